@@ -0,0 +1,101 @@
+//******************************************************************************
+///
+/// @file platform/unix/syspovdirectory.cpp
+///
+/// Unix-specific implementation of directory listing.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "base/fileinputoutput.h"
+
+#if !POV_USE_DEFAULT_DIRECTORY_LISTING
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_base
+{
+
+//******************************************************************************
+
+#if !POV_USE_DEFAULT_DIRECTORY_LISTING
+
+static bool StatDirectory(const std::string& dir, POV_LONG& stamp)
+{
+    struct stat info;
+
+    if ((stat(dir.c_str(), &info) != 0) || !S_ISDIR(info.st_mode))
+        return false;
+
+#ifdef HAVE_STRUCT_STAT_ST_MTIM
+    stamp = POV_LONG(info.st_mtim.tv_sec) * 1000000000 + info.st_mtim.tv_nsec;
+#else
+    stamp = POV_LONG(info.st_mtime) * 1000000000;
+#endif
+    return true;
+}
+
+bool ReadDirectory(const UCS2String& dir, std::vector<UCS2String>& names, POV_LONG& stamp)
+{
+    std::string name(dir.empty() ? std::string(".") : UCS2toASCIIString(dir));
+    POV_LONG after;
+
+    if (!StatDirectory(name, stamp))
+        return false;
+
+    DIR *handle = opendir(name.c_str());
+    if (handle == nullptr)
+        return false;
+
+    names.clear();
+    for (struct dirent *entry = readdir(handle); entry != nullptr; entry = readdir(handle))
+        names.push_back(ASCIItoUCS2String(entry->d_name));
+
+    closedir(handle);
+
+    // a directory modified while being read may have been listed partially
+    return StatDirectory(name, after) && (after == stamp);
+}
+
+bool GetDirectoryStamp(const UCS2String& dir, POV_LONG& stamp)
+{
+    return StatDirectory(dir.empty() ? std::string(".") : UCS2toASCIIString(dir), stamp);
+}
+
+#endif // !POV_USE_DEFAULT_DIRECTORY_LISTING
+
+//******************************************************************************
+
+}
@@ -0,0 +1,180 @@
+//******************************************************************************
+///
+/// @file platform/unix/syspovfilemapping.cpp
+///
+/// Unix-specific implementation of the @ref pov_base::MappedFile class.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#include "syspovfilemapping.h"
+
+#include <fcntl.h>
+
+#include <limits>
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
+#include <sys/stat.h>
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_base
+{
+
+//******************************************************************************
+
+#if !POV_USE_DEFAULT_FILE_MAPPING
+
+MappedFile::MappedFile() :
+    mData(nullptr),
+    mSize(0)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const char *name)
+{
+    Close();
+
+    int fd = open(name, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if ((fstat(fd, &info) == 0) && (info.st_size > 0))
+    {
+        void *data = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            mData = data;
+            mSize = info.st_size;
+        }
+    }
+
+    // the mapping remains valid after the file is closed
+    close(fd);
+    return (mData != nullptr);
+}
+
+void MappedFile::Close()
+{
+    if (mData != nullptr)
+        munmap(mData, mSize);
+    mData = nullptr;
+    mSize = 0;
+}
+
+void MappedFile::Prefetch()
+{
+#ifdef MADV_WILLNEED
+    // have the kernel read the file ahead in bulk rather than fault it in page by page,
+    // which matters on network file systems; this is only a hint, so we don't care whether
+    // the kernel takes it
+    if (mData != nullptr)
+        (void)madvise(mData, mSize, MADV_WILLNEED);
+#endif
+}
+
+#endif // !POV_USE_DEFAULT_FILE_MAPPING
+
+//******************************************************************************
+
+#if !POV_USE_DEFAULT_WRITABLE_FILE_MAPPING
+
+WritableMappedFile::WritableMappedFile() :
+    mData(nullptr),
+    mSize(0)
+{
+}
+
+WritableMappedFile::~WritableMappedFile()
+{
+    Close();
+}
+
+bool WritableMappedFile::Open(int fd, POV_OFF_T size)
+{
+    Close();
+
+    // refuse to map anything that doesn't fit the address space (e.g. on 32-bit systems)
+    if ((size <= 0) || ((POV_ULONG)(size) > (POV_ULONG)(std::numeric_limits<size_t>::max())))
+        return false;
+
+    void *data = mmap(nullptr, size_t(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+        return false;
+
+    mData = data;
+    mSize = size_t(size);
+    return true;
+}
+
+void WritableMappedFile::Close()
+{
+    if (mData != nullptr)
+        munmap(mData, mSize);
+    mData = nullptr;
+    mSize = 0;
+}
+
+void WritableMappedFile::Advise(AccessPattern pattern)
+{
+#ifdef MADV_NORMAL
+    if (mData == nullptr)
+        return;
+
+    int advice;
+    switch (pattern)
+    {
+        case kAccessRandom:     advice = MADV_RANDOM;       break;
+        case kAccessSequential: advice = MADV_SEQUENTIAL;   break;
+        default:                advice = MADV_NORMAL;       break;
+    }
+    // this is only a hint, so we don't care whether the kernel takes it
+    (void)madvise(mData, mSize, advice);
+#endif
+}
+
+#endif // !POV_USE_DEFAULT_WRITABLE_FILE_MAPPING
+
+//******************************************************************************
+
+}
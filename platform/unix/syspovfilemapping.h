@@ -0,0 +1,115 @@
+//******************************************************************************
+///
+/// @file platform/unix/syspovfilemapping.h
+///
+/// Unix-specific declaration of the @ref pov_base::MappedFile class.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_UNIX_SYSPOVFILEMAPPING_H
+#define POVRAY_UNIX_SYSPOVFILEMAPPING_H
+
+#include "base/configbase.h"
+
+namespace pov_base
+{
+
+#if !POV_USE_DEFAULT_FILE_MAPPING
+
+/// Read-only view of an entire file's contents.
+///
+/// This is the Unix-specific implementation of the memory-mapped file required by POV-Ray.
+/// The file is mapped shared and read-only, so that multiple processes mapping the same file
+/// share the same physical memory.
+///
+class MappedFile
+{
+    public:
+
+        MappedFile();
+        ~MappedFile();
+
+        bool Open(const char *name);
+        void Close();
+
+        inline const void *GetData() const { return mData; }
+        inline size_t GetSize() const { return mSize; }
+
+        void Prefetch();
+
+    private:
+
+        void *mData;
+        size_t mSize;
+};
+
+#endif // !POV_USE_DEFAULT_FILE_MAPPING
+
+#if !POV_USE_DEFAULT_WRITABLE_FILE_MAPPING
+
+/// Read-write view of a portion of an already open file.
+///
+/// This is the Unix-specific implementation of the writable memory-mapped file required by
+/// POV-Ray. The file is mapped shared, so that modifications end up in the file itself, and
+/// access pattern hints are passed on to the kernel via `madvise()` where available.
+///
+class WritableMappedFile
+{
+    public:
+
+        enum AccessPattern
+        {
+            kAccessNormal,
+            kAccessRandom,
+            kAccessSequential,
+        };
+
+        WritableMappedFile();
+        ~WritableMappedFile();
+
+        bool Open(int fd, POV_OFF_T size);
+        void Close();
+
+        void Advise(AccessPattern pattern);
+
+        inline void *GetData() const { return mData; }
+        inline size_t GetSize() const { return mSize; }
+
+    private:
+
+        void *mData;
+        size_t mSize;
+};
+
+#endif // !POV_USE_DEFAULT_WRITABLE_FILE_MAPPING
+
+}
+
+#endif // POVRAY_UNIX_SYSPOVFILEMAPPING_H
@@ -0,0 +1,105 @@
+//******************************************************************************
+///
+/// @file platform/unix/syspovtask.cpp
+///
+/// Unix-specific partial implementation of the @ref Task class.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#include "backend/support/task.h"
+
+#if !POV_USE_DEFAULT_TASK_AFFINITY
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+//******************************************************************************
+
+#if !POV_USE_DEFAULT_TASK_AFFINITY
+
+/// The CPUs the process may run on, as inherited by every thread.
+static const cpu_set_t& ProcessCPUs()
+{
+    struct Mask
+    {
+        cpu_set_t set;
+        Mask()
+        {
+            CPU_ZERO(&set);
+            if (sched_getaffinity(0, sizeof(set), &set) != 0)
+                CPU_ZERO(&set);
+        }
+    };
+
+    // first called from a thread that isn't bound yet
+    static const Mask mask;
+    return mask.set;
+}
+
+void Task::BindToCPU (int cpu)
+{
+    const cpu_set_t& allowed = ProcessCPUs();
+    int count = CPU_COUNT(&allowed);
+    cpu_set_t set;
+
+    if (count == 0)
+        return;
+
+    if (cpu < 0)
+        set = allowed;
+    else
+    {
+        // map the index to the n-th CPU the process may use, e.g. under `taskset`
+        int n = cpu % count;
+        CPU_ZERO(&set);
+        for (int i = 0; i < CPU_SETSIZE; i++)
+        {
+            if (CPU_ISSET(i, &allowed) && (n-- == 0))
+            {
+                CPU_SET(i, &set);
+                break;
+            }
+        }
+    }
+
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+#endif // !POV_USE_DEFAULT_TASK_AFFINITY
+
+//******************************************************************************
+
+}
@@ -34,7 +34,8 @@
 ///
 //******************************************************************************
 
-#include "syspovtimer.h"
+// syspovtimer.h relies on declarations from base/timer.h, which in turn pulls in syspovtimer.h
+#include "base/timer.h"
 
 #include <ctime>
 
@@ -50,6 +51,12 @@
 #include <sys/time.h>
 #endif
 
+#if !POV_USE_DEFAULT_HARDWARE_COUNTERS
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
 #include "base/types.h"
 
 // this must be the last file included
@@ -304,4 +311,76 @@ bool Timer::HasValidThreadCPUTime () const
 
 //******************************************************************************
 
+#if !POV_USE_DEFAULT_HARDWARE_COUNTERS
+
+/// Event of each @ref HardwareCounter.
+static const POV_ULONG kHardwareCounterEvent[kHardwareCounterCount] =
+{
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+HardwareCounters::HardwareCounters()
+{
+    for (int i = 0; i < kHardwareCounterCount; ++i)
+    {
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.size           = sizeof(attr);
+        attr.config         = kHardwareCounterEvent[i];
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        // with more counters than the hardware provides, the kernel takes turns; we then scale up the counts
+        attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        // count the calling thread, on whatever CPU it runs
+        mFd[i] = int(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    Reset();
+}
+
+HardwareCounters::~HardwareCounters()
+{
+    for (int i = 0; i < kHardwareCounterCount; ++i)
+        if (mFd[i] >= 0)
+            close(mFd[i]);
+}
+
+bool HardwareCounters::Read(HardwareCounter counter, POV_ULONG& value) const
+{
+    POV_UINT64 data[3]; // value, time enabled, time running
+
+    if ((mFd[counter] < 0) || (read(mFd[counter], data, sizeof(data)) != sizeof(data)))
+        return false;
+
+    if ((data[2] > 0) && (data[2] < data[1]))
+        value = static_cast<POV_ULONG>(double(data[0]) * double(data[1]) / double(data[2]));
+    else
+        value = data[0];
+    return true;
+}
+
+POV_LONG HardwareCounters::Elapsed(HardwareCounter counter) const
+{
+    POV_ULONG value;
+    if (!Read(counter, value))
+        return -1;
+    return static_cast<POV_LONG>(value - mStart[counter]);
+}
+
+void HardwareCounters::Reset()
+{
+    for (int i = 0; i < kHardwareCounterCount; ++i)
+        if (!Read(HardwareCounter(i), mStart[i]))
+            mStart[i] = 0;
+}
+
+#endif // !POV_USE_DEFAULT_HARDWARE_COUNTERS
+
+//******************************************************************************
+
 }
@@ -104,6 +104,43 @@ class Timer
 
 #endif // !POV_USE_DEFAULT_TIMER
 
+
+#if !POV_USE_DEFAULT_HARDWARE_COUNTERS
+
+/// Hardware performance counters of the current thread.
+///
+/// This is the Linux-specific implementation, based on `perf_event_open()`. Only events caused
+/// in user space are counted. Counters the kernel refuses to set up, e.g. because of the
+/// `kernel.perf_event_paranoid` setting or on a virtual machine without access to the
+/// performance monitoring unit, are reported as unsupported.
+///
+class HardwareCounters
+{
+    public:
+
+        HardwareCounters();
+        ~HardwareCounters();
+
+        POV_LONG Elapsed(HardwareCounter counter) const;
+
+        void Reset();
+
+    private:
+
+        int mFd[kHardwareCounterCount];             ///< File descriptor of each counter, or -1.
+        POV_ULONG mStart[kHardwareCounterCount];    ///< Count of each counter at the last reset.
+
+        bool Read(HardwareCounter counter, POV_ULONG& value) const;
+
+        /// not available
+        HardwareCounters(const HardwareCounters&);
+
+        /// not available
+        HardwareCounters& operator=(const HardwareCounters&);
+};
+
+#endif // !POV_USE_DEFAULT_HARDWARE_COUNTERS
+
 }
 
 #endif // POVRAY_UNIX_SYSPOVTIMER_H
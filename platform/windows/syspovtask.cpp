@@ -113,6 +113,24 @@ void Task::Cleanup ()
 
 #endif // !POV_USE_DEFAULT_TASK_CLEANUP
 
+#if !POV_USE_DEFAULT_TASK_AFFINITY
+
+void Task::BindToCPU (int cpu)
+{
+    DWORD_PTR processMask;
+    DWORD_PTR systemMask;
+
+    if (!GetProcessAffinityMask (GetCurrentProcess(), &processMask, &systemMask))
+        return;
+    // TODO - if numCPUs > 64, we need to do more than this
+    if ((cpu >= 0) && (cpu < int(sizeof(DWORD_PTR) * 8)) && ((processMask >> cpu) & 1))
+        SetThreadAffinityMask (GetCurrentThread(), DWORD_PTR(1) << cpu);
+    else
+        SetThreadAffinityMask (GetCurrentThread(), processMask);
+}
+
+#endif // !POV_USE_DEFAULT_TASK_AFFINITY
+
 //******************************************************************************
 
 }
@@ -0,0 +1,94 @@
+//******************************************************************************
+///
+/// @file platform/x86/avx/avxflatbvh.cpp
+///
+/// This file contains the implementation of the flattened bounding hierarchy
+/// node test optimized for the AVX instruction set.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "avxflatbvh.h"
+
+#include <cfloat>
+
+#ifdef MACHINE_INTRINSICS_H
+#include MACHINE_INTRINSICS_H
+#endif
+
+/// @file
+/// @attention
+///     This file **must not** contain any code that might get called before CPU
+///     support for this optimized implementation has been confirmed. Most
+///     notably, the function to detect support itself must not reside in this
+///     file.
+
+#ifdef TRY_OPTIMIZED_BVH_AVX
+
+namespace pov
+{
+
+#ifndef DISABLE_OPTIMIZED_BVH_AVX
+
+const bool kAVXFlatBVHEnabled = true;
+
+// This mirrors @ref PortableFlatBVHNodeTest() operation by operation, so that
+// both implementations produce identical results.
+unsigned int AVXFlatBVHNodeTest(const FlatBVH::Node& node, const FlatBVH::RayData& ray, float maxDist, float *entryDist)
+{
+    __m128 tnear = _mm_set1_ps(-FLT_MAX);
+    __m128 tfar  = _mm_set1_ps(maxDist);
+
+    for (int dim = 0; dim < 3; ++dim)
+    {
+        __m128 origin = _mm_set1_ps(ray.origin[dim]);
+        __m128 invDir = _mm_set1_ps(ray.invDirection[dim]);
+        __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.bounds[ray.nearRow[dim]]), origin), invDir);
+        __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.bounds[ray.farRow[dim]]),  origin), invDir);
+        tnear = _mm_max_ps(t0, tnear);
+        tfar  = _mm_min_ps(t1, tfar);
+    }
+
+    _mm_storeu_ps(entryDist, tnear);
+
+    __m128 hit = _mm_and_ps(_mm_cmple_ps(tnear, tfar), _mm_cmpge_ps(tfar, _mm_set1_ps(float(EPSILON))));
+    return _mm_movemask_ps(hit);
+}
+
+#else // DISABLE_OPTIMIZED_BVH_AVX
+
+const bool kAVXFlatBVHEnabled = false;
+unsigned int AVXFlatBVHNodeTest(const FlatBVH::Node& node, const FlatBVH::RayData& ray, float maxDist, float *entryDist) { POV_ASSERT(false); return 0; }
+
+#endif // DISABLE_OPTIMIZED_BVH_AVX
+
+}
+
+#endif // TRY_OPTIMIZED_BVH_AVX
@@ -130,7 +130,7 @@ static inline __m256d permute4x64_functional(const __m256d& x, int i)
 
 
 
-extern DBL RTable[];
+extern const DBL RTable[];
 
 ALIGN32 static AVXTABLETYPE AVXRTable[267];
 
@@ -519,12 +519,26 @@ void AVXDNoise(Vector3d& result, const Vector3d& EPoint)
 
 }
 
+void AVXMultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator)
+{
+    for (int i = 0; i < count; ++i)
+        results[i] = AVXNoise(EPoints[i], noise_generator);
+}
+
+void AVXMultiDNoise(Vector3d* results, const Vector3d* EPoints, int count)
+{
+    for (int i = 0; i < count; ++i)
+        AVXDNoise(results[i], EPoints[i]);
+}
+
 #else // DISABLE_OPTIMIZED_NOISE_AVX
 
 const bool kAVXNoiseEnabled = false;
 void AVXNoiseInit() { POV_ASSERT(false); }
 DBL AVXNoise(const Vector3d& EPoint, int noise_generator) { POV_ASSERT(false); return 0.0; }
 void AVXDNoise(Vector3d& result, const Vector3d& EPoint) { POV_ASSERT(false); }
+void AVXMultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator) { POV_ASSERT(false); }
+void AVXMultiDNoise(Vector3d* results, const Vector3d* EPoints, int count) { POV_ASSERT(false); }
 
 #endif // DISABLE_OPTIMIZED_NOISE_AVX
 
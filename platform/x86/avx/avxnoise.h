@@ -57,6 +57,12 @@ DBL AVXNoise(const Vector3d& EPoint, int noise_generator);
 /// @author Optimized by Intel
 void AVXDNoise(Vector3d& result, const Vector3d& EPoint);
 
+/// Batched Noise function using AVX instructions.
+void AVXMultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator);
+
+/// Batched DNoise function using AVX instructions.
+void AVXMultiDNoise(Vector3d* results, const Vector3d* EPoints, int count);
+
 }
 
 #endif // TRY_OPTIMIZED_NOISE_AVX
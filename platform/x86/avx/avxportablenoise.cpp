@@ -59,6 +59,8 @@ const bool kAVXPortableNoiseEnabled = true;
 #define PORTABLE_OPTIMIZED_NOISE
 #define PortableNoise  AVXPortableNoise
 #define PortableDNoise AVXPortableDNoise
+#define PortableMultiNoise  AVXPortableMultiNoise
+#define PortableMultiDNoise AVXPortableMultiDNoise
 #include "core/material/portablenoise.cpp" // pulls in the actual code
 
 #else // DISABLE_OPTIMIZED_NOISE_AVX_PORTABLE
@@ -68,6 +70,8 @@ namespace pov
 const bool kAVXPortableNoiseEnabled = false;
 DBL AVXPortableNoise(const Vector3d& EPoint, int noise_generator) { POV_ASSERT(false); return 0.0; }
 void AVXPortableDNoise(Vector3d& result, const Vector3d& EPoint) { POV_ASSERT(false); }
+void AVXPortableMultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator) { POV_ASSERT(false); }
+void AVXPortableMultiDNoise(Vector3d* results, const Vector3d* EPoints, int count) { POV_ASSERT(false); }
 }
 
 #endif // DISABLE_OPTIMIZED_NOISE_AVX_PORTABLE
@@ -51,6 +51,10 @@ DBL AVXPortableNoise(const Vector3d& EPoint, int noise_generator);
 
 void AVXPortableDNoise(Vector3d& result, const Vector3d& EPoint);
 
+void AVXPortableMultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator);
+
+void AVXPortableMultiDNoise(Vector3d* results, const Vector3d* EPoints, int count);
+
 }
 
 #endif // TRY_OPTIMIZED_NOISE_AVX_PORTABLE
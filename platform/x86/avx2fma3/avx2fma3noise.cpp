@@ -117,7 +117,7 @@ const bool kAVX2FMA3NoiseEnabled = true;
 
 
 
-extern DBL RTable[];
+extern const DBL RTable[];
 
 ALIGN32 static AVX2TABLETYPE AVX2RTable[267];
 
@@ -506,12 +506,26 @@ void AVX2FMA3DNoise(Vector3d& result, const Vector3d& EPoint)
 
 }
 
+void AVX2FMA3MultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator)
+{
+    for (int i = 0; i < count; ++i)
+        results[i] = AVX2FMA3Noise(EPoints[i], noise_generator);
+}
+
+void AVX2FMA3MultiDNoise(Vector3d* results, const Vector3d* EPoints, int count)
+{
+    for (int i = 0; i < count; ++i)
+        AVX2FMA3DNoise(results[i], EPoints[i]);
+}
+
 #else // DISABLE_OPTIMIZED_NOISE_AVX2FMA3
 
 const bool kAVX2FMA3NoiseEnabled = false;
 void AVX2FMA3NoiseInit() { POV_ASSERT(false); }
 DBL AVX2FMA3Noise(const Vector3d& EPoint, int noise_generator) { POV_ASSERT(false); return 0.0; }
 void AVX2FMA3DNoise(Vector3d& result, const Vector3d& EPoint) { POV_ASSERT(false); }
+void AVX2FMA3MultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator) { POV_ASSERT(false); }
+void AVX2FMA3MultiDNoise(Vector3d* results, const Vector3d* EPoints, int count) { POV_ASSERT(false); }
 
 #endif // DISABLE_OPTIMIZED_NOISE_AVX2FMA3
 
@@ -57,6 +57,12 @@ DBL AVX2FMA3Noise(const Vector3d& EPoint, int noise_generator);
 /// @author Optimized by Intel
 void AVX2FMA3DNoise(Vector3d& result, const Vector3d& EPoint);
 
+/// Batched Noise function using AVX2 and FMA3 instructions.
+void AVX2FMA3MultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator);
+
+/// Batched DNoise function using AVX2 and FMA3 instructions.
+void AVX2FMA3MultiDNoise(Vector3d* results, const Vector3d* EPoints, int count);
+
 }
 
 #endif // TRY_OPTIMIZED_NOISE_AVX2FMA3
@@ -68,7 +68,7 @@ namespace pov
 
 const bool kAVXFMA4NoiseEnabled = true;
 
-extern DBL RTable[];
+extern const DBL RTable[];
 
 #define INCRSUMP2(mpA, mpB, s, x, y, z, sum)  \
     mp_t1 = _mm_loadu_pd(mpA + 1); \
@@ -119,7 +119,7 @@ extern DBL RTable[];
 DBL AVXFMA4Noise(const Vector3d& EPoint, int noise_generator)
 {
     DBL x, y, z;
-    DBL *mp;
+    const DBL *mp;
     int ix, iy, iz;
     int ixiy_hash, ixjy_hash, jxiy_hash, jxjy_hash;
     DBL sum;
@@ -408,11 +408,25 @@ void AVXFMA4DNoise(Vector3d& result, const Vector3d& EPoint)
     _mm_store_sd(&result[Z], sum__Z);
 }
 
+void AVXFMA4MultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator)
+{
+    for (int i = 0; i < count; ++i)
+        results[i] = AVXFMA4Noise(EPoints[i], noise_generator);
+}
+
+void AVXFMA4MultiDNoise(Vector3d* results, const Vector3d* EPoints, int count)
+{
+    for (int i = 0; i < count; ++i)
+        AVXFMA4DNoise(results[i], EPoints[i]);
+}
+
 #else // DISABLE_OPTIMIZED_NOISE_AVXFMA4
 
 const bool kAVXFMA4NoiseEnabled = false;
 DBL AVXFMA4Noise(const Vector3d& EPoint, int noise_generator) { POV_ASSERT(false); return 0.0; }
 void AVXFMA4DNoise(Vector3d& result, const Vector3d& EPoint) { POV_ASSERT(false); }
+void AVXFMA4MultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator) { POV_ASSERT(false); }
+void AVXFMA4MultiDNoise(Vector3d* results, const Vector3d* EPoints, int count) { POV_ASSERT(false); }
 
 #endif // DISABLE_OPTIMIZED_NOISE_AVXFMA4
 
@@ -55,6 +55,12 @@ DBL AVXFMA4Noise(const Vector3d& EPoint, int noise_generator);
 /// @author Optimized by AMD
 void AVXFMA4DNoise(Vector3d& result, const Vector3d& EPoint);
 
+/// Batched Noise function using AVX and FMA4 instructions.
+void AVXFMA4MultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator);
+
+/// Batched DNoise function using AVX and FMA4 instructions.
+void AVXFMA4MultiDNoise(Vector3d* results, const Vector3d* EPoints, int count);
+
 }
 
 #endif // TRY_OPTIMIZED_NOISE_AVXFMA4
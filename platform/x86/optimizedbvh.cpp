@@ -0,0 +1,76 @@
+//******************************************************************************
+///
+/// @file platform/x86/optimizedbvh.cpp
+///
+/// Implementations related to the dynamic dispatch of the optimized flattened
+/// bounding hierarchy node test implementations for the x86 family of CPUs.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "optimizedbvh.h"
+
+#include "core/bounding/flatbvh.h"
+
+#ifdef TRY_OPTIMIZED_BVH_AVX
+#include "avx/avxflatbvh.h"
+#endif
+
+#include "cpuid.h"
+
+#ifdef TRY_OPTIMIZED_BVH
+
+namespace pov
+{
+
+static bool AVXSupported() { return CPUInfo::SupportsAVX(); }
+
+/// List of optimized flattened bounding hierarchy node test implementations.
+///
+/// @note
+///     Entries must be listed in descending order of preference.
+///
+OptimizedFlatBVHInfo gaOptimizedFlatBVHInfo[] = {
+#ifdef TRY_OPTIMIZED_BVH_AVX
+    {
+        "avx-generic",              // name,
+        "SSE-style 4-wide box test, VEX-encoded", // info,
+        AVXFlatBVHNodeTest,         // nodeTest,
+        &kAVXFlatBVHEnabled,        // enabled,
+        AVXSupported                // supported
+    },
+#endif
+    // End-of-list entry.
+    { nullptr }
+};
+
+}
+
+#endif // TRY_OPTIMIZED_BVH
@@ -78,6 +78,8 @@ OptimizedNoiseInfo gaOptimizedNoiseInfo[] = {
         "hand-optimized by Intel",  // info,
         AVX2FMA3Noise,              // noise,
         AVX2FMA3DNoise,             // dNoise,
+        AVX2FMA3MultiNoise,         // multiNoise,
+        AVX2FMA3MultiDNoise,        // multiDNoise,
         &kAVX2FMA3NoiseEnabled,     // enabled,
         AVX2FMA3Supported,          // supported,
         CPUInfo::IsIntel,           // recommended,
@@ -90,6 +92,8 @@ OptimizedNoiseInfo gaOptimizedNoiseInfo[] = {
         "hand-optimized by AMD, 2017-04 update", // info,
         AVXFMA4Noise,               // noise,
         AVXFMA4DNoise,              // dNoise,
+        AVXFMA4MultiNoise,          // multiNoise,
+        AVXFMA4MultiDNoise,         // multiDNoise,
         &kAVXFMA4NoiseEnabled,      // enabled,
         AVXFMA4Supported,           // supported,
         nullptr,                    // recommended,
@@ -102,6 +106,8 @@ OptimizedNoiseInfo gaOptimizedNoiseInfo[] = {
         "hand-optimized by Intel",  // info,
         AVXNoise,                   // noise,
         AVXDNoise,                  // dNoise,
+        AVXMultiNoise,              // multiNoise,
+        AVXMultiDNoise,             // multiDNoise,
         &kAVXNoiseEnabled,          // enabled,
         AVXSupported,               // supported,
         CPUInfo::IsIntel,           // recommended,
@@ -114,6 +120,8 @@ OptimizedNoiseInfo gaOptimizedNoiseInfo[] = {
         "compiler-optimized",       // info,
         AVXPortableNoise,           // noise,
         AVXPortableDNoise,          // dNoise,
+        AVXPortableMultiNoise,      // multiNoise,
+        AVXPortableMultiDNoise,     // multiDNoise,
         &kAVXPortableNoiseEnabled,  // enabled,
         AVXSupported,               // supported,
         nullptr,                    // recommended,
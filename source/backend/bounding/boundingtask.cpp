@@ -33,6 +33,7 @@
 ///
 //******************************************************************************
 
+#include <list>
 #include <set>
 
 #include <boost/bind.hpp>
@@ -42,7 +43,12 @@
 #include "backend/frame.h"
 #include "backend/bounding/boundingtask.h"
 
+#include "core/bounding/boundingbox.h"
 #include "core/bounding/bsptree.h"
+#include "core/bounding/flatbvh.h"
+#include "core/bounding/projectionbuffer.h"
+#include "core/lighting/lightsource.h"
+#include "core/lighting/lighttree.h"
 #include "core/math/matrix.h"
 #include "core/scene/object.h"
 #include "core/scene/tracethreaddata.h"
@@ -58,6 +64,21 @@
 namespace pov
 {
 
+// Factor by which the cost of a refitted bounding box hierarchy may exceed that of the
+// hierarchy as originally built before it is rebuilt from scratch.
+const DBL BBOX_REFIT_MAX_COST_RATIO = 1.5;
+
+// Maximum number of bounding box hierarchy topologies kept for refitting; enough for a few
+// animations rendered concurrently, without growing in sessions rendering many scenes.
+const size_t BBOX_REFIT_CACHE_SIZE = 4;
+
+// Bounding box hierarchy topologies carried over between the frames of an animation,
+// by input file and bounding method, most recently used first.
+typedef std::pair<UCS2String, int> RefitCacheKey;
+typedef std::list<std::pair<RefitCacheKey, BBoxTreeTopology> > RefitCache;
+static RefitCache gRefitCache;
+static boost::mutex gRefitCacheMutex;
+
 class SceneObjects : public BSPTree::Objects
 {
     public:
@@ -161,6 +182,8 @@ void BoundingTask::Run()
         sceneData->boundingMethod = 0;
         sceneData->numberOfFiniteObjects = objects.finite.size();
         sceneData->numberOfInfiniteObjects = objects.infinite.size() - objects.numLights;
+        BuildProjectionBuffers();
+        BuildLightSourceTree();
         return;
     }
 
@@ -181,19 +204,146 @@ void BoundingTask::Run()
             sceneData->tree->build(progress, objects,
                                    sceneData->nodes, sceneData->splitNodes, sceneData->objectNodes, sceneData->emptyNodes,
                                    sceneData->maxObjects, sceneData->averageObjects, sceneData->maxDepth, sceneData->averageDepth,
-                                   sceneData->aborts, sceneData->averageAborts, sceneData->averageAbortObjects, sceneData->inputFile);
+                                   sceneData->aborts, sceneData->averageAborts, sceneData->averageAbortObjects, sceneData->inputFile,
+                                   sceneData->bspBuildThreads, sceneData->bspCacheFile);
+            sceneData->tree->GetStatistics(sceneData->bboxTreeStats);
             break;
         }
         case 1:
         {
             // old bounding box code
-            unsigned int numberOfLightSources;
-
-            Build_Bounding_Slabs(&(sceneData->boundingSlabs), sceneData->objects, sceneData->numberOfFiniteObjects,
-                                 sceneData->numberOfInfiniteObjects, numberOfLightSources);
+            BuildBoundingHierarchy(kBBoxTreeBuild_Slabs);
+            break;
+        }
+        case 3:
+        {
+            // bounding box hierarchy built using the surface area heuristic
+            BuildBoundingHierarchy(kBBoxTreeBuild_BinnedSAH);
+            break;
+        }
+        case 4:
+        {
+            // surface area heuristic hierarchy, flattened into 4-wide nodes for traversal
+            BuildBoundingHierarchy(kBBoxTreeBuild_BinnedSAH);
+            if (sceneData->boundingSlabs != nullptr)
+                sceneData->flatBVH = new FlatBVH(sceneData->boundingSlabs, false, sceneData->floatPrefilter);
+            break;
+        }
+        case 5:
+        {
+            // surface area heuristic hierarchy, flattened into compressed 4-wide nodes; the
+            // original hierarchy is discarded to save memory
+            BuildBoundingHierarchy(kBBoxTreeBuild_BinnedSAH);
+            if (sceneData->boundingSlabs != nullptr)
+            {
+                sceneData->flatBVH = new FlatBVH(sceneData->boundingSlabs, true, sceneData->floatPrefilter);
+                Destroy_BBox_Tree(sceneData->boundingSlabs);
+                sceneData->boundingSlabs = nullptr;
+            }
             break;
         }
     }
+
+    BuildProjectionBuffers();
+    BuildLightSourceTree();
+}
+
+void BoundingTask::BuildBoundingHierarchy(BBoxTreeBuildMethod method)
+{
+    RefitCacheKey key(sceneData->inputFile, sceneData->boundingMethod);
+    BBoxTreeTopology topology;
+    unsigned int numberOfLightSources;
+    bool haveTopology = false;
+
+    if(sceneData->boundingRefit)
+    {
+        boost::mutex::scoped_lock lock(gRefitCacheMutex);
+
+        for(RefitCache::const_iterator i = gRefitCache.begin(); i != gRefitCache.end(); i++)
+        {
+            if(i->first == key)
+            {
+                topology = i->second;
+                haveTopology = true;
+                break;
+            }
+        }
+    }
+
+    if(haveTopology && Refit_BBox_Tree(&(sceneData->boundingSlabs), sceneData->objects, topology,
+                                       sceneData->numberOfFiniteObjects, sceneData->numberOfInfiniteObjects))
+    {
+        Get_BBox_Tree_Statistics(sceneData->boundingSlabs, sceneData->bboxTreeStats);
+
+        // Objects moving apart from their original neighbours degrade the hierarchy; once it
+        // has become notably more expensive to traverse than when it was built, start afresh.
+        if(sceneData->bboxTreeStats.cost <= topology.builtCost * BBOX_REFIT_MAX_COST_RATIO)
+        {
+            sceneData->bboxTreeRefitted = true;
+            return;
+        }
+
+        Destroy_BBox_Tree(sceneData->boundingSlabs);
+        sceneData->boundingSlabs = nullptr;
+    }
+
+    Build_Bounding_Slabs(&(sceneData->boundingSlabs), sceneData->objects, sceneData->numberOfFiniteObjects,
+                         sceneData->numberOfInfiniteObjects, numberOfLightSources, method);
+    Get_BBox_Tree_Statistics(sceneData->boundingSlabs, sceneData->bboxTreeStats);
+
+    if(sceneData->boundingRefit)
+    {
+        Get_BBox_Tree_Topology(sceneData->boundingSlabs, sceneData->objects, topology);
+
+        boost::mutex::scoped_lock lock(gRefitCacheMutex);
+
+        for(RefitCache::iterator i = gRefitCache.begin(); i != gRefitCache.end(); i++)
+        {
+            if(i->first == key)
+            {
+                gRefitCache.erase(i);
+                break;
+            }
+        }
+
+        gRefitCache.push_front(RefitCache::value_type(key, BBoxTreeTopology()));
+        gRefitCache.front().second.nodes.swap(topology.nodes);
+        gRefitCache.front().second.elementTypes.swap(topology.elementTypes);
+        gRefitCache.front().second.builtCost = topology.builtCost;
+
+        if(gRefitCache.size() > BBOX_REFIT_CACHE_SIZE)
+            gRefitCache.pop_back();
+    }
+}
+
+void BoundingTask::BuildProjectionBuffers()
+{
+    if(sceneData->useLightBuffer)
+    {
+        sceneData->lightBuffers.assign(sceneData->lightSources.size(), nullptr);
+
+        // Only shadow rays from point-like light sources all end at the same point; fill lights
+        // cast no shadows to begin with.
+        for(size_t i = 0; i < sceneData->lightSources.size(); i++)
+        {
+            const LightSource *light = sceneData->lightSources[i];
+
+            if(((light->Light_Type == POINT_SOURCE) || (light->Light_Type == SPOT_SOURCE)) &&
+               (light->Parallel == false) && (light->Area_Light == false))
+                sceneData->lightBuffers[i] = new ProjectionBuffer(light->Center, sceneData->objects);
+
+            Cooperate();
+        }
+    }
+
+    if(sceneData->useVistaBuffer)
+        sceneData->vistaBuffer = new ProjectionBuffer(sceneData->parsedCamera.Location, sceneData->objects);
+}
+
+void BoundingTask::BuildLightSourceTree()
+{
+    if(sceneData->lightCutoff > 0.0)
+        sceneData->lightSourceTree = new LightSourceTree(sceneData->lightSources, sceneData->lightCutoff);
 }
 
 void BoundingTask::Stopped()
@@ -205,6 +355,7 @@ void BoundingTask::Finish()
     GetSceneDataPtr()->timeType = TraceThreadData::kBoundingTime;
     GetSceneDataPtr()->realTime = ConsumedRealTime();
     GetSceneDataPtr()->cpuTime = ConsumedCPUTime();
+    ConsumedHardwareCounts(GetSceneDataPtr()->hardwareCounts);
 }
 
 void BoundingTask::SendFatalError(Exception& e)
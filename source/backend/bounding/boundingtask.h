@@ -41,6 +41,8 @@
 #include "backend/frame.h"
 #include "backend/render/rendertask.h"
 
+#include "core/bounding/boundingbox.h"
+
 namespace pov
 {
 
@@ -64,6 +66,9 @@ class BoundingTask : public SceneTask
         shared_ptr<BackendSceneData> sceneData;
         unsigned int boundingThreshold;
 
+        void BuildBoundingHierarchy(BBoxTreeBuildMethod method);
+        void BuildProjectionBuffers();
+        void BuildLightSourceTree();
         void SendFatalError(pov_base::Exception& e);
 };
 
@@ -76,6 +76,16 @@
     #define POV_USE_DEFAULT_TASK_CLEANUP 1
 #endif
 
+/// @def POV_USE_DEFAULT_TASK_AFFINITY
+/// Whether to use a default implementation for binding task threads to CPUs.
+///
+/// Define as non-zero to use a default implementation for the @ref pov::Task::BindToCPU() method, which ignores
+/// the request, or zero if the platform provides its own implementation.
+///
+#ifndef POV_USE_DEFAULT_TASK_AFFINITY
+    #define POV_USE_DEFAULT_TASK_AFFINITY 1
+#endif
+
 /// @def POV_THREAD_STACK_SIZE
 /// Default thread stack size.
 ///
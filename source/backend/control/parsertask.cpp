@@ -86,6 +86,7 @@ void ParserTask::Finish()
         mpParser->GetParserDataPtr()->timeType  = TraceThreadData::kParseTime;
         mpParser->GetParserDataPtr()->realTime  = ConsumedRealTime();
         mpParser->GetParserDataPtr()->cpuTime   = ConsumedCPUTime();
+        ConsumedHardwareCounts(mpParser->GetParserDataPtr()->hardwareCounts);
         mpParser->Finish();
         mpParser.reset();
     }
@@ -89,7 +89,7 @@ RenderBackend::~RenderBackend()
 
 void RenderBackend::SendSceneOutput(SceneId sid, POVMSAddress addr, POVMSType ident, POVMS_Object& obj)
 {
-    POVMS_Message msg(obj, kPOVMsgClass_SceneOutput, ident);
+    POVMS_Message msg(std::move(obj), kPOVMsgClass_SceneOutput, ident);
 
     msg.SetInt(kPOVAttrib_SceneId, sid);
     msg.SetDestinationAddress(addr);
@@ -99,7 +99,7 @@ void RenderBackend::SendSceneOutput(SceneId sid, POVMSAddress addr, POVMSType id
 
 void RenderBackend::SendViewOutput(ViewId vid, POVMSAddress addr, POVMSType ident, POVMS_Object& obj)
 {
-    POVMS_Message msg(obj, kPOVMsgClass_ViewOutput, ident);
+    POVMS_Message msg(std::move(obj), kPOVMsgClass_ViewOutput, ident);
 
     msg.SetInt(kPOVAttrib_ViewId, vid);
     msg.SetDestinationAddress(addr);
@@ -66,6 +66,7 @@ class RenderBackend : public POVMS_MessageReceiver
         RenderBackend(POVMSContext ctx, bool (*val)(POVMSAddress));
         ~RenderBackend();
 
+        // Note: The output functions take over the data of `obj`, leaving it a null object.
         static void SendSceneOutput(SceneId sid, POVMSAddress addr, POVMSType ident, POVMS_Object& obj);
         static void SendViewOutput(ViewId vid, POVMSAddress addr, POVMSType ident, POVMS_Object& obj);
 
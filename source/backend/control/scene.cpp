@@ -43,12 +43,15 @@
 #include "backend/control/parsertask.h"
 #include "backend/control/scene.h"
 
+#include "base/memoryaccounting.h"
+
 #include "core/scene/tracethreaddata.h"
 
 #include "parser/parsertypes.h"
 
 #include "backend/bounding/boundingtask.h"
 #include "backend/scene/view.h"
+#include "backend/support/eventtrace.h"
 
 // this must be the last file included
 #include "base/povdebug.h"
@@ -101,19 +104,36 @@ void Scene::StartParser(POVMS_Object& parseOptions)
 
     sceneData->inputFile = parseOptions.TryGetUCS2String(kPOVAttrib_InputFile, "object.pov");
     sceneData->headerFile = parseOptions.TryGetUCS2String(kPOVAttrib_IncludeHeader, "");
+    // NB an empty path disables caching of pre-tokenized include files
+    sceneData->includeCachePath = parseOptions.TryGetUCS2String(kPOVAttrib_IncludeCachePath, "");
+    sceneData->parseProfile = parseOptions.TryGetBool(kPOVAttrib_ParseProfile, false);
+    sceneData->eventTraceFile = parseOptions.TryGetUCS2String(kPOVAttrib_EventTraceFile, "");
+    if (!sceneData->eventTraceFile.empty())
+        EventTrace::Start();
+
+    // report the highest memory use of this frame rather than of any before
+    MemoryAccounting::ResetPeaks();
 
     DBL outputWidth  = parseOptions.TryGetFloat(kPOVAttrib_Width, 160);
     DBL outputHeight = parseOptions.TryGetFloat(kPOVAttrib_Height, 120);
     sceneData->aspectRatio = outputWidth / outputHeight;
+    sceneData->outputWidth = outputWidth;
 
     sceneData->defaultFileType = parseOptions.TryGetInt(kPOVAttrib_OutputFileType, DEFAULT_OUTPUT_FORMAT); // TODO - should get DEFAULT_OUTPUT_FORMAT from the front-end
     sceneData->clocklessAnimation = parseOptions.TryGetBool(kPOVAttrib_ClocklessAnimation, false); // TODO - experimental code
+    sceneData->reuseScene = parseOptions.TryGetBool(kPOVAttrib_ReuseScene, false);
+    sceneData->incrementalAnimation = parseOptions.TryGetBool(kPOVAttrib_IncrementalAnimation, false);
+    sceneData->animationRunId = parseOptions.TryGetLong(kPOVAttrib_AnimationRunId, 0);
 
     sceneData->splitUnions = parseOptions.TryGetBool(kPOVAttrib_SplitUnions, false);
     sceneData->removeBounds = parseOptions.TryGetBool(kPOVAttrib_RemoveBounds, true);
-    sceneData->boundingMethod = clip<int>(parseOptions.TryGetInt(kPOVAttrib_BoundingMethod, 1), 1, 2);
+    sceneData->useLightBuffer = parseOptions.TryGetBool(kPOVAttrib_LightBuffer, false);
+    sceneData->useVistaBuffer = parseOptions.TryGetBool(kPOVAttrib_VistaBuffer, false);
+    sceneData->boundingMethod = clip<int>(parseOptions.TryGetInt(kPOVAttrib_BoundingMethod, 1), 1, 5);
     if(parseOptions.TryGetBool(kPOVAttrib_Bounding, true) == false)
         sceneData->boundingMethod = 0;
+    // NB only the bounding box hierarchy methods (1, 3, 4 and 5) support refitting
+    sceneData->boundingRefit = parseOptions.TryGetBool(kPOVAttrib_BoundingRefit, false);
 
     sceneData->outputAlpha = parseOptions.TryGetBool(kPOVAttrib_OutputAlpha, false);
     if (!sceneData->outputAlpha)
@@ -127,6 +147,10 @@ void Scene::StartParser(POVMS_Object& parseOptions)
     sceneData->bspBaseAccessCost = clip<float>(parseOptions.TryGetFloat(kPOVAttrib_BSP_BaseAccessCost, 0.0f), 0.0f, HUGE_VAL);
     sceneData->bspChildAccessCost = clip<float>(parseOptions.TryGetFloat(kPOVAttrib_BSP_ChildAccessCost, 0.0f), 0.0f, HUGE_VAL);
     sceneData->bspMissChance = clip<float>(parseOptions.TryGetFloat(kPOVAttrib_BSP_MissChance, 0.0f), 0.0f, 1.0f - EPSILON);
+    // the BSP tree is built using as many threads as will be used for rendering; the resulting tree is the same either way
+    sceneData->bspBuildThreads = max(1, parseOptions.TryGetInt(kPOVAttrib_MaxRenderThreads, 1));
+    // NB an empty file name disables caching of the BSP tree
+    sceneData->bspCacheFile = parseOptions.TryGetUCS2String(kPOVAttrib_BSP_CacheFile, "");
 
     sceneData->realTimeRaytracing = parseOptions.TryGetBool(kPOVAttrib_RealTimeRaytracing, false);
 
@@ -240,9 +264,23 @@ void Scene::GetStatistics(POVMS_Object& parserStats)
     {
         POV_LONG cpuTime;
         POV_LONG realTime;
+        POV_LONG totalRealTime;
+        POV_LONG hardwareCounts[kHardwareCounterCount];
         size_t samples;
 
-        TimeData() : cpuTime(0), realTime(0), samples(0) { }
+        TimeData() : cpuTime(0), realTime(0), totalRealTime(0), samples(0)
+        {
+            for (int i = 0; i < kHardwareCounterCount; ++i)
+                hardwareCounts[i] = -1;
+        }
+    };
+
+    static const POVMSType kHardwareCounterAttrib[kHardwareCounterCount] =
+    {
+        kPOVAttrib_CPUCycles,
+        kPOVAttrib_Instructions,
+        kPOVAttrib_CacheMisses,
+        kPOVAttrib_BranchMisses,
     };
 
     TimeData timeData[TraceThreadData::kMaxTimeType];
@@ -250,7 +288,14 @@ void Scene::GetStatistics(POVMS_Object& parserStats)
     for(vector<TraceThreadData *>::iterator i(sceneThreadData.begin()); i != sceneThreadData.end(); i++)
     {
         timeData[(*i)->timeType].realTime = max(timeData[(*i)->timeType].realTime, (*i)->realTime);
+        timeData[(*i)->timeType].totalRealTime += (*i)->realTime;
         timeData[(*i)->timeType].cpuTime += (*i)->cpuTime;
+        for (int c = 0; c < kHardwareCounterCount; ++c)
+        {
+            // threads that could not sample a counter leave the sum alone
+            if ((*i)->hardwareCounts[c] >= 0)
+                timeData[(*i)->timeType].hardwareCounts[c] = max<POV_LONG>(timeData[(*i)->timeType].hardwareCounts[c], 0) + (*i)->hardwareCounts[c];
+        }
         timeData[(*i)->timeType].samples++;
     }
 
@@ -263,6 +308,12 @@ void Scene::GetStatistics(POVMS_Object& parserStats)
             elapsedTime.SetLong(kPOVAttrib_RealTime, timeData[i].realTime);
             elapsedTime.SetLong(kPOVAttrib_CPUTime, timeData[i].cpuTime);
             elapsedTime.SetInt(kPOVAttrib_TimeSamples, POVMSInt(timeData[i].samples));
+            elapsedTime.SetLong(kPOVAttrib_MeanRealTime, timeData[i].totalRealTime / POV_LONG(timeData[i].samples));
+            for (int c = 0; c < kHardwareCounterCount; ++c)
+            {
+                if (timeData[i].hardwareCounts[c] >= 0)
+                    elapsedTime.SetLong(kHardwareCounterAttrib[c], timeData[i].hardwareCounts[c]);
+            }
 
             switch(i)
             {
@@ -294,6 +345,28 @@ void Scene::GetStatistics(POVMS_Object& parserStats)
         parserStats.SetInt(kPOVAttrib_BSPAborts, sceneData->aborts);
         parserStats.SetFloat(kPOVAttrib_BSPAverageAborts, sceneData->averageAborts);
         parserStats.SetFloat(kPOVAttrib_BSPAverageAbortObjects, sceneData->averageAbortObjects);
+        parserStats.SetFloat(kPOVAttrib_HierarchyNodeCost, sceneData->bboxTreeStats.cost);
+    }
+    else if(sceneData->boundingMethod != 0)
+    {
+        parserStats.SetInt(kPOVAttrib_BBoxTreeNodes, sceneData->bboxTreeStats.nodes);
+        parserStats.SetFloat(kPOVAttrib_BBoxTreeCost, sceneData->bboxTreeStats.cost);
+        parserStats.SetBool(kPOVAttrib_BBoxTreeRefitted, sceneData->bboxTreeRefitted);
+        if(sceneData->flatBVH != nullptr)
+        {
+            parserStats.SetInt(kPOVAttrib_FlatBVHNodes, sceneData->flatBVH->GetNodeCount());
+            parserStats.SetInt(kPOVAttrib_FlatBVHNodeSize, sceneData->flatBVH->GetNodeSize());
+        }
+    }
+
+    if((sceneData->boundingMethod != 0) && !sceneData->bboxTreeStats.depths.empty())
+    {
+        vector<POVMSInt> depths(sceneData->bboxTreeStats.depths.begin(), sceneData->bboxTreeStats.depths.end());
+        vector<POVMSInt> leafSizes(sceneData->bboxTreeStats.leafSizes.begin(), sceneData->bboxTreeStats.leafSizes.end());
+
+        parserStats.SetFloat(kPOVAttrib_HierarchyObjectCost, sceneData->bboxTreeStats.objectCost);
+        parserStats.SetIntVector(kPOVAttrib_HierarchyDepths, depths);
+        parserStats.SetIntVector(kPOVAttrib_HierarchyLeafSizes, leafSizes);
     }
 }
 
@@ -53,6 +53,7 @@
 #include "povms/povmsid.h"
 #include "povms/povmsutil.h"
 
+#include "backend/lighting/photonshootingstrategy.h"
 #include "backend/scene/backendscenedata.h"
 #include "backend/scene/view.h"
 #include "backend/scene/viewthreaddata.h"
@@ -63,8 +64,15 @@
 namespace pov
 {
 
-PhotonEstimationTask::PhotonEstimationTask(ViewData *vd, size_t seed) :
+/// Brightness of a light source, used to distribute the photons among the light sources.
+static DBL LightBrightness(const LightSource* light)
+{
+    return max(DBL(fabs(light->colour.Greyscale())), EPSILON);
+}
+
+PhotonEstimationTask::PhotonEstimationTask(ViewData *vd, PhotonShootingStrategy* strategy, size_t seed) :
     RenderTask(vd, seed, "Photon"),
+    strategy(strategy),
     cooperate(*this)
 {
     photonCountEstimate = 0;
@@ -85,35 +93,44 @@ void PhotonEstimationTask::Run()
     Cooperate();
 
     //  COUNT THE PHOTONS
-    DBL factor;
+    // the work units have already been created, with their shooting directions
+    // computed, so there is no need to search through the objects again
+    vector<DBL> estimates(strategy->units.size());
     photonCountEstimate = 0.0;
-
-    // global lights
-    GetViewDataPtr()->Light_Is_Global = true;
-    for(vector<LightSource *>::iterator Light = GetSceneData()->lightSources.begin(); Light != GetSceneData()->lightSources.end(); Light++)
+    for (size_t i = 0; i < strategy->units.size(); i++)
     {
-        if((*Light)->Light_Type != FILL_LIGHT_SOURCE)
-            SearchThroughObjectsEstimatePhotons(GetSceneData()->objects, *Light);
+        estimates[i] = EstimatePhotons(strategy->units[i]->lightAndObject);
+        photonCountEstimate += estimates[i];
     }
 
-    // light_group lights
-    /*
-    TODO
-    renderer->sceneData->photonSettings.Light_Is_Global = false;
-    for(vector<LightSource *>::iterator Light_Group_Light = renderer->sceneData->lightGroupLights.begin(); Light_Group_Light != renderer->sceneData->lightGroupLights.end(); Light_Group_Light++)
+    if (photonCountEstimate <= 0.0) return;
+
+    if (GetSceneData()->photonSettings.adaptiveCount)
     {
-        Light = Light_Group_Light->Light;
-        if (Light->Light_Type != FILL_LightSource)
+        // Distribute the photons such that each carries the same amount of light: the number of
+        // photons shot from a light source is proportional to its brightness, while the relative
+        // spacing of the targets is kept. The estimates are for a spacing factor of 1, and the
+        // number of photons is inversely proportional to the square of the spacing factor.
+        DBL weightedEstimate = 0.0;
+        for (size_t i = 0; i < strategy->units.size(); i++)
+            weightedEstimate += estimates[i] * LightBrightness(strategy->units[i]->lightAndObject.light);
+
+        for (vector<PhotonShootingUnit*>::iterator unit = strategy->units.begin(); unit != strategy->units.end(); unit++)
         {
-            SearchThroughObjectsEstimatePhotons(GetSceneData()->objects, *Light);
+            (*unit)->lightAndObject.spacingFactor = sqrt(weightedEstimate / GetSceneData()->photonSettings.surfaceCount /
+                                                         LightBrightness((*unit)->lightAndObject.light));
+            (*unit)->lightAndObject.computeAnglesAndDeltas(GetSceneData());
         }
     }
-    */
-
-    factor = (DBL)photonCountEstimate/GetSceneData()->photonSettings.surfaceCount;
-    factor = sqrt(factor);
-    GetSceneData()->photonSettings.surfaceSeparation *= factor;
+    else
+    {
+        DBL factor = (DBL)photonCountEstimate/GetSceneData()->photonSettings.surfaceCount;
+        factor = sqrt(factor);
+        GetSceneData()->photonSettings.surfaceSeparation *= factor;
 
+        for (vector<PhotonShootingUnit*>::iterator unit = strategy->units.begin(); unit != strategy->units.end(); unit++)
+            (*unit)->lightAndObject.computeAnglesAndDeltas(GetSceneData());
+    }
 
     // good idea to make sure all warnings and errors arrive frontend now [trf]
     Cooperate();
@@ -129,63 +146,23 @@ void PhotonEstimationTask::Finish()
     GetViewDataPtr()->timeType = TraceThreadData::kPhotonTime;
     GetViewDataPtr()->realTime = ConsumedRealTime();
     GetViewDataPtr()->cpuTime = ConsumedCPUTime();
+    ConsumedHardwareCounts(GetViewDataPtr()->hardwareCounts);
 }
 
 
-void PhotonEstimationTask::SearchThroughObjectsEstimatePhotons(vector<ObjectPtr>& Objects, LightSource *Light)
-{
-    ViewThreadData *renderDataPtr = GetViewDataPtr();
-    shared_ptr<SceneData> sceneData = GetSceneData();
-
-    /* check this object and all siblings */
-    for(vector<ObjectPtr>::iterator Sib = Objects.begin(); Sib != Objects.end(); Sib++)
-    {
-        if(Test_Flag((*Sib), PH_TARGET_FLAG) &&
-            !((*Sib)->Type & LIGHT_SOURCE_OBJECT))
-        {
-            /* do not shoot photons if global lights are turned off for ObjectPtr */
-            if(!Test_Flag((*Sib), NO_GLOBAL_LIGHTS_FLAG))
-            {
-                EstimatePhotonsForObjectAndLight((*Sib), Light);
-            }
-
-            Cooperate();
-        }
-        /* if it has children, check them too */
-        else if(((*Sib)->Type & IS_COMPOUND_OBJECT))
-        {
-            SearchThroughObjectsEstimatePhotons((reinterpret_cast<CSG *>(*Sib))->children, Light);
-        }
-    }
-}
-
-void PhotonEstimationTask::EstimatePhotonsForObjectAndLight(ObjectPtr Object, LightSource *Light)
+DBL PhotonEstimationTask::EstimatePhotons(LightTargetCombo& combo)
 {
     int mergedFlags=0;             /* merged flags to see if we should shoot photons */
-    ViewThreadData *renderDataPtr = GetViewDataPtr();
 
     /* first, check on various flags... make sure all is a go for this ObjectPtr */
-    LightTargetCombo combo(Light,Object);
     mergedFlags = combo.computeMergedFlags();
 
     if (!( ((mergedFlags & PH_RFR_ON_FLAG) && !(mergedFlags & PH_RFR_OFF_FLAG)) ||
            ((mergedFlags & PH_RFL_ON_FLAG) && !(mergedFlags & PH_RFL_OFF_FLAG)) ))
         /* it is a no-go for this object... bail out now */
-        return;
-
-    if(!Object) return;
-
-    ShootingDirection shootingDirection(Light,Object);
-    shootingDirection.compute();
+        return 0.0;
 
-    /* calculate the spacial separation (spread) */
-    renderDataPtr->photonSpread = combo.target->Ph_Density*GetSceneData()->photonSettings.surfaceSeparation;
-
-    /* if rays aren't parallel, divide by dist so we get separation at a distance of 1 unit */
-    if (!combo.light->Parallel)
-    {
-        renderDataPtr->photonSpread /= shootingDirection.dist;
-    }
+    const ShootingDirection& shootingDirection = combo.shootingDirection;
 
     /* try to guess the number of photons */
     DBL x=shootingDirection.rad / (combo.target->Ph_Density*GetSceneData()->photonSettings.surfaceSeparation);
@@ -210,7 +187,7 @@ void PhotonEstimationTask::EstimatePhotonsForObjectAndLight(ObjectPtr Object, Li
 
     x *= 0.5;  /* assume 1/2 of photons hit target ObjectPtr */
 
-    photonCountEstimate += x;
+    return x;
 }
 
 }
@@ -46,20 +46,24 @@ namespace pov
 
 using namespace pov_base;
 
+class LightTargetCombo;
+class PhotonShootingStrategy;
+
 class PhotonEstimationTask : public RenderTask
 {
     public:
         DBL photonCountEstimate;
 
-        PhotonEstimationTask(ViewData *vd, size_t seed);
+        PhotonShootingStrategy* strategy;
+
+        PhotonEstimationTask(ViewData *vd, PhotonShootingStrategy* strategy, size_t seed);
         ~PhotonEstimationTask();
 
         void Run();
         void Stopped();
         void Finish();
 
-        void SearchThroughObjectsEstimatePhotons(vector<ObjectPtr>& Objects, LightSource *Light);
-        void EstimatePhotonsForObjectAndLight(ObjectPtr Object, LightSource *Light);
+        DBL EstimatePhotons(LightTargetCombo& combo);
     private:
         class CooperateFunction : public Trace::CooperateFunctor
         {
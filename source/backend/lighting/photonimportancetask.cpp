@@ -0,0 +1,204 @@
+//******************************************************************************
+///
+/// @file backend/lighting/photonimportancetask.cpp
+///
+/// This module implements the visual importance pass of photon shooting.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#include <algorithm>
+
+// frame.h must always be the first POV file included (pulls in platform config)
+#include "backend/frame.h"
+#include "backend/lighting/photonimportancetask.h"
+
+#include "core/lighting/lightsource.h"
+#include "core/render/ray.h"
+
+#include "backend/lighting/photonshootingstrategy.h"
+#include "backend/scene/backendscenedata.h"
+#include "backend/scene/view.h"
+#include "backend/scene/viewthreaddata.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+// horizontal resolution of the camera rays finding the visible surfaces
+#define VISIBLE_POINTS_COLUMNS 128
+// maximum number of direction cells along theta per light/target combination
+#define IMPORTANCE_THETA_CELLS 16
+// number of direction cells along phi per light/target combination
+#define IMPORTANCE_PHI_CELLS 32
+// number of pilot photons shot per direction cell
+#define IMPORTANCE_PILOT_PHOTONS 4
+
+PhotonImportanceTask::PhotonImportanceTask(ViewData *vd, PhotonShootingStrategy* strategy, size_t seed) :
+    PhotonShootingTask(vd, strategy, seed),
+    cameraTrace(vd->GetSceneData(), &vd->GetCamera(), GetViewDataPtr(), vd->GetSceneData()->parsedMaxTraceLevel, vd->GetSceneData()->parsedAdcBailout,
+                vd->GetQualityFeatureFlags(), noCooperate, noMedia, noRadiosity)
+{
+}
+
+PhotonImportanceTask::~PhotonImportanceTask()
+{
+}
+
+void PhotonImportanceTask::Run()
+{
+    // quit right away if photons not enabled
+    if (!GetSceneData()->photonSettings.photonsEnabled) return;
+
+    Cooperate();
+
+    ComputeVisiblePoints();
+
+    // with nothing in sight, leave all directions to be shot as usual
+    if (visualImportance.Empty())
+        return;
+
+    for(vector<PhotonShootingUnit*>::iterator unit = strategy->units.begin(); unit != strategy->units.end(); unit++)
+        ComputeDirectionImportance((*unit)->lightAndObject);
+
+    Cooperate();
+}
+
+void PhotonImportanceTask::ComputeVisiblePoints()
+{
+    DBL width = GetViewData()->GetWidth();
+    DBL height = GetViewData()->GetHeight();
+    unsigned int columns = VISIBLE_POINTS_COLUMNS;
+    unsigned int rows = max(1, int(columns * height / width + 0.5));
+    DBL scaleX = width / columns;
+    DBL scaleY = height / rows;
+
+    TraceTicket ticket(GetSceneData()->parsedMaxTraceLevel, GetSceneData()->parsedAdcBailout);
+
+    for(unsigned int row = 0; row < rows; row++)
+    {
+        Cooperate();
+
+        for(unsigned int column = 0; column < columns; column++)
+        {
+            Ray ray(ticket);
+            Intersection isect;
+
+            if (!cameraTrace.CreatePrimaryRay(ray, (column + 0.5) * scaleX, (row + 0.5) * scaleY, width, height))
+                continue;
+            if (!cameraTrace.FindIntersection(isect, ray))
+                continue;
+
+            // photons contribute to the point if they land within the footprint of the
+            // camera ray, as given by the distance to the neighbouring ray at the same depth
+            Ray neighbour(ticket);
+            if (!cameraTrace.CreatePrimaryRay(neighbour, (column + 1.5) * scaleX, (row + 0.5) * scaleY, width, height) &&
+                !cameraTrace.CreatePrimaryRay(neighbour, (column - 0.5) * scaleX, (row + 0.5) * scaleY, width, height))
+                continue;
+
+            Vector3d neighbourPoint = neighbour.Origin + neighbour.Direction * isect.Depth;
+            visualImportance.Add(isect.IPoint, 2.0 * (neighbourPoint - isect.IPoint).length());
+        }
+    }
+
+    visualImportance.Build();
+}
+
+void PhotonImportanceTask::ComputeDirectionImportance(LightTargetCombo& combo)
+{
+    ViewThreadData *renderDataPtr = GetViewDataPtr();
+
+    combo.importance.Clear();
+
+    /* same checks as when shooting the photons for real */
+    int mergedFlags = combo.computeMergedFlags();
+    if (!( ((mergedFlags & PH_RFR_ON_FLAG) && !(mergedFlags & PH_RFR_OFF_FLAG)) ||
+           ((mergedFlags & PH_RFL_ON_FLAG) && !(mergedFlags & PH_RFL_OFF_FLAG)) ))
+        return;
+    if (combo.photonSpread <= 0.0)
+        return;
+
+    renderDataPtr->photonSourceLight = combo.light;
+    renderDataPtr->photonTargetObject = combo.target;
+    renderDataPtr->photonSpread = combo.photonSpread;
+
+    unsigned int thetaCells = clip(int((combo.maxtheta - combo.mintheta) / combo.dtheta), 1, IMPORTANCE_THETA_CELLS);
+    unsigned int phiCells = IMPORTANCE_PHI_CELLS;
+    combo.importance.Init(thetaCells, phiCells, combo.mintheta, combo.maxtheta);
+
+    ShootingDirection shootingDirection(combo.light, combo.target);
+    shootingDirection.compute();
+
+    // pilot photons of area lights all stem from the light's center
+    int area_x = 0;
+    int area_y = 0;
+    if (combo.light->Area_Light && combo.light->Photon_Area_Light && !combo.light->Parallel)
+    {
+        area_x = combo.light->Area_Size1 / 2;
+        area_y = combo.light->Area_Size2 / 2;
+    }
+
+    vector<bool> seen(thetaCells * phiCells, false);
+    VisibilityProbe probe(visualImportance);
+
+    renderDataPtr->photonDepositProbe = &probe;
+    for(unsigned int t = 0; t < thetaCells; t++)
+    {
+        Cooperate();
+
+        for(unsigned int p = 0; p < phiCells; p++)
+        {
+            probe.visible = false;
+            for(int i = 0; (i < IMPORTANCE_PILOT_PHOTONS) && !probe.visible; i++)
+                ShootPhoton(combo, shootingDirection, combo.importance.CellTheta(t, randgen()), combo.importance.CellPhi(p, randgen()),
+                            area_x, area_y, 1, combo.light->colour);
+            seen[t * phiCells + p] = probe.visible;
+        }
+    }
+    renderDataPtr->photonDepositProbe = nullptr;
+
+    // a few pilot photons may easily miss a small visible patch, so cells next to visible
+    // ones are considered important as well
+    DBL probability = GetSceneData()->photonSettings.importance;
+    for(unsigned int t = 0; t < thetaCells; t++)
+    {
+        for(unsigned int p = 0; p < phiCells; p++)
+        {
+            bool important = false;
+            for(unsigned int nt = (t > 0 ? t - 1 : 0); (nt <= t + 1) && (nt < thetaCells) && !important; nt++)
+                for(unsigned int np = p + phiCells - 1; (np <= p + phiCells + 1) && !important; np++)
+                    important = seen[nt * phiCells + (np % phiCells)];
+            combo.importance.Cell(t, p) = (important ? 1.0f : float(probability));
+        }
+    }
+}
+
+}
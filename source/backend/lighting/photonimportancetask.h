@@ -0,0 +1,90 @@
+//******************************************************************************
+///
+/// @file backend/lighting/photonimportancetask.h
+///
+/// Declarations related to the visual importance of photon shooting directions.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef PHOTONIMPORTANCETASK_H
+#define PHOTONIMPORTANCETASK_H
+
+#include "core/lighting/photons.h"
+#include "core/render/tracepixel.h"
+
+#include "backend/frame.h"
+#include "backend/lighting/photonshootingtask.h"
+
+namespace pov
+{
+
+using namespace pov_base;
+
+/// Task to find the directions in which photons are worth shooting.
+///
+/// The task traces a coarse grid of camera rays to find the surfaces seen in the image, then
+/// shoots a few pilot photons per direction cell of each light/target combination to see whether
+/// any of them lands near such a surface. Cells found unimportant are shot with reduced
+/// probability by the @ref PhotonShootingTask, as set by the `importance` photon setting.
+///
+class PhotonImportanceTask : public PhotonShootingTask
+{
+    public:
+        PhotonImportanceTask(ViewData *vd, PhotonShootingStrategy* strategy, size_t seed);
+        ~PhotonImportanceTask();
+
+        void Run();
+
+    private:
+        /// Probe recording whether any pilot photon lands where it can be seen.
+        class VisibilityProbe : public PhotonDepositProbe
+        {
+            public:
+                VisibilityProbe(const VisualImportanceMap& m) : map(m), visible(false) {}
+                virtual void Deposit(const Vector3d& point, bool media) { if (media || map.IsVisible(point)) visible = true; }
+
+                const VisualImportanceMap& map;
+                bool visible;
+        };
+
+        Trace::CooperateFunctor noCooperate;
+        Trace::MediaFunctor noMedia;
+        Trace::RadiosityFunctor noRadiosity;
+        TracePixel cameraTrace;
+
+        VisualImportanceMap visualImportance;
+
+        void ComputeVisiblePoints();
+        void ComputeDirectionImportance(LightTargetCombo& combo);
+};
+
+}
+
+#endif
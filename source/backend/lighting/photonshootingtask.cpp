@@ -60,6 +60,9 @@
 // this must be the last file included
 #include "base/povdebug.h"
 
+// offset into the random number sequence between passes of progressive photon mapping
+#define PHOTON_PASS_SEED_STEP 7919
+
 namespace pov
 {
 
@@ -79,17 +82,6 @@ PhotonShootingTask::~PhotonShootingTask()
 {
 }
 
-
-PhotonMap* PhotonShootingTask::getMediaPhotonMap()
-{
-    return GetViewDataPtr()->mediaPhotonMap;
-}
-
-PhotonMap* PhotonShootingTask::getSurfacePhotonMap()
-{
-    return GetViewDataPtr()->surfacePhotonMap;
-}
-
 void PhotonShootingTask::SendProgress(void)
 {
     if (timer.ElapsedRealTime() > 1000)
@@ -100,7 +92,7 @@ void PhotonShootingTask::SendProgress(void)
         // the totals should be combined and sent from a single thread.
         timer.Reset();
         POVMS_Object obj(kPOVObjectClass_PhotonProgress);
-        obj.SetInt(kPOVAttrib_CurrentPhotonCount, GetViewDataPtr()->surfacePhotonMap->numPhotons + GetViewDataPtr()->mediaPhotonMap->numPhotons);
+        obj.SetInt(kPOVAttrib_CurrentPhotonCount, GetViewDataPtr()->surfacePhotonSlice->numPhotons + GetViewDataPtr()->mediaPhotonSlice->numPhotons);
         RenderBackend::SendViewOutput(GetViewData()->GetViewId(), GetSceneData()->frontendAddress, kPOVMsgIdent_Progress, obj);
     }
 }
@@ -114,6 +106,9 @@ void PhotonShootingTask::Run()
 
     Cooperate();
 
+    // each pass of progressive photon mapping shoots its photons along different directions
+    randgen.SetSeed((GetViewData()->GetPhotonPass() - 1) * PHOTON_PASS_SEED_STEP);
+
     PhotonShootingUnit* unit = strategy->getNextUnit();
     while(unit)
     {
@@ -122,6 +117,9 @@ void PhotonShootingTask::Run()
         unit = strategy->getNextUnit();
     }
 
+    // hand back the partially filled photon blocks
+    GetViewDataPtr()->surfacePhotonSlice->Release();
+    GetViewDataPtr()->mediaPhotonSlice->Release();
 
     // good idea to make sure all warnings and errors arrive frontend now [trf]
     SendProgress();
@@ -138,6 +136,7 @@ void PhotonShootingTask::Finish()
     GetViewDataPtr()->timeType = TraceThreadData::kPhotonTime;
     GetViewDataPtr()->realTime = ConsumedRealTime();
     GetViewDataPtr()->cpuTime = ConsumedCPUTime();
+    ConsumedHardwareCounts(GetViewDataPtr()->hardwareCounts);
 }
 
 
@@ -148,20 +147,17 @@ void PhotonShootingTask::Finish()
 void PhotonShootingTask::ShootPhotonsAtObject(LightTargetCombo& combo)
 {
     MathColour colour;             /* light color */
-    MathColour photonColour;       /* photon color */
-    ColourChannel dummyTransm;
     int i;                         /* counter */
     DBL theta, phi;                /* rotation angles */
     DBL dphi;              /* deltas for theta and phi */
     DBL jittheta, jitphi;          /* jittered versions of theta and phi */
+    DBL jitter;                    /* amount of jitter */
     DBL minphi,maxphi;
                                    /* these are minimum and maximum for theta and
                                        phi for the spiral shooting */
-    DBL Attenuation;               /* light attenuation for spotlight */
-    TRANSFORM Trans;               /* transformation for rotation */
     int mergedFlags=0;             /* merged flags to see if we should shoot photons */
-    int notComputed=true;          /* have the ray containers been computed for this point yet?*/
     int hitAtLeastOnce = false;    /* have we hit the object at least once - for autostop stuff */
+    bool thinned;                  /* have directions of this ring been skipped for lack of visual importance? */
     ViewThreadData *renderDataPtr = GetViewDataPtr();
 
     /* get the light source colour */
@@ -185,12 +181,12 @@ void PhotonShootingTask::ShootPhotonsAtObject(LightTargetCombo& combo)
            main ray-shooting loop
        --------------------------------------------- */
     i = 0;
-    notComputed = true;
     for(theta=combo.mintheta; theta<combo.maxtheta; theta+=combo.dtheta)
     {
         Cooperate();
         SendProgress();
         renderDataPtr->hitObject = false;
+        thinned = false;
 
         if (theta<EPSILON)
         {
@@ -213,6 +209,10 @@ void PhotonShootingTask::ShootPhotonsAtObject(LightTargetCombo& combo)
         ShootingDirection shootingDirection(combo.light,combo.target);
         shootingDirection.compute();
 
+        // progressive photon mapping relies on the passes' photons covering the whole angular
+        // range between them, so the directions are always fully jittered
+        jitter = (GetViewData()->GetPhotonPasses() > 1) ? 1.0 : GetSceneData()->photonSettings.jitter;
+
         minphi = -M_PI + dphi*randgen()*0.5;
         maxphi = M_PI - dphi/2 + (minphi+M_PI);
         for(phi=minphi; phi<maxphi; phi+=dphi)
@@ -222,8 +222,18 @@ void PhotonShootingTask::ShootPhotonsAtObject(LightTargetCombo& combo)
             /* ------------------- shoot one photon ------------------ */
 
             /* jitter theta & phi */
-            jitphi = phi + (dphi)*(randgen() - 0.5)*1.0*GetSceneData()->photonSettings.jitter;
-            jittheta = theta + (combo.dtheta)*(randgen() - 0.5)*1.0*GetSceneData()->photonSettings.jitter;
+            jitphi = phi + (dphi)*(randgen() - 0.5)*1.0*jitter;
+            jittheta = theta + (combo.dtheta)*(randgen() - 0.5)*1.0*jitter;
+
+            /* directions whose photons are unlikely to be seen are only shot now and then,
+               with their photons carrying the flux of the ones skipped */
+            DBL probability = combo.importance.Probability(jittheta, jitphi);
+            if (probability < 1.0)
+            {
+                thinned = true;
+                if (randgen() >= probability)
+                    continue;
+            }
 
             /* actually, shoot multiple samples for area light */
             if(combo.light->Area_Light && combo.light->Photon_Area_Light && !combo.light->Parallel)
@@ -241,159 +251,170 @@ void PhotonShootingTask::ShootPhotonsAtObject(LightTargetCombo& combo)
             {
                 for(area_y=0; area_y<y_samples; area_y++)
                 {
-                    TraceTicket ticket(maxTraceLevel, adcBailout);
-                    Ray ray(ticket);
-
-                    ray.Origin = combo.light->Center;
+                    if (!ShootPhoton(combo, shootingDirection, jittheta, jitphi, area_x, area_y, x_samples*y_samples, colour / probability))
+                        continue;
 
-                    if (combo.light->Area_Light && combo.light->Photon_Area_Light && !combo.light->Parallel)
+                    /* display here */
+                    if ((i++%100) == 0)
                     {
-                        shootingDirection.recomputeForAreaLight(ray,area_x,area_y);
-                        /* we must recompute the media containers (new start point) */
-                        notComputed = true;
+                        Cooperate();
+                        SendProgress();
                     }
 
-                    DBL dist_of_initial_from_center;
+                } // for(area_y...)
+            } // for(area_x...)
+        }
 
-                    if (combo.light->Parallel)
-                    {
-                        DBL a;
-                        Vector3d v;
-                        /* assign the direction */
-                        ray.Direction = combo.light->Direction;
+        /* if we didn't hit anything and we're past the autostop angle, then
+             we should stop
 
-                        /* project ctr onto plane defined by Direction & light location */
+             as per suggestion from Smellenberg, changed autostop to a percentage
+             of the object's bounding sphere. */
 
-                        a = dot(ray.Direction, shootingDirection.toctr);
-                        v = ray.Direction * (-a*shootingDirection.dist); /* MAYBE NEEDS TO BE NEGATIVE! */
+        /* suggested by Pabs, we only use autostop if we have it it once */
+        if (renderDataPtr->hitObject) hitAtLeastOnce=true;
 
-                        ray.Origin = shootingDirection.ctr + v;
+        /* a ring thinned out by the visual importance may have missed the object by chance */
+        if (hitAtLeastOnce && !renderDataPtr->hitObject && !thinned && renderDataPtr->photonTargetObject)
+            if (theta > GetSceneData()->photonSettings.autoStopPercent*combo.maxtheta)
+                break;
+    } /* end of rays loop */
+}
 
-                        /* move point along "left" distance theta (remember theta means rad) */
-                        v = shootingDirection.left * jittheta;
+bool PhotonShootingTask::ShootPhoton(LightTargetCombo& combo, ShootingDirection& shootingDirection, DBL jittheta, DBL jitphi,
+                                     int area_x, int area_y, int areaSamples, const MathColour& colour)
+{
+    MathColour photonColour;       /* photon color */
+    ColourChannel dummyTransm;
+    DBL Attenuation;               /* light attenuation for spotlight */
+    TRANSFORM Trans;               /* transformation for rotation */
+    ViewThreadData *renderDataPtr = GetViewDataPtr();
 
-                        /* rotate pt around ray.Direction by phi */
-                        /* use POV funcitons... slower but easy */
-                        Compute_Axis_Rotation_Transform(&Trans,combo.light->Direction,jitphi);
-                        MTransPoint(v, v, &Trans);
+    TraceTicket ticket(maxTraceLevel, adcBailout);
+    Ray ray(ticket);
 
-                        ray.Origin += v;
+    ray.Origin = combo.light->Center;
 
-                        // compute the length of "v" if we're going to use it
-                        if (combo.light->Light_Type == CYLINDER_SOURCE)
-                        {
-                            Vector3d initial_from_center;
-                            initial_from_center = ray.Origin - combo.light->Center;
-                            dist_of_initial_from_center = initial_from_center.length();
-                        }
-                    }
-                    else
-                    {
-                        DBL st,ct;                     /* cos(theta) & sin(theta) for rotation */
-                        /* rotate toctr by theta around up */
-                        st = sin(jittheta);
-                        ct = cos(jittheta);
-                        /* use fast rotation */
-                        Vector3d v = -st * shootingDirection.left + ct * shootingDirection.toctr;
-
-                        /* then rotate by phi around toctr */
-                        /* use POV funcitons... slower but easy */
-                        Compute_Axis_Rotation_Transform(&Trans,shootingDirection.toctr,jitphi);
-                        MTransPoint(ray.Direction, v, &Trans);
-                    }
+    if (combo.light->Area_Light && combo.light->Photon_Area_Light && !combo.light->Parallel)
+    {
+        shootingDirection.recomputeForAreaLight(ray,area_x,area_y);
+    }
 
-                    /* ------ attenuation for spot/cylinder (copied from point.c) ---- */
-                    Attenuation = computeAttenuation(combo.light, ray, dist_of_initial_from_center);
+    DBL dist_of_initial_from_center;
 
-                    /* set up defaults for reflection, refraction */
-                    renderDataPtr->passThruPrev = true;
-                    renderDataPtr->passThruThis = false;
+    if (combo.light->Parallel)
+    {
+        DBL a;
+        Vector3d v;
+        /* assign the direction */
+        ray.Direction = combo.light->Direction;
 
-                    renderDataPtr->photonDepth = 0.0;
-                    // GetViewDataPtr()->Trace_Level = 0;
-                    // Total_Depth = 0.0;
-                    renderDataPtr->Stats()[Number_Of_Photons_Shot]++;
+        /* project ctr onto plane defined by Direction & light location */
 
-                    /* attenuate for area light extra samples */
-                    Attenuation/=(x_samples*y_samples);
+        a = dot(ray.Direction, shootingDirection.toctr);
+        v = ray.Direction * (-a*shootingDirection.dist); /* MAYBE NEEDS TO BE NEGATIVE! */
 
-                    /* compute photon color from light source & attenuation */
+        ray.Origin = shootingDirection.ctr + v;
 
-                    photonColour = colour * Attenuation;
+        /* move point along "left" distance theta (remember theta means rad) */
+        v = shootingDirection.left * jittheta;
 
-                    if (Attenuation<0.00001) continue;
+        /* rotate pt around ray.Direction by phi */
+        /* use POV funcitons... slower but easy */
+        Compute_Axis_Rotation_Transform(&Trans,combo.light->Direction,jitphi);
+        MTransPoint(v, v, &Trans);
 
-                    /* handle the projected_through object if it exists */
-                    if (combo.light->Projected_Through_Object != nullptr)
-                    {
-                        /* try to intersect ray with projected-through ObjectPtr */
-                        Intersection Intersect;
-
-                        Intersect.Object = nullptr;
-                        if ( trace.FindIntersection(combo.light->Projected_Through_Object, Intersect, ray) )
-                        {
-                            /* we must recompute the media containers (new start point) */
-                            notComputed = true;
-
-                            /* we did hit it, so find the 'real' starting point of the ray */
-                            /* find the farthest intersection */
-                            ray.Origin += (Intersect.Depth+EPSILON) * ray.Direction;
-                            renderDataPtr->photonDepth += Intersect.Depth+EPSILON;
-                            while(trace.FindIntersection( combo.light->Projected_Through_Object, Intersect, ray) )
-                            {
-                                ray.Origin += (Intersect.Depth+EPSILON) * ray.Direction;
-                                renderDataPtr->photonDepth += Intersect.Depth+EPSILON;
-                            }
-                        }
-                        else
-                        {
-                            /* we didn't hit it, so stop now */
-                            continue;
-                        }
+        ray.Origin += v;
 
-                    }
+        // compute the length of "v" if we're going to use it
+        if (combo.light->Light_Type == CYLINDER_SOURCE)
+        {
+            Vector3d initial_from_center;
+            initial_from_center = ray.Origin - combo.light->Center;
+            dist_of_initial_from_center = initial_from_center.length();
+        }
+    }
+    else
+    {
+        DBL st,ct;                     /* cos(theta) & sin(theta) for rotation */
+        /* rotate toctr by theta around up */
+        st = sin(jittheta);
+        ct = cos(jittheta);
+        /* use fast rotation */
+        Vector3d v = -st * shootingDirection.left + ct * shootingDirection.toctr;
+
+        /* then rotate by phi around toctr */
+        /* use POV funcitons... slower but easy */
+        Compute_Axis_Rotation_Transform(&Trans,shootingDirection.toctr,jitphi);
+        MTransPoint(ray.Direction, v, &Trans);
+    }
 
-                    /* As mike said, "fire photon torpedo!" */
-                    //Initialize_Ray_Containers(&ray);
-                    ray.ClearInteriors ();
+    /* ------ attenuation for spot/cylinder (copied from point.c) ---- */
+    Attenuation = computeAttenuation(combo.light, ray, dist_of_initial_from_center);
 
-                    for(vector<ObjectPtr>::iterator object = GetSceneData()->objects.begin(); object != GetSceneData()->objects.end(); object++)
-                    {
-                        if ((*object)->Inside(ray.Origin, renderDataPtr) && ((*object)->interior != nullptr))
-                            ray.AppendInterior((*object)->interior.get());
-                    }
+    /* set up defaults for reflection, refraction */
+    renderDataPtr->passThruPrev = true;
+    renderDataPtr->passThruThis = false;
 
-                    notComputed = false;
-                    //disp_elem = 0;   /* for dispersion */
-                    //disp_nelems = 0; /* for dispersion */
+    renderDataPtr->photonDepth = 0.0;
+    // GetViewDataPtr()->Trace_Level = 0;
+    // Total_Depth = 0.0;
+    if (renderDataPtr->photonDepositProbe == nullptr)
+        renderDataPtr->Stats()[Number_Of_Photons_Shot]++;
 
-                    ray.SetFlags(Ray::PrimaryRay, false, true);
-                    trace.TraceRay(ray, photonColour, dummyTransm, 1.0, false);
+    /* attenuate for area light extra samples */
+    Attenuation/=areaSamples;
 
-                    /* display here */
-                    if ((i++%100) == 0)
-                    {
-                        Cooperate();
-                        SendProgress();
-                    }
+    /* compute photon color from light source & attenuation */
 
-                } // for(area_y...)
-            } // for(area_x...)
+    photonColour = colour * Attenuation;
+
+    if (Attenuation<0.00001) return false;
+
+    /* handle the projected_through object if it exists */
+    if (combo.light->Projected_Through_Object != nullptr)
+    {
+        /* try to intersect ray with projected-through ObjectPtr */
+        Intersection Intersect;
+
+        Intersect.Object = nullptr;
+        if ( trace.FindIntersection(combo.light->Projected_Through_Object, Intersect, ray) )
+        {
+            /* we did hit it, so find the 'real' starting point of the ray */
+            /* find the farthest intersection */
+            ray.Origin += (Intersect.Depth+EPSILON) * ray.Direction;
+            renderDataPtr->photonDepth += Intersect.Depth+EPSILON;
+            while(trace.FindIntersection( combo.light->Projected_Through_Object, Intersect, ray) )
+            {
+                ray.Origin += (Intersect.Depth+EPSILON) * ray.Direction;
+                renderDataPtr->photonDepth += Intersect.Depth+EPSILON;
+            }
+        }
+        else
+        {
+            /* we didn't hit it, so stop now */
+            return false;
         }
 
-        /* if we didn't hit anything and we're past the autostop angle, then
-             we should stop
+    }
 
-             as per suggestion from Smellenberg, changed autostop to a percentage
-             of the object's bounding sphere. */
+    /* As mike said, "fire photon torpedo!" */
+    //Initialize_Ray_Containers(&ray);
+    ray.ClearInteriors ();
 
-        /* suggested by Pabs, we only use autostop if we have it it once */
-        if (renderDataPtr->hitObject) hitAtLeastOnce=true;
+    for(vector<ObjectPtr>::iterator object = GetSceneData()->objects.begin(); object != GetSceneData()->objects.end(); object++)
+    {
+        if ((*object)->Inside(ray.Origin, renderDataPtr) && ((*object)->interior != nullptr))
+            ray.AppendInterior((*object)->interior.get());
+    }
 
-        if (hitAtLeastOnce && !renderDataPtr->hitObject && renderDataPtr->photonTargetObject)
-            if (theta > GetSceneData()->photonSettings.autoStopPercent*combo.maxtheta)
-                break;
-    } /* end of rays loop */
+    //disp_elem = 0;   /* for dispersion */
+    //disp_nelems = 0; /* for dispersion */
+
+    ray.SetFlags(Ray::PrimaryRay, false, true);
+    trace.TraceRay(ray, photonColour, dummyTransm, 1.0, false);
+
+    return true;
 }
 
 DBL PhotonShootingTask::computeAttenuation(const LightSource* Light, const Ray& ray, DBL dist_of_initial_from_center)
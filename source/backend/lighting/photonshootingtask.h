@@ -49,8 +49,8 @@ using namespace pov_base;
 
 class LightSource;
 class LightTargetCombo;
-class PhotonMap;
 class PhotonShootingStrategy;
+class ShootingDirection;
 
 class PhotonShootingTask : public RenderTask
 {
@@ -74,9 +74,12 @@ class PhotonShootingTask : public RenderTask
 
         void ShootPhotonsAtObject(LightTargetCombo& combo);
         DBL computeAttenuation(const LightSource* Light, const Ray& ray, DBL dist_of_initial_from_center);
-
-        PhotonMap* getMediaPhotonMap();
-        PhotonMap* getSurfacePhotonMap();
+    protected:
+        /// Shoot a single photon of a light/target combination.
+        /// @return     `false` if the photon was not shot, e.g. because of the light's spot or
+        ///             cylinder falloff, or for missing the light's projected_through object.
+        bool ShootPhoton(LightTargetCombo& combo, ShootingDirection& shootingDirection, DBL jittheta, DBL jitphi,
+                         int area_x, int area_y, int areaSamples, const MathColour& colour);
     private:
         class CooperateFunction : public Trace::CooperateFunctor
         {
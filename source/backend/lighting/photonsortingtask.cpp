@@ -34,6 +34,7 @@
 //******************************************************************************
 
 #include <algorithm>
+#include <cstring>
 
 // frame.h must always be the first POV file included (pulls in platform config)
 #include "backend/frame.h"
@@ -62,23 +63,57 @@
 namespace pov
 {
 
+/// Identifies the current photon map file format.
+/// Files without this signature are read as the legacy format, which holds just the number of
+/// photons followed by the photons themselves, for each map in turn.
+static const char kPhotonFileSignature[8] = { 'P', 'O', 'V', 'P', 'H', 'O', 'T', '\x1A' };
+
+/// Version of the photon map file format.
+static const POV_UINT32 kPhotonFileVersion = 1;
+
+/// Header of the current photon map file format.
+///
+/// The header is followed directly by the surface photons, then the media photons, each in the
+/// order of their already balanced kd-tree. The data is stored in native format, so that it can
+/// be used in place when the file is mapped into memory.
+///
+struct PhotonFileHeader
+{
+    char        signature[8];       ///< @ref kPhotonFileSignature.
+    POV_UINT32  version;            ///< @ref kPhotonFileVersion.
+    POV_UINT32  photonSize;         ///< Size of a photon, to catch incompatible builds.
+    POV_INT32   surfacePhotons;     ///< Number of surface photons.
+    POV_INT32   mediaPhotons;       ///< Number of media photons.
+};
+
 /*
     If you pass a nullptr for the "strategy" parameter, then this will
     load the photon map from a file.
     Otherwise, it will:
-      1) merge
-      2) sort
-      3) compute gather options
-      4) clean up memory (delete the non-merged maps and delete the strategy)
+      1) merge the photons stored by the individual threads
+      2) sort the top levels of the kd-tree
+      3) clean up memory (delete the strategy)
+    leaving the subtrees to be sorted by PhotonTreeTask, possibly in
+    parallel; a second PhotonSortingTask, created with the short form of
+    the constructor, must then be run to compute the gather options.
+    A third one, created with the saving flag set, saves the photon map;
+    as it only reads the map, it may run alongside the render.
 */
-PhotonSortingTask::PhotonSortingTask(ViewData *vd, const vector<PhotonMap*>& surfaceMaps,
-                                     const vector<PhotonMap*>& mediaMaps, PhotonShootingStrategy* strategy,
-                                     size_t seed) :
+PhotonSortingTask::PhotonSortingTask(ViewData *vd, PhotonShootingStrategy* strategy, size_t seed) :
     RenderTask(vd, seed, "Photon"),
-    surfaceMaps(surfaceMaps),
-    mediaMaps(mediaMaps),
     strategy(strategy),
-    cooperate(*this)
+    cooperate(*this),
+    finishing(false),
+    saving(false)
+{
+}
+
+PhotonSortingTask::PhotonSortingTask(ViewData *vd, size_t seed, bool saving) :
+    RenderTask(vd, seed, "Photon"),
+    strategy(nullptr),
+    cooperate(*this),
+    finishing(!saving),
+    saving(saving)
 {
 }
 
@@ -109,7 +144,15 @@ void PhotonSortingTask::Run()
 
     Cooperate();
 
-    if (strategy != nullptr)
+    if (saving)
+    {
+        savePhotonMap();
+    }
+    else if (finishing)
+    {
+        finishPhotonMap();
+    }
+    else if (strategy != nullptr)
     {
         delete strategy;
         sortPhotonMap();
@@ -117,7 +160,7 @@ void PhotonSortingTask::Run()
     else
     {
         if (!this->load())
-            messageFactory.Error(POV_EXCEPTION_STRING("Failed to load photon map from disk"), "Could not load photon map (%s)",GetSceneData()->photonSettings.fileName.c_str());
+            messageFactory.Error(POV_EXCEPTION_STRING("Failed to load photon map from disk"), "Could not load photon map (%s)",GetViewData()->GetPhotonFileName().c_str());
 
         // set photon options automatically
         if (GetSceneData()->surfacePhotonMap.numPhotons>0)
@@ -141,29 +184,35 @@ void PhotonSortingTask::Finish()
     GetViewDataPtr()->timeType = TraceThreadData::kPhotonTime;
     GetViewDataPtr()->realTime = ConsumedRealTime();
     GetViewDataPtr()->cpuTime = ConsumedCPUTime();
+    ConsumedHardwareCounts(GetViewDataPtr()->hardwareCounts);
 }
 
 
 void PhotonSortingTask::sortPhotonMap()
 {
-    vector<PhotonMap*>::iterator mapIter;
-    for(mapIter = surfaceMaps.begin(); mapIter != surfaceMaps.end(); mapIter++)
-    {
-        GetSceneData()->surfacePhotonMap.mergeMap(*mapIter);
-        //delete (*mapIter);
-    }
-    for(mapIter = mediaMaps.begin(); mapIter != mediaMaps.end(); mapIter++)
-    {
-        GetSceneData()->mediaPhotonMap.mergeMap(*mapIter);
-        //delete (*mapIter);
-    }
+    GetSceneData()->surfacePhotonMap.mergeSlices();
+    GetSceneData()->mediaPhotonMap.mergeSlices();
 
-    /* now actually build the kd-tree by sorting the array of photons */
+    /* now actually build the top of the kd-tree by sorting the array of photons;
+       the subtrees are left to PhotonTreeTask */
     if (GetSceneData()->surfacePhotonMap.numPhotons>0)
-    {
-    //povwin::WIN32_DEBUG_FILE_OUTPUT("\n\nsurfacePhotonMap.buildTree about to be called\n");
+        GetSceneData()->surfacePhotonMap.buildTreeTop();
 
-        GetSceneData()->surfacePhotonMap.buildTree();
+#ifdef GLOBAL_PHOTONS
+    /* ----------- global photons ------------- */
+    if (globalPhotonMap.numPhotons>0)
+        globalPhotonMap.buildTreeTop();
+#endif
+
+    /* ----------- media photons ------------- */
+    if (GetSceneData()->mediaPhotonMap.numPhotons>0)
+        GetSceneData()->mediaPhotonMap.buildTreeTop();
+}
+
+void PhotonSortingTask::finishPhotonMap()
+{
+    if (GetSceneData()->surfacePhotonMap.numPhotons>0)
+    {
         GetSceneData()->surfacePhotonMap.setGatherOptions(GetSceneData()->photonSettings,false);
 //      povwin::WIN32_DEBUG_FILE_OUTPUT("gatherNumSteps: %d\n",GetSceneData()->surfacePhotonMap.gatherNumSteps);
 //      povwin::WIN32_DEBUG_FILE_OUTPUT("gatherRadStep: %lf\n",GetSceneData()->surfacePhotonMap.gatherRadStep);
@@ -174,21 +223,16 @@ void PhotonSortingTask::sortPhotonMap()
     }
 
 #ifdef GLOBAL_PHOTONS
-    /* ----------- global photons ------------- */
     if (globalPhotonMap.numPhotons>0)
-    {
-        globalPhotonMap.buildTree();
         globalPhotonMap.setGatherOptions(false);
-    }
 #endif
 
-    /* ----------- media photons ------------- */
     if (GetSceneData()->mediaPhotonMap.numPhotons>0)
-    {
-        GetSceneData()->mediaPhotonMap.buildTree();
         GetSceneData()->mediaPhotonMap.setGatherOptions(GetSceneData()->photonSettings,true);
-    }
+}
 
+void PhotonSortingTask::savePhotonMap()
+{
     if (GetSceneData()->surfacePhotonMap.numPhotons+
 #ifdef GLOBAL_PHOTONS
         globalPhotonMap.numPhotons+
@@ -196,7 +240,7 @@ void PhotonSortingTask::sortPhotonMap()
         GetSceneData()->mediaPhotonMap.numPhotons > 0)
     {
         /* should we save the photon map now that it is built? */
-        if (!GetSceneData()->photonSettings.fileName.empty() && !GetSceneData()->photonSettings.loadFile)
+        if (!GetViewData()->GetPhotonFileName().empty() && !GetViewData()->GetPhotonFileLoad())
         {
             /* status bar for user */
 //          Send_Progress("Saving Photon Maps", PROGRESS_SAVING_PHOTON_MAPS);
@@ -206,7 +250,7 @@ void PhotonSortingTask::sortPhotonMap()
     }
     else
     {
-        if (!GetSceneData()->photonSettings.fileName.empty() && !GetSceneData()->photonSettings.loadFile)
+        if (!GetViewData()->GetPhotonFileName().empty() && !GetViewData()->GetPhotonFileLoad())
             messageFactory.Warning(kWarningGeneral,"Could not save photon map - no photons!");
     }
 }
@@ -219,7 +263,7 @@ void PhotonSortingTask::sortPhotonMap()
   Preconditions:
     InitBacktraceEverything was called
     the photon map has been built and balanced
-    photonSettings.fileName contains the filename to save
+    the view data's photon file name contains the filename to save
 
   Postconditions:
     Returns true if success, false if failure.
@@ -233,13 +277,24 @@ bool PhotonSortingTask::save()
     size_t err;
     int numph;
 
-    f = fopen(GetSceneData()->photonSettings.fileName.c_str(), "wb");
+    f = fopen(GetViewData()->GetPhotonFileName().c_str(), "wb");
     if (!f)
         return false;
 
+    PhotonFileHeader header;
+    memcpy(header.signature, kPhotonFileSignature, sizeof(header.signature));
+    header.version = kPhotonFileVersion;
+    header.photonSize = sizeof(Photon);
+    header.surfacePhotons = GetSceneData()->surfacePhotonMap.numPhotons;
+    header.mediaPhotons = GetSceneData()->mediaPhotonMap.numPhotons;
+    if (fwrite(&header, sizeof(header), 1, f) != 1)
+    {
+        fclose(f);
+        return false;
+    }
+
     /* caustic photons */
     numph = GetSceneData()->surfacePhotonMap.numPhotons;
-    fwrite(&numph, sizeof(numph),1,f);
     if ((numph > 0) && !GetSceneData()->surfacePhotonMap.mBlockList.empty())
     {
         for(i=0; i<numph; i++)
@@ -260,34 +315,8 @@ bool PhotonSortingTask::save()
         messageFactory.PossibleError("Photon map for surface is empty.");
     }
 
-#ifdef GLOBAL_PHOTONS
-    /* global photons */
-    numph = globalPhotonMap.numPhotons;
-    fwrite(&numph, sizeof(numph),1,f);
-    if ((numph > 0) && !globalPhotonMap.mBlockList.empty())
-    {
-        for(i=0; i<numph; i++)
-        {
-            ph = &globalPhotonMap.GetPhoton(i);
-            err = fwrite(ph, sizeof(Photon), 1, f);
-
-            if (err<=0)
-            {
-                /* fwrite returned an error! */
-                fclose(f);
-                return false;
-            }
-        }
-    }
-    else
-    {
-        messageFactory.PossibleError("Global photon map is empty.");
-    }
-#endif
-
     /* media photons */
     numph = GetSceneData()->mediaPhotonMap.numPhotons;
-    fwrite(&numph, sizeof(numph),1,f);
     if ((numph > 0) && !GetSceneData()->mediaPhotonMap.mBlockList.empty())
     {
         for(i=0; i<numph; i++)
@@ -316,10 +345,14 @@ bool PhotonSortingTask::save()
 
   Loads the caustic photon map from a file.
 
+  Files in the current format are mapped into memory and used in place,
+  so that loading takes next to no time, and concurrent renders on the
+  same machine share the photon data; legacy files are read into memory.
+
   Preconditions:
     InitBacktraceEverything was called
     the photon map is empty
-    renderer->sceneData->photonSettings.fileName contains the filename to load
+    the view data's photon file name contains the filename to load
 
   Postconditions:
     Returns true if success, false if failure.
@@ -336,9 +369,37 @@ bool PhotonSortingTask::load()
 
     if (!GetSceneData()->photonSettings.photonsEnabled) return false;
 
-    messageFactory.Warning(kWarningGeneral,"Starting the load of photon file %s\n",GetSceneData()->photonSettings.fileName.c_str());
+    messageFactory.Warning(kWarningGeneral,"Starting the load of photon file %s\n",GetViewData()->GetPhotonFileName().c_str());
+
+    shared_ptr<MappedFile> file(new MappedFile());
+    if (!file->Open(GetViewData()->GetPhotonFileName().c_str()))
+        return false;
+
+    const PhotonFileHeader* header = reinterpret_cast<const PhotonFileHeader*>(file->GetData());
+    if ((file->GetSize() >= sizeof(PhotonFileHeader)) &&
+        (memcmp(header->signature, kPhotonFileSignature, sizeof(header->signature)) == 0))
+    {
+        if ((header->version != kPhotonFileVersion) || (header->photonSize != sizeof(Photon)))
+        {
+            messageFactory.PossibleError("Photon map file was written by an incompatible version of POV-Ray.");
+            return false;
+        }
+        if ((header->surfacePhotons < 0) || (header->mediaPhotons < 0) ||
+            (file->GetSize() < sizeof(PhotonFileHeader) + (size_t(header->surfacePhotons) + size_t(header->mediaPhotons)) * sizeof(Photon)))
+            return false;
+
+        // use the photons in place; they are already in kd-tree order
+        const Photon* photons = reinterpret_cast<const Photon*>(header + 1);
+        if (header->surfacePhotons > 0)
+            GetSceneData()->surfacePhotonMap.MapPhotons(file, photons, header->surfacePhotons);
+        if (header->mediaPhotons > 0)
+            GetSceneData()->mediaPhotonMap.MapPhotons(file, photons + header->surfacePhotons, header->mediaPhotons);
+        return true;
+    }
+    file.reset();
 
-    f = fopen(GetSceneData()->photonSettings.fileName.c_str(), "rb");
+    // legacy file format
+    f = fopen(GetViewData()->GetPhotonFileName().c_str(), "rb");
     if (!f)
         return false;
 
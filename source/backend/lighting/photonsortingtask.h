@@ -46,7 +46,6 @@ namespace pov
 
 using namespace pov_base;
 
-class PhotonMap;
 class PhotonShootingStrategy;
 
 class PhotonSortingTask : public RenderTask
@@ -54,12 +53,10 @@ class PhotonSortingTask : public RenderTask
     public:
         Timer timer;
 
-        vector<PhotonMap*> surfaceMaps;
-        vector<PhotonMap*> mediaMaps;
         PhotonShootingStrategy* strategy;
 
-        PhotonSortingTask(ViewData *vd, const vector<PhotonMap*>& surfaceMaps, const vector<PhotonMap*>& mediaMaps,
-                          PhotonShootingStrategy* strategy, size_t seed);
+        PhotonSortingTask(ViewData *vd, PhotonShootingStrategy* strategy, size_t seed);
+        PhotonSortingTask(ViewData *vd, size_t seed, bool saving = false);
         ~PhotonSortingTask();
 
         void Run();
@@ -69,6 +66,8 @@ class PhotonSortingTask : public RenderTask
         void SendProgress();
 
         void sortPhotonMap();
+        void finishPhotonMap();
+        void savePhotonMap();
         bool save();
         bool load();
     private:
@@ -82,6 +81,8 @@ class PhotonSortingTask : public RenderTask
         };
 
         CooperateFunction cooperate;
+        bool finishing;
+        bool saving;
 };
 
 }
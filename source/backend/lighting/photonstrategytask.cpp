@@ -143,6 +143,7 @@ void PhotonStrategyTask::Finish()
     GetViewDataPtr()->timeType = TraceThreadData::kPhotonTime;
     GetViewDataPtr()->realTime = ConsumedRealTime();
     GetViewDataPtr()->cpuTime = ConsumedCPUTime();
+    ConsumedHardwareCounts(GetViewDataPtr()->hardwareCounts);
 }
 
 
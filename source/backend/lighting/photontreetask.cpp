@@ -0,0 +1,87 @@
+//******************************************************************************
+///
+/// @file backend/lighting/photontreetask.cpp
+///
+/// Implementations related to the parallel photon kd-tree construction task.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// frame.h must always be the first POV file included (pulls in platform config)
+#include "backend/frame.h"
+#include "backend/lighting/photontreetask.h"
+
+#include "core/lighting/photons.h"
+
+#include "backend/scene/backendscenedata.h"
+#include "backend/scene/view.h"
+#include "backend/scene/viewthreaddata.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+PhotonTreeTask::PhotonTreeTask(ViewData *vd, size_t seed) :
+    RenderTask(vd, seed, "Photon")
+{
+    // do nothing
+}
+
+PhotonTreeTask::~PhotonTreeTask()
+{
+}
+
+void PhotonTreeTask::Run()
+{
+    // quit right away if photons not enabled
+    if (!GetSceneData()->photonSettings.photonsEnabled) return;
+
+    while (GetSceneData()->surfacePhotonMap.buildSubtree())
+        Cooperate();
+
+    while (GetSceneData()->mediaPhotonMap.buildSubtree())
+        Cooperate();
+}
+
+void PhotonTreeTask::Stopped()
+{
+    // nothing to do for now [trf]
+}
+
+void PhotonTreeTask::Finish()
+{
+    GetViewDataPtr()->timeType = TraceThreadData::kPhotonTime;
+    GetViewDataPtr()->realTime = ConsumedRealTime();
+    GetViewDataPtr()->cpuTime = ConsumedCPUTime();
+    ConsumedHardwareCounts(GetViewDataPtr()->hardwareCounts);
+}
+
+}
@@ -0,0 +1,65 @@
+//******************************************************************************
+///
+/// @file backend/lighting/photontreetask.h
+///
+/// Declarations related to the parallel photon kd-tree construction task.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef PHOTONTREETASK_H
+#define PHOTONTREETASK_H
+
+#include "backend/frame.h"
+#include "backend/render/rendertask.h"
+
+namespace pov
+{
+
+using namespace pov_base;
+
+/// Task to build the subtrees of the photon maps' kd-trees.
+///
+/// Any number of these tasks may run in parallel, after @ref PhotonSortingTask has merged the
+/// photon maps and built the top levels of their kd-trees; each takes subtrees from the maps
+/// until none are left.
+///
+class PhotonTreeTask : public RenderTask
+{
+    public:
+        PhotonTreeTask(ViewData *vd, size_t seed);
+        ~PhotonTreeTask();
+
+        void Run();
+        void Stopped();
+        void Finish();
+};
+
+}
+#endif
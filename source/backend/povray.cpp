@@ -51,6 +51,7 @@
 #include "base/timer.h"
 #include "base/types.h"
 
+#include "core/bounding/flatbvh.h"
 #include "core/material/noise.h"
 #include "core/material/pattern.h"
 
@@ -518,6 +519,19 @@ void BuildInitInfo(POVMSObjectPtr msg)
             else
                 err = POVMSAttr_Delete(&attr);
         }
+#endif
+#ifdef TRY_OPTIMIZED_BVH
+        std::string bvhInfo = "Flattened BVH node test: " + std::string(GetFlatBVHNodeTestInfo());
+        if (err == kNoErr)
+            err = POVMSAttr_New(&attr);
+        if (err == kNoErr)
+        {
+            err = POVMSAttr_Set(&attr, kPOVMSType_CString, reinterpret_cast<const void *>(bvhInfo.c_str()), bvhInfo.length() + 1);
+            if (err == kNoErr)
+                err = POVMSAttrList_Append(&attrlist, &attr);
+            else
+                err = POVMSAttr_Delete(&attr);
+        }
 #endif
     }
     if (err == kNoErr)
@@ -643,6 +657,7 @@ boost::thread *povray_init(const boost::function0<void>& threadExit, POVMSAddres
         POV_MainThreadTerminated = false;
 
         Initialize_Noise();
+        Initialise_FlatBVHDispatch();
         pov::InitializePatternGenerators();
 
         POV_MainThread = Task::NewBoostThread(boost::bind(&MainThreadFunction, threadExit), POV_THREAD_STACK_SIZE);
@@ -689,5 +704,5 @@ void povray_terminate()
     delete POV_MainThread;
     POV_MainThread = nullptr;
 
-    Free_Noise_Tables(); // TODO FIXME - don't add such calls here!
+    TaskWorkerPool::Shutdown();
 }
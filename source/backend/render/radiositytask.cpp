@@ -55,6 +55,11 @@ namespace pov
 
 using namespace pov_base;
 
+// a sub-block's pretrace has converged once fewer than this fraction of its top-level queries take new samples...
+#define PRETRACE_CONVERGED_GATHER_RATE  0.02
+// ...and the samples found nearby predict the newly gathered illumination to within this relative error
+#define PRETRACE_CONVERGED_ERROR        0.1
+
 RadiosityTask::RadiosityTask(ViewData *vd, DBL ptsz, DBL ptesz, unsigned int pts, unsigned int ptsc, unsigned int nt,
                              size_t seed) :
     RenderTask(vd, seed, "Radiosity", vd->GetViewId()),
@@ -72,6 +77,7 @@ RadiosityTask::RadiosityTask(ViewData *vd, DBL ptsz, DBL ptesz, unsigned int pts
     pretraceCoverage(vd->GetSceneData()->radiositySettings.nearestCountAPT),
     nominalThreads(nt)
 {
+    trace.SetCameraRayTable(vd->GetCameraRayTable());
 }
 
 RadiosityTask::~RadiosityTask()
@@ -97,6 +103,10 @@ void RadiosityTask::Run()
 
     ViewData::BlockInfo* pInfo;
 
+    // pretrace steps run as separate tasks are skipped altogether once out of time
+    if ((pretraceStep > RadiosityFunction::PRETRACE_FIRST) && GetViewData()->PretraceTimeBudgetExceeded())
+        return;
+
     while(GetViewData()->GetNextRectangle(rect, serial, pInfo, nominalThreads) == true)
     {
         RadiosityBlockInfo* pBlockInfo = dynamic_cast<RadiosityBlockInfo*>(pInfo);
@@ -192,7 +202,10 @@ void RadiosityTask::Run()
 
             long  queryCount;
             float reuse;
+            long  gatherCount;
+            float error;
             radiosity.GetTopLevelStats(queryCount, reuse);
+            radiosity.GetTopLevelConvergence(gatherCount, error);
 
             bool again;
             if (pixelCount < 9)
@@ -205,6 +218,9 @@ void RadiosityTask::Run()
             else if ((pretraceCoverage != 0) && (reuse / (float)queryCount >= pretraceCoverage))
                 // stop if the average number of re-usable samples reaches a certain threshold
                 again = false;
+            else if ((pBlockInfo->pass > 0) && (gatherCount < PRETRACE_CONVERGED_GATHER_RATE * queryCount) && (error < PRETRACE_CONVERGED_ERROR))
+                // stop if hardly any samples are added anymore, and those that are could have been interpolated well enough
+                again = false;
             else
                 // otherwise do another pass
                 again = true;
@@ -225,7 +241,8 @@ void RadiosityTask::Run()
 
         pBlockInfo->pass ++;
 
-        if (pBlockInfo->pass < pretraceStepCount && pBlockInfo->incompleteSubBlocks.size() > 0)
+        // with a time budget, pretrace ends early rather than taking time from the final render
+        if (pBlockInfo->pass < pretraceStepCount && pBlockInfo->incompleteSubBlocks.size() > 0 && !GetViewData()->PretraceTimeBudgetExceeded())
         {
             // run another pass
             pBlockInfo->subBlockCountX *= subBlockDivideX;
@@ -258,6 +275,7 @@ void RadiosityTask::Finish()
     GetViewDataPtr()->timeType = TraceThreadData::kRadiosityTime;
     GetViewDataPtr()->realTime = ConsumedRealTime();
     GetViewDataPtr()->cpuTime = ConsumedCPUTime();
+    ConsumedHardwareCounts(GetViewDataPtr()->hardwareCounts);
 }
 
 }
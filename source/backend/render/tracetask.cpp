@@ -33,6 +33,7 @@
 ///
 //******************************************************************************
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -46,7 +47,9 @@
 #include "core/math/chi2.h"
 #include "core/math/jitter.h"
 #include "core/math/matrix.h"
+#include "core/math/randomsequence.h"
 #include "core/render/trace.h"
+#include "core/support/simplevector.h"
 
 #include "backend/scene/backendscenedata.h"
 #include "backend/scene/view.h"
@@ -221,7 +224,7 @@ void TraceTask::SubdivisionBuffer::Clear()
 
 TraceTask::TraceTask(ViewData *vd, unsigned int tm, DBL js,
                      DBL aat, DBL aac, unsigned int aad, pov_base::GammaCurvePtr& aag,
-                     unsigned int ps, bool psc, bool contributesToImage, bool hr, size_t seed) :
+                     unsigned int ps, bool psc, bool contributesToImage, bool hr, bool wf, size_t seed) :
     RenderTask(vd, seed, "Trace"),
     trace(vd->GetSceneData(), &vd->GetCamera(), GetViewDataPtr(), vd->GetSceneData()->parsedMaxTraceLevel, vd->GetSceneData()->parsedAdcBailout,
           vd->GetQualityFeatureFlags(), cooperate, media, radiosity),
@@ -237,6 +240,10 @@ TraceTask::TraceTask(ViewData *vd, unsigned int tm, DBL js,
     passContributesToImage(contributesToImage),
     passCompletesImage((ps == 0) || ((ps == 1) && contributesToImage)),
     highReproducibility(hr),
+    deadlineBound((ps == 0) || psc),
+    wavefront(wf),
+    blockAffinity(std::numeric_limits<unsigned int>::max()),
+    sampleStore(vd->GetSampleStore()),
     media(GetViewDataPtr(), &trace, &photonGatherer),
     radiosity(vd->GetSceneData(), GetViewDataPtr(),
               vd->GetSceneData()->radiositySettings, vd->GetRadiosityCache(), cooperate, true, vd->GetCamera().Location),
@@ -265,6 +272,15 @@ TraceTask::TraceTask(ViewData *vd, unsigned int tm, DBL js,
 #endif
     // TODO: this could be initialised someplace more suitable
     GetViewDataPtr()->qualityFlags = vd->GetQualityFeatureFlags();
+
+    // mosaic preview passes are left out of the cost and feature maps, as they'd attribute their samples to the wrong pixels
+    if(passContributesToImage)
+    {
+        trace.SetCostMap(vd->GetCostMap());
+        trace.SetFeatureMap(vd->GetFeatureMap());
+    }
+
+    trace.SetCameraRayTable(vd->GetCameraRayTable());
 }
 
 TraceTask::~TraceTask()
@@ -273,11 +289,16 @@ TraceTask::~TraceTask()
 
 void TraceTask::Run()
 {
+    POV_ULONG heapAllocations = VectorPoolHeapAllocations();
+
 #ifdef RTR_HACK
     bool forever = GetViewData()->GetRealTimeRaytracing();
     do
     {
 #endif
+        if(deadlineBound && GetViewData()->HasTimeBudget())
+            ApplyTimeBudget();
+
         switch(tracingMethod)
         {
             case 0:
@@ -295,6 +316,9 @@ void TraceTask::Run()
             case 3:
                 StochasticSupersamplingM3();
                 break;
+            case 4:
+                ProgressiveSamplingM4();
+                break;
         }
 
 #ifdef RTR_HACK
@@ -308,6 +332,7 @@ void TraceTask::Run()
     } while(forever);
 #endif
 
+    GetViewDataPtr()->Stats()[Trace_Heap_Allocations] += VectorPoolHeapAllocations() - heapAllocations;
     GetViewData()->SetHighestTraceLevel(trace.GetHighestTraceLevel());
 }
 
@@ -321,6 +346,7 @@ void TraceTask::Finish()
     GetViewDataPtr()->timeType = TraceThreadData::kRenderTime;
     GetViewDataPtr()->realTime = ConsumedRealTime();
     GetViewDataPtr()->cpuTime = ConsumedCPUTime();
+    ConsumedHardwareCounts(GetViewDataPtr()->hardwareCounts);
 
 #ifdef PROFILE_INTERSECTIONS
     if (gDoneBSP && gDoneBVH)
@@ -387,47 +413,97 @@ void TraceTask::Finish()
 #endif
 }
 
+void TraceTask::ApplyTimeBudget()
+{
+    aaDepth = min(aaDepth, GetViewData()->GetTimeBudgetAntialiasDepth());
+
+    if(GetViewData()->GetTimeBudgetScale() < 1.0)
+        radiosity.ScaleRaysPerSample(GetViewData()->GetTimeBudgetScale());
+
+    if(!GetViewData()->GetTimeBudgetAreaLights())
+    {
+        QualityFlags qualityFlags(GetViewData()->GetQualityFeatureFlags());
+        qualityFlags.areaLights = false;
+        trace.SetQualityFlags(qualityFlags);
+    }
+}
+
+/// Hand back a rectangle unchanged if the time budget has been used up, leaving the result of
+/// a previous pass in place.
+bool TraceTask::OutOfTime(const POVRect& rect, unsigned int serial)
+{
+    if(!deadlineBound || !GetViewData()->TimeBudgetExceeded())
+        return false;
+
+    GetViewData()->CompletedRectangle(rect, serial, 0.0f);
+    return true;
+}
+
 void TraceTask::SimpleSamplingM0()
 {
     POVRect rect;
     vector<RGBTColour> pixels;
     unsigned int serial;
 
-    while(GetViewData()->GetNextRectangle(rect, serial) == true)
+    while(GetViewData()->GetNextRectangle(rect, serial, blockAffinity) == true)
     {
+        if(OutOfTime(rect, serial))
+            continue;
+
+        trace.SetCostRectangle(rect);
+
         radiosity.BeforeTile(highReproducibility? serial : 0);
 
         pixels.clear();
         pixels.reserve(rect.GetArea());
 
-        for(DBL y = DBL(rect.top); y <= DBL(rect.bottom); y++)
+        // pick up the pixels already traced by the mosaic preview
+        unsigned int stored = 0;
+        if(sampleStore != nullptr)
+            stored = sampleStore->TakeCentres(rect, storedColours, storedFound);
+
+        if(wavefront)
+            WavefrontSampleRectangle(rect, pixels, stored);
+        else
         {
-            for(DBL x = DBL(rect.left); x <= DBL(rect.right); x++)
+            unsigned int i = 0;
+            for(DBL y = DBL(rect.top); y <= DBL(rect.bottom); y++)
             {
-#ifdef PROFILE_INTERSECTIONS
-                POV_LONG it = std::numeric_limits<POV_ULONG>::max();
-                for (int i = 0 ; i < 3 ; i++)
+                for(DBL x = DBL(rect.left); x <= DBL(rect.right); x++, i++)
                 {
-                    TransColour c;
-                    gIntersectionTime = 0;
-                    trace(x+0.5, y+0.5, GetViewData()->GetWidth(), GetViewData()->GetHeight(), c);
-                    if (gIntersectionTime < it)
-                        it = gIntersectionTime;
-                }
-                (*gIntersectionTimes)[(int) y] [(int) x] = it;
-                if (it < gMinVal)
-                    gMinVal = it;
-                if (it > gMaxVal)
-                    gMaxVal = it;
+                    if((stored > 0) && storedFound[i])
+                    {
+                        pixels.push_back(storedColours[i]);
+                        GetViewDataPtr()->Stats()[Number_Of_Pixels]++;
+                        GetViewDataPtr()->Stats()[Reused_Camera_Rays]++;
+                        continue;
+                    }
+
+#ifdef PROFILE_INTERSECTIONS
+                    POV_LONG it = std::numeric_limits<POV_ULONG>::max();
+                    for (int i = 0 ; i < 3 ; i++)
+                    {
+                        TransColour c;
+                        gIntersectionTime = 0;
+                        trace(x+0.5, y+0.5, GetViewData()->GetWidth(), GetViewData()->GetHeight(), c);
+                        if (gIntersectionTime < it)
+                            it = gIntersectionTime;
+                    }
+                    (*gIntersectionTimes)[(int) y] [(int) x] = it;
+                    if (it < gMinVal)
+                        gMinVal = it;
+                    if (it > gMaxVal)
+                        gMaxVal = it;
 #endif
-                RGBTColour col;
+                    RGBTColour col;
 
-                trace(x+0.5, y+0.5, GetViewData()->GetWidth(), GetViewData()->GetHeight(), col);
-                GetViewDataPtr()->Stats()[Number_Of_Pixels]++;
+                    trace(x+0.5, y+0.5, GetViewData()->GetWidth(), GetViewData()->GetHeight(), col);
+                    GetViewDataPtr()->Stats()[Number_Of_Pixels]++;
 
-                pixels.push_back(col);
+                    pixels.push_back(col);
 
-                Cooperate();
+                    Cooperate();
+                }
             }
         }
 
@@ -440,6 +516,58 @@ void TraceTask::SimpleSamplingM0()
     }
 }
 
+/// Interleave the bits of the lower 16 bits of two coordinates, giving the index along a Z-order curve.
+static unsigned int MortonCode(unsigned int x, unsigned int y)
+{
+    unsigned int code = 0;
+
+    for(unsigned int bit = 0; bit < 16; bit++)
+        code |= (((x >> bit) & 1u) << (2 * bit)) | (((y >> bit) & 1u) << (2 * bit + 1));
+
+    return code;
+}
+
+void TraceTask::WavefrontSampleRectangle(const POVRect& rect, vector<RGBTColour>& pixels, unsigned int stored)
+{
+    unsigned int width = rect.GetWidth();
+    unsigned int area = rect.GetArea();
+
+    pixels.resize(area);
+
+    // Queue up the primary rays of the whole block, sorted along a Z-order curve so that
+    // consecutive rays are close together in both origin and direction; each ray packet
+    // thus covers a compact patch of the image rather than a strip of a single row.
+    // Pixels found in the sample store are filled in right away instead.
+    pixelQueue.clear();
+    for(unsigned int i = 0; i < area; i++)
+    {
+        if((stored > 0) && storedFound[i])
+            pixels[i] = storedColours[i];
+        else
+            pixelQueue.push_back(std::make_pair(MortonCode(i % width, i / width), i));
+    }
+    std::sort(pixelQueue.begin(), pixelQueue.end());
+
+    if(!pixelQueue.empty())
+    {
+        samplePositions.clear();
+        for(vector<std::pair<unsigned int, unsigned int> >::const_iterator i = pixelQueue.begin(); i != pixelQueue.end(); i++)
+            samplePositions.push_back(Vector2d(DBL(rect.left + (i->second % width)) + 0.5, DBL(rect.top + (i->second / width)) + 0.5));
+
+        sampleColours.resize(pixelQueue.size());
+        trace(&samplePositions[0], pixelQueue.size(), GetViewData()->GetWidth(), GetViewData()->GetHeight(), &sampleColours[0]);
+
+        // Return the results in scanline order.
+        for(size_t i = 0; i < pixelQueue.size(); i++)
+            pixels[pixelQueue[i].second] = sampleColours[i];
+    }
+
+    GetViewDataPtr()->Stats()[Number_Of_Pixels] += area;
+    GetViewDataPtr()->Stats()[Reused_Camera_Rays] += area - pixelQueue.size();
+
+    Cooperate();
+}
+
 void TraceTask::SimpleSamplingM0P()
 {
     DBL stepsize(previewSize);
@@ -448,10 +576,18 @@ void TraceTask::SimpleSamplingM0P()
     vector<RGBTColour> pixelcolors;
     unsigned int serial;
 
-    while(GetViewData()->GetNextRectangle(rect, serial) == true)
+    while(GetViewData()->GetNextRectangle(rect, serial, blockAffinity) == true)
     {
+        if(OutOfTime(rect, serial))
+            continue;
+
+        trace.SetCostRectangle(rect);
+
         radiosity.BeforeTile(highReproducibility? serial : 0);
 
+        // Take note of the rays traced for the block, to estimate its cost in the final pass.
+        POV_ULONG rays = GetViewDataPtr()->Stats()[Number_Of_Rays] + GetViewDataPtr()->Stats()[Shadow_Ray_Tests];
+
         unsigned int px = (rect.GetWidth() + previewSize - 1) / previewSize;
         unsigned int py = (rect.GetHeight() + previewSize - 1) / previewSize;
 
@@ -497,6 +633,12 @@ void TraceTask::SimpleSamplingM0P()
 
         radiosity.AfterTile();
 
+        // keep the pixels for the final pass to pick up
+        if((sampleStore != nullptr) && sampleStore->KeepsPreviewSamples())
+            sampleStore->AddCentres(pixelpositions, pixelcolors);
+
+        GetViewData()->AddRectangleCost(serial, GetViewDataPtr()->Stats()[Number_Of_Rays] + GetViewDataPtr()->Stats()[Shadow_Ray_Tests] - rays);
+
         GetViewDataPtr()->AfterTile();
         if(pixelpositions.size() > 0)
             GetViewData()->CompletedRectangle(rect, serial, pixelpositions, pixelcolors, previewSize, passContributesToImage, passCompletesImage);
@@ -512,16 +654,29 @@ void TraceTask::NonAdaptiveSupersamplingM1()
 
     jitterScale = jitterScale / DBL(aaDepth);
 
-    while(GetViewData()->GetNextRectangle(rect, serial) == true)
+    while(GetViewData()->GetNextRectangle(rect, serial, blockAffinity) == true)
     {
+        if(OutOfTime(rect, serial))
+            continue;
+
+        trace.SetCostRectangle(rect);
+
         radiosity.BeforeTile(highReproducibility? serial : 0);
 
         SmartBlock pixels(rect.left, rect.top, rect.GetWidth(), rect.GetHeight());
 
-        // sample line above current block
+        // pick up the pixels already traced by the mosaic preview
+        unsigned int stored = 0;
+        if(sampleStore != nullptr)
+            stored = sampleStore->TakeCentres(rect, storedColours, storedFound);
+
+        // sample line above current block, unless the block above has left it behind
         for(int x = rect.left; x <= rect.right; x++)
         {
-            trace(x+0.5, rect.top-0.5, GetViewData()->GetWidth(), GetViewData()->GetHeight(), pixels(x, rect.top - 1));
+            if((sampleStore != nullptr) && sampleStore->FindCentre(x, rect.top - 1, pixels(x, rect.top - 1)))
+                GetViewDataPtr()->Stats()[Reused_Camera_Rays]++;
+            else
+                trace(x+0.5, rect.top-0.5, GetViewData()->GetWidth(), GetViewData()->GetHeight(), pixels(x, rect.top - 1));
             GetViewDataPtr()->Stats()[Number_Of_Pixels]++;
 
             // Cannot supersample this pixel, so just claim it was already supersampled! [trf]
@@ -533,7 +688,11 @@ void TraceTask::NonAdaptiveSupersamplingM1()
 
         for(int y = rect.top; y <= rect.bottom; y++)
         {
-            trace(rect.left-0.5, y+0.5, GetViewData()->GetWidth(), GetViewData()->GetHeight(), pixels(rect.left - 1, y)); // sample pixel left of current line in block
+            // sample pixel left of current line in block, unless the block to the left has left it behind
+            if((sampleStore != nullptr) && sampleStore->FindCentre(rect.left - 1, y, pixels(rect.left - 1, y)))
+                GetViewDataPtr()->Stats()[Reused_Camera_Rays]++;
+            else
+                trace(rect.left-0.5, y+0.5, GetViewData()->GetWidth(), GetViewData()->GetHeight(), pixels(rect.left - 1, y));
             GetViewDataPtr()->Stats()[Number_Of_Pixels]++;
 
             // Cannot supersample this pixel, so just claim it was already supersampled! [trf]
@@ -556,10 +715,22 @@ void TraceTask::NonAdaptiveSupersamplingM1()
 
             for(int x = rect.left; x <= rect.right; x++)
             {
-                // trace current pixel
-                trace(x+0.5, y+0.5, GetViewData()->GetWidth(), GetViewData()->GetHeight(), pixels(x, y));
+                // trace current pixel, unless the mosaic preview has already done so
+                unsigned int i = (y - rect.top) * rect.GetWidth() + (x - rect.left);
+                if((stored > 0) && storedFound[i])
+                {
+                    pixels(x, y) = storedColours[i];
+                    GetViewDataPtr()->Stats()[Reused_Camera_Rays]++;
+                }
+                else
+                    trace(x+0.5, y+0.5, GetViewData()->GetWidth(), GetViewData()->GetHeight(), pixels(x, y));
                 GetViewDataPtr()->Stats()[Number_Of_Pixels]++;
 
+                // leave the pixels along the right and bottom edges behind for the neighbouring blocks,
+                // before anti-aliasing changes them
+                if((sampleStore != nullptr) && ((x == rect.right) || (y == rect.bottom)))
+                    sampleStore->AddCentre(x, y, pixels(x, y));
+
                 Cooperate();
 
                 bool sampleleft = (pixels.GetFlag(x - 1, y) == false);
@@ -597,8 +768,13 @@ void TraceTask::AdaptiveSupersamplingM2()
 
     jitterScale = jitterScale / DBL((1 << aaDepth) + 1);
 
-    while(GetViewData()->GetNextRectangle(rect, serial) == true)
+    while(GetViewData()->GetNextRectangle(rect, serial, blockAffinity) == true)
     {
+        if(OutOfTime(rect, serial))
+            continue;
+
+        trace.SetCostRectangle(rect);
+
         radiosity.BeforeTile(highReproducibility? serial : 0);
 
         SmartBlock pixels(rect.left, rect.top, rect.GetWidth(), rect.GetHeight());
@@ -607,8 +783,17 @@ void TraceTask::AdaptiveSupersamplingM2()
         {
             for(int x = rect.left; x <= rect.right + 1; x++)
             {
-                // trace upper-left corners of all pixels
-                trace(x, y, GetViewData()->GetWidth(), GetViewData()->GetHeight(), pixels(x, y));
+                // trace upper-left corners of all pixels; those along the block border are shared
+                // with the neighbouring blocks, so whichever block gets there first leaves them behind
+                bool border = (sampleStore != nullptr) && ((x == rect.left) || (x == rect.right + 1) || (y == rect.top) || (y == rect.bottom + 1));
+                if(border && sampleStore->FindCorner(x, y, pixels(x, y)))
+                    GetViewDataPtr()->Stats()[Reused_Camera_Rays]++;
+                else
+                {
+                    trace(x, y, GetViewData()->GetWidth(), GetViewData()->GetHeight(), pixels(x, y));
+                    if(border)
+                        sampleStore->AddCorner(x, y, pixels(x, y));
+                }
                 GetViewDataPtr()->Stats()[Number_Of_Pixels]++;
 
                 Cooperate();
@@ -652,6 +837,7 @@ void TraceTask::StochasticSupersamplingM3()
     vector<unsigned int> pixelsSamples;
     unsigned int serial;
     bool sampleMore;
+    bool useSampler = (GetViewData()->GetSceneData()->samplingMethod == kSamplingMethod_Sobol);
 
     // Create list of thresholds for confidence test.
     vector<double> confidenceFactor;
@@ -669,9 +855,14 @@ void TraceTask::StochasticSupersamplingM3()
     else
         confidenceFactor.push_back(0.0);
 
-    while(GetViewData()->GetNextRectangle(rect, serial) == true)
+    while(GetViewData()->GetNextRectangle(rect, serial, blockAffinity) == true)
     {
-        GetViewDataPtr()->stochasticRandomGenerator->Seed(GetViewDataPtr()->stochasticRandomSeedBase + serial);
+        if(OutOfTime(rect, serial))
+            continue;
+
+        trace.SetCostRectangle(rect);
+
+        GetViewDataPtr()->stochasticRandomGenerator.Seed(GetViewDataPtr()->stochasticRandomSeedBase + serial);
 
         radiosity.BeforeTile(highReproducibility? serial : 0);
 
@@ -757,7 +948,11 @@ void TraceTask::StochasticSupersamplingM3()
                         RGBTColour colTemp;
                         PreciseRGBTColour col, colSqr;
 
-                        Vector2d jitter = Uniform2dOnSquare(GetViewDataPtr()->stochasticRandomGenerator) - 0.5;
+                        Vector2d jitter;
+                        if (useSampler)
+                            jitter = LowDiscrepancySampler::PixelSet(x, y, kSamplerStream_Pixel).Get2d(samples) - 0.5;
+                        else
+                            jitter = Uniform2dOnSquare(GetViewDataPtr()->stochasticRandomGenerator) - 0.5;
                         trace(x+0.5 + jitter.x(), y+0.5 + jitter.y(), GetViewData()->GetWidth(), GetViewData()->GetHeight(), colTemp);
 
                         col = PreciseRGBTColour(GammaCurve::Encode(aaGamma, colTemp));
@@ -822,6 +1017,97 @@ void TraceTask::StochasticSupersamplingM3()
     }
 }
 
+void TraceTask::ProgressiveSamplingM4()
+{
+    POVRect rect;
+    vector<RGBTColour> pixels;
+    unsigned int serial;
+    unsigned int pass = GetViewData()->GetProgressivePass();
+    bool useSampler = (GetViewData()->GetSceneData()->samplingMethod == kSamplingMethod_Sobol);
+
+    if(!GetViewData()->ProgressivePassPending())
+        return;
+
+    while(GetViewData()->GetNextRectangle(rect, serial, blockAffinity) == true)
+    {
+        if(OutOfTime(rect, serial))
+            continue;
+
+        trace.SetCostRectangle(rect);
+
+        // Once the time limit has passed, refinement passes merely hand back their blocks unchanged.
+        if((pass > 0) && GetViewData()->ProgressiveTimeExceeded())
+        {
+            GetViewData()->CompletedRectangle(rect, serial, 0.0f);
+            continue;
+        }
+
+        // make sure every pass jitters its samples differently
+        GetViewDataPtr()->stochasticRandomGenerator.Seed(GetViewDataPtr()->stochasticRandomSeedBase + serial +
+                                                           pass * GetViewData()->GetWidth() * GetViewData()->GetHeight());
+
+        radiosity.BeforeTile(highReproducibility? serial : 0);
+
+        pixels.clear();
+        pixels.reserve(rect.GetArea());
+
+        bool sampled = false;
+
+        for(unsigned int y = rect.top; y <= rect.bottom; y++)
+        {
+            for(unsigned int x = rect.left; x <= rect.right; x++)
+            {
+                ViewData::ProgressivePixel& pixel = GetViewData()->GetProgressivePixel(x, y);
+                unsigned int samples = GetViewData()->GetProgressiveSamples(pixel);
+
+                if((samples > 0) && (pixel.samples == 0))
+                    GetViewDataPtr()->Stats()[Number_Of_Pixels]++;
+
+                for(unsigned int i = 0; i < samples; i++)
+                {
+                    RGBTColour colTemp;
+
+                    // With the low-discrepancy sampler, the sample count makes successive passes continue the same sequence.
+                    Vector2d jitter;
+                    if (useSampler)
+                        jitter = LowDiscrepancySampler::PixelSet(x, y, kSamplerStream_Pixel).Get2d(pixel.samples) - 0.5;
+                    else
+                        jitter = Uniform2dOnSquare(GetViewDataPtr()->stochasticRandomGenerator) - 0.5;
+                    trace(x+0.5 + jitter.x(), y+0.5 + jitter.y(), GetViewData()->GetWidth(), GetViewData()->GetHeight(), colTemp);
+
+                    RGBTColour col = GammaCurve::Encode(aaGamma, colTemp);
+
+                    // Welford's method, to keep the statistics accurate in single precision.
+                    pixel.colourSum += colTemp;
+                    pixel.samples ++;
+                    RGBTColour delta = col - pixel.mean;
+                    pixel.mean += delta / pixel.samples;
+                    pixel.squaredDeviations += delta * (col - pixel.mean);
+
+                    sampled = true;
+
+                    Cooperate();
+                }
+
+                if(pixel.samples > 0)
+                    pixels.push_back(pixel.colourSum / pixel.samples);
+                else
+                    pixels.push_back(RGBTColour());
+            }
+        }
+
+        radiosity.AfterTile();
+
+        GetViewDataPtr()->AfterTile();
+        if(sampled)
+            GetViewData()->CompletedRectangle(rect, serial, pixels, 1, passContributesToImage, passCompletesImage, (pass == 0) ? 1.0f : 0.0f);
+        else
+            GetViewData()->CompletedRectangle(rect, serial, 0.0f);
+
+        Cooperate();
+    }
+}
+
 void TraceTask::NonAdaptiveSupersamplingForOnePixel(DBL x, DBL y, RGBTColour& leftcol, RGBTColour& topcol, RGBTColour& curcol, bool& sampleleft, bool& sampletop, bool& samplecurrent)
 {
     RGBTColour gcLeft = GammaCurve::Encode(aaGamma, leftcol);
@@ -850,10 +1136,11 @@ void TraceTask::SupersampleOnePixel(DBL x, DBL y, RGBTColour& col)
     DBL step(1.0 / DBL(aaDepth));
     DBL range(0.5 - (step * 0.5));
     DBL rx, ry;
-    RGBTColour tempcol;
 
     GetViewDataPtr()->Stats()[Number_Of_Pixels_Supersampled]++;
 
+    // Collect the whole grid first, so that the samples can be traced as ray packets.
+    samplePositions.clear();
     for(DBL yy = -range; yy <= (range + EPSILON); yy += step)
     {
         for(DBL xx = -range; xx <= (range + EPSILON); xx += step)
@@ -861,16 +1148,22 @@ void TraceTask::SupersampleOnePixel(DBL x, DBL y, RGBTColour& col)
             if (jitterScale > 0.0)
             {
                 Jitter2d(x + xx, y + yy, rx, ry);
-                trace(x+0.5 + xx + (rx * jitterScale), y+0.5 + yy + (ry * jitterScale), GetViewData()->GetWidth(), GetViewData()->GetHeight(), tempcol);
+                samplePositions.push_back(Vector2d(x+0.5 + xx + (rx * jitterScale), y+0.5 + yy + (ry * jitterScale)));
             }
             else
-                trace(x+0.5 + xx, y+0.5 + yy, GetViewData()->GetWidth(), GetViewData()->GetHeight(), tempcol);
+                samplePositions.push_back(Vector2d(x+0.5 + xx, y+0.5 + yy));
+        }
+    }
 
-            col += tempcol;
-            GetViewDataPtr()->Stats()[Number_Of_Samples]++;
+    sampleColours.resize(samplePositions.size());
+    trace(&samplePositions[0], samplePositions.size(), GetViewData()->GetWidth(), GetViewData()->GetHeight(), &sampleColours[0]);
 
-            Cooperate();
-        }
+    for(vector<RGBTColour>::const_iterator i = sampleColours.begin(); i != sampleColours.end(); i++)
+    {
+        col += *i;
+        GetViewDataPtr()->Stats()[Number_Of_Samples]++;
+
+        Cooperate();
     }
 
     col /= (aaDepth * aaDepth + 1);
@@ -50,6 +50,8 @@
 namespace pov
 {
 
+class SampleStore;
+
 #ifdef PROFILE_INTERSECTIONS
     // NB not thread-safe (and not intended to be)
     extern POV_ULONG gIntersectionTime;
@@ -63,7 +65,7 @@ class TraceTask : public RenderTask
     public:
         TraceTask(ViewData *vd, unsigned int tm, DBL js,
                   DBL aat, DBL aac, unsigned int aad, pov_base::GammaCurvePtr& aag,
-                  unsigned int ps, bool psc, bool contributesToImage, bool hr, size_t seed);
+                  unsigned int ps, bool psc, bool contributesToImage, bool hr, bool wf, size_t seed);
         virtual ~TraceTask();
 
         virtual void Run();
@@ -106,21 +108,41 @@ class TraceTask : public RenderTask
         bool passContributesToImage;    ///< Pass computes pixels for the final image.
         bool passCompletesImage;        ///< Pass is the last one computing pixels for the final image.
         bool highReproducibility;
+        bool deadlineBound;             ///< Pass leaves blocks unchanged once the time budget has been used up.
+        bool wavefront;                 ///< Trace each block's pixels as a sorted queue of ray packets.
+        unsigned int blockAffinity;     ///< Block to preferably render next, see @ref ViewData::GetNextRectangle().
         pov_base::GammaCurvePtr aaGamma;
 
         /// tracing core
         TracePixel trace;
+        /// scratch space for the sample positions of a supersampled pixel
+        vector<Vector2d> samplePositions;
+        /// scratch space for the sample colours of a supersampled pixel
+        vector<RGBTColour> sampleColours;
+        /// scratch space for the queue of pixels to trace in wavefront mode, as pairs of sort key and index
+        vector<std::pair<unsigned int, unsigned int> > pixelQueue;
+        /// samples to reuse rather than trace, or `nullptr` if not applicable
+        SampleStore *sampleStore;
+        /// scratch space for the samples of a block's pixels taken from the sample store
+        vector<RGBTColour> storedColours;
+        /// scratch space for whether each of a block's pixels was found in the sample store
+        vector<bool> storedFound;
 
         CooperateFunction cooperate;
         MediaFunction media;
         RadiosityFunction radiosity;
         PhotonGatherer photonGatherer;
 
+        void ApplyTimeBudget();
+        bool OutOfTime(const POVRect& rect, unsigned int serial);
+
         void SimpleSamplingM0();
+        void WavefrontSampleRectangle(const POVRect& rect, vector<RGBTColour>& pixels, unsigned int stored);
         void SimpleSamplingM0P();
         void NonAdaptiveSupersamplingM1();
         void AdaptiveSupersamplingM2();
         void StochasticSupersamplingM3();
+        void ProgressiveSamplingM4();
 
         void NonAdaptiveSupersamplingForOnePixel(DBL x, DBL y, RGBTColour& leftcol, RGBTColour& topcol, RGBTColour& curcol, bool& sampleleft, bool& sampletop, bool& samplecurrent);
         void SupersampleOnePixel(DBL x, DBL y, RGBTColour& col);
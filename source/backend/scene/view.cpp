@@ -33,6 +33,10 @@
 ///
 //******************************************************************************
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+
 #include <boost/thread.hpp>
 #include <boost/bind.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
@@ -43,11 +47,16 @@
 #include "backend/frame.h"
 #include "backend/scene/view.h"
 
+#include "base/fileinputoutput.h"
+#include "base/memoryaccounting.h"
 #include "base/path.h"
+#include "base/pixelexchange.h"
 #include "base/timer.h"
 
+#include "core/bounding/flatbvh.h"
 #include "core/lighting/photons.h"
 #include "core/lighting/radiosity.h"
+#include "core/math/chi2.h"
 #include "core/math/matrix.h"
 #include "core/support/octree.h"
 
@@ -56,20 +65,60 @@
 
 #include "backend/control/renderbackend.h"
 #include "backend/lighting/photonestimationtask.h"
+#include "backend/lighting/photonimportancetask.h"
 #include "backend/lighting/photonshootingstrategy.h"
 #include "backend/lighting/photonshootingtask.h"
 #include "backend/lighting/photonsortingtask.h"
+#include "backend/lighting/photontreetask.h"
 #include "backend/lighting/photonstrategytask.h"
 #include "backend/render/radiositytask.h"
 #include "backend/render/tracetask.h"
 #include "backend/scene/backendscenedata.h"
 #include "backend/scene/viewthreaddata.h"
+#include "backend/support/eventtrace.h"
 
 // this must be the last file included
 #include "base/povdebug.h"
 
 #define DEFAULT_BLOCK_SIZE 32
 
+// smallest width and height of the parts blocks are split into near the end of a frame
+#define MIN_SPLIT_BLOCK_SIZE 8
+
+// number of samples taken of every pixel in the first pass of progressive sampling
+#define PROGRESSIVE_MIN_SAMPLES 4u
+
+// maximum number of refinement passes of progressive sampling, per level of anti-aliasing depth
+#define PROGRESSIVE_PASSES_PER_DEPTH 8
+
+// each refinement pass of progressive sampling targets this fraction (as a divisor) of the pixels
+#define PROGRESSIVE_TARGET_FRACTION 4
+
+// smallest mosaic preview size used to estimate the cost of a render with a time budget
+#define TIME_BUDGET_PREVIEW_SIZE 8
+
+// share of the time budget that radiosity pretrace may take
+#define TIME_BUDGET_PRETRACE_SHARE 0.25
+
+// assumed fraction of pixels being anti-aliased, for estimating the cost of anti-aliasing
+#define TIME_BUDGET_ANTIALIAS_FRACTION 0.25
+
+// lowest factor by which radiosity sample rays are scaled to fit the time budget
+#define TIME_BUDGET_MIN_SCALE 0.1
+
+// factor of radiosity sample rays below which area lights are treated as point lights to fit the time budget
+#define TIME_BUDGET_AREA_LIGHTS_SCALE 0.5
+
+// fraction of the photons gathered in one pass of progressive photon mapping that is kept in the next
+// (the alpha parameter of Knaus & Zwicker's probabilistic progressive photon mapping)
+#define PHOTON_PASS_ALPHA 0.7
+
+// highest number of passes of progressive photon mapping
+#define PHOTON_PASSES_MAX 1024u
+
+// number of rows of the table of precomputed primary rays filled by each job
+#define CAMERA_RAY_TABLE_STRIPE_ROWS 16u
+
 namespace pov
 {
 
@@ -92,11 +141,29 @@ ViewData::ViewData(shared_ptr<BackendSceneData> sd) :
     blockWidth(10),
     blockHeight(8),
     blockSize(DEFAULT_BLOCK_SIZE),
+    blockSplitThreads(0),
+    blocksUndispatched(0),
+    progressivePass(0),
+    progressiveCutoff(0.0),
+    progressiveDone(true),
+    progressiveThreshold(0.0),
+    progressiveConfidenceFactor(0.0),
+    progressiveMaxSamples(PROGRESSIVE_MIN_SAMPLES),
+    progressiveTimeLimit(0),
+    timeBudget(0),
+    timeBudgetProbeStart(0),
+    timeBudgetAntialiasDepth(9),
+    timeBudgetScale(1.0),
+    timeBudgetAreaLights(true),
+    photonPass(1),
+    photonPasses(1),
+    photonFileLoad(false),
     realTimeRaytracing(false),
     rtrData(nullptr),
     renderArea(0, 0, 159, 119),
     radiosityCache(sd->radiositySettings),
     sceneData(sd),
+    blockAffinity(false),
     qualityFlags(9)
 {
 }
@@ -105,6 +172,11 @@ ViewData::~ViewData()
 {
     if (rtrData != nullptr)
         delete rtrData;
+
+#if POV_SHARED_PIXEL_BLOCKS
+    // pixel blocks the front-end didn't pick up any more
+    PixelBlockExchange::Discard(this);
+#endif
 }
 
 void ViewData::getBlockXY(const unsigned int nb, unsigned int &x, unsigned int &y)
@@ -210,6 +282,11 @@ void ViewData::getBlockXY(const unsigned int nb, unsigned int &x, unsigned int &
                  y /= 2;
              }
              break;
+         case 6:
+         case 7:
+             x = blockPatternTable[neo_nb] % blockWidth;
+             y = blockPatternTable[neo_nb] / blockWidth;
+             break;
          default:
              x = neo_nb % blockWidth;
              y = neo_nb / blockWidth;
@@ -217,46 +294,226 @@ void ViewData::getBlockXY(const unsigned int nb, unsigned int &x, unsigned int &
      }/* all values are covered */
 }
 
+void ViewData::buildBlockPatternTable()
+{
+    unsigned int side = 1;
+
+    blockPatternTable.clear();
+    if ((renderPattern != 6) && (renderPattern != 7))
+        return;
+
+    while ((side < blockWidth) || (side < blockHeight))
+        side *= 2;
+
+    blockPatternTable.reserve(blockWidth * blockHeight);
+
+    // walk the curve across the smallest enclosing square of power-of-two size,
+    // skipping the cells outside the view
+    for (unsigned long d = 0; d < (unsigned long)side * side; d++)
+    {
+        unsigned int x = 0, y = 0;
+
+        if (renderPattern == 6)
+        {
+            // Hilbert curve
+            unsigned long t = d;
+            for (unsigned int s = 1; s < side; s *= 2)
+            {
+                unsigned int rx = 1 & (t / 2);
+                unsigned int ry = 1 & (t ^ rx);
+                if (ry == 0)
+                {
+                    if (rx == 1)
+                    {
+                        x = s - 1 - x;
+                        y = s - 1 - y;
+                    }
+                    std::swap(x, y);
+                }
+                x += s * rx;
+                y += s * ry;
+                t /= 4;
+            }
+        }
+        else
+        {
+            // Morton (Z-order) curve
+            for (unsigned int bit = 0; (1ul << (2 * bit)) <= d; bit++)
+            {
+                x |= ((d >> (2 * bit)) & 1) << bit;
+                y |= ((d >> (2 * bit + 1)) & 1) << bit;
+            }
+        }
+
+        if ((x < blockWidth) && (y < blockHeight))
+            blockPatternTable.push_back(y * blockWidth + x);
+    }
+}
+
 bool ViewData::GetNextRectangle(POVRect& rect, unsigned int& serial)
 {
-    boost::mutex::scoped_lock lock(nextBlockMutex);
+    unsigned int affinity = blockWidth * blockHeight;
+
+    return GetNextRectangle(rect, serial, affinity);
+}
+
+bool ViewData::GetNextRectangle(POVRect& rect, unsigned int& serial, unsigned int& affinity)
+{
+    EventTrace::ScopedLock<boost::mutex> lock(nextBlockMutex, "Block Queue");
+    unsigned int remaining;
 
-    while(true)
+    // parts of blocks already split take precedence
+    if(blockPartQueue.empty() == false)
     {
-        if(nextBlock >= (blockWidth * blockHeight))
+        rect = blockPartQueue.front().first;
+        serial = blockPartQueue.front().second;
+        blockPartQueue.pop_front();
+
+        pixelsPending += rect.GetArea();
+
+        EventTrace::Begin("Block", "block", serial);
+        return true;
+    }
+
+    if(blockDispatched.empty() == false)
+    {
+        if(blocksUndispatched == 0)
             return false;
 
-        unsigned int tempNextBlock = nextBlock; // TODO FIXME - works around nasty gcc (found using 4.0.1) bug failing to honor casting away of volatile on pass by value on template argument lookup [trf]
+        remaining = blocksUndispatched;
+        serial = nextAffineBlock(affinity);
+    }
+    else
+    {
+        while(true)
+        {
+            if(nextBlock >= (blockWidth * blockHeight))
+                return false;
+
+            serial = (blockOrder.empty() ? (unsigned int)nextBlock : blockOrder[nextBlock]);
 
-        if((blockSkipList.empty() == true) || (blockSkipList.find((unsigned int)tempNextBlock) == blockSkipList.end()))
-            break;
+            if((blockSkipList.empty() == true) || (blockSkipList.find(serial) == blockSkipList.end()))
+                break;
 
-        blockSkipList.erase((unsigned int)tempNextBlock);
+            blockSkipList.erase(serial);
+            nextBlock++;
+        }
+
+        remaining = (blockWidth * blockHeight) - nextBlock;
         nextBlock++;
     }
 
     unsigned int blockX;
     unsigned int blockY;
-    getBlockXY(nextBlock,blockX,blockY);
+    getBlockXY(serial,blockX,blockY);
 
     rect.left = renderArea.left + (blockX * blockSize);
     rect.right = min(renderArea.left + ((blockX + 1) * blockSize) - 1, renderArea.right);
     rect.top = renderArea.top + (blockY * blockSize);
     rect.bottom = min(renderArea.top + ((blockY + 1) * blockSize) - 1, renderArea.bottom);
 
+    blockBusyList.insert(serial);
+
+    // near the end of the frame, hand out the remaining blocks in parts
+    if((blockSplitThreads > 0) && (remaining <= blockSplitThreads))
+        splitBlock(rect, serial, remaining);
+
     pixelsPending += rect.GetArea();
 
-    serial = nextBlock;
-    nextBlock++;
+    EventTrace::Begin("Block", "block", serial);
+    return true;
+}
+
+unsigned int ViewData::nextAffineBlock(unsigned int& affinity)
+{
+    unsigned int serial = affinity;
 
-    blockBusyList.insert(serial);
+    if((serial >= blockDispatched.size()) || blockDispatched[serial])
+    {
+        // The thread has no block to continue with; take over the second half of the longest
+        // run of blocks not yet dispatched, leaving the first half to whichever thread is
+        // working its way towards it.
+        unsigned int bestStart = 0;
+        unsigned int bestLength = 0;
+
+        for(unsigned int start = 0; start < blockDispatched.size(); )
+        {
+            if(blockDispatched[start])
+            {
+                start++;
+                continue;
+            }
+
+            unsigned int end = start;
+            while((end < blockDispatched.size()) && !blockDispatched[end])
+                end++;
+
+            if(end - start > bestLength)
+            {
+                bestStart = start;
+                bestLength = end - start;
+            }
+            start = end;
+        }
+
+        serial = bestStart + bestLength / 2;
+    }
+
+    blockDispatched[serial] = true;
+    blocksUndispatched--;
+    affinity = serial + 1;
+
+    return serial;
+}
+
+void ViewData::splitBlock(POVRect& rect, unsigned int serial, unsigned int remaining)
+{
+    unsigned int partSize = blockSize;
+
+    // halve the part size until there are about as many parts left as there are threads
+    while((partSize >= 2 * MIN_SPLIT_BLOCK_SIZE) &&
+          (remaining * ((blockSize + partSize - 1) / partSize) * ((blockSize + partSize - 1) / partSize) < blockSplitThreads))
+        partSize /= 2;
+
+    if((partSize >= rect.GetWidth()) && (partSize >= rect.GetHeight()))
+        return;
+
+    unsigned int parts = 0;
+
+    for(unsigned int top = rect.top; top <= rect.bottom; top += partSize)
+    {
+        for(unsigned int left = rect.left; left <= rect.right; left += partSize)
+        {
+            POVRect part(left, top, min(left + partSize - 1, rect.right), min(top + partSize - 1, rect.bottom));
+            blockPartQueue.push_back(std::make_pair(part, serial));
+            parts++;
+        }
+    }
+
+    blockPartsPending[serial] = parts;
+
+    rect = blockPartQueue.front().first;
+    blockPartQueue.pop_front();
+}
+
+bool ViewData::completedBlockPart(unsigned int serial)
+{
+    boost::mutex::scoped_lock lock(nextBlockMutex);
 
+    std::map<unsigned int, unsigned int>::iterator i = blockPartsPending.find(serial);
+    if(i == blockPartsPending.end())
+        return true;
+
+    if(--(i->second) > 0)
+        return false;
+
+    blockPartsPending.erase(i);
     return true;
 }
 
 bool ViewData::GetNextRectangle(POVRect& rect, unsigned int& serial, BlockInfo*& blockInfo, unsigned int stride)
 {
-    boost::mutex::scoped_lock lock(nextBlockMutex);
+    EventTrace::ScopedLock<boost::mutex> lock(nextBlockMutex, "Block Queue");
 
     BlockIdSet newPostponedList;
 
@@ -383,11 +640,43 @@ bool ViewData::GetNextRectangle(POVRect& rect, unsigned int& serial, BlockInfo*&
 
     blockInfo = blockInfoList[serial];
 
+    EventTrace::Begin("Block", "block", serial);
     return true;
 }
 
+void ViewData::AddRectangleCost(unsigned int serial, POV_ULONG cost)
+{
+    boost::mutex::scoped_lock lock(nextBlockMutex);
+
+    if(serial < blockCostList.size())
+        blockCostList[serial] += cost;
+}
+
 void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, const vector<RGBTColour>& pixels, unsigned int size, bool relevant, bool complete, float completion, BlockInfo* blockInfo)
 {
+    // of a split block, only the part completed last may mark the block as complete
+    bool wholeBlock = completedBlockPart(serial);
+
+    // with progressive photon mapping, the image shows the average of all passes so far
+    vector<RGBTColour> averagedPixels;
+    const vector<RGBTColour>* sentPixels = &pixels;
+    if((size == 1) && relevant && !photonPassPixels.empty() && (pixels.size() == rect.GetArea()))
+    {
+        averagedPixels.reserve(pixels.size());
+        vector<RGBTColour>::const_iterator i(pixels.begin());
+        for(int y = rect.top; y <= rect.bottom; y++)
+            for(int x = rect.left; x <= rect.right; x++)
+                averagedPixels.push_back(averagePhotonPasses(x, y, *i++));
+        sentPixels = &averagedPixels;
+    }
+
+    // later passes of progressive photon mapping add neither to the render progress nor to continue-trace
+    if(photonPass > 1)
+    {
+        complete = false;
+        completion = 0.0f;
+    }
+
     if (realTimeRaytracing == true)
     {
         POV_RTR_ASSERT(pixels.size() == rect.GetArea());
@@ -411,11 +700,22 @@ void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, cons
         try
         {
             POVMS_Message pixelblockmsg(kPOVObjectClass_PixelData, kPOVMsgClass_ViewImage, kPOVMsgIdent_PixelBlockSet);
+
+#if POV_SHARED_PIXEL_BLOCKS
+            // the front-end shares our process, so just hand over the pixels
+            vector<RGBTColour> sharedPixels;
+            if(sentPixels == &averagedPixels)
+                sharedPixels.swap(averagedPixels);
+            else
+                sharedPixels = pixels;
+
+            pixelblockmsg.SetLong(kPOVAttrib_PixelBlockRef, PixelBlockExchange::Deposit(this, sharedPixels));
+#else
             vector<POVMSFloat> pixelvector;
 
-            pixelvector.reserve(pixels.size() * 5);
+            pixelvector.reserve(sentPixels->size() * 5);
 
-            for(vector<RGBTColour>::const_iterator i(pixels.begin()); i != pixels.end(); i++)
+            for(vector<RGBTColour>::const_iterator i(sentPixels->begin()); i != sentPixels->end(); i++)
             {
                 pixelvector.push_back(i->red());
                 pixelvector.push_back(i->green());
@@ -427,9 +727,10 @@ void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, cons
             POVMS_Attribute pixelattr(pixelvector);
 
             pixelblockmsg.Set(kPOVAttrib_PixelBlock, pixelattr);
+#endif
             if (relevant)
                 pixelblockmsg.SetVoid(kPOVAttrib_PixelFinal);
-            if (complete)
+            if (complete && wholeBlock)
                 // only completely rendered blocks get a block id
                 // (used by continue-trace to identify blocks that do not need to be rendered again)
                 pixelblockmsg.SetInt(kPOVAttrib_PixelId, serial);
@@ -458,17 +759,31 @@ void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, cons
 
 void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, const vector<Vector2d>& positions, const vector<RGBTColour>& colors, unsigned int size, bool relevant, bool complete, float completion, BlockInfo* blockInfo)
 {
+    // of a split block, only the part completed last may mark the block as complete
+    bool wholeBlock = completedBlockPart(serial);
+
     try
     {
         if(positions.size() != colors.size())
             throw POV_EXCEPTION(kInvalidDataSizeErr, "Number of pixel colors and pixel positions does not match!");
 
+        // with progressive photon mapping, the image shows the average of all passes so far
+        vector<RGBTColour> averagedColors;
+        const vector<RGBTColour>* sentColors = &colors;
+        if((size == 1) && relevant && !photonPassPixels.empty())
+        {
+            averagedColors.reserve(colors.size());
+            for(size_t i = 0; i < positions.size(); i++)
+                averagedColors.push_back(averagePhotonPasses(positions[i].x(), positions[i].y(), colors[i]));
+            sentColors = &averagedColors;
+        }
+
         POVMS_Message pixelblockmsg(kPOVObjectClass_PixelData, kPOVMsgClass_ViewImage, kPOVMsgIdent_PixelSet);
         vector<POVMSInt> positionvector;
         vector<POVMSFloat> colorvector;
 
         positionvector.reserve(positions.size() * 2);
-        colorvector.reserve(colors.size() * 5);
+        colorvector.reserve(sentColors->size() * 5);
 
         for(vector<Vector2d>::const_iterator i(positions.begin()); i != positions.end(); i++)
         {
@@ -476,7 +791,7 @@ void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, cons
             positionvector.push_back(POVMSInt(i->y()));
         }
 
-        for(vector<RGBTColour>::const_iterator i(colors.begin()); i != colors.end(); i++)
+        for(vector<RGBTColour>::const_iterator i(sentColors->begin()); i != sentColors->end(); i++)
         {
             colorvector.push_back(i->red());
             colorvector.push_back(i->green());
@@ -492,7 +807,7 @@ void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, cons
         pixelblockmsg.Set(kPOVAttrib_PixelColors, pixelcolattr);
         if (relevant)
             pixelblockmsg.SetVoid(kPOVAttrib_PixelFinal);
-        if (complete)
+        if (complete && wholeBlock)
             // only completely rendered blocks get a block id
             // (used by continue-trace to identify blocks that do not need to be rendered again)
             pixelblockmsg.SetInt(kPOVAttrib_PixelId, serial);
@@ -516,9 +831,12 @@ void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, cons
 
 void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, float completion, BlockInfo* blockInfo)
 {
+    EventTrace::End();
+
     {
-        boost::mutex::scoped_lock lock(nextBlockMutex);
-        blockBusyList.erase(serial);
+        EventTrace::ScopedLock<boost::mutex> lock(nextBlockMutex, "Block Queue");
+        if(blockPartsPending.find(serial) == blockPartsPending.end())
+            blockBusyList.erase(serial);
         blockInfoList[serial] = blockInfo;
     }
 
@@ -537,6 +855,7 @@ void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, floa
             obj.SetInt(kPOVAttrib_Pixels, renderArea.GetArea());
             obj.SetInt(kPOVAttrib_PixelsPending, pixelsPending - pixelsCompleted + rect.GetArea());
             obj.SetInt(kPOVAttrib_PixelsCompleted, pixelsCompleted);
+            obj.SetLong(kPOVAttrib_AccountedMemory, MemoryAccounting::GetTotalCurrent());
             RenderBackend::SendViewOutput(viewId, sceneData->frontendAddress, kPOVMsgIdent_Progress, obj);
         }
 
@@ -548,12 +867,207 @@ void ViewData::CompletedRectangle(const POVRect& rect, unsigned int serial, floa
     }
 }
 
+DBL ViewData::progressiveError(const ProgressivePixel& pixel) const
+{
+    if(pixel.samples < 2)
+        return std::numeric_limits<DBL>::max();
+
+    // half width of the confidence interval of the mean, summed over all channels
+    RGBTColour standardError = Sqrt(pixel.squaredDeviations / (DBL(pixel.samples) * (pixel.samples - 1)));
+    return progressiveConfidenceFactor * (standardError.red() + standardError.green() + standardError.blue() + standardError.transm());
+}
+
+unsigned int ViewData::GetProgressiveSamples(const ProgressivePixel& pixel) const
+{
+    if(progressivePass == 0)
+        return (pixel.samples < PROGRESSIVE_MIN_SAMPLES) ? min(PROGRESSIVE_MIN_SAMPLES - pixel.samples, progressiveMaxSamples) : 0;
+
+    // pixels not sampled in the first pass belong to blocks skipped when continuing an aborted render
+    if(progressiveDone || (pixel.samples == 0) || (pixel.samples >= progressiveMaxSamples))
+        return 0;
+
+    DBL error = progressiveError(pixel);
+    if((error < progressiveCutoff) || (error <= 0.0))
+        return 0;
+
+    return min(pixel.samples, progressiveMaxSamples - pixel.samples);
+}
+
+bool ViewData::ProgressiveTimeExceeded() const
+{
+    return (progressiveTimeLimit > 0) && (renderTimer.ElapsedRealTime() >= progressiveTimeLimit);
+}
+
+void ViewData::PlanProgressivePass()
+{
+    progressivePass++;
+
+    if(progressiveDone)
+        return;
+
+    if(ProgressiveTimeExceeded())
+    {
+        progressiveDone = true;
+        return;
+    }
+
+    vector<DBL> errors;
+    DBL totalError = 0.0;
+    size_t sampledPixels = 0;
+
+    for(vector<ProgressivePixel>::const_iterator i = progressivePixels.begin(); i != progressivePixels.end(); i++)
+    {
+        if(i->samples == 0)
+            continue;
+
+        DBL error = progressiveError(*i);
+        totalError += error;
+        sampledPixels++;
+        if(i->samples < progressiveMaxSamples)
+            errors.push_back(error);
+    }
+
+    // stop once the mean error is within budget, or no pixel can be refined any further
+    if(errors.empty() || (totalError <= progressiveThreshold * sampledPixels))
+    {
+        progressiveDone = true;
+        return;
+    }
+
+    // refine the pixels with the highest errors
+    vector<DBL>::iterator cutoff = errors.begin() + (errors.size() - 1) / PROGRESSIVE_TARGET_FRACTION;
+    std::nth_element(errors.begin(), cutoff, errors.end(), std::greater<DBL>());
+    progressiveCutoff = *cutoff;
+}
+
+bool ViewData::TimeBudgetExceeded() const
+{
+    return (timeBudget > 0) && (renderTimer.ElapsedRealTime() >= timeBudget);
+}
+
+bool ViewData::PretraceTimeBudgetExceeded() const
+{
+    return (timeBudget > 0) && (renderTimer.ElapsedRealTime() >= POV_LONG(timeBudget * TIME_BUDGET_PRETRACE_SHARE));
+}
+
+void ViewData::StartTimeBudgetProbe()
+{
+    timeBudgetProbeStart = renderTimer.ElapsedRealTime();
+}
+
+void ViewData::PlanTimeBudget(unsigned int previewSize, unsigned int tracingMethod, unsigned int aaDepth)
+{
+    POV_LONG now = renderTimer.ElapsedRealTime();
+
+    // Extrapolate the time taken by the preview pass to tracing every pixel once, and express
+    // the remaining time in units of that.
+    DBL fullPass = max(DBL(now - timeBudgetProbeStart), 1.0) * previewSize * previewSize;
+    DBL available = DBL(timeBudget - now) / fullPass;
+
+    // The rest of the mosaic preview traces every pixel about once more, as does a final
+    // anti-aliasing pass, which additionally supersamples some of the pixels.
+    DBL needed = 1.0;
+    unsigned int depth = aaDepth;
+    if(tracingMethod != 0)
+    {
+        for(; depth > 1; depth--)
+        {
+            DBL samples = (tracingMethod == 1) ? DBL(depth * depth) : DBL(1u << (depth * 2));
+            if(2.0 + TIME_BUDGET_ANTIALIAS_FRACTION * samples <= available)
+                break;
+        }
+        DBL samples = (tracingMethod == 1) ? DBL(depth * depth) : DBL(1u << (depth * 2));
+        needed = 2.0 + TIME_BUDGET_ANTIALIAS_FRACTION * samples;
+    }
+
+    timeBudgetAntialiasDepth = depth;
+    timeBudgetScale = clip(available / needed, TIME_BUDGET_MIN_SCALE, 1.0);
+    timeBudgetAreaLights = (timeBudgetScale >= TIME_BUDGET_AREA_LIGHTS_SCALE);
+
+    if(tracingMethod == 4)
+        progressiveMaxSamples = min(progressiveMaxSamples, max(PROGRESSIVE_MIN_SAMPLES, 1u << (depth * 2)));
+}
+
+void ViewData::StartPhotonPass()
+{
+    photonPass++;
+
+    // Each pass gathers photons from a smaller radius, so that the bias of the estimate vanishes as the
+    // passes are averaged; the gather area (or volume, for media) shrinks by (n - 1 + alpha) / n.
+    DBL shrink = (DBL(photonPass) - 1.0 + PHOTON_PASS_ALPHA) / DBL(photonPass);
+    DBL surfaceShrink = sqrt(shrink);
+    DBL mediaShrink = pow(shrink, 1.0 / 3.0);
+
+    sceneData->surfacePhotonMap.minGatherRad *= surfaceShrink;
+    sceneData->surfacePhotonMap.gatherRadStep *= surfaceShrink;
+    sceneData->mediaPhotonMap.minGatherRad *= mediaShrink;
+    sceneData->mediaPhotonMap.gatherRadStep *= mediaShrink;
+
+    // only the photons of a single pass are ever kept
+    sceneData->surfacePhotonMap.Clear();
+    sceneData->mediaPhotonMap.Clear();
+}
+
+RGBTColour ViewData::averagePhotonPasses(unsigned int x, unsigned int y, const RGBTColour& colour)
+{
+    PhotonPassPixel& pixel = photonPassPixels[(y - renderArea.top) * renderArea.GetWidth() + (x - renderArea.left)];
+
+    // a pixel may be sent more than once per pass, in which case only its most recent colour counts
+    if(pixel.pass != photonPass)
+    {
+        if(pixel.passes > 0)
+            pixel.colourSum += pixel.colour;
+        pixel.pass = photonPass;
+        pixel.passes++;
+    }
+    pixel.colour = colour;
+
+    return (pixel.colourSum + colour) / DBL(pixel.passes);
+}
+
+/// Orders block serial numbers by decreasing cost.
+struct BlockCostGreater
+{
+    const vector<POV_ULONG>& costs;
+    BlockCostGreater(const vector<POV_ULONG>& c) : costs(c) {}
+    bool operator()(unsigned int a, unsigned int b) const { return costs[a] > costs[b]; }
+};
+
 void ViewData::SetNextRectangle(const BlockIdSet& bsl, unsigned int fs)
 {
     blockSkipList = bsl;
     blockBusyList.clear(); // safety catch; shouldn't be necessary
     blockPostponedList.clear(); // safety catch; shouldn't be necessary
+    blockPartQueue.clear(); // safety catch; shouldn't be necessary
+    blockPartsPending.clear(); // safety catch; shouldn't be necessary
     nextBlock = fs;
+
+    // Once a previous pass has given an estimate of each block's cost, dispatch the most expensive
+    // blocks first, so that none of them is left to a single thread at the end of the frame.
+    // When continuing an aborted render, the render pattern is kept, as the blocks preceding the
+    // first one are known to be complete.
+    blockOrder.clear();
+    blockDispatched.clear();
+    if((fs == 0) && !blockCostList.empty() && (*std::max_element(blockCostList.begin(), blockCostList.end()) > 0))
+    {
+        blockOrder.resize(blockCostList.size());
+        for(unsigned int i = 0; i < blockOrder.size(); i++)
+            blockOrder[i] = i;
+        std::stable_sort(blockOrder.begin(), blockOrder.end(), BlockCostGreater(blockCostList));
+    }
+    else if(blockAffinity)
+    {
+        // Let each thread work its way along the render pattern on its own; blocks preceding
+        // the first one and those to be skipped have already been rendered.
+        blockDispatched.assign(blockWidth * blockHeight, false);
+        for(unsigned int i = 0; (i < fs) && (i < blockDispatched.size()); i++)
+            blockDispatched[i] = true;
+        for(BlockIdSet::const_iterator i = blockSkipList.begin(); i != blockSkipList.end(); i++)
+            if(*i < blockDispatched.size())
+                blockDispatched[*i] = true;
+        blocksUndispatched = (unsigned int)std::count(blockDispatched.begin(), blockDispatched.end(), false);
+    }
+
     completedFirstPass = false; // TODO
     pixelsCompleted = 0; // TODO
 }
@@ -646,7 +1160,7 @@ bool View::CheckCameraHollowObject(const Vector3d& point)
         HasInteriorPointObjectCondition precond;
         TruePointObjectCondition postcond;
         TraceThreadData threadData(sd, seed); // TODO: avoid the need to construct threadData
-        BSPInsideCondFunctor ifn(point, sd->objects, &threadData, precond, postcond);
+        BSPInsideCondFunctor<HasInteriorPointObjectCondition, TruePointObjectCondition> ifn(point, sd->objects, &threadData, precond, postcond);
 
         mailbox.clear();
         if ((*sd->tree)(point, ifn, mailbox, true))
@@ -657,6 +1171,17 @@ bool View::CheckCameraHollowObject(const Vector3d& point)
             if (((*object)->interior != nullptr) && Inside_BBox(point, (*object)->BBox) && (*object)->Inside(point, &threadData))
                 return true;
     }
+    else if ((sd->boundingSlabs == nullptr) && (sd->flatBVH != nullptr))
+    {
+        TraceThreadData threadData(sd, seed); // TODO: avoid the need to construct threadData
+        vector<ObjectPtr> candidates;
+
+        sd->flatBVH->GetCandidatesContaining(point, candidates);
+        for(vector<ObjectPtr>::const_iterator object = candidates.begin(); object != candidates.end(); object++)
+            if ((*object)->interior != nullptr)
+                if((*object)->Inside(point, &threadData))
+                    return true;
+    }
     else if ((sd->boundingMethod == 0) || (sd->boundingSlabs == nullptr))
     {
         TraceThreadData threadData(sd, seed); // TODO: avoid the need to construct threadData
@@ -687,6 +1212,9 @@ void View::StartRender(POVMS_Object& renderOptions)
     unsigned int previewendsize = 0;
     unsigned int nextblock = 0;
     bool highReproducibility = false;
+    bool wavefront = false;
+    DBL timebudget = 0.0;
+    unsigned int photonpasses = 1;
     size_t seed = 0;
     shared_ptr<ViewData::BlockIdSet> blockskiplist(new ViewData::BlockIdSet());
 
@@ -696,7 +1224,7 @@ void View::StartRender(POVMS_Object& renderOptions)
     viewData.qualityFlags = QualityFlags(clip(renderOptions.TryGetInt(kPOVAttrib_Quality, 9), 0, 9));
 
     if(renderOptions.TryGetBool(kPOVAttrib_Antialias, false) == true)
-        tracingmethod = clip(renderOptions.TryGetInt(kPOVAttrib_SamplingMethod, 1), 0, 3); // TODO FIXME - magic number in clip
+        tracingmethod = clip(renderOptions.TryGetInt(kPOVAttrib_SamplingMethod, 1), 0, 4); // TODO FIXME - magic number in clip
 
     aadepth = clip((unsigned int)renderOptions.TryGetInt(kPOVAttrib_AntialiasDepth, 3), 1u, 9u);
     aathreshold = clip(renderOptions.TryGetFloat(kPOVAttrib_AntialiasThreshold, 0.3f), 0.0f, 1.0f);
@@ -716,7 +1244,20 @@ void View::StartRender(POVMS_Object& renderOptions)
     if((previewendsize == 2) && (tracingmethod == 0)) // optimisation to render all pixels only once
         previewendsize = 1;
 
+    // A render with a time budget starts with a coarse mosaic preview, so that an image is available
+    // early on, and the time taken to trace it can be used to estimate the cost of the other passes.
+    timebudget = max(renderOptions.TryGetFloat(kPOVAttrib_TimeBudget, 0.0f), 0.0f);
+    if((timebudget > 0.0) && (previewstartsize < TIME_BUDGET_PREVIEW_SIZE))
+        previewstartsize = TIME_BUDGET_PREVIEW_SIZE;
+
     highReproducibility = renderOptions.TryGetBool(kPOVAttrib_HighReproducibility, false);
+    wavefront = renderOptions.TryGetBool(kPOVAttrib_WavefrontTracing, false);
+    photonpasses = clip((unsigned int)renderOptions.TryGetInt(kPOVAttrib_PhotonPasses, 1), 1u, PHOTON_PASSES_MAX);
+
+    // when continuing an aborted render, blocks of the final render pass having been completed implies that any
+    // radiosity pretrace was completed as well
+    bool continuing = renderOptions.Exist(kPOVAttrib_PixelId);
+    bool continuingFinalPass = (renderOptions.TryGetInt(kPOVAttrib_PixelId, 0) > 0) || renderOptions.Exist(kPOVAttrib_PixelSkipList);
 
     seed = renderOptions.TryGetInt(kPOVAttrib_StochasticSeed, 0);
     if (seed == 0)
@@ -726,11 +1267,18 @@ void View::StartRender(POVMS_Object& renderOptions)
         seed = (now - base).total_seconds();
     }
 
-    // TODO FIXME - [CLi] handle loading, storing (and later optionally deleting) of radiosity cache file for trace abort & continue feature
     // TODO FIXME - [CLi] if high reproducibility is a demand, timing of writing samples to disk is an issue regarding abort & continue
     bool loadRadiosityCache = renderOptions.TryGetBool(kPOVAttrib_RadiosityFromFile, false);
     bool saveRadiosityCache = renderOptions.TryGetBool(kPOVAttrib_RadiosityToFile, false);
-    if (loadRadiosityCache || saveRadiosityCache)
+    bool incrementalRadiosityCache = renderOptions.TryGetBool(kPOVAttrib_RadiosityIncremental, false);
+    bool resumeRadiosityCache = false;
+    if (incrementalRadiosityCache)
+    {
+        // keep the samples of the previous frame that are unaffected by changes in the scene, and add new ones to the same file
+        Path radiosityFile = Path(renderOptions.TryGetUCS2String(kPOVAttrib_RadiosityFileName, "object.rca"));
+        viewData.radiosityCache.LoadIncremental(radiosityFile, *viewData.GetSceneData());
+    }
+    else if (loadRadiosityCache || saveRadiosityCache)
     {
         // TODO FIXME - [CLi] I guess the radiosity file name needs more attention than this; probably a frontend job
         Path radiosityFile = Path(renderOptions.TryGetUCS2String(kPOVAttrib_RadiosityFileName, "object.rca"));
@@ -739,6 +1287,33 @@ void View::StartRender(POVMS_Object& renderOptions)
         if(saveRadiosityCache)
             viewData.radiosityCache.InitAutosave(radiosityFile, loadRadiosityCache); // if we loaded the file, add to existing data
     }
+    else if (renderOptions.Exist(kPOVAttrib_CheckpointRadiosityFile) && viewData.GetSceneData()->radiositySettings.radiosityEnabled)
+    {
+        // keep the samples alongside the render state as they are computed, so that continuing can pick them up again
+        Path radiosityFile = Path(renderOptions.GetUCS2String(kPOVAttrib_CheckpointRadiosityFile));
+        if(continuing)
+            resumeRadiosityCache = viewData.radiosityCache.Load(radiosityFile);
+        viewData.radiosityCache.InitAutosave(radiosityFile, resumeRadiosityCache);
+    }
+
+    // merge partial cache files, e.g. from pretrace-only renders of different parts of the image on different machines
+    if (renderOptions.Exist(kPOVAttrib_RadiosityMergeFile))
+    {
+        POVMS_List mergeFiles;
+        renderOptions.Get(kPOVAttrib_RadiosityMergeFile, mergeFiles);
+        for (int i = 1; i <= mergeFiles.GetListSize(); i++)
+        {
+            POVMS_Attribute mergeFile;
+            mergeFiles.GetNth(i, mergeFile);
+            viewData.radiosityCache.Merge(Path(mergeFile.GetUCS2String()));
+        }
+    }
+
+    // With a cache covering the whole image at hand, pretrace can be skipped; conversely, a render may just do the
+    // pretrace to contribute samples to such a cache.
+    bool radiosityPretraceOnly = renderOptions.TryGetBool(kPOVAttrib_RadiosityPretraceOnly, false);
+    bool radiositySkipPretrace = (renderOptions.TryGetBool(kPOVAttrib_RadiositySkipPretrace, false) ||
+                                  (resumeRadiosityCache && continuingFinalPass)) && !radiosityPretraceOnly;
 
     viewData.GetSceneData()->radiositySettings.vainPretrace = renderOptions.TryGetBool(kPOVAttrib_RadiosityVainPretrace, true);
 
@@ -819,11 +1394,40 @@ void View::StartRender(POVMS_Object& renderOptions)
             viewData.renderBlockStep--;
     }
 
+    viewData.buildBlockPatternTable();
+    viewData.blockAffinity = ((viewData.renderPattern == 6) || (viewData.renderPattern == 7)) && (viewData.renderBlockStep <= 1);
+
     viewData.blockInfoList.resize(viewData.blockWidth * viewData.blockHeight);
+    viewData.blockCostList.assign(viewData.blockWidth * viewData.blockHeight, 0);
 
     viewData.pixelsPending = 0;
     viewData.pixelsCompleted = 0;
 
+    // Progressive sampling keeps running statistics of every pixel across its passes, and refines
+    // the pixels with the highest estimated error until their mean is within the anti-aliasing
+    // threshold, or the time limit has passed.
+    if(tracingmethod == 4)
+    {
+        viewData.progressivePixels.assign(viewData.renderArea.GetArea(), ViewData::ProgressivePixel());
+        viewData.progressiveDone = false;
+        viewData.progressiveThreshold = aathreshold;
+        viewData.progressiveConfidenceFactor = ndtri((1 + aaconfidence) / 2);
+        viewData.progressiveMaxSamples = max(PROGRESSIVE_MIN_SAMPLES, 1u << (aadepth * 2));
+        viewData.progressiveTimeLimit = POV_LONG(max(renderOptions.TryGetFloat(kPOVAttrib_AntialiasTimeLimit, 0.0f), 0.0f) * 1000.0);
+    }
+    else
+    {
+        viewData.progressivePixels.clear();
+        viewData.progressiveDone = true;
+    }
+    viewData.progressivePass = 0;
+    viewData.progressiveCutoff = 0.0;
+    viewData.timeBudget = POV_LONG(timebudget * 1000.0);
+    viewData.timeBudgetAntialiasDepth = aadepth;
+    viewData.timeBudgetScale = 1.0;
+    viewData.timeBudgetAreaLights = true;
+    viewData.renderTimer.Reset();
+
     // continue trace
     nextblock = renderOptions.TryGetInt(kPOVAttrib_PixelId, 0);
 
@@ -835,18 +1439,99 @@ void View::StartRender(POVMS_Object& renderOptions)
             blockskiplist->insert(*i);
     }
 
+    // when several machines share the frame, each renders every n-th block and leaves the others alone
+    // (negative node numbers turn into huge unsigned values, and are thus rejected as well)
+    unsigned int renderNodes = (unsigned int)max(renderOptions.TryGetInt(kPOVAttrib_RenderNodes, 1), 1);
+    if(renderNodes > 1)
+    {
+        unsigned int renderNode = (unsigned int)renderOptions.TryGetInt(kPOVAttrib_RenderNode, 1);
+        if((renderNode < 1) || (renderNode > renderNodes))
+            throw POV_EXCEPTION(kParamErr, "Invalid render node");
+
+        for(unsigned int i = 0; i < viewData.blockWidth * viewData.blockHeight; i++)
+        {
+            if((i % renderNodes) != (renderNode - 1))
+                blockskiplist->insert(i);
+        }
+    }
+
     viewData.SetNextRectangle(*blockskiplist, nextblock);
 
     // render thread count
     int maxRenderThreads = renderOptions.TryGetInt(kPOVAttrib_MaxRenderThreads, 1);
 
+    // binding the render threads to CPUs keeps their data local to their NUMA node
+    renderTasks.SetAffinity(renderOptions.TryGetBool(kPOVAttrib_ThreadAffinity, false));
+
+    // views rendering concurrently take turns on the worker threads rather than oversubscribing them
+    renderTasks.SetFairShare(true);
+
     viewData.realTimeRaytracing = renderOptions.TryGetBool(kPOVAttrib_RealTimeRaytracing, false); // TODO - experimental code
     if (viewData.realTimeRaytracing)
         viewData.rtrData = new RTRData(viewData, maxRenderThreads);
 
-    // camera changes without parsing
+    // the render cost of each pixel is recorded for the final image only
+    if(renderOptions.TryGetBool(kPOVAttrib_CostMap, false) && !viewData.realTimeRaytracing)
+        viewData.costMap.reset(new RenderCostMap(viewData.width, viewData.height));
+    else
+        viewData.costMap.reset();
+
+    // likewise the surfaces guiding the denoising of the final image
+    if(renderOptions.TryGetBool(kPOVAttrib_Denoise, false) && !viewData.realTimeRaytracing)
+        viewData.featureMap.reset(new RenderFeatureMap(viewData.width, viewData.height));
+    else
+        viewData.featureMap.reset();
+
+    // Progressive photon mapping renders the image repeatedly, each time from a freshly shot photon map,
+    // and shows the average of the passes, so that memory only ever needs to hold the photons of a
+    // single pass. It does not combine with loading the photon map from a file, nor with the other
+    // modes that render pixels repeatedly.
+    viewData.photonFileName = viewData.GetSceneData()->photonSettings.fileName;
+    viewData.photonFileLoad = !viewData.photonFileName.empty() && viewData.GetSceneData()->photonSettings.loadFile;
+    if(viewData.photonFileName.empty() && (photonpasses == 1) && renderOptions.Exist(kPOVAttrib_CheckpointPhotonFile))
+    {
+        // keep the photon maps alongside the render state, so that continuing doesn't have to shoot them again
+        Path photonFile = Path(renderOptions.GetUCS2String(kPOVAttrib_CheckpointPhotonFile));
+        viewData.photonFileName = UCS2toASCIIString(photonFile());
+        viewData.photonFileLoad = continuing && CheckIfFileExists(photonFile);
+    }
+    if(!viewData.GetSceneData()->photonSettings.photonsEnabled || viewData.photonFileLoad ||
+       (tracingmethod == 4) || viewData.HasTimeBudget() || viewData.realTimeRaytracing || radiosityPretraceOnly)
+        photonpasses = 1;
+    viewData.photonPass = 1;
+    viewData.photonPasses = photonpasses;
+    if(photonpasses > 1)
+        viewData.photonPassPixels.assign(viewData.renderArea.GetArea(), ViewData::PhotonPassPixel());
+    else
+        viewData.photonPassPixels.clear();
+
+    // Split the last blocks of the frame among the render threads, unless the output must not depend
+    // on the block layout (radiosity in high reproducibility mode and stochastic anti-aliasing seed
+    // per block), or blocks must stay aligned to the mosaic preview grid.
+    if(!highReproducibility && (tracingmethod < 3) && (previewstartsize <= 1) && !viewData.realTimeRaytracing && (maxRenderThreads > 1))
+        viewData.blockSplitThreads = maxRenderThreads;
+    else
+        viewData.blockSplitThreads = 0;
+
+    // Keep the pixel centres traced by the mosaic preview for a final pass using no or non-adaptive
+    // anti-aliasing, and the samples along block borders for the neighbouring blocks; but not if each
+    // pixel's own samples must be recorded, nor if the output must not depend on which block traced a
+    // sample, nor if the image is rendered repeatedly from changing cameras or photon maps.
+    bool reusePreview = (previewstartsize > 1) && (tracingmethod <= 1) && !((previewendsize == 1) && (tracingmethod == 0));
+    bool reuseBorders = (tracingmethod == 1) || (tracingmethod == 2);
+    if((reusePreview || reuseBorders) && !highReproducibility && !viewData.realTimeRaytracing && (photonpasses == 1) &&
+       (viewData.costMap == nullptr) && (viewData.featureMap == nullptr))
+        viewData.sampleStore.reset(new SampleStore(reusePreview));
+    else
+        viewData.sampleStore.reset();
+
+    // camera changes without parsing; a scene rendered repeatedly (see Reuse_Scene) may pick any of its cameras
+    const vector<Camera>& sceneCameras = viewData.GetSceneData()->cameras;
+    const Camera& baseCamera = ((renderOptions.Exist(kPOVAttrib_CameraIndex) && !sceneCameras.empty())
+                                ? sceneCameras[size_t(max(0, int(renderOptions.GetInt(kPOVAttrib_CameraIndex)))) % sceneCameras.size()]
+                                : viewData.GetSceneData()->parsedCamera);
     if(renderOptions.Exist(kPOVAttrib_SceneCamera) == false)
-        viewData.camera = viewData.GetSceneData()->parsedCamera;
+        viewData.camera = baseCamera;
     else // INCOMPLETE EXPERIMENTAL [trf]
     {
         POVMS_Object camera;
@@ -854,7 +1539,7 @@ void View::StartRender(POVMS_Object& renderOptions)
         renderOptions.Get(kPOVAttrib_SceneCamera, camera);
 
         // TODO FIXME - clear by setting scene's camera, but not sure if this is the way to go in the long run [trf]
-        viewData.camera = viewData.GetSceneData()->parsedCamera;
+        viewData.camera = baseCamera;
 
         bool had_location = false;
         bool had_direction = false;
@@ -965,6 +1650,23 @@ void View::StartRender(POVMS_Object& renderOptions)
         // Warning("Camera is inside a non-hollow object. Fog and participating media may not work as expected.");
     }
 
+    // precompute the primary rays of costly camera types if the scene asks for it, in stripes of rows run as jobs
+    viewData.cameraRayTable.reset();
+    if (viewData.GetSceneData()->cameraRayTable)
+    {
+        std::unique_ptr<CameraRayTable> table(new CameraRayTable());
+        if (table->Setup(viewData.camera, viewData.width, viewData.height))
+        {
+            viewData.cameraRayTable.reset(table.release());
+            for (unsigned int row = 0; row < viewData.cameraRayTable->GetRows(); row += CAMERA_RAY_TABLE_STRIPE_ROWS)
+                renderTasks.AppendJob(boost::bind(&View::FillCameraRayTable, this, row,
+                                                  min(row + CAMERA_RAY_TABLE_STRIPE_ROWS, viewData.cameraRayTable->GetRows())));
+
+            // wait for the table to be filled before anything traces primary rays
+            renderTasks.AppendSync();
+        }
+    }
+
     // check for preview end size
     if((previewendsize > 1) && (tracingmethod == 0))
     {
@@ -985,60 +1687,42 @@ void View::StartRender(POVMS_Object& renderOptions)
     */
     if(viewData.GetSceneData()->photonSettings.photonsEnabled)
     {
-        if (!viewData.GetSceneData()->photonSettings.fileName.empty() && viewData.GetSceneData()->photonSettings.loadFile)
-        {
-            vector<PhotonMap*> surfaceMaps;
-            vector<PhotonMap*> mediaMaps;
+        // discard the photons of any previous view of the same scene
+        viewData.GetSceneData()->surfacePhotonMap.Clear();
+        viewData.GetSceneData()->mediaPhotonMap.Clear();
 
-            // when we pass a null parameter for the "strategy" (last parameter),
+        if (viewData.photonFileLoad)
+        {
+            // when we pass a null parameter for the "strategy",
             // then this will LOAD the photon map
             viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonSortingTask(
-                &viewData, surfaceMaps, mediaMaps, nullptr, seed
+                &viewData, nullptr, seed
                 ))));
             // wait for photons to finish
             renderTasks.AppendSync();
         }
         else
         {
-            PhotonShootingStrategy* strategy = new PhotonShootingStrategy();
+            AppendPhotonShootingTasks(maxRenderThreads, seed);
 
-            viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonEstimationTask(
+            // this computes gather options
+            viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonSortingTask(
                 &viewData, seed
                 ))));
             // wait for photons to finish
             renderTasks.AppendSync();
 
-            viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonStrategyTask(
-                &viewData, strategy, seed
-                ))));
-            // wait for photons to finish
-            renderTasks.AppendSync();
-
-            vector<PhotonMap*> surfaceMaps;
-            vector<PhotonMap*> mediaMaps;
-
-            for(int i = 0; i < maxRenderThreads; i++)
-            {
-                PhotonShootingTask* task = new PhotonShootingTask(&viewData, strategy, seed);
-                surfaceMaps.push_back(task->getSurfacePhotonMap());
-                mediaMaps.push_back(task->getMediaPhotonMap());
-                viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(task)));
-            }
-            // wait for photons to finish
-            renderTasks.AppendSync();
-
-            // this merges the maps, sorts, computes gather options, and then cleans up memory
-            viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonSortingTask(
-                &viewData, surfaceMaps, mediaMaps, strategy, seed
-                ))));
-            // wait for photons to finish
-            renderTasks.AppendSync();
+            // save the photon maps while the radiosity pretrace and render go ahead, as they only read them
+            if (!viewData.photonFileName.empty())
+                viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonSortingTask(
+                    &viewData, seed, true
+                    ), true)));
 
         }
     }
 
     // do radiosity pretrace
-    if(viewData.GetSceneData()->radiositySettings.radiosityEnabled)
+    if(viewData.GetSceneData()->radiositySettings.radiosityEnabled && !radiositySkipPretrace)
     {
         // TODO load radiosity data (if applicable)?
 
@@ -1113,20 +1797,42 @@ void View::StartRender(POVMS_Object& renderOptions)
         // TODO store radiosity data (if applicable)?
     }
 
+    if(radiosityPretraceOnly)
+    {
+        // only the radiosity cache file is wanted, so there is nothing left to render
+    }
     // do render with mosaic preview
-    if(previewstartsize > 1)
+    else if(previewstartsize > 1)
     {
         // If the mosaic preview goes all the way down to single-pixel size and no anti-aliasing is required,
         // we don't need a dedicated final render pass.
         bool previewIsFinalPass = (previewendsize == 1) && (tracingmethod == 0);
 
+        // With a time budget, the later passes may not get round to every block, so the
+        // mosaic preview must go into the image as well.
+        bool previewContributesToImage = previewIsFinalPass || viewData.HasTimeBudget();
+
+        // time the mosaic preview start size pass, to estimate the cost of the render with a time budget
+        if(viewData.HasTimeBudget())
+        {
+            renderTasks.AppendSync();
+            renderTasks.AppendFunction(boost::bind(&View::StartTimeBudgetProbe, this, _1));
+        }
+
         // do render with mosaic preview start size
         for(int i = 0; i < maxRenderThreads; i++)
             viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new TraceTask(
                 &viewData, 0, jitterscale, aathreshold, aaconfidence, aadepth, aaGammaCurve,
-                previewstartsize, false, previewIsFinalPass, highReproducibility, seed
+                previewstartsize, false, previewContributesToImage, highReproducibility, wavefront, seed
                 ))));
 
+        // scale the settings of the remaining passes to fit the time budget
+        if(viewData.HasTimeBudget())
+        {
+            renderTasks.AppendSync();
+            renderTasks.AppendFunction(boost::bind(&View::PlanTimeBudget, this, _1, previewstartsize, tracingmethod, aadepth));
+        }
+
         for(unsigned int step = (previewstartsize >> 1); step >= previewendsize; step >>= 1)
         {
             // wait for previous mosaic preview step to finish
@@ -1142,7 +1848,7 @@ void View::StartRender(POVMS_Object& renderOptions)
             for(int i = 0; i < maxRenderThreads; i++)
                 viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new TraceTask(
                     &viewData, 0, jitterscale, aathreshold, aaconfidence, aadepth, aaGammaCurve,
-                    step, true, previewIsFinalPass, highReproducibility, seed
+                    step, true, previewContributesToImage, highReproducibility, wavefront, seed
                     ))));
         }
 
@@ -1160,7 +1866,7 @@ void View::StartRender(POVMS_Object& renderOptions)
             for(int i = 0; i < maxRenderThreads; i++)
                 viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new TraceTask(
                     &viewData, tracingmethod, jitterscale, aathreshold, aaconfidence, aadepth, aaGammaCurve,
-                    0, false, true, highReproducibility, seed
+                    0, false, true, highReproducibility, wavefront, seed
                     ))));
         }
     }
@@ -1170,12 +1876,62 @@ void View::StartRender(POVMS_Object& renderOptions)
         for(int i = 0; i < maxRenderThreads; i++)
             viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new TraceTask(
                 &viewData, tracingmethod, jitterscale, aathreshold, aaconfidence, aadepth, aaGammaCurve,
-                0, false, true, highReproducibility, seed
+                0, false, true, highReproducibility, wavefront, seed
                 ))));
     }
 
-    // wait for render to finish
-    renderTasks.AppendSync();
+    // refine a progressively sampled image where its estimated error is highest
+    if((tracingmethod == 4) && !radiosityPretraceOnly)
+    {
+        for(unsigned int pass = 0; pass < PROGRESSIVE_PASSES_PER_DEPTH * aadepth; pass++)
+        {
+            // wait for previous pass to finish
+            renderTasks.AppendSync();
+
+            // choose pixels to refine, and reset block size counter and block skip list
+            renderTasks.AppendFunction(boost::bind(&View::PlanProgressivePass, this, _1));
+            renderTasks.AppendFunction(boost::bind(&View::SetNextRectangle, this, _1, blockskiplist, nextblock));
+
+            // wait for pass setup to finish
+            renderTasks.AppendSync();
+
+            for(int i = 0; i < maxRenderThreads; i++)
+                viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new TraceTask(
+                    &viewData, tracingmethod, jitterscale, aathreshold, aaconfidence, aadepth, aaGammaCurve,
+                    0, false, true, highReproducibility, wavefront, seed
+                    ))));
+        }
+    }
+
+    // render again from fresh photon maps for each further pass of progressive photon mapping
+    for(unsigned int pass = 2; pass <= photonpasses; pass++)
+    {
+        // wait for previous pass to finish, and for the photon maps to be saved
+        renderTasks.AppendJoin();
+
+        // discard the previous photons and shrink the gather radii
+        renderTasks.AppendFunction(boost::bind(&View::StartPhotonPass, this, _1));
+
+        // wait for pass setup to finish
+        renderTasks.AppendSync();
+
+        AppendPhotonShootingTasks(maxRenderThreads, seed);
+
+        // reset block size counter and block skip list
+        renderTasks.AppendFunction(boost::bind(&View::SetNextRectangle, this, _1, blockskiplist, nextblock));
+
+        // wait for block size counter and block skip list reset to finish
+        renderTasks.AppendSync();
+
+        for(int i = 0; i < maxRenderThreads; i++)
+            viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new TraceTask(
+                &viewData, tracingmethod, jitterscale, aathreshold, aaconfidence, aadepth, aaGammaCurve,
+                0, false, true, highReproducibility, wavefront, seed
+                ))));
+    }
+
+    // wait for render to finish, including any work running alongside it
+    renderTasks.AppendJoin();
 
     // send shutdown messages
     renderTasks.AppendFunction(boost::bind(&View::DispatchShutdownMessages, this, _1));
@@ -1183,9 +1939,21 @@ void View::StartRender(POVMS_Object& renderOptions)
     // wait for shutdown messages to be sent
     renderTasks.AppendSync();
 
+    // send render cost map
+    renderTasks.AppendFunction(boost::bind(&View::SendCostMap, this, _1));
+
+    // send the surfaces guiding the denoising of the image, if recorded
+    renderTasks.AppendFunction(boost::bind(&View::SendFeatureMap, this, _1));
+
+    // release any samples left over for reuse
+    renderTasks.AppendFunction(boost::bind(&View::DiscardSampleStore, this, _1));
+
     // send statistics
     renderTasks.AppendFunction(boost::bind(&View::SendStatistics, this, _1));
 
+    // write event trace
+    renderTasks.AppendFunction(boost::bind(&View::WriteEventTrace, this, _1));
+
     // send done message
     POVMS_Message doneMessage(kPOVObjectClass_ResultData, kPOVMsgClass_ViewOutput, kPOVMsgIdent_Done);
     doneMessage.SetInt(kPOVAttrib_ViewId, viewData.viewId);
@@ -1201,6 +1969,19 @@ void View::StopRender()
     RenderBackend::SendViewFailedResult(viewData.viewId, kUserAbortErr, viewData.sceneData->frontendAddress);
 }
 
+#if POV_OBJECT_PROFILE
+/// Orders object profile entries by decreasing total time.
+struct ObjectProfileTimeOrder
+{
+    const vector<ObjectProfile>& profile;
+    ObjectProfileTimeOrder(const vector<ObjectProfile>& p) : profile(p) {}
+    bool operator()(size_t a, size_t b) const
+    {
+        return (profile[a].testTime + profile[a].shadingTime) > (profile[b].testTime + profile[b].shadingTime);
+    }
+};
+#endif
+
 void View::GetStatistics(POVMS_Object& renderStats)
 {
     RenderStatistics    stats;
@@ -1225,6 +2006,151 @@ void View::GetStatistics(POVMS_Object& renderStats)
 
     renderStats.Set(kPOVAttrib_ObjectIStats, isectStats);
 
+    // bounding hierarchy traversal stats
+    POVMS_List traversalStats;
+
+    for (size_t index = 0; traversal_stats[index].infotext != nullptr; index++)
+    {
+        POVMS_Object traversalStat(kPOVObjectClass_TraversalStat);
+
+        traversalStat.SetString(kPOVAttrib_ObjectName, traversal_stats[index].infotext);
+        traversalStat.SetLong(kPOVAttrib_TraversalRays, stats[traversal_stats[index].stat_rays_id]);
+        traversalStat.SetLong(kPOVAttrib_TraversalNodes, stats[traversal_stats[index].stat_nodes_id]);
+        traversalStat.SetLong(kPOVAttrib_TraversalObjects, stats[traversal_stats[index].stat_objects_id]);
+
+        traversalStats.Append(traversalStat);
+    }
+
+    renderStats.Set(kPOVAttrib_TraversalStats, traversalStats);
+
+    // Russian roulette stats by trace level
+    POVMS_List rouletteStats;
+
+    for (int level = 0; level < 5; level++)
+    {
+        POVMS_Object rouletteStat(kPOVObjectClass_RouletteStat);
+
+        rouletteStat.SetInt(kPOVAttrib_TraceLevel, level + 1);
+        rouletteStat.SetLong(kPOVAttrib_RouletteTests, stats[IntStatsIndex(Roulette_Tests_L1 + level)]);
+        rouletteStat.SetLong(kPOVAttrib_RouletteKills, stats[IntStatsIndex(Roulette_Kills_L1 + level)]);
+
+        rouletteStats.Append(rouletteStat);
+    }
+
+    renderStats.Set(kPOVAttrib_RouletteStats, rouletteStats);
+
+    // function profile, if the function virtual machine gathers one
+    if (viewData.sceneData->functionContextFactory != nullptr)
+    {
+        vector<CustomFunctionProfile> functionProfile;
+        vector<CustomFunctionOpcodeProfile> opcodeProfile;
+
+        viewData.sceneData->functionContextFactory->GetProfile(functionProfile, opcodeProfile);
+
+        if (!functionProfile.empty())
+        {
+            POVMS_List functionStats;
+
+            for (vector<CustomFunctionProfile>::const_iterator i = functionProfile.begin(); i != functionProfile.end(); i++)
+            {
+                POVMS_Object functionStat(kPOVObjectClass_FunctionStat);
+
+                functionStat.SetString(kPOVAttrib_ObjectName, i->sourceInfo.name.c_str());
+                functionStat.SetUCS2String(kPOVAttrib_FileName, i->sourceInfo.fileName.c_str());
+                functionStat.SetLong(kPOVAttrib_Line, i->sourceInfo.position.line);
+                functionStat.SetLong(kPOVAttrib_FunctionVMCalls, i->calls);
+                functionStat.SetLong(kPOVAttrib_FunctionVMInstr, i->instructions);
+                functionStat.SetFloat(kPOVAttrib_FunctionVMTime, i->time);
+
+                functionStats.Append(functionStat);
+            }
+
+            renderStats.Set(kPOVAttrib_FunctionVMProfile, functionStats);
+        }
+
+        if (!opcodeProfile.empty())
+        {
+            POVMS_List opcodeStats;
+
+            for (vector<CustomFunctionOpcodeProfile>::const_iterator i = opcodeProfile.begin(); i != opcodeProfile.end(); i++)
+            {
+                POVMS_Object opcodeStat(kPOVObjectClass_OpcodeStat);
+
+                opcodeStat.SetString(kPOVAttrib_ObjectName, i->name);
+                opcodeStat.SetLong(kPOVAttrib_FunctionVMInstr, i->count);
+
+                opcodeStats.Append(opcodeStat);
+            }
+
+            renderStats.Set(kPOVAttrib_FunctionVMOpcodes, opcodeStats);
+        }
+    }
+
+#if POV_OBJECT_PROFILE
+    // object profile, by decreasing total time
+    const vector<ObjectSourceInfo>& objectSources = viewData.sceneData->objectProfileSources;
+    vector<ObjectProfile> objectProfile(max<size_t>(objectSources.size(), 1));
+
+    for(vector<ViewThreadData *>::iterator i(viewThreadData.begin()); i != viewThreadData.end(); i++)
+    {
+        // entries beyond the known objects can only stem from objects not attributed to any of them
+        for(size_t n = 0; n < (*i)->objectProfile.size(); n++)
+            objectProfile[(n < objectProfile.size()) ? n : 0] += (*i)->objectProfile[n];
+    }
+
+    vector<size_t> objectOrder;
+    for(size_t n = 0; n < objectProfile.size(); n++)
+    {
+        if((objectProfile[n].tests > 0) || (objectProfile[n].shadings > 0))
+            objectOrder.push_back(n);
+    }
+    std::stable_sort(objectOrder.begin(), objectOrder.end(), ObjectProfileTimeOrder(objectProfile));
+
+    if (!objectOrder.empty())
+    {
+        POVMS_List objectStats;
+
+        for (vector<size_t>::const_iterator i = objectOrder.begin(); i != objectOrder.end(); i++)
+        {
+            const ObjectProfile& profile = objectProfile[*i];
+            POVMS_Object objectStat(kPOVObjectClass_ObjectStat);
+
+            if (*i < objectSources.size())
+            {
+                objectStat.SetString(kPOVAttrib_ObjectName, objectSources[*i].name.c_str());
+                objectStat.SetUCS2String(kPOVAttrib_FileName, objectSources[*i].fileName.c_str());
+                objectStat.SetLong(kPOVAttrib_Line, objectSources[*i].position.line);
+            }
+            objectStat.SetLong(kPOVAttrib_ObjectTests, profile.tests);
+            objectStat.SetLong(kPOVAttrib_ObjectHits, profile.hits);
+            objectStat.SetFloat(kPOVAttrib_ObjectTestTime, profile.testTime * 1.0e-9);
+            objectStat.SetLong(kPOVAttrib_ObjectShadings, profile.shadings);
+            objectStat.SetFloat(kPOVAttrib_ObjectShadingTime, profile.shadingTime * 1.0e-9);
+
+            objectStats.Append(objectStat);
+        }
+
+        renderStats.Set(kPOVAttrib_ObjectProfile, objectStats);
+    }
+#endif
+
+    // memory use by subsystem
+    POVMS_List memoryStats;
+
+    for (int category = 0; category < kMemoryCategories; category++)
+    {
+        POVMS_Object memoryStat(kPOVObjectClass_MemoryStat);
+
+        memoryStat.SetString(kPOVAttrib_MemoryCategory, MemoryAccounting::GetName(MemoryCategory(category)));
+        memoryStat.SetLong(kPOVAttrib_MemoryCurrent, MemoryAccounting::GetCurrent(MemoryCategory(category)));
+        memoryStat.SetLong(kPOVAttrib_MemoryPeak, MemoryAccounting::GetPeak(MemoryCategory(category)));
+
+        memoryStats.Append(memoryStat);
+    }
+
+    renderStats.Set(kPOVAttrib_MemoryStats, memoryStats);
+    renderStats.SetLong(kPOVAttrib_AccountedMemory, MemoryAccounting::GetTotalPeak());
+
     // general stats
     renderStats.SetInt(kPOVAttrib_Height, viewData.GetHeight());
     renderStats.SetInt(kPOVAttrib_Width, viewData.GetWidth());
@@ -1239,6 +2165,12 @@ void View::GetStatistics(POVMS_Object& renderStats)
     renderStats.SetLong(kPOVAttrib_ShadowTest, stats[Shadow_Ray_Tests]);
     renderStats.SetLong(kPOVAttrib_ShadowTestSuc, stats[Shadow_Rays_Succeeded]);
     renderStats.SetLong(kPOVAttrib_ShadowCacheHits, stats[Shadow_Cache_Hits]);
+    renderStats.SetLong(kPOVAttrib_ShadowCacheTests, stats[Shadow_Cache_Tests]);
+    renderStats.SetLong(kPOVAttrib_BSPMailboxHits, stats[BSP_Mailbox_Hits]);
+    renderStats.SetLong(kPOVAttrib_MergeHitTests, stats[CSG_Merge_Hit_Tests]);
+    renderStats.SetLong(kPOVAttrib_MergeInsideTests, stats[CSG_Merge_Inside_Tests]);
+    renderStats.SetLong(kPOVAttrib_TraceHeapAllocs, stats[Trace_Heap_Allocations]);
+    renderStats.SetLong(kPOVAttrib_ReusedCameraRays, stats[Reused_Camera_Rays]);
     renderStats.SetLong(kPOVAttrib_MediaSamples, stats[Media_Samples]);
     renderStats.SetLong(kPOVAttrib_MediaIntervals, stats[Media_Intervals]);
     renderStats.SetLong(kPOVAttrib_ReflectedRays, stats[Reflected_Rays_Traced]);
@@ -1258,6 +2190,9 @@ void View::GetStatistics(POVMS_Object& renderStats)
     renderStats.SetLong(kPOVAttrib_CrackleCacheTest, stats[CrackleCache_Tests]);
     renderStats.SetLong(kPOVAttrib_CrackleCacheTestSuc, stats[CrackleCache_Tests_Succeeded]);
 
+    renderStats.SetLong(kPOVAttrib_MeshTest, stats[Ray_Mesh_Tests]);
+    renderStats.SetLong(kPOVAttrib_MeshTriangleTest, stats[Ray_Mesh_Triangle_Tests]);
+
     POV_LONG current;
     POV_ULONG allocs(0), frees(0), peak(0), smallest(0), largest(0);
     POV_MEM_STATS_RENDER_END();
@@ -1331,9 +2266,23 @@ void View::GetStatistics(POVMS_Object& renderStats)
     {
         POV_LONG cpuTime;
         POV_LONG realTime;
+        POV_LONG totalRealTime;
+        POV_LONG hardwareCounts[kHardwareCounterCount];
         size_t samples;
 
-        TimeData() : cpuTime(0), realTime(0), samples(0) { }
+        TimeData() : cpuTime(0), realTime(0), totalRealTime(0), samples(0)
+        {
+            for (int i = 0; i < kHardwareCounterCount; ++i)
+                hardwareCounts[i] = -1;
+        }
+    };
+
+    static const POVMSType kHardwareCounterAttrib[kHardwareCounterCount] =
+    {
+        kPOVAttrib_CPUCycles,
+        kPOVAttrib_Instructions,
+        kPOVAttrib_CacheMisses,
+        kPOVAttrib_BranchMisses,
     };
 
     TimeData timeData[TraceThreadData::kMaxTimeType];
@@ -1341,7 +2290,14 @@ void View::GetStatistics(POVMS_Object& renderStats)
     for(vector<ViewThreadData *>::iterator i(viewThreadData.begin()); i != viewThreadData.end(); i++)
     {
         timeData[(*i)->timeType].realTime = max(timeData[(*i)->timeType].realTime, (*i)->realTime);
+        timeData[(*i)->timeType].totalRealTime += (*i)->realTime;
         timeData[(*i)->timeType].cpuTime += (*i)->cpuTime;
+        for (int c = 0; c < kHardwareCounterCount; ++c)
+        {
+            // threads that could not sample a counter leave the sum alone
+            if ((*i)->hardwareCounts[c] >= 0)
+                timeData[(*i)->timeType].hardwareCounts[c] = max<POV_LONG>(timeData[(*i)->timeType].hardwareCounts[c], 0) + (*i)->hardwareCounts[c];
+        }
         timeData[(*i)->timeType].samples++;
     }
 
@@ -1354,6 +2310,13 @@ void View::GetStatistics(POVMS_Object& renderStats)
             elapsedTime.SetLong(kPOVAttrib_RealTime, timeData[i].realTime);
             elapsedTime.SetLong(kPOVAttrib_CPUTime, timeData[i].cpuTime);
             elapsedTime.SetInt(kPOVAttrib_TimeSamples, (int) timeData[i].samples);
+            // the gap between the slowest and the average thread is the time lost waiting for the last blocks
+            elapsedTime.SetLong(kPOVAttrib_MeanRealTime, timeData[i].totalRealTime / POV_LONG(timeData[i].samples));
+            for (int c = 0; c < kHardwareCounterCount; ++c)
+            {
+                if (timeData[i].hardwareCounts[c] >= 0)
+                    elapsedTime.SetLong(kHardwareCounterAttrib[c], timeData[i].hardwareCounts[c]);
+            }
 
             switch(i)
             {
@@ -1423,11 +2386,177 @@ void View::SendStatistics(TaskQueue&)
     viewThreadData.clear();
 }
 
+void View::SendFeatureMap(TaskQueue&)
+{
+    if(viewData.featureMap == nullptr)
+        return;
+
+    POVMS_Message featuremsg(kPOVObjectClass_PixelData, kPOVMsgClass_ViewImage, kPOVMsgIdent_FeatureMapSet);
+
+    // send the averages rather than the sums, with the normals renormalised
+    const vector<float>& sums(viewData.featureMap->GetData());
+    vector<POVMSFloat> features;
+    features.reserve(sums.size() / RenderFeatureMap::kChannels * 7);
+    for(vector<float>::const_iterator i(sums.begin()); i != sums.end(); i += RenderFeatureMap::kChannels)
+    {
+        float rays = i[RenderFeatureMap::kRays];
+        float scale = (rays > 0.0f) ? 1.0f / rays : 0.0f;
+        Vector3d normal(i[RenderFeatureMap::kNormalX], i[RenderFeatureMap::kNormalY], i[RenderFeatureMap::kNormalZ]);
+        if(!normal.IsNull())
+            normal.normalize();
+        features.push_back(i[RenderFeatureMap::kAlbedoRed] * scale);
+        features.push_back(i[RenderFeatureMap::kAlbedoGreen] * scale);
+        features.push_back(i[RenderFeatureMap::kAlbedoBlue] * scale);
+        features.push_back(POVMSFloat(normal.x()));
+        features.push_back(POVMSFloat(normal.y()));
+        features.push_back(POVMSFloat(normal.z()));
+        features.push_back(i[RenderFeatureMap::kDepth] * scale);
+    }
+    POVMS_Attribute featureattr(features);
+
+    featuremsg.Set(kPOVAttrib_PixelFeatures, featureattr);
+    featuremsg.SetInt(kPOVAttrib_Width, viewData.featureMap->GetWidth());
+    featuremsg.SetInt(kPOVAttrib_Height, viewData.featureMap->GetHeight());
+
+    featuremsg.SetInt(kPOVAttrib_ViewId, viewData.viewId);
+    featuremsg.SetSourceAddress(viewData.sceneData->backendAddress);
+    featuremsg.SetDestinationAddress(viewData.sceneData->frontendAddress);
+
+    POVMS_SendMessage(featuremsg);
+
+    viewData.featureMap.reset();
+}
+
+void View::FillCameraRayTable(unsigned int firstRow, unsigned int endRow)
+{
+    Trace::CooperateFunctor cooperate;
+    Trace::MediaFunctor media;
+    Trace::RadiosityFunctor radiosity;
+    TraceThreadData threadData(viewData.GetSceneData(), 0);
+    TracePixel trace(viewData.GetSceneData(), &viewData.GetCamera(), &threadData,
+                     viewData.GetSceneData()->parsedMaxTraceLevel, viewData.GetSceneData()->parsedAdcBailout,
+                     viewData.GetQualityFeatureFlags(), cooperate, media, radiosity);
+    trace.FillCameraRayTable(*viewData.cameraRayTable, firstRow, endRow);
+}
+
+void View::DiscardSampleStore(TaskQueue&)
+{
+    viewData.sampleStore.reset();
+}
+
+void View::SendCostMap(TaskQueue&)
+{
+    if(viewData.costMap == nullptr)
+        return;
+
+    POVMS_Message costmsg(kPOVObjectClass_PixelData, kPOVMsgClass_ViewImage, kPOVMsgIdent_CostMapSet);
+
+    const vector<float>& costs(viewData.costMap->GetData());
+    vector<POVMSFloat> costvector(costs.begin(), costs.end());
+    POVMS_Attribute costattr(costvector);
+
+    costmsg.Set(kPOVAttrib_PixelCosts, costattr);
+    costmsg.SetInt(kPOVAttrib_Width, viewData.costMap->GetWidth());
+    costmsg.SetInt(kPOVAttrib_Height, viewData.costMap->GetHeight());
+
+    costmsg.SetInt(kPOVAttrib_ViewId, viewData.viewId);
+    costmsg.SetSourceAddress(viewData.sceneData->backendAddress);
+    costmsg.SetDestinationAddress(viewData.sceneData->frontendAddress);
+
+    POVMS_SendMessage(costmsg);
+
+    viewData.costMap.reset();
+}
+
+void View::WriteEventTrace(TaskQueue&)
+{
+    if(viewData.sceneData->eventTraceFile.empty() || !EventTrace::IsEnabled())
+        return;
+
+    EventTrace::Stop();
+
+    std::unique_ptr<OStream> file(NewOStream(viewData.sceneData->eventTraceFile.c_str(), POV_File_Text_User, false));
+    EventTrace::Write(*file);
+}
+
 void View::SetNextRectangle(TaskQueue&, shared_ptr<ViewData::BlockIdSet> bsl, unsigned int fs)
 {
     viewData.SetNextRectangle(*bsl, fs);
 }
 
+void View::PlanProgressivePass(TaskQueue&)
+{
+    viewData.PlanProgressivePass();
+}
+
+void View::StartTimeBudgetProbe(TaskQueue&)
+{
+    viewData.StartTimeBudgetProbe();
+}
+
+void View::PlanTimeBudget(TaskQueue&, unsigned int previewSize, unsigned int tracingMethod, unsigned int aaDepth)
+{
+    viewData.PlanTimeBudget(previewSize, tracingMethod, aaDepth);
+}
+
+void View::StartPhotonPass(TaskQueue&)
+{
+    viewData.StartPhotonPass();
+}
+
+void View::AppendPhotonShootingTasks(int maxRenderThreads, size_t seed)
+{
+    PhotonShootingStrategy* strategy = new PhotonShootingStrategy();
+
+    viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonStrategyTask(
+        &viewData, strategy, seed
+        ))));
+    // wait for photons to finish
+    renderTasks.AppendSync();
+
+    // this adjusts the photon spacing of the work units to meet the photon count, if one is given
+    if(viewData.GetSceneData()->photonSettings.surfaceCount > 0)
+    {
+        viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonEstimationTask(
+            &viewData, strategy, seed
+            ))));
+        // wait for photons to finish
+        renderTasks.AppendSync();
+    }
+
+    // this finds the directions of the work units whose photons end up in sight of the camera
+    if(viewData.GetSceneData()->photonSettings.importance < 1.0)
+    {
+        viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonImportanceTask(
+            &viewData, strategy, seed
+            ))));
+        // wait for photons to finish
+        renderTasks.AppendSync();
+    }
+
+    for(int i = 0; i < maxRenderThreads; i++)
+        viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonShootingTask(
+            &viewData, strategy, seed
+            ))));
+    // wait for photons to finish
+    renderTasks.AppendSync();
+
+    // this merges the maps, sorts the top of the kd-trees, and then cleans up memory
+    viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonSortingTask(
+        &viewData, strategy, seed
+        ))));
+    // wait for photons to finish
+    renderTasks.AppendSync();
+
+    // sort the subtrees of the kd-trees in parallel
+    for(int i = 0; i < maxRenderThreads; i++)
+        viewThreadData.push_back(dynamic_cast<ViewThreadData *>(renderTasks.AppendTask(new PhotonTreeTask(
+            &viewData, seed
+            ))));
+    // wait for photons to finish
+    renderTasks.AppendSync();
+}
+
 void View::RenderControlThread()
 {
     bool sentFailedResult = false;
@@ -1450,9 +2579,67 @@ void View::RenderControlThread()
     }
 }
 
+void SampleStore::AddCentres(const vector<Vector2d>& positions, const vector<RGBTColour>& colours)
+{
+    boost::mutex::scoped_lock lock(dataMutex);
+
+    for(size_t i = 0; i < positions.size(); i++)
+        samples[Key(2 * int(positions[i].x()) + 1, 2 * int(positions[i].y()) + 1)] = colours[i];
+}
+
+unsigned int SampleStore::TakeCentres(const POVRect& rect, vector<RGBTColour>& colours, vector<bool>& found)
+{
+    unsigned int count = 0;
+
+    colours.resize(rect.GetArea());
+    found.assign(rect.GetArea(), false);
+
+    boost::mutex::scoped_lock lock(dataMutex);
+
+    if(samples.empty())
+        return 0;
+
+    for(unsigned int y = rect.top, i = 0; y <= rect.bottom; y++)
+    {
+        for(unsigned int x = rect.left; x <= rect.right; x++, i++)
+        {
+            SampleMap::iterator sample = samples.find(Key(2 * int(x) + 1, 2 * int(y) + 1));
+            if(sample != samples.end())
+            {
+                colours[i] = sample->second;
+                found[i] = true;
+                samples.erase(sample);
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+void SampleStore::Add(POV_ULONG key, const RGBTColour& colour)
+{
+    boost::mutex::scoped_lock lock(dataMutex);
+
+    samples[key] = colour;
+}
+
+bool SampleStore::Find(POV_ULONG key, RGBTColour& colour) const
+{
+    boost::mutex::scoped_lock lock(dataMutex);
+
+    SampleMap::const_iterator sample = samples.find(key);
+    if(sample == samples.end())
+        return false;
+
+    colour = sample->second;
+    return true;
+}
+
 RTRData::RTRData(ViewData& v, int mrt) :
     viewData(v),
     numRTRframes(0),
+    numAccumulatedFrames(0),
     numRenderThreads(mrt),
     numRenderThreadsCompleted(0),
     numPixelsCompleted(0)
@@ -1460,6 +2647,14 @@ RTRData::RTRData(ViewData& v, int mrt) :
     width = viewData.GetWidth();
     height = viewData.GetHeight();
     rtrPixels.resize(width * height * 5);
+    accumulatedPixels.resize(width * height * 5);
+}
+
+/// Whether two cameras show the same view, so that their frames may be accumulated.
+static bool SameView(const Camera& a, const Camera& b)
+{
+    return (a.Location - b.Location).IsNull() && (a.Direction - b.Direction).IsNull() &&
+           (a.Up - b.Up).IsNull() && (a.Right - b.Right).IsNull() && (a.Type == b.Type) && (a.Angle == b.Angle) && (a.Aperture == b.Aperture) && (a.Focal_Distance == b.Focal_Distance);
 }
 
 RTRData::~RTRData()
@@ -1488,46 +2683,60 @@ const Camera *RTRData::CompletedFrame()
         if (++numRenderThreadsCompleted >= numRenderThreads)
         {
             viewData.SetNextRectangle(ViewData::BlockIdSet(), 0);
-            try
+
+            // While the camera stays put, show the average of all frames rendered so far,
+            // so that the noise of stochastic effects fades away progressively.
+            unsigned int frame = numRTRframes;
+            if ((frame == 0) || (ca && !SameView(cameras[(frame - 1) % cameras.size()], cameras[frame % cameras.size()])))
+                numAccumulatedFrames = 0;
+            numAccumulatedFrames++;
+
+            vector<POVMSFloat> framePixels(rtrPixels.size());
+            POVMSFloat scale = 1.0f / numAccumulatedFrames;
+            for (size_t i = 0; i < rtrPixels.size(); i++)
             {
-                POVMS_Message pixelblockmsg(kPOVObjectClass_PixelData, kPOVMsgClass_ViewImage, kPOVMsgIdent_PixelBlockSet);
-                POVMS_Attribute pixelattr(rtrPixels);
+                if (numAccumulatedFrames == 1)
+                    accumulatedPixels[i] = rtrPixels[i];
+                else
+                    accumulatedPixels[i] += rtrPixels[i];
+                framePixels[i] = accumulatedPixels[i] * scale;
+            }
 
-                // we can release the other threads now.
-                numRenderThreadsCompleted = 0;
-                numRTRframes++;
+            numPixelsCompleted += width * height;
+            unsigned int pixelsCompleted = numPixelsCompleted;
 
-                event.notify_all();
+            // we can release the other threads now; sending the frame no longer needs the lock,
+            // so they can start on the next frame while we're at it.
+            numRenderThreadsCompleted = 0;
+            numRTRframes++;
+            const Camera *camera = (ca ? &cameras[numRTRframes % cameras.size()] : nullptr);
 
-                pixelblockmsg.Set(kPOVAttrib_PixelBlock, pixelattr);
-                pixelblockmsg.SetInt(kPOVAttrib_PixelSize, 1);
-                pixelblockmsg.SetInt(kPOVAttrib_Left, 0);
-                pixelblockmsg.SetInt(kPOVAttrib_Top, 0);
-                pixelblockmsg.SetInt(kPOVAttrib_Right, width - 1);
-                pixelblockmsg.SetInt(kPOVAttrib_Bottom, height - 1);
+            event.notify_all();
+            lock.unlock();
 
-                pixelblockmsg.SetInt(kPOVAttrib_ViewId, viewData.GetViewId());
-                pixelblockmsg.SetSourceAddress(viewData.GetSceneData()->backendAddress);
-                pixelblockmsg.SetDestinationAddress(viewData.GetSceneData()->frontendAddress);
+            POVMS_Message pixelblockmsg(kPOVObjectClass_PixelData, kPOVMsgClass_ViewImage, kPOVMsgIdent_PixelBlockSet);
+            POVMS_Attribute pixelattr(framePixels);
 
-                POVMS_SendMessage(pixelblockmsg);
+            pixelblockmsg.Set(kPOVAttrib_PixelBlock, pixelattr);
+            pixelblockmsg.SetInt(kPOVAttrib_PixelSize, 1);
+            pixelblockmsg.SetInt(kPOVAttrib_Left, 0);
+            pixelblockmsg.SetInt(kPOVAttrib_Top, 0);
+            pixelblockmsg.SetInt(kPOVAttrib_Right, width - 1);
+            pixelblockmsg.SetInt(kPOVAttrib_Bottom, height - 1);
 
-                numPixelsCompleted += width * height;
-                POVMS_Object obj(kPOVObjectClass_RenderProgress);
-                obj.SetInt(kPOVAttrib_Pixels, width * height);
-                obj.SetInt(kPOVAttrib_PixelsPending, 0);
-                obj.SetInt(kPOVAttrib_PixelsCompleted, numPixelsCompleted);
-                RenderBackend::SendViewOutput(viewData.GetViewId(), viewData.GetSceneData()->frontendAddress, kPOVMsgIdent_Progress, obj);
+            pixelblockmsg.SetInt(kPOVAttrib_ViewId, viewData.GetViewId());
+            pixelblockmsg.SetSourceAddress(viewData.GetSceneData()->backendAddress);
+            pixelblockmsg.SetDestinationAddress(viewData.GetSceneData()->frontendAddress);
 
-                return (ca ? &cameras[numRTRframes % cameras.size()] : nullptr);
-            }
-            catch(pov_base::Exception&)
-            {
-                // TODO - work out what we should do here. until then, just re-raise the exception.
-                // oh yeah, might want to release any waiting threads first ...
-                event.notify_all();
-                throw;
-            }
+            POVMS_SendMessage(pixelblockmsg);
+
+            POVMS_Object obj(kPOVObjectClass_RenderProgress);
+            obj.SetInt(kPOVAttrib_Pixels, width * height);
+            obj.SetInt(kPOVAttrib_PixelsPending, 0);
+            obj.SetInt(kPOVAttrib_PixelsCompleted, pixelsCompleted);
+            RenderBackend::SendViewOutput(viewData.GetViewId(), viewData.GetSceneData()->frontendAddress, kPOVMsgIdent_Progress, obj);
+
+            return camera;
         }
     }
 
@@ -36,8 +36,15 @@
 #ifndef POVRAY_BACKEND_VIEW_H
 #define POVRAY_BACKEND_VIEW_H
 
+#include <deque>
+#include <map>
+#include <memory>
 #include <vector>
 
+#include <boost/unordered_map.hpp>
+
+#include "base/timer.h"
+
 #include "core/bounding/bsptree.h"
 #include "core/lighting/radiosity.h"
 #include "core/scene/camera.h"
@@ -49,6 +56,9 @@ namespace pov
 
 using namespace pov_base;
 
+class CameraRayTable;
+class RenderCostMap;
+class RenderFeatureMap;
 class Scene;
 class SceneData;
 class ViewData;
@@ -66,6 +76,10 @@ class RTRData
         unsigned int numRTRframes;
         /// this holds the pixels rendered in real-time-raytracing mode
         vector<POVMSFloat> rtrPixels;
+        /// sum of the frames rendered since the camera last changed
+        vector<POVMSFloat> accumulatedPixels;
+        /// number of frames in accumulatedPixels
+        unsigned int numAccumulatedFrames;
         /// the number of render threads to wait for
         int numRenderThreads;
         /// the number of render threads that have completed the current RTR frame
@@ -81,6 +95,51 @@ class RTRData
         unsigned int numPixelsCompleted;
 };
 
+/**
+ *  Sparse store of camera ray samples, for reuse rather than tracing them again.
+ *
+ *  The mosaic preview passes trace pixel centres that a final pass using no or non-adaptive
+ *  anti-aliasing would trace again, and neighbouring blocks trace the same samples along their
+ *  common border. Such samples are kept here, keyed by their position on a grid of half-pixel
+ *  spacing, so that both pixel centres and pixel corners can be told apart. All methods may be
+ *  called from any render thread.
+ */
+class SampleStore final
+{
+    public:
+        /// @param[in]  kp          Whether the samples of the mosaic preview are of use to the final pass.
+        SampleStore(bool kp) : keepPreview(kp) {}
+
+        bool KeepsPreviewSamples() const { return keepPreview; }
+
+        /// Store samples taken at the centres of the pixels at the given (integer) positions.
+        void AddCentres(const vector<Vector2d>& positions, const vector<RGBTColour>& colours);
+        void AddCentre(int x, int y, const RGBTColour& colour) { Add(Key(2 * x + 1, 2 * y + 1), colour); }
+        void AddCorner(int x, int y, const RGBTColour& colour) { Add(Key(2 * x, 2 * y), colour); }
+
+        bool FindCentre(int x, int y, RGBTColour& colour) const { return Find(Key(2 * x + 1, 2 * y + 1), colour); }
+        bool FindCorner(int x, int y, RGBTColour& colour) const { return Find(Key(2 * x, 2 * y), colour); }
+
+        /// Remove the samples taken at the centres of the pixels of a block.
+        /// @param[in]  rect        Block to take the samples of.
+        /// @param[out] colours     Samples in scanline order, where found.
+        /// @param[out] found       Whether each pixel's sample was found.
+        /// @return                 Number of samples found.
+        unsigned int TakeCentres(const POVRect& rect, vector<RGBTColour>& colours, vector<bool>& found);
+
+    private:
+        typedef boost::unordered_map<POV_ULONG, RGBTColour> SampleMap;
+
+        bool keepPreview;
+        SampleMap samples;
+        mutable boost::mutex dataMutex;
+
+        static POV_ULONG Key(int x2, int y2) { return (static_cast<POV_ULONG>(POV_UINT32(y2)) << 32) | static_cast<POV_ULONG>(POV_UINT32(x2)); }
+
+        void Add(POV_ULONG key, const RGBTColour& colour);
+        bool Find(POV_ULONG key, RGBTColour& colour) const;
+};
+
 /**
  *  ViewData class representing holding view specific data.
  *  For private use by View and Renderer classes only!
@@ -119,6 +178,20 @@ class ViewData
          */
         bool GetNextRectangle(POVRect& rect, unsigned int& serial);
 
+        /**
+         *  Get the next sub-rectangle of the view to render (if any), preferring a particular one.
+         *  With the space-filling curve render patterns, each render thread is given consecutive
+         *  blocks along the curve for as long as possible, so that it keeps working in the same
+         *  part of the scene; otherwise, this is equivalent to the above.
+         *  @param  rect            Rectangle to render.
+         *  @param  serial          Rectangle serial number.
+         *  @param  affinity        Serial number of the rectangle preferably dispatched next, any value
+         *                          not denoting a rectangle if there is no preference. Updated to the
+         *                          rectangle following the one dispatched.
+         *  @return                 True if there is another rectangle to be dispatched, false otherwise.
+         */
+        bool GetNextRectangle(POVRect& rect, unsigned int& serial, unsigned int& affinity);
+
         /**
          *  Get the next sub-rectangle of the view to render (if any).
          *  This method is called by the render threads when they have
@@ -136,6 +209,171 @@ class ViewData
          */
         bool GetNextRectangle(POVRect& rect, unsigned int& serial, BlockInfo*& blockInfo, unsigned int stride);
 
+        /**
+         *  Record the cost of rendering a rectangle in the current pass.
+         *  Costs are accumulated per block; in subsequent passes, @ref GetNextRectangle(POVRect&, unsigned int&)
+         *  dispatches the blocks in order of decreasing cost, so that expensive blocks are started early
+         *  rather than holding up the end of the frame.
+         *  @param  serial          Serial number of the rectangle.
+         *  @param  cost            Cost of the rectangle, e.g. number of rays traced.
+         */
+        void AddRectangleCost(unsigned int serial, POV_ULONG cost);
+
+        /**
+         *  Running sample statistics of a pixel, retained across the passes of progressive sampling.
+         */
+        struct ProgressivePixel
+        {
+            RGBTColour colourSum;           ///< Sum of the samples.
+            RGBTColour mean;                ///< Mean of the gamma-encoded samples.
+            RGBTColour squaredDeviations;   ///< Sum of squared deviations of the gamma-encoded samples from their mean.
+            unsigned int samples;           ///< Number of samples taken so far.
+
+            ProgressivePixel() : samples(0) {}
+        };
+
+        /**
+         *  Get the running sample statistics of a pixel for progressive sampling.
+         *  A pixel may only be accessed by the render thread its rectangle has been dispatched to.
+         *  @param  x               Horizontal pixel position.
+         *  @param  y               Vertical pixel position.
+         *  @return                 Sample statistics of the pixel.
+         */
+        inline ProgressivePixel& GetProgressivePixel(unsigned int x, unsigned int y)
+        {
+            return progressivePixels[(y - renderArea.top) * renderArea.GetWidth() + (x - renderArea.left)];
+        }
+
+        /**
+         *  Get the number of samples to add to a pixel in the current pass of progressive sampling.
+         *  The first pass takes a few samples of every pixel; each subsequent pass doubles the
+         *  samples of those pixels whose estimated error is among the highest in the image.
+         *  @param  pixel           Sample statistics of the pixel.
+         *  @return                 Number of samples to take, zero if the pixel is to be left as is.
+         */
+        unsigned int GetProgressiveSamples(const ProgressivePixel& pixel) const;
+
+        /**
+         *  Get the number of the current pass of progressive sampling.
+         *  @return                 Pass number, starting at zero.
+         */
+        inline unsigned int GetProgressivePass() const { return progressivePass; }
+
+        /**
+         *  Determine whether the current pass of progressive sampling has any pixels to refine.
+         *  @return                 False if the noise budget has been met or refinement has been
+         *                          given up for another reason, true otherwise.
+         */
+        inline bool ProgressivePassPending() const { return !progressiveDone; }
+
+        /**
+         *  Determine whether the time limit for progressive sampling has passed.
+         *  @return                 True if refinement passes should end as soon as possible.
+         */
+        bool ProgressiveTimeExceeded() const;
+
+        /**
+         *  Set up the next pass of progressive sampling.
+         *  Estimates the error of each pixel from the statistics gathered so far, and decides
+         *  which pixels to refine, if the noise budget has not been met yet.
+         */
+        void PlanProgressivePass();
+
+        /**
+         *  Determine whether a time budget has been set for rendering this view.
+         *  @return                 True if the render is to finish within a time budget.
+         */
+        inline bool HasTimeBudget() const { return timeBudget > 0; }
+
+        /**
+         *  Determine whether the time budget for rendering this view has been used up.
+         *  @return                 True if a time budget has been set and used up.
+         */
+        bool TimeBudgetExceeded() const;
+
+        /**
+         *  Determine whether the share of the time budget for radiosity pretrace has been used up.
+         *  @return                 True if a time budget has been set and pretrace is to end.
+         */
+        bool PretraceTimeBudgetExceeded() const;
+
+        /**
+         *  Get the anti-aliasing depth that fits the time budget.
+         *  @return                 Maximum anti-aliasing depth to use.
+         */
+        inline unsigned int GetTimeBudgetAntialiasDepth() const { return timeBudgetAntialiasDepth; }
+
+        /**
+         *  Get the factor by which to scale radiosity sample rays to fit the time budget.
+         *  @return                 Scaling factor, between 0 and 1.
+         */
+        inline DBL GetTimeBudgetScale() const { return timeBudgetScale; }
+
+        /**
+         *  Determine whether area lights fit the time budget.
+         *  @return                 False if area lights are to be treated as point lights.
+         */
+        inline bool GetTimeBudgetAreaLights() const { return timeBudgetAreaLights; }
+
+        /**
+         *  Start measuring the time taken by the pass used to estimate the cost of the render.
+         */
+        void StartTimeBudgetProbe();
+
+        /**
+         *  Scale the render settings to fit the time budget.
+         *  The time taken by the preceding pass is extrapolated to the remaining passes, and the
+         *  anti-aliasing depth, radiosity sample rays and area lights are cut back as needed.
+         *  @param  previewSize     Size of the pixels traced in the preceding pass.
+         *  @param  tracingMethod   Anti-aliasing method of the final pass, or zero if none.
+         *  @param  aaDepth         Anti-aliasing depth requested.
+         */
+        void PlanTimeBudget(unsigned int previewSize, unsigned int tracingMethod, unsigned int aaDepth);
+
+        /**
+         *  Running sum of a pixel, retained across the passes of progressive photon mapping.
+         */
+        struct PhotonPassPixel
+        {
+            RGBTColour colourSum;           ///< Sum of the pixel over the passes completed so far.
+            RGBTColour colour;              ///< Most recent colour of the pixel in the current pass.
+            unsigned int pass;              ///< Pass in which the pixel was last rendered, or zero if none.
+            unsigned int passes;            ///< Number of passes in which the pixel has been rendered.
+
+            PhotonPassPixel() : pass(0), passes(0) {}
+        };
+
+        /**
+         *  Get the number of the current pass of progressive photon mapping.
+         *  @return                 Pass number, starting at one.
+         */
+        inline unsigned int GetPhotonPass() const { return photonPass; }
+
+        /**
+         *  Get the number of passes of progressive photon mapping.
+         *  @return                 Number of passes, one if photons are shot only once.
+         */
+        inline unsigned int GetPhotonPasses() const { return photonPasses; }
+
+        /**
+         *  Get the file the photon maps are loaded from or saved to.
+         *  This is either the one specified in the scene, or the one kept alongside the render state.
+         *  @return                 File name, or an empty string if none.
+         */
+        inline const string& GetPhotonFileName() const { return photonFileName; }
+
+        /**
+         *  Check whether the photon maps are loaded from file rather than shot.
+         *  @return                 True if the photon maps are to be loaded.
+         */
+        inline bool GetPhotonFileLoad() const { return photonFileLoad; }
+
+        /**
+         *  Set up the next pass of progressive photon mapping.
+         *  The photons of the previous pass are discarded, and the gather radii shrunk.
+         */
+        void StartPhotonPass();
+
         /**
          *  Called to (fully or partially) complete rendering of a specific sub-rectangle of the view.
          *  The pixel data is sent to the frontend and pixel progress information
@@ -270,6 +508,30 @@ class ViewData
          */
         RTRData *GetRTRData() { return rtrData; }
 
+        /**
+         *  Get the map recording the render cost of each pixel.
+         *  @return                 pointer to the cost map, or `nullptr` if not requested in render options
+         */
+        RenderCostMap *GetCostMap() { return costMap.get(); }
+
+        /**
+         *  Get the map recording the first surfaces hit in each pixel.
+         *  @return                 pointer to the feature map, or `nullptr` if denoising is not requested in render options
+         */
+        RenderFeatureMap *GetFeatureMap() { return featureMap.get(); }
+
+        /**
+         *  Get the precomputed primary rays.
+         *  @return                 pointer to the table, or `nullptr` if not used for this view
+         */
+        const CameraRayTable *GetCameraRayTable() const { return cameraRayTable.get(); }
+
+        /**
+         *  Get the store of samples to reuse.
+         *  @return                 pointer to the store, or `nullptr` if samples are not reused in this render
+         */
+        SampleStore *GetSampleStore() { return sampleStore.get(); }
+
     private:
 
         struct BlockPostponedEntry {
@@ -316,8 +578,63 @@ class ViewData
         BlockIdSet blockBusyList;
         /// list of blocks postponed for some reason
         BlockIdSet blockPostponedList;
+        /// Number of render threads; once no more than this many blocks remain to be dispatched,
+        /// each remaining block is split into smaller parts, so that idle threads can help finish
+        /// expensive blocks near the end of the frame. Zero if blocks are never to be split.
+        unsigned int blockSplitThreads;
+        /// parts of split blocks not yet dispatched, along with the serial number of their block
+        std::deque<std::pair<POVRect, unsigned int> > blockPartQueue;
+        /// number of parts of each split block not yet completed, by serial number of the block
+        std::map<unsigned int, unsigned int> blockPartsPending;
         /// list of additional block information
         vector<BlockInfo*> blockInfoList;
+        /// cost of each block accumulated over the passes so far, by serial number
+        vector<POV_ULONG> blockCostList;
+        /// serial numbers of the blocks in the order to dispatch them, or empty to follow the render pattern
+        vector<unsigned int> blockOrder;
+        /// whether each block has been dispatched in the current pass, by serial number;
+        /// empty unless dispatching blocks with per-thread affinity
+        vector<bool> blockDispatched;
+        /// number of blocks not yet dispatched in the current pass, when dispatching with per-thread affinity
+        unsigned int blocksUndispatched;
+        /// running sample statistics of each pixel in the render area, for progressive sampling
+        vector<ProgressivePixel> progressivePixels;
+        /// number of the current pass of progressive sampling
+        unsigned int progressivePass;
+        /// estimated error of a pixel from which on it is refined in the current pass of progressive sampling
+        DBL progressiveCutoff;
+        /// whether progressive sampling has met its noise budget or otherwise stopped refining
+        bool progressiveDone;
+        /// mean estimated pixel error at which progressive sampling stops refining
+        DBL progressiveThreshold;
+        /// factor converting a standard error into a confidence interval, for progressive sampling
+        DBL progressiveConfidenceFactor;
+        /// maximum number of samples per pixel for progressive sampling
+        unsigned int progressiveMaxSamples;
+        /// time in milliseconds after which progressive sampling stops refining, or zero for no limit
+        POV_LONG progressiveTimeLimit;
+        /// time in milliseconds within which the render is to finish, or zero for no limit
+        POV_LONG timeBudget;
+        /// time in milliseconds at which the pass used to estimate the cost of the render started
+        POV_LONG timeBudgetProbeStart;
+        /// maximum anti-aliasing depth fitting the time budget
+        unsigned int timeBudgetAntialiasDepth;
+        /// factor by which to scale radiosity sample rays to fit the time budget
+        DBL timeBudgetScale;
+        /// whether area lights fit the time budget
+        bool timeBudgetAreaLights;
+        /// number of the current pass of progressive photon mapping, starting at one
+        unsigned int photonPass;
+        /// number of passes of progressive photon mapping, one if photons are shot only once
+        unsigned int photonPasses;
+        /// running sum of each pixel in the render area, for progressive photon mapping
+        vector<PhotonPassPixel> photonPassPixels;
+        /// file the photon maps are loaded from or saved to, empty if none
+        string photonFileName;
+        /// whether the photon maps are loaded from file rather than shot
+        bool photonFileLoad;
+        /// timer measuring the time spent on the render
+        Timer renderTimer;
         /// area of view to be rendered
         POVRect renderArea;
         /// camera of this view
@@ -333,13 +650,45 @@ class ViewData
         bool realTimeRaytracing;
         /// data specifically associated with the RTR feature
         RTRData *rtrData;
+        /// render cost of each pixel, if requested
+        std::unique_ptr<RenderCostMap> costMap;
+        /// first surfaces hit in each pixel, if denoising is requested
+        std::unique_ptr<RenderFeatureMap> featureMap;
+        /// precomputed primary rays, if the scene asks for them and the camera benefits
+        std::unique_ptr<CameraRayTable> cameraRayTable;
+        /// samples kept for reuse by later passes or neighbouring blocks, if applicable
+        std::unique_ptr<SampleStore> sampleStore;
 
         /// functions to compute the X & Y block
         void getBlockXY(const unsigned int nb, unsigned int &x, unsigned int &y);
 
+        /// function to split a block into parts, queueing all but the first; returns the first part
+        void splitBlock(POVRect& rect, unsigned int serial, unsigned int remaining);
+
+        /// function to account for a completed part of a block; returns whether the whole block is complete
+        bool completedBlockPart(unsigned int serial);
+
+        /// function to estimate the error of a pixel from its progressive sampling statistics
+        DBL progressiveError(const ProgressivePixel& pixel) const;
+
+        /// function to add a pixel to the average over the passes of progressive photon mapping; returns the average
+        RGBTColour averagePhotonPasses(unsigned int x, unsigned int y, const RGBTColour& colour);
+
         /// pattern number to use for rendering
         unsigned int renderPattern;
 
+        /// block indices (y * blockWidth + x) in order along the space-filling curve render patterns
+        vector<unsigned int> blockPatternTable;
+
+        /// whether render threads are dispatched consecutive blocks along the render pattern
+        bool blockAffinity;
+
+        /// function to set up the order of blocks for the space-filling curve render patterns
+        void buildBlockPatternTable();
+
+        /// function to choose the next block when dispatching with per-thread affinity
+        unsigned int nextAffineBlock(unsigned int& affinity);
+
         /// adjusted step size for renderering (using clock arithmetic)
         unsigned int renderBlockStep;
 
@@ -481,6 +830,37 @@ class View
          */
         void SendStatistics(TaskQueue& taskq);
 
+        /**
+         *  Send the render cost of each pixel upon completion of a render, if it was recorded.
+         *  @param  taskq           The task queue that executed this method.
+         */
+        void SendCostMap(TaskQueue& taskq);
+
+        /**
+         *  Send the first surfaces hit in each pixel upon completion of a render, if they were recorded.
+         *  @param  taskq           The task queue that executed this method.
+         */
+        void SendFeatureMap(TaskQueue& taskq);
+
+        /**
+         *  Release the samples kept for reuse, once all render passes are finished.
+         *  @param  taskq           The task queue that executed this method.
+         */
+        void DiscardSampleStore(TaskQueue& taskq);
+
+        /**
+         *  Fill a stripe of the table of precomputed primary rays.
+         *  @param  firstRow        First row of the table to fill.
+         *  @param  endRow          Row of the table to stop before.
+         */
+        void FillCameraRayTable(unsigned int firstRow, unsigned int endRow);
+
+        /**
+         *  Write the event trace recorded since parsing started, if requested.
+         *  @param  taskq           The task queue that executed this method.
+         */
+        void WriteEventTrace(TaskQueue& taskq);
+
         /**
          *  Set the blocks not to generate with GetNextRectangle because they have
          *  already been rendered.
@@ -490,6 +870,40 @@ class View
          */
         void SetNextRectangle(TaskQueue& taskq, shared_ptr<ViewData::BlockIdSet> bsl, unsigned int fs);
 
+        /**
+         *  Set up the next pass of progressive sampling.
+         *  @param  taskq           The task queue that executed this method.
+         */
+        void PlanProgressivePass(TaskQueue& taskq);
+
+        /**
+         *  Start measuring the time taken by the pass used to estimate the cost of the render.
+         *  @param  taskq           The task queue that executed this method.
+         */
+        void StartTimeBudgetProbe(TaskQueue& taskq);
+
+        /**
+         *  Scale the render settings to fit the time budget.
+         *  @param  taskq           The task queue that executed this method.
+         *  @param  previewSize     Size of the pixels traced in the preceding pass.
+         *  @param  tracingMethod   Anti-aliasing method of the final pass, or zero if none.
+         *  @param  aaDepth         Anti-aliasing depth requested.
+         */
+        void PlanTimeBudget(TaskQueue& taskq, unsigned int previewSize, unsigned int tracingMethod, unsigned int aaDepth);
+
+        /**
+         *  Set up the next pass of progressive photon mapping.
+         *  @param  taskq           The task queue that executed this method.
+         */
+        void StartPhotonPass(TaskQueue& taskq);
+
+        /**
+         *  Append the tasks shooting photons and building the photon maps from them.
+         *  @param  maxRenderThreads    Number of render threads.
+         *  @param  seed                Seed for the stochastic random number generators.
+         */
+        void AppendPhotonShootingTasks(int maxRenderThreads, size_t seed);
+
         /**
          *  Thread controlling the render task queue.
          */
@@ -0,0 +1,251 @@
+//******************************************************************************
+///
+/// @file backend/support/eventtrace.cpp
+///
+/// Recording of a timeline of tasks, render phases and blocks.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+// frame.h must always be the first POV file included (pulls in platform config)
+#include "backend/frame.h"
+#include "backend/support/eventtrace.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+namespace
+{
+
+/// lock waits shorter than this many microseconds are not recorded
+const POV_LONG kMinLockWait = 20;
+
+/// thread id of the pseudo-thread phases are recorded on
+const unsigned int kPhaseThreadId = 0;
+
+struct TraceEvent
+{
+    const char *name;
+    const char *category;
+    POV_LONG start;
+    POV_LONG end;
+    int arg;
+
+    TraceEvent(const char *n, const char *c, POV_LONG s, POV_LONG e, int a) :
+        name(n), category(c), start(s), end(e), arg(a) {}
+};
+
+/// Events of a single thread.
+///
+/// Buffers are only ever appended to by their own thread, but are read (and cleared) by whichever
+/// thread writes (or restarts) the trace, hence each buffer has a mutex of its own.
+///
+struct ThreadBuffer
+{
+    boost::mutex mutex;
+    std::vector<TraceEvent> events;
+    unsigned int threadId;
+    TraceEvent open;
+    bool isOpen;
+
+    ThreadBuffer(unsigned int tid) : threadId(tid), open(nullptr, nullptr, 0, 0, -1), isOpen(false) {}
+};
+
+std::atomic<bool> gEnabled(false);
+/// time recording was started, in nanoseconds of the steady clock
+std::atomic<POV_LONG> gEpoch(0);
+
+/// protects @ref gBuffers
+boost::mutex gBuffersMutex;
+/// buffers of all threads that have recorded any events, indexed by thread id
+std::vector<shared_ptr<ThreadBuffer> > gBuffers;
+
+thread_local shared_ptr<ThreadBuffer> tThreadBuffer;
+
+/// Get the buffer of the phase track; must be called with @ref gBuffersMutex held.
+ThreadBuffer& GetPhaseBuffer()
+{
+    if (gBuffers.empty())
+        gBuffers.push_back(std::make_shared<ThreadBuffer>(kPhaseThreadId));
+    return *gBuffers[kPhaseThreadId];
+}
+
+ThreadBuffer& GetThreadBuffer()
+{
+    if (tThreadBuffer == nullptr)
+    {
+        boost::mutex::scoped_lock lock(gBuffersMutex);
+        (void)GetPhaseBuffer();
+        tThreadBuffer = std::make_shared<ThreadBuffer>(gBuffers.size());
+        gBuffers.push_back(tThreadBuffer);
+    }
+    return *tThreadBuffer;
+}
+
+void AddEvent(ThreadBuffer& buffer, const TraceEvent& event)
+{
+    boost::mutex::scoped_lock lock(buffer.mutex);
+    buffer.events.push_back(event);
+}
+
+POV_LONG SteadyNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
+
+void EventTrace::Start()
+{
+    gEnabled = false;
+
+    {
+        boost::mutex::scoped_lock lock(gBuffersMutex);
+        for (std::vector<shared_ptr<ThreadBuffer> >::iterator i = gBuffers.begin(); i != gBuffers.end(); ++i)
+        {
+            boost::mutex::scoped_lock bufferLock((*i)->mutex);
+            (*i)->events.clear();
+            (*i)->isOpen = false;
+        }
+    }
+
+    gEpoch = SteadyNanoseconds();
+    gEnabled = true;
+}
+
+void EventTrace::Stop()
+{
+    gEnabled = false;
+}
+
+bool EventTrace::IsEnabled()
+{
+    return gEnabled;
+}
+
+POV_LONG EventTrace::Now()
+{
+    return (SteadyNanoseconds() - gEpoch) / 1000;
+}
+
+void EventTrace::Record(const char *name, const char *category, POV_LONG start, POV_LONG end, int arg)
+{
+    if (!gEnabled)
+        return;
+    AddEvent(GetThreadBuffer(), TraceEvent(name, category, start, end, arg));
+}
+
+void EventTrace::RecordPhase(const char *name, POV_LONG start, POV_LONG end)
+{
+    if (!gEnabled)
+        return;
+    boost::mutex::scoped_lock lock(gBuffersMutex);
+    AddEvent(GetPhaseBuffer(), TraceEvent(name, "phase", start, end, -1));
+}
+
+void EventTrace::RecordWait(const char *name, POV_LONG start, POV_LONG end)
+{
+    if (end - start < kMinLockWait)
+        return;
+    Record(name, "lock", start, end);
+}
+
+void EventTrace::Begin(const char *name, const char *category, int arg)
+{
+    if (!gEnabled)
+        return;
+    ThreadBuffer& buffer(GetThreadBuffer());
+    POV_LONG now = Now();
+    boost::mutex::scoped_lock lock(buffer.mutex);
+    if (buffer.isOpen)
+    {
+        buffer.open.end = now;
+        buffer.events.push_back(buffer.open);
+    }
+    buffer.open = TraceEvent(name, category, now, now, arg);
+    buffer.isOpen = true;
+}
+
+void EventTrace::End()
+{
+    if (!gEnabled)
+        return;
+    ThreadBuffer& buffer(GetThreadBuffer());
+    POV_LONG now = Now();
+    boost::mutex::scoped_lock lock(buffer.mutex);
+    if (buffer.isOpen)
+    {
+        buffer.open.end = now;
+        buffer.events.push_back(buffer.open);
+        buffer.isOpen = false;
+    }
+}
+
+void EventTrace::Write(OStream& stream)
+{
+    boost::mutex::scoped_lock lock(gBuffersMutex);
+
+    stream.printf("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    stream.printf("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"POV-Ray\"}}",
+                  kPhaseThreadId);
+
+    for (std::vector<shared_ptr<ThreadBuffer> >::iterator i = gBuffers.begin(); i != gBuffers.end(); ++i)
+    {
+        boost::mutex::scoped_lock bufferLock((*i)->mutex);
+        unsigned int tid = (*i)->threadId;
+
+        if (tid == kPhaseThreadId)
+            stream.printf(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Phases\"}}", tid);
+        else
+            stream.printf(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}", tid, tid);
+
+        // names and categories are string literals known not to require escaping
+        for (std::vector<TraceEvent>::const_iterator e = (*i)->events.begin(); e != (*i)->events.end(); ++e)
+        {
+            stream.printf(",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%lld,\"dur\":%lld",
+                          e->name, e->category, tid, (long long)e->start, (long long)(e->end - e->start));
+            if (e->arg >= 0)
+                stream.printf(",\"args\":{\"id\":%d}", e->arg);
+            stream.printf("}");
+        }
+    }
+
+    stream.printf("\n]}\n");
+}
+
+}
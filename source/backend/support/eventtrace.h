@@ -0,0 +1,147 @@
+//******************************************************************************
+///
+/// @file backend/support/eventtrace.h
+///
+/// Recording of a timeline of tasks, render phases and blocks.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_BACKEND_EVENTTRACE_H
+#define POVRAY_BACKEND_EVENTTRACE_H
+
+#include <boost/thread.hpp>
+
+#include "backend/frame.h"
+
+#include "base/fileinputoutput.h"
+
+namespace pov
+{
+
+using namespace pov_base;
+
+/// Process-wide recorder of a timeline of events, written in the Chrome trace event format.
+///
+/// While enabled, the recorder collects the time spans of tasks, render phases, image blocks and
+/// noticeable lock waits, each on a per-thread buffer, so that recording does not serialise the
+/// threads being recorded. The resulting file can be loaded into `chrome://tracing` or Perfetto
+/// to see which threads were busy, idle or waiting at any given time.
+///
+/// @note   When disabled, each recording call costs a single flag test.
+///
+class EventTrace final
+{
+    public:
+
+        /// Time span of the current thread, recorded when the object goes out of scope.
+        class Scope final
+        {
+            public:
+                Scope(const char *name, const char *category) :
+                    name(name), category(category), start(EventTrace::IsEnabled() ? EventTrace::Now() : -1) {}
+                ~Scope() { if (start >= 0) EventTrace::Record(name, category, start, EventTrace::Now()); }
+            private:
+                const char *name;
+                const char *category;
+                POV_LONG start;
+
+                /// not available
+                Scope(const Scope&);
+                /// not available
+                Scope& operator=(const Scope&);
+        };
+
+        /// Acquire a mutex, recording the time spent waiting for it if noticeable.
+        template<typename MUTEX_T>
+        class ScopedLock final
+        {
+            public:
+                ScopedLock(MUTEX_T& m, const char *name) : lock(m, boost::defer_lock)
+                {
+                    if (EventTrace::IsEnabled() && !lock.try_lock())
+                    {
+                        POV_LONG start = EventTrace::Now();
+                        lock.lock();
+                        EventTrace::RecordWait(name, start, EventTrace::Now());
+                    }
+                    else if (!lock.owns_lock())
+                        lock.lock();
+                }
+            private:
+                boost::unique_lock<MUTEX_T> lock;
+
+                /// not available
+                ScopedLock(const ScopedLock&);
+                /// not available
+                ScopedLock& operator=(const ScopedLock&);
+        };
+
+        /// Discard any events recorded so far and start recording.
+        static void Start();
+
+        /// Stop recording, keeping the events recorded so far.
+        static void Stop();
+
+        static bool IsEnabled();
+
+        /// Time elapsed since recording was started, in microseconds.
+        static POV_LONG Now();
+
+        /// Record a completed time span of the current thread.
+        static void Record(const char *name, const char *category, POV_LONG start, POV_LONG end, int arg = -1);
+
+        /// Record a completed time span of the process as a whole, shown on a track of its own.
+        static void RecordPhase(const char *name, POV_LONG start, POV_LONG end);
+
+        /// Record a lock wait of the current thread, unless too short to be of interest.
+        static void RecordWait(const char *name, POV_LONG start, POV_LONG end);
+
+        /// Open a time span of the current thread, closing any span opened before.
+        ///
+        /// This is intended for spans whose begin and end are not within the same scope, such
+        /// as the rendering of an image block; the span is recorded when @ref End() is called.
+        ///
+        static void Begin(const char *name, const char *category, int arg = -1);
+
+        /// Close the time span of the current thread opened by @ref Begin(), if any.
+        static void End();
+
+        /// Write all events recorded so far to a stream.
+        static void Write(OStream& stream);
+
+    private:
+
+        /// not available
+        EventTrace();
+};
+
+}
+
+#endif // POVRAY_BACKEND_EVENTTRACE_H
@@ -34,6 +34,8 @@
 //******************************************************************************
 
 #include <cassert>
+#include <deque>
+#include <vector>
 #include <stdexcept>
 
 #include <boost/bind.hpp>
@@ -48,6 +50,7 @@
 
 #include "backend/control/messagefactory.h"
 #include "backend/scene/backendscenedata.h"
+#include "backend/support/eventtrace.h"
 
 // this must be the last file included
 #include "base/povdebug.h"
@@ -57,19 +60,24 @@ namespace pov
 
 using namespace pov_base;
 
-Task::Task(ThreadData *td, const boost::function1<void, Exception&>& f) :
+Task::Task(ThreadData *td, const boost::function1<void, Exception&>& f, const char *n) :
     taskData(td),
+    name(n),
     fatalErrorHandler(f),
-    stopRequested(false),
-    paused(false),
+    control(0),
     done(false),
     failed(kNoError),
     timer(nullptr),
     realTime(-1),
     cpuTime(-1),
-    taskThread(nullptr),
-    povmsContext(nullptr)
+    started(false),
+    active(false),
+    povmsContext(nullptr),
+    affinity(-1)
 {
+    for (int i = 0; i < kHardwareCounterCount; ++i)
+        hardwareCounts[i] = -1;
+
     if (td == nullptr)
         throw POV_EXCEPTION_STRING("Internal error: TaskData is NULL in Task constructor");
 }
@@ -100,37 +108,69 @@ POV_LONG Task::ConsumedCPUTime() const
     return cpuTime;
 }
 
+void Task::ConsumedHardwareCounts(POV_LONG counts[kHardwareCounterCount]) const
+{
+    for (int i = 0; i < kHardwareCounterCount; ++i)
+        counts[i] = hardwareCounts[i];
+}
+
 void Task::Start(const boost::function0<void>& completion)
 {
-    if ((done == false) && (taskThread == nullptr))
-        taskThread = NewBoostThread(boost::bind(&Task::TaskThread, this, completion), POV_THREAD_STACK_SIZE);
+    if ((done == false) && (started == false))
+    {
+        started = true;
+        {
+            boost::mutex::scoped_lock lock(activeMutex);
+            active = true;
+        }
+        TaskWorkerPool::Submit(boost::bind(&Task::WorkerJob, this, completion));
+    }
 }
 
 void Task::RequestStop()
 {
-    stopRequested = true;
+    boost::mutex::scoped_lock lock(controlMutex);
+    control |= kStopRequested;
+    controlCondition.notify_all();
 }
 
 void Task::Stop()
 {
-    stopRequested = true;
+    RequestStop();
 
-    if (taskThread != nullptr)
+    if (started == true)
     {
-        taskThread->join();
-        delete taskThread;
-        taskThread = nullptr;
+        boost::mutex::scoped_lock lock(activeMutex);
+        while (active == true)
+            activeCondition.wait(lock);
+        started = false;
     }
 }
 
 void Task::Pause()
 {
-    paused = true;
+    boost::mutex::scoped_lock lock(controlMutex);
+    control |= kPaused;
 }
 
 void Task::Resume()
 {
-    paused = false;
+    boost::mutex::scoped_lock lock(controlMutex);
+    control &= ~kPaused;
+    controlCondition.notify_all();
+}
+
+void Task::CooperateRequested()
+{
+    if ((control & kStopRequested) != 0)
+        throw StopThreadException();
+
+    boost::mutex::scoped_lock lock(controlMutex);
+    while (control == kPaused)
+        controlCondition.wait(lock);
+
+    if ((control & kStopRequested) != 0)
+        throw StopThreadException();
 }
 
 POV_LONG Task::ElapsedRealTime() const
@@ -157,14 +197,19 @@ void Task::TaskThread(const boost::function0<void>& completion)
         return;
     }
 
+    if (affinity >= 0)
+        BindToCPU(affinity);
+
     Initialize();
 
     Timer tasktime;
+    HardwareCounters taskcounters;
 
     timer = &tasktime;
 
     try
     {
+        EventTrace::Scope traceScope(name, "task");
         Run();
     }
     catch(StopThreadException&)
@@ -222,6 +267,8 @@ void Task::TaskThread(const boost::function0<void>& completion)
         cpuTime = tasktime.ElapsedThreadCPUTime();
     else
         cpuTime = -1;
+    for (int i = 0; i < kHardwareCounterCount; ++i)
+        hardwareCounts[i] = taskcounters.Elapsed(HardwareCounter(i));
 
     try
     {
@@ -245,11 +292,25 @@ void Task::TaskThread(const boost::function0<void>& completion)
 
     Cleanup();
 
+    // the thread is returned to the worker pool, so don't leave it bound
+    if (affinity >= 0)
+        BindToCPU(-1);
+
     (void)POVMS_CloseContext(povmsContext);
 
     completion();
 }
 
+void Task::WorkerJob(const boost::function0<void>& completion)
+{
+    TaskThread(completion);
+
+    // after this point the task may be destroyed at any time
+    boost::mutex::scoped_lock lock(activeMutex);
+    active = false;
+    activeCondition.notify_all();
+}
+
 
 #if POV_USE_DEFAULT_TASK_INITIALIZE
 
@@ -269,9 +330,94 @@ void Task::Cleanup ()
 
 #endif // POV_USE_DEFAULT_TASK_CLEANUP
 
+#if POV_USE_DEFAULT_TASK_AFFINITY
+
+void Task::BindToCPU (int)
+{
+    // not supported on this platform
+}
+
+#endif // POV_USE_DEFAULT_TASK_AFFINITY
+
+
+namespace
+{
+
+/// protects all of the worker pool state below
+boost::mutex gWorkerPoolMutex;
+/// signalled when a job is submitted or the pool is shut down
+boost::condition_variable gWorkerPoolCondition;
+/// jobs waiting for a worker
+std::deque<boost::function0<void> > gWorkerPoolJobs;
+/// all worker threads spawned so far
+std::vector<boost::thread*> gWorkerPoolThreads;
+/// number of workers waiting for a job
+size_t gWorkerPoolIdle = 0;
+/// set while the workers are being shut down
+bool gWorkerPoolShutdown = false;
+
+}
+
+void TaskWorkerPool::Submit(const boost::function0<void>& job)
+{
+    boost::mutex::scoped_lock lock(gWorkerPoolMutex);
+
+    gWorkerPoolJobs.push_back(job);
+
+    if (gWorkerPoolJobs.size() > gWorkerPoolIdle)
+        gWorkerPoolThreads.push_back(Task::NewBoostThread(&TaskWorkerPool::WorkerThread, POV_THREAD_STACK_SIZE));
+    else
+        gWorkerPoolCondition.notify_one();
+}
+
+void TaskWorkerPool::Shutdown()
+{
+    {
+        boost::mutex::scoped_lock lock(gWorkerPoolMutex);
+        gWorkerPoolShutdown = true;
+        gWorkerPoolCondition.notify_all();
+    }
+
+    // no new workers can be spawned now, as no task is active that could submit a job
+    for (std::vector<boost::thread*>::iterator i = gWorkerPoolThreads.begin(); i != gWorkerPoolThreads.end(); ++i)
+    {
+        (*i)->join();
+        delete *i;
+    }
+    gWorkerPoolThreads.clear();
+
+    boost::mutex::scoped_lock lock(gWorkerPoolMutex);
+    gWorkerPoolShutdown = false;
+}
+
+void TaskWorkerPool::WorkerThread()
+{
+    for (;;)
+    {
+        boost::function0<void> job;
+
+        {
+            boost::mutex::scoped_lock lock(gWorkerPoolMutex);
+
+            gWorkerPoolIdle++;
+            while (gWorkerPoolJobs.empty() && !gWorkerPoolShutdown)
+                gWorkerPoolCondition.wait(lock);
+            gWorkerPoolIdle--;
+
+            if (gWorkerPoolJobs.empty())
+                return;
+
+            job = gWorkerPoolJobs.front();
+            gWorkerPoolJobs.pop_front();
+        }
+
+        job();
+    }
+}
+
 
 SceneTask::SceneTask(ThreadData *td, const boost::function1<void, Exception&>& f, const char* sn, shared_ptr<BackendSceneData> sd, RenderBackend::ViewId vid) :
-    Task(td, f),
+    Task(td, f, sn),
     messageFactory(sd->warningLevel, sn, sd->backendAddress, sd->frontendAddress, sd->sceneId, vid)
 {}
 
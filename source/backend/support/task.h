@@ -36,6 +36,7 @@
 #ifndef POVRAY_BACKEND_TASK_H
 #define POVRAY_BACKEND_TASK_H
 
+#include <atomic>
 #include <queue>
 #include <vector>
 
@@ -60,11 +61,11 @@ class Task
 {
     public:
 
-        Task(ThreadData *td, const boost::function1<void, Exception&>& f);
+        Task(ThreadData *td, const boost::function1<void, Exception&>& f, const char *n = "Task");
         virtual ~Task();
 
-        inline bool IsPaused() { return !done && paused; }
-        inline bool IsRunning() { return !done && !paused && !stopRequested && (taskThread != nullptr); }
+        inline bool IsPaused() { return !done && ((control & kPaused) != 0); }
+        inline bool IsRunning() { return !done && (control == 0) && started; }
         inline bool IsDone() { return done; }
         inline bool Failed() { return done && (failed != kNoError); }
 
@@ -73,30 +74,40 @@ class Task
         POV_LONG ConsumedRealTime() const;
         POV_LONG ConsumedCPUTime() const;
 
+        /// Report the hardware performance counters sampled while the task ran.
+        ///
+        /// @param[out] counts  Count of each @ref HardwareCounter, or -1 if not supported.
+        ///
+        void ConsumedHardwareCounts(POV_LONG counts[kHardwareCounterCount]) const;
+
+        /// Bind the task's thread to a CPU while the task runs, or not (-1, the default).
+        ///
+        /// @note   This must be set before @ref Start() is called.
+        ///
+        inline void SetAffinity(int cpu) { affinity = cpu; }
+
         void Start(const boost::function0<void>& completion);
         void RequestStop();
         void Stop();
         void Pause();
         void Resume();
 
+        /// Stop or pause the task here if requested.
+        ///
+        /// Unless either is requested, this costs a single atomic load, so it is cheap enough to
+        /// call often. A paused task sleeps until it is resumed or stopped.
+        ///
         inline void Cooperate()
         {
-            if(stopRequested == true)
-                throw StopThreadException();
-            else if(paused == true)
-            {
-                while(paused == true)
-                {
-                    boost::thread::yield();
-                    Delay(100);
-                    if(stopRequested == true)
-                        throw StopThreadException();
-                }
-            }
+            if(control.load(std::memory_order_relaxed) != 0)
+                CooperateRequested();
         }
 
         inline ThreadData *GetDataPtr() { return taskData; }
 
+        /// Name of the task, as shown in event traces.
+        inline const char *GetName() const { return name; }
+
         inline POVMSContext GetPOVMSContext() { return povmsContext; }
 
         /// Start a new thread with a given stack size.
@@ -132,12 +143,23 @@ class Task
 
         /// task data pointer
         ThreadData *taskData;
+        /// task name; must be a string literal
+        const char *name;
         /// task fatal error handler
         boost::function1<void, Exception&> fatalErrorHandler;
-        /// stop request flag
-        volatile bool stopRequested;
-        /// paused flag
-        volatile bool paused;
+        /// flags of @ref control
+        enum
+        {
+            kStopRequested  = 1,
+            kPaused         = 2,
+        };
+
+        /// stop request and paused flags
+        std::atomic<unsigned int> control;
+        /// protects changes to @ref control, so that @ref controlCondition is not missed
+        boost::mutex controlMutex;
+        /// signalled when the task is resumed or asked to stop
+        boost::condition_variable controlCondition;
         /// done flag
         volatile bool done;
         /// failed code
@@ -148,10 +170,20 @@ class Task
         POV_LONG realTime;
         // CPU time spend in task
         POV_LONG cpuTime;
-        /// task thread
-        boost::thread *taskThread;
+        // hardware performance counts of task, or -1 each
+        POV_LONG hardwareCounts[kHardwareCounterCount];
+        /// set by Start() until the task has been stopped
+        volatile bool started;
+        /// set while the task is queued on or running in the worker pool
+        bool active;
+        /// protects @ref active
+        boost::mutex activeMutex;
+        /// signalled when the worker pool is done with the task
+        boost::condition_variable activeCondition;
         /// POVMS message receiving context
         POVMSContext povmsContext;
+        /// CPU to bind the thread to while running, or -1
+        int affinity;
 
         inline void FatalErrorHandler(const Exception& e)
         {
@@ -170,9 +202,15 @@ class Task
         /// not available
         Task& operator=(const Task&);
 
+        /// Called by @ref Cooperate() if a stop or pause has been requested.
+        void CooperateRequested();
+
         /// Execute the thread.
         void TaskThread(const boost::function0<void>& completion);
 
+        /// Job handed to the worker pool; runs @ref TaskThread() and signals @ref Stop().
+        void WorkerJob(const boost::function0<void>& completion);
+
         /// Called by @ref TaskThread() before Run() is invoked.
         ///
         /// This method is intended as a hook to inject platform-specific thread initialization code, to be run by every
@@ -188,6 +226,41 @@ class Task
         /// knock out the default implementation and provide a platform-specific implementation somewhere else.
         ///
         void Cleanup();
+
+        /// Called by @ref TaskThread() before Initialize() to bind the thread to a CPU, and with -1 after Cleanup()
+        /// to release it again, if the task has been assigned a CPU.
+        ///
+        /// Binding a thread makes the OS keep it on one core, and (on NUMA systems) makes the memory it first
+        /// touches local to that core's node. To make use of this mechanism, set @ref POV_USE_DEFAULT_TASK_AFFINITY
+        /// to zero to knock out the default implementation, which does nothing, and provide a platform-specific
+        /// implementation somewhere else.
+        ///
+        void BindToCPU(int cpu);
+};
+
+
+/// Process-wide pool of persistent worker threads that @ref Task instances are run on.
+///
+/// Threads are spawned on demand whenever a job is submitted and no worker is idle, so
+/// tasks that need to run concurrently never starve each other; idle workers are kept
+/// around for later render passes, views and frames instead of being joined.
+///
+class TaskWorkerPool
+{
+    public:
+
+        /// Run a job on an idle worker thread, spawning a new one if necessary.
+        static void Submit(const boost::function0<void>& job);
+
+        /// Join all worker threads; must only be called when no task is active.
+        static void Shutdown();
+
+    private:
+
+        static void WorkerThread();
+
+        /// not available
+        TaskWorkerPool();
 };
 
 
@@ -33,6 +33,8 @@
 ///
 //******************************************************************************
 
+#include <algorithm>
+
 #include <boost/thread.hpp>
 #include <boost/bind.hpp>
 
@@ -40,6 +42,7 @@
 #include "backend/frame.h"
 #include "backend/support/taskqueue.h"
 
+#include "backend/support/eventtrace.h"
 #include "backend/support/task.h"
 
 // this must be the last file included
@@ -50,7 +53,19 @@ namespace pov
 
 using boost::recursive_mutex;
 
-TaskQueue::TaskQueue() : failed(kNoError)
+namespace
+{
+
+/// protects the fair share state below
+boost::mutex gFairShareMutex;
+/// number of admitted tasks of all sharing queues that have not finished yet
+unsigned int gFairShareRunning = 0;
+/// sharing queues waiting for threads, in order of arrival
+std::deque<TaskQueue *> gFairShareWaiting;
+
+}
+
+TaskQueue::TaskQueue() : failed(kNoError), affinity(false), nextCPU(0), fairShare(false), admittedTasks(0), phaseName(nullptr), phaseStart(0)
 {
 }
 
@@ -74,9 +89,21 @@ void TaskQueue::Stop()
     for(list<TaskEntry>::iterator i(activeTasks.begin()); i != activeTasks.end(); i++)
         i->GetTask()->Stop();
 
+    // jobs are short and can't be cancelled, so just let them finish
+    try { activeJobs.Wait(); } catch(...) { }
+
+    unsigned int released = admittedTasks;
+    for(list<TaskEntry>::iterator i(activeTasks.begin()); i != activeTasks.end(); i++)
+    {
+        if(i->IsAdmitted())
+            released++;
+    }
+    ReleaseTasks(released, true);
+    admittedTasks = 0;
+
     activeTasks.clear();
     while(queuedTasks.empty() == false)
-        queuedTasks.pop();
+        queuedTasks.pop_front();
 
     Notify();
 }
@@ -113,7 +140,7 @@ bool TaskQueue::IsRunning()
 {
     boost::recursive_mutex::scoped_lock lock(queueMutex);
 
-    bool running = !queuedTasks.empty();
+    bool running = !queuedTasks.empty() || !activeJobs.IsDone();
 
     for(list<TaskEntry>::iterator i(activeTasks.begin()); i != activeTasks.end(); i++)
         running = running || i->GetTask()->IsRunning();
@@ -125,7 +152,7 @@ bool TaskQueue::IsDone()
 {
     boost::recursive_mutex::scoped_lock lock(queueMutex);
 
-    bool done = queuedTasks.empty();
+    bool done = queuedTasks.empty() && activeJobs.IsDone();
 
     for(list<TaskEntry>::iterator i(activeTasks.begin()); i != activeTasks.end(); i++)
         done = done && i->GetTask()->IsDone();
@@ -150,13 +177,13 @@ int TaskQueue::FailureCode(int defval)
         return failed;
 }
 
-ThreadData *TaskQueue::AppendTask(Task *task)
+ThreadData *TaskQueue::AppendTask(Task *task, bool detached)
 {
     boost::recursive_mutex::scoped_lock lock(queueMutex);
 
     failed = false;
 
-    queuedTasks.push(TaskEntry(shared_ptr<Task>(task)));
+    queuedTasks.push_back(TaskEntry(shared_ptr<Task>(task), detached));
 
     Notify();
 
@@ -167,7 +194,16 @@ void TaskQueue::AppendSync()
 {
     boost::recursive_mutex::scoped_lock lock(queueMutex);
 
-    queuedTasks.push(TaskEntry::kSync);
+    queuedTasks.push_back(TaskEntry::kSync);
+
+    Notify();
+}
+
+void TaskQueue::AppendJoin()
+{
+    boost::recursive_mutex::scoped_lock lock(queueMutex);
+
+    queuedTasks.push_back(TaskEntry::kJoin);
 
     Notify();
 }
@@ -176,7 +212,7 @@ void TaskQueue::AppendMessage(POVMS_Message& msg)
 {
     boost::recursive_mutex::scoped_lock lock(queueMutex);
 
-    queuedTasks.push(TaskEntry(msg));
+    queuedTasks.push_back(TaskEntry(msg));
 
     Notify();
 }
@@ -185,7 +221,18 @@ void TaskQueue::AppendFunction(const boost::function1<void, TaskQueue&>& fn)
 {
     boost::recursive_mutex::scoped_lock lock(queueMutex);
 
-    queuedTasks.push(TaskEntry(fn));
+    queuedTasks.push_back(TaskEntry(fn));
+
+    Notify();
+}
+
+void TaskQueue::AppendJob(const boost::function0<void>& job)
+{
+    boost::recursive_mutex::scoped_lock lock(queueMutex);
+
+    failed = false;
+
+    queuedTasks.push_back(TaskEntry(job));
 
     Notify();
 }
@@ -194,6 +241,8 @@ bool TaskQueue::Process()
 {
     boost::recursive_mutex::scoped_lock lock(queueMutex);
 
+    unsigned int released = 0;
+
     for(list<TaskEntry>::iterator i(activeTasks.begin()); i != activeTasks.end();)
     {
         if(failed == kNoError)
@@ -201,6 +250,8 @@ bool TaskQueue::Process()
 
         if(i->GetTask()->IsDone() == true)
         {
+            if(i->IsAdmitted())
+                released++;
             list<TaskEntry>::iterator e(i);
             i++;
             activeTasks.erase(e);
@@ -209,6 +260,17 @@ bool TaskQueue::Process()
             i++;
     }
 
+    if(released > 0)
+        ReleaseTasks(released, false);
+
+    // errors of jobs are collected once all of them have finished
+    if((failed == kNoError) && activeJobs.IsDone())
+    {
+        try { activeJobs.Wait(); }
+        catch(pov_base::Exception& e) { failed = e.code(kUncategorizedError); }
+        catch(...) { failed = kUncategorizedError; }
+    }
+
     if(failed != kNoError)
     {
         Stop();
@@ -221,15 +283,41 @@ bool TaskQueue::Process()
         {
             case TaskEntry::kTask:
             {
+                if((fairShare == true) && (queuedTasks.front().IsDetached() == false))
+                {
+                    if((admittedTasks == 0) && (AdmitBatch() == false))
+                        return false;
+                    queuedTasks.front().SetAdmitted();
+                    admittedTasks--;
+                }
+                // a phase spans from its first task to the sync or join waiting for it
+                if((phaseName == nullptr) && (queuedTasks.front().IsDetached() == false) && EventTrace::IsEnabled())
+                {
+                    phaseName = queuedTasks.front().GetTask()->GetName();
+                    phaseStart = EventTrace::Now();
+                }
                 activeTasks.push_back(queuedTasks.front());
+                if((affinity == true) && (queuedTasks.front().IsDetached() == false))
+                    queuedTasks.front().GetTask()->SetAffinity(nextCPU++ % max(1u, boost::thread::hardware_concurrency()));
                 queuedTasks.front().GetTask()->Start(boost::bind(&TaskQueue::Notify, this));
-                queuedTasks.pop();
+                queuedTasks.pop_front();
                 break;
             }
             case TaskEntry::kSync:
+            case TaskEntry::kJoin:
             {
-                if(activeTasks.empty() == true)
-                    queuedTasks.pop();
+                bool join = (queuedTasks.front().GetEntryType() == TaskEntry::kJoin);
+
+                if((HasActiveTasks(join) == false) && (activeJobs.IsDone() == true))
+                {
+                    queuedTasks.pop_front();
+                    nextCPU = 0;
+                    if(phaseName != nullptr)
+                    {
+                        EventTrace::RecordPhase(phaseName, phaseStart, EventTrace::Now());
+                        phaseName = nullptr;
+                    }
+                }
                 else
                     return false;
                 break;
@@ -237,13 +325,19 @@ bool TaskQueue::Process()
             case TaskEntry::kMessage:
             {
                 try { POVMS_SendMessage(queuedTasks.front().GetMessage()); } catch(pov_base::Exception&) { }
-                queuedTasks.pop();
+                queuedTasks.pop_front();
                 break;
             }
             case TaskEntry::kFunction:
             {
                 try { queuedTasks.front().GetFunction()(*this); } catch(pov_base::Exception&) { }
-                queuedTasks.pop();
+                queuedTasks.pop_front();
+                break;
+            }
+            case TaskEntry::kJob:
+            {
+                activeJobs.Run(boost::bind(&TaskQueue::RunJob, this, queuedTasks.front().GetJob()));
+                queuedTasks.pop_front();
                 break;
             }
         }
@@ -260,4 +354,92 @@ void TaskQueue::Notify()
     processCondition.notify_one();
 }
 
+bool TaskQueue::HasActiveTasks(bool includeDetached)
+{
+    for(list<TaskEntry>::iterator i(activeTasks.begin()); i != activeTasks.end(); i++)
+    {
+        if(includeDetached || !i->IsDetached())
+            return true;
+    }
+
+    return false;
+}
+
+bool TaskQueue::AdmitBatch()
+{
+    unsigned int batch = 0;
+
+    for(std::deque<TaskEntry>::iterator i(queuedTasks.begin()); i != queuedTasks.end(); i++)
+    {
+        if(i->GetEntryType() != TaskEntry::kTask)
+            break;
+        if(i->IsDetached() == false)
+            batch++;
+    }
+
+    boost::mutex::scoped_lock lock(gFairShareMutex);
+
+    std::deque<TaskQueue *>::iterator self(std::find(gFairShareWaiting.begin(), gFairShareWaiting.end(), this));
+    if(self == gFairShareWaiting.end())
+        self = gFairShareWaiting.insert(gFairShareWaiting.end(), this);
+
+    // first come, first served; a batch larger than the machine runs on its own
+    if((self != gFairShareWaiting.begin()) ||
+       ((gFairShareRunning > 0) && (gFairShareRunning + batch > max(1u, boost::thread::hardware_concurrency()))))
+        return false;
+
+    gFairShareWaiting.pop_front();
+    gFairShareRunning += batch;
+    admittedTasks = batch;
+
+    // the next batch in line may fit as well
+    if(gFairShareWaiting.empty() == false)
+        gFairShareWaiting.front()->Notify();
+
+    return true;
+}
+
+void TaskQueue::ReleaseTasks(unsigned int count, bool withdraw)
+{
+    boost::mutex::scoped_lock lock(gFairShareMutex);
+
+    gFairShareRunning -= count;
+
+    if(withdraw == true)
+        gFairShareWaiting.erase(std::remove(gFairShareWaiting.begin(), gFairShareWaiting.end(), this), gFairShareWaiting.end());
+
+    if(gFairShareWaiting.empty() == false)
+        gFairShareWaiting.front()->Notify();
+}
+
+void TaskQueue::SetFairShare(bool enable)
+{
+    boost::recursive_mutex::scoped_lock lock(queueMutex);
+
+    fairShare = enable;
+}
+
+void TaskQueue::SetAffinity(bool enable)
+{
+    boost::recursive_mutex::scoped_lock lock(queueMutex);
+
+    affinity = enable;
+    nextCPU = 0;
+}
+
+void TaskQueue::RunJob(const boost::function0<void>& job)
+{
+    try
+    {
+        job();
+    }
+    catch(...)
+    {
+        Notify();
+        throw;
+    }
+
+    Notify();
+}
+
 }
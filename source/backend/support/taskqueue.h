@@ -36,9 +36,12 @@
 #ifndef POVRAY_BACKEND_TASKQUEUE_H
 #define POVRAY_BACKEND_TASKQUEUE_H
 
+#include <deque>
+
 #include <boost/thread.hpp>
 #include <boost/thread/condition.hpp>
 
+#include "base/jobscheduler.h"
 #include "povms/povmscpp.h"
 
 #include "backend/support/task.h"
@@ -55,26 +58,36 @@ class TaskQueue
                 {
                     kTask,
                     kSync,
+                    kJoin,
                     kMessage,
                     kFunction,
+                    kJob,
                 };
 
-                TaskEntry(EntryType et) : entryType(et) { }
-                TaskEntry(shared_ptr<Task> rt) : entryType(kTask), task(rt) { }
-                TaskEntry(POVMS_Message& m) : entryType(kMessage), msg(m) { }
-                TaskEntry(const boost::function1<void, TaskQueue&>& f) : entryType(kFunction), fn(f) { }
+                TaskEntry(EntryType et) : entryType(et), detached(false), admitted(false) { }
+                TaskEntry(shared_ptr<Task> rt, bool d = false) : entryType(kTask), task(rt), detached(d), admitted(false) { }
+                TaskEntry(POVMS_Message& m) : entryType(kMessage), msg(m), detached(false), admitted(false) { }
+                TaskEntry(const boost::function1<void, TaskQueue&>& f) : entryType(kFunction), fn(f), detached(false), admitted(false) { }
+                TaskEntry(const boost::function0<void>& j) : entryType(kJob), job(j), detached(false), admitted(false) { }
                 ~TaskEntry() { }
 
                 shared_ptr<Task> GetTask() { return task; }
                 POVMS_Message& GetMessage() { return msg; }
                 boost::function1<void, TaskQueue&>& GetFunction() { return fn; }
+                boost::function0<void>& GetJob() { return job; }
 
                 EntryType GetEntryType() { return entryType; }
+                bool IsDetached() { return detached; }
+                bool IsAdmitted() { return admitted; }
+                void SetAdmitted() { admitted = true; }
             private:
                 EntryType entryType;
                 shared_ptr<Task> task;
                 POVMS_Message msg;
                 boost::function1<void, TaskQueue&> fn;
+                boost::function0<void> job;
+                bool detached;
+                bool admitted;
         };
     public:
         TaskQueue();
@@ -91,17 +104,52 @@ class TaskQueue
 
         int FailureCode(int defval = kNoError);
 
-        ThreadData *AppendTask(Task *task);
+        /// Append a task.
+        ///
+        /// A detached task does not hold up subsequent syncs, so that work queued after it may run
+        /// in parallel; only a join waits for it. This is intended for tasks nothing else depends on
+        /// until much later, such as writing out results.
+        ///
+        ThreadData *AppendTask(Task *task, bool detached = false);
+
+        /// Append a sync, waiting for all tasks and jobs started before it, except detached tasks.
         void AppendSync();
+
+        /// Append a join, waiting for all tasks and jobs started before it, including detached tasks.
+        void AppendJoin();
         void AppendMessage(POVMS_Message& msg);
         void AppendFunction(const boost::function1<void, TaskQueue&>& fn);
 
+        /// Append a fine-grained job to be run on the work-stealing scheduler.
+        ///
+        /// Unlike tasks, jobs do not get a thread of their own; consecutive jobs are spread
+        /// across the scheduler's workers, and a subsequent sync waits for them to finish.
+        ///
+        void AppendJob(const boost::function0<void>& job);
+
         bool Process();
 
         void Notify();
+
+        /// Bind the threads of subsequently started tasks to CPUs.
+        ///
+        /// The tasks started between two syncs are assigned consecutive CPUs, so that each pass of
+        /// render threads keeps running on the same cores as the one before.
+        ///
+        void SetAffinity(bool enable);
+
+        /// Share the worker threads fairly with other queues doing the same.
+        ///
+        /// Each batch of consecutive tasks is only started once there are enough idle hardware
+        /// threads for it, or none of the sharing queues' tasks are running at all; batches waiting
+        /// for threads are started in the order they arrived, regardless of their queue. This keeps
+        /// concurrent views from oversubscribing the CPUs, and makes them take turns pass by pass.
+        /// Detached tasks are not held back nor counted.
+        ///
+        void SetFairShare(bool enable);
     private:
         /// queued task list
-        std::queue<TaskEntry> queuedTasks;
+        std::deque<TaskEntry> queuedTasks;
         /// active task list
         list<TaskEntry> activeTasks;
         /// queue mutex
@@ -110,6 +158,32 @@ class TaskQueue
         int failed;
         /// wait for data in queue or related operation to be processed
         boost::condition processCondition;
+        /// jobs started from the queue
+        JobGroup activeJobs;
+        /// whether to bind tasks to CPUs
+        bool affinity;
+        /// CPU to bind the next task to
+        unsigned int nextCPU;
+        /// whether to share the worker threads with other queues
+        bool fairShare;
+        /// number of tasks at the head of the queue already admitted to run
+        unsigned int admittedTasks;
+        /// name of the phase being recorded in the event trace, or `nullptr`
+        const char *phaseName;
+        /// event trace time the phase being recorded was started at
+        POV_LONG phaseStart;
+
+        void RunJob(const boost::function0<void>& job);
+
+        /// Check whether any tasks are active, optionally ignoring detached ones.
+        bool HasActiveTasks(bool includeDetached);
+
+        /// Request threads for the batch of tasks at the head of the queue.
+        bool AdmitBatch();
+
+        /// Return threads of finished tasks, or give up waiting for them.
+        void ReleaseTasks(unsigned int count, bool withdraw);
+
         /// not available
         TaskQueue(const TaskQueue&);
 
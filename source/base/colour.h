@@ -1242,6 +1242,12 @@ typedef GenericRGBTColour<PreciseColourChannel> PreciseRGBTColour;  ///< High pr
 
 /// Generic template class to hold and manipulate a colour.
 ///
+/// @note
+///     Channel-wise operations are simple fixed-count loops, which the compiler unrolls and
+///     vectorises as it sees fit. Hand-written SSE2 code for three `float` channels turned out
+///     about twice as slow, due to the shuffling needed to load and store them, and padding the
+///     colour to four channels did not pay off in shading code either.
+///
 /// @tparam T   Floating-point type to use for the individual colour channels.
 ///
 template<typename T>
@@ -679,6 +679,28 @@
     #undef POV_SYS_IMAGE_EXTENSION
 #endif
 
+/// @def POV_IMAGE_TILE_CACHE_SIZE
+/// Memory (in MB) to use for caching tiles of images paged in from tile cache files.
+///
+/// @see @ref pov_base::TiledImage
+///
+#ifndef POV_IMAGE_TILE_CACHE_SIZE
+    #define POV_IMAGE_TILE_CACHE_SIZE 256
+#endif
+
+/// @def POV_SHARED_PIXEL_BLOCKS
+/// Whether rendered pixel blocks are handed from the render engine to the front-end by reference.
+///
+/// This requires that render engine and front-end run in the same process, as is the case with all
+/// POVMS transports shipped with POV-Ray. Set this to 0 when using a transport that crosses process
+/// boundaries, to have pixel blocks serialised into the POVMS messages instead.
+///
+/// @see @ref pov_base::PixelBlockExchange
+///
+#ifndef POV_SHARED_PIXEL_BLOCKS
+    #define POV_SHARED_PIXEL_BLOCKS 1
+#endif
+
 /// @def POV_FILENAME_BUFFER_CHARS
 /// The number of characters to reserve for file name buffers.
 ///
@@ -828,6 +850,60 @@
     #define POV_USE_DEFAULT_TIMER 1
 #endif
 
+/// @def POV_USE_DEFAULT_HARDWARE_COUNTERS
+/// Whether to use a default implementation for the hardware performance counters.
+///
+/// Define as non-zero to use a default implementation for the @ref pov_base::HardwareCounters class, or zero if
+/// the platform provides its own implementation.
+///
+/// @note
+///     The default implementation does not support any counters.
+///
+#ifndef POV_USE_DEFAULT_HARDWARE_COUNTERS
+    #define POV_USE_DEFAULT_HARDWARE_COUNTERS 1
+#endif
+
+/// @def POV_USE_DEFAULT_FILE_MAPPING
+/// Whether to use a default implementation for read-only memory-mapped files.
+///
+/// Define as non-zero to use a default implementation for the @ref pov_base::MappedFile class, or zero if the
+/// platform provides its own implementation.
+///
+/// @note
+///     The default implementation is only provided as a last-ditch resort. It reads the whole file into memory,
+///     and therefore cannot share the data between processes.
+///
+#ifndef POV_USE_DEFAULT_FILE_MAPPING
+    #define POV_USE_DEFAULT_FILE_MAPPING 1
+#endif
+
+/// @def POV_USE_DEFAULT_WRITABLE_FILE_MAPPING
+/// Whether to use a default implementation for writable memory-mapped files.
+///
+/// Define as non-zero to use a default implementation for the @ref pov_base::WritableMappedFile class, or zero if
+/// the platform provides its own implementation.
+///
+/// @note
+///     The default implementation never succeeds in mapping a file, so that callers fall back to explicit file I/O.
+///
+#ifndef POV_USE_DEFAULT_WRITABLE_FILE_MAPPING
+    #define POV_USE_DEFAULT_WRITABLE_FILE_MAPPING 1
+#endif
+
+/// @def POV_USE_DEFAULT_DIRECTORY_LISTING
+/// Whether to use a default implementation for listing directories.
+///
+/// Define as non-zero to use a default implementation for the @ref pov_base::ReadDirectory() and
+/// @ref pov_base::GetDirectoryStamp() functions, or zero if the platform provides its own implementation.
+///
+/// @note
+///     The default implementation never succeeds, so that file searches fall back to checking each
+///     candidate file name on the file system.
+///
+#ifndef POV_USE_DEFAULT_DIRECTORY_LISTING
+    #define POV_USE_DEFAULT_DIRECTORY_LISTING 1
+#endif
+
 /// @def POV_USE_DEFAULT_PATH_PARSER
 /// Whether to use a default implementation for the path string parser.
 ///
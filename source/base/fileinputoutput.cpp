@@ -544,4 +544,18 @@ bool IMemStream::seekg(POV_OFF_T posi, unsigned int whence)
     return !fail;
 }
 
+#if POV_USE_DEFAULT_DIRECTORY_LISTING
+
+bool ReadDirectory(const UCS2String&, std::vector<UCS2String>&, POV_LONG&)
+{
+    return false;
+}
+
+bool GetDirectoryStamp(const UCS2String&, POV_LONG&)
+{
+    return false;
+}
+
+#endif // POV_USE_DEFAULT_DIRECTORY_LISTING
+
 }
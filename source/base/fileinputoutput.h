@@ -43,6 +43,9 @@
 #include <cstdio>
 #include <cstring>
 
+// Standard C++ header files
+#include <vector>
+
 // POV-Ray base header files
 #include "base/path.h"
 #include "base/stringutilities.h"
@@ -86,6 +89,12 @@ enum
     POV_File_Data_RCA,
     POV_File_Data_LOG,
     POV_File_Data_Backup,
+    POV_File_Data_BSP,
+    POV_File_Data_TKC,
+    POV_File_Data_RAW,
+    POV_File_Data_Mesh,
+    POV_File_Data_Particles,
+    POV_File_Data_Hair,
     POV_File_Font_TTF,
     POV_File_Count
 };
@@ -191,6 +200,15 @@ class IMemStream : public IStream
 
         virtual bool eof() const { return fail; }
 
+        /// Get the data, allowing it to be processed in place.
+        const unsigned char* GetData() const { return start; }
+
+        /// Get the size of the data.
+        size_t GetSize() const { return size; }
+
+        /// Get the formal position of the start of the data.
+        POV_OFF_T GetFormalStart() const { return formalStart; }
+
     protected:
 
         size_t size;
@@ -230,6 +248,24 @@ UCS2String GetFileName(const Path& p);
 bool CheckIfFileExists(const Path& p);
 POV_OFF_T GetFileLength(const Path& p);
 
+/// Read the names of the entries of a directory.
+///
+/// @param[in]  dir     Directory to list, or an empty string for the current directory.
+/// @param[out] names   Names of the directory's entries.
+/// @param[out] stamp   Modification time of the directory, in nanoseconds since the epoch.
+/// @return             `false` if the directory cannot be read, or the platform does not
+///                     support listing directories.
+///
+bool ReadDirectory(const UCS2String& dir, std::vector<UCS2String>& names, POV_LONG& stamp);
+
+/// Get the modification time of a directory.
+///
+/// @param[in]  dir     Directory to check, or an empty string for the current directory.
+/// @param[out] stamp   Modification time of the directory, in nanoseconds since the epoch.
+/// @return             `false` if the time cannot be determined.
+///
+bool GetDirectoryStamp(const UCS2String& dir, POV_LONG& stamp);
+
 /// @}
 ///
 //##############################################################################
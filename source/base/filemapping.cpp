@@ -0,0 +1,101 @@
+//******************************************************************************
+///
+/// @file base/filemapping.cpp
+///
+/// Implementations related to read-only memory-mapped files.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2017 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "base/filemapping.h"
+
+// C++ variants of C standard header files
+#include <cstdio>
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_base
+{
+
+#if POV_USE_DEFAULT_FILE_MAPPING
+
+MappedFile::MappedFile() :
+    mData(nullptr),
+    mSize(0)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const char *name)
+{
+    Close();
+
+    FILE *f = fopen(name, "rb");
+    if (f == nullptr)
+        return false;
+
+    bool ok = false;
+    if (fseek(f, 0, SEEK_END) == 0)
+    {
+        long size = ftell(f);
+        if ((size > 0) && (fseek(f, 0, SEEK_SET) == 0))
+        {
+            mData = new char[size];
+            mSize = size;
+            ok = (fread(mData, 1, mSize, f) == mSize);
+        }
+    }
+    fclose(f);
+
+    if (!ok)
+        Close();
+    return ok;
+}
+
+void MappedFile::Close()
+{
+    delete[] mData;
+    mData = nullptr;
+    mSize = 0;
+}
+
+#endif // POV_USE_DEFAULT_FILE_MAPPING
+
+IMappedFileStream::IMappedFileStream(const shared_ptr<MappedFile>& file, const UCS2String& formalName) :
+    IMemStream(reinterpret_cast<const unsigned char *>(file->GetData()), file->GetSize(), formalName),
+    mpFile(file)
+{}
+
+}
@@ -0,0 +1,207 @@
+//******************************************************************************
+///
+/// @file base/filemapping.h
+///
+/// Declarations related to read-only memory-mapped files.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2017 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_BASE_FILEMAPPING_H
+#define POVRAY_BASE_FILEMAPPING_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "base/configbase.h"
+
+#if !POV_USE_DEFAULT_FILE_MAPPING || !POV_USE_DEFAULT_WRITABLE_FILE_MAPPING
+#include "syspovfilemapping.h"
+#endif
+
+// POV-Ray header files (base module)
+#include "base/fileinputoutput.h"
+
+namespace pov_base
+{
+
+//##############################################################################
+///
+/// @defgroup PovBaseFilemapping Memory-Mapped Files
+/// @ingroup PovBase
+///
+/// @{
+
+#if POV_USE_DEFAULT_FILE_MAPPING
+
+/// Read-only view of an entire file's contents.
+///
+/// @note
+///     This is a default implementation, provided only as a last-ditch resort for platforms that
+///     cannot provide a better implementation. It simply reads the whole file into memory, so it
+///     neither saves time nor allows the data to be shared between processes.
+///
+class MappedFile
+{
+    public:
+
+        /// Create an empty mapping.
+        ///
+        MappedFile();
+
+        /// Destroy the mapping, releasing the file's contents.
+        ///
+        ~MappedFile();
+
+        /// Map a file.
+        ///
+        /// @param[in]  name    Name of the file to map.
+        /// @return             `true` on success, `false` otherwise.
+        ///
+        bool Open(const char *name);
+
+        /// Release the file's contents.
+        ///
+        void Close();
+
+        /// Get the file's contents.
+        ///
+        /// @return     Pointer to the first byte of the file, or `nullptr` if no file is mapped.
+        ///
+        inline const void *GetData() const { return mData; }
+
+        /// Get the size of the file.
+        ///
+        /// @return     Size of the file in bytes.
+        ///
+        inline size_t GetSize() const { return mSize; }
+
+        /// Hint that the entire file's contents are going to be read soon.
+        ///
+        /// @note   This implementation reads the contents when the file is opened, so there is
+        ///         nothing to do.
+        ///
+        inline void Prefetch() {}
+
+    private:
+
+        char *mData;
+        size_t mSize;
+};
+
+#endif // POV_USE_DEFAULT_FILE_MAPPING
+
+#if POV_USE_DEFAULT_WRITABLE_FILE_MAPPING
+
+/// Read-write view of a portion of an already open file.
+///
+/// @note
+///     This is a default implementation, provided for platforms that cannot map files into
+///     memory. It never succeeds in mapping a file, so callers must be prepared to fall back
+///     to explicit file I/O.
+///
+class WritableMappedFile
+{
+    public:
+
+        /// Hints on how the mapped data is going to be accessed.
+        enum AccessPattern
+        {
+            kAccessNormal,      ///< No particular access pattern.
+            kAccessRandom,      ///< Data will be accessed in no particular order.
+            kAccessSequential,  ///< Data will be accessed from start to end.
+        };
+
+        /// Create an empty mapping.
+        ///
+        WritableMappedFile() {}
+
+        /// Destroy the mapping.
+        ///
+        ~WritableMappedFile() {}
+
+        /// Map the leading portion of a file.
+        ///
+        /// @param[in]  fd      Descriptor of a file open for reading and writing.
+        /// @param[in]  size    Number of bytes to map; the file must be at least this large.
+        /// @return             `true` on success, `false` otherwise.
+        ///
+        bool Open(int fd, POV_OFF_T size) { return false; }
+
+        /// Release the mapping.
+        ///
+        void Close() {}
+
+        /// Tell the system how the data is going to be accessed.
+        ///
+        /// @param[in]  pattern The anticipated access pattern.
+        ///
+        void Advise(AccessPattern pattern) {}
+
+        /// Get the mapped data.
+        ///
+        /// @return     Pointer to the first mapped byte, or `nullptr` if no file is mapped.
+        ///
+        inline void *GetData() const { return nullptr; }
+
+        /// Get the size of the mapping.
+        ///
+        /// @return     Size of the mapping in bytes.
+        ///
+        inline size_t GetSize() const { return 0; }
+};
+
+#endif // POV_USE_DEFAULT_WRITABLE_FILE_MAPPING
+
+/// Input stream reading from a memory-mapped file.
+///
+/// Being an @ref IMemStream, this stream allows consumers to process its data in place rather
+/// than reading it into buffers of their own.
+///
+class IMappedFileStream final : public IMemStream
+{
+    public:
+
+        /// Create a stream reading from a mapped file.
+        ///
+        /// @param[in]  file        The mapped file; the stream keeps it mapped for as long as it exists.
+        /// @param[in]  formalName  Name of the file.
+        ///
+        IMappedFileStream(const shared_ptr<MappedFile>& file, const UCS2String& formalName);
+
+    private:
+
+        shared_ptr<MappedFile> mpFile;
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_BASE_FILEMAPPING_H
@@ -136,6 +136,12 @@ POV_File_Extensions gPOV_File_Extensions[POV_File_Count] =
     {{ ".rca",  ".RCA",  "",      ""      }}, // POV_File_Data_RCA
     {{ ".log",  ".LOG",  "",      ""      }}, // POV_File_Data_LOG
     {{ ".bak",  ".BAK",  "",      ""      }}, // POV_File_Data_Backup
+    {{ ".bsp",  ".BSP",  "",      ""      }}, // POV_File_Data_BSP
+    {{ ".tkc",  ".TKC",  "",      ""      }}, // POV_File_Data_TKC
+    {{ ".r16",  ".R16",  ".raw",  ".RAW"  }}, // POV_File_Data_RAW
+    {{ ".pmesh", ".PMESH", "",    ""      }}, // POV_File_Data_Mesh
+    {{ ".ppcl", ".PPCL", "",      ""      }}, // POV_File_Data_Particles
+    {{ ".phair", ".PHAIR", "",    ""      }}, // POV_File_Data_Hair
     {{ ".ttf",  ".TTF",  "",      ""      }}  // POV_File_Font_TTF
 };
 
@@ -166,6 +172,12 @@ const int gFile_Type_To_Mask [POV_File_Count] =
     NO_FILE,   // POV_File_Data_RCA
     NO_FILE,   // POV_File_Data_LOG
     NO_FILE,   // POV_File_Data_Backup
+    NO_FILE,   // POV_File_Data_BSP
+    NO_FILE,   // POV_File_Data_TKC
+    NO_FILE,   // POV_File_Data_RAW
+    NO_FILE,   // POV_File_Data_Mesh
+    NO_FILE,   // POV_File_Data_Particles
+    NO_FILE,   // POV_File_Data_Hair
     NO_FILE    // POV_File_Font_TTF
 };
 
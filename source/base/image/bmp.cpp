@@ -469,6 +469,7 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
 
     // BMP files used to have no clearly defined gamma by default, but a Microsoft recommendation exists to assume sRGB.
     gamma = options.GetTranscodingGammaCurve(SRGBGammaCurve::Get());
+    IntEncoder encoder(gamma, 255);
 
     // TODO ALPHA - check if BMP should really keep presuming non-premultiplied alpha
     // We presume non-premultiplied alpha, unless the user overrides
@@ -500,9 +501,9 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
         for (int x = 0 ; x < width ; x++)
         {
             if (alpha)
-                GetEncodedRGBAValue (image, x, y, gamma, 255, r, g, b, a, dither, premul);
+                GetEncodedRGBAValue (image, x, y, encoder, r, g, b, a, dither, premul);
             else
-                GetEncodedRGBValue (image, x, y, gamma, 255, r, g, b, dither) ;
+                GetEncodedRGBValue (image, x, y, encoder, r, g, b, dither) ;
             file->Write_Byte((unsigned char) b);
             file->Write_Byte((unsigned char) g);
             file->Write_Byte((unsigned char) r);
@@ -91,6 +91,38 @@ float* GammaCurve::GetLookupTable(unsigned int max)
     return lookupTable;
 }
 
+const unsigned int* GammaCurve::GetEncodingLookupTable(unsigned int max)
+{
+    POV_COLOURSPACE_ASSERT(max == 255 || max == 65535); // shouldn't happen, but it won't hurt to check in debug versions
+
+    // Get the decoding table first, as it is guarded by the same mutex.
+    const float* decoded = GetLookupTable(max);
+
+    unsigned int*& encodingTable = (max == 255 ? encodingTable8 : encodingTable16);
+
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(lutMutex);
+#endif
+
+    if (!encodingTable)
+    {
+        unsigned int* tempTable = new unsigned int[kEncodingLookupTableSize+1];
+        unsigned int v = 0;
+        for (unsigned int i = 0; i <= kEncodingLookupTableSize; i ++)
+        {
+            float x = float(i) / float(kEncodingLookupTableSize);
+            while ((v < max) && (decoded[v+1] <= x))
+                ++ v;
+            tempTable[i] = v;
+        }
+
+        // hook up the table only as soon as it is completed (see GetLookupTable()).
+        encodingTable = tempTable;
+    }
+
+    return encodingTable;
+}
+
 GammaCurvePtr GammaCurve::GetMatching(const GammaCurvePtr& newInstance)
 {
     GammaCurvePtr oldInstance;
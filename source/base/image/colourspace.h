@@ -128,6 +128,23 @@ class GammaCurve
         ///
         float* GetLookupTable(unsigned int max);
 
+        /// Number of intervals covered by the lookup tables for faster encoding.
+        static const unsigned int kEncodingLookupTableSize = 4096;
+
+        /// Retrieves a lookup table for faster encoding.
+        ///
+        /// The table divides the range from 0.0 to 1.0 into @ref kEncodingLookupTableSize intervals of equal size,
+        /// so that encoding a value only needs to search the few integer values within the respective interval,
+        /// using the table returned by @ref GetLookupTable().
+        ///
+        /// @note           The same lifetime restrictions apply as for @ref GetLookupTable().
+        ///
+        /// @param[in]  max The maximum encoded value; must be either 255 for 8-bit depth, or 65535 for 16-bit depth.
+        /// @return         Pointer to a table holding, for each interval boundary from 0.0 to 1.0 inclusive, the largest
+        ///                 integer value that does not decode to a value greater than the boundary.
+        ///
+        const unsigned int* GetEncodingLookupTable(unsigned int max);
+
         /// Convenience function to test whether a gamma curve pointer refers to a neutral curve.
         ///
         /// @param[in]  p   The gamma curve pointer to test.
@@ -309,16 +326,28 @@ class GammaCurve
         ///
         float* lookupTable16;
 
+        /// Cached encoding lookup table for 8-bit depth, as returned by `GetEncodingLookupTable(255)`.
+        unsigned int* encodingTable8;
+
+        /// Cached encoding lookup table for 16-bit depth, as returned by `GetEncodingLookupTable(65535)`.
+        unsigned int* encodingTable16;
+
 #if POV_MULTITHREADED
-        /// Mutex to guard access to @ref lookupTable8 and @ref lookupTable16.
+        /// Mutex to guard access to the lookup tables.
         boost::mutex lutMutex;
 #endif
 
         /// Constructor.
-        GammaCurve() : lookupTable8(nullptr), lookupTable16(nullptr) {}
+        GammaCurve() : lookupTable8(nullptr), lookupTable16(nullptr), encodingTable8(nullptr), encodingTable16(nullptr) {}
 
         /// Destructor.
-        virtual ~GammaCurve() { if (lookupTable8) delete[] lookupTable8; if (lookupTable16) delete[] lookupTable16; }
+        virtual ~GammaCurve()
+        {
+            delete[] lookupTable8;
+            delete[] lookupTable16;
+            delete[] encodingTable8;
+            delete[] encodingTable16;
+        }
 
         /// Function to test whether two gamma curves match.
         ///
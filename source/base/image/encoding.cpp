@@ -37,6 +37,9 @@
 // Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
 #include "base/image/encoding.h"
 
+// C++ variants of C standard header files
+#include <cstring>
+
 // POV-Ray header files (base module)
 #include "base/image/dither.h"
 #include "base/image/image.h"
@@ -111,6 +114,92 @@ void AlphaUnPremultiply(RGBTColour& colour)
 }
 
 
+POV_UINT16 HalfEncode(float x)
+{
+    POV_UINT32 bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+
+    POV_UINT16 sign = POV_UINT16((bits >> 16) & 0x8000u);
+    POV_UINT32 mag  = bits & 0x7FFFFFFFu;
+
+    if (mag >= 0x7F800000u)
+        // infinity or NaN (making sure the latter stays a NaN)
+        return sign | 0x7C00u | ((mag > 0x7F800000u) ? 0x0200u : 0u);
+    if (mag >= 0x477FF000u)
+        // rounds to 65520 or more, which is beyond the largest finite half value
+        return sign | 0x7C00u;
+    if (mag <= 0x33000000u)
+        // 2^-25 or less, which rounds to zero
+        return sign;
+
+    POV_UINT32 result, rest, halfway;
+    if (mag < 0x38800000u)
+    {
+        // below 2^-14, i.e. subnormal in half precision
+        POV_UINT32 mantissa = (mag & 0x007FFFFFu) | 0x00800000u;
+        unsigned int shift = 126 - (mag >> 23);
+        result  = mantissa >> shift;
+        rest    = mantissa & ((1u << shift) - 1);
+        halfway = 1u << (shift - 1);
+    }
+    else
+    {
+        // normal; re-bias the exponent and drop the 13 surplus mantissa bits
+        result  = (mag - 0x38000000u) >> 13;
+        rest    = mag & 0x1FFFu;
+        halfway = 0x1000u;
+    }
+    // round to nearest even; a carry out of the mantissa correctly bumps the exponent
+    if ((rest > halfway) || ((rest == halfway) && (result & 1u)))
+        ++result;
+    return sign | POV_UINT16(result);
+}
+
+float HalfDecode(POV_UINT16 x)
+{
+    POV_UINT32 sign     = POV_UINT32(x & 0x8000u) << 16;
+    POV_UINT32 exponent = (x >> 10) & 0x1Fu;
+    POV_UINT32 mantissa = x & 0x03FFu;
+
+    if (exponent == 0)
+    {
+        // zero or subnormal
+        float value = float(mantissa) * (1.0f / 16777216.0f);
+        return (sign != 0) ? -value : value;
+    }
+
+    POV_UINT32 bits;
+    if (exponent == 0x1Fu)
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    else
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+
+IntEncoder::IntEncoder() :
+    mDecodeTable(nullptr),
+    mEncodeTable(nullptr),
+    mMax(255)
+{}
+
+IntEncoder::IntEncoder(const GammaCurvePtr& g, unsigned int max) :
+    mGamma(g),
+    mDecodeTable(nullptr),
+    mEncodeTable(nullptr),
+    mMax(max)
+{
+    if (!GammaCurve::IsNeutral(g) && ((max == 255) || (max == 65535)))
+    {
+        mDecodeTable = mGamma->GetLookupTable(max);
+        mEncodeTable = mGamma->GetEncodingLookupTable(max);
+    }
+}
+
+
 void SetEncodedGrayValue(Image* img, unsigned int x, unsigned int y, const GammaCurvePtr& g, unsigned int max, unsigned int gray)
 {
     if (!img->IsIndexed() && img->GetMaxIntValue() == max && GammaCurve::IsNeutral(g))
@@ -206,7 +295,7 @@ void SetEncodedRGBValue(Image* img, unsigned int x, unsigned int y, const GammaC
     img->SetRGBValue(x, y, GammaCurve::Decode(g,col.red()), GammaCurve::Decode(g,col.green()), GammaCurve::Decode(g,col.blue()));
 }
 
-unsigned int GetEncodedGrayValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr& g, unsigned int max, DitherStrategy& dh)
+unsigned int GetEncodedGrayValue(const Image* img, unsigned int x, unsigned int y, const IntEncoder& enc, DitherStrategy& dh)
 {
     float fGray;
     if (!img->IsPremultiplied() && img->HasTransparency())
@@ -223,11 +312,11 @@ unsigned int GetEncodedGrayValue(const Image* img, unsigned int x, unsigned int
     }
     DitherStrategy::ColourOffset linOff, encOff;
     dh.GetOffset(x,y,linOff,encOff);
-    unsigned int iGray = IntEncode(g, fGray, max, encOff.gray, linOff.gray);
+    unsigned int iGray = enc.Encode(fGray, encOff.gray, linOff.gray);
     dh.SetError(x,y,linOff);
     return iGray;
 }
-void GetEncodedGrayAValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr& g, unsigned int max, unsigned int& gray, unsigned int& alpha, DitherStrategy& dh, bool premul)
+void GetEncodedGrayAValue(const Image* img, unsigned int x, unsigned int y, const IntEncoder& enc, unsigned int& gray, unsigned int& alpha, DitherStrategy& dh, bool premul)
 {
     bool doPremultiply   = premul && !img->IsPremultiplied() && img->HasTransparency(); // need to apply premultiplication if encoded data should be premul'ed but container content isn't
     bool doUnPremultiply = !premul && img->IsPremultiplied() && img->HasTransparency(); // need to undo premultiplication if other way round
@@ -268,11 +357,11 @@ void GetEncodedGrayAValue(const Image* img, unsigned int x, unsigned int y, cons
     // else no need to worry about premultiplication
     DitherStrategy::ColourOffset linOff, encOff;
     dh.GetOffset(x,y,linOff,encOff);
-    gray  = IntEncode(g, fGray,  max, encOff.gray,  linOff.gray);
-    alpha = IntEncode(   fAlpha, max, encOff.alpha, linOff.alpha);
+    gray  = enc.Encode(fGray, encOff.gray, linOff.gray);
+    alpha = IntEncode(fAlpha, enc.GetMaxValue(), encOff.alpha, linOff.alpha);
     dh.SetError(x,y,linOff);
 }
-void GetEncodedRGBValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr& g, unsigned int max, unsigned int& red, unsigned int& green, unsigned int& blue, DitherStrategy& dh)
+void GetEncodedRGBValue(const Image* img, unsigned int x, unsigned int y, const IntEncoder& enc, unsigned int& red, unsigned int& green, unsigned int& blue, DitherStrategy& dh)
 {
     float fRed, fGreen, fBlue;
     if (!img->IsPremultiplied() && img->HasTransparency())
@@ -289,12 +378,12 @@ void GetEncodedRGBValue(const Image* img, unsigned int x, unsigned int y, const
     }
     DitherStrategy::ColourOffset linOff, encOff;
     dh.GetOffset(x,y,linOff,encOff);
-    red   = IntEncode(g, fRed,   max, encOff.red,   linOff.red);
-    green = IntEncode(g, fGreen, max, encOff.green, linOff.green);
-    blue  = IntEncode(g, fBlue,  max, encOff.blue,  linOff.blue);
+    red   = enc.Encode(fRed,   encOff.red,   linOff.red);
+    green = enc.Encode(fGreen, encOff.green, linOff.green);
+    blue  = enc.Encode(fBlue,  encOff.blue,  linOff.blue);
     dh.SetError(x,y,linOff);
 }
-void GetEncodedRGBAValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr& g, unsigned int max, unsigned int& red, unsigned int& green, unsigned int& blue, unsigned int& alpha, DitherStrategy& dh, bool premul)
+void GetEncodedRGBAValue(const Image* img, unsigned int x, unsigned int y, const IntEncoder& enc, unsigned int& red, unsigned int& green, unsigned int& blue, unsigned int& alpha, DitherStrategy& dh, bool premul)
 {
     bool doPremultiply   = premul && !img->IsPremultiplied() && img->HasTransparency(); // need to apply premultiplication if encoded data should be premul'ed but container content isn't
     bool doUnPremultiply = !premul && img->IsPremultiplied() && img->HasTransparency(); // need to undo premultiplication if other way round
@@ -342,10 +431,10 @@ void GetEncodedRGBAValue(const Image* img, unsigned int x, unsigned int y, const
     // else no need to worry about premultiplication
     DitherStrategy::ColourOffset linOff, encOff;
     dh.GetOffset(x,y,linOff,encOff);
-    red   = IntEncode(g, fRed,   max, encOff.red,   linOff.red);
-    green = IntEncode(g, fGreen, max, encOff.green, linOff.green);
-    blue  = IntEncode(g, fBlue,  max, encOff.blue,  linOff.blue);
-    alpha = IntEncode(   fAlpha, max, encOff.alpha, linOff.alpha);
+    red   = enc.Encode(fRed,   encOff.red,   linOff.red);
+    green = enc.Encode(fGreen, encOff.green, linOff.green);
+    blue  = enc.Encode(fBlue,  encOff.blue,  linOff.blue);
+    alpha = IntEncode(fAlpha, enc.GetMaxValue(), encOff.alpha, linOff.alpha);
     dh.SetError(x,y,linOff);
 }
 
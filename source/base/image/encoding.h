@@ -225,6 +225,136 @@ inline unsigned int IntEncode(const GammaCurvePtr& g, float x, unsigned int max,
     return IntEncode(g, x, max, qOff, err);
 }
 
+/// Table-driven encoder for a particular transfer function and bit depth.
+///
+/// This class maps floating-point values to integer values just like the generic encoding
+/// functions, but instead of evaluating the transfer function for each value it looks up the
+/// candidate integer values in tables cached by the gamma curve; this is considerably faster
+/// when converting entire images.
+///
+/// @note
+///     Lookup tables are only available for 8 and 16 bit depth; at other depths, or with a
+///     neutral transfer function, the generic encoding functions are used.
+/// @note
+///     Results may differ from those of the generic functions where a value falls within
+///     floating-point precision of the boundary between two integer values, or near
+///     discontinuities of the transfer function (such as the one in ITU-R BT.709).
+///
+class IntEncoder final
+{
+    public:
+
+        /// Construct a neutral 8-bit encoder.
+        IntEncoder();
+
+        /// Construct an encoder.
+        ///
+        /// @param[in]  g       Transfer function (gamma curve) to use.
+        /// @param[in]  max     Encoded value representing 1.0.
+        ///
+        IntEncoder(const GammaCurvePtr& g, unsigned int max);
+
+        /// Get the encoded value representing 1.0.
+        unsigned int GetMaxValue() const { return mMax; }
+
+        /// Encode a value.
+        ///
+        /// @param[in]      x       Value to encode.
+        /// @param[in]      qOff    Offset to add before quantization.
+        /// @param[in,out]  err     Quantization error (including effects due to adding qOff).
+        ///
+        unsigned int Encode(float x, float qOff, float& err) const
+        {
+            if (mEncodeTable == nullptr)
+                return IntEncode(mGamma, x, mMax, qOff, err);
+
+            float xEff = clip(x, 0.0f, 1.0f) + err;
+            unsigned int v = EncodeDown(xEff);
+            float decoded = mDecodeTable[v];
+            if (v >= mMax)
+            {
+                err = xEff - decoded;
+                return v;
+            }
+            float decodedUp = mDecodeTable[v + 1];
+            float threshold = (0.5 - qOff) * decoded + (0.5 + qOff) * decodedUp;
+            if (xEff > threshold)
+            {
+                decoded = decodedUp;
+                ++v;
+            }
+            err = xEff - decoded;
+            return v;
+        }
+
+        /// Encode a value.
+        ///
+        /// @param[in]      x       Value to encode.
+        /// @param[in]      qOff    Offset to add before quantization.
+        ///
+        unsigned int Encode(float x, float qOff = 0.0f) const
+        {
+            float err = 0.0f;
+            return Encode(x, qOff, err);
+        }
+
+    private:
+
+        GammaCurvePtr       mGamma;
+        const float*        mDecodeTable;   ///< Decoded value for each integer value.
+        const unsigned int* mEncodeTable;   ///< See @ref GammaCurve::GetEncodingLookupTable(); `nullptr` if not used.
+        unsigned int        mMax;
+
+        /// Find the largest integer value that does not decode to more than a given value.
+        unsigned int EncodeDown(float x) const
+        {
+            if (!(x > 0.0f))
+                return 0;
+            if (x >= 1.0f)
+                return mMax;
+            // The table size is a power of two, so the following is exact.
+            unsigned int i = (unsigned int)(x * float(GammaCurve::kEncodingLookupTableSize));
+            unsigned int lo = mEncodeTable[i];
+            unsigned int hi = mEncodeTable[i + 1];
+            while (lo < hi)
+            {
+                unsigned int mid = (lo + hi + 1) / 2;
+                if (mDecodeTable[mid] <= x)
+                    lo = mid;
+                else
+                    hi = mid - 1;
+            }
+            return lo;
+        }
+};
+
+/// @}
+///
+//*****************************************************************************
+///
+/// @name Half-Precision Floating-Point Encoding
+///
+/// The following functions convert between single-precision floating-point values and the
+/// 16-bit IEEE 754 "half" format, as used e.g. by OpenEXR.
+///
+/// @{
+
+/// Half-precision encoding function.
+/// This function maps a floating-point value to the nearest half-precision value, rounding
+/// ties to even.
+/// @note
+///     Values too large for the half-precision format are mapped to infinity; NaN values are
+///     preserved.
+/// @param[in]  x       Value to encode.
+/// @return             Encoded value.
+POV_UINT16 HalfEncode(float x);
+
+/// Half-precision decoding function.
+/// This function maps a half-precision value to the corresponding floating-point value.
+/// @param[in]  x       Value to decode.
+/// @return             Decoded value.
+float HalfDecode(POV_UINT16 x);
+
 /// @}
 ///
 //*****************************************************************************
@@ -302,10 +432,10 @@ void SetEncodedRGBValue(Image* img, unsigned int x, unsigned int y, const GammaC
 ///
 /// @{
 
-unsigned int GetEncodedGrayValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr&, unsigned int max, DitherStrategy& dh);
-void GetEncodedGrayAValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr&, unsigned int max, unsigned int& gray, unsigned int& alpha, DitherStrategy& dh, bool premul = false);
-void GetEncodedRGBValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr&, unsigned int max, unsigned int& red, unsigned int& green, unsigned int& blue, DitherStrategy& dh);
-void GetEncodedRGBAValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr&, unsigned int max, unsigned int& red, unsigned int& green, unsigned int& blue, unsigned int& alpha, DitherStrategy& dh, bool premul = false);
+unsigned int GetEncodedGrayValue(const Image* img, unsigned int x, unsigned int y, const IntEncoder& enc, DitherStrategy& dh);
+void GetEncodedGrayAValue(const Image* img, unsigned int x, unsigned int y, const IntEncoder& enc, unsigned int& gray, unsigned int& alpha, DitherStrategy& dh, bool premul = false);
+void GetEncodedRGBValue(const Image* img, unsigned int x, unsigned int y, const IntEncoder& enc, unsigned int& red, unsigned int& green, unsigned int& blue, DitherStrategy& dh);
+void GetEncodedRGBAValue(const Image* img, unsigned int x, unsigned int y, const IntEncoder& enc, unsigned int& red, unsigned int& green, unsigned int& blue, unsigned int& alpha, DitherStrategy& dh, bool premul = false);
 float GetEncodedGrayValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr&);
 void GetEncodedGrayAValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr&, float& gray, float& alpha, bool premul = false);
 void GetEncodedRGBValue(const Image* img, unsigned int x, unsigned int y, const GammaCurvePtr&, float& red, float& green, float& blue);
@@ -173,7 +173,9 @@ class Image
             /// Dual-channel (grayscale and alpha) image using 8-bit gamma greyscale encoding and 8-bit linear alpha encoding.
             GrayA_Gamma8,
             /// Dual-channel (grayscale and alpha) image using 16-bit gamma greyscale encoding and 16-bit linear alpha encoding.
-            GrayA_Gamma16
+            GrayA_Gamma16,
+            /// 4-channel (colour and alpha) image using half-precision floating-point encoding.
+            RGBA_Half,
         };
 
         /// Image file type identifier.
@@ -290,6 +292,12 @@ class Image
             ///     in POV-Ray.
             bool grayscale : 1;
 
+            /// Whether to write a tiled image, including lower resolution versions (MIP map levels).
+            /// @note
+            ///     This setting is ignored with file formats that do not support tiling, or for
+            ///     which support of tiling has not been implemented in POV-Ray.
+            bool tiled : 1;
+
             WriteOptions();
 
             inline bool AlphaIsEnabled() const
@@ -329,6 +337,28 @@ class Image
 
         static void Write(ImageFileType ftype, OStream *file, const Image *image, const WriteOptions& options = WriteOptions());
 
+        /// Writer emitting an image file row by row, from top to bottom.
+        ///
+        /// This allows the output file to be written while the image is still being rendered, as
+        /// soon as its topmost rows are complete.
+        ///
+        class RowWriter
+        {
+            public:
+                virtual ~RowWriter() { }
+                /// Write the next row, taking its pixels from the given image.
+                virtual void WriteRow(const Image *image) = 0;
+                /// Complete the file, after the last row has been written.
+                virtual void Finish() = 0;
+        };
+
+        /// Check whether a file type can be written row by row.
+        static bool CanWriteRows(ImageFileType ftype);
+
+        /// Create a writer emitting the image file row by row.
+        /// @return     New writer, or `nullptr` if the file type can't be written row by row.
+        static RowWriter *NewRowWriter(ImageFileType ftype, OStream *file, const Image *image, const WriteOptions& options = WriteOptions());
+
         unsigned int GetWidth() const { return width; }
         unsigned int GetHeight() const { return height; }
         ImageDataType GetImageDataType() const { return type; }
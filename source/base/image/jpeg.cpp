@@ -414,6 +414,7 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
     // JPEG files used to have no clearly defined gamma by default, but a W3C recommendation exists for them to use sRGB
     // unless an ICC profile is present (which we presently don't support).
     gamma = options.GetTranscodingGammaCurve(SRGBGammaCurve::Get());
+    IntEncoder encoder(gamma, MAXJSAMPLE);
 
     writebuf.file = file;
 
@@ -512,7 +513,7 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
             for (int col = 0; col < width; col++)
             {
                 unsigned int r, g, b;
-                GetEncodedRGBValue(image, col, row, gamma, MAXJSAMPLE, r, g, b, *dither);
+                GetEncodedRGBValue(image, col, row, encoder, r, g, b, *dither);
                 *sample++ = (JSAMPLE) r;
                 *sample++ = (JSAMPLE) g;
                 *sample++ = (JSAMPLE) b;
@@ -521,7 +522,7 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
         else if (writebuf.cinfo.input_components == 1) // 8-bit grayscale image
         {
             for (int col = 0; col < width; col++)
-                *sample++ = (JSAMPLE) GetEncodedGrayValue(image, col, row, gamma, MAXJSAMPLE, *dither);
+                *sample++ = (JSAMPLE) GetEncodedGrayValue(image, col, row, encoder, *dither);
         }
         jpeg_write_scanlines(&writebuf.cinfo, writebuf.row_pointer, 1);
     }
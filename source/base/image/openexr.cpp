@@ -50,9 +50,12 @@
 #include <ImfStringAttribute.h>
 #include <ImfMatrixAttribute.h>
 #include <ImfArray.h>
+#include <ImfThreading.h>
+#include <ImfTiledRgbaFile.h>
 
 // POV-Ray base header files
 #include "base/fileinputoutput.h"
+#include "base/jobscheduler.h"
 #include "base/types.h"
 #include "base/image/metadata.h"
 
@@ -220,6 +223,26 @@ Image *Read(IStream *file, const Image::ReadOptions& options)
     return image;
 }
 
+/// Edge length of the tiles in tiled output files.
+static const int kTileSize = 64;
+
+/// Compute the next lower resolution level of a MIP-mapped image, averaging 2x2 pixel blocks.
+static void Downsample(const Rgba *src, int srcWidth, Rgba *dst, int dstWidth, int dstHeight)
+{
+    for (int y = 0; y < dstHeight; y++)
+    {
+        const Rgba *s0 = src + (2 * y) * srcWidth;
+        const Rgba *s1 = s0 + srcWidth;
+        for (int x = 0; x < dstWidth; x++, s0 += 2, s1 += 2)
+        {
+            *dst++ = Rgba((float(s0[0].r) + float(s0[1].r) + float(s1[0].r) + float(s1[1].r)) * 0.25f,
+                          (float(s0[0].g) + float(s0[1].g) + float(s1[0].g) + float(s1[1].g)) * 0.25f,
+                          (float(s0[0].b) + float(s0[1].b) + float(s1[0].b) + float(s1[1].b)) * 0.25f,
+                          (float(s0[0].a) + float(s0[1].a) + float(s1[0].a) + float(s1[1].a)) * 0.25f);
+        }
+    }
+}
+
 void Write(OStream *file, const Image *image, const Image::WriteOptions& options)
 {
     int width = image->GetWidth();
@@ -247,6 +270,10 @@ void Write(OStream *file, const Image *image, const Image::WriteOptions& options
         }
     }
 
+    // have OpenEXR compress lines or tiles on as many threads as we render with
+    if (globalThreadCount() < int(JobGroup::Concurrency()))
+        setGlobalThreadCount(int(JobGroup::Concurrency()));
+
     POV_EXR_OStream os(*file);
     try
     {
@@ -281,9 +308,32 @@ void Write(OStream *file, const Image *image, const Image::WriteOptions& options
         hdr.insert("software",StringAttribute(software.c_str()));
         hdr.insert("creation",StringAttribute(datetime.c_str()));
 
-        RgbaOutputFile rof(os, hdr, channels);
-        rof.setFrameBuffer(pixels.get(), 1, width);
-        rof.writePixels(height);
+        if (options.tiled)
+        {
+            // all lower resolution levels are computed in the same buffer, each overwriting the
+            // top left portion of the previous one once that has been written
+            TiledRgbaOutputFile tof(os, hdr, channels, kTileSize, kTileSize, MIPMAP_LEVELS, ROUND_DOWN);
+            boost::scoped_array<Rgba> level;
+            if (tof.numLevels() > 1)
+                level.reset(new Rgba[tof.levelWidth(1) * tof.levelHeight(1)]);
+            for (int lod = 0; lod < tof.numLevels(); lod++)
+            {
+                Rgba *levelPixels = (lod == 0 ? pixels.get() : level.get());
+                int levelWidth = tof.levelWidth(lod);
+                if (lod == 1)
+                    Downsample(pixels.get(), width, levelPixels, levelWidth, tof.levelHeight(lod));
+                else if (lod > 1)
+                    Downsample(levelPixels, tof.levelWidth(lod - 1), levelPixels, levelWidth, tof.levelHeight(lod));
+                tof.setFrameBuffer(levelPixels, 1, levelWidth);
+                tof.writeTiles(0, tof.numXTiles(lod) - 1, 0, tof.numYTiles(lod) - 1, lod);
+            }
+        }
+        else
+        {
+            RgbaOutputFile rof(os, hdr, channels);
+            rof.setFrameBuffer(pixels.get(), 1, width);
+            rof.writePixels(height);
+        }
     }
     catch(const std::exception& e)
     {
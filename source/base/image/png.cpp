@@ -47,11 +47,16 @@
 #include <string>
 #include <memory>
 
+// Boost header files
+#include <boost/bind.hpp>
+
 // other 3rd party library headers
 #include <png.h>
+#include <zlib.h>
 
 // POV-Ray base header files
 #include "base/fileinputoutput.h"
+#include "base/jobscheduler.h"
 #include "base/types.h"
 #include "base/image/metadata.h"
 
@@ -78,6 +83,14 @@ const int FLUSH_DIST = 16; // Set to 16 and removed complicated math [trf]
 const int NTEXT = 15;      // Maximum number of tEXt comment blocks
 const int MAXTEXT = 1024;  // Maximum length of a tEXt message
 
+/* When writing a complete image, the filtered image data is split into segments
+ * of at least this many bytes, which are compressed concurrently; each segment's
+ * compressor is primed with the preceding DEFLATE_WINDOW bytes, so that the
+ * compression ratio hardly suffers.
+ */
+const size_t PARALLEL_SEGMENT_SIZE = 128 * 1024;
+const size_t DEFLATE_WINDOW = 32768;
+
 
 /*****************************************************************************
 * Local typedefs
@@ -88,6 +101,20 @@ struct Messages
     string error;
 };
 
+/// Portion of the image data to be filtered and compressed independently.
+struct Segment
+{
+    const png_byte *raw;        ///< Unfiltered rows, each rawRowBytes long.
+    png_byte       *filtered;   ///< Filtered rows, each prefixed with its filter type.
+    int             firstRow;
+    int             rows;
+    const png_byte *dict;       ///< Filtered data preceding this segment.
+    size_t          dictSize;
+    bool            last;
+    vector<png_byte> output;    ///< Raw deflate stream of this segment.
+    uLong           adler;      ///< Adler-32 checksum of this segment's filtered data.
+};
+
 /*****************************************************************************
 * Local variables
 ******************************************************************************/
@@ -665,6 +692,109 @@ Image *Read (IStream *file, const Image::ReadOptions& options)
     return (image) ;
 }
 
+static inline unsigned int FilterCost(png_byte v)
+{
+    return (v < 128) ? v : 256 - v;
+}
+
+static inline png_byte PaethPredictor(int a, int b, int c)
+{
+    int p  = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if ((pa <= pb) && (pa <= pc))
+        return a;
+    else if (pb <= pc)
+        return b;
+    else
+        return c;
+}
+
+/// Filter a single row, choosing the filter type with the smallest sum of absolute residuals.
+/// This is the same heuristic libpng uses by default.
+static void FilterRow(const png_byte *row, const png_byte *prev, size_t rowBytes, size_t bpp, png_byte *out, vector<png_byte>& scratch)
+{
+    scratch.resize(rowBytes * 5);
+    png_byte *cand[5];
+    unsigned long cost[5] = { 0, 0, 0, 0, 0 };
+    for (int f = 0; f < 5; f++)
+        cand[f] = &scratch[rowBytes * f];
+
+    for (size_t i = 0; i < rowBytes; i++)
+    {
+        int x = row[i];
+        int a = (i >= bpp) ? row[i - bpp] : 0;
+        int b = (prev != nullptr) ? prev[i] : 0;
+        int c = ((i >= bpp) && (prev != nullptr)) ? prev[i - bpp] : 0;
+        cand[PNG_FILTER_VALUE_NONE][i]  = png_byte(x);
+        cand[PNG_FILTER_VALUE_SUB][i]   = png_byte(x - a);
+        cand[PNG_FILTER_VALUE_UP][i]    = png_byte(x - b);
+        cand[PNG_FILTER_VALUE_AVG][i]   = png_byte(x - ((a + b) >> 1));
+        cand[PNG_FILTER_VALUE_PAETH][i] = png_byte(x - PaethPredictor(a, b, c));
+        for (int f = 0; f < 5; f++)
+            cost[f] += FilterCost(cand[f][i]);
+    }
+
+    int best = PNG_FILTER_VALUE_NONE;
+    for (int f = 1; f < 5; f++)
+        if (cost[f] < cost[best])
+            best = f;
+
+    out[0] = png_byte(best);
+    memcpy(out + 1, cand[best], rowBytes);
+}
+
+static void FilterSegment(Segment *seg, size_t rawRowBytes, size_t bpp)
+{
+    vector<png_byte> scratch;
+    for (int i = 0; i < seg->rows; i++)
+    {
+        int row = seg->firstRow + i;
+        const png_byte *cur  = seg->raw + row * rawRowBytes;
+        const png_byte *prev = (row > 0) ? cur - rawRowBytes : nullptr;
+        FilterRow(cur, prev, rawRowBytes, bpp, seg->filtered + i * (rawRowBytes + 1), scratch);
+    }
+}
+
+static void DeflateSegment(Segment *seg, size_t rawRowBytes)
+{
+    size_t size = seg->rows * (rawRowBytes + 1);
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    // raw deflate (negative window bits); the zlib wrapper is added once for the whole stream
+    if (deflateInit2(&z, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_FILTERED) != Z_OK)
+        throw POV_EXCEPTION(kOutOfMemoryErr, "Cannot allocate PNG compression data structures");
+    if (seg->dictSize > 0)
+        deflateSetDictionary(&z, seg->dict, uInt(seg->dictSize));
+
+    // all but the last segment end with a sync flush, so that they end on a byte boundary
+    // and can simply be concatenated
+    int flush = seg->last ? Z_FINISH : Z_SYNC_FLUSH;
+    int result;
+    seg->output.resize(deflateBound(&z, uLong(size)) + 64);
+    z.next_in  = const_cast<Bytef *>(seg->filtered);
+    z.avail_in = uInt(size);
+    for (;;)
+    {
+        z.next_out  = &seg->output[z.total_out];
+        z.avail_out = uInt(seg->output.size() - z.total_out);
+        result = deflate(&z, flush);
+        if ((result == Z_STREAM_END) || ((result == Z_OK) && !seg->last && (z.avail_out > 0)))
+            break;
+        if ((result != Z_OK) && (result != Z_BUF_ERROR))
+        {
+            deflateEnd(&z);
+            throw POV_EXCEPTION(kFileDataErr, "PNG compression failed");
+        }
+        seg->output.resize(seg->output.size() * 2);
+    }
+    seg->output.resize(z.total_out);
+    deflateEnd(&z);
+
+    seg->adler = adler32(adler32(0, Z_NULL, 0), seg->filtered, uInt(size));
+}
+
 void SetChannelValue(png_bytep& p, unsigned int v, unsigned int bpcc)
 {
     if (bpcc > 8)
@@ -672,59 +802,77 @@ void SetChannelValue(png_bytep& p, unsigned int v, unsigned int bpcc)
     *(p++) = (v & 0xFF);
 }
 
-void Write (OStream *file, const Image *image, const Image::WriteOptions& options)
+struct RowWriter::Data
+{
+    png_info            *info_ptr;
+    png_struct          *png_ptr;
+    Messages            messages;
+    Image::WriteOptions options;
+    GammaCurvePtr       gamma;
+    IntEncoder          encoder;
+    bool                premul;
+    bool                use_color;
+    bool                use_alpha;
+    int                 bpcc;
+    unsigned int        maxValue;
+    unsigned int        mult;
+    unsigned int        shift;
+    int                 row;
+    size_t              pixelBytes;
+    size_t              rowBytes;
+    bool                wroteEnd;
+    std::unique_ptr<png_byte[]> row_ptr;
+
+    Data() : info_ptr(nullptr), png_ptr(nullptr), row(0), wroteEnd(false) {}
+    ~Data() { if (png_ptr != nullptr) png_destroy_write_struct(&png_ptr, &info_ptr); }
+};
+
+RowWriter::RowWriter (OStream *file, const Image *image, const Image::WriteOptions& options) :
+    mData(new Data)
 {
     int             png_stride;
     int             width = image->GetWidth() ;
     int             height = image->GetHeight() ;
-    int             bpcc = options.bitsPerChannel;
-    bool            use_alpha = image->HasTransparency() && options.AlphaIsEnabled();
-    unsigned int    octetDepth = ((bpcc + 7) / 8);
-    unsigned int    bitDepth = 8 * octetDepth;
-    unsigned int    alpha;
-    unsigned int    r;
-    unsigned int    g;
-    unsigned int    b;
-    unsigned int    maxValue;
-    unsigned int    mult;
-    unsigned int    shift;
-    png_info        *info_ptr = nullptr;
-    png_struct      *png_ptr  = nullptr;
-    Messages        messages;
-    GammaCurvePtr   gamma;
+    int&            bpcc = mData->bpcc;
+    unsigned int    octetDepth;
+    unsigned int    bitDepth;
+    png_info*&      info_ptr = mData->info_ptr;
+    png_struct*&    png_ptr  = mData->png_ptr;
     Metadata        meta;
-    DitherStrategy& dither = *options.ditherStrategy;
+
+    mData->options = options;
+    mData->use_alpha = image->HasTransparency() && options.AlphaIsEnabled();
 
     // PNG/W3C recommends to use sRGB color space
-    gamma = options.GetTranscodingGammaCurve(SRGBGammaCurve::Get());
+    mData->gamma = options.GetTranscodingGammaCurve(SRGBGammaCurve::Get());
 
     // PNG is specified to use non-premultiplied alpha, so that's the way we do it unless the user overrides
     // (e.g. to handle a non-compliant file).
-    bool premul = options.AlphaIsPremultiplied(false);
+    mData->premul = options.AlphaIsPremultiplied(false);
 
+    bpcc = options.bitsPerChannel;
     if (bpcc <= 0)
         bpcc = image->GetMaxIntValue() == 65535 ? 16 : 8 ;
     else if (bpcc > 16)
         bpcc = 16 ;
 
-    maxValue = (1<<bpcc)-1;
+    octetDepth = ((bpcc + 7) / 8);
+    bitDepth = 8 * octetDepth;
+    mData->maxValue = (1<<bpcc)-1;
+    mData->encoder = IntEncoder(mData->gamma, mData->maxValue);
 
-    if ((png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, (png_voidp)(&messages), png_pov_err, png_pov_warn)) == nullptr)
+    // NB: png_pov_err throws an exception, so libpng never gets to longjmp back here
+    if ((png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, (png_voidp)(&mData->messages), png_pov_err, png_pov_warn)) == nullptr)
         throw POV_EXCEPTION(kOutOfMemoryErr, "Cannot allocate PNG data structures");
     if ((info_ptr = png_create_info_struct(png_ptr)) == nullptr)
         throw POV_EXCEPTION(kOutOfMemoryErr, "Cannot allocate PNG data structures");
 
-    if (setjmp(png_jmpbuf(png_ptr)))
-    {
-        // If we get here, we had a problem writing the file
-        png_destroy_write_struct(&png_ptr, &info_ptr);
-        throw POV_EXCEPTION(kFileDataErr, "Error writing PNG file") ;
-    }
-
     // Set up the compression structure
     png_set_write_fn (png_ptr, file, png_pov_write_data, png_pov_flush_data);
 
-    bool use_color = !(image->IsGrayscale() | options.grayscale);
+    mData->use_color = !(image->IsGrayscale() | options.grayscale);
+    bool use_color = mData->use_color;
+    bool use_alpha = mData->use_alpha;
 
     // Fill in the relevant image information
     png_set_IHDR(png_ptr, info_ptr,
@@ -748,7 +896,7 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
 #endif // PNG_WRITE_sBIT_SUPPORTED
 
 #if defined(PNG_WRITE_gAMA_SUPPORTED)
-    png_set_gAMA(png_ptr, info_ptr, 1.0f / (options.workingGamma->ApproximateDecodingGamma() * gamma->ApproximateDecodingGamma()));
+    png_set_gAMA(png_ptr, info_ptr, 1.0f / (options.workingGamma->ApproximateDecodingGamma() * mData->gamma->ApproximateDecodingGamma()));
 #endif // PNG_WRITE_gAMA_SUPPORTED
 
 #if defined(PNG_WRITE_sRGB_SUPPORTED)
@@ -798,61 +946,157 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
         png_stride++;
     png_stride *= octetDepth;
 
-    std::unique_ptr<png_byte[]> row_ptr(new png_byte[width*png_stride]);
+    mData->pixelBytes = png_stride;
+    mData->rowBytes = size_t(width) * png_stride;
+    mData->row_ptr.reset(new png_byte[width*png_stride]);
 
     int repeat = (bitDepth + bpcc - 1) / bpcc;
-    shift = (bpcc * repeat) - bitDepth;
-    mult = 0x01;
+    mData->shift = (bpcc * repeat) - bitDepth;
+    mData->mult = 0x01;
     for (int i = 1; i < repeat; ++i)
-        mult = (mult << bpcc) | 0x01;
+        mData->mult = (mData->mult << bpcc) | 0x01;
+}
 
-    for (int row = 0 ; row < height ; row++)
+RowWriter::~RowWriter()
+{
+}
+
+void RowWriter::WriteRow (const Image *image)
+{
+    int row = mData->row++;
+    EncodeRow(image, row, mData->row_ptr.get());
+
+    // Write out a scanline
+    png_write_row (mData->png_ptr, mData->row_ptr.get());
+}
+
+void RowWriter::WriteImage (const Image *image)
+{
+    int     height = image->GetHeight();
+    size_t  rowBytes = mData->rowBytes;
+    size_t  filteredRowBytes = rowBytes + 1;
+    int     rowsPerSegment = int(max(size_t(1), PARALLEL_SEGMENT_SIZE / filteredRowBytes));
+
+    if ((mData->row != 0) || (height <= rowsPerSegment) || (JobGroup::Concurrency() < 2))
     {
-        auto p = row_ptr.get();
-        for (int col = 0; col < width; ++col)
-        {
-            if (use_color && use_alpha)
-                GetEncodedRGBAValue(image, col, row, gamma, maxValue, r, g, b, alpha, dither, premul);
-            else if (use_color)
-                GetEncodedRGBValue(image, col, row, gamma, maxValue, r, g, b, dither);
-            else if (use_alpha)
-                GetEncodedGrayAValue(image, col, row, gamma, maxValue, g, alpha, dither, premul);
-            else
-                g = GetEncodedGrayValue(image, col, row, gamma, maxValue, dither);
+        while (mData->row < height)
+            WriteRow(image);
+        return;
+    }
 
-            if (use_color)
-            {
-                SetChannelValue(p, (r * mult) >> shift, bpcc);
-                SetChannelValue(p, (g * mult) >> shift, bpcc);
-                SetChannelValue(p, (b * mult) >> shift, bpcc);
-            }
-            else
-            {
-                SetChannelValue(p, (g * mult) >> shift, bpcc);
-            }
+    // encoding stays sequential, as error diffusion dithering depends on the rows processed before
+    vector<png_byte> raw(rowBytes * height);
+    for (int row = 0; row < height; row++)
+        EncodeRow(image, row, &raw[row * rowBytes]);
+    mData->row = height;
 
-            if (use_alpha)
-                SetChannelValue(p, (alpha * mult) >> shift, bpcc);
-        }
+    vector<png_byte> filtered(filteredRowBytes * height);
+    vector<Segment> segments((height + rowsPerSegment - 1) / rowsPerSegment);
+    for (size_t i = 0; i < segments.size(); i++)
+    {
+        Segment& seg = segments[i];
+        seg.raw      = &raw[0];
+        seg.firstRow = int(i) * rowsPerSegment;
+        seg.rows     = min(rowsPerSegment, height - seg.firstRow);
+        seg.filtered = &filtered[seg.firstRow * filteredRowBytes];
+        seg.dictSize = min(DEFLATE_WINDOW, seg.firstRow * filteredRowBytes);
+        seg.dict     = seg.filtered - seg.dictSize;
+        seg.last     = (i == segments.size() - 1);
+        seg.adler    = 0;
+    }
 
-        if (setjmp(png_jmpbuf(png_ptr)))
-        {
-            if (messages.error.length() > 0)
-                throw POV_EXCEPTION(kFileDataErr, messages.error.c_str());
+    // the dictionaries are taken from the preceding segments, so all filtering must be done
+    // before any compression starts
+    JobGroup jobs;
+    for (size_t i = 0; i < segments.size(); i++)
+        jobs.Run(boost::bind(&FilterSegment, &segments[i], rowBytes, mData->pixelBytes));
+    jobs.Wait();
+    for (size_t i = 0; i < segments.size(); i++)
+        jobs.Run(boost::bind(&DeflateSegment, &segments[i], rowBytes));
+    jobs.Wait();
+
+    // stitch the segments together into a single zlib stream, one IDAT chunk per segment
+    static const png_byte zlibHeader[2] = { 0x78, 0x9C };
+    uLong adler = adler32(0, Z_NULL, 0);
+    for (size_t i = 0; i < segments.size(); i++)
+    {
+        Segment& seg = segments[i];
+        adler = adler32_combine(adler, seg.adler, z_off_t(seg.rows * filteredRowBytes));
+        png_byte zlibTrailer[4] = { png_byte(adler >> 24), png_byte(adler >> 16), png_byte(adler >> 8), png_byte(adler) };
+        png_uint_32 length = png_uint_32(seg.output.size() + (i == 0 ? 2 : 0) + (seg.last ? 4 : 0));
+        png_write_chunk_start(mData->png_ptr, reinterpret_cast<png_const_bytep>("IDAT"), length);
+        if (i == 0)
+            png_write_chunk_data(mData->png_ptr, zlibHeader, 2);
+        png_write_chunk_data(mData->png_ptr, &seg.output[0], seg.output.size());
+        if (seg.last)
+            png_write_chunk_data(mData->png_ptr, zlibTrailer, 4);
+        png_write_chunk_end(mData->png_ptr);
+    }
 
-            // If we get here, we had a problem writing the file
-            throw POV_EXCEPTION(kFileDataErr, "Cannot write PNG output data");
+    // libpng doesn't know about the image data we've written, so we must end the file ourselves;
+    // all ancillary chunks have already been written ahead of the image data anyway
+    png_write_chunk(mData->png_ptr, reinterpret_cast<png_const_bytep>("IEND"), nullptr, 0);
+    mData->wroteEnd = true;
+}
+
+void RowWriter::EncodeRow (const Image *image, int row, unsigned char *p)
+{
+    int             width = image->GetWidth() ;
+    int             bpcc = mData->bpcc;
+    bool            use_color = mData->use_color;
+    bool            use_alpha = mData->use_alpha;
+    bool            premul = mData->premul;
+    unsigned int    mult = mData->mult;
+    unsigned int    shift = mData->shift;
+    unsigned int    alpha;
+    unsigned int    r;
+    unsigned int    g;
+    unsigned int    b;
+    const IntEncoder& encoder = mData->encoder;
+    DitherStrategy& dither = *mData->options.ditherStrategy;
+
+    for (int col = 0; col < width; ++col)
+    {
+        if (use_color && use_alpha)
+            GetEncodedRGBAValue(image, col, row, encoder, r, g, b, alpha, dither, premul);
+        else if (use_color)
+            GetEncodedRGBValue(image, col, row, encoder, r, g, b, dither);
+        else if (use_alpha)
+            GetEncodedGrayAValue(image, col, row, encoder, g, alpha, dither, premul);
+        else
+            g = GetEncodedGrayValue(image, col, row, encoder, dither);
+
+        if (use_color)
+        {
+            SetChannelValue(p, (r * mult) >> shift, bpcc);
+            SetChannelValue(p, (g * mult) >> shift, bpcc);
+            SetChannelValue(p, (b * mult) >> shift, bpcc);
+        }
+        else
+        {
+            SetChannelValue(p, (g * mult) >> shift, bpcc);
         }
 
-        // Write out a scanline
-        png_write_row (png_ptr, row_ptr.get());
+        if (use_alpha)
+            SetChannelValue(p, (alpha * mult) >> shift, bpcc);
     }
+}
 
-    if (messages.error.length() > 0)
-        throw messages.error.c_str();
+void RowWriter::Finish()
+{
+    if (mData->messages.error.length() > 0)
+        throw mData->messages.error.c_str();
+
+    if (!mData->wroteEnd)
+        png_write_end(mData->png_ptr, mData->info_ptr);
+    png_destroy_write_struct(&mData->png_ptr, &mData->info_ptr);
+}
 
-    png_write_end(png_ptr, info_ptr);
-    png_destroy_write_struct(&png_ptr, &info_ptr);
+void Write (OStream *file, const Image *image, const Image::WriteOptions& options)
+{
+    RowWriter writer(file, image, options);
+    writer.WriteImage(image);
+    writer.Finish();
 }
 
 } // end of namespace Png
@@ -39,6 +39,9 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "base/configbase.h"
 
+// C++ standard header files
+#include <memory>
+
 // POV-Ray base header files
 #include "base/image/image.h"
 
@@ -54,6 +57,25 @@ namespace Png
 ///
 /// @{
 
+/// Writer emitting a PNG file row by row.
+class RowWriter final : public Image::RowWriter
+{
+    public:
+        RowWriter(OStream *file, const Image *image, const Image::WriteOptions& options);
+        virtual ~RowWriter() override;
+        virtual void WriteRow(const Image *image) override;
+        virtual void Finish() override;
+
+        /// Write all rows of the image at once, compressing them on multiple threads if worthwhile.
+        /// Must be called before any call to @ref WriteRow().
+        void WriteImage(const Image *image);
+    private:
+        struct Data;
+        std::unique_ptr<Data> mData;
+
+        void EncodeRow(const Image *image, int row, unsigned char *p);
+};
+
 void Write(OStream *file, const Image *image, const Image::WriteOptions& options);
 Image *Read(IStream *file, const Image::ReadOptions& options);
 
@@ -132,6 +132,8 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
             file->printf("P6\n");
     }
 
+    IntEncoder encoder(gamma, mask);
+
     // Prepare metadata, as comment in the header
     Metadata meta;
     file->printf("# Software: %s\n", meta.getSoftware().c_str());
@@ -152,7 +154,7 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
         {
             if (grayscale)
             {
-                gray = GetEncodedGrayValue (image, x, y, gamma, mask, dither) ;
+                gray = GetEncodedGrayValue (image, x, y, encoder, dither) ;
 
                 if (plainFormat)
                 {
@@ -172,7 +174,7 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
             }
             else
             {
-                GetEncodedRGBValue(image, x, y, gamma, mask, rval, gval, bval, dither);
+                GetEncodedRGBValue(image, x, y, encoder, rval, gval, bval, dither);
 
                 if (plainFormat)
                 {
@@ -105,9 +105,9 @@ typedef char Targa_extension[495];
 #define EXT_GAMMA_OFF 478
 #define EXT_PIXRATIO_OFF 474
 
-static Pixel *GetPix (const Image *image, int x, int y, Pixel *pixel, const GammaCurvePtr& gamma, DitherStrategy& dither, bool premul)
+static Pixel *GetPix (const Image *image, int x, int y, Pixel *pixel, const IntEncoder& encoder, DitherStrategy& dither, bool premul)
 {
-    GetEncodedRGBAValue (image, x, y, gamma, 255, pixel->r, pixel->g, pixel->b, pixel->a, dither, premul);
+    GetEncodedRGBAValue (image, x, y, encoder, pixel->r, pixel->g, pixel->b, pixel->a, dither, premul);
     return (pixel);
 }
 
@@ -134,6 +134,7 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
 
     // If the user does not specify gamma, we're defaulting to sRGB.
     gamma = options.GetTranscodingGammaCurve(SRGBGammaCurve::Get());
+    IntEncoder encoder(gamma, 255);
 
     // TODO ALPHA - check if TGA should really keep presuming non-premultiplied alpha
     // We presume non-premultiplied alpha, unless the user overrides
@@ -194,11 +195,11 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
             int ptype = 0;
             bool writenow = false;
 
-            GetPix(image, 0, row, &current, gamma, dither, premul);
+            GetPix(image, 0, row, &current, encoder, dither, premul);
             while (true)
             {
                 if (startx + cnt < llen)
-                    GetPix(image, startx + cnt, row, &next, gamma, dither, premul);
+                    GetPix(image, startx + cnt, row, &next, encoder, dither, premul);
                 else
                     next = current;
                 if (memcmp (&current, &next, sizeof (pix)) == 0)
@@ -245,7 +246,7 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
                     {
                         line.push_back ((unsigned char) cnt - 1);
                         for (int x = 0; x < cnt; x++)
-                            PutPix(line, GetPix(image, startx + x, row, &pixel, gamma, dither, premul), opaque);
+                            PutPix(line, GetPix(image, startx + x, row, &pixel, encoder, dither, premul), opaque);
                     }
                     startx += cnt;
                     writenow = false;
@@ -269,7 +270,7 @@ void Write (OStream *file, const Image *image, const Image::WriteOptions& option
         {
             line.clear ();
             for (int col = 0; col < w; ++col)
-                PutPix(line, GetPix(image, col, row, &pixel, gamma, dither, premul), opaque);
+                PutPix(line, GetPix(image, col, row, &pixel, encoder, dither, premul), opaque);
             if (!file->write(&line[0], line.size()))
                 throw POV_EXCEPTION(kFileDataErr, "row write failed for targa file") ;
         }
@@ -0,0 +1,632 @@
+//******************************************************************************
+///
+/// @file base/image/tiledimage.cpp
+///
+/// Implementations related to images paged in from tile cache files.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "base/image/tiledimage.h"
+
+// Standard C++ header files
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <vector>
+
+// Boost header files
+#include <boost/functional/hash.hpp>
+#include <boost/thread.hpp>
+#include <boost/unordered_map.hpp>
+
+// POV-Ray header files (base module)
+#include "base/fileinputoutput.h"
+#include "base/pov_err.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_base
+{
+
+namespace
+{
+
+const char kTileFileMagic[8] = { 'P', 'O', 'V', 'T', 'I', 'L', 'E', '1' };
+
+enum
+{
+    kTileFileFloat          = 0x01, ///< Pixels are stored as 5 floats (RGBFT) rather than 4 16-bit integers (RGBA).
+    kTileFileGrayscale      = 0x02,
+    kTileFileAlpha          = 0x04,
+    kTileFileFilterTransmit = 0x08,
+    kTileFilePremultiplied  = 0x10,
+    kTileFileOpaque         = 0x20,
+};
+
+struct TileFileHeader
+{
+    char        magic[8];   ///< Written last, so that incomplete files are recognized as such.
+    POV_UINT64  signature;
+    POV_UINT32  width;
+    POV_UINT32  height;
+    POV_UINT32  levelCount; ///< Number of resolution levels, including the original image.
+    POV_UINT32  flags;
+};
+
+struct TileFileLevel
+{
+    POV_UINT32  width;
+    POV_UINT32  height;
+    POV_UINT64  offset;     ///< File offset of the level's first tile.
+};
+
+}
+
+/// Tile cache file shared by the resolution levels of a @ref TiledImage.
+class TileFile
+{
+    public:
+
+        TileFile(const UCS2String& filename, const TileFileHeader& header, const vector<TileFileLevel>& levels);
+        ~TileFile();
+
+        /// Gets a pixel of one of the resolution levels, reading the tile from the file if necessary.
+        void GetPixel(unsigned int level, unsigned int x, unsigned int y, float& red, float& green, float& blue, float& filter, float& transm) const;
+
+        /// Reads a tile from the file.
+        void ReadTile(unsigned int level, unsigned int tile, unsigned char *buffer) const;
+
+        bool IsFloat() const { return ((header.flags & kTileFileFloat) != 0); }
+        size_t PixelSize() const { return (IsFloat() ? 5 * sizeof(float) : 4 * sizeof(POV_UINT16)); }
+        size_t TileSize() const { return PixelSize() * TiledImage::kTileSize * TiledImage::kTileSize; }
+
+        TileFileHeader          header;
+        vector<TileFileLevel>   levels;
+
+    protected:
+
+        IFileStream             stream;
+#if POV_MULTITHREADED
+        mutable boost::mutex    streamMutex;
+#endif
+};
+
+namespace
+{
+
+struct TileKey
+{
+    const TileFile *file;
+    unsigned int    level;
+    unsigned int    tile;
+
+    bool operator==(const TileKey& other) const { return (file == other.file) && (level == other.level) && (tile == other.tile); }
+};
+
+std::size_t hash_value(const TileKey& key)
+{
+    std::size_t seed = 0;
+    boost::hash_combine(seed, key.file);
+    boost::hash_combine(seed, key.level);
+    boost::hash_combine(seed, key.tile);
+    return seed;
+}
+
+/// Cache of tiles read from tile cache files, shared by all of them.
+///
+/// To keep threads accessing different tiles from contending for a single lock, the cache is
+/// split into a number of independent shards, each with its own lock and least recently used list.
+///
+class TileCache
+{
+    public:
+
+        /// Gets the cache instance.
+        /// @note   The instance is deliberately never destroyed, as tile files may outlive any static object.
+        static TileCache& GetInstance()
+        {
+            static TileCache *instance = new TileCache();
+            return *instance;
+        }
+
+        /// Copies a pixel from a tile, reading the tile if not cached.
+        void GetPixel(const TileFile& file, unsigned int level, unsigned int tile, size_t offset, unsigned char *pixel);
+
+        /// Discards all tiles of a file.
+        void Purge(const TileFile& file);
+
+    protected:
+
+        static const int kShards = 16;
+
+        struct Tile
+        {
+            TileKey                 key;
+            vector<unsigned char>   data;
+        };
+
+        typedef std::list<Tile> TileList;
+        typedef boost::unordered_map<TileKey, TileList::iterator, boost::hash<TileKey> > TileIndex;
+
+        struct Shard
+        {
+            TileList    tiles;  ///< Cached tiles, most recently used first.
+            TileIndex   index;
+            size_t      size;   ///< Total size of the cached tiles, in bytes.
+#if POV_MULTITHREADED
+            boost::mutex mutex;
+#endif
+            Shard() : size(0) {}
+        };
+
+        Shard shards[kShards];
+};
+
+void TileCache::GetPixel(const TileFile& file, unsigned int level, unsigned int tile, size_t offset, unsigned char *pixel)
+{
+    TileKey key;
+    key.file  = &file;
+    key.level = level;
+    key.tile  = tile;
+    Shard& shard = shards[hash_value(key) % kShards];
+    size_t pixelSize = file.PixelSize();
+
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(shard.mutex);
+#endif
+
+    TileIndex::iterator found = shard.index.find(key);
+    if (found != shard.index.end())
+    {
+        if (found->second != shard.tiles.begin())
+            shard.tiles.splice(shard.tiles.begin(), shard.tiles, found->second);
+        std::memcpy(pixel, &found->second->data[offset], pixelSize);
+        return;
+    }
+
+    Tile newTile;
+    newTile.key = key;
+    shard.tiles.push_front(newTile);
+    Tile& cached = shard.tiles.front();
+    cached.data.resize(file.TileSize());
+    try
+    {
+        file.ReadTile(level, tile, &cached.data[0]);
+    }
+    catch (...)
+    {
+        shard.tiles.pop_front();
+        throw;
+    }
+    shard.index[key] = shard.tiles.begin();
+    shard.size += cached.data.size();
+    std::memcpy(pixel, &cached.data[offset], pixelSize);
+
+    const size_t limit = size_t(POV_IMAGE_TILE_CACHE_SIZE) * 1024 * 1024 / kShards;
+    while ((shard.size > limit) && (shard.tiles.size() > 1))
+    {
+        shard.size -= shard.tiles.back().data.size();
+        shard.index.erase(shard.tiles.back().key);
+        shard.tiles.pop_back();
+    }
+}
+
+void TileCache::Purge(const TileFile& file)
+{
+    for (int i = 0; i < kShards; i++)
+    {
+        Shard& shard = shards[i];
+#if POV_MULTITHREADED
+        boost::mutex::scoped_lock lock(shard.mutex);
+#endif
+        for (TileList::iterator tile = shard.tiles.begin(); tile != shard.tiles.end(); )
+        {
+            if (tile->key.file == &file)
+            {
+                shard.size -= tile->data.size();
+                shard.index.erase(tile->key);
+                tile = shard.tiles.erase(tile);
+            }
+            else
+                ++tile;
+        }
+    }
+}
+
+inline POV_UINT16 QuantizeChannel(float value)
+{
+    return POV_UINT16(std::max(0.0f, std::min(1.0f, value)) * 65535.0f + 0.5f);
+}
+
+void EncodePixel(unsigned char *pixel, bool isFloat, float red, float green, float blue, float filter, float transm)
+{
+    if (isFloat)
+    {
+        float channels[5] = { red, green, blue, filter, transm };
+        std::memcpy(pixel, channels, sizeof(channels));
+    }
+    else
+    {
+        POV_UINT16 channels[4] = { QuantizeChannel(red), QuantizeChannel(green), QuantizeChannel(blue),
+                                   QuantizeChannel(RGBFTColour::FTtoA(filter, transm)) };
+        std::memcpy(pixel, channels, sizeof(channels));
+    }
+}
+
+void DecodePixel(const unsigned char *pixel, bool isFloat, float& red, float& green, float& blue, float& filter, float& transm)
+{
+    if (isFloat)
+    {
+        float channels[5];
+        std::memcpy(channels, pixel, sizeof(channels));
+        red    = channels[0];
+        green  = channels[1];
+        blue   = channels[2];
+        filter = channels[3];
+        transm = channels[4];
+    }
+    else
+    {
+        POV_UINT16 channels[4];
+        std::memcpy(channels, pixel, sizeof(channels));
+        red   = channels[0] / 65535.0f;
+        green = channels[1] / 65535.0f;
+        blue  = channels[2] / 65535.0f;
+        RGBFTColour::AtoFT(channels[3] / 65535.0f, filter, transm);
+    }
+}
+
+Image::ImageDataType TiledImageDataType(const TileFileHeader& header)
+{
+    if ((header.flags & kTileFileFloat) != 0)
+        return Image::RGBFT_Float;
+    else if ((header.flags & kTileFileGrayscale) != 0)
+        return (((header.flags & kTileFileAlpha) != 0) ? Image::GrayA_Int16 : Image::Gray_Int16);
+    else
+        return (((header.flags & kTileFileAlpha) != 0) ? Image::RGBA_Int16 : Image::RGB_Int16);
+}
+
+}
+
+TileFile::TileFile(const UCS2String& filename, const TileFileHeader& h, const vector<TileFileLevel>& l) :
+    header(h),
+    levels(l),
+    stream(filename)
+{
+    if (!stream)
+        throw POV_EXCEPTION(kCannotOpenFileErr, "Cannot open image tile cache file.");
+}
+
+TileFile::~TileFile()
+{
+    TileCache::GetInstance().Purge(*this);
+}
+
+void TileFile::GetPixel(unsigned int level, unsigned int x, unsigned int y, float& red, float& green, float& blue, float& filter, float& transm) const
+{
+    const TileFileLevel& info = levels[level];
+    POV_IMAGE_ASSERT((x < info.width) && (y < info.height));
+    unsigned int tilesX = (info.width + TiledImage::kTileSize - 1) / TiledImage::kTileSize;
+    unsigned int tile = (y / TiledImage::kTileSize) * tilesX + (x / TiledImage::kTileSize);
+    size_t offset = ((y % TiledImage::kTileSize) * TiledImage::kTileSize + (x % TiledImage::kTileSize)) * PixelSize();
+    unsigned char pixel[5 * sizeof(float)];
+    TileCache::GetInstance().GetPixel(*this, level, tile, offset, pixel);
+    DecodePixel(pixel, IsFloat(), red, green, blue, filter, transm);
+}
+
+void TileFile::ReadTile(unsigned int level, unsigned int tile, unsigned char *buffer) const
+{
+    POV_OFF_T pos = POV_OFF_T(levels[level].offset) + POV_OFF_T(tile) * POV_OFF_T(TileSize());
+
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(streamMutex);
+#endif
+
+    IFileStream& s = const_cast<IFileStream&>(stream);
+    if (!s.seekg(pos) || !s.read(buffer, TileSize()))
+    {
+        s.clearstate();
+        throw POV_EXCEPTION(kFileDataErr, "Cannot read tile from image tile cache file.");
+    }
+}
+
+void TiledImage::Convert(const UCS2String& filename, POV_UINT64 signature, const Image *image)
+{
+    POV_IMAGE_ASSERT(!image->IsIndexed());
+
+    TileFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.signature = signature;
+    header.width     = image->GetWidth();
+    header.height    = image->GetHeight();
+    header.flags     = 0;
+    if (image->IsFloat() || image->HasFilterTransmit())
+        header.flags |= kTileFileFloat;
+    if (image->IsGrayscale())
+        header.flags |= kTileFileGrayscale;
+    if (image->HasAlphaChannel())
+        header.flags |= kTileFileAlpha;
+    if (image->HasFilterTransmit())
+        header.flags |= kTileFileFilterTransmit;
+    if (image->IsPremultiplied())
+        header.flags |= kTileFilePremultiplied;
+    bool isFloat = ((header.flags & kTileFileFloat) != 0);
+    size_t pixelSize = (isFloat ? 5 * sizeof(float) : 4 * sizeof(POV_UINT16));
+    size_t tileSize = pixelSize * kTileSize * kTileSize;
+
+    // Lay out the resolution levels, each one having half the resolution of the previous one.
+    vector<TileFileLevel> levels;
+    TileFileLevel info;
+    info.width  = header.width;
+    info.height = header.height;
+    info.offset = 0;
+    for (;;)
+    {
+        levels.push_back(info);
+        if ((info.width <= 1) && (info.height <= 1))
+            break;
+        info.width  = std::max(info.width  / 2, POV_UINT32(1));
+        info.height = std::max(info.height / 2, POV_UINT32(1));
+    }
+    header.levelCount = levels.size();
+    POV_OFF_T offset = sizeof(TileFileHeader) + levels.size() * sizeof(TileFileLevel);
+    for (size_t i = 0; i < levels.size(); i++)
+    {
+        levels[i].offset = offset;
+        POV_OFF_T tiles = POV_OFF_T((levels[i].width  + kTileSize - 1) / kTileSize) *
+                          POV_OFF_T((levels[i].height + kTileSize - 1) / kTileSize);
+        offset += tiles * tileSize;
+    }
+
+    OStream out(filename);
+    if (!out)
+        throw POV_EXCEPTION(kCannotOpenFileErr, "Cannot create image tile cache file.");
+    out.write(&header, sizeof(header));
+    out.write(&levels[0], levels.size() * sizeof(TileFileLevel));
+
+    // Copy the original image.
+    vector<unsigned char> tile(tileSize);
+    float red, green, blue, filter, transm;
+    bool opaque = true;
+    for (unsigned int ty = 0; ty < header.height; ty += kTileSize)
+    {
+        for (unsigned int tx = 0; tx < header.width; tx += kTileSize)
+        {
+            std::fill(tile.begin(), tile.end(), 0);
+            for (unsigned int y = ty; y < std::min(ty + kTileSize, header.height); y++)
+            {
+                for (unsigned int x = tx; x < std::min(tx + kTileSize, header.width); x++)
+                {
+                    image->GetRGBFTValue(x, y, red, green, blue, filter, transm);
+                    opaque = opaque && (filter == 0.0f) && (transm == 0.0f);
+                    EncodePixel(&tile[((y - ty) * kTileSize + (x - tx)) * pixelSize], isFloat, red, green, blue, filter, transm);
+                }
+            }
+            if (!out.write(&tile[0], tileSize))
+                throw POV_EXCEPTION(kFileDataErr, "Cannot write image tile cache file.");
+        }
+    }
+    if (opaque || !image->HasTransparency())
+        header.flags |= kTileFileOpaque;
+    out.flush();
+
+    // Compute each reduced-resolution copy from the previous level, reading that back from the file.
+    // Each pixel averages the 2x2 (or, for odd sizes, up to 3x3) pixels of the previous level it covers.
+    shared_ptr<TileFile> source(new TileFile(filename, header, levels));
+    RGBFTColour colour;
+    for (size_t level = 1; level < levels.size(); level++)
+    {
+        TiledImage previous(source, level - 1);
+        unsigned int sourceWidth  = levels[level - 1].width;
+        unsigned int sourceHeight = levels[level - 1].height;
+        unsigned int levelWidth   = levels[level].width;
+        unsigned int levelHeight  = levels[level].height;
+
+        for (unsigned int ty = 0; ty < levelHeight; ty += kTileSize)
+        {
+            for (unsigned int tx = 0; tx < levelWidth; tx += kTileSize)
+            {
+                std::fill(tile.begin(), tile.end(), 0);
+                for (unsigned int y = ty; y < std::min(ty + kTileSize, levelHeight); y++)
+                {
+                    unsigned int y0 = (y * sourceHeight) / levelHeight;
+                    unsigned int y1 = ((y + 1) * sourceHeight) / levelHeight;
+                    for (unsigned int x = tx; x < std::min(tx + kTileSize, levelWidth); x++)
+                    {
+                        unsigned int x0 = (x * sourceWidth) / levelWidth;
+                        unsigned int x1 = ((x + 1) * sourceWidth) / levelWidth;
+                        PreciseRGBFTColour sum;
+                        for (unsigned int sy = y0; sy < y1; sy++)
+                        {
+                            for (unsigned int sx = x0; sx < x1; sx++)
+                            {
+                                previous.Image::GetRGBFTValue(sx, sy, colour, true);
+                                sum += PreciseRGBFTColour(colour);
+                            }
+                        }
+                        colour = RGBFTColour(sum / (double)((x1 - x0) * (y1 - y0)));
+                        EncodePixel(&tile[((y - ty) * kTileSize + (x - tx)) * pixelSize], isFloat,
+                                    colour.red(), colour.green(), colour.blue(), colour.filter(), colour.transm());
+                    }
+                }
+                if (!out.write(&tile[0], tileSize))
+                    throw POV_EXCEPTION(kFileDataErr, "Cannot write image tile cache file.");
+            }
+        }
+        out.flush();
+    }
+
+    // Only now mark the file as complete.
+    std::memcpy(header.magic, kTileFileMagic, sizeof(header.magic));
+    out.seekg(0);
+    if (!out.write(&header, sizeof(header)))
+        throw POV_EXCEPTION(kFileDataErr, "Cannot write image tile cache file.");
+    out.flush();
+}
+
+TiledImage *TiledImage::Open(const UCS2String& filename, POV_UINT64 signature)
+{
+    IFileStream in(filename);
+    if (!in)
+        return nullptr;
+
+    TileFileHeader header;
+    if (!in.read(&header, sizeof(header)) ||
+        (std::memcmp(header.magic, kTileFileMagic, sizeof(header.magic)) != 0) ||
+        (header.signature != signature) ||
+        (header.levelCount == 0) || (header.levelCount > 64))
+        return nullptr;
+
+    vector<TileFileLevel> levels(header.levelCount);
+    if (!in.read(&levels[0], levels.size() * sizeof(TileFileLevel)) ||
+        (levels[0].width != header.width) || (levels[0].height != header.height))
+        return nullptr;
+
+    shared_ptr<TileFile> file(new TileFile(filename, header, levels));
+    return new TiledImage(file, 0);
+}
+
+TiledImage::TiledImage(const shared_ptr<TileFile>& f, unsigned int l) :
+    Image(f->levels[l].width, f->levels[l].height, TiledImageDataType(f->header)),
+    file(f),
+    level(l)
+{
+    premultiplied = ((level > 0) || ((file->header.flags & kTileFilePremultiplied) != 0));
+}
+
+TiledImage::~TiledImage()
+{
+}
+
+unsigned int TiledImage::GetLevelCount() const
+{
+    return file->levels.size() - 1;
+}
+
+TiledImage *TiledImage::CreateLevel(unsigned int l) const
+{
+    POV_IMAGE_ASSERT((l > 0) && (l < file->levels.size()));
+    return new TiledImage(file, l);
+}
+
+void TiledImage::ReadOnly() const
+{
+    throw POV_EXCEPTION(kUncategorizedError, "Internal error: Images paged in from tile cache files cannot be modified.");
+}
+
+bool TiledImage::IsOpaque() const
+{
+    return ((file->header.flags & kTileFileOpaque) != 0);
+}
+
+bool TiledImage::IsGrayscale() const
+{
+    return ((file->header.flags & kTileFileGrayscale) != 0);
+}
+
+bool TiledImage::IsColour() const
+{
+    return !IsGrayscale();
+}
+
+bool TiledImage::IsFloat() const
+{
+    return file->IsFloat();
+}
+
+bool TiledImage::IsInt() const
+{
+    return !file->IsFloat();
+}
+
+bool TiledImage::HasAlphaChannel() const
+{
+    return ((file->header.flags & kTileFileAlpha) != 0);
+}
+
+bool TiledImage::HasFilterTransmit() const
+{
+    return ((file->header.flags & kTileFileFilterTransmit) != 0);
+}
+
+unsigned int TiledImage::GetMaxIntValue() const
+{
+    return (file->IsFloat() ? 255 : 65535);
+}
+
+bool TiledImage::GetBitValue(unsigned int x, unsigned int y) const
+{
+    float red, green, blue, filter, transm;
+    GetRGBFTValue(x, y, red, green, blue, filter, transm);
+    return (red * green * blue != 0.0f); // same test as other image containers
+}
+
+float TiledImage::GetGrayValue(unsigned int x, unsigned int y) const
+{
+    float red, green, blue, filter, transm;
+    GetRGBFTValue(x, y, red, green, blue, filter, transm);
+    return RGB2Gray(red, green, blue);
+}
+
+void TiledImage::GetGrayAValue(unsigned int x, unsigned int y, float& gray, float& alpha) const
+{
+    float red, green, blue, filter, transm;
+    GetRGBFTValue(x, y, red, green, blue, filter, transm);
+    gray = RGB2Gray(red, green, blue);
+    alpha = RGBFTColour::FTtoA(filter, transm);
+}
+
+void TiledImage::GetRGBValue(unsigned int x, unsigned int y, float& red, float& green, float& blue) const
+{
+    float filter, transm;
+    GetRGBFTValue(x, y, red, green, blue, filter, transm);
+}
+
+void TiledImage::GetRGBAValue(unsigned int x, unsigned int y, float& red, float& green, float& blue, float& alpha) const
+{
+    float filter, transm;
+    GetRGBFTValue(x, y, red, green, blue, filter, transm);
+    alpha = RGBFTColour::FTtoA(filter, transm);
+}
+
+void TiledImage::GetRGBTValue(unsigned int x, unsigned int y, float& red, float& green, float& blue, float& transm) const
+{
+    float filter;
+    GetRGBFTValue(x, y, red, green, blue, filter, transm);
+    transm = 1.0 - RGBFTColour::FTtoA(filter, transm);
+}
+
+void TiledImage::GetRGBFTValue(unsigned int x, unsigned int y, float& red, float& green, float& blue, float& filter, float& transm) const
+{
+    file->GetPixel(level, x, y, red, green, blue, filter, transm);
+}
+
+}
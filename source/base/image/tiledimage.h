@@ -0,0 +1,161 @@
+//******************************************************************************
+///
+/// @file base/image/tiledimage.h
+///
+/// Declarations related to images paged in from tile cache files.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+
+#ifndef POVRAY_BASE_TILEDIMAGE_H
+#define POVRAY_BASE_TILEDIMAGE_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "base/configbase.h"
+
+// POV-Ray base header files
+#include "base/image/image.h"
+
+namespace pov_base
+{
+
+//##############################################################################
+///
+/// @addtogroup PovBaseImage
+///
+/// @{
+
+class TileFile;
+
+/// Read-only image paged in on demand from a tile cache file.
+///
+/// Very large images need not be held in memory in their entirety: Once converted to a tile
+/// cache file, which stores the image in square tiles along with reduced-resolution copies of
+/// it, individual tiles are read from the file as they are accessed. Tiles are kept in a cache
+/// shared by all such images, the total size of which is bounded by
+/// @ref POV_IMAGE_TILE_CACHE_SIZE.
+///
+/// Pixels are stored in linear encoding, either as 16-bit integer RGBA, or as single-precision
+/// floating-point RGBFT for high dynamic range images and images with filter and transmit.
+///
+class TiledImage : public Image
+{
+    public:
+
+        /// Edge length of the tiles, in pixels.
+        static const unsigned int kTileSize = 64;
+
+        /// Converts an image to a tile cache file.
+        ///
+        /// @param[in]  filename    Name of the cache file to create.
+        /// @param[in]  signature   Value identifying the image, to be checked when opening the file.
+        /// @param[in]  image       Image to convert. Must not be indexed.
+        ///
+        static void Convert(const UCS2String& filename, POV_UINT64 signature, const Image *image);
+
+        /// Opens a tile cache file.
+        ///
+        /// @return     The image, or `nullptr` if the file does not exist, is incomplete, or does not match the signature.
+        ///
+        static TiledImage *Open(const UCS2String& filename, POV_UINT64 signature);
+
+        virtual ~TiledImage();
+
+        /// Gets the number of reduced-resolution copies stored along with the image.
+        unsigned int GetLevelCount() const;
+
+        /// Creates an image accessing one of the reduced-resolution copies.
+        ///
+        /// Each level has half the resolution of the previous one (rounded down), level 1 having
+        /// half the resolution of the original image. The copies use premultiplied alpha.
+        ///
+        TiledImage *CreateLevel(unsigned int level) const;
+
+        bool IsOpaque() const;
+        bool IsGrayscale() const;
+        bool IsColour() const;
+        bool IsFloat() const;
+        bool IsInt() const;
+        bool IsIndexed() const { return false; }
+        bool IsGammaEncoded() const { return false; }
+        bool HasAlphaChannel() const;
+        bool HasFilterTransmit() const;
+        unsigned int GetMaxIntValue() const;
+        bool TryDeferDecoding(GammaCurvePtr&, unsigned int) { return false; }
+
+        bool GetBitValue(unsigned int x, unsigned int y) const;
+        float GetGrayValue(unsigned int x, unsigned int y) const;
+        void GetGrayAValue(unsigned int x, unsigned int y, float& gray, float& alpha) const;
+        void GetRGBValue(unsigned int x, unsigned int y, float& red, float& green, float& blue) const;
+        void GetRGBAValue(unsigned int x, unsigned int y, float& red, float& green, float& blue, float& alpha) const;
+        void GetRGBTValue(unsigned int x, unsigned int y, float& red, float& green, float& blue, float& transm) const;
+        void GetRGBFTValue(unsigned int x, unsigned int y, float& red, float& green, float& blue, float& filter, float& transm) const;
+
+        void SetBitValue(unsigned int, unsigned int, bool) { ReadOnly(); }
+        void SetGrayValue(unsigned int, unsigned int, float) { ReadOnly(); }
+        void SetGrayValue(unsigned int, unsigned int, unsigned int) { ReadOnly(); }
+        void SetGrayAValue(unsigned int, unsigned int, float, float) { ReadOnly(); }
+        void SetGrayAValue(unsigned int, unsigned int, unsigned int, unsigned int) { ReadOnly(); }
+        void SetRGBValue(unsigned int, unsigned int, float, float, float) { ReadOnly(); }
+        void SetRGBValue(unsigned int, unsigned int, unsigned int, unsigned int, unsigned int) { ReadOnly(); }
+        void SetRGBAValue(unsigned int, unsigned int, float, float, float, float) { ReadOnly(); }
+        void SetRGBAValue(unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int) { ReadOnly(); }
+        void SetRGBTValue(unsigned int, unsigned int, float, float, float, float) { ReadOnly(); }
+        void SetRGBTValue(unsigned int, unsigned int, const RGBTColour&) { ReadOnly(); }
+        void SetRGBFTValue(unsigned int, unsigned int, float, float, float, float, float) { ReadOnly(); }
+        void SetRGBFTValue(unsigned int, unsigned int, const RGBFTColour&) { ReadOnly(); }
+
+        void FillBitValue(bool) { ReadOnly(); }
+        void FillGrayValue(float) { ReadOnly(); }
+        void FillGrayValue(unsigned int) { ReadOnly(); }
+        void FillGrayAValue(float, float) { ReadOnly(); }
+        void FillGrayAValue(unsigned int, unsigned int) { ReadOnly(); }
+        void FillRGBValue(float, float, float) { ReadOnly(); }
+        void FillRGBValue(unsigned int, unsigned int, unsigned int) { ReadOnly(); }
+        void FillRGBAValue(float, float, float, float) { ReadOnly(); }
+        void FillRGBAValue(unsigned int, unsigned int, unsigned int, unsigned int) { ReadOnly(); }
+        void FillRGBTValue(float, float, float, float) { ReadOnly(); }
+        void FillRGBFTValue(float, float, float, float, float) { ReadOnly(); }
+
+    protected:
+
+        shared_ptr<TileFile> file;
+        unsigned int level;
+
+        TiledImage(const shared_ptr<TileFile>& f, unsigned int l);
+
+        void ReadOnly() const;
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_BASE_TILEDIMAGE_H
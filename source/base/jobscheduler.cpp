@@ -0,0 +1,418 @@
+//******************************************************************************
+///
+/// @file base/jobscheduler.cpp
+///
+/// Implementations related to the work-stealing job scheduler.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2017 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "base/jobscheduler.h"
+
+// C++ standard header files
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+// Boost header files
+#include <boost/bind.hpp>
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_base
+{
+
+/// A submitted job.
+///
+struct JobGroup::Item
+{
+    boost::function0<void>  job;
+    JobGroup*               group;
+};
+
+/// The process-wide set of worker threads and their queues.
+///
+class JobGroup::Scheduler final
+{
+    public:
+
+        /// Get the scheduler, starting the worker threads on first use.
+        ///
+        /// @note
+        ///     The scheduler is intentionally never destroyed: its workers are idle whenever no
+        ///     job group exists, and joining them from a static destructor would be fragile.
+        ///
+        static Scheduler& Instance();
+
+        void Submit(Item* item);
+
+        /// Run one pending job on the calling thread, if any can be found.
+        ///
+        bool RunOne();
+
+        unsigned int WorkerCount() const { return (unsigned int)mDeques.size(); }
+
+    private:
+
+        class Deque;
+
+        std::vector<Deque*> mDeques;            ///< Per-worker deques.
+        std::deque<Item*> mInjected;            ///< Jobs submitted from outside the workers.
+        boost::mutex mInjectedMutex;            ///< Protects @ref mInjected.
+        std::atomic<int> mQueued;               ///< Number of jobs in any of the queues.
+        std::atomic<unsigned int> mSleeping;    ///< Number of workers waiting for a job.
+        boost::mutex mSleepMutex;               ///< Protects the wait for @ref mWakeUp.
+        boost::condition_variable mWakeUp;      ///< Signalled when a job is submitted while workers sleep.
+
+        Scheduler();
+
+        Item* Find(int self);
+        void Work(int self);
+        static void Execute(Item* item);
+};
+
+/// Lock-free work-stealing deque.
+///
+/// This is the dynamic circular deque by Chase and Lev, in the formulation for the C++11
+/// memory model by Lê, Pop, Cohen and Zappa Nardelli. Only the owning worker may call
+/// @ref Push() and @ref Take(); any thread may call @ref Steal(). Arrays outgrown by the
+/// deque are retired rather than freed, as a thief may still be reading from them.
+///
+class JobGroup::Scheduler::Deque final
+{
+    public:
+
+        Deque();
+        ~Deque();
+
+        void Push(Item* item);
+        Item* Take();
+        Item* Steal();
+
+    private:
+
+        struct Array
+        {
+            explicit Array(std::ptrdiff_t n) : size(n), slots(new std::atomic<Item*>[n]) {}
+            ~Array() { delete[] slots; }
+
+            Item* Get(std::ptrdiff_t i) const { return slots[i & (size - 1)].load(std::memory_order_relaxed); }
+            void Put(std::ptrdiff_t i, Item* item) { slots[i & (size - 1)].store(item, std::memory_order_relaxed); }
+
+            std::ptrdiff_t          size;   ///< Capacity; always a power of two.
+            std::atomic<Item*>*     slots;
+        };
+
+        std::atomic<std::ptrdiff_t> mTop;
+        std::atomic<std::ptrdiff_t> mBottom;
+        std::atomic<Array*> mArray;
+        std::vector<Array*> mRetired;
+};
+
+namespace
+{
+
+/// Index of the worker running on the current thread, or -1 for any other thread.
+thread_local int gCurrentWorker = -1;
+
+}
+
+JobGroup::Scheduler::Deque::Deque() :
+    mTop(0),
+    mBottom(0),
+    mArray(new Array(64))
+{}
+
+JobGroup::Scheduler::Deque::~Deque()
+{
+    delete mArray.load();
+    for (std::vector<Array*>::iterator i = mRetired.begin(); i != mRetired.end(); ++i)
+        delete *i;
+}
+
+void JobGroup::Scheduler::Deque::Push(Item* item)
+{
+    std::ptrdiff_t b = mBottom.load(std::memory_order_relaxed);
+    std::ptrdiff_t t = mTop.load(std::memory_order_acquire);
+    Array* a = mArray.load(std::memory_order_relaxed);
+
+    if (b - t > a->size - 1)
+    {
+        Array* grown = new Array(a->size * 2);
+        for (std::ptrdiff_t i = t; i < b; i++)
+            grown->Put(i, a->Get(i));
+        mRetired.push_back(a);
+        a = grown;
+        mArray.store(a, std::memory_order_release);
+    }
+
+    a->Put(b, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    mBottom.store(b + 1, std::memory_order_relaxed);
+}
+
+JobGroup::Item* JobGroup::Scheduler::Deque::Take()
+{
+    std::ptrdiff_t b = mBottom.load(std::memory_order_relaxed) - 1;
+    Array* a = mArray.load(std::memory_order_relaxed);
+    mBottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t t = mTop.load(std::memory_order_relaxed);
+
+    if (t > b)
+    {
+        // empty
+        mBottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Item* item = a->Get(b);
+    if (t == b)
+    {
+        // last item; race against thieves for it
+        if (!mTop.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            item = nullptr;
+        mBottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return item;
+}
+
+JobGroup::Item* JobGroup::Scheduler::Deque::Steal()
+{
+    std::ptrdiff_t t = mTop.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::ptrdiff_t b = mBottom.load(std::memory_order_acquire);
+
+    if (t >= b)
+        return nullptr;
+
+    Array* a = mArray.load(std::memory_order_acquire);
+    Item* item = a->Get(t);
+    if (!mTop.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr; // lost the race to the owner or another thief
+    return item;
+}
+
+JobGroup::Scheduler& JobGroup::Scheduler::Instance()
+{
+    static Scheduler* instance = new Scheduler();
+    return *instance;
+}
+
+JobGroup::Scheduler::Scheduler() :
+    mQueued(0),
+    mSleeping(0)
+{
+    unsigned int workers = std::max(1u, boost::thread::hardware_concurrency());
+
+    for (unsigned int i = 0; i < workers; i++)
+        mDeques.push_back(new Deque());
+
+    // the threads are detached; see Instance()
+    for (unsigned int i = 0; i < workers; i++)
+        boost::thread(boost::bind(&Scheduler::Work, this, (int)i)).detach();
+}
+
+void JobGroup::Scheduler::Submit(Item* item)
+{
+    mQueued++;
+
+    if (gCurrentWorker >= 0)
+        mDeques[gCurrentWorker]->Push(item);
+    else
+    {
+        boost::mutex::scoped_lock lock(mInjectedMutex);
+        mInjected.push_back(item);
+    }
+
+    if (mSleeping.load() > 0)
+    {
+        boost::mutex::scoped_lock lock(mSleepMutex);
+        mWakeUp.notify_one();
+    }
+}
+
+bool JobGroup::Scheduler::RunOne()
+{
+    Item* item = Find(gCurrentWorker);
+
+    if (item == nullptr)
+        return false;
+
+    Execute(item);
+    return true;
+}
+
+JobGroup::Item* JobGroup::Scheduler::Find(int self)
+{
+    Item* item = nullptr;
+    int workers = (int)mDeques.size();
+
+    if (mQueued.load() <= 0)
+        return nullptr;
+
+    if (self >= 0)
+        item = mDeques[self]->Take();
+
+    if (item == nullptr)
+    {
+        boost::mutex::scoped_lock lock(mInjectedMutex);
+        if (!mInjected.empty())
+        {
+            item = mInjected.front();
+            mInjected.pop_front();
+        }
+    }
+
+    for (int i = 1; (item == nullptr) && (i <= workers); i++)
+        item = mDeques[(self + i + workers) % workers]->Steal();
+
+    if (item != nullptr)
+        mQueued--;
+
+    return item;
+}
+
+void JobGroup::Scheduler::Work(int self)
+{
+    gCurrentWorker = self;
+
+    while (true)
+    {
+        Item* item = Find(self);
+
+        if (item != nullptr)
+        {
+            Execute(item);
+            continue;
+        }
+
+        boost::mutex::scoped_lock lock(mSleepMutex);
+
+        mSleeping++;
+        while (mQueued.load() <= 0)
+            mWakeUp.wait(lock);
+        mSleeping--;
+    }
+}
+
+void JobGroup::Scheduler::Execute(Item* item)
+{
+    std::exception_ptr error;
+    JobGroup* group = item->group;
+
+    try
+    {
+        item->job();
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    delete item;
+
+    group->Finish(error);
+}
+
+JobGroup::JobGroup() :
+    mPending(0)
+{}
+
+JobGroup::~JobGroup()
+{
+    try
+    {
+        Wait();
+    }
+    catch (...)
+    {
+        // errors are only reported by an explicit call to Wait()
+    }
+}
+
+void JobGroup::Run(const boost::function0<void>& job)
+{
+    Item* item = new Item;
+
+    item->job = job;
+    item->group = this;
+
+    mPending++;
+
+    Scheduler::Instance().Submit(item);
+}
+
+void JobGroup::Wait()
+{
+    std::exception_ptr error;
+
+    while (mPending.load() > 0)
+    {
+        if (!Scheduler::Instance().RunOne())
+        {
+            // the remaining jobs are running on other threads; check back now and then
+            // in case they spawn further jobs this thread could help with
+            boost::mutex::scoped_lock lock(mMutex);
+            if (mPending.load() > 0)
+                mDone.timed_wait(lock, boost::posix_time::milliseconds(1));
+        }
+    }
+
+    // taking the lock also makes sure the last job is done touching the group
+    {
+        boost::mutex::scoped_lock lock(mMutex);
+        std::swap(error, mError);
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+unsigned int JobGroup::Concurrency()
+{
+    return Scheduler::Instance().WorkerCount();
+}
+
+void JobGroup::Finish(std::exception_ptr error)
+{
+    // the count is decremented under the lock, so that a waiting thread can't destroy
+    // the group before we are done with it
+    boost::mutex::scoped_lock lock(mMutex);
+
+    if (error && !mError)
+        mError = error;
+
+    if (--mPending == 0)
+        mDone.notify_all();
+}
+
+}
@@ -0,0 +1,128 @@
+//******************************************************************************
+///
+/// @file base/jobscheduler.h
+///
+/// Declarations related to the work-stealing job scheduler.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2017 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_BASE_JOBSCHEDULER_H
+#define POVRAY_BASE_JOBSCHEDULER_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "base/configbase.h"
+
+// C++ standard header files
+#include <atomic>
+#include <exception>
+
+// Boost header files
+#include <boost/function.hpp>
+#include <boost/thread.hpp>
+
+namespace pov_base
+{
+
+//##############################################################################
+///
+/// @defgroup PovBaseJobScheduler Job Scheduler
+/// @ingroup PovBase
+///
+/// @{
+
+/// Set of fine-grained jobs run in parallel on the process-wide work-stealing scheduler.
+///
+/// The scheduler keeps one persistent worker thread per hardware thread. Each worker owns a
+/// lock-free deque: jobs submitted from a worker are pushed onto (and taken back from) the
+/// bottom of that worker's own deque, while idle workers steal from the top of the others'.
+/// Jobs submitted from any other thread go to a shared injection queue.
+///
+/// A thread waiting for a group helps running pending jobs in the meantime, so jobs may
+/// themselves spawn further jobs into a group and wait for them without tying up a thread.
+///
+/// @note
+///     Jobs should not block on anything other than groups of their own; in particular they
+///     must not wait for a @ref pov::Task or for the thread that submitted them.
+///
+class JobGroup final
+{
+    public:
+
+        JobGroup();
+
+        /// Destroy the group, after waiting for all of its jobs.
+        ///
+        /// Errors are silently discarded; call @ref Wait() beforehand to receive them.
+        ///
+        ~JobGroup();
+
+        /// Submit a job.
+        ///
+        /// Any exception thrown by the job is caught, and the first one is re-thrown by @ref Wait().
+        ///
+        void Run(const boost::function0<void>& job);
+
+        /// Wait until all jobs submitted so far are finished.
+        ///
+        /// @note   Any error that occurred in one of the jobs is re-thrown here.
+        ///
+        void Wait();
+
+        /// Check whether all jobs submitted so far are finished.
+        ///
+        bool IsDone() const { return mPending.load() == 0; }
+
+        /// Number of threads that may run jobs concurrently.
+        ///
+        static unsigned int Concurrency();
+
+    private:
+
+        class Scheduler;
+        struct Item;
+
+        std::atomic<unsigned int> mPending;     ///< Number of submitted jobs not finished yet.
+        std::exception_ptr mError;              ///< First error that occurred in a job.
+        boost::mutex mMutex;                    ///< Protects @ref mError.
+        boost::condition_variable mDone;        ///< Signalled when the last pending job is finished.
+
+        void Finish(std::exception_ptr error);
+
+        JobGroup(const JobGroup&) = delete;
+        JobGroup& operator=(const JobGroup&) = delete;
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_BASE_JOBSCHEDULER_H
@@ -0,0 +1,120 @@
+//******************************************************************************
+///
+/// @file base/memoryaccounting.cpp
+///
+/// Implementations related to accounting memory use by subsystem.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "base/memoryaccounting.h"
+
+// C++ standard header files
+#include <atomic>
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_base
+{
+
+namespace
+{
+
+std::atomic<size_t> gCurrent[kMemoryCategories];
+std::atomic<size_t> gPeak[kMemoryCategories];
+std::atomic<size_t> gTotalCurrent(0);
+std::atomic<size_t> gTotalPeak(0);
+
+const char *const kCategoryNames[kMemoryCategories] =
+{
+    "Geometry",
+    "Bounding",
+    "Photons",
+    "Radiosity",
+    "Images",
+    "Parser",
+    "Functions",
+};
+
+void RaisePeak(std::atomic<size_t>& peak, size_t value)
+{
+    size_t old = peak.load(std::memory_order_relaxed);
+    while ((value > old) && !peak.compare_exchange_weak(old, value, std::memory_order_relaxed))
+        ;
+}
+
+}
+
+void MemoryAccounting::Allocate(MemoryCategory category, size_t size)
+{
+    RaisePeak(gPeak[category], gCurrent[category].fetch_add(size, std::memory_order_relaxed) + size);
+    RaisePeak(gTotalPeak, gTotalCurrent.fetch_add(size, std::memory_order_relaxed) + size);
+}
+
+void MemoryAccounting::Release(MemoryCategory category, size_t size)
+{
+    gCurrent[category].fetch_sub(size, std::memory_order_relaxed);
+    gTotalCurrent.fetch_sub(size, std::memory_order_relaxed);
+}
+
+size_t MemoryAccounting::GetCurrent(MemoryCategory category)
+{
+    return gCurrent[category].load(std::memory_order_relaxed);
+}
+
+size_t MemoryAccounting::GetPeak(MemoryCategory category)
+{
+    return gPeak[category].load(std::memory_order_relaxed);
+}
+
+size_t MemoryAccounting::GetTotalCurrent()
+{
+    return gTotalCurrent.load(std::memory_order_relaxed);
+}
+
+size_t MemoryAccounting::GetTotalPeak()
+{
+    return gTotalPeak.load(std::memory_order_relaxed);
+}
+
+void MemoryAccounting::ResetPeaks()
+{
+    for (int i = 0; i < kMemoryCategories; i++)
+        gPeak[i].store(gCurrent[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    gTotalPeak.store(gTotalCurrent.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+const char *MemoryAccounting::GetName(MemoryCategory category)
+{
+    return kCategoryNames[category];
+}
+
+}
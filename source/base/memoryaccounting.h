@@ -0,0 +1,171 @@
+//******************************************************************************
+///
+/// @file base/memoryaccounting.h
+///
+/// Declarations related to accounting memory use by subsystem.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_BASE_MEMORYACCOUNTING_H
+#define POVRAY_BASE_MEMORYACCOUNTING_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "base/configbase.h"
+
+// C++ variants of C standard header files
+#include <cstddef>
+
+// C++ standard header files
+#include <new>
+
+namespace pov_base
+{
+
+//##############################################################################
+///
+/// @defgroup PovBaseMemoryAccounting Memory Accounting
+/// @ingroup PovBase
+///
+/// @{
+
+/// Subsystems memory use is accounted for separately.
+enum MemoryCategory
+{
+    kMemoryGeometry,    ///< Shape data, such as mesh vertices and triangles.
+    kMemoryBounding,    ///< Scene-level bounding hierarchies.
+    kMemoryPhotons,     ///< Photon maps.
+    kMemoryRadiosity,   ///< Radiosity sample cache.
+    kMemoryImages,      ///< Images held in memory, such as image maps and the render output.
+    kMemoryParser,      ///< Temporary data of the parser.
+    kMemoryVM,          ///< Compiled user-defined functions.
+    kMemoryCategories
+};
+
+/// Process-wide accounting of the memory used by the major data structures, by subsystem.
+///
+/// Only the allocations that make up the bulk of each subsystem's memory are accounted for,
+/// so the figures are lower bounds, meant to show which subsystem dominates memory use rather
+/// than to sum up to the process size.
+///
+/// @note   All methods are thread-safe, and cheap enough for allocations of blocks or arrays,
+///         though not for individual small objects.
+///
+class MemoryAccounting final
+{
+    public:
+
+        static void Allocate(MemoryCategory category, size_t size);
+        static void Release(MemoryCategory category, size_t size);
+
+        /// Memory currently in use by a subsystem, in bytes.
+        static size_t GetCurrent(MemoryCategory category);
+
+        /// Highest memory use by a subsystem since the last call to @ref ResetPeaks(), in bytes.
+        static size_t GetPeak(MemoryCategory category);
+
+        /// Memory currently in use by all subsystems together, in bytes.
+        static size_t GetTotalCurrent();
+
+        /// Highest memory use by all subsystems together since the last call to @ref ResetPeaks(), in bytes.
+        static size_t GetTotalPeak();
+
+        /// Start tracking the high-water marks anew from the current memory use.
+        static void ResetPeaks();
+
+        static const char *GetName(MemoryCategory category);
+
+    private:
+
+        /// not available
+        MemoryAccounting();
+};
+
+/// Standard allocator accounting the memory of a container to a subsystem.
+template<typename T, MemoryCategory CATEGORY>
+class MemoryAccountingAllocator
+{
+    public:
+
+        typedef T value_type;
+
+        template<typename U>
+        struct rebind { typedef MemoryAccountingAllocator<U, CATEGORY> other; };
+
+        MemoryAccountingAllocator() {}
+        template<typename U>
+        MemoryAccountingAllocator(const MemoryAccountingAllocator<U, CATEGORY>&) {}
+
+        T *allocate(size_t n)
+        {
+            T *p = static_cast<T*>(::operator new(n * sizeof(T)));
+            MemoryAccounting::Allocate(CATEGORY, n * sizeof(T));
+            return p;
+        }
+
+        void deallocate(T *p, size_t n)
+        {
+            MemoryAccounting::Release(CATEGORY, n * sizeof(T));
+            ::operator delete(p);
+        }
+
+        template<typename U>
+        bool operator==(const MemoryAccountingAllocator<U, CATEGORY>&) const { return true; }
+        template<typename U>
+        bool operator!=(const MemoryAccountingAllocator<U, CATEGORY>&) const { return false; }
+};
+
+/// Base class accounting the memory of each object allocated with `new` to a subsystem.
+///
+/// This is intended for blocks or pools of data, rather than small individual objects.
+///
+template<MemoryCategory CATEGORY>
+struct MemoryAccounted
+{
+    static void *operator new(size_t size)
+    {
+        void *p = ::operator new(size);
+        MemoryAccounting::Allocate(CATEGORY, size);
+        return p;
+    }
+
+    static void operator delete(void *p, size_t size)
+    {
+        MemoryAccounting::Release(CATEGORY, size);
+        ::operator delete(p);
+    }
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_BASE_MEMORYACCOUNTING_H
@@ -0,0 +1,164 @@
+//******************************************************************************
+///
+/// @file base/memoryarena.cpp
+///
+/// Implementations related to region-based memory allocation.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2017 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "base/memoryarena.h"
+
+// C++ variants of C standard header files
+#include <cstring>
+
+// POV-Ray header files (base module)
+#include "base/pov_mem.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_base
+{
+
+/// Header of each block of arena memory.
+///
+/// The union pads the header to the strictest fundamental alignment, so that the payload
+/// immediately following it is suitably aligned as well.
+///
+struct MemoryArena::Block
+{
+    union
+    {
+        Block*      next;
+        long double alignDummy1;
+        long long   alignDummy2;
+        void*       alignDummy3;
+    };
+};
+
+MemoryArena::MemoryArena(MemoryCategory category, size_t blockSize) :
+    mpBlocks(nullptr),
+    mpLargeBlocks(nullptr),
+    mpNext(nullptr),
+    mpEnd(nullptr),
+    mBlockSize(blockSize),
+    mAccountedSize(0),
+    mCategory(category)
+{
+}
+
+MemoryArena::~MemoryArena()
+{
+    FreeBlocks(mpBlocks);
+    FreeBlocks(mpLargeBlocks);
+    MemoryAccounting::Release(mCategory, mAccountedSize);
+}
+
+void* MemoryArena::Allocate(size_t size)
+{
+    // Round up to keep subsequent allocations aligned, too.
+    size = (size + sizeof(Block) - 1) / sizeof(Block) * sizeof(Block);
+    if (size == 0)
+        size = sizeof(Block);
+    if (size > size_t(mpEnd - mpNext))
+        return AllocateBlock(size);
+    void* p = mpNext;
+    mpNext += size;
+    return p;
+}
+
+char* MemoryArena::Duplicate(const char* s)
+{
+    size_t len = std::strlen(s) + 1;
+    char* p = static_cast<char*>(Allocate(len));
+    std::memcpy(p, s, len);
+    return p;
+}
+
+void MemoryArena::Reset()
+{
+    FreeBlocks(mpLargeBlocks);
+    mpLargeBlocks = nullptr;
+
+    size_t retainedSize = 0;
+
+    if (mpBlocks != nullptr)
+    {
+        FreeBlocks(mpBlocks->next);
+        mpBlocks->next = nullptr;
+        mpNext = reinterpret_cast<char*>(mpBlocks + 1);
+        mpEnd  = mpNext + mBlockSize;
+        retainedSize = sizeof(Block) + mBlockSize;
+    }
+
+    MemoryAccounting::Release(mCategory, mAccountedSize - retainedSize);
+    mAccountedSize = retainedSize;
+}
+
+void* MemoryArena::AllocateBlock(size_t size)
+{
+    if (size > mBlockSize / 4)
+    {
+        // Oversized request; give it a block of its own, so that the remainder of the current
+        // regular block stays available.
+        Block* block = reinterpret_cast<Block*>(POV_MALLOC(sizeof(Block) + size, "memory arena"));
+        Account(sizeof(Block) + size);
+        block->next = mpLargeBlocks;
+        mpLargeBlocks = block;
+        return block + 1;
+    }
+
+    Block* block = reinterpret_cast<Block*>(POV_MALLOC(sizeof(Block) + mBlockSize, "memory arena"));
+    Account(sizeof(Block) + mBlockSize);
+    block->next = mpBlocks;
+    mpBlocks = block;
+    mpNext = reinterpret_cast<char*>(block + 1) + size;
+    mpEnd  = reinterpret_cast<char*>(block + 1) + mBlockSize;
+    return block + 1;
+}
+
+void MemoryArena::Account(size_t size)
+{
+    MemoryAccounting::Allocate(mCategory, size);
+    mAccountedSize += size;
+}
+
+void MemoryArena::FreeBlocks(Block* blocks)
+{
+    while (blocks != nullptr)
+    {
+        Block* next = blocks->next;
+        POV_FREE(blocks);
+        blocks = next;
+    }
+}
+
+}
@@ -0,0 +1,137 @@
+//******************************************************************************
+///
+/// @file base/memoryarena.h
+///
+/// Declarations related to region-based memory allocation.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2017 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_BASE_MEMORYARENA_H
+#define POVRAY_BASE_MEMORYARENA_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "base/configbase.h"
+
+// C++ variants of C standard header files
+#include <cstddef>
+
+// POV-Ray header files (base module)
+#include "base/memoryaccounting.h"
+
+namespace pov_base
+{
+
+//##############################################################################
+///
+/// @defgroup PovBaseMemoryArena Memory Arenas
+/// @ingroup PovBase
+///
+/// @{
+
+/// Region-based allocator for short-lived data with a common lifetime.
+///
+/// Memory is handed out by advancing a pointer through large blocks, and is never released
+/// piecemeal; instead, all allocations are discarded together by calling @ref Reset() or by
+/// destroying the arena. This avoids the per-allocation overhead of the general-purpose heap
+/// when building data structures consisting of many small nodes that are thrown away as a whole.
+///
+/// @note
+///     The arena does not run destructors; it is only suitable for plain data.
+///
+/// @note
+///     The arena is not thread-safe.
+///
+class MemoryArena final
+{
+    public:
+
+        /// Create an empty arena.
+        ///
+        /// No memory is allocated until the first request.
+        ///
+        /// @param[in]  category    Subsystem to account the arena's memory to.
+        /// @param[in]  blockSize   Size of the blocks to carve allocations from.
+        ///
+        explicit MemoryArena(MemoryCategory category, size_t blockSize = 64 * 1024);
+
+        /// Destroy the arena, releasing all memory.
+        ///
+        ~MemoryArena();
+
+        /// Allocate a chunk of memory.
+        ///
+        /// The memory is suitably aligned for any fundamental type, and remains valid until the
+        /// next call to @ref Reset().
+        ///
+        void* Allocate(size_t size);
+
+        /// Allocate uninitialized memory for an object of the given type.
+        ///
+        template<typename T>
+        T* Allocate() { return static_cast<T*>(Allocate(sizeof(T))); }
+
+        /// Copy a string into the arena.
+        ///
+        char* Duplicate(const char* s);
+
+        /// Discard all allocations.
+        ///
+        /// One block is retained for re-use, so that an arena repeatedly filled and reset
+        /// settles down to not touching the heap at all.
+        ///
+        void Reset();
+
+    private:
+
+        struct Block;
+
+        Block*  mpBlocks;       ///< Regular blocks, most recent first.
+        Block*  mpLargeBlocks;  ///< Dedicated blocks of oversized allocations.
+        char*   mpNext;
+        char*   mpEnd;
+        size_t  mBlockSize;
+        size_t  mAccountedSize; ///< Total size of all blocks.
+        MemoryCategory mCategory;
+
+        void* AllocateBlock(size_t size);
+        void Account(size_t size);
+        static void FreeBlocks(Block* blocks);
+
+        MemoryArena(const MemoryArena&) = delete;
+        MemoryArena& operator=(const MemoryArena&) = delete;
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_BASE_MEMORYARENA_H
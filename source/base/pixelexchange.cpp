@@ -0,0 +1,107 @@
+//******************************************************************************
+///
+/// @file base/pixelexchange.cpp
+///
+/// Implementations related to handing pixel blocks between render engine and front-end.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2017 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "base/pixelexchange.h"
+
+// C++ standard header files
+#include <map>
+
+// Boost header files
+#include <boost/thread.hpp>
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_base
+{
+
+namespace
+{
+
+struct DepositedBlock
+{
+    const void*             owner;
+    std::vector<RGBTColour> pixels;
+};
+
+typedef std::map<PixelBlockExchange::Handle, DepositedBlock> DepositedBlockMap;
+
+boost::mutex gExchangeMutex;
+DepositedBlockMap gDepositedBlocks;
+PixelBlockExchange::Handle gLastHandle = 0;
+
+}
+
+PixelBlockExchange::Handle PixelBlockExchange::Deposit(const void *owner, std::vector<RGBTColour>& pixels)
+{
+    boost::mutex::scoped_lock lock(gExchangeMutex);
+
+    Handle handle = ++gLastHandle;
+    DepositedBlock& block = gDepositedBlocks[handle];
+    block.owner = owner;
+    block.pixels.swap(pixels);
+
+    return handle;
+}
+
+bool PixelBlockExchange::Withdraw(Handle handle, std::vector<RGBTColour>& pixels)
+{
+    boost::mutex::scoped_lock lock(gExchangeMutex);
+
+    DepositedBlockMap::iterator i(gDepositedBlocks.find(handle));
+    if(i == gDepositedBlocks.end())
+        return false;
+
+    pixels.swap(i->second.pixels);
+    gDepositedBlocks.erase(i);
+
+    return true;
+}
+
+void PixelBlockExchange::Discard(const void *owner)
+{
+    boost::mutex::scoped_lock lock(gExchangeMutex);
+
+    for(DepositedBlockMap::iterator i(gDepositedBlocks.begin()); i != gDepositedBlocks.end();)
+    {
+        if(i->second.owner == owner)
+            gDepositedBlocks.erase(i++);
+        else
+            i++;
+    }
+}
+
+}
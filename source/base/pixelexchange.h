@@ -0,0 +1,107 @@
+//******************************************************************************
+///
+/// @file base/pixelexchange.h
+///
+/// Declarations related to handing pixel blocks between render engine and front-end.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2017 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_BASE_PIXELEXCHANGE_H
+#define POVRAY_BASE_PIXELEXCHANGE_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "base/configbase.h"
+
+// C++ standard header files
+#include <vector>
+
+// POV-Ray base header files
+#include "base/colour.h"
+#include "base/types.h"
+
+namespace pov_base
+{
+
+//##############################################################################
+///
+/// @defgroup PovBasePixelExchange Pixel Block Exchange
+/// @ingroup PovBase
+///
+/// @{
+
+/// Process-wide hand-over point for rendered pixel blocks.
+///
+/// When render engine and front-end share a process, the render engine deposits each rendered
+/// block here and merely sends the returned handle via POVMS, sparing the conversion into a POVMS
+/// float vector, the copy POVMS makes of it, and the conversion back on the receiving side. The
+/// front-end then withdraws the pixels by swapping them out, so no further copy is made.
+///
+/// Blocks whose message never gets handled are discarded along with their owner.
+///
+/// @see @ref POV_SHARED_PIXEL_BLOCKS
+///
+class PixelBlockExchange final
+{
+    public:
+
+        typedef POV_ULONG Handle;
+
+        /// Deposit a pixel block.
+        ///
+        /// @param[in]      owner   Opaque identifier of the depositing party.
+        /// @param[in,out]  pixels  Pixels to deposit; left empty on return.
+        /// @return                 Handle identifying the block; never zero.
+        ///
+        static Handle Deposit(const void *owner, std::vector<RGBTColour>& pixels);
+
+        /// Withdraw a pixel block.
+        ///
+        /// @param[in]      handle  Handle identifying the block.
+        /// @param[out]     pixels  Withdrawn pixels.
+        /// @return                 `false` if the block has already been withdrawn or discarded.
+        ///
+        static bool Withdraw(Handle handle, std::vector<RGBTColour>& pixels);
+
+        /// Discard all blocks still deposited by a given party.
+        ///
+        static void Discard(const void *owner);
+
+    private:
+
+        PixelBlockExchange() = delete;
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_BASE_PIXELEXCHANGE_H
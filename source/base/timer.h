@@ -43,7 +43,23 @@
 #include <boost/thread/xtime.hpp>
 #endif
 
-#if !POV_USE_DEFAULT_TIMER || (POV_MULTITHREADED && !POV_USE_DEFAULT_DELAY)
+namespace pov_base
+{
+
+/// Hardware performance counters supported by @ref HardwareCounters.
+/// @ingroup PovBaseTimer
+enum HardwareCounter
+{
+    kHardwareCycles,            ///< CPU cycles.
+    kHardwareInstructions,      ///< Instructions retired.
+    kHardwareCacheMisses,       ///< Last level cache misses.
+    kHardwareBranchMisses,      ///< Mispredicted branches.
+    kHardwareCounterCount
+};
+
+}
+
+#if !POV_USE_DEFAULT_TIMER || (POV_MULTITHREADED && !POV_USE_DEFAULT_DELAY) || !POV_USE_DEFAULT_HARDWARE_COUNTERS
 #include "syspovtimer.h"
 #endif
 
@@ -188,6 +204,41 @@ class Timer
 
 #endif // POV_USE_DEFAULT_TIMER
 
+#if POV_USE_DEFAULT_HARDWARE_COUNTERS
+
+/// Hardware performance counters of the current thread.
+///
+/// @note
+///     This is a default implementation, for platforms that cannot provide access to the
+///     hardware performance counters. It does not support any counters.
+///
+class HardwareCounters
+{
+    public:
+
+        /// Create and start the counters for the current thread.
+        ///
+        HardwareCounters() {}
+
+        /// Report a counter's count.
+        ///
+        /// This method reports the number of events the current thread has caused since the
+        /// counters' creation or last call to @ref Reset().
+        ///
+        /// @note
+        ///     If the counters were created or reset from a different thread, the result is undefined.
+        ///
+        /// @return     Number of events, or -1 if the counter is not supported.
+        ///
+        inline POV_LONG Elapsed(HardwareCounter) const { return -1; }
+
+        /// Reset the counters.
+        ///
+        inline void Reset() {}
+};
+
+#endif // POV_USE_DEFAULT_HARDWARE_COUNTERS
+
 /// @}
 ///
 //##############################################################################
@@ -40,6 +40,9 @@
 // Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
 #include "core/bounding/boundingbox.h"
 
+#include <algorithm>
+#include <map>
+
 #include "base/pov_err.h"
 
 #include "core/math/matrix.h"
@@ -57,6 +60,10 @@ const int BUNCHING_FACTOR = 4;
 // Initial number of entries in a priority queue.
 const int INITIAL_PRIORITY_QUEUE_SIZE = 256;
 const int BBQ_FIRST_ELEMENT = 1;
+// Number of centroid bins per axis used by the SAH builder.
+const int SAH_BIN_COUNT = 16;
+// Recursion depth beyond which the SAH builder falls back to median splits.
+const int SAH_MAX_DEPTH = 64;
 
 BBOX_TREE *create_bbox_node(int size);
 
@@ -64,6 +71,12 @@ int find_axis(BBOX_TREE **Finite, ptrdiff_t first, ptrdiff_t last);
 void calc_bbox(BoundingBox *BBox, BBOX_TREE **Finite, ptrdiff_t first, ptrdiff_t last);
 void build_area_table(BBOX_TREE **Finite, ptrdiff_t a, ptrdiff_t b, BBoxScalar *areas);
 bool sort_and_split(BBOX_TREE **Root, BBOX_TREE **&Finite, size_t *numOfFiniteObjects, ptrdiff_t first, ptrdiff_t last, size_t& maxfinitecount, BBoxScalar **areaCache);
+BBOX_TREE *sah_split(BBOX_TREE **Finite, ptrdiff_t first, ptrdiff_t last, int depth);
+void add_infinite_objects(BBOX_TREE **Root, bool haveRoot, size_t numOfInfiniteObjects, BBOX_TREE **Infinite);
+void sum_bbox_tree_cost(const BBOX_TREE *Node, BBoxScalar rootArea, unsigned int depth, BBoxTreeStatistics& stats);
+void collect_bounded_elements(const vector<ObjectPtr>& objects, vector<ObjectPtr>& elements);
+bool get_bbox_tree_topology(const BBOX_TREE *Node, const std::map<ObjectPtr, int>& indices, vector<int>& nodes);
+BBOX_TREE *refit_bbox_node(const vector<int>& nodes, size_t& next, const vector<ObjectPtr>& elements);
 
 BBoxPriorityQueue::BBoxPriorityQueue()
 {
@@ -134,6 +147,57 @@ void BBoxPriorityQueue::Clear()
     mQueue.resize(BBQ_FIRST_ELEMENT);
 }
 
+BBoxTraversalStack::BBoxTraversalStack()
+{
+    mStack.reserve(64);
+}
+
+BBoxTraversalStack::~BBoxTraversalStack()
+{}
+
+void BBoxTraversalStack::SortTop(size_t first)
+{
+    // insertion sort, as there are only ever a few elements to sort
+    for (size_t i = first + 1; i < mStack.size(); i++)
+    {
+        Selem e = mStack[i];
+        size_t j = i;
+
+        while ((j > first) && (mStack[j-1].depth < e.depth))
+        {
+            mStack[j] = mStack[j-1];
+            j--;
+        }
+        mStack[j] = e;
+    }
+}
+
+BBoxPacketStack::BBoxPacketStack()
+{
+    mStack.reserve(64);
+    rayinfo.reserve(BBOX_PACKET_SIZE);
+}
+
+BBoxPacketStack::~BBoxPacketStack()
+{}
+
+void BBoxPacketStack::SortTop(size_t first)
+{
+    // insertion sort, as there are only ever a few elements to sort
+    for (size_t i = first + 1; i < mStack.size(); i++)
+    {
+        Selem e = mStack[i];
+        size_t j = i;
+
+        while ((j > first) && (mStack[j-1].depth < e.depth))
+        {
+            mStack[j] = mStack[j-1];
+            j--;
+        }
+        mStack[j] = e;
+    }
+}
+
 void Destroy_BBox_Tree(BBOX_TREE *Node)
 {
     if (Node != nullptr)
@@ -250,7 +314,6 @@ void Recompute_Inverse_BBox(BoundingBox *bbox, const TRANSFORM *trans)
 void Build_BBox_Tree(BBOX_TREE **Root, size_t numOfFiniteObjects, BBOX_TREE **&Finite, size_t numOfInfiniteObjects, BBOX_TREE **Infinite, size_t& maxfinitecount)
 {
     ptrdiff_t low, high;
-    BBOX_TREE *cd, *root;
 
     // This is a resonable guess at the number of finites needed.
     // This array will be reallocated as needed if it isn't.
@@ -272,45 +335,61 @@ void Build_BBox_Tree(BBOX_TREE **Root, size_t numOfFiniteObjects, BBOX_TREE **&F
         }
 
         delete[] areaCache;
+    }
 
-        // Move infinite objects in the first leaf of Root.
-        if(numOfInfiniteObjects > 0)
-        {
-            root = *Root;
-            root->Node = reinterpret_cast<BBOX_TREE **>(POV_REALLOC(root->Node, (root->Entries + 1) * sizeof(BBOX_TREE *), "composite"));
-            POV_MEMMOVE(&(root->Node[1]), &(root->Node[0]), root->Entries * sizeof(BBOX_TREE *));
-            root->Entries++;
-            cd = create_bbox_node(numOfInfiniteObjects);
-            for(size_t i = 0; i < numOfInfiniteObjects; i++)
-                cd->Node[i] = Infinite[i];
+    add_infinite_objects(Root, (numOfFiniteObjects > 0), numOfInfiniteObjects, Infinite);
+}
 
-            calc_bbox(&(cd->BBox), Infinite, 0, numOfInfiniteObjects);
-            root->Node[0] = cd;
-            calc_bbox(&(root->BBox), root->Node, 0, root->Entries);
+// Create a bounding box hierarchy from a given list of finite and
+// infinite elements, choosing the split planes with a binned surface
+// area heuristic. The resulting tree is binary except for the nodes
+// holding the leaves, and can be used anywhere a tree created by
+// Build_BBox_Tree() can.
+void Build_BBox_Tree_SAH(BBOX_TREE **Root, size_t numOfFiniteObjects, BBOX_TREE **Finite, size_t numOfInfiniteObjects, BBOX_TREE **Infinite)
+{
+    if(numOfFiniteObjects > 0)
+        *Root = sah_split(Finite, 0, numOfFiniteObjects, 0);
 
-            // Root and first node are infinite.
-            root->Infinite = true;
-            root->Node[0]->Infinite = true;
-        }
+    add_infinite_objects(Root, (numOfFiniteObjects > 0), numOfInfiniteObjects, Infinite);
+}
+
+// Move infinite objects into the first leaf of Root, creating Root
+// first if there were no finite objects.
+void add_infinite_objects(BBOX_TREE **Root, bool haveRoot, size_t numOfInfiniteObjects, BBOX_TREE **Infinite)
+{
+    BBOX_TREE *cd, *root;
+
+    if(numOfInfiniteObjects == 0)
+        return;
+
+    cd = create_bbox_node(numOfInfiniteObjects);
+    for(size_t i = 0; i < numOfInfiniteObjects; i++)
+        cd->Node[i] = Infinite[i];
+    calc_bbox(&(cd->BBox), Infinite, 0, numOfInfiniteObjects);
+
+    if(haveRoot)
+    {
+        root = *Root;
+        root->Node = reinterpret_cast<BBOX_TREE **>(POV_REALLOC(root->Node, (root->Entries + 1) * sizeof(BBOX_TREE *), "composite"));
+        POV_MEMMOVE(&(root->Node[1]), &(root->Node[0]), root->Entries * sizeof(BBOX_TREE *));
+        root->Entries++;
+        root->Node[0] = cd;
+        calc_bbox(&(root->BBox), root->Node, 0, root->Entries);
+
+        // Root and first node are infinite.
+        root->Infinite = true;
+        root->Node[0]->Infinite = true;
     }
     else
     {
         // There are no finite objects and no Root was created.
-        // Create it now and put all infinite objects into it.
-
-        if(numOfInfiniteObjects > 0)
-        {
-            cd = create_bbox_node(numOfInfiniteObjects);
-            for(size_t i = 0; i < numOfInfiniteObjects; i++)
-                cd->Node[i] = Infinite[i];
-            calc_bbox(&(cd->BBox), Infinite, 0, numOfInfiniteObjects);
-            *Root = cd;
-            (*Root)->Infinite = true;
-        }
+        // Use the node holding all infinite objects as Root.
+        *Root = cd;
+        (*Root)->Infinite = true;
     }
 }
 
-void Build_Bounding_Slabs(BBOX_TREE **Root, vector<ObjectPtr>& objects, unsigned int& numberOfFiniteObjects, unsigned int& numberOfInfiniteObjects, unsigned int& numberOfLightSources)
+void Build_Bounding_Slabs(BBOX_TREE **Root, vector<ObjectPtr>& objects, unsigned int& numberOfFiniteObjects, unsigned int& numberOfInfiniteObjects, unsigned int& numberOfLightSources, BBoxTreeBuildMethod method)
 {
     ptrdiff_t iFinite, iInfinite;
     BBOX_TREE **Finite, **Infinite;
@@ -407,7 +486,10 @@ void Build_Bounding_Slabs(BBOX_TREE **Root, vector<ObjectPtr>& objects, unsigned
     }
 
     // Now build the bounding box tree.
-    Build_BBox_Tree(Root, numberOfFiniteObjects, Finite, numberOfInfiniteObjects, Infinite, maxfinitecount);
+    if(method == kBBoxTreeBuild_BinnedSAH)
+        Build_BBox_Tree_SAH(Root, numberOfFiniteObjects, Finite, numberOfInfiniteObjects, Infinite);
+    else
+        Build_BBox_Tree(Root, numberOfFiniteObjects, Finite, numberOfInfiniteObjects, Infinite, maxfinitecount);
 
     // Get rid of the Finite and Infinite arrays and just use Root.
     if (Finite != nullptr)
@@ -417,6 +499,256 @@ void Build_Bounding_Slabs(BBOX_TREE **Root, vector<ObjectPtr>& objects, unsigned
         delete[] Infinite;
 }
 
+// Gather size and quality figures for a bounding box hierarchy. The cost
+// is the number of bounding box tests a ray passing through the finite
+// part of the scene can be expected to perform, with the probability of
+// a node being visited estimated from its surface area relative to the
+// root's. Nodes flagged as infinite are presumed to be always visited.
+// The object cost likewise estimates the number of elements tested.
+void Get_BBox_Tree_Statistics(const BBOX_TREE *Root, BBoxTreeStatistics& stats)
+{
+    BBoxScalar rootArea = 0.0;
+
+    stats.nodes = 0;
+    stats.leaves = 0;
+    stats.cost = 0.0;
+    stats.objectCost = 0.0;
+    stats.depths.clear();
+    stats.leafSizes.clear();
+
+    if(Root == nullptr)
+        return;
+
+    if(Root->Infinite)
+    {
+        // Use the extent of the finite children, as the root itself is unbounded.
+        for(short i = 0; i < Root->Entries; i++)
+        {
+            if(Root->Node[i]->Infinite == false)
+                rootArea = max(rootArea, BBOX_HALF_AREA(Root->Node[i]->BBox));
+        }
+    }
+    else
+        rootArea = BBOX_HALF_AREA(Root->BBox);
+
+    sum_bbox_tree_cost(Root, rootArea, 0, stats);
+}
+
+void sum_bbox_tree_cost(const BBOX_TREE *Node, BBoxScalar rootArea, unsigned int depth, BBoxTreeStatistics& stats)
+{
+    BBoxScalar probability = 1.0;
+    unsigned int elements = 0;
+
+    if(Node->Entries == 0)
+    {
+        stats.leaves++;
+
+        if(stats.depths.size() <= depth)
+            stats.depths.resize(depth + 1, 0);
+        stats.depths[depth]++;
+
+        if(!Node->Infinite && (rootArea > 0.0))
+            probability = min(BBoxScalar(1.0), BBOX_HALF_AREA(Node->BBox) / rootArea);
+        stats.objectCost += probability;
+        return;
+    }
+
+    stats.nodes++;
+
+    if(!Node->Infinite && (rootArea > 0.0))
+        probability = min(BBoxScalar(1.0), BBOX_HALF_AREA(Node->BBox) / rootArea);
+    stats.cost += probability * Node->Entries;
+
+    for(short i = 0; i < Node->Entries; i++)
+    {
+        if(Node->Node[i]->Entries == 0)
+            elements++;
+        sum_bbox_tree_cost(Node->Node[i], rootArea, depth + 1, stats);
+    }
+
+    if(elements > 0)
+    {
+        if(stats.leafSizes.size() <= elements)
+            stats.leafSizes.resize(elements + 1, 0);
+        stats.leafSizes[elements]++;
+    }
+}
+
+// Get the elements a bounding box hierarchy built from the given objects
+// refers to, in the order Build_Bounding_Slabs() sees them.
+void collect_bounded_elements(const vector<ObjectPtr>& objects, vector<ObjectPtr>& elements)
+{
+    elements.clear();
+    elements.reserve(objects.size());
+
+    for(vector<ObjectPtr>::const_iterator i(objects.begin()); i != objects.end(); i++)
+    {
+        if((*i)->Type & LIGHT_SOURCE_OBJECT)
+        {
+            if((reinterpret_cast<LightSource *>(*i))->children.size() > 0)
+                elements.push_back((reinterpret_cast<LightSource *>(*i))->children[0]);
+        }
+        else
+            elements.push_back(*i);
+    }
+}
+
+// Record the shape of a bounding box hierarchy built from the given
+// objects, so that it can later be re-created by Refit_BBox_Tree(). The
+// topology is left empty if there is no hierarchy or if it refers to
+// anything other than the objects.
+void Get_BBox_Tree_Topology(const BBOX_TREE *Root, const vector<ObjectPtr>& objects, BBoxTreeTopology& topology)
+{
+    vector<ObjectPtr> elements;
+    std::map<ObjectPtr, int> indices;
+    BBoxTreeStatistics stats;
+
+    topology.nodes.clear();
+    topology.elementTypes.clear();
+    topology.builtCost = 0.0;
+
+    if(Root == nullptr)
+        return;
+
+    collect_bounded_elements(objects, elements);
+
+    for(size_t i = 0; i < elements.size(); i++)
+    {
+        indices[elements[i]] = int(i);
+        topology.elementTypes.push_back(elements[i]->Type);
+    }
+
+    if(get_bbox_tree_topology(Root, indices, topology.nodes) == false)
+    {
+        topology.nodes.clear();
+        topology.elementTypes.clear();
+        return;
+    }
+
+    Get_BBox_Tree_Statistics(Root, stats);
+    topology.builtCost = stats.cost;
+}
+
+bool get_bbox_tree_topology(const BBOX_TREE *Node, const std::map<ObjectPtr, int>& indices, vector<int>& nodes)
+{
+    if(Node->Entries == 0)
+    {
+        std::map<ObjectPtr, int>::const_iterator i = indices.find(reinterpret_cast<ObjectPtr>(Node->Node));
+
+        if(i == indices.end())
+            return false;
+
+        nodes.push_back(i->second);
+        return true;
+    }
+
+    nodes.push_back(-int(Node->Entries));
+
+    for(short i = 0; i < Node->Entries; i++)
+    {
+        if(get_bbox_tree_topology(Node->Node[i], indices, nodes) == false)
+            return false;
+    }
+
+    return true;
+}
+
+// Create a bounding box hierarchy of the given topology from the given
+// objects, recomputing the bounding boxes of all inner nodes from those
+// of the objects. Fails if the objects do not match those the topology
+// was recorded from, in which case Root is left untouched.
+bool Refit_BBox_Tree(BBOX_TREE **Root, const vector<ObjectPtr>& objects, const BBoxTreeTopology& topology, unsigned int& numberOfFiniteObjects, unsigned int& numberOfInfiniteObjects)
+{
+    vector<ObjectPtr> elements;
+    BBOX_TREE *root;
+    size_t next = 0;
+
+    if(topology.nodes.empty())
+        return false;
+
+    collect_bounded_elements(objects, elements);
+
+    if(elements.size() != topology.elementTypes.size())
+        return false;
+
+    for(size_t i = 0; i < elements.size(); i++)
+    {
+        if(elements[i]->Type != topology.elementTypes[i])
+            return false;
+    }
+
+    root = refit_bbox_node(topology.nodes, next, elements);
+
+    if((root != nullptr) && (next != topology.nodes.size()))
+    {
+        Destroy_BBox_Tree(root);
+        root = nullptr;
+    }
+
+    if(root == nullptr)
+        return false;
+
+    numberOfFiniteObjects = numberOfInfiniteObjects = 0;
+
+    for(size_t i = 0; i < elements.size(); i++)
+    {
+        if(Test_Flag(elements[i], INFINITE_FLAG))
+            numberOfInfiniteObjects++;
+        else
+            numberOfFiniteObjects++;
+    }
+
+    *Root = root;
+    return true;
+}
+
+BBOX_TREE *refit_bbox_node(const vector<int>& nodes, size_t& next, const vector<ObjectPtr>& elements)
+{
+    BBOX_TREE *node;
+    int code;
+
+    if(next >= nodes.size())
+        return nullptr;
+
+    code = nodes[next++];
+
+    if(code >= 0)
+    {
+        if(code >= int(elements.size()))
+            return nullptr;
+
+        node = create_bbox_node(0);
+        node->BBox = elements[code]->BBox;
+        node->Node = reinterpret_cast<BBOX_TREE **>(elements[code]);
+        node->Infinite = Test_Flag(elements[code], INFINITE_FLAG);
+        return node;
+    }
+
+    node = create_bbox_node(-code);
+
+    for(short i = 0; i < node->Entries; i++)
+    {
+        node->Node[i] = refit_bbox_node(nodes, next, elements);
+
+        if(node->Node[i] == nullptr)
+        {
+            // Only destroy the children created so far.
+            for(short j = 0; j < i; j++)
+                Destroy_BBox_Tree(node->Node[j]);
+            POV_FREE(node->Node);
+            POV_FREE(node);
+            return nullptr;
+        }
+
+        if(node->Node[i]->Infinite)
+            node->Infinite = true;
+    }
+
+    calc_bbox(&(node->BBox), node->Node, 0, node->Entries);
+
+    return node;
+}
+
 bool Intersect_BBox_Tree(BBoxPriorityQueue& pqueue, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, TraceThreadData *Thread)
 {
     int i, found;
@@ -470,7 +802,8 @@ bool Intersect_BBox_Tree(BBoxPriorityQueue& pqueue, const BBOX_TREE *Root, const
     return (found);
 }
 
-bool Intersect_BBox_Tree(BBoxPriorityQueue& pqueue, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, TraceThreadData *Thread)
+template<class Precondition, class Postcondition>
+static bool intersect_bbox_tree(BBoxPriorityQueue& pqueue, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, const Precondition& precondition, const Postcondition& postcondition, TraceThreadData *Thread)
 {
     int i, found;
     DBL Depth;
@@ -526,9 +859,365 @@ bool Intersect_BBox_Tree(BBoxPriorityQueue& pqueue, const BBOX_TREE *Root, const
     return (found);
 }
 
-void Check_And_Enqueue(BBoxPriorityQueue& Queue, const BBOX_TREE *Node, const BoundingBox *BBox, const Rayinfo *rayinfo, RenderStatistics& Stats)
+// Traversal of the bounding box tree with a priority queue, as invoked by Dispatch_Ray_Object_Conditions().
+struct BBoxTreeQueueTraversal
+{
+    BBoxPriorityQueue& pqueue;
+    const BBOX_TREE *root;
+    const Ray& ray;
+    Intersection *bestIsect;
+    TraceThreadData *thread;
+
+    BBoxTreeQueueTraversal(BBoxPriorityQueue& q, const BBOX_TREE *r, const Ray& ry, Intersection *bi, TraceThreadData *t) :
+        pqueue(q), root(r), ray(ry), bestIsect(bi), thread(t) {}
+
+    template<class Precondition, class Postcondition>
+    bool operator()(const Precondition& precondition, const Postcondition& postcondition)
+    {
+        return intersect_bbox_tree(pqueue, root, ray, bestIsect, precondition, postcondition, thread);
+    }
+};
+
+bool Intersect_BBox_Tree(BBoxPriorityQueue& pqueue, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, TraceThreadData *Thread)
+{
+    BBoxTreeQueueTraversal traversal(pqueue, Root, ray, Best_Intersection, Thread);
+    return Dispatch_Ray_Object_Conditions(ray, precondition, postcondition, traversal);
+}
+
+bool Intersect_BBox_Tree(BBoxTraversalStack& stack, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, TraceThreadData *Thread)
+{
+    int i, found;
+    size_t first;
+    DBL Depth;
+    const BBOX_TREE *Node;
+    Intersection New_Intersection;
+
+    // Create the direction vectors for this ray.
+    Rayinfo rayinfo(ray);
+
+    // Start with an empty stack.
+    stack.Clear();
+    New_Intersection.Object = nullptr;
+    found = false;
+
+    // Check top node.
+    if(Intersect_BBox_Node(Root, &Root->BBox, &rayinfo, Depth, Thread->Stats()))
+        stack.Push(Depth, Root);
+
+    // Check elements on the stack.
+    while(stack.Pop(Depth, Node))
+    {
+        // If the current box is entered beyond the best intersection found so
+        // far, skip it; unlike with the priority queue, boxes further down the
+        // stack may still be closer.
+        if(Depth > Best_Intersection->Depth)
+            continue;
+
+        // Check current node.
+        if(Node->Entries)
+        {
+            // This is a node containing leaves to be checked; push those
+            // hit by the ray, ordered so that the nearest one is on top.
+            first = stack.Size();
+            for (i = 0; i < Node->Entries; i++)
+            {
+                if(Intersect_BBox_Node(Node->Node[i], &Node->Node[i]->BBox, &rayinfo, Depth, Thread->Stats()) &&
+                   (Depth <= Best_Intersection->Depth))
+                    stack.Push(Depth, Node->Node[i]);
+            }
+            stack.SortTop(first);
+        }
+        else
+        {
+            // This is a leaf so test contained object.
+            if(Find_Intersection(&New_Intersection, reinterpret_cast<ObjectPtr>(Node->Node), ray, Thread))
+            {
+                if(New_Intersection.Depth < Best_Intersection->Depth)
+                {
+                    *Best_Intersection = New_Intersection;
+                    found = true;
+                }
+            }
+        }
+    }
+
+    return (found);
+}
+
+template<class Precondition, class Postcondition>
+static bool intersect_bbox_tree(BBoxTraversalStack& stack, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, const Precondition& precondition, const Postcondition& postcondition, TraceThreadData *Thread)
+{
+    int i, found;
+    size_t first;
+    DBL Depth;
+    const BBOX_TREE *Node;
+    Intersection New_Intersection;
+
+    // Create the direction vectors for this ray.
+    Rayinfo rayinfo(ray);
+
+    // Start with an empty stack.
+    stack.Clear();
+    New_Intersection.Object = nullptr;
+    found = false;
+
+    // Check top node.
+    if(Intersect_BBox_Node(Root, &Root->BBox, &rayinfo, Depth, Thread->Stats()))
+        stack.Push(Depth, Root);
+
+    // Check elements on the stack.
+    while(stack.Pop(Depth, Node))
+    {
+        // If the current box is entered beyond the best intersection found so
+        // far, skip it; unlike with the priority queue, boxes further down the
+        // stack may still be closer.
+        if(Depth > Best_Intersection->Depth)
+            continue;
+
+        // Check current node.
+        if(Node->Entries)
+        {
+            // This is a node containing leaves to be checked; push those
+            // hit by the ray, ordered so that the nearest one is on top.
+            first = stack.Size();
+            for (i = 0; i < Node->Entries; i++)
+            {
+                if(Intersect_BBox_Node(Node->Node[i], &Node->Node[i]->BBox, &rayinfo, Depth, Thread->Stats()) &&
+                   (Depth <= Best_Intersection->Depth))
+                    stack.Push(Depth, Node->Node[i]);
+            }
+            stack.SortTop(first);
+        }
+        else
+        {
+            if(precondition(ray, reinterpret_cast<ObjectPtr>(Node->Node), 0.0) == true)
+            {
+                // This is a leaf so test contained object.
+                if(Find_Intersection(&New_Intersection, reinterpret_cast<ObjectPtr>(Node->Node), ray, postcondition, Thread))
+                {
+                    if(New_Intersection.Depth < Best_Intersection->Depth)
+                    {
+                        *Best_Intersection = New_Intersection;
+                        found = true;
+                    }
+                }
+            }
+        }
+    }
+
+    return (found);
+}
+
+// Traversal of the bounding box tree with a stack, as invoked by Dispatch_Ray_Object_Conditions().
+struct BBoxTreeStackTraversal
+{
+    BBoxTraversalStack& stack;
+    const BBOX_TREE *root;
+    const Ray& ray;
+    Intersection *bestIsect;
+    TraceThreadData *thread;
+
+    BBoxTreeStackTraversal(BBoxTraversalStack& s, const BBOX_TREE *r, const Ray& ry, Intersection *bi, TraceThreadData *t) :
+        stack(s), root(r), ray(ry), bestIsect(bi), thread(t) {}
+
+    template<class Precondition, class Postcondition>
+    bool operator()(const Precondition& precondition, const Postcondition& postcondition)
+    {
+        return intersect_bbox_tree(stack, root, ray, bestIsect, precondition, postcondition, thread);
+    }
+};
+
+bool Intersect_BBox_Tree(BBoxTraversalStack& stack, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, TraceThreadData *Thread)
 {
-    DBL dmin, dmax;
+    BBoxTreeStackTraversal traversal(stack, Root, ray, Best_Intersection, Thread);
+    return Dispatch_Ray_Object_Conditions(ray, precondition, postcondition, traversal);
+}
+
+// Find the closest intersections of a packet of up to BBOX_PACKET_SIZE rays
+// in a single traversal of the hierarchy. Each ray's search distance is taken
+// from the Depth of its element in Best_Intersections, which receives the
+// closest intersection found, if any; elements for rays not hitting anything
+// are left unchanged. Returns whether any of the rays hit an object.
+bool Intersect_BBox_Tree_Packet(BBoxPacketStack& stack, const BBOX_TREE *Root, const Ray *rays, size_t count, Intersection *Best_Intersections, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, TraceThreadData *Thread)
+{
+    int i;
+    size_t first, r;
+    unsigned int mask, childMask;
+    DBL Depth, nearest;
+    const BBOX_TREE *Node;
+    ObjectPtr Object;
+    Intersection New_Intersection;
+    bool found;
+
+    POV_ASSERT(count <= BBOX_PACKET_SIZE);
+
+    // Create the direction vectors for the rays.
+    stack.rayinfo.clear();
+    for (r = 0; r < count; r++)
+        stack.rayinfo.push_back(Rayinfo(rays[r]));
+
+    // Start with an empty stack.
+    stack.Clear();
+    New_Intersection.Object = nullptr;
+    found = false;
+
+    // Check top node.
+    mask = 0;
+    nearest = BOUND_HUGE;
+    for (r = 0; r < count; r++)
+    {
+        if(Intersect_BBox_Node(Root, &Root->BBox, &stack.rayinfo[r], Depth, Thread->Stats()) &&
+           (Depth <= Best_Intersections[r].Depth))
+        {
+            mask |= (1u << r);
+            nearest = min(nearest, Depth);
+        }
+    }
+    if(mask != 0)
+        stack.Push(nearest, mask, Root);
+
+    // Check elements on the stack.
+    while(stack.Pop(mask, Node))
+    {
+        if(Node->Entries)
+        {
+            // This is a node containing leaves to be checked; push those
+            // hit by any of the rays still active, along with the subset
+            // of rays hitting them, ordered so that the nearest one is on top.
+            first = stack.Size();
+            for (i = 0; i < Node->Entries; i++)
+            {
+                childMask = 0;
+                nearest = BOUND_HUGE;
+                for (r = 0; r < count; r++)
+                {
+                    if((mask & (1u << r)) &&
+                       Intersect_BBox_Node(Node->Node[i], &Node->Node[i]->BBox, &stack.rayinfo[r], Depth, Thread->Stats()) &&
+                       (Depth <= Best_Intersections[r].Depth))
+                    {
+                        childMask |= (1u << r);
+                        nearest = min(nearest, Depth);
+                    }
+                }
+                if(childMask != 0)
+                    stack.Push(nearest, childMask, Node->Node[i]);
+            }
+            stack.SortTop(first);
+        }
+        else
+        {
+            // This is a leaf so test contained object against each active ray.
+            Object = reinterpret_cast<ObjectPtr>(Node->Node);
+            for (r = 0; r < count; r++)
+            {
+                if((mask & (1u << r)) && (precondition(rays[r], Object, 0.0) == true))
+                {
+                    if(Find_Intersection(&New_Intersection, Object, rays[r], postcondition, Thread))
+                    {
+                        if(New_Intersection.Depth < Best_Intersections[r].Depth)
+                        {
+                            Best_Intersections[r] = New_Intersection;
+                            found = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return (found);
+}
+
+template<class Precondition, class Postcondition>
+static bool intersect_bbox_tree_any(BBoxTraversalStack& stack, const BBOX_TREE *Root, const Ray& ray, Intersection *Any_Intersection, DBL Max_Depth, const Precondition& precondition, const Postcondition& postcondition, const RayObjectCondition& terminate, TraceThreadData *Thread)
+{
+    int i, found;
+    DBL Depth;
+    const BBOX_TREE *Node;
+    Intersection New_Intersection;
+
+    // Create the direction vectors for this ray.
+    Rayinfo rayinfo(ray);
+
+    // Start with an empty stack.
+    stack.Clear();
+    New_Intersection.Object = nullptr;
+    found = false;
+
+    // Check top node.
+    if(Intersect_BBox_Node(Root, &Root->BBox, &rayinfo, Depth, Thread->Stats()) && (Depth <= Max_Depth))
+        stack.Push(Depth, Root);
+
+    // Check elements on the stack.
+    while(stack.Pop(Depth, Node))
+    {
+        // Check current node.
+        if(Node->Entries)
+        {
+            // This is a node containing leaves to be checked; push those
+            // hit by the ray within the search distance.
+            for (i = 0; i < Node->Entries; i++)
+            {
+                if(Intersect_BBox_Node(Node->Node[i], &Node->Node[i]->BBox, &rayinfo, Depth, Thread->Stats()) &&
+                   (Depth <= Max_Depth))
+                    stack.Push(Depth, Node->Node[i]);
+            }
+        }
+        else
+        {
+            if(precondition(ray, reinterpret_cast<ObjectPtr>(Node->Node), 0.0) == true)
+            {
+                // This is a leaf so test contained object.
+                if(Find_Intersection(&New_Intersection, reinterpret_cast<ObjectPtr>(Node->Node), ray, postcondition, Thread) &&
+                   (New_Intersection.Depth < Max_Depth))
+                {
+                    *Any_Intersection = New_Intersection;
+                    found = true;
+
+                    if(terminate(ray, New_Intersection.Object, New_Intersection.Depth) == true)
+                        break;
+                }
+            }
+        }
+    }
+
+    return (found);
+}
+
+// Any-hit traversal of the bounding box tree, as invoked by Dispatch_Ray_Object_Conditions().
+struct BBoxTreeAnyTraversal
+{
+    BBoxTraversalStack& stack;
+    const BBOX_TREE *root;
+    const Ray& ray;
+    Intersection *anyIsect;
+    DBL maxDepth;
+    const RayObjectCondition& terminate;
+    TraceThreadData *thread;
+
+    BBoxTreeAnyTraversal(BBoxTraversalStack& s, const BBOX_TREE *r, const Ray& ry, Intersection *ai, DBL md, const RayObjectCondition& term, TraceThreadData *t) :
+        stack(s), root(r), ray(ry), anyIsect(ai), maxDepth(md), terminate(term), thread(t) {}
+
+    template<class Precondition, class Postcondition>
+    bool operator()(const Precondition& precondition, const Postcondition& postcondition)
+    {
+        return intersect_bbox_tree_any(stack, root, ray, anyIsect, maxDepth, precondition, postcondition, terminate, thread);
+    }
+};
+
+// Find any intersection closer than Max_Depth rather than the closest one.
+// The traversal stops as soon as an intersection satisfying the terminate
+// condition has been found; otherwise Any_Intersection receives one of the
+// intersections found, if any.
+bool Intersect_BBox_Tree_Any(BBoxTraversalStack& stack, const BBOX_TREE *Root, const Ray& ray, Intersection *Any_Intersection, DBL Max_Depth, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, const RayObjectCondition& terminate, TraceThreadData *Thread)
+{
+    BBoxTreeAnyTraversal traversal(stack, Root, ray, Any_Intersection, Max_Depth, terminate, Thread);
+    return Dispatch_Ray_Object_Conditions(ray, precondition, postcondition, traversal);
+}
+
+bool Intersect_BBox_Node(const BBOX_TREE *Node, const BoundingBox *BBox, const Rayinfo *rayinfo, DBL& dmin, RenderStatistics& Stats)
+{
+    DBL dmax;
 
     if(Node->Infinite == false)
     {
@@ -565,7 +1254,7 @@ void Check_And_Enqueue(BBoxPriorityQueue& Queue, const BBOX_TREE *Node, const Bo
                     if(tmax < EPSILON)
                         // The far plane is (at least almost) behind the observer,
                         // so the ray is heading away from the box and can't possibly intersect it.
-                        return;
+                        return false;
                     tmin = (BBox->lowerLeft[dim] - rayinfo->origin[dim]) * rayinfo->invDirection[dim];
                 }
                 else
@@ -575,7 +1264,7 @@ void Check_And_Enqueue(BBoxPriorityQueue& Queue, const BBOX_TREE *Node, const Bo
                     if(tmax < EPSILON)
                         // The far plane is (at least almost) behind the observer,
                         // so the ray is heading away from the box and can't possibly intersect it.
-                        return;
+                        return false;
                     tmin = (BBox->lowerLeft[dim] + BBox->size[dim] - rayinfo->origin[dim]) * rayinfo->invDirection[dim];
                 }
 
@@ -584,20 +1273,20 @@ void Check_And_Enqueue(BBoxPriorityQueue& Queue, const BBOX_TREE *Node, const Bo
                 //
                 //  if (tmax < dmax) dmax = tmax;   // update the overlap lower bound
                 //  if (tmin > dmin) dmin = tmin;   // update the overlap upper bound
-                //  if (dmin > dmax) return;        // detect whether there is no overlap
+                //  if (dmin > dmax) return false;        // detect whether there is no overlap
 
                 if (tmax < dmax)
                 {
                     if (tmin > dmin)
                     {
                         if(tmin > tmax)
-                            return;
+                            return false;
                         dmin = tmin;
                     }
                     else
                     {
                         if(dmin > tmax)
-                            return;
+                            return false;
                     }
                     dmax = tmax;
                 }
@@ -606,7 +1295,7 @@ void Check_And_Enqueue(BBoxPriorityQueue& Queue, const BBOX_TREE *Node, const Bo
                     if(tmin > dmin)
                     {
                         if(tmin > dmax)
-                            return;
+                            return false;
                         dmin = tmin;
                     }
                 }
@@ -618,7 +1307,7 @@ void Check_And_Enqueue(BBoxPriorityQueue& Queue, const BBOX_TREE *Node, const Bo
 
                 if (!IsInRange (rayinfo->origin[dim], BBox->lowerLeft[dim], BBox->lowerLeft[dim] + BBox->size[dim]))
                     // The ray is entirely outside the slab, so it can't possibly hit the bounding box.
-                    return;
+                    return false;
 
                 // The ray is entirely inside the slab, so this slab has no effect on the end result.
             }
@@ -632,7 +1321,15 @@ void Check_And_Enqueue(BBoxPriorityQueue& Queue, const BBOX_TREE *Node, const Bo
         // Set intersection depth to -Max_Distance.
         dmin = -MAX_DISTANCE;
 
-    Queue.Insert (dmin, Node);
+    return true;
+}
+
+void Check_And_Enqueue(BBoxPriorityQueue& Queue, const BBOX_TREE *Node, const BoundingBox *BBox, const Rayinfo *rayinfo, RenderStatistics& Stats)
+{
+    DBL dmin;
+
+    if(Intersect_BBox_Node(Node, BBox, rayinfo, dmin, Stats))
+        Queue.Insert (dmin, Node);
 }
 
 BBOX_TREE *create_bbox_node(int size)
@@ -914,4 +1611,176 @@ bool sort_and_split(BBOX_TREE **Root, BBOX_TREE **&Finite, size_t *numOfFiniteOb
     }
 }
 
+// Orders bounding tree entries by the centroid of their bounding box
+// along a given axis.
+class CentroidLess
+{
+    public:
+        CentroidLess(int axis) : mAxis(axis) {}
+        bool operator()(const BBOX_TREE *a, const BBOX_TREE *b) const
+        {
+            return (BBOX_CENTROID(a->BBox, mAxis) < BBOX_CENTROID(b->BBox, mAxis));
+        }
+    private:
+        int mAxis;
+};
+
+// Tests whether a bounding tree entry falls to the left of a binned split.
+class CentroidBinLess
+{
+    public:
+        CentroidBinLess(int axis, BBoxScalar base, BBoxScalar scale, int bin) : mAxis(axis), mBase(base), mScale(scale), mBin(bin) {}
+        bool operator()(const BBOX_TREE *a) const
+        {
+            return (min(int((BBOX_CENTROID(a->BBox, mAxis) - mBase) * mScale), SAH_BIN_COUNT - 1) <= mBin);
+        }
+    private:
+        int mAxis;
+        BBoxScalar mBase;
+        BBoxScalar mScale;
+        int mBin;
+};
+
+BBOX_TREE *sah_split(BBOX_TREE **Finite, ptrdiff_t first, ptrdiff_t last, int depth)
+{
+    ptrdiff_t i, mid;
+    ptrdiff_t size = last - first;
+    BBOX_TREE *cd;
+
+    // Don't bother to do any further examinations if the BUNCHING_FACTOR is reached.
+    if(size <= BUNCHING_FACTOR)
+    {
+        cd = create_bbox_node(size);
+
+        for(i = 0; i < size; i++)
+            cd->Node[i] = Finite[first+i];
+
+        calc_bbox(&(cd->BBox), Finite, first, last);
+        return cd;
+    }
+
+    BBoxVector3d cmin(BOUND_HUGE), cmax(-BOUND_HUGE);
+    int bestAxis = -1;
+    int bestBin = 0;
+    BBoxScalar bestCost = BOUND_HUGE;
+
+    for(i = first; i < last; i++)
+    {
+        for(int axis = X; axis <= Z; axis++)
+        {
+            BBoxScalar c = BBOX_CENTROID(Finite[i]->BBox, axis);
+            cmin[axis] = min(cmin[axis], c);
+            cmax[axis] = max(cmax[axis], c);
+        }
+    }
+
+    // Sort the centroids into bins and sweep the bin boundaries for the
+    // split minimizing the summed area-weighted entry count of the halves.
+    // Beyond a certain depth we stop trusting the heuristic, to make sure
+    // pathological scenes cannot exhaust the stack.
+    if(depth < SAH_MAX_DEPTH)
+    {
+        for(int axis = X; axis <= Z; axis++)
+        {
+            if(cmax[axis] <= cmin[axis])
+                continue;
+
+            BBoxScalar scale = BBoxScalar(SAH_BIN_COUNT) / (cmax[axis] - cmin[axis]);
+            ptrdiff_t binCount[SAH_BIN_COUNT] = { 0 };
+            BBoxVector3d binMin[SAH_BIN_COUNT], binMax[SAH_BIN_COUNT];
+            BBoxScalar rightCost[SAH_BIN_COUNT];
+
+            for(int b = 0; b < SAH_BIN_COUNT; b++)
+            {
+                binMin[b] = BBoxVector3d(BOUND_HUGE);
+                binMax[b] = BBoxVector3d(-BOUND_HUGE);
+            }
+
+            for(i = first; i < last; i++)
+            {
+                const BoundingBox& bbox = Finite[i]->BBox;
+                int b = min(int((BBOX_CENTROID(bbox, axis) - cmin[axis]) * scale), SAH_BIN_COUNT - 1);
+                binCount[b]++;
+                for(int dim = X; dim <= Z; dim++)
+                {
+                    binMin[b][dim] = min(binMin[b][dim], bbox.lowerLeft[dim]);
+                    binMax[b][dim] = max(binMax[b][dim], bbox.lowerLeft[dim] + bbox.size[dim]);
+                }
+            }
+
+            // rightCost[b] holds the cost of everything in bins b+1 and above.
+            BBoxVector3d smin(BOUND_HUGE), smax(-BOUND_HUGE);
+            ptrdiff_t count = 0;
+            for(int b = SAH_BIN_COUNT - 1; b > 0; b--)
+            {
+                count += binCount[b];
+                smin = min(smin, binMin[b]);
+                smax = max(smax, binMax[b]);
+                rightCost[b-1] = (count > 0 ? BBOX_HALF_AREA(smin, smax) * BBoxScalar(count) : 0.0);
+            }
+
+            smin = BBoxVector3d(BOUND_HUGE);
+            smax = BBoxVector3d(-BOUND_HUGE);
+            count = 0;
+            for(int b = 0; b < SAH_BIN_COUNT - 1; b++)
+            {
+                count += binCount[b];
+                smin = min(smin, binMin[b]);
+                smax = max(smax, binMax[b]);
+
+                // Skip splits leaving one side empty.
+                if((count == 0) || (count == size))
+                    continue;
+
+                BBoxScalar cost = BBOX_HALF_AREA(smin, smax) * BBoxScalar(count) + rightCost[b];
+                if(cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = b;
+                }
+            }
+        }
+    }
+
+    mid = first;
+    if(bestAxis >= 0)
+        mid = std::partition(Finite + first, Finite + last, CentroidBinLess(bestAxis, cmin[bestAxis], BBoxScalar(SAH_BIN_COUNT) / (cmax[bestAxis] - cmin[bestAxis]), bestBin)) - Finite;
+
+    if((mid <= first) || (mid >= last))
+    {
+        // No usable split was found (e.g. because all centroids coincide);
+        // fall back to splitting at the median along the longest axis.
+        mid = first + size / 2;
+        std::nth_element(Finite + first, Finite + mid, Finite + last, CentroidLess(find_axis(Finite, first, last)));
+    }
+
+    BBOX_TREE *left  = sah_split(Finite, first, mid, depth + 1);
+    BBOX_TREE *right = sah_split(Finite, mid, last, depth + 1);
+
+    // Pull up the children of two small sibling nodes, as testing their
+    // boxes directly is cheaper than queuing the siblings themselves.
+    if(left->Entries + right->Entries <= BUNCHING_FACTOR)
+    {
+        cd = create_bbox_node(left->Entries + right->Entries);
+        for(i = 0; i < left->Entries; i++)
+            cd->Node[i] = left->Node[i];
+        for(i = 0; i < right->Entries; i++)
+            cd->Node[left->Entries + i] = right->Node[i];
+        POV_FREE(left->Node);
+        POV_FREE(left);
+        POV_FREE(right->Node);
+        POV_FREE(right);
+    }
+    else
+    {
+        cd = create_bbox_node(2);
+        cd->Node[0] = left;
+        cd->Node[1] = right;
+    }
+    calc_bbox(&(cd->BBox), cd->Node, 0, cd->Entries);
+
+    return cd;
+}
+
 }
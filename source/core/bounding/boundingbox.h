@@ -66,6 +66,10 @@ class TraceThreadData;
 
 #define BBOX_EXTRA_STATS 1
 
+/* Maximum number of rays traversing the hierarchy together as a packet. */
+
+#define BBOX_PACKET_SIZE 16
+
 
 /*****************************************************************************
 * Global typedefs
@@ -264,17 +268,151 @@ class BBoxPriorityQueue
         vector<Qelem> mQueue;
 };
 
+/// Container for BBox subtrees still to be visited in a depth-first traversal.
+///
+/// For closest-hit queries, the children of a node hit by the ray are pushed in far-to-near
+/// order so that the nearest one is visited first. Therefore an intersection is found early,
+/// and subtrees entered beyond it can be skipped, without the overhead of maintaining a heap.
+/// For any-hit queries, the order is irrelevant and the children are pushed unsorted.
+///
+class BBoxTraversalStack
+{
+    public:
+
+        BBoxTraversalStack();
+        ~BBoxTraversalStack();
+
+        inline void Push(DBL depth, ConstBBoxTreePtr node) { Selem e = { depth, node }; mStack.push_back(e); }
+        inline bool Pop(DBL& depth, ConstBBoxTreePtr& node)
+        {
+            if (mStack.empty())
+                return false;
+            depth = mStack.back().depth;
+            node  = mStack.back().node;
+            mStack.pop_back();
+            return true;
+        }
+        inline size_t Size() const { return mStack.size(); }
+        inline void Clear() { mStack.clear(); }
+
+        /// Re-order the elements from index `first` to the top by decreasing depth.
+        void SortTop(size_t first);
+
+    protected:
+
+        struct Selem
+        {
+            DBL depth;
+            ConstBBoxTreePtr node;
+        };
+
+        vector<Selem> mStack;
+};
+
+/// Container for BBox subtrees still to be visited by a packet of rays.
+///
+/// Each element carries a bit mask of the rays in the packet that hit the subtree's bounding
+/// box closer than their nearest intersection found so far; the subtree's contents are only
+/// tested against those rays. As with @ref BBoxTraversalStack, siblings are visited in
+/// near-to-far order, using the nearest entry distance of any ray in the mask.
+///
+class BBoxPacketStack
+{
+    public:
+
+        BBoxPacketStack();
+        ~BBoxPacketStack();
+
+        inline void Push(DBL depth, unsigned int mask, ConstBBoxTreePtr node) { Selem e = { depth, mask, node }; mStack.push_back(e); }
+        inline bool Pop(unsigned int& mask, ConstBBoxTreePtr& node)
+        {
+            if (mStack.empty())
+                return false;
+            mask = mStack.back().mask;
+            node = mStack.back().node;
+            mStack.pop_back();
+            return true;
+        }
+        inline size_t Size() const { return mStack.size(); }
+        inline void Clear() { mStack.clear(); }
+
+        /// Re-order the elements from index `first` to the top by decreasing depth.
+        void SortTop(size_t first);
+
+        /// Per-ray direction data of the packet currently being traversed.
+        vector<Rayinfo> rayinfo;
+
+    protected:
+
+        struct Selem
+        {
+            DBL depth;
+            unsigned int mask;
+            ConstBBoxTreePtr node;
+        };
+
+        vector<Selem> mStack;
+};
+
+/// Strategies available to @ref Build_Bounding_Slabs() for building the hierarchy.
+enum BBoxTreeBuildMethod
+{
+    kBBoxTreeBuild_Slabs,       ///< Sort-and-split build, see @ref Build_BBox_Tree().
+    kBBoxTreeBuild_BinnedSAH,   ///< Binned surface area heuristic build, see @ref Build_BBox_Tree_SAH().
+};
+
+/// Size and quality figures of a bounding box hierarchy.
+///
+/// @note
+///     The same figures are also gathered for BSP trees, see @ref BSPTree::GetStatistics().
+///
+struct BBoxTreeStatistics
+{
+    unsigned int nodes;             ///< Number of inner nodes.
+    unsigned int leaves;            ///< Number of leaves, i.e. bounded elements.
+    DBL cost;                       ///< Expected number of bounding box tests per ray hitting the finite part of the scene.
+    DBL objectCost;                 ///< Expected number of element tests per ray hitting the finite part of the scene.
+    vector<unsigned int> depths;    ///< Number of leaves at each depth, the root being at depth 0.
+    vector<unsigned int> leafSizes; ///< Number of inner nodes directly holding a given number of elements.
+};
+
+/// Shape of a bounding box hierarchy, independent of the bounding boxes themselves.
+///
+/// This allows a hierarchy to be carried over to a scene holding the same elements in the same
+/// order, e.g. the next frame of an animation in which only the objects' transformations change,
+/// by just recomputing the bounding boxes of the inner nodes, see @ref Refit_BBox_Tree().
+///
+struct BBoxTreeTopology
+{
+    /// Nodes in depth-first order; non-negative values denote a leaf holding the element
+    /// of that index, negative values an inner node with that many (negated) children.
+    vector<int> nodes;
+    /// Object type flags of each element, to detect changes in the scene's makeup.
+    vector<int> elementTypes;
+    /// Cost of the hierarchy as originally built, see @ref BBoxTreeStatistics.
+    DBL builtCost;
+};
+
 
 /*****************************************************************************
 * Global functions
 ******************************************************************************/
 
 void Build_BBox_Tree(BBOX_TREE **Root, size_t numOfFiniteObjects, BBOX_TREE **&Finite, size_t numOfInfiniteObjects, BBOX_TREE **Infinite, size_t& maxfinitecount);
-void Build_Bounding_Slabs(BBOX_TREE **Root, vector<ObjectPtr>& objects, unsigned int& numberOfFiniteObjects, unsigned int& numberOfInfiniteObjects, unsigned int& numberOfLightSources);
+void Build_BBox_Tree_SAH(BBOX_TREE **Root, size_t numOfFiniteObjects, BBOX_TREE **Finite, size_t numOfInfiniteObjects, BBOX_TREE **Infinite);
+void Build_Bounding_Slabs(BBOX_TREE **Root, vector<ObjectPtr>& objects, unsigned int& numberOfFiniteObjects, unsigned int& numberOfInfiniteObjects, unsigned int& numberOfLightSources, BBoxTreeBuildMethod method = kBBoxTreeBuild_Slabs);
+void Get_BBox_Tree_Statistics(const BBOX_TREE *Root, BBoxTreeStatistics& stats);
+void Get_BBox_Tree_Topology(const BBOX_TREE *Root, const vector<ObjectPtr>& objects, BBoxTreeTopology& topology);
+bool Refit_BBox_Tree(BBOX_TREE **Root, const vector<ObjectPtr>& objects, const BBoxTreeTopology& topology, unsigned int& numberOfFiniteObjects, unsigned int& numberOfInfiniteObjects);
 
 void Recompute_BBox(BoundingBox *bbox, const TRANSFORM *trans);
 bool Intersect_BBox_Tree(BBoxPriorityQueue& pqueue, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, TraceThreadData *Thread);
 bool Intersect_BBox_Tree(BBoxPriorityQueue& pqueue, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, TraceThreadData *Thread);
+bool Intersect_BBox_Tree(BBoxTraversalStack& stack, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, TraceThreadData *Thread);
+bool Intersect_BBox_Tree(BBoxTraversalStack& stack, const BBOX_TREE *Root, const Ray& ray, Intersection *Best_Intersection, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, TraceThreadData *Thread);
+bool Intersect_BBox_Tree_Packet(BBoxPacketStack& stack, const BBOX_TREE *Root, const Ray *rays, size_t count, Intersection *Best_Intersections, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, TraceThreadData *Thread);
+bool Intersect_BBox_Tree_Any(BBoxTraversalStack& stack, const BBOX_TREE *Root, const Ray& ray, Intersection *Any_Intersection, DBL Max_Depth, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, const RayObjectCondition& terminate, TraceThreadData *Thread);
+bool Intersect_BBox_Node(const BBOX_TREE *Node, const BoundingBox *BBox, const Rayinfo *rayinfo, DBL& Depth, RenderStatistics& Stats);
 void Check_And_Enqueue(BBoxPriorityQueue& Queue, const BBOX_TREE *Node, const BoundingBox *BBox, const Rayinfo *rayinfo, RenderStatistics& Stats);
 void Destroy_BBox_Tree(BBOX_TREE *Node);
 
@@ -289,6 +427,25 @@ inline void BOUNDS_VOLUME(DBL& a, const BoundingBox& b)
     a = b.size[X] * b.size[Y] * b.size[Z];
 }
 
+// Calculate half the surface area of a bounding box.
+inline BBoxScalar BBOX_HALF_AREA(const BoundingBox& b)
+{
+    return b.size[X] * (b.size[Y] + b.size[Z]) + b.size[Y] * b.size[Z];
+}
+
+// Calculate half the surface area of a bounding box given in min/max format.
+inline BBoxScalar BBOX_HALF_AREA(const BBoxVector3d& mins, const BBoxVector3d& maxs)
+{
+    BBoxVector3d len = maxs - mins;
+    return len[X] * (len[Y] + len[Z]) + len[Y] * len[Z];
+}
+
+// Calculate twice the centroid coordinate of a bounding box along the given axis.
+inline BBoxScalar BBOX_CENTROID(const BoundingBox& b, int axis)
+{
+    return 2.0 * b.lowerLeft[axis] + b.size[axis];
+}
+
 /// @}
 ///
 //##############################################################################
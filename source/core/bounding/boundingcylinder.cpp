@@ -36,6 +36,8 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/bounding/boundingcylinder.h"
 
+#include <algorithm>
+
 #include "core/coretypes.h"
 
 // this must be the last file included
@@ -54,15 +56,27 @@ namespace pov
 * Local typedefs
 ******************************************************************************/
 
+/* Ray-only dependant constants. */
+
+typedef struct BCyl_Ray_Struct BCYL_RAY;
+
+struct BCyl_Ray_Struct
+{
+    Vector3d P, D;       /* Ray origin and direction.           */
+    DBL a, b, bb, b2, c; /* Ray constants in the x-z plane.     */
+};
+
 
 
 /*****************************************************************************
 * Static functions
 ******************************************************************************/
 
-static int  intersect_thick_cylinder (const BCYL *BCyl, const vector<BCYL_INT>& rint, const vector<BCYL_INT>& hint, const BCYL_ENTRY *Entry, DBL *dist);
-static void insert_hit (const BCYL_INT *Element, vector<BCYL_INT>& intervals);
-static void intersect_bound_elements (const BCYL *BCyl, vector<BCYL_INT>& rint, vector<BCYL_INT>& hint, const Vector3d& P, const Vector3d& D);
+static int  intersect_thick_cylinder (const BCYL *BCyl, const BCYL_RAY *Ray, const BCYL_ENTRY *Entry, DBL *dist);
+static bool intersect_bound_node (const BCYL_NODE *Node, const BCYL_RAY *Ray);
+static bool compare_hits (const BCYL_INT& a, const BCYL_INT& b);
+static int  count_bound_nodes (int number);
+static int  build_bound_nodes (BCYL *BCyl, int index, int first, int number);
 
 
 /*****************************************************************************
@@ -79,7 +93,8 @@ static void intersect_bound_elements (const BCYL *BCyl, vector<BCYL_INT>& rint,
 *
 * INPUT
 *
-*   BCyl - Pointer to lathe structure
+*   BCyl  - Pointer to lathe structure
+*   Ray   - Current ray
 *   Entry - Segment whos bounding cylinder to intersect
 *   dist  - List of sorted intersection depths
 *
@@ -96,88 +111,114 @@ static void intersect_bound_elements (const BCYL *BCyl, vector<BCYL_INT>& rint,
 * DESCRIPTION
 *
 *   Find all intersections of the current ray with the bounding
-*   cylinder of the given segment. The intersection tests are
-*   done in intersect_bound_elements() and the results stored
-*   in the lathe structure are evaluated here.
+*   cylinder of the given segment, i.e. with its base- and cap-plane
+*   and its inner and outer cylinder.
 *
 * CHANGES
 *
 *   Oct 1996 : Creation.
 *
+*   Oct 2026 : Intersect the planes and cylinders of the segment
+*              directly, as only the segments in leaves of the bounding
+*              hierarchy hit by the ray are tested.
+*
 ******************************************************************************/
 
-static int intersect_thick_cylinder(const BCYL *BCyl, const vector<BCYL_INT>& rint, const vector<BCYL_INT>& hint, const BCYL_ENTRY *Entry, DBL *dist)
+static int intersect_thick_cylinder(const BCYL *BCyl, const BCYL_RAY *Ray, const BCYL_ENTRY *Entry, DBL *dist)
 {
     int i, j, n;
-    DBL k, r, h;
+    DBL d, k, r, h, h1, h2, r1, r2;
 
     n = 0;
 
-    /* Intersect ray with the cap-plane. */
+    h1 = BCyl->height[Entry->h1];
+    h2 = BCyl->height[Entry->h2];
 
-    if (hint[Entry->h2].n)
+    r1 = BCyl->radius[Entry->r1];
+    r2 = BCyl->radius[Entry->r2];
+
+    if ((Ray->D[Y] < -EPSILON) || (Ray->D[Y] > EPSILON))
     {
-        r = hint[Entry->h2].w[0];
+        /* Intersect ray with the cap-plane. */
+
+        k = (h2 - Ray->P[Y]) / Ray->D[Y];
+
+        r = k * (Ray->a * k + Ray->b2) + Ray->c;
 
-        if ((r >= BCyl->radius[Entry->r1]) &&
-            (r <= BCyl->radius[Entry->r2]))
+        if ((r >= r1) && (r <= r2))
         {
-            dist[n++] = hint[Entry->h2].d[0];
+            dist[n++] = k;
         }
-    }
 
-    /* Intersect ray with the base-plane. */
+        /* Intersect ray with the base-plane. */
 
-    if (hint[Entry->h1].n)
-    {
-        r = hint[Entry->h1].w[0];
+        k = (h1 - Ray->P[Y]) / Ray->D[Y];
 
-        if ((r >= BCyl->radius[Entry->r1]) &&
-            (r <= BCyl->radius[Entry->r2]))
+        r = k * (Ray->a * k + Ray->b2) + Ray->c;
+
+        if ((r >= r1) && (r <= r2))
         {
-            dist[n++] = hint[Entry->h1].d[0];
+            dist[n++] = k;
         }
     }
 
     /* Intersect with inner cylinder. */
 
-    if (rint[Entry->r1].n)
+    if (r1 > EPSILON)
     {
-        h = rint[Entry->r1].w[0];
+        d = Ray->bb - Ray->a * (Ray->c - r1);
 
-        if ((h >= BCyl->height[Entry->h1]) &&
-            (h <= BCyl->height[Entry->h2]))
+        if (d > 0.0)
         {
-            dist[n++] = rint[Entry->r1].d[0];
-        }
+            d = sqrt(d);
 
-        h = rint[Entry->r1].w[1];
+            k = (-Ray->b + d) / Ray->a;
 
-        if ((h >= BCyl->height[Entry->h1]) &&
-            (h <= BCyl->height[Entry->h2]))
-        {
-            dist[n++] = rint[Entry->r1].d[1];
+            h = Ray->P[Y] + k * Ray->D[Y];
+
+            if ((h >= h1) && (h <= h2))
+            {
+                dist[n++] = k;
+            }
+
+            k = (-Ray->b - d) / Ray->a;
+
+            h = Ray->P[Y] + k * Ray->D[Y];
+
+            if ((h >= h1) && (h <= h2))
+            {
+                dist[n++] = k;
+            }
         }
     }
 
     /* Intersect with outer cylinder. */
 
-    if (rint[Entry->r2].n)
+    if (r2 > EPSILON)
     {
-        h = rint[Entry->r2].w[0];
+        d = Ray->bb - Ray->a * (Ray->c - r2);
 
-        if ((h >= BCyl->height[Entry->h1]) &&
-            (h <= BCyl->height[Entry->h2]))
+        if (d > 0.0)
         {
-            dist[n++] = rint[Entry->r2].d[0];
-        }
+            d = sqrt(d);
 
-        h = rint[Entry->r2].w[1];
+            k = (-Ray->b + d) / Ray->a;
 
-        if ((h >= BCyl->height[Entry->h1]) &&
-            (h <= BCyl->height[Entry->h2]))
-        {
-            dist[n++] = rint[Entry->r2].d[1];
+            h = Ray->P[Y] + k * Ray->D[Y];
+
+            if ((h >= h1) && (h <= h2))
+            {
+                dist[n++] = k;
+            }
+
+            k = (-Ray->b - d) / Ray->a;
+
+            h = Ray->P[Y] + k * Ray->D[Y];
+
+            if ((h >= h1) && (h <= h2))
+            {
+                dist[n++] = k;
+            }
         }
     }
 
@@ -205,150 +246,121 @@ static int intersect_thick_cylinder(const BCYL *BCyl, const vector<BCYL_INT>& ri
 *
 * FUNCTION
 *
-*   intersect_bound_elements
+*   intersect_bound_node
 *
 * INPUT
 *
-*   BCyl - Pointer to lathe structure
-*   P, D  - Current ray
+*   Node - Node of the bounding hierarchy
+*   Ray  - Current ray
 *
 * OUTPUT
 *
 * RETURNS
 *
+*   bool - true if the ray hits the node's solid cylinder
+*
 * AUTHOR
 *
-*   Dieter Bayer
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   Intersect all bounding discs and cylinders and store
-*   the intersections found in the lathe structure.
-*
-*   By intersecting all different discs and cylinders once
-*   we avoid testing the same cylinders and discs more than
-*   once. This happened when we tested one bounding cylinder
-*   after the other.
+*   Test if the ray passes through the solid cylinder enclosing the
+*   bounding cylinders of a node's segments in front of its origin.
 *
 * CHANGES
 *
-*   Oct 1996 : Creation.
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-static void intersect_bound_elements(const BCYL *BCyl, vector<BCYL_INT>& rint, vector<BCYL_INT>& hint, const Vector3d& P, const Vector3d& D)
+static bool intersect_bound_node(const BCYL_NODE *Node, const BCYL_RAY *Ray)
 {
-    int i;
-    DBL a, b, bb, b2, c, d, k;
-
-    /* Init constants. */
-
-    a = D[X] * D[X] + D[Z] * D[Z];
+    DBL d, k1, k2, tmin, tmax;
 
-    b = P[X] * D[X] + P[Z] * D[Z];
+    /* Clip the ray against the slab between base- and cap-plane. */
 
-    bb = b * b;
-
-    b2 = 2.0 * b;
-
-    c = P[X] * P[X] + P[Z] * P[Z];
-
-    /* Intersect all rings. */
-
-    if ((D[Y] < -EPSILON) || (D[Y] > EPSILON))
+    if ((Ray->D[Y] < -EPSILON) || (Ray->D[Y] > EPSILON))
     {
-        for (i = 0; i < BCyl->nheight; i++)
-        {
-            k = (BCyl->height[i] - P[Y]) / D[Y];
+        k1 = (Node->height1 - Ray->P[Y]) / Ray->D[Y];
+        k2 = (Node->height2 - Ray->P[Y]) / Ray->D[Y];
 
-            hint[i].n = 1;
-
-            hint[i].d[0] = k;
-
-            hint[i].w[0] = k * (a * k + b2) + c;
-        }
+        tmin = min(k1, k2);
+        tmax = max(k1, k2);
     }
     else
     {
-        for (i = 0; i < BCyl->nheight; i++)
+        if ((Ray->P[Y] < Node->height1) || (Ray->P[Y] > Node->height2))
         {
-            hint[i].n = 0;
+            return(false);
         }
+
+        tmin = -BOUND_HUGE;
+        tmax =  BOUND_HUGE;
     }
 
-    /* Intersect all cylinders. */
+    /* Clip the ray against the outer cylinder. */
 
-    for (i = 0; i < BCyl->nradius; i++)
+    if (Ray->a > 0.0)
     {
-        rint[i].n = 0;
+        d = Ray->bb - Ray->a * (Ray->c - Node->radius);
 
-        if (BCyl->radius[i] > EPSILON)
+        if (d <= 0.0)
         {
-            d = bb - a * (c - BCyl->radius[i]);
-
-            if (d > 0.0)
-            {
-                d = sqrt(d);
-
-                k = (-b + d) / a;
-
-                rint[i].n = 2;
-
-                rint[i].d[0] = k;
-
-                rint[i].w[0] = P[Y] + k * D[Y];
-
-                k = (-b - d) / a;
+            return(false);
+        }
 
-                rint[i].d[1] = k;
+        d = sqrt(d);
 
-                rint[i].w[1] = P[Y] + k * D[Y];
-            }
+        tmin = max(tmin, (-Ray->b - d) / Ray->a);
+        tmax = min(tmax, (-Ray->b + d) / Ray->a);
+    }
+    else
+    {
+        if (Ray->c > Node->radius)
+        {
+            return(false);
         }
     }
+
+    return((tmin <= tmax) && (tmax > EPSILON));
 }
 
+
+
 /*****************************************************************************
 *
 * FUNCTION
 *
-*   insert_hit
+*   compare_hits
 *
 * INPUT
 *
-*   element   - Intersection to insert
-*   intervals - List of intervals
-*   cnt       - Number of elements in the list
+*   a, b - Intersections to compare
 *
 * OUTPUT
 *
-*   intervals, cnt
-*
 * RETURNS
 *
+*   bool - true if a is closer than b
+*
 * AUTHOR
 *
-*   Dieter Bayer
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   Insert an intersection into the depth sorted intersection list.
+*   Order intersections by depth.
 *
 * CHANGES
 *
-*   Oct 1996 : Creation.
+*   Oct 2026 : Creation, replacing insert_hit().
 *
 ******************************************************************************/
 
-static void insert_hit(const BCYL_INT *element, vector<BCYL_INT>& intervals)
+static bool compare_hits(const BCYL_INT& a, const BCYL_INT& b)
 {
-    // TODO - a heap-based priority queue might be faster
-
-    vector<BCYL_INT>::iterator k = intervals.begin();
-    while ((k != intervals.end()) && (element->d[0] > k->d[0]))
-        k ++;
-
-    intervals.insert(k, *element);
+    return(a.d[0] < b.d[0]);
 }
 
 
@@ -357,132 +369,297 @@ static void insert_hit(const BCYL_INT *element, vector<BCYL_INT>& intervals)
 *
 * FUNCTION
 *
-*   Intersect_All_Bounds
+*   Intersect_BCyl
 *
 * INPUT
 *
-*   BCyl     - Pointer to lathe structure
+*   BCyl      - Pointer to lathe structure
 *   P, D      - Current ray
 *   intervals - List of intervals
-*   cnt       - Number of elements in the list
 *
 * OUTPUT
 *
-*   intervals, cnt
+*   intervals
 *
 * RETURNS
 *
+*   int - number of intervals
+*
 * AUTHOR
 *
 *   Dieter Bayer
 *
 * DESCRIPTION
 *
-*   Intersect given ray with all bounding cylinders of the given lathe
+*   Intersect given ray with the bounding cylinders of the given lathe
 *   and return a sorted list of intersection depths and segments hit.
 *
+*   Only the bounding cylinders of segments in leaves of the bounding
+*   hierarchy whose solid cylinders the ray passes through are tested.
+*
 * CHANGES
 *
 *   Oct 1996 : Creation.
 *
+*   Oct 2026 : Walk the bounding hierarchy instead of testing all
+*              segments, and sort the hits once.
+*
 ******************************************************************************/
 
-int Intersect_BCyl(const BCYL *BCyl, vector<BCYL_INT>& intervals, vector<BCYL_INT>& rint, vector<BCYL_INT>& hint, const Vector3d& P, const Vector3d& D)
+int Intersect_BCyl(const BCYL *BCyl, vector<BCYL_INT>& intervals, const Vector3d& P, const Vector3d& D)
 {
-    int i;
+    int i, j;
     DBL dist[8];
     BCYL_INT Inter;
     BCYL_ENTRY *Entry;
+    BCYL_NODE *Node;
+    BCYL_RAY Ray;
 
     intervals.clear();
 
     Inter.d[1] = 0.0;
 
-    /* Intersect all cylinder and plane elements. */
+    /* Init constants. */
+
+    Ray.P = P;
+    Ray.D = D;
+
+    Ray.a = D[X] * D[X] + D[Z] * D[Z];
 
-    intersect_bound_elements(BCyl, rint, hint, P, D);
+    Ray.b = P[X] * D[X] + P[Z] * D[Z];
 
-    /* Intersect all spline segments. */
-    for (i = 0; i < BCyl->number; i++)
+    Ray.bb = Ray.b * Ray.b;
+
+    Ray.b2 = 2.0 * Ray.b;
+
+    Ray.c = P[X] * P[X] + P[Z] * P[Z];
+
+    /* Walk the hierarchy, intersecting the spline segments of leaves hit. */
+
+    i = 0;
+
+    while (i < BCyl->nnodes)
     {
-        Entry = &BCyl->entry[i];
+        Node = &BCyl->node[i];
 
-        switch (intersect_thick_cylinder(BCyl, rint, hint, Entry, dist))
+        if (!intersect_bound_node(Node, &Ray))
         {
-            case 0:
-                break;
+            i = Node->skip;
+
+            continue;
+        }
+
+        if (Node->number == 0)
+        {
+            i++;
 
-            case 2:
+            continue;
+        }
+
+        for (j = Node->first; j < Node->first + Node->number; j++)
+        {
+            Entry = &BCyl->entry[j];
+
+            switch (intersect_thick_cylinder(BCyl, &Ray, Entry, dist))
+            {
+                case 0:
+                    break;
+
+                case 2:
+
+                    if (dist[0] > EPSILON)
+                    {
+                        Inter.d[0] = dist[0];
+                        Inter.n    = j;
+
+                        intervals.push_back(Inter);
+                    }
+                    else if (dist[1] > EPSILON)
+                    {
+                        Inter.d[0] = 0.0;
+                        Inter.n    = j;
+
+                        intervals.push_back(Inter);
+                    }
+
+                    break;
+
+                case 4:
+
+                    if (dist[0] > EPSILON)
+                    {
+                        Inter.d[0] = dist[0];
+                        Inter.n    = j;
+
+                        intervals.push_back(Inter);
+                    }
+                    else if (dist[1] > EPSILON)
+                    {
+                        Inter.d[0] = 0.0;
+                        Inter.n    = j;
+
+                        intervals.push_back(Inter);
+                    }
+                    else if (dist[2] > EPSILON)
+                    {
+                        Inter.d[0] = dist[2];
+                        Inter.n    = j;
+
+                        intervals.push_back(Inter);
+                    }
+                    else if (dist[3] > EPSILON)
+                    {
+                        Inter.d[0] = 0.0;
+                        Inter.n    = j;
+
+                        intervals.push_back(Inter);
+                    }
+
+                    break;
+
+                default:
+
+                    /*
+                     * We weren't able to find an even number of intersections. Thus
+                     * we can't tell where the ray enters and leaves the bounding
+                     * cylinder. To avoid problems we assume that the ray is always
+                     * inside the cylinder in that case.
+                     */
 
-                if (dist[0] > EPSILON)
-                {
                     Inter.d[0] = dist[0];
-                    Inter.n    = i;
+                    Inter.n    = j;
 
-                    insert_hit(&Inter, intervals);
-                }
-                else if (dist[1] > EPSILON)
-                {
-                    Inter.d[0] = 0.0;
-                    Inter.n    = i;
+                    intervals.push_back(Inter);
 
-                    insert_hit(&Inter, intervals);
-                }
+                    break;
+            }
+        }
 
-                break;
+        i = Node->skip;
+    }
 
-            case 4:
+    std::stable_sort(intervals.begin(), intervals.end(), compare_hits);
 
-                if (dist[0] > EPSILON)
-                {
-                    Inter.d[0] = dist[0];
-                    Inter.n    = i;
-
-                    insert_hit(&Inter, intervals);
-                }
-                else if (dist[1] > EPSILON)
-                {
-                    Inter.d[0] = 0.0;
-                    Inter.n    = i;
-
-                    insert_hit(&Inter, intervals);
-                }
-                else if (dist[2] > EPSILON)
-                {
-                    Inter.d[0] = dist[2];
-                    Inter.n    = i;
-
-                    insert_hit(&Inter, intervals);
-                }
-                else if (dist[3] > EPSILON)
-                {
-                    Inter.d[0] = 0.0;
-                    Inter.n    = i;
-
-                    insert_hit(&Inter, intervals);
-                }
+    return(intervals.size());
+}
 
-                break;
 
-            default:
 
-                /*
-                 * We weren't able to find an even number of intersections. Thus
-                 * we can't tell where the ray enters and leaves the bounding
-                 * cylinder. To avoid problems we assume that the ray is always
-                 * inside the cylinder in that case.
-                 */
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   count_bound_nodes
+*
+* INPUT
+*
+*   number - number of segments
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   int - number of hierarchy nodes needed
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Count the nodes of a bounding hierarchy over the given number
+*   of segments, as built by build_bound_nodes().
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+static int count_bound_nodes(int number)
+{
+    if (number <= BCYL_MAX_LEAF_ENTRIES)
+    {
+        return(1);
+    }
+
+    return(1 + count_bound_nodes(number / 2) + count_bound_nodes(number - number / 2));
+}
 
-                Inter.d[0] = dist[0];
-                Inter.n    = i;
 
-                insert_hit(&Inter, intervals);
 
-                break;
-        }
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   build_bound_nodes
+*
+* INPUT
+*
+*   BCyl   - bounding cylinder
+*   index  - slot of the node to build
+*   first  - first segment below the node
+*   number - number of segments below the node
+*
+* OUTPUT
+*
+*   BCyl
+*
+* RETURNS
+*
+*   int - slot following the node's subtree
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Build the bounding hierarchy over a range of segments by halving
+*   it until the ranges fit into a leaf. Consecutive segments of a
+*   spline lie close together, so this needs no spatial sorting.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+static int build_bound_nodes(BCYL *BCyl, int index, int first, int number)
+{
+    int i, half;
+    BCYL_NODE *Node;
+
+    Node = &BCyl->node[index];
+
+    Node->radius  = -BOUND_HUGE;
+    Node->height1 =  BOUND_HUGE;
+    Node->height2 = -BOUND_HUGE;
+
+    for (i = first; i < first + number; i++)
+    {
+        Node->radius  = max(Node->radius,  BCyl->radius[BCyl->entry[i].r2]);
+        Node->height1 = min(Node->height1, BCyl->height[BCyl->entry[i].h1]);
+        Node->height2 = max(Node->height2, BCyl->height[BCyl->entry[i].h2]);
     }
 
-    return(intervals.size());
+    if (number <= BCYL_MAX_LEAF_ENTRIES)
+    {
+        Node->first  = first;
+        Node->number = number;
+        Node->skip   = index + 1;
+    }
+    else
+    {
+        half = number / 2;
+
+        Node->first  = first;
+        Node->number = 0;
+        Node->skip   = build_bound_nodes(BCyl, index + 1, first, half);
+        Node->skip   = build_bound_nodes(BCyl, Node->skip, first + half, number - half);
+    }
+
+    return(Node->skip);
 }
 
 
@@ -652,6 +829,14 @@ BCYL *Create_BCyl(int number, const DBL *tmp_r1, const DBL *tmp_r2, const DBL *t
         bcyl->entry[i].h2 = tmp_h2_index[i];
     }
 
+    /* Build the bounding hierarchy. */
+
+    bcyl->nnodes = count_bound_nodes(bcyl->number);
+
+    bcyl->node = new BCYL_NODE[bcyl->nnodes];
+
+    build_bound_nodes(bcyl, 0, 0, bcyl->number);
+
 /*
     fprintf(stderr, "number of different radii   = %d\n", nr);
     fprintf(stderr, "number of different heights = %d\n", nh);
@@ -701,6 +886,8 @@ BCYL *Create_BCyl(int number, const DBL *tmp_r1, const DBL *tmp_r2, const DBL *t
 
 void Destroy_BCyl(BCYL *BCyl)
 {
+    delete[] BCyl->node;
+
     delete[] BCyl->entry;
 
     delete[] BCyl->radius;
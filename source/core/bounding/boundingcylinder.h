@@ -59,6 +59,10 @@ namespace pov
 
 #define BCYL_EXTRA_STATS 1
 
+/* Maximum number of segments in a leaf of the bounding hierarchy. */
+
+#define BCYL_MAX_LEAF_ENTRIES 4
+
 
 /*****************************************************************************
 * Global typedefs
@@ -66,6 +70,7 @@ namespace pov
 
 typedef struct BCyl_Struct BCYL;
 typedef struct BCyl_Entry_Struct BCYL_ENTRY;
+typedef struct BCyl_Node_Struct BCYL_NODE;
 typedef struct BCyl_Intersection_Struct BCYL_INT;
 
 struct BCyl_Intersection_Struct
@@ -81,6 +86,23 @@ struct BCyl_Entry_Struct
     short h1, h2;        /* Index of min/max segmnet height */
 };
 
+/*
+ * Node of the bounding hierarchy, enclosing the bounding cylinders of a
+ * range of consecutive segments in a solid cylinder. The nodes are stored
+ * in depth-first order, so the first child of an inner node follows it,
+ * and skip gives the node to continue with once a subtree is done.
+ */
+
+struct BCyl_Node_Struct
+{
+    DBL radius;          /* Max. bound-radius of the segments.  */
+    DBL height1;         /* Min. bound-height of the segments.  */
+    DBL height2;         /* Max. bound-height of the segments.  */
+    int first;           /* First segment of a leaf.            */
+    int number;          /* Number of segments, 0 if inner.     */
+    int skip;            /* Node following the subtree.         */
+};
+
 struct BCyl_Struct
 {
     int number;          /* Number of bounding cylinders.       */
@@ -89,6 +111,8 @@ struct BCyl_Struct
     DBL *radius;         /* List of different bound-radii.      */
     DBL *height;         /* List of different bound-heights.    */
     BCYL_ENTRY *entry;   /* BCyl elements.                      */
+    int nnodes;          /* Number of hierarchy nodes.          */
+    BCYL_NODE *node;     /* Bounding hierarchy.                 */
 };
 
 
@@ -99,7 +123,7 @@ struct BCyl_Struct
 BCYL *Create_BCyl (int, const DBL *, const DBL *, const DBL *, const DBL *);
 void Destroy_BCyl (BCYL *);
 
-int Intersect_BCyl (const BCYL *BCyl, vector<BCYL_INT>& Intervals, vector<BCYL_INT>& rint, vector<BCYL_INT>& hint, const Vector3d& P, const Vector3d& D);
+int Intersect_BCyl (const BCYL *BCyl, vector<BCYL_INT>& Intervals, const Vector3d& P, const Vector3d& D);
 
 /// @}
 ///
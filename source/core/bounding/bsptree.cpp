@@ -36,9 +36,17 @@
 // Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
 #include "core/bounding/bsptree.h"
 
+#include <cstring>
+#include <exception>
+#include <memory>
 #include <vector>
 #include <list>
 
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+#include "base/fileinputoutput.h"
+#include "base/path.h"
 #include "base/pov_err.h"
 
 #include "core/render/ray.h"
@@ -71,6 +79,14 @@ namespace pov
 
 const unsigned int NODE_PROGRESS_INTERVAL = 1000;
 
+// subtrees with fewer objects than this are never handed to a separate thread, as the
+// overhead of copying their object indices would outweigh any gain
+const unsigned int PARALLEL_BUILD_MIN_OBJECTS = 1000;
+
+// limit for the number of tree levels at which subtrees are built concurrently,
+// i.e. at most 2^PARALLEL_BUILD_MAX_LEVELS subtrees are built at the same time
+const unsigned int PARALLEL_BUILD_MAX_LEVELS = 6;
+
 // we allow the values to be set by users to promote experimentation with tree
 // building. at a later date we may remove this facility since using compile-time
 // constants is more efficient.
@@ -88,7 +104,8 @@ BSPTree::BSPTree(unsigned int md, float oic, float bac, float cac, float mc) :
     objectIsectCost(oic == 0.0f ? OBJECT_ISECT_COST : oic),
     baseAccessCost(bac == 0.0f ? BASE_ACCESS_COST : bac),
     childAccessCost(cac == 0.0f ? CHILD_ACCESS_COST : cac),
-    missChance(mc == 0.0f ? MISS_CHANCE + 1.0f : mc + 1.0f)
+    missChance(mc == 0.0f ? MISS_CHANCE + 1.0f : mc + 1.0f),
+    buildCancelled(false)
 {
 }
 
@@ -100,6 +117,135 @@ BSPTree::~BSPTree()
 static FILE *gFile = nullptr;
 #endif
 
+// identification of the tree cache file format; the version must be changed whenever
+// the file layout or the tree building algorithm changes
+static const char kCacheFileMagic[8] = { 'P', 'O', 'V', 'B', 'S', 'P', '\x1A', '\0' };
+const unsigned int kCacheFileVersion = 1;
+
+/// Header of a tree cache file.
+///
+/// The header is followed by the node array and the object pointer list array, all stored
+/// in native layout and byte order; files written on a different platform will simply be
+/// rejected and the tree rebuilt.
+///
+struct BSPCacheFileHeader
+{
+    char magic[8];
+    unsigned int version;
+    unsigned int nodeSize;
+    POV_UINT64 key;
+    unsigned int objects;
+    unsigned int nodes;
+    unsigned int lists;
+    unsigned int maxObjectsInNode;
+    unsigned int maxTreeDepth;
+    unsigned int maxTreeDepthNodes;
+    unsigned int emptyNodeCounter;
+    unsigned int objectNodeCounter;
+    POV_LONG objectsInTreeCounter;
+    POV_LONG objectsAtMaxDepthCounter;
+    POV_LONG treeDepthCounter;
+    double bmin[3];
+    double bmax[3];
+};
+
+// 64 bit FNV-1a hash
+static inline void HashCacheKey(POV_UINT64& hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data);
+
+    for(size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+}
+
+BSPTree::BuildContext::BuildContext(bool rp, unsigned int pb, unsigned int pl) :
+    reportProgress(rp),
+    progressBase(pb),
+    parallelLevels(pl),
+    lastProgressNodeCounter(0),
+    maxObjectsInNode(0),
+    maxTreeDepth(0),
+    maxTreeDepthNodes(0),
+    emptyNodeCounter(0),
+    objectNodeCounter(0),
+    objectsInTreeCounter(0),
+    objectsAtMaxDepthCounter(0),
+    treeDepthCounter(0)
+{
+}
+
+void BSPTree::BuildContext::Splice(unsigned int inode, const BuildContext& subtree)
+{
+    // subtree node 0 replaces node inode, while any other subtree node i is appended,
+    // ending up at index (nodeoffset + i); since the serial builder also appends all
+    // descendants of a node right after its children, splicing the left subtree before
+    // the right subtree reproduces the serial node order exactly
+    unsigned int nodeoffset = (unsigned int) nodes.size() - 1;
+    unsigned int listoffset = (unsigned int) lists.size();
+
+    nodes.reserve(nodes.size() + subtree.nodes.size() - 1);
+
+    for(unsigned int i = 0; i < subtree.nodes.size(); i++)
+    {
+        Node node = subtree.nodes[i];
+
+        if(node.type == Node::Split)
+            node.index += nodeoffset;
+        else if(node.data == Node::ObjectList)
+            node.index2 += listoffset;
+
+        if(i == 0)
+            nodes[inode] = node;
+        else
+            nodes.push_back(node);
+    }
+
+    lists.insert(lists.end(), subtree.lists.begin(), subtree.lists.end());
+
+    maxObjectsInNode = max(maxObjectsInNode, subtree.maxObjectsInNode);
+    maxTreeDepth = max(maxTreeDepth, subtree.maxTreeDepth);
+    maxTreeDepthNodes += subtree.maxTreeDepthNodes;
+    emptyNodeCounter += subtree.emptyNodeCounter;
+    objectNodeCounter += subtree.objectNodeCounter;
+    objectsInTreeCounter += subtree.objectsInTreeCounter;
+    objectsAtMaxDepthCounter += subtree.objectsAtMaxDepthCounter;
+    treeDepthCounter += subtree.treeDepthCounter;
+}
+
+/// Functor building a subtree on a separate thread.
+class BSPTree::SubtreeBuilder
+{
+    public:
+        SubtreeBuilder(BSPTree& t, const Progress& p, const Objects& o, BuildContext& c, MinMaxBoundingBox b, unsigned int ml, std::exception_ptr& e) :
+            tree(t), progress(p), objects(o), ctx(c), cell(b), maxlevel(ml), error(e)
+        {
+        }
+
+        void operator()()
+        {
+            try
+            {
+                tree.BuildRecursive(progress, objects, ctx, 0, 0, (unsigned int) ctx.indices.size(), cell, maxlevel);
+            }
+            catch(...)
+            {
+                error = std::current_exception();
+                tree.buildCancelled = true;
+            }
+        }
+    private:
+        BSPTree& tree;
+        const Progress& progress;
+        const Objects& objects;
+        BuildContext& ctx;
+        MinMaxBoundingBox cell;
+        unsigned int maxlevel;
+        std::exception_ptr& error;
+};
+
 bool BSPTree::operator()(const BasicRay& ray, Intersect& isect, Mailbox& mailbox, double maxdist)
 {
     TraceStack tstack[MAX_BSP_TREE_LEVEL];
@@ -117,6 +263,8 @@ bool BSPTree::operator()(const BasicRay& ray, Intersect& isect, Mailbox& mailbox
 
     while(rentry < maxdist)
     {
+        mailbox.visits++;
+
         // descend into child
         if(nodes[inode].type == Node::Split)
         {
@@ -249,22 +397,74 @@ bool BSPTree::operator()(const Vector3d& origin, Inside& inside, Mailbox& mailbo
 void BSPTree::build(const Progress& progress, const Objects& objects,
                     unsigned int& totalnodes, unsigned int& splitnodes, unsigned int& objectnodes, unsigned int& emptynodes,
                     unsigned int& maxobjects, float& averageobjects, unsigned int& maxdepth, float& averagedepth,
-                    unsigned int& aborts, float& averageaborts, float& averageabortobjects, const UCS2String& inputFile)
+                    unsigned int& aborts, float& averageaborts, float& averageabortobjects, const UCS2String& inputFile,
+                    unsigned int threads, const UCS2String& cacheFile)
 {
-    MinMaxBoundingBox bbox;
+    unsigned int parallellevels = 0;
+    POV_UINT64 cachekey = 0;
+    bool cached = false;
+
+#if !BSP_WRITETREE
+    // the tree file is written in build order, so only build concurrently if it is disabled
+    while((parallellevels < PARALLEL_BUILD_MAX_LEVELS) && ((1u << parallellevels) < threads))
+        parallellevels++;
+#endif
 
-    lastProgressNodeCounter = 0;
-    maxObjectsInNode = 0;
-    maxTreeDepth = 0;
-    maxTreeDepthNodes = 0;
-    emptyNodeCounter = 0;
-    objectNodeCounter = 0;
-    objectsInTreeCounter = 0;
-    objectsAtMaxDepthCounter = 0;
-    treeDepthCounter = 0;
+    BuildContext ctx(true, 0, parallellevels);
+
+    buildCancelled = false;
 
     progress(0);
 
+    // try to use a tree cached by an earlier run with the same geometry
+    if(!cacheFile.empty())
+    {
+        cachekey = ComputeCacheKey(objects);
+        cached = ReadCache(cacheFile, cachekey, objects, ctx);
+    }
+
+    if(!cached)
+    {
+        BuildTree(progress, objects, ctx, inputFile);
+
+        if(!cacheFile.empty())
+            WriteCache(cacheFile, cachekey, objects, ctx);
+    }
+
+    progress((unsigned int) ctx.nodes.size());
+
+    unsigned int nodesoftypeobject = ctx.emptyNodeCounter + ctx.objectNodeCounter; // number of terminal nodes
+
+    totalnodes = (unsigned int) ctx.nodes.size();
+    splitnodes = totalnodes - nodesoftypeobject;
+    objectnodes = ctx.objectNodeCounter;
+    emptynodes = ctx.emptyNodeCounter;
+    maxobjects = ctx.maxObjectsInNode;
+    averageobjects = float(double(ctx.objectsInTreeCounter) / double(nodesoftypeobject));
+    maxdepth = ctx.maxTreeDepth;
+    averagedepth = float(double(ctx.treeDepthCounter) / double(nodesoftypeobject));
+    aborts = ctx.maxTreeDepthNodes;
+    if(aborts > 0)
+    {
+        averageaborts = float(double(aborts) / double(nodesoftypeobject));
+        averageabortobjects = float(double(ctx.objectsAtMaxDepthCounter) / double(aborts));
+    }
+    else
+    {
+        averageaborts = 0.0f;
+        averageabortobjects = 0.0f;
+    }
+
+    // take over nodes and lists, freeing up unused allocation; the build context itself,
+    // including the memory only needed for building, goes out of scope here
+    lists = ctx.lists;
+    nodes = ctx.nodes;
+}
+
+void BSPTree::BuildTree(const Progress& progress, const Objects& objects, BuildContext& ctx, const UCS2String& inputFile)
+{
+    MinMaxBoundingBox bbox;
+
     bbox.pmin[X] = BOUND_HUGE;
     bbox.pmin[Y] = BOUND_HUGE;
     bbox.pmin[Z] = BOUND_HUGE;
@@ -274,11 +474,11 @@ void BSPTree::build(const Progress& progress, const Objects& objects,
     bbox.pmax[Z] = -BOUND_HUGE;
 
     // allocate memory that is going to be needed for building
-    indices.reserve(objects.size() * 4); // can't tell what we need, but we'll start with object count * 4
-    indices.resize(objects.size());
-    splits[X].resize(objects.size() * 2);
-    splits[Y].resize(objects.size() * 2);
-    splits[Z].resize(objects.size() * 2);
+    ctx.indices.reserve(objects.size() * 4); // can't tell what we need, but we'll start with object count * 4
+    ctx.indices.resize(objects.size());
+    ctx.splits[X].resize(objects.size() * 2);
+    ctx.splits[Y].resize(objects.size() * 2);
+    ctx.splits[Z].resize(objects.size() * 2);
 
 #if BSP_WRITEBOUNDS || BSP_READNODES || BSP_WRITETREE
     string tempstr = UCS2toASCIIString(inputFile);
@@ -307,7 +507,7 @@ void BSPTree::build(const Progress& progress, const Objects& objects,
         bbox.pmax[Y] = max(bbox.pmax[Y], objects.GetMax(Y, i));
         bbox.pmax[Z] = max(bbox.pmax[Z], objects.GetMax(Z, i));
 
-        indices[i] = i;
+        ctx.indices[i] = i;
 
 #if BSP_WRITEBOUNDS
         if (bb != nullptr)
@@ -342,7 +542,7 @@ void BSPTree::build(const Progress& progress, const Objects& objects,
 #endif
 
     // recursively build BSP tree
-    nodes.push_back(Node());
+    ctx.nodes.push_back(Node());
 
 #if BSP_READNODES
     FILE *infile = fopen(string(tempstr + ".nodes").c_str(), "r");
@@ -378,10 +578,10 @@ void BSPTree::build(const Progress& progress, const Objects& objects,
         fclose (infile);
         throw;
     }
-    ReadRecursive(progress, infile, 0, 0, objects.size() - 1);
+    ReadRecursive(progress, ctx, infile, 0, 0, objects.size() - 1);
     fclose(infile);
 #else
-    BuildRecursive(progress, objects, 0, 0, (unsigned int) indices.size(), bbox, maxDepth);
+    BuildRecursive(progress, objects, ctx, 0, 0, (unsigned int) ctx.indices.size(), bbox, maxDepth);
 #endif
 
 #if BSP_WRITETREE
@@ -391,46 +591,151 @@ void BSPTree::build(const Progress& progress, const Objects& objects,
         fclose(gFile);
     }
 #endif
+}
 
-    // memory was only needed for building
-    splits[X].clear();
-    splits[Y].clear();
-    splits[Z].clear();
+POV_UINT64 BSPTree::ComputeCacheKey(const Objects& objects) const
+{
+    POV_UINT64 hash = 0xCBF29CE484222325ull;
+    unsigned int count = objects.size();
+
+    // besides the object bounding boxes, the key covers all parameters affecting the tree
+    HashCacheKey(hash, &kCacheFileVersion, sizeof(kCacheFileVersion));
+    HashCacheKey(hash, &maxDepth, sizeof(maxDepth));
+    HashCacheKey(hash, &objectIsectCost, sizeof(objectIsectCost));
+    HashCacheKey(hash, &baseAccessCost, sizeof(baseAccessCost));
+    HashCacheKey(hash, &childAccessCost, sizeof(childAccessCost));
+    HashCacheKey(hash, &missChance, sizeof(missChance));
+    HashCacheKey(hash, &count, sizeof(count));
+
+    for(unsigned int i = 0; i < count; i++)
+    {
+        float bounds[6] =
+        {
+            objects.GetMin(X, i), objects.GetMin(Y, i), objects.GetMin(Z, i),
+            objects.GetMax(X, i), objects.GetMax(Y, i), objects.GetMax(Z, i)
+        };
 
-    progress((unsigned int) nodes.size());
+        HashCacheKey(hash, bounds, sizeof(bounds));
+    }
 
-    unsigned int nodesoftypeobject = emptyNodeCounter + objectNodeCounter; // number of terminal nodes
+    return hash;
+}
 
-    totalnodes = (unsigned int) nodes.size();
-    splitnodes = totalnodes - nodesoftypeobject;
-    objectnodes = objectNodeCounter;
-    emptynodes = emptyNodeCounter;
-    maxobjects = maxObjectsInNode;
-    averageobjects = float(double(objectsInTreeCounter) / double(nodesoftypeobject));
-    maxdepth = maxTreeDepth;
-    averagedepth = float(double(treeDepthCounter) / double(nodesoftypeobject));
-    aborts = maxTreeDepthNodes;
-    if(aborts > 0)
+bool BSPTree::ReadCache(const UCS2String& cacheFile, POV_UINT64 key, const Objects& objects, BuildContext& ctx)
+{
+    if(CheckIfFileExists(Path(cacheFile)) == false)
+        return false;
+
+    std::unique_ptr<IStream> file(NewIStream(Path(cacheFile), POV_File_Data_BSP));
+    BSPCacheFileHeader header;
+
+    if(!*file || !file->read(&header, sizeof(header)))
+        return false;
+
+    if((memcmp(header.magic, kCacheFileMagic, sizeof(kCacheFileMagic)) != 0) ||
+       (header.version != kCacheFileVersion) || (header.nodeSize != sizeof(Node)) ||
+       (header.key != key) || (header.objects != objects.size()) || (header.nodes == 0))
+        return false; // stale or foreign file
+
+    vector<Node> cachednodes(header.nodes);
+    vector<unsigned int> cachedlists(header.lists);
+
+    if(!file->read(&cachednodes[0], cachednodes.size() * sizeof(Node)))
+        return false;
+    if((header.lists > 0) && !file->read(&cachedlists[0], cachedlists.size() * sizeof(unsigned int)))
+        return false;
+
+    // depth of each node; as children always follow their parent, it is final by the time we get to the node
+    vector<unsigned int> depth(header.nodes, 0);
+
+    // make sure a damaged file cannot cause out-of-bounds accesses, endless loops or traversal stack overflows later
+    for(unsigned int i = 0; i < header.nodes; i++)
     {
-        averageaborts = float(double(aborts) / double(nodesoftypeobject));
-        averageabortobjects = float(double(objectsAtMaxDepthCounter) / double(aborts));
+        const Node& node = cachednodes[i];
+
+        if(node.type == Node::Split)
+        {
+            if((node.data == Node::NoAxis) || (node.index <= i) || (node.index >= header.nodes - 1))
+                return false;
+            if(depth[i] + 1 >= MAX_BSP_TREE_LEVEL)
+                return false;
+            depth[node.index] = max(depth[node.index], depth[i] + 1);
+            depth[node.index + 1] = max(depth[node.index + 1], depth[i] + 1);
+        }
+        else if(node.data == Node::SingleObject)
+        {
+            if(node.index >= header.objects)
+                return false;
+        }
+        else if(node.data == Node::DoubleObject)
+        {
+            if((node.index >= header.objects) || (node.index2 >= header.objects))
+                return false;
+        }
+        else if(node.data == Node::ObjectList)
+        {
+            if((node.index2 > header.lists) || (node.index > header.lists - node.index2))
+                return false;
+        }
     }
-    else
+    for(unsigned int i = 0; i < header.lists; i++)
     {
-        averageaborts = 0.0f;
-        averageabortobjects = 0.0f;
+        if(cachedlists[i] >= header.objects)
+            return false;
     }
 
-    // free up unused allocation in lists and nodes
-    vector<unsigned int> tmplists;
-    tmplists.swap(lists);
-    lists = tmplists;
+    ctx.nodes.swap(cachednodes);
+    ctx.lists.swap(cachedlists);
+    ctx.maxObjectsInNode = header.maxObjectsInNode;
+    ctx.maxTreeDepth = header.maxTreeDepth;
+    ctx.maxTreeDepthNodes = header.maxTreeDepthNodes;
+    ctx.emptyNodeCounter = header.emptyNodeCounter;
+    ctx.objectNodeCounter = header.objectNodeCounter;
+    ctx.objectsInTreeCounter = header.objectsInTreeCounter;
+    ctx.objectsAtMaxDepthCounter = header.objectsAtMaxDepthCounter;
+    ctx.treeDepthCounter = header.treeDepthCounter;
+
+    bmin = Vector3d(header.bmin[X], header.bmin[Y], header.bmin[Z]);
+    bmax = Vector3d(header.bmax[X], header.bmax[Y], header.bmax[Z]);
+
+    return true;
+}
+
+void BSPTree::WriteCache(const UCS2String& cacheFile, POV_UINT64 key, const Objects& objects, const BuildContext& ctx) const
+{
+    std::unique_ptr<OStream> file(NewOStream(Path(cacheFile), POV_File_Data_BSP, false));
+    BSPCacheFileHeader header;
+
+    // the cache is merely an optimization, so failing to write it is not an error
+    if(!*file)
+        return;
 
-    vector<Node> tmpnodes;
-    tmpnodes.swap(nodes);
-    nodes = tmpnodes;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, kCacheFileMagic, sizeof(kCacheFileMagic));
+    header.version = kCacheFileVersion;
+    header.nodeSize = sizeof(Node);
+    header.key = key;
+    header.objects = objects.size();
+    header.nodes = (unsigned int) ctx.nodes.size();
+    header.lists = (unsigned int) ctx.lists.size();
+    header.maxObjectsInNode = ctx.maxObjectsInNode;
+    header.maxTreeDepth = ctx.maxTreeDepth;
+    header.maxTreeDepthNodes = ctx.maxTreeDepthNodes;
+    header.emptyNodeCounter = ctx.emptyNodeCounter;
+    header.objectNodeCounter = ctx.objectNodeCounter;
+    header.objectsInTreeCounter = ctx.objectsInTreeCounter;
+    header.objectsAtMaxDepthCounter = ctx.objectsAtMaxDepthCounter;
+    header.treeDepthCounter = ctx.treeDepthCounter;
+    for(unsigned int i = 0; i < 3; i++)
+    {
+        header.bmin[i] = bmin[i];
+        header.bmax[i] = bmax[i];
+    }
 
-    indices.clear();
+    file->write(&header, sizeof(header));
+    file->write(&ctx.nodes[0], ctx.nodes.size() * sizeof(Node));
+    if(!ctx.lists.empty())
+        file->write(&ctx.lists[0], ctx.lists.size() * sizeof(unsigned int));
 }
 
 void BSPTree::clear()
@@ -439,14 +744,91 @@ void BSPTree::clear()
     lists.clear();
 }
 
-void BSPTree::BuildRecursive(const Progress& progress, const Objects& objects, unsigned int inode, unsigned int indexbegin, unsigned int indexend, MinMaxBoundingBox& cell, unsigned int maxlevel)
+void BSPTree::GetStatistics(BBoxTreeStatistics& stats) const
+{
+    Vector3d extent(bmax - bmin);
+
+    stats.nodes = 0;
+    stats.leaves = 0;
+    stats.cost = 0.0;
+    stats.objectCost = 0.0;
+    stats.depths.clear();
+    stats.leafSizes.clear();
+
+    if(nodes.empty())
+        return;
+
+    GetStatisticsRecursive(stats, 0, 0, bmin, bmax, extent[X] * extent[Y] + extent[Y] * extent[Z] + extent[Z] * extent[X]);
+}
+
+void BSPTree::GetStatisticsRecursive(BBoxTreeStatistics& stats, unsigned int inode, unsigned int depth, const Vector3d& cellMin, const Vector3d& cellMax, double rootArea) const
 {
-    maxTreeDepth = max(maxTreeDepth, maxDepth - maxlevel);
+    Vector3d extent(cellMax - cellMin);
+    double probability = 1.0;
+
+    if(rootArea > 0.0)
+        probability = min(1.0, (extent[X] * extent[Y] + extent[Y] * extent[Z] + extent[Z] * extent[X]) / rootArea);
+
+    stats.cost += probability;
+
+    if(nodes[inode].type == Node::Split)
+    {
+        unsigned int axis = nodes[inode].data;
+        Vector3d leftMax(cellMax);
+        Vector3d rightMin(cellMin);
+
+        leftMax[axis] = rightMin[axis] = nodes[inode].plane;
+
+        stats.nodes++;
+
+        GetStatisticsRecursive(stats, nodes[inode].index, depth + 1, cellMin, leftMax, rootArea);
+        GetStatisticsRecursive(stats, nodes[inode].index + 1, depth + 1, rightMin, cellMax, rootArea);
+    }
+    else
+    {
+        unsigned int count = 0;
+
+        switch(nodes[inode].data)
+        {
+            case Node::Empty:
+                count = 0;
+                break;
+            case Node::SingleObject:
+                count = 1;
+                break;
+            case Node::DoubleObject:
+                count = 2;
+                break;
+            case Node::ObjectList:
+                count = nodes[inode].index;
+                break;
+        }
+
+        stats.leaves++;
+        stats.objectCost += probability * count;
+
+        if(stats.depths.size() <= depth)
+            stats.depths.resize(depth + 1, 0);
+        stats.depths[depth]++;
+
+        if(stats.leafSizes.size() <= count)
+            stats.leafSizes.resize(count + 1, 0);
+        stats.leafSizes[count]++;
+    }
+}
+
+void BSPTree::BuildRecursive(const Progress& progress, const Objects& objects, BuildContext& ctx, unsigned int inode, unsigned int indexbegin, unsigned int indexend, MinMaxBoundingBox& cell, unsigned int maxlevel)
+{
+    // a concurrently built subtree failed, so the result will be discarded anyway
+    if(buildCancelled)
+        return;
+
+    ctx.maxTreeDepth = max(ctx.maxTreeDepth, maxDepth - maxlevel);
 
-    if((nodes.size() - lastProgressNodeCounter) > NODE_PROGRESS_INTERVAL)
+    if(ctx.reportProgress && ((ctx.nodes.size() - ctx.lastProgressNodeCounter) > NODE_PROGRESS_INTERVAL))
     {
-        lastProgressNodeCounter = (unsigned int) nodes.size();
-        progress(lastProgressNodeCounter);
+        ctx.lastProgressNodeCounter = (unsigned int) ctx.nodes.size();
+        progress(ctx.progressBase + ctx.lastProgressNodeCounter);
     }
 
 #if BSP_WRITETREE
@@ -464,26 +846,26 @@ void BSPTree::BuildRecursive(const Progress& progress, const Objects& objects, u
             fprintf(gFile, "*\n");
 #endif
 
-        nodes[inode].type = Node::Object;
-        nodes[inode].data = Node::Empty;
-        nodes[inode].index = 0;
+        ctx.nodes[inode].type = Node::Object;
+        ctx.nodes[inode].data = Node::Empty;
+        ctx.nodes[inode].index = 0;
 
-        emptyNodeCounter++;
-        treeDepthCounter += (maxDepth - maxlevel);
+        ctx.emptyNodeCounter++;
+        ctx.treeDepthCounter += (maxDepth - maxlevel);
         return;
     }
 
     // stop if maximum split recursion level reached or we only have one object
     if((maxlevel == 0) || (cnt == 1))
     {
-        SetObjectNode(inode, indexbegin, indexend);
+        SetObjectNode(ctx, inode, indexbegin, indexend);
 
         if(maxlevel == 0)
         {
-            maxTreeDepthNodes++;
-            objectsAtMaxDepthCounter += cnt;
+            ctx.maxTreeDepthNodes++;
+            ctx.objectsAtMaxDepthCounter += cnt;
         }
-        treeDepthCounter += (maxDepth - maxlevel);
+        ctx.treeDepthCounter += (maxDepth - maxlevel);
         return;
     }
 
@@ -541,8 +923,8 @@ void BSPTree::BuildRecursive(const Progress& progress, const Objects& objects, u
             unsigned int scnt = 0;
             for(unsigned int i = indexbegin; i < indexend; i++)
             {
-                float smin = objects.GetMin(axis, indices[i]) - BSP_TOLERANCE;
-                float smax = objects.GetMax(axis, indices[i]) + BSP_TOLERANCE;
+                float smin = objects.GetMin(axis, ctx.indices[i]) - BSP_TOLERANCE;
+                float smax = objects.GetMax(axis, ctx.indices[i]) + BSP_TOLERANCE;
 
                 // (if they are equal for our purpose we consider it outside)
                 if((smin >= bmax) || (smax <= bmin))
@@ -556,17 +938,17 @@ void BSPTree::BuildRecursive(const Progress& progress, const Objects& objects, u
                     pab++;
                     pb--;
                 }
-                splits[axis][scnt++] = Split(Split::Min, indices[i], smin);
-                splits[axis][scnt++] = Split(Split::Max, indices[i], smax);
+                ctx.splits[axis][scnt++] = Split(Split::Min, ctx.indices[i], smin);
+                ctx.splits[axis][scnt++] = Split(Split::Max, ctx.indices[i], smax);
             }
 
-            sort(splits[axis].begin(), splits[axis].begin() + scnt);
+            sort(ctx.splits[axis].begin(), ctx.splits[axis].begin() + scnt);
 
             for(unsigned int i = 0; i < scnt; i++)
             {
-                float plane = splits[axis][i].plane;
+                float plane = ctx.splits[axis][i].plane;
 
-                if(splits[axis][i].se == Split::Max) // leaving object
+                if(ctx.splits[axis][i].se == Split::Max) // leaving object
                 {
                     pa++;
                     pab--;
@@ -591,7 +973,7 @@ void BSPTree::BuildRecursive(const Progress& progress, const Objects& objects, u
                     }
                 }
 
-                if(splits[axis][i].se == Split::Min) // entering object
+                if(ctx.splits[axis][i].se == Split::Min) // entering object
                 {
                     pab++;
                     pb--;
@@ -602,36 +984,36 @@ void BSPTree::BuildRecursive(const Progress& progress, const Objects& objects, u
 
     if(bestaxis == Node::NoAxis) // no better split found, so stop at this node
     {
-        SetObjectNode(inode, indexbegin, indexend);
+        SetObjectNode(ctx, inode, indexbegin, indexend);
 
-        treeDepthCounter += (maxDepth - maxlevel);
+        ctx.treeDepthCounter += (maxDepth - maxlevel);
     }
     else // better split found, so create child nodes
     {
-        unsigned int ichild = (unsigned int) nodes.size(); // child node position
-        float bestplane = splits[bestaxis][bestsplit].plane;
+        unsigned int ichild = (unsigned int) ctx.nodes.size(); // child node position
+        float bestplane = ctx.splits[bestaxis][bestsplit].plane;
         float ptemp = 0.0f;
 
         // create child nodes
-        nodes.push_back(Node());
-        nodes.push_back(Node());
+        ctx.nodes.push_back(Node());
+        ctx.nodes.push_back(Node());
 
         // set current node
-        nodes[inode].type = Node::Split;
-        nodes[inode].data = bestaxis;
-        nodes[inode].index = ichild;
-        nodes[inode].plane = bestplane;
+        ctx.nodes[inode].type = Node::Split;
+        ctx.nodes[inode].data = bestaxis;
+        ctx.nodes[inode].index = ichild;
+        ctx.nodes[inode].plane = bestplane;
 
         // if the best split is at the maximum side, the split goes
         // into the left child, otherwise it goes into the right side
         // and thus the mid-point for sorting has to be moved [trf]
-        if(splits[bestaxis][bestsplit].se == Split::Max)
+        if(ctx.splits[bestaxis][bestsplit].se == Split::Max)
             bestsplit++;
 
         // reorder indices to find objects completely in one child
         Split::CompareIndex ci;
-        sort(splits[bestaxis].begin(), splits[bestaxis].begin() + bestsplit, ci);
-        sort(splits[bestaxis].begin() + bestsplit, splits[bestaxis].begin() + bestscnt, ci);
+        sort(ctx.splits[bestaxis].begin(), ctx.splits[bestaxis].begin() + bestsplit, ci);
+        sort(ctx.splits[bestaxis].begin() + bestsplit, ctx.splits[bestaxis].begin() + bestscnt, ci);
 
 #if BSP_WRITETREE
         if (gFile != nullptr)
@@ -643,43 +1025,104 @@ void BSPTree::BuildRecursive(const Progress& progress, const Objects& objects, u
         }
 #endif
 
-        unsigned int begin = (unsigned int) indices.size();
-        for (vector<Split>::iterator it = splits[bestaxis].begin(), en = it + bestsplit; it != en; )
+        unsigned int begin = (unsigned int) ctx.indices.size();
+        for (vector<Split>::iterator it = ctx.splits[bestaxis].begin(), en = it + bestsplit; it != en; )
         {
             unsigned int index = it++->index;
-            indices.push_back(index);
+            ctx.indices.push_back(index);
             if((it != en) && (it->index == index)) // keep only once if completely in child
                 it++;
         }
-        unsigned int middle = (unsigned int) indices.size();
-        for (vector<Split>::iterator it = splits[bestaxis].begin() + bestsplit, en = splits[bestaxis].begin() + bestscnt; it != en; )
+        unsigned int middle = (unsigned int) ctx.indices.size();
+        for (vector<Split>::iterator it = ctx.splits[bestaxis].begin() + bestsplit, en = ctx.splits[bestaxis].begin() + bestscnt; it != en; )
         {
             unsigned int index = it++->index;
-            indices.push_back(index);
+            ctx.indices.push_back(index);
             if((it != en) && (it->index == index)) // keep only once if completely in child
                 it++;
         }
-        unsigned int end = (unsigned int) indices.size();
+        unsigned int end = (unsigned int) ctx.indices.size();
+
+        // build large subtrees near the top of the tree concurrently
+        if((inode == 0) && (ctx.parallelLevels > 0) && (cnt >= PARALLEL_BUILD_MIN_OBJECTS))
+        {
+            BuildParallel(progress, objects, ctx, ichild, begin, middle, end, bestaxis, bestplane, cell, maxlevel);
+            ctx.indices.resize(begin);
+            return;
+        }
 
         // split left cell
         ptemp = cell.pmax[bestaxis];
         cell.pmax[bestaxis] = bestplane;
-        BuildRecursive(progress, objects, ichild, begin, middle, cell, maxlevel - 1);
+        BuildRecursive(progress, objects, ctx, ichild, begin, middle, cell, maxlevel - 1);
         cell.pmax[bestaxis] = ptemp;
 
         // split right cell
         ptemp = cell.pmin[bestaxis];
         cell.pmin[bestaxis] = bestplane;
-        BuildRecursive(progress, objects, ichild + 1, middle, end, cell, maxlevel - 1);
+        BuildRecursive(progress, objects, ctx, ichild + 1, middle, end, cell, maxlevel - 1);
         cell.pmin[bestaxis] = ptemp;
 
         // the efficiency of this code depends on the assumption that resize() does not
         // de-allocate memory when truncating a vector.
-        indices.resize(begin);
+        ctx.indices.resize(begin);
     }
 }
 
-void BSPTree::SetObjectNode(unsigned int inode, unsigned int indexbegin, unsigned int indexend)
+void BSPTree::BuildParallel(const Progress& progress, const Objects& objects, BuildContext& ctx, unsigned int ichild, unsigned int begin, unsigned int middle, unsigned int end,
+                            unsigned int axis, float plane, MinMaxBoundingBox& cell, unsigned int maxlevel)
+{
+    // the left subtree is built on a separate thread, the right subtree on this one,
+    // so that only the latter reports progress (and thus cooperates with the task)
+    BuildContext left(false, 0, ctx.parallelLevels - 1);
+    BuildContext right(ctx.reportProgress, ctx.progressBase + (unsigned int) ctx.nodes.size(), ctx.parallelLevels - 1);
+    MinMaxBoundingBox leftcell(cell);
+    MinMaxBoundingBox rightcell(cell);
+    std::exception_ptr lefterror;
+
+    leftcell.pmax[axis] = plane;
+    rightcell.pmin[axis] = plane;
+
+    left.indices.assign(ctx.indices.begin() + begin, ctx.indices.begin() + middle);
+    right.indices.assign(ctx.indices.begin() + middle, ctx.indices.begin() + end);
+
+    for(unsigned int i = 0; i < 3; i++)
+    {
+        left.splits[i].resize(left.indices.size() * 2);
+        right.splits[i].resize(right.indices.size() * 2);
+    }
+
+    left.nodes.push_back(Node());
+    right.nodes.push_back(Node());
+
+    boost::thread thread(SubtreeBuilder(*this, progress, objects, left, leftcell, maxlevel - 1, lefterror));
+
+    try
+    {
+        BuildRecursive(progress, objects, right, 0, 0, (unsigned int) right.indices.size(), rightcell, maxlevel - 1);
+
+        // keep reporting progress while waiting, so the task can still be paused or stopped
+        while(thread.timed_join(boost::posix_time::milliseconds(100)) == false)
+        {
+            if(ctx.reportProgress)
+                progress(right.progressBase + (unsigned int) right.nodes.size());
+        }
+    }
+    catch(...)
+    {
+        buildCancelled = true;
+        thread.join();
+        throw;
+    }
+
+    if(lefterror)
+        std::rethrow_exception(lefterror);
+
+    ctx.Splice(ichild, left);
+    ctx.Splice(ichild + 1, right);
+}
+
+void BSPTree::SetObjectNode(BuildContext& ctx, unsigned int inode, unsigned int indexbegin, unsigned int indexend)
 {
     unsigned int count = indexend - indexbegin;
 
@@ -688,53 +1131,53 @@ void BSPTree::SetObjectNode(unsigned int inode, unsigned int indexbegin, unsigne
     {
         fprintf(gFile, "# (%d) ", count);
         for(unsigned int i = indexbegin; i < indexend; i++)
-            fprintf(gFile, " %d", indices[i]);
+            fprintf(gFile, " %d", ctx.indices[i]);
         fprintf(gFile, "\n");
     }
 #endif
 
-    objectNodeCounter++;
+    ctx.objectNodeCounter++;
 
     // single object
     if(count == 1)
     {
-        nodes[inode].type = Node::Object;
-        nodes[inode].data = Node::SingleObject;
-        nodes[inode].index = indices[indexbegin];
+        ctx.nodes[inode].type = Node::Object;
+        ctx.nodes[inode].data = Node::SingleObject;
+        ctx.nodes[inode].index = ctx.indices[indexbegin];
 
-        maxObjectsInNode = max(maxObjectsInNode, (unsigned int)1);
-        objectsInTreeCounter += 1;
+        ctx.maxObjectsInNode = max(ctx.maxObjectsInNode, (unsigned int)1);
+        ctx.objectsInTreeCounter += 1;
     }
     // double object
     else if(count == 2)
     {
-        nodes[inode].type = Node::Object;
-        nodes[inode].data = Node::DoubleObject;
-        nodes[inode].index = indices[indexbegin];
-        nodes[inode].index2 = indices[indexbegin + 1];
+        ctx.nodes[inode].type = Node::Object;
+        ctx.nodes[inode].data = Node::DoubleObject;
+        ctx.nodes[inode].index = ctx.indices[indexbegin];
+        ctx.nodes[inode].index2 = ctx.indices[indexbegin + 1];
 
-        maxObjectsInNode = max(maxObjectsInNode, (unsigned int)2);
-        objectsInTreeCounter += 2;
+        ctx.maxObjectsInNode = max(ctx.maxObjectsInNode, (unsigned int)2);
+        ctx.objectsInTreeCounter += 2;
     }
     // object list
     else
     {
-        unsigned int s((unsigned int) lists.size());
+        unsigned int s((unsigned int) ctx.lists.size());
 
-        nodes[inode].type = Node::Object;
-        nodes[inode].data = Node::ObjectList;
-        nodes[inode].index = count; // length of list
-        nodes[inode].index2 = s; // list offset
+        ctx.nodes[inode].type = Node::Object;
+        ctx.nodes[inode].data = Node::ObjectList;
+        ctx.nodes[inode].index = count; // length of list
+        ctx.nodes[inode].index2 = s; // list offset
 
         // Note: It is actually *much* faster with the Microsoft STL for large trees to not call lists.reserve() here! [cjc] Need to check this for other STL implementations... [trf]
         // lists.reserve(s + c);
 
         // Note: This could first search for an already existing sequence of the same objects
         // and then adjust the value of index2 accordingly, which would reduce memory consumption [trf]
-        lists.insert(lists.end(), indices.begin() + indexbegin, indices.begin() + indexend);
+        ctx.lists.insert(ctx.lists.end(), ctx.indices.begin() + indexbegin, ctx.indices.begin() + indexend);
 
-        maxObjectsInNode = max(maxObjectsInNode, count);
-        objectsInTreeCounter += count;
+        ctx.maxObjectsInNode = max(ctx.maxObjectsInNode, count);
+        ctx.objectsInTreeCounter += count;
     }
 }
 
@@ -798,23 +1241,23 @@ void BSPTree::ValidateBounds(FILE *infile, const Objects& objects)
         throw POV_EXCEPTION(kFileDataErr, "Invalid separator line in node file");
 }
 
-void BSPTree::ReadRecursive(const Progress& progress, FILE *infile, unsigned int inode, unsigned int level, unsigned int maxIndex)
+void BSPTree::ReadRecursive(const Progress& progress, BuildContext& ctx, FILE *infile, unsigned int inode, unsigned int level, unsigned int maxIndex)
 {
     if (level == MAX_BSP_TREE_LEVEL)
         throw POV_EXCEPTION(kFileDataErr, "Depth in node file exceeded MAX_BSP_TREE_LEVEL");
 
-    if((nodes.size() - lastProgressNodeCounter) > NODE_PROGRESS_INTERVAL)
+    if((ctx.nodes.size() - ctx.lastProgressNodeCounter) > NODE_PROGRESS_INTERVAL)
     {
-        lastProgressNodeCounter = (unsigned int) nodes.size();
-        progress(lastProgressNodeCounter);
+        ctx.lastProgressNodeCounter = (unsigned int) ctx.nodes.size();
+        progress(ctx.lastProgressNodeCounter);
     }
 
-    maxTreeDepth = max(maxTreeDepth, level);
+    ctx.maxTreeDepth = max(ctx.maxTreeDepth, level);
     int c = fgetc(infile); // read node type
 
     if(c == '|') // split node
     {
-        unsigned int ichild = (unsigned int) nodes.size(); // child node position
+        unsigned int ichild = (unsigned int) ctx.nodes.size(); // child node position
         unsigned int bestaxis = 0;
         float bestplane = 0.0f;
 
@@ -827,20 +1270,20 @@ void BSPTree::ReadRecursive(const Progress& progress, FILE *infile, unsigned int
 #endif
 
         // create child nodes
-        nodes.push_back(Node());
-        nodes.push_back(Node());
+        ctx.nodes.push_back(Node());
+        ctx.nodes.push_back(Node());
 
         // set current node
-        nodes[inode].type = Node::Split;
-        nodes[inode].data = bestaxis;
-        nodes[inode].index = ichild;
-        nodes[inode].plane = bestplane;
+        ctx.nodes[inode].type = Node::Split;
+        ctx.nodes[inode].data = bestaxis;
+        ctx.nodes[inode].index = ichild;
+        ctx.nodes[inode].plane = bestplane;
 
         // left cell
-        ReadRecursive(progress, infile, ichild, level + 1, maxIndex);
+        ReadRecursive(progress, ctx, infile, ichild, level + 1, maxIndex);
 
         // right cell
-        ReadRecursive(progress, infile, ichild + 1, level + 1, maxIndex);
+        ReadRecursive(progress, ctx, infile, ichild + 1, level + 1, maxIndex);
     }
     else if(c == '#') // object node
     {
@@ -851,7 +1294,7 @@ void BSPTree::ReadRecursive(const Progress& progress, FILE *infile, unsigned int
 
         vector<unsigned int> ind(cnt);
 
-        treeDepthCounter += level;
+        ctx.treeDepthCounter += level;
 
         if (cnt == 0)
         {
@@ -859,18 +1302,18 @@ void BSPTree::ReadRecursive(const Progress& progress, FILE *infile, unsigned int
             if (gFile != nullptr)
                 fprintf(gFile, "%*s*\n", level * 2, "");
 #endif
-            nodes[inode].type = Node::Object;
-            nodes[inode].data = Node::Empty;
-            nodes[inode].index = 0;
-            emptyNodeCounter++;
+            ctx.nodes[inode].type = Node::Object;
+            ctx.nodes[inode].data = Node::Empty;
+            ctx.nodes[inode].index = 0;
+            ctx.emptyNodeCounter++;
             fscanf(infile, "\n");
             return;
         }
 
         if(level == MAX_BSP_TREE_LEVEL - 1)
         {
-            maxTreeDepthNodes++;
-            objectsAtMaxDepthCounter += cnt;
+            ctx.maxTreeDepthNodes++;
+            ctx.objectsAtMaxDepthCounter += cnt;
         }
 
         for(unsigned int i = 0; i < cnt; i++)
@@ -888,7 +1331,7 @@ void BSPTree::ReadRecursive(const Progress& progress, FILE *infile, unsigned int
             fprintf(gFile, "%*s", level * 2, "");
 #endif
 
-        SetObjectNode(inode, 0, (unsigned int) ind.size());
+        SetObjectNode(ctx, inode, 0, (unsigned int) ind.size());
     }
     else
     {
@@ -948,17 +1391,23 @@ BSPIntersectCondFunctor::BSPIntersectCondFunctor(Intersection& bi, const Ray& r,
     origin = BBoxVector3d(ray.Origin);
     invdir = BBoxVector3d(tmp);
     variant = (BBoxDirection)((int(invdir[X] < 0.0) << 2) | (int(invdir[Y] < 0.0) << 1) | int(invdir[Z] < 0.0));
+
+    unsigned int mask;
+    preconditionIsMask = precondition.GetFlagMask(ray, preconditionMask);
+    postconditionIsTrue = (postcondition.GetFlagMask(ray, mask) && (mask == 0));
 }
 
 bool BSPIntersectCondFunctor::operator()(unsigned int index, double& maxdist)
 {
     ObjectPtr object = objects[index];
 
-    if(precondition(ray, object, 0.0) == true)
+    if(preconditionIsMask ? !Test_Flag(object, preconditionMask) : precondition(ray, object, 0.0))
     {
         Intersection isect;
+        bool hit = (postconditionIsTrue ? Find_Intersection(&isect, object, ray, variant, origin, invdir, traceThreadData)
+                                        : Find_Intersection(&isect, object, ray, variant, origin, invdir, postcondition, traceThreadData));
 
-        if(Find_Intersection(&isect, object, ray, variant, origin, invdir, postcondition, traceThreadData) && (isect.Depth <= maxdist))
+        if(hit && (isect.Depth <= maxdist))
         {
             if(isect.Depth < bestisect.Depth)
             {
@@ -978,28 +1427,55 @@ bool BSPIntersectCondFunctor::operator()() const
 }
 
 
-BSPInsideCondFunctor::BSPInsideCondFunctor(Vector3d o, vector<ObjectPtr>& objs, TraceThreadData *t,
-                                           const PointObjectCondition& prec, const PointObjectCondition& postc) :
+BSPIntersectAnyCondFunctor::BSPIntersectAnyCondFunctor(Intersection& ai, const Ray& r, vector<ObjectPtr>& objs, TraceThreadData *t,
+                                                       const RayObjectCondition& prec, const RayObjectCondition& postc, const RayObjectCondition& term) :
     found(false),
-    origin(o),
+    done(false),
     objects(objs),
+    anyisect(ai),
+    ray(r),
+    traceThreadData(t),
     precondition(prec),
     postcondition(postc),
-    threadData(t)
+    terminate(term)
 {
+    Vector3d tmp(1.0 / ray.GetDirection()[X], 1.0 / ray.GetDirection()[Y], 1.0 /ray.GetDirection()[Z]);
+    origin = BBoxVector3d(ray.Origin);
+    invdir = BBoxVector3d(tmp);
+    variant = (BBoxDirection)((int(invdir[X] < 0.0) << 2) | (int(invdir[Y] < 0.0) << 1) | int(invdir[Z] < 0.0));
+
+    unsigned int mask;
+    preconditionIsMask = precondition.GetFlagMask(ray, preconditionMask);
+    postconditionIsTrue = (postcondition.GetFlagMask(ray, mask) && (mask == 0));
 }
 
-bool BSPInsideCondFunctor::operator()(unsigned int index)
+bool BSPIntersectAnyCondFunctor::operator()(unsigned int index, double& maxdist)
 {
     ObjectPtr object = objects[index];
-    if(precondition(origin, object))
-        if(Inside_BBox(origin, object->BBox) && object->Inside(origin, threadData))
-            if(postcondition(origin, object))
-                found = true;
+
+    if((done == false) && (preconditionIsMask ? !Test_Flag(object, preconditionMask) : precondition(ray, object, 0.0)))
+    {
+        Intersection isect;
+        bool hit = (postconditionIsTrue ? Find_Intersection(&isect, object, ray, variant, origin, invdir, traceThreadData)
+                                        : Find_Intersection(&isect, object, ray, variant, origin, invdir, postcondition, traceThreadData));
+
+        if(hit && (isect.Depth < maxdist))
+        {
+            anyisect = isect;
+            found = true;
+
+            if(terminate(ray, isect.Object, isect.Depth) == true)
+            {
+                done = true;
+                maxdist = -HUGE_VAL;
+            }
+        }
+    }
+
     return found;
 }
 
-bool BSPInsideCondFunctor::operator()() const
+bool BSPIntersectAnyCondFunctor::operator()() const
 {
     return found;
 }
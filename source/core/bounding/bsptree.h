@@ -44,6 +44,7 @@
 #include <cstdio>
 
 #include "core/bounding/boundingbox.h"
+#include "core/scene/object.h"
 
 namespace pov
 {
@@ -59,29 +60,59 @@ class BSPTree
 {
     public:
 
+        /// Set of objects already tested during the current tree query.
+        ///
+        /// Rather than clearing a flag per object for every query, each object carries the stamp
+        /// of the last query it was inserted in, so that clearing only requires advancing the
+        /// current stamp. The stamps only need to be reset whenever the counter wraps around.
+        ///
         class Mailbox
         {
                 friend class BSPTree;
             public:
-                inline Mailbox(unsigned int range) : objects((range >> 5) + 1), count(0) { }
-                inline void clear() { count = 0; memset(&objects[0], 0, objects.size() * sizeof(unsigned int)); } // using memset here as std::fill may not be fast with every standard libaray [trf]
+                inline Mailbox(unsigned int range) : objects(range), count(0), generation(1), hits(0), visits(0) { }
+                inline void clear()
+                {
+                    count = 0;
+                    hits = 0;
+                    visits = 0;
+                    if(++generation == 0)
+                    {
+                        if(!objects.empty())
+                            memset(&objects[0], 0, objects.size() * sizeof(Stamp)); // using memset here as std::fill may not be fast with every standard libaray [trf]
+                        generation = 1;
+                    }
+                }
                 inline unsigned int size() const { return count; }
+                /// number of insertions of objects already in mailbox since last @ref clear()
+                inline unsigned int redundant() const { return hits; }
+                /// number of tree nodes visited by ray traversal since last @ref clear()
+                inline unsigned int visited() const { return visits; }
 
                 inline bool insert(unsigned int i)
                 {
-                    if((objects[i >> 5] & (1 << (i & 31))) == 0)
+                    if(objects[i] != generation)
                     {
-                        objects[i >> 5] |= (1 << (i & 31));
+                        objects[i] = generation;
                         count++;
                         return true;
                     }
+                    hits++;
                     return false;
                 }
             private:
-                /// bit marking object (by index) in mailbox
-                vector<unsigned int> objects;
+                typedef unsigned short Stamp;
+
+                /// stamp of the query in which the object (by index) was last inserted
+                vector<Stamp> objects;
                 /// number of objects in mailbox
                 unsigned int count;
+                /// stamp of the current query
+                Stamp generation;
+                /// number of insertions of objects already in mailbox
+                unsigned int hits;
+                /// number of tree nodes visited
+                unsigned int visits;
 
                 /// unavailable
                 Mailbox();
@@ -136,10 +167,19 @@ class BSPTree
         void build(const Progress& progress, const Objects& objects,
                    unsigned int& nodes, unsigned int& splitNodes, unsigned int& objectNodes, unsigned int& emptyNodes,
                    unsigned int& maxObjects, float& averageObjects, unsigned int& maxDepth, float& averageDepth,
-                   unsigned int& aborts, float& averageAborts, float& averageAbortObjects, const UCS2String& inputFile);
+                   unsigned int& aborts, float& averageAborts, float& averageAbortObjects, const UCS2String& inputFile,
+                   unsigned int threads = 1, const UCS2String& cacheFile = UCS2String());
 
         void clear();
 
+        /// Gather size and quality figures of the tree.
+        ///
+        /// The costs are estimated from the surface areas of the nodes' cells relative to the
+        /// tree's bounding box, ignoring the savings due to the mailbox. Leaves are the tree's
+        /// object nodes, and inner nodes its split nodes.
+        ///
+        void GetStatistics(BBoxTreeStatistics& stats) const;
+
     private:
 
         struct Node
@@ -214,12 +254,59 @@ class BSPTree
             float rexit;
         };
 
+        /// State of a tree build.
+        ///
+        /// Each context holds a self-contained subtree, with its root at node index 0 and all
+        /// indices relative to its own arrays, so that independent subtrees can be built
+        /// concurrently and spliced into their parent afterwards.
+        ///
+        struct BuildContext
+        {
+            /// array of subtree nodes
+            vector<Node> nodes;
+            /// array of subtree object pointer lists
+            vector<unsigned int> lists;
+            /// object index list
+            vector<unsigned int> indices;
+            /// splits
+            vector<Split> splits[3];
+            /// set if the context is built on the caller's thread and may report progress
+            bool reportProgress;
+            /// number of nodes built elsewhere, to offset progress reports
+            unsigned int progressBase;
+            /// number of tree levels below the subtree root at which to build concurrently
+            unsigned int parallelLevels;
+            /// last node progress counter
+            unsigned int lastProgressNodeCounter;
+            /// maximum objects in node
+            unsigned int maxObjectsInNode;
+            /// maximum tree depth
+            unsigned int maxTreeDepth;
+            /// maximum tree depth nodes
+            unsigned int maxTreeDepthNodes;
+            /// empty node counter
+            unsigned int emptyNodeCounter;
+            /// object node counter
+            unsigned int objectNodeCounter;
+            /// objects in tree counter
+            POV_LONG objectsInTreeCounter;
+            /// objects at maximum depth counter
+            POV_LONG objectsAtMaxDepthCounter;
+            /// tree depth counter
+            POV_LONG treeDepthCounter;
+
+            BuildContext(bool rp, unsigned int pb, unsigned int pl);
+
+            /// Append a subtree, replacing the (leaf) node `inode` with the subtree root.
+            void Splice(unsigned int inode, const BuildContext& subtree);
+        };
+
+        class SubtreeBuilder;
+
         /// array of all nodes
         vector<Node> nodes;
         /// array of all object pointer lists
         vector<unsigned int> lists;
-        /// splits, only used while building tree
-        vector<Split> splits[3];
         /// lower left corner of bounding box
         Vector3d bmin;
         /// upper right corner of bounding box
@@ -234,31 +321,21 @@ class BSPTree
         const float childAccessCost;
         /// user-define miss chance
         const float missChance;
-        /// last node progress counter
-        unsigned int lastProgressNodeCounter;
-        /// maximum objects in node
-        unsigned int maxObjectsInNode;
-        /// maximum tree depth
-        unsigned int maxTreeDepth;
-        /// maximum tree depth nodes
-        unsigned int maxTreeDepthNodes;
-        /// empty node counter
-        unsigned int emptyNodeCounter;
-        /// object node counter
-        unsigned int objectNodeCounter;
-        /// objects in tree counter
-        POV_LONG objectsInTreeCounter;
-        /// objects at maximum depth counter
-        POV_LONG objectsAtMaxDepthCounter;
-        /// tree depth counter
-        POV_LONG treeDepthCounter;
-        /// object index list (only used while building tree)
-        vector<unsigned int> indices;
-
-        void BuildRecursive(const Progress& progress, const Objects& objects, unsigned int inode, unsigned int indexbegin, unsigned int indexend, MinMaxBoundingBox& cell, unsigned int maxlevel);
-        void SetObjectNode(unsigned int inode, unsigned int indexbegin, unsigned int indexend);
-
-        void ReadRecursive(const Progress& progress, FILE *infile, unsigned int inode, unsigned int level, unsigned int maxIndex);
+        /// set to abandon concurrently built subtrees (only used while building tree)
+        volatile bool buildCancelled;
+
+        void BuildTree(const Progress& progress, const Objects& objects, BuildContext& ctx, const UCS2String& inputFile);
+        void BuildRecursive(const Progress& progress, const Objects& objects, BuildContext& ctx, unsigned int inode, unsigned int indexbegin, unsigned int indexend, MinMaxBoundingBox& cell, unsigned int maxlevel);
+        void BuildParallel(const Progress& progress, const Objects& objects, BuildContext& ctx, unsigned int ichild, unsigned int begin, unsigned int middle, unsigned int end,
+                           unsigned int axis, float plane, MinMaxBoundingBox& cell, unsigned int maxlevel);
+        void SetObjectNode(BuildContext& ctx, unsigned int inode, unsigned int indexbegin, unsigned int indexend);
+        void GetStatisticsRecursive(BBoxTreeStatistics& stats, unsigned int inode, unsigned int depth, const Vector3d& cellMin, const Vector3d& cellMax, double rootArea) const;
+
+        POV_UINT64 ComputeCacheKey(const Objects& objects) const;
+        bool ReadCache(const UCS2String& cacheFile, POV_UINT64 key, const Objects& objects, BuildContext& ctx);
+        void WriteCache(const UCS2String& cacheFile, POV_UINT64 key, const Objects& objects, const BuildContext& ctx) const;
+
+        void ReadRecursive(const Progress& progress, BuildContext& ctx, FILE *infile, unsigned int inode, unsigned int level, unsigned int maxIndex);
         char *GetLine(char *str, int len, FILE *infile);
         void ValidateBounds(FILE *infile, const Objects& objects);
 };
@@ -305,24 +382,88 @@ class BSPIntersectCondFunctor : public BSPTree::Intersect
         TraceThreadData *traceThreadData;
         const RayObjectCondition& precondition;
         const RayObjectCondition& postcondition;
+        unsigned int preconditionMask;  ///< Flags tested instead of calling @ref precondition.
+        bool preconditionIsMask;        ///< Whether @ref precondition amounts to testing @ref preconditionMask.
+        bool postconditionIsTrue;       ///< Whether @ref postcondition is always met.
 };
 
+/// Intersection functor for any-hit queries.
+///
+/// Intersections closer than the search distance are recorded without narrowing it. Once an
+/// intersection satisfying the terminate condition has been found, the search distance is
+/// set to minus infinity, ending the traversal.
+///
+class BSPIntersectAnyCondFunctor : public BSPTree::Intersect
+{
+    public:
+
+        BSPIntersectAnyCondFunctor(Intersection& ai, const Ray& r, vector<ObjectPtr>& objs, TraceThreadData *t,
+                                   const RayObjectCondition& prec, const RayObjectCondition& postc, const RayObjectCondition& term);
+        virtual bool operator()(unsigned int index, double& maxdist);
+        virtual bool operator()() const;
+
+    private:
+
+        bool found;
+        bool done;
+        vector<ObjectPtr>& objects;
+        Intersection& anyisect;
+        const Ray& ray;
+        BBoxVector3d origin;
+        BBoxVector3d invdir;
+        BBoxDirection variant;
+        TraceThreadData *traceThreadData;
+        const RayObjectCondition& precondition;
+        const RayObjectCondition& postcondition;
+        const RayObjectCondition& terminate;
+        unsigned int preconditionMask;  ///< Flags tested instead of calling @ref precondition.
+        bool preconditionIsMask;        ///< Whether @ref precondition amounts to testing @ref preconditionMask.
+        bool postconditionIsTrue;       ///< Whether @ref postcondition is always met.
+};
+
+/// Inside functor testing objects subject to conditions.
+///
+/// The functor is templated on the condition types, so that conditions of final types with
+/// inline tests, such as those used to find the interiors containing a point, are compiled
+/// into the test rather than called for each object.
+///
+template<class Precondition = PointObjectCondition, class Postcondition = PointObjectCondition>
 class BSPInsideCondFunctor : public BSPTree::Inside
 {
     public:
 
         BSPInsideCondFunctor(Vector3d o, vector<ObjectPtr>& objs, TraceThreadData *t,
-                             const PointObjectCondition& prec, const PointObjectCondition& postc);
-        virtual bool operator()(unsigned int index);
-        virtual bool operator()() const;
+                             const Precondition& prec, const Postcondition& postc) :
+            found(false),
+            objects(objs),
+            origin(o),
+            precondition(prec),
+            postcondition(postc),
+            threadData(t)
+        {}
+
+        virtual bool operator()(unsigned int index)
+        {
+            ObjectPtr object = objects[index];
+            if(precondition(origin, object))
+                if(Inside_BBox(origin, object->BBox) && object->Inside(origin, threadData))
+                    if(postcondition(origin, object))
+                        found = true;
+            return found;
+        }
+
+        virtual bool operator()() const
+        {
+            return found;
+        }
 
     private:
 
         bool found;
         vector<ObjectPtr>& objects;
         Vector3d origin;
-        const PointObjectCondition& precondition;
-        const PointObjectCondition& postcondition;
+        const Precondition& precondition;
+        const Postcondition& postcondition;
         TraceThreadData *threadData;
 };
 
@@ -0,0 +1,277 @@
+//******************************************************************************
+///
+/// @file core/bounding/compactbvh.cpp
+///
+/// Implementation of compact per-object bounding volume hierarchies.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "core/bounding/compactbvh.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+/// Number of bins used to evaluate the surface area heuristic.
+const int COMPACT_BVH_SAH_BINS = 16;
+
+/// Depth beyond which nodes are split at the median.
+const int COMPACT_BVH_SAH_DEPTH = 32;
+
+static_assert(CompactBVH::kMaxDepth >= COMPACT_BVH_SAH_DEPTH + 34, "CompactBVH::kMaxDepth too small for median splits");
+
+/// Round a value down to the nearest single precision value.
+static inline float float_below(DBL value)
+{
+    float result = float(value);
+    return (DBL(result) > value) ? std::nextafter(result, -FLT_MAX) : result;
+}
+
+/// Round a value up to the nearest single precision value.
+static inline float float_above(DBL value)
+{
+    float result = float(value);
+    return (DBL(result) < value) ? std::nextafter(result, FLT_MAX) : result;
+}
+
+/// Surface area of a box, sans the constant factor.
+static inline DBL half_area(const Vector3d& min, const Vector3d& max)
+{
+    Vector3d d = max - min;
+    return d[X] * d[Y] + d[Y] * d[Z] + d[Z] * d[X];
+}
+
+/// Element bounds and centres, cached for the duration of the build.
+struct CompactBVHBuildData
+{
+    std::vector<float> bounds;      ///< Minimum x, y, z and maximum x, y, z per element.
+    std::vector<unsigned int>& order;
+    std::vector<CompactBVH::Node>& nodes;
+
+    CompactBVHBuildData(std::vector<unsigned int>& o, std::vector<CompactBVH::Node>& n) : order(o), nodes(n) {}
+
+    DBL min(unsigned int i, int axis) const { return bounds[6*i + axis]; }
+    DBL max(unsigned int i, int axis) const { return bounds[6*i + 3 + axis]; }
+    DBL centre(unsigned int i, int axis) const { return 0.5 * (min(i, axis) + max(i, axis)); }
+};
+
+/// Predicate selecting the elements whose centre falls into the bins up to a given one.
+struct CompactBVHBinPredicate
+{
+    const CompactBVHBuildData& build;
+    int axis;
+    DBL base;
+    DBL scale;
+    int bin;
+
+    CompactBVHBinPredicate(const CompactBVHBuildData& b, int a, DBL o, DBL s, int n) : build(b), axis(a), base(o), scale(s), bin(n) {}
+    bool operator()(unsigned int k) const { return std::min(int((build.centre(k, axis) - base) * scale), COMPACT_BVH_SAH_BINS - 1) <= bin; }
+};
+
+/// Predicate ordering elements by centre along a given axis.
+struct CompactBVHAxisLess
+{
+    const CompactBVHBuildData& build;
+    int axis;
+
+    CompactBVHAxisLess(const CompactBVHBuildData& b, int a) : build(b), axis(a) {}
+    bool operator()(unsigned int k1, unsigned int k2) const { return build.centre(k1, axis) < build.centre(k2, axis); }
+};
+
+/// Build the subtree for the elements `order[first]` to `order[last-1]`, in pre-order.
+static void build_node(CompactBVHBuildData& build, unsigned int first, unsigned int last, int depth)
+{
+    Vector3d bmin(BOUND_HUGE), bmax(-BOUND_HUGE);
+    Vector3d cmin(BOUND_HUGE), cmax(-BOUND_HUGE);
+    CompactBVH::Node node;
+    unsigned int index = (unsigned int)build.nodes.size();
+    unsigned int middle;
+    int axis;
+
+    for (unsigned int i = first; i < last; i++)
+    {
+        unsigned int k = build.order[i];
+
+        for (int a = 0; a < 3; a++)
+        {
+            bmin[a] = std::min(bmin[a], build.min(k, a));
+            bmax[a] = std::max(bmax[a], build.max(k, a));
+            cmin[a] = std::min(cmin[a], build.centre(k, a));
+            cmax[a] = std::max(cmax[a], build.centre(k, a));
+        }
+    }
+
+    for (int a = 0; a < 3; a++)
+    {
+        node.min[a] = float_below(bmin[a]);
+        node.max[a] = float_above(bmax[a]);
+    }
+
+    if (last - first <= CompactBVH::kLeafSize)
+    {
+        node.index = first;
+        node.count = last - first;
+        build.nodes.push_back(node);
+        return;
+    }
+
+    node.index = 0;
+    node.count = 0;
+    build.nodes.push_back(node);
+
+    axis = X;
+    if (cmax[Y] - cmin[Y] > cmax[axis] - cmin[axis])
+        axis = Y;
+    if (cmax[Z] - cmin[Z] > cmax[axis] - cmin[axis])
+        axis = Z;
+
+    DBL extent = cmax[axis] - cmin[axis];
+    middle = first + (last - first) / 2;
+
+    if ((extent > 0.0) && (depth < COMPACT_BVH_SAH_DEPTH))
+    {
+        // Bin the elements by centre, and pick the bin boundary with the lowest estimated cost.
+
+        unsigned int count[COMPACT_BVH_SAH_BINS] = { 0 };
+        Vector3d binMin[COMPACT_BVH_SAH_BINS];
+        Vector3d binMax[COMPACT_BVH_SAH_BINS];
+        DBL rightCost[COMPACT_BVH_SAH_BINS];
+        DBL scale = COMPACT_BVH_SAH_BINS * (1.0 - EPSILON) / extent;
+
+        for (int b = 0; b < COMPACT_BVH_SAH_BINS; b++)
+        {
+            binMin[b] = Vector3d(BOUND_HUGE);
+            binMax[b] = Vector3d(-BOUND_HUGE);
+        }
+
+        for (unsigned int i = first; i < last; i++)
+        {
+            unsigned int k = build.order[i];
+            int b = std::min(int((build.centre(k, axis) - cmin[axis]) * scale), COMPACT_BVH_SAH_BINS - 1);
+
+            count[b]++;
+            for (int a = 0; a < 3; a++)
+            {
+                binMin[b][a] = std::min(binMin[b][a], build.min(k, a));
+                binMax[b][a] = std::max(binMax[b][a], build.max(k, a));
+            }
+        }
+
+        Vector3d accMin(BOUND_HUGE), accMax(-BOUND_HUGE);
+        unsigned int acc = 0;
+
+        for (int b = COMPACT_BVH_SAH_BINS - 1; b > 0; b--)
+        {
+            acc += count[b];
+            accMin = min(accMin, binMin[b]);
+            accMax = max(accMax, binMax[b]);
+            rightCost[b] = (acc > 0) ? acc * half_area(accMin, accMax) : 0.0;
+        }
+
+        DBL bestCost = HUGE_VAL;
+        int bestBin = -1;
+
+        accMin = Vector3d(BOUND_HUGE);
+        accMax = Vector3d(-BOUND_HUGE);
+        acc = 0;
+
+        for (int b = 0; b < COMPACT_BVH_SAH_BINS - 1; b++)
+        {
+            acc += count[b];
+            accMin = min(accMin, binMin[b]);
+            accMax = max(accMax, binMax[b]);
+
+            if ((acc == 0) || (acc == last - first))
+                continue;
+
+            DBL cost = acc * half_area(accMin, accMax) + rightCost[b + 1];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestBin = b;
+            }
+        }
+
+        if (bestBin >= 0)
+        {
+            std::vector<unsigned int>::iterator split =
+                std::partition(build.order.begin() + first, build.order.begin() + last,
+                               CompactBVHBinPredicate(build, axis, cmin[axis], scale, bestBin));
+            middle = (unsigned int)(split - build.order.begin());
+        }
+    }
+    else if (extent > 0.0)
+    {
+        std::nth_element(build.order.begin() + first, build.order.begin() + middle, build.order.begin() + last,
+                         CompactBVHAxisLess(build, axis));
+    }
+
+    build_node(build, first, middle, depth + 1);
+    build.nodes[index].index = (unsigned int)build.nodes.size();
+    build_node(build, middle, last, depth + 1);
+}
+
+void CompactBVH::Build(const Elements& elements, std::vector<unsigned int>& order, std::vector<Node>& nodes)
+{
+    CompactBVHBuildData build(order, nodes);
+    const unsigned int count = elements.size();
+    Vector3d emin, emax;
+
+    POV_ASSERT(count > 0);
+
+    build.bounds.resize(6 * size_t(count));
+    for (unsigned int i = 0; i < count; i++)
+    {
+        elements.GetBounds(i, emin, emax);
+        for (int a = 0; a < 3; a++)
+        {
+            build.bounds[6*i + a]     = float_below(emin[a]);
+            build.bounds[6*i + 3 + a] = float_above(emax[a]);
+        }
+    }
+
+    order.resize(count);
+    for (unsigned int i = 0; i < count; i++)
+        order[i] = i;
+
+    nodes.clear();
+    nodes.reserve(2 * ((count + kLeafSize - 1) / kLeafSize));
+
+    build_node(build, 0, count, 0);
+}
+
+}
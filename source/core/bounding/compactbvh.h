@@ -0,0 +1,155 @@
+//******************************************************************************
+///
+/// @file core/bounding/compactbvh.h
+///
+/// Declarations related to compact per-object bounding volume hierarchies.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_CORE_COMPACTBVH_H
+#define POVRAY_CORE_COMPACTBVH_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "core/configcore.h"
+
+#include <vector>
+
+#include "core/math/vector.h"
+
+namespace pov
+{
+
+//##############################################################################
+///
+/// @addtogroup PovCoreBounding
+///
+/// @{
+
+/// Compact bounding volume hierarchy over the elements of a single primitive.
+///
+/// This is meant for primitives made up of vast numbers of small elements, such as particles or
+/// hair segments, where the memory taken by the hierarchy matters as much as its speed. Each node
+/// takes 32 bytes, and each leaf refers to a contiguous range of up to @ref kLeafSize elements,
+/// which the primitive is expected to store in the order given by the builder.
+///
+/// The hierarchy is built top-down with a binned surface area heuristic over the elements'
+/// centres. Beyond a certain depth, nodes are split at the median instead, so that the depth of
+/// the hierarchy, and thus the size of the traversal stack, is bounded regardless of the
+/// elements' distribution.
+///
+class CompactBVH
+{
+    public:
+
+        /// Maximum number of elements per leaf.
+        static const unsigned int kLeafSize = 4;
+
+        /// Maximum depth of the hierarchy, and thus the size needed for a traversal stack.
+        static const int kMaxDepth = 66;
+
+        /// Node of the hierarchy.
+        ///
+        /// Nodes are stored in pre-order, so that the first child of an inner node immediately
+        /// follows it. The bounds are rounded outward to single precision.
+        ///
+        struct Node
+        {
+            float min[3];           ///< Minimum x, y, z of the node's elements.
+            float max[3];           ///< Maximum x, y, z of the node's elements.
+            unsigned int index;     ///< Index of the second child node, or of a leaf's first element.
+            unsigned int count;     ///< Number of elements in a leaf, zero for an inner node.
+        };
+
+        /// Interface to the elements to build a hierarchy for.
+        class Elements
+        {
+            public:
+                virtual ~Elements() {}
+                virtual unsigned int size() const = 0;
+                /// Get the bounds of an element.
+                virtual void GetBounds(unsigned int i, Vector3d& min, Vector3d& max) const = 0;
+        };
+
+        /// Build a hierarchy.
+        ///
+        /// @param[in]  elements    Elements to build the hierarchy for; must not be empty.
+        /// @param[out] order       Original indices of the elements, in the order referred to by
+        ///                         the leaves.
+        /// @param[out] nodes       Nodes of the hierarchy, root first.
+        ///
+        static void Build(const Elements& elements, std::vector<unsigned int>& order, std::vector<Node>& nodes);
+
+        /// Test whether a ray hits a node's bounds.
+        ///
+        /// @note   Degenerate slabs, where the ray runs parallel to a face and starts on it, yield
+        ///         NaN distances; these fail all comparisons and thus leave the interval unchanged.
+        ///
+        static inline bool IntersectNode(const Node& node, const Vector3d& origin, const Vector3d& invDirection)
+        {
+            DBL tmin = 0.0;
+            DBL tmax = BOUND_HUGE;
+
+            for (int i = 0; i < 3; i++)
+            {
+                DBL t1 = (DBL(node.min[i]) - origin[i]) * invDirection[i];
+                DBL t2 = (DBL(node.max[i]) - origin[i]) * invDirection[i];
+
+                if (t1 > t2)
+                {
+                    DBL t = t1;
+                    t1 = t2;
+                    t2 = t;
+                }
+
+                if (t1 > tmin)
+                    tmin = t1;
+                if (t2 < tmax)
+                    tmax = t2;
+            }
+
+            return (tmin <= tmax);
+        }
+
+        /// Test whether a point is within a node's bounds.
+        static inline bool InsideNode(const Node& node, const Vector3d& p)
+        {
+            return (p[X] >= node.min[X]) && (p[X] <= node.max[X]) &&
+                   (p[Y] >= node.min[Y]) && (p[Y] <= node.max[Y]) &&
+                   (p[Z] >= node.min[Z]) && (p[Z] <= node.max[Z]);
+        }
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_CORE_COMPACTBVH_H
@@ -0,0 +1,954 @@
+//******************************************************************************
+///
+/// @file core/bounding/flatbvh.cpp
+///
+/// Implementations related to the flattened 4-wide bounding volume hierarchy.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "core/bounding/flatbvh.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#include "base/memoryaccounting.h"
+
+#include "core/render/ray.h"
+#include "core/scene/object.h"
+#include "core/scene/tracethreaddata.h"
+#include "core/shape/plane.h"
+#include "core/shape/sphere.h"
+#include "core/shape/triangle.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+// Inverse direction to use for axes the ray runs parallel to; large enough to
+// push the slab planes out of reach, yet finite to avoid NaNs in the node test.
+const float FLAT_BVH_HUGE_INV_DIRECTION = 1.0e30f;
+const size_t FLAT_BVH_NODE_ALIGNMENT = 64;
+// Largest quantised coordinate value in compressed nodes.
+const int FLAT_BVH_QUANT_MAX = 255;
+// Margin by which quantised bounds are pushed outward, relative to the magnitude of the
+// coordinates involved, to make up for rounding errors when decompressing.
+const DBL FLAT_BVH_QUANT_MARGIN = 4.0 * FLT_EPSILON;
+// Tolerances of the single precision pre-tests, as a fixed part and a part relative to the
+// magnitude of the terms involved; both are chosen generously, as they only need to keep
+// grazing hits from being discarded, while the bulk of misses is clear-cut.
+const float FLAT_BVH_PREFILTER_TOLERANCE = 1.0e-4f;
+const float FLAT_BVH_PREFILTER_REL_TOLERANCE = 1.0e-5f;
+// Tolerance, relative to the depth of the nearest intersection so far, by which infinite planes
+// may lie beyond it without being skipped, to make up for rounding differences.
+const double FLAT_BVH_PLANE_REL_TOLERANCE = 1.0e-9;
+
+FlatBVH::NodeTestFunction FlatBVHNodeTest = PortableFlatBVHNodeTest;
+
+static const char* gFlatBVHNodeTestInfo = "generic";
+
+FlatBVH::RayData::RayData(const BasicRay& ray)
+{
+    for(int dim = X; dim <= Z; dim++)
+    {
+        origin[dim] = ray.Origin[dim];
+
+        if(ray.Direction[dim] != 0.0)
+            invDirection[dim] = 1.0 / ray.Direction[dim];
+        else
+            invDirection[dim] = FLAT_BVH_HUGE_INV_DIRECTION;
+
+        // Choose near and far planes depending on the ray direction.
+        nearRow[dim] = (invDirection[dim] >= 0.0f ? dim     : dim + 3);
+        farRow[dim]  = (invDirection[dim] >= 0.0f ? dim + 3 : dim);
+    }
+}
+
+FlatBVH::FlatBVH(const BBOX_TREE *root, bool compress, bool prefilter) :
+    nodes(nullptr),
+    compressedNodes(nullptr),
+    nodeCount(0),
+    nodeMemory(nullptr)
+{
+    vector<const BBOX_TREE *> items;
+    vector<Node> buildNodes;
+
+    if(root != nullptr)
+        CollectItems(root, items);
+
+    if(!items.empty())
+        BuildNode(buildNodes, &items[0], items.size());
+
+    nodeCount = buildNodes.size();
+    if(nodeCount > 0)
+    {
+        size_t nodeSize = (compress ? sizeof(CompressedNode) : sizeof(Node));
+        nodeMemory = new char[nodeCount * nodeSize + FLAT_BVH_NODE_ALIGNMENT];
+        MemoryAccounting::Allocate(kMemoryBounding, nodeCount * nodeSize + FLAT_BVH_NODE_ALIGNMENT);
+        char *alignedMemory = nodeMemory + (FLAT_BVH_NODE_ALIGNMENT - (reinterpret_cast<size_t>(nodeMemory) % FLAT_BVH_NODE_ALIGNMENT)) % FLAT_BVH_NODE_ALIGNMENT;
+
+        if(compress)
+        {
+            compressedNodes = reinterpret_cast<CompressedNode *>(alignedMemory);
+            for(unsigned int i = 0; i < nodeCount; i++)
+                CompressNode(buildNodes[i], compressedNodes[i]);
+        }
+        else
+        {
+            nodes = reinterpret_cast<Node *>(alignedMemory);
+            std::memcpy(nodes, &buildNodes[0], nodeCount * sizeof(Node));
+        }
+    }
+
+    if(prefilter)
+        BuildPrefilters();
+
+    BuildInfinitePlanes();
+}
+
+FlatBVH::~FlatBVH()
+{
+    if(nodeMemory != nullptr)
+        MemoryAccounting::Release(kMemoryBounding, nodeCount * GetNodeSize() + FLAT_BVH_NODE_ALIGNMENT);
+    if(!prefilters.empty())
+        MemoryAccounting::Release(kMemoryBounding, prefilters.size() * sizeof(Prefilter));
+    delete[] nodeMemory;
+}
+
+void FlatBVH::BuildPrefilters()
+{
+    bool any = false;
+
+    prefilters.resize(elements.size());
+    for(size_t i = 0; i < elements.size(); i++)
+    {
+        Prefilter& prefilter = prefilters[i];
+
+        prefilter.kind = PrefilterKind(elements[i]);
+        for(int dim = X; dim <= Z; dim++)
+        {
+            prefilter.anchor[dim] = 0.0;
+            prefilter.edge1[dim] = prefilter.edge2[dim] = 0.0f;
+        }
+
+        if(prefilter.kind == kPrefilterTriangle)
+        {
+            const Triangle *triangle = static_cast<const Triangle *>(elements[i]);
+            for(int dim = X; dim <= Z; dim++)
+            {
+                prefilter.anchor[dim] = triangle->P1[dim];
+                prefilter.edge1[dim] = float(triangle->P2[dim] - triangle->P1[dim]);
+                prefilter.edge2[dim] = float(triangle->P3[dim] - triangle->P1[dim]);
+            }
+            any = true;
+        }
+        else if(prefilter.kind == kPrefilterSphere)
+        {
+            const Sphere *sphere = static_cast<const Sphere *>(elements[i]);
+            for(int dim = X; dim <= Z; dim++)
+                prefilter.anchor[dim] = sphere->Center[dim];
+            prefilter.edge1[0] = float(Sqr(sphere->Radius));
+            any = true;
+        }
+    }
+
+    // Don't bother if there is nothing to pre-test.
+    if(any)
+        MemoryAccounting::Allocate(kMemoryBounding, prefilters.size() * sizeof(Prefilter));
+    else
+        vector<Prefilter>().swap(prefilters);
+}
+
+void FlatBVH::BuildInfinitePlanes()
+{
+    const size_t count = infiniteElements.size();
+    bool any = false;
+
+    infinitePlanes.assign(5 * count, 0.0);
+    for(size_t i = 0; i < count; i++)
+    {
+        const Plane *plane = dynamic_cast<const Plane *>(infiniteElements[i]);
+
+        if((plane == nullptr) || (plane->Trans != nullptr))
+            continue;
+
+        for(int dim = X; dim <= Z; dim++)
+            infinitePlanes[dim * count + i] = plane->Normal_Vector[dim];
+        infinitePlanes[3 * count + i] = plane->Distance;
+        infinitePlanes[4 * count + i] = 1.0;
+        any = true;
+    }
+
+    // Don't bother if there is nothing to pre-test.
+    if(!any)
+        vector<double>().swap(infinitePlanes);
+}
+
+// Compute the depths at which a ray hits the planes of the infinite elements, the same way as
+// the planes' own intersection test does; the result is meaningless for other elements.
+void FlatBVH::InfinitePlaneDepths(const BasicRay& ray, double *depths) const
+{
+    const size_t count = infiniteElements.size();
+    const double *normalX  = &infinitePlanes[0];
+    const double *normalY  = normalX + count;
+    const double *normalZ  = normalY + count;
+    const double *distance = normalZ + count;
+
+    for(size_t i = 0; i < count; i++)
+    {
+        DBL normalDotDirection = normalX[i] * ray.Direction[X] + normalY[i] * ray.Direction[Y] + normalZ[i] * ray.Direction[Z];
+        DBL normalDotOrigin    = normalX[i] * ray.Origin[X]    + normalY[i] * ray.Origin[Y]    + normalZ[i] * ray.Origin[Z];
+        depths[i] = -(normalDotOrigin + distance[i]) / normalDotDirection;
+    }
+}
+
+int FlatBVH::PrefilterKind(ConstObjectPtr object)
+{
+    if(dynamic_cast<const Triangle *>(object) != nullptr)
+        return kPrefilterTriangle;
+
+    const Sphere *sphere = dynamic_cast<const Sphere *>(object);
+    if((sphere != nullptr) && !sphere->IsEllipsoid())
+        return kPrefilterSphere;
+
+    return kPrefilterNone;
+}
+
+// Test which of the hit element children of a node a ray certainly misses, judging by their
+// pre-test data; the elements are batched by kind, so that each kind's test runs only once.
+unsigned int FlatBVH::PrefilterMiss(const Node& node, unsigned int mask, const Prefilter *prefilters, const BasicRay& ray, const float *direction)
+{
+    const Prefilter *spheres[kWidth];
+    const Prefilter *triangles[kWidth];
+    int sphereSlot[kWidth];
+    int triangleSlot[kWidth];
+    int sphereCount = 0;
+    int triangleCount = 0;
+    unsigned int miss = 0;
+    unsigned int batchMiss;
+
+    for(int i = 0; i < node.entries; i++)
+    {
+        if(((mask & (1u << i)) == 0) || (node.child[i] >= 0))
+            continue;
+
+        const Prefilter& prefilter = prefilters[~node.child[i]];
+        if(prefilter.kind == kPrefilterSphere)
+        {
+            spheres[sphereCount] = &prefilter;
+            sphereSlot[sphereCount++] = i;
+        }
+        else if(prefilter.kind == kPrefilterTriangle)
+        {
+            triangles[triangleCount] = &prefilter;
+            triangleSlot[triangleCount++] = i;
+        }
+    }
+
+    if(sphereCount > 0)
+    {
+        batchMiss = PrefilterSpheresMiss(spheres, sphereCount, ray, direction);
+        for(int k = 0; k < sphereCount; k++)
+            if((batchMiss & (1u << k)) != 0)
+                miss |= (1u << sphereSlot[k]);
+    }
+
+    if(triangleCount > 0)
+    {
+        batchMiss = PrefilterTrianglesMiss(triangles, triangleCount, ray, direction);
+        for(int k = 0; k < triangleCount; k++)
+            if((batchMiss & (1u << k)) != 0)
+                miss |= (1u << triangleSlot[k]);
+    }
+
+    return miss;
+}
+
+// Test which of up to four spheres a ray certainly misses, judging by their pre-test data.
+// Errs on the side of reporting a potential hit. Slots beyond the given count repeat the first
+// sphere, so that the loop always runs over all of them.
+unsigned int FlatBVH::PrefilterSpheresMiss(const Prefilter * const *batch, int count, const BasicRay& ray, const float *direction)
+{
+    float s[3][kWidth];
+    float radius2[kWidth];
+    int lost[kWidth];
+    unsigned int miss = 0;
+
+    for(int i = 0; i < kWidth; i++)
+    {
+        const Prefilter& prefilter = *batch[i < count ? i : 0];
+        for(int dim = X; dim <= Z; dim++)
+            s[dim][i] = float(ray.Origin[dim] - prefilter.anchor[dim]);
+        radius2[i] = prefilter.edge1[0];
+    }
+
+    float a = direction[X] * direction[X] + direction[Y] * direction[Y] + direction[Z] * direction[Z];
+
+    for(int i = 0; i < kWidth; i++)
+    {
+        float b = s[X][i] * direction[X] + s[Y][i] * direction[Y] + s[Z][i] * direction[Z];
+        float ss = s[X][i] * s[X][i] + s[Y][i] * s[Y][i] + s[Z][i] * s[Z][i];
+        float disc = b * b - a * (ss - radius2[i]);
+        float tolerance = FLAT_BVH_PREFILTER_REL_TOLERANCE * (b * b + a * (ss + radius2[i]));
+
+        lost[i] = (disc < -tolerance);
+    }
+
+    for(int i = 0; i < count; i++)
+        miss |= (unsigned int)(lost[i]) << i;
+
+    return miss;
+}
+
+// Test which of up to four triangles a ray certainly misses, judging by their pre-test data,
+// using the barycentric coordinates of the ray's intersection with each triangle's plane as per
+// the Moeller-Trumbore algorithm. Errs on the side of reporting a potential hit. Slots beyond the
+// given count repeat the first triangle, so that the loop always runs over all of them.
+unsigned int FlatBVH::PrefilterTrianglesMiss(const Prefilter * const *batch, int count, const BasicRay& ray, const float *direction)
+{
+    float s[3][kWidth];
+    float e1[3][kWidth];
+    float e2[3][kWidth];
+    int lost[kWidth];
+    unsigned int miss = 0;
+
+    for(int i = 0; i < kWidth; i++)
+    {
+        const Prefilter& prefilter = *batch[i < count ? i : 0];
+        for(int dim = X; dim <= Z; dim++)
+        {
+            s[dim][i] = float(ray.Origin[dim] - prefilter.anchor[dim]);
+            e1[dim][i] = prefilter.edge1[dim];
+            e2[dim][i] = prefilter.edge2[dim];
+        }
+    }
+
+    float dNorm = fabs(direction[X]) + fabs(direction[Y]) + fabs(direction[Z]);
+
+    for(int i = 0; i < kWidth; i++)
+    {
+        float p[3], q[3];
+
+        p[X] = direction[Y] * e2[Z][i] - direction[Z] * e2[Y][i];
+        p[Y] = direction[Z] * e2[X][i] - direction[X] * e2[Z][i];
+        p[Z] = direction[X] * e2[Y][i] - direction[Y] * e2[X][i];
+        float det = e1[X][i] * p[X] + e1[Y][i] * p[Y] + e1[Z][i] * p[Z];
+
+        q[X] = s[Y][i] * e1[Z][i] - s[Z][i] * e1[Y][i];
+        q[Y] = s[Z][i] * e1[X][i] - s[X][i] * e1[Z][i];
+        q[Z] = s[X][i] * e1[Y][i] - s[Y][i] * e1[X][i];
+
+        float uNum = s[X][i] * p[X] + s[Y][i] * p[Y] + s[Z][i] * p[Z];
+        float vNum = direction[X] * q[X] + direction[Y] * q[Y] + direction[Z] * q[Z];
+
+        float sNorm = fabs(s[X][i]) + fabs(s[Y][i]) + fabs(s[Z][i]);
+        float pNorm = fabs(p[X]) + fabs(p[Y]) + fabs(p[Z]);
+        float e1Norm = fabs(e1[X][i]) + fabs(e1[Y][i]) + fabs(e1[Z][i]);
+        float absDet = fabs(det);
+
+        // Rays (nearly) parallel to the plane are left to the exact test; the division by zero
+        // this may entail in the other lanes' arithmetic is harmless, as its result is discarded.
+        int parallel = (absDet <= FLAT_BVH_PREFILTER_REL_TOLERANCE * e1Norm * pNorm);
+
+        float tolerance = FLAT_BVH_PREFILTER_TOLERANCE + FLAT_BVH_PREFILTER_REL_TOLERANCE * sNorm * (pNorm + dNorm * e1Norm) / absDet;
+        float u = uNum / det;
+        float v = vNum / det;
+
+        lost[i] = (parallel == 0) & ((u < -tolerance) | (v < -tolerance) | (u + v > 1.0f + tolerance));
+    }
+
+    for(int i = 0; i < count; i++)
+        miss |= (unsigned int)(lost[i]) << i;
+
+    return miss;
+}
+
+// Orders the children of a node by kind: subtrees first, then elements by pre-test kind.
+struct FlatBVHChildKindLess
+{
+    static int Key(const BBOX_TREE *item)
+    {
+        return (item->Entries > 0 ? -1 : FlatBVH::PrefilterKind(reinterpret_cast<ConstObjectPtr>(item->Node)));
+    }
+    bool operator()(const BBOX_TREE *left, const BBOX_TREE *right) const { return Key(left) < Key(right); }
+};
+
+// Sort the top level of the tree into finite items and infinite elements.
+void FlatBVH::CollectItems(const BBOX_TREE *node, vector<const BBOX_TREE *>& items)
+{
+    if(node->Infinite)
+    {
+        if(node->Entries == 0)
+            infiniteElements.push_back(reinterpret_cast<ObjectPtr>(node->Node));
+        else
+        {
+            for(short i = 0; i < node->Entries; i++)
+                CollectItems(node->Node[i], items);
+        }
+    }
+    else
+        items.push_back(node);
+}
+
+int FlatBVH::BuildNode(vector<Node>& buildNodes, const BBOX_TREE * const *items, size_t count)
+{
+    vector<const BBOX_TREE *> list(items, items + count);
+
+    // Pull up grandchildren as long as they fit, preferring those of the largest
+    // children as these are the least likely to be culled by their own box.
+    while(list.size() < kWidth)
+    {
+        ptrdiff_t best = -1;
+        BBoxScalar bestArea = -1.0;
+
+        for(size_t i = 0; i < list.size(); i++)
+        {
+            if((list[i]->Entries > 0) && (list.size() - 1 + list[i]->Entries <= kWidth) && (BBOX_HALF_AREA(list[i]->BBox) > bestArea))
+            {
+                best = i;
+                bestArea = BBOX_HALF_AREA(list[i]->BBox);
+            }
+        }
+
+        if(best < 0)
+            break;
+
+        const BBOX_TREE *opened = list[best];
+        list.erase(list.begin() + best);
+        list.insert(list.end(), opened->Node, opened->Node + opened->Entries);
+    }
+
+    // Group element children of the same kind, so that they are pre-tested together and
+    // their pre-test data is adjacent in memory.
+    if(list.size() <= kWidth)
+        std::stable_sort(list.begin(), list.end(), FlatBVHChildKindLess());
+
+    int index = buildNodes.size();
+    buildNodes.push_back(Node());
+
+    for(int i = 0; i < kWidth; i++)
+    {
+        for(int dim = X; dim <= Z; dim++)
+        {
+            buildNodes[index].bounds[dim][i]     =  FLT_MAX;
+            buildNodes[index].bounds[dim + 3][i] = -FLT_MAX;
+        }
+        buildNodes[index].child[i] = kEmptySlot;
+    }
+    buildNodes[index].entries = 0;
+
+    // Nodes with too many children to fit are split into groups of consecutive children.
+    size_t chunk = (list.size() + kWidth - 1) / kWidth;
+
+    for(int i = 0; i < kWidth; i++)
+    {
+        size_t first = i * chunk;
+        if(first >= list.size())
+            break;
+
+        size_t n = min(chunk, list.size() - first);
+        BoundingBox bbox;
+        int child;
+
+        if(n == 1)
+        {
+            bbox = list[first]->BBox;
+            child = BuildChild(buildNodes, list[first]);
+        }
+        else
+        {
+            BBoxVector3d mins(BOUND_HUGE), maxs(-BOUND_HUGE), lo, hi;
+            for(size_t j = first; j < first + n; j++)
+            {
+                Make_min_max_from_BBox(lo, hi, list[j]->BBox);
+                mins = min(mins, lo);
+                maxs = max(maxs, hi);
+            }
+            Make_BBox_from_min_max(bbox, mins, maxs);
+            child = BuildNode(buildNodes, &list[first], n);
+        }
+
+        Node& node = buildNodes[index];
+        for(int dim = X; dim <= Z; dim++)
+        {
+            node.bounds[dim][i]     = bbox.lowerLeft[dim];
+            node.bounds[dim + 3][i] = bbox.lowerLeft[dim] + bbox.size[dim];
+        }
+        node.child[i] = child;
+        node.entries++;
+    }
+
+    return index;
+}
+
+int FlatBVH::BuildChild(vector<Node>& buildNodes, const BBOX_TREE *item)
+{
+    if(item->Entries > 0)
+        return BuildNode(buildNodes, item->Node, item->Entries);
+
+    elements.push_back(reinterpret_cast<ObjectPtr>(item->Node));
+    elementBounded.push_back(elements.back()->Bound.empty() ? 0 : 1);
+    return ~int(elements.size() - 1);
+}
+
+void FlatBVH::CompressNode(const Node& node, CompressedNode& compressed)
+{
+    for(int dim = X; dim <= Z; dim++)
+    {
+        DBL lo = HUGE_VAL;
+        DBL hi = -HUGE_VAL;
+
+        for(int i = 0; i < node.entries; i++)
+        {
+            lo = min(lo, DBL(node.bounds[dim][i]));
+            hi = max(hi, DBL(node.bounds[dim + 3][i]));
+        }
+
+        if(node.entries == 0)
+            lo = hi = 0.0;
+
+        // Decompressing in single precision may place a bound up to a few units in the last place
+        // off, so all bounds are pushed outward by a margin covering that, and the step size is
+        // kept from becoming zero for flat nodes.
+        DBL margin = FLAT_BVH_QUANT_MARGIN * max(fabs(lo), fabs(hi)) + FLT_MIN;
+        DBL origin = lo - margin;
+
+        compressed.origin[dim] = float(origin);
+        if(DBL(compressed.origin[dim]) > origin)
+            compressed.origin[dim] = nextafterf(compressed.origin[dim], -FLT_MAX);
+        origin = compressed.origin[dim];
+
+        compressed.step[dim] = float((hi + margin - origin) / FLAT_BVH_QUANT_MAX);
+        while(origin + FLAT_BVH_QUANT_MAX * DBL(compressed.step[dim]) < hi + margin)
+            compressed.step[dim] = nextafterf(compressed.step[dim], FLT_MAX);
+        DBL step = compressed.step[dim];
+
+        for(int i = 0; i < kWidth; i++)
+        {
+            if(i < node.entries)
+            {
+                DBL qlo = floor((DBL(node.bounds[dim][i])     - margin - origin) / step);
+                DBL qhi = ceil ((DBL(node.bounds[dim + 3][i]) + margin - origin) / step);
+                compressed.bounds[dim][i]     = (unsigned char)(clip<DBL>(qlo, 0, FLAT_BVH_QUANT_MAX));
+                compressed.bounds[dim + 3][i] = (unsigned char)(clip<DBL>(qhi, 0, FLAT_BVH_QUANT_MAX));
+            }
+            else
+            {
+                compressed.bounds[dim][i]     = 0;
+                compressed.bounds[dim + 3][i] = 0;
+            }
+        }
+    }
+
+    for(int i = 0; i < kWidth; i++)
+        compressed.child[i] = (i < node.entries ? node.child[i] : kEmptySlot);
+}
+
+void FlatBVH::DecompressNode(const CompressedNode& compressed, Node& node)
+{
+    node.entries = 0;
+
+    for(int i = 0; i < kWidth; i++)
+    {
+        node.child[i] = compressed.child[i];
+
+        if(compressed.child[i] == kEmptySlot)
+        {
+            for(int dim = X; dim <= Z; dim++)
+            {
+                node.bounds[dim][i]     =  FLT_MAX;
+                node.bounds[dim + 3][i] = -FLT_MAX;
+            }
+            continue;
+        }
+
+        for(int dim = X; dim <= Z; dim++)
+        {
+            node.bounds[dim][i]     = compressed.origin[dim] + float(compressed.bounds[dim][i])     * compressed.step[dim];
+            node.bounds[dim + 3][i] = compressed.origin[dim] + float(compressed.bounds[dim + 3][i]) * compressed.step[dim];
+        }
+        node.entries++;
+    }
+}
+
+unsigned int PortableFlatBVHNodeTest(const FlatBVH::Node& node, const FlatBVH::RayData& ray, float maxDist, float *entryDist)
+{
+    unsigned int mask = 0;
+
+    for(int i = 0; i < FlatBVH::kWidth; i++)
+    {
+        float tnear = -FLT_MAX;
+        float tfar  = maxDist;
+
+        for(int dim = X; dim <= Z; dim++)
+        {
+            float t0 = (node.bounds[ray.nearRow[dim]][i] - ray.origin[dim]) * ray.invDirection[dim];
+            float t1 = (node.bounds[ray.farRow[dim]][i]  - ray.origin[dim]) * ray.invDirection[dim];
+            tnear = (t0 > tnear ? t0 : tnear);
+            tfar  = (t1 < tfar  ? t1 : tfar);
+        }
+
+        entryDist[i] = tnear;
+        if((tnear <= tfar) && (tfar >= float(EPSILON)))
+            mask |= (1u << i);
+    }
+
+    return mask;
+}
+
+template<class LeafTest>
+bool FlatBVH::Traverse(TraversalStack& stack, const Ray& ray, Intersection *bestIsect, LeafTest& leafTest, TraceThreadData *thread) const
+{
+    bool found = false;
+    RenderStatistics& stats = thread->Stats();
+
+    if(infinitePlanes.empty())
+    {
+        for(vector<ObjectPtr>::const_iterator i = infiniteElements.begin(); i != infiniteElements.end(); i++)
+            found = leafTest(*i) || found;
+    }
+    else
+    {
+        const size_t count = infiniteElements.size();
+        const double *isPlane = &infinitePlanes[4 * count];
+        vector<double>& depths = stack.infiniteDepths;
+
+        depths.resize(count);
+        InfinitePlaneDepths(ray, &depths[0]);
+
+        // A plane is certainly missed if hit behind the ray's origin or beyond the nearest
+        // intersection so far; a ray parallel to it yields no valid depth and is left to its test.
+        for(size_t i = 0; i < count; i++)
+        {
+            double limit = bestIsect->Depth + fabs(bestIsect->Depth) * FLAT_BVH_PLANE_REL_TOLERANCE;
+            if((isPlane[i] != 0.0) && ((depths[i] < 0.0) || (depths[i] > limit)))
+                continue;
+            found = leafTest(infiniteElements[i]) || found;
+        }
+    }
+
+    if(nodeCount == 0)
+        return found;
+
+    RayData rayData(ray);
+    float direction[3] = { float(ray.Direction[X]), float(ray.Direction[Y]), float(ray.Direction[Z]) };
+    const Prefilter *prefilter = (prefilters.empty() ? nullptr : &prefilters[0]);
+    vector<TraversalStack::Entry>& entries = stack.entries;
+    TraversalStack::Entry entry;
+
+    entries.clear();
+    entry.node = 0;
+    entry.dist = -FLT_MAX;
+    entries.push_back(entry);
+
+    while(!entries.empty())
+    {
+        entry = entries.back();
+        entries.pop_back();
+
+        // Boxes entered beyond the best intersection found so far cannot contribute.
+        if(entry.dist > bestIsect->Depth)
+            continue;
+
+        // Optimized node tests may rely on nodes being aligned like those in the node array.
+        alignas(FLAT_BVH_NODE_ALIGNMENT) Node scratch;
+        const Node& node = GetNode(entry.node, scratch);
+        float dist[kWidth];
+        float maxDist = (bestIsect->Depth < FLT_MAX ? float(bestIsect->Depth) : FLT_MAX);
+        unsigned int mask = FlatBVHNodeTest(node, rayData, maxDist, dist);
+        unsigned int miss = 0;
+
+        stats[nChecked] += node.entries;
+
+        if(prefilter != nullptr)
+            miss = PrefilterMiss(node, mask, prefilter, ray, direction);
+
+        // Test hit elements right away, and push hit subtrees far-to-near.
+        size_t base = entries.size();
+        for(int i = 0; i < node.entries; i++)
+        {
+            if((mask & (1u << i)) == 0)
+                continue;
+
+            stats[nEnqueued]++;
+
+            if(node.child[i] < 0)
+            {
+                if((miss & (1u << i)) != 0)
+                    continue;
+                found = leafTest(elements[~node.child[i]], elementBounded[~node.child[i]] != 0) || found;
+            }
+            else
+            {
+                entry.node = node.child[i];
+                entry.dist = dist[i];
+                size_t j = entries.size();
+                entries.push_back(entry);
+                while((j > base) && (entries[j - 1].dist < entry.dist))
+                {
+                    entries[j] = entries[j - 1];
+                    j--;
+                }
+                entries[j] = entry;
+            }
+        }
+    }
+
+    return found;
+}
+
+class FlatBVHLeafTest
+{
+    public:
+        FlatBVHLeafTest(const Ray& r, Intersection *bi, TraceThreadData *t) : ray(r), bestIsect(bi), thread(t) {}
+        bool operator()(ObjectPtr object)
+        {
+            Intersection isect;
+            if(Find_Intersection(&isect, object, ray, thread) && (isect.Depth < bestIsect->Depth))
+            {
+                *bestIsect = isect;
+                return true;
+            }
+            return false;
+        }
+        bool operator()(ObjectPtr object, bool bounded)
+        {
+            Intersection isect;
+            if(Find_Leaf_Intersection(&isect, object, ray, bounded, nullptr, thread) && (isect.Depth < bestIsect->Depth))
+            {
+                *bestIsect = isect;
+                return true;
+            }
+            return false;
+        }
+    private:
+        const Ray& ray;
+        Intersection *bestIsect;
+        TraceThreadData *thread;
+};
+
+template<class Precondition, class Postcondition>
+class FlatBVHCondLeafTest
+{
+    public:
+        FlatBVHCondLeafTest(const Ray& r, Intersection *bi, const Precondition& prec, const Postcondition& postc, TraceThreadData *t) :
+            ray(r), bestIsect(bi), precondition(prec), postcondition(postc), thread(t) {}
+        bool operator()(ObjectPtr object)
+        {
+            Intersection isect;
+            if(precondition(ray, object, 0.0) && Find_Intersection(&isect, object, ray, postcondition, thread) && (isect.Depth < bestIsect->Depth))
+            {
+                *bestIsect = isect;
+                return true;
+            }
+            return false;
+        }
+        bool operator()(ObjectPtr object, bool bounded)
+        {
+            Intersection isect;
+            if(precondition(ray, object, 0.0) && Find_Leaf_Intersection(&isect, object, ray, bounded, postcondition, thread) && (isect.Depth < bestIsect->Depth))
+            {
+                *bestIsect = isect;
+                return true;
+            }
+            return false;
+        }
+    private:
+        const Ray& ray;
+        Intersection *bestIsect;
+        const Precondition& precondition;
+        const Postcondition& postcondition;
+        TraceThreadData *thread;
+};
+
+// Leaf test for any-hit queries. Intersections do not narrow the search; instead, once an
+// intersection satisfying the terminate condition has been found, the search distance is set
+// to minus infinity, causing the traversal to discard all remaining subtrees.
+template<class Precondition, class Postcondition>
+class FlatBVHAnyLeafTest
+{
+    public:
+        FlatBVHAnyLeafTest(const Ray& r, Intersection *w, Intersection *ai, const Precondition& prec, const Postcondition& postc, const RayObjectCondition& term, TraceThreadData *t) :
+            ray(r), window(w), anyIsect(ai), precondition(prec), postcondition(postc), terminate(term), thread(t), done(false) {}
+        bool operator()(ObjectPtr object)
+        {
+            if(done)
+                return false;
+            Intersection isect;
+            return precondition(ray, object, 0.0) && Find_Intersection(&isect, object, ray, postcondition, thread) && Accept(isect);
+        }
+        bool operator()(ObjectPtr object, bool bounded)
+        {
+            if(done)
+                return false;
+            Intersection isect;
+            return precondition(ray, object, 0.0) && Find_Leaf_Intersection(&isect, object, ray, bounded, postcondition, thread) && Accept(isect);
+        }
+    private:
+        bool Accept(const Intersection& isect)
+        {
+            if(isect.Depth >= window->Depth)
+                return false;
+            *anyIsect = isect;
+            if(terminate(ray, isect.Object, isect.Depth))
+            {
+                window->Depth = -HUGE_VAL;
+                done = true;
+            }
+            return true;
+        }
+        const Ray& ray;
+        Intersection *window;
+        Intersection *anyIsect;
+        const Precondition& precondition;
+        const Postcondition& postcondition;
+        const RayObjectCondition& terminate;
+        TraceThreadData *thread;
+        bool done;
+};
+
+bool FlatBVH::Intersect(TraversalStack& stack, const Ray& ray, Intersection *bestIsect, TraceThreadData *thread) const
+{
+    FlatBVHLeafTest leafTest(ray, bestIsect, thread);
+    return Traverse(stack, ray, bestIsect, leafTest, thread);
+}
+
+// Traversal with conditions, as invoked by Dispatch_Ray_Object_Conditions().
+struct FlatBVHCondTraversal
+{
+    const FlatBVH& bvh;
+    FlatBVH::TraversalStack& stack;
+    const Ray& ray;
+    Intersection *bestIsect;
+    TraceThreadData *thread;
+
+    FlatBVHCondTraversal(const FlatBVH& b, FlatBVH::TraversalStack& s, const Ray& r, Intersection *bi, TraceThreadData *t) :
+        bvh(b), stack(s), ray(r), bestIsect(bi), thread(t) {}
+
+    template<class Precondition, class Postcondition>
+    bool operator()(const Precondition& precondition, const Postcondition& postcondition)
+    {
+        FlatBVHCondLeafTest<Precondition, Postcondition> leafTest(ray, bestIsect, precondition, postcondition, thread);
+        return bvh.Traverse(stack, ray, bestIsect, leafTest, thread);
+    }
+};
+
+// Any-hit traversal with conditions, as invoked by Dispatch_Ray_Object_Conditions().
+struct FlatBVHAnyTraversal
+{
+    const FlatBVH& bvh;
+    FlatBVH::TraversalStack& stack;
+    const Ray& ray;
+    Intersection *window;
+    Intersection *anyIsect;
+    const RayObjectCondition& terminate;
+    TraceThreadData *thread;
+
+    FlatBVHAnyTraversal(const FlatBVH& b, FlatBVH::TraversalStack& s, const Ray& r, Intersection *w, Intersection *ai, const RayObjectCondition& term, TraceThreadData *t) :
+        bvh(b), stack(s), ray(r), window(w), anyIsect(ai), terminate(term), thread(t) {}
+
+    template<class Precondition, class Postcondition>
+    bool operator()(const Precondition& precondition, const Postcondition& postcondition)
+    {
+        FlatBVHAnyLeafTest<Precondition, Postcondition> leafTest(ray, window, anyIsect, precondition, postcondition, terminate, thread);
+        return bvh.Traverse(stack, ray, window, leafTest, thread);
+    }
+};
+
+bool FlatBVH::Intersect(TraversalStack& stack, const Ray& ray, Intersection *bestIsect, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, TraceThreadData *thread) const
+{
+    FlatBVHCondTraversal traversal(*this, stack, ray, bestIsect, thread);
+    return Dispatch_Ray_Object_Conditions(ray, precondition, postcondition, traversal);
+}
+
+bool FlatBVH::IntersectAny(TraversalStack& stack, const Ray& ray, Intersection *anyIsect, double maxDepth, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, const RayObjectCondition& terminate, TraceThreadData *thread) const
+{
+    Intersection window;
+    window.Depth = maxDepth;
+    FlatBVHAnyTraversal traversal(*this, stack, ray, &window, anyIsect, terminate, thread);
+    return Dispatch_Ray_Object_Conditions(ray, precondition, postcondition, traversal);
+}
+
+void FlatBVH::GetCandidatesContaining(const Vector3d& point, vector<ObjectPtr>& candidates) const
+{
+    vector<int> pending;
+    float p[3] = { float(point[X]), float(point[Y]), float(point[Z]) };
+
+    candidates.assign(infiniteElements.begin(), infiniteElements.end());
+
+    if(nodeCount > 0)
+        pending.push_back(0);
+
+    while(!pending.empty())
+    {
+        Node scratch;
+        const Node& node = GetNode(pending.back(), scratch);
+        pending.pop_back();
+
+        for(int i = 0; i < node.entries; i++)
+        {
+            if((p[X] < node.bounds[X][i]) || (p[Y] < node.bounds[Y][i]) || (p[Z] < node.bounds[Z][i]) ||
+               (p[X] > node.bounds[X + 3][i]) || (p[Y] > node.bounds[Y + 3][i]) || (p[Z] > node.bounds[Z + 3][i]))
+                continue;
+
+            if(node.child[i] < 0)
+                candidates.push_back(elements[~node.child[i]]);
+            else
+                pending.push_back(node.child[i]);
+        }
+    }
+}
+
+void Initialise_FlatBVHDispatch()
+{
+#ifdef TRY_OPTIMIZED_BVH
+    for (const OptimizedFlatBVHInfo* p = gaOptimizedFlatBVHInfo; p->name != nullptr; ++p)
+    {
+        if (((p->enabled == nullptr) || *p->enabled) && ((p->supported == nullptr) || p->supported()))
+        {
+            FlatBVHNodeTest = p->nodeTest;
+            gFlatBVHNodeTestInfo = p->name;
+            return;
+        }
+    }
+#endif
+    FlatBVHNodeTest = PortableFlatBVHNodeTest;
+}
+
+const char* GetFlatBVHNodeTestInfo()
+{
+    return gFlatBVHNodeTestInfo;
+}
+
+}
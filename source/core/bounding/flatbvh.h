@@ -0,0 +1,318 @@
+//******************************************************************************
+///
+/// @file core/bounding/flatbvh.h
+///
+/// Declarations related to the flattened 4-wide bounding volume hierarchy.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_CORE_FLATBVH_H
+#define POVRAY_CORE_FLATBVH_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "core/configcore.h"
+
+#include <vector>
+
+#include "core/bounding/boundingbox.h"
+
+namespace pov
+{
+
+//##############################################################################
+///
+/// @defgroup PovCoreBoundingFlatBVH Flattened Bounding Volume Hierarchy
+/// @ingroup PovCoreBounding
+///
+/// @{
+
+/// Flattened 4-wide bounding volume hierarchy.
+///
+/// This is an alternative, read-only representation of a bounding box hierarchy as created by
+/// @ref Build_BBox_Tree() or @ref Build_BBox_Tree_SAH(). All inner nodes are stored in a single
+/// contiguous array, each node occupying exactly two cache lines and holding the bounding boxes of
+/// up to four children in structure-of-arrays layout, so that all of them can be tested against
+/// a ray in one go.
+///
+/// Infinite elements are kept in a separate list and tested for every ray. Those that are plain
+/// planes, such as the typical ground plane, are first tested all at once by computing where the
+/// ray hits each plane, so that planes behind the ray's origin or beyond the nearest intersection
+/// found so far are skipped without visiting the element itself.
+///
+/// As a finite element is only visited after its own bounding box, as held by its parent node,
+/// has been hit, it is intersected without testing that box again.
+///
+/// Optionally, elements that are plain triangles or spheres get a compact copy of their geometry,
+/// held in an array alongside the nodes, against which each ray is tested in single precision
+/// before the element itself is visited. As this pre-test is only meant to weed out misses, with
+/// tolerances erring on the side of reporting a hit, each candidate it reports is confirmed by the
+/// element's own double precision intersection test. The element children of each node are sorted
+/// by kind, and the hit ones of each kind pre-tested together, with a loop over all four slots
+/// written for the compiler to vectorize.
+///
+/// Optionally, nodes can be stored in a compressed format occupying a single cache line, with the
+/// children's bounding boxes quantised to 8 bits per coordinate relative to the node's own
+/// extent and rounded outward. This halves the memory taken by the nodes, at the cost of having to
+/// decompress each node visited and the slightly enlarged boxes causing some additional hits.
+///
+class FlatBVH
+{
+    public:
+
+        /// Maximum number of children per node.
+        static const int kWidth = 4;
+
+        /// Child index value marking an unused slot.
+        static const int kEmptySlot = 0x7FFFFFFF;
+
+        /// Inner node.
+        ///
+        /// Child indices greater or equal to zero refer to other nodes, while negative values
+        /// refer to elements, stored as the one's complement of the element index.
+        ///
+        /// @note   The layout of this structure is also relied upon by optimized node test
+        ///         implementations; it must remain at a size of 128 bytes.
+        ///
+        struct Node
+        {
+            float bounds[6][kWidth];    ///< Per-child minimum x, y, z and maximum x, y, z.
+            int child[kWidth];          ///< Per-child node or element index.
+            int entries;                ///< Number of slots in use.
+            int padding[3];
+        };
+
+        /// Inner node in compressed format.
+        ///
+        /// Child bounds are stored as multiples of the per-axis step size above the node's
+        /// origin. Slots not in use are marked by a child index of @ref kEmptySlot.
+        ///
+        struct CompressedNode
+        {
+            float origin[3];                    ///< Node's minimum x, y, z.
+            float step[3];                      ///< Node's extent per quantisation step in x, y, z.
+            unsigned char bounds[6][kWidth];    ///< Per-child quantised minimum x, y, z and maximum x, y, z.
+            int child[kWidth];                  ///< Per-child node or element index.
+        };
+
+        /// Compact copy of an element's geometry for the single precision pre-test.
+        ///
+        /// The anchor point is kept in double precision, so that the remaining data, being relative
+        /// to it, retains its precision in single precision regardless of the element's position.
+        ///
+        struct Prefilter
+        {
+            double anchor[3];       ///< First vertex of a triangle, or centre of a sphere.
+            float edge1[3];         ///< Edge from first to second vertex of a triangle; first entry is the squared radius of a sphere.
+            float edge2[3];         ///< Edge from first to third vertex of a triangle.
+            int kind;               ///< Kind of element, one of @ref kPrefilterNone, @ref kPrefilterTriangle or @ref kPrefilterSphere.
+        };
+
+        static const int kPrefilterNone     = 0;
+        static const int kPrefilterTriangle = 1;
+        static const int kPrefilterSphere   = 2;
+
+        /// Determine which kind of pre-test data, if any, an element gets.
+        static int PrefilterKind(ConstObjectPtr object);
+
+        /// Ray data in the form required by the node tests.
+        struct RayData
+        {
+            float origin[3];
+            float invDirection[3];
+            int nearRow[3];             ///< Row in @ref Node::bounds giving the near plane per axis.
+            int farRow[3];              ///< Row in @ref Node::bounds giving the far plane per axis.
+
+            explicit RayData(const BasicRay& ray);
+        };
+
+        /// Type of function to test all the children of a node against a ray.
+        ///
+        /// @param[in]  node        Node to test.
+        /// @param[in]  ray         Ray to test against.
+        /// @param[in]  maxDist     Distance beyond which hits are of no interest.
+        /// @param[out] entryDist   Per-child distance at which the ray enters the box.
+        /// @return                 Bit mask of the children hit by the ray.
+        ///
+        typedef unsigned int (*NodeTestFunction)(const Node& node, const RayData& ray, float maxDist, float *entryDist);
+
+        /// Per-thread traversal scratch space.
+        class TraversalStack
+        {
+                friend class FlatBVH;
+            public:
+                TraversalStack() { entries.reserve(256); }
+            private:
+                struct Entry
+                {
+                    int node;
+                    float dist;
+                };
+                vector<Entry> entries;
+                vector<double> infiniteDepths;  ///< Per infinite element depth at which the ray hits its plane.
+        };
+
+        /// Create a flattened copy of a bounding box hierarchy.
+        ///
+        /// @param[in]  root        Hierarchy to copy; may be destroyed afterwards.
+        /// @param[in]  compress    Whether to store the nodes in compressed format.
+        /// @param[in]  prefilter   Whether to pre-test triangles and spheres in single precision.
+        ///
+        explicit FlatBVH(const BBOX_TREE *root, bool compress = false, bool prefilter = false);
+        ~FlatBVH();
+
+        bool Intersect(TraversalStack& stack, const Ray& ray, Intersection *bestIsect, TraceThreadData *thread) const;
+        bool Intersect(TraversalStack& stack, const Ray& ray, Intersection *bestIsect, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, TraceThreadData *thread) const;
+
+        /// Find any intersection closer than `maxDepth`, stopping at the first one satisfying `terminate`.
+        ///
+        /// If no intersection satisfying `terminate` is found, `anyIsect` receives one of the
+        /// other intersections found, if any.
+        ///
+        bool IntersectAny(TraversalStack& stack, const Ray& ray, Intersection *anyIsect, double maxDepth, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, const RayObjectCondition& terminate, TraceThreadData *thread) const;
+
+        /// Get all elements whose bounding box may contain a given point, including all infinite elements.
+        void GetCandidatesContaining(const Vector3d& point, vector<ObjectPtr>& candidates) const;
+
+        unsigned int GetNodeCount() const { return nodeCount; }
+
+        /// Get the size of a single node in bytes.
+        unsigned int GetNodeSize() const { return (compressedNodes != nullptr ? sizeof(CompressedNode) : sizeof(Node)); }
+
+    private:
+
+        /// Node array, aligned to a cache line boundary, or `nullptr` if compressed.
+        Node *nodes;
+        /// Compressed node array, aligned to a cache line boundary, or `nullptr` if not compressed.
+        CompressedNode *compressedNodes;
+        /// Number of valid entries in @ref nodes.
+        unsigned int nodeCount;
+        /// Memory block holding @ref nodes.
+        char *nodeMemory;
+        /// Finite elements referenced by the nodes.
+        vector<ObjectPtr> elements;
+        /// Whether each finite element has a `bounded_by` set, kept apart from the elements
+        /// themselves so that an element is not accessed until it is actually intersected.
+        vector<unsigned char> elementBounded;
+        /// Infinite elements.
+        vector<ObjectPtr> infiniteElements;
+        /// Plane equations of the infinite elements in structure-of-arrays layout, with rows for
+        /// the normal's x, y and z, the distance, and 1 for untransformed planes or 0 for other
+        /// elements; or empty if there are no such planes.
+        vector<double> infinitePlanes;
+        /// Pre-test data per finite element, or empty if pre-testing is disabled.
+        vector<Prefilter> prefilters;
+
+        void BuildPrefilters();
+        void BuildInfinitePlanes();
+        void InfinitePlaneDepths(const BasicRay& ray, double *depths) const;
+        static unsigned int PrefilterMiss(const Node& node, unsigned int mask, const Prefilter *prefilters, const BasicRay& ray, const float *direction);
+        static unsigned int PrefilterSpheresMiss(const Prefilter * const *batch, int count, const BasicRay& ray, const float *direction);
+        static unsigned int PrefilterTrianglesMiss(const Prefilter * const *batch, int count, const BasicRay& ray, const float *direction);
+
+        void CollectItems(const BBOX_TREE *node, vector<const BBOX_TREE *>& items);
+        int BuildNode(vector<Node>& buildNodes, const BBOX_TREE * const *items, size_t count);
+        int BuildChild(vector<Node>& buildNodes, const BBOX_TREE *item);
+
+        static void CompressNode(const Node& node, CompressedNode& compressed);
+        static void DecompressNode(const CompressedNode& compressed, Node& node);
+
+        inline const Node& GetNode(int index, Node& scratch) const
+        {
+            if(compressedNodes == nullptr)
+                return nodes[index];
+            DecompressNode(compressedNodes[index], scratch);
+            return scratch;
+        }
+
+        template<class LeafTest>
+        bool Traverse(TraversalStack& stack, const Ray& ray, Intersection *bestIsect, LeafTest& leafTest, TraceThreadData *thread) const;
+
+        friend struct FlatBVHCondTraversal;
+        friend struct FlatBVHAnyTraversal;
+
+        /// unavailable
+        FlatBVH();
+        FlatBVH(const FlatBVH&);
+        FlatBVH& operator=(const FlatBVH&);
+};
+
+/// Portable implementation of the flattened hierarchy node test.
+unsigned int PortableFlatBVHNodeTest(const FlatBVH::Node& node, const FlatBVH::RayData& ray, float maxDist, float *entryDist);
+
+#ifdef TRY_OPTIMIZED_BVH
+
+/// Optimized flattened hierarchy node test dispatch information.
+struct OptimizedFlatBVHInfo
+{
+    /// String unambiguously identifying the optimized implementation.
+    /// See @ref OptimizedNoiseInfo::name for the naming convention.
+    const char* name;
+
+    /// String providing noteworthy details about the implementation.
+    const char* info;
+
+    /// Pointer to the optimized implementation of @ref PortableFlatBVHNodeTest().
+    FlatBVH::NodeTestFunction nodeTest;
+
+    /// Pointer to a constant indicating whether the implementation is enabled in the binary.
+    const bool* enabled;
+
+    /// Pointer to a function testing whether the optimized implementation is supported.
+    /// A value of `nullptr` indicates universal support.
+    bool(*supported)();
+};
+
+/// Optimized flattened hierarchy node test dispatch table.
+///
+/// The end of the table is indicated by an entry with the `name` field set to `nullptr`.
+///
+/// @note
+///     This table must be implemented by platform-specific code.
+///
+extern OptimizedFlatBVHInfo gaOptimizedFlatBVHInfo[];
+
+#endif // TRY_OPTIMIZED_BVH
+
+/// Node test implementation selected by @ref Initialise_FlatBVHDispatch().
+extern FlatBVH::NodeTestFunction FlatBVHNodeTest;
+
+/// Select the fastest node test implementation supported by the current runtime environment.
+void Initialise_FlatBVHDispatch();
+
+/// Get a string describing the node test implementation in use.
+const char* GetFlatBVHNodeTestInfo();
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_CORE_FLATBVH_H
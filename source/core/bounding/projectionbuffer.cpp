@@ -0,0 +1,354 @@
+//******************************************************************************
+///
+/// @file core/bounding/projectionbuffer.cpp
+///
+/// Implementations related to the light buffer and vista buffer.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "core/bounding/projectionbuffer.h"
+
+#include <algorithm>
+
+#include "core/scene/object.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+// Limits to the number of cells per face edge.
+const int PROJECTION_BUFFER_MIN_RESOLUTION = 4;
+const int PROJECTION_BUFFER_MAX_RESOLUTION = 128;
+// Amount by which projected bounding boxes are enlarged, in face coordinates,
+// to make up for rounding errors.
+const DBL PROJECTION_BUFFER_PADDING = 1.0e-4;
+// Fraction of a face an object may cover while still being taken into account
+// when choosing the part of the face to divide into cells.
+const DBL PROJECTION_BUFFER_MAX_WINDOW_SHARE = 0.25;
+// Fraction of all cells beyond which an object is not worth listing per cell.
+const DBL PROJECTION_BUFFER_MAX_COVERAGE = 0.125;
+// Average number of cells per finite object the lists may take up in total.
+const unsigned int PROJECTION_BUFFER_CELLS_PER_OBJECT = 32;
+
+// Cell coverage of a bounding box, as a range of cells per face.
+struct ProjectionBufferFootprint
+{
+    ObjectPtr object;
+    DBL distance;
+    unsigned int cells;
+    DBL lo[6][2];       // Covered range of face coordinates; empty if `lo` > `hi`.
+    DBL hi[6][2];
+    int first[6][2];    // Covered range of cells.
+    int last[6][2];
+};
+
+// Orders footprints by increasing number of cells covered.
+struct ProjectionBufferCoverageLess
+{
+    bool operator()(const ProjectionBufferFootprint *a, const ProjectionBufferFootprint *b) const
+    {
+        return (a->cells < b->cells);
+    }
+};
+
+// Orders footprints by increasing distance.
+struct ProjectionBufferFootprintDistanceLess
+{
+    bool operator()(const ProjectionBufferFootprint *a, const ProjectionBufferFootprint *b) const
+    {
+        return (a->distance < b->distance);
+    }
+};
+
+// Orders entries by increasing distance.
+struct ProjectionBufferDistanceLess
+{
+    bool operator()(const ProjectionBuffer::Entry& a, const ProjectionBuffer::Entry& b) const
+    {
+        return (a.distance < b.distance);
+    }
+};
+
+// Compute the range of face coordinates covered by `q/qa` for `q` in
+// [qmin, qmax] and `qa` in [qa0, qa1], with 0 <= qa0 < qa1.
+static void ProjectInterval(DBL qmin, DBL qmax, DBL qa0, DBL qa1, DBL& cmin, DBL& cmax)
+{
+    if(qa0 > 0.0)
+    {
+        cmin = min(qmin / qa0, qmin / qa1);
+        cmax = max(qmax / qa0, qmax / qa1);
+    }
+    else
+    {
+        // The box extends right up to the plane through the centre.
+        cmin = (qmin < 0.0 ? -HUGE_VAL : qmin / qa1);
+        cmax = (qmax > 0.0 ?  HUGE_VAL : qmax / qa1);
+    }
+}
+
+static int FaceCoordinateToCell(DBL c, DBL lo, DBL scale, int resolution)
+{
+    return clip(int((c - lo) * scale), 0, resolution - 1);
+}
+
+ProjectionBuffer::ProjectionBuffer(const Vector3d& c, const vector<ObjectPtr>& objects) :
+    centre(c),
+    resolution(PROJECTION_BUFFER_MIN_RESOLUTION)
+{
+    vector<ProjectionBufferFootprint> footprints;
+    Entry entry;
+
+    for(vector<ObjectPtr>::const_iterator i = objects.begin(); i != objects.end(); i++)
+    {
+        if(Test_Flag((*i), INFINITE_FLAG))
+        {
+            entry.object = *i;
+            entry.distance = 0.0;
+            unbuffered.push_back(entry);
+        }
+        else
+        {
+            ProjectionBufferFootprint footprint;
+            footprint.object = *i;
+            footprints.push_back(footprint);
+        }
+    }
+
+    // Aim at a handful of cells per object.
+    resolution = clip(int(2.0 * ceil(sqrt(DBL(footprints.size()) / 6.0))), PROJECTION_BUFFER_MIN_RESOLUTION, PROJECTION_BUFFER_MAX_RESOLUTION);
+
+    const unsigned int faceCells = resolution * resolution;
+    const unsigned int totalCells = 6 * faceCells;
+    DBL windowLo[6][2];
+    DBL windowHi[6][2];
+
+    for(int face = 0; face < 6; face++)
+    {
+        windowLo[face][0] = windowLo[face][1] =  HUGE_VAL;
+        windowHi[face][0] = windowHi[face][1] = -HUGE_VAL;
+    }
+
+    for(vector<ProjectionBufferFootprint>::iterator fp = footprints.begin(); fp != footprints.end(); fp++)
+    {
+        const BoundingBox& bbox = fp->object->BBox;
+        Vector3d lo(Vector3d(bbox.lowerLeft) - centre);
+        Vector3d hi(Vector3d(bbox.lowerLeft + bbox.size) - centre);
+        DBL distanceSqr = 0.0;
+
+        for(int axis = X; axis <= Z; axis++)
+        {
+            if(lo[axis] > 0.0)
+                distanceSqr += Sqr(lo[axis]);
+            else if(hi[axis] < 0.0)
+                distanceSqr += Sqr(hi[axis]);
+        }
+        fp->distance = sqrt(distanceSqr);
+
+        for(int face = 0; face < 6; face++)
+        {
+            int a = face >> 1;
+            int u = (a + 1) % 3;
+            int v = (a + 2) % 3;
+            DBL qa0 = ((face & 1) == 0 ?  lo[a] : -hi[a]);
+            DBL qa1 = ((face & 1) == 0 ?  hi[a] : -lo[a]);
+
+            fp->lo[face][0] = fp->lo[face][1] =  1.0;
+            fp->hi[face][0] = fp->hi[face][1] = -1.0;
+
+            // The box must lie at least partially in front of the face.
+            if(qa1 <= 0.0)
+                continue;
+
+            ProjectInterval(lo[u], hi[u], max(qa0, 0.0), qa1, fp->lo[face][0], fp->hi[face][0]);
+            ProjectInterval(lo[v], hi[v], max(qa0, 0.0), qa1, fp->lo[face][1], fp->hi[face][1]);
+
+            for(int k = 0; k < 2; k++)
+            {
+                fp->lo[face][k] = max(fp->lo[face][k] - PROJECTION_BUFFER_PADDING, -1.0);
+                fp->hi[face][k] = min(fp->hi[face][k] + PROJECTION_BUFFER_PADDING,  1.0);
+            }
+
+            if((fp->lo[face][0] > fp->hi[face][0]) || (fp->lo[face][1] > fp->hi[face][1]))
+                continue;
+
+            // Faces span 2 by 2 units in face coordinates.
+            if((fp->hi[face][0] - fp->lo[face][0]) * (fp->hi[face][1] - fp->lo[face][1]) <= 4.0 * PROJECTION_BUFFER_MAX_WINDOW_SHARE)
+            {
+                for(int k = 0; k < 2; k++)
+                {
+                    windowLo[face][k] = min(windowLo[face][k], fp->lo[face][k]);
+                    windowHi[face][k] = max(windowHi[face][k], fp->hi[face][k]);
+                }
+            }
+        }
+    }
+
+    // Only divide the part of each face most objects project to into cells; anything beyond
+    // is covered by the outermost cells.
+    for(int face = 0; face < 6; face++)
+    {
+        for(int k = 0; k < 2; k++)
+        {
+            if(windowLo[face][k] >= windowHi[face][k])
+            {
+                windowLo[face][k] = -1.0;
+                windowHi[face][k] =  1.0;
+            }
+            faceLo[face][k] = windowLo[face][k];
+            faceScale[face][k] = resolution / (windowHi[face][k] - windowLo[face][k]);
+        }
+    }
+
+    for(vector<ProjectionBufferFootprint>::iterator fp = footprints.begin(); fp != footprints.end(); fp++)
+    {
+        fp->cells = 0;
+
+        for(int face = 0; face < 6; face++)
+        {
+            if((fp->lo[face][0] > fp->hi[face][0]) || (fp->lo[face][1] > fp->hi[face][1]))
+            {
+                fp->first[face][0] = fp->first[face][1] = 0;
+                fp->last[face][0] = fp->last[face][1] = -1;
+                continue;
+            }
+
+            for(int k = 0; k < 2; k++)
+            {
+                fp->first[face][k] = FaceCoordinateToCell(fp->lo[face][k], faceLo[face][k], faceScale[face][k], resolution);
+                fp->last[face][k]  = FaceCoordinateToCell(fp->hi[face][k], faceLo[face][k], faceScale[face][k], resolution);
+            }
+
+            fp->cells += (fp->last[face][0] - fp->first[face][0] + 1) * (fp->last[face][1] - fp->first[face][1] + 1);
+        }
+    }
+
+    // List objects per cell, starting with those covering the fewest cells, until the total
+    // exceeds the budget; the remaining ones are tested for all directions instead.
+    vector<const ProjectionBufferFootprint *> order;
+    order.reserve(footprints.size());
+    for(vector<ProjectionBufferFootprint>::const_iterator fp = footprints.begin(); fp != footprints.end(); fp++)
+        order.push_back(&(*fp));
+    std::stable_sort(order.begin(), order.end(), ProjectionBufferCoverageLess());
+
+    const size_t budget = PROJECTION_BUFFER_CELLS_PER_OBJECT * footprints.size() + totalCells;
+    size_t total = 0;
+    size_t listed = 0;
+
+    for(; listed < order.size(); listed++)
+    {
+        if((order[listed]->cells > PROJECTION_BUFFER_MAX_COVERAGE * totalCells) || (total + order[listed]->cells > budget))
+            break;
+        total += order[listed]->cells;
+    }
+
+    for(size_t i = listed; i < order.size(); i++)
+    {
+        entry.object = order[i]->object;
+        entry.distance = order[i]->distance;
+        unbuffered.push_back(entry);
+    }
+    std::stable_sort(unbuffered.begin(), unbuffered.end(), ProjectionBufferDistanceLess());
+
+    // Fill in the cells in order of distance, so that each list ends up sorted.
+    order.resize(listed);
+    std::stable_sort(order.begin(), order.end(), ProjectionBufferFootprintDistanceLess());
+
+    cellStart.assign(totalCells + 1, 0);
+
+    for(vector<const ProjectionBufferFootprint *>::const_iterator fp = order.begin(); fp != order.end(); fp++)
+    {
+        for(int face = 0; face < 6; face++)
+        {
+            for(int j = (*fp)->first[face][1]; j <= (*fp)->last[face][1]; j++)
+                for(int i = (*fp)->first[face][0]; i <= (*fp)->last[face][0]; i++)
+                    cellStart[face * faceCells + j * resolution + i + 1]++;
+        }
+    }
+
+    for(unsigned int cell = 0; cell < totalCells; cell++)
+        cellStart[cell + 1] += cellStart[cell];
+
+    vector<unsigned int> fill(cellStart.begin(), cellStart.end() - 1);
+    entries.resize(cellStart[totalCells]);
+
+    for(vector<const ProjectionBufferFootprint *>::const_iterator fp = order.begin(); fp != order.end(); fp++)
+    {
+        entry.object = (*fp)->object;
+        entry.distance = (*fp)->distance;
+
+        for(int face = 0; face < 6; face++)
+        {
+            for(int j = (*fp)->first[face][1]; j <= (*fp)->last[face][1]; j++)
+                for(int i = (*fp)->first[face][0]; i <= (*fp)->last[face][0]; i++)
+                    entries[fill[face * faceCells + j * resolution + i]++] = entry;
+        }
+    }
+}
+
+ProjectionBuffer::Range ProjectionBuffer::GetCell(const Vector3d& direction) const
+{
+    Range range;
+    int a = X;
+
+    if(fabs(direction[Y]) > fabs(direction[a]))
+        a = Y;
+    if(fabs(direction[Z]) > fabs(direction[a]))
+        a = Z;
+
+    int face = (a << 1) | int(direction[a] < 0.0);
+    DBL qa = fabs(direction[a]);
+
+    if(qa == 0.0)
+    {
+        range.first = range.last = nullptr;
+        return range;
+    }
+
+    int i = FaceCoordinateToCell(direction[(a + 1) % 3] / qa, faceLo[face][0], faceScale[face][0], resolution);
+    int j = FaceCoordinateToCell(direction[(a + 2) % 3] / qa, faceLo[face][1], faceScale[face][1], resolution);
+    unsigned int cell = (face * resolution + j) * resolution + i;
+
+    range.first = entries.data() + cellStart[cell];
+    range.last  = entries.data() + cellStart[cell + 1];
+    return range;
+}
+
+ProjectionBuffer::Range ProjectionBuffer::GetUnbuffered() const
+{
+    Range range;
+    range.first = unbuffered.data();
+    range.last  = unbuffered.data() + unbuffered.size();
+    return range;
+}
+
+}
@@ -0,0 +1,128 @@
+//******************************************************************************
+///
+/// @file core/bounding/projectionbuffer.h
+///
+/// Declarations related to the light buffer and vista buffer.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_CORE_PROJECTIONBUFFER_H
+#define POVRAY_CORE_PROJECTIONBUFFER_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "core/configcore.h"
+
+#include <vector>
+
+#include "core/coretypes.h"
+#include "core/math/vector.h"
+
+namespace pov
+{
+
+//##############################################################################
+///
+/// @defgroup PovCoreBoundingProjectionBuffer Light Buffer and Vista Buffer
+/// @ingroup PovCoreBounding
+///
+/// @{
+
+/// Candidate object lists for rays passing through a given point.
+///
+/// The bounding boxes of all finite objects are projected from the centre point onto the six
+/// faces of a cube, each divided into a grid of cells, and each cell lists the objects whose
+/// projection overlaps it. The grid only spans the part of each face the objects project to,
+/// with the outermost cells extending to the edges of the face. Any ray passing through the centre point can therefore only hit the
+/// objects listed in the cell its direction falls into, plus those held in a separate list of
+/// objects to be tested for any direction, i.e. infinite objects and objects covering a large
+/// part of the view from the centre.
+///
+/// All lists are sorted by the distance of the objects' bounding boxes from the centre point.
+///
+/// This serves as the light buffer for point lights, where shadow rays end at the centre, and
+/// as the vista buffer for the camera, where primary rays start at the centre.
+///
+class ProjectionBuffer
+{
+    public:
+
+        /// List entry.
+        struct Entry
+        {
+            ObjectPtr object;
+            DBL distance;       ///< Minimum distance from the centre to the object's bounding box.
+        };
+
+        /// Half-open range of list entries.
+        struct Range
+        {
+            const Entry *first;
+            const Entry *last;
+        };
+
+        ProjectionBuffer(const Vector3d& centre, const vector<ObjectPtr>& objects);
+
+        const Vector3d& GetCentre() const { return centre; }
+
+        /// Get the objects listed in the cell a given direction from the centre falls into.
+        Range GetCell(const Vector3d& direction) const;
+
+        /// Get the objects to be tested regardless of direction.
+        Range GetUnbuffered() const;
+
+    private:
+
+        Vector3d centre;
+        /// Number of cells per face edge.
+        int resolution;
+        /// Per-face lower end of the range of face coordinates divided into cells.
+        DBL faceLo[6][2];
+        /// Per-face number of cells per unit of face coordinates.
+        DBL faceScale[6][2];
+        /// Index into @ref entries of the first entry per cell, followed by the total number of entries.
+        vector<unsigned int> cellStart;
+        /// Concatenated per-cell lists.
+        vector<Entry> entries;
+        /// Objects to be tested regardless of direction.
+        vector<Entry> unbuffered;
+
+        /// unavailable
+        ProjectionBuffer();
+        ProjectionBuffer(const ProjectionBuffer&);
+        ProjectionBuffer& operator=(const ProjectionBuffer&);
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_CORE_PROJECTIONBUFFER_H
@@ -88,10 +88,6 @@
 #define WEIGHTEDTEXTURE_VECTOR_SIZE     512
 #endif
 
-#ifndef RAYINTERIOR_VECTOR_SIZE
-#define RAYINTERIOR_VECTOR_SIZE         512
-#endif
-
 /// @def POV_VECTOR_POOL_SIZE
 /// Initial size of @ref PooledSimpleVector pools.
 #ifndef POV_VECTOR_POOL_SIZE
@@ -123,6 +119,47 @@
     #define MAX_TRACE_LEVEL_LIMIT 256
 #endif
 
+/// @def IMAGE_CACHE_SIZE_LIMIT
+/// Memory (in MB) that image files no longer used by any scene may occupy in the image cache.
+///
+/// @note
+///     Images still in use are never evicted, even if they exceed this limit.
+///
+#ifndef IMAGE_CACHE_SIZE_LIMIT
+    #define IMAGE_CACHE_SIZE_LIMIT 256
+#endif
+
+/// @def CRACKLE_CACHE_SIZE_LIMIT
+/// Memory (in MB) that the crackle cells shared by all render threads may occupy.
+///
+#ifndef CRACKLE_CACHE_SIZE_LIMIT
+    #define CRACKLE_CACHE_SIZE_LIMIT 64
+#endif
+
+/// @def CRACKLE_THREAD_CACHE_CELLS
+/// Number of crackle cells each render thread keeps at hand without consulting the shared cache.
+///
+#ifndef CRACKLE_THREAD_CACHE_CELLS
+    #define CRACKLE_THREAD_CACHE_CELLS 256
+#endif
+
+/// @def COLOUR_MAP_LOOKUP_SIZE
+/// Number of colours precomputed for long colour maps, to avoid searching the map's entries for each evaluation.
+///
+/// @note
+///     Set this to 0 to always evaluate colour maps exactly.
+///
+#ifndef COLOUR_MAP_LOOKUP_SIZE
+    #define COLOUR_MAP_LOOKUP_SIZE 1024
+#endif
+
+/// @def COLOUR_MAP_LOOKUP_MIN_ENTRIES
+/// Minimum number of entries for a colour map to be evaluated via precomputed colours.
+///
+#ifndef COLOUR_MAP_LOOKUP_MIN_ENTRIES
+    #define COLOUR_MAP_LOOKUP_MIN_ENTRIES 16
+#endif
+
 //******************************************************************************
 ///
 /// @name Various Numerical Constants
@@ -227,6 +264,62 @@
     #endif
 #endif
 
+/// @def TRY_OPTIMIZED_BVH
+/// Whether the platform provides dynamic optimized flattened bounding hierarchy node tests.
+///
+/// Define if the platform provides one or more alternative optimized implementations of
+/// @ref pov::PortableFlatBVHNodeTest(), to be dispatched dynamically at run-time. Leave
+/// undefined otherwise.
+///
+/// @note
+///     If this macro is defined, the platform must implement the table
+///     @ref pov::gaOptimizedFlatBVHInfo as declared in @ref core/bounding/flatbvh.h.
+///
+#ifndef TRY_OPTIMIZED_BVH
+    // leave undefined
+    #ifdef DOXYGEN
+        // Doxygen cannot document undefined macros.
+        #define TRY_OPTIMIZED_BVH
+    #endif
+#endif
+
+/// @def POV_PHOTONS_COMPACT
+/// Whether to store photons in compact form.
+///
+/// Define as non-zero integer to store photon locations at reduced precision, shrinking each
+/// photon from 20 to 16 bytes, or zero to store them at full single precision.
+///
+/// @note
+///     Photon map files are specific to the setting used.
+///
+#ifndef POV_PHOTONS_COMPACT
+    #define POV_PHOTONS_COMPACT 0
+#endif
+
+/// @def POV_CACHE_LINE_SIZE
+/// Size of a CPU cache line, in bytes.
+///
+/// Data written frequently by different threads is kept at least this far apart, so that the threads
+/// do not compete for the same cache line.
+///
+#ifndef POV_CACHE_LINE_SIZE
+    #define POV_CACHE_LINE_SIZE 64
+#endif
+
+/// @def POV_OBJECT_PROFILE
+/// Gather run-time statistics on scene-level objects.
+///
+/// Define as non-zero integer to have the intersection tests, hits, time spent on intersection
+/// tests and time spent on texture evaluation counted for each object in the scene, and reported
+/// with the render statistics along with the object's declared name and location in the scene
+/// description, or zero to disable.
+///
+/// @note   The time measurements add considerable overhead to each intersection test.
+///
+#ifndef POV_OBJECT_PROFILE
+    #define POV_OBJECT_PROFILE 0
+#endif
+
 //******************************************************************************
 ///
 /// @name Debug Settings.
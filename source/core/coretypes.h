@@ -38,7 +38,7 @@
 
 #include "core/configcore.h"
 
-#include <stack>
+#include <vector>
 
 #include "base/colour.h"
 #include "base/messenger.h"
@@ -124,6 +124,9 @@ typedef TEXTURE* TexturePtr;
 ///
 /// @{
 
+class MediaDensityGrid;
+class TraceThreadData;
+
 class Media
 {
     public:
@@ -156,6 +159,9 @@ class Media
 
         vector<PIGMENT*> Density;
 
+        int Density_Grid_Resolution;                ///< Number of grid cells along the longest axis to bake the density into, or 0.
+        shared_ptr<MediaDensityGrid> Density_Grid;  ///< Baked density, or `nullptr` if the density is to be evaluated directly.
+
         Media();
         Media(const Media&);
         ~Media();
@@ -165,6 +171,9 @@ class Media
         void Transform(const TRANSFORM *trans);
 
         void PostProcess();
+
+        /// Bakes the density into a grid covering the given box, if requested and not done yet.
+        void BakeDensity(const Vector3d& lowerLeft, const Vector3d& upperRight, TraceThreadData *ttd);
 };
 
 /// @}
@@ -320,12 +329,17 @@ typedef unsigned short HF_VAL;
 ///
 /// This class holds various information on a ray-object intersection.
 ///
+/// @note   The members needed to sort and select intersections (depth, object and point) come first, so that
+///         they share a cache line; the remaining ones are only of interest for the intersection finally chosen.
+///
 class Intersection
 {
     public:
 
         /// Distance from the intersecting ray's origin.
         DBL Depth;
+        /// Intersected object.
+        ObjectPtr Object;
         /// Point of the intersection in global coordinate space.
         Vector3d IPoint;
         /// Unperturbed surface normal at the intersection point.
@@ -337,10 +351,12 @@ class Intersection
         Vector3d PNormal;
         /// UV texture coordinate.
         Vector2d Iuv;
-        /// Intersected object.
-        ObjectPtr Object;
         /// Root-level parent CSG object for cutaway textures.
         ObjectPtr Csg;
+        /// Component of an instance's prototype that was actually hit (used by Instance).
+        ObjectPtr InnerObject;
+        /// Top-level component of an instance's prototype containing InnerObject (used by Instance).
+        ObjectPtr InnerComponent;
 
         /// @name Object-Specific Auxiliary Data
         /// These members hold information specific to particular object types, typically generated during
@@ -370,80 +386,131 @@ class Intersection
         /// @}
 
         Intersection() :
-            Depth(BOUND_HUGE), Object(nullptr), Csg(nullptr),
+            Depth(BOUND_HUGE), Object(nullptr), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(0.0), Pointer(nullptr), i1(0), i2(0), haveNormal(false), haveLocalIPoint(false), b1(false)
         {}
 
         Intersection(DBL d, const Vector3d& v, ObjectPtr o) :
-            Depth(d), IPoint(v), Iuv(v), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), Iuv(v), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(0.0), Pointer(nullptr), i1(0), i2(0), haveNormal(false), haveLocalIPoint(false), b1(false)
         {}
 
         Intersection(DBL d, const Vector3d& v, const Vector3d& n, ObjectPtr o) :
-            Depth(d), IPoint(v), INormal(n), Iuv(v), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), INormal(n), Iuv(v), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(0.0), Pointer(nullptr), i1(0), i2(0), haveNormal(true), haveLocalIPoint(false), b1(false)
         {}
 
         Intersection(DBL d, const Vector3d& v, const Vector2d& uv, ObjectPtr o) :
-            Depth(d), IPoint(v), Iuv(uv), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), Iuv(uv), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(0.0), Pointer(nullptr), i1(0), i2(0), haveNormal(false), haveLocalIPoint(false), b1(false)
         {}
 
         Intersection(DBL d, const Vector3d& v, const Vector3d& n, const Vector2d& uv, ObjectPtr o) :
-            Depth(d), IPoint(v), INormal(n), Iuv(uv), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), INormal(n), Iuv(uv), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(0.0), Pointer(nullptr), i1(0), i2(0), haveNormal(true), haveLocalIPoint(false), b1(false)
         {}
 
         Intersection(DBL d, const Vector3d& v, ObjectPtr o, const void *a) :
-            Depth(d), IPoint(v), Iuv(v), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), Iuv(v), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(0.0), Pointer(a), i1(0), i2(0), haveNormal(false), haveLocalIPoint(false), b1(false)
         {}
 
         Intersection(DBL d, const Vector3d& v, const Vector2d& uv, ObjectPtr o, const void *a) :
-            Depth(d), IPoint(v), Iuv(uv), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), Iuv(uv), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(0.0), Pointer(a), i1(0), i2(0), haveNormal(false), haveLocalIPoint(false), b1(false)
         {}
 
         /// @todo Why does this not set Iuv=IPoint, as other constructors do?
         Intersection(DBL d, const Vector3d& v, ObjectPtr o, int a) :
-            Depth(d), IPoint(v), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(0.0), Pointer(nullptr), i1(a), i2(0), haveNormal(false), haveLocalIPoint(false), b1(false)
         {}
 
         /// @todo Why does this not set Iuv=IPoint, as other constructors do?
         Intersection(DBL d, const Vector3d& v, ObjectPtr o, DBL a) :
-            Depth(d), IPoint(v), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(a), Pointer(nullptr), i1(0), i2(0), haveNormal(false), haveLocalIPoint(false), b1(false)
         {}
 
         /// @todo Why does this not set Iuv=IPoint, as other constructors do?
         Intersection(DBL d, const Vector3d& v, ObjectPtr o, int a, int b) :
-            Depth(d), IPoint(v), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(0.0), Pointer(nullptr), i1(a), i2(b), haveNormal(false), haveLocalIPoint(false), b1(false)
         {}
 
         /// @todo Why does this not set Iuv=IPoint, as other constructors do?
         Intersection(DBL d, const Vector3d& v, ObjectPtr o, int a, DBL b) :
-            Depth(d), IPoint(v), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(b), Pointer(nullptr), i1(a), i2(0), haveNormal(false), haveLocalIPoint(false), b1(false)
         {}
 
         /// @todo Why does this not set Iuv=IPoint, as other constructors do?
         Intersection(DBL d, const Vector3d& v, ObjectPtr o, int a, int b, DBL c) :
-            Depth(d), IPoint(v), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             d1(c), Pointer(nullptr), i1(a), i2(b), haveNormal(false), haveLocalIPoint(false), b1(false)
         {}
 
         /// @todo Why does this not set Iuv=IPoint, as other constructors do?
         Intersection(DBL d, const Vector3d& v, ObjectPtr o, const Vector3d& lv, bool a) :
-            Depth(d), IPoint(v), Object(o), Csg(nullptr),
+            Depth(d), Object(o), IPoint(v), Csg(nullptr), InnerObject(nullptr), InnerComponent(nullptr),
             LocalIPoint(lv), d1(0.0), Pointer(nullptr), i1(0), i2(0), haveNormal(false), haveLocalIPoint(true), b1(a)
         {}
 
         ~Intersection() { }
 };
 
-typedef std::stack<Intersection, vector<Intersection> > IStackData;
+/// Stack of ray-object intersections.
+///
+/// The first few entries are held in a buffer within the stack object itself, so that only objects reporting
+/// an unusually high number of intersections along a single ray spill over into heap memory. The stacks are
+/// recycled via a per-thread @ref IStackPool, and the buffers of recycled stacks are never released, so once a
+/// thread has warmed up, intersection testing involves no heap traffic at all, and the entries of a stack do not
+/// require an extra indirection.
+///
+class IntersectionStack final
+{
+    public:
+
+        /// Number of entries held without resorting to heap memory.
+        static const size_t kInlineCapacity = 8;
+
+        IntersectionStack() : count(0) {}
+
+        inline bool empty() const { return (count == 0); }
+        inline size_t size() const { return count; }
+
+        inline void push(const Intersection& isect)
+        {
+            if (count < kInlineCapacity)
+                entries[count] = isect;
+            else
+                overflow.push_back(isect);
+            ++count;
+        }
+
+        inline void pop()
+        {
+            if (count > kInlineCapacity)
+                overflow.pop_back();
+            --count;
+        }
+
+        inline Intersection& top() { return ((count > kInlineCapacity) ? overflow.back() : entries[count - 1]); }
+        inline const Intersection& top() const { return ((count > kInlineCapacity) ? overflow.back() : entries[count - 1]); }
+
+        inline void clear() { overflow.clear(); count = 0; }
+
+    private:
+
+        Intersection entries[kInlineCapacity];
+        vector<Intersection> overflow;
+        size_t count;
+
+        IntersectionStack(const IntersectionStack&);
+        IntersectionStack& operator=(const IntersectionStack&);
+};
+
+typedef IntersectionStack IStackData;
 typedef RefPool<IStackData> IStackPool;
 typedef Ref<IStackData> IStack;
 
@@ -475,11 +542,23 @@ class Ray;
 struct RayObjectCondition
 {
     virtual bool operator()(const Ray& ray, ConstObjectPtr object, DBL data) const = 0;
+
+    /// Get the object flags the condition amounts to rejecting for a given ray.
+    ///
+    /// Traversal code calls this once per ray; if the condition merely tests object flags, the
+    /// test can then be compiled into the traversal loop rather than being called for each object.
+    ///
+    /// @param[in]  ray     Ray the condition is to be applied to.
+    /// @param[out] mask    Flags any of which make an object fail the condition.
+    /// @return             `true` if the condition is equivalent to testing @p mask.
+    ///
+    virtual bool GetFlagMask(const Ray& ray, unsigned int& mask) const { return false; }
 };
 
-struct TrueRayObjectCondition : public RayObjectCondition
+struct TrueRayObjectCondition final : public RayObjectCondition
 {
-    virtual bool operator()(const Ray&, ConstObjectPtr, DBL) const { return true; }
+    virtual bool operator()(const Ray&, ConstObjectPtr, DBL) const override { return true; }
+    virtual bool GetFlagMask(const Ray&, unsigned int& mask) const override { mask = 0; return true; }
 };
 
 struct PointObjectCondition
@@ -487,9 +566,9 @@ struct PointObjectCondition
     virtual bool operator()(const Vector3d& point, ConstObjectPtr object) const = 0;
 };
 
-struct TruePointObjectCondition : public PointObjectCondition
+struct TruePointObjectCondition final : public PointObjectCondition
 {
-    virtual bool operator()(const Vector3d&, ConstObjectPtr) const { return true; }
+    virtual bool operator()(const Vector3d&, ConstObjectPtr) const override { return true; }
 };
 
 /// @}
@@ -538,6 +617,11 @@ class FractalRules
         virtual void CalcNormal (Vector3d&, int, const Fractal *, DBL **) const = 0;
         virtual bool Iterate (const Vector3d&, const Fractal *, DBL **) const = 0;
         virtual bool Iterate (const Vector3d&, const Fractal *, const Vector3d&, DBL *, DBL **) const = 0;
+        /// Tell whether each of several points is inside the set.
+        /// The default tests one point after the other; algebras with a
+        /// lane kernel iterate all points together. Leaves the iteration
+        /// stack undefined.
+        virtual void Iterate (const Vector3d *, int, const Fractal *, bool *, DBL **) const;
         virtual bool Bound (const BasicRay&, const Fractal *, DBL *, DBL *) const = 0;
 };
 
@@ -582,6 +666,8 @@ struct QualityFlags
 /// @{
 
 class TraceThreadData;
+struct CustomFunctionProfile;
+struct CustomFunctionOpcodeProfile;
 
 class GenericFunctionContext
 {
@@ -598,6 +684,22 @@ class GenericFunctionContextFactory
         virtual ~GenericFunctionContextFactory() {}
         virtual GenericFunctionContextPtr CreateFunctionContext(TraceThreadData* pTd) = 0;
 
+        /// Fill a thread's pool of function contexts ahead of rendering.
+        ///
+        /// @note   This is called when the thread's data is set up, before any function is
+        ///         evaluated by the thread.
+        ///
+        virtual void PreallocateContexts(TraceThreadData* pTd) {}
+
+        /// Get run-time statistics gathered on the functions, if any.
+        ///
+        /// @note   This must not be called while functions are being evaluated.
+        ///
+        /// @param[out]     functions   Receives the statistics of each function called.
+        /// @param[out]     opcodes     Receives the statistics of each instruction executed.
+        ///
+        virtual void GetProfile(vector<CustomFunctionProfile>& functions, vector<CustomFunctionOpcodeProfile>& opcodes) const {}
+
     private:
         mutable size_t mRefCounter;
         friend void intrusive_ptr_add_ref(GenericFunctionContextFactory* f);
@@ -640,6 +742,22 @@ struct CustomFunctionSourceInfo : SourceInfo
     CustomFunctionSourceInfo(const UTF8String& n, const MessageContext& o) : name(n), SourceInfo(o) {}
 };
 
+/// Run-time statistics of a function.
+struct CustomFunctionProfile
+{
+    CustomFunctionSourceInfo sourceInfo;
+    POV_ULONG calls;            ///< Number of calls, including those from other functions.
+    POV_ULONG instructions;     ///< Number of instructions executed, not counting those of functions called.
+    DBL time;                   ///< Time in seconds spent in calls from outside, including functions called.
+};
+
+/// Run-time statistics of a function virtual machine instruction.
+struct CustomFunctionOpcodeProfile
+{
+    const char *name;
+    POV_ULONG count;            ///< Number of times the instruction was executed.
+};
+
 template<typename RETURN_T, typename ARG_T>
 class GenericCustomFunction
 {
@@ -650,6 +768,47 @@ public:
     virtual void InitArguments(GenericFunctionContextPtr pContext) = 0;
     virtual void PushArgument(GenericFunctionContextPtr pContext, ARG_T arg) = 0;
     virtual RETURN_T Execute(GenericFunctionContextPtr pContext) = 0;
+
+    /// Evaluate the function at several points in one call.
+    ///
+    /// Implementations able to evaluate several points at once should override this; the default
+    /// implementation simply evaluates one point after the other.
+    ///
+    /// @param[in]      pContext    Context to evaluate the function in.
+    /// @param[in]      args        Arguments for all points, `argCount` consecutive values per point.
+    /// @param[in]      argCount    Number of arguments per point.
+    /// @param[in]      count       Number of points.
+    /// @param[out]     results     Receives the function's value at each point.
+    ///
+    virtual void ExecuteBatch(GenericFunctionContextPtr pContext, const ARG_T* args, unsigned int argCount, unsigned int count, RETURN_T* results)
+    {
+        for (unsigned int i = 0; i < count; ++i, args += argCount)
+        {
+            InitArguments(pContext);
+            for (unsigned int j = 0; j < argCount; ++j)
+                PushArgument(pContext, args[j]);
+            results[i] = Execute(pContext);
+        }
+    }
+
+    /// Bound the function's value over a box of arguments.
+    ///
+    /// Implementations able to do so, for instance using interval arithmetic, should override
+    /// this; the default implementation never succeeds.
+    ///
+    /// @param[in]      pContext    Context to evaluate the function in.
+    /// @param[in]      lower       Lower bounds of the arguments.
+    /// @param[in]      upper       Upper bounds of the arguments.
+    /// @param[in]      argCount    Number of arguments.
+    /// @param[out]     lowerResult Receives a lower bound of the function's value.
+    /// @param[out]     upperResult Receives an upper bound of the function's value.
+    /// @return                     `true` if bounds could be determined.
+    ///
+    virtual bool ExecuteInterval(GenericFunctionContextPtr pContext, const ARG_T* lower, const ARG_T* upper, unsigned int argCount, RETURN_T& lowerResult, RETURN_T& upperResult)
+    {
+        return false;
+    }
+
     virtual GenericCustomFunction* Clone() const = 0;
     virtual const CustomFunctionSourceInfo* GetSourceInfo() const { return nullptr; }
 };
@@ -724,6 +883,35 @@ public:
         return Evaluate(argV.x(), argV.y(), argV.z());
     }
 
+    /// Evaluate the function at several points in one call.
+    ///
+    /// @param[in]      args        Arguments for all points, `argCount` consecutive values per point.
+    /// @param[in]      argCount    Number of arguments per point.
+    /// @param[in]      count       Number of points.
+    /// @param[out]     results     Receives the function's value at each point.
+    ///
+    inline void EvaluateBatch(const ARG_T* args, unsigned int argCount, unsigned int count, RETURN_T* results)
+    {
+        mpFunction->ExecuteBatch(mpContext, args, argCount, count, results);
+        mReInit = true;
+    }
+
+    /// Bound the function's value over a box of arguments.
+    ///
+    /// @param[in]      lower       Lower bounds of the arguments.
+    /// @param[in]      upper       Upper bounds of the arguments.
+    /// @param[in]      argCount    Number of arguments.
+    /// @param[out]     lowerResult Receives a lower bound of the function's value.
+    /// @param[out]     upperResult Receives an upper bound of the function's value.
+    /// @return                     `true` if bounds could be determined.
+    ///
+    inline bool EvaluateInterval(const ARG_T* lower, const ARG_T* upper, unsigned int argCount, RETURN_T& lowerResult, RETURN_T& upperResult)
+    {
+        bool result = mpFunction->ExecuteInterval(mpContext, lower, upper, argCount, lowerResult, upperResult);
+        mReInit = true;
+        return result;
+    }
+
 protected:
     GenericCustomFunction<RETURN_T,ARG_T>*  mpFunction;
     GenericFunctionContextPtr               mpContext;
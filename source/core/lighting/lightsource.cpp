@@ -37,6 +37,7 @@
 #include "core/lighting/lightsource.h"
 
 #include "core/math/matrix.h"
+#include "core/math/randomsequence.h"
 #include "core/render/ray.h"
 #include "core/scene/object.h"
 
@@ -382,6 +383,7 @@ LightSource::LightSource() : CompoundObject(LIGHT_OBJECT)
     Area_Size2 = 0;
 
     Adaptive_Level = 100;
+    Area_Sampling = AREA_SAMPLING_CLASSIC;
 
     Media_Attenuation = false;
     Media_Interaction = true;
@@ -463,6 +465,85 @@ LightSource::~LightSource()
     Destroy_Object(Projected_Through_Object);
 }
 
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Compute_Jitter_Patterns
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+* DESCRIPTION
+*
+*   Precompute a set of jitter patterns for the points of an area light grid,
+*   each offsetting the points by up to half a cell in either direction.
+*
+*   The patterns are multi-jittered after Chiu, Shirley and Wang, "Multi-
+*   Jittered Sampling" (1994): Besides each point jittering within its own
+*   cell, the points of each grid row also cover all the sub-columns of their
+*   cells exactly once, and vice versa, so that the samples remain well
+*   distributed when projected onto either axis.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void LightSource::Compute_Jitter_Patterns()
+{
+    int n1 = Area_Size1;
+    int n2 = Area_Size2;
+    int points = n1 * n2;
+
+    SeedableDoubleGeneratorPtr randgen(GetRandomDoubleGenerator(0.0, 1.0));
+    randgen->Seed(points);
+
+    Jitter_Patterns.resize(AREA_LIGHT_JITTER_PATTERNS * points);
+
+    for(int p = 0; p < AREA_LIGHT_JITTER_PATTERNS; p++)
+    {
+        Vector2d *pattern = &Jitter_Patterns[p * points];
+
+        // Canonical arrangement, with the point at (u,v) occupying sub-column v and sub-row u of its cell.
+        for(int u = 0; u < n1; u++)
+        {
+            for(int v = 0; v < n2; v++)
+                pattern[u * n2 + v] = Vector2d((v + (*randgen)()) / n2, (u + (*randgen)()) / n1);
+        }
+
+        // Shuffle the sub-columns among the points sharing the same u, and the sub-rows among those sharing the same v.
+        for(int u = 0; u < n1; u++)
+        {
+            for(int v = 0; v < n2; v++)
+            {
+                int k = v + min(int((*randgen)() * (n2 - v)), n2 - v - 1);
+                std::swap(pattern[u * n2 + v][X], pattern[u * n2 + k][X]);
+            }
+        }
+        for(int v = 0; v < n2; v++)
+        {
+            for(int u = 0; u < n1; u++)
+            {
+                int k = u + min(int((*randgen)() * (n1 - u)), n1 - u - 1);
+                std::swap(pattern[u * n2 + v][Y], pattern[k * n2 + v][Y]);
+            }
+        }
+
+        // Convert to offsets from the grid points.
+        for(int i = 0; i < points; i++)
+            pattern[i] -= Vector2d(0.5, 0.5);
+    }
+}
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -72,6 +72,14 @@ class Ray;
 #define FILL_LIGHT_SOURCE  3
 #define CYLINDER_SOURCE    4
 
+/* Area light sampling methods. */
+
+#define AREA_SAMPLING_CLASSIC    1 ///< Independent random jitter, subdivision as per `adaptive`.
+#define AREA_SAMPLING_STRATIFIED 2 ///< Precomputed multi-jittered patterns, subdivision skipped in coherent regions.
+
+/// Number of precomputed jitter patterns per area light using @ref AREA_SAMPLING_STRATIFIED.
+#define AREA_LIGHT_JITTER_PATTERNS 8
+
 
 
 /*****************************************************************************
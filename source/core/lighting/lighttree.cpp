@@ -0,0 +1,242 @@
+//******************************************************************************
+///
+/// @file core/lighting/lighttree.cpp
+///
+/// Implementations related to the light source hierarchy.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "core/lighting/lighttree.h"
+
+#include <algorithm>
+
+#include "core/scene/object.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+LightSourceTree::LightSourceTree(const vector<LightSource *>& lights, DBL cutoff)
+{
+    for (size_t i = 0; i < lights.size(); i++)
+    {
+        DBL radius = InfluenceRadius(*lights[i], cutoff);
+        if (radius >= HUGE_VAL)
+            unbounded.push_back(i);
+        else if (radius > 0.0)
+        {
+            BoundedLight light;
+            light.index = i;
+            light.centre = lights[i]->Center;
+            light.radiusSqr = Sqr(radius);
+            bounded.push_back(light);
+        }
+        // else the light source is too dim to matter anywhere
+    }
+
+    if (!bounded.empty())
+    {
+        nodes.reserve(2 * (bounded.size() / MaxLeafLights + 1));
+        BuildNode(0, bounded.size());
+    }
+}
+
+DBL LightSourceTree::InfluenceRadius(const LightSource& light, DBL cutoff)
+{
+    if ((cutoff <= 0.0) || light.Parallel || (light.Fade_Power <= 0.0))
+        return HUGE_VAL;
+
+    // see Attenuate_Light()
+    DBL level = light.colour.WeightMaxAbs();
+    DBL radius;
+    if (fabs(light.Fade_Distance) >= EPSILON)
+    {
+        // 2/(1+(d/fade_distance)^fade_power) drops below cutoff/level
+        if (2.0 * level <= cutoff)
+            return 0.0;
+        radius = fabs(light.Fade_Distance) * pow(2.0 * level / cutoff - 1.0, 1.0 / light.Fade_Power);
+    }
+    else
+    {
+        // d^-fade_power drops below cutoff/level
+        if (level <= 0.0)
+            return 0.0;
+        radius = pow(level / cutoff, 1.0 / light.Fade_Power);
+    }
+
+    // samples of an area light are spread out around its centre
+    if (light.Area_Light)
+        radius += (light.Axis1.length() + light.Axis2.length()) * 0.5;
+
+    return radius;
+}
+
+int LightSourceTree::BuildNode(size_t first, size_t count)
+{
+    Node node;
+    node.first = first;
+    node.count = count;
+    node.child[0] = node.child[1] = -1;
+    node.lowerLeft = Vector3d(HUGE_VAL);
+    node.upperRight = Vector3d(-HUGE_VAL);
+
+    for (size_t i = first; i < first + count; i++)
+    {
+        DBL radius = sqrt(bounded[i].radiusSqr);
+        for (int j = X; j <= Z; j++)
+        {
+            node.lowerLeft[j]  = min(node.lowerLeft[j],  bounded[i].centre[j] - radius);
+            node.upperRight[j] = max(node.upperRight[j], bounded[i].centre[j] + radius);
+        }
+    }
+
+    int index = nodes.size();
+    nodes.push_back(node);
+
+    if (count > MaxLeafLights)
+    {
+        // split at the median of the centres along the longest axis of the node
+        Vector3d size = node.upperRight - node.lowerLeft;
+        int axis = (size[X] > size[Y]) ? ((size[X] > size[Z]) ? X : Z) : ((size[Y] > size[Z]) ? Y : Z);
+        size_t half = count / 2;
+        std::nth_element(bounded.begin() + first, bounded.begin() + first + half, bounded.begin() + first + count,
+                         CentreLess(axis));
+
+        int left  = BuildNode(first, half);
+        int right = BuildNode(first + half, count - half);
+        nodes[index].child[0] = left;
+        nodes[index].child[1] = right;
+    }
+
+    return index;
+}
+
+void LightSourceTree::Find(const Vector3d& point, LightSourceIndexVector& result) const
+{
+    result.clear();
+    for (vector<size_t>::const_iterator i = unbounded.begin(); i != unbounded.end(); ++i)
+        result.push_back(*i);
+
+    if (nodes.empty())
+        return;
+
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const Node& node = nodes[stack[--top]];
+
+        if ((point[X] < node.lowerLeft[X]) || (point[X] > node.upperRight[X]) ||
+            (point[Y] < node.lowerLeft[Y]) || (point[Y] > node.upperRight[Y]) ||
+            (point[Z] < node.lowerLeft[Z]) || (point[Z] > node.upperRight[Z]))
+            continue;
+
+        if (node.child[0] < 0)
+        {
+            for (size_t i = node.first; i < node.first + node.count; i++)
+            {
+                if ((point - bounded[i].centre).lengthSqr() <= bounded[i].radiusSqr)
+                    result.push_back(bounded[i].index);
+            }
+        }
+        else
+        {
+            stack[top++] = node.child[0];
+            stack[top++] = node.child[1];
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+}
+
+void LightSourceTree::Find(const BasicRay& ray, DBL depth, LightSourceIndexVector& result) const
+{
+    result.clear();
+    for (vector<size_t>::const_iterator i = unbounded.begin(); i != unbounded.end(); ++i)
+        result.push_back(*i);
+
+    if (nodes.empty())
+        return;
+
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const Node& node = nodes[stack[--top]];
+
+        // clip the section of the ray against the node's box
+        DBL t0 = 0.0;
+        DBL t1 = depth;
+        for (int j = X; (j <= Z) && (t0 <= t1); j++)
+        {
+            if (ray.Direction[j] != 0.0)
+            {
+                DBL ta = (node.lowerLeft[j]  - ray.Origin[j]) / ray.Direction[j];
+                DBL tb = (node.upperRight[j] - ray.Origin[j]) / ray.Direction[j];
+                if (ta > tb)
+                    std::swap(ta, tb);
+                t0 = max(t0, ta);
+                t1 = min(t1, tb);
+            }
+            else if ((ray.Origin[j] < node.lowerLeft[j]) || (ray.Origin[j] > node.upperRight[j]))
+                t1 = -1.0;
+        }
+        if (t0 > t1)
+            continue;
+
+        if (node.child[0] < 0)
+        {
+            for (size_t i = node.first; i < node.first + node.count; i++)
+            {
+                // distance between the light source and the closest point of the section
+                Vector3d v = bounded[i].centre - ray.Origin;
+                DBL t = clip(dot(v, ray.Direction) / ray.Direction.lengthSqr(), 0.0, depth);
+                if ((v - ray.Direction * t).lengthSqr() <= bounded[i].radiusSqr)
+                    result.push_back(bounded[i].index);
+            }
+        }
+        else
+        {
+            stack[top++] = node.child[0];
+            stack[top++] = node.child[1];
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+}
+
+}
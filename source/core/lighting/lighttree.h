@@ -0,0 +1,127 @@
+//******************************************************************************
+///
+/// @file core/lighting/lighttree.h
+///
+/// Declarations related to the light source hierarchy.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+#ifndef POVRAY_CORE_LIGHTTREE_H
+#define POVRAY_CORE_LIGHTTREE_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "core/configcore.h"
+
+#include "core/coretypes.h"
+#include "core/support/simplevector.h"
+
+namespace pov
+{
+
+class LightSource;
+
+//##############################################################################
+///
+/// @addtogroup PovCoreLightingLightsource
+///
+/// @{
+
+/// Bounding volume hierarchy over the regions of influence of light sources.
+///
+/// Light sources fading with distance never quite stop contributing; but with a cutoff level
+/// in effect, each of them can be presumed to only illuminate the inside of a sphere around it.
+/// Indices of light sources, as returned by @ref LightSourceTree::Find(); drawn from a thread-local pool,
+/// as these are looked up for every shading point.
+typedef PooledSimpleVector<size_t, LIGHTSOURCE_VECTOR_SIZE> LightSourceIndexVector;
+
+/// The hierarchy allows finding the few light sources relevant to a particular point or ray
+/// among thousands. Light sources that do not fade are relevant everywhere.
+///
+class LightSourceTree
+{
+    public:
+
+        /// Builds the hierarchy.
+        /// @param[in]  lights      Light sources, in the order of their indices.
+        /// @param[in]  cutoff      Light level below which a light source's contribution is ignored.
+        LightSourceTree(const vector<LightSource *>& lights, DBL cutoff);
+
+        /// Gets the indices of the light sources that may contribute at a point, in ascending order.
+        void Find(const Vector3d& point, LightSourceIndexVector& result) const;
+
+        /// Gets the indices of the light sources that may contribute anywhere along a section of a ray, in ascending order.
+        void Find(const BasicRay& ray, DBL depth, LightSourceIndexVector& result) const;
+
+        /// Computes the distance beyond which a light source contributes less than the cutoff level.
+        /// @return     The distance, or `HUGE_VAL` if the light source is relevant at any distance.
+        static DBL InfluenceRadius(const LightSource& light, DBL cutoff);
+
+    protected:
+
+        static const size_t MaxLeafLights = 4;
+
+        struct Node
+        {
+            Vector3d    lowerLeft;
+            Vector3d    upperRight;
+            size_t      first;      ///< Index of the first light in @ref bounded covered by the node.
+            size_t      count;      ///< Number of lights covered by the node.
+            int         child[2];   ///< Indices of the child nodes, or -1 for a leaf.
+        };
+
+        struct BoundedLight
+        {
+            size_t      index;
+            Vector3d    centre;
+            DBL         radiusSqr;
+        };
+
+        struct CentreLess
+        {
+            int axis;
+            CentreLess(int a) : axis(a) {}
+            bool operator()(const BoundedLight& a, const BoundedLight& b) const { return a.centre[axis] < b.centre[axis]; }
+        };
+
+        vector<size_t>          unbounded;  ///< Indices of the light sources relevant everywhere.
+        vector<BoundedLight>    bounded;    ///< Light sources with a sphere of influence, in tree order.
+        vector<Node>            nodes;
+
+        int BuildNode(size_t first, size_t count);
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_CORE_LIGHTTREE_H
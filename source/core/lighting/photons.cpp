@@ -43,6 +43,9 @@
 #include <algorithm>
 #include <limits>
 
+// POV-Ray header files (base module)
+#include "base/memoryaccounting.h"
+
 // POV-Ray header files (core module)
 #include "core/bounding/boundingbox.h"
 #include "core/lighting/lightgroup.h"
@@ -91,8 +94,18 @@ constexpr int PHOTON_BLOCK_SIZE = 1 << PHOTON_BLOCK_POWER;
 constexpr int PHOTON_BLOCK_MASK = PHOTON_BLOCK_SIZE - 1;
 
 static_assert(PHOTON_BLOCK_POWER < std::numeric_limits<decltype(PHOTON_BLOCK_SIZE)>::digits, "PHOTON_BLOCK_POWER too large");
-
-class PhotonMap::PhotonBlock
+static_assert(!POV_PHOTONS_COMPACT || (sizeof(Photon) == 16), "compact photons not compact");
+
+/// Number of subtrees the top levels of a photon kd-tree are split into, to be built in parallel.
+/// This is fixed rather than derived from the number of threads, to keep the tree layout deterministic.
+constexpr size_t PHOTON_SUBTREES = 64;
+/// Ranges of photons smaller than this are not split any further to be built in parallel.
+constexpr int PHOTON_MIN_SUBTREE_SIZE = 4096;
+/// Subtrees of at most this many photons are searched by testing each photon in turn, rather than
+/// by descending into the subtree.
+constexpr int PHOTON_GATHER_LEAF_SIZE = 8;
+
+class PhotonMap::PhotonBlock : public MemoryAccounted<kMemoryPhotons>
 {
 public:
     inline Photon& operator[](size_t i)
@@ -876,7 +889,13 @@ void PhotonTrace::addSurfacePhoton(const Vector3d& Point, const Vector3d& Origin
     DBL Attenuation;
     Vector3d d;
     DBL d_len, phi, theta;
-    PhotonMap *map;
+    PhotonMapSlice *map;
+
+    if (threadData->photonDepositProbe != nullptr)
+    {
+        threadData->photonDepositProbe->Deposit(Point, false);
+        return;
+    }
 
     // first, compensate for POV's weird light attenuation
     LightSource *photonLight = threadData->photonSourceLight;
@@ -902,7 +921,7 @@ void PhotonTrace::addSurfacePhoton(const Vector3d& Point, const Vector3d& Origin
     else
 #endif
     {
-        map = (threadData->surfacePhotonMap);
+        map = (threadData->surfacePhotonSlice);
         threadData->Stats()[Number_Of_Photons_Stored]++;
     }
 
@@ -914,7 +933,7 @@ void PhotonTrace::addSurfacePhoton(const Vector3d& Point, const Vector3d& Origin
     photon->colour = PhotonColour(ToRGBColour(LightCol2));
 
     // store the location
-    photon->Loc = PhotonVector3d(Point);
+    photon->Loc = PhotonLocation(Point);
 
     // now determine rotation angles
     d = (Origin - Point).normalized();
@@ -993,15 +1012,21 @@ void PhotonMediaFunction::addMediaPhoton(const Vector3d& Point, const Vector3d&
     if (threadData->photonTargetObject == nullptr)
         return;
 
+    if (threadData->photonDepositProbe != nullptr)
+    {
+        threadData->photonDepositProbe->Deposit(Point, true);
+        return;
+    }
+
     threadData->Stats()[Number_Of_Media_Photons_Stored]++;
 
-    photon = threadData->mediaPhotonMap->AllocatePhoton();
+    photon = threadData->mediaPhotonSlice->AllocatePhoton();
 
     // convert photon from three floats to 4 bytes
     photon->colour = PhotonColour(ToRGBColour(LightCol2));
 
     // store the location
-    photon->Loc = PhotonVector3d(Point);
+    photon->Loc = PhotonLocation(Point);
 
     // now determine rotation angles
     d = (Origin - Point).normalized();
@@ -1285,9 +1310,7 @@ SinCosOptimizations::~SinCosOptimizations()
 
 Photon* PhotonMap::AllocatePhoton()
 {
-    // a mutex would be needed if we were allocating photons into the same map
-    // from different threads...
-    // but we have a different map for each thread, so there's no danger there...
+    // not thread-safe; threads sharing a map must use PhotonMapSlice instead
 
     int i,j;
 
@@ -1306,66 +1329,205 @@ Photon* PhotonMap::AllocatePhoton()
     return &GetPhoton(j, i);
 }
 
-/*
-Merge the parameter photon map into this photon map.
-"Delete" the contents of the parameter photon map after
-the merge is complete.
-*/
-void PhotonMap::mergeMap(PhotonMap* map)
+/*****************************************************************************
+
+ FUNCTION
+
+  ClaimBlock
+    allocates a block of photons for exclusive use by a PhotonMapSlice
+
+  Preconditions:
+    mergeSlices() has not yet been called for the current set of slices
+
+  Postconditions:
+    Returns a pointer to the new block, and its index in 'blockId'.
+
+******************************************************************************/
+
+PhotonMap::PhotonBlock* PhotonMap::ClaimBlock(int& blockId)
+{
+    PhotonBlock* block = new PhotonBlock;
+
+    // the block list may be re-allocated when growing, so this needs to be locked
+    // regardless of how the block index is determined
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(mBlockMutex);
+#endif
+    blockId = mBlockList.size();
+    mBlockList.push_back(block);
+    return block;
+}
+
+/*****************************************************************************
+
+ FUNCTION
+
+  ReleaseBlock
+    records that a block claimed by a PhotonMapSlice was left partially filled
+
+******************************************************************************/
+
+void PhotonMap::ReleaseBlock(int blockId, int count)
+{
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(mBlockMutex);
+#endif
+    mPartialBlocks.push_back(std::make_pair(blockId, count));
+}
+
+/*****************************************************************************
+
+ FUNCTION
+
+  mergeSlices
+    adds the photons stored via PhotonMapSlice to the photon map
+
+    The slices' completely filled blocks already are in their final place,
+    and just need to be counted. The photons of the partially filled ones
+    (at most one per slice) are moved to the end of the photon array.
+
+  Preconditions:
+    all slices have been released
+
+  Postconditions:
+    The photon map holds all photons stored via the slices, in addition to
+    those it held before.
+
+******************************************************************************/
+
+void PhotonMap::mergeSlices()
 {
-    int thisi = GetIndexInBlock(numPhotons);
-    int thisj = GetBlockId(numPhotons);
+    // the last block we held ourselves may be partially filled as well
+    if (GetIndexInBlock(numPhotons) > 0)
+        mPartialBlocks.push_back(std::make_pair(int(GetBlockId(numPhotons)), int(GetIndexInBlock(numPhotons))));
 
-    int mapi = GetIndexInBlock(map->numPhotons);
-    int mapj = GetBlockId(map->numPhotons);
+    // process the partially filled blocks in a well-defined order
+    std::sort(mPartialBlocks.begin(), mPartialBlocks.end());
 
-    // Set aside any partially filled blocks from both lists;
-    // we'll deal with them later.
-    PhotonBlock* thisPartialBlock = nullptr;
-    if (thisi > 0)
+    vector<PhotonBlock*> partialBlocks;
+    for (vector<std::pair<int, int> >::const_iterator i = mPartialBlocks.begin(); i != mPartialBlocks.end(); i++)
     {
-        thisPartialBlock = mBlockList.back();
-        mBlockList.pop_back();
+        partialBlocks.push_back(mBlockList[i->first]);
+        mBlockList[i->first] = nullptr;
     }
-    PhotonBlock* mapPartialBlock = nullptr;
-    if (mapi > 0)
+    mBlockList.erase(std::remove(mBlockList.begin(), mBlockList.end(), (PhotonBlock*)nullptr), mBlockList.end());
+    numPhotons = mBlockList.size() * PHOTON_BLOCK_SIZE;
+
+    for (size_t i = 0; i < partialBlocks.size(); i++)
     {
-        mapPartialBlock = map->mBlockList.back();
-        map->mBlockList.pop_back();
+        for (int j = 0; j < mPartialBlocks[i].second; j++)
+            *AllocatePhoton() = (*partialBlocks[i])[j];
+        delete partialBlocks[i];
     }
 
-    // Transplant all the (pointers to the) completely filled blocks from the other map.
-    mBlockList.insert(mBlockList.end(), map->mBlockList.begin(), map->mBlockList.end());
-    map->mBlockList.clear();
+    mPartialBlocks.clear();
+}
+
+/*****************************************************************************
+
+ FUNCTION
+
+  MapPhotons
+    uses photons mapped from a file in place
+
+    The photons are not copied; instead, the blocks are set up to point
+    directly into the file's contents, which are kept alive as long as the
+    photon map references them.
+
+  Preconditions:
+    the photon map is empty
+    'photons' points to 'count' photons within the contents of 'file',
+    forming a balanced kd-tree
+
+  Postconditions:
+    The photon map holds the mapped photons. It must not be modified any
+    further.
+
+******************************************************************************/
+
+void PhotonMap::MapPhotons(const shared_ptr<MappedFile>& file, const Photon* photons, int count)
+{
+    POV_PHOTONS_ASSERT(mBlockList.empty());
+
+    mMappedFile = file;
+    for (int i = 0; i < count; i += PHOTON_BLOCK_SIZE)
+        // the photon data is never modified once loaded, so it is safe to cast away const-ness here
+        mBlockList.push_back(reinterpret_cast<PhotonBlock*>(const_cast<Photon*>(photons + i)));
+    numPhotons = count;
+}
+
+PhotonMapSlice::PhotonMapSlice(PhotonMap* map) :
+    numPhotons(0),
+    mMap(map),
+    mBlock(nullptr),
+    mBlockId(0),
+    mCount(0)
+{
+}
+
+/*****************************************************************************
+
+ FUNCTION
+
+  AllocatePhoton
+    allocates a photon
 
-    // If both maps had partially filled blocks, merge them.
-    if ((thisPartialBlock != nullptr) && (mapPartialBlock != nullptr))
+    Photons are allocated from a block claimed from the shared photon map,
+    claiming another block when the current one is full. No locking is
+    required except when claiming a block.
+
+******************************************************************************/
+
+Photon* PhotonMapSlice::AllocatePhoton()
+{
+    if ((mBlock == nullptr) || (mCount == PHOTON_BLOCK_SIZE))
     {
-        // Retain the old map's block, and fill it up with data from the new map's block.
-        int i;
-        for (i = 0; (thisi < PHOTON_BLOCK_SIZE) && (i < mapi); i++, thisi++)
-            (*thisPartialBlock)[thisi] = (*mapPartialBlock)[i];
-        // Now move any remaining data in the new map's block to its start.
-        if (i < mapi)
-        {
-            for (thisi = 0; i < mapi; i++, thisi++)
-                (*mapPartialBlock)[thisi] = (*mapPartialBlock)[i];
-        }
-        else
+        mBlock = mMap->ClaimBlock(mBlockId);
+        mCount = 0;
+    }
+
+    numPhotons++;
+    return &(*mBlock)[mCount++];
+}
+
+void PhotonMapSlice::Release()
+{
+    if ((mBlock != nullptr) && (mCount < PHOTON_BLOCK_SIZE))
+        mMap->ReleaseBlock(mBlockId, mCount);
+    mBlock = nullptr;
+    mCount = 0;
+}
+
+
+
+/*****************************************************************************
+
+ FUNCTION
+
+  Clear
+    discards all photons, so that the photon map can be filled anew
+
+    The gather options are kept, as they are used to continue from one
+    pass of progressive photon mapping to the next.
+
+******************************************************************************/
+
+void PhotonMap::Clear()
+{
+    if (!mMappedFile)
+    {
+        for (auto&& block : mBlockList)
         {
-            // Everything fit into the old map's block; ditch the new map's block.
-            delete mapPartialBlock;
-            mapPartialBlock = nullptr;
+            if (block != nullptr)
+                delete block;
         }
     }
+    mMappedFile.reset();
 
-    // Re-append the contents of the partially filled blocks.
-    if (thisPartialBlock != nullptr)
-        mBlockList.push_back(thisPartialBlock);
-    if (mapPartialBlock != nullptr)
-        mBlockList.push_back(mapPartialBlock);
-
-    numPhotons += map->numPhotons;
+    mBlockList.clear();
+    mPartialBlocks.clear();
+    mSubtreeQueue.clear();
+    numPhotons = 0;
 }
 
 
@@ -1383,6 +1545,10 @@ void PhotonMap::mergeMap(PhotonMap* map)
 
 PhotonMap::~PhotonMap()
 {
+    // blocks mapped from a file are not ours to free
+    if (mMappedFile)
+        return;
+
     // free all non-nullptr blocks
     for (auto&& block : mBlockList)
     {
@@ -1698,22 +1864,22 @@ void PhotonMap::halfSortRec(int left, int right, int d, int mid)
 
   FUNCTION
 
-  sortAndSubdivide
+  subdivide
 
-  Finds the dimension with the greatest range, sorts the photons on that
-  dimension.  Then it recurses on the left and right halves (keeping
-  the median photon as a pivot).  This produces a balanced kd-tree.
+  Finds the dimension with the greatest range, and moves the median photon
+  on that dimension to the middle of the range, with all photons below it
+  on that dimension to its left, and all photons above it to its right.
 
   Preconditions:
     photon memory initialized
     'start' is the index of the first photon
-    'end' is the index of the last photon
-    'sorted' is the dimension that was last sorted (so we don't sort again)
+    'end' is the index of the last photon, greater than 'start'
 
   Postconditions:
-    photons from 'start' to 'end' in the map are in a valid kd-tree format
+    the photon at the returned index is the median, and has its splitting
+    dimension set
 ******************************************************************************/
-void PhotonMap::sortAndSubdivide(int start, int end, int /*sorted*/)
+int PhotonMap::subdivide(int start, int end)
 {
     int i,j;             // counters
     PhotonVector3d min,max; // min/max vectors for finding range
@@ -1721,14 +1887,6 @@ void PhotonMap::sortAndSubdivide(int start, int end, int /*sorted*/)
     int mid;             // index of median (middle)
     int len;             // length of the array we're sorting
 
-    if (end==start)
-    {
-        GetPhoton(start).info = 0;
-        return;
-    }
-
-    if(end<start) return;
-
     // loop and find greatest range
 
     min = PhotonVector3d(1/EPSILON);  // TODO - should probably use  std::numeric_limits<PhotonScalar>::max() instead of  1/EPSILON
@@ -1774,9 +1932,43 @@ void PhotonMap::sortAndSubdivide(int start, int end, int /*sorted*/)
     // set DimToUse for the midpoint
     GetPhoton(mid).info = DimToUse;
 
+    return mid;
+}
+
+/*****************************************************************************
+
+  FUNCTION
+
+  sortAndSubdivide
+
+  Finds the dimension with the greatest range, sorts the photons on that
+  dimension.  Then it recurses on the left and right halves (keeping
+  the median photon as a pivot).  This produces a balanced kd-tree.
+
+  Preconditions:
+    photon memory initialized
+    'start' is the index of the first photon
+    'end' is the index of the last photon
+    'sorted' is the dimension that was last sorted (so we don't sort again)
+
+  Postconditions:
+    photons from 'start' to 'end' in the map are in a valid kd-tree format
+******************************************************************************/
+void PhotonMap::sortAndSubdivide(int start, int end, int /*sorted*/)
+{
+    if (end==start)
+    {
+        GetPhoton(start).info = 0;
+        return;
+    }
+
+    if(end<start) return;
+
+    int mid = subdivide(start, end);
+
     // now recurse to continue building the kd-tree
-    sortAndSubdivide(start, mid - 1, DimToUse);
-    sortAndSubdivide(mid + 1, end, DimToUse);
+    sortAndSubdivide(start, mid - 1, 0);
+    sortAndSubdivide(mid + 1, end, 0);
 }
 
 /*****************************************************************************
@@ -1801,6 +1993,89 @@ void PhotonMap::buildTree()
     sortAndSubdivide(0, numPhotons-1, X+Y+Z /* this is not X, Y, or Z */);
 }
 
+/*****************************************************************************
+
+  FUNCTION
+
+  buildTreeTop
+
+  Builds the top levels of the kd-tree, leaving the subtrees below to be
+  built by buildSubtree(), possibly by several threads at once.
+
+  The subtrees are independent ranges of the photon array, and each is split
+  exactly as sortAndSubdivide() would have done, so the resulting tree is
+  the same no matter how many threads build it, or in what order.
+
+  Preconditions:
+    photon memory initialized
+    the map contains an array of unsorted photons
+
+  Postconditions:
+    the top levels of the kd-tree are built, and the ranges of photons
+    below them are queued for buildSubtree()
+******************************************************************************/
+void PhotonMap::buildTreeTop()
+{
+    vector<std::pair<int, int> > ranges;
+
+    mSubtreeQueue.clear();
+    mSubtreeQueue.push_back(std::make_pair(0, numPhotons-1));
+
+    // split breadth-first until there are enough subtrees to keep the threads busy
+    while (mSubtreeQueue.size() < PHOTON_SUBTREES)
+    {
+        ranges.clear();
+        for (vector<std::pair<int, int> >::const_iterator i = mSubtreeQueue.begin(); i != mSubtreeQueue.end(); i++)
+        {
+            if (i->second - i->first < PHOTON_MIN_SUBTREE_SIZE)
+            {
+                ranges.push_back(*i);
+                continue;
+            }
+            int mid = subdivide(i->first, i->second);
+            ranges.push_back(std::make_pair(i->first, mid - 1));
+            ranges.push_back(std::make_pair(mid + 1, i->second));
+        }
+        if (ranges.size() == mSubtreeQueue.size())
+            break;
+        mSubtreeQueue.swap(ranges);
+    }
+}
+
+/*****************************************************************************
+
+  FUNCTION
+
+  buildSubtree
+
+  Builds one of the subtrees queued by buildTreeTop(). Safe to be called by
+  several threads at once.
+
+  Preconditions:
+    buildTreeTop() was called
+
+  Postconditions:
+    returns false if there was no subtree left to build; photons are in a
+    valid kd-tree format once every caller has received false
+******************************************************************************/
+bool PhotonMap::buildSubtree()
+{
+    std::pair<int, int> range;
+
+    {
+#if POV_MULTITHREADED
+        boost::mutex::scoped_lock lock(mSubtreeMutex);
+#endif
+        if (mSubtreeQueue.empty())
+            return false;
+        range = mSubtreeQueue.back();
+        mSubtreeQueue.pop_back();
+    }
+
+    sortAndSubdivide(range.first, range.second, X+Y+Z /* this is not X, Y, or Z */);
+    return true;
+}
+
 /*****************************************************************************
 
   FUNCTION
@@ -2232,11 +2507,16 @@ void PhotonGatherer::gatherPhotonsRec(int start, int end)
 {
     DBL delta;
     int DimToUse;
-    DBL dSqr;
     int mid;
     Photon *photon;
-    Vector3d ptToPhoton;
-    DBL discFix;   // use disc(ellipsoid) for gathering instead of sphere
+
+    // small subtrees are cheaper to test photon by photon than to descend into
+    if (end - start < PHOTON_GATHER_LEAF_SIZE)
+    {
+        for (int i = start; i <= end; i++)
+            gatherPhoton(&map->GetPhoton(i));
+        return;
+    }
 
     // find midpoint
     mid = (end+start)>>1;
@@ -2248,48 +2528,10 @@ void PhotonGatherer::gatherPhotonsRec(int start, int end)
 
     // find distance in DimToUse (largest of the photon's dimensions) from pt
     delta=(*pt_s)[DimToUse]-photon->Loc[DimToUse];
-    dSqr = Sqr(delta);
 
-    if (dSqr<dmax_s)
-    {
+    if (Sqr(delta)<dmax_s)
         // it fits DimToUse distance - maybe we can use this photon
-
-        ptToPhoton = Vector3d(photon->Loc) - *pt_s;
-
-        // find euclidean distance (squared)
-        dSqr = ptToPhoton.lengthSqr();
-
-        // now fix this distance so that we gather using an ellipsoid
-        // aligned with the surface normal instead of a sphere.  This
-        // minimizes false bleeding of photons at sharp corners
-
-        // dmax_s is square of radius of major axis
-        // dmax_s/16 is  "   "   "     " minor  "    (1/6 of major axis)
-        /*
-        discFix = dot(*norm_s,ptToPhoton);
-        discFix*=discFix*(dmax_s/1000.0-dmax_s); // TODO FIXME - magic number
-        */
-
-        if (flattenFactor!=0.0)
-        {
-            discFix = dot(*norm_s,ptToPhoton);
-            discFix = fabs(discFix);
-            dSqr += flattenFactor*(discFix)*dSqr*16;
-        }
-        // this [the above? - CLi] will add zero if on the plane, and will double distance from
-        // point to photon if ptToPhoton is perpendicular to the surface
-
-        if(dSqr < dmax_s)
-        {
-            if (gatheredPhotons.numFound+1>TargetNum_s)
-            {
-                FullPQInsert(photon, dSqr);
-                sqrt_dmax_s = sqrt(dmax_s);
-            }
-            else
-                PQInsert(photon, dSqr);
-        }
-    }
+        gatherPhoton(photon);
 
     // now go left & right if appropriate - if going left or right goes out
     // the current range, then don't go that way.
@@ -2337,6 +2579,66 @@ void PhotonGatherer::gatherPhotonsRec(int start, int end)
     }
 }
 
+/*****************************************************************************
+
+  FUNCTION
+
+  gatherPhoton()
+
+  Adds a single photon to the priority queue if it is close enough.
+
+  Preconditions:
+    same preconditions as gatherPhotonsRec()
+
+  Postconditions:
+    the photon is added to the priority queue if it is within the current
+    search radius (possibly deleting another photon to make room for it)
+
+******************************************************************************/
+
+void PhotonGatherer::gatherPhoton(Photon *photon)
+{
+    Vector3d ptToPhoton;
+    DBL dSqr;
+    DBL discFix;   // use disc(ellipsoid) for gathering instead of sphere
+
+    ptToPhoton = Vector3d(photon->Loc) - *pt_s;
+
+    // find euclidean distance (squared)
+    dSqr = ptToPhoton.lengthSqr();
+
+    // now fix this distance so that we gather using an ellipsoid
+    // aligned with the surface normal instead of a sphere.  This
+    // minimizes false bleeding of photons at sharp corners
+
+    // dmax_s is square of radius of major axis
+    // dmax_s/16 is  "   "   "     " minor  "    (1/6 of major axis)
+    /*
+    discFix = dot(*norm_s,ptToPhoton);
+    discFix*=discFix*(dmax_s/1000.0-dmax_s); // TODO FIXME - magic number
+    */
+
+    if (flattenFactor!=0.0)
+    {
+        discFix = dot(*norm_s,ptToPhoton);
+        discFix = fabs(discFix);
+        dSqr += flattenFactor*(discFix)*dSqr*16;
+    }
+    // this [the above? - CLi] will add zero if on the plane, and will double distance from
+    // point to photon if ptToPhoton is perpendicular to the surface
+
+    if(dSqr < dmax_s)
+    {
+        if (gatheredPhotons.numFound+1>TargetNum_s)
+        {
+            FullPQInsert(photon, dSqr);
+            sqrt_dmax_s = sqrt(dmax_s);
+        }
+        else
+            PQInsert(photon, dSqr);
+    }
+}
+
 /*****************************************************************************
 
   FUNCTION
@@ -2420,72 +2722,98 @@ DBL PhotonGatherer::gatherPhotonsAdaptive(const Vector3d* pt, const Vector3d* no
 
     // first try at gathering
     num=gatherPhotons(pt, Size, &radius, norm, flatten);
-    prevDensity = thisDensity = num / (radius*radius);
-    if (prevDensity==0)
-        // TODO FIXME - Magic Value
-        prevDensity = 0.0000000000000001;  // avoid div-by-zero error
 
     // start looping if necessary
-    int step=1;
-    while(num<photonSettings.minGatherCount && step<map->gatherNumSteps)
-    {
-        step++;
-        DBL tempr = 0;
-        int tempn;
-
-        // save out the current set in case we want to revert
-        GatheredPhotons savedGatheredPhotons(photonSettings.maxGatherCount);
-        savedGatheredPhotons.swapWith(gatheredPhotons);
-
-        // increase the size
-        Size+=map->gatherRadStep;
-
-        // gather again, with the new size
-        tempn=gatherPhotons(pt, Size, &tempr, norm, flatten);
-
-        // compute the density of this search
-        thisDensity = tempn / (tempr*tempr);
-
-        /*
-        this next line handles the adaptive search
-        if
-        the density change ((thisDensity-prevDensity)/prevDensity) is small enough
-            or
-        this is the first time through (step==0)
-            or
-        the number gathered is less than photonSettings.minExpandCount and greater than zero
-
-        then
-        use the color from this new gathering step and discard any previous
-        color
-
-        This adaptive search is explained my paper "Simulating Reflective and Refractive
-        Caustics in POV-Ray Using a Photon Map" - May, 1999
-        */
-        if(((thisDensity-prevDensity)/prevDensity < photonSettings.expandTolerance)
-            || (step==0)
-            || (tempn<photonSettings.minExpandCount && tempn>0))
+    if (num<photonSettings.minGatherCount && map->gatherNumSteps>1)
+    {
+        // Rather than searching the kd-tree again for each expansion step, gather once more
+        // with the largest radius we might expand to; as the photons found are the nearest ones
+        // within that radius, those of any smaller step are simply the nearest ones among them.
+        DBL maxSize = Size;
+        DBL maxRadius;
+        for (int step = 1; step < map->gatherNumSteps; step++)
+            maxSize += map->gatherRadStep; // same as the steps below, so rounding errors match
+        gatherPhotons(pt, maxSize, &maxRadius, norm, flatten);
+
+        // sort the photons found by distance
+        sortedPhotons.resize(gatheredPhotons.numFound);
+        for (int i = 0; i < gatheredPhotons.numFound; i++)
+            sortedPhotons[i] = std::make_pair(gatheredPhotons.photonDistances[i], gatheredPhotons.photonGatherList[i]);
+        std::sort(sortedPhotons.begin(), sortedPhotons.end());
+        for (int i = 0; i < gatheredPhotons.numFound; i++)
         {
-            // it passes the tests, so use the new color
-            expanded = true;
-
-            // save variables in case we loop again
-            prevDensity = thisDensity;
-            if (prevDensity==0)
-                // TODO FIXME - Magic Value
-                prevDensity = 0.0000000000000001;  // avoid div-by-zero error
-
-            // keep
-            radius = tempr;
-            num = tempn;
+            gatheredPhotons.photonDistances[i] = sortedPhotons[i].first;
+            gatheredPhotons.photonGatherList[i] = sortedPhotons[i].second;
         }
-        else
+
+        prevDensity = thisDensity = num / (radius*radius);
+        if (prevDensity==0)
+            // TODO FIXME - Magic Value
+            prevDensity = 0.0000000000000001;  // avoid div-by-zero error
+
+        int step=1;
+        while(num<photonSettings.minGatherCount && step<map->gatherNumSteps)
         {
-            // put the old gathered photons back
-            savedGatheredPhotons.swapWith(gatheredPhotons);
-            // we're done - break out of the loop
-            break;
+            step++;
+            DBL tempr;
+            int tempn;
+
+            // increase the size
+            Size+=map->gatherRadStep;
+
+            // find the photons within the new size
+            tempn = std::lower_bound(gatheredPhotons.photonDistances, gatheredPhotons.photonDistances + gatheredPhotons.numFound, Size*Size) -
+                    gatheredPhotons.photonDistances;
+            if (tempn < photonSettings.maxGatherCount)
+                tempr = Size;
+            else
+                tempr = sqrt(gatheredPhotons.photonDistances[tempn-1]);
+
+            // compute the density of this search
+            thisDensity = tempn / (tempr*tempr);
+
+            /*
+            this next line handles the adaptive search
+            if
+            the density change ((thisDensity-prevDensity)/prevDensity) is small enough
+                or
+            this is the first time through (step==0)
+                or
+            the number gathered is less than photonSettings.minExpandCount and greater than zero
+
+            then
+            use the color from this new gathering step and discard any previous
+            color
+
+            This adaptive search is explained my paper "Simulating Reflective and Refractive
+            Caustics in POV-Ray Using a Photon Map" - May, 1999
+            */
+            if(((thisDensity-prevDensity)/prevDensity < photonSettings.expandTolerance)
+                || (step==0)
+                || (tempn<photonSettings.minExpandCount && tempn>0))
+            {
+                // it passes the tests, so use the new color
+                expanded = true;
+
+                // save variables in case we loop again
+                prevDensity = thisDensity;
+                if (prevDensity==0)
+                    // TODO FIXME - Magic Value
+                    prevDensity = 0.0000000000000001;  // avoid div-by-zero error
+
+                // keep
+                radius = tempr;
+                num = tempn;
+            }
+            else
+            {
+                // we're done - break out of the loop
+                break;
+            }
         }
+
+        // keep only the photons of the step we settled on, which are the nearest ones
+        gatheredPhotons.numFound = num;
     }
     // TODO FIXME STATS
     //if (expanded)
@@ -2500,7 +2828,7 @@ DBL PhotonGatherer::gatherPhotonsAdaptive(const Vector3d* pt, const Vector3d* no
 stuff grabbed from radiosit.h & radiosit.c
 ******************************************************************/
 
-extern BYTE_XYZ kaRandCosWeighted[];
+extern const BYTE_XYZ kaRandCosWeighted[];
 
 /******************************************************************
 ******************************************************************/
@@ -2629,7 +2957,7 @@ void LightTargetCombo::computeAnglesAndDeltas(shared_ptr<SceneData> sceneData)
     shootingDirection.compute();
 
     // calculate the spacial separation (spread)
-    photonSpread = target->Ph_Density*sceneData->photonSettings.surfaceSeparation;
+    photonSpread = target->Ph_Density*sceneData->photonSettings.surfaceSeparation*spacingFactor;
 
     // if rays aren't parallel, divide by dist so we get separation at a distance of 1 unit
     if (!light->Parallel)
@@ -2683,5 +3011,114 @@ void LightTargetCombo::computeAnglesAndDeltas(shared_ptr<SceneData> sceneData)
     }
 }
 
+/*****************************************************************************
+*
+* VisualImportanceMap
+*
+*****************************************************************************/
+
+// Points are entered into a uniform grid, in every cell their sphere overlaps. To keep that
+// number bounded, the cell size follows the larger radii, and the few radii beyond are clipped.
+const DBL kVisualImportanceCellPercentile = 0.9;
+
+void VisualImportanceMap::Add(const Vector3d& point, DBL radius)
+{
+    VisiblePoint p;
+    p.point = point;
+    p.radius = radius;
+    points.push_back(p);
+}
+
+void VisualImportanceMap::Build()
+{
+    cells.clear();
+    if (points.empty())
+        return;
+
+    vector<DBL> radii;
+    radii.reserve(points.size());
+    for (vector<VisiblePoint>::const_iterator i = points.begin(); i != points.end(); ++i)
+        radii.push_back(i->radius);
+    vector<DBL>::iterator nth = radii.begin() + size_t((radii.size() - 1) * kVisualImportanceCellPercentile);
+    std::nth_element(radii.begin(), nth, radii.end());
+    cellSize = max(*nth, EPSILON);
+
+    for (unsigned int n = 0; n < points.size(); ++n)
+    {
+        VisiblePoint& p = points[n];
+        p.radius = min(p.radius, cellSize);
+        int lo[3], hi[3];
+        CellIndex(p.point - Vector3d(p.radius), lo);
+        CellIndex(p.point + Vector3d(p.radius), hi);
+        for (int x = lo[X]; x <= hi[X]; ++x)
+            for (int y = lo[Y]; y <= hi[Y]; ++y)
+                for (int z = lo[Z]; z <= hi[Z]; ++z)
+                    cells.push_back(std::make_pair(CellKey(x, y, z), n));
+    }
+
+    std::sort(cells.begin(), cells.end());
+}
+
+bool VisualImportanceMap::IsVisible(const Vector3d& point) const
+{
+    if (cells.empty())
+        return false;
+
+    int index[3];
+    CellIndex(point, index);
+    POV_UINT64 key = CellKey(index[X], index[Y], index[Z]);
+
+    vector<std::pair<POV_UINT64, unsigned int> >::const_iterator i =
+        std::lower_bound(cells.begin(), cells.end(), std::make_pair(key, 0u));
+    for (; (i != cells.end()) && (i->first == key); ++i)
+    {
+        const VisiblePoint& p = points[i->second];
+        if ((point - p.point).lengthSqr() <= p.radius * p.radius)
+            return true;
+    }
+
+    return false;
+}
+
+void VisualImportanceMap::CellIndex(const Vector3d& point, int index[3]) const
+{
+    for (int i = X; i <= Z; ++i)
+        index[i] = int(floor(point[i] / cellSize));
+}
+
+POV_UINT64 VisualImportanceMap::CellKey(int x, int y, int z)
+{
+    // 21 bits per coordinate; cells that wrap around merely share a key
+    return ((POV_UINT64(x) & 0x1FFFFF) << 42) | ((POV_UINT64(y) & 0x1FFFFF) << 21) | (POV_UINT64(z) & 0x1FFFFF);
+}
+
+/*****************************************************************************
+*
+* PhotonDirectionImportance
+*
+*****************************************************************************/
+
+void PhotonDirectionImportance::Init(unsigned int thetaCount, unsigned int phiCount, DBL mintheta, DBL maxtheta)
+{
+    thetaCells = max(thetaCount, 1u);
+    phiCells = max(phiCount, 1u);
+    minTheta = mintheta;
+    thetaScale = thetaCells / max(maxtheta - mintheta, EPSILON);
+    probabilities.assign(thetaCells * phiCells, 1.0f);
+}
+
+DBL PhotonDirectionImportance::Probability(DBL theta, DBL phi) const
+{
+    if (probabilities.empty())
+        return 1.0;
+
+    int t = clip(int(floor((theta - minTheta) * thetaScale)), 0, int(thetaCells) - 1);
+    DBL phiFraction = (phi + M_PI) / (2.0 * M_PI);
+    phiFraction -= floor(phiFraction);
+    int p = min(int(phiFraction * phiCells), int(phiCells) - 1);
+
+    return Cell(t, p);
+}
+
 } // end of namespace
 
@@ -39,8 +39,21 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+// C++ variants of C standard header files
+#include <cstring>
+
 // C++ standard header files
 #include <string>
+#include <utility>
+#include <vector>
+
+// Boost header files
+#if POV_MULTITHREADED
+#include <boost/thread.hpp>
+#endif
+
+// POV-Ray header files (base module)
+#include "base/filemapping.h"
 
 // POV-Ray header files (core module)
 #include "core/material/media.h"
@@ -71,6 +84,7 @@ class ScenePhotonSettings
             surfaceSeparation = 0.1;
             globalSeparation = 0.1;
             surfaceCount = 0;
+            adaptiveCount = false;
 
             expandTolerance = 0;
             minExpandCount = 0;
@@ -85,6 +99,8 @@ class ScenePhotonSettings
             // see the POV documentation for info about autostop
             autoStopPercent = 1.0;  // disabled by default
 
+            importance = 1.0;  // disabled by default
+
             // these are used for saving or loading the photon map
             // note: save and load are mutually exclusive - there are three states: save, load, neither;
             // save is indicated by a non-empty fileName with loadFile set to false.
@@ -111,6 +127,8 @@ class ScenePhotonSettings
         DBL globalSeparation;
         // ...or photon count
         int surfaceCount;
+        // distribute the photon count among the light sources according to their brightness
+        bool adaptiveCount;
 
         // settings for the adaptive search
         // see POV documentation for an explanation
@@ -127,6 +145,10 @@ class ScenePhotonSettings
         // see the POV documentation for info about autostop
         DBL autoStopPercent;
 
+        // probability of shooting photons in directions whose photons do not reach any surface
+        // seen by the camera; 1.0 disables the visual importance pass
+        DBL importance;
+
         // these are used for saving or loading the photon map
         // note: save and load are mutually exclusive - there are three states: save, load, neither;
         // save is indicated by a non-empty fileName with loadFile set to false.
@@ -156,6 +178,56 @@ class ScenePhotonSettings
 typedef float PhotonScalar;
 typedef GenericVector3d<PhotonScalar> PhotonVector3d;
 
+#if POV_PHOTONS_COMPACT
+
+/// Photon location stored at reduced precision.
+///
+/// Each coordinate is stored as a single-precision value with the 8 least significant mantissa
+/// bits rounded off, giving a relative precision of about 3e-5 in 3 bytes instead of 4. The
+/// rounding preserves the order of the coordinates, so the kd-tree remains valid.
+///
+class PhotonLocation
+{
+    public:
+
+        PhotonLocation() {}
+
+        explicit PhotonLocation(const Vector3d& v)
+        {
+            for (int i = X; i <= Z; i++)
+            {
+                PhotonScalar s = PhotonScalar(v[i]);
+                POV_UINT32 bits;
+                std::memcpy(&bits, &s, sizeof(bits));
+                if ((bits & 0x7FFFFFFF) < 0x7F7FFF80) // avoid rounding the largest values to NaN
+                    bits += 0x80;
+                mData[i][0] = (unsigned char)(bits >> 8);
+                mData[i][1] = (unsigned char)(bits >> 16);
+                mData[i][2] = (unsigned char)(bits >> 24);
+            }
+        }
+
+        inline PhotonScalar operator[](int i) const
+        {
+            POV_UINT32 bits = (POV_UINT32(mData[i][0]) << 8) | (POV_UINT32(mData[i][1]) << 16) | (POV_UINT32(mData[i][2]) << 24);
+            PhotonScalar s;
+            std::memcpy(&s, &bits, sizeof(s));
+            return s;
+        }
+
+        inline operator Vector3d() const { return Vector3d((*this)[X], (*this)[Y], (*this)[Z]); }
+
+    private:
+
+        unsigned char mData[3][3];
+};
+
+#else
+
+typedef PhotonVector3d PhotonLocation;
+
+#endif
+
 struct Photon
 {
     void init(unsigned char _info)
@@ -163,7 +235,7 @@ struct Photon
         this->info = _info;
     }
 
-    PhotonVector3d Loc;     /* location */
+    PhotonLocation Loc;     /* location */
     PhotonColour colour;    /* color & intensity (flux) */
     unsigned char info;     /* info byte for kd-tree */
     signed char theta, phi; /* incoming direction */
@@ -173,6 +245,8 @@ struct Photon
 /* photon map */
 /* ------------------------------------------------------ */
 
+class PhotonMapSlice;
+
 class PhotonMap
 {
 
@@ -180,6 +254,8 @@ class PhotonMap
 
         class PhotonBlock;
 
+        friend class PhotonMapSlice;
+
     public:
 
         std::vector<PhotonBlock*> mBlockList;
@@ -197,14 +273,22 @@ class PhotonMap
         void insertSort(int start, int end, int d);
         void quickSortRec(int left, int right, int d);
         void halfSortRec(int left, int right, int d, int mid);
+        int subdivide(int start, int end);
         void sortAndSubdivide(int start, int end, int /*sorted*/);
         void buildTree();
+        void buildTreeTop();
+        bool buildSubtree();
 
         void setGatherOptions(ScenePhotonSettings& photonSettings, bool mediaMap);
 
         Photon* AllocatePhoton();
 
-        void mergeMap(PhotonMap* map);
+        void mergeSlices();
+
+        void MapPhotons(const shared_ptr<MappedFile>& file, const Photon* photons, int count);
+
+        /// Discard all photons, keeping the gather options.
+        void Clear();
 
         Photon& GetPhoton(unsigned int photonId);
         const Photon& GetPhoton(unsigned int photonId) const;
@@ -248,6 +332,49 @@ class PhotonMap
 
         Photon& GetPhoton(unsigned int blockId, unsigned int indexInBlock);
         const Photon& GetPhoton(unsigned int blockId, unsigned int indexInBlock) const;
+
+        PhotonBlock* ClaimBlock(int& blockId);
+        void ReleaseBlock(int blockId, int count);
+
+        /// Ranges of photons (first and last index) left by @ref buildTreeTop() to be built by @ref buildSubtree().
+        std::vector<std::pair<int, int> > mSubtreeQueue;
+        /// File the photons are mapped from by @ref MapPhotons(), if any.
+        /// The blocks then point into the file's contents, and must not be modified or deleted.
+        shared_ptr<MappedFile> mMappedFile;
+        /// Blocks (block index and number of photons) left partially filled by @ref PhotonMapSlice.
+        std::vector<std::pair<int, int> > mPartialBlocks;
+#if POV_MULTITHREADED
+        boost::mutex mSubtreeMutex;     ///< Lock this when accessing mSubtreeQueue.
+        boost::mutex mBlockMutex;       ///< Lock this when claiming or releasing blocks.
+#endif
+};
+
+/// Portion of a photon map being filled by a single thread.
+///
+/// Each thread shooting photons claims whole blocks of the shared photon map in turn, and
+/// writes its photons directly into them. Only the blocks left partially filled at the end
+/// need to be copied, by @ref PhotonMap::mergeSlices().
+///
+class PhotonMapSlice
+{
+    public:
+
+        int numPhotons;         ///< Number of photons stored via this slice.
+
+        PhotonMapSlice(PhotonMap* map);
+
+        Photon* AllocatePhoton();
+
+        /// Hand the current block back to the photon map.
+        /// @note   This must be called once the thread has finished storing photons.
+        void Release();
+
+    private:
+
+        PhotonMap* mMap;
+        PhotonMap::PhotonBlock* mBlock;
+        int mBlockId;
+        int mCount;
 };
 
 
@@ -290,10 +417,12 @@ class PhotonGatherer
         DBL alreadyGatheredRadius;
 
         GatheredPhotons gatheredPhotons;
+        vector<std::pair<DBL, Photon*> > sortedPhotons; // scratch buffer of gatherPhotonsAdaptive(), kept to avoid re-allocation
 
         PhotonGatherer(PhotonMap *map, ScenePhotonSettings& photonSettings);
 
         void gatherPhotonsRec(int start, int end);
+        void gatherPhoton(Photon *photon);
         int gatherPhotons(const Vector3d* pt, DBL Size, DBL *r, const Vector3d* norm, bool flatten);
         DBL gatherPhotonsAdaptive(const Vector3d* pt, const Vector3d* norm, bool flatten);
 
@@ -337,6 +466,98 @@ class PhotonTrace : public Trace
 // forward declaration
 class LightTargetCombo;
 
+/* ------------------------------------------------------ */
+/* visual importance */
+/* ------------------------------------------------------ */
+
+/// Receiver of the photons deposited while probing the scene.
+///
+/// While a probe is set in @ref TraceThreadData::photonDepositProbe, photons are reported to the
+/// probe instead of being stored in the photon maps.
+///
+class PhotonDepositProbe
+{
+    public:
+        virtual ~PhotonDepositProbe() {}
+
+        /// Report a photon that would have been stored.
+        /// @param[in]  point   Location of the photon.
+        /// @param[in]  media   Whether the photon would have gone to the media photon map.
+        virtual void Deposit(const Vector3d& point, bool media) = 0;
+};
+
+/// Set of surface points seen by the camera, each covering a small sphere.
+class VisualImportanceMap
+{
+    public:
+        VisualImportanceMap() : cellSize(0.0) {}
+
+        /// Add a visible point.
+        /// @param[in]  point   Location of the point.
+        /// @param[in]  radius  Radius around the point within which photons contribute to the image.
+        void Add(const Vector3d& point, DBL radius);
+
+        /// Prepare the map for look-ups, once all points have been added.
+        void Build();
+
+        /// Whether a location lies within the radius of any visible point.
+        bool IsVisible(const Vector3d& point) const;
+
+        bool Empty() const { return points.empty(); }
+
+    private:
+        struct VisiblePoint
+        {
+            Vector3d    point;
+            DBL         radius;
+        };
+
+        vector<VisiblePoint> points;
+        /// keys of the grid cells overlapped by each point, and the point's index, sorted by key
+        vector<std::pair<POV_UINT64, unsigned int> > cells;
+        DBL cellSize;
+
+        void CellIndex(const Vector3d& point, int index[3]) const;
+        static POV_UINT64 CellKey(int x, int y, int z);
+};
+
+/// Probability of shooting photons in the directions of a light/target combination.
+///
+/// The directions are split into a grid of cells by the angle @f$\theta@f$ from the direction
+/// towards the target (or the distance from the axis, for parallel lights) and the angle
+/// @f$\phi@f$ around it. An empty grid shoots photons in all directions.
+///
+class PhotonDirectionImportance
+{
+    public:
+        PhotonDirectionImportance() : thetaCells(0), phiCells(0), minTheta(0.0), thetaScale(0.0) {}
+
+        void Init(unsigned int thetaCount, unsigned int phiCount, DBL mintheta, DBL maxtheta);
+        void Clear() { probabilities.clear(); }
+        bool Empty() const { return probabilities.empty(); }
+
+        unsigned int GetThetaCells() const { return thetaCells; }
+        unsigned int GetPhiCells() const { return phiCells; }
+
+        /// Get the angle @f$\theta@f$ at a given fraction of a cell's extent.
+        DBL CellTheta(unsigned int t, DBL fraction) const { return minTheta + (t + fraction) / thetaScale; }
+        /// Get the angle @f$\phi@f$ at a given fraction of a cell's extent.
+        DBL CellPhi(unsigned int p, DBL fraction) const { return -M_PI + (p + fraction) * (2.0 * M_PI / phiCells); }
+
+        float& Cell(unsigned int t, unsigned int p) { return probabilities[t * phiCells + p]; }
+        float Cell(unsigned int t, unsigned int p) const { return probabilities[t * phiCells + p]; }
+
+        /// Get the probability of shooting a photon in a given direction.
+        DBL Probability(DBL theta, DBL phi) const;
+
+    private:
+        vector<float> probabilities;
+        unsigned int thetaCells;
+        unsigned int phiCells;
+        DBL minTheta;
+        DBL thetaScale;
+};
+
 /* ------------------------------------------------------ */
 /* photon map builder */
 /* ------------------------------------------------------ */
@@ -360,7 +581,7 @@ class ShootingDirection
 class LightTargetCombo
 {
     public:
-        LightTargetCombo(LightSource *light, ObjectPtr target):light(light),target(target),shootingDirection(light,target) {}
+        LightTargetCombo(LightSource *light, ObjectPtr target):light(light),target(target),spacingFactor(1.0),shootingDirection(light,target) {}
         LightSource *light;
         ObjectPtr target;
         int estimate;
@@ -368,7 +589,9 @@ class LightTargetCombo
         DBL maxtheta;
         DBL dtheta;
         DBL photonSpread;
+        DBL spacingFactor;      // multiplier to the photon spacing for this combination
         ShootingDirection shootingDirection;
+        PhotonDirectionImportance importance;   // empty unless the visual importance pass is enabled
 
         int computeMergedFlags();
         void computeAnglesAndDeltas(shared_ptr<SceneData> sceneData);
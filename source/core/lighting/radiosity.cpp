@@ -65,8 +65,10 @@
 
 #include <cstring>
 #include <algorithm>
+#include <iterator>
 
 #include "base/fileinputoutput.h"
+#include "base/memoryaccounting.h"
 
 #include "core/lighting/photons.h"
 #include "core/render/ray.h"
@@ -105,6 +107,27 @@ const int PRETRACE_STEP_LOADED = std::numeric_limits<signed char>::max();   // d
 
 #define BRILLIANCE_EPSILON 1e-5
 
+// maximum length of a line in a radiosity cache file, including the terminating null character
+#define RADIOSITY_CACHE_LINE_LENGTH 256
+
+// when updating a cache file incrementally, samples closer to a changed object than this many times their
+// harmonic mean distance to surrounding surfaces are discarded
+#define RADIOSITY_CHANGE_DISTANCE_FACTOR 4.0
+
+// when merging cache files, samples closer to an existing sample than this fraction of their harmonic mean
+// distance to surrounding surfaces, and with a normal deviating by less than the corresponding angle, are duplicates
+#define RADIOSITY_MERGE_DISTANCE_FACTOR 0.05
+#define RADIOSITY_MERGE_NORMAL_COS 0.99
+
+// structure used to look for an existing sample duplicating one to be merged
+struct DUPLICATE_SEARCH
+{
+    Vector3d P;             // position of the sample to be merged
+    Vector3d N;             // normal of the sample to be merged
+    DBL MaxDistance;        // maximum distance of a duplicate
+    bool Found;             // set if a duplicate has been found
+};
+
 // structure used to gather weighted average during tree traversal
 struct WT_AVG
 {
@@ -152,7 +175,7 @@ inline QualityFlags GetRadiosityQualityFlags(const SceneRadiositySettings& rs, c
 
 static const unsigned int BLOCK_POOL_UNIT_SIZE = 32;
 
-struct RadiosityCache::BlockPool::PoolUnit
+struct RadiosityCache::BlockPool::PoolUnit : public MemoryAccounted<kMemoryRadiosity>
 {
     PoolUnit *next;
     ot_block_struct blocks[BLOCK_POOL_UNIT_SIZE];
@@ -298,6 +321,9 @@ RadiosityFunction::RadiosityFunction(shared_ptr<SceneData> sd, TraceThreadData *
     recursionParameters(new RecursionParameters[rs.recursionLimit]),
     topLevelQueryCount(0),
     topLevelReuse(0.0),
+    topLevelGatherCount(0),
+    topLevelErrorCount(0),
+    topLevelError(0.0),
     tileId(0),
     cacheBlockPool(nullptr),
     settings(rs),
@@ -319,16 +345,37 @@ RadiosityFunction::~RadiosityFunction()
     delete[] recursionParameters;
 }
 
+void RadiosityFunction::ScaleRaysPerSample(double scale)
+{
+    RadiosityRecursionSettings* scaledSettings = settings.GetRecursionSettings(isFinalTrace);
+
+    // keep the minimum of 5 rays per sample imposed by the settings
+    for (unsigned int depth = 0; depth < settings.recursionLimit; depth ++)
+        scaledSettings[depth].raysPerSample = max(5, int(scaledSettings[depth].raysPerSample * scale));
+
+    delete[] recursionSettings;
+    recursionSettings = scaledSettings;
+}
+
 void RadiosityFunction::GetTopLevelStats(long& queryCount, float& reuse)
 {
     queryCount = topLevelQueryCount;
     reuse      = topLevelReuse;
 }
 
+void RadiosityFunction::GetTopLevelConvergence(long& gatherCount, float& error)
+{
+    gatherCount = topLevelGatherCount;
+    error       = (topLevelErrorCount > 0 ? topLevelError / topLevelErrorCount : 0.0);
+}
+
 void RadiosityFunction::ResetTopLevelStats()
 {
-    topLevelQueryCount = 0;
-    topLevelReuse      = 0.0;
+    topLevelQueryCount  = 0;
+    topLevelReuse       = 0.0;
+    topLevelGatherCount = 0;
+    topLevelErrorCount  = 0;
+    topLevelError       = 0.0;
 }
 
 void RadiosityFunction::BeforeTile(int id, unsigned int pts)
@@ -421,6 +468,15 @@ void RadiosityFunction::ComputeAmbient(const Vector3d& ipoint, const Vector3d& r
         MathColour tmpColour;
         double quality = GatherLight(ipoint, raw_normal, effectiveNormal, tmpBrilliance, tmpColour, ticket);
 
+        // keep track of how well the samples found nearby would have done, to tell when pretrace has converged
+        if ((ticket.radiosityRecursionDepth == 0) && (reuse > 0))
+        {
+            float interpolated = ambient_colour.Greyscale();
+            float gathered     = tmpColour.Greyscale();
+            topLevelError += fabs(interpolated - gathered) / max(max(interpolated, gathered), float(EPSILON));
+            topLevelErrorCount ++;
+        }
+
         // If we already found samples nearby (and we just decided to take more), make use of them.
         if (reuse > 0)
             ambient_colour = (ambient_colour * reuse + tmpColour * quality) / (reuse + quality);
@@ -434,6 +490,7 @@ void RadiosityFunction::ComputeAmbient(const Vector3d& ipoint, const Vector3d& r
         if (ticket.radiosityRecursionDepth == 0)
         {
             threadData->Stats()[Radiosity_TopLevel_GatherCount]++;
+            topLevelGatherCount ++;
         }
         if (isFinalTrace)
         {
@@ -548,7 +605,14 @@ double RadiosityFunction::GatherLight(const Vector3d& ipoint, const Vector3d& ra
     unsigned int okCountRaw = 0;
     bool use_raw_normal = similar(raw_normal, layer_normal); // if the normal isn't pertubed, go for the raw normal right away because it makes life easier
     double qualitySum = 0.0;
-    param.directionGenerator.InitSequence(cur_sample_count, raw_normal, layer_normal, use_raw_normal, brilliance);
+    ScrambledSobolSampleSet sampleSet;
+    const ScrambledSobolSampleSet* pSampleSet = nullptr;
+    if (threadData->GetSceneData()->samplingMethod == kSamplingMethod_Sobol)
+    {
+        sampleSet = threadData->sampler.NewSet(kSamplerStream_Radiosity);
+        pSampleSet = &sampleSet;
+    }
+    param.directionGenerator.InitSequence(cur_sample_count, raw_normal, layer_normal, use_raw_normal, brilliance, pSampleSet);
     for(unsigned int i = 0, hit = 0; i < cur_sample_count; i++)
     {
         bool ray_ok = param.directionGenerator.GetDirection(direction);
@@ -556,7 +620,7 @@ double RadiosityFunction::GatherLight(const Vector3d& ipoint, const Vector3d& ra
         {
             // out of good sample directions, but we may still re-try with the raw normal
             use_raw_normal = true;
-            param.directionGenerator.InitSequence(cur_sample_count, raw_normal, layer_normal, use_raw_normal, brilliance);
+            param.directionGenerator.InitSequence(cur_sample_count, raw_normal, layer_normal, use_raw_normal, brilliance, pSampleSet);
             ray_ok = param.directionGenerator.GetDirection(direction);
         }
         if (!ray_ok)
@@ -750,20 +814,55 @@ RadiosityFunction::SampleDirectionGenerator::SampleDirectionGenerator() :
     rawNormal(0,1,0),
     frameX(1,0,0),
     frameY(0,1,0),
-    frameZ(0,0,1)
+    frameZ(0,0,1),
+    poolIndex(0),
+    useSampleSet(false),
+    sampleSetIndex(0),
+    batchSize(0),
+    batchNext(0)
 {}
 
 void RadiosityFunction::SampleDirectionGenerator::Reset(unsigned int samplePoolCount)
 {
-    if (!sampleDirections)
-        sampleDirections = GetSubRandomCosWeightedDirectionGenerator(0, samplePoolCount);
+    if (poolX.empty())
+    {
+        // fetch the whole cycle of precomputed directions once, so that they can be transformed in batches
+        SequentialVectorGeneratorPtr sampleDirections = GetSubRandomCosWeightedDirectionGenerator(0, samplePoolCount);
+        size_t sequenceSize = sampleDirections->CycleLength();
+        poolX.resize(sequenceSize);
+        poolY.resize(sequenceSize);
+        poolZ.resize(sequenceSize);
+        for (size_t i = 0; i < sequenceSize; i ++)
+        {
+            Vector3d v = (*sampleDirections)();
+            poolX[i] = v.x();
+            poolY[i] = fabs(v.y());
+            poolZ[i] = v.z();
+        }
+        poolIndex = 0;
+        batchSize = batchNext = 0;
+    }
 }
 
-void RadiosityFunction::SampleDirectionGenerator::InitSequence(unsigned int& sample_count, const Vector3d& raw_normal, const Vector3d& layer_normal, bool use_raw_normal, DBL br)
+void RadiosityFunction::SampleDirectionGenerator::InitSequence(unsigned int& sample_count, const Vector3d& raw_normal, const Vector3d& layer_normal, bool use_raw_normal, DBL br,
+                                                               const ScrambledSobolSampleSet* set)
 {
-    size_t sequenceSize = sampleDirections->CycleLength();
+    size_t sequenceSize = poolX.size();
     sample_count = (unsigned int)min((size_t)sample_count, sequenceSize);
 
+    // hand back any directions of the previous sequence that were transformed but not used,
+    // so that we pick up the precomputed sequence exactly where the previous one left off
+    if (!useSampleSet)
+        poolIndex = (poolIndex + sequenceSize - (batchSize - batchNext)) % sequenceSize;
+    batchSize = batchNext = 0;
+
+    useSampleSet = (set != nullptr);
+    if (useSampleSet)
+    {
+        sampleSet = *set;
+        sampleSetIndex = 0;
+    }
+
     if (use_raw_normal)
         // when working with the raw normal, everything should work smooth (and we don't have any fallback solution anyway). No limits.
         remainingDirections = sequenceSize;
@@ -802,49 +901,116 @@ void RadiosityFunction::SampleDirectionGenerator::InitSequence(unsigned int& sam
     brilliance = br;
 }
 
+void RadiosityFunction::SampleDirectionGenerator::FillBatch()
+{
+    // only transform as many directions as may actually be used, and stop at the end of the pool;
+    // that way the loops below run over plain contiguous arrays, for the compiler to vectorize
+    size_t count;
+    const DBL* srcX;
+    const DBL* srcY;
+    const DBL* srcZ;
+
+    DBL tempX[RADIOSITY_DIRECTION_BATCH], tempY[RADIOSITY_DIRECTION_BATCH], tempZ[RADIOSITY_DIRECTION_BATCH];
+    DBL setX[RADIOSITY_DIRECTION_BATCH], setY[RADIOSITY_DIRECTION_BATCH], setZ[RADIOSITY_DIRECTION_BATCH];
+    if (useSampleSet)
+    {
+        // draw cosine-weighted directions from the low-discrepancy sample set
+        count = min((size_t)RADIOSITY_DIRECTION_BATCH, remainingDirections);
+        for (size_t i = 0; i < count; i ++)
+        {
+            Vector3d v = CosWeighted3dOnHemisphere(sampleSet.Get2d(sampleSetIndex + (unsigned int)i));
+            setX[i] = v.x();
+            setY[i] = v.y();
+            setZ[i] = v.z();
+        }
+        sampleSetIndex += (unsigned int)count;
+        srcX = setX;
+        srcY = setY;
+        srcZ = setZ;
+    }
+    else
+    {
+        count = min(min((size_t)RADIOSITY_DIRECTION_BATCH, remainingDirections), poolX.size() - poolIndex);
+        srcX = &poolX[poolIndex];
+        srcY = &poolY[poolIndex];
+        srcZ = &poolZ[poolIndex];
+    }
+
+    if (brilliance != 1.0)
+    {
+        // Tweak the direction vectors according to the brilliance specified.
+        DBL exponent = 2.0/(1.0 + brilliance);
+        for (size_t i = 0; i < count; i ++)
+        {
+            DBL yOldSqr     =  Sqr(srcY[i]);
+            DBL yNewSqr     =  pow(yOldSqr, exponent);
+            DBL rFactor     =  sqrt((1.0 - yNewSqr)/(1.0 - yOldSqr));
+            tempX[i]        =  srcX[i] * rFactor;
+            tempY[i]        =  sqrt(yNewSqr);
+            tempZ[i]        =  srcZ[i] * rFactor;
+        }
+        srcX = tempX;
+        srcY = tempY;
+        srcZ = tempZ;
+    }
+
+    // TODO OPTIMIZE
+    //  - Checking for almost-exact match with other axes might be beneficial as well, because we could just swap the co-ordinates;
+    //    the -Y direction would be the "hottest" candidate again (think roofs); the others might be more common than other directions
+    //    as well (think walls or boxes)
+    if(frameY[Y] > 1.0 - RAD_EPSILON)
+    {
+        // within 2.56 degree of Y, so we'll cheat a bit by using precomputed vectors as-is
+        for (size_t i = 0; i < count; i ++)
+        {
+            batchX[i] = srcX[i];
+            batchY[i] = srcY[i];
+            batchZ[i] = srcZ[i];
+        }
+    }
+    else if(frameY[Y] < -1.0 + RAD_EPSILON)
+    {
+        // within 2.56 degree of -Y, so we'll cheat a bit by using precomputed vectors simply inverted
+        for (size_t i = 0; i < count; i ++)
+        {
+            batchX[i] = -srcX[i];
+            batchY[i] = -srcY[i];
+            batchZ[i] = -srcZ[i];
+        }
+    }
+    else
+    {
+        // somewhere else, we need to do some math
+        for (size_t i = 0; i < count; i ++)
+        {
+            batchX[i] = frameX[X] * srcX[i] + frameY[X] * srcY[i] + frameZ[X] * srcZ[i];
+            batchY[i] = frameX[Y] * srcX[i] + frameY[Y] * srcY[i] + frameZ[Y] * srcZ[i];
+            batchZ[i] = frameX[Z] * srcX[i] + frameY[Z] * srcY[i] + frameZ[Z] * srcZ[i];
+        }
+    }
+
+    batchSize = (unsigned int)count;
+    batchNext = 0;
+    if (!useSampleSet)
+        poolIndex = (poolIndex + count) % poolX.size();
+}
+
 bool RadiosityFunction::SampleDirectionGenerator::GetDirection(Vector3d& direction)
 {
     if (!remainingDirections)
         // we're out of samples for sure
         return false;
 
-    Vector3d random_vec;
     DBL ray_ok = -1.0;
 
     // loop through here choosing rays until we get one that is not behind the surface
-    // TODO OPTIMIZE
-    //  - Checking for almost-exact match with other axes might be beneficial as well, because we could just swap the co-ordinates;
-    //    the -Y direction would be the "hottest" candidate again (think roofs); the others might be more common than other directions
-    //    as well (think walls or boxes)
     do
     {
         //Increase_Counter(stats[Gather_Performed_Count]);
-        random_vec = (*sampleDirections)();
-
-        // Tweak the direction vector according to the brilliance specified.
-        random_vec.y() = fabs(random_vec.y());
-        if (brilliance != 1.0)
-        {
-            DBL yOld        =  random_vec.y();
-            DBL yOldSqr     =  Sqr(yOld);
-            DBL yNewSqr     =  pow(yOldSqr, 2.0/(1.0 + brilliance));
-            DBL rOldSqr     =  1.0 - yOldSqr;
-            DBL rNewSqr     =  1.0 - yNewSqr;
-            DBL rFactor     =  sqrt(rNewSqr/rOldSqr);
-            random_vec.x()  *= rFactor;
-            random_vec.z()  *= rFactor;
-            random_vec.y()  =  sqrt(yNewSqr);
-        }
-
-        if(frameY[Y] > 1.0 - RAD_EPSILON)
-            // within 2.56 degree of Y, so we'll cheat a bit by using precomputed vectors as-is
-            direction = random_vec;
-        else if(frameY[Y] < -1.0 + RAD_EPSILON)
-            // within 2.56 degree of -Y, so we'll cheat a bit by using precomputed vectors simply inverted
-            direction = -random_vec;
-        else
-            // somewhere else, we need to do some math
-            direction = ((frameX * random_vec[X]) + (frameY * random_vec[Y]) + (frameZ * random_vec[Z]));
+        if (batchNext == batchSize)
+            FillBatch();
+        direction = Vector3d(batchX[batchNext], batchY[batchNext], batchZ[batchNext]);
+        batchNext ++;
 
         if (rawNormalMode)
             ray_ok = 1.0; // no need to check - we know it's good
@@ -882,6 +1048,7 @@ bool RadiosityFunction::SampleDirectionGenerator::GetDirection(Vector3d& directi
 RadiosityCache::RadiosityCache(const SceneRadiositySettings& radset) :
     ra_reuse_count(0),
     ra_gather_count(0),
+    useSpatialHash(radset.cacheMethod == RADIOSITY_CACHE_SPATIAL_HASH),
     ot_fd(nullptr),
     Gather_Total_Count(0),
     recursionSettings(radset.GetRecursionSettings(true)) // be prepared for the main render
@@ -896,110 +1063,234 @@ RadiosityCache::RadiosityCache(const SceneRadiositySettings& radset) :
     #endif
 }
 
-bool RadiosityCache::Load(const Path& inputFile)
+bool RadiosityCache::ReadCacheFile(const Path& inputFile, vector<CacheFileSample>& samples, vector<std::string>& records)
 {
-    bool ok = false;
     IStream* fd = NewIStream(inputFile, POV_File_Data_RCA);
-    if (fd != nullptr)
+    if (fd == nullptr)
+        return false;
+
+    int tx, ty, tz;
+    CacheFileSample sample;
+    int count;
+    DBL brightness;
+    char normal_string[30], to_nearest_string[30];
+    char line[RADIOSITY_CACHE_LINE_LENGTH];
+
+    //info->Gather_Total.clear();
+    //info->Gather_Total_Count = 0;
+
+    while (fd->getline (line, RADIOSITY_CACHE_LINE_LENGTH - 1))
     {
-        BlockPool* pool = AcquireBlockPool();
-
-        bool got_eof;
-        int line_num = 0;
-        int depth, tx, ty, tz;
-        Vector3d point;
-        Vector3d normal;
-        Vector3d to_nearest;
-        MathColour dx, dy, dz;
-        MathColour illuminance;
-        double harmonic_mean;
-        double nearest;
-        int goodreads = 0;
-        int count;
-        DBL brightness;
-        char normal_string[30], to_nearest_string[30];
-        char line[101];
-
-        //info->Gather_Total.clear();
-        //info->Gather_Total_Count = 0;
-
-        while (!(got_eof = !fd->getline (line, 99)))
+        switch ( line[0] )
         {
-            switch ( line[0] )
+            case 'B':    // the file contains the old radiosity_brightness value
             {
-                case 'B':    // the file contains the old radiosity_brightness value
-                {
-                    if ( sscanf(line, "B%lf\n", &brightness) == 1 )
-                    {
-                        //info->Brightness = brightness;
-                    }
-                    break;
-                }
-                case 'P':    // the file made it to the point that the Preview was done
+                if ( sscanf(line, "B%lf\n", &brightness) == 1 )
                 {
-                    //info->FirstRadiosityPass = true;
-                    break;
+                    //info->Brightness = brightness;
                 }
-                case 'C':
-                {
+                break;
+            }
+            case 'P':    // the file made it to the point that the Preview was done
+            {
+                //info->FirstRadiosityPass = true;
+                break;
+            }
+            case 'O':    // bounding box of an object in the scene the file was written for
+            case 'L':    // parameters of a light source in the scene the file was written for
+            {
+                records.push_back(std::string(line));
+                break;
+            }
+            case 'C':
+            {
 #if (NUM_COLOUR_CHANNELS == 3)
-                    RGBColour tempCol;
-                    count = sscanf(line, "C%d %lf %lf %lf %s %f %f %f %lf %lf %s\n", // tw
-                        &depth,
-                        &point[X], &point[Y], &point[Z],
-                        normal_string,
-                        &tempCol.red(), &tempCol.green(), &tempCol.blue(),
-                        &harmonic_mean,
-                        &nearest, to_nearest_string
-                    );
-                    illuminance = ToMathColour(tempCol);
+                RGBColour tempCol;
+                count = sscanf(line, "C%d %lf %lf %lf %s %f %f %f %lf %lf %s\n", // tw
+                    &sample.bounceDepth,
+                    &sample.point[X], &sample.point[Y], &sample.point[Z],
+                    normal_string,
+                    &tempCol.red(), &tempCol.green(), &tempCol.blue(),
+                    &sample.harmonicMeanDistance,
+                    &sample.nearestDistance, to_nearest_string
+                );
+                sample.illuminance = ToMathColour(tempCol);
 #else
-                    #error "TODO!"
+                #error "TODO!"
 #endif
-                    if ( count == 11 )
-                    {
-                        depth = depth - 1; // file format still uses 1-based bounce depth counting
+                if ( count == 11 )
+                {
+                    sample.bounceDepth = sample.bounceDepth - 1; // file format still uses 1-based bounce depth counting
+
+                    // normals aren't very critical for direction precision, so they are packed
+                    sscanf(normal_string, "%02x%02x%02x", &tx, &ty, &tz);
+                    sample.normal[X] = ((double)tx * (1./ 254.))*2.-1.;
+                    sample.normal[Y] = ((double)ty * (1./ 254.))*2.-1.;
+                    sample.normal[Z] = ((double)tz * (1./ 254.))*2.-1.;
+                    sample.normal.normalize();
+
+                    sscanf(to_nearest_string, "%02x%02x%02x", &tx, &ty, &tz);
+                    sample.toNearestSurface[X] = ((double)tx * (1./ 254.))*2.-1.;
+                    sample.toNearestSurface[Y] = ((double)ty * (1./ 254.))*2.-1.;
+                    sample.toNearestSurface[Z] = ((double)tz * (1./ 254.))*2.-1.;
+                    sample.toNearestSurface.normalize();
+
+                    samples.push_back(sample);
+                }
+                break;
+            }
 
-                        // normals aren't very critical for direction precision, so they are packed
-                        sscanf(normal_string, "%02x%02x%02x", &tx, &ty, &tz);
-                        normal[X] = ((double)tx * (1./ 254.))*2.-1.;
-                        normal[Y] = ((double)ty * (1./ 254.))*2.-1.;
-                        normal[Z] = ((double)tz * (1./ 254.))*2.-1.;
-                        normal.normalize();
+            default:
+            {
+            // wrong leading character on line, just try again on next line
+            }
 
-                        sscanf(to_nearest_string, "%02x%02x%02x", &tx, &ty, &tz);
-                        to_nearest[X] = ((double)tx * (1./ 254.))*2.-1.;
-                        to_nearest[Y] = ((double)ty * (1./ 254.))*2.-1.;
-                        to_nearest[Z] = ((double)tz * (1./ 254.))*2.-1.;
-                        to_nearest.normalize();
+        } // end switch
+    } // end while-reading loop
 
-                        line_num++;
+    if ( !samples.empty() )
+        ;// TODO MESSAGE         Debug_Info("Reloaded %d values from radiosity cache file.\n", samples.size());
+    else
+        ;// TODO MESSAGE         PossibleError("Unable to read any values from the radiosity cache file.");
 
-                        AddBlock(pool, nullptr, point, normal, 1.0 /* TODO FIXME - brilliance */, to_nearest, dx, dy, dz, illuminance, harmonic_mean, nearest, 1.0 /* TODO FIXME - quality */, depth, PRETRACE_STEP_LOADED, 0);
-                        goodreads++;
-                    }
-                    break;
-                }
+    delete fd;
+    return true;
+}
+
+void RadiosityCache::AddLoadedSamples(const vector<CacheFileSample>& samples)
+{
+    MathColour dx, dy, dz;
+    BlockPool* pool = AcquireBlockPool();
+    for (vector<CacheFileSample>::const_iterator i = samples.begin(); i != samples.end(); ++i)
+        AddBlock(pool, nullptr, i->point, i->normal, 1.0 /* TODO FIXME - brilliance */, i->toNearestSurface, dx, dy, dz, i->illuminance,
+                 i->harmonicMeanDistance, i->nearestDistance, 1.0 /* TODO FIXME - quality */, i->bounceDepth, PRETRACE_STEP_LOADED, 0);
+    ReleaseBlockPool(pool);
+}
+
+bool RadiosityCache::Load(const Path& inputFile)
+{
+    vector<CacheFileSample> samples;
+    vector<std::string> records;
+    if (!ReadCacheFile(inputFile, samples, records))
+        return false;
+    AddLoadedSamples(samples);
+    return true;
+}
+
+int RadiosityCache::LoadIncremental(const Path& cacheFile, const SceneData& scene)
+{
+    char line[RADIOSITY_CACHE_LINE_LENGTH];
+
+    // describe the current scene by the bounding boxes of its top-level objects and the parameters of its light sources
+    vector<std::string> sceneRecords;
+    for (vector<ObjectPtr>::const_iterator i = scene.objects.begin(); i != scene.objects.end(); ++i)
+    {
+        const BoundingBox& bbox = (*i)->BBox;
+        sprintf(line, "O%.7g %.7g %.7g %.7g %.7g %.7g",
+                bbox.lowerLeft[X], bbox.lowerLeft[Y], bbox.lowerLeft[Z], bbox.size[X], bbox.size[Y], bbox.size[Z]);
+        sceneRecords.push_back(std::string(line));
+    }
+    for (vector<LightSource *>::const_iterator i = scene.lightSources.begin(); i != scene.lightSources.end(); ++i)
+    {
+        const LightSource* light = *i;
+        RGBColour lightColour = ToRGBColour(light->colour);
+        sprintf(line, "L%.7g %.7g %.7g %.7g %.7g %.7g",
+                light->Center[X], light->Center[Y], light->Center[Z], light->Direction[X], light->Direction[Y], light->Direction[Z]);
+        sceneRecords.push_back(std::string(line));
+        sprintf(line, "L%.7g %.7g %.7g %.7g %.7g %.7g",
+                lightColour.red(), lightColour.green(), lightColour.blue(), light->Radius, light->Falloff, light->Coeff);
+        sceneRecords.push_back(std::string(line));
+    }
+    std::sort(sceneRecords.begin(), sceneRecords.end());
 
-                default:
+    vector<CacheFileSample> fileSamples;
+    vector<std::string> fileRecords;
+    vector<CacheFileSample> keptSamples;
+    if (ReadCacheFile(cacheFile, fileSamples, fileRecords) && !fileRecords.empty())
+    {
+        std::sort(fileRecords.begin(), fileRecords.end());
+        vector<std::string> changedRecords;
+        std::set_symmetric_difference(fileRecords.begin(), fileRecords.end(), sceneRecords.begin(), sceneRecords.end(),
+                                      std::back_inserter(changedRecords));
+
+        // any change in lighting may affect indirect illumination anywhere, so only objects are checked individually
+        bool lightsChanged = false;
+        vector<BoundingBox> changedBoxes;
+        for (vector<std::string>::const_iterator i = changedRecords.begin(); i != changedRecords.end(); ++i)
+        {
+            double llx, lly, llz, sx, sy, sz;
+            if ((*i)[0] == 'O' && sscanf(i->c_str(), "O%lf %lf %lf %lf %lf %lf", &llx, &lly, &llz, &sx, &sy, &sz) == 6)
+            {
+                BoundingBox box;
+                Make_BBox(box, llx, lly, llz, sx, sy, sz);
+                changedBoxes.push_back(box);
+            }
+            else
+                lightsChanged = true;
+        }
+
+        if (!lightsChanged)
+        {
+            // keep samples unless an object that has appeared, moved or vanished is close compared to the sample's own
+            // area of influence
+            for (vector<CacheFileSample>::const_iterator i = fileSamples.begin(); i != fileSamples.end(); ++i)
+            {
+                DBL limit = RADIOSITY_CHANGE_DISTANCE_FACTOR * i->harmonicMeanDistance;
+                bool keep = true;
+                for (vector<BoundingBox>::const_iterator box = changedBoxes.begin(); keep && (box != changedBoxes.end()); ++box)
                 {
-                // wrong leading character on line, just try again on next line
+                    Vector3d lo(box->lowerLeft), hi(box->lowerLeft + box->size);
+                    Vector3d offset(max(max(lo[X] - i->point[X], i->point[X] - hi[X]), 0.0),
+                                    max(max(lo[Y] - i->point[Y], i->point[Y] - hi[Y]), 0.0),
+                                    max(max(lo[Z] - i->point[Z], i->point[Z] - hi[Z]), 0.0));
+                    keep = (offset.length() >= limit);
                 }
+                if (keep)
+                    keptSamples.push_back(*i);
+            }
+        }
+    }
 
-            } // end switch
-        } // end while-reading loop
-
-        if ( goodreads > 0 )
-            ;// TODO MESSAGE         Debug_Info("Reloaded %d values from radiosity cache file.\n", goodreads);
-        else
-            ;// TODO MESSAGE         PossibleError("Unable to read any values from the radiosity cache file.");
-        ok = true;
+    // rewrite the file for the current scene; samples kept are saved again as they are added, followed by any new ones
+    ot_fd = NewOStream(cacheFile, POV_File_Data_RCA, false);
+    if (ot_fd != nullptr)
+    {
+        for (vector<std::string>::const_iterator i = sceneRecords.begin(); i != sceneRecords.end(); ++i)
+            ot_fd->printf("%s\n", i->c_str());
+    }
+    AddLoadedSamples(keptSamples);
 
-        ReleaseBlockPool(pool);
+    return keptSamples.size();
+}
 
-        delete fd;
+int RadiosityCache::Merge(const Path& inputFile)
+{
+    vector<CacheFileSample> samples;
+    vector<std::string> records;
+    if (!ReadCacheFile(inputFile, samples, records))
+        return -1;
+
+    MathColour dx, dy, dz;
+    int added = 0;
+    BlockPool* pool = AcquireBlockPool();
+    for (vector<CacheFileSample>::const_iterator i = samples.begin(); i != samples.end(); ++i)
+    {
+        // samples are inserted as we go, so this also catches duplicates within the file itself
+        DUPLICATE_SEARCH search;
+        search.P = i->point;
+        search.N = i->normal;
+        search.MaxDistance = RADIOSITY_MERGE_DISTANCE_FACTOR * i->harmonicMeanDistance;
+        search.Found = false;
+        TraverseNearBlocks(i->point, i->bounceDepth, FindDuplicateBlock, reinterpret_cast<void *>(&search));
+        if (search.Found)
+            continue;
+        AddBlock(pool, nullptr, i->point, i->normal, 1.0 /* TODO FIXME - brilliance */, i->toNearestSurface, dx, dy, dz, i->illuminance,
+                 i->harmonicMeanDistance, i->nearestDistance, 1.0 /* TODO FIXME - quality */, i->bounceDepth, PRETRACE_STEP_LOADED, 0);
+        added ++;
     }
-    return ok;
+    ReleaseBlockPool(pool);
+
+    return added;
 }
 
 void RadiosityCache::InitAutosave(const Path& outputFile, bool append)
@@ -1050,7 +1341,6 @@ RadiosityCache::~RadiosityCache()
     { // mutex scope
 #if POV_MULTITHREADED
         boost::mutex::scoped_lock lockTree(octree.treeMutex);
-        boost::mutex::scoped_lock lockBlock(octree.blockMutex);
 #endif
         if (octree.root != nullptr)
             ot_free_tree(&octree.root);
@@ -1212,6 +1502,13 @@ void RadiosityCache::AddBlock(BlockPool* pool, RenderStatistics* stats, const Ve
     block->S_Normal = normal;
     block->next = nullptr;
 
+    if (useSpatialHash)
+    {
+        // the block in the pool is only kept for saving to the cache file
+        spatialHash.Insert(*block, harmonicMeanDistance * recSettings.octreeAddressFactor);
+        return;
+    }
+
     // figure out the block id
     ot_index_sphere(point, harmonicMeanDistance * recSettings.octreeAddressFactor, &id);
 
@@ -1358,6 +1655,12 @@ ot_node_struct *RadiosityCache::GetNode(RenderStatistics* stats, const ot_id_str
     // somewhere.  Go back down the tree to the right level, making new nodes
     // as you go.
 
+#if POV_MULTITHREADED
+    // the root won't change in a way that matters to us anymore, so let other tasks get on with their business
+    if (treeLock.owns_lock())
+        treeLock.unlock();
+#endif
+
     this_node = octree.root; // start at the root
 
     while (this_node->Id.Size > id.Size)
@@ -1386,12 +1689,11 @@ ot_node_struct *RadiosityCache::GetNode(RenderStatistics* stats, const ot_id_str
             // Next level down doesn't exist yet, so create it
 
 #if POV_MULTITHREADED
-            // now is the time to lock the tree for modification, in case we haven't yet
-            if (!treeLock.owns_lock())
-                treeLock.lock();
+            // now is the time to lock the node for modification; other parts of the tree remain open to other tasks
+            boost::mutex::scoped_lock nodeLock(octree.NodeMutex(this_node));
 #endif
 
-            // We may have acquired the lock just now, so some other task may have changed the root since last time we looked
+            // We have acquired the lock just now, so some other task may have created the child since last time we looked
             if (this_node->Kids[index] == nullptr)
             {
                 temp_node = new ot_node_struct;
@@ -1424,13 +1726,99 @@ ot_node_struct *RadiosityCache::GetNode(RenderStatistics* stats, const ot_id_str
 void RadiosityCache::InsertBlock(ot_node_struct *node, ot_block_struct *block)
 {
 #if POV_MULTITHREADED
-    boost::mutex::scoped_lock lock(octree.blockMutex);
+    boost::mutex::scoped_lock lock(octree.NodeMutex(node));
 #endif
 
     block->next = node->Values;
     node->Values = block;
 }
 
+bool RadiosityCache::TraverseNearBlocks(const Vector3d& point, int bounceDepth, bool (*function)(ot_block_struct *block, void *handle1), void *handle2)
+{
+    if (useSpatialHash)
+        return spatialHash.Traverse(point, bounceDepth, function, handle2);
+    else if (octree.root != nullptr)
+        // [CLi] inspection of octree.cpp tree code indicates that tree traversal is perfectly safe
+        // regarding insertions by other threads, so no locking is needed
+        return ot_dist_traverse(octree.root, point, bounceDepth, function, handle2);
+    else
+        return true;
+}
+
+RadiosityCache::SpatialHash::SpatialHash()
+{
+    for (int i = 0; i < RADIOSITY_HASH_LEVELS; i ++)
+        levelUsed[i] = false;
+}
+
+void RadiosityCache::SpatialHash::Insert(const ot_block_struct& block, DBL radius)
+{
+    // choose the finest grid with cells at least as large as the sample's area of influence
+    int level;
+    (void)frexp(2.0 * radius, &level);
+    level = clip(level, RADIOSITY_HASH_LEVEL_MIN, RADIOSITY_HASH_LEVEL_MAX);
+    DBL cellSize = ldexp(1.0, level);
+
+    CellKey lo, hi;
+    lo.x = POV_INT64(floor((block.Point[X] - radius) / cellSize));
+    lo.y = POV_INT64(floor((block.Point[Y] - radius) / cellSize));
+    lo.z = POV_INT64(floor((block.Point[Z] - radius) / cellSize));
+    hi.x = POV_INT64(floor((block.Point[X] + radius) / cellSize));
+    hi.y = POV_INT64(floor((block.Point[Y] + radius) / cellSize));
+    hi.z = POV_INT64(floor((block.Point[Z] + radius) / cellSize));
+
+    CellKey key;
+    key.level = level;
+    key.depth = block.Bounce_Depth;
+    for (key.x = lo.x; key.x <= hi.x; key.x ++)
+    {
+        for (key.y = lo.y; key.y <= hi.y; key.y ++)
+        {
+            for (key.z = lo.z; key.z <= hi.z; key.z ++)
+            {
+                unsigned int index = CellKeyHash()(key) % RADIOSITY_HASH_CELL_LOCKS;
+#if POV_MULTITHREADED
+                boost::mutex::scoped_lock lock(cellMutex[index]);
+#endif
+                cells[index][key].push_back(block);
+            }
+        }
+    }
+
+    levelUsed[level - RADIOSITY_HASH_LEVEL_MIN] = true;
+}
+
+bool RadiosityCache::SpatialHash::Traverse(const Vector3d& point, int bounceDepth, bool (*function)(ot_block_struct *block, void *handle1), void *handle2)
+{
+    CellKey key;
+    key.depth = bounceDepth;
+    for (key.level = RADIOSITY_HASH_LEVEL_MIN; key.level <= RADIOSITY_HASH_LEVEL_MAX; key.level ++)
+    {
+        if (!levelUsed[key.level - RADIOSITY_HASH_LEVEL_MIN])
+            continue;
+
+        DBL cellSize = ldexp(1.0, key.level);
+        key.x = POV_INT64(floor(point[X] / cellSize));
+        key.y = POV_INT64(floor(point[Y] / cellSize));
+        key.z = POV_INT64(floor(point[Z] / cellSize));
+
+        unsigned int index = CellKeyHash()(key) % RADIOSITY_HASH_CELL_LOCKS;
+#if POV_MULTITHREADED
+        boost::mutex::scoped_lock lock(cellMutex[index]);
+#endif
+        CellMap::iterator cell = cells[index].find(key);
+        if (cell == cells[index].end())
+            continue;
+        for (vector<ot_block_struct>::iterator block = cell->second.begin(); block != cell->second.end(); ++block)
+        {
+            if (!function(&(*block), handle2))
+                return false;
+        }
+    }
+
+    return true;
+}
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1460,7 +1848,7 @@ void RadiosityCache::InsertBlock(ot_node_struct *node, ot_block_struct *block)
 
 DBL RadiosityCache::FindReusableBlock(RenderStatistics& stats, DBL errorbound, const Vector3d& ipoint, const Vector3d& snormal, DBL brilliance, MathColour& illuminance, int recursionDepth, int pretraceStep, int tileId)
 {
-    if (octree.root != nullptr)
+    if (useSpatialHash || (octree.root != nullptr))
     {
         WT_AVG gather;
 
@@ -1486,10 +1874,8 @@ DBL RadiosityCache::FindReusableBlock(RenderStatistics& stats, DBL errorbound, c
         gather.AcceptEpsilon_Count = 0;
 #endif
 
-        // Go through the tree calculating a weighted average of all of the usable points near this one
-        // [CLi] inspection of octree.cpp tree code indicates that tree traversal is perfectly safe
-        // regarding insertions by other threads, so no locking is needed
-        ot_dist_traverse(octree.root, ipoint, recursionDepth, AverageNearBlock, reinterpret_cast<void *>(&gather));
+        // Go through the cache calculating a weighted average of all of the usable points near this one
+        TraverseNearBlocks(ipoint, recursionDepth, AverageNearBlock, reinterpret_cast<void *>(&gather));
 
 #ifdef OCTREE_PERFORMANCE_DEBUG
         stats[Radiosity_OctreeLookups]  += gather.Lookup_Count;
@@ -1771,4 +2157,19 @@ bool RadiosityCache::AverageNearBlock(ot_block_struct *block, void *void_info)
     return true;
 }
 
+// Tree traversal function used by Merge() to detect samples already present in the cache
+bool RadiosityCache::FindDuplicateBlock(ot_block_struct *block, void *void_info)
+{
+    DUPLICATE_SEARCH *info = reinterpret_cast<DUPLICATE_SEARCH *>(void_info);
+
+    if ((dot(block->S_Normal, info->N) >= RADIOSITY_MERGE_NORMAL_COS) &&
+        ((block->Point - info->P).length() <= min(info->MaxDistance, RADIOSITY_MERGE_DISTANCE_FACTOR * block->Harmonic_Mean_Distance)))
+    {
+        info->Found = true;
+        return false; // no need to look any further
+    }
+
+    return true;
+}
+
 } // end of namespace
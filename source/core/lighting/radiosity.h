@@ -43,11 +43,13 @@
 
 #if POV_MULTITHREADED
 #include <boost/thread.hpp>
+#include <boost/unordered_map.hpp>
 #endif
 
 #include "core/lighting/photons.h" // TODO FIXME - make PhotonGatherer class visible only as a pointer
 #include "core/material/media.h"   // TODO FIXME - make MediaFunction class visible only as a pointer
 #include "core/math/randcosweighted.h"
+#include "core/math/randomsequence.h"
 #include "core/render/trace.h"     // TODO FIXME - make Trace class visible only as a pointer
 #include "core/support/octree.h"   // TODO FIXME - this should only be included in radiosity.cpp
 #include "core/support/statistics.h"
@@ -75,7 +77,25 @@ struct ot_id_struct;
 
 #define RADIOSITY_CACHE_EXTENSION ".rca"
 
+// number of locks the nodes of the radiosity cache octree are distributed among;
+// a prime, so that the addresses of the nodes spread evenly across them
+static const unsigned int RADIOSITY_OCTREE_NODE_LOCKS = 67;
+
+// number of locks (and separate hash tables) the cells of the radiosity cache spatial hash are distributed among
+static const unsigned int RADIOSITY_HASH_CELL_LOCKS = 67;
+
+// range of cell sizes (as powers of two) used by the radiosity cache spatial hash
+static const int RADIOSITY_HASH_LEVEL_MIN = -24;
+static const int RADIOSITY_HASH_LEVEL_MAX = 39;
+static const int RADIOSITY_HASH_LEVELS    = RADIOSITY_HASH_LEVEL_MAX - RADIOSITY_HASH_LEVEL_MIN + 1;
+
+// radiosity cache data structures, as selected by `method` in the scene file
+static const int RADIOSITY_CACHE_OCTREE       = 1;
+static const int RADIOSITY_CACHE_SPATIAL_HASH = 2;
+
 static const unsigned int RADIOSITY_MAX_SAMPLE_DIRECTIONS    = kRandCosWeightedCount;
+// number of sample directions transformed into the local co-ordinate frame in one go
+static const unsigned int RADIOSITY_DIRECTION_BATCH          = 64;
 // to get some more pseudo-randomness and make use of the full range of all the precomputed sample directions,
 // we start each sample direction sequence at a different index than the previous one; 663 has some nice properties
 // for this:
@@ -136,6 +156,7 @@ class SceneRadiositySettings
         float   defaultImportance;
         bool    subsurface;                 // whether to use subsurface scattering for radiosity sampling rays
         bool    brilliance;                 // whether to respect brilliance in radiosity computations
+        int     cacheMethod;                // data structure to hold the samples in (RADIOSITY_CACHE_OCTREE or RADIOSITY_CACHE_SPATIAL_HASH)
 
         SceneRadiositySettings() {
             radiosityEnabled    = false;
@@ -163,6 +184,7 @@ class SceneRadiositySettings
             defaultImportance   = 1.0;
             subsurface          = false;
             brilliance          = false;
+            cacheMethod         = RADIOSITY_CACHE_OCTREE;
         }
 
         RadiosityRecursionSettings* GetRecursionSettings (bool final) const;
@@ -214,6 +236,18 @@ class RadiosityCache
         bool Load(const Path& inputFile);
         void InitAutosave(const Path& outputFile, bool append);
 
+        /// Update a cache file from the previous frame of an animation for the current one.
+        /// Samples are loaded from the file except near objects whose bounding boxes have changed since
+        /// it was written, or if any light source has changed. The file is then rewritten with the samples
+        /// kept and a description of the current scene, and new samples are appended as with @ref InitAutosave().
+        /// @return     The number of samples kept.
+        int LoadIncremental(const Path& cacheFile, const SceneData& scene);
+
+        /// Add the samples from a partial cache file, such as one written by a pretrace-only render of part of the image.
+        /// Samples duplicating one already in the cache are skipped; samples added are saved as with @ref InitAutosave().
+        /// @return     The number of samples added, or -1 if the file could not be read.
+        int Merge(const Path& inputFile);
+
         DBL FindReusableBlock(RenderStatistics& stats, DBL errorbound, const Vector3d& ipoint, const Vector3d& snormal, DBL brilliance, MathColour& illuminance, int recursionDepth, int pretraceStep, int tileId);
         BlockPool* AcquireBlockPool();
         void AddBlock(BlockPool* pool, RenderStatistics* stats, const Vector3d& Point, const Vector3d& S_Normal, DBL brilliance, const Vector3d& To_Nearest_Surface,
@@ -223,23 +257,87 @@ class RadiosityCache
 
     private:
 
+        struct CacheFileSample
+        {
+            Vector3d point;
+            Vector3d normal;
+            Vector3d toNearestSurface;
+            MathColour illuminance;
+            DBL harmonicMeanDistance;
+            DBL nearestDistance;
+            int bounceDepth;
+        };
+
+        bool ReadCacheFile(const Path& inputFile, vector<CacheFileSample>& samples, vector<std::string>& records);
+        void AddLoadedSamples(const vector<CacheFileSample>& samples);
+
         struct Octree
         {
             ot_node_struct *root;
 #if POV_MULTITHREADED
-            boost::mutex treeMutex;   // lock this when adding nodes to the tree
-            boost::mutex blockMutex;  // lock this when adding blocks to any node of the tree
+            boost::mutex treeMutex;   // lock this when replacing the root of the tree
+            boost::mutex nodeMutex[RADIOSITY_OCTREE_NODE_LOCKS]; // lock the one returned by NodeMutex() when adding children or blocks to a node
+
+            // Each node is guarded by one of a fixed set of locks, so that threads adding to different
+            // parts of the tree rarely contend. Readers traverse the tree without locking, which is safe
+            // as nodes and blocks are fully set up before being linked in, and never unlinked.
+            boost::mutex& NodeMutex(const ot_node_struct *node)
+            {
+                return nodeMutex[(reinterpret_cast<size_t>(node) / sizeof(void*)) % RADIOSITY_OCTREE_NODE_LOCKS];
+            }
 #endif
 
             Octree() : root(nullptr) {}
         };
 
+        // Alternative to the octree: Samples are filed in a set of uniform grids with power-of-two cell sizes,
+        // each sample in the finest grid whose cells are at least as large as its area of influence, and there
+        // in every cell (at most eight) that area overlaps. A lookup thus only needs to scan the one cell
+        // containing the point in each grid level in use, and the samples of a cell are stored contiguously.
+        struct SpatialHash
+        {
+            struct CellKey
+            {
+                POV_INT64 x, y, z;
+                int level;
+                int depth;
+
+                bool operator==(const CellKey& o) const
+                {
+                    return (x == o.x) && (y == o.y) && (z == o.z) && (level == o.level) && (depth == o.depth);
+                }
+            };
+
+            struct CellKeyHash
+            {
+                size_t operator()(const CellKey& key) const
+                {
+                    return size_t((key.x * 73856093) ^ (key.y * 19349663) ^ (key.z * 83492791) ^ (key.level * 2654435761u) ^ (key.depth * 40503));
+                }
+            };
+
+            typedef boost::unordered_map<CellKey, vector<ot_block_struct>, CellKeyHash> CellMap;
+
+            CellMap cells[RADIOSITY_HASH_CELL_LOCKS];   // cells with the same index as their lock
+#if POV_MULTITHREADED
+            boost::mutex cellMutex[RADIOSITY_HASH_CELL_LOCKS]; // lock the one with the cell's hash modulo the count when accessing a cell
+#endif
+            volatile bool levelUsed[RADIOSITY_HASH_LEVELS]; // set once a grid level holds any samples; never reset
+
+            SpatialHash();
+
+            void Insert(const ot_block_struct& block, DBL radius);
+            bool Traverse(const Vector3d& point, int bounceDepth, bool (*function)(ot_block_struct *block, void *handle1), void *handle2);
+        };
+
         vector<BlockPool*> blockPools;  // block pools ready to be re-used
 #if POV_MULTITHREADED
         boost::mutex blockPoolsMutex;   // lock this when accessing blockPools
 #endif
 
         Octree octree;
+        SpatialHash spatialHash;
+        bool useSpatialHash;
 
         OStream *ot_fd;
 #if POV_MULTITHREADED
@@ -250,8 +348,10 @@ class RadiosityCache
 
         void InsertBlock(ot_node_struct* node, ot_block_struct *block);
         ot_node_struct *GetNode(RenderStatistics* stats, const ot_id_struct& id);
+        bool TraverseNearBlocks(const Vector3d& point, int bounceDepth, bool (*function)(ot_block_struct *block, void *handle1), void *handle2);
 
         static bool AverageNearBlock(ot_block_struct *block, void *void_info);
+        static bool FindDuplicateBlock(ot_block_struct *block, void *void_info);
 };
 
 class RadiosityFunction : public Trace::RadiosityFunctor
@@ -292,10 +392,19 @@ class RadiosityFunction : public Trace::RadiosityFunctor
 
         // retrieves top level statistics information to drive pretrace re-iteration
         virtual void GetTopLevelStats(long& queryCount, float& reuse);
+        // retrieves top level statistics information on how the cache is still changing
+        //      gatherCount - (output) number of top level queries that had to take a new sample
+        //      error       - (output) average relative difference between the interpolated and newly
+        //                    gathered illumination, where both were available
+        virtual void GetTopLevelConvergence(long& gatherCount, float& error);
         virtual void ResetTopLevelStats();
         virtual void BeforeTile(int id, unsigned int pts = FINAL_TRACE);
         virtual void AfterTile();
 
+        // scales the number of sample rays to shoot per sample, e.g. to fit a time budget
+        //      scale   - factor to apply to the numbers derived from the radiosity settings
+        void ScaleRaysPerSample(double scale);
+
     private:
 
         class SampleDirectionGenerator
@@ -306,7 +415,9 @@ class RadiosityFunction : public Trace::RadiosityFunctor
                 /// Called before each tile
                 void Reset(unsigned int samplePoolCount);
                 /// Called before each sample
-                void InitSequence(unsigned int& sample_count, const Vector3d& raw_normal, const Vector3d& layer_normal, bool use_raw_normal, DBL brilliance);
+                /// @param[in]  set     Low-discrepancy sample set to draw directions from, or `nullptr` to use the precomputed directions.
+                void InitSequence(unsigned int& sample_count, const Vector3d& raw_normal, const Vector3d& layer_normal, bool use_raw_normal, DBL brilliance,
+                                  const ScrambledSobolSampleSet* set = nullptr);
                 /// Called to get the next sampling ray direction
                 bool GetDirection(Vector3d& direction);
             protected:
@@ -324,8 +435,22 @@ class RadiosityFunction : public Trace::RadiosityFunctor
                 Vector3d frameY;
                 /// direction we'll map the precomputed sample directions' Z axis to
                 Vector3d frameZ;
-                /// Generator for sampling directions
-                SequentialVectorGeneratorPtr sampleDirections;
+                /// precomputed sampling directions in structure-of-arrays layout, with Y already made non-negative
+                vector<DBL> poolX, poolY, poolZ;
+                /// index of the next precomputed sampling direction to use
+                size_t poolIndex;
+                /// whether the current sequence is drawn from a low-discrepancy sample set instead of the precomputed directions
+                bool useSampleSet;
+                /// low-discrepancy sample set of the current sequence
+                ScrambledSobolSampleSet sampleSet;
+                /// index of the next sample to draw from the low-discrepancy sample set
+                unsigned int sampleSetIndex;
+                /// sampling directions already transformed into the local co-ordinate frame
+                DBL batchX[RADIOSITY_DIRECTION_BATCH], batchY[RADIOSITY_DIRECTION_BATCH], batchZ[RADIOSITY_DIRECTION_BATCH];
+                /// number of valid entries in the batch, and index of the next one to use
+                unsigned int batchSize, batchNext;
+                /// Transforms the next batch of precomputed directions into the local co-ordinate frame
+                void FillBatch();
         };
 
         // structure to store precomputed effective parameters for each recursion depth
@@ -358,6 +483,9 @@ class RadiosityFunction : public Trace::RadiosityFunctor
         RecursionParameters*                recursionParameters;    // dynamically allocated array; use recursion depth as index
         long topLevelQueryCount;
         float topLevelReuse;
+        long topLevelGatherCount;
+        long topLevelErrorCount;
+        float topLevelError;
         int tileId;
 
         double GatherLight(const Vector3d& IPoint, const Vector3d& Raw_Normal, const Vector3d& LayNormal, DBL brilliance, MathColour& Illuminance, TraceTicket& ticket);
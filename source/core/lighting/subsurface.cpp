@@ -36,11 +36,19 @@
 // Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
 #include "core/lighting/subsurface.h"
 
+#include <algorithm>
+
 #include "base/mathutil.h"
 
 // this must be the last file included
 #include "base/povdebug.h"
 
+// maximum number of points in an octree leaf of a subsurface point cloud
+#define SUBSURFACE_LEAF_POINTS 8
+
+// maximum depth of the octree of a subsurface point cloud, to cope with coincident points
+#define SUBSURFACE_MAX_DEPTH 32
+
 namespace pov
 {
 
@@ -111,4 +119,170 @@ PreciseMathColour SubsurfaceInterior::GetReducedAlbedo(const MathColour& diffuse
     return result;
 }
 
+SubsurfacePointCloud::Profile::Profile(const PreciseMathColour& sigma_prime_s, const PreciseMathColour& sigma_a, double eta)
+{
+    // see Trace::ComputeDiffuseContribution() for the full BSSRDF model
+    double F_dr = FresnelDiffuseReflectance(eta);
+    double Aconst = ((1 + F_dr) / (1 - F_dr));
+    for (int i = 0; i < MathColour::channels; i ++)
+    {
+        double sigma_prime_t = sigma_prime_s[i] + sigma_a[i];
+        double alpha_prime = sigma_prime_s[i] / sigma_prime_t;
+        sigmaTr[i] = sqrt(3 * sigma_a[i] * sigma_prime_t);
+        zR[i] = 1.0 / sigma_prime_t;
+        zV[i] = zR[i] * (1.0 + Aconst * 4.0/3.0);
+        commonTerm[i] = alpha_prime / (4.0 * M_PI);
+    }
+}
+
+void SubsurfacePointCloud::Profile::Evaluate(double distSqr, MathColour& rd) const
+{
+    for (int i = 0; i < MathColour::channels; i ++)
+    {
+        double dSqr_r = Sqr(zR[i]) + distSqr;
+        double d_r = sqrt(dSqr_r);
+        double dSqr_v = Sqr(zV[i]) + distSqr;
+        double d_v = sqrt(dSqr_v);
+        double r_term = zR[i] * (sigmaTr[i] + 1.0/d_r) * exp(-sigmaTr[i] * d_r) / dSqr_r;
+        double v_term = zV[i] * (sigmaTr[i] + 1.0/d_v) * exp(-sigmaTr[i] * d_v) / dSqr_v;
+        rd[i] = commonTerm[i] * (r_term + v_term);
+    }
+}
+
+SubsurfacePointCloud::SubsurfacePointCloud(vector<Point>& pts)
+{
+    points.swap(pts);
+    if (!points.empty())
+        BuildNode(0, points.size(), 0);
+}
+
+int SubsurfacePointCloud::BuildNode(size_t firstPoint, size_t pointCount, int depth)
+{
+    int index = nodes.size();
+    nodes.push_back(Node());
+
+    Node node;
+    node.firstPoint = firstPoint;
+    node.pointCount = pointCount;
+    node.lowerLeft = node.upperRight = points[firstPoint].position;
+    node.centre = Vector3d(0.0);
+    double area = 0.0;
+    for (size_t i = firstPoint; i < firstPoint + pointCount; i ++)
+    {
+        const Point& point = points[i];
+        node.lowerLeft  = min(node.lowerLeft,  point.position);
+        node.upperRight = max(node.upperRight, point.position);
+        node.centre += point.position * point.area;
+        node.power += point.irradiance * point.area;
+        area += point.area;
+    }
+    node.centre /= area;
+    node.radius = (node.upperRight - node.lowerLeft).length() * 0.5;
+    for (int i = 0; i < 8; i ++)
+        node.child[i] = NoChild;
+
+    if ((pointCount > SUBSURFACE_LEAF_POINTS) && (depth < SUBSURFACE_MAX_DEPTH))
+    {
+        // sort the points into octants around the centre of the bounding box
+        Vector3d mid = (node.lowerLeft + node.upperRight) * 0.5;
+        size_t octantStart[9];
+        size_t first = firstPoint;
+        for (int octant = 0; octant < 8; octant ++)
+        {
+            octantStart[octant] = first;
+            for (size_t i = first; i < firstPoint + pointCount; i ++)
+            {
+                const Vector3d& p = points[i].position;
+                int pointOctant = ((p[X] > mid[X]) ? 1 : 0) | ((p[Y] > mid[Y]) ? 2 : 0) | ((p[Z] > mid[Z]) ? 4 : 0);
+                if (pointOctant == octant)
+                    std::swap(points[i], points[first ++]);
+            }
+        }
+        octantStart[8] = first;
+
+        for (int octant = 0; octant < 8; octant ++)
+        {
+            size_t count = octantStart[octant + 1] - octantStart[octant];
+            if (count > 0)
+                node.child[octant] = BuildNode(octantStart[octant], count, depth + 1);
+        }
+    }
+
+    nodes[index] = node;
+    return index;
+}
+
+void SubsurfacePointCloud::Evaluate(const Vector3d& position, double mmPerUnit, const Profile& profile, double accuracy, MathColour& result) const
+{
+    result.Clear();
+    if (!nodes.empty())
+        EvaluateNode(nodes[0], position, Sqr(mmPerUnit), profile, accuracy, result);
+}
+
+void SubsurfacePointCloud::EvaluateNode(const Node& node, const Vector3d& position, double mmPerUnitSqr, const Profile& profile, double accuracy, MathColour& result) const
+{
+    MathColour rd;
+    bool isLeaf = true;
+    for (int i = 0; i < 8; i ++)
+        isLeaf = isLeaf && (node.child[i] == NoChild);
+
+    if (!isLeaf)
+    {
+        double distSqr = (position - node.centre).lengthSqr();
+        bool inside = (position[X] >= node.lowerLeft[X]) && (position[X] <= node.upperRight[X]) &&
+                      (position[Y] >= node.lowerLeft[Y]) && (position[Y] <= node.upperRight[Y]) &&
+                      (position[Z] >= node.lowerLeft[Z]) && (position[Z] <= node.upperRight[Z]);
+        if (!inside && (Sqr(node.radius) < Sqr(accuracy) * distSqr))
+        {
+            // far enough away to treat the whole subtree as a single point
+            profile.Evaluate(distSqr * mmPerUnitSqr, rd);
+            result += rd * node.power;
+        }
+        else
+        {
+            for (int i = 0; i < 8; i ++)
+            {
+                if (node.child[i] != NoChild)
+                    EvaluateNode(nodes[node.child[i]], position, mmPerUnitSqr, profile, accuracy, result);
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = node.firstPoint; i < node.firstPoint + node.pointCount; i ++)
+        {
+            const Point& point = points[i];
+            profile.Evaluate((position - point.position).lengthSqr() * mmPerUnitSqr, rd);
+            result += rd * point.irradiance * point.area;
+        }
+    }
+}
+
+SubsurfacePointClouds::~SubsurfacePointClouds()
+{
+    for (std::map<const Interior*, SubsurfacePointCloud*>::iterator i = clouds.begin(); i != clouds.end(); ++i)
+        delete i->second;
+}
+
+const SubsurfacePointCloud* SubsurfacePointClouds::Get(const Interior* interior, const Generator& generator)
+{
+    // The lock is held while generating, so that other threads wait for the point cloud rather than doing the
+    // same work. Generating may take us back here for another material, hence the recursive mutex; when it takes
+    // us back here for the same material, we find the null entry and the caller has to make do without.
+#if POV_MULTITHREADED
+    boost::recursive_mutex::scoped_lock lock(cloudsMutex);
+#endif
+
+    std::map<const Interior*, SubsurfacePointCloud*>::iterator i = clouds.find(interior);
+    if (i != clouds.end())
+        return i->second;
+
+    clouds[interior] = nullptr;
+    vector<SubsurfacePointCloud::Point> points;
+    generator(points);
+    SubsurfacePointCloud* cloud = new SubsurfacePointCloud(points);
+    clouds[interior] = cloud;
+    return cloud;
+}
+
 } // end of namespace
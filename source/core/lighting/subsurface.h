@@ -39,8 +39,12 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include <map>
+
 #include <boost/flyweight.hpp>
 #include <boost/flyweight/key_value.hpp>
+#include <boost/function.hpp>
+#include <boost/thread.hpp>
 
 #include "core/coretypes.h"
 
@@ -79,6 +83,101 @@ class SubsurfaceInterior {
         flyweight<key_value<float,PrecomputedReducedAlbedo> > precomputedReducedAlbedo;
 };
 
+/// Subsurface scattering computation methods, as selected by `method` in the global settings.
+static const int SUBSURFACE_METHOD_PROBE        = 1; ///< Probe rays at every shading point.
+static const int SUBSURFACE_METHOD_POINT_CLOUD  = 2; ///< Precomputed irradiance point cloud, evaluated hierarchically.
+
+/// Irradiance samples over the surfaces of a subsurface scattering material.
+///
+/// Implements the hierarchical evaluation of the diffusion term after Jensen and Buhler, "A Rapid Hierarchical
+/// Rendering Technique for Translucent Materials" (2002): The irradiance is computed once for a set of points
+/// distributed evenly across the surfaces, which are organized in an octree; the light diffusing to a shading
+/// point is then summed up from the individual points nearby, and from the aggregate of entire subtrees further
+/// away.
+///
+class SubsurfacePointCloud
+{
+    public:
+
+        struct Point
+        {
+            Vector3d    position;
+            double      area;       ///< Surface area represented by the point, in mm^2.
+            MathColour  irradiance; ///< Irradiance entering the surface at the point, after Fresnel transmittance.
+        };
+
+        /// Diffuse reflectance profile of a particular material, using the dipole approximation.
+        class Profile
+        {
+            public:
+                Profile(const PreciseMathColour& sigma_prime_s, const PreciseMathColour& sigma_a, double eta);
+                /// Computes the diffuse reflectance for a given squared distance (in mm^2) between the points of entry and exit.
+                void Evaluate(double distSqr, MathColour& rd) const;
+            protected:
+                double sigmaTr[MathColour::channels];
+                double zR[MathColour::channels];
+                double zV[MathColour::channels];
+                double commonTerm[MathColour::channels];
+        };
+
+        /// Organizes the points in an octree, taking over the contents of the vector.
+        SubsurfacePointCloud(vector<Point>& points);
+
+        bool IsEmpty() const { return points.empty(); }
+
+        /// Computes the light leaving the surface at a point due to diffusion, before Fresnel transmittance.
+        /// @param[in]  position    Point of exit.
+        /// @param[in]  mmPerUnit   Scale of the scene.
+        /// @param[in]  profile     Diffuse reflectance profile of the material at the point of exit.
+        /// @param[in]  accuracy    Maximum ratio of a subtree's size to its distance for it to be evaluated in aggregate.
+        /// @param[out] result      Computed radiant exitance.
+        void Evaluate(const Vector3d& position, double mmPerUnit, const Profile& profile, double accuracy, MathColour& result) const;
+
+    protected:
+
+        static const int NoChild = -1;
+
+        struct Node
+        {
+            Vector3d    lowerLeft;  ///< Lower left corner of the points' bounding box.
+            Vector3d    upperRight; ///< Upper right corner of the points' bounding box.
+            Vector3d    centre;     ///< Area-weighted mean position of the points.
+            double      radius;     ///< Half the diagonal of the bounding box.
+            MathColour  power;      ///< Sum of irradiance times area of the points.
+            int         child[8];   ///< Indices of the child nodes, or NoChild.
+            size_t      firstPoint; ///< Index of the first point in the subtree.
+            size_t      pointCount; ///< Number of points in the subtree.
+        };
+
+        vector<Point>   points;
+        vector<Node>    nodes;
+
+        int BuildNode(size_t firstPoint, size_t pointCount, int depth);
+        void EvaluateNode(const Node& node, const Vector3d& position, double mmPerUnitSqr, const Profile& profile, double accuracy, MathColour& result) const;
+};
+
+/// Irradiance point clouds for the subsurface scattering materials of a scene, built on demand.
+class SubsurfacePointClouds
+{
+    public:
+
+        typedef boost::function<void(vector<SubsurfacePointCloud::Point>&)> Generator;
+
+        ~SubsurfacePointClouds();
+
+        /// Gets the point cloud for an interior, generating it first if necessary.
+        /// Other threads asking for any point cloud wait while one is generated.
+        /// @return     The point cloud, or `nullptr` if it is being generated by the calling thread itself.
+        const SubsurfacePointCloud* Get(const Interior* interior, const Generator& generator);
+
+    protected:
+
+        std::map<const Interior*, SubsurfacePointCloud*> clouds; ///< Point clouds, or `nullptr` while being generated.
+#if POV_MULTITHREADED
+        boost::recursive_mutex cloudsMutex;
+#endif
+};
+
 /// Approximation to the Fresnel diffuse reflectance.
 inline double FresnelDiffuseReflectance(double eta)
 {
@@ -39,11 +39,14 @@
 #include <algorithm>
 
 #include "core/lighting/lightsource.h"
+#include "core/lighting/lighttree.h"
 #include "core/lighting/photons.h"
 #include "core/material/pattern.h"
 #include "core/material/pigment.h"
 #include "core/math/chi2.h"
+#include "core/math/randomsequence.h"
 #include "core/render/ray.h"
+#include "core/scene/scenedata.h"
 #include "core/scene/tracethreaddata.h"
 
 // this must be the last file included
@@ -86,6 +89,8 @@ Media::Media()
     AA_Threshold = 0.1;
     AA_Level = 3;
     Jitter = 0.0;
+
+    Density_Grid_Resolution = 0;
 }
 
 Media::Media(const Media& source)
@@ -131,6 +136,8 @@ Media& Media::operator=(const Media& source)
         Variance = source.Variance;
         AA_Threshold = source.AA_Threshold;
         AA_Level = source.AA_Level;
+        Density_Grid_Resolution = source.Density_Grid_Resolution;
+        Density_Grid = source.Density_Grid;
 
         if (Sample_Threshold != nullptr)
             delete[] Sample_Threshold;
@@ -161,6 +168,9 @@ Media& Media::operator=(const Media& source)
 void Media::Transform(const TRANSFORM *Trans)
 {
     Transform_Density(Density, Trans);
+
+    // any baked density no longer matches
+    Density_Grid.reset();
 }
 
 void Media::PostProcess()
@@ -206,12 +216,216 @@ void Media::PostProcess()
         Post_Pigment(*i);
 }
 
+void Media::BakeDensity(const Vector3d& lowerLeft, const Vector3d& upperRight, TraceThreadData *ttd)
+{
+    if ((Density_Grid_Resolution <= 0) || is_constant || (Density_Grid != nullptr))
+        return;
+
+    Vector3d size = upperRight - lowerLeft;
+    if ((size[X] < 0.0) || (size[Y] < 0.0) || (size[Z] < 0.0) || (max(size[X], max(size[Y], size[Z])) <= 0.0))
+        return;
+
+    Density_Grid = shared_ptr<MediaDensityGrid>(new MediaDensityGrid(Density, lowerLeft, upperRight, Density_Grid_Resolution, ttd));
+}
+
 void Transform_Density(vector<PIGMENT*>& Density, const TRANSFORM *Trans)
 {
     for (vector<PIGMENT*>::iterator i = Density.begin(); i != Density.end(); ++ i)
         Transform_Tpattern(*i, Trans);
 }
 
+MediaDensityGrid::MediaDensityGrid(vector<PIGMENT*>& density, const Vector3d& ll, const Vector3d& ur, int resolution, TraceThreadData *ttd) :
+    lowerLeft(ll)
+{
+    Vector3d size = ur - ll;
+    Vector3d cellSize;
+    double maxSize = max(size[X], max(size[Y], size[Z]));
+
+    for (int j = X; j <= Z; j++)
+    {
+        cells[j] = max(1, (int)ceil(resolution * size[j] / maxSize));
+        cellSize[j] = size[j] / cells[j];
+        cellsPerUnit[j] = (size[j] > 0.0 ? cells[j] / size[j] : 0.0);
+        bricks[j] = (cells[j] + BrickSize - 1) / BrickSize;
+    }
+
+    brickData.resize(bricks[X] * bricks[Y] * bricks[Z]);
+
+    vector<MathColour> samples(BrickSamples * BrickSamples * BrickSamples);
+    vector<Brick>::iterator brick = brickData.begin();
+
+    for (int bz = 0; bz < bricks[Z]; bz++)
+    {
+        for (int by = 0; by < bricks[Y]; by++)
+        {
+            for (int bx = 0; bx < bricks[X]; bx++, brick++)
+            {
+                bool uniform = true;
+                bool empty = true;
+                vector<MathColour>::iterator sample = samples.begin();
+
+                for (int z = 0; z < BrickSamples; z++)
+                {
+                    // vertices beyond the end of the lattice are never looked up; just repeat the last ones
+                    double pz = min(bz * BrickSize + z, cells[Z]) * cellSize[Z];
+                    for (int y = 0; y < BrickSamples; y++)
+                    {
+                        double py = min(by * BrickSize + y, cells[Y]) * cellSize[Y];
+                        for (int x = 0; x < BrickSamples; x++, sample++)
+                        {
+                            double px = min(bx * BrickSize + x, cells[X]) * cellSize[X];
+                            Evaluate_Density_Pigment(density, lowerLeft + Vector3d(px, py, pz), *sample, ttd);
+                            if (uniform && !(*sample - samples.front()).IsNearZero(EPSILON))
+                                uniform = false;
+                            if (empty && !sample->IsNearZero(EPSILON))
+                                empty = false;
+                        }
+                    }
+                }
+
+                brick->empty = empty;
+                if (empty)
+                    brick->uniform.Clear();
+                else
+                {
+                    brick->uniform = samples.front();
+                    if (!uniform)
+                        brick->samples = samples;
+                }
+            }
+        }
+    }
+}
+
+void MediaDensityGrid::Evaluate(const Vector3d& p, MathColour& c) const
+{
+    int brick[3];
+    int local[3];
+    double frac[3];
+
+    for (int j = X; j <= Z; j++)
+    {
+        double x = clip((p[j] - lowerLeft[j]) * cellsPerUnit[j], 0.0, (double)cells[j]);
+        int i = min((int)x, cells[j] - 1);
+        frac[j] = x - i;
+        brick[j] = i / BrickSize;
+        local[j] = i % BrickSize;
+    }
+
+    const Brick& b = brickData[(brick[Z] * bricks[Y] + brick[Y]) * bricks[X] + brick[X]];
+    if (b.samples.empty())
+    {
+        c = b.uniform;
+        return;
+    }
+
+    const int dy = BrickSamples;
+    const int dz = BrickSamples * BrickSamples;
+    const MathColour *s = &b.samples[local[Z] * dz + local[Y] * dy + local[X]];
+
+    MathColour c00 = s[0]       + (s[1]           - s[0])       * frac[X];
+    MathColour c10 = s[dy]      + (s[dy + 1]      - s[dy])      * frac[X];
+    MathColour c01 = s[dz]      + (s[dz + 1]      - s[dz])      * frac[X];
+    MathColour c11 = s[dz + dy] + (s[dz + dy + 1] - s[dz + dy]) * frac[X];
+
+    MathColour c0 = c00 + (c10 - c00) * frac[Y];
+    MathColour c1 = c01 + (c11 - c01) * frac[Y];
+
+    c = c0 + (c1 - c0) * frac[Z];
+}
+
+bool MediaDensityGrid::FindOccupiedSpan(const BasicRay& ray, DBL& s0, DBL& s1) const
+{
+    // work in units of bricks
+    Vector3d origin;
+    Vector3d direction;
+    DBL tEnter = s0;
+    DBL tExit  = s1;
+
+    for (int j = X; j <= Z; j++)
+    {
+        DBL scale = cellsPerUnit[j] / BrickSize;
+        origin[j] = (ray.Origin[j] - lowerLeft[j]) * scale;
+        direction[j] = ray.Direction[j] * scale;
+
+        if (direction[j] != 0.0)
+        {
+            DBL ta = -origin[j] / direction[j];
+            DBL tb = ((DBL)cells[j] / BrickSize - origin[j]) / direction[j];
+            if (ta > tb)
+                std::swap(ta, tb);
+            tEnter = max(tEnter, ta);
+            tExit  = min(tExit,  tb);
+        }
+    }
+
+    if (tEnter >= tExit)
+        return false;
+
+    // step through the bricks along the ray
+    int cell[3];
+    int step[3];
+    DBL tMax[3];
+    DBL tDelta[3];
+    Vector3d p = origin + direction * tEnter;
+
+    for (int j = X; j <= Z; j++)
+    {
+        cell[j] = clip((int)floor(p[j]), 0, bricks[j] - 1);
+        if (direction[j] > 0.0)
+        {
+            step[j]   = 1;
+            tMax[j]   = tEnter + (cell[j] + 1 - p[j]) / direction[j];
+            tDelta[j] = 1.0 / direction[j];
+        }
+        else if (direction[j] < 0.0)
+        {
+            step[j]   = -1;
+            tMax[j]   = tEnter + (cell[j] - p[j]) / direction[j];
+            tDelta[j] = -1.0 / direction[j];
+        }
+        else
+        {
+            step[j]   = 0;
+            tMax[j]   = HUGE_VAL;
+            tDelta[j] = HUGE_VAL;
+        }
+    }
+
+    bool found = false;
+    DBL first = tEnter;
+    DBL last  = tExit;
+
+    for (DBL t = tEnter; t < tExit; )
+    {
+        int axis = (tMax[X] < tMax[Y]) ? ((tMax[X] < tMax[Z]) ? X : Z) : ((tMax[Y] < tMax[Z]) ? Y : Z);
+        DBL tNext = min(tMax[axis], tExit);
+
+        if (!brickData[(cell[Z] * bricks[Y] + cell[Y]) * bricks[X] + cell[X]].empty)
+        {
+            if (!found)
+                first = t;
+            found = true;
+            last = tNext;
+        }
+
+        cell[axis] += step[axis];
+        if ((cell[axis] < 0) || (cell[axis] >= bricks[axis]))
+            break;
+
+        t = tNext;
+        tMax[axis] += tDelta[axis];
+    }
+
+    if (found)
+    {
+        s0 = first;
+        s1 = last;
+    }
+
+    return found;
+}
+
 MediaFunction::MediaFunction(TraceThreadData *td, Trace *t, PhotonGatherer *pg) :
     randomNumbers(0.0, 1.0, 32768),
     randomNumberGenerator(&randomNumbers),
@@ -338,6 +552,19 @@ void MediaFunction::ComputeMedia(MediaVector& medias, const Ray& ray, Intersecti
                                  isect.Depth - mediaintervals.back().s1,
                                  0, 0));
 
+    // Leap over the parts of the ray where all densities are known to be zero.
+    DBL occupied0 = 0.0;
+    DBL occupied1 = isect.Depth;
+    if(ComputeMediaOccupiedSpan(medias, ray, occupied0, occupied1))
+    {
+        for(MediaIntervalVector::iterator i(mediaintervals.begin()); i != mediaintervals.end(); i++)
+        {
+            i->s0 = max(i->s0, occupied0);
+            i->s1 = max(i->s0, min(i->s1, occupied1));
+            i->ds = i->s1 - i->s0;
+        }
+    }
+
     minSamples = IMedia->Min_Samples;
 
     // Sample all intervals.
@@ -358,37 +585,61 @@ void MediaFunction::ComputeMediaRegularSampling(MediaVector& medias, LightSource
     DBL d0;
     MathColour C0;
     MathColour od0;
+    MathColour od;
+    MediaIntervalVector::iterator last(mediaintervals.end());
+    bool useSampler = (threadData->GetSceneData()->samplingMethod == kSamplingMethod_Sobol);
 
     threadData->Stats()[Media_Intervals] += mediaintervals.size();
     for(MediaIntervalVector::iterator i(mediaintervals.begin()); i != mediaintervals.end(); i++)
     {
+        // Skip empty space.
+        if(i->ds <= 0.0)
+        {
+            i->samples = 1;
+            continue;
+        }
+
         // Sample current interval.
 
+        ScrambledSobolSampleSet sampleSet;
+        if(useSampler)
+            sampleSet = threadData->sampler.NewSet(kSamplerStream_Media);
+
         for(j = 0; j < minsamples; j++)
         {
             if(IMedia->Sample_Method == 2)
             {
-                d0 = (j + 0.5) / minsamples + (randomNumberGenerator() * IMedia->Jitter / minsamples);
+                d0 = (j + 0.5) / minsamples + ((useSampler ? sampleSet.Get1d(j) : randomNumberGenerator()) * IMedia->Jitter / minsamples);
                 ComputeOneMediaSample(medias, lights, *i, ray, d0, C0, od0, 2, ignore_photons, use_scattering, false);
             }
             else
             {
                 // we may get here with media method 3
-                d0 = randomNumberGenerator();
+                d0 = (useSampler ? sampleSet.Get1d(j) : randomNumberGenerator());
                 ComputeOneMediaSample(medias, lights, *i, ray, d0, C0, od0, 1, ignore_photons, use_scattering, false);
             }
 
             if(all_constant_and_light_ray)
                 j = minsamples;
         }
+
+        // Stop once hardly anything shines through from further down the ray.
+        od += i->od / (DBL)i->samples;
+        if(Exp(-od).WeightMax() < ray.GetTicket().adcBailout)
+        {
+            last = i + 1;
+            for(MediaIntervalVector::iterator k(last); k != mediaintervals.end(); k++)
+                k->samples = 1;
+            break;
+        }
     }
 
     // Cast additional samples if necessary.
     if((!ray.IsShadowTestRay()) && (IMedia->Max_Samples > minsamples))
     {
-        for(MediaIntervalVector::iterator i(mediaintervals.begin()); i != mediaintervals.end(); i++)
+        for(MediaIntervalVector::iterator i(mediaintervals.begin()); i != last; i++)
         {
-            if(i->samples < IMedia->Max_Samples)
+            if((i->samples < IMedia->Max_Samples) && (i->ds > 0.0))
             {
                 // Get variance of samples.
                 n = 1.0 / (DBL)i->samples;
@@ -425,9 +676,20 @@ void MediaFunction::ComputeMediaAdaptiveSampling(MediaVector& medias, LightSourc
     MathColour C0, C1, Result;
     MathColour ODResult;
     MathColour od0, od1;
+    MathColour od;
+    bool opaque = false;
+    bool useSampler = (threadData->GetSceneData()->samplingMethod == kSamplingMethod_Sobol);
+    ScrambledSobolSampleSet sampleSet;
 
     for(MediaIntervalVector::iterator i(mediaintervals.begin()); i != mediaintervals.end(); i++)
     {
+        // Skip empty space, as well as anything hidden behind opaque media.
+        if(opaque || (i->ds <= 0.0))
+        {
+            i->samples = 1;
+            continue;
+        }
+
         // Sample current interval.
 
         threadData->Stats()[Media_Intervals]++;
@@ -440,7 +702,12 @@ void MediaFunction::ComputeMediaAdaptiveSampling(MediaVector& medias, LightSourc
 
         dd = 1.0 / (DBL)subIntervalCount;
 
-        ComputeOneMediaSample(medias, lights, *i, ray, dd * IMedia->Jitter * (randomNumberGenerator() - 0.5), C0, od0, 3, ignore_photons, use_scattering, false);
+        // With the low-discrepancy sampler, the sub-interval end points are jittered from a stratified set;
+        // the recursive subdivision keeps jittering randomly.
+        if(useSampler)
+            sampleSet = threadData->sampler.NewSet(kSamplerStream_Media);
+
+        ComputeOneMediaSample(medias, lights, *i, ray, dd * IMedia->Jitter * ((useSampler ? sampleSet.Get1d(0) : randomNumberGenerator()) - 0.5), C0, od0, 3, ignore_photons, use_scattering, false);
 
         // clear out od & te
         i->te.Clear();
@@ -450,7 +717,7 @@ void MediaFunction::ComputeMediaAdaptiveSampling(MediaVector& medias, LightSourc
         for(j = 1; j <= subIntervalCount; j++)
         {
             d1 = d0 + dd;
-            ComputeOneMediaSample(medias, lights, *i, ray, d1 + dd * IMedia->Jitter * (randomNumberGenerator() - 0.5), C1, od1, 3, ignore_photons, use_scattering, false);
+            ComputeOneMediaSample(medias, lights, *i, ray, d1 + dd * IMedia->Jitter * ((useSampler ? sampleSet.Get1d(j) : randomNumberGenerator()) - 0.5), C1, od1, 3, ignore_photons, use_scattering, false);
             ComputeOneMediaSampleRecursive(medias, lights, *i, ray, d0, d1, Result, C0, C1, ODResult, od0, od1, IMedia->AA_Level - 1,
                                            IMedia->Jitter, aa_threshold, ignore_photons, use_scattering, false);
 
@@ -480,9 +747,19 @@ void MediaFunction::ComputeMediaAdaptiveSampling(MediaVector& medias, LightSourc
             od0 = od1;
 
             d0 = d1;
+
+            // Stop once hardly anything shines through from further down the ray.
+            if(Exp(-(od + i->od * dd)).WeightMax() < ray.GetTicket().adcBailout)
+            {
+                // presume the remainder of the interval to be just as dense as the part sampled so far
+                i->od *= (DBL)subIntervalCount / (DBL)j;
+                opaque = true;
+                break;
+            }
         }
 
         i->samples = subIntervalCount;
+        od += i->od * dd;
     }
 }
 
@@ -581,18 +858,37 @@ void MediaFunction::ComputeMediaSampleInterval(LitIntervalVector& litintervals,
     }
 }
 
+bool MediaFunction::ComputeMediaOccupiedSpan(MediaVector& medias, const Ray& ray, DBL& s0, DBL& s1)
+{
+    DBL first = s1;
+    DBL last  = s0;
+
+    for(MediaVector::iterator i(medias.begin()); i != medias.end(); i++)
+    {
+        // without a baked density, we know nothing about empty space
+        if((*i)->Density_Grid == nullptr)
+            return false;
+
+        DBL t0 = s0;
+        DBL t1 = s1;
+        if((*i)->Density_Grid->FindOccupiedSpan(ray, t0, t1))
+        {
+            first = min(first, t0);
+            last  = max(last,  t1);
+        }
+    }
+
+    s0 = first;
+    s1 = last;
+    return true;
+}
+
 void MediaFunction::ComputeMediaLightInterval(LightSourceEntryVector& lights, LitIntervalVector& litintervals, const Ray& ray, const Intersection& isect)
 {
     if (isect.Object != nullptr)
     {
         if((isect.Object->Flags & NO_GLOBAL_LIGHTS_FLAG) != NO_GLOBAL_LIGHTS_FLAG)
-        {
-            for(vector<LightSource *>::iterator i(threadData->lightSources.begin()); i != threadData->lightSources.end(); i++)
-            {
-                if((*i)->Media_Interaction == true)
-                    ComputeOneMediaLightInterval(*i, lights, ray, isect);
-            }
-        }
+            ComputeGlobalMediaLightIntervals(lights, ray, isect);
 
         for(vector<LightSource *>::iterator i(isect.Object->LLights.begin()); i != isect.Object->LLights.end(); i++)
         {
@@ -601,13 +897,7 @@ void MediaFunction::ComputeMediaLightInterval(LightSourceEntryVector& lights, Li
         }
     }
     else
-    {
-        for(vector<LightSource *>::iterator i(threadData->lightSources.begin()); i != threadData->lightSources.end(); i++)
-        {
-            if((*i)->Media_Interaction == true)
-                ComputeOneMediaLightInterval(*i, lights, ray, isect);
-        }
-    }
+        ComputeGlobalMediaLightIntervals(lights, ray, isect);
 
     if(lights.empty() == false)
     {
@@ -698,7 +988,33 @@ void MediaFunction::ComputeMediaLightInterval(LightSourceEntryVector& lights, Li
     }
 }
 
-void MediaFunction::ComputeOneMediaLightInterval(LightSource *light, LightSourceEntryVector&lights, const Ray& ray, const Intersection& isect)
+void MediaFunction::ComputeGlobalMediaLightIntervals(LightSourceEntryVector& lights, const Ray& ray, const Intersection& isect)
+{
+    const LightSourceTree *lightSourceTree = threadData->GetSceneData()->lightSourceTree;
+
+    if(lightSourceTree != nullptr)
+    {
+        // only bother with the light sources near enough to the ray to matter
+        LightSourceIndexVector candidates;
+        lightSourceTree->Find(ray, isect.Depth, candidates);
+        for(LightSourceIndexVector::const_iterator i(candidates.begin()); i != candidates.end(); i++)
+        {
+            const LightSource *light = threadData->lightSources[*i];
+            if(light->Media_Interaction == true)
+                ComputeOneMediaLightInterval(light, lights, ray, isect);
+        }
+    }
+    else
+    {
+        for(vector<LightSource *>::const_iterator i(threadData->lightSources.begin()); i != threadData->lightSources.end(); i++)
+        {
+            if((*i)->Media_Interaction == true)
+                ComputeOneMediaLightInterval(*i, lights, ray, isect);
+        }
+    }
+}
+
+void MediaFunction::ComputeOneMediaLightInterval(const LightSource *light, LightSourceEntryVector&lights, const Ray& ray, const Intersection& isect)
 {
     LightSourceEntry lse;
     DBL t1 = 0.0, t2 = 0.0;
@@ -940,7 +1256,10 @@ void MediaFunction::ComputeOneMediaSample(MediaVector& medias, LightSourceEntryV
     {
         P = H;
 
-        Evaluate_Density_Pigment((*i)->Density, P, C0, threadData);
+        if ((*i)->Density_Grid != nullptr)
+            (*i)->Density_Grid->Evaluate(P, C0);
+        else
+            Evaluate_Density_Pigment((*i)->Density, P, C0, threadData);
 
         Extinction += C0 * (*i)->Extinction;
 
@@ -957,7 +1276,8 @@ void MediaFunction::ComputeOneMediaSample(MediaVector& medias, LightSourceEntryV
     if(sample_method != 3)
         mediainterval.od += SampOptDepth;
 
-    if(!ray.IsShadowTestRay() && use_scattering && !ray.IsPhotonRay())
+    // no need to look for light where there's nothing to scatter it, e.g. in empty parts of a density grid
+    if(!ray.IsShadowTestRay() && use_scattering && !ray.IsPhotonRay() && !Scattering.IsZero())
     {
         if(mediainterval.lit)
         {
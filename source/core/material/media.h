@@ -64,6 +64,44 @@ enum
 
 void Transform_Density(vector<PIGMENT*>& Density, const TRANSFORM *Trans);
 
+/// Media density baked into a sparse grid.
+///
+/// The density is sampled at the vertices of a regular lattice over the container's bounding box
+/// and looked up by trilinear interpolation. The lattice is split into bricks of @ref BrickSize
+/// cells along each axis; bricks of uniform density, such as empty space, are stored as a single
+/// value.
+///
+class MediaDensityGrid
+{
+    public:
+        MediaDensityGrid(vector<PIGMENT*>& density, const Vector3d& lowerLeft, const Vector3d& upperRight, int resolution, TraceThreadData *ttd);
+
+        /// Looks up the density at a point; points outside the grid are clamped to its boundary.
+        void Evaluate(const Vector3d& p, MathColour& c) const;
+
+        /// Narrows down a section of a ray to the part crossing bricks of non-zero density.
+        /// @return     `false` if the section crosses no such bricks at all.
+        bool FindOccupiedSpan(const BasicRay& ray, DBL& s0, DBL& s1) const;
+
+    protected:
+
+        static const int BrickSize = 8;
+        static const int BrickSamples = BrickSize + 1;
+
+        struct Brick
+        {
+            MathColour          uniform;    ///< Density throughout the brick, if uniform.
+            bool                empty;      ///< Whether the density is zero throughout the brick.
+            vector<MathColour>  samples;    ///< Density at the brick's lattice vertices, or empty if uniform.
+        };
+
+        Vector3d        lowerLeft;
+        Vector3d        cellsPerUnit;
+        int             cells[3];
+        int             bricks[3];
+        vector<Brick>   brickData;
+};
+
 class MediaFunction : public Trace::MediaFunctor
 {
     public:
@@ -92,7 +130,9 @@ class MediaFunction : public Trace::MediaFunctor
         void ComputeMediaColour(MediaIntervalVector& mediaintervals, MathColour& colour, ColourChannel& transm);
         void ComputeMediaSampleInterval(LitIntervalVector& litintervals, MediaIntervalVector& mediaintervals, const Media *media);
         void ComputeMediaLightInterval(LightSourceEntryVector& lights, LitIntervalVector& litintervals, const Ray& ray, const Intersection& isect);
-        void ComputeOneMediaLightInterval(LightSource *light, LightSourceEntryVector&lights, const Ray& ray, const Intersection& isect);
+        void ComputeGlobalMediaLightIntervals(LightSourceEntryVector& lights, const Ray& ray, const Intersection& isect);
+        void ComputeOneMediaLightInterval(const LightSource *light, LightSourceEntryVector&lights, const Ray& ray, const Intersection& isect);
+        bool ComputeMediaOccupiedSpan(MediaVector& medias, const Ray& ray, DBL& s0, DBL& s1);
         bool ComputeSpotLightInterval(const Ray &ray, const LightSource *Light, DBL *d1, DBL *d2);
         bool ComputeCylinderLightInterval(const Ray &ray, const LightSource *Light, DBL *d1, DBL *d2);
         void ComputeOneMediaSample(MediaVector& medias, LightSourceEntryVector& lights, MediaInterval& mediainterval, const Ray &ray, DBL d0, MathColour& SampCol,
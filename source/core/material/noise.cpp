@@ -45,88 +45,93 @@
 // Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
 #include "core/material/noise.h"
 
+// POV-Ray header files (core module)
+#include "core/material/noisetables.h"
+
 // this must be the last file included
 #include "base/povdebug.h"
 
 namespace pov
 {
 
-/*****************************************************************************
-* Static functions
-******************************************************************************/
-
-static void InitTextureTable(void);
-static void InitSolidNoise(void);
-
-/*****************************************************************************
-* Local preprocessor defines
-******************************************************************************/
-
-/* Ridiculously large scaling values */
-
-const int SINTABSIZE = 1000;
-
-
-
 /*****************************************************************************
 * Local variables
 ******************************************************************************/
 
-static DBL *sintab; // GLOBAL VARIABLE
+// The hash, permutation and gradient tables are generated offline (see `core/material/noisetables.h`),
+// so that no start-up initialization is needed and they are shared read-only between all threads.
 
-#ifdef DYNAMIC_HASHTABLE
-unsigned short *hashTable; // GLOBAL VARIABLE
-#else
-ALIGN16 unsigned short hashTable[8192]; // GLOBAL VARIABLE
-#endif
-
-ALIGN16 DBL RTable[267*2] =
+/// Pseudo-random gradient table of the original noise generator.
+/// Each value is immediately followed by half its value.
+ALIGN16 const DBL RTable[267*2] =
 {
-            -1, 0.0,    0.604974, 0.0,   -0.937102, 0.0,    0.414115, 0.0,    0.576226, 0.0,  -0.0161593, 0.0,
-      0.432334, 0.0,    0.103685, 0.0,    0.590539, 0.0,   0.0286412, 0.0,     0.46981, 0.0,    -0.84622, 0.0,
-    -0.0734112, 0.0,   -0.304097, 0.0,    -0.40206, 0.0,   -0.210132, 0.0,   -0.919127, 0.0,    0.652033, 0.0,
-      -0.83151, 0.0,   -0.183948, 0.0,   -0.671107, 0.0,    0.852476, 0.0,    0.043595, 0.0,   -0.404532, 0.0,
-       0.75494, 0.0,   -0.335653, 0.0,    0.618433, 0.0,    0.605707, 0.0,    0.708583, 0.0,   -0.477195, 0.0,
-      0.899474, 0.0,    0.490623, 0.0,    0.221729, 0.0,   -0.400381, 0.0,   -0.853727, 0.0,   -0.932586, 0.0,
-      0.659113, 0.0,    0.961303, 0.0,    0.325948, 0.0,   -0.750851, 0.0,    0.842466, 0.0,    0.734401, 0.0,
-     -0.649866, 0.0,    0.394491, 0.0,   -0.466056, 0.0,   -0.434073, 0.0,    0.109026, 0.0,   0.0847028, 0.0,
-     -0.738857, 0.0,    0.241505, 0.0,     0.16228, 0.0,    -0.71426, 0.0,   -0.883665, 0.0,   -0.150408, 0.0,
-      -0.90396, 0.0,   -0.686549, 0.0,   -0.785214, 0.0,    0.488548, 0.0,   0.0246433, 0.0,    0.142473, 0.0,
-     -0.602136, 0.0,    0.375845, 0.0, -0.00779736, 0.0,    0.498955, 0.0,   -0.268147, 0.0,    0.856382, 0.0,
-     -0.386007, 0.0,   -0.596094, 0.0,   -0.867735, 0.0,   -0.570977, 0.0,   -0.914366, 0.0,     0.28896, 0.0,
-      0.672206, 0.0,   -0.233783, 0.0,     0.94815, 0.0,    0.895262, 0.0,    0.343252, 0.0,   -0.173388, 0.0,
-     -0.767971, 0.0,   -0.314748, 0.0,    0.824308, 0.0,   -0.342092, 0.0,    0.721431, 0.0,    -0.24004, 0.0,
-      -0.63653, 0.0,    0.553277, 0.0,    0.376272, 0.0,    0.158984, 0.0,   -0.452659, 0.0,    0.396323, 0.0,
-     -0.420676, 0.0,   -0.454154, 0.0,    0.122179, 0.0,    0.295857, 0.0,   0.0664225, 0.0,   -0.202075, 0.0,
-     -0.724788, 0.0,    0.453513, 0.0,    0.224567, 0.0,   -0.908812, 0.0,    0.176349, 0.0,   -0.320516, 0.0,
-     -0.697139, 0.0,    0.742702, 0.0,   -0.900786, 0.0,    0.471489, 0.0,   -0.133532, 0.0,    0.119127, 0.0,
-     -0.889769, 0.0,    -0.23183, 0.0,   -0.669673, 0.0,   -0.046891, 0.0,   -0.803433, 0.0,   -0.966735, 0.0,
-      0.475578, 0.0,   -0.652644, 0.0,   0.0112459, 0.0,   -0.730007, 0.0,    0.128283, 0.0,    0.145647, 0.0,
-     -0.619318, 0.0,    0.272023, 0.0,    0.392966, 0.0,    0.646418, 0.0,  -0.0207675, 0.0,   -0.315908, 0.0,
-      0.480797, 0.0,    0.535668, 0.0,   -0.250172, 0.0,    -0.83093, 0.0,   -0.653773, 0.0,   -0.443809, 0.0,
-      0.119982, 0.0,   -0.897642, 0.0,     0.89453, 0.0,    0.165789, 0.0,    0.633875, 0.0,   -0.886839, 0.0,
-      0.930877, 0.0,   -0.537194, 0.0,    0.587732, 0.0,    0.722011, 0.0,   -0.209461, 0.0,  -0.0424659, 0.0,
-     -0.814267, 0.0,   -0.919432, 0.0,    0.280262, 0.0,    -0.66302, 0.0,   -0.558099, 0.0,   -0.537469, 0.0,
-     -0.598779, 0.0,    0.929656, 0.0,   -0.170794, 0.0,   -0.537163, 0.0,    0.312581, 0.0,    0.959442, 0.0,
-      0.722652, 0.0,    0.499931, 0.0,    0.175616, 0.0,   -0.534874, 0.0,   -0.685115, 0.0,    0.444999, 0.0,
-       0.17171, 0.0,    0.108202, 0.0,   -0.768704, 0.0,   -0.463828, 0.0,    0.254231, 0.0,    0.546014, 0.0,
-      0.869474, 0.0,    0.875212, 0.0,   -0.944427, 0.0,    0.130724, 0.0,   -0.110185, 0.0,    0.312184, 0.0,
-      -0.33138, 0.0,   -0.629206, 0.0,   0.0606546, 0.0,    0.722866, 0.0,  -0.0979477, 0.0,    0.821561, 0.0,
-     0.0931258, 0.0,   -0.972808, 0.0,   0.0318151, 0.0,   -0.867033, 0.0,   -0.387228, 0.0,    0.280995, 0.0,
-     -0.218189, 0.0,   -0.539178, 0.0,   -0.427359, 0.0,   -0.602075, 0.0,    0.311971, 0.0,    0.277974, 0.0,
-      0.773159, 0.0,    0.592493, 0.0,  -0.0331884, 0.0,   -0.630854, 0.0,   -0.269947, 0.0,    0.339132, 0.0,
-      0.581079, 0.0,    0.209461, 0.0,   -0.317433, 0.0,   -0.284993, 0.0,    0.181323, 0.0,    0.341634, 0.0,
-      0.804959, 0.0,   -0.229572, 0.0,   -0.758907, 0.0,   -0.336721, 0.0,    0.605463, 0.0,   -0.991272, 0.0,
-    -0.0188754, 0.0,   -0.300191, 0.0,    0.368307, 0.0,   -0.176135, 0.0,     -0.3832, 0.0,   -0.749569, 0.0,
-       0.62356, 0.0,   -0.573938, 0.0,    0.278309, 0.0,   -0.971313, 0.0,    0.839994, 0.0,   -0.830686, 0.0,
-      0.439078, 0.0,     0.66128, 0.0,    0.694514, 0.0,   0.0565042, 0.0,     0.54342, 0.0,   -0.438804, 0.0,
-    -0.0228428, 0.0,   -0.687068, 0.0,    0.857267, 0.0,    0.301991, 0.0,   -0.494255, 0.0,   -0.941039, 0.0,
-      0.775509, 0.0,    0.410575, 0.0,   -0.362081, 0.0,   -0.671534, 0.0,   -0.348379, 0.0,    0.932433, 0.0,
-      0.886442, 0.0,    0.868681, 0.0,   -0.225666, 0.0,   -0.062211, 0.0,  -0.0976425, 0.0,   -0.641444, 0.0,
-     -0.848112, 0.0,    0.724697, 0.0,    0.473503, 0.0,    0.998749, 0.0,    0.174701, 0.0,    0.559625, 0.0,
-     -0.029099, 0.0,   -0.337392, 0.0,   -0.958129, 0.0,   -0.659785, 0.0,    0.236042, 0.0,   -0.246937, 0.0,
-      0.659449, 0.0,   -0.027512, 0.0,    0.821897, 0.0,   -0.226215, 0.0,   0.0181735, 0.0,    0.500481, 0.0,
-     -0.420127, 0.0,   -0.427878, 0.0,    0.566186, 0.0
+             -1,        -0.5,    0.604974,    0.302487,   -0.937102,   -0.468551,    0.414115,   0.2070575,
+       0.576226,    0.288113,  -0.0161593, -0.00807965,    0.432334,    0.216167,    0.103685,   0.0518425,
+       0.590539,   0.2952695,   0.0286412,   0.0143206,     0.46981,    0.234905,    -0.84622,    -0.42311,
+     -0.0734112,  -0.0367056,   -0.304097,  -0.1520485,    -0.40206,    -0.20103,   -0.210132,   -0.105066,
+      -0.919127,  -0.4595635,    0.652033,   0.3260165,    -0.83151,   -0.415755,   -0.183948,   -0.091974,
+      -0.671107,  -0.3355535,    0.852476,    0.426238,    0.043595,   0.0217975,   -0.404532,   -0.202266,
+        0.75494,     0.37747,   -0.335653,  -0.1678265,    0.618433,   0.3092165,    0.605707,   0.3028535,
+       0.708583,   0.3542915,   -0.477195,  -0.2385975,    0.899474,    0.449737,    0.490623,   0.2453115,
+       0.221729,   0.1108645,   -0.400381,  -0.2001905,   -0.853727,  -0.4268635,   -0.932586,   -0.466293,
+       0.659113,   0.3295565,    0.961303,   0.4806515,    0.325948,    0.162974,   -0.750851,  -0.3754255,
+       0.842466,    0.421233,    0.734401,   0.3672005,   -0.649866,   -0.324933,    0.394491,   0.1972455,
+      -0.466056,   -0.233028,   -0.434073,  -0.2170365,    0.109026,    0.054513,   0.0847028,   0.0423514,
+      -0.738857,  -0.3694285,    0.241505,   0.1207525,     0.16228,     0.08114,    -0.71426,    -0.35713,
+      -0.883665,  -0.4418325,   -0.150408,   -0.075204,    -0.90396,    -0.45198,   -0.686549,  -0.3432745,
+      -0.785214,   -0.392607,    0.488548,    0.244274,   0.0246433,  0.01232165,    0.142473,   0.0712365,
+      -0.602136,   -0.301068,    0.375845,   0.1879225, -0.00779736, -0.00389868,    0.498955,   0.2494775,
+      -0.268147,  -0.1340735,    0.856382,    0.428191,   -0.386007,  -0.1930035,   -0.596094,   -0.298047,
+      -0.867735,  -0.4338675,   -0.570977,  -0.2854885,   -0.914366,   -0.457183,     0.28896,     0.14448,
+       0.672206,    0.336103,   -0.233783,  -0.1168915,     0.94815,    0.474075,    0.895262,    0.447631,
+       0.343252,    0.171626,   -0.173388,   -0.086694,   -0.767971,  -0.3839855,   -0.314748,   -0.157374,
+       0.824308,    0.412154,   -0.342092,   -0.171046,    0.721431,   0.3607155,    -0.24004,    -0.12002,
+       -0.63653,   -0.318265,    0.553277,   0.2766385,    0.376272,    0.188136,    0.158984,    0.079492,
+      -0.452659,  -0.2263295,    0.396323,   0.1981615,   -0.420676,   -0.210338,   -0.454154,   -0.227077,
+       0.122179,   0.0610895,    0.295857,   0.1479285,   0.0664225,  0.03321125,   -0.202075,  -0.1010375,
+      -0.724788,   -0.362394,    0.453513,   0.2267565,    0.224567,   0.1122835,   -0.908812,   -0.454406,
+       0.176349,   0.0881745,   -0.320516,   -0.160258,   -0.697139,  -0.3485695,    0.742702,    0.371351,
+      -0.900786,   -0.450393,    0.471489,   0.2357445,   -0.133532,   -0.066766,    0.119127,   0.0595635,
+      -0.889769,  -0.4448845,    -0.23183,   -0.115915,   -0.669673,  -0.3348365,   -0.046891,  -0.0234455,
+      -0.803433,  -0.4017165,   -0.966735,  -0.4833675,    0.475578,    0.237789,   -0.652644,   -0.326322,
+      0.0112459,  0.00562295,   -0.730007,  -0.3650035,    0.128283,   0.0641415,    0.145647,   0.0728235,
+      -0.619318,   -0.309659,    0.272023,   0.1360115,    0.392966,    0.196483,    0.646418,    0.323209,
+     -0.0207675, -0.01038375,   -0.315908,   -0.157954,    0.480797,   0.2403985,    0.535668,    0.267834,
+      -0.250172,   -0.125086,    -0.83093,   -0.415465,   -0.653773,  -0.3268865,   -0.443809,  -0.2219045,
+       0.119982,    0.059991,   -0.897642,   -0.448821,     0.89453,    0.447265,    0.165789,   0.0828945,
+       0.633875,   0.3169375,   -0.886839,  -0.4434195,    0.930877,   0.4654385,   -0.537194,   -0.268597,
+       0.587732,    0.293866,    0.722011,   0.3610055,   -0.209461,  -0.1047305,  -0.0424659, -0.02123295,
+      -0.814267,  -0.4071335,   -0.919432,   -0.459716,    0.280262,    0.140131,    -0.66302,    -0.33151,
+      -0.558099,  -0.2790495,   -0.537469,  -0.2687345,   -0.598779,  -0.2993895,    0.929656,    0.464828,
+      -0.170794,   -0.085397,   -0.537163,  -0.2685815,    0.312581,   0.1562905,    0.959442,    0.479721,
+       0.722652,    0.361326,    0.499931,   0.2499655,    0.175616,    0.087808,   -0.534874,   -0.267437,
+      -0.685115,  -0.3425575,    0.444999,   0.2224995,     0.17171,    0.085855,    0.108202,    0.054101,
+      -0.768704,   -0.384352,   -0.463828,   -0.231914,    0.254231,   0.1271155,    0.546014,    0.273007,
+       0.869474,    0.434737,    0.875212,    0.437606,   -0.944427,  -0.4722135,    0.130724,    0.065362,
+      -0.110185,  -0.0550925,    0.312184,    0.156092,    -0.33138,    -0.16569,   -0.629206,   -0.314603,
+      0.0606546,   0.0303273,    0.722866,    0.361433,  -0.0979477, -0.04897385,    0.821561,   0.4107805,
+      0.0931258,   0.0465629,   -0.972808,   -0.486404,   0.0318151,  0.01590755,   -0.867033,  -0.4335165,
+      -0.387228,   -0.193614,    0.280995,   0.1404975,   -0.218189,  -0.1090945,   -0.539178,   -0.269589,
+      -0.427359,  -0.2136795,   -0.602075,  -0.3010375,    0.311971,   0.1559855,    0.277974,    0.138987,
+       0.773159,   0.3865795,    0.592493,   0.2962465,  -0.0331884,  -0.0165942,   -0.630854,   -0.315427,
+      -0.269947,  -0.1349735,    0.339132,    0.169566,    0.581079,   0.2905395,    0.209461,   0.1047305,
+      -0.317433,  -0.1587165,   -0.284993,  -0.1424965,    0.181323,   0.0906615,    0.341634,    0.170817,
+       0.804959,   0.4024795,   -0.229572,   -0.114786,   -0.758907,  -0.3794535,   -0.336721,  -0.1683605,
+       0.605463,   0.3027315,   -0.991272,   -0.495636,  -0.0188754,  -0.0094377,   -0.300191,  -0.1500955,
+       0.368307,   0.1841535,   -0.176135,  -0.0880675,     -0.3832,     -0.1916,   -0.749569,  -0.3747845,
+        0.62356,     0.31178,   -0.573938,   -0.286969,    0.278309,   0.1391545,   -0.971313,  -0.4856565,
+       0.839994,    0.419997,   -0.830686,   -0.415343,    0.439078,    0.219539,     0.66128,     0.33064,
+       0.694514,    0.347257,   0.0565042,   0.0282521,     0.54342,     0.27171,   -0.438804,   -0.219402,
+     -0.0228428,  -0.0114214,   -0.687068,   -0.343534,    0.857267,   0.4286335,    0.301991,   0.1509955,
+      -0.494255,  -0.2471275,   -0.941039,  -0.4705195,    0.775509,   0.3877545,    0.410575,   0.2052875,
+      -0.362081,  -0.1810405,   -0.671534,   -0.335767,   -0.348379,  -0.1741895,    0.932433,   0.4662165,
+       0.886442,    0.443221,    0.868681,   0.4343405,   -0.225666,   -0.112833,   -0.062211,  -0.0311055,
+     -0.0976425, -0.04882125,   -0.641444,   -0.320722,   -0.848112,   -0.424056,    0.724697,   0.3623485,
+       0.473503,   0.2367515,    0.998749,   0.4993745,    0.174701,   0.0873505,    0.559625,   0.2798125,
+      -0.029099,  -0.0145495,   -0.337392,   -0.168696,   -0.958129,  -0.4790645,   -0.659785,  -0.3298925,
+       0.236042,    0.118021,   -0.246937,  -0.1234685,    0.659449,   0.3297245,   -0.027512,   -0.013756,
+       0.821897,   0.4109485,   -0.226215,  -0.1131075,   0.0181735,  0.00908675,    0.500481,   0.2502405,
+      -0.420127,  -0.2100635,   -0.427878,   -0.213939,    0.566186,    0.283093
 };
 
 /*****************************************************************************
@@ -156,19 +161,6 @@ void Initialize_Noise()
 #ifdef TRY_OPTIMIZED_NOISE
     Initialise_NoiseDispatch();
 #endif
-    InitTextureTable();
-
-    /* are - initialize Perlin style noise function */
-    InitSolidNoise();
-
-    sintab = new DBL[SINTABSIZE];
-
-    for(int i = 0; i < 267; i++)
-        RTable[(i * 2) + 1] = RTable[i * 2] * 0.5;
-    //    Debug_Info("%.10f  %.10f\n", (DBL)(RTable[i * 2] - (DBL)((float)(RTable[i * 2]))), (DBL)(RTable[(i * 2) + 1] - (DBL)((float)(RTable[(i * 2) + 1]))));
-
-    for(int i = 0; i < SINTABSIZE; i++)
-        sintab[i] = sin((DBL)i / SINTABSIZE * TWO_M_PI);
 }
 
 void Initialize_Waves(vector<double>& waveFrequencies, vector<Vector3d>& waveSources, unsigned int numberOfWaves)
@@ -191,147 +183,15 @@ void Initialize_Waves(vector<double>& waveFrequencies, vector<Vector3d>& waveSou
 
 
 
-/*****************************************************************************
-*
-* FUNCTION
-*
-*   InitTextureTable()
-*
-* INPUT
-*
-* OUTPUT
-*
-* RETURNS
-*
-* AUTHOR
-*
-*   POV-Ray Team
-*
-* DESCRIPTION
-*
-* CHANGES
-*
-******************************************************************************/
-
-static void InitTextureTable()
-{
-    unsigned short j, temp;
-    int i;
-    int next_rand = 0;
-
-    #ifdef DYNAMIC_HASHTABLE
-        hashTable = new unsigned short[8192];
-    #endif
-
-    for(i = 0; i < 4096; i++)
-        hashTable[i] = i;
-
-    for(i = 4095; i >= 0; i--)
-    {
-        next_rand = next_rand * 1812433253L + 12345L;
-        j = ((int)(next_rand >> 16) & 0x7FFF) % 4096;
-        temp = hashTable[i];
-        hashTable[i] = hashTable[j];
-        hashTable[j] = temp;
-    }
-
-    for(i = 0; i < 4096; i++)
-        hashTable[4096 + i] = hashTable[i];
-}
-
-
-
-/*****************************************************************************
-*
-* FUNCTION
-*
-*   Free_Noise_Tables()
-*
-* INPUT
-*
-* OUTPUT
-*
-* RETURNS
-*
-* AUTHOR
-*
-*   POV-Ray Team
-*
-* DESCRIPTION
-*
-* CHANGES
-*
-******************************************************************************/
-
-void Free_Noise_Tables()
-{
-    if (sintab != nullptr)
-    {
-        delete[] sintab;
-        sintab = nullptr;
-
-#ifdef DYNAMIC_HASHTABLE
-        delete[] hashTable;
-        hashTable = nullptr;
-#endif
-    }
-}
-
-
-
 // Note that the value of NoiseEntries must be a power of 2.  This
 // is because bit masking using (NoiseEntries-1) is used to rescale
-// the input values to the noise function.
+// the input values to the noise function.  It must also match the
+// value in `tools/meta-make/noise/metagen-noise.py`.
 const int NoiseEntries = 2048;
-static int NoisePermutation[2*(NoiseEntries+1)];
-static Vector3d NoiseGradients[2*(NoiseEntries+1)];
+static_assert(sizeof(NoisePermutation) == 2 * (NoiseEntries + 1) * sizeof(int), "NoisePermutation size mismatch");
 
 const DBL ROLLOVER = 10000000.023157213;
 
-static void
-InitSolidNoise(void)
-{
-    int i, j, k;
-    Vector3d v;
-    DBL s;
-
-    // Create an array of random gradient vectors uniformly on the unit sphere
-    int next_rand = 1;
-    for(i = 0; i < NoiseEntries; i++)
-    {
-        do
-        {
-            for(j = 0; j < 3; j++)
-            {
-                next_rand = next_rand * 1812433253L + 12345L;
-                v[j] = (DBL)((((int)(next_rand >> 16) & 0x7FFF) % (NoiseEntries << 1)) - NoiseEntries) / (DBL)NoiseEntries;
-            }
-            s = v.lengthSqr();
-        } while ((s > 1.0) || (s < 1.0e-5));
-        v /= sqrt(s);
-
-        NoiseGradients[i] = v;
-    }
-    // Create a pseudorandom permutation of [0..NoiseEntries]
-    for(i = 0; i < NoiseEntries; i++)
-        NoisePermutation[i] = i;
-    for(i = NoiseEntries; i > 0; i -= 2)
-    {
-        k = NoisePermutation[i];
-        next_rand = next_rand * 1812433253L + 12345L;
-        j = ((int)(next_rand >> 16) & 0x7FFF) % NoiseEntries;
-        NoisePermutation[i] = NoisePermutation[j];
-        NoisePermutation[j] = k;
-    }
-    // Duplicate the entries so that we don't need a modulus operation
-    // to get a value out.
-    for(i = 0; i < NoiseEntries + 2; i++)
-    {
-        NoisePermutation[NoiseEntries + i] = NoisePermutation[i];
-        NoiseGradients[NoiseEntries + i] = NoiseGradients[i];
-    }
-}
-
 // Hermite curve from 0 to 1.  Makes a nice smooth transition of values.
 static DBL inline
 SCurve(DBL t)
@@ -374,6 +234,12 @@ NoiseValueAt(const Vector3d& q, DBL rx, DBL ry, DBL rz)
     return (rx * q[X] + ry * q[Y] + rz * q[Z]);
 }
 
+static DBL inline
+NoiseValueAt(const DBL* q, DBL rx, DBL ry, DBL rz)
+{
+    return (rx * q[X] + ry * q[Y] + rz * q[Z]);
+}
+
 DBL
 SolidNoise(const Vector3d& P)
 {
@@ -451,22 +317,22 @@ SolidDNoise(const Vector3d& P, Vector3d& D)
     sz = SCurve(rz0);
 
 
-    u = NoiseGradients[b00 + bz0];
-    v = NoiseGradients[b10 + bz0];
+    u = Vector3d(NoiseGradients[b00 + bz0]);
+    v = Vector3d(NoiseGradients[b10 + bz0]);
     VLerp(a, sx, u, v);
 
-    u = NoiseGradients[b01 + bz0];
-    v = NoiseGradients[b11 + bz0];
+    u = Vector3d(NoiseGradients[b01 + bz0]);
+    v = Vector3d(NoiseGradients[b11 + bz0]);
     VLerp(b, sx, u, v);
 
     VLerp(c, sy, a, b);
 
-    u = NoiseGradients[b00 + bz1];
-    v = NoiseGradients[b10 + bz1];
+    u = Vector3d(NoiseGradients[b00 + bz1]);
+    v = Vector3d(NoiseGradients[b10 + bz1]);
     VLerp(a, sx, u, v);
 
-    u = NoiseGradients[b01 + bz1];
-    v = NoiseGradients[b11 + bz1];
+    u = Vector3d(NoiseGradients[b01 + bz1]);
+    v = Vector3d(NoiseGradients[b11 + bz1]);
     VLerp(b, sx, u, v);
 
     VLerp(d, sy, a, b);
@@ -474,6 +340,189 @@ SolidDNoise(const Vector3d& P, Vector3d& D)
     VLerp(D, sz, c, d);
 }
 
+// Derivative of the Hermite curve.
+static DBL inline
+SCurveSlope(DBL t)
+{
+    return (6.0 * t * (1.0 - t));
+}
+
+// Adds one lattice corner's contribution to a trilinearly blended noise value and its gradient.
+// The corner's own contribution is the linear function c + dot(slope, r), blended with weight wx*wy*wz;
+// dwx, dwy and dwz are the derivatives of the individual weights.
+static void inline
+AddNoiseCorner(DBL& value, Vector3d& gradient, DBL wx, DBL wy, DBL wz, DBL dwx, DBL dwy, DBL dwz,
+               DBL c, const Vector3d& slope, DBL rx, DBL ry, DBL rz)
+{
+    DBL l = c + NoiseValueAt(slope, rx, ry, rz);
+    DBL w = wx * wy * wz;
+
+    value += w * l;
+    gradient[X] += dwx * wy  * wz  * l + w * slope[X];
+    gradient[Y] += wx  * dwy * wz  * l + w * slope[Y];
+    gradient[Z] += wx  * wy  * dwz * l + w * slope[Z];
+}
+
+static DBL
+SolidNoiseGradient(const Vector3d& P, Vector3d& G)
+{
+    int bx0, bx1, by0, by1, bz0, bz1;
+    int b00, b10, b01, b11;
+    DBL rx0, rx1, ry0, ry1, rz0, rz1;
+    DBL sx, sy, sz, tx, ty, tz, dsx, dsy, dsz;
+    DBL value = 0.0;
+    int i, j;
+
+    SetupSolidNoise(P, 0, bx0, bx1, rx0, rx1);
+    SetupSolidNoise(P, 1, by0, by1, ry0, ry1);
+    SetupSolidNoise(P, 2, bz0, bz1, rz0, rz1);
+
+    i = NoisePermutation[bx0];
+    j = NoisePermutation[bx1];
+
+    b00 = NoisePermutation[i + by0];
+    b10 = NoisePermutation[j + by0];
+    b01 = NoisePermutation[i + by1];
+    b11 = NoisePermutation[j + by1];
+
+    sx = SCurve(rx0); tx = 1.0 - sx; dsx = SCurveSlope(rx0);
+    sy = SCurve(ry0); ty = 1.0 - sy; dsy = SCurveSlope(ry0);
+    sz = SCurve(rz0); tz = 1.0 - sz; dsz = SCurveSlope(rz0);
+
+    G = Vector3d(0.0);
+
+    AddNoiseCorner(value, G, tx, ty, tz, -dsx, -dsy, -dsz, 0.0, Vector3d(NoiseGradients[b00 + bz0]), rx0, ry0, rz0);
+    AddNoiseCorner(value, G, sx, ty, tz,  dsx, -dsy, -dsz, 0.0, Vector3d(NoiseGradients[b10 + bz0]), rx1, ry0, rz0);
+    AddNoiseCorner(value, G, tx, sy, tz, -dsx,  dsy, -dsz, 0.0, Vector3d(NoiseGradients[b01 + bz0]), rx0, ry1, rz0);
+    AddNoiseCorner(value, G, sx, sy, tz,  dsx,  dsy, -dsz, 0.0, Vector3d(NoiseGradients[b11 + bz0]), rx1, ry1, rz0);
+    AddNoiseCorner(value, G, tx, ty, sz, -dsx, -dsy,  dsz, 0.0, Vector3d(NoiseGradients[b00 + bz1]), rx0, ry0, rz1);
+    AddNoiseCorner(value, G, sx, ty, sz,  dsx, -dsy,  dsz, 0.0, Vector3d(NoiseGradients[b10 + bz1]), rx1, ry0, rz1);
+    AddNoiseCorner(value, G, tx, sy, sz, -dsx,  dsy,  dsz, 0.0, Vector3d(NoiseGradients[b01 + bz1]), rx0, ry1, rz1);
+    AddNoiseCorner(value, G, sx, sy, sz,  dsx,  dsy,  dsz, 0.0, Vector3d(NoiseGradients[b11 + bz1]), rx1, ry1, rz1);
+
+    return value;
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   NoiseGradient
+*
+* INPUT
+*
+*   EPoint          -- 3-D point at which noise is evaluated
+*   noise_generator -- noise generator to use
+*
+* OUTPUT
+*
+*   gradient        -- gradient of the noise function
+*
+* RETURNS
+*
+*   DBL noise value
+*
+* AUTHOR
+*
+* DESCRIPTION
+*
+*   Computes the same value as "Noise", along with its exact derivative;
+*   this allows bump patterns built on noise to perturb the normal without
+*   sampling the function at several nearby points.
+*
+*   Note that this always uses the portable code path, as the optimized
+*   implementations only provide the value.
+*
+* CHANGES
+*
+******************************************************************************/
+
+DBL NoiseGradient(Vector3d& gradient, const Vector3d& EPoint, int noise_generator)
+{
+    DBL value, scale;
+
+    if (noise_generator == kNoiseGen_Perlin)
+    {
+        // See PortableNoise() for the magic numbers.
+        scale = 0.5 * 1.59;
+        value = scale * SolidNoiseGradient(EPoint, gradient) + 0.5 * 0.985;
+    }
+    else
+    {
+        DBL x_ix, x_jx, y_iy, y_jy, z_iz, z_jz;
+        DBL sx, sy, sz, tx, ty, tz, dsx, dsy, dsz;
+        int ix, iy, iz, tmp;
+        int ixiy_hash, ixjy_hash, jxiy_hash, jxjy_hash;
+        const DBL *mp;
+
+        tmp = (EPoint[X]>=0)?(int)EPoint[X]:(int)(EPoint[X]-(1-EPSILON));
+        ix = (int)((tmp-NOISE_MINX)&0xFFF);
+        x_ix = EPoint[X]-tmp;
+
+        tmp = (EPoint[Y]>=0)?(int)EPoint[Y]:(int)(EPoint[Y]-(1-EPSILON));
+        iy = (int)((tmp-NOISE_MINY)&0xFFF);
+        y_iy = EPoint[Y]-tmp;
+
+        tmp = (EPoint[Z]>=0)?(int)EPoint[Z]:(int)(EPoint[Z]-(1-EPSILON));
+        iz = (int)((tmp-NOISE_MINZ)&0xFFF);
+        z_iz = EPoint[Z]-tmp;
+
+        x_jx = x_ix-1; y_jy = y_iy-1; z_jz = z_iz-1;
+
+        sx = SCurve(x_ix); tx = 1.0 - sx; dsx = SCurveSlope(x_ix);
+        sy = SCurve(y_iy); ty = 1.0 - sy; dsy = SCurveSlope(y_iy);
+        sz = SCurve(z_iz); tz = 1.0 - sz; dsz = SCurveSlope(z_iz);
+
+        ixiy_hash = Hash2d(ix,     iy);
+        jxiy_hash = Hash2d(ix + 1, iy);
+        ixjy_hash = Hash2d(ix,     iy + 1);
+        jxjy_hash = Hash2d(ix + 1, iy + 1);
+
+        value = 0.0;
+        gradient = Vector3d(0.0);
+
+        mp = &RTable[Hash1dRTableIndex(ixiy_hash, iz)];
+        AddNoiseCorner(value, gradient, tx, ty, tz, -dsx, -dsy, -dsz, mp[1], Vector3d(mp[2], mp[4], mp[6]), x_ix, y_iy, z_iz);
+        mp = &RTable[Hash1dRTableIndex(jxiy_hash, iz)];
+        AddNoiseCorner(value, gradient, sx, ty, tz,  dsx, -dsy, -dsz, mp[1], Vector3d(mp[2], mp[4], mp[6]), x_jx, y_iy, z_iz);
+        mp = &RTable[Hash1dRTableIndex(ixjy_hash, iz)];
+        AddNoiseCorner(value, gradient, tx, sy, tz, -dsx,  dsy, -dsz, mp[1], Vector3d(mp[2], mp[4], mp[6]), x_ix, y_jy, z_iz);
+        mp = &RTable[Hash1dRTableIndex(jxjy_hash, iz)];
+        AddNoiseCorner(value, gradient, sx, sy, tz,  dsx,  dsy, -dsz, mp[1], Vector3d(mp[2], mp[4], mp[6]), x_jx, y_jy, z_iz);
+        mp = &RTable[Hash1dRTableIndex(ixiy_hash, iz + 1)];
+        AddNoiseCorner(value, gradient, tx, ty, sz, -dsx, -dsy,  dsz, mp[1], Vector3d(mp[2], mp[4], mp[6]), x_ix, y_iy, z_jz);
+        mp = &RTable[Hash1dRTableIndex(jxiy_hash, iz + 1)];
+        AddNoiseCorner(value, gradient, sx, ty, sz,  dsx, -dsy,  dsz, mp[1], Vector3d(mp[2], mp[4], mp[6]), x_jx, y_iy, z_jz);
+        mp = &RTable[Hash1dRTableIndex(ixjy_hash, iz + 1)];
+        AddNoiseCorner(value, gradient, tx, sy, sz, -dsx,  dsy,  dsz, mp[1], Vector3d(mp[2], mp[4], mp[6]), x_ix, y_jy, z_jz);
+        mp = &RTable[Hash1dRTableIndex(jxjy_hash, iz + 1)];
+        AddNoiseCorner(value, gradient, sx, sy, sz,  dsx,  dsy,  dsz, mp[1], Vector3d(mp[2], mp[4], mp[6]), x_jx, y_jy, z_jz);
+
+        if (noise_generator == kNoiseGen_RangeCorrected)
+        {
+            // See PortableNoise() for the magic numbers.
+            scale = 0.48985582;
+            value = (value + 1.05242) * scale;
+        }
+        else
+        {
+            scale = 1.0;
+            value = value + 0.5;
+        }
+    }
+
+    // Clamp final value to 0-1 range, where the function is flat.
+    if ((value < 0.0) || (value > 1.0))
+    {
+        gradient = Vector3d(0.0);
+        return clip(value, 0.0, 1.0);
+    }
+
+    gradient *= scale;
+    return value;
+}
+
 
 /*****************************************************************************
 *
@@ -497,7 +546,7 @@ SolidDNoise(const Vector3d& P, Vector3d& D)
 *   POV-Ray Team
 *
 * DESCRIPTION   : Computes a Fractal Brownian Motion turbulence value
-*                 using repeated calls to a Perlin Noise function.
+*                 using batched calls to a Perlin Noise function.
 *
 * CHANGES
 *   ??? ???? : Updated with varible Octaves, Lambda, & Omega by [DMF]
@@ -506,48 +555,50 @@ SolidDNoise(const Vector3d& P, Vector3d& D)
 
 DBL Turbulence(const Vector3d& EPoint, const GenericTurbulenceWarp *Turb, int noise_generator)
 {
-    int i;
+    int i, first, count;
     DBL Lambda, Omega, l, o, value;
-    Vector3d temp;
+    Vector3d temp[kNoiseBatchSize];
+    DBL weight[kNoiseBatchSize];
+    DBL noise[kNoiseBatchSize];
     int Octaves=Turb->Octaves;
 
-    // TODO - This distinction (with minor variations that seem to be more of an inconsistency rather than intentional)
-    // appears in other places as well; make it a function.
-    switch(noise_generator)
-    {
-        case kNoiseGen_Default:
-        case kNoiseGen_Original:
-            value = Noise(EPoint, noise_generator);
-            break;
-        default:
-            value = (2.0 * Noise(EPoint, noise_generator) - 0.5);
-            value = min(max(value,0.0),1.0);
-            break;
-    }
-
-    l = Lambda = Turb->Lambda;
-    o = Omega  = Turb->Omega;
+    Lambda = Turb->Lambda;
+    Omega  = Turb->Omega;
+    l = o = 1.0;
+    value = 0.0;
 
-    for (i = 2; i <= Octaves; i++)
+    // Evaluate the octaves in batches, rather than one noise call at a time.
+    for (first = 0; first < Octaves; first += count)
     {
-        temp = EPoint * l;
-        // TODO - This distinction (with minor variations that seem to be more of an inconsistency rather than intentional)
-        // appears in other places as well; make it a function.
-        switch(noise_generator)
-        {
-            case kNoiseGen_Default:
-            case kNoiseGen_Original:
-                value += o * Noise(temp, noise_generator);
-                break;
-            default:
-                value += o * (2.0 * Noise(temp, noise_generator) - 0.5); // TODO similar code clips the (2.0 * Noise(temp, noise_generator) - 0.5) term
-                break;
-        }
-        if (i < Octaves)
+        count = min(Octaves - first, kNoiseBatchSize);
+        for (i = 0; i < count; i++)
         {
+            temp[i] = EPoint * l;
+            weight[i] = o;
             l *= Lambda;
             o *= Omega;
         }
+
+        MultiNoise(noise, temp, count, noise_generator);
+
+        for (i = 0; i < count; i++)
+        {
+            // TODO - This distinction (with minor variations that seem to be more of an inconsistency rather than intentional)
+            // appears in other places as well; make it a function.
+            switch(noise_generator)
+            {
+                case kNoiseGen_Default:
+                case kNoiseGen_Original:
+                    value += weight[i] * noise[i];
+                    break;
+                default:
+                    if (first + i == 0)
+                        value = min(max(2.0 * noise[i] - 0.5,0.0),1.0);
+                    else
+                        value += weight[i] * (2.0 * noise[i] - 0.5); // TODO similar code clips the (2.0 * Noise(temp, noise_generator) - 0.5) term
+                    break;
+            }
+        }
     }
     return (value);
 }
@@ -576,7 +627,7 @@ DBL Turbulence(const Vector3d& EPoint, const GenericTurbulenceWarp *Turb, int no
 *   POV-Ray Team
 *
 * DESCRIPTION   : Computes a Fractal Brownian Motion turbulence value
-*                 using repeated calls to a Perlin DNoise function.
+*                 using batched calls to a Perlin DNoise function.
 *
 * CHANGES
 *   ??? ???? : Updated with varible Octaves, Lambda, & Omega by [DMF]
@@ -587,30 +638,34 @@ DBL Turbulence(const Vector3d& EPoint, const GenericTurbulenceWarp *Turb, int no
 void DTurbulence(Vector3d& result, const Vector3d& EPoint, const GenericTurbulenceWarp *Turb)
 {
     DBL Omega, Lambda;
-    int i;
+    int i, first, count;
     DBL l, o;
-    Vector3d value, temp;
+    Vector3d value[kNoiseBatchSize], temp[kNoiseBatchSize];
+    DBL weight[kNoiseBatchSize];
     int Octaves=Turb->Octaves;
 
     result[X] = result[Y] = result[Z] = 0.0;
-    value[X]  = value[Y]  = value[Z]  = 0.0;
-
-    DNoise(result, EPoint);
 
-    l = Lambda = Turb->Lambda;
-    o = Omega  = Turb->Omega;
+    Lambda = Turb->Lambda;
+    Omega  = Turb->Omega;
+    l = o = 1.0;
 
-    for (i = 2; i <= Octaves; i++)
+    // Evaluate the octaves in batches, rather than one noise call at a time.
+    for (first = 0; first < Octaves; first += count)
     {
-        temp = EPoint * l;
-
-        DNoise(value, temp);
-        result += o * value;
-        if (i < Octaves)
+        count = min(Octaves - first, kNoiseBatchSize);
+        for (i = 0; i < count; i++)
         {
+            temp[i] = EPoint * l;
+            weight[i] = o;
             l *= Lambda;
             o *= Omega;
         }
+
+        MultiDNoise(value, temp, count);
+
+        for (i = 0; i < count; i++)
+            result += weight[i] * value[i];
     }
 }
 
@@ -619,6 +674,8 @@ void DTurbulence(Vector3d& result, const Vector3d& EPoint, const GenericTurbulen
 
 NoiseFunction Noise;
 DNoiseFunction DNoise;
+MultiNoiseFunction MultiNoise;
+MultiDNoiseFunction MultiDNoise;
 
 /*****************************************************************************
 *
@@ -660,18 +717,22 @@ void Initialise_NoiseDispatch()
         if (pNoiseImpl->init) pNoiseImpl->init();
         Noise = pNoiseImpl->noise;
         DNoise = pNoiseImpl->dNoise;
+        MultiNoise = pNoiseImpl->multiNoise;
+        MultiDNoise = pNoiseImpl->multiDNoise;
     }
 }
 
 OptimizedNoiseInfo gPortableNoiseInfo = {
-    "generic",      // name,
-    "portable",     // info,
-    PortableNoise,  // noise,
-    PortableDNoise, // dNoise,
-    nullptr,        // enabled,
-    nullptr,        // supported,
-    nullptr,        // recommended,
-    nullptr         // init
+    "generic",           // name,
+    "portable",          // info,
+    PortableNoise,       // noise,
+    PortableDNoise,      // dNoise,
+    PortableMultiNoise,  // multiNoise,
+    PortableMultiDNoise, // multiDNoise,
+    nullptr,             // enabled,
+    nullptr,             // supported,
+    nullptr,             // recommended,
+    nullptr              // init
 };
 
 const OptimizedNoiseInfo* GetRecommendedOptimizedNoise()
@@ -83,13 +83,9 @@ const int NOISE_MINZ = NOISE_MINX;
 * Global variables
 ******************************************************************************/
 
-#ifdef DYNAMIC_HASHTABLE
-extern unsigned short *hashTable;
-#else
-extern ALIGN16 unsigned short hashTable[8192];
-#endif
+extern const unsigned short hashTable[8192];
 
-extern ALIGN16 DBL RTable[];
+extern ALIGN16 const DBL RTable[];
 
 
 /*****************************************************************************
@@ -98,17 +94,41 @@ extern ALIGN16 DBL RTable[];
 
 void Initialize_Noise (void);
 void Initialize_Waves(vector<double>& waveFrequencies, vector<Vector3d>& waveSources, unsigned int numberOfWaves);
-void Free_Noise_Tables (void);
 
 DBL SolidNoise(const Vector3d& P);
 
 DBL PortableNoise(const Vector3d& EPoint, int noise_generator);
 void PortableDNoise(Vector3d& result, const Vector3d& EPoint);
 
+/// Evaluates @ref Noise() together with its analytic gradient.
+///
+/// @param[out] gradient        Gradient of the noise function at the given point; zero where the value is clamped.
+/// @param[in]  EPoint          Point at which to evaluate the noise function.
+/// @param[in]  noise_generator Noise generator to use.
+/// @return                     The noise value, as per @ref Noise().
+///
+DBL NoiseGradient(Vector3d& gradient, const Vector3d& EPoint, int noise_generator);
+
+/// Maximum number of points submitted in a single call to the batched noise functions.
+///
+/// @note
+///     The batched functions themselves accept any number of points; this is merely the chunk
+///     size used by @ref Turbulence() and @ref DTurbulence() to evaluate all octaves of a point
+///     at once, and is chosen to cover the maximum number of octaves supported by the parser.
+///
+const int kNoiseBatchSize = 16;
+
+/// Evaluates @ref PortableNoise() at a number of points.
+void PortableMultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator);
+/// Evaluates @ref PortableDNoise() at a number of points.
+void PortableMultiDNoise(Vector3d* results, const Vector3d* EPoints, int count);
+
 #ifdef TRY_OPTIMIZED_NOISE
 
 typedef DBL(*NoiseFunction) (const Vector3d& EPoint, int noise_generator);
 typedef void(*DNoiseFunction) (Vector3d& result, const Vector3d& EPoint);
+typedef void(*MultiNoiseFunction) (DBL* results, const Vector3d* EPoints, int count, int noise_generator);
+typedef void(*MultiDNoiseFunction) (Vector3d* results, const Vector3d* EPoints, int count);
 
 /// Optimized noise dispatch information.
 struct OptimizedNoiseInfo
@@ -138,6 +158,12 @@ struct OptimizedNoiseInfo
     /// Pointer to the optimized implementation of @ref PortableDNoise().
     DNoiseFunction dNoise;
 
+    /// Pointer to the optimized implementation of @ref PortableMultiNoise().
+    MultiNoiseFunction multiNoise;
+
+    /// Pointer to the optimized implementation of @ref PortableMultiDNoise().
+    MultiDNoiseFunction multiDNoise;
+
     /// Pointer to a constant indicating whether the implementation is enabled in the binary.
     const bool* enabled;
 
@@ -177,6 +203,8 @@ const OptimizedNoiseInfo* GetOptimizedNoise(std::string name);
 
 extern NoiseFunction Noise;
 extern DNoiseFunction DNoise;
+extern MultiNoiseFunction MultiNoise;
+extern MultiDNoiseFunction MultiDNoise;
 
 void Initialise_NoiseDispatch();
 
@@ -184,6 +212,8 @@ void Initialise_NoiseDispatch();
 
 inline DBL Noise(const Vector3d& EPoint, int noise_generator) { return PortableNoise(EPoint, noise_generator); }
 inline void DNoise(Vector3d& result, const Vector3d& EPoint) { PortableDNoise(result, EPoint); }
+inline void MultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator) { PortableMultiNoise(results, EPoints, count, noise_generator); }
+inline void MultiDNoise(Vector3d* results, const Vector3d* EPoints, int count) { PortableMultiDNoise(results, EPoints, count); }
 
 #endif // TRY_OPTIMIZED_NOISE
 
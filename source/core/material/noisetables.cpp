@@ -0,0 +1,4922 @@
+//******************************************************************************
+///
+/// @file core/material/noisetables.cpp
+///
+/// Noise generator lookup tables
+/// Auto-generated using metagen-noise.py.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+/// @file
+/// @attention
+///     **DO NOT EDIT THIS FILE!**
+///     Instead, if this file needs fixing, modify metagen-noise.py
+///     or its invocation in `tools/meta-make/Makefile` accordingly,
+///     and re-generate this file as described in @ref tools-metamake (`tools/meta-make/readme.md`).
+
+namespace pov {
+
+extern const unsigned short hashTable[8192] = {
+  2291,2574,3654,1557,1196,3388,2637,1820,2436, 762,2037,3527,1391,3291, 581, 669,
+  1180, 342,2798,2670, 435,2653, 747,2126,1630, 345,3881,1954,2538, 545,1482,3183,
+  1626,1474, 170, 882,3745,2530,3961, 219, 828,2561, 398,1728,2046, 404, 783,2923,
+  1823,3157,3083,3439,1093,1503,1120,3133,2900,3930,1834, 143,2783,1056, 971,3407,
+  3067,1858,3232,2631,2423,3773,1508, 236, 706, 815,1912,3819,1778, 739,1701,4049,
+   225,2452, 720,3378,3177,3366,1517,2941,1985,3987,3238, 854,1044, 784,3541,3921,
+  1127,1464, 448,3721,1305,3132,1042,3268,3290,1833,3235,2540, 679,2496,2222,3247,
+  1000,1461,3043,1490,3255,1810,3709,2245,1702,2386,2862, 770,3833,3435, 411,  73,
+   567,1165, 821,2926,3395,2950,2150,2193,1135,3461,2320,2741,3173,1481,2137,1565,
+  4038,  74,2257,3774,2171,2027,1274, 422,3920,2778, 113,2375,  25,1764,1233,2654,
+  2684,1495,3113,1754,3555, 812,1787,1727,2505,3620,3087, 842,1223,3891, 612,4022,
+  3949, 378, 621,1668,1709,1582,3609, 381, 970,2104,3387,3433,3530, 482, 144, 338,
+  3018,2790,3877,1860,1045,1854,1990,2589,2073,  71,2695,  12,2509,2016,2054,2344,
+  1317,2426,3696, 368,3215,1841,2928,1169, 124,2946,3455, 253,1602, 101,1122,3539,
+  1427,1118,3653,  87,1356,1603,3552, 399, 712,1691,3454, 980, 182, 105,2412,3739,
+  2339,1554, 565,3365,3129,1953,3629, 597,2776, 913,3430,2921,2188, 370, 682,2354,
+  2730,3982,3859, 900, 429, 731,3058,2130,1370,4078,3954,3211, 604,3669,2152,3244,
+  1185,2893,3677,1249,1720,1466,3808,3301,   2,1374,1364,3039,3202,3611,3644,3732,
+   374, 820,2903,1316,4012,1836,2688,1083,3791,3570,3525,2197,1414,1644,2765,2673,
+   212,2201,3416,3668,3912,2766,1208,   6,3263,4040,1314,1650,2533,3094, 463,3809,
+    78, 281,1368, 133,1234,2726,  70,3465,4035,2251,2752,1408,2881,1916,1955,1742,
+    66,1573,2470,2289,1591, 879,  65, 564, 596,3884,3171,1267,1663, 958,2468,2177,
+  1082,3875,3727, 961,3593,1087,3131, 639,  80, 786,3704, 462,2030,3866,3107,3164,
+  3032,2437, 798,2267,1799,2792,2859,2474,3374, 687,3140,1894,1308,3381,1763,3163,
+  3326,1320,2938,2250,4095,2018, 307, 531, 111,2189,3012, 432,1896,3068,3522,2662,
+  2853, 736,3813, 532,1878,3510,1211,2306,3911, 610,1797,2816,1555,2909,2531,1256,
+  2782,3516,3020,  63,1073,3948, 297,2164,3577,4036, 248,2535, 293,2153,1091, 433,
+  1533,1423,3071,2777,3567, 246, 126,3662,3851,2398, 519,1271,1768, 290,1064,2749,
+  1961, 315,3521, 516,1874,4002, 327, 794,3826,3934,  92,1186,2660,3814,3184,1791,
+  1513,2092,2656, 480,3486,1567,3121,3733,3008,2311,1634, 384, 640, 420,3035,3870,
+  2773,3737,1545,2102,2769, 296,  61,3498,3490,2185,2555, 866,2492,2286, 103,3895,
+   807,4007,3361,3511,3123, 211,4045,3543, 808,1285,3540, 358,1158, 725, 441,  26,
+  3513,3252,1887,3534,2697, 876,1151,3533, 990,1143,1252,3420,1502,1862, 119,3503,
+  3693,1637, 277, 132,  15, 122,3495, 121,1708,1041, 688,1796,  86,2640, 891,1785,
+  3026,1430,2329,1212,2216,2203,1784,2537, 446,1534, 165,1392,3873,1544,2434,1776,
+  3835, 291,3619,3673, 547, 691,2818, 884, 299,3936,3953, 698,1396,3578,2089, 663,
+   456,1381,3367, 310, 371,2281,1723,2762,2724, 460,3000,  33,2680, 916,2843,2179,
+  3440,1181, 239,1286,3467,2727,2006, 587,2690,3664, 992, 169,3924, 501, 361,2666,
+  1137, 870,3923,3818,3191,1354,1526,2823,1761,2754, 963,2945,1065, 424,2627, 509,
+  2772, 205,1741,3105, 257,1451,4067,  21,3999,1871, 877,1418,2618,3715, 331, 627,
+  1992, 606,2349,2713,2979, 359,4050,1476,3531,2475,3090,1086,2200,1024,2972,1931,
+  2183,1347,3630,1775,1492,2785, 601,1934,2638,1935,3914, 593, 223, 199,3720, 513,
+  1539, 235,2563,3331, 414,2238,1031,1489,1673,3575,1767,1631, 676,3003,3741,4059,
+  1633,3594, 616, 123,2889,1850,1166,2100,2572,3556, 125,2996,3348,  13,3031,2132,
+  3940, 324, 210,1330,1170,1939,1575,  34,3329, 833, 260,1442,1350, 649,3399,2808,
+  1377,2058,2230,  36, 653,1297,1244, 909,2236,2244,3867, 628, 814,3167,   8,2519,
+  2401, 625, 996,1304, 594, 667, 986,1434,3968,3792,3939,1652,3101,3944,1199,3975,
+  3887,3448,2545,3474,1115,1560, 912,3526,3443,3918, 487,2532,2272,2364,1017,2317,
+  2676,2081,3768, 447,1497,2707,2613,1586,3903,3135,1736,  39,2573,3603, 483,3730,
+  3806,2838,1505,3631,1039,1291, 175,1052,2683,3007,3293,3606,2821,1683,2701, 104,
+   201,  62,3854,2623,1275,2877,2465, 723, 985,1130,3358,2284,1531,2868,3222,1054,
+  4000, 492,1116,3591,3610,2936,  18,1357,3266,2655, 372,2226, 107, 822,2097,2015,
+  1133,3576,2963,2520,1090,2914, 527,3108,2479,1983,4005,3908,3988,2957, 136, 623,
+  4021,3059,3782,3909,1855,1898, 880,2781,3692,1597,2204,3572, 888,2458, 765, 306,
+   305,1991,3341, 959, 161,3212,2559, 552,  91,2896,1725,1486, 619, 930,3878,2129,
+  2596,3070,2725, 714,3993, 568,3245,  48,1813,1737,3569,2583,2314,2242,2897,3180,
+  3425,3750,2919,2140, 258, 512,3414,1477,1345, 893,  77,2294,1134,1457,1406,3970,
+  1173, 314, 865,3236,3641,2567,2450, 728,1488, 100, 115,3871,  96, 960,2312, 289,
+  2208, 252,2324,3565,3369,1203,2794,1542,2441, 198,1793, 838,3998,3081,3801, 875,
+  1213, 830,1969, 320,3957,2379,1506, 615,3492,1606,3422,3441,3559, 759, 874, 863,
+   318,1111,2255, 227,2984,3002,2920,3092,2927,2958,1226,2992,1892,3179,2290,2528,
+  1258, 827,1690,3025,2369,3174,1441,  27,3821,3751, 167,3916,2757, 410,1243, 592,
+  1480,1075, 539,1425, 803, 326,1328,2425, 835,2146,1055,4094,3126, 362,1178,1197,
+  1595,1697,1585,1625,3906,1966,2218,2924, 735,2112,3843,1838,3118,1277,1977,2763,
+    69,3469,3112,3646,2587, 240, 272,3250,3517,2033,3436,3781,2658,2906,1202, 853,
+  2960,1881,1107,2524,2082,3564, 831,1218,3049,1747,2801,1013,1230,2039,1789,3665,
+  1734,1144,1047,1875,2136, 983,3761, 697,3418,2055,1412,3772, 158,2809, 221,4009,
+  1635,2247,1927,2365,2167, 885,1262, 624,1978,1740,2105,1182,3700, 801, 178,2194,
+   308,2848,3844,4056,3279,2228,1020,3427,1614,2768,3016, 336,1227,2077,1732,2447,
+  2124,1845,3586, 633,3925,2544,  49,2182,3770,2566,3926,1936,1108, 661,2056,  41,
+  1146, 301,2385,2486,3317,3701,1519, 311,2032, 226,1817, 824,3299, 431,2297, 489,
+  1818,2427,2232,2849,3789,3830,1914, 357,3805, 952, 785,3742,3682,2459, 719,3219,
+   582,3913, 647,3840,1397, 515,2973,1009,3588,1411,3566,3990,2118,2539, 562,2892,
+  2273,1106,2858, 903,3856,2151, 151,2716,2971,1662,1188, 560, 203, 826,2607, 168,
+  1885,3127,2225, 551,2358,4053,3980, 757, 231,2478,1739,3027, 471,1241, 544,3072,
+   611,2166,  58,1944,1731,1812,1803, 185,3172,3260, 139,1117, 705,3651,3827,2383,
+   642,1280,2481,3052,2983,2350,3710,1590,1948,2347,2895,1102,2047,2088,3625,3198,
+   707,1876, 964,1645,3462,1851,3985, 571,1067, 538,2007,4058,2322,2011, 379,1076,
+  1719,3373,2758,3681,1224, 427,3289, 283, 574, 566, 529,3156, 408,1706,3991,3269,
+  1659,2156,1018,4060,1119, 267,2863,1300,1194,3563, 715,2363, 540, 477, 790,3431,
+   632, 918,3969,3196,1037, 407,3278, 249,2433, 352,2048, 919,2780, 577,2547,3758,
+     3,2161, 614, 847, 805,1601,3307,4019,1069,   7,1097, 695,2260,3201,1268,2139,
+   746,1424,1340,2476,1840,2548,3976,2751,3162, 467,  11, 924,3711,3584,3800,1413,
+   772, 792,2944,2268,2327, 222,1390,1287,3438,1616, 430,2913,4051,2651, 650,2223,
+   265, 234, 542,1421,1437,3523,1288,2404,3876,2800,2571, 603,3848, 643,2885,1470,
+   465,2031,1232, 745,3579,1210,4023,1984,1074,1235,1592,3524, 340, 351, 977,3597,
+  1129,3956, 550, 789,1821,2064,2861,2835,2019,2285, 106,1085, 605,1446, 771,2674,
+   518,3014, 708,1236,3024,3033,2390, 954,1351, 956, 656, 160,2586, 773, 380,2044,
+  2704,3261,1353, 453,3483,1868,3010,  47,1096,3684, 472,3253,1407,3890,1021,2925,
+  1801,2880,3119,1260,1322,2315,2803,3904,2248,2917,3297,1293, 275,3898,3169, 181,
+  3038,2499,  75,1643,1746,1857,1549,1081, 354, 271,1500,3613, 216, 344,2954,2599,
+  3902,2497, 159,3055,  16,1774,3432,3823,1004,1546,  23,3122,3106, 920,2370,4008,
+  3778,1988,2819,2444, 887, 180,2376,2522,1587,3339,3508,3645,1040, 966,4025, 207,
+  3984, 829,1964,1177,1080,2005, 809,3679, 502,1459, 767,3981, 466,1145,1113,3568,
+  1685,2041,2331,2826,1359,1028,3784,3852, 872, 758,2219,2851,2128,2410,3743,3722,
+  1556, 641, 576, 671, 570,3671,1284, 224, 128, 406,2445,2310,3302,3473,2525,2581,
+   689,1805, 535, 787,1918,2553,1981, 636,2797,2736,3097,1599, 206, 871,3869,2740,
+   388,3257, 630,2516,2669,3336,3380,4071,1001,3687,2511,1543,1084,1334,3130,2668,
+  2113,4014,1048, 386,3456,1440, 337,1744,2788,2733, 365,3842, 284,2083,3190,2121,
+   776, 779, 421,4028,3905,1976,1428,3412,  83,1276, 598,3638,1057,3811,4044,2175,
+  3220, 259,1160, 479,3017,3221,3449,2990, 936,2692,2309,1824,2045,3602, 450,3589,
+    67,1712,1524,1594,3030,2483,1124,3214,2705,1671, 580,1147,3937,3340,1891,3273,
+  3181, 278,2872,3860, 973, 522,2723, 442,3865, 418,2428,2463,  20,1572, 774,4043,
+  2498,1925,1105,2731, 486,1501,  85,3707, 917,2644,1261,3046,1957, 440, 332, 508,
+  4032,3006, 802, 572, 591, 397,1383,3386,1296,1142,  37, 208, 949, 635,2635,3889,
+  2852,1217,2652,3056,4046,3963, 506,3050,2507,3421,2735,3702,2013, 295,3295, 174,
+  2682, 962,1550,1035,3063,3678,2610,1615,2413,1449, 678,3962, 629,4010,3327,1589,
+  2024,3680, 131,3992,1804, 177,1664,2753,2706,1640,1468, 907,  38, 237, 791,1253,
+   915, 953, 110,1398,1772,3144,1315,1995, 965, 716, 703, 204,1548,2875,2508, 190,
+  3997,2584,3573,2955, 991,  29,2249,3057,2689,1996, 251,1809,1937,1622,1564,1128,
+  2029, 683,  82,2714,3862,2642,1027, 220,3635,2371,3434,4015,1221, 800,3604,1636,
+  1693,  45,2696,2929,3343,3685,3655,3777,1758,4011,1393,3064,2299, 469,1007,3350,
+  3315, 648, 156, 748,1613,2815,3639,3265,2402,  22,2560,1921,3371,3941,3450,3979,
+   192,2120,1605,3259, 241,3769,2500,3270,2514,1959,2103, 862, 238, 528,1558,1839,
+  1870,2001, 188,1030,2554,3217,1402,3458,2473,2184,3666,2160, 554,3151,3698,2750,
+  2734,1717,3154,2440, 444,2918, 975,3100,1172,2831,1535,2844,2060,3335, 393,2986,
+   579, 652,3943,3994,3294,1455,2418, 662, 183,1138,1010,1193,  79,3311,2190, 176,
+  2131,2977,1779,1947,3497, 470,2916,2318,   5,1865,3647,1569,2034,1600, 684,1309,
+   933,1205,3251,3138,3689, 989,3520, 718,1174,2173,1946,1718,1365,2252,2899,1568,
+  2879,1220,1341,3176,1167, 928, 245,1159,1657, 343,2211,2970,3351,1496,2342,2564,
+  2335,1830,1609,3197,1439,3729, 309,3408,2698, 288,4055,1140,4074,1889,3397,1329,
+  2847, 927,2442,1450, 548,2487,3716,2650,2910, 894,1104,1467,3464, 892,1022,2626,
+  1538,3415,2361,2145,2389,2602,2326, 215,1448,3080, 701, 609,3974,1141, 673,1638,
+  1403, 261,3683, 896, 229,1384,1672,2066,1132,1827,2935,3755,1612, 832, 268,2259,
+  1667,2771,1956, 468, 948,2770, 613,2472,1487,2799,2884, 743, 184,2355,1982,1444,
+  3466,2912,1136, 968,3776,2805,2866,1997,3950, 451,1675, 988,2439,3896,3967, 578,
+   360, 476,3740,3310,2593, 557,1703,1743,1371,1559, 155,2671,1753,3377,3284, 766,
+  2806,1460, 503,1922,2455, 744,2873,3822,3309,3241, 686, 138,1187, 108, 704,2367,
+  3042, 526,  52,2191,2719,3888,1814,3775,1255, 312, 840, 793,2720,3853, 292,3617,
+  3580, 837,3304, 263,2332,3246,3475, 626,3085,1191,3695,1363,1471,2833,1387,1577,
+  1184,4063,2209,1566,1465,3044,2894, 569, 897, 534,2932,3500,3783,  43,3185,1375,
+  2722,2953, 922,1331, 377,3277,2017,2974,1794,2902, 929, 951,1008, 449,3472,2568,
+  3590,1032,3959,3444,3093,2934,1070,1088,1273, 947,1110,1333,2221,4077,2796,3583,
+  1897,2362, 134,2577,3089,1342,3656,3182,3143,3857,1462,2256, 438,1580,2491,3231,
+  3360,1002,2384, 709,4004,1380, 347, 914, 302, 152,2217,1822, 325,3337,1899,  95,
+  3402,4029,3507,1929,1864, 541, 173,   1, 464, 905,1139,3688,2712, 426,1114,2422,
+  3496,3370,1189, 495,2050,1307, 823,3802,2036,3206,4031,2501,2784, 194,3763,2471,
+  2657,3051, 634,1835,  10,1730, 109,1972,3719,2448, 898,3013,2302,1704, 851,3404,
+  3599,2231, 890,1025,1971,4013,1596,3488,2067,1913,2155,3318,1621,3933,3831,1782,
+  2964,3484,1043,1229,3632,3661,3767,1940,1429, 402,1409, 298,2829, 937,1302, 868,
+  2038,2438,1962,4066,1807, 595,3332, 969,1958,3305,1829,2678,4027,2002, 247,3296,
+   846,1678,2195,1679,2087,  81, 950,1228,3927,1422,2025, 520, 856, 857,3738,1222,
+  1651,4089, 321,3459,2856,1593,1098,1993,2229,3724, 955, 839,2933, 908, 855,1310,
+  3237, 164, 873,1561,2456,  98,1655, 799,3357, 899,3799, 537,1023,3029, 724,3766,
+  3960, 481,1292, 732,3447,3663,3128,1658,1038,2681,3041,2283,1161,1938,3955, 171,
+  2980,1454, 395,2348,3372,  55,  51,3562,2867,1903,3825,2141,1866, 400,1498, 149,
+  1530,2282,3096,2748,1722,2235,2694, 536,  30,2675,1552,2078,3248,3011,2316,1179,
+  2253,  35, 439,1473,1066,2323,1019,1863,1379,1786,2804,2466,2482,3810,1214,1933,
+  1816,2040,3194, 436,4020,1410,1005,1907,1895,3233, 674,3153,3935,1281,1726,3445,
+   670,1540,1661, 452, 768,2685, 859, 559, 202,1318,1745,3320,4030,1247,3760, 910,
+  3964,1904, 740, 425,3037,1695,2576,2205, 967, 788, 145, 836, 906,1654,1781, 721,
+  1713,3686, 391,1979,3368,3285,1346,1123, 130,3787,2202,3405,1485,2824,1478, 323,
+   925, 172,2313,2630,2305, 349,2271, 494,3468,3155, 644,1752, 733,2353,2832,3616,
+  2042, 505, 987, 926,3482,2562,3855,1574,1681,1201,1033,1239,1312,2122,1532,1579,
+  1522,2825,2807,3353,  44,3303,1514,2057,3901, 637,1257,1639,2841,1859,2407, 602,
+  1853, 193,2181,2615,4052,4062,2820,1826,2416,3189,2521, 369,2063,3838, 994,1795,
+  1242,1738,3099,2158,1905,1156,2882,2876,  94,2870,3836,3098,1491,2608,1469,2612,
+  3505,3428,2334,3401,3752,1034,3512,3411, 944,2110, 319,3790, 394,3628,1511, 622,
+   118, 878, 303, 356, 195,1366,2237,2411,1367, 497,2502,3493,1121,1619,1692,1195,
+  3352,1714,3040, 780,3621,1760,2998, 946,1246,4033,1715,  88,2966,3907,3708, 921,
+  2488,  40,1624, 525,1666,2409, 493,1628, 287, 233,2443, 817,1176,3390,2065,2287,
+  2888, 403,3160,1686,2274, 681, 889,1808,  19,2091,3882,1463,2270,3494,2356, 491,
+  2679, 680,2296,1949,1415,2617,2227, 218,2169,2319, 693,3384,3034,1126,2451,1611,
+  1973, 264,2243,2915, 478, 645,1837,2176, 825,1155,3023, 333, 777,1751, 617, 413,
+  1570,3502,2930,2357, 843,4082,1099, 795,1536, 834,2406,2381,3147,3788, 672,2580,
+  3453,1238,3557,1989,3892,1298,2767,1687,3986,  24,3623,2336,3545,  72, 932,2513,
+   150,3504, 141,3256,1770, 575,3283,2887,3476, 911,1395,3697, 504,1290,1100,2116,
+    97,3642, 655,2834,3509,3413,2737,3272,2629,4048,1790,2142,3347,1819,3824,1847,
+  1749, 389,2431,2628,3978,2262,3618,3161,3558,1721,  60,1289,3546, 186,1509,3227,
+   618,2836,2298,3286,2269, 692,3216,3146, 588,3409,3209, 754,1264,  89,3165,3880,
+  2119,2485,3812, 600,1906, 285, 485,4070, 415,3690,1632, 392,2715,1792, 775, 273,
+   750,2241,3423,2213,1494,1604,1092,3103, 304,3417,1780,3429,3595,2127,2395,3834,
+  1919,1867, 484, 813,2408,3396,2098,2430,4079, 869,1049, 242,2143, 818,1798,1952,
+     4,2664,3754, 675,3333,  31,4039,2523,2457,1164, 658, 230, 500,3376,2813,1369,
+   350,3931,3879,2419,1299, 475, 816,1015,2340,3757,2074,1443,3785,1773, 517,2898,
+   282,2774,2424,4042,3137,2345,3841,2174, 734,4091,2461,3009,3319,2300,1950,2600,
+  3585,4093,3053,1419, 781, 200,2414, 563,1707,1811, 543,2277,3054,2352,3470, 646,
+  4090,1254,1373,2123,2233,1648,2043,2795,2149,1755,1325, 428,1684,2405,1479,1386,
+   127,2453,1856,2526,1623,1071,3650,3275,1060,  53, 213, 608, 214, 255, 997,1301,
+  2931,1553,1562, 459,2962,1059, 755,2159, 116,1584, 811,  64,2624,3226, 416,2546,
+  3718,1844, 401, 749,1521,3780,4018,2814,3243,1656,2187,2086,1987, 810,2377,1152,
+  1360,2330,3535,1930,3694,3262,2009,2732,2106,1941,1445,2076,1355, 474,1680,2380,
+  2871,4065,1646, 738,1724,2096,2942,1676,3643,1344,3359,3972,1525, 558, 454,1062,
+  1103,1649, 507,3077,1388, 620,  90,1729,2467,2417, 373,2265,3929,1653,2429,1332,
+  2138, 940,2393,3519,2095,1051,2693, 999,3150,4064,3627,2117,3136,2677,1968,2952,
+  1510,1338,2711,3861, 727,2094,1385,1617,1348,2830,1095,2075,  14,2700, 364,1432,
+  2709,3815,2261,2968, 129,2605,3592, 651,2601,2967,2021, 700, 166,2961,2827,3983,
+  2764,3615,2196,3624, 458,1339, 982,2186, 163,2264,2911,2070, 631,2144,2940,2634,
+   334,2469,3820,2609, 665,2397,1456,2403, 806,2542,1900,1861,3229,2125,2534,2742,
+  1647,1699,2717, 280,3614,2214,3316,2220,1527, 778,3403,2374,1046,3228, 382,1216,
+  2084,3195,2343,3344, 585,1893,3149,3917,3560, 729,1321,  54, 696,2028, 995,3544,
+  1974,2839,1576,2224,2556, 457,2606,1326,2686, 409, 751,2333,3364,3675,2989,3832,
+  2490,1975,2982, 867,3015, 473, 939, 530,1882,2995,1337,1688,3471,3528,2721,1831,
+     0,1499,2266, 499,3356,2079, 861, 300,2388, 895,1970,2855,3995,2212,1815,1250,
+  3178,3073,1198,2435,1225, 886,1660,2010,2956,3549, 668,4088, 274,3213,3240,3355,
+  3111,1382,1101,2157,3084,1458,3487,  42,1750,1802, 120,1306,1362,1608,3362,2372,
+   938, 848,3607, 488,  68, 197,1282,1765,2301, 146,1279, 533,2168,3287,1157,1089,
+  2515,4041, 699,2493,3274,2672,3095,2886,2622,1078,2633,2702,2165,2341,3514, 713,
+  3382,1710,1036,2991, 935,1206,  57,2134,4016,3187,1665,1620,3705,2549,1920,1012,
+   841,1563,1843, 984,2907,1998, 209,1029,3977,2857,1832,2421,3451,3633,2891,2812,
+   904,2981,2199, 366,3036,4086,3062,2170,2939,2008,2111,1323,2728, 685, 850, 849,
+  3280,2646,1523,3005,3148,3846,1884,1190,2993,3748,2351, 417,1026,1094,3115, 742,
+  2359,1266,2747,2558, 599,1777,1515,3899, 607,1852,3660,2565,1270, 860,1842,2172,
+   763,3288, 945,3676,1902,1416,2550,3134, 730,3086,3928,1910,1431,1769,1245,3392,
+  1475,2263,2937, 328,3965,2280,2288, 294,  84,1682, 157,3254,3019,3753,3079,3996,
+  2703, 654, 498,1670,3670,3322,1883,  17,2133,3779,3762,2810,3786, 135,2307, 756,
+  2661, 154,3587,2817,3759,2192,1405,1295,2649, 443, 934,2579,2378,1319, 322,2616,
+  1283,2454,2328,1541, 148,3796, 346,2069,1014,2020,2854,2292, 782,1951, 232,3501,
+  1231, 437,1788,1389,3571,1960,3203,3756,1079, 737,3001,1529,1598,4080,1063,2480,
+  2536,1879,2621,4076, 694,2761,3312,2997,1716,3795, 279,3205,1006,1400,2303,2446,
+  2636,1928,3223,3410,1588,1877, 317,2639, 313,3529,2746,1265, 717,3798, 412,1748,
+  1215,3375,2699,3460,3807,1759, 329,3239,1711, 769,2994, 976, 445,1452,2180,1003,
+   998,3747, 191,3168,1263, 187,2308, 638,3224,2842,1581,1493, 864,2779,1168,1986,
+  2051,1394,3325,1131,3725,  50,1733,3193,1209,2246, 375,3691, 702,2068,3028,3515,
+  2023,3648,2529, 405,2154,2604,2619,3659,1869,2278, 142,3065,3485, 254,2420,1872,
+  3398, 711, 881,2062,2786,3731, 726,1945,2276,1401,1061,3207,2360, 243,2035,2462,
+  1125,2802,1849,3045,3958,1528,1311,2527,3276,1520,2738,4026, 244,1700,2391, 335,
+   845, 974,2012,1072,1806,2551,2663,2346,1154,3426,4072,4047, 660,2415,1909, 972,
+  3477,2464,3804,2061,4017,2557,3480,  93,3897,2659, 137,3328,3074, 348,3391,2744,
+  1518, 455,2987,3192,3271,3706, 666,2503,1109, 353,3175,3622,4075,3188,1917, 523,
+  3282,2828,2729,2901,1537,1399,2760,3764,  32,2585, 269,3658, 147,3794,3652,3672,
+  3334,1240,3499,3117,3803,3932,2883,2495,3021,3657, 434, 931,2860,3886,  46,  99,
+  1358,2691,2258,3300,2512,3208, 217,3829,3966,3945,1943,2239,2387,1259,1848,3394,
+  2504, 339,2791,2147,1336,2845,3735,3218,1846,1618,3345,3069,3281,3714,2620,2591,
+   923,3139,3446, 978,1669,3900,2215,2755,1219,2337,2049,1994,2109,1583, 112,4092,
+  3125,3066, 573,2293,3726,  28, 262,3457,2449,1698, 764,2603,3893,2400,3491,2975,
+   390,2575,2093,3152,1248, 556,2198,1050,3258,4084,1162,2904,2338, 943,4001,2718,
+  1735,3874, 722,1327,2570,3166,3973,2163,3532,1771,3858,2976,3400, 376,3489,2687,
+   189, 844,2489,3225,1068,3553,1901,1417, 196,3537,3298,1694,2756, 760,2210, 957,
+     9,2789,1438,3922,2595,1924,1999,1171,2588, 852, 590,2592,2625,1607,2793,3264,
+  3145,1571,1426,2178,2632, 341,2908,1207,3200,2368,2026,1880,3142,2569,2969,3078,
+  2517,4061,3626, 355,2014,1378,1483, 256,2710,3076,2148,3324,3124,3060,2275, 330,
+  3649,2115,1343, 385,1148,2304,1349, 102, 741,2107,3637,3091,3424,2541,3442,1420,
+  3330,2869,2948,3116,1757,2207,2477,2072, 804,3634,3612,4081,2905,1629,3636,2822,
+  4085,2321,2922,2484,1484,3847,1192, 659,4006,2518,2743, 490,1436,1313,3082,3383,
+  4003,3321,3868,3989,3542,1011,3793, 657,2846,1756,2811,3736,3946,3379,2614,3437,
+  1150,1696, 511,2114,3242,1204,4068, 524,2837,3765,3249,3338,3308,3170, 690,2108,
+  2090,1504,3574,3109,1447,3885,1610,3547, 363,1372,1376,2399,3667,1762, 942,3506,
+  2254,4083,3022,1112,2162,3872,4037,4054,3605,1932,2003,1800,1825,1908,3004,1627,
+  1058,2052, 583,1200,2392,3554,3828,2708,2951,2598,1361,3550,1965, 179,3919, 114,
+  3159,2594,2745,2099,3204, 266,3674,2965,1472,2667,1516,2850,1674,3548, 858,1578,
+  1453,2510,3551,3210,3141,2234,3894, 546,1915,3712,2552,1335, 819,3314,  76,3075,
+  3234, 521, 423,2295,3313,3598,2947,2578, 514,1278,2739, 586, 461,3910,1828,3864,
+  3518,1911, 153,1926,1873, 510, 387,2432,3114, 883,3342,2890, 286, 710,1016,3703,
+  3389, 796,3817,3850,2543,4087,3582,1641,2611,1149, 549,1942,2366,2988,3845,2582,
+  1163, 140, 901, 276,2874,3771,3346,3047,2325,3723,3797,2597,2080, 250,3363,3385,
+    56,2865,2101,2959, 553,2135,3349,1886,3463,2396,4069, 162, 584, 396,3863,1923,
+  1507,3536,2641,1435,1980,3713, 589,  59,1352,3230, 981,3915,3048, 316,2999,3199,
+  3102,3717,3110,1183,2878,1175,3947, 496,2943,1783,2460, 902,2840,3479,2665, 797,
+  1294, 761,3561,3942,3608, 664,3478,2759,1269,2206,4034,1890,3640,3749,1677,2240,
+  3481, 561,2647,1888,1689,1077,1642, 383,3600,2085, 419,3699,2949, 228,1153, 555,
+  3104,4024,3952,2279,3601,1433,3406,3581,1303, 979, 677,3452,1705,3538,2059,2004,
+  3354, 270,4057,3323,2022,1967,2053,3393,1512, 752,3186,2985,3728,2864,3306,3158,
+  2590, 993,3883,3837,2071,1053,3839,1766,1547,1272,1551,3120,2394,2506,3951,2373,
+  2648,3746,3596,1963,3419,1251,2787,2978,3744,1237, 367,2382,2643,4073,1324,2645,
+  3292,2000, 117,3938,2494,3971, 941,1404,2775,3849,3061, 753,3734,3267,3816,3088,
+  2291,2574,3654,1557,1196,3388,2637,1820,2436, 762,2037,3527,1391,3291, 581, 669,
+  1180, 342,2798,2670, 435,2653, 747,2126,1630, 345,3881,1954,2538, 545,1482,3183,
+  1626,1474, 170, 882,3745,2530,3961, 219, 828,2561, 398,1728,2046, 404, 783,2923,
+  1823,3157,3083,3439,1093,1503,1120,3133,2900,3930,1834, 143,2783,1056, 971,3407,
+  3067,1858,3232,2631,2423,3773,1508, 236, 706, 815,1912,3819,1778, 739,1701,4049,
+   225,2452, 720,3378,3177,3366,1517,2941,1985,3987,3238, 854,1044, 784,3541,3921,
+  1127,1464, 448,3721,1305,3132,1042,3268,3290,1833,3235,2540, 679,2496,2222,3247,
+  1000,1461,3043,1490,3255,1810,3709,2245,1702,2386,2862, 770,3833,3435, 411,  73,
+   567,1165, 821,2926,3395,2950,2150,2193,1135,3461,2320,2741,3173,1481,2137,1565,
+  4038,  74,2257,3774,2171,2027,1274, 422,3920,2778, 113,2375,  25,1764,1233,2654,
+  2684,1495,3113,1754,3555, 812,1787,1727,2505,3620,3087, 842,1223,3891, 612,4022,
+  3949, 378, 621,1668,1709,1582,3609, 381, 970,2104,3387,3433,3530, 482, 144, 338,
+  3018,2790,3877,1860,1045,1854,1990,2589,2073,  71,2695,  12,2509,2016,2054,2344,
+  1317,2426,3696, 368,3215,1841,2928,1169, 124,2946,3455, 253,1602, 101,1122,3539,
+  1427,1118,3653,  87,1356,1603,3552, 399, 712,1691,3454, 980, 182, 105,2412,3739,
+  2339,1554, 565,3365,3129,1953,3629, 597,2776, 913,3430,2921,2188, 370, 682,2354,
+  2730,3982,3859, 900, 429, 731,3058,2130,1370,4078,3954,3211, 604,3669,2152,3244,
+  1185,2893,3677,1249,1720,1466,3808,3301,   2,1374,1364,3039,3202,3611,3644,3732,
+   374, 820,2903,1316,4012,1836,2688,1083,3791,3570,3525,2197,1414,1644,2765,2673,
+   212,2201,3416,3668,3912,2766,1208,   6,3263,4040,1314,1650,2533,3094, 463,3809,
+    78, 281,1368, 133,1234,2726,  70,3465,4035,2251,2752,1408,2881,1916,1955,1742,
+    66,1573,2470,2289,1591, 879,  65, 564, 596,3884,3171,1267,1663, 958,2468,2177,
+  1082,3875,3727, 961,3593,1087,3131, 639,  80, 786,3704, 462,2030,3866,3107,3164,
+  3032,2437, 798,2267,1799,2792,2859,2474,3374, 687,3140,1894,1308,3381,1763,3163,
+  3326,1320,2938,2250,4095,2018, 307, 531, 111,2189,3012, 432,1896,3068,3522,2662,
+  2853, 736,3813, 532,1878,3510,1211,2306,3911, 610,1797,2816,1555,2909,2531,1256,
+  2782,3516,3020,  63,1073,3948, 297,2164,3577,4036, 248,2535, 293,2153,1091, 433,
+  1533,1423,3071,2777,3567, 246, 126,3662,3851,2398, 519,1271,1768, 290,1064,2749,
+  1961, 315,3521, 516,1874,4002, 327, 794,3826,3934,  92,1186,2660,3814,3184,1791,
+  1513,2092,2656, 480,3486,1567,3121,3733,3008,2311,1634, 384, 640, 420,3035,3870,
+  2773,3737,1545,2102,2769, 296,  61,3498,3490,2185,2555, 866,2492,2286, 103,3895,
+   807,4007,3361,3511,3123, 211,4045,3543, 808,1285,3540, 358,1158, 725, 441,  26,
+  3513,3252,1887,3534,2697, 876,1151,3533, 990,1143,1252,3420,1502,1862, 119,3503,
+  3693,1637, 277, 132,  15, 122,3495, 121,1708,1041, 688,1796,  86,2640, 891,1785,
+  3026,1430,2329,1212,2216,2203,1784,2537, 446,1534, 165,1392,3873,1544,2434,1776,
+  3835, 291,3619,3673, 547, 691,2818, 884, 299,3936,3953, 698,1396,3578,2089, 663,
+   456,1381,3367, 310, 371,2281,1723,2762,2724, 460,3000,  33,2680, 916,2843,2179,
+  3440,1181, 239,1286,3467,2727,2006, 587,2690,3664, 992, 169,3924, 501, 361,2666,
+  1137, 870,3923,3818,3191,1354,1526,2823,1761,2754, 963,2945,1065, 424,2627, 509,
+  2772, 205,1741,3105, 257,1451,4067,  21,3999,1871, 877,1418,2618,3715, 331, 627,
+  1992, 606,2349,2713,2979, 359,4050,1476,3531,2475,3090,1086,2200,1024,2972,1931,
+  2183,1347,3630,1775,1492,2785, 601,1934,2638,1935,3914, 593, 223, 199,3720, 513,
+  1539, 235,2563,3331, 414,2238,1031,1489,1673,3575,1767,1631, 676,3003,3741,4059,
+  1633,3594, 616, 123,2889,1850,1166,2100,2572,3556, 125,2996,3348,  13,3031,2132,
+  3940, 324, 210,1330,1170,1939,1575,  34,3329, 833, 260,1442,1350, 649,3399,2808,
+  1377,2058,2230,  36, 653,1297,1244, 909,2236,2244,3867, 628, 814,3167,   8,2519,
+  2401, 625, 996,1304, 594, 667, 986,1434,3968,3792,3939,1652,3101,3944,1199,3975,
+  3887,3448,2545,3474,1115,1560, 912,3526,3443,3918, 487,2532,2272,2364,1017,2317,
+  2676,2081,3768, 447,1497,2707,2613,1586,3903,3135,1736,  39,2573,3603, 483,3730,
+  3806,2838,1505,3631,1039,1291, 175,1052,2683,3007,3293,3606,2821,1683,2701, 104,
+   201,  62,3854,2623,1275,2877,2465, 723, 985,1130,3358,2284,1531,2868,3222,1054,
+  4000, 492,1116,3591,3610,2936,  18,1357,3266,2655, 372,2226, 107, 822,2097,2015,
+  1133,3576,2963,2520,1090,2914, 527,3108,2479,1983,4005,3908,3988,2957, 136, 623,
+  4021,3059,3782,3909,1855,1898, 880,2781,3692,1597,2204,3572, 888,2458, 765, 306,
+   305,1991,3341, 959, 161,3212,2559, 552,  91,2896,1725,1486, 619, 930,3878,2129,
+  2596,3070,2725, 714,3993, 568,3245,  48,1813,1737,3569,2583,2314,2242,2897,3180,
+  3425,3750,2919,2140, 258, 512,3414,1477,1345, 893,  77,2294,1134,1457,1406,3970,
+  1173, 314, 865,3236,3641,2567,2450, 728,1488, 100, 115,3871,  96, 960,2312, 289,
+  2208, 252,2324,3565,3369,1203,2794,1542,2441, 198,1793, 838,3998,3081,3801, 875,
+  1213, 830,1969, 320,3957,2379,1506, 615,3492,1606,3422,3441,3559, 759, 874, 863,
+   318,1111,2255, 227,2984,3002,2920,3092,2927,2958,1226,2992,1892,3179,2290,2528,
+  1258, 827,1690,3025,2369,3174,1441,  27,3821,3751, 167,3916,2757, 410,1243, 592,
+  1480,1075, 539,1425, 803, 326,1328,2425, 835,2146,1055,4094,3126, 362,1178,1197,
+  1595,1697,1585,1625,3906,1966,2218,2924, 735,2112,3843,1838,3118,1277,1977,2763,
+    69,3469,3112,3646,2587, 240, 272,3250,3517,2033,3436,3781,2658,2906,1202, 853,
+  2960,1881,1107,2524,2082,3564, 831,1218,3049,1747,2801,1013,1230,2039,1789,3665,
+  1734,1144,1047,1875,2136, 983,3761, 697,3418,2055,1412,3772, 158,2809, 221,4009,
+  1635,2247,1927,2365,2167, 885,1262, 624,1978,1740,2105,1182,3700, 801, 178,2194,
+   308,2848,3844,4056,3279,2228,1020,3427,1614,2768,3016, 336,1227,2077,1732,2447,
+  2124,1845,3586, 633,3925,2544,  49,2182,3770,2566,3926,1936,1108, 661,2056,  41,
+  1146, 301,2385,2486,3317,3701,1519, 311,2032, 226,1817, 824,3299, 431,2297, 489,
+  1818,2427,2232,2849,3789,3830,1914, 357,3805, 952, 785,3742,3682,2459, 719,3219,
+   582,3913, 647,3840,1397, 515,2973,1009,3588,1411,3566,3990,2118,2539, 562,2892,
+  2273,1106,2858, 903,3856,2151, 151,2716,2971,1662,1188, 560, 203, 826,2607, 168,
+  1885,3127,2225, 551,2358,4053,3980, 757, 231,2478,1739,3027, 471,1241, 544,3072,
+   611,2166,  58,1944,1731,1812,1803, 185,3172,3260, 139,1117, 705,3651,3827,2383,
+   642,1280,2481,3052,2983,2350,3710,1590,1948,2347,2895,1102,2047,2088,3625,3198,
+   707,1876, 964,1645,3462,1851,3985, 571,1067, 538,2007,4058,2322,2011, 379,1076,
+  1719,3373,2758,3681,1224, 427,3289, 283, 574, 566, 529,3156, 408,1706,3991,3269,
+  1659,2156,1018,4060,1119, 267,2863,1300,1194,3563, 715,2363, 540, 477, 790,3431,
+   632, 918,3969,3196,1037, 407,3278, 249,2433, 352,2048, 919,2780, 577,2547,3758,
+     3,2161, 614, 847, 805,1601,3307,4019,1069,   7,1097, 695,2260,3201,1268,2139,
+   746,1424,1340,2476,1840,2548,3976,2751,3162, 467,  11, 924,3711,3584,3800,1413,
+   772, 792,2944,2268,2327, 222,1390,1287,3438,1616, 430,2913,4051,2651, 650,2223,
+   265, 234, 542,1421,1437,3523,1288,2404,3876,2800,2571, 603,3848, 643,2885,1470,
+   465,2031,1232, 745,3579,1210,4023,1984,1074,1235,1592,3524, 340, 351, 977,3597,
+  1129,3956, 550, 789,1821,2064,2861,2835,2019,2285, 106,1085, 605,1446, 771,2674,
+   518,3014, 708,1236,3024,3033,2390, 954,1351, 956, 656, 160,2586, 773, 380,2044,
+  2704,3261,1353, 453,3483,1868,3010,  47,1096,3684, 472,3253,1407,3890,1021,2925,
+  1801,2880,3119,1260,1322,2315,2803,3904,2248,2917,3297,1293, 275,3898,3169, 181,
+  3038,2499,  75,1643,1746,1857,1549,1081, 354, 271,1500,3613, 216, 344,2954,2599,
+  3902,2497, 159,3055,  16,1774,3432,3823,1004,1546,  23,3122,3106, 920,2370,4008,
+  3778,1988,2819,2444, 887, 180,2376,2522,1587,3339,3508,3645,1040, 966,4025, 207,
+  3984, 829,1964,1177,1080,2005, 809,3679, 502,1459, 767,3981, 466,1145,1113,3568,
+  1685,2041,2331,2826,1359,1028,3784,3852, 872, 758,2219,2851,2128,2410,3743,3722,
+  1556, 641, 576, 671, 570,3671,1284, 224, 128, 406,2445,2310,3302,3473,2525,2581,
+   689,1805, 535, 787,1918,2553,1981, 636,2797,2736,3097,1599, 206, 871,3869,2740,
+   388,3257, 630,2516,2669,3336,3380,4071,1001,3687,2511,1543,1084,1334,3130,2668,
+  2113,4014,1048, 386,3456,1440, 337,1744,2788,2733, 365,3842, 284,2083,3190,2121,
+   776, 779, 421,4028,3905,1976,1428,3412,  83,1276, 598,3638,1057,3811,4044,2175,
+  3220, 259,1160, 479,3017,3221,3449,2990, 936,2692,2309,1824,2045,3602, 450,3589,
+    67,1712,1524,1594,3030,2483,1124,3214,2705,1671, 580,1147,3937,3340,1891,3273,
+  3181, 278,2872,3860, 973, 522,2723, 442,3865, 418,2428,2463,  20,1572, 774,4043,
+  2498,1925,1105,2731, 486,1501,  85,3707, 917,2644,1261,3046,1957, 440, 332, 508,
+  4032,3006, 802, 572, 591, 397,1383,3386,1296,1142,  37, 208, 949, 635,2635,3889,
+  2852,1217,2652,3056,4046,3963, 506,3050,2507,3421,2735,3702,2013, 295,3295, 174,
+  2682, 962,1550,1035,3063,3678,2610,1615,2413,1449, 678,3962, 629,4010,3327,1589,
+  2024,3680, 131,3992,1804, 177,1664,2753,2706,1640,1468, 907,  38, 237, 791,1253,
+   915, 953, 110,1398,1772,3144,1315,1995, 965, 716, 703, 204,1548,2875,2508, 190,
+  3997,2584,3573,2955, 991,  29,2249,3057,2689,1996, 251,1809,1937,1622,1564,1128,
+  2029, 683,  82,2714,3862,2642,1027, 220,3635,2371,3434,4015,1221, 800,3604,1636,
+  1693,  45,2696,2929,3343,3685,3655,3777,1758,4011,1393,3064,2299, 469,1007,3350,
+  3315, 648, 156, 748,1613,2815,3639,3265,2402,  22,2560,1921,3371,3941,3450,3979,
+   192,2120,1605,3259, 241,3769,2500,3270,2514,1959,2103, 862, 238, 528,1558,1839,
+  1870,2001, 188,1030,2554,3217,1402,3458,2473,2184,3666,2160, 554,3151,3698,2750,
+  2734,1717,3154,2440, 444,2918, 975,3100,1172,2831,1535,2844,2060,3335, 393,2986,
+   579, 652,3943,3994,3294,1455,2418, 662, 183,1138,1010,1193,  79,3311,2190, 176,
+  2131,2977,1779,1947,3497, 470,2916,2318,   5,1865,3647,1569,2034,1600, 684,1309,
+   933,1205,3251,3138,3689, 989,3520, 718,1174,2173,1946,1718,1365,2252,2899,1568,
+  2879,1220,1341,3176,1167, 928, 245,1159,1657, 343,2211,2970,3351,1496,2342,2564,
+  2335,1830,1609,3197,1439,3729, 309,3408,2698, 288,4055,1140,4074,1889,3397,1329,
+  2847, 927,2442,1450, 548,2487,3716,2650,2910, 894,1104,1467,3464, 892,1022,2626,
+  1538,3415,2361,2145,2389,2602,2326, 215,1448,3080, 701, 609,3974,1141, 673,1638,
+  1403, 261,3683, 896, 229,1384,1672,2066,1132,1827,2935,3755,1612, 832, 268,2259,
+  1667,2771,1956, 468, 948,2770, 613,2472,1487,2799,2884, 743, 184,2355,1982,1444,
+  3466,2912,1136, 968,3776,2805,2866,1997,3950, 451,1675, 988,2439,3896,3967, 578,
+   360, 476,3740,3310,2593, 557,1703,1743,1371,1559, 155,2671,1753,3377,3284, 766,
+  2806,1460, 503,1922,2455, 744,2873,3822,3309,3241, 686, 138,1187, 108, 704,2367,
+  3042, 526,  52,2191,2719,3888,1814,3775,1255, 312, 840, 793,2720,3853, 292,3617,
+  3580, 837,3304, 263,2332,3246,3475, 626,3085,1191,3695,1363,1471,2833,1387,1577,
+  1184,4063,2209,1566,1465,3044,2894, 569, 897, 534,2932,3500,3783,  43,3185,1375,
+  2722,2953, 922,1331, 377,3277,2017,2974,1794,2902, 929, 951,1008, 449,3472,2568,
+  3590,1032,3959,3444,3093,2934,1070,1088,1273, 947,1110,1333,2221,4077,2796,3583,
+  1897,2362, 134,2577,3089,1342,3656,3182,3143,3857,1462,2256, 438,1580,2491,3231,
+  3360,1002,2384, 709,4004,1380, 347, 914, 302, 152,2217,1822, 325,3337,1899,  95,
+  3402,4029,3507,1929,1864, 541, 173,   1, 464, 905,1139,3688,2712, 426,1114,2422,
+  3496,3370,1189, 495,2050,1307, 823,3802,2036,3206,4031,2501,2784, 194,3763,2471,
+  2657,3051, 634,1835,  10,1730, 109,1972,3719,2448, 898,3013,2302,1704, 851,3404,
+  3599,2231, 890,1025,1971,4013,1596,3488,2067,1913,2155,3318,1621,3933,3831,1782,
+  2964,3484,1043,1229,3632,3661,3767,1940,1429, 402,1409, 298,2829, 937,1302, 868,
+  2038,2438,1962,4066,1807, 595,3332, 969,1958,3305,1829,2678,4027,2002, 247,3296,
+   846,1678,2195,1679,2087,  81, 950,1228,3927,1422,2025, 520, 856, 857,3738,1222,
+  1651,4089, 321,3459,2856,1593,1098,1993,2229,3724, 955, 839,2933, 908, 855,1310,
+  3237, 164, 873,1561,2456,  98,1655, 799,3357, 899,3799, 537,1023,3029, 724,3766,
+  3960, 481,1292, 732,3447,3663,3128,1658,1038,2681,3041,2283,1161,1938,3955, 171,
+  2980,1454, 395,2348,3372,  55,  51,3562,2867,1903,3825,2141,1866, 400,1498, 149,
+  1530,2282,3096,2748,1722,2235,2694, 536,  30,2675,1552,2078,3248,3011,2316,1179,
+  2253,  35, 439,1473,1066,2323,1019,1863,1379,1786,2804,2466,2482,3810,1214,1933,
+  1816,2040,3194, 436,4020,1410,1005,1907,1895,3233, 674,3153,3935,1281,1726,3445,
+   670,1540,1661, 452, 768,2685, 859, 559, 202,1318,1745,3320,4030,1247,3760, 910,
+  3964,1904, 740, 425,3037,1695,2576,2205, 967, 788, 145, 836, 906,1654,1781, 721,
+  1713,3686, 391,1979,3368,3285,1346,1123, 130,3787,2202,3405,1485,2824,1478, 323,
+   925, 172,2313,2630,2305, 349,2271, 494,3468,3155, 644,1752, 733,2353,2832,3616,
+  2042, 505, 987, 926,3482,2562,3855,1574,1681,1201,1033,1239,1312,2122,1532,1579,
+  1522,2825,2807,3353,  44,3303,1514,2057,3901, 637,1257,1639,2841,1859,2407, 602,
+  1853, 193,2181,2615,4052,4062,2820,1826,2416,3189,2521, 369,2063,3838, 994,1795,
+  1242,1738,3099,2158,1905,1156,2882,2876,  94,2870,3836,3098,1491,2608,1469,2612,
+  3505,3428,2334,3401,3752,1034,3512,3411, 944,2110, 319,3790, 394,3628,1511, 622,
+   118, 878, 303, 356, 195,1366,2237,2411,1367, 497,2502,3493,1121,1619,1692,1195,
+  3352,1714,3040, 780,3621,1760,2998, 946,1246,4033,1715,  88,2966,3907,3708, 921,
+  2488,  40,1624, 525,1666,2409, 493,1628, 287, 233,2443, 817,1176,3390,2065,2287,
+  2888, 403,3160,1686,2274, 681, 889,1808,  19,2091,3882,1463,2270,3494,2356, 491,
+  2679, 680,2296,1949,1415,2617,2227, 218,2169,2319, 693,3384,3034,1126,2451,1611,
+  1973, 264,2243,2915, 478, 645,1837,2176, 825,1155,3023, 333, 777,1751, 617, 413,
+  1570,3502,2930,2357, 843,4082,1099, 795,1536, 834,2406,2381,3147,3788, 672,2580,
+  3453,1238,3557,1989,3892,1298,2767,1687,3986,  24,3623,2336,3545,  72, 932,2513,
+   150,3504, 141,3256,1770, 575,3283,2887,3476, 911,1395,3697, 504,1290,1100,2116,
+    97,3642, 655,2834,3509,3413,2737,3272,2629,4048,1790,2142,3347,1819,3824,1847,
+  1749, 389,2431,2628,3978,2262,3618,3161,3558,1721,  60,1289,3546, 186,1509,3227,
+   618,2836,2298,3286,2269, 692,3216,3146, 588,3409,3209, 754,1264,  89,3165,3880,
+  2119,2485,3812, 600,1906, 285, 485,4070, 415,3690,1632, 392,2715,1792, 775, 273,
+   750,2241,3423,2213,1494,1604,1092,3103, 304,3417,1780,3429,3595,2127,2395,3834,
+  1919,1867, 484, 813,2408,3396,2098,2430,4079, 869,1049, 242,2143, 818,1798,1952,
+     4,2664,3754, 675,3333,  31,4039,2523,2457,1164, 658, 230, 500,3376,2813,1369,
+   350,3931,3879,2419,1299, 475, 816,1015,2340,3757,2074,1443,3785,1773, 517,2898,
+   282,2774,2424,4042,3137,2345,3841,2174, 734,4091,2461,3009,3319,2300,1950,2600,
+  3585,4093,3053,1419, 781, 200,2414, 563,1707,1811, 543,2277,3054,2352,3470, 646,
+  4090,1254,1373,2123,2233,1648,2043,2795,2149,1755,1325, 428,1684,2405,1479,1386,
+   127,2453,1856,2526,1623,1071,3650,3275,1060,  53, 213, 608, 214, 255, 997,1301,
+  2931,1553,1562, 459,2962,1059, 755,2159, 116,1584, 811,  64,2624,3226, 416,2546,
+  3718,1844, 401, 749,1521,3780,4018,2814,3243,1656,2187,2086,1987, 810,2377,1152,
+  1360,2330,3535,1930,3694,3262,2009,2732,2106,1941,1445,2076,1355, 474,1680,2380,
+  2871,4065,1646, 738,1724,2096,2942,1676,3643,1344,3359,3972,1525, 558, 454,1062,
+  1103,1649, 507,3077,1388, 620,  90,1729,2467,2417, 373,2265,3929,1653,2429,1332,
+  2138, 940,2393,3519,2095,1051,2693, 999,3150,4064,3627,2117,3136,2677,1968,2952,
+  1510,1338,2711,3861, 727,2094,1385,1617,1348,2830,1095,2075,  14,2700, 364,1432,
+  2709,3815,2261,2968, 129,2605,3592, 651,2601,2967,2021, 700, 166,2961,2827,3983,
+  2764,3615,2196,3624, 458,1339, 982,2186, 163,2264,2911,2070, 631,2144,2940,2634,
+   334,2469,3820,2609, 665,2397,1456,2403, 806,2542,1900,1861,3229,2125,2534,2742,
+  1647,1699,2717, 280,3614,2214,3316,2220,1527, 778,3403,2374,1046,3228, 382,1216,
+  2084,3195,2343,3344, 585,1893,3149,3917,3560, 729,1321,  54, 696,2028, 995,3544,
+  1974,2839,1576,2224,2556, 457,2606,1326,2686, 409, 751,2333,3364,3675,2989,3832,
+  2490,1975,2982, 867,3015, 473, 939, 530,1882,2995,1337,1688,3471,3528,2721,1831,
+     0,1499,2266, 499,3356,2079, 861, 300,2388, 895,1970,2855,3995,2212,1815,1250,
+  3178,3073,1198,2435,1225, 886,1660,2010,2956,3549, 668,4088, 274,3213,3240,3355,
+  3111,1382,1101,2157,3084,1458,3487,  42,1750,1802, 120,1306,1362,1608,3362,2372,
+   938, 848,3607, 488,  68, 197,1282,1765,2301, 146,1279, 533,2168,3287,1157,1089,
+  2515,4041, 699,2493,3274,2672,3095,2886,2622,1078,2633,2702,2165,2341,3514, 713,
+  3382,1710,1036,2991, 935,1206,  57,2134,4016,3187,1665,1620,3705,2549,1920,1012,
+   841,1563,1843, 984,2907,1998, 209,1029,3977,2857,1832,2421,3451,3633,2891,2812,
+   904,2981,2199, 366,3036,4086,3062,2170,2939,2008,2111,1323,2728, 685, 850, 849,
+  3280,2646,1523,3005,3148,3846,1884,1190,2993,3748,2351, 417,1026,1094,3115, 742,
+  2359,1266,2747,2558, 599,1777,1515,3899, 607,1852,3660,2565,1270, 860,1842,2172,
+   763,3288, 945,3676,1902,1416,2550,3134, 730,3086,3928,1910,1431,1769,1245,3392,
+  1475,2263,2937, 328,3965,2280,2288, 294,  84,1682, 157,3254,3019,3753,3079,3996,
+  2703, 654, 498,1670,3670,3322,1883,  17,2133,3779,3762,2810,3786, 135,2307, 756,
+  2661, 154,3587,2817,3759,2192,1405,1295,2649, 443, 934,2579,2378,1319, 322,2616,
+  1283,2454,2328,1541, 148,3796, 346,2069,1014,2020,2854,2292, 782,1951, 232,3501,
+  1231, 437,1788,1389,3571,1960,3203,3756,1079, 737,3001,1529,1598,4080,1063,2480,
+  2536,1879,2621,4076, 694,2761,3312,2997,1716,3795, 279,3205,1006,1400,2303,2446,
+  2636,1928,3223,3410,1588,1877, 317,2639, 313,3529,2746,1265, 717,3798, 412,1748,
+  1215,3375,2699,3460,3807,1759, 329,3239,1711, 769,2994, 976, 445,1452,2180,1003,
+   998,3747, 191,3168,1263, 187,2308, 638,3224,2842,1581,1493, 864,2779,1168,1986,
+  2051,1394,3325,1131,3725,  50,1733,3193,1209,2246, 375,3691, 702,2068,3028,3515,
+  2023,3648,2529, 405,2154,2604,2619,3659,1869,2278, 142,3065,3485, 254,2420,1872,
+  3398, 711, 881,2062,2786,3731, 726,1945,2276,1401,1061,3207,2360, 243,2035,2462,
+  1125,2802,1849,3045,3958,1528,1311,2527,3276,1520,2738,4026, 244,1700,2391, 335,
+   845, 974,2012,1072,1806,2551,2663,2346,1154,3426,4072,4047, 660,2415,1909, 972,
+  3477,2464,3804,2061,4017,2557,3480,  93,3897,2659, 137,3328,3074, 348,3391,2744,
+  1518, 455,2987,3192,3271,3706, 666,2503,1109, 353,3175,3622,4075,3188,1917, 523,
+  3282,2828,2729,2901,1537,1399,2760,3764,  32,2585, 269,3658, 147,3794,3652,3672,
+  3334,1240,3499,3117,3803,3932,2883,2495,3021,3657, 434, 931,2860,3886,  46,  99,
+  1358,2691,2258,3300,2512,3208, 217,3829,3966,3945,1943,2239,2387,1259,1848,3394,
+  2504, 339,2791,2147,1336,2845,3735,3218,1846,1618,3345,3069,3281,3714,2620,2591,
+   923,3139,3446, 978,1669,3900,2215,2755,1219,2337,2049,1994,2109,1583, 112,4092,
+  3125,3066, 573,2293,3726,  28, 262,3457,2449,1698, 764,2603,3893,2400,3491,2975,
+   390,2575,2093,3152,1248, 556,2198,1050,3258,4084,1162,2904,2338, 943,4001,2718,
+  1735,3874, 722,1327,2570,3166,3973,2163,3532,1771,3858,2976,3400, 376,3489,2687,
+   189, 844,2489,3225,1068,3553,1901,1417, 196,3537,3298,1694,2756, 760,2210, 957,
+     9,2789,1438,3922,2595,1924,1999,1171,2588, 852, 590,2592,2625,1607,2793,3264,
+  3145,1571,1426,2178,2632, 341,2908,1207,3200,2368,2026,1880,3142,2569,2969,3078,
+  2517,4061,3626, 355,2014,1378,1483, 256,2710,3076,2148,3324,3124,3060,2275, 330,
+  3649,2115,1343, 385,1148,2304,1349, 102, 741,2107,3637,3091,3424,2541,3442,1420,
+  3330,2869,2948,3116,1757,2207,2477,2072, 804,3634,3612,4081,2905,1629,3636,2822,
+  4085,2321,2922,2484,1484,3847,1192, 659,4006,2518,2743, 490,1436,1313,3082,3383,
+  4003,3321,3868,3989,3542,1011,3793, 657,2846,1756,2811,3736,3946,3379,2614,3437,
+  1150,1696, 511,2114,3242,1204,4068, 524,2837,3765,3249,3338,3308,3170, 690,2108,
+  2090,1504,3574,3109,1447,3885,1610,3547, 363,1372,1376,2399,3667,1762, 942,3506,
+  2254,4083,3022,1112,2162,3872,4037,4054,3605,1932,2003,1800,1825,1908,3004,1627,
+  1058,2052, 583,1200,2392,3554,3828,2708,2951,2598,1361,3550,1965, 179,3919, 114,
+  3159,2594,2745,2099,3204, 266,3674,2965,1472,2667,1516,2850,1674,3548, 858,1578,
+  1453,2510,3551,3210,3141,2234,3894, 546,1915,3712,2552,1335, 819,3314,  76,3075,
+  3234, 521, 423,2295,3313,3598,2947,2578, 514,1278,2739, 586, 461,3910,1828,3864,
+  3518,1911, 153,1926,1873, 510, 387,2432,3114, 883,3342,2890, 286, 710,1016,3703,
+  3389, 796,3817,3850,2543,4087,3582,1641,2611,1149, 549,1942,2366,2988,3845,2582,
+  1163, 140, 901, 276,2874,3771,3346,3047,2325,3723,3797,2597,2080, 250,3363,3385,
+    56,2865,2101,2959, 553,2135,3349,1886,3463,2396,4069, 162, 584, 396,3863,1923,
+  1507,3536,2641,1435,1980,3713, 589,  59,1352,3230, 981,3915,3048, 316,2999,3199,
+  3102,3717,3110,1183,2878,1175,3947, 496,2943,1783,2460, 902,2840,3479,2665, 797,
+  1294, 761,3561,3942,3608, 664,3478,2759,1269,2206,4034,1890,3640,3749,1677,2240,
+  3481, 561,2647,1888,1689,1077,1642, 383,3600,2085, 419,3699,2949, 228,1153, 555,
+  3104,4024,3952,2279,3601,1433,3406,3581,1303, 979, 677,3452,1705,3538,2059,2004,
+  3354, 270,4057,3323,2022,1967,2053,3393,1512, 752,3186,2985,3728,2864,3306,3158,
+  2590, 993,3883,3837,2071,1053,3839,1766,1547,1272,1551,3120,2394,2506,3951,2373,
+  2648,3746,3596,1963,3419,1251,2787,2978,3744,1237, 367,2382,2643,4073,1324,2645,
+  3292,2000, 117,3938,2494,3971, 941,1404,2775,3849,3061, 753,3734,3267,3816,3088,
+};
+
+extern const int NoisePermutation[4098] = {
+     0,   1, 386,   3, 649,1576,1405,   7,1146,   9,1663,  11, 693,  13,  55,  15,
+   864,  17,  44,  19,1347,1934,1217,1554,1799, 450,1561,1294, 529,  29, 355,  31,
+    67,  33, 631,1076, 840,  37, 338,  39,1447,  41, 558,  43,1747,  45,  28,  47,
+   767,  49, 811,  51,1323,1356,  57,  14,1121,1678, 127,  59, 910,  61,1424,  63,
+  1141,  65, 351, 800, 888,1488, 944, 584, 246,  73,1664,  75, 147,  77, 795,  79,
+  1772,  81, 544,  83, 895,  85, 441, 122,1787, 764, 202,  91,1102,2004,  62, 546,
+  1705,  97, 880,1088, 586, 101, 687,1844,1026, 846,1605, 736,1540, 109,1539, 111,
+  1978, 113, 680, 115,1779, 117,1862, 119,1904,1572,1120, 426,1334,1858,1636,  58,
+  1910, 129, 177, 131,1438, 133, 543, 760, 274, 137,1911, 428, 979, 141, 671,1838,
+  1707, 145,1271,  76,1081, 514,   4, 151, 973, 153,1191, 155,1385, 157, 305, 159,
+  1440, 161, 125, 163,1198, 165,  42, 167,   6, 169,1566, 171,1002, 173, 633,1728,
+   700, 130, 207, 179,1193, 181, 756, 432, 571, 185,1472,1382,1795, 189, 346, 191,
+  1659,1350, 317,1006, 451, 197,1151, 199,  26, 201,1406, 203,1260, 418, 403, 956,
+   548, 209, 832,1418,1396, 213, 897,1828,1609,1238,1538, 219, 842, 221, 100, 223,
+   845, 364, 561,1638,1014, 229, 467,1720,1504,1886,1186, 618,1242, 237,1947, 239,
+   394, 241, 955, 243,1855, 245, 553,1568, 721, 249,1735, 251, 923, 253,1894,1968,
+  1484,1228, 311, 259, 647, 261, 445, 263,1332, 265, 971, 874, 267, 269,1711, 271,
+  1427, 273,1226, 275, 684, 526, 729, 958,1966, 512, 749, 283,1266, 285,1535, 287,
+  1548,2020,1635, 291,1852, 293,1670,1072, 733, 297,  89, 794,1134, 301,1157, 786,
+   668, 158, 787, 307, 238, 309, 596, 582,1961,1676, 226, 315, 495,1522,2038,1016,
+  1523,1430, 947, 323,1147, 325,1034, 327,1583, 329, 339, 331, 414,1354,1730,1328,
+  1771, 337,1184, 330,1129, 341, 373, 343, 411,1804, 257, 347,1927, 518,1577,  66,
+  1890, 532,  88,  30, 326,1688, 843, 376, 989, 870,1485, 363,1816, 365,1278, 367,
+  1926, 369, 745, 371, 227,1174, 598, 776, 359, 377, 240,1620, 779, 381,1977, 383,
+  1291, 385,1661, 387,1346,1004,1051, 391,1248, 774,1047, 395, 990, 397,1534, 399,
+   744, 401,1943,1674,1055,1342,1712, 407,1919,1976,1041,1202,1725, 413, 892, 415,
+  1369, 417, 205, 419,1363,1588,1160, 423,2017, 425, 123, 427, 139, 852,1696, 431,
+   183,1652,1287, 435, 780, 437, 120, 439,1614,  86, 642,1224,1839, 262,1164, 447,
+  1836,1442,  25, 828,1246,1352, 313, 455,1225, 457, 559, 459, 656, 461,1449, 463,
+   652, 465,1443, 230,1958, 469,1654, 471, 402, 473,1889, 475, 927, 477, 717, 479,
+   831, 481,1800, 574,1367,1060, 694, 487, 464, 489, 166, 650, 290, 493,1761, 698,
+   881,1774, 575,1144,1737,2026, 206, 503,1142, 505, 913, 507,2012,1748, 566, 511,
+   281, 844, 334, 515,1317, 517, 349,1956, 296, 228,1564, 523,1079, 525,1668, 527,
+  1991, 508, 550, 531, 280,1166,1455, 535, 657, 537,1873, 539,1063, 942,1982,1694,
+  1913, 545,  95, 547, 914, 742,1247,1268, 132, 430, 912, 555, 272,1232, 715,1514,
+  1633,1916,1119, 614, 710, 565,1520, 567,1148, 569, 357,1112, 460, 573, 483, 498,
+    32, 577, 601,1358, 146, 581, 258, 583,1702,1434, 466, 587, 781, 589,1479, 591,
+   743,1156,1445, 595, 894, 597,1581,1022, 190,1196, 688, 603,1496,1330, 204, 607,
+   622, 609, 751,1766, 484, 613, 563, 615, 536, 617,1992,1516, 961, 778, 667, 623,
+    21, 294, 938, 627,1649, 629, 882, 318, 916,1050,1082, 635,1580, 637,1930,2034,
+  1632, 641,  24, 643,2040, 640,1729, 260, 943,1810, 491, 651,   2, 653, 712, 655,
+   438, 616, 478, 659, 504, 661,1172,1012,1627, 665, 934,1806,1987,1624,1458, 300,
+   775, 673, 186, 136, 869, 677,1062, 679, 215, 681,1176, 683,1808, 685, 212,1490,
+   568, 689,1706,1736,1884,  12,1118, 695,1592,1940, 316, 699, 378, 701, 374, 703,
+   758, 705,1883, 707,1924, 709,1701, 711,1896, 713,1489, 220,1643, 658, 789,  60,
+  1871, 248, 490, 723, 931, 725, 211, 727,  38,1206,2016, 731,1257,1044,1459, 735,
+  1528, 737,1955, 218, 393,1152,1920, 630, 739,1280,1194, 747,1851,1052, 324, 868,
+   193, 753,  40, 755, 222, 757, 851, 759, 135,1790,1005, 763, 298,1970, 752,  48,
+   970,1846, 424, 771,1379,1606, 740, 672, 375, 777,1444,1628,1752, 588,1140, 783,
+   953, 785, 303, 306, 282,1578, 234, 791,1945, 793,1104,  78,1429, 797, 557,1250,
+   112, 801,1687, 803,2029, 805, 436,1074, 819, 809,1222,  50,1975, 813,1413, 172,
+  1842,1996, 556, 808, 356, 821,1657, 823, 883, 825,1971, 827, 196, 829,1859,1932,
+    69, 833, 606, 835,1481,1594,1108,1170, 644, 841,1662, 358, 660, 224, 105,1998,
+   765,1046,1815, 704, 429, 853, 663, 855,1446, 857, 839, 859,1421, 861,1653, 863,
+   926,1582,2014, 867, 610, 692,1682,1038,1312, 873,1782,1986, 150, 877, 175, 879,
+  1618, 496, 592, 824, 639, 885,1389, 887,1860, 889,1731, 891, 268, 893,1764, 552,
+  1390, 214, 676,1114, 645, 901,1456,1128, 149,2032, 987, 907,1897,1734,1732, 911,
+   702, 506,1801, 915, 164, 917,1550, 542, 608, 921,1603,1450,1980, 925,1954,1214,
+  1901, 929, 957,1366,1096, 933,1007,1556, 636, 937,1679, 939, 935,1906, 541, 648,
+   121, 945,1743,1370,1315, 949,1818, 951,1834, 784,1829, 242,1426, 930,1368, 959,
+   103, 620,1003, 963,1137, 965, 782, 967, 510, 969, 400,1700, 482, 152,1646,1392,
+  1040, 977, 110, 140,1351, 981,1407, 983, 308, 985, 168,1988,1669,1570, 790, 991,
+  1068, 993,1316, 674, 611, 997,1345,  92, 798,1001, 815,1698, 389,1552,1018, 666,
+   875,1009,1502,1882, 854,1013, 521,1015, 319,   0, 195,1019,1428,1021, 599,1023,
+   384,1025,1039,1027, 580,1029,1666, 856,1098,1033, 128,1035,1149,1037, 871,1216,
+  1585, 410,1812,1043, 520,1045,1716, 838, 754,1049, 174, 390, 788,1053,1208, 404,
+  1284,1057,1298,1059,1378,1061,   8,1962, 335,1065, 368,1067,1794,1069,  46,1071,
+   295,1073, 807,1075,1946,1077, 444, 524,  34,2002,2025,1083, 621,1085, 941,1087,
+    99,1952,1895,1030, 360,1093,1416,1095,1042,1097,1999,1099, 590,1872, 999,1596,
+  1840,1105, 302,1107, 176,1109,1372,1111, 184,1113, 899, 398,1553,1117, 217,1672,
+    87,  56,1876,1822, 772, 160, 748,1127, 288,1760,1714,1131,1579,1133, 142,1135,
+   850,1908, 108,1139,1807,1984, 572,1143, 499,1820,1584, 750, 600,1658,1854,1560,
+   741,1153,1482,1155, 593,1454,1717,1159, 182,1161, 848,1163, 968, 728, 533,1167,
+  1831,1169, 858,1324, 519,1173, 342,1234, 231,1177, 924,1179, 162,1181, 522, 292,
+  1165,1185, 605,1204, 982,1189, 148, 154,1254, 180,1756,1270,2008,1197,1414,1199,
+    82,1201, 344,2000,1187,1374,1942,1207, 446,1209,1630,1211,1078,1213,1994, 352,
+   104,  22, 612,1219,1295,1221, 255,1223,1436,1738, 675,1227, 602,1229,1305,1231,
+  2018,1233,1648,1235,1132,1237,1110,1239, 372,1241,  27,1243, 625,1938,1195,1494,
+  1084,1249, 799, 264,1415,1253, 540,1255,1972, 732,1281,1259, 244,1261,2033,1263,
+  1744,1265, 806,1267, 551,1269,1410,1094, 836,1273, 474,1275, 236,1277,1190,1154,
+   370,1258, 134,1283, 198,1285, 906,1684, 849,1289,1417,1024,1178,1878,1276,1340,
+   576,1297,1830,1299,  98,1301,1476,1303, 433,1230,1220,1726,1893,1309,1404,1311,
+   770,1313, 554, 948,1727, 516, 724,1319, 866,  74,1529,  52,1856,1922, 976,1327,
+  1064,1329, 310,1331,1251,1333,1885,1335, 225,1337,  10,1526,1306,1341, 405,1474,
+   634,1950, 886,1622, 638,1349, 766, 980,  94,1353, 333,1355,  53,1357, 579,1359,
+  1907,1361,1384,2036,2037,1365,1318,2030, 279, 416, 254,1371, 486,1373,1205,1375,
+  1136,1377,1130,1124,1722,1626, 187,1383,1408,1928, 962,1387, 974,1264,1788,1391,
+   975,1393,1724,1395, 247,1397, 345,1399,1704,1401,1709,1403,1608, 170,1619,1486,
+   458,1409, 452,1411,2019, 814,1964,1252,1028,1290, 726,1419, 830, 860,1892,1423,
+   453,1425, 178, 818,  18, 796, 321,1431, 485,1433, 585,1435, 443,1437,  84,1439,
+  1125,1441, 449,2042, 392, 594,1031,1048,1236, 462,1348,1451,1274,1468,1106, 534,
+  1781,1457,  70,1784, 804,1461, 509,1463, 332,1465,1713,1467,1453,1469,2013,1471,
+   995,1473,1343,1475, 996,1477,1171,1612, 114, 232, 972,1780,1786, 362,1824,1487,
+   210, 714, 102,1491,  80,1493, 530,1495,1381,1532,1767,1499, 686,1501,2046,1503,
+  1272,1505,1733,2024,1625,1509,1210,1511,1642,1513,1362,1515, 619,1517,1825,1519,
+   200,1066, 746, 320,1336,1598,1339,1527, 107,1322, 500,1531,1746,1533,1115, 286,
+   476,1537, 768, 978, 488, 730, 350,1543,1827,1545,1751,1742,1770,1549,1837,1551,
+   762,1116,  23,1555, 940,1557,1448,1559,1056, 118, 884, 256,1158,1565, 986,1567,
+   470,1948,1092,1571,1762,1573, 366,1575,   5,1542,1292,1558, 235,1758, 865,1400,
+  1288,1326,1325,1587, 421,1589,1850,1591,1604,1593, 837,1595,1103,1597,1525,1599,
+  1602,1601, 138, 922,  54, 106, 773,1607, 513, 216,1188,1611,1100,1613,1310,1615,
+    93,1617,1867,  90, 379,1621,  20,1623, 669,1508, 604, 664, 380,1629,  16,1631,
+   900, 560,1394, 492, 903,1637,1240,1639,1089,1641, 448, 716,1960,1645, 442,1647,
+  1175, 628,1150,1651,1304, 862,1500,1655, 348, 896,1036,1900,1749, 632, 722,1338,
+  1826,1665,1091,1667, 277, 988,1244,1671, 562,1673, 502,1675, 454,1677, 696,1718,
+   822,1650, 361,1683,1058,1685,1398, 802, 570,1868,1544,1691,1541,1693,1282,1695,
+    72,1697,1386,1814, 266, 564,  71,1902, 328,  96, 144, 690,1905, 932, 420,1912,
+  1699,1466,1432,2022, 678,1182, 626,1719,1422,1721,1286,1723,1845,2010,1307, 994,
+   878, 646, 904, 890, 719,1506, 909,1864, 691,1530, 456,1739, 966,1741,1547, 946,
+  1320,1745,1497,1020,1462,1660, 208,1546,1279,1753,1768,1755, 194,1757,1314,1759,
+   340, 494, 670,1763, 396,1765,1302,1974,1866,1769, 126, 336, 434,1773, 497,1775,
+   314,1777,1914,2006,1483, 902,1464,1783, 734,1785,1563, 354,1680,1789, 761,1791,
+   549,1793,1000, 188,1963,1797, 919,1388, 284,1750, 422,1803,1686,1805, 920,1740,
+   816,1809, 876,1811,1402,1813, 406,1376,1524,1817,1518,1819,1145,1821,1123,1823,
+  1610, 950,1256,2044,2028, 954,1492,1168,1245,1833,1863,1835, 984,1918, 143,1212,
+   299,1841,1480,1843, 960,1634, 769,1847,2035,1849, 820,1126,1183,1853,1681,1880,
+  1478, 468,1180,1420,1521,1861,1054, 952, 250,1865,  36,1300,1689,1869,1937, 720,
+  1101,1874, 538,1875,1857,1877,1293,1879,1936,1881,1011, 706, 898, 124, 233,1887,
+  1262,1452,1215,1891, 682,1308, 322,1090,1498, 908,1344,1899, 192, 928,1703,1903,
+   440,1708,1086,1360, 964,1909, 528,1600, 270,1200,1574,1915,1776,1917,1944, 408,
+  1792,1921,1586,1923,1898,1925,  68,1656, 156,1929, 252,1931, 480,1933, 624,1935,
+   834,1870,1832,1939, 697,1941,1510, 472, 918, 792,  35,1512,1569,1949, 998,1951,
+  1640,1953, 278, 738, 662,1957,1122,1959,1796, 312,1192,1644,1138,1965, 353,1967,
+   810,1969,1162, 826,1321,1973, 654, 812, 409, 382,1296,1979, 718,1981,1798,1983,
+    64,1985,1008, 304,1380,1989,1507,1754, 936,1993,1536,1995, 817,1997, 847,1032,
+  1203,2001,1778,2003,1616,2005, 116,2007, 578,2009, 412,2011,1070,1470, 388,2015,
+  1692, 872, 992,1412, 289,2021,1715,2023,1990, 708, 501,2027, 276,1460,1218,2031,
+   905,1888,1562,1848,1010,1364,1080,2039,1590,2041,1802,2043,1690,2045,1710,2047,
+     0,   1, 386,   3, 649,1576,1405,   7,1146,   9,1663,  11, 693,  13,  55,  15,
+   864,  17,  44,  19,1347,1934,1217,1554,1799, 450,1561,1294, 529,  29, 355,  31,
+    67,  33, 631,1076, 840,  37, 338,  39,1447,  41, 558,  43,1747,  45,  28,  47,
+   767,  49, 811,  51,1323,1356,  57,  14,1121,1678, 127,  59, 910,  61,1424,  63,
+  1141,  65, 351, 800, 888,1488, 944, 584, 246,  73,1664,  75, 147,  77, 795,  79,
+  1772,  81, 544,  83, 895,  85, 441, 122,1787, 764, 202,  91,1102,2004,  62, 546,
+  1705,  97, 880,1088, 586, 101, 687,1844,1026, 846,1605, 736,1540, 109,1539, 111,
+  1978, 113, 680, 115,1779, 117,1862, 119,1904,1572,1120, 426,1334,1858,1636,  58,
+  1910, 129, 177, 131,1438, 133, 543, 760, 274, 137,1911, 428, 979, 141, 671,1838,
+  1707, 145,1271,  76,1081, 514,   4, 151, 973, 153,1191, 155,1385, 157, 305, 159,
+  1440, 161, 125, 163,1198, 165,  42, 167,   6, 169,1566, 171,1002, 173, 633,1728,
+   700, 130, 207, 179,1193, 181, 756, 432, 571, 185,1472,1382,1795, 189, 346, 191,
+  1659,1350, 317,1006, 451, 197,1151, 199,  26, 201,1406, 203,1260, 418, 403, 956,
+   548, 209, 832,1418,1396, 213, 897,1828,1609,1238,1538, 219, 842, 221, 100, 223,
+   845, 364, 561,1638,1014, 229, 467,1720,1504,1886,1186, 618,1242, 237,1947, 239,
+   394, 241, 955, 243,1855, 245, 553,1568, 721, 249,1735, 251, 923, 253,1894,1968,
+  1484,1228, 311, 259, 647, 261, 445, 263,1332, 265, 971, 874, 267, 269,1711, 271,
+  1427, 273,1226, 275, 684, 526, 729, 958,1966, 512, 749, 283,1266, 285,1535, 287,
+  1548,2020,1635, 291,1852, 293,1670,1072, 733, 297,  89, 794,1134, 301,1157, 786,
+   668, 158, 787, 307, 238, 309, 596, 582,1961,1676, 226, 315, 495,1522,2038,1016,
+  1523,1430, 947, 323,1147, 325,1034, 327,1583, 329, 339, 331, 414,1354,1730,1328,
+  1771, 337,1184, 330,1129, 341, 373, 343, 411,1804, 257, 347,1927, 518,1577,  66,
+  1890, 532,  88,  30, 326,1688, 843, 376, 989, 870,1485, 363,1816, 365,1278, 367,
+  1926, 369, 745, 371, 227,1174, 598, 776, 359, 377, 240,1620, 779, 381,1977, 383,
+  1291, 385,1661, 387,1346,1004,1051, 391,1248, 774,1047, 395, 990, 397,1534, 399,
+   744, 401,1943,1674,1055,1342,1712, 407,1919,1976,1041,1202,1725, 413, 892, 415,
+  1369, 417, 205, 419,1363,1588,1160, 423,2017, 425, 123, 427, 139, 852,1696, 431,
+   183,1652,1287, 435, 780, 437, 120, 439,1614,  86, 642,1224,1839, 262,1164, 447,
+  1836,1442,  25, 828,1246,1352, 313, 455,1225, 457, 559, 459, 656, 461,1449, 463,
+   652, 465,1443, 230,1958, 469,1654, 471, 402, 473,1889, 475, 927, 477, 717, 479,
+   831, 481,1800, 574,1367,1060, 694, 487, 464, 489, 166, 650, 290, 493,1761, 698,
+   881,1774, 575,1144,1737,2026, 206, 503,1142, 505, 913, 507,2012,1748, 566, 511,
+   281, 844, 334, 515,1317, 517, 349,1956, 296, 228,1564, 523,1079, 525,1668, 527,
+  1991, 508, 550, 531, 280,1166,1455, 535, 657, 537,1873, 539,1063, 942,1982,1694,
+  1913, 545,  95, 547, 914, 742,1247,1268, 132, 430, 912, 555, 272,1232, 715,1514,
+  1633,1916,1119, 614, 710, 565,1520, 567,1148, 569, 357,1112, 460, 573, 483, 498,
+    32, 577, 601,1358, 146, 581, 258, 583,1702,1434, 466, 587, 781, 589,1479, 591,
+   743,1156,1445, 595, 894, 597,1581,1022, 190,1196, 688, 603,1496,1330, 204, 607,
+   622, 609, 751,1766, 484, 613, 563, 615, 536, 617,1992,1516, 961, 778, 667, 623,
+    21, 294, 938, 627,1649, 629, 882, 318, 916,1050,1082, 635,1580, 637,1930,2034,
+  1632, 641,  24, 643,2040, 640,1729, 260, 943,1810, 491, 651,   2, 653, 712, 655,
+   438, 616, 478, 659, 504, 661,1172,1012,1627, 665, 934,1806,1987,1624,1458, 300,
+   775, 673, 186, 136, 869, 677,1062, 679, 215, 681,1176, 683,1808, 685, 212,1490,
+   568, 689,1706,1736,1884,  12,1118, 695,1592,1940, 316, 699, 378, 701, 374, 703,
+   758, 705,1883, 707,1924, 709,1701, 711,1896, 713,1489, 220,1643, 658, 789,  60,
+  1871, 248, 490, 723, 931, 725, 211, 727,  38,1206,2016, 731,1257,1044,1459, 735,
+  1528, 737,1955, 218, 393,1152,1920, 630, 739,1280,1194, 747,1851,1052, 324, 868,
+   193, 753,  40, 755, 222, 757, 851, 759, 135,1790,1005, 763, 298,1970, 752,  48,
+   970,1846, 424, 771,1379,1606, 740, 672, 375, 777,1444,1628,1752, 588,1140, 783,
+   953, 785, 303, 306, 282,1578, 234, 791,1945, 793,1104,  78,1429, 797, 557,1250,
+   112, 801,1687, 803,2029, 805, 436,1074, 819, 809,1222,  50,1975, 813,1413, 172,
+  1842,1996, 556, 808, 356, 821,1657, 823, 883, 825,1971, 827, 196, 829,1859,1932,
+    69, 833, 606, 835,1481,1594,1108,1170, 644, 841,1662, 358, 660, 224, 105,1998,
+   765,1046,1815, 704, 429, 853, 663, 855,1446, 857, 839, 859,1421, 861,1653, 863,
+   926,1582,2014, 867, 610, 692,1682,1038,1312, 873,1782,1986, 150, 877, 175, 879,
+  1618, 496, 592, 824, 639, 885,1389, 887,1860, 889,1731, 891, 268, 893,1764, 552,
+  1390, 214, 676,1114, 645, 901,1456,1128, 149,2032, 987, 907,1897,1734,1732, 911,
+   702, 506,1801, 915, 164, 917,1550, 542, 608, 921,1603,1450,1980, 925,1954,1214,
+  1901, 929, 957,1366,1096, 933,1007,1556, 636, 937,1679, 939, 935,1906, 541, 648,
+   121, 945,1743,1370,1315, 949,1818, 951,1834, 784,1829, 242,1426, 930,1368, 959,
+   103, 620,1003, 963,1137, 965, 782, 967, 510, 969, 400,1700, 482, 152,1646,1392,
+  1040, 977, 110, 140,1351, 981,1407, 983, 308, 985, 168,1988,1669,1570, 790, 991,
+  1068, 993,1316, 674, 611, 997,1345,  92, 798,1001, 815,1698, 389,1552,1018, 666,
+   875,1009,1502,1882, 854,1013, 521,1015, 319,   0, 195,1019,1428,1021, 599,1023,
+   384,1025,1039,1027, 580,1029,1666, 856,1098,1033, 128,1035,1149,1037, 871,1216,
+  1585, 410,1812,1043, 520,1045,1716, 838, 754,1049, 174, 390, 788,1053,1208, 404,
+  1284,1057,1298,1059,1378,1061,   8,1962, 335,1065, 368,1067,1794,1069,  46,1071,
+   295,1073, 807,1075,1946,1077, 444, 524,  34,2002,2025,1083, 621,1085, 941,1087,
+    99,1952,1895,1030, 360,1093,1416,1095,1042,1097,1999,1099, 590,1872, 999,1596,
+  1840,1105, 302,1107, 176,1109,1372,1111, 184,1113, 899, 398,1553,1117, 217,1672,
+    87,  56,1876,1822, 772, 160, 748,1127, 288,1760,1714,1131,1579,1133, 142,1135,
+   850,1908, 108,1139,1807,1984, 572,1143, 499,1820,1584, 750, 600,1658,1854,1560,
+   741,1153,1482,1155, 593,1454,1717,1159, 182,1161, 848,1163, 968, 728, 533,1167,
+  1831,1169, 858,1324, 519,1173, 342,1234, 231,1177, 924,1179, 162,1181, 522, 292,
+  1165,1185, 605,1204, 982,1189, 148, 154,1254, 180,1756,1270,2008,1197,1414,1199,
+    82,1201, 344,2000,1187,1374,1942,1207, 446,1209,1630,1211,1078,1213,1994, 352,
+   104,  22, 612,1219,1295,1221, 255,1223,1436,1738, 675,1227, 602,1229,1305,1231,
+  2018,1233,1648,1235,1132,1237,1110,1239, 372,1241,  27,1243, 625,1938,1195,1494,
+  1084,1249, 799, 264,1415,1253, 540,1255,1972, 732,1281,1259, 244,1261,2033,1263,
+  1744,1265, 806,1267, 551,1269,1410,1094, 836,1273, 474,1275, 236,1277,1190,1154,
+   370,1258, 134,1283, 198,1285, 906,1684, 849,1289,1417,1024,1178,1878,1276,1340,
+   576,1297,1830,1299,  98,1301,1476,1303, 433,1230,1220,1726,1893,1309,1404,1311,
+   770,1313, 554, 948,1727, 516, 724,1319, 866,  74,1529,  52,1856,1922, 976,1327,
+  1064,1329, 310,1331,1251,1333,1885,1335, 225,1337,  10,1526,1306,1341, 405,1474,
+   634,1950, 886,1622, 638,1349, 766, 980,  94,1353, 333,1355,  53,1357, 579,1359,
+  1907,1361,1384,2036,2037,1365,1318,2030, 279, 416, 254,1371, 486,1373,1205,1375,
+  1136,1377,1130,1124,1722,1626, 187,1383,1408,1928, 962,1387, 974,1264,1788,1391,
+   975,1393,1724,1395, 247,1397, 345,1399,1704,1401,1709,1403,1608, 170,1619,1486,
+   458,1409, 452,1411,2019, 814,1964,1252,1028,1290, 726,1419, 830, 860,1892,1423,
+   453,1425, 178, 818,  18, 796, 321,1431, 485,1433, 585,1435, 443,1437,  84,1439,
+  1125,1441, 449,2042, 392, 594,1031,1048,1236, 462,1348,1451,1274,1468,1106, 534,
+  1781,1457,  70,1784, 804,1461, 509,1463, 332,1465,1713,1467,1453,1469,2013,1471,
+   995,1473,1343,1475, 996,1477,1171,1612, 114, 232, 972,1780,1786, 362,1824,1487,
+   210, 714, 102,1491,  80,1493, 530,1495,1381,1532,1767,1499, 686,1501,2046,1503,
+  1272,1505,1733,2024,1625,1509,1210,1511,1642,1513,1362,1515, 619,1517,1825,1519,
+   200,1066, 746, 320,1336,1598,1339,1527, 107,1322, 500,1531,1746,1533,1115, 286,
+   476,1537, 768, 978, 488, 730, 350,1543,1827,1545,1751,1742,1770,1549,1837,1551,
+   762,1116,  23,1555, 940,1557,1448,1559,1056, 118, 884, 256,1158,1565, 986,1567,
+   470,1948,1092,1571,1762,1573, 366,1575,   5,1542,1292,1558, 235,1758, 865,1400,
+  1288,1326,1325,1587, 421,1589,1850,1591,1604,1593, 837,1595,1103,1597,1525,1599,
+  1602,1601, 138, 922,  54, 106, 773,1607, 513, 216,1188,1611,1100,1613,1310,1615,
+    93,1617,1867,  90, 379,1621,  20,1623, 669,1508, 604, 664, 380,1629,  16,1631,
+   900, 560,1394, 492, 903,1637,1240,1639,1089,1641, 448, 716,1960,1645, 442,1647,
+  1175, 628,1150,1651,1304, 862,1500,1655, 348, 896,1036,1900,1749, 632, 722,1338,
+  1826,1665,1091,1667, 277, 988,1244,1671, 562,1673, 502,1675, 454,1677, 696,1718,
+   822,1650, 361,1683,1058,1685,1398, 802, 570,1868,1544,1691,1541,1693,1282,1695,
+    72,1697,1386,1814, 266, 564,  71,1902, 328,  96, 144, 690,1905, 932, 420,1912,
+  1699,1466,1432,2022, 678,1182, 626,1719,1422,1721,1286,1723,1845,2010,1307, 994,
+   878, 646, 904, 890, 719,1506, 909,1864, 691,1530, 456,1739, 966,1741,1547, 946,
+  1320,1745,1497,1020,1462,1660, 208,1546,1279,1753,1768,1755, 194,1757,1314,1759,
+   340, 494, 670,1763, 396,1765,1302,1974,1866,1769, 126, 336, 434,1773, 497,1775,
+   314,1777,1914,2006,1483, 902,1464,1783, 734,1785,1563, 354,1680,1789, 761,1791,
+   549,1793,1000, 188,1963,1797, 919,1388, 284,1750, 422,1803,1686,1805, 920,1740,
+   816,1809, 876,1811,1402,1813, 406,1376,1524,1817,1518,1819,1145,1821,1123,1823,
+  1610, 950,1256,2044,2028, 954,1492,1168,1245,1833,1863,1835, 984,1918, 143,1212,
+   299,1841,1480,1843, 960,1634, 769,1847,2035,1849, 820,1126,1183,1853,1681,1880,
+  1478, 468,1180,1420,1521,1861,1054, 952, 250,1865,  36,1300,1689,1869,1937, 720,
+  1101,1874, 538,1875,1857,1877,1293,1879,1936,1881,1011, 706, 898, 124, 233,1887,
+  1262,1452,1215,1891, 682,1308, 322,1090,1498, 908,1344,1899, 192, 928,1703,1903,
+   440,1708,1086,1360, 964,1909, 528,1600, 270,1200,1574,1915,1776,1917,1944, 408,
+  1792,1921,1586,1923,1898,1925,  68,1656, 156,1929, 252,1931, 480,1933, 624,1935,
+   834,1870,1832,1939, 697,1941,1510, 472, 918, 792,  35,1512,1569,1949, 998,1951,
+  1640,1953, 278, 738, 662,1957,1122,1959,1796, 312,1192,1644,1138,1965, 353,1967,
+   810,1969,1162, 826,1321,1973, 654, 812, 409, 382,1296,1979, 718,1981,1798,1983,
+    64,1985,1008, 304,1380,1989,1507,1754, 936,1993,1536,1995, 817,1997, 847,1032,
+  1203,2001,1778,2003,1616,2005, 116,2007, 578,2009, 412,2011,1070,1470, 388,2015,
+  1692, 872, 992,1412, 289,2021,1715,2023,1990, 708, 501,2027, 276,1460,1218,2031,
+   905,1888,1562,1848,1010,1364,1080,2039,1590,2041,1802,2043,1690,2045,1710,2047,
+     0,   1,
+};
+
+extern const double NoiseGradients[4098][3] = {
+  { 0.6044250694264234, 0.7052602895441197, 0.3705108088045583 },
+  { 0.9819510452214386, 0.011797933075673476, 0.18876692921077562 },
+  { -0.25612867528632977, -0.9649498929391959, -0.05718221587787827 },
+  { 0.7459577565893801, -0.4075548295369986, 0.5267315125424025 },
+  { -0.32136681360633274, -0.4975446917798044, -0.8057125112558771 },
+  { -0.39201418812000444, -0.24844211285312381, 0.885777281755233 },
+  { 0.8456878760610017, -0.4517990128897323, -0.2840592688776328 },
+  { 0.269950865354651, -0.3307848631810512, -0.904272030190345 },
+  { 0.3733198301967363, -0.12950842423959813, 0.9186184585739916 },
+  { -0.7584313097655433, 0.49239350324498427, 0.42700185752459474 },
+  { -0.8142207763724617, -0.4514044498253426, 0.36507334879624587 },
+  { 0.5647858967511004, 0.7703222884147979, 0.2960075384216498 },
+  { 0.08428946352751907, -0.9132722455991386, 0.3985336770670076 },
+  { 0.7671360599333354, -0.5943840464368974, 0.24126721884926278 },
+  { 0.1564187223886557, -0.1598946939972925, 0.9746624390617569 },
+  { 0.9291807075579557, 0.19688349306701827, 0.3128259945398179 },
+  { 0.7278165734023079, -0.16655061798756515, -0.6652397516150724 },
+  { -0.6997812646649738, 0.7134800822440598, 0.03538861207930536 },
+  { 0.8387620447476671, 0.5020138488946816, -0.2108561780187156 },
+  { 0.13727270252461174, -0.7911242592865781, 0.5960525241200246 },
+  { 0.5035355017723896, -0.10229016239148907, -0.857897850057191 },
+  { -0.069863759481821, 0.8888506042103211, 0.4528395505099055 },
+  { 0.19763171145035033, 0.43924045252638183, -0.876361530131044 },
+  { -0.03420175208839992, 0.9591148478504149, -0.2809429635832851 },
+  { 0.9556336745570809, 0.2731154531133706, -0.11032782660421307 },
+  { 0.3238600250542947, 0.07354321402274608, 0.9432423229706332 },
+  { -0.8594428892144986, 0.331888608515109, 0.3888545637080008 },
+  { -0.422569081106577, -0.020321568256893376, 0.906102866983834 },
+  { 0.7739151618907086, -0.541153201435913, 0.3289506570465251 },
+  { -0.2847006656052786, -0.753582682863095, -0.59250204311274 },
+  { -0.4829572601736283, 0.301973276547486, -0.82192726265574 },
+  { 0.7970381094445963, -0.5870766637341273, -0.1416730143386175 },
+  { 0.13171284443365194, -0.9852120763637164, 0.10958508656879841 },
+  { 0.5972689853744882, -0.6528523934888653, -0.46589002074050606 },
+  { -0.22742840166563116, -0.8545027029174159, -0.4670133325962404 },
+  { 0.9674261799769573, 0.2491041884069413, -0.045096447901256616 },
+  { 0.21698890606673904, -0.42904624608650677, 0.8768324431515045 },
+  { -0.25623618806925264, 0.5538269507952518, -0.792223910581202 },
+  { 0.9158028590861481, -0.3694211815213517, -0.15758525925036682 },
+  { -0.15146766412506724, -0.2608260606303025, 0.9534292384967925 },
+  { -0.39022671338202336, -0.6543395481583506, 0.6477367272889424 },
+  { 0.9872253530516726, -0.1161098376225076, -0.10910823937391417 },
+  { 0.20588329555412055, 0.8757289472865409, 0.43670456775282473 },
+  { 0.6487356392592135, 0.7168042609373751, 0.25560462017921903 },
+  { -0.5742001265758132, -0.4834258418597839, 0.6607523515376086 },
+  { -0.7402548659160272, -0.6285395736512609, 0.23866448802018256 },
+  { -0.17124767920276962, 0.9313239168950626, -0.32141872096519836 },
+  { -0.13694785715487964, -0.5885362456242762, -0.7967875325374816 },
+  { 0.46621149457362215, 0.4992293058040486, 0.7303539844170341 },
+  { 0.012996029921419005, 0.11510769358971118, 0.9932680011370238 },
+  { 0.7696645358035364, 0.6377220439515017, -0.030448267350469575 },
+  { -0.2785310018776764, -0.2785310018776764, 0.9191523061963321 },
+  { -0.8242483702624798, -0.3447469341561053, 0.44918167316756386 },
+  { -0.6271436097817986, -0.7119359855941336, -0.3159715891120031 },
+  { 0.7228249836702664, 0.4200850905837575, 0.548682567293071 },
+  { 0.9124358799110261, -0.08894991103976281, -0.39943544957478394 },
+  { 0.8897442943201306, -0.12413730368986671, -0.439255074594913 },
+  { 0.9127894480876286, 0.3775744652953004, 0.1557335757531121 },
+  { 0.32876507889361045, 0.9443475392143419, 0.011011270584953459 },
+  { -0.9715936904949085, 0.1187434682208927, 0.20470879156830982 },
+  { -0.46929232533346177, -0.3450530923673685, 0.8128364391627806 },
+  { -0.8459827013719898, 0.4163673250600397, -0.33309386004803176 },
+  { 0.9498946754122161, -0.30770268588913435, 0.054946908194488275 },
+  { 0.5383058000309445, 0.739508623649068, -0.4041705842855288 },
+  { -0.23378812533130688, 0.961569238650799, -0.14397121842436414 },
+  { 0.8829492644192347, -0.24983773398357767, 0.39746912224660086 },
+  { 0.8007932443765277, 0.08189930908396305, -0.5933149946971545 },
+  { 0.9702564102564103, 0.05435897435897436, -0.2358974358974359 },
+  { -0.34120606393880315, -0.8396143174566622, 0.42264195231090423 },
+  { -0.35582932769122627, 0.8717260802216091, -0.33686663624686625 },
+  { -0.05895060523211584, -0.1168759825471514, 0.9913953958166264 },
+  { -0.36710646144562853, -0.25390182575754927, -0.8948556916295791 },
+  { 0.16628470059345674, -0.9413523008491504, -0.2936072956085303 },
+  { 0.5115745673123936, 0.6172825773948014, 0.5977070199721333 },
+  { -0.8776778134121582, -0.32391832009755517, 0.3532118029585515 },
+  { -0.3979377139632379, 0.8456954860126401, 0.35559066458999816 },
+  { 0.5176840151740032, 0.8553893904328979, 0.017670630100756115 },
+  { -0.11271209439982437, 0.928488974359209, -0.35384206684535024 },
+  { 0.24103193718443935, 0.12869578546499477, 0.9619464642383507 },
+  { -0.9338247382287176, 0.33988473928177587, -0.1115783235015931 },
+  { -0.8383937222372194, 0.2981225862817399, 0.45631008104347937 },
+  { 0.8337861110060072, 0.5314044527227128, 0.14969979532368227 },
+  { -0.7769497714203873, 0.513160639405493, 0.36471250438496533 },
+  { 0.13501554555187598, 0.9701520248929153, -0.20143448328304078 },
+  { 0.6264151375205324, -0.6132689646449703, 0.48114992724557154 },
+  { 0.6778907206321967, -0.2929305953397336, -0.6742817194575799 },
+  { 0.5314878457109826, -0.6004504744609536, 0.5974779473596616 },
+  { -0.5723822632542933, 0.519973833405157, 0.6340392395473949 },
+  { -0.5329445938874225, 0.32575919554602023, 0.7809295783637471 },
+  { 0.7415782349369157, -0.340077291577131, 0.5782812094659585 },
+  { 0.4136038037662326, -0.031020285282467447, -0.9099283682857118 },
+  { 0.38823927307414585, -0.8339954754926097, 0.39207373503043375 },
+  { 0.1914626317364729, -0.8869411317858464, 0.4203302147062303 },
+  { -0.4564496770420337, 0.6853854963684121, -0.5673626826784157 },
+  { 0.24621877040508436, 0.7242406923390772, 0.6440898513875392 },
+  { -0.11992479769968523, -0.9806045958248651, -0.155024738489837 },
+  { -0.7438355454584284, 0.32993185923456314, -0.5812517953302051 },
+  { -0.6335462987909153, 0.4679208495640398, -0.6161729999209633 },
+  { 0.054113281060104795, 0.051021093570955946, 0.9972304652505026 },
+  { -0.8904112127707564, 0.24739444012505188, 0.38205217335767505 },
+  { -0.7758068648717314, -0.11223601852205252, -0.6209080322915888 },
+  { -0.37536603859948725, -0.7035111896139644, -0.6034669362558921 },
+  { -0.5870208004022373, -0.7993811079086122, -0.1280485228884593 },
+  { -0.6300804267359589, 0.7685169886676788, -0.11126676940306461 },
+  { -0.773832644874388, -0.5500887012285984, 0.3139832137349753 },
+  { -0.5021192428200039, 0.05441420979057982, 0.8630847929159294 },
+  { 0.9673094372611479, 0.2437876400466563, 0.06985727697243367 },
+  { -0.08038065025763391, -0.9908031542173625, 0.10884879722387926 },
+  { 0.35319221926035427, -0.9326967549675924, 0.07302067876203805 },
+  { 0.4572527118694286, -0.8864687468683795, 0.071366086579398 },
+  { 0.8424375732922951, -0.032259065895059634, -0.5378273772996008 },
+  { 0.5517247882459412, -0.7483437732579937, 0.36821373556802556 },
+  { 0.0952593827584468, 0.5223563955655489, 0.8473897839886009 },
+  { 0.04897398549971977, -0.9980104072105056, -0.03970863689166468 },
+  { -0.3201735681614192, -0.8827807194090928, 0.34378348955461735 },
+  { 0.6524619096587535, -0.033014796457861456, -0.7571020272455348 },
+  { -0.21536868633712222, 0.7422527939832962, 0.6345684508147351 },
+  { -0.6859573516049111, -0.13597604201249067, -0.7148237739315851 },
+  { 0.020886856960628974, 0.7512066141357248, -0.6597365853771082 },
+  { -0.7867489293041153, -0.4321485273009968, -0.4407649856674277 },
+  { -0.8009723568127362, -0.11288872142998295, -0.5879620907811612 },
+  { 0.6224602450810084, -0.775767999017764, -0.10357246252583499 },
+  { 0.40471898423563585, 0.5383155421386613, -0.7392015428090193 },
+  { -0.8966184768963094, 0.4222101744559629, 0.13346863104867684 },
+  { 0.3953690177952137, 0.6087520023993952, -0.687825805958438 },
+  { 0.21631480697389663, 0.8228732184209717, -0.5254403588318638 },
+  { 0.8788377972910023, 0.30714736996641573, -0.36510905107298125 },
+  { 0.5519619503974836, 0.798836926941212, 0.23916013352673687 },
+  { -0.2114936275906109, -0.961051925374982, 0.17790346320857273 },
+  { 0.9206340059562483, 0.16155972806474553, -0.3554314017424402 },
+  { -0.2193440621166095, 0.9207939677028878, -0.32253162861362633 },
+  { 0.28137604814851824, 0.12595895296179155, 0.9512948342638532 },
+  { -0.8638182970756548, -0.46040755276686296, -0.2045552125772995 },
+  { 0.000570495027386555, 0.38052018326683223, 0.9247724393936058 },
+  { -0.7270917462823384, 0.4811741077547831, -0.4897030431950451 },
+  { 0.7293864497060938, -0.6820236932316721, 0.053283101033724384 },
+  { -0.9397631356053697, -0.3412167717939883, 0.020404989675388004 },
+  { -0.9340069662359426, -0.24328191921590653, -0.2616197523226331 },
+  { 0.6605484339857896, 0.14115680231214478, 0.7373944151673046 },
+  { -0.39649378666904395, 0.8266729786121988, 0.39925488546200383 },
+  { -0.6588851234211902, 0.04285431697048392, 0.7510219049077306 },
+  { 0.5878462084565453, -0.5076853618488346, 0.6298352233462986 },
+  { 0.059733374854718135, -0.03944656830028556, -0.997434655592935 },
+  { -0.8365165160139914, 0.38413718959063553, -0.39074126734864073 },
+  { -0.8415494884554148, -0.5016319859594823, 0.2003991246058109 },
+  { -0.9765881771915563, -0.001777769740033173, -0.21511013854401392 },
+  { 0.013911254134355552, 0.8855048304753246, 0.4644218687931007 },
+  { -0.42458148238269616, 0.8717696327125575, 0.24443459717872357 },
+  { 0.9440307786239358, 0.32757868018250574, 0.03870526192358137 },
+  { -0.23439358896071924, 0.929301640938381, -0.2854086642051111 },
+  { 0.5097132899616836, -0.06598539776239432, -0.8578101709111261 },
+  { -0.8187003106229063, -0.5548110595573469, 0.14803543352458212 },
+  { 0.7411407895247281, 0.6687400114279799, 0.05913651340726764 },
+  { -0.021779443888484813, -0.8666937523858809, 0.49836492191885834 },
+  { -0.6789603551160605, -0.6000384676837662, 0.42304452895692995 },
+  { -0.6121061585610384, 0.11912404823429419, 0.7817515665375556 },
+  { 0.17946395122027003, -0.4829211778290903, 0.8570763246155926 },
+  { 0.006372982797196546, -0.6086198571322702, 0.79343635825097 },
+  { -0.8665677889651894, -0.35820995236927383, 0.34748510349594225 },
+  { 0.8460870456824672, 0.13351373593216237, 0.5160530916928523 },
+  { -0.7337615750718528, -0.05607608785101965, -0.6770889330947585 },
+  { -0.17062748709617767, -0.0007685922842170166, -0.9853353083662152 },
+  { 0.9696128042496025, 0.2416385221946959, -0.03823394338523669 },
+  { 0.13621199476423104, -0.1237383688700707, 0.9829217204598357 },
+  { 0.4561001922465339, -0.8659171546525524, -0.20532923783792303 },
+  { -0.017213352994843854, -0.001967240342267869, -0.9998499039576444 },
+  { 0.9644747405190992, 0.23093057167358713, -0.12829476204088175 },
+  { -0.9185252604089148, -0.2426582306419547, -0.3121351135204933 },
+  { 0.20755317351228142, 0.26864151890774013, -0.940613318257786 },
+  { -0.6149137584033123, -0.6773127560272647, -0.4038916937114007 },
+  { 0.5048062542337394, 0.6899462788735541, 0.5187916517784736 },
+  { 0.7271970654404659, 0.25045979688567116, 0.6391043092944713 },
+  { 0.6825308144931587, 0.6102628458997654, -0.40215786226508665 },
+  { -0.3931149093179848, 0.03710298020529295, 0.9187404622263016 },
+  { 0.24561714301555643, 0.8473791434036697, -0.4707661907798165 },
+  { -0.3050133971834723, -0.5201053918954021, 0.7977826827275254 },
+  { 0.4241770749951977, 0.8069404118991482, -0.41099997651161907 },
+  { 0.5276768420450676, -0.4189308785225316, -0.738954714031709 },
+  { 0.16199482596517634, -0.8689333774386491, 0.46766704174398965 },
+  { -0.8539971867709772, 0.12332298358116484, -0.5054505383397038 },
+  { 0.4533111384955482, -0.7801383137041512, -0.4311533639051344 },
+  { 0.29043590576650635, -0.6776837801218482, 0.6755676715188136 },
+  { 0.8080285077307111, -0.5346436920182741, 0.2474793997074279 },
+  { -0.885275121777185, -0.07765571243659518, -0.45853849248275247 },
+  { -0.3075962560451978, -0.5603908802662512, 0.7689906401129946 },
+  { 0.23052756683418643, -0.2971244194751736, 0.926592747802966 },
+  { -0.09183063661880285, -0.6208847520644432, -0.7785045014847765 },
+  { 0.5793954711415824, -0.5840806097222421, 0.5684634811200431 },
+  { 0.05913252037491854, -0.9091625007643727, 0.4122218968443841 },
+  { -0.253364118160176, 0.963322721600499, 0.08840790506014652 },
+  { -0.13579008461481407, 0.516403671540081, 0.8455106746459359 },
+  { 0.5223747515956725, 0.7588758059937133, -0.38888575439677836 },
+  { -0.9295066532606532, -0.27651990043238067, -0.24403714104423957 },
+  { -0.08194231993876713, -0.0568579362840425, 0.9950138849707437 },
+  { 0.6519147759686421, 0.4048841768987636, -0.6411520320257637 },
+  { -0.9746810962987354, 0.156850993903087, 0.15935660083444622 },
+  { -0.5981509039984626, 0.13141707290566448, 0.7905346602108786 },
+  { 0.4598989067534622, -0.8365292092200858, -0.29784539225676865 },
+  { 0.32610821075684543, -0.9450248501862105, -0.024113635302442798 },
+  { -0.7809300578928813, -0.46015292920799883, -0.42238315120364284 },
+  { 0.12342067618195282, 0.14923826660776948, 0.9810684361810332 },
+  { -0.06677158947263735, -0.9960925922074781, 0.05780227148377562 },
+  { -0.7494188759683846, 0.4020061520095308, -0.5260821248519787 },
+  { -0.04993049226594689, 0.8875575435550215, 0.4579831359566163 },
+  { -0.20990618075262346, 0.2825660125516085, 0.9359999165772032 },
+  { -0.16511435354609302, -0.5603278262909582, -0.811646460804891 },
+  { 0.9987367468432454, -0.04823022923091452, 0.014098067005959631 },
+  { -0.8795507962028479, 0.03117810658181737, -0.4747823949652189 },
+  { -0.5275555649124379, 0.49068340177339653, -0.693480299038124 },
+  { 0.6813519365489787, -0.7018393229572384, 0.20780063356949094 },
+  { 0.5642537691861821, 0.8216730040083914, -0.08044351088194042 },
+  { -0.8138791314623606, -0.4499694291770755, 0.36759797629493324 },
+  { -0.30829965093028955, -0.21782040554857413, 0.9260159805116305 },
+  { 0.8059939703021185, 0.2794533452369735, 0.5218041276882471 },
+  { 0.6036507635815765, -0.6840364180283695, -0.4095118245402655 },
+  { -0.7651028513981287, -0.49036137294152793, -0.41732882803534294 },
+  { 0.11708263326643495, 0.9814630941671052, 0.15172953494731875 },
+  { 0.40889183721150124, 0.66856996296534, -0.6211454500214318 },
+  { 0.27131177438234794, 0.8144570765593175, -0.5128836042650924 },
+  { 0.27350448004472255, -0.043827289905746615, -0.9608717229968752 },
+  { -0.555800208727429, -0.7267640847533571, -0.40360883673572046 },
+  { 0.5040894641684588, -0.8607565378725569, 0.07065404888614515 },
+  { 0.2912815889619983, -0.6855278326268426, -0.6672380584362054 },
+  { 0.5607318519009973, -0.6344046499609823, 0.5320813193221142 },
+  { -0.0786680383733229, 0.30898530734582247, -0.9478076912448542 },
+  { -0.6472756957761278, 0.5002603957891208, 0.5751292985602818 },
+  { -0.823362977701214, -0.24783501001039887, -0.5105401206214216 },
+  { -0.48439261529871924, -0.5374016184823527, -0.6903356391615709 },
+  { 0.8421125916212171, -0.013149790624940929, 0.5391414156225781 },
+  { -0.9439544901863706, 0.0032438298631834043, -0.3300596885789114 },
+  { -0.9344333977328858, -0.3483986590685113, -0.07384171964843207 },
+  { 0.7682571492275487, 0.2110146303211667, -0.6043622907256717 },
+  { 0.1430380409068557, 0.1711951355735596, -0.9747986173612883 },
+  { 0.81021496548835, 0.22670384285890427, -0.5405155662251708 },
+  { -0.8774105386882763, 0.19244504749070165, 0.4394492579297981 },
+  { -0.4397696666151208, 0.055262061281000634, -0.8964088045686524 },
+  { -0.5190748839133779, -0.33332389999529494, -0.7870555524117977 },
+  { 0.1752183329156687, 0.2526992720373372, 0.9515469582327789 },
+  { -0.8081001566018718, 0.2822714919361299, -0.5170076805427379 },
+  { -0.9440738889057532, 0.25652670471739536, 0.2071679078747529 },
+  { 0.09493762930119765, 0.844000495044155, 0.5278731011406906 },
+  { -0.9659259226904751, -0.22635387051447328, -0.12550313612683667 },
+  { 0.919844504987103, -0.18027103364068853, -0.3484084400170999 },
+  { -0.1602811482453811, 0.9115680164915327, 0.3786207929140117 },
+  { 0.9596979929128758, -0.2732473452043605, -0.06569361261010757 },
+  { -0.677298278880183, -0.14131080635152962, -0.7220099012023466 },
+  { -0.14667247652375937, -0.3666811913093984, 0.9187121902806709 },
+  { 0.9957871455842638, -0.043648916485491504, -0.080639523676586 },
+  { 0.5605861636472359, 0.4322037484324036, -0.7063590255445555 },
+  { -0.7600532901647071, 0.6183149573009833, 0.2000140237275545 },
+  { -0.9169134469877532, 0.3948966129196293, 0.05767491515070592 },
+  { 0.09956050704116681, -0.39573736132086434, 0.9129510645661713 },
+  { 0.4194131410270641, 0.8836833024848303, 0.20783752799558614 },
+  { 0.4055225084630907, -0.34373930080250903, 0.8469916104741562 },
+  { -0.6949833367932206, -0.3568669875613578, 0.6242147985819004 },
+  { -0.3448444805067225, 0.641571126524135, 0.6851779140300722 },
+  { 0.022126919752389434, 0.8679284272874755, 0.4961961754473331 },
+  { 0.4094531881108806, -0.8591804602982412, -0.306850164392229 },
+  { -0.8918964932111072, 0.09799972566914496, -0.4414937136205925 },
+  { -0.22976507222774, -0.343255092752351, 0.9107051953754058 },
+  { 0.48814865455146583, 0.7272077559242728, 0.48257618132599245 },
+  { -0.26411920638160025, -0.7547116689139391, -0.6005425393970775 },
+  { -0.16652991063497402, 0.3554675156673146, 0.9197340018555447 },
+  { 0.41312460015395475, -0.1462210705999452, 0.8988589785167864 },
+  { 0.7386916964497765, 0.3100049640225516, -0.5985244354890848 },
+  { 0.3223980918719011, -0.8699957001468923, 0.3730508706373378 },
+  { -0.03628323200097152, -0.0960110139102631, 0.9947187603958653 },
+  { 0.6013670675377594, 0.7508252136260689, -0.27316505754653886 },
+  { -0.4738530067332282, -0.5518993843128188, 0.6861999691088674 },
+  { -0.8951203662027162, 0.3906385638041779, 0.21485121009229782 },
+  { 0.04237596696708972, -0.1695038678683589, 0.9846180560000259 },
+  { -0.7490344972299745, 0.5875080104123541, 0.30623791349334334 },
+  { -0.31587118496559646, -0.8371596650580733, 0.44653005465285805 },
+  { 0.23653628715878858, -0.9245952049026833, 0.29862064886424067 },
+  { 0.35906883128893974, -0.878572672302725, 0.31492798205247435 },
+  { -0.18746306259040124, 0.48819685786382433, -0.8523622634397398 },
+  { -0.5301003055016295, 0.1476896373536878, -0.834973914038885 },
+  { -0.2547339344387803, 0.920425349046374, -0.29652622055764266 },
+  { -0.930068490245703, -0.34481342198635373, 0.12679237938511662 },
+  { -0.25151645966961095, -0.6388306717238648, -0.727072790977699 },
+  { -0.762778333586011, -0.21614147179043475, 0.6094686849904701 },
+  { 0.671598107349728, -0.6056593840826637, -0.4267700700340544 },
+  { 0.016971875447547368, 0.2915169194519901, -0.9564150987500223 },
+  { 0.4253174756175903, -0.014328070987117405, -0.9049307991863624 },
+  { 0.046683116419988915, 0.9037372537715803, 0.4255345612129759 },
+  { 0.0016563301776622913, 0.9805474651760765, 0.19627512605298153 },
+  { 0.3128379360192747, -0.9485567594549116, -0.04870831427587423 },
+  { -0.29747276340883383, 0.6170977538800276, -0.7284918099650377 },
+  { -0.9319277097611796, -0.07673933688193942, -0.3544316830564151 },
+  { 0.1271517372011714, 0.8985389428882778, -0.4200716651238699 },
+  { 0.8976748210240622, 0.3744099411739601, 0.2323727859486338 },
+  { 0.561618082514468, -0.8245031424148572, 0.06913535666211536 },
+  { -0.8761043946905301, 0.31465028765540926, 0.3652893183249517 },
+  { -0.658034556844005, 0.7160758620704156, 0.23286451373969572 },
+  { 0.8280428059653567, -0.09508871452736871, -0.5525425303617372 },
+  { 0.6397093679145975, -0.22487470842511292, 0.734985231221027 },
+  { 0.3757421471969746, -0.8767316767929406, 0.3002655586770583 },
+  { 0.5220396997925182, -0.6856869103720087, 0.5072553723569878 },
+  { -0.4783573910163941, 0.12557914237390655, -0.8691398537983532 },
+  { 0.47221502402639715, 0.6646855041163643, 0.5789699056957311 },
+  { 0.23913624140009368, -0.5369595879144305, 0.8090044863879317 },
+  { 0.37529315523559675, -0.870574403764828, -0.31820630908708347 },
+  { -0.5803277522002475, 0.33433807813327693, 0.7425885465965356 },
+  { -0.9211003708461825, 0.3796154749140927, 0.08640716424448242 },
+  { -0.19180524038069985, 0.08246403646940917, -0.9779623880557339 },
+  { 0.4298438599198123, -0.6996615117489956, -0.570708353773052 },
+  { 0.1183407638669817, -0.7611723889502464, -0.6376613975356781 },
+  { -0.9934306117269689, -0.058876884796612454, 0.09812814132768742 },
+  { 0.6172891578798224, -0.7687204856380304, 0.16740044959452813 },
+  { -0.37942295494952233, 0.8917876649476462, -0.24648119990092074 },
+  { -0.8669557000802937, -0.486828970045088, -0.1067022400098823 },
+  { 0.6272093141632917, -0.28499971346499364, 0.7248335254054442 },
+  { -0.9913121912043621, 0.13103551952701337, 0.01139439300234899 },
+  { 0.47640241653050375, 0.09334527635723132, 0.8742581980774835 },
+  { -0.3791321588507818, -0.7893785070297432, -0.4828461232780473 },
+  { -0.3281397224582299, 0.3350398568089871, -0.8832171968969179 },
+  { 0.33363952741582054, 0.6242287932295998, 0.7064156562880424 },
+  { 0.30379817481775717, 0.1312708162792778, -0.9436496393104655 },
+  { 0.8139889127477082, -0.42000578809936095, 0.4012694704146311 },
+  { -0.7198731006650056, -0.21817012989479312, -0.6589267890749622 },
+  { 0.31632903917329686, 0.4446572497912672, -0.8379832153353463 },
+  { 0.04686918216158771, 0.9961450059418044, -0.07415124341982533 },
+  { 0.19711540148084816, -0.49728698796828086, 0.8448971358079509 },
+  { 0.7514272406897464, 0.6576426769589435, -0.05350898421450721 },
+  { -0.16400611544901653, -0.1282820110937852, 0.9780826753015606 },
+  { 0.33102373000975166, -0.6934334136796872, 0.6399792113521866 },
+  { -0.36904544015498275, 0.9292401069095767, -0.01784059448263038 },
+  { -0.6389034545637883, -0.7581654327490287, -0.1303363047310128 },
+  { 0.6775699292122427, 0.13074090517724743, 0.7237442965169055 },
+  { -0.8854105551555844, 0.41177776317615006, -0.21560895754287684 },
+  { 0.8221182479187609, -0.31556053960518093, 0.4738598234531747 },
+  { -0.7890168259513168, -0.6137526890719478, -0.027569639509114233 },
+  { -0.03790746398432229, 0.21999867490901331, -0.974763359596859 },
+  { 0.03474751340037992, -0.8650574977885627, 0.500467916886069 },
+  { -0.046564526921637345, 0.20403729069299273, 0.9778550653543843 },
+  { 0.49435417958693395, -0.7141963912150058, -0.49551736589184436 },
+  { 0.03995321800146475, 0.05438076894643813, 0.997720638425467 },
+  { -0.44741786098455133, -0.5341147475421115, -0.7173135256845748 },
+  { 0.008350061535548198, -0.07001205441344259, 0.9975111972851041 },
+  { -0.9112797350516315, 0.3381183592779404, 0.2350430164957507 },
+  { 0.5347052322527982, -0.43421098647479006, -0.7249490560212288 },
+  { 0.053514863022669217, 0.5839874372570892, 0.8099968102169058 },
+  { -0.8932745568160199, 0.4491635073582815, 0.017683602651900845 },
+  { -0.879938512592638, -0.1306778915300656, 0.4567619760022854 },
+  { 0.5421242909830678, -0.3289814073486993, 0.7732221457931576 },
+  { -0.37041477966273484, 0.8914377664410872, -0.2610203048997019 },
+  { -0.6157248007268951, -0.023214040960978087, -0.787619246890328 },
+  { 0.39178211900034504, -0.0018957199306468308, -0.9200560730072619 },
+  { 0.6106772993024526, -0.3952130172858634, 0.6862068981615287 },
+  { 0.01593399294298436, 0.07303080098867833, -0.9972023916817714 },
+  { -0.7846136099168366, 0.16668495617690574, -0.5971579426898492 },
+  { -0.16174159928708456, 0.14990684811973692, -0.9753807420422357 },
+  { -0.7900873107725932, -0.5297312943612288, 0.30845874461669737 },
+  { 0.38548570512396996, 0.07337663555979053, 0.9197916288480785 },
+  { 0.4886892324231649, -0.5973424736483973, 0.6358968495670282 },
+  { -0.4809817149671198, 0.8617299032261856, 0.16148734858519795 },
+  { 0.016466756883784687, 0.9791839361250537, 0.20230587028649757 },
+  { 0.949716983943711, -0.3099494759314203, -0.04437310873377171 },
+  { -0.7314075774217533, 0.1582416393918762, -0.6633268721019926 },
+  { 0.09126201573949895, -0.01064723516960821, -0.9957699939576441 },
+  { -0.7157846354203079, -0.6605795101644033, -0.22646647974297207 },
+  { -0.32257960886250664, -0.945248216407863, 0.04947934239524504 },
+  { 0.82528212526492, 0.4789527642436169, -0.2991883409185848 },
+  { -0.6982348546827762, -0.6760157662282726, -0.23552233761773836 },
+  { -0.43187163455348865, -0.673546351003747, 0.5998518186332646 },
+  { 0.854562103937942, 0.40484624733098207, -0.3253046672508395 },
+  { -0.004717806715256317, 0.9844490012501513, 0.17560724995676288 },
+  { -0.17536899331127803, 0.8431201601503752, -0.5083248092833899 },
+  { -0.3950532162584981, -0.5397114547242535, 0.7434006335504743 },
+  { -0.9372351984221869, 0.2646374300241341, -0.22706213570022055 },
+  { -0.6374241754866753, 0.44441434800083535, 0.6294333227563699 },
+  { 0.4666335545705351, -0.006977698012269684, 0.8844232230551824 },
+  { -0.8302690035452295, -0.4111213862882393, 0.3763410520903188 },
+  { -0.2305092953959056, -0.905419069589964, -0.3564853056704121 },
+  { -0.7379406312361247, -0.09858538884883396, 0.6676260524248241 },
+  { 0.8033331831558038, -0.2274925828405816, -0.5503661704658862 },
+  { 0.9886502334289505, 0.1502144982768717, 0.0025140501803660536 },
+  { -0.7117664688851125, -0.29720990061437386, -0.6364391320052627 },
+  { 0.8868795521578767, -0.26636828654627304, -0.37748191464843267 },
+  { -0.7733534625238949, -0.5496561799756609, -0.3159153459660775 },
+  { 0.19414315283779052, 0.8487204046354762, 0.4919167723930503 },
+  { 0.7109237349350899, -0.7029582028909992, -0.020909521615737937 },
+  { -0.7192403868856992, 0.24776016055748848, -0.6490825592426877 },
+  { 0.6745306975942124, -0.4958088888299339, -0.5469752131132556 },
+  { 0.14779664493481934, -0.9134050004979093, -0.3792722726636173 },
+  { -0.07882110197193784, -0.9340300583674634, 0.34838927071596526 },
+  { -0.004975923483672638, 0.36766545740470047, -0.9299448110597086 },
+  { 0.3290412411970607, 0.866368782647018, -0.37568203849295473 },
+  { 0.33596203163057237, 0.3225948420431491, 0.8849079506874227 },
+  { -0.24899470116944722, -0.9106091928482641, 0.32983713661407293 },
+  { -0.15244437010691006, -0.6238326351183482, 0.7665465135163065 },
+  { 0.1090608934240759, 0.006751388640538032, 0.9940121429222918 },
+  { 0.40914835017268636, 0.5569242899156468, -0.7227952426883575 },
+  { 0.8353570654834676, 0.03775625154727537, 0.5484095537241748 },
+  { -0.45128674930002666, 0.5400121497989003, 0.7104415162247945 },
+  { -0.5275218993605248, 0.612145204049609, -0.589066120952586 },
+  { -0.23497699802321004, -0.8592153416727818, 0.45446100716576887 },
+  { -0.5501038588080085, -0.19530819173183558, 0.8119362381166265 },
+  { 0.15198338300418673, 0.5135567538609213, 0.8444883136281021 },
+  { 0.03669645126898118, -0.9883978595891161, 0.14738738624426867 },
+  { 0.41254207661847764, -0.566116134337765, -0.7136676799896292 },
+  { 0.788642589249843, -0.4057659759992596, -0.4619489572914648 },
+  { -0.17556107905942456, 0.8870861571857267, -0.4269150468757813 },
+  { -0.5875390960871519, -0.4408180732069713, 0.6785847308208355 },
+  { -0.4415816216069816, -0.3396399184206852, -0.8304519235176343 },
+  { 0.5792855098626752, 0.10894819222187929, 0.8078109862305196 },
+  { -0.45778938064809377, -0.30027045397348084, 0.8368192979588811 },
+  { -0.761019574470806, 0.139341612227049, -0.6335875017503424 },
+  { -0.15566718704633825, -0.465756223642644, 0.8711135787113088 },
+  { -0.5537742151322613, 0.7691694556479464, -0.31892392063451436 },
+  { -0.9909035125438891, -0.11949671301549683, -0.061893169305462466 },
+  { -0.8995795689421779, -0.09172928093995485, -0.42701561816875533 },
+  { 0.4252322891804304, 0.4397950388098972, 0.7910485598726362 },
+  { -0.39943498364940366, -0.6662706489561775, 0.6297103430756993 },
+  { -0.3654510011317562, -0.364141140912646, -0.8566485832980952 },
+  { -0.5628504484567592, -0.7927274880492475, -0.23405662213053352 },
+  { -0.5849608865435807, -0.5958318410722667, 0.5502773649520587 },
+  { -0.4969715887600359, -0.8206077798181357, 0.28217390323570984 },
+  { -0.49091369983951155, -0.6970974537721064, -0.5225503604958357 },
+  { 0.9322940917694595, 0.3323586188181155, -0.1427076555377219 },
+  { 0.8180334633880695, -0.5619620869072731, 0.12255556150637338 },
+  { -0.4999159397390189, -0.8629935748049486, 0.07298042915898086 },
+  { -0.5267507931805196, -0.7998053629530134, -0.28782804462958766 },
+  { 0.26487076750924304, 0.7557749465879574, -0.5988720285912797 },
+  { -0.34292076123348486, 0.2886644810383252, -0.8939117232153976 },
+  { -0.5930719502333294, 0.7805551800225801, 0.19748233537801063 },
+  { -0.13383836412432717, 0.1548214974828022, -0.9788348155872403 },
+  { 0.9130409102217506, 0.08983735863627666, -0.3978511596749395 },
+  { -0.8034101293138137, 0.5492495663925254, 0.22990667222502217 },
+  { 0.9773837192461098, 0.092206011249633, 0.1903132072192425 },
+  { 0.6911878951390183, 0.18058062125253632, 0.6997499073535782 },
+  { 0.817841147618018, 0.12230329623953339, -0.5622968619793182 },
+  { -0.6106196979899559, 0.30439024101607737, -0.7310883432259261 },
+  { -0.8006594564853792, -0.5132004710666701, 0.30914351236518806 },
+  { -0.322629070272049, -0.5844549696082119, -0.7445286237047285 },
+  { 0.6964331253938015, 0.46867318677097775, -0.5434393672307497 },
+  { -0.7667617150092564, -0.10853413118365828, -0.6326901411941491 },
+  { -0.8445039312816354, 0.47384883924780036, 0.2495603886705082 },
+  { -0.7380633297809893, 0.6732220135664638, 0.04510700258401768 },
+  { 0.694174216866191, -0.6914590634755801, -0.20001629977500418 },
+  { -0.3804570249675179, -0.16177416355761684, -0.9105391656365469 },
+  { 0.5474588559804423, 0.7269535628592758, 0.41452058869830616 },
+  { -0.5691675358449091, 0.5373815652567118, 0.6223097054220516 },
+  { -0.716211720990137, 0.16102013259289957, -0.679053228853314 },
+  { 0.5117403029149028, -0.04042748393027732, 0.858188487988292 },
+  { 0.8113482770491234, -0.5663529149597802, -0.1447699866891573 },
+  { -0.9628593152142471, -0.26689336456203927, 0.040864055818111276 },
+  { -0.9887852033268646, 0.1472248449686944, 0.025073226872397738 },
+  { -0.4297188471442641, 0.9019298290938621, 0.043177491818323185 },
+  { -0.6242189316599899, 0.7143969011493317, 0.3162084644431468 },
+  { 0.4473265026503807, 0.7469121420400853, -0.49195655509371 },
+  { -0.4603970845963946, 0.6602934833224301, -0.5933355209129756 },
+  { 0.7896894956869095, -0.2828421084192791, -0.544417892897259 },
+  { -0.8572069693096874, -0.446592838108045, 0.25641967303134555 },
+  { -0.8222756055015937, -0.3431078066121758, 0.45402627857731886 },
+  { 0.8227572110270188, 0.5128144260510871, -0.245136566299146 },
+  { 0.722363198298246, -0.46980475808557554, -0.5074198449257605 },
+  { -0.46224676422876615, 0.8843644137607493, -0.06501932507833194 },
+  { -0.7719055173345205, 0.11443072688704206, 0.6253538846546246 },
+  { -0.4326132134323645, -0.8430411338681975, 0.3195738634024182 },
+  { -0.20389074043134656, -0.147552509522685, -0.967810323823793 },
+  { 0.943479033522029, 0.2620379504423447, -0.20293699966322887 },
+  { -0.09755164873092913, 0.6389377621067662, 0.7630479748900949 },
+  { -0.6878757501987106, -0.7247109398108458, 0.04026171887838032 },
+  { -0.8460096665890273, 0.41874639537544134, 0.3300289387281021 },
+  { 0.950804605347919, -0.2894878945476507, -0.11030576303872916 },
+  { 0.43148002468418456, -0.041672115060041974, 0.9011594881734076 },
+  { 0.9763463182278592, -0.21620722664719494, 0.001517243695769789 },
+  { -0.3065005601723102, 0.4962890717026772, 0.8122527709540639 },
+  { -0.580554759515531, -0.7935140169230714, -0.18246006727630973 },
+  { -0.10942304524975786, 0.9927861709639489, -0.049012405684787375 },
+  { 0.6298856216041684, -0.6447180930705145, 0.43310816681730885 },
+  { -0.8727577949892742, -0.325061379225834, -0.3641825517803654 },
+  { 0.49721336573167346, -0.7586159808038401, 0.4210471025987578 },
+  { -0.07119986447963925, -0.3840477538598723, 0.9205639043832144 },
+  { -0.7417009953991317, 0.07519914040866331, 0.6665018549904684 },
+  { -0.4430781537026552, -0.4885727855560528, 0.7516504393170044 },
+  { 0.9856768165483192, 0.16065184707149263, -0.05130494470992829 },
+  { -0.35596194358611477, 0.018130489486559327, -0.9343245582073573 },
+  { 0.9003834658060756, 0.16376061703201775, 0.4031030573095821 },
+  { -0.15002388247261017, -0.6072395242938983, -0.7802262459204794 },
+  { 0.5609439275452635, -0.8165029088624465, 0.1366195812072991 },
+  { 0.533890473017645, -0.5760170964924674, -0.6190034469769798 },
+  { -0.07220285323085716, -0.2334783852137998, 0.9696775709602032 },
+  { 0.1530384901991428, -0.8027191305847758, -0.5763863443132466 },
+  { 0.13150521682831953, 0.5243349029949663, -0.8412961948375827 },
+  { -0.17256891148727166, -0.7272153170981192, -0.6643627423072279 },
+  { 0.16857723663555912, 0.9833672137074282, 0.06760649594238569 },
+  { -0.5012034984847884, 0.6801698208705763, -0.5349430510657156 },
+  { -0.6723894676823543, -0.7172482958048574, -0.18288599157635882 },
+  { 0.861207223545064, -0.4545961883815587, 0.22729809419077934 },
+  { -0.46649606728169585, -0.3816786005032057, 0.7979366297699497 },
+  { -0.7114819533554447, 0.4604013814082922, -0.530870980603439 },
+  { -0.483874172037111, 0.7219952156894432, -0.49455909066253617 },
+  { -0.0984952012898437, 0.9516265688530011, -0.29104221133013963 },
+  { -0.8513670701652886, -0.2954176930477636, -0.433477217939432 },
+  { -0.8407995163332762, -0.005624077032329607, -0.5413174143617246 },
+  { -0.3999940651050167, -0.763764177885472, 0.5066251360322469 },
+  { -0.8575775633942772, -0.4706358152050144, 0.20751542643631574 },
+  { 0.6601793929096935, -0.5468871520779313, 0.5148568850364905 },
+  { 0.20175024043327802, -0.03223228693312726, -0.9789064920431242 },
+  { -0.3806679297614883, -0.6277681648698227, 0.678969114486865 },
+  { -0.9440645162715177, 0.1853838380419666, 0.2727178426686734 },
+  { 0.17245852123106145, -0.9772649536426815, -0.12333397275918334 },
+  { -0.9273285267041338, -0.2123130304861754, 0.3081963345767062 },
+  { 0.36547719815344004, 0.32188352403250264, -0.8733941919811057 },
+  { -0.36546227821337285, 0.14561387647564075, -0.9193660436305161 },
+  { -0.6645410596243553, 0.7469862035744209, 0.019919632095317892 },
+  { -0.7751115456079967, -0.6170387080421441, 0.1358871761531014 },
+  { 0.26623832781854573, 0.5223583343898308, -0.8100980948588055 },
+  { 0.4965742320614768, 0.8164372537695029, -0.29469347245887006 },
+  { -0.16771095523126947, -0.9274475086110837, 0.3342366740298091 },
+  { 0.9282257642132404, 0.2413720681057797, -0.2830838310272854 },
+  { 0.989555906576753, -0.12254226569114858, -0.0759111380387646 },
+  { -0.7595220285530423, 0.008255674223402633, -0.6504291906009361 },
+  { -0.9681389855144589, -0.06811883803092059, 0.24097038953438157 },
+  { -0.8853322046970196, -0.35390529005240756, 0.30155916998034726 },
+  { -0.24146143663390504, 0.2663864881574049, -0.9331316164110266 },
+  { -0.5247086204396564, -0.5271548144743401, 0.6684225199773245 },
+  { 0.6596199764044289, -0.7111527870610249, 0.24323486629913316 },
+  { 0.12755699076386234, 0.10566288040887103, 0.9861868838161297 },
+  { 0.15371580827984344, -0.9763163797454593, -0.15224249382348712 },
+  { -0.019634565091870598, -0.7315458929390497, 0.6815094206081537 },
+  { -0.09387462406595065, 0.993904211862099, 0.05780979674117865 },
+  { 0.4097069801535802, 0.9036262495304136, 0.12489912558954407 },
+  { -0.41517849522889594, 0.6176908318962514, -0.6678958401508326 },
+  { 0.8198926046289022, 0.38167414353414414, -0.4267328965902584 },
+  { 0.16784727228266838, -0.9848388144778253, -0.043815553005515845 },
+  { 0.6405814688722317, 0.3808548005840359, 0.6667870744170048 },
+  { 0.00736150161796845, 0.21883736627960756, 0.9757335780907274 },
+  { -0.7204540758693566, -0.6359905135901857, -0.27651761460442853 },
+  { -0.7041086045489624, -0.6978591198932024, 0.13123917777096045 },
+  { -0.0774457830501789, 0.9011872936748091, 0.426454701471115 },
+  { 0.379851809180335, 0.8573797978641847, -0.3472930826791634 },
+  { 0.28542159245122, -0.2674866629435132, 0.9203180970240415 },
+  { -0.05196834051349797, -0.35529375657187384, 0.9333089724873105 },
+  { -0.5366663854041404, 0.6560595812580952, 0.530636426017577 },
+  { 0.4841990693740385, -0.171593354409747, 0.857966772048735 },
+  { 0.3936941828185577, -0.08143185866116748, -0.915627513135017 },
+  { 0.12870149326299649, 0.6891516005536032, 0.7130960644164863 },
+  { -0.4113743661609617, -0.151931690788712, 0.8987145777162794 },
+  { -0.3466594111745493, -0.342195985279598, -0.8733436667788 },
+  { 0.5211816345826822, -0.8329900855101183, 0.18573427582320207 },
+  { -0.6836929092471083, -0.2594609240883001, -0.6820879963146035 },
+  { -0.9469074680910814, -0.3211341059448795, 0.015463921634584888 },
+  { -0.6340838026942841, -0.5407658090902197, 0.5527296544240741 },
+  { -0.4486614982819824, -0.6595078854527501, -0.6031187353954517 },
+  { -0.30266533445116534, 0.565458588914752, 0.7672354785488622 },
+  { 0.710664153075715, 0.5116247568195467, 0.4829043070241935 },
+  { -0.4339176406052788, -0.08678352812105576, 0.8967631239175762 },
+  { -0.5349675155191562, 0.22709026211264366, -0.8137811562040941 },
+  { -0.6647378622049852, 0.38074678496084124, -0.6427717015341675 },
+  { -0.8269265730794552, 0.5555276423828113, 0.08707170196834164 },
+  { -0.7661441356711953, 0.34135765313363314, 0.5445164056515976 },
+  { -0.634680103089704, 0.7580348566682671, 0.15021425637389546 },
+  { 0.037705216687822576, -0.29933325084822415, -0.953403336249228 },
+  { -0.5333925976660611, 0.7482167283567143, 0.3945428546586876 },
+  { 0.25240486855756383, 0.771335157759828, -0.5842378426052701 },
+  { -0.741655567136465, 0.6702509875020172, 0.026657709730193865 },
+  { -0.16510033245846242, -0.24356385679515744, 0.955729317267799 },
+  { 0.005172347909127125, 0.5777512614494998, -0.8161965000602603 },
+  { 0.32432574143499443, 0.2724016695303771, 0.9058753467667086 },
+  { -0.8355717338094688, -0.5385732732701263, 0.10843757179935427 },
+  { -0.4653444475404231, -0.8659066181118819, 0.18346736454569285 },
+  { 0.43716570032178953, 0.5694133151451619, -0.6961714063343566 },
+  { 0.6220011176266816, 0.7085955007258121, 0.3331771691192157 },
+  { 0.42967917451234977, -0.38534079815554073, 0.8166322772626836 },
+  { -0.3514170899878591, 0.8816565472859959, 0.3149408857106383 },
+  { -0.19764757389598725, -0.9786145793651503, 0.05699948760296261 },
+  { 0.08262377957914416, 0.6839993904400035, -0.7247883449157835 },
+  { -0.36916565843824545, 0.8660761407567984, -0.3370887643361418 },
+  { 0.23468688435433618, -0.5008988725771653, -0.8330800596359147 },
+  { -0.6626949813307579, 0.739619575242093, 0.11746593394568729 },
+  { 0.5171876562312556, 0.5968223038066266, 0.6134493181355501 },
+  { -0.9749406013205731, -0.14563656107663578, -0.16816901014886998 },
+  { -0.671196198974938, 0.4970169572257383, 0.5499725508710994 },
+  { 0.7365345109286318, -0.6671103479266914, 0.11171704391116842 },
+  { 0.2377440468674924, -0.787738821956962, -0.5682827786946613 },
+  { -0.9868173440092913, 0.16166797168889693, 0.00741596200407784 },
+  { -0.4579862238421489, 0.18439053625853655, -0.8696256372193143 },
+  { -0.4600372030986716, -0.32370035434672556, -0.8267912991565379 },
+  { 0.0365115901672256, -0.08992669430075934, -0.9952789023362236 },
+  { 0.675028462813718, -0.4436637454065734, -0.589490504930453 },
+  { -0.660911670802942, -0.5218985179232661, -0.5392751620332256 },
+  { 0.7058215523384127, -0.6040940630576543, -0.3699814849868679 },
+  { -0.42434988343153207, -0.5397980134827577, 0.7270111973496101 },
+  { 0.3955532652682712, -0.7383298225158791, -0.5462661325025369 },
+  { 0.33562040906151996, -0.8984994807611095, -0.28294456010567604 },
+  { 0.9789142032813576, -0.2042639765236268, 0.001791789267751112 },
+  { -0.953730177628213, -0.06314651861008716, -0.29395793146075055 },
+  { 0.23252152025730402, -0.919061353775637, -0.3182137184555777 },
+  { -0.9940306200683375, -0.10423581335320985, -0.032218342309173954 },
+  { -0.8722984132105205, 0.45340346093250133, -0.18308680980572464 },
+  { -0.36115639738568894, -0.3875218093160491, 0.8481703271936634 },
+  { 0.20730833438023655, 0.9482759384955919, -0.24040798440733316 },
+  { 0.4568196888554573, 0.2650974360197473, -0.8491402247507529 },
+  { 0.7611493862037351, 0.626458041506538, -0.16793431487778193 },
+  { 0.5171760321483091, -0.601229498176237, 0.6091404126259243 },
+  { 0.6017151084800497, -0.5377878725193538, -0.5905278421869279 },
+  { -0.2570652460751192, 0.9446127693077793, 0.20402003656755494 },
+  { 0.9560439369612619, 0.14485514196382757, -0.25494504985633654 },
+  { 0.5792195515749365, 0.21926130188164708, 0.7851300481897854 },
+  { -0.05443063154002595, 0.23170470673919302, -0.9712621866545914 },
+  { -0.8939453873406776, -0.00636878190462918, 0.44813065401663504 },
+  { -0.9003638051480656, -0.03714555107445837, 0.4335495662720365 },
+  { 0.308919912139462, -0.26258192531854274, -0.9141221036490444 },
+  { 0.9914062676900902, 0.05850403812525254, 0.11700807625050508 },
+  { -0.04331196645444728, -0.15629970503126625, -0.9867595835708858 },
+  { 0.09163809126595995, -0.7570103191535822, -0.646945003013489 },
+  { -0.9637092255735827, 0.05548876150635362, -0.26112358355931115 },
+  { 0.25848951839740214, -0.9620542991058242, 0.08737673861320636 },
+  { 0.2237473018852357, -0.2975548534162096, 0.9281154314564193 },
+  { 0.4724874715596996, 0.8507466724379776, 0.230186204093187 },
+  { -0.2605791101504376, 0.5407393095029313, 0.7998121820224415 },
+  { -0.980250973242266, -0.19713534332731916, 0.01567436980584189 },
+  { 0.33431414660572156, 0.9418107101521185, 0.03502338678726607 },
+  { 0.1243330998350167, 0.7859220714341881, 0.6056961102054483 },
+  { 0.23953442849233164, -0.9488482901496793, 0.2056943845779025 },
+  { -0.557660763950974, 0.6727202890432684, 0.4862734673608644 },
+  { 0.6273917481589665, -0.14386595039194755, 0.7652987538601234 },
+  { -0.21177132969247942, 0.009547068141874072, -0.977272611613655 },
+  { 0.04091065208494613, -0.8669161989429061, 0.4967722038886316 },
+  { 0.02217593022647253, 0.6288460214221139, -0.7772135546039897 },
+  { -0.47846112393102525, 0.8771787272068796, -0.040403383798619914 },
+  { -0.31923859891465084, 0.9476610377230187, 0.005027379510466942 },
+  { -0.728196724477889, 0.5389686575508743, -0.4233701886499354 },
+  { -0.267728078517549, -0.5992009376345144, -0.7545064030949108 },
+  { -0.341915371954268, 0.2311347914410852, -0.9108625508861701 },
+  { 0.45085787758650947, -0.6198419343491047, 0.6422796514296153 },
+  { 0.23189634920807412, 0.06451954877160127, -0.9705984293466973 },
+  { -0.6441164029155065, -0.6670386948342079, -0.3743974346721212 },
+  { 0.8541727179545284, -0.5133165755756649, 0.08303650487253403 },
+  { -0.656137969027831, -0.4807472426915454, 0.581691545618904 },
+  { 0.2721751906027322, 0.8599524111251446, 0.43174357693012255 },
+  { -0.9019736796862109, 0.2079893644938523, -0.37839649233411243 },
+  { 0.9656149037339536, 0.18752521318891274, -0.18006152311174206 },
+  { 0.07079446232860649, -0.9805439897238025, 0.18308912671191335 },
+  { 0.30416621811194666, 0.8980145487114616, -0.31788800238767356 },
+  { 0.9892267672447365, -0.05652724384255637, -0.13503730473499576 },
+  { -0.5128327694226793, -0.79773986354639, 0.3171965647910646 },
+  { 0.49538628814686364, 0.447821108283937, 0.7443444635996286 },
+  { 0.8576420958428554, -0.5094561730912419, 0.07003172950528204 },
+  { 0.675671531747932, -0.7221010402586399, 0.14845224431713155 },
+  { 0.057863307857148126, 0.12713628205232547, -0.9901960429075348 },
+  { 0.45811542860017596, 0.8637151861169171, -0.21006268433373923 },
+  { -0.9067699131395797, 0.3897722713367836, -0.16076660449796118 },
+  { 0.5686439273536023, -0.4580186562751286, -0.6832737331317492 },
+  { -0.8156578120234242, -0.25980211790375735, -0.5169189425992071 },
+  { 0.8757768816263856, -0.43599516157558166, 0.20717884228715605 },
+  { -0.2999652052394647, -0.803098333176581, 0.5148338983542585 },
+  { 0.7922229163528942, -0.5377789598531163, 0.28840360806448934 },
+  { -0.9811733977204897, 0.03135895309248031, -0.1905659457158419 },
+  { 0.06279303534563414, -0.7782218806770397, -0.6248421713901627 },
+  { -0.234871772665337, -0.2240511218921372, 0.9458521793514655 },
+  { -0.16207244579774602, 0.9369813272682191, 0.3095133513498622 },
+  { -0.825922122192596, -0.46886734193063434, -0.3130751726722837 },
+  { 0.129546655205906, 0.5590026902720602, -0.8189833065414468 },
+  { -0.8038215507176766, -0.5382992695239314, -0.2531892790617952 },
+  { 0.9139130917109347, 0.4056988903537801, -0.013087060979154196 },
+  { 0.8393902288383347, 0.5373689668911686, -0.08160047275014042 },
+  { 0.6935558041801987, 0.47591825504236696, -0.5408161989117806 },
+  { 0.01498660592447199, 0.972464206654627, 0.2325699215686579 },
+  { -0.6282310787524353, -0.759486500563212, 0.168837102414717 },
+  { 0.4477065423106414, -0.8159812787274593, -0.3656957816800055 },
+  { 0.030035277661709353, 0.8572363673612456, 0.5140463914561404 },
+  { -0.8767612232526864, 0.08751305452181184, 0.4728966300246975 },
+  { -0.8326840368635363, -0.5528270710906035, -0.03192998938348899 },
+  { -0.19554727587377616, 0.3627543668383094, 0.9111369448321599 },
+  { 0.9332098635224976, 0.09904467351518774, -0.3454120774851271 },
+  { -0.8300594230186498, 0.12852533001579095, 0.5426625045111173 },
+  { -0.6173176614284276, -0.7856295047645442, 0.041293899452028604 },
+  { -0.44710683742059854, -0.870653554066938, 0.20508014219411885 },
+  { -0.5080162051968414, -0.6437791565856525, -0.5722481391872467 },
+  { 0.6703151088539977, 0.06031248808946783, 0.7396215644655791 },
+  { -0.8559031749751522, -0.226153277940589, -0.4650639202778266 },
+  { -0.8126959163482818, -0.4413240245530207, 0.3804713562190346 },
+  { -0.42277987962249214, -0.8412675777259742, -0.33693624924229065 },
+  { -0.3414254904003597, 0.8089312948333485, -0.4786008720678602 },
+  { 0.21451346227069107, -0.2778460082744189, 0.9363682876895245 },
+  { -0.17968637296619666, -0.9598016722132844, 0.215623647559436 },
+  { 0.5568479175066219, 0.8301683821076319, 0.027218635478938748 },
+  { 0.011529687332438964, 0.8788766207500065, -0.4769097942054299 },
+  { 0.8138768901206503, 0.45612079965579866, -0.3599419728913172 },
+  { -0.12160491429061532, 0.3278045515660065, 0.9368865570563928 },
+  { 0.8412270299647632, 0.5406818240070258, 0.0004992445281689989 },
+  { 0.3820990999049939, 0.7966963191318044, -0.46826835568253766 },
+  { 0.15461161759917638, -0.8113012442924981, -0.5638133899729684 },
+  { 0.6730311561640588, 0.19049241720857146, -0.714661949328846 },
+  { 0.8173805381652359, -0.5605356655006658, 0.13299933657892837 },
+  { 0.12464211362686843, 0.9819561387655211, -0.14221984759988834 },
+  { -0.7970544206299823, 0.49444392872978565, -0.346741188635642 },
+  { -0.09966511142932641, 0.6922053442239936, 0.7147857210322004 },
+  { 0.29195466213934484, 0.9033780383473969, -0.3141187595268868 },
+  { 0.7878932335060624, 0.6149859246743818, -0.031883617231373736 },
+  { 0.5375855036656264, -0.8408953575097572, 0.06242454619068066 },
+  { -0.23416359268940284, -0.7542595929044261, -0.6134002595128574 },
+  { 0.9817192374392273, 0.17837604181588082, 0.06640276009204323 },
+  { 0.9424226153769146, -0.08087771267494191, -0.32449716426897424 },
+  { 0.3671565865133087, 0.4825667743292365, -0.795188876489964 },
+  { -0.27098845954187345, 0.9617557711310882, -0.03988848820359352 },
+  { 0.9091006750301924, -0.36626688512452377, 0.1984553640515348 },
+  { 0.024722012532644968, 0.21247567528057026, 0.9768535762899173 },
+  { -0.4420829507088507, 0.8658728138021627, 0.2341515214788947 },
+  { -0.23211140231124638, -0.7557913149149451, -0.6122938716141499 },
+  { -0.856896884723636, -0.09633751958431411, -0.5064057772885985 },
+  { 0.6111910940574038, 0.4832066341906825, -0.6268626605716963 },
+  { -0.5791135657861389, 0.6853950961076827, -0.44143067423322996 },
+  { 0.5448066840811991, -0.7548762883935894, -0.3651677233841551 },
+  { 0.6438239428579912, -0.4617236051327417, -0.6101655865959783 },
+  { -0.26524544981726783, 0.7981810079754649, 0.5408806983600968 },
+  { -0.2690756081370354, 0.9230463253048736, -0.2749250778791449 },
+  { -0.7930754642807586, -0.37466152244081496, 0.48027081064560845 },
+  { 0.8403815125079477, 0.34076445476694217, -0.4214718256327969 },
+  { 0.47900520531930896, 0.04394543168067055, -0.8767113620293775 },
+  { -0.6921286944855106, -0.5301411276910294, 0.4898043027580163 },
+  { 0.23356164966282014, -0.9526453281652008, 0.1947198873556553 },
+  { 0.27991108112299357, -0.2948396721162199, -0.9136297687854511 },
+  { 0.1014912350506496, 0.9617787039211558, -0.2543250948916278 },
+  { 0.6425813178159663, 0.7358248755421637, -0.21366095227545812 },
+  { -0.7251081303906909, 0.5731689480430674, -0.3817008727269565 },
+  { 0.5379570938226657, 0.7866584205762868, -0.30293678307906696 },
+  { 0.23162260129179424, -0.18914901914782217, -0.9542398121679053 },
+  { 0.11661829396893145, -0.9915079192856335, 0.05755188533531681 },
+  { 0.8497066376502271, -0.5177980729129964, 0.09941722999929532 },
+  { -0.1256837138803236, 0.6912604263417799, -0.7115916153518321 },
+  { 0.03150716565605752, -0.7098379086041193, 0.7036600329852846 },
+  { -0.997383828904329, 0.04934791069840234, 0.052823115677163066 },
+  { 0.8285695626778395, -0.03171558134652017, -0.558987121232418 },
+  { 0.40084033450212625, 0.7206746083731608, 0.5656457681998646 },
+  { 0.22817611898049364, 0.9161100896381014, 0.32966340772107144 },
+  { -0.7893105541628994, 0.5280520818172553, 0.31328876132973427 },
+  { -0.9111361716503097, -0.3797676816290366, 0.16002307552513842 },
+  { 0.7618126052149844, 0.2648534019638822, -0.5911803701102707 },
+  { 0.04433205995912119, -0.9742370766920126, -0.2211261785912792 },
+  { 0.7391880198850853, 0.2087871747747802, 0.6403194413009275 },
+  { -0.6432630024246809, -0.7631840260725811, 0.06134209043740514 },
+  { 0.7752792859148337, -0.37223266191777393, 0.5102792120329749 },
+  { -0.7127479631061596, -0.3073865822000332, -0.6304790481621119 },
+  { 0.6140201567238883, 0.016675620163209382, -0.7891141684375867 },
+  { 0.9401526500902677, -0.17727128988078072, -0.29101182847480767 },
+  { 0.0687045441706505, 0.6199263870167158, 0.7816463140645546 },
+  { 0.1836547348288412, -0.9101370719682447, -0.371377770745663 },
+  { -0.1615483900176235, 0.6345153632017502, 0.7558388528937003 },
+  { -0.8529307773582094, 0.10301631466793959, 0.5117584664149257 },
+  { -0.03604714813476885, -0.9006065264147012, 0.43313795457174636 },
+  { -0.12973929777749194, -0.25847674769569823, -0.9572656295474405 },
+  { 0.2677139489578829, 0.8486027061306478, 0.4562923280980269 },
+  { 0.20245762130615685, -0.8759045206299841, 0.43795226031499207 },
+  { -0.18241928667042437, -0.9191965852285156, -0.3489997730012011 },
+  { -0.6960335778119767, 0.6324952429079789, -0.33983382153198866 },
+  { 0.9537811893224986, 0.28386344920312456, -0.09860519814424326 },
+  { 0.3781515745252717, -0.9011827979350527, -0.21182764548096134 },
+  { 0.5781890807505135, 0.10229499120970621, 0.8094647130507188 },
+  { 0.627090928422388, -0.04340613103900894, -0.7777357361460072 },
+  { 0.7148033941953763, 0.6458143266590933, -0.268290818196656 },
+  { -0.3906616204361102, 0.11161760583888862, 0.9137423096174473 },
+  { -0.0012798884067871088, 0.9931934036667964, -0.1164698450176269 },
+  { 0.2867262267954705, -0.4197435485047094, 0.8611639938805541 },
+  { -0.07562530141106995, -0.6624047485041911, -0.7453192355934364 },
+  { 0.18524480074730262, -0.7511574887445568, -0.6335982882703071 },
+  { 0.013304732436501309, 0.8455896615198609, -0.533667601064108 },
+  { 0.2288417923027508, 0.8800637522166395, 0.41607598600500145 },
+  { -0.35315935607875004, -0.9265504637153809, -0.12954808915169458 },
+  { -0.845925507514205, -0.5037907145536169, -0.17494270966916806 },
+  { 0.7645028684947964, 0.6330830909263192, 0.12141319552011601 },
+  { 0.6695546068404362, 0.6359809517696406, -0.38369891509480586 },
+  { 0.05797014614594761, -0.4574475888942598, 0.8873450093231188 },
+  { 0.6638479663670052, 0.2064811400405735, -0.7187985923455449 },
+  { 0.6052443670242351, 0.2400547278492747, 0.7589815437957919 },
+  { 0.9013724565216692, 0.2954742881866155, 0.3165795944856594 },
+  { 0.9086902538267803, -0.38769231841680696, 0.1548440791274334 },
+  { 0.49891244751873853, -0.6745296290453345, 0.5441471760937708 },
+  { 0.44966912816323357, 0.5914228616760692, -0.6693404767857736 },
+  { 0.009722119075286919, -0.3624961540928408, 0.9319345570739317 },
+  { 0.5156875604512712, -0.1274208590507022, -0.8472486439496952 },
+  { 0.7575503344869546, 0.09864504355549554, -0.6452802849155067 },
+  { -0.5051629537627729, 0.1432850066741374, -0.8510462954552255 },
+  { -0.5430908062040188, 0.34002206997121176, 0.7677482452921408 },
+  { -0.9537056823339308, -0.2986215253570277, -0.03564626316198754 },
+  { 0.13080848537560208, 0.9402243714086703, -0.31443166437703407 },
+  { 0.14665548404007495, -0.6027067311840499, 0.7843702985111106 },
+  { -0.34390118235340306, 0.594285376522986, 0.7270191662032468 },
+  { -0.10926930737226485, -0.6556158442335891, 0.747146627681785 },
+  { 0.49562799022535303, -0.7291014800370929, -0.47197873586942246 },
+  { 0.27986876050033843, -0.9584465195054053, -0.055260710672041344 },
+  { 0.4547694947863028, 0.7842871596057217, 0.4219933149818846 },
+  { 0.7936918060430741, 0.06247719756024199, 0.6051032282223437 },
+  { -0.4780688947977985, 0.38573538525616524, 0.7890870322011947 },
+  { -0.6146874924130965, 0.7730237291790623, -0.15682347017266038 },
+  { 0.5417150404129469, 0.6854711352798131, 0.4864916625067727 },
+  { 0.27434382010143044, 0.37539030345940005, -0.8853347324265628 },
+  { 0.9313501419617902, 0.28757990276876594, -0.22334885849553904 },
+  { -0.33166432795625644, -0.8413069724092185, 0.4268505027957202 },
+  { 0.8137446716849621, 0.1463025138181271, -0.5625079410593508 },
+  { 0.07871647720510541, 0.9123458364952842, 0.40178201906772554 },
+  { -0.7030162093810869, -0.12092538394358023, 0.7008175660366581 },
+  { 0.8647998319475645, -0.4677881443910739, -0.18247055277666002 },
+  { -0.9568195921363974, 0.08698359928512704, 0.27736279772049943 },
+  { -0.6866841170206882, 0.7269509729835901, 0.0026844570641934642 },
+  { 0.07143021275821623, -0.7789294629348342, -0.623030189057775 },
+  { 0.7685919178661159, -0.3806266786122458, -0.5141884822898076 },
+  { 0.12818118344287058, -0.6059474126390245, 0.7851097485875823 },
+  { 0.7913928134340388, 0.46679427409492247, 0.39471574647732416 },
+  { 0.3532993205136506, -0.5897243708573815, 0.7262263810558374 },
+  { 0.839813604293189, 0.4528895806650398, -0.2993395025203446 },
+  { 0.8504468730247319, 0.421451495916455, 0.3148313084053709 },
+  { -0.3498715288570071, 0.07140235282796063, 0.9340725974494124 },
+  { 0.07048766630319675, 0.8555744323698364, 0.5128585375853281 },
+  { -0.4763713168528105, 0.5392185304952545, -0.6944881171412924 },
+  { 0.6382316792020293, -0.385623729689945, -0.6662992291478164 },
+  { -0.5685198779759598, 0.7504462389282669, 0.3370691187644135 },
+  { -0.06381295487511812, 0.08481468685933422, -0.9943512335603849 },
+  { -0.8132915609966697, 0.5756069124514245, -0.08505009788200467 },
+  { -0.8827079313794428, -0.4598088799177112, 0.09696649848604794 },
+  { -0.6269678377778611, -0.011514560840732069, 0.7789600408755245 },
+  { 0.8171423010248298, -0.561713095188214, 0.12944828531086414 },
+  { -0.2621839468172446, -0.001002615475400553, 0.9650173950730322 },
+  { 0.7719471470013985, 0.6356183678328498, 0.009321625926054624 },
+  { 0.9302822710897416, -0.30716349057245457, 0.20056292318237195 },
+  { -0.26237308839516177, -0.33419920535401826, 0.9052465153905467 },
+  { 0.00992720755466729, -0.9927207554667289, 0.12002896407006813 },
+  { -0.7691533209967609, 0.5534676694445224, 0.3194944564140392 },
+  { -0.6101704338124547, -0.51455495822409, -0.6024327652677316 },
+  { 0.8235290490349798, 0.5561430331141475, -0.11182500665834065 },
+  { 0.17138824317801774, -0.9849033839385412, 0.02431860207255657 },
+  { -0.0305265523087941, 0.947357919955966, 0.3187179020714774 },
+  { -0.35156318642375883, 0.5944816480414432, -0.7231838605040237 },
+  { -0.34025880055430435, -0.5641990974047412, -0.7522654632063215 },
+  { -0.40098468411791827, -0.8974419120734362, -0.18387304739093255 },
+  { -0.4903494910878947, 0.4360293378835471, -0.7546096958658021 },
+  { 0.7625702430652517, 0.5814334055504446, -0.2835874103365929 },
+  { 0.23852330071094824, 0.4362254996223718, -0.8676485166800936 },
+  { 0.6475941840506593, -0.7359262398251237, -0.19757110699850625 },
+  { 0.996894231374987, 0.06144101037347227, -0.04926351282197326 },
+  { -0.6167381713153156, 0.5288013411469118, -0.5830979074253894 },
+  { 0.27787753576542035, 0.42002034232047814, 0.863925336562093 },
+  { -0.7474221510019771, 0.6258394027680788, 0.2229017050954801 },
+  { -0.8283984697169271, -0.2105411555487791, -0.5190649257952593 },
+  { 0.7444981146121769, -0.275501158748813, -0.6081296480743029 },
+  { 0.0, -0.9947494292130037, -0.10234047625648185 },
+  { 0.6706349921333272, 0.26442933318138073, -0.6930554343482074 },
+  { 0.6876039397534568, 0.513420306394052, -0.513420306394052 },
+  { 0.23814568998970248, 0.8856280611757625, 0.39868479729905465 },
+  { 0.33581496057467436, -0.13110216060835286, 0.9327596344922156 },
+  { 0.44574735567885276, 0.48490083962361685, 0.7524496465795049 },
+  { -0.2195298301566734, 0.8896378610978771, -0.4004386716746728 },
+  { -0.18166064957105155, -0.3816914771886139, -0.906262116961201 },
+  { -0.8565584778198208, 0.24642073585150193, 0.45341415396676354 },
+  { -0.43648178304391333, -0.8665682286073297, -0.24195693467879933 },
+  { -0.024139462882259745, 0.38959970326251775, 0.9206678866722322 },
+  { 0.881316921082619, -0.2785601566300141, 0.38168668270155126 },
+  { 0.07123356652685353, 0.2703222524608801, 0.9601310633576754 },
+  { -0.7287690803224602, -0.3397358711853686, 0.594537774574395 },
+  { 0.8801651876798117, 0.45425703321205, -0.13769455390082944 },
+  { 0.549234155513735, -0.549234155513735, 0.6298282978989026 },
+  { 0.06982727548230479, -0.990016851016239, -0.12243686659910975 },
+  { 0.1278806685696164, -0.529489379779982, 0.8386224009090134 },
+  { 0.8416515337795601, -0.38936215815035724, -0.374192203936707 },
+  { 0.8355044266762853, -0.4582699865381632, 0.30318471670360186 },
+  { 0.7221455508405344, -0.4656417830344112, -0.5115501278406208 },
+  { 0.7459877923381028, -0.6526117554038532, 0.13266540766614685 },
+  { -0.0026945125342434963, -0.8582022421565536, -0.5133046377733861 },
+  { 0.25314161884146563, 0.21456262473827778, -0.943335677728635 },
+  { 0.0006468111814205854, -0.4417720369102599, -0.897127108630352 },
+  { -0.7140144341232145, 0.6016671392753912, 0.3580224034608346 },
+  { -0.5757883668243251, 0.43091853735089714, 0.6948215388120462 },
+  { 0.5485040213949981, 0.581414262678698, 0.6009166278838535 },
+  { 0.3990667481612605, -0.7285390744577537, 0.5567553749181382 },
+  { -0.8064580461459417, 0.4576872601374385, 0.3743631815688541 },
+  { 0.3519122094414842, 0.4576747339247925, -0.8165118705645886 },
+  { 0.235113625723645, -0.30586210276510656, -0.9225887258639079 },
+  { 0.9128081967311704, -0.4072711020434794, -0.03019015436659513 },
+  { -0.23113678275439217, -0.8362833595811388, -0.49719807938650845 },
+  { 0.45465791678595335, -0.6456480453986401, 0.6135346609416397 },
+  { 0.7766482544850095, 0.5130288469689621, 0.36553917845161965 },
+  { 0.5755193649657406, 0.23328401876116878, 0.7838086674310699 },
+  { -0.07008824831807209, 0.9459278626386421, 0.3167145657079799 },
+  { 0.4317383964678645, -0.612551912937312, -0.662104305205907 },
+  { -0.566276340310976, -0.17432014207334148, -0.8055703535207448 },
+  { -0.39833707846633865, -0.7839558594082093, 0.476173059316083 },
+  { 0.4176327082289848, -0.8702395841421703, -0.26127760564079344 },
+  { 0.3477107664478592, 0.6879385178358649, 0.6370540154288612 },
+  { -0.9639941714012585, -0.06733571227101329, -0.25725695200976867 },
+  { 0.2283500220277397, 0.9456669390496611, 0.23145260384876878 },
+  { 0.5079339958142425, 0.6356515034322745, -0.5813348622613873 },
+  { -0.6394270624099632, -0.4444096508981755, -0.627401860091542 },
+  { 0.9088967160089354, 0.2051206596440399, -0.36308714465726605 },
+  { 0.9502094300614462, 0.3024476130772022, 0.07501653395221944 },
+  { 0.1423747921897982, -0.2762070968482085, 0.9504941126590928 },
+  { -0.44305200414098356, 0.11702233524608288, 0.8888254579388528 },
+  { 0.7455959912409711, -0.32384472346830057, 0.5824184174003545 },
+  { 0.6107097300409909, 0.7700584611003756, -0.1845090570161296 },
+  { 0.7655506086562524, 0.48184202458223335, 0.4263338233503601 },
+  { 0.6477526553980886, -0.35529158350357054, -0.6739320352351938 },
+  { -0.21880945996827764, -0.7688553399990308, -0.6008193458797457 },
+  { 0.7772499111622546, 0.5598660309955027, -0.2871107851258988 },
+  { 0.5085452035828739, 0.24624876560868214, -0.8250717067922362 },
+  { 0.9891013222212718, -0.08019740450442744, 0.1234785434433248 },
+  { 0.015266249517590012, -0.9217656174241418, 0.38744688430849133 },
+  { 0.3099634750951266, -0.34635049173672844, -0.8854174049456444 },
+  { -0.725962141771057, 0.4364572391738718, 0.5314922831875375 },
+  { 0.7977195074495521, 0.2676220283056562, -0.5403906340787288 },
+  { -0.03790952616433146, -0.10513575256241257, -0.9937350458543419 },
+  { -0.492814570076767, -0.8485099347051773, 0.1927814571650163 },
+  { 0.6522530685192448, 0.7577718117334191, -0.018649824382040107 },
+  { 0.2221419654032229, 0.7083729162725113, -0.6699707148065287 },
+  { 0.8822807591674283, -0.44114037958371416, -0.16424319621732555 },
+  { 0.3772778844921145, 0.9245060234535872, -0.05431399885103197 },
+  { -0.2913379432367928, 0.6146290802479435, 0.7330438571764464 },
+  { 0.8764634273956692, 0.3948285727245666, -0.27553994011416566 },
+  { 0.2734338128130796, -0.23869427102125393, 0.9318041612871956 },
+  { -0.0616247133157139, 0.5729631083282447, -0.817261078972682 },
+  { 0.7047723255035291, -0.6516033057624925, -0.28055142331440647 },
+  { 0.7931557977527722, -0.3524046180609471, -0.496704002058048 },
+  { 0.5741025713432342, 0.33163122018880004, -0.7486167052458651 },
+  { -0.1394332231320665, 0.11408172801714532, -0.9836380104589418 },
+  { 0.9330420397431173, 0.31361245937381127, 0.176294575632697 },
+  { 0.4104837116603744, 0.5576773658416198, 0.7214562204939914 },
+  { -0.21769301333322205, 0.9379458974471395, 0.26993933653319535 },
+  { -0.7708804333235956, -0.014523834251024263, -0.6368142710064485 },
+  { -0.521112009958895, 0.8242941869338967, -0.2213173433411558 },
+  { -0.7681740165498251, -0.23400914395303365, 0.5959432866003923 },
+  { -0.12941739073389308, 0.9106493110544714, 0.3923888011292466 },
+  { -0.5462443712021618, -0.11854158110057819, 0.8291953813668586 },
+  { 0.9230272596226091, -0.3355926586103927, -0.18814421458122194 },
+  { 0.9008642239825312, -0.23484067377322396, 0.3650938343632908 },
+  { -0.009801809355345647, 0.999784554245256, -0.01829671079664521 },
+  { 0.2911089586061203, 0.882424030774802, -0.3695719201054261 },
+  { -0.9578883032845501, 0.08076429587520076, -0.2755487741624496 },
+  { -0.38984972821104275, 0.9205238352319323, -0.025555003104489552 },
+  { -0.9370636977341888, -0.16508829910031755, 0.30766455741422816 },
+  { -0.1736001772411104, 0.11353945241361724, -0.9782493399984847 },
+  { -0.9342671953367425, 0.057165719210766484, 0.35196148690550344 },
+  { 0.6752445941220653, -0.6741563675400797, -0.2992623100460402 },
+  { -0.07243070447944128, -0.680848622106748, 0.7288339638243779 },
+  { -0.9358097902550186, 0.29313190829501173, 0.19578999157817764 },
+  { 0.1953616206639813, 0.38554809905871806, -0.9017685404158606 },
+  { 0.5891537891416475, 0.4030268549140841, -0.7003336111869121 },
+  { 0.610060179974677, 0.036499327007031956, 0.7915139770953501 },
+  { 0.4233291553323964, -0.5189014745973465, -0.7426531396999942 },
+  { 0.29317158424691175, 0.4238687065947483, 0.8569630924140498 },
+  { -0.321161420599255, 0.2022753508686536, 0.9251702677613627 },
+  { -0.6213116641949109, -0.3515893064444143, -0.7002547932926172 },
+  { -0.3491557866210294, -0.5338054814686892, 0.7701570908736938 },
+  { 0.534054911871503, 0.3923940199304941, -0.7488740109181973 },
+  { -0.4659249418783112, 0.878903867634087, -0.10218581111649325 },
+  { -0.5955170167514452, -0.09564709255663746, 0.7976284325705303 },
+  { -0.6126762001801576, -0.1534553473348432, -0.7752930607887227 },
+  { -0.7285358642735803, 0.3549277287486673, -0.5858854852549772 },
+  { 0.6592357435081581, 0.7202415063634928, 0.21601020113062402 },
+  { -0.8256617754567123, -0.4507208459171231, -0.33931305840686804 },
+  { -0.8778298360960096, 0.29464019650403794, -0.37762671179845686 },
+  { -0.9603379020852454, 0.25158775023717017, -0.12022777444962114 },
+  { -0.10301363561318957, 0.961460599056436, 0.2549150982970454 },
+  { 0.5224366931109989, -0.6869609555824185, -0.5051183496929548 },
+  { -0.7105211727479436, 0.29460633991987906, 0.63903581085562 },
+  { 0.6232423971609659, 0.7705113945997574, 0.13372024967442273 },
+  { 0.34600917578554935, 0.1375942921252477, 0.9280869900212786 },
+  { -0.07631138981777376, 0.2547453748328624, 0.9639924096098185 },
+  { 0.1231161098404916, 0.5354953127042741, -0.835516124063142 },
+  { 0.06124699822530332, 0.5394447151382485, 0.8397905718200244 },
+  { -0.95213451429108, -0.24691386403362856, 0.18020380252278856 },
+  { 0.31655669983239393, 0.565596061588648, -0.7615070261702344 },
+  { -0.21658908252870865, -0.42164073208978636, 0.8805159069387454 },
+  { 0.6507354761344397, 0.07110308961259175, -0.7559680487610755 },
+  { -0.9757240297824444, -0.08913517984762916, -0.20004383874200743 },
+  { -0.20154227561922863, -0.5689950433227947, -0.7972611565931917 },
+  { 0.09585143448209948, 0.04568619774380443, -0.9943466567769199 },
+  { -0.5260289320256211, 0.8132161953263032, 0.24894373326315403 },
+  { -0.5928286312143719, -0.42951358285118774, 0.6812285197779303 },
+  { 0.310701413233052, 0.21169268824153367, -0.9266341443957572 },
+  { -0.7023626109778355, -0.5616474764814124, -0.4373086722927629 },
+  { -0.3991252673841068, -0.2953065562148305, -0.8680397794986716 },
+  { -0.2705533212777497, 0.08851435819580701, -0.958627200082891 },
+  { -0.7796521528642354, -0.5683395348810323, -0.26293096741421457 },
+  { 0.6295603582043062, -0.7027535498887032, 0.33134755694963486 },
+  { -0.1394478791818123, 0.7406739812279867, -0.6572338567995252 },
+  { -0.8360904731785278, -0.524616558400456, -0.16040631942715514 },
+  { -0.7107053724163709, 0.5998213646806472, 0.3675761201318085 },
+  { -0.26365363137022335, 0.9581558798576408, -0.11146332383131392 },
+  { -0.6303641062330785, -0.35652221078112717, 0.6895890129582328 },
+  { -0.05484896527763858, -0.9245968432516217, 0.3769778089717064 },
+  { -0.581887463187819, -0.6526109394448366, 0.48528954439774635 },
+  { 0.16994385630872405, -0.9784646272320475, -0.11715826457646886 },
+  { -0.648864605072413, -0.34028656285084824, -0.6805731257016965 },
+  { -0.8660393830970163, 0.29524069878307374, 0.4034956216702008 },
+  { 0.7032279927307256, 0.564369679405597, -0.43238554000745494 },
+  { 0.10860215974584526, -0.8023137082347558, 0.5869397622219278 },
+  { 0.4128849850832294, 0.8731229765039721, -0.25919540311059874 },
+  { -0.5349799983412507, 0.15113399632112376, -0.8312369797661807 },
+  { -0.40808500620683946, -0.8212289174493009, 0.39881034697486584 },
+  { -0.9129179470911992, 0.3823797129224474, -0.14271151678871968 },
+  { -0.9661760746130301, -0.24180458393767315, 0.08963445783896504 },
+  { 0.27168069000982403, -0.9206094238618608, 0.2804779694958564 },
+  { -0.022773160045069574, -0.9852740713616865, -0.16945910268831182 },
+  { -0.41778471284899904, -0.17461899974167744, -0.8916076147268458 },
+  { -0.1769066713678357, -0.3198378892941665, -0.9308102675612281 },
+  { 0.22815398606206969, -0.9249485921435258, 0.30399977061783884 },
+  { 0.9033974419327859, 0.38394391282143403, 0.19094536840852067 },
+  { -0.8209574718973205, -0.46792910670009547, -0.32721732906252227 },
+  { -0.19501609384999835, -0.7268781679863575, 0.6584959013116827 },
+  { 0.679581280470397, -0.48323355898617315, 0.5519552615056516 },
+  { 0.2711463400574687, 0.8894195879907077, -0.36798431864942177 },
+  { -0.7514402047092157, -0.5316205597631588, 0.3907904799041011 },
+  { -0.5317632504353138, -0.7953723831297429, -0.2908790429731631 },
+  { -0.6118959144825765, 0.31367221960852165, 0.7260806625199399 },
+  { 0.8909425881819987, -0.29276537851544737, 0.34714512484877025 },
+  { -0.9709256341040234, -0.20601872852868044, 0.12190035494257563 },
+  { 0.8568551368674139, -0.2670950112829386, 0.44097565621210005 },
+  { 0.040515118476145424, -0.8615663969825211, -0.5060255613755306 },
+  { -0.46633819005172966, -0.8845672133168297, 0.008338922243015799 },
+  { 0.6294467562204574, -0.635632965126801, 0.44695359348332236 },
+  { 0.022031306760275548, 0.9421282496170466, -0.3345280000178682 },
+  { -0.9972494582723181, 0.06688500898382316, -0.0319360853706543 },
+  { 0.8853589151221205, 0.17427099911015376, 0.43100952458493386 },
+  { 0.5903688694034019, 0.7568528905751613, -0.28042521296661593 },
+  { 0.9345211923474545, -0.06455408128465956, 0.3500041594652636 },
+  { -0.7119251406663131, 0.13327977610249792, -0.6894919110252986 },
+  { 0.45448486319808107, 0.4997447665871016, 0.7373592593794593 },
+  { 0.907132945878865, 0.4144045325757452, 0.07333963377199615 },
+  { -0.6317827465674238, 0.0967463138595127, -0.7690843334084494 },
+  { 0.867521617885401, 0.318558746521429, -0.3820033606085061 },
+  { -0.19277605918734586, 0.2795252858216515, -0.9405865221182583 },
+  { 0.7993066564318654, -0.3881284415417988, -0.4587648437381032 },
+  { -0.9770205502416914, -0.09142011421498315, -0.19254403943602597 },
+  { 0.9724876774688785, 0.009369810279872562, 0.2327658132684131 },
+  { 0.01303015243882806, 0.9105777116075139, -0.41313248026637206 },
+  { 0.46680653698150076, 0.5861651261221297, -0.662194912355544 },
+  { -0.07670536588858863, -0.11280200865968917, 0.9906523071624258 },
+  { -0.3537199222272428, -0.8163708931680655, 0.4565312491029812 },
+  { -0.7914911738684806, -0.24019047457209172, 0.5620055672438915 },
+  { 0.13660966356773677, 0.4118781356567264, 0.900940731229224 },
+  { 0.46532593358634144, 0.8580549717919318, 0.2172865410354422 },
+  { 0.11309482781799364, -0.7351163808169586, 0.6684410718794848 },
+  { -0.5680671877540407, 0.4257114485794005, -0.7043219666783394 },
+  { -0.8443103168451424, 0.19026711365524335, -0.5009376351704453 },
+  { -0.9859668661441283, 0.10465152483713265, -0.130066895154722 },
+  { -0.48354710598064654, 0.4615211255175451, -0.7437610147075199 },
+  { 0.8642564294709421, -0.4556585787665505, -0.2131574153403669 },
+  { -0.8922641735826013, -0.05388068681054356, -0.4482873142637224 },
+  { 0.6136499545050048, -0.39597376743460205, 0.6831094413340026 },
+  { -0.15614214340158766, 0.7718828926460112, -0.616292488267044 },
+  { -0.6658580998110355, 0.6124330859318722, 0.4260970619143026 },
+  { -0.44433272476864366, 0.8706248727421695, 0.21114156545397203 },
+  { -0.504820289665085, -0.7165191208149594, 0.4814112842975508 },
+  { 0.6317034559676814, 0.7433009870867694, 0.2201235705559992 },
+  { 0.18768424280668103, 0.5711172857281427, -0.7991243150753216 },
+  { -0.6133662937081695, 0.22654166609180337, 0.7566113026297278 },
+  { 0.5733730132544413, -0.6877580335754031, 0.4452328322619715 },
+  { -0.6397522950208526, 0.3348859771642002, -0.6917863711539355 },
+  { -0.7239413396121682, -0.5170121841693768, 0.45673552327462974 },
+  { -0.9310055470073421, -0.307379609170678, 0.19684117279583804 },
+  { 0.7437668555168222, -0.6649275688320391, 0.06842655070754765 },
+  { -0.33882744931311803, -0.9405625045247965, 0.023197729932225925 },
+  { -0.20377264416974158, -0.9710550235627301, -0.12461480931918813 },
+  { -0.7960475781167712, -0.6016212111112925, 0.06603159634148333 },
+  { 0.945855966448387, -0.2595461599907179, 0.19491608853057868 },
+  { 0.4467746243677466, -0.8795538990565036, -0.16363793470818672 },
+  { -0.04039619859921239, 0.12455494568090487, 0.9913900406223375 },
+  { -0.7448840737098747, 0.6183381451315816, -0.2506105644393649 },
+  { -0.7820878982964519, 0.5537529432459621, -0.28582546629835653 },
+  { -0.3037078125723446, -0.9125835714313238, 0.27377507142939717 },
+  { 0.5925658547221059, 0.7953574811771412, 0.12756247470558674 },
+  { -0.5382024600406864, 0.8408882037602509, -0.05696613716070456 },
+  { 0.7242648561131408, 0.6861983768153547, 0.06761808822633057 },
+  { 0.1589050083301161, 0.29520428325762155, 0.9421271832793913 },
+  { -0.6787126586180795, 0.17910472935754876, -0.7122293331177378 },
+  { -0.2806866436651742, 0.1946224463044239, -0.9398601552691024 },
+  { 0.751532367315669, -0.30419167248491363, 0.585377252092817 },
+  { -0.26159045344082277, 0.9584197240025586, -0.11402660791010223 },
+  { -0.05344091373783545, -0.9437437957958176, -0.3263306860161442 },
+  { -0.019855301656559493, 0.9276838162870297, 0.3728384422176172 },
+  { -0.3625982016190058, 0.5484954680287497, -0.7534422776394921 },
+  { -0.4623834492754021, 0.8839683589088569, -0.06929275780457707 },
+  { 0.3139426135498044, -0.7610730025449804, -0.5676336143981312 },
+  { 0.9732815241744742, -0.20811325195370592, -0.09701520015887043 },
+  { -0.90019018683895, 0.12821500796885865, 0.4161953138256145 },
+  { 0.3311878195092871, -0.36286066711308584, 0.8710033091044661 },
+  { 0.9142654921176044, 0.3258922476166788, 0.24065089417308178 },
+  { -0.09100351152355694, 0.9149103033529028, -0.3932651747982282 },
+  { -0.46466223737235657, 0.4033183608148528, 0.7883040688653941 },
+  { 0.3784161706008323, -0.8917758921746474, 0.24806644263969585 },
+  { -0.8046956000766649, 0.5481817125436939, 0.22795131333229754 },
+  { 0.48694195285450304, -0.6647636426442579, 0.5665481744464281 },
+  { -0.006676994319489239, -0.9621548814383993, -0.27242136823516094 },
+  { -0.6033171605010919, -0.3868714398854445, -0.6973800203948078 },
+  { 0.021413944387259465, 0.6477718177145988, 0.7615333972719147 },
+  { 0.31643512327894846, -0.10949659821398533, 0.9422734782084242 },
+  { 0.35456473456517457, 0.3685377290307972, 0.8593391596357924 },
+  { -0.06028274868578796, 0.47924785205201426, -0.8756069246610702 },
+  { 0.3174843652587974, -0.04040710103293785, 0.9474022081472749 },
+  { 0.09151163074381098, 0.14340542134853307, 0.9854240237412817 },
+  { 0.3493345006199923, -0.8012904038366021, 0.48569444653604565 },
+  { 0.9698087679784354, -0.07903727844758174, 0.23070340736050884 },
+  { -0.14093684013307223, 0.4661259712658031, -0.8734205092650484 },
+  { 0.859397002893509, 0.2186924860219489, -0.46218003848629563 },
+  { -0.9057013285756882, 0.3459021268379484, 0.2450649343851896 },
+  { 0.1570140849128977, 0.9573690664158098, 0.2424686532504482 },
+  { 0.2326586167529879, -0.20072508112022486, -0.9516193618563388 },
+  { 0.5116851480183725, -0.7390374576612797, -0.4381802659533725 },
+  { 0.4852736405316185, -0.15818969164388544, 0.8599334365302945 },
+  { 0.47096192998250014, -0.2635942455871386, -0.8418508978438557 },
+  { 0.836096785969544, 0.5484075692918514, 0.01383121234027368 },
+  { -0.42839828952773285, -0.6826938259222738, 0.5919493606528525 },
+  { -0.07058854402920148, 0.9332044803860534, -0.3523445121457599 },
+  { -0.618472697067381, -0.23444676852811525, -0.7500174902686764 },
+  { 0.1930884489178064, 0.03450169776901243, 0.9805745681719322 },
+  { -0.27678279861332056, 0.36543978879414984, -0.888732267422459 },
+  { 0.41129096179228114, 0.892395149571444, -0.18566270968975052 },
+  { -0.8251146978027062, -0.1683785258406394, -0.5392906521586315 },
+  { 0.44903821670846505, -0.27897058646007633, -0.8488463299239756 },
+  { 0.4020328857817925, 0.7746743334385453, 0.48810781171940865 },
+  { 0.14127964050750907, 0.9225666750433956, 0.35904149241757943 },
+  { 0.3238203489358794, 0.23725451308173343, 0.9158879176173222 },
+  { -0.2546978777542343, -0.6769151650380992, 0.6905902188772527 },
+  { -0.9999318757261068, 0.009337885220788546, -0.00700341391559141 },
+  { 0.2530851513266565, 0.18945639859198862, -0.9487118525719581 },
+  { -0.8184448985227882, 0.3577235483394596, 0.4496463177269987 },
+  { 0.1010878808836673, -0.9819965571556252, 0.1595744405377891 },
+  { 0.11322990288385099, 0.7915846151834831, 0.600477132035626 },
+  { -0.11143818420938033, 0.3976004350186533, 0.9107663944025899 },
+  { 0.06835239390562828, 0.9548303640970843, 0.28918320498535044 },
+  { -0.7994098776538575, -0.600689716848968, 0.010756931781461256 },
+  { -0.16386405947136135, -0.8251959010828716, -0.5405555427979569 },
+  { 0.5560054810100598, 0.05632553017253364, -0.829267954124332 },
+  { -0.8792987756163857, -0.4431709171005567, -0.1744511434063316 },
+  { 0.6793634862570704, -0.09065928473575961, -0.7281800241917102 },
+  { 0.2843461475151551, -0.7501369520985471, -0.5970274880519252 },
+  { -0.710903866413978, -0.5203918590476422, 0.47308350822512923 },
+  { 0.7645888496726682, -0.27525198588216054, -0.5827866120838336 },
+  { 0.19368613249629993, 0.16004590948378467, 0.9679209621328252 },
+  { 0.6155559531000563, -0.7647816387000699, -0.1902627491400174 },
+  { -0.43261207365601206, -0.6794315012591287, -0.592637856387703 },
+  { 0.6077328384918966, 0.438984886301953, 0.6617802253142985 },
+  { -0.32364664498821966, -0.6463213781296279, -0.6910293230829555 },
+  { 0.9167243236547711, -0.3548610285115243, 0.18354880785078842 },
+  { -0.571189570053995, -0.19720232758620923, 0.7967770811564009 },
+  { -0.7973933684007617, 0.0647785715141818, -0.5999729599765886 },
+  { 0.5860421565837471, 0.331478544113415, -0.7393757945044735 },
+  { 0.3932469402378927, -0.782646063056628, -0.4825163043623459 },
+  { 0.3432373185544189, -0.6707630697102202, -0.6574686665267743 },
+  { 0.4363508035723206, -0.7784082144203692, -0.4513076865561706 },
+  { 0.7951495146267985, 0.6010285063611013, 0.08063488035652042 },
+  { 0.39977009419804094, 0.39438763270945043, 0.8274311252005964 },
+  { -0.649015582644988, -0.13382412304296462, 0.7489124632263561 },
+  { -0.6479630803799571, 0.7468145908788395, 0.14970575578443454 },
+  { 0.06508842878010071, -0.8895418599947097, -0.45219329468280495 },
+  { 0.6648039328866425, -0.7469952287468072, -0.005818852804259453 },
+  { -0.18216701066791835, 0.9381874573437836, -0.2943118670851053 },
+  { 0.6566181854913445, 0.177788644908786, 0.7329691372926637 },
+  { -0.9037768482961658, 0.4222202205008132, 0.07012484498445562 },
+  { 0.9640351756155251, 0.24744229353581237, -0.09699737906603846 },
+  { 0.8071759762606466, -0.43196723060619546, -0.40233226943670064 },
+  { -0.5298850528584929, -0.5499043228602304, -0.6456214575560385 },
+  { -0.679592305041857, 0.45038069919933715, 0.5790608989705763 },
+  { -0.29380667431300833, -0.48913066449875126, 0.8212361604168072 },
+  { 0.9765395804943109, 0.022607990287971187, -0.21414790800550484 },
+  { -0.16555182695279266, 0.8546053769725243, -0.4921811071569511 },
+  { 0.443163234614293, 0.27279623640172285, -0.8539253836789561 },
+  { -0.13676792357305528, -0.24789186147616274, 0.9590850640560503 },
+  { 0.8548152779279244, 0.23124182290451453, 0.4645622239924404 },
+  { -0.11254668358936512, -0.9745634350271931, 0.19380236097899645 },
+  { -0.6019386874008065, -0.453854694614546, -0.6570279543417703 },
+  { -0.27700805286798086, -0.1506165458559744, 0.948989565148482 },
+  { 0.8700144554499691, -0.4581982430964296, 0.18201433276376575 },
+  { -0.0977876942316152, -0.8501141257321321, -0.5174394071652804 },
+  { -0.6335444447017484, -0.7336514674557264, 0.24571723766885492 },
+  { 0.05201047186182307, -0.654927980628976, 0.7538993639776878 },
+  { -0.1034472314797712, -0.15551798558032717, 0.982401560697156 },
+  { -0.4750721268412122, -0.387897561694241, -0.7898366640832961 },
+  { -0.840429616933427, 0.4191345647431487, -0.3435175040936116 },
+  { -0.948458806438816, -0.055297962686698274, 0.31203850373208314 },
+  { 0.4720348138513296, -0.45753374435801547, 0.7535555767732561 },
+  { 0.4419908813456438, -0.5299957398115729, 0.7237047578874167 },
+  { 0.3734220363142923, 0.2802121676554986, -0.8843286289003054 },
+  { -0.014169020772458428, -0.45517979231522704, -0.8902868052028046 },
+  { -0.44648389992206355, -0.6605809989208362, 0.6035601635091028 },
+  { -0.40781547203136254, 0.21088836121261448, 0.8883764066412924 },
+  { -0.6186278763240254, 0.5858218525795695, 0.5235573585339696 },
+  { 0.5712615876725133, -0.817007000387491, 0.07848413704509756 },
+  { -0.8399985138444541, 0.2491210545731839, -0.4820178387855092 },
+  { 0.08668338184621636, 0.9522876487928309, 0.29263326070070206 },
+  { -0.7015417824541677, -0.20307788439462748, 0.6830801566001106 },
+  { 0.3758360879358716, -0.36369602587603184, -0.8523335237845808 },
+  { 0.5255844609271778, -0.6533038071024124, -0.5449358770143345 },
+  { 0.5941629581922798, -0.7445285225505226, 0.3043807783368313 },
+  { 0.7092942234521492, 0.08936981342520424, -0.6992243853197317 },
+  { 0.7263568506226301, -0.6657761191890662, 0.1707275158582256 },
+  { -0.9091959033476549, -0.02680675882106108, -0.41550476172644674 },
+  { 0.02634862394648593, 0.7308014566289494, 0.6820813595203526 },
+  { 0.7765956765365308, 0.5246466975075037, -0.3487764297931239 },
+  { -0.4043983980129771, -0.1890626905360033, 0.8948280475777596 },
+  { 0.029259770810644056, 0.9618371468605333, -0.2720536137074777 },
+  { -0.5968607357621976, 0.5644415299400025, -0.5702306738368231 },
+  { -0.5508322955578286, -0.6871075686784938, -0.47377945421390116 },
+  { 0.17052845971861721, 0.5370057706667014, 0.8261627241026176 },
+  { -0.701434261173761, 0.6101554417491352, 0.36837523553509677 },
+  { -0.9020702061982859, -0.2406504805406229, -0.35826901806456746 },
+  { -0.4632272679140811, -0.14417019782138782, -0.8744343613565274 },
+  { -0.7109103926270116, -0.7032825987147047, 0.0 },
+  { 0.6079347524615649, -0.7873988860295545, -0.1020702259667941 },
+  { -0.005964302771993467, -0.6983656336661441, 0.715716332639216 },
+  { -0.9205846132148118, 0.38199516166903275, -0.08126294588300852 },
+  { 0.13034721531073573, -0.7048972937784493, -0.6972298105248766 },
+  { 0.4852023925102507, 0.8288662067226529, -0.27849497240619847 },
+  { 0.16458022834947877, -0.1045306855733176, 0.9808091986772992 },
+  { -0.01667037641444736, 0.2471138150847491, 0.9688430527925878 },
+  { 0.9462287570195275, 0.0056745352744799245, 0.3234485106453557 },
+  { -0.4386833519580983, -0.6948024621483512, -0.5699179373448394 },
+  { 0.49779915191314067, 0.8208314073272794, 0.28005678906192516 },
+  { -0.6238425342911736, -0.7784701709958235, -0.06931583714346373 },
+  { 0.31054651947589784, -0.15301565176114512, -0.9381615370273488 },
+  { -0.267355894194031, 0.4986108946514903, 0.8245653409976377 },
+  { 0.5809190690449466, 0.8134854713657637, 0.027828458397362716 },
+  { -0.129132751453223, 0.3066902847014046, -0.9430089086386679 },
+  { -0.9718630177623852, -0.12753684120137612, 0.1980318884477064 },
+  { -0.9750686342711128, 0.05060076108655692, 0.21605721797275892 },
+  { -0.2279723974174581, -0.4937764211304857, 0.8391742560108155 },
+  { 0.2689826254209927, 0.28076288638833546, -0.9213145764875973 },
+  { -0.8703128765190289, -0.08265541285376252, 0.4855137276031933 },
+  { 0.24397908172510954, -0.7984769947367222, -0.550371416914782 },
+  { 0.5546172665118104, 0.2502639776108606, 0.7935789999725031 },
+  { -0.9630509215865236, 0.18710703619395314, 0.19371081394197504 },
+  { 0.4145806640131896, 0.812765482556931, 0.4093105708265813 },
+  { 0.14291642568911236, -0.9662393128111727, -0.21437463853366856 },
+  { 0.42403882341948224, 0.37508357725220753, -0.8243199538460223 },
+  { -0.7050237283653467, 0.4424215775978498, -0.5542604894069716 },
+  { -0.4058663991924123, -0.4216452224871497, -0.8108561970906725 },
+  { -0.4189728570388426, -0.9029848218490579, -0.09528985557201114 },
+  { -0.11716024410185087, 0.9230993969498461, -0.3662799210342075 },
+  { 0.6458376686387248, -0.20915204499761783, -0.7342677494215657 },
+  { -0.25737658731421886, 0.023307706365642174, -0.9660300425589564 },
+  { 0.26292590615232975, 0.9600348627345878, 0.09593242521774194 },
+  { 0.2217971719968306, -0.19767599414041137, -0.9548456502675228 },
+  { 0.9369814241603043, -0.2558108015167815, -0.23796353629468045 },
+  { 0.6012186241382939, -0.6213183618184335, -0.5024934420034904 },
+  { -0.9263985514278404, 0.21099468786968606, -0.3118765230073797 },
+  { 0.1816935453763818, 0.09741400926806011, -0.978518250400514 },
+  { 0.5363086206608926, 0.8034085890110095, 0.25866523250748163 },
+  { -0.9894335776706116, -0.09452532621567629, -0.1099370641856235 },
+  { -0.18932174363863047, -0.9154470647371045, 0.35512525825382857 },
+  { -0.3027466758468586, -0.8806438158011839, 0.36443232561726413 },
+  { 0.8556738809530493, -0.4736221065203858, 0.2085768675331452 },
+  { -0.7050154223810488, 0.579012666040606, -0.40950895810643895 },
+  { 0.7104605412453175, -0.640358172849195, -0.29186851457231733 },
+  { -0.786138985676469, -0.177667410762882, 0.5919626562143812 },
+  { 0.8061567172996764, 0.33145119387234084, 0.49015451975189384 },
+  { -0.8495450623285014, 0.46139085281634123, 0.25571794620376587 },
+  { -0.5994701613054204, -0.5390357710599959, -0.5916721754673011 },
+  { 0.8754301979243517, 0.30321632262526405, -0.37640646946584505 },
+  { -0.5939349891865077, -0.8045073602466944, 0.003022569919524212 },
+  { -0.01805885277197056, 0.5907824692544655, -0.8066287571480184 },
+  { 0.550803745478204, 0.03240022032224729, 0.834005671257847 },
+  { 0.29140250483038105, 0.343691552426113, 0.8927265521812983 },
+  { -0.39833916775880857, -0.8448645251658602, 0.3571132055042007 },
+  { 0.6687282206920236, -0.35792499968073826, 0.6516841730881789 },
+  { -0.9373449642194694, 0.009879788819177544, 0.3482625558760084 },
+  { 0.41652757738258855, -0.8753826994476493, -0.24537707062302713 },
+  { -0.8093040475526371, 0.2628949453833407, 0.525274410481616 },
+  { 0.23465590037090556, 0.9262992369683435, -0.29479879920546537 },
+  { -0.31412839257659353, -0.7760088749421777, 0.5469310550592469 },
+  { -0.17596113625462, 0.9831479358988292, 0.049576351881261985 },
+  { -0.9155582907835642, -0.21641454859161263, -0.3389952202249571 },
+  { -0.8268962507367673, 0.495379999009541, -0.26616019067243024 },
+  { -0.6092737493431345, 0.775240792174956, -0.16669496845827692 },
+  { -0.047221224300941535, -0.6018194331119996, 0.7972349251658959 },
+  { -0.48863462516433714, -0.5732060025966262, -0.6577773800289154 },
+  { 0.3009904964098084, -0.4770699368095463, 0.8257172618175743 },
+  { -0.4338305122453462, 0.7555097929969263, 0.49091347438289173 },
+  { 0.19346539272437266, -0.7527322447296411, -0.6292577449362701 },
+  { -0.7569696795587827, 0.5882885468128117, -0.2844529660902554 },
+  { -0.7282183086200658, 0.01723593629869978, 0.6851284678733163 },
+  { 0.21099028493492278, 0.5505527747520641, -0.8076971845165013 },
+  { -0.22377867605211205, -0.4893293716339517, -0.8428996797962888 },
+  { -0.6150673839681402, -0.6285483129318254, 0.47604530403013584 },
+  { 0.37429593615999857, 0.4169576235072672, -0.8282806845347066 },
+  { 0.10035247018790562, -0.577488448075187, -0.810207673418919 },
+  { -0.2605658662172119, 0.41569345168606364, 0.8713807340008157 },
+  { -0.9118573035804437, -0.19661067386509268, 0.36036162507863784 },
+  { -0.36603512618521056, 0.8640958810376569, 0.34548023788971277 },
+  { 0.2994706096084426, 0.9203913231085162, -0.25139046586396785 },
+  { 0.7892912906928767, -0.5376331980081914, -0.29659703780695057 },
+  { 0.024825948486547997, -0.251080615375315, 0.967647764873405 },
+  { -0.33371559798210365, 0.6142140906381575, -0.7151048528187934 },
+  { -0.4391143450722835, 0.7838094053425738, 0.4391143450722835 },
+  { 0.5518649801024188, -0.2761835660203188, 0.7868720871887991 },
+  { 0.05281326274549786, -0.41260361519920197, 0.9093783678990411 },
+  { 0.29657009931034634, 0.09597737841758781, 0.9501760463341193 },
+  { 0.41412474038065183, 0.09185473564834007, 0.9055735237647087 },
+  { -0.38059007881452583, 0.4034412429669508, 0.832097563619336 },
+  { -0.4191823949204781, 0.8596685288952106, -0.29198654115537037 },
+  { -0.5839613369005726, 0.8102601536578833, -0.04967535001989748 },
+  { 0.22840277820886257, -0.2169076712092918, -0.9490960083558644 },
+  { -0.2729665569926176, 0.5094615907127352, -0.8160503332221889 },
+  { -0.7747721659582582, -0.574797187987951, -0.263317837484462 },
+  { -0.7277975480715948, 0.004001636003142789, 0.6857803700385956 },
+  { -0.8308357460362703, -0.14734796989442253, -0.5366568166681074 },
+  { 0.3872565794688456, -0.9217513375899086, -0.020169613514002375 },
+  { 0.41158178979713456, -0.6965230288874584, 0.5877551365465283 },
+  { -0.6734839160983761, -0.20736215311450001, -0.7095212133632892 },
+  { 0.04009430880166575, -0.7191518880298778, -0.6936951840288201 },
+  { -0.8811894955963143, -0.3937229661175021, 0.26170078105032385 },
+  { 0.668041633649017, 0.729887022585665, 0.14486307318494113 },
+  { 0.6541309775261613, -0.7392512744602587, 0.16006316706085702 },
+  { -0.9073221468483205, 0.3326847871777175, 0.2570746082736908 },
+  { 0.18104398675376038, -0.9231253830081847, 0.33920878836830926 },
+  { -0.4994199258214935, 0.07398813715873978, -0.8631949335186307 },
+  { -0.30818270167813533, 0.0684222145010172, -0.9488634374603873 },
+  { 0.604354917013835, 0.4977040493055112, 0.622130061631889 },
+  { -0.656221185583678, -0.7066997383208841, 0.26447917772169904 },
+  { 0.08880070351134457, -0.8564971080610332, 0.5084556410730213 },
+  { -0.3323526094856096, 0.2621097879113516, 0.9060023190087165 },
+  { -0.573524160743981, 0.6598736783331054, -0.4854243150956178 },
+  { -0.18552614580365914, -0.9125880685477288, 0.36436666473151075 },
+  { -0.910607413694866, -0.3992545152793679, 0.1067238031227541 },
+  { -0.3497559565916839, -0.19720282658892815, 0.9158503240235127 },
+  { 0.28006769090488165, -0.6233994033593432, -0.7300241587799834 },
+  { -0.9721092865734847, 0.022772691925586758, -0.23342009223726426 },
+  { 0.18408696807060912, -0.4445026789997635, 0.8766580613606447 },
+  { 0.5872387794283855, -0.2150545643484904, -0.7803218248186711 },
+  { 0.04290649260910295, 0.8059903168596049, -0.5903716134948723 },
+  { 0.35741442521789085, 0.9075916865083521, -0.22030038408293753 },
+  { -0.18530385399476307, 0.23531665887916278, -0.9540904316408562 },
+  { 0.08517167926623691, -0.48577226726329603, 0.8699259102985991 },
+  { -0.22567317979491436, -0.6535535229016436, 0.7224537415115954 },
+  { -0.16405991887041846, -0.8349915273852642, 0.5252366059358919 },
+  { -0.8969651848923987, -0.06103609246309222, 0.4378676198439224 },
+  { 0.650941427670828, -0.6943375228488832, -0.3068723873305332 },
+  { -0.09740062928614698, -0.8708423127299888, -0.48181613066993423 },
+  { -0.05331589585013581, 0.988972321614491, -0.13817077234401393 },
+  { -0.696647150086603, 0.2345051674235185, -0.6780044798730179 },
+  { -0.029331798302486483, -0.9842447874834354, 0.17436124546478077 },
+  { 0.37898096379055685, -0.9095543130973365, 0.1705414337057506 },
+  { -0.7784274310832473, 0.6146251764269107, -0.12761907004568313 },
+  { 0.7322685234130341, 0.4631784483511685, 0.4992479690509505 },
+  { 0.866649240355587, -0.3357888345907361, -0.36900535599809314 },
+  { -0.05667151232700247, -0.9961592500146434, -0.0667464478518029 },
+  { 0.8074205644071, -0.37514846631976145, 0.4553412570703986 },
+  { 0.6444837306156234, 0.27264740082146915, -0.7143557347687955 },
+  { -0.5706141953434921, -0.3167458963132608, 0.7576750472605047 },
+  { -0.9054840216762924, -0.11152101002263161, 0.40946520097861755 },
+  { 0.8820424753855731, -0.14863146684674022, 0.4471126912520792 },
+  { 0.09269619789668289, -0.7721048013041352, 0.6286983304404434 },
+  { -0.7725768193194473, 0.6160804892521747, 0.15352488076219786 },
+  { -0.9825763130999791, -0.062331830704150916, 0.17509577897802395 },
+  { 0.8570233489930429, -0.015544558929740803, 0.5150430525387453 },
+  { -0.3685501415212086, 0.831990148782586, 0.41468444088659456 },
+  { -0.32471119446567465, 0.945452468428447, -0.026120301132096856 },
+  { -0.6133064347900075, -0.46932230762604515, -0.6352887442806887 },
+  { -0.24735975626681458, -0.2776599491280057, -0.9282877267473999 },
+  { 0.2673065118391705, 0.9575922933702083, 0.1075371024640341 },
+  { -0.7398750752313673, -0.5448946871712821, -0.39455627348185607 },
+  { -0.19961594534046903, 0.978714000661852, -0.047669479484291115 },
+  { -0.7665784971563383, -0.27470140075163896, 0.5804279008822865 },
+  { -0.13916041538309318, 0.8825981729489255, -0.4490599557939045 },
+  { 0.593445382291064, -0.7897029102928332, 0.15553742865446335 },
+  { 0.024383526637705436, -0.9201878504943599, -0.39071698636132757 },
+  { -0.19346141565521366, 0.9776710826861691, 0.0820483682466308 },
+  { -0.12014587054726872, -0.7574195922417398, 0.6417791918399938 },
+  { -0.10159930457395845, 0.4981325127169807, 0.8611280863404439 },
+  { 0.03258268486642047, -0.5168508246457678, -0.8554551967870002 },
+  { 0.2994296382864559, -0.7160273959023946, -0.6305923088913135 },
+  { -0.37249304174958314, -0.5693389581213141, -0.7328724886455213 },
+  { 0.043291025847039456, -0.5024851214388508, -0.8635013548418407 },
+  { -0.7025237945504336, -0.23440107264980617, -0.671949741596111 },
+  { -0.8005497288651539, -0.15560886296013432, -0.5787106473724004 },
+  { -0.9038132558656807, -0.3329236170340672, 0.26885584193472783 },
+  { 0.8029252267863984, 0.2773278243630481, 0.5276365776024904 },
+  { -0.3048942950738811, -0.9299030513203395, 0.2057177288823771 },
+  { 0.28509579650660183, 0.8835237144134306, 0.371626469567711 },
+  { 0.0, 0.9934043066827765, 0.11466422050540558 },
+  { 0.5080028982591139, 0.328238587643268, 0.7963620313289008 },
+  { -0.42207292645773925, 0.9038486653910505, 0.07008591029741057 },
+  { -0.22943337000733993, -0.6032418850436889, 0.7638452440488268 },
+  { -0.5578999880376826, -0.7041405632602468, 0.43924215476101125 },
+  { -0.10876370212227814, 0.1306624340932066, 0.9854429386917817 },
+  { -0.2680204182039481, -0.06131599190043153, 0.9614600379438799 },
+  { 0.33887866208819156, 0.6097928014177486, -0.7164593440806055 },
+  { -0.7439370079129889, 0.5249425640251827, 0.41351303816462237 },
+  { -0.3615446874631899, 0.9250459776890211, -0.11651342467075455 },
+  { -0.39757915835660546, -0.753894841652357, -0.5230424271227151 },
+  { 0.9111661780195554, -0.3780954948597431, -0.16376810678517942 },
+  { 0.3624071293431734, -0.4288484363894218, -0.8274962786669126 },
+  { -0.504048457002393, 0.862003187921423, -0.05371831165264546 },
+  { 0.7900563954104136, 0.6119007159737249, -0.037261318574993714 },
+  { -0.14174807181232668, -0.017407657941864683, -0.9897496944088776 },
+  { 0.5955423927609852, -0.5860893389076363, 0.5493892474769873 },
+  { 0.5139910705196346, 0.22159308907606695, 0.8286794810418598 },
+  { 0.38893136696725156, 0.08981346827557013, -0.9168783630914725 },
+  { -0.023532097344649183, -0.6933759845504771, 0.7201916303618215 },
+  { -0.18783789293450912, -0.04990861889564252, -0.980931218657992 },
+  { 0.8632980858997609, 0.3764509556161362, 0.3361563518625028 },
+  { 0.8429646460617142, -0.5059015792824855, 0.18295955173080178 },
+  { -0.9173067312840498, -0.030833839707026887, -0.39698568622797115 },
+  { -0.43939032095510244, 0.7302006778878147, 0.5232046596343994 },
+  { 0.26642282626982555, -0.664601203235931, 0.6980860393244883 },
+  { 0.6781490538968996, 0.5995230766334909, 0.425071689580303 },
+  { -0.8041270012744961, 0.4747744172616275, 0.35772757586628495 },
+  { -0.7275601828123751, -0.6576321369731645, -0.1953871869036767 },
+  { 0.1875325553272081, -0.9821104277363204, -0.017048414120655282 },
+  { -0.3218360983590523, -0.10773912305582009, 0.9406454205258139 },
+  { 0.8311342957275409, 0.5398629074050063, 0.13328099517072278 },
+  { 0.4900329352800848, 0.8367543517518429, -0.24435604589438192 },
+  { 0.5563821294235767, 0.7688798824684848, -0.3150597600350374 },
+  { 0.660001171525753, 0.002444448783428715, -0.7512605927737583 },
+  { 0.6968028309562049, -0.4154786994925647, 0.5846736397678501 },
+  { 0.34396443812641164, -0.7645391374718876, 0.5451315186064039 },
+  { 0.7896182968380439, 0.6128723408597608, 0.029840226333995846 },
+  { 0.3306792646961636, -0.6302879944544327, -0.7024160219888308 },
+  { 0.34556655233006967, 0.796373827415206, -0.49635922971046376 },
+  { 0.9333172016467678, -0.17248038433523655, -0.3149119212253099 },
+  { 0.8796384030722554, 0.3543221610845541, 0.3173201632497747 },
+  { -0.709501677031598, -0.6517884809148488, 0.26791630490894675 },
+  { 0.4063236435329153, 0.026499368056494475, 0.9133448856805095 },
+  { 0.9612236402670062, -0.24500550413585362, 0.1265757335944819 },
+  { 0.37026387525247506, 0.2643148748037247, 0.8905292300876547 },
+  { -0.6641237052993516, -0.6469582975866233, -0.37467941662610477 },
+  { 0.5707321314945544, -0.8078333235425036, -0.14720786478295061 },
+  { -0.9603326584897769, -0.2535071695260648, -0.11616927320440851 },
+  { -0.8135402748818473, 0.21667153049617038, -0.5396347551980093 },
+  { -0.9752485318874605, 0.21552453743369293, 0.049391039828554625 },
+  { 0.34051500370959836, 0.8693028336133263, 0.35827659108640303 },
+  { 0.16837670631516294, 0.07279652979302424, -0.9830310015561823 },
+  { 0.1309635795003259, 0.6018209626065558, 0.7878198206517658 },
+  { 0.2578763313357779, 0.5085728112190515, -0.821494670357362 },
+  { 0.330839191995899, -0.7533466739654727, 0.5683433978367837 },
+  { -0.3229233644885232, 0.33107482805813643, 0.8866284221102365 },
+  { -0.42813578726745644, 0.7577933591928062, -0.49239107671053306 },
+  { -0.7351342215242992, -0.6006584492942445, 0.3143041578396573 },
+  { 0.628133642993364, 0.5750194011226016, -0.5242144741157855 },
+  { 0.9004515260892987, 0.3815663341803403, -0.2087921976119561 },
+  { 0.38498212883566063, -0.08830575993413543, -0.9186897480867072 },
+  { 0.24249434456899852, -0.959372669329828, 0.14422404166785918 },
+  { -0.41047816646498686, -0.26357655460785606, -0.8729462037929911 },
+  { -0.9372175772602738, -0.21188770332940984, 0.27699605421769213 },
+  { 0.02250766396209522, 0.7712184857600274, 0.6361725019874561 },
+  { -0.110062720527914, -0.984392743413212, -0.1373212447708086 },
+  { -0.898241452559782, -0.05195483980101567, -0.4364206543285316 },
+  { -0.5728604290505018, 0.7998428632025875, -0.17911539021525125 },
+  { -0.24711146244802923, -0.03545282223558449, -0.9683382789719347 },
+  { -0.2661509492263065, -0.20138417831192013, -0.9426601110429829 },
+  { 0.45212438744032657, 0.6569194061415198, 0.6033576320196693 },
+  { 0.8177214474234619, -0.42051286593277454, 0.39306559758987175 },
+  { 0.7395700428958503, 0.2635187888692761, -0.6193496585644493 },
+  { 0.008442739795721119, -0.9811669748313044, 0.19297690961648273 },
+  { 0.870127126319529, 0.09591348394174704, 0.48340395906640504 },
+  { -0.42165496680787135, -0.8961884880851336, 0.13803362919931944 },
+  { -0.4703936935038611, 0.349302247651382, 0.8103812145512063 },
+  { -0.003762946744852296, 0.0611478846038498, 0.9981216240720714 },
+  { 0.18246193714968645, 0.7063403824628967, -0.6839524147144689 },
+  { 0.5921634877905324, -0.7923461889728186, -0.14673077573570717 },
+  { 0.07422452584903273, -0.6117296492792765, 0.7875770158880588 },
+  { 0.3861602890961435, 0.4803457254610566, 0.7874948984955231 },
+  { 0.31268240945086523, 0.9430006130567679, -0.11392784819595882 },
+  { 0.4013905279103203, -0.6316723172642755, 0.663231277689657 },
+  { -0.8679749135157487, 0.44146555316071356, -0.2274372768035919 },
+  { 0.1541878043842816, 0.6684003342766887, -0.7276449093603042 },
+  { -0.53459502193158, -0.8280468881777802, 0.1689571351114485 },
+  { -0.8718989092168521, -0.4797040885141801, -0.098368082065491 },
+  { -0.17610961394653718, -0.9329686571615883, 0.3139345292090445 },
+  { -0.6054009902372642, -0.6301744322930091, 0.48617880034399225 },
+  { -0.7562659326688949, 0.06615285156174998, -0.6509113912927745 },
+  { -0.10753934558831196, -0.3813580154476273, 0.9181510514094534 },
+  { -0.8519201775200371, -0.5001547284467769, 0.15516848503017475 },
+  { 0.9513882637399147, -0.045570698347206, -0.3046041415839559 },
+  { -0.21201813689697735, -0.798503492433755, 0.5634185674947454 },
+  { -0.5742450316815813, 0.7835682427005514, -0.2371991834306973 },
+  { -0.42198172018545005, -0.1475388410428346, -0.8945187075813819 },
+  { -0.12527244034957316, 0.802469835282773, -0.5833943598888335 },
+  { 0.060021984528878, 0.9658082965101278, 0.2522135915556894 },
+  { 0.31921049445954913, -0.18360184034474067, -0.9297284681286867 },
+  { -0.06595056908588827, 0.9975971139888385, -0.02122547051040082 },
+  { -0.9722335978457783, -0.17468262794970352, 0.15571708548659283 },
+  { 0.5458625774796538, -0.5837604665373155, -0.6010472229495822 },
+  { -0.8061926657667231, -0.5911646461303127, 0.024036364732770956 },
+  { 0.6877055596426822, 0.6472839946166625, 0.32876206221162707 },
+  { -0.1333207976052565, 0.2690656097124267, -0.9538497065030623 },
+  { 0.45896934533203304, 0.841237614085667, -0.28577336596145453 },
+  { -0.6014447755403672, -0.7266526098536036, 0.3320243463484927 },
+  { 0.2781845422013755, -0.2829625209796434, 0.9179028119583554 },
+  { -0.5225672208031419, -0.6128766566130808, 0.5927104719176576 },
+  { 0.5226298855787446, -0.11157916804944436, 0.845226651234651 },
+  { 0.8098298661951467, -0.4752669485006267, 0.3439431864149272 },
+  { 0.3392888323252425, 0.3272301016125521, 0.8819317143963088 },
+  { 0.33862666677099423, -0.340922440783001, -0.8769856725865749 },
+  { -0.10590996063738421, 0.9910761357205629, 0.08093931951149688 },
+  { -0.8412034849833907, -0.4418085530374951, -0.31174011502325655 },
+  { 0.46788468530766636, -0.42784565355762155, 0.7733252989437224 },
+  { 0.7632747696805595, 0.3372730117555158, 0.5510522130528581 },
+  { 0.9810212415825815, -0.17253586661429846, -0.08847993159707612 },
+  { -0.4649286713397615, 0.5783678295964131, -0.6703222987893049 },
+  { -0.2748274988091816, 0.4615027810191918, 0.8434957196156014 },
+  { -0.6859377260821881, 0.7238007841329378, -0.0748455798677612 },
+  { 0.7607201274404973, 0.6222802513070245, 0.18458650151129713 },
+  { -0.15328021135616066, 0.11326956795069225, 0.9816695889059995 },
+  { -0.1322376966502715, 0.9604919118836592, -0.2448846234264287 },
+  { 0.7031021315289953, 0.0752712744215956, 0.7070937900210496 },
+  { 0.9894035694172779, 0.1449126440055609, 0.008994577903793436 },
+  { -0.18241276912443122, -0.947047116413143, -0.2642486347247754 },
+  { -0.25358000681158677, -0.4993916983160352, 0.8284353395398228 },
+  { -0.5921132112393472, 0.47369056899147777, -0.6519349583542504 },
+  { -0.9818558988382816, -0.14615862119561454, 0.12081660219798783 },
+  { -0.28621913167511026, -0.819779854891475, 0.49602378791471097 },
+  { -0.4361797032705391, -0.8468569642127604, 0.30427051881372286 },
+  { 0.25018906032761873, 0.48708067059845456, 0.8367543572768193 },
+  { 0.17924504807531988, 0.17109754589007806, 0.9688120780269355 },
+  { 0.7042072328355554, 0.005243538591478448, -0.7099751252861818 },
+  { -0.8281950727144214, 0.22851536287270824, 0.5117359186755497 },
+  { -0.839858752284783, -0.4779067222678572, -0.25737606924856254 },
+  { 0.33573957558843737, 0.08022582329936474, -0.9385322342144861 },
+  { 0.13973279385574894, -0.3347555421148518, -0.9318870496710739 },
+  { 0.7916495822634392, -0.2046238181735943, 0.5756909170190043 },
+  { -0.0013076448870811255, -0.6074010500491828, -0.7943942689017838 },
+  { -0.04283367790703019, 0.831394666261045, 0.5540290470269971 },
+  { 0.7678565068234763, 0.6096037741381872, -0.19692542620323747 },
+  { 0.8416045224651837, 0.0017163926358909252, -0.5400915494270111 },
+  { 0.8409577927070445, -0.027411895454944407, -0.540405938968904 },
+  { 0.8572747339496768, 0.43502302607316, 0.27538154861511965 },
+  { 0.2157841218061386, -0.09233070596512662, 0.9720659717901532 },
+  { -0.18447985565027733, 0.40074700950491016, 0.8974235439479645 },
+  { 0.6607584679565736, 0.5349468856020236, 0.5265264253656955 },
+  { 0.5961126512420288, 0.7017231603203411, 0.3901721585393201 },
+  { 0.7543625361483156, 0.11283200327004721, 0.6466885673134706 },
+  { -0.9253149731429876, 0.37223582795817256, -0.07233732689065701 },
+  { -0.767997071951532, 0.41332456972054593, 0.48922724529527056 },
+  { -0.8403260892638366, -0.4559671788066702, -0.29316547469583226 },
+  { -0.4121545420873406, 0.1525915671086719, 0.8982452043201201 },
+  { -0.6114282355929999, -0.7527120461774197, 0.2440903280735083 },
+  { 0.24406819262428897, -0.9676901527345435, 0.06329680599926615 },
+  { 0.165362158155098, -0.8409201899354813, -0.5152752573228822 },
+  { -0.9568158650192952, 0.1861711489301109, 0.22325703517116888 },
+  { 0.7004602179484338, 0.711127124820745, 0.06044580560976332 },
+  { -0.18611605051281285, -0.39515944058155195, -0.8995609108119288 },
+  { -0.891569830105, 0.3246477098751902, 0.31576431482885414 },
+  { 0.4179538211779505, 0.8719644118621397, -0.25493659566382887 },
+  { 0.1991959656101435, 0.808798857191662, -0.553322126694843 },
+  { -0.16891914561854368, -0.9345043055993626, 0.31331777009891165 },
+  { -0.46973274645255275, -0.5468137160667865, 0.6930699148219993 },
+  { -0.32037216832749604, 0.6887719103901546, -0.6503498514020245 },
+  { 0.018102534831224454, 0.5911770660597014, -0.8063386229108264 },
+  { -0.9637182480828493, 0.0483963312356016, -0.2624974922452739 },
+  { -0.29646459580958556, -0.5570458687834288, -0.7757632651155725 },
+  { -0.7190843896492776, -0.3315679863820993, -0.6107211401034405 },
+  { 0.34558987963279914, 0.40269165572155186, 0.8475889720304427 },
+  { 0.040899925601686364, -0.6445525312413907, -0.7634652778981456 },
+  { -0.8583817126443359, -0.38917488982777937, -0.33425101424724596 },
+  { -0.8407739523305747, -0.5106687581799706, -0.17976812982659401 },
+  { -0.15334849383978466, -0.5481392971294431, 0.8222089456941646 },
+  { -0.008000113780205095, 0.6826763759108347, -0.7306770585920652 },
+  { 0.15645895846853441, 0.954597695972577, -0.2535031225819292 },
+  { 0.23977373088892262, -0.31484851556045423, -0.9183566683075726 },
+  { -0.8972712518841626, 0.04641058199400841, -0.43903343656401056 },
+  { -0.08658764858347176, 0.4987448558407973, -0.8624129798913787 },
+  { -0.39716713263342845, -0.2359113043461718, -0.8869070555799117 },
+  { -0.49452164214442834, -0.8234952667469451, -0.2780357730511593 },
+  { 0.923541015591317, 0.29941038173106255, 0.23963600696101228 },
+  { 0.17934164851638995, 0.5570382435294176, -0.8108914652116429 },
+  { -0.23261521349547748, -0.8565781062711876, -0.46061275525903483 },
+  { -0.676445835457729, -0.24503345903533616, 0.6945355539100021 },
+  { -0.27969034412420934, -0.5712824050196617, -0.771627970668918 },
+  { 0.7857936546340644, 0.24653625422707814, -0.5672285321530663 },
+  { -0.6460942978517068, -0.7264084742275722, 0.23429231070156906 },
+  { 0.011163009226244266, 0.9190877596274446, 0.3938947541260477 },
+  { -0.9032233682940736, -0.0602148912196049, 0.4249255391747119 },
+  { 0.9498431318767687, -0.2524565714842487, -0.18456355095454216 },
+  { 0.7136903032999897, 0.6079861722440039, -0.34784905538991095 },
+  { -0.4345648058353801, 0.044325610195208774, -0.8995491480792368 },
+  { 0.16936367061473853, 0.981593668422041, 0.08825994102458205 },
+  { -0.6283812195278605, -0.6333032656338229, -0.4517344537249893 },
+  { -0.2888646101707324, -0.3095717506847634, -0.905937397488856 },
+  { 0.7992876462470758, -0.5586495360536844, 0.22147224300984694 },
+  { 0.10127228229863067, 0.6444115226265499, 0.7579430812034358 },
+  { 0.33602822233256463, -0.13764340118763427, -0.9317399465009089 },
+  { -0.2708210143348957, -0.9269392447587722, -0.2596913836088041 },
+  { -0.5978635551059853, -0.3321464195033252, -0.7295463833692506 },
+  { -0.2704637438399925, 0.8405018106025598, 0.46947424811364646 },
+  { 0.055298265990210344, 0.7722007857918659, -0.6329676517808005 },
+  { -0.3189853348825993, 0.006144179805122298, -0.9477397349401144 },
+  { 0.5970633995945878, -0.7472021492002443, -0.2918976620240207 },
+  { 0.4831512766022989, 0.16843805973291154, -0.8591818573218251 },
+  { -0.28381528068589157, -0.0723651981495673, -0.9561444266144955 },
+  { -0.8626126295942246, -0.41168583599149744, 0.29396296315780834 },
+  { 0.21974523203969526, 0.11050406783605364, -0.969278537876242 },
+  { -0.08014073006220988, 0.8893539459501083, -0.4501411136611139 },
+  { 0.5724385230913781, 0.5257521560551953, 0.6292049011921913 },
+  { -0.8091668751757009, -0.37373806817885813, 0.4533969833515955 },
+  { -0.6385929973536265, 0.14884129092165294, 0.7550134130250185 },
+  { -0.09114528186007587, -0.9888063801793757, -0.11812908241075622 },
+  { -0.27631195870182257, -0.6940780501077612, -0.6647611314126076 },
+  { -0.9012724517021508, 0.28599648619363083, -0.32544427739275233 },
+  { 0.3590804356680323, 0.5309648808021111, -0.7675529532711448 },
+  { -0.49657273709152505, -0.863711747864843, -0.08612510306344587 },
+  { -0.8900828613333854, 0.0005003276342514815, -0.4557984748030996 },
+  { -0.08928279184416874, -0.9029901874320806, 0.4202824103884041 },
+  { -0.5067115113192712, 0.7309611227255804, -0.45709876543291955 },
+  { 0.5079261066177124, 0.6916790717547898, -0.5134112697561327 },
+  { -0.5726797406125494, -0.02813744390292873, 0.8192961607029248 },
+  { -0.958245384407216, -0.285559251624126, -0.014889495429190925 },
+  { -0.555128284913686, 0.5062769958412816, 0.6599365051053899 },
+  { 0.3152123953562022, -0.9188738694817593, 0.23730140707004657 },
+  { -0.38948937654886795, -0.7639316152221481, -0.514496368130674 },
+  { -0.11049841848314049, 0.463167023582026, 0.8793556776293036 },
+  { 0.4581523949630521, 0.7931815686106222, -0.40119743544296516 },
+  { -0.04244449381549314, 0.8632292323286105, 0.5030246091376687 },
+  { 0.5178406521543085, 0.7225079111613438, -0.45806481777765057 },
+  { -0.5813287087818667, -0.4356757100031871, 0.6871998312421405 },
+  { -0.5267844431294456, 0.678110055518934, -0.512508441960626 },
+  { -0.3302896014884075, -0.9006508114660742, 0.282377221025583 },
+  { -0.5341495287205331, -0.5006039061438813, 0.681234181556622 },
+  { 0.7214128707952429, 0.6531425796077907, 0.23014830121955554 },
+  { 0.7075716816651609, 0.5324655584247928, -0.46456726573975216 },
+  { 0.8935873565024481, 0.20180621759276196, 0.4009686856100729 },
+  { -0.9643276635415199, 0.238505467929353, -0.11483596604005886 },
+  { -0.13109079098042306, -0.9601514690728283, -0.24682860644061638 },
+  { -0.5788737500197865, -0.22482018825074931, 0.7838118808061838 },
+  { -0.09972695806594789, -0.9938136959740252, 0.04887608340855862 },
+  { -0.533600873391285, 0.359989105972111, 0.76529598946908 },
+  { -0.9760275915787584, 0.21689502035083522, -0.018074585029236267 },
+  { -0.6653075604202581, -0.7429267758026215, -0.07365905133224285 },
+  { 0.17135472263265833, -0.1448502151750889, -0.9745029369864491 },
+  { -0.8458855635183804, 0.4827246544781246, -0.22683589087745207 },
+  { -0.852269132074371, -0.38284470536039206, 0.35646494651047106 },
+  { 0.3620415889268714, -0.9202863615302408, 0.148320263850686 },
+  { -0.944088506715062, 0.2217008471245772, 0.24401972435188363 },
+  { 0.22586307035941391, 0.512260047184031, 0.8285985261312216 },
+  { 0.856304729609986, -0.49360444145303445, -0.1519765291925255 },
+  { -0.7223428909720991, 0.018986312546458998, 0.6912743795324389 },
+  { -0.9078230514879166, 0.40686921936967024, 0.10156153561601264 },
+  { 0.7123963544506365, -0.4203580973466489, -0.5619524038213096 },
+  { 0.6715501464342012, -0.7076897928688128, -0.21953486714756618 },
+  { -0.594248317792452, -0.2636536508782717, -0.759839252197068 },
+  { -0.8843829913499903, 0.38520641451889426, 0.26359579439805325 },
+  { -0.003531910038643069, 0.8088073988492628, -0.588063021434071 },
+  { 0.5986725500614885, -0.18471805651175782, -0.7794038859291077 },
+  { -0.6673256758246905, -0.7302595331029748, -0.14627869529547166 },
+  { -0.7779929148893974, -0.23790887389389834, -0.5814863645043074 },
+  { -0.021989588328558234, -0.6189661899890465, 0.7851097462492643 },
+  { -0.6420903555245224, 0.09517873000933628, -0.7606976959976954 },
+  { 0.6452905986902644, -0.4344762040050287, -0.6283553703083479 },
+  { -0.6507917169351451, 0.14178276918343488, 0.7459006552693748 },
+  { 0.8667303611904423, 0.4224647647678771, -0.26514524985431615 },
+  { -0.39532543537503373, -0.7647822600459965, -0.5087493438467297 },
+  { -0.6227264667129347, -0.7481723975073793, 0.2290192377580628 },
+  { 0.023255577934692177, 0.9684656233247365, -0.2480594979700499 },
+  { -0.3972213696154839, 0.7762955700607173, 0.48946947956425746 },
+  { 0.8676347215524134, -0.26047781057405067, -0.42351068481824067 },
+  { 0.16992079983754127, 0.2593806601881471, 0.9507095218324739 },
+  { 0.5186447101921589, -0.8517129419711019, -0.07478455100234066 },
+  { 0.45656559717783035, -0.6962911425631824, 0.5538289449475436 },
+  { -0.07832830523255771, -0.3979357649761191, -0.9140633476692226 },
+  { -0.45098692068893503, -0.26897704773871745, 0.8510359247160345 },
+  { 0.984966750153725, -0.08336709170580117, -0.15129583309571323 },
+  { -0.6765764146844032, 0.03170612268973772, 0.7356895247839143 },
+  { -0.5338374819548295, 0.5643424809236769, -0.6297103358569213 },
+  { -0.34565692018271915, -0.8912314007845972, -0.2936458475533445 },
+  { 0.9777977722515898, 0.19720291205074078, -0.07086979651823497 },
+  { -0.5418510041798519, 0.4790718664627262, -0.6905705148883826 },
+  { -0.31866373580700924, -0.5304701709841231, 0.785528370701909 },
+  { 0.3418206202297555, -0.1346415524451508, -0.9300700596949162 },
+  { 0.6176205864913369, 0.09065990260423293, -0.7812333794724134 },
+  { 0.5078164362596651, -0.16423221501210933, 0.8456655642845757 },
+  { -0.22800415549930403, 0.10763917108455516, 0.9676920553168136 },
+  { -0.9511514125746126, -0.2773428010975428, 0.1356169644133359 },
+  { -0.1852776994002461, 0.06658417322196344, -0.980427825992969 },
+  { -0.3002505217031465, -0.8364121676016224, 0.45854586477793463 },
+  { 0.18478131235817355, 0.8531617164880242, 0.48782266462557816 },
+  { -0.8093180191241659, -0.0642996307566869, -0.5838406472707172 },
+  { 0.43693705733211236, 0.8855569236837999, 0.15771792176426516 },
+  { -0.5257421738508431, 0.5209040556865715, -0.6724984248337471 },
+  { -0.0016288080377698866, 0.17319658801619794, -0.9848859268381915 },
+  { 0.761539040325825, 0.6467642278195757, -0.04188464721792037 },
+  { 0.6821671851756739, -0.49542583156737424, 0.5377742806096936 },
+  { 0.9492727965161506, 0.051574663747727865, 0.3101954413812618 },
+  { 0.34513513514004796, 0.9162516087646511, -0.20338320463609968 },
+  { -0.40440780274840643, 0.23962981628151075, 0.8826278265640027 },
+  { 0.8179829748818512, -0.5352234280091126, 0.21080734074887217 },
+  { 0.13473777883079296, 0.5658986710893305, 0.813390696415366 },
+  { -0.3739053191974244, 0.046346722982595324, 0.9263081525845741 },
+  { 0.6134358108804837, 0.6328704141496461, -0.4724103563888697 },
+  { -0.2701929134729486, 0.2572792815790209, -0.9277947837637278 },
+  { 0.7222227101557391, 0.5850442422250307, 0.3689411763067913 },
+  { 0.6675950164525917, 0.2559717530162919, 0.6991390102586397 },
+  { 0.6687728252410213, -0.036395800013116805, 0.7425754197120638 },
+  { 0.8472650639181294, 0.30245159492112894, -0.43665197147553714 },
+  { -0.7451450783943586, 0.24303829760260137, 0.621040415788775 },
+  { 0.9276889715071783, 0.16160135325534344, -0.33656823196789576 },
+  { -0.687286343686073, -0.7164086463846354, -0.11998388711807714 },
+  { 0.9556594452428916, -0.28844771206090825, -0.05927007782073457 },
+  { 0.7181801600342378, -0.44795945595696923, -0.5324937403875586 },
+  { -0.4817649956918088, 0.47115083422001863, 0.7388635735640593 },
+  { -0.9680438853213643, -0.07651604363019167, -0.23882280284574975 },
+  { 0.6711195260443954, -0.16758943896681838, -0.7221581279115629 },
+  { 0.2629922328599799, 0.5071572812646592, 0.8207475723482595 },
+  { -0.8110280273032076, 0.5292596940352593, -0.24923425767412322 },
+  { -0.7037357130571977, 0.4283608688174247, -0.5668006812221194 },
+  { -0.5621038155570489, -0.7415825777173698, -0.36618926931611256 },
+  { -0.5027621480950248, -0.7403458673420714, -0.44622664549799396 },
+  { 0.7583334229197074, -0.45277412509215353, -0.4689626971624875 },
+  { 0.07194147422429435, -0.43809877062104763, 0.8960434651660386 },
+  { -0.8539539104626077, 0.4863539042816389, -0.18499350960405897 },
+  { -0.5413079676007424, 0.36271316196376274, -0.7585676280663465 },
+  { -0.04121625195801939, 0.9469685205964454, -0.3186719968461499 },
+  { 0.20118468549620705, -0.2975753824784193, -0.9332596712944445 },
+  { 0.07869661720679492, 0.9887849161950523, 0.12693002775289502 },
+  { -0.8078308527101304, 0.22573281265897563, -0.5444759046079921 },
+  { 0.9769616648418511, -0.10348648152170932, 0.18664526131594003 },
+  { 0.3741201400770015, -0.7839738970065097, 0.49539787000066043 },
+  { 0.8802208545184516, -0.47308700105962886, -0.03741572796584196 },
+  { 0.6428352363912533, -0.35302269011467713, -0.6798072073154257 },
+  { -0.3356523255147524, 0.15434721110284677, -0.9292547846534405 },
+  { 0.17663242472854104, 0.07051604553116174, 0.981747663026077 },
+  { 0.4330009094522877, 0.11940120165562292, -0.8934503710093163 },
+  { 0.1041669411156032, -0.9828936510852168, 0.1518858750344829 },
+  { -0.6044243828208604, 0.7494238693273265, 0.2702499390084673 },
+  { 0.8661065522014669, 0.36233540123835173, -0.34434357441824043 },
+  { 0.479057017404807, -0.24685034084614507, 0.8423593552037946 },
+  { -0.9368112582276191, 0.11700941874170577, 0.3296869156999005 },
+  { 0.24638142886984551, 0.13103943031304804, -0.9602733252628051 },
+  { -0.6017395778355382, 0.3431195890636686, 0.7212339620865671 },
+  { -0.9531344353772492, 0.2793387698415292, -0.11620929292235493 },
+  { -0.7463186797416038, -0.5706675314744105, 0.34255947919982027 },
+  { 0.1669902095713047, 0.9202013049950274, 0.35403930317519855 },
+  { 0.24869651556313532, 0.8484358264539567, 0.46723301631642716 },
+  { -0.8874090313358299, -0.3136763041277707, 0.3378052505991377 },
+  { -0.8920599708446928, 0.43857472918185764, -0.109000987791974 },
+  { -0.992879929874703, -0.04336458003423263, -0.11094574372394582 },
+  { 0.02145864077501645, 0.9361955835797875, 0.35082382476364105 },
+  { 0.05468700035803503, 0.3779479358077532, 0.924210306050792 },
+  { 0.9790797971059413, 0.19427813775034122, -0.06048765238664978 },
+  { 0.023693571189866893, -0.9551470885915091, 0.29518240774042503 },
+  { -0.5252918970532124, 0.4792579132778409, 0.7031218069799903 },
+  { -0.6482256056318031, 0.6812292591822474, -0.34019150582765645 },
+  { -0.275314126872877, -0.4608304560918765, -0.8437045823523649 },
+  { -0.44982770754132717, 0.8256972559598685, -0.34041015705830163 },
+  { -0.610014140769789, 0.5113468984886678, 0.6053157006611642 },
+  { -0.4662415646928718, -0.5742541938467204, -0.6729419917067117 },
+  { -0.9730794678796791, -0.2278312987025743, 0.03477425085460344 },
+  { -0.0813625135349045, 0.9389673859298437, -0.33424600154879686 },
+  { 0.7110866037252822, -0.5676066594707863, 0.41494399878400245 },
+  { -0.5033129065595381, -0.30746086935886496, -0.8075542903753783 },
+  { 0.9229344447818343, -0.32577203466205035, 0.20509654328485205 },
+  { -0.12493900951088485, -0.824964930446872, 0.5512015125480214 },
+  { -0.38027592686739253, -0.40691613602980603, -0.8305476974164204 },
+  { -0.8002018699796121, -0.5687190970192837, -0.19035639197752885 },
+  { 0.8432228030441092, 0.3925226680837084, 0.36728906799261285 },
+  { -0.4891223685042864, 0.87032225311924, 0.05743243294695492 },
+  { -0.240290858252518, 0.11199997630413976, 0.9642179778183667 },
+  { -0.2860930648730372, 0.5888337865382555, 0.7559269343412578 },
+  { -0.31652665032651406, 0.057302238421179263, 0.9468512729594859 },
+  { 0.5722992747542036, 0.742219059423493, 0.3486895581234375 },
+  { -0.0384671299901618, 0.9733349558116698, 0.22614009751792088 },
+  { 0.5898763930050183, 0.8024127765153442, 0.09044101425971318 },
+  { -0.3460198908518937, -0.8586052305952434, -0.378242373524348 },
+  { 0.006323261535706934, -0.18050037474654337, -0.9835545897813239 },
+  { -0.2703111549239097, 0.9305793858036236, 0.2468884084785124 },
+  { -0.4215103757689198, 0.9064739263847738, 0.02517983128846594 },
+  { -0.07976906614775797, 0.5338005432780785, -0.8418395785908042 },
+  { 0.26429845794962376, 0.9428886278711627, -0.20274950198875247 },
+  { -0.6363171451391032, -0.7544699931179523, -0.16085869664590305 },
+  { -0.09491494068055183, 0.9952762938652258, 0.02040227696871675 },
+  { -0.12147539681817608, 0.912518531122184, 0.39058118020006855 },
+  { 0.6036169665436186, -0.1289948166675596, 0.7867699123464131 },
+  { 0.18609929606919487, -0.9369136974518086, -0.29590501099124855 },
+  { 0.1708696702971766, 0.2834061903116313, 0.9436548559010236 },
+  { 0.01617601581909669, 0.7308618056446414, -0.6823337581873513 },
+  { -0.5051331382095811, 0.8139088844148443, -0.2870415310597471 },
+  { 0.8897437198439836, 0.1667464713745237, -0.42491378805863184 },
+  { 0.4153135952507312, -0.9054772001586655, -0.08732501126673697 },
+  { 0.8375875931600288, -0.20448915848633517, 0.506587808623481 },
+  { 0.7065710979047263, -0.06146420291909495, 0.7049676839155324 },
+  { 0.23982489027593365, 0.7040535581493041, 0.6684254702369149 },
+  { -0.3855722051562563, -0.9226727866579674, -0.0030005619078307885 },
+  { 0.09980859353216938, 0.9692197244471938, -0.2250585932588133 },
+  { 0.7760270300645299, -0.1823160375742755, -0.6037738906680552 },
+  { -0.9847905494662083, -0.01907071532048601, 0.17269592206884554 },
+  { 0.6792515528260825, -0.3916683187691826, -0.6206555051362048 },
+  { 0.6707608008921226, -0.662983864070185, 0.33246404913783467 },
+  { 0.5044549149742693, -0.8399947335610137, 0.1998351479296481 },
+  { 0.2794650759562989, -0.9540973293794663, -0.10769195602137634 },
+  { -0.094493550773486, 0.31545215446186303, 0.9442250299094954 },
+  { 0.3844725601556173, -0.21058482369757014, 0.8987963520818543 },
+  { -0.5760787257246028, -0.6839942996895422, 0.4475322332075427 },
+  { -0.9680560998301412, 0.10310656684581385, 0.22855288984155403 },
+  { 0.3285888761147128, -0.37266787169107674, -0.8678410038151649 },
+  { -0.9126921950312428, -0.358768854202346, -0.1956473009867189 },
+  { 0.012775172182671204, -0.28602191053424975, 0.9581379137003404 },
+  { 0.6649051966170426, 0.4560261060730796, 0.5915583403954984 },
+  { -0.4837471662777902, -0.7175789167292028, 0.5010680366815985 },
+  { 0.3422167073126302, -0.1454933306538727, -0.9282884336085119 },
+  { -0.008306783317322033, 0.7134060966641275, 0.7007016045317526 },
+  { -0.2984122890331085, 0.829622116799877, 0.47188690283849993 },
+  { -0.27183425540211587, -0.8975160208775457, 0.3472335379224108 },
+  { 0.6781027210298339, 0.723867678333905, 0.12724890567473426 },
+  { 0.892135320665429, -0.010416926179579655, -0.45164815650034645 },
+  { -0.9764620061943007, 0.2139819652963932, 0.02708632472106243 },
+  { -0.7865576823255852, -0.4212621433224528, -0.4515143618734369 },
+  { -0.6444555400252701, 0.66311083197337, 0.38073754930440296 },
+  { 0.2492419756297279, 0.6969001122509647, -0.6724646244441287 },
+  { 0.232052853681027, 0.704140723086163, 0.6710717660505375 },
+  { -0.49764915347236144, 0.0050723016775212374, -0.8673635868561316 },
+  { 0.9707490460024579, -0.16904673222613803, 0.1704977771379504 },
+  { -0.8269361781291835, -0.05231449739551994, 0.5598569019520555 },
+  { -0.29933934945854207, -0.10234764521928093, -0.9486416148281737 },
+  { 0.3138307128538635, -0.044742932957076924, -0.9484241422591657 },
+  { 0.20228417007877583, 0.9281273685967362, 0.31250712343439363 },
+  { 0.8779303756088375, -0.44575483092446017, -0.17475950987237115 },
+  { 0.23592593444416265, -0.11679501705156567, -0.9647268408459325 },
+  { -0.0005810794001341374, -0.9669161218232046, 0.25509385665888634 },
+  { 0.3576214475040818, -0.38009492644559517, -0.8530150919974411 },
+  { 0.17336447040370304, -0.43156687313262243, 0.8852653807848665 },
+  { 0.027034672609855287, -0.5864066258828611, -0.8095655597896665 },
+  { -0.28808361433748975, 0.9527986486825187, 0.09582570750594395 },
+  { -0.9527578923595041, -0.3030229393101068, 0.02072430453692043 },
+  { -0.9760428879572461, 0.029897931475397457, -0.21551425605182334 },
+  { -0.17545835074815058, -0.35456123697178205, -0.91842293982118 },
+  { 0.5929941673695268, -0.8020845963264119, -0.07083938030233268 },
+  { -0.9065474890308365, 0.38569706811790155, -0.17149175425407526 },
+  { -0.6031763415978121, -0.7013678390672233, 0.3798176605410194 },
+  { -0.6268021527649851, -0.6432197956811868, -0.439758292398259 },
+  { 0.9469493995620999, 0.3156497998540333, 0.06043209843359269 },
+  { 0.30576918958954086, 0.8180904276038748, 0.4870659657178527 },
+  { -0.004900873388957252, -0.09381671916003882, -0.9955774227281732 },
+  { -0.14146476294755997, -0.7083415468453362, 0.6915489670709856 },
+  { 0.13553650362254888, -0.7237137834939874, 0.6766596011042723 },
+  { -0.7827255990392908, 0.09325753063910085, 0.6153402876357765 },
+  { -0.5853453893844073, 0.7950887758782688, 0.15875960946919976 },
+  { 0.519184198977855, 0.8483770787645384, 0.10346061936152907 },
+  { -0.7323156625925256, -0.6331306970043732, 0.25071755190338535 },
+  { 0.9107302419643811, 0.15830494258229033, -0.3814576929693743 },
+  { -0.5908428807744546, 0.6499809307154828, -0.4779429672506735 },
+  { 0.6611350407673239, -0.6348805806646504, -0.39978382429071024 },
+  { -0.759005762924318, -0.2325398053647499, 0.608141012240252 },
+  { 0.5894568280577119, 0.1770040333544404, -0.7881689032386403 },
+  { -0.07256219476814568, 0.7223533803495584, -0.6877065666314348 },
+  { -0.740426023644399, 0.424238716977154, 0.5213356064261505 },
+  { -0.7956170657422639, 0.5534727413859227, 0.2462953699167356 },
+  { -0.9160738480344623, -0.382331836852795, 0.12095896608395947 },
+  { 0.8222505132836138, 0.24952838920468026, 0.5115072593675982 },
+  { 0.9268187647405117, 0.2843401830936933, 0.24527053961517056 },
+  { 0.4431412474046082, 0.8087198494058427, 0.38677905841149 },
+  { -0.7682486819590536, 0.3731493598086832, 0.5201475924605887 },
+  { 0.8560699138038885, -0.22887083392584348, 0.46342469081598553 },
+  { 0.9002306733638431, -0.15175471917030467, -0.4081117983401408 },
+  { 0.1492550598663225, -0.986801438972305, 0.06281597843294869 },
+  { -0.7777023004370858, -0.4262212607590262, 0.46207636681813863 },
+  { -0.02823642653660794, 0.09086995449053828, -0.9954623828087781 },
+  { -0.8836019319959688, 0.42008114197126784, -0.2068319606180508 },
+  { 0.5694287764064441, 0.8156212789219464, -0.10253193634175035 },
+  { -0.4477719892068664, 0.8407319646690128, -0.30441749172067567 },
+  { 0.8554115346301894, -0.150776700966703, 0.49551739915690335 },
+  { 0.3505577761769865, -0.14410073011759533, -0.9253886886824486 },
+  { -0.6709176324724968, 0.6672656702428642, 0.3234595117674557 },
+  { -0.2809608811722335, 0.27314193271660553, -0.9200296016122304 },
+  { 0.3399763985981477, 0.7642625643204738, 0.5480134863071592 },
+  { -0.37752508618919645, -0.8897161330007587, 0.25667101896399636 },
+  { -0.48441141019910255, 0.5582165821393091, -0.6736021326373787 },
+  { -0.24539586970261545, -0.610568294855317, -0.7529855406648707 },
+  { -0.835449746085814, -0.4003403658413592, -0.3764987559649507 },
+  { 0.3791413324733552, -0.1257117645590666, -0.9167597298429805 },
+  { -0.28981975674038146, -0.38798451305567194, 0.8749128677942161 },
+  { -0.0864420859794464, -0.6817276568024425, -0.726481360891092 },
+  { -0.24265636407831828, -0.7845203635243934, 0.5706537375570621 },
+  { 0.36577247811096314, -0.3712155209399953, -0.8534691155922474 },
+  { 0.35734083639079306, 0.007179954981576986, 0.9339464518343602 },
+  { 0.3560575227029859, 0.8047715856838357, -0.47493761211609414 },
+  { 0.28623159779129503, -0.7915343067412908, 0.5399489917366516 },
+  { 0.19928812998237377, 0.577781090026417, -0.79148799943904 },
+  { -0.5429090064072952, 0.6217588806033595, 0.5645048318240518 },
+  { -0.6218639929874127, 0.01539267309374784, -0.7829739713686401 },
+  { -0.06921688373026649, 0.7527336105666481, -0.6546763586154372 },
+  { 0.6962694600970919, -0.7138077336511748, 0.07541457628255656 },
+  { -0.4604691756026016, 0.39341631884603717, -0.7957334593854236 },
+  { 0.18182132374900736, -0.904083930243683, -0.3867470146042422 },
+  { 0.07134446962607091, 0.19770882684512872, -0.9776610795369209 },
+  { 0.9943751348798882, 0.1039708391772331, -0.020202864484675627 },
+  { 0.11863198242245986, -0.0429529591529596, -0.9920088185326384 },
+  { -0.45232714368912796, -0.7179378501577438, 0.5291175657572823 },
+  { 0.9695992940833188, 0.23574316393318467, -0.0655924505709412 },
+  { -0.17086549622995262, 0.39815879522720443, -0.9012627563487315 },
+  { -0.3419833333764446, -0.4538048632048129, -0.8228660558222076 },
+  { 0.005645713545803247, -0.8320370338127536, 0.554691355875169 },
+  { -0.6840606887696413, -0.48246093918261856, 0.5470762435374336 },
+  { 0.6343450240455636, 0.6780301906943255, -0.37132391651447627 },
+  { 0.006416179562508337, -0.4343260011544105, -0.9007329001213626 },
+  { 0.7316533395587256, 0.6753723134388235, -0.09249664292749106 },
+  { -0.2911764892590149, -0.3674885431354482, 0.8832714321016958 },
+  { 0.47240185065037965, 0.5033993474122156, 0.7234815744212507 },
+  { 0.2678424911659144, 0.05661216290552282, -0.9617980364594199 },
+  { -0.306466889319291, -0.5884739799605165, 0.7481820772114146 },
+  { -0.7537280409091309, 0.15499634403839763, -0.6386471433287821 },
+  { -0.9135144497846892, 0.09124833951009594, -0.39644052589414563 },
+  { 0.8005176643419961, 0.265768652855768, -0.5371577908172471 },
+  { -0.25828990416986597, -0.8898269092950593, 0.3761574097347062 },
+  { -0.04615329921496099, -0.20455598047124685, 0.9777661907762106 },
+  { -0.5157514205459259, -0.8302339940495393, -0.21145209227957243 },
+  { -0.7740488898617787, 0.3322519600675058, 0.5389405821934814 },
+  { 0.3132071547250125, 0.9409402311423006, -0.128579779308163 },
+  { 0.01241684435310946, -0.4961564056096655, -0.8681443676882364 },
+  { 0.783901710847674, 0.6011609873448721, -0.15525326091463673 },
+  { -0.7008703238964069, 0.565871224590518, 0.4342471027672762 },
+  { -0.01300055869281382, 0.8783177452865017, -0.47790053754783607 },
+  { 0.609415094025833, 0.03348434582559522, 0.7921439526740812 },
+  { -0.2350145824799993, 0.11224577073671609, 0.9654890123525344 },
+  { 0.1324190551345394, 0.12253703609464837, 0.9835902951038173 },
+  { -0.6609845007603856, 0.49528811364879033, 0.5637279257166231 },
+  { -0.699937902384786, 0.43463885873893976, -0.5667239145115526 },
+  { 0.7081800033424988, -0.2505045778797439, 0.660097371095439 },
+  { -0.4606014186466743, 0.49319114166412764, 0.7379761723285552 },
+  { -0.025225211261477386, 0.8601302428178269, -0.5094503450847393 },
+  { -0.8139268299275543, 0.500298712381114, -0.29533762698627053 },
+  { 0.8940427826301697, -0.35666600370884427, -0.27106616281872165 },
+  { 0.45035750720581696, -0.2551408099807989, -0.8556174862552216 },
+  { 0.13533180267788417, 0.35141407325196444, 0.9263873122535828 },
+  { 0.5152574264531322, -0.8088514016401022, -0.283318186055426 },
+  { 0.9142660305797947, -0.1990644421210244, -0.35283278363966003 },
+  { -0.501011974039062, 0.861151169495376, -0.08605617436435653 },
+  { 0.9497457340091527, 0.21299645558572142, -0.2293807983230846 },
+  { -0.24370582071040064, 0.29278942862865465, -0.9245981956694357 },
+  { 0.9415675822371613, 0.14046336062882242, -0.3061380936782027 },
+  { -0.4516033570761283, -0.19704391759217862, -0.870188544177351 },
+  { 0.8809436332817719, -0.37687428161787034, -0.2861889076035703 },
+  { 0.9738938686127194, -0.03523958077217077, -0.2242518776410867 },
+  { 0.7465225967363616, 0.5805436997160844, 0.32507387665261644 },
+  { -0.725789190877791, 0.4495702074728574, -0.5206886583725185 },
+  { 0.44167382782015746, -0.6310363217570708, -0.6377439850300405 },
+  { -0.5457226389451717, -0.8318197686906815, 0.10130485555045632 },
+  { -0.474646083799479, -0.052875081874035224, 0.8785871162557712 },
+  { -0.9199428043548381, -0.29155110414937946, 0.26211293441002464 },
+  { -0.0015970571983380318, 0.09475872710138988, -0.9954989869640398 },
+  { -0.7241196831980141, -0.3870669778055451, 0.5708150655840202 },
+  { 0.6396103109778252, -0.7470707314643181, -0.18106344821696777 },
+  { -0.23018171317374192, 0.7232060582823648, -0.6511446660950898 },
+  { 0.9377369120352504, 0.06636950747281453, -0.3409465827434101 },
+  { 0.7496322146898072, 0.6334000420288441, 0.1919789818108043 },
+  { -0.7846969259081187, -0.2609017697816334, 0.5622997430153778 },
+  { -0.458595562088625, 0.8763793411342342, -0.14713721781297803 },
+  { 0.8541305895651746, 0.24773484632409828, -0.45726183077731575 },
+  { 0.45733385672702126, 0.4697210142765072, -0.7551211242166634 },
+  { -0.5581884086647628, 0.6646565395346681, 0.49664613648562694 },
+  { -0.044262504499427736, -0.5359912654227578, -0.8430623903875377 },
+  { -0.7045069480295063, -0.39316210038123656, 0.5908413687293443 },
+  { -0.21778459126437194, -0.9103082555726626, 0.3520067494297043 },
+  { -0.9180471505985918, -0.39278862987020285, 0.053912164884145485 },
+  { -0.6525724962855456, 0.3537981697749845, 0.6700567081639605 },
+  { -0.2935773923681616, -0.5990056152539371, -0.7449863002663625 },
+  { -0.1503483506796075, 0.5908054906987393, 0.7926816798741747 },
+  { -0.04114575987232547, 0.910726270344765, -0.41095582116383617 },
+  { -0.8374822531556352, -0.17454118521511042, 0.517840564568927 },
+  { 0.6721271452794582, -0.49066060431756503, -0.5545243655144544 },
+  { 0.46795581481905973, 0.20956608721431405, -0.8585449379425124 },
+  { -0.3246716445123222, -0.8419361932248226, 0.4309660889069561 },
+  { -0.7039966210778258, -0.2960424318862901, 0.6455599399233626 },
+  { 0.3453411781936666, 0.937462108996315, 0.04363788308329556 },
+  { -0.5414313667234868, 0.632532629193213, -0.5538542661511767 },
+  { -0.6796871685953174, 0.650557718512661, 0.3388214983298462 },
+  { -0.1296561562304792, 0.6638825592880139, 0.7365115264710623 },
+  { 0.8677982725436977, 0.3051598321032783, 0.39217806547647877 },
+  { -0.7742827474715884, 0.4369166932161106, -0.4578100371955027 },
+  { -0.33786739207302285, -0.19235727573905292, -0.9213274682999656 },
+  { -0.8253849604643337, 0.5628985703771272, 0.04341504931100183 },
+  { 0.7701854716913626, -0.23567973762537503, 0.5926798465178207 },
+  { 0.3526272676051012, 0.5445221062553192, -0.7610188472965905 },
+  { -0.5787408851915955, 0.8154248326368978, -0.011888234803188702 },
+  { 0.4531430272286886, -0.40758896629035485, -0.7928004991373176 },
+  { 0.10695039324347881, -0.45474327508868473, -0.8841776784937981 },
+  { 0.6715162202888675, 0.1600828141245907, -0.7234911599397086 },
+  { 0.43766177664228245, 0.7202632140388712, 0.5382128498732784 },
+  { 0.3125944948478699, 0.9117339433062871, 0.26650684496645316 },
+  { 0.7238779459551383, 0.2039092805507432, 0.6591067627213728 },
+  { 0.8814903845799709, 0.4639122010995174, -0.08809183596710934 },
+  { 0.8536978909343431, 0.33039624437875376, -0.40253972811968414 },
+  { 0.5577229454529066, 0.522123608509104, 0.6452379821064211 },
+  { 0.9799746879324248, 0.16764428281010438, 0.10744768705203601 },
+  { 0.4034554903555658, 0.8368618249733353, -0.3699810173566324 },
+  { 0.5706346918649184, 0.7140299844850184, 0.405631889397954 },
+  { -0.16758736604922053, 0.09421578290329313, -0.9813449245767789 },
+  { 0.10109902956286153, 0.37334427345713866, -0.922167576798387 },
+  { -0.16333784845084592, 0.9386843157859818, 0.3036321830123609 },
+  { -0.5883590598957193, -0.7104408757972991, -0.38614424589134044 },
+  { 0.3099625922972376, 0.9230114736496239, -0.22797589979540853 },
+  { 0.9195637811221659, 0.39166605492240397, 0.03162520940367237 },
+  { -0.16612568626050483, 0.9566028942976501, -0.23940166871982116 },
+  { 0.5101205869633485, -0.27744263360398125, 0.8141268769762215 },
+  { -0.38821184194075553, 0.8440984509225348, 0.3698504710381523 },
+  { -0.0363032863442327, -0.925426146808915, -0.3771849920171974 },
+  { -0.7425798667095698, -0.26831396736436114, -0.6136633902024743 },
+  { -0.5773810228936759, 0.21924873977449044, 0.7864865825362504 },
+  { -0.9475388469286251, 0.31749992776665975, 0.0369314152089691 },
+  { -0.8705391162171867, -0.4444783639924141, 0.2111886149356222 },
+  { 0.823647788344739, -0.003696803358818397, -0.5670896352427421 },
+  { 0.7931755023117459, -0.1009160452902454, -0.6005735378248751 },
+  { 0.027350297686149796, -0.37411300049269186, -0.9269797322912913 },
+  { -0.7999179125180077, 0.1915719325024358, -0.5687104077736886 },
+  { 0.8046108491492195, -0.3732632578301705, -0.4618180613460018 },
+  { -0.668708951183099, -0.23776318264287963, -0.7044835041270507 },
+  { -0.35812580743639666, -0.9222479470841422, -0.14561809690802247 },
+  { 0.7667899216104791, -0.5578327641007808, -0.3175780587702464 },
+  { -0.6909967146707927, -0.31652509562918185, -0.6498733754748753 },
+  { 0.17314996925838225, 0.9832245842775018, 0.05734548821097547 },
+  { 0.05917265336159759, -0.7745277663223399, 0.6297660964912887 },
+  { 0.8448968455803985, -0.44988686201554307, 0.2893978778673056 },
+  { 0.6614480389192008, -0.6693282836122069, -0.33835800650595005 },
+  { 0.789025291944014, 0.380403527959253, -0.48242330435916675 },
+  { -0.18386597986460662, 0.4648408016416194, -0.8660925646705464 },
+  { -0.7569971921821027, 0.2551009346695174, 0.6015635994299782 },
+  { -0.11614570747407553, -0.3891175986441109, 0.9138367846945029 },
+  { -0.16676629096261167, -0.04918192309744819, 0.9847690808707442 },
+  { 0.020479724230082097, 0.839668693433366, 0.5427126920971757 },
+  { -0.47210884609982356, 0.747625254765982, 0.4670864115668467 },
+  { -0.7710829523366549, 0.11071960341244276, 0.6270344887133238 },
+  { 0.16828084603011617, -0.9856449553192519, -0.013622735154818929 },
+  { 0.4603073349006466, 0.11523960152392426, 0.8802482557081672 },
+  { 0.44883385715350593, 0.8455988213657698, -0.28898235582389303 },
+  { -0.9228365522075245, 0.3447692993725801, -0.1717755166485293 },
+  { 0.7723637803310971, -0.2529826774285479, 0.5826267722596862 },
+  { 0.9717075398182323, 0.11765068867754383, -0.20479934695720592 },
+  { 0.9795172749974232, -0.043877429984111704, 0.19652144697109186 },
+  { -0.10880001018416745, 0.6444765630581285, -0.7568437866909572 },
+  { -0.2427117392300113, 0.7193749213696301, -0.6508384854511767 },
+  { 0.35383850098381214, 0.5964871620512708, -0.7204175044580398 },
+  { -0.6772616895405977, -0.06754361863342889, -0.7326352867986341 },
+  { -0.21311112935706486, 0.8949486761919954, -0.39198279748778686 },
+  { 0.1648993173573263, 0.08586473329848943, 0.9825657549043052 },
+  { 0.7262851274235874, 0.06740026767937889, -0.6840812214935091 },
+  { 0.02195781290764652, -0.7520550920868933, -0.6587343872293956 },
+  { -0.3674674692652252, 0.8332641647890073, -0.41308412062228766 },
+  { -0.1558769705370277, -0.25873456334037254, -0.9532884116516184 },
+  { -0.6640026220679145, 0.049137487124792115, 0.746113949236975 },
+  { 0.9183152504921438, -0.31175681523557, 0.2439360343773056 },
+  { -0.8698873173678812, -0.1336077960614582, -0.4748105010571176 },
+  { 0.9762672587808037, -0.16900970824054773, -0.1354177165405631 },
+  { -0.2089976641834638, -0.0759019649975751, -0.9749660856026546 },
+  { 0.312493930151024, -0.43864888713791883, -0.8425762264812795 },
+  { -0.1703697622544048, 0.24754580840383605, 0.9537794382618389 },
+  { 0.8551693678912988, 0.4619677822423099, -0.23509810801135364 },
+  { -0.2426348745477787, 0.1479344269760129, -0.9587719869543865 },
+  { -0.5691934613217441, -0.7832262552382636, -0.2501508278899322 },
+  { 0.07096720698046051, -0.9965607788745519, -0.04278164959814996 },
+  { -0.49491267486106344, -0.4072871864336348, -0.7675796975095426 },
+  { 0.22394725419167633, -0.8398022032187862, -0.4945501863399519 },
+  { 0.9344495173103621, -0.254772146531096, -0.2487875659078823 },
+  { 0.6975573418922094, -0.5941670416867975, -0.40047382104881063 },
+  { -0.7558978941660239, -0.6398236856985821, -0.13872283450986955 },
+  { -0.43239628021017423, -0.5024219518636905, -0.7487360276799053 },
+  { -0.34406881797977745, -0.5523381783887888, -0.7593017747826968 },
+  { 0.5011469491418199, 0.01220020662704805, -0.8652761930875617 },
+  { 0.3274880608186487, 0.7241231608717333, -0.6069573443911611 },
+  { 0.10793257607068941, 0.6519880612642227, -0.7505079126775845 },
+  { 0.6044250694264234, 0.7052602895441197, 0.3705108088045583 },
+  { 0.9819510452214386, 0.011797933075673476, 0.18876692921077562 },
+  { -0.25612867528632977, -0.9649498929391959, -0.05718221587787827 },
+  { 0.7459577565893801, -0.4075548295369986, 0.5267315125424025 },
+  { -0.32136681360633274, -0.4975446917798044, -0.8057125112558771 },
+  { -0.39201418812000444, -0.24844211285312381, 0.885777281755233 },
+  { 0.8456878760610017, -0.4517990128897323, -0.2840592688776328 },
+  { 0.269950865354651, -0.3307848631810512, -0.904272030190345 },
+  { 0.3733198301967363, -0.12950842423959813, 0.9186184585739916 },
+  { -0.7584313097655433, 0.49239350324498427, 0.42700185752459474 },
+  { -0.8142207763724617, -0.4514044498253426, 0.36507334879624587 },
+  { 0.5647858967511004, 0.7703222884147979, 0.2960075384216498 },
+  { 0.08428946352751907, -0.9132722455991386, 0.3985336770670076 },
+  { 0.7671360599333354, -0.5943840464368974, 0.24126721884926278 },
+  { 0.1564187223886557, -0.1598946939972925, 0.9746624390617569 },
+  { 0.9291807075579557, 0.19688349306701827, 0.3128259945398179 },
+  { 0.7278165734023079, -0.16655061798756515, -0.6652397516150724 },
+  { -0.6997812646649738, 0.7134800822440598, 0.03538861207930536 },
+  { 0.8387620447476671, 0.5020138488946816, -0.2108561780187156 },
+  { 0.13727270252461174, -0.7911242592865781, 0.5960525241200246 },
+  { 0.5035355017723896, -0.10229016239148907, -0.857897850057191 },
+  { -0.069863759481821, 0.8888506042103211, 0.4528395505099055 },
+  { 0.19763171145035033, 0.43924045252638183, -0.876361530131044 },
+  { -0.03420175208839992, 0.9591148478504149, -0.2809429635832851 },
+  { 0.9556336745570809, 0.2731154531133706, -0.11032782660421307 },
+  { 0.3238600250542947, 0.07354321402274608, 0.9432423229706332 },
+  { -0.8594428892144986, 0.331888608515109, 0.3888545637080008 },
+  { -0.422569081106577, -0.020321568256893376, 0.906102866983834 },
+  { 0.7739151618907086, -0.541153201435913, 0.3289506570465251 },
+  { -0.2847006656052786, -0.753582682863095, -0.59250204311274 },
+  { -0.4829572601736283, 0.301973276547486, -0.82192726265574 },
+  { 0.7970381094445963, -0.5870766637341273, -0.1416730143386175 },
+  { 0.13171284443365194, -0.9852120763637164, 0.10958508656879841 },
+  { 0.5972689853744882, -0.6528523934888653, -0.46589002074050606 },
+  { -0.22742840166563116, -0.8545027029174159, -0.4670133325962404 },
+  { 0.9674261799769573, 0.2491041884069413, -0.045096447901256616 },
+  { 0.21698890606673904, -0.42904624608650677, 0.8768324431515045 },
+  { -0.25623618806925264, 0.5538269507952518, -0.792223910581202 },
+  { 0.9158028590861481, -0.3694211815213517, -0.15758525925036682 },
+  { -0.15146766412506724, -0.2608260606303025, 0.9534292384967925 },
+  { -0.39022671338202336, -0.6543395481583506, 0.6477367272889424 },
+  { 0.9872253530516726, -0.1161098376225076, -0.10910823937391417 },
+  { 0.20588329555412055, 0.8757289472865409, 0.43670456775282473 },
+  { 0.6487356392592135, 0.7168042609373751, 0.25560462017921903 },
+  { -0.5742001265758132, -0.4834258418597839, 0.6607523515376086 },
+  { -0.7402548659160272, -0.6285395736512609, 0.23866448802018256 },
+  { -0.17124767920276962, 0.9313239168950626, -0.32141872096519836 },
+  { -0.13694785715487964, -0.5885362456242762, -0.7967875325374816 },
+  { 0.46621149457362215, 0.4992293058040486, 0.7303539844170341 },
+  { 0.012996029921419005, 0.11510769358971118, 0.9932680011370238 },
+  { 0.7696645358035364, 0.6377220439515017, -0.030448267350469575 },
+  { -0.2785310018776764, -0.2785310018776764, 0.9191523061963321 },
+  { -0.8242483702624798, -0.3447469341561053, 0.44918167316756386 },
+  { -0.6271436097817986, -0.7119359855941336, -0.3159715891120031 },
+  { 0.7228249836702664, 0.4200850905837575, 0.548682567293071 },
+  { 0.9124358799110261, -0.08894991103976281, -0.39943544957478394 },
+  { 0.8897442943201306, -0.12413730368986671, -0.439255074594913 },
+  { 0.9127894480876286, 0.3775744652953004, 0.1557335757531121 },
+  { 0.32876507889361045, 0.9443475392143419, 0.011011270584953459 },
+  { -0.9715936904949085, 0.1187434682208927, 0.20470879156830982 },
+  { -0.46929232533346177, -0.3450530923673685, 0.8128364391627806 },
+  { -0.8459827013719898, 0.4163673250600397, -0.33309386004803176 },
+  { 0.9498946754122161, -0.30770268588913435, 0.054946908194488275 },
+  { 0.5383058000309445, 0.739508623649068, -0.4041705842855288 },
+  { -0.23378812533130688, 0.961569238650799, -0.14397121842436414 },
+  { 0.8829492644192347, -0.24983773398357767, 0.39746912224660086 },
+  { 0.8007932443765277, 0.08189930908396305, -0.5933149946971545 },
+  { 0.9702564102564103, 0.05435897435897436, -0.2358974358974359 },
+  { -0.34120606393880315, -0.8396143174566622, 0.42264195231090423 },
+  { -0.35582932769122627, 0.8717260802216091, -0.33686663624686625 },
+  { -0.05895060523211584, -0.1168759825471514, 0.9913953958166264 },
+  { -0.36710646144562853, -0.25390182575754927, -0.8948556916295791 },
+  { 0.16628470059345674, -0.9413523008491504, -0.2936072956085303 },
+  { 0.5115745673123936, 0.6172825773948014, 0.5977070199721333 },
+  { -0.8776778134121582, -0.32391832009755517, 0.3532118029585515 },
+  { -0.3979377139632379, 0.8456954860126401, 0.35559066458999816 },
+  { 0.5176840151740032, 0.8553893904328979, 0.017670630100756115 },
+  { -0.11271209439982437, 0.928488974359209, -0.35384206684535024 },
+  { 0.24103193718443935, 0.12869578546499477, 0.9619464642383507 },
+  { -0.9338247382287176, 0.33988473928177587, -0.1115783235015931 },
+  { -0.8383937222372194, 0.2981225862817399, 0.45631008104347937 },
+  { 0.8337861110060072, 0.5314044527227128, 0.14969979532368227 },
+  { -0.7769497714203873, 0.513160639405493, 0.36471250438496533 },
+  { 0.13501554555187598, 0.9701520248929153, -0.20143448328304078 },
+  { 0.6264151375205324, -0.6132689646449703, 0.48114992724557154 },
+  { 0.6778907206321967, -0.2929305953397336, -0.6742817194575799 },
+  { 0.5314878457109826, -0.6004504744609536, 0.5974779473596616 },
+  { -0.5723822632542933, 0.519973833405157, 0.6340392395473949 },
+  { -0.5329445938874225, 0.32575919554602023, 0.7809295783637471 },
+  { 0.7415782349369157, -0.340077291577131, 0.5782812094659585 },
+  { 0.4136038037662326, -0.031020285282467447, -0.9099283682857118 },
+  { 0.38823927307414585, -0.8339954754926097, 0.39207373503043375 },
+  { 0.1914626317364729, -0.8869411317858464, 0.4203302147062303 },
+  { -0.4564496770420337, 0.6853854963684121, -0.5673626826784157 },
+  { 0.24621877040508436, 0.7242406923390772, 0.6440898513875392 },
+  { -0.11992479769968523, -0.9806045958248651, -0.155024738489837 },
+  { -0.7438355454584284, 0.32993185923456314, -0.5812517953302051 },
+  { -0.6335462987909153, 0.4679208495640398, -0.6161729999209633 },
+  { 0.054113281060104795, 0.051021093570955946, 0.9972304652505026 },
+  { -0.8904112127707564, 0.24739444012505188, 0.38205217335767505 },
+  { -0.7758068648717314, -0.11223601852205252, -0.6209080322915888 },
+  { -0.37536603859948725, -0.7035111896139644, -0.6034669362558921 },
+  { -0.5870208004022373, -0.7993811079086122, -0.1280485228884593 },
+  { -0.6300804267359589, 0.7685169886676788, -0.11126676940306461 },
+  { -0.773832644874388, -0.5500887012285984, 0.3139832137349753 },
+  { -0.5021192428200039, 0.05441420979057982, 0.8630847929159294 },
+  { 0.9673094372611479, 0.2437876400466563, 0.06985727697243367 },
+  { -0.08038065025763391, -0.9908031542173625, 0.10884879722387926 },
+  { 0.35319221926035427, -0.9326967549675924, 0.07302067876203805 },
+  { 0.4572527118694286, -0.8864687468683795, 0.071366086579398 },
+  { 0.8424375732922951, -0.032259065895059634, -0.5378273772996008 },
+  { 0.5517247882459412, -0.7483437732579937, 0.36821373556802556 },
+  { 0.0952593827584468, 0.5223563955655489, 0.8473897839886009 },
+  { 0.04897398549971977, -0.9980104072105056, -0.03970863689166468 },
+  { -0.3201735681614192, -0.8827807194090928, 0.34378348955461735 },
+  { 0.6524619096587535, -0.033014796457861456, -0.7571020272455348 },
+  { -0.21536868633712222, 0.7422527939832962, 0.6345684508147351 },
+  { -0.6859573516049111, -0.13597604201249067, -0.7148237739315851 },
+  { 0.020886856960628974, 0.7512066141357248, -0.6597365853771082 },
+  { -0.7867489293041153, -0.4321485273009968, -0.4407649856674277 },
+  { -0.8009723568127362, -0.11288872142998295, -0.5879620907811612 },
+  { 0.6224602450810084, -0.775767999017764, -0.10357246252583499 },
+  { 0.40471898423563585, 0.5383155421386613, -0.7392015428090193 },
+  { -0.8966184768963094, 0.4222101744559629, 0.13346863104867684 },
+  { 0.3953690177952137, 0.6087520023993952, -0.687825805958438 },
+  { 0.21631480697389663, 0.8228732184209717, -0.5254403588318638 },
+  { 0.8788377972910023, 0.30714736996641573, -0.36510905107298125 },
+  { 0.5519619503974836, 0.798836926941212, 0.23916013352673687 },
+  { -0.2114936275906109, -0.961051925374982, 0.17790346320857273 },
+  { 0.9206340059562483, 0.16155972806474553, -0.3554314017424402 },
+  { -0.2193440621166095, 0.9207939677028878, -0.32253162861362633 },
+  { 0.28137604814851824, 0.12595895296179155, 0.9512948342638532 },
+  { -0.8638182970756548, -0.46040755276686296, -0.2045552125772995 },
+  { 0.000570495027386555, 0.38052018326683223, 0.9247724393936058 },
+  { -0.7270917462823384, 0.4811741077547831, -0.4897030431950451 },
+  { 0.7293864497060938, -0.6820236932316721, 0.053283101033724384 },
+  { -0.9397631356053697, -0.3412167717939883, 0.020404989675388004 },
+  { -0.9340069662359426, -0.24328191921590653, -0.2616197523226331 },
+  { 0.6605484339857896, 0.14115680231214478, 0.7373944151673046 },
+  { -0.39649378666904395, 0.8266729786121988, 0.39925488546200383 },
+  { -0.6588851234211902, 0.04285431697048392, 0.7510219049077306 },
+  { 0.5878462084565453, -0.5076853618488346, 0.6298352233462986 },
+  { 0.059733374854718135, -0.03944656830028556, -0.997434655592935 },
+  { -0.8365165160139914, 0.38413718959063553, -0.39074126734864073 },
+  { -0.8415494884554148, -0.5016319859594823, 0.2003991246058109 },
+  { -0.9765881771915563, -0.001777769740033173, -0.21511013854401392 },
+  { 0.013911254134355552, 0.8855048304753246, 0.4644218687931007 },
+  { -0.42458148238269616, 0.8717696327125575, 0.24443459717872357 },
+  { 0.9440307786239358, 0.32757868018250574, 0.03870526192358137 },
+  { -0.23439358896071924, 0.929301640938381, -0.2854086642051111 },
+  { 0.5097132899616836, -0.06598539776239432, -0.8578101709111261 },
+  { -0.8187003106229063, -0.5548110595573469, 0.14803543352458212 },
+  { 0.7411407895247281, 0.6687400114279799, 0.05913651340726764 },
+  { -0.021779443888484813, -0.8666937523858809, 0.49836492191885834 },
+  { -0.6789603551160605, -0.6000384676837662, 0.42304452895692995 },
+  { -0.6121061585610384, 0.11912404823429419, 0.7817515665375556 },
+  { 0.17946395122027003, -0.4829211778290903, 0.8570763246155926 },
+  { 0.006372982797196546, -0.6086198571322702, 0.79343635825097 },
+  { -0.8665677889651894, -0.35820995236927383, 0.34748510349594225 },
+  { 0.8460870456824672, 0.13351373593216237, 0.5160530916928523 },
+  { -0.7337615750718528, -0.05607608785101965, -0.6770889330947585 },
+  { -0.17062748709617767, -0.0007685922842170166, -0.9853353083662152 },
+  { 0.9696128042496025, 0.2416385221946959, -0.03823394338523669 },
+  { 0.13621199476423104, -0.1237383688700707, 0.9829217204598357 },
+  { 0.4561001922465339, -0.8659171546525524, -0.20532923783792303 },
+  { -0.017213352994843854, -0.001967240342267869, -0.9998499039576444 },
+  { 0.9644747405190992, 0.23093057167358713, -0.12829476204088175 },
+  { -0.9185252604089148, -0.2426582306419547, -0.3121351135204933 },
+  { 0.20755317351228142, 0.26864151890774013, -0.940613318257786 },
+  { -0.6149137584033123, -0.6773127560272647, -0.4038916937114007 },
+  { 0.5048062542337394, 0.6899462788735541, 0.5187916517784736 },
+  { 0.7271970654404659, 0.25045979688567116, 0.6391043092944713 },
+  { 0.6825308144931587, 0.6102628458997654, -0.40215786226508665 },
+  { -0.3931149093179848, 0.03710298020529295, 0.9187404622263016 },
+  { 0.24561714301555643, 0.8473791434036697, -0.4707661907798165 },
+  { -0.3050133971834723, -0.5201053918954021, 0.7977826827275254 },
+  { 0.4241770749951977, 0.8069404118991482, -0.41099997651161907 },
+  { 0.5276768420450676, -0.4189308785225316, -0.738954714031709 },
+  { 0.16199482596517634, -0.8689333774386491, 0.46766704174398965 },
+  { -0.8539971867709772, 0.12332298358116484, -0.5054505383397038 },
+  { 0.4533111384955482, -0.7801383137041512, -0.4311533639051344 },
+  { 0.29043590576650635, -0.6776837801218482, 0.6755676715188136 },
+  { 0.8080285077307111, -0.5346436920182741, 0.2474793997074279 },
+  { -0.885275121777185, -0.07765571243659518, -0.45853849248275247 },
+  { -0.3075962560451978, -0.5603908802662512, 0.7689906401129946 },
+  { 0.23052756683418643, -0.2971244194751736, 0.926592747802966 },
+  { -0.09183063661880285, -0.6208847520644432, -0.7785045014847765 },
+  { 0.5793954711415824, -0.5840806097222421, 0.5684634811200431 },
+  { 0.05913252037491854, -0.9091625007643727, 0.4122218968443841 },
+  { -0.253364118160176, 0.963322721600499, 0.08840790506014652 },
+  { -0.13579008461481407, 0.516403671540081, 0.8455106746459359 },
+  { 0.5223747515956725, 0.7588758059937133, -0.38888575439677836 },
+  { -0.9295066532606532, -0.27651990043238067, -0.24403714104423957 },
+  { -0.08194231993876713, -0.0568579362840425, 0.9950138849707437 },
+  { 0.6519147759686421, 0.4048841768987636, -0.6411520320257637 },
+  { -0.9746810962987354, 0.156850993903087, 0.15935660083444622 },
+  { -0.5981509039984626, 0.13141707290566448, 0.7905346602108786 },
+  { 0.4598989067534622, -0.8365292092200858, -0.29784539225676865 },
+  { 0.32610821075684543, -0.9450248501862105, -0.024113635302442798 },
+  { -0.7809300578928813, -0.46015292920799883, -0.42238315120364284 },
+  { 0.12342067618195282, 0.14923826660776948, 0.9810684361810332 },
+  { -0.06677158947263735, -0.9960925922074781, 0.05780227148377562 },
+  { -0.7494188759683846, 0.4020061520095308, -0.5260821248519787 },
+  { -0.04993049226594689, 0.8875575435550215, 0.4579831359566163 },
+  { -0.20990618075262346, 0.2825660125516085, 0.9359999165772032 },
+  { -0.16511435354609302, -0.5603278262909582, -0.811646460804891 },
+  { 0.9987367468432454, -0.04823022923091452, 0.014098067005959631 },
+  { -0.8795507962028479, 0.03117810658181737, -0.4747823949652189 },
+  { -0.5275555649124379, 0.49068340177339653, -0.693480299038124 },
+  { 0.6813519365489787, -0.7018393229572384, 0.20780063356949094 },
+  { 0.5642537691861821, 0.8216730040083914, -0.08044351088194042 },
+  { -0.8138791314623606, -0.4499694291770755, 0.36759797629493324 },
+  { -0.30829965093028955, -0.21782040554857413, 0.9260159805116305 },
+  { 0.8059939703021185, 0.2794533452369735, 0.5218041276882471 },
+  { 0.6036507635815765, -0.6840364180283695, -0.4095118245402655 },
+  { -0.7651028513981287, -0.49036137294152793, -0.41732882803534294 },
+  { 0.11708263326643495, 0.9814630941671052, 0.15172953494731875 },
+  { 0.40889183721150124, 0.66856996296534, -0.6211454500214318 },
+  { 0.27131177438234794, 0.8144570765593175, -0.5128836042650924 },
+  { 0.27350448004472255, -0.043827289905746615, -0.9608717229968752 },
+  { -0.555800208727429, -0.7267640847533571, -0.40360883673572046 },
+  { 0.5040894641684588, -0.8607565378725569, 0.07065404888614515 },
+  { 0.2912815889619983, -0.6855278326268426, -0.6672380584362054 },
+  { 0.5607318519009973, -0.6344046499609823, 0.5320813193221142 },
+  { -0.0786680383733229, 0.30898530734582247, -0.9478076912448542 },
+  { -0.6472756957761278, 0.5002603957891208, 0.5751292985602818 },
+  { -0.823362977701214, -0.24783501001039887, -0.5105401206214216 },
+  { -0.48439261529871924, -0.5374016184823527, -0.6903356391615709 },
+  { 0.8421125916212171, -0.013149790624940929, 0.5391414156225781 },
+  { -0.9439544901863706, 0.0032438298631834043, -0.3300596885789114 },
+  { -0.9344333977328858, -0.3483986590685113, -0.07384171964843207 },
+  { 0.7682571492275487, 0.2110146303211667, -0.6043622907256717 },
+  { 0.1430380409068557, 0.1711951355735596, -0.9747986173612883 },
+  { 0.81021496548835, 0.22670384285890427, -0.5405155662251708 },
+  { -0.8774105386882763, 0.19244504749070165, 0.4394492579297981 },
+  { -0.4397696666151208, 0.055262061281000634, -0.8964088045686524 },
+  { -0.5190748839133779, -0.33332389999529494, -0.7870555524117977 },
+  { 0.1752183329156687, 0.2526992720373372, 0.9515469582327789 },
+  { -0.8081001566018718, 0.2822714919361299, -0.5170076805427379 },
+  { -0.9440738889057532, 0.25652670471739536, 0.2071679078747529 },
+  { 0.09493762930119765, 0.844000495044155, 0.5278731011406906 },
+  { -0.9659259226904751, -0.22635387051447328, -0.12550313612683667 },
+  { 0.919844504987103, -0.18027103364068853, -0.3484084400170999 },
+  { -0.1602811482453811, 0.9115680164915327, 0.3786207929140117 },
+  { 0.9596979929128758, -0.2732473452043605, -0.06569361261010757 },
+  { -0.677298278880183, -0.14131080635152962, -0.7220099012023466 },
+  { -0.14667247652375937, -0.3666811913093984, 0.9187121902806709 },
+  { 0.9957871455842638, -0.043648916485491504, -0.080639523676586 },
+  { 0.5605861636472359, 0.4322037484324036, -0.7063590255445555 },
+  { -0.7600532901647071, 0.6183149573009833, 0.2000140237275545 },
+  { -0.9169134469877532, 0.3948966129196293, 0.05767491515070592 },
+  { 0.09956050704116681, -0.39573736132086434, 0.9129510645661713 },
+  { 0.4194131410270641, 0.8836833024848303, 0.20783752799558614 },
+  { 0.4055225084630907, -0.34373930080250903, 0.8469916104741562 },
+  { -0.6949833367932206, -0.3568669875613578, 0.6242147985819004 },
+  { -0.3448444805067225, 0.641571126524135, 0.6851779140300722 },
+  { 0.022126919752389434, 0.8679284272874755, 0.4961961754473331 },
+  { 0.4094531881108806, -0.8591804602982412, -0.306850164392229 },
+  { -0.8918964932111072, 0.09799972566914496, -0.4414937136205925 },
+  { -0.22976507222774, -0.343255092752351, 0.9107051953754058 },
+  { 0.48814865455146583, 0.7272077559242728, 0.48257618132599245 },
+  { -0.26411920638160025, -0.7547116689139391, -0.6005425393970775 },
+  { -0.16652991063497402, 0.3554675156673146, 0.9197340018555447 },
+  { 0.41312460015395475, -0.1462210705999452, 0.8988589785167864 },
+  { 0.7386916964497765, 0.3100049640225516, -0.5985244354890848 },
+  { 0.3223980918719011, -0.8699957001468923, 0.3730508706373378 },
+  { -0.03628323200097152, -0.0960110139102631, 0.9947187603958653 },
+  { 0.6013670675377594, 0.7508252136260689, -0.27316505754653886 },
+  { -0.4738530067332282, -0.5518993843128188, 0.6861999691088674 },
+  { -0.8951203662027162, 0.3906385638041779, 0.21485121009229782 },
+  { 0.04237596696708972, -0.1695038678683589, 0.9846180560000259 },
+  { -0.7490344972299745, 0.5875080104123541, 0.30623791349334334 },
+  { -0.31587118496559646, -0.8371596650580733, 0.44653005465285805 },
+  { 0.23653628715878858, -0.9245952049026833, 0.29862064886424067 },
+  { 0.35906883128893974, -0.878572672302725, 0.31492798205247435 },
+  { -0.18746306259040124, 0.48819685786382433, -0.8523622634397398 },
+  { -0.5301003055016295, 0.1476896373536878, -0.834973914038885 },
+  { -0.2547339344387803, 0.920425349046374, -0.29652622055764266 },
+  { -0.930068490245703, -0.34481342198635373, 0.12679237938511662 },
+  { -0.25151645966961095, -0.6388306717238648, -0.727072790977699 },
+  { -0.762778333586011, -0.21614147179043475, 0.6094686849904701 },
+  { 0.671598107349728, -0.6056593840826637, -0.4267700700340544 },
+  { 0.016971875447547368, 0.2915169194519901, -0.9564150987500223 },
+  { 0.4253174756175903, -0.014328070987117405, -0.9049307991863624 },
+  { 0.046683116419988915, 0.9037372537715803, 0.4255345612129759 },
+  { 0.0016563301776622913, 0.9805474651760765, 0.19627512605298153 },
+  { 0.3128379360192747, -0.9485567594549116, -0.04870831427587423 },
+  { -0.29747276340883383, 0.6170977538800276, -0.7284918099650377 },
+  { -0.9319277097611796, -0.07673933688193942, -0.3544316830564151 },
+  { 0.1271517372011714, 0.8985389428882778, -0.4200716651238699 },
+  { 0.8976748210240622, 0.3744099411739601, 0.2323727859486338 },
+  { 0.561618082514468, -0.8245031424148572, 0.06913535666211536 },
+  { -0.8761043946905301, 0.31465028765540926, 0.3652893183249517 },
+  { -0.658034556844005, 0.7160758620704156, 0.23286451373969572 },
+  { 0.8280428059653567, -0.09508871452736871, -0.5525425303617372 },
+  { 0.6397093679145975, -0.22487470842511292, 0.734985231221027 },
+  { 0.3757421471969746, -0.8767316767929406, 0.3002655586770583 },
+  { 0.5220396997925182, -0.6856869103720087, 0.5072553723569878 },
+  { -0.4783573910163941, 0.12557914237390655, -0.8691398537983532 },
+  { 0.47221502402639715, 0.6646855041163643, 0.5789699056957311 },
+  { 0.23913624140009368, -0.5369595879144305, 0.8090044863879317 },
+  { 0.37529315523559675, -0.870574403764828, -0.31820630908708347 },
+  { -0.5803277522002475, 0.33433807813327693, 0.7425885465965356 },
+  { -0.9211003708461825, 0.3796154749140927, 0.08640716424448242 },
+  { -0.19180524038069985, 0.08246403646940917, -0.9779623880557339 },
+  { 0.4298438599198123, -0.6996615117489956, -0.570708353773052 },
+  { 0.1183407638669817, -0.7611723889502464, -0.6376613975356781 },
+  { -0.9934306117269689, -0.058876884796612454, 0.09812814132768742 },
+  { 0.6172891578798224, -0.7687204856380304, 0.16740044959452813 },
+  { -0.37942295494952233, 0.8917876649476462, -0.24648119990092074 },
+  { -0.8669557000802937, -0.486828970045088, -0.1067022400098823 },
+  { 0.6272093141632917, -0.28499971346499364, 0.7248335254054442 },
+  { -0.9913121912043621, 0.13103551952701337, 0.01139439300234899 },
+  { 0.47640241653050375, 0.09334527635723132, 0.8742581980774835 },
+  { -0.3791321588507818, -0.7893785070297432, -0.4828461232780473 },
+  { -0.3281397224582299, 0.3350398568089871, -0.8832171968969179 },
+  { 0.33363952741582054, 0.6242287932295998, 0.7064156562880424 },
+  { 0.30379817481775717, 0.1312708162792778, -0.9436496393104655 },
+  { 0.8139889127477082, -0.42000578809936095, 0.4012694704146311 },
+  { -0.7198731006650056, -0.21817012989479312, -0.6589267890749622 },
+  { 0.31632903917329686, 0.4446572497912672, -0.8379832153353463 },
+  { 0.04686918216158771, 0.9961450059418044, -0.07415124341982533 },
+  { 0.19711540148084816, -0.49728698796828086, 0.8448971358079509 },
+  { 0.7514272406897464, 0.6576426769589435, -0.05350898421450721 },
+  { -0.16400611544901653, -0.1282820110937852, 0.9780826753015606 },
+  { 0.33102373000975166, -0.6934334136796872, 0.6399792113521866 },
+  { -0.36904544015498275, 0.9292401069095767, -0.01784059448263038 },
+  { -0.6389034545637883, -0.7581654327490287, -0.1303363047310128 },
+  { 0.6775699292122427, 0.13074090517724743, 0.7237442965169055 },
+  { -0.8854105551555844, 0.41177776317615006, -0.21560895754287684 },
+  { 0.8221182479187609, -0.31556053960518093, 0.4738598234531747 },
+  { -0.7890168259513168, -0.6137526890719478, -0.027569639509114233 },
+  { -0.03790746398432229, 0.21999867490901331, -0.974763359596859 },
+  { 0.03474751340037992, -0.8650574977885627, 0.500467916886069 },
+  { -0.046564526921637345, 0.20403729069299273, 0.9778550653543843 },
+  { 0.49435417958693395, -0.7141963912150058, -0.49551736589184436 },
+  { 0.03995321800146475, 0.05438076894643813, 0.997720638425467 },
+  { -0.44741786098455133, -0.5341147475421115, -0.7173135256845748 },
+  { 0.008350061535548198, -0.07001205441344259, 0.9975111972851041 },
+  { -0.9112797350516315, 0.3381183592779404, 0.2350430164957507 },
+  { 0.5347052322527982, -0.43421098647479006, -0.7249490560212288 },
+  { 0.053514863022669217, 0.5839874372570892, 0.8099968102169058 },
+  { -0.8932745568160199, 0.4491635073582815, 0.017683602651900845 },
+  { -0.879938512592638, -0.1306778915300656, 0.4567619760022854 },
+  { 0.5421242909830678, -0.3289814073486993, 0.7732221457931576 },
+  { -0.37041477966273484, 0.8914377664410872, -0.2610203048997019 },
+  { -0.6157248007268951, -0.023214040960978087, -0.787619246890328 },
+  { 0.39178211900034504, -0.0018957199306468308, -0.9200560730072619 },
+  { 0.6106772993024526, -0.3952130172858634, 0.6862068981615287 },
+  { 0.01593399294298436, 0.07303080098867833, -0.9972023916817714 },
+  { -0.7846136099168366, 0.16668495617690574, -0.5971579426898492 },
+  { -0.16174159928708456, 0.14990684811973692, -0.9753807420422357 },
+  { -0.7900873107725932, -0.5297312943612288, 0.30845874461669737 },
+  { 0.38548570512396996, 0.07337663555979053, 0.9197916288480785 },
+  { 0.4886892324231649, -0.5973424736483973, 0.6358968495670282 },
+  { -0.4809817149671198, 0.8617299032261856, 0.16148734858519795 },
+  { 0.016466756883784687, 0.9791839361250537, 0.20230587028649757 },
+  { 0.949716983943711, -0.3099494759314203, -0.04437310873377171 },
+  { -0.7314075774217533, 0.1582416393918762, -0.6633268721019926 },
+  { 0.09126201573949895, -0.01064723516960821, -0.9957699939576441 },
+  { -0.7157846354203079, -0.6605795101644033, -0.22646647974297207 },
+  { -0.32257960886250664, -0.945248216407863, 0.04947934239524504 },
+  { 0.82528212526492, 0.4789527642436169, -0.2991883409185848 },
+  { -0.6982348546827762, -0.6760157662282726, -0.23552233761773836 },
+  { -0.43187163455348865, -0.673546351003747, 0.5998518186332646 },
+  { 0.854562103937942, 0.40484624733098207, -0.3253046672508395 },
+  { -0.004717806715256317, 0.9844490012501513, 0.17560724995676288 },
+  { -0.17536899331127803, 0.8431201601503752, -0.5083248092833899 },
+  { -0.3950532162584981, -0.5397114547242535, 0.7434006335504743 },
+  { -0.9372351984221869, 0.2646374300241341, -0.22706213570022055 },
+  { -0.6374241754866753, 0.44441434800083535, 0.6294333227563699 },
+  { 0.4666335545705351, -0.006977698012269684, 0.8844232230551824 },
+  { -0.8302690035452295, -0.4111213862882393, 0.3763410520903188 },
+  { -0.2305092953959056, -0.905419069589964, -0.3564853056704121 },
+  { -0.7379406312361247, -0.09858538884883396, 0.6676260524248241 },
+  { 0.8033331831558038, -0.2274925828405816, -0.5503661704658862 },
+  { 0.9886502334289505, 0.1502144982768717, 0.0025140501803660536 },
+  { -0.7117664688851125, -0.29720990061437386, -0.6364391320052627 },
+  { 0.8868795521578767, -0.26636828654627304, -0.37748191464843267 },
+  { -0.7733534625238949, -0.5496561799756609, -0.3159153459660775 },
+  { 0.19414315283779052, 0.8487204046354762, 0.4919167723930503 },
+  { 0.7109237349350899, -0.7029582028909992, -0.020909521615737937 },
+  { -0.7192403868856992, 0.24776016055748848, -0.6490825592426877 },
+  { 0.6745306975942124, -0.4958088888299339, -0.5469752131132556 },
+  { 0.14779664493481934, -0.9134050004979093, -0.3792722726636173 },
+  { -0.07882110197193784, -0.9340300583674634, 0.34838927071596526 },
+  { -0.004975923483672638, 0.36766545740470047, -0.9299448110597086 },
+  { 0.3290412411970607, 0.866368782647018, -0.37568203849295473 },
+  { 0.33596203163057237, 0.3225948420431491, 0.8849079506874227 },
+  { -0.24899470116944722, -0.9106091928482641, 0.32983713661407293 },
+  { -0.15244437010691006, -0.6238326351183482, 0.7665465135163065 },
+  { 0.1090608934240759, 0.006751388640538032, 0.9940121429222918 },
+  { 0.40914835017268636, 0.5569242899156468, -0.7227952426883575 },
+  { 0.8353570654834676, 0.03775625154727537, 0.5484095537241748 },
+  { -0.45128674930002666, 0.5400121497989003, 0.7104415162247945 },
+  { -0.5275218993605248, 0.612145204049609, -0.589066120952586 },
+  { -0.23497699802321004, -0.8592153416727818, 0.45446100716576887 },
+  { -0.5501038588080085, -0.19530819173183558, 0.8119362381166265 },
+  { 0.15198338300418673, 0.5135567538609213, 0.8444883136281021 },
+  { 0.03669645126898118, -0.9883978595891161, 0.14738738624426867 },
+  { 0.41254207661847764, -0.566116134337765, -0.7136676799896292 },
+  { 0.788642589249843, -0.4057659759992596, -0.4619489572914648 },
+  { -0.17556107905942456, 0.8870861571857267, -0.4269150468757813 },
+  { -0.5875390960871519, -0.4408180732069713, 0.6785847308208355 },
+  { -0.4415816216069816, -0.3396399184206852, -0.8304519235176343 },
+  { 0.5792855098626752, 0.10894819222187929, 0.8078109862305196 },
+  { -0.45778938064809377, -0.30027045397348084, 0.8368192979588811 },
+  { -0.761019574470806, 0.139341612227049, -0.6335875017503424 },
+  { -0.15566718704633825, -0.465756223642644, 0.8711135787113088 },
+  { -0.5537742151322613, 0.7691694556479464, -0.31892392063451436 },
+  { -0.9909035125438891, -0.11949671301549683, -0.061893169305462466 },
+  { -0.8995795689421779, -0.09172928093995485, -0.42701561816875533 },
+  { 0.4252322891804304, 0.4397950388098972, 0.7910485598726362 },
+  { -0.39943498364940366, -0.6662706489561775, 0.6297103430756993 },
+  { -0.3654510011317562, -0.364141140912646, -0.8566485832980952 },
+  { -0.5628504484567592, -0.7927274880492475, -0.23405662213053352 },
+  { -0.5849608865435807, -0.5958318410722667, 0.5502773649520587 },
+  { -0.4969715887600359, -0.8206077798181357, 0.28217390323570984 },
+  { -0.49091369983951155, -0.6970974537721064, -0.5225503604958357 },
+  { 0.9322940917694595, 0.3323586188181155, -0.1427076555377219 },
+  { 0.8180334633880695, -0.5619620869072731, 0.12255556150637338 },
+  { -0.4999159397390189, -0.8629935748049486, 0.07298042915898086 },
+  { -0.5267507931805196, -0.7998053629530134, -0.28782804462958766 },
+  { 0.26487076750924304, 0.7557749465879574, -0.5988720285912797 },
+  { -0.34292076123348486, 0.2886644810383252, -0.8939117232153976 },
+  { -0.5930719502333294, 0.7805551800225801, 0.19748233537801063 },
+  { -0.13383836412432717, 0.1548214974828022, -0.9788348155872403 },
+  { 0.9130409102217506, 0.08983735863627666, -0.3978511596749395 },
+  { -0.8034101293138137, 0.5492495663925254, 0.22990667222502217 },
+  { 0.9773837192461098, 0.092206011249633, 0.1903132072192425 },
+  { 0.6911878951390183, 0.18058062125253632, 0.6997499073535782 },
+  { 0.817841147618018, 0.12230329623953339, -0.5622968619793182 },
+  { -0.6106196979899559, 0.30439024101607737, -0.7310883432259261 },
+  { -0.8006594564853792, -0.5132004710666701, 0.30914351236518806 },
+  { -0.322629070272049, -0.5844549696082119, -0.7445286237047285 },
+  { 0.6964331253938015, 0.46867318677097775, -0.5434393672307497 },
+  { -0.7667617150092564, -0.10853413118365828, -0.6326901411941491 },
+  { -0.8445039312816354, 0.47384883924780036, 0.2495603886705082 },
+  { -0.7380633297809893, 0.6732220135664638, 0.04510700258401768 },
+  { 0.694174216866191, -0.6914590634755801, -0.20001629977500418 },
+  { -0.3804570249675179, -0.16177416355761684, -0.9105391656365469 },
+  { 0.5474588559804423, 0.7269535628592758, 0.41452058869830616 },
+  { -0.5691675358449091, 0.5373815652567118, 0.6223097054220516 },
+  { -0.716211720990137, 0.16102013259289957, -0.679053228853314 },
+  { 0.5117403029149028, -0.04042748393027732, 0.858188487988292 },
+  { 0.8113482770491234, -0.5663529149597802, -0.1447699866891573 },
+  { -0.9628593152142471, -0.26689336456203927, 0.040864055818111276 },
+  { -0.9887852033268646, 0.1472248449686944, 0.025073226872397738 },
+  { -0.4297188471442641, 0.9019298290938621, 0.043177491818323185 },
+  { -0.6242189316599899, 0.7143969011493317, 0.3162084644431468 },
+  { 0.4473265026503807, 0.7469121420400853, -0.49195655509371 },
+  { -0.4603970845963946, 0.6602934833224301, -0.5933355209129756 },
+  { 0.7896894956869095, -0.2828421084192791, -0.544417892897259 },
+  { -0.8572069693096874, -0.446592838108045, 0.25641967303134555 },
+  { -0.8222756055015937, -0.3431078066121758, 0.45402627857731886 },
+  { 0.8227572110270188, 0.5128144260510871, -0.245136566299146 },
+  { 0.722363198298246, -0.46980475808557554, -0.5074198449257605 },
+  { -0.46224676422876615, 0.8843644137607493, -0.06501932507833194 },
+  { -0.7719055173345205, 0.11443072688704206, 0.6253538846546246 },
+  { -0.4326132134323645, -0.8430411338681975, 0.3195738634024182 },
+  { -0.20389074043134656, -0.147552509522685, -0.967810323823793 },
+  { 0.943479033522029, 0.2620379504423447, -0.20293699966322887 },
+  { -0.09755164873092913, 0.6389377621067662, 0.7630479748900949 },
+  { -0.6878757501987106, -0.7247109398108458, 0.04026171887838032 },
+  { -0.8460096665890273, 0.41874639537544134, 0.3300289387281021 },
+  { 0.950804605347919, -0.2894878945476507, -0.11030576303872916 },
+  { 0.43148002468418456, -0.041672115060041974, 0.9011594881734076 },
+  { 0.9763463182278592, -0.21620722664719494, 0.001517243695769789 },
+  { -0.3065005601723102, 0.4962890717026772, 0.8122527709540639 },
+  { -0.580554759515531, -0.7935140169230714, -0.18246006727630973 },
+  { -0.10942304524975786, 0.9927861709639489, -0.049012405684787375 },
+  { 0.6298856216041684, -0.6447180930705145, 0.43310816681730885 },
+  { -0.8727577949892742, -0.325061379225834, -0.3641825517803654 },
+  { 0.49721336573167346, -0.7586159808038401, 0.4210471025987578 },
+  { -0.07119986447963925, -0.3840477538598723, 0.9205639043832144 },
+  { -0.7417009953991317, 0.07519914040866331, 0.6665018549904684 },
+  { -0.4430781537026552, -0.4885727855560528, 0.7516504393170044 },
+  { 0.9856768165483192, 0.16065184707149263, -0.05130494470992829 },
+  { -0.35596194358611477, 0.018130489486559327, -0.9343245582073573 },
+  { 0.9003834658060756, 0.16376061703201775, 0.4031030573095821 },
+  { -0.15002388247261017, -0.6072395242938983, -0.7802262459204794 },
+  { 0.5609439275452635, -0.8165029088624465, 0.1366195812072991 },
+  { 0.533890473017645, -0.5760170964924674, -0.6190034469769798 },
+  { -0.07220285323085716, -0.2334783852137998, 0.9696775709602032 },
+  { 0.1530384901991428, -0.8027191305847758, -0.5763863443132466 },
+  { 0.13150521682831953, 0.5243349029949663, -0.8412961948375827 },
+  { -0.17256891148727166, -0.7272153170981192, -0.6643627423072279 },
+  { 0.16857723663555912, 0.9833672137074282, 0.06760649594238569 },
+  { -0.5012034984847884, 0.6801698208705763, -0.5349430510657156 },
+  { -0.6723894676823543, -0.7172482958048574, -0.18288599157635882 },
+  { 0.861207223545064, -0.4545961883815587, 0.22729809419077934 },
+  { -0.46649606728169585, -0.3816786005032057, 0.7979366297699497 },
+  { -0.7114819533554447, 0.4604013814082922, -0.530870980603439 },
+  { -0.483874172037111, 0.7219952156894432, -0.49455909066253617 },
+  { -0.0984952012898437, 0.9516265688530011, -0.29104221133013963 },
+  { -0.8513670701652886, -0.2954176930477636, -0.433477217939432 },
+  { -0.8407995163332762, -0.005624077032329607, -0.5413174143617246 },
+  { -0.3999940651050167, -0.763764177885472, 0.5066251360322469 },
+  { -0.8575775633942772, -0.4706358152050144, 0.20751542643631574 },
+  { 0.6601793929096935, -0.5468871520779313, 0.5148568850364905 },
+  { 0.20175024043327802, -0.03223228693312726, -0.9789064920431242 },
+  { -0.3806679297614883, -0.6277681648698227, 0.678969114486865 },
+  { -0.9440645162715177, 0.1853838380419666, 0.2727178426686734 },
+  { 0.17245852123106145, -0.9772649536426815, -0.12333397275918334 },
+  { -0.9273285267041338, -0.2123130304861754, 0.3081963345767062 },
+  { 0.36547719815344004, 0.32188352403250264, -0.8733941919811057 },
+  { -0.36546227821337285, 0.14561387647564075, -0.9193660436305161 },
+  { -0.6645410596243553, 0.7469862035744209, 0.019919632095317892 },
+  { -0.7751115456079967, -0.6170387080421441, 0.1358871761531014 },
+  { 0.26623832781854573, 0.5223583343898308, -0.8100980948588055 },
+  { 0.4965742320614768, 0.8164372537695029, -0.29469347245887006 },
+  { -0.16771095523126947, -0.9274475086110837, 0.3342366740298091 },
+  { 0.9282257642132404, 0.2413720681057797, -0.2830838310272854 },
+  { 0.989555906576753, -0.12254226569114858, -0.0759111380387646 },
+  { -0.7595220285530423, 0.008255674223402633, -0.6504291906009361 },
+  { -0.9681389855144589, -0.06811883803092059, 0.24097038953438157 },
+  { -0.8853322046970196, -0.35390529005240756, 0.30155916998034726 },
+  { -0.24146143663390504, 0.2663864881574049, -0.9331316164110266 },
+  { -0.5247086204396564, -0.5271548144743401, 0.6684225199773245 },
+  { 0.6596199764044289, -0.7111527870610249, 0.24323486629913316 },
+  { 0.12755699076386234, 0.10566288040887103, 0.9861868838161297 },
+  { 0.15371580827984344, -0.9763163797454593, -0.15224249382348712 },
+  { -0.019634565091870598, -0.7315458929390497, 0.6815094206081537 },
+  { -0.09387462406595065, 0.993904211862099, 0.05780979674117865 },
+  { 0.4097069801535802, 0.9036262495304136, 0.12489912558954407 },
+  { -0.41517849522889594, 0.6176908318962514, -0.6678958401508326 },
+  { 0.8198926046289022, 0.38167414353414414, -0.4267328965902584 },
+  { 0.16784727228266838, -0.9848388144778253, -0.043815553005515845 },
+  { 0.6405814688722317, 0.3808548005840359, 0.6667870744170048 },
+  { 0.00736150161796845, 0.21883736627960756, 0.9757335780907274 },
+  { -0.7204540758693566, -0.6359905135901857, -0.27651761460442853 },
+  { -0.7041086045489624, -0.6978591198932024, 0.13123917777096045 },
+  { -0.0774457830501789, 0.9011872936748091, 0.426454701471115 },
+  { 0.379851809180335, 0.8573797978641847, -0.3472930826791634 },
+  { 0.28542159245122, -0.2674866629435132, 0.9203180970240415 },
+  { -0.05196834051349797, -0.35529375657187384, 0.9333089724873105 },
+  { -0.5366663854041404, 0.6560595812580952, 0.530636426017577 },
+  { 0.4841990693740385, -0.171593354409747, 0.857966772048735 },
+  { 0.3936941828185577, -0.08143185866116748, -0.915627513135017 },
+  { 0.12870149326299649, 0.6891516005536032, 0.7130960644164863 },
+  { -0.4113743661609617, -0.151931690788712, 0.8987145777162794 },
+  { -0.3466594111745493, -0.342195985279598, -0.8733436667788 },
+  { 0.5211816345826822, -0.8329900855101183, 0.18573427582320207 },
+  { -0.6836929092471083, -0.2594609240883001, -0.6820879963146035 },
+  { -0.9469074680910814, -0.3211341059448795, 0.015463921634584888 },
+  { -0.6340838026942841, -0.5407658090902197, 0.5527296544240741 },
+  { -0.4486614982819824, -0.6595078854527501, -0.6031187353954517 },
+  { -0.30266533445116534, 0.565458588914752, 0.7672354785488622 },
+  { 0.710664153075715, 0.5116247568195467, 0.4829043070241935 },
+  { -0.4339176406052788, -0.08678352812105576, 0.8967631239175762 },
+  { -0.5349675155191562, 0.22709026211264366, -0.8137811562040941 },
+  { -0.6647378622049852, 0.38074678496084124, -0.6427717015341675 },
+  { -0.8269265730794552, 0.5555276423828113, 0.08707170196834164 },
+  { -0.7661441356711953, 0.34135765313363314, 0.5445164056515976 },
+  { -0.634680103089704, 0.7580348566682671, 0.15021425637389546 },
+  { 0.037705216687822576, -0.29933325084822415, -0.953403336249228 },
+  { -0.5333925976660611, 0.7482167283567143, 0.3945428546586876 },
+  { 0.25240486855756383, 0.771335157759828, -0.5842378426052701 },
+  { -0.741655567136465, 0.6702509875020172, 0.026657709730193865 },
+  { -0.16510033245846242, -0.24356385679515744, 0.955729317267799 },
+  { 0.005172347909127125, 0.5777512614494998, -0.8161965000602603 },
+  { 0.32432574143499443, 0.2724016695303771, 0.9058753467667086 },
+  { -0.8355717338094688, -0.5385732732701263, 0.10843757179935427 },
+  { -0.4653444475404231, -0.8659066181118819, 0.18346736454569285 },
+  { 0.43716570032178953, 0.5694133151451619, -0.6961714063343566 },
+  { 0.6220011176266816, 0.7085955007258121, 0.3331771691192157 },
+  { 0.42967917451234977, -0.38534079815554073, 0.8166322772626836 },
+  { -0.3514170899878591, 0.8816565472859959, 0.3149408857106383 },
+  { -0.19764757389598725, -0.9786145793651503, 0.05699948760296261 },
+  { 0.08262377957914416, 0.6839993904400035, -0.7247883449157835 },
+  { -0.36916565843824545, 0.8660761407567984, -0.3370887643361418 },
+  { 0.23468688435433618, -0.5008988725771653, -0.8330800596359147 },
+  { -0.6626949813307579, 0.739619575242093, 0.11746593394568729 },
+  { 0.5171876562312556, 0.5968223038066266, 0.6134493181355501 },
+  { -0.9749406013205731, -0.14563656107663578, -0.16816901014886998 },
+  { -0.671196198974938, 0.4970169572257383, 0.5499725508710994 },
+  { 0.7365345109286318, -0.6671103479266914, 0.11171704391116842 },
+  { 0.2377440468674924, -0.787738821956962, -0.5682827786946613 },
+  { -0.9868173440092913, 0.16166797168889693, 0.00741596200407784 },
+  { -0.4579862238421489, 0.18439053625853655, -0.8696256372193143 },
+  { -0.4600372030986716, -0.32370035434672556, -0.8267912991565379 },
+  { 0.0365115901672256, -0.08992669430075934, -0.9952789023362236 },
+  { 0.675028462813718, -0.4436637454065734, -0.589490504930453 },
+  { -0.660911670802942, -0.5218985179232661, -0.5392751620332256 },
+  { 0.7058215523384127, -0.6040940630576543, -0.3699814849868679 },
+  { -0.42434988343153207, -0.5397980134827577, 0.7270111973496101 },
+  { 0.3955532652682712, -0.7383298225158791, -0.5462661325025369 },
+  { 0.33562040906151996, -0.8984994807611095, -0.28294456010567604 },
+  { 0.9789142032813576, -0.2042639765236268, 0.001791789267751112 },
+  { -0.953730177628213, -0.06314651861008716, -0.29395793146075055 },
+  { 0.23252152025730402, -0.919061353775637, -0.3182137184555777 },
+  { -0.9940306200683375, -0.10423581335320985, -0.032218342309173954 },
+  { -0.8722984132105205, 0.45340346093250133, -0.18308680980572464 },
+  { -0.36115639738568894, -0.3875218093160491, 0.8481703271936634 },
+  { 0.20730833438023655, 0.9482759384955919, -0.24040798440733316 },
+  { 0.4568196888554573, 0.2650974360197473, -0.8491402247507529 },
+  { 0.7611493862037351, 0.626458041506538, -0.16793431487778193 },
+  { 0.5171760321483091, -0.601229498176237, 0.6091404126259243 },
+  { 0.6017151084800497, -0.5377878725193538, -0.5905278421869279 },
+  { -0.2570652460751192, 0.9446127693077793, 0.20402003656755494 },
+  { 0.9560439369612619, 0.14485514196382757, -0.25494504985633654 },
+  { 0.5792195515749365, 0.21926130188164708, 0.7851300481897854 },
+  { -0.05443063154002595, 0.23170470673919302, -0.9712621866545914 },
+  { -0.8939453873406776, -0.00636878190462918, 0.44813065401663504 },
+  { -0.9003638051480656, -0.03714555107445837, 0.4335495662720365 },
+  { 0.308919912139462, -0.26258192531854274, -0.9141221036490444 },
+  { 0.9914062676900902, 0.05850403812525254, 0.11700807625050508 },
+  { -0.04331196645444728, -0.15629970503126625, -0.9867595835708858 },
+  { 0.09163809126595995, -0.7570103191535822, -0.646945003013489 },
+  { -0.9637092255735827, 0.05548876150635362, -0.26112358355931115 },
+  { 0.25848951839740214, -0.9620542991058242, 0.08737673861320636 },
+  { 0.2237473018852357, -0.2975548534162096, 0.9281154314564193 },
+  { 0.4724874715596996, 0.8507466724379776, 0.230186204093187 },
+  { -0.2605791101504376, 0.5407393095029313, 0.7998121820224415 },
+  { -0.980250973242266, -0.19713534332731916, 0.01567436980584189 },
+  { 0.33431414660572156, 0.9418107101521185, 0.03502338678726607 },
+  { 0.1243330998350167, 0.7859220714341881, 0.6056961102054483 },
+  { 0.23953442849233164, -0.9488482901496793, 0.2056943845779025 },
+  { -0.557660763950974, 0.6727202890432684, 0.4862734673608644 },
+  { 0.6273917481589665, -0.14386595039194755, 0.7652987538601234 },
+  { -0.21177132969247942, 0.009547068141874072, -0.977272611613655 },
+  { 0.04091065208494613, -0.8669161989429061, 0.4967722038886316 },
+  { 0.02217593022647253, 0.6288460214221139, -0.7772135546039897 },
+  { -0.47846112393102525, 0.8771787272068796, -0.040403383798619914 },
+  { -0.31923859891465084, 0.9476610377230187, 0.005027379510466942 },
+  { -0.728196724477889, 0.5389686575508743, -0.4233701886499354 },
+  { -0.267728078517549, -0.5992009376345144, -0.7545064030949108 },
+  { -0.341915371954268, 0.2311347914410852, -0.9108625508861701 },
+  { 0.45085787758650947, -0.6198419343491047, 0.6422796514296153 },
+  { 0.23189634920807412, 0.06451954877160127, -0.9705984293466973 },
+  { -0.6441164029155065, -0.6670386948342079, -0.3743974346721212 },
+  { 0.8541727179545284, -0.5133165755756649, 0.08303650487253403 },
+  { -0.656137969027831, -0.4807472426915454, 0.581691545618904 },
+  { 0.2721751906027322, 0.8599524111251446, 0.43174357693012255 },
+  { -0.9019736796862109, 0.2079893644938523, -0.37839649233411243 },
+  { 0.9656149037339536, 0.18752521318891274, -0.18006152311174206 },
+  { 0.07079446232860649, -0.9805439897238025, 0.18308912671191335 },
+  { 0.30416621811194666, 0.8980145487114616, -0.31788800238767356 },
+  { 0.9892267672447365, -0.05652724384255637, -0.13503730473499576 },
+  { -0.5128327694226793, -0.79773986354639, 0.3171965647910646 },
+  { 0.49538628814686364, 0.447821108283937, 0.7443444635996286 },
+  { 0.8576420958428554, -0.5094561730912419, 0.07003172950528204 },
+  { 0.675671531747932, -0.7221010402586399, 0.14845224431713155 },
+  { 0.057863307857148126, 0.12713628205232547, -0.9901960429075348 },
+  { 0.45811542860017596, 0.8637151861169171, -0.21006268433373923 },
+  { -0.9067699131395797, 0.3897722713367836, -0.16076660449796118 },
+  { 0.5686439273536023, -0.4580186562751286, -0.6832737331317492 },
+  { -0.8156578120234242, -0.25980211790375735, -0.5169189425992071 },
+  { 0.8757768816263856, -0.43599516157558166, 0.20717884228715605 },
+  { -0.2999652052394647, -0.803098333176581, 0.5148338983542585 },
+  { 0.7922229163528942, -0.5377789598531163, 0.28840360806448934 },
+  { -0.9811733977204897, 0.03135895309248031, -0.1905659457158419 },
+  { 0.06279303534563414, -0.7782218806770397, -0.6248421713901627 },
+  { -0.234871772665337, -0.2240511218921372, 0.9458521793514655 },
+  { -0.16207244579774602, 0.9369813272682191, 0.3095133513498622 },
+  { -0.825922122192596, -0.46886734193063434, -0.3130751726722837 },
+  { 0.129546655205906, 0.5590026902720602, -0.8189833065414468 },
+  { -0.8038215507176766, -0.5382992695239314, -0.2531892790617952 },
+  { 0.9139130917109347, 0.4056988903537801, -0.013087060979154196 },
+  { 0.8393902288383347, 0.5373689668911686, -0.08160047275014042 },
+  { 0.6935558041801987, 0.47591825504236696, -0.5408161989117806 },
+  { 0.01498660592447199, 0.972464206654627, 0.2325699215686579 },
+  { -0.6282310787524353, -0.759486500563212, 0.168837102414717 },
+  { 0.4477065423106414, -0.8159812787274593, -0.3656957816800055 },
+  { 0.030035277661709353, 0.8572363673612456, 0.5140463914561404 },
+  { -0.8767612232526864, 0.08751305452181184, 0.4728966300246975 },
+  { -0.8326840368635363, -0.5528270710906035, -0.03192998938348899 },
+  { -0.19554727587377616, 0.3627543668383094, 0.9111369448321599 },
+  { 0.9332098635224976, 0.09904467351518774, -0.3454120774851271 },
+  { -0.8300594230186498, 0.12852533001579095, 0.5426625045111173 },
+  { -0.6173176614284276, -0.7856295047645442, 0.041293899452028604 },
+  { -0.44710683742059854, -0.870653554066938, 0.20508014219411885 },
+  { -0.5080162051968414, -0.6437791565856525, -0.5722481391872467 },
+  { 0.6703151088539977, 0.06031248808946783, 0.7396215644655791 },
+  { -0.8559031749751522, -0.226153277940589, -0.4650639202778266 },
+  { -0.8126959163482818, -0.4413240245530207, 0.3804713562190346 },
+  { -0.42277987962249214, -0.8412675777259742, -0.33693624924229065 },
+  { -0.3414254904003597, 0.8089312948333485, -0.4786008720678602 },
+  { 0.21451346227069107, -0.2778460082744189, 0.9363682876895245 },
+  { -0.17968637296619666, -0.9598016722132844, 0.215623647559436 },
+  { 0.5568479175066219, 0.8301683821076319, 0.027218635478938748 },
+  { 0.011529687332438964, 0.8788766207500065, -0.4769097942054299 },
+  { 0.8138768901206503, 0.45612079965579866, -0.3599419728913172 },
+  { -0.12160491429061532, 0.3278045515660065, 0.9368865570563928 },
+  { 0.8412270299647632, 0.5406818240070258, 0.0004992445281689989 },
+  { 0.3820990999049939, 0.7966963191318044, -0.46826835568253766 },
+  { 0.15461161759917638, -0.8113012442924981, -0.5638133899729684 },
+  { 0.6730311561640588, 0.19049241720857146, -0.714661949328846 },
+  { 0.8173805381652359, -0.5605356655006658, 0.13299933657892837 },
+  { 0.12464211362686843, 0.9819561387655211, -0.14221984759988834 },
+  { -0.7970544206299823, 0.49444392872978565, -0.346741188635642 },
+  { -0.09966511142932641, 0.6922053442239936, 0.7147857210322004 },
+  { 0.29195466213934484, 0.9033780383473969, -0.3141187595268868 },
+  { 0.7878932335060624, 0.6149859246743818, -0.031883617231373736 },
+  { 0.5375855036656264, -0.8408953575097572, 0.06242454619068066 },
+  { -0.23416359268940284, -0.7542595929044261, -0.6134002595128574 },
+  { 0.9817192374392273, 0.17837604181588082, 0.06640276009204323 },
+  { 0.9424226153769146, -0.08087771267494191, -0.32449716426897424 },
+  { 0.3671565865133087, 0.4825667743292365, -0.795188876489964 },
+  { -0.27098845954187345, 0.9617557711310882, -0.03988848820359352 },
+  { 0.9091006750301924, -0.36626688512452377, 0.1984553640515348 },
+  { 0.024722012532644968, 0.21247567528057026, 0.9768535762899173 },
+  { -0.4420829507088507, 0.8658728138021627, 0.2341515214788947 },
+  { -0.23211140231124638, -0.7557913149149451, -0.6122938716141499 },
+  { -0.856896884723636, -0.09633751958431411, -0.5064057772885985 },
+  { 0.6111910940574038, 0.4832066341906825, -0.6268626605716963 },
+  { -0.5791135657861389, 0.6853950961076827, -0.44143067423322996 },
+  { 0.5448066840811991, -0.7548762883935894, -0.3651677233841551 },
+  { 0.6438239428579912, -0.4617236051327417, -0.6101655865959783 },
+  { -0.26524544981726783, 0.7981810079754649, 0.5408806983600968 },
+  { -0.2690756081370354, 0.9230463253048736, -0.2749250778791449 },
+  { -0.7930754642807586, -0.37466152244081496, 0.48027081064560845 },
+  { 0.8403815125079477, 0.34076445476694217, -0.4214718256327969 },
+  { 0.47900520531930896, 0.04394543168067055, -0.8767113620293775 },
+  { -0.6921286944855106, -0.5301411276910294, 0.4898043027580163 },
+  { 0.23356164966282014, -0.9526453281652008, 0.1947198873556553 },
+  { 0.27991108112299357, -0.2948396721162199, -0.9136297687854511 },
+  { 0.1014912350506496, 0.9617787039211558, -0.2543250948916278 },
+  { 0.6425813178159663, 0.7358248755421637, -0.21366095227545812 },
+  { -0.7251081303906909, 0.5731689480430674, -0.3817008727269565 },
+  { 0.5379570938226657, 0.7866584205762868, -0.30293678307906696 },
+  { 0.23162260129179424, -0.18914901914782217, -0.9542398121679053 },
+  { 0.11661829396893145, -0.9915079192856335, 0.05755188533531681 },
+  { 0.8497066376502271, -0.5177980729129964, 0.09941722999929532 },
+  { -0.1256837138803236, 0.6912604263417799, -0.7115916153518321 },
+  { 0.03150716565605752, -0.7098379086041193, 0.7036600329852846 },
+  { -0.997383828904329, 0.04934791069840234, 0.052823115677163066 },
+  { 0.8285695626778395, -0.03171558134652017, -0.558987121232418 },
+  { 0.40084033450212625, 0.7206746083731608, 0.5656457681998646 },
+  { 0.22817611898049364, 0.9161100896381014, 0.32966340772107144 },
+  { -0.7893105541628994, 0.5280520818172553, 0.31328876132973427 },
+  { -0.9111361716503097, -0.3797676816290366, 0.16002307552513842 },
+  { 0.7618126052149844, 0.2648534019638822, -0.5911803701102707 },
+  { 0.04433205995912119, -0.9742370766920126, -0.2211261785912792 },
+  { 0.7391880198850853, 0.2087871747747802, 0.6403194413009275 },
+  { -0.6432630024246809, -0.7631840260725811, 0.06134209043740514 },
+  { 0.7752792859148337, -0.37223266191777393, 0.5102792120329749 },
+  { -0.7127479631061596, -0.3073865822000332, -0.6304790481621119 },
+  { 0.6140201567238883, 0.016675620163209382, -0.7891141684375867 },
+  { 0.9401526500902677, -0.17727128988078072, -0.29101182847480767 },
+  { 0.0687045441706505, 0.6199263870167158, 0.7816463140645546 },
+  { 0.1836547348288412, -0.9101370719682447, -0.371377770745663 },
+  { -0.1615483900176235, 0.6345153632017502, 0.7558388528937003 },
+  { -0.8529307773582094, 0.10301631466793959, 0.5117584664149257 },
+  { -0.03604714813476885, -0.9006065264147012, 0.43313795457174636 },
+  { -0.12973929777749194, -0.25847674769569823, -0.9572656295474405 },
+  { 0.2677139489578829, 0.8486027061306478, 0.4562923280980269 },
+  { 0.20245762130615685, -0.8759045206299841, 0.43795226031499207 },
+  { -0.18241928667042437, -0.9191965852285156, -0.3489997730012011 },
+  { -0.6960335778119767, 0.6324952429079789, -0.33983382153198866 },
+  { 0.9537811893224986, 0.28386344920312456, -0.09860519814424326 },
+  { 0.3781515745252717, -0.9011827979350527, -0.21182764548096134 },
+  { 0.5781890807505135, 0.10229499120970621, 0.8094647130507188 },
+  { 0.627090928422388, -0.04340613103900894, -0.7777357361460072 },
+  { 0.7148033941953763, 0.6458143266590933, -0.268290818196656 },
+  { -0.3906616204361102, 0.11161760583888862, 0.9137423096174473 },
+  { -0.0012798884067871088, 0.9931934036667964, -0.1164698450176269 },
+  { 0.2867262267954705, -0.4197435485047094, 0.8611639938805541 },
+  { -0.07562530141106995, -0.6624047485041911, -0.7453192355934364 },
+  { 0.18524480074730262, -0.7511574887445568, -0.6335982882703071 },
+  { 0.013304732436501309, 0.8455896615198609, -0.533667601064108 },
+  { 0.2288417923027508, 0.8800637522166395, 0.41607598600500145 },
+  { -0.35315935607875004, -0.9265504637153809, -0.12954808915169458 },
+  { -0.845925507514205, -0.5037907145536169, -0.17494270966916806 },
+  { 0.7645028684947964, 0.6330830909263192, 0.12141319552011601 },
+  { 0.6695546068404362, 0.6359809517696406, -0.38369891509480586 },
+  { 0.05797014614594761, -0.4574475888942598, 0.8873450093231188 },
+  { 0.6638479663670052, 0.2064811400405735, -0.7187985923455449 },
+  { 0.6052443670242351, 0.2400547278492747, 0.7589815437957919 },
+  { 0.9013724565216692, 0.2954742881866155, 0.3165795944856594 },
+  { 0.9086902538267803, -0.38769231841680696, 0.1548440791274334 },
+  { 0.49891244751873853, -0.6745296290453345, 0.5441471760937708 },
+  { 0.44966912816323357, 0.5914228616760692, -0.6693404767857736 },
+  { 0.009722119075286919, -0.3624961540928408, 0.9319345570739317 },
+  { 0.5156875604512712, -0.1274208590507022, -0.8472486439496952 },
+  { 0.7575503344869546, 0.09864504355549554, -0.6452802849155067 },
+  { -0.5051629537627729, 0.1432850066741374, -0.8510462954552255 },
+  { -0.5430908062040188, 0.34002206997121176, 0.7677482452921408 },
+  { -0.9537056823339308, -0.2986215253570277, -0.03564626316198754 },
+  { 0.13080848537560208, 0.9402243714086703, -0.31443166437703407 },
+  { 0.14665548404007495, -0.6027067311840499, 0.7843702985111106 },
+  { -0.34390118235340306, 0.594285376522986, 0.7270191662032468 },
+  { -0.10926930737226485, -0.6556158442335891, 0.747146627681785 },
+  { 0.49562799022535303, -0.7291014800370929, -0.47197873586942246 },
+  { 0.27986876050033843, -0.9584465195054053, -0.055260710672041344 },
+  { 0.4547694947863028, 0.7842871596057217, 0.4219933149818846 },
+  { 0.7936918060430741, 0.06247719756024199, 0.6051032282223437 },
+  { -0.4780688947977985, 0.38573538525616524, 0.7890870322011947 },
+  { -0.6146874924130965, 0.7730237291790623, -0.15682347017266038 },
+  { 0.5417150404129469, 0.6854711352798131, 0.4864916625067727 },
+  { 0.27434382010143044, 0.37539030345940005, -0.8853347324265628 },
+  { 0.9313501419617902, 0.28757990276876594, -0.22334885849553904 },
+  { -0.33166432795625644, -0.8413069724092185, 0.4268505027957202 },
+  { 0.8137446716849621, 0.1463025138181271, -0.5625079410593508 },
+  { 0.07871647720510541, 0.9123458364952842, 0.40178201906772554 },
+  { -0.7030162093810869, -0.12092538394358023, 0.7008175660366581 },
+  { 0.8647998319475645, -0.4677881443910739, -0.18247055277666002 },
+  { -0.9568195921363974, 0.08698359928512704, 0.27736279772049943 },
+  { -0.6866841170206882, 0.7269509729835901, 0.0026844570641934642 },
+  { 0.07143021275821623, -0.7789294629348342, -0.623030189057775 },
+  { 0.7685919178661159, -0.3806266786122458, -0.5141884822898076 },
+  { 0.12818118344287058, -0.6059474126390245, 0.7851097485875823 },
+  { 0.7913928134340388, 0.46679427409492247, 0.39471574647732416 },
+  { 0.3532993205136506, -0.5897243708573815, 0.7262263810558374 },
+  { 0.839813604293189, 0.4528895806650398, -0.2993395025203446 },
+  { 0.8504468730247319, 0.421451495916455, 0.3148313084053709 },
+  { -0.3498715288570071, 0.07140235282796063, 0.9340725974494124 },
+  { 0.07048766630319675, 0.8555744323698364, 0.5128585375853281 },
+  { -0.4763713168528105, 0.5392185304952545, -0.6944881171412924 },
+  { 0.6382316792020293, -0.385623729689945, -0.6662992291478164 },
+  { -0.5685198779759598, 0.7504462389282669, 0.3370691187644135 },
+  { -0.06381295487511812, 0.08481468685933422, -0.9943512335603849 },
+  { -0.8132915609966697, 0.5756069124514245, -0.08505009788200467 },
+  { -0.8827079313794428, -0.4598088799177112, 0.09696649848604794 },
+  { -0.6269678377778611, -0.011514560840732069, 0.7789600408755245 },
+  { 0.8171423010248298, -0.561713095188214, 0.12944828531086414 },
+  { -0.2621839468172446, -0.001002615475400553, 0.9650173950730322 },
+  { 0.7719471470013985, 0.6356183678328498, 0.009321625926054624 },
+  { 0.9302822710897416, -0.30716349057245457, 0.20056292318237195 },
+  { -0.26237308839516177, -0.33419920535401826, 0.9052465153905467 },
+  { 0.00992720755466729, -0.9927207554667289, 0.12002896407006813 },
+  { -0.7691533209967609, 0.5534676694445224, 0.3194944564140392 },
+  { -0.6101704338124547, -0.51455495822409, -0.6024327652677316 },
+  { 0.8235290490349798, 0.5561430331141475, -0.11182500665834065 },
+  { 0.17138824317801774, -0.9849033839385412, 0.02431860207255657 },
+  { -0.0305265523087941, 0.947357919955966, 0.3187179020714774 },
+  { -0.35156318642375883, 0.5944816480414432, -0.7231838605040237 },
+  { -0.34025880055430435, -0.5641990974047412, -0.7522654632063215 },
+  { -0.40098468411791827, -0.8974419120734362, -0.18387304739093255 },
+  { -0.4903494910878947, 0.4360293378835471, -0.7546096958658021 },
+  { 0.7625702430652517, 0.5814334055504446, -0.2835874103365929 },
+  { 0.23852330071094824, 0.4362254996223718, -0.8676485166800936 },
+  { 0.6475941840506593, -0.7359262398251237, -0.19757110699850625 },
+  { 0.996894231374987, 0.06144101037347227, -0.04926351282197326 },
+  { -0.6167381713153156, 0.5288013411469118, -0.5830979074253894 },
+  { 0.27787753576542035, 0.42002034232047814, 0.863925336562093 },
+  { -0.7474221510019771, 0.6258394027680788, 0.2229017050954801 },
+  { -0.8283984697169271, -0.2105411555487791, -0.5190649257952593 },
+  { 0.7444981146121769, -0.275501158748813, -0.6081296480743029 },
+  { 0.0, -0.9947494292130037, -0.10234047625648185 },
+  { 0.6706349921333272, 0.26442933318138073, -0.6930554343482074 },
+  { 0.6876039397534568, 0.513420306394052, -0.513420306394052 },
+  { 0.23814568998970248, 0.8856280611757625, 0.39868479729905465 },
+  { 0.33581496057467436, -0.13110216060835286, 0.9327596344922156 },
+  { 0.44574735567885276, 0.48490083962361685, 0.7524496465795049 },
+  { -0.2195298301566734, 0.8896378610978771, -0.4004386716746728 },
+  { -0.18166064957105155, -0.3816914771886139, -0.906262116961201 },
+  { -0.8565584778198208, 0.24642073585150193, 0.45341415396676354 },
+  { -0.43648178304391333, -0.8665682286073297, -0.24195693467879933 },
+  { -0.024139462882259745, 0.38959970326251775, 0.9206678866722322 },
+  { 0.881316921082619, -0.2785601566300141, 0.38168668270155126 },
+  { 0.07123356652685353, 0.2703222524608801, 0.9601310633576754 },
+  { -0.7287690803224602, -0.3397358711853686, 0.594537774574395 },
+  { 0.8801651876798117, 0.45425703321205, -0.13769455390082944 },
+  { 0.549234155513735, -0.549234155513735, 0.6298282978989026 },
+  { 0.06982727548230479, -0.990016851016239, -0.12243686659910975 },
+  { 0.1278806685696164, -0.529489379779982, 0.8386224009090134 },
+  { 0.8416515337795601, -0.38936215815035724, -0.374192203936707 },
+  { 0.8355044266762853, -0.4582699865381632, 0.30318471670360186 },
+  { 0.7221455508405344, -0.4656417830344112, -0.5115501278406208 },
+  { 0.7459877923381028, -0.6526117554038532, 0.13266540766614685 },
+  { -0.0026945125342434963, -0.8582022421565536, -0.5133046377733861 },
+  { 0.25314161884146563, 0.21456262473827778, -0.943335677728635 },
+  { 0.0006468111814205854, -0.4417720369102599, -0.897127108630352 },
+  { -0.7140144341232145, 0.6016671392753912, 0.3580224034608346 },
+  { -0.5757883668243251, 0.43091853735089714, 0.6948215388120462 },
+  { 0.5485040213949981, 0.581414262678698, 0.6009166278838535 },
+  { 0.3990667481612605, -0.7285390744577537, 0.5567553749181382 },
+  { -0.8064580461459417, 0.4576872601374385, 0.3743631815688541 },
+  { 0.3519122094414842, 0.4576747339247925, -0.8165118705645886 },
+  { 0.235113625723645, -0.30586210276510656, -0.9225887258639079 },
+  { 0.9128081967311704, -0.4072711020434794, -0.03019015436659513 },
+  { -0.23113678275439217, -0.8362833595811388, -0.49719807938650845 },
+  { 0.45465791678595335, -0.6456480453986401, 0.6135346609416397 },
+  { 0.7766482544850095, 0.5130288469689621, 0.36553917845161965 },
+  { 0.5755193649657406, 0.23328401876116878, 0.7838086674310699 },
+  { -0.07008824831807209, 0.9459278626386421, 0.3167145657079799 },
+  { 0.4317383964678645, -0.612551912937312, -0.662104305205907 },
+  { -0.566276340310976, -0.17432014207334148, -0.8055703535207448 },
+  { -0.39833707846633865, -0.7839558594082093, 0.476173059316083 },
+  { 0.4176327082289848, -0.8702395841421703, -0.26127760564079344 },
+  { 0.3477107664478592, 0.6879385178358649, 0.6370540154288612 },
+  { -0.9639941714012585, -0.06733571227101329, -0.25725695200976867 },
+  { 0.2283500220277397, 0.9456669390496611, 0.23145260384876878 },
+  { 0.5079339958142425, 0.6356515034322745, -0.5813348622613873 },
+  { -0.6394270624099632, -0.4444096508981755, -0.627401860091542 },
+  { 0.9088967160089354, 0.2051206596440399, -0.36308714465726605 },
+  { 0.9502094300614462, 0.3024476130772022, 0.07501653395221944 },
+  { 0.1423747921897982, -0.2762070968482085, 0.9504941126590928 },
+  { -0.44305200414098356, 0.11702233524608288, 0.8888254579388528 },
+  { 0.7455959912409711, -0.32384472346830057, 0.5824184174003545 },
+  { 0.6107097300409909, 0.7700584611003756, -0.1845090570161296 },
+  { 0.7655506086562524, 0.48184202458223335, 0.4263338233503601 },
+  { 0.6477526553980886, -0.35529158350357054, -0.6739320352351938 },
+  { -0.21880945996827764, -0.7688553399990308, -0.6008193458797457 },
+  { 0.7772499111622546, 0.5598660309955027, -0.2871107851258988 },
+  { 0.5085452035828739, 0.24624876560868214, -0.8250717067922362 },
+  { 0.9891013222212718, -0.08019740450442744, 0.1234785434433248 },
+  { 0.015266249517590012, -0.9217656174241418, 0.38744688430849133 },
+  { 0.3099634750951266, -0.34635049173672844, -0.8854174049456444 },
+  { -0.725962141771057, 0.4364572391738718, 0.5314922831875375 },
+  { 0.7977195074495521, 0.2676220283056562, -0.5403906340787288 },
+  { -0.03790952616433146, -0.10513575256241257, -0.9937350458543419 },
+  { -0.492814570076767, -0.8485099347051773, 0.1927814571650163 },
+  { 0.6522530685192448, 0.7577718117334191, -0.018649824382040107 },
+  { 0.2221419654032229, 0.7083729162725113, -0.6699707148065287 },
+  { 0.8822807591674283, -0.44114037958371416, -0.16424319621732555 },
+  { 0.3772778844921145, 0.9245060234535872, -0.05431399885103197 },
+  { -0.2913379432367928, 0.6146290802479435, 0.7330438571764464 },
+  { 0.8764634273956692, 0.3948285727245666, -0.27553994011416566 },
+  { 0.2734338128130796, -0.23869427102125393, 0.9318041612871956 },
+  { -0.0616247133157139, 0.5729631083282447, -0.817261078972682 },
+  { 0.7047723255035291, -0.6516033057624925, -0.28055142331440647 },
+  { 0.7931557977527722, -0.3524046180609471, -0.496704002058048 },
+  { 0.5741025713432342, 0.33163122018880004, -0.7486167052458651 },
+  { -0.1394332231320665, 0.11408172801714532, -0.9836380104589418 },
+  { 0.9330420397431173, 0.31361245937381127, 0.176294575632697 },
+  { 0.4104837116603744, 0.5576773658416198, 0.7214562204939914 },
+  { -0.21769301333322205, 0.9379458974471395, 0.26993933653319535 },
+  { -0.7708804333235956, -0.014523834251024263, -0.6368142710064485 },
+  { -0.521112009958895, 0.8242941869338967, -0.2213173433411558 },
+  { -0.7681740165498251, -0.23400914395303365, 0.5959432866003923 },
+  { -0.12941739073389308, 0.9106493110544714, 0.3923888011292466 },
+  { -0.5462443712021618, -0.11854158110057819, 0.8291953813668586 },
+  { 0.9230272596226091, -0.3355926586103927, -0.18814421458122194 },
+  { 0.9008642239825312, -0.23484067377322396, 0.3650938343632908 },
+  { -0.009801809355345647, 0.999784554245256, -0.01829671079664521 },
+  { 0.2911089586061203, 0.882424030774802, -0.3695719201054261 },
+  { -0.9578883032845501, 0.08076429587520076, -0.2755487741624496 },
+  { -0.38984972821104275, 0.9205238352319323, -0.025555003104489552 },
+  { -0.9370636977341888, -0.16508829910031755, 0.30766455741422816 },
+  { -0.1736001772411104, 0.11353945241361724, -0.9782493399984847 },
+  { -0.9342671953367425, 0.057165719210766484, 0.35196148690550344 },
+  { 0.6752445941220653, -0.6741563675400797, -0.2992623100460402 },
+  { -0.07243070447944128, -0.680848622106748, 0.7288339638243779 },
+  { -0.9358097902550186, 0.29313190829501173, 0.19578999157817764 },
+  { 0.1953616206639813, 0.38554809905871806, -0.9017685404158606 },
+  { 0.5891537891416475, 0.4030268549140841, -0.7003336111869121 },
+  { 0.610060179974677, 0.036499327007031956, 0.7915139770953501 },
+  { 0.4233291553323964, -0.5189014745973465, -0.7426531396999942 },
+  { 0.29317158424691175, 0.4238687065947483, 0.8569630924140498 },
+  { -0.321161420599255, 0.2022753508686536, 0.9251702677613627 },
+  { -0.6213116641949109, -0.3515893064444143, -0.7002547932926172 },
+  { -0.3491557866210294, -0.5338054814686892, 0.7701570908736938 },
+  { 0.534054911871503, 0.3923940199304941, -0.7488740109181973 },
+  { -0.4659249418783112, 0.878903867634087, -0.10218581111649325 },
+  { -0.5955170167514452, -0.09564709255663746, 0.7976284325705303 },
+  { -0.6126762001801576, -0.1534553473348432, -0.7752930607887227 },
+  { -0.7285358642735803, 0.3549277287486673, -0.5858854852549772 },
+  { 0.6592357435081581, 0.7202415063634928, 0.21601020113062402 },
+  { -0.8256617754567123, -0.4507208459171231, -0.33931305840686804 },
+  { -0.8778298360960096, 0.29464019650403794, -0.37762671179845686 },
+  { -0.9603379020852454, 0.25158775023717017, -0.12022777444962114 },
+  { -0.10301363561318957, 0.961460599056436, 0.2549150982970454 },
+  { 0.5224366931109989, -0.6869609555824185, -0.5051183496929548 },
+  { -0.7105211727479436, 0.29460633991987906, 0.63903581085562 },
+  { 0.6232423971609659, 0.7705113945997574, 0.13372024967442273 },
+  { 0.34600917578554935, 0.1375942921252477, 0.9280869900212786 },
+  { -0.07631138981777376, 0.2547453748328624, 0.9639924096098185 },
+  { 0.1231161098404916, 0.5354953127042741, -0.835516124063142 },
+  { 0.06124699822530332, 0.5394447151382485, 0.8397905718200244 },
+  { -0.95213451429108, -0.24691386403362856, 0.18020380252278856 },
+  { 0.31655669983239393, 0.565596061588648, -0.7615070261702344 },
+  { -0.21658908252870865, -0.42164073208978636, 0.8805159069387454 },
+  { 0.6507354761344397, 0.07110308961259175, -0.7559680487610755 },
+  { -0.9757240297824444, -0.08913517984762916, -0.20004383874200743 },
+  { -0.20154227561922863, -0.5689950433227947, -0.7972611565931917 },
+  { 0.09585143448209948, 0.04568619774380443, -0.9943466567769199 },
+  { -0.5260289320256211, 0.8132161953263032, 0.24894373326315403 },
+  { -0.5928286312143719, -0.42951358285118774, 0.6812285197779303 },
+  { 0.310701413233052, 0.21169268824153367, -0.9266341443957572 },
+  { -0.7023626109778355, -0.5616474764814124, -0.4373086722927629 },
+  { -0.3991252673841068, -0.2953065562148305, -0.8680397794986716 },
+  { -0.2705533212777497, 0.08851435819580701, -0.958627200082891 },
+  { -0.7796521528642354, -0.5683395348810323, -0.26293096741421457 },
+  { 0.6295603582043062, -0.7027535498887032, 0.33134755694963486 },
+  { -0.1394478791818123, 0.7406739812279867, -0.6572338567995252 },
+  { -0.8360904731785278, -0.524616558400456, -0.16040631942715514 },
+  { -0.7107053724163709, 0.5998213646806472, 0.3675761201318085 },
+  { -0.26365363137022335, 0.9581558798576408, -0.11146332383131392 },
+  { -0.6303641062330785, -0.35652221078112717, 0.6895890129582328 },
+  { -0.05484896527763858, -0.9245968432516217, 0.3769778089717064 },
+  { -0.581887463187819, -0.6526109394448366, 0.48528954439774635 },
+  { 0.16994385630872405, -0.9784646272320475, -0.11715826457646886 },
+  { -0.648864605072413, -0.34028656285084824, -0.6805731257016965 },
+  { -0.8660393830970163, 0.29524069878307374, 0.4034956216702008 },
+  { 0.7032279927307256, 0.564369679405597, -0.43238554000745494 },
+  { 0.10860215974584526, -0.8023137082347558, 0.5869397622219278 },
+  { 0.4128849850832294, 0.8731229765039721, -0.25919540311059874 },
+  { -0.5349799983412507, 0.15113399632112376, -0.8312369797661807 },
+  { -0.40808500620683946, -0.8212289174493009, 0.39881034697486584 },
+  { -0.9129179470911992, 0.3823797129224474, -0.14271151678871968 },
+  { -0.9661760746130301, -0.24180458393767315, 0.08963445783896504 },
+  { 0.27168069000982403, -0.9206094238618608, 0.2804779694958564 },
+  { -0.022773160045069574, -0.9852740713616865, -0.16945910268831182 },
+  { -0.41778471284899904, -0.17461899974167744, -0.8916076147268458 },
+  { -0.1769066713678357, -0.3198378892941665, -0.9308102675612281 },
+  { 0.22815398606206969, -0.9249485921435258, 0.30399977061783884 },
+  { 0.9033974419327859, 0.38394391282143403, 0.19094536840852067 },
+  { -0.8209574718973205, -0.46792910670009547, -0.32721732906252227 },
+  { -0.19501609384999835, -0.7268781679863575, 0.6584959013116827 },
+  { 0.679581280470397, -0.48323355898617315, 0.5519552615056516 },
+  { 0.2711463400574687, 0.8894195879907077, -0.36798431864942177 },
+  { -0.7514402047092157, -0.5316205597631588, 0.3907904799041011 },
+  { -0.5317632504353138, -0.7953723831297429, -0.2908790429731631 },
+  { -0.6118959144825765, 0.31367221960852165, 0.7260806625199399 },
+  { 0.8909425881819987, -0.29276537851544737, 0.34714512484877025 },
+  { -0.9709256341040234, -0.20601872852868044, 0.12190035494257563 },
+  { 0.8568551368674139, -0.2670950112829386, 0.44097565621210005 },
+  { 0.040515118476145424, -0.8615663969825211, -0.5060255613755306 },
+  { -0.46633819005172966, -0.8845672133168297, 0.008338922243015799 },
+  { 0.6294467562204574, -0.635632965126801, 0.44695359348332236 },
+  { 0.022031306760275548, 0.9421282496170466, -0.3345280000178682 },
+  { -0.9972494582723181, 0.06688500898382316, -0.0319360853706543 },
+  { 0.8853589151221205, 0.17427099911015376, 0.43100952458493386 },
+  { 0.5903688694034019, 0.7568528905751613, -0.28042521296661593 },
+  { 0.9345211923474545, -0.06455408128465956, 0.3500041594652636 },
+  { -0.7119251406663131, 0.13327977610249792, -0.6894919110252986 },
+  { 0.45448486319808107, 0.4997447665871016, 0.7373592593794593 },
+  { 0.907132945878865, 0.4144045325757452, 0.07333963377199615 },
+  { -0.6317827465674238, 0.0967463138595127, -0.7690843334084494 },
+  { 0.867521617885401, 0.318558746521429, -0.3820033606085061 },
+  { -0.19277605918734586, 0.2795252858216515, -0.9405865221182583 },
+  { 0.7993066564318654, -0.3881284415417988, -0.4587648437381032 },
+  { -0.9770205502416914, -0.09142011421498315, -0.19254403943602597 },
+  { 0.9724876774688785, 0.009369810279872562, 0.2327658132684131 },
+  { 0.01303015243882806, 0.9105777116075139, -0.41313248026637206 },
+  { 0.46680653698150076, 0.5861651261221297, -0.662194912355544 },
+  { -0.07670536588858863, -0.11280200865968917, 0.9906523071624258 },
+  { -0.3537199222272428, -0.8163708931680655, 0.4565312491029812 },
+  { -0.7914911738684806, -0.24019047457209172, 0.5620055672438915 },
+  { 0.13660966356773677, 0.4118781356567264, 0.900940731229224 },
+  { 0.46532593358634144, 0.8580549717919318, 0.2172865410354422 },
+  { 0.11309482781799364, -0.7351163808169586, 0.6684410718794848 },
+  { -0.5680671877540407, 0.4257114485794005, -0.7043219666783394 },
+  { -0.8443103168451424, 0.19026711365524335, -0.5009376351704453 },
+  { -0.9859668661441283, 0.10465152483713265, -0.130066895154722 },
+  { -0.48354710598064654, 0.4615211255175451, -0.7437610147075199 },
+  { 0.8642564294709421, -0.4556585787665505, -0.2131574153403669 },
+  { -0.8922641735826013, -0.05388068681054356, -0.4482873142637224 },
+  { 0.6136499545050048, -0.39597376743460205, 0.6831094413340026 },
+  { -0.15614214340158766, 0.7718828926460112, -0.616292488267044 },
+  { -0.6658580998110355, 0.6124330859318722, 0.4260970619143026 },
+  { -0.44433272476864366, 0.8706248727421695, 0.21114156545397203 },
+  { -0.504820289665085, -0.7165191208149594, 0.4814112842975508 },
+  { 0.6317034559676814, 0.7433009870867694, 0.2201235705559992 },
+  { 0.18768424280668103, 0.5711172857281427, -0.7991243150753216 },
+  { -0.6133662937081695, 0.22654166609180337, 0.7566113026297278 },
+  { 0.5733730132544413, -0.6877580335754031, 0.4452328322619715 },
+  { -0.6397522950208526, 0.3348859771642002, -0.6917863711539355 },
+  { -0.7239413396121682, -0.5170121841693768, 0.45673552327462974 },
+  { -0.9310055470073421, -0.307379609170678, 0.19684117279583804 },
+  { 0.7437668555168222, -0.6649275688320391, 0.06842655070754765 },
+  { -0.33882744931311803, -0.9405625045247965, 0.023197729932225925 },
+  { -0.20377264416974158, -0.9710550235627301, -0.12461480931918813 },
+  { -0.7960475781167712, -0.6016212111112925, 0.06603159634148333 },
+  { 0.945855966448387, -0.2595461599907179, 0.19491608853057868 },
+  { 0.4467746243677466, -0.8795538990565036, -0.16363793470818672 },
+  { -0.04039619859921239, 0.12455494568090487, 0.9913900406223375 },
+  { -0.7448840737098747, 0.6183381451315816, -0.2506105644393649 },
+  { -0.7820878982964519, 0.5537529432459621, -0.28582546629835653 },
+  { -0.3037078125723446, -0.9125835714313238, 0.27377507142939717 },
+  { 0.5925658547221059, 0.7953574811771412, 0.12756247470558674 },
+  { -0.5382024600406864, 0.8408882037602509, -0.05696613716070456 },
+  { 0.7242648561131408, 0.6861983768153547, 0.06761808822633057 },
+  { 0.1589050083301161, 0.29520428325762155, 0.9421271832793913 },
+  { -0.6787126586180795, 0.17910472935754876, -0.7122293331177378 },
+  { -0.2806866436651742, 0.1946224463044239, -0.9398601552691024 },
+  { 0.751532367315669, -0.30419167248491363, 0.585377252092817 },
+  { -0.26159045344082277, 0.9584197240025586, -0.11402660791010223 },
+  { -0.05344091373783545, -0.9437437957958176, -0.3263306860161442 },
+  { -0.019855301656559493, 0.9276838162870297, 0.3728384422176172 },
+  { -0.3625982016190058, 0.5484954680287497, -0.7534422776394921 },
+  { -0.4623834492754021, 0.8839683589088569, -0.06929275780457707 },
+  { 0.3139426135498044, -0.7610730025449804, -0.5676336143981312 },
+  { 0.9732815241744742, -0.20811325195370592, -0.09701520015887043 },
+  { -0.90019018683895, 0.12821500796885865, 0.4161953138256145 },
+  { 0.3311878195092871, -0.36286066711308584, 0.8710033091044661 },
+  { 0.9142654921176044, 0.3258922476166788, 0.24065089417308178 },
+  { -0.09100351152355694, 0.9149103033529028, -0.3932651747982282 },
+  { -0.46466223737235657, 0.4033183608148528, 0.7883040688653941 },
+  { 0.3784161706008323, -0.8917758921746474, 0.24806644263969585 },
+  { -0.8046956000766649, 0.5481817125436939, 0.22795131333229754 },
+  { 0.48694195285450304, -0.6647636426442579, 0.5665481744464281 },
+  { -0.006676994319489239, -0.9621548814383993, -0.27242136823516094 },
+  { -0.6033171605010919, -0.3868714398854445, -0.6973800203948078 },
+  { 0.021413944387259465, 0.6477718177145988, 0.7615333972719147 },
+  { 0.31643512327894846, -0.10949659821398533, 0.9422734782084242 },
+  { 0.35456473456517457, 0.3685377290307972, 0.8593391596357924 },
+  { -0.06028274868578796, 0.47924785205201426, -0.8756069246610702 },
+  { 0.3174843652587974, -0.04040710103293785, 0.9474022081472749 },
+  { 0.09151163074381098, 0.14340542134853307, 0.9854240237412817 },
+  { 0.3493345006199923, -0.8012904038366021, 0.48569444653604565 },
+  { 0.9698087679784354, -0.07903727844758174, 0.23070340736050884 },
+  { -0.14093684013307223, 0.4661259712658031, -0.8734205092650484 },
+  { 0.859397002893509, 0.2186924860219489, -0.46218003848629563 },
+  { -0.9057013285756882, 0.3459021268379484, 0.2450649343851896 },
+  { 0.1570140849128977, 0.9573690664158098, 0.2424686532504482 },
+  { 0.2326586167529879, -0.20072508112022486, -0.9516193618563388 },
+  { 0.5116851480183725, -0.7390374576612797, -0.4381802659533725 },
+  { 0.4852736405316185, -0.15818969164388544, 0.8599334365302945 },
+  { 0.47096192998250014, -0.2635942455871386, -0.8418508978438557 },
+  { 0.836096785969544, 0.5484075692918514, 0.01383121234027368 },
+  { -0.42839828952773285, -0.6826938259222738, 0.5919493606528525 },
+  { -0.07058854402920148, 0.9332044803860534, -0.3523445121457599 },
+  { -0.618472697067381, -0.23444676852811525, -0.7500174902686764 },
+  { 0.1930884489178064, 0.03450169776901243, 0.9805745681719322 },
+  { -0.27678279861332056, 0.36543978879414984, -0.888732267422459 },
+  { 0.41129096179228114, 0.892395149571444, -0.18566270968975052 },
+  { -0.8251146978027062, -0.1683785258406394, -0.5392906521586315 },
+  { 0.44903821670846505, -0.27897058646007633, -0.8488463299239756 },
+  { 0.4020328857817925, 0.7746743334385453, 0.48810781171940865 },
+  { 0.14127964050750907, 0.9225666750433956, 0.35904149241757943 },
+  { 0.3238203489358794, 0.23725451308173343, 0.9158879176173222 },
+  { -0.2546978777542343, -0.6769151650380992, 0.6905902188772527 },
+  { -0.9999318757261068, 0.009337885220788546, -0.00700341391559141 },
+  { 0.2530851513266565, 0.18945639859198862, -0.9487118525719581 },
+  { -0.8184448985227882, 0.3577235483394596, 0.4496463177269987 },
+  { 0.1010878808836673, -0.9819965571556252, 0.1595744405377891 },
+  { 0.11322990288385099, 0.7915846151834831, 0.600477132035626 },
+  { -0.11143818420938033, 0.3976004350186533, 0.9107663944025899 },
+  { 0.06835239390562828, 0.9548303640970843, 0.28918320498535044 },
+  { -0.7994098776538575, -0.600689716848968, 0.010756931781461256 },
+  { -0.16386405947136135, -0.8251959010828716, -0.5405555427979569 },
+  { 0.5560054810100598, 0.05632553017253364, -0.829267954124332 },
+  { -0.8792987756163857, -0.4431709171005567, -0.1744511434063316 },
+  { 0.6793634862570704, -0.09065928473575961, -0.7281800241917102 },
+  { 0.2843461475151551, -0.7501369520985471, -0.5970274880519252 },
+  { -0.710903866413978, -0.5203918590476422, 0.47308350822512923 },
+  { 0.7645888496726682, -0.27525198588216054, -0.5827866120838336 },
+  { 0.19368613249629993, 0.16004590948378467, 0.9679209621328252 },
+  { 0.6155559531000563, -0.7647816387000699, -0.1902627491400174 },
+  { -0.43261207365601206, -0.6794315012591287, -0.592637856387703 },
+  { 0.6077328384918966, 0.438984886301953, 0.6617802253142985 },
+  { -0.32364664498821966, -0.6463213781296279, -0.6910293230829555 },
+  { 0.9167243236547711, -0.3548610285115243, 0.18354880785078842 },
+  { -0.571189570053995, -0.19720232758620923, 0.7967770811564009 },
+  { -0.7973933684007617, 0.0647785715141818, -0.5999729599765886 },
+  { 0.5860421565837471, 0.331478544113415, -0.7393757945044735 },
+  { 0.3932469402378927, -0.782646063056628, -0.4825163043623459 },
+  { 0.3432373185544189, -0.6707630697102202, -0.6574686665267743 },
+  { 0.4363508035723206, -0.7784082144203692, -0.4513076865561706 },
+  { 0.7951495146267985, 0.6010285063611013, 0.08063488035652042 },
+  { 0.39977009419804094, 0.39438763270945043, 0.8274311252005964 },
+  { -0.649015582644988, -0.13382412304296462, 0.7489124632263561 },
+  { -0.6479630803799571, 0.7468145908788395, 0.14970575578443454 },
+  { 0.06508842878010071, -0.8895418599947097, -0.45219329468280495 },
+  { 0.6648039328866425, -0.7469952287468072, -0.005818852804259453 },
+  { -0.18216701066791835, 0.9381874573437836, -0.2943118670851053 },
+  { 0.6566181854913445, 0.177788644908786, 0.7329691372926637 },
+  { -0.9037768482961658, 0.4222202205008132, 0.07012484498445562 },
+  { 0.9640351756155251, 0.24744229353581237, -0.09699737906603846 },
+  { 0.8071759762606466, -0.43196723060619546, -0.40233226943670064 },
+  { -0.5298850528584929, -0.5499043228602304, -0.6456214575560385 },
+  { -0.679592305041857, 0.45038069919933715, 0.5790608989705763 },
+  { -0.29380667431300833, -0.48913066449875126, 0.8212361604168072 },
+  { 0.9765395804943109, 0.022607990287971187, -0.21414790800550484 },
+  { -0.16555182695279266, 0.8546053769725243, -0.4921811071569511 },
+  { 0.443163234614293, 0.27279623640172285, -0.8539253836789561 },
+  { -0.13676792357305528, -0.24789186147616274, 0.9590850640560503 },
+  { 0.8548152779279244, 0.23124182290451453, 0.4645622239924404 },
+  { -0.11254668358936512, -0.9745634350271931, 0.19380236097899645 },
+  { -0.6019386874008065, -0.453854694614546, -0.6570279543417703 },
+  { -0.27700805286798086, -0.1506165458559744, 0.948989565148482 },
+  { 0.8700144554499691, -0.4581982430964296, 0.18201433276376575 },
+  { -0.0977876942316152, -0.8501141257321321, -0.5174394071652804 },
+  { -0.6335444447017484, -0.7336514674557264, 0.24571723766885492 },
+  { 0.05201047186182307, -0.654927980628976, 0.7538993639776878 },
+  { -0.1034472314797712, -0.15551798558032717, 0.982401560697156 },
+  { -0.4750721268412122, -0.387897561694241, -0.7898366640832961 },
+  { -0.840429616933427, 0.4191345647431487, -0.3435175040936116 },
+  { -0.948458806438816, -0.055297962686698274, 0.31203850373208314 },
+  { 0.4720348138513296, -0.45753374435801547, 0.7535555767732561 },
+  { 0.4419908813456438, -0.5299957398115729, 0.7237047578874167 },
+  { 0.3734220363142923, 0.2802121676554986, -0.8843286289003054 },
+  { -0.014169020772458428, -0.45517979231522704, -0.8902868052028046 },
+  { -0.44648389992206355, -0.6605809989208362, 0.6035601635091028 },
+  { -0.40781547203136254, 0.21088836121261448, 0.8883764066412924 },
+  { -0.6186278763240254, 0.5858218525795695, 0.5235573585339696 },
+  { 0.5712615876725133, -0.817007000387491, 0.07848413704509756 },
+  { -0.8399985138444541, 0.2491210545731839, -0.4820178387855092 },
+  { 0.08668338184621636, 0.9522876487928309, 0.29263326070070206 },
+  { -0.7015417824541677, -0.20307788439462748, 0.6830801566001106 },
+  { 0.3758360879358716, -0.36369602587603184, -0.8523335237845808 },
+  { 0.5255844609271778, -0.6533038071024124, -0.5449358770143345 },
+  { 0.5941629581922798, -0.7445285225505226, 0.3043807783368313 },
+  { 0.7092942234521492, 0.08936981342520424, -0.6992243853197317 },
+  { 0.7263568506226301, -0.6657761191890662, 0.1707275158582256 },
+  { -0.9091959033476549, -0.02680675882106108, -0.41550476172644674 },
+  { 0.02634862394648593, 0.7308014566289494, 0.6820813595203526 },
+  { 0.7765956765365308, 0.5246466975075037, -0.3487764297931239 },
+  { -0.4043983980129771, -0.1890626905360033, 0.8948280475777596 },
+  { 0.029259770810644056, 0.9618371468605333, -0.2720536137074777 },
+  { -0.5968607357621976, 0.5644415299400025, -0.5702306738368231 },
+  { -0.5508322955578286, -0.6871075686784938, -0.47377945421390116 },
+  { 0.17052845971861721, 0.5370057706667014, 0.8261627241026176 },
+  { -0.701434261173761, 0.6101554417491352, 0.36837523553509677 },
+  { -0.9020702061982859, -0.2406504805406229, -0.35826901806456746 },
+  { -0.4632272679140811, -0.14417019782138782, -0.8744343613565274 },
+  { -0.7109103926270116, -0.7032825987147047, 0.0 },
+  { 0.6079347524615649, -0.7873988860295545, -0.1020702259667941 },
+  { -0.005964302771993467, -0.6983656336661441, 0.715716332639216 },
+  { -0.9205846132148118, 0.38199516166903275, -0.08126294588300852 },
+  { 0.13034721531073573, -0.7048972937784493, -0.6972298105248766 },
+  { 0.4852023925102507, 0.8288662067226529, -0.27849497240619847 },
+  { 0.16458022834947877, -0.1045306855733176, 0.9808091986772992 },
+  { -0.01667037641444736, 0.2471138150847491, 0.9688430527925878 },
+  { 0.9462287570195275, 0.0056745352744799245, 0.3234485106453557 },
+  { -0.4386833519580983, -0.6948024621483512, -0.5699179373448394 },
+  { 0.49779915191314067, 0.8208314073272794, 0.28005678906192516 },
+  { -0.6238425342911736, -0.7784701709958235, -0.06931583714346373 },
+  { 0.31054651947589784, -0.15301565176114512, -0.9381615370273488 },
+  { -0.267355894194031, 0.4986108946514903, 0.8245653409976377 },
+  { 0.5809190690449466, 0.8134854713657637, 0.027828458397362716 },
+  { -0.129132751453223, 0.3066902847014046, -0.9430089086386679 },
+  { -0.9718630177623852, -0.12753684120137612, 0.1980318884477064 },
+  { -0.9750686342711128, 0.05060076108655692, 0.21605721797275892 },
+  { -0.2279723974174581, -0.4937764211304857, 0.8391742560108155 },
+  { 0.2689826254209927, 0.28076288638833546, -0.9213145764875973 },
+  { -0.8703128765190289, -0.08265541285376252, 0.4855137276031933 },
+  { 0.24397908172510954, -0.7984769947367222, -0.550371416914782 },
+  { 0.5546172665118104, 0.2502639776108606, 0.7935789999725031 },
+  { -0.9630509215865236, 0.18710703619395314, 0.19371081394197504 },
+  { 0.4145806640131896, 0.812765482556931, 0.4093105708265813 },
+  { 0.14291642568911236, -0.9662393128111727, -0.21437463853366856 },
+  { 0.42403882341948224, 0.37508357725220753, -0.8243199538460223 },
+  { -0.7050237283653467, 0.4424215775978498, -0.5542604894069716 },
+  { -0.4058663991924123, -0.4216452224871497, -0.8108561970906725 },
+  { -0.4189728570388426, -0.9029848218490579, -0.09528985557201114 },
+  { -0.11716024410185087, 0.9230993969498461, -0.3662799210342075 },
+  { 0.6458376686387248, -0.20915204499761783, -0.7342677494215657 },
+  { -0.25737658731421886, 0.023307706365642174, -0.9660300425589564 },
+  { 0.26292590615232975, 0.9600348627345878, 0.09593242521774194 },
+  { 0.2217971719968306, -0.19767599414041137, -0.9548456502675228 },
+  { 0.9369814241603043, -0.2558108015167815, -0.23796353629468045 },
+  { 0.6012186241382939, -0.6213183618184335, -0.5024934420034904 },
+  { -0.9263985514278404, 0.21099468786968606, -0.3118765230073797 },
+  { 0.1816935453763818, 0.09741400926806011, -0.978518250400514 },
+  { 0.5363086206608926, 0.8034085890110095, 0.25866523250748163 },
+  { -0.9894335776706116, -0.09452532621567629, -0.1099370641856235 },
+  { -0.18932174363863047, -0.9154470647371045, 0.35512525825382857 },
+  { -0.3027466758468586, -0.8806438158011839, 0.36443232561726413 },
+  { 0.8556738809530493, -0.4736221065203858, 0.2085768675331452 },
+  { -0.7050154223810488, 0.579012666040606, -0.40950895810643895 },
+  { 0.7104605412453175, -0.640358172849195, -0.29186851457231733 },
+  { -0.786138985676469, -0.177667410762882, 0.5919626562143812 },
+  { 0.8061567172996764, 0.33145119387234084, 0.49015451975189384 },
+  { -0.8495450623285014, 0.46139085281634123, 0.25571794620376587 },
+  { -0.5994701613054204, -0.5390357710599959, -0.5916721754673011 },
+  { 0.8754301979243517, 0.30321632262526405, -0.37640646946584505 },
+  { -0.5939349891865077, -0.8045073602466944, 0.003022569919524212 },
+  { -0.01805885277197056, 0.5907824692544655, -0.8066287571480184 },
+  { 0.550803745478204, 0.03240022032224729, 0.834005671257847 },
+  { 0.29140250483038105, 0.343691552426113, 0.8927265521812983 },
+  { -0.39833916775880857, -0.8448645251658602, 0.3571132055042007 },
+  { 0.6687282206920236, -0.35792499968073826, 0.6516841730881789 },
+  { -0.9373449642194694, 0.009879788819177544, 0.3482625558760084 },
+  { 0.41652757738258855, -0.8753826994476493, -0.24537707062302713 },
+  { -0.8093040475526371, 0.2628949453833407, 0.525274410481616 },
+  { 0.23465590037090556, 0.9262992369683435, -0.29479879920546537 },
+  { -0.31412839257659353, -0.7760088749421777, 0.5469310550592469 },
+  { -0.17596113625462, 0.9831479358988292, 0.049576351881261985 },
+  { -0.9155582907835642, -0.21641454859161263, -0.3389952202249571 },
+  { -0.8268962507367673, 0.495379999009541, -0.26616019067243024 },
+  { -0.6092737493431345, 0.775240792174956, -0.16669496845827692 },
+  { -0.047221224300941535, -0.6018194331119996, 0.7972349251658959 },
+  { -0.48863462516433714, -0.5732060025966262, -0.6577773800289154 },
+  { 0.3009904964098084, -0.4770699368095463, 0.8257172618175743 },
+  { -0.4338305122453462, 0.7555097929969263, 0.49091347438289173 },
+  { 0.19346539272437266, -0.7527322447296411, -0.6292577449362701 },
+  { -0.7569696795587827, 0.5882885468128117, -0.2844529660902554 },
+  { -0.7282183086200658, 0.01723593629869978, 0.6851284678733163 },
+  { 0.21099028493492278, 0.5505527747520641, -0.8076971845165013 },
+  { -0.22377867605211205, -0.4893293716339517, -0.8428996797962888 },
+  { -0.6150673839681402, -0.6285483129318254, 0.47604530403013584 },
+  { 0.37429593615999857, 0.4169576235072672, -0.8282806845347066 },
+  { 0.10035247018790562, -0.577488448075187, -0.810207673418919 },
+  { -0.2605658662172119, 0.41569345168606364, 0.8713807340008157 },
+  { -0.9118573035804437, -0.19661067386509268, 0.36036162507863784 },
+  { -0.36603512618521056, 0.8640958810376569, 0.34548023788971277 },
+  { 0.2994706096084426, 0.9203913231085162, -0.25139046586396785 },
+  { 0.7892912906928767, -0.5376331980081914, -0.29659703780695057 },
+  { 0.024825948486547997, -0.251080615375315, 0.967647764873405 },
+  { -0.33371559798210365, 0.6142140906381575, -0.7151048528187934 },
+  { -0.4391143450722835, 0.7838094053425738, 0.4391143450722835 },
+  { 0.5518649801024188, -0.2761835660203188, 0.7868720871887991 },
+  { 0.05281326274549786, -0.41260361519920197, 0.9093783678990411 },
+  { 0.29657009931034634, 0.09597737841758781, 0.9501760463341193 },
+  { 0.41412474038065183, 0.09185473564834007, 0.9055735237647087 },
+  { -0.38059007881452583, 0.4034412429669508, 0.832097563619336 },
+  { -0.4191823949204781, 0.8596685288952106, -0.29198654115537037 },
+  { -0.5839613369005726, 0.8102601536578833, -0.04967535001989748 },
+  { 0.22840277820886257, -0.2169076712092918, -0.9490960083558644 },
+  { -0.2729665569926176, 0.5094615907127352, -0.8160503332221889 },
+  { -0.7747721659582582, -0.574797187987951, -0.263317837484462 },
+  { -0.7277975480715948, 0.004001636003142789, 0.6857803700385956 },
+  { -0.8308357460362703, -0.14734796989442253, -0.5366568166681074 },
+  { 0.3872565794688456, -0.9217513375899086, -0.020169613514002375 },
+  { 0.41158178979713456, -0.6965230288874584, 0.5877551365465283 },
+  { -0.6734839160983761, -0.20736215311450001, -0.7095212133632892 },
+  { 0.04009430880166575, -0.7191518880298778, -0.6936951840288201 },
+  { -0.8811894955963143, -0.3937229661175021, 0.26170078105032385 },
+  { 0.668041633649017, 0.729887022585665, 0.14486307318494113 },
+  { 0.6541309775261613, -0.7392512744602587, 0.16006316706085702 },
+  { -0.9073221468483205, 0.3326847871777175, 0.2570746082736908 },
+  { 0.18104398675376038, -0.9231253830081847, 0.33920878836830926 },
+  { -0.4994199258214935, 0.07398813715873978, -0.8631949335186307 },
+  { -0.30818270167813533, 0.0684222145010172, -0.9488634374603873 },
+  { 0.604354917013835, 0.4977040493055112, 0.622130061631889 },
+  { -0.656221185583678, -0.7066997383208841, 0.26447917772169904 },
+  { 0.08880070351134457, -0.8564971080610332, 0.5084556410730213 },
+  { -0.3323526094856096, 0.2621097879113516, 0.9060023190087165 },
+  { -0.573524160743981, 0.6598736783331054, -0.4854243150956178 },
+  { -0.18552614580365914, -0.9125880685477288, 0.36436666473151075 },
+  { -0.910607413694866, -0.3992545152793679, 0.1067238031227541 },
+  { -0.3497559565916839, -0.19720282658892815, 0.9158503240235127 },
+  { 0.28006769090488165, -0.6233994033593432, -0.7300241587799834 },
+  { -0.9721092865734847, 0.022772691925586758, -0.23342009223726426 },
+  { 0.18408696807060912, -0.4445026789997635, 0.8766580613606447 },
+  { 0.5872387794283855, -0.2150545643484904, -0.7803218248186711 },
+  { 0.04290649260910295, 0.8059903168596049, -0.5903716134948723 },
+  { 0.35741442521789085, 0.9075916865083521, -0.22030038408293753 },
+  { -0.18530385399476307, 0.23531665887916278, -0.9540904316408562 },
+  { 0.08517167926623691, -0.48577226726329603, 0.8699259102985991 },
+  { -0.22567317979491436, -0.6535535229016436, 0.7224537415115954 },
+  { -0.16405991887041846, -0.8349915273852642, 0.5252366059358919 },
+  { -0.8969651848923987, -0.06103609246309222, 0.4378676198439224 },
+  { 0.650941427670828, -0.6943375228488832, -0.3068723873305332 },
+  { -0.09740062928614698, -0.8708423127299888, -0.48181613066993423 },
+  { -0.05331589585013581, 0.988972321614491, -0.13817077234401393 },
+  { -0.696647150086603, 0.2345051674235185, -0.6780044798730179 },
+  { -0.029331798302486483, -0.9842447874834354, 0.17436124546478077 },
+  { 0.37898096379055685, -0.9095543130973365, 0.1705414337057506 },
+  { -0.7784274310832473, 0.6146251764269107, -0.12761907004568313 },
+  { 0.7322685234130341, 0.4631784483511685, 0.4992479690509505 },
+  { 0.866649240355587, -0.3357888345907361, -0.36900535599809314 },
+  { -0.05667151232700247, -0.9961592500146434, -0.0667464478518029 },
+  { 0.8074205644071, -0.37514846631976145, 0.4553412570703986 },
+  { 0.6444837306156234, 0.27264740082146915, -0.7143557347687955 },
+  { -0.5706141953434921, -0.3167458963132608, 0.7576750472605047 },
+  { -0.9054840216762924, -0.11152101002263161, 0.40946520097861755 },
+  { 0.8820424753855731, -0.14863146684674022, 0.4471126912520792 },
+  { 0.09269619789668289, -0.7721048013041352, 0.6286983304404434 },
+  { -0.7725768193194473, 0.6160804892521747, 0.15352488076219786 },
+  { -0.9825763130999791, -0.062331830704150916, 0.17509577897802395 },
+  { 0.8570233489930429, -0.015544558929740803, 0.5150430525387453 },
+  { -0.3685501415212086, 0.831990148782586, 0.41468444088659456 },
+  { -0.32471119446567465, 0.945452468428447, -0.026120301132096856 },
+  { -0.6133064347900075, -0.46932230762604515, -0.6352887442806887 },
+  { -0.24735975626681458, -0.2776599491280057, -0.9282877267473999 },
+  { 0.2673065118391705, 0.9575922933702083, 0.1075371024640341 },
+  { -0.7398750752313673, -0.5448946871712821, -0.39455627348185607 },
+  { -0.19961594534046903, 0.978714000661852, -0.047669479484291115 },
+  { -0.7665784971563383, -0.27470140075163896, 0.5804279008822865 },
+  { -0.13916041538309318, 0.8825981729489255, -0.4490599557939045 },
+  { 0.593445382291064, -0.7897029102928332, 0.15553742865446335 },
+  { 0.024383526637705436, -0.9201878504943599, -0.39071698636132757 },
+  { -0.19346141565521366, 0.9776710826861691, 0.0820483682466308 },
+  { -0.12014587054726872, -0.7574195922417398, 0.6417791918399938 },
+  { -0.10159930457395845, 0.4981325127169807, 0.8611280863404439 },
+  { 0.03258268486642047, -0.5168508246457678, -0.8554551967870002 },
+  { 0.2994296382864559, -0.7160273959023946, -0.6305923088913135 },
+  { -0.37249304174958314, -0.5693389581213141, -0.7328724886455213 },
+  { 0.043291025847039456, -0.5024851214388508, -0.8635013548418407 },
+  { -0.7025237945504336, -0.23440107264980617, -0.671949741596111 },
+  { -0.8005497288651539, -0.15560886296013432, -0.5787106473724004 },
+  { -0.9038132558656807, -0.3329236170340672, 0.26885584193472783 },
+  { 0.8029252267863984, 0.2773278243630481, 0.5276365776024904 },
+  { -0.3048942950738811, -0.9299030513203395, 0.2057177288823771 },
+  { 0.28509579650660183, 0.8835237144134306, 0.371626469567711 },
+  { 0.0, 0.9934043066827765, 0.11466422050540558 },
+  { 0.5080028982591139, 0.328238587643268, 0.7963620313289008 },
+  { -0.42207292645773925, 0.9038486653910505, 0.07008591029741057 },
+  { -0.22943337000733993, -0.6032418850436889, 0.7638452440488268 },
+  { -0.5578999880376826, -0.7041405632602468, 0.43924215476101125 },
+  { -0.10876370212227814, 0.1306624340932066, 0.9854429386917817 },
+  { -0.2680204182039481, -0.06131599190043153, 0.9614600379438799 },
+  { 0.33887866208819156, 0.6097928014177486, -0.7164593440806055 },
+  { -0.7439370079129889, 0.5249425640251827, 0.41351303816462237 },
+  { -0.3615446874631899, 0.9250459776890211, -0.11651342467075455 },
+  { -0.39757915835660546, -0.753894841652357, -0.5230424271227151 },
+  { 0.9111661780195554, -0.3780954948597431, -0.16376810678517942 },
+  { 0.3624071293431734, -0.4288484363894218, -0.8274962786669126 },
+  { -0.504048457002393, 0.862003187921423, -0.05371831165264546 },
+  { 0.7900563954104136, 0.6119007159737249, -0.037261318574993714 },
+  { -0.14174807181232668, -0.017407657941864683, -0.9897496944088776 },
+  { 0.5955423927609852, -0.5860893389076363, 0.5493892474769873 },
+  { 0.5139910705196346, 0.22159308907606695, 0.8286794810418598 },
+  { 0.38893136696725156, 0.08981346827557013, -0.9168783630914725 },
+  { -0.023532097344649183, -0.6933759845504771, 0.7201916303618215 },
+  { -0.18783789293450912, -0.04990861889564252, -0.980931218657992 },
+  { 0.8632980858997609, 0.3764509556161362, 0.3361563518625028 },
+  { 0.8429646460617142, -0.5059015792824855, 0.18295955173080178 },
+  { -0.9173067312840498, -0.030833839707026887, -0.39698568622797115 },
+  { -0.43939032095510244, 0.7302006778878147, 0.5232046596343994 },
+  { 0.26642282626982555, -0.664601203235931, 0.6980860393244883 },
+  { 0.6781490538968996, 0.5995230766334909, 0.425071689580303 },
+  { -0.8041270012744961, 0.4747744172616275, 0.35772757586628495 },
+  { -0.7275601828123751, -0.6576321369731645, -0.1953871869036767 },
+  { 0.1875325553272081, -0.9821104277363204, -0.017048414120655282 },
+  { -0.3218360983590523, -0.10773912305582009, 0.9406454205258139 },
+  { 0.8311342957275409, 0.5398629074050063, 0.13328099517072278 },
+  { 0.4900329352800848, 0.8367543517518429, -0.24435604589438192 },
+  { 0.5563821294235767, 0.7688798824684848, -0.3150597600350374 },
+  { 0.660001171525753, 0.002444448783428715, -0.7512605927737583 },
+  { 0.6968028309562049, -0.4154786994925647, 0.5846736397678501 },
+  { 0.34396443812641164, -0.7645391374718876, 0.5451315186064039 },
+  { 0.7896182968380439, 0.6128723408597608, 0.029840226333995846 },
+  { 0.3306792646961636, -0.6302879944544327, -0.7024160219888308 },
+  { 0.34556655233006967, 0.796373827415206, -0.49635922971046376 },
+  { 0.9333172016467678, -0.17248038433523655, -0.3149119212253099 },
+  { 0.8796384030722554, 0.3543221610845541, 0.3173201632497747 },
+  { -0.709501677031598, -0.6517884809148488, 0.26791630490894675 },
+  { 0.4063236435329153, 0.026499368056494475, 0.9133448856805095 },
+  { 0.9612236402670062, -0.24500550413585362, 0.1265757335944819 },
+  { 0.37026387525247506, 0.2643148748037247, 0.8905292300876547 },
+  { -0.6641237052993516, -0.6469582975866233, -0.37467941662610477 },
+  { 0.5707321314945544, -0.8078333235425036, -0.14720786478295061 },
+  { -0.9603326584897769, -0.2535071695260648, -0.11616927320440851 },
+  { -0.8135402748818473, 0.21667153049617038, -0.5396347551980093 },
+  { -0.9752485318874605, 0.21552453743369293, 0.049391039828554625 },
+  { 0.34051500370959836, 0.8693028336133263, 0.35827659108640303 },
+  { 0.16837670631516294, 0.07279652979302424, -0.9830310015561823 },
+  { 0.1309635795003259, 0.6018209626065558, 0.7878198206517658 },
+  { 0.2578763313357779, 0.5085728112190515, -0.821494670357362 },
+  { 0.330839191995899, -0.7533466739654727, 0.5683433978367837 },
+  { -0.3229233644885232, 0.33107482805813643, 0.8866284221102365 },
+  { -0.42813578726745644, 0.7577933591928062, -0.49239107671053306 },
+  { -0.7351342215242992, -0.6006584492942445, 0.3143041578396573 },
+  { 0.628133642993364, 0.5750194011226016, -0.5242144741157855 },
+  { 0.9004515260892987, 0.3815663341803403, -0.2087921976119561 },
+  { 0.38498212883566063, -0.08830575993413543, -0.9186897480867072 },
+  { 0.24249434456899852, -0.959372669329828, 0.14422404166785918 },
+  { -0.41047816646498686, -0.26357655460785606, -0.8729462037929911 },
+  { -0.9372175772602738, -0.21188770332940984, 0.27699605421769213 },
+  { 0.02250766396209522, 0.7712184857600274, 0.6361725019874561 },
+  { -0.110062720527914, -0.984392743413212, -0.1373212447708086 },
+  { -0.898241452559782, -0.05195483980101567, -0.4364206543285316 },
+  { -0.5728604290505018, 0.7998428632025875, -0.17911539021525125 },
+  { -0.24711146244802923, -0.03545282223558449, -0.9683382789719347 },
+  { -0.2661509492263065, -0.20138417831192013, -0.9426601110429829 },
+  { 0.45212438744032657, 0.6569194061415198, 0.6033576320196693 },
+  { 0.8177214474234619, -0.42051286593277454, 0.39306559758987175 },
+  { 0.7395700428958503, 0.2635187888692761, -0.6193496585644493 },
+  { 0.008442739795721119, -0.9811669748313044, 0.19297690961648273 },
+  { 0.870127126319529, 0.09591348394174704, 0.48340395906640504 },
+  { -0.42165496680787135, -0.8961884880851336, 0.13803362919931944 },
+  { -0.4703936935038611, 0.349302247651382, 0.8103812145512063 },
+  { -0.003762946744852296, 0.0611478846038498, 0.9981216240720714 },
+  { 0.18246193714968645, 0.7063403824628967, -0.6839524147144689 },
+  { 0.5921634877905324, -0.7923461889728186, -0.14673077573570717 },
+  { 0.07422452584903273, -0.6117296492792765, 0.7875770158880588 },
+  { 0.3861602890961435, 0.4803457254610566, 0.7874948984955231 },
+  { 0.31268240945086523, 0.9430006130567679, -0.11392784819595882 },
+  { 0.4013905279103203, -0.6316723172642755, 0.663231277689657 },
+  { -0.8679749135157487, 0.44146555316071356, -0.2274372768035919 },
+  { 0.1541878043842816, 0.6684003342766887, -0.7276449093603042 },
+  { -0.53459502193158, -0.8280468881777802, 0.1689571351114485 },
+  { -0.8718989092168521, -0.4797040885141801, -0.098368082065491 },
+  { -0.17610961394653718, -0.9329686571615883, 0.3139345292090445 },
+  { -0.6054009902372642, -0.6301744322930091, 0.48617880034399225 },
+  { -0.7562659326688949, 0.06615285156174998, -0.6509113912927745 },
+  { -0.10753934558831196, -0.3813580154476273, 0.9181510514094534 },
+  { -0.8519201775200371, -0.5001547284467769, 0.15516848503017475 },
+  { 0.9513882637399147, -0.045570698347206, -0.3046041415839559 },
+  { -0.21201813689697735, -0.798503492433755, 0.5634185674947454 },
+  { -0.5742450316815813, 0.7835682427005514, -0.2371991834306973 },
+  { -0.42198172018545005, -0.1475388410428346, -0.8945187075813819 },
+  { -0.12527244034957316, 0.802469835282773, -0.5833943598888335 },
+  { 0.060021984528878, 0.9658082965101278, 0.2522135915556894 },
+  { 0.31921049445954913, -0.18360184034474067, -0.9297284681286867 },
+  { -0.06595056908588827, 0.9975971139888385, -0.02122547051040082 },
+  { -0.9722335978457783, -0.17468262794970352, 0.15571708548659283 },
+  { 0.5458625774796538, -0.5837604665373155, -0.6010472229495822 },
+  { -0.8061926657667231, -0.5911646461303127, 0.024036364732770956 },
+  { 0.6877055596426822, 0.6472839946166625, 0.32876206221162707 },
+  { -0.1333207976052565, 0.2690656097124267, -0.9538497065030623 },
+  { 0.45896934533203304, 0.841237614085667, -0.28577336596145453 },
+  { -0.6014447755403672, -0.7266526098536036, 0.3320243463484927 },
+  { 0.2781845422013755, -0.2829625209796434, 0.9179028119583554 },
+  { -0.5225672208031419, -0.6128766566130808, 0.5927104719176576 },
+  { 0.5226298855787446, -0.11157916804944436, 0.845226651234651 },
+  { 0.8098298661951467, -0.4752669485006267, 0.3439431864149272 },
+  { 0.3392888323252425, 0.3272301016125521, 0.8819317143963088 },
+  { 0.33862666677099423, -0.340922440783001, -0.8769856725865749 },
+  { -0.10590996063738421, 0.9910761357205629, 0.08093931951149688 },
+  { -0.8412034849833907, -0.4418085530374951, -0.31174011502325655 },
+  { 0.46788468530766636, -0.42784565355762155, 0.7733252989437224 },
+  { 0.7632747696805595, 0.3372730117555158, 0.5510522130528581 },
+  { 0.9810212415825815, -0.17253586661429846, -0.08847993159707612 },
+  { -0.4649286713397615, 0.5783678295964131, -0.6703222987893049 },
+  { -0.2748274988091816, 0.4615027810191918, 0.8434957196156014 },
+  { -0.6859377260821881, 0.7238007841329378, -0.0748455798677612 },
+  { 0.7607201274404973, 0.6222802513070245, 0.18458650151129713 },
+  { -0.15328021135616066, 0.11326956795069225, 0.9816695889059995 },
+  { -0.1322376966502715, 0.9604919118836592, -0.2448846234264287 },
+  { 0.7031021315289953, 0.0752712744215956, 0.7070937900210496 },
+  { 0.9894035694172779, 0.1449126440055609, 0.008994577903793436 },
+  { -0.18241276912443122, -0.947047116413143, -0.2642486347247754 },
+  { -0.25358000681158677, -0.4993916983160352, 0.8284353395398228 },
+  { -0.5921132112393472, 0.47369056899147777, -0.6519349583542504 },
+  { -0.9818558988382816, -0.14615862119561454, 0.12081660219798783 },
+  { -0.28621913167511026, -0.819779854891475, 0.49602378791471097 },
+  { -0.4361797032705391, -0.8468569642127604, 0.30427051881372286 },
+  { 0.25018906032761873, 0.48708067059845456, 0.8367543572768193 },
+  { 0.17924504807531988, 0.17109754589007806, 0.9688120780269355 },
+  { 0.7042072328355554, 0.005243538591478448, -0.7099751252861818 },
+  { -0.8281950727144214, 0.22851536287270824, 0.5117359186755497 },
+  { -0.839858752284783, -0.4779067222678572, -0.25737606924856254 },
+  { 0.33573957558843737, 0.08022582329936474, -0.9385322342144861 },
+  { 0.13973279385574894, -0.3347555421148518, -0.9318870496710739 },
+  { 0.7916495822634392, -0.2046238181735943, 0.5756909170190043 },
+  { -0.0013076448870811255, -0.6074010500491828, -0.7943942689017838 },
+  { -0.04283367790703019, 0.831394666261045, 0.5540290470269971 },
+  { 0.7678565068234763, 0.6096037741381872, -0.19692542620323747 },
+  { 0.8416045224651837, 0.0017163926358909252, -0.5400915494270111 },
+  { 0.8409577927070445, -0.027411895454944407, -0.540405938968904 },
+  { 0.8572747339496768, 0.43502302607316, 0.27538154861511965 },
+  { 0.2157841218061386, -0.09233070596512662, 0.9720659717901532 },
+  { -0.18447985565027733, 0.40074700950491016, 0.8974235439479645 },
+  { 0.6607584679565736, 0.5349468856020236, 0.5265264253656955 },
+  { 0.5961126512420288, 0.7017231603203411, 0.3901721585393201 },
+  { 0.7543625361483156, 0.11283200327004721, 0.6466885673134706 },
+  { -0.9253149731429876, 0.37223582795817256, -0.07233732689065701 },
+  { -0.767997071951532, 0.41332456972054593, 0.48922724529527056 },
+  { -0.8403260892638366, -0.4559671788066702, -0.29316547469583226 },
+  { -0.4121545420873406, 0.1525915671086719, 0.8982452043201201 },
+  { -0.6114282355929999, -0.7527120461774197, 0.2440903280735083 },
+  { 0.24406819262428897, -0.9676901527345435, 0.06329680599926615 },
+  { 0.165362158155098, -0.8409201899354813, -0.5152752573228822 },
+  { -0.9568158650192952, 0.1861711489301109, 0.22325703517116888 },
+  { 0.7004602179484338, 0.711127124820745, 0.06044580560976332 },
+  { -0.18611605051281285, -0.39515944058155195, -0.8995609108119288 },
+  { -0.891569830105, 0.3246477098751902, 0.31576431482885414 },
+  { 0.4179538211779505, 0.8719644118621397, -0.25493659566382887 },
+  { 0.1991959656101435, 0.808798857191662, -0.553322126694843 },
+  { -0.16891914561854368, -0.9345043055993626, 0.31331777009891165 },
+  { -0.46973274645255275, -0.5468137160667865, 0.6930699148219993 },
+  { -0.32037216832749604, 0.6887719103901546, -0.6503498514020245 },
+  { 0.018102534831224454, 0.5911770660597014, -0.8063386229108264 },
+  { -0.9637182480828493, 0.0483963312356016, -0.2624974922452739 },
+  { -0.29646459580958556, -0.5570458687834288, -0.7757632651155725 },
+  { -0.7190843896492776, -0.3315679863820993, -0.6107211401034405 },
+  { 0.34558987963279914, 0.40269165572155186, 0.8475889720304427 },
+  { 0.040899925601686364, -0.6445525312413907, -0.7634652778981456 },
+  { -0.8583817126443359, -0.38917488982777937, -0.33425101424724596 },
+  { -0.8407739523305747, -0.5106687581799706, -0.17976812982659401 },
+  { -0.15334849383978466, -0.5481392971294431, 0.8222089456941646 },
+  { -0.008000113780205095, 0.6826763759108347, -0.7306770585920652 },
+  { 0.15645895846853441, 0.954597695972577, -0.2535031225819292 },
+  { 0.23977373088892262, -0.31484851556045423, -0.9183566683075726 },
+  { -0.8972712518841626, 0.04641058199400841, -0.43903343656401056 },
+  { -0.08658764858347176, 0.4987448558407973, -0.8624129798913787 },
+  { -0.39716713263342845, -0.2359113043461718, -0.8869070555799117 },
+  { -0.49452164214442834, -0.8234952667469451, -0.2780357730511593 },
+  { 0.923541015591317, 0.29941038173106255, 0.23963600696101228 },
+  { 0.17934164851638995, 0.5570382435294176, -0.8108914652116429 },
+  { -0.23261521349547748, -0.8565781062711876, -0.46061275525903483 },
+  { -0.676445835457729, -0.24503345903533616, 0.6945355539100021 },
+  { -0.27969034412420934, -0.5712824050196617, -0.771627970668918 },
+  { 0.7857936546340644, 0.24653625422707814, -0.5672285321530663 },
+  { -0.6460942978517068, -0.7264084742275722, 0.23429231070156906 },
+  { 0.011163009226244266, 0.9190877596274446, 0.3938947541260477 },
+  { -0.9032233682940736, -0.0602148912196049, 0.4249255391747119 },
+  { 0.9498431318767687, -0.2524565714842487, -0.18456355095454216 },
+  { 0.7136903032999897, 0.6079861722440039, -0.34784905538991095 },
+  { -0.4345648058353801, 0.044325610195208774, -0.8995491480792368 },
+  { 0.16936367061473853, 0.981593668422041, 0.08825994102458205 },
+  { -0.6283812195278605, -0.6333032656338229, -0.4517344537249893 },
+  { -0.2888646101707324, -0.3095717506847634, -0.905937397488856 },
+  { 0.7992876462470758, -0.5586495360536844, 0.22147224300984694 },
+  { 0.10127228229863067, 0.6444115226265499, 0.7579430812034358 },
+  { 0.33602822233256463, -0.13764340118763427, -0.9317399465009089 },
+  { -0.2708210143348957, -0.9269392447587722, -0.2596913836088041 },
+  { -0.5978635551059853, -0.3321464195033252, -0.7295463833692506 },
+  { -0.2704637438399925, 0.8405018106025598, 0.46947424811364646 },
+  { 0.055298265990210344, 0.7722007857918659, -0.6329676517808005 },
+  { -0.3189853348825993, 0.006144179805122298, -0.9477397349401144 },
+  { 0.5970633995945878, -0.7472021492002443, -0.2918976620240207 },
+  { 0.4831512766022989, 0.16843805973291154, -0.8591818573218251 },
+  { -0.28381528068589157, -0.0723651981495673, -0.9561444266144955 },
+  { -0.8626126295942246, -0.41168583599149744, 0.29396296315780834 },
+  { 0.21974523203969526, 0.11050406783605364, -0.969278537876242 },
+  { -0.08014073006220988, 0.8893539459501083, -0.4501411136611139 },
+  { 0.5724385230913781, 0.5257521560551953, 0.6292049011921913 },
+  { -0.8091668751757009, -0.37373806817885813, 0.4533969833515955 },
+  { -0.6385929973536265, 0.14884129092165294, 0.7550134130250185 },
+  { -0.09114528186007587, -0.9888063801793757, -0.11812908241075622 },
+  { -0.27631195870182257, -0.6940780501077612, -0.6647611314126076 },
+  { -0.9012724517021508, 0.28599648619363083, -0.32544427739275233 },
+  { 0.3590804356680323, 0.5309648808021111, -0.7675529532711448 },
+  { -0.49657273709152505, -0.863711747864843, -0.08612510306344587 },
+  { -0.8900828613333854, 0.0005003276342514815, -0.4557984748030996 },
+  { -0.08928279184416874, -0.9029901874320806, 0.4202824103884041 },
+  { -0.5067115113192712, 0.7309611227255804, -0.45709876543291955 },
+  { 0.5079261066177124, 0.6916790717547898, -0.5134112697561327 },
+  { -0.5726797406125494, -0.02813744390292873, 0.8192961607029248 },
+  { -0.958245384407216, -0.285559251624126, -0.014889495429190925 },
+  { -0.555128284913686, 0.5062769958412816, 0.6599365051053899 },
+  { 0.3152123953562022, -0.9188738694817593, 0.23730140707004657 },
+  { -0.38948937654886795, -0.7639316152221481, -0.514496368130674 },
+  { -0.11049841848314049, 0.463167023582026, 0.8793556776293036 },
+  { 0.4581523949630521, 0.7931815686106222, -0.40119743544296516 },
+  { -0.04244449381549314, 0.8632292323286105, 0.5030246091376687 },
+  { 0.5178406521543085, 0.7225079111613438, -0.45806481777765057 },
+  { -0.5813287087818667, -0.4356757100031871, 0.6871998312421405 },
+  { -0.5267844431294456, 0.678110055518934, -0.512508441960626 },
+  { -0.3302896014884075, -0.9006508114660742, 0.282377221025583 },
+  { -0.5341495287205331, -0.5006039061438813, 0.681234181556622 },
+  { 0.7214128707952429, 0.6531425796077907, 0.23014830121955554 },
+  { 0.7075716816651609, 0.5324655584247928, -0.46456726573975216 },
+  { 0.8935873565024481, 0.20180621759276196, 0.4009686856100729 },
+  { -0.9643276635415199, 0.238505467929353, -0.11483596604005886 },
+  { -0.13109079098042306, -0.9601514690728283, -0.24682860644061638 },
+  { -0.5788737500197865, -0.22482018825074931, 0.7838118808061838 },
+  { -0.09972695806594789, -0.9938136959740252, 0.04887608340855862 },
+  { -0.533600873391285, 0.359989105972111, 0.76529598946908 },
+  { -0.9760275915787584, 0.21689502035083522, -0.018074585029236267 },
+  { -0.6653075604202581, -0.7429267758026215, -0.07365905133224285 },
+  { 0.17135472263265833, -0.1448502151750889, -0.9745029369864491 },
+  { -0.8458855635183804, 0.4827246544781246, -0.22683589087745207 },
+  { -0.852269132074371, -0.38284470536039206, 0.35646494651047106 },
+  { 0.3620415889268714, -0.9202863615302408, 0.148320263850686 },
+  { -0.944088506715062, 0.2217008471245772, 0.24401972435188363 },
+  { 0.22586307035941391, 0.512260047184031, 0.8285985261312216 },
+  { 0.856304729609986, -0.49360444145303445, -0.1519765291925255 },
+  { -0.7223428909720991, 0.018986312546458998, 0.6912743795324389 },
+  { -0.9078230514879166, 0.40686921936967024, 0.10156153561601264 },
+  { 0.7123963544506365, -0.4203580973466489, -0.5619524038213096 },
+  { 0.6715501464342012, -0.7076897928688128, -0.21953486714756618 },
+  { -0.594248317792452, -0.2636536508782717, -0.759839252197068 },
+  { -0.8843829913499903, 0.38520641451889426, 0.26359579439805325 },
+  { -0.003531910038643069, 0.8088073988492628, -0.588063021434071 },
+  { 0.5986725500614885, -0.18471805651175782, -0.7794038859291077 },
+  { -0.6673256758246905, -0.7302595331029748, -0.14627869529547166 },
+  { -0.7779929148893974, -0.23790887389389834, -0.5814863645043074 },
+  { -0.021989588328558234, -0.6189661899890465, 0.7851097462492643 },
+  { -0.6420903555245224, 0.09517873000933628, -0.7606976959976954 },
+  { 0.6452905986902644, -0.4344762040050287, -0.6283553703083479 },
+  { -0.6507917169351451, 0.14178276918343488, 0.7459006552693748 },
+  { 0.8667303611904423, 0.4224647647678771, -0.26514524985431615 },
+  { -0.39532543537503373, -0.7647822600459965, -0.5087493438467297 },
+  { -0.6227264667129347, -0.7481723975073793, 0.2290192377580628 },
+  { 0.023255577934692177, 0.9684656233247365, -0.2480594979700499 },
+  { -0.3972213696154839, 0.7762955700607173, 0.48946947956425746 },
+  { 0.8676347215524134, -0.26047781057405067, -0.42351068481824067 },
+  { 0.16992079983754127, 0.2593806601881471, 0.9507095218324739 },
+  { 0.5186447101921589, -0.8517129419711019, -0.07478455100234066 },
+  { 0.45656559717783035, -0.6962911425631824, 0.5538289449475436 },
+  { -0.07832830523255771, -0.3979357649761191, -0.9140633476692226 },
+  { -0.45098692068893503, -0.26897704773871745, 0.8510359247160345 },
+  { 0.984966750153725, -0.08336709170580117, -0.15129583309571323 },
+  { -0.6765764146844032, 0.03170612268973772, 0.7356895247839143 },
+  { -0.5338374819548295, 0.5643424809236769, -0.6297103358569213 },
+  { -0.34565692018271915, -0.8912314007845972, -0.2936458475533445 },
+  { 0.9777977722515898, 0.19720291205074078, -0.07086979651823497 },
+  { -0.5418510041798519, 0.4790718664627262, -0.6905705148883826 },
+  { -0.31866373580700924, -0.5304701709841231, 0.785528370701909 },
+  { 0.3418206202297555, -0.1346415524451508, -0.9300700596949162 },
+  { 0.6176205864913369, 0.09065990260423293, -0.7812333794724134 },
+  { 0.5078164362596651, -0.16423221501210933, 0.8456655642845757 },
+  { -0.22800415549930403, 0.10763917108455516, 0.9676920553168136 },
+  { -0.9511514125746126, -0.2773428010975428, 0.1356169644133359 },
+  { -0.1852776994002461, 0.06658417322196344, -0.980427825992969 },
+  { -0.3002505217031465, -0.8364121676016224, 0.45854586477793463 },
+  { 0.18478131235817355, 0.8531617164880242, 0.48782266462557816 },
+  { -0.8093180191241659, -0.0642996307566869, -0.5838406472707172 },
+  { 0.43693705733211236, 0.8855569236837999, 0.15771792176426516 },
+  { -0.5257421738508431, 0.5209040556865715, -0.6724984248337471 },
+  { -0.0016288080377698866, 0.17319658801619794, -0.9848859268381915 },
+  { 0.761539040325825, 0.6467642278195757, -0.04188464721792037 },
+  { 0.6821671851756739, -0.49542583156737424, 0.5377742806096936 },
+  { 0.9492727965161506, 0.051574663747727865, 0.3101954413812618 },
+  { 0.34513513514004796, 0.9162516087646511, -0.20338320463609968 },
+  { -0.40440780274840643, 0.23962981628151075, 0.8826278265640027 },
+  { 0.8179829748818512, -0.5352234280091126, 0.21080734074887217 },
+  { 0.13473777883079296, 0.5658986710893305, 0.813390696415366 },
+  { -0.3739053191974244, 0.046346722982595324, 0.9263081525845741 },
+  { 0.6134358108804837, 0.6328704141496461, -0.4724103563888697 },
+  { -0.2701929134729486, 0.2572792815790209, -0.9277947837637278 },
+  { 0.7222227101557391, 0.5850442422250307, 0.3689411763067913 },
+  { 0.6675950164525917, 0.2559717530162919, 0.6991390102586397 },
+  { 0.6687728252410213, -0.036395800013116805, 0.7425754197120638 },
+  { 0.8472650639181294, 0.30245159492112894, -0.43665197147553714 },
+  { -0.7451450783943586, 0.24303829760260137, 0.621040415788775 },
+  { 0.9276889715071783, 0.16160135325534344, -0.33656823196789576 },
+  { -0.687286343686073, -0.7164086463846354, -0.11998388711807714 },
+  { 0.9556594452428916, -0.28844771206090825, -0.05927007782073457 },
+  { 0.7181801600342378, -0.44795945595696923, -0.5324937403875586 },
+  { -0.4817649956918088, 0.47115083422001863, 0.7388635735640593 },
+  { -0.9680438853213643, -0.07651604363019167, -0.23882280284574975 },
+  { 0.6711195260443954, -0.16758943896681838, -0.7221581279115629 },
+  { 0.2629922328599799, 0.5071572812646592, 0.8207475723482595 },
+  { -0.8110280273032076, 0.5292596940352593, -0.24923425767412322 },
+  { -0.7037357130571977, 0.4283608688174247, -0.5668006812221194 },
+  { -0.5621038155570489, -0.7415825777173698, -0.36618926931611256 },
+  { -0.5027621480950248, -0.7403458673420714, -0.44622664549799396 },
+  { 0.7583334229197074, -0.45277412509215353, -0.4689626971624875 },
+  { 0.07194147422429435, -0.43809877062104763, 0.8960434651660386 },
+  { -0.8539539104626077, 0.4863539042816389, -0.18499350960405897 },
+  { -0.5413079676007424, 0.36271316196376274, -0.7585676280663465 },
+  { -0.04121625195801939, 0.9469685205964454, -0.3186719968461499 },
+  { 0.20118468549620705, -0.2975753824784193, -0.9332596712944445 },
+  { 0.07869661720679492, 0.9887849161950523, 0.12693002775289502 },
+  { -0.8078308527101304, 0.22573281265897563, -0.5444759046079921 },
+  { 0.9769616648418511, -0.10348648152170932, 0.18664526131594003 },
+  { 0.3741201400770015, -0.7839738970065097, 0.49539787000066043 },
+  { 0.8802208545184516, -0.47308700105962886, -0.03741572796584196 },
+  { 0.6428352363912533, -0.35302269011467713, -0.6798072073154257 },
+  { -0.3356523255147524, 0.15434721110284677, -0.9292547846534405 },
+  { 0.17663242472854104, 0.07051604553116174, 0.981747663026077 },
+  { 0.4330009094522877, 0.11940120165562292, -0.8934503710093163 },
+  { 0.1041669411156032, -0.9828936510852168, 0.1518858750344829 },
+  { -0.6044243828208604, 0.7494238693273265, 0.2702499390084673 },
+  { 0.8661065522014669, 0.36233540123835173, -0.34434357441824043 },
+  { 0.479057017404807, -0.24685034084614507, 0.8423593552037946 },
+  { -0.9368112582276191, 0.11700941874170577, 0.3296869156999005 },
+  { 0.24638142886984551, 0.13103943031304804, -0.9602733252628051 },
+  { -0.6017395778355382, 0.3431195890636686, 0.7212339620865671 },
+  { -0.9531344353772492, 0.2793387698415292, -0.11620929292235493 },
+  { -0.7463186797416038, -0.5706675314744105, 0.34255947919982027 },
+  { 0.1669902095713047, 0.9202013049950274, 0.35403930317519855 },
+  { 0.24869651556313532, 0.8484358264539567, 0.46723301631642716 },
+  { -0.8874090313358299, -0.3136763041277707, 0.3378052505991377 },
+  { -0.8920599708446928, 0.43857472918185764, -0.109000987791974 },
+  { -0.992879929874703, -0.04336458003423263, -0.11094574372394582 },
+  { 0.02145864077501645, 0.9361955835797875, 0.35082382476364105 },
+  { 0.05468700035803503, 0.3779479358077532, 0.924210306050792 },
+  { 0.9790797971059413, 0.19427813775034122, -0.06048765238664978 },
+  { 0.023693571189866893, -0.9551470885915091, 0.29518240774042503 },
+  { -0.5252918970532124, 0.4792579132778409, 0.7031218069799903 },
+  { -0.6482256056318031, 0.6812292591822474, -0.34019150582765645 },
+  { -0.275314126872877, -0.4608304560918765, -0.8437045823523649 },
+  { -0.44982770754132717, 0.8256972559598685, -0.34041015705830163 },
+  { -0.610014140769789, 0.5113468984886678, 0.6053157006611642 },
+  { -0.4662415646928718, -0.5742541938467204, -0.6729419917067117 },
+  { -0.9730794678796791, -0.2278312987025743, 0.03477425085460344 },
+  { -0.0813625135349045, 0.9389673859298437, -0.33424600154879686 },
+  { 0.7110866037252822, -0.5676066594707863, 0.41494399878400245 },
+  { -0.5033129065595381, -0.30746086935886496, -0.8075542903753783 },
+  { 0.9229344447818343, -0.32577203466205035, 0.20509654328485205 },
+  { -0.12493900951088485, -0.824964930446872, 0.5512015125480214 },
+  { -0.38027592686739253, -0.40691613602980603, -0.8305476974164204 },
+  { -0.8002018699796121, -0.5687190970192837, -0.19035639197752885 },
+  { 0.8432228030441092, 0.3925226680837084, 0.36728906799261285 },
+  { -0.4891223685042864, 0.87032225311924, 0.05743243294695492 },
+  { -0.240290858252518, 0.11199997630413976, 0.9642179778183667 },
+  { -0.2860930648730372, 0.5888337865382555, 0.7559269343412578 },
+  { -0.31652665032651406, 0.057302238421179263, 0.9468512729594859 },
+  { 0.5722992747542036, 0.742219059423493, 0.3486895581234375 },
+  { -0.0384671299901618, 0.9733349558116698, 0.22614009751792088 },
+  { 0.5898763930050183, 0.8024127765153442, 0.09044101425971318 },
+  { -0.3460198908518937, -0.8586052305952434, -0.378242373524348 },
+  { 0.006323261535706934, -0.18050037474654337, -0.9835545897813239 },
+  { -0.2703111549239097, 0.9305793858036236, 0.2468884084785124 },
+  { -0.4215103757689198, 0.9064739263847738, 0.02517983128846594 },
+  { -0.07976906614775797, 0.5338005432780785, -0.8418395785908042 },
+  { 0.26429845794962376, 0.9428886278711627, -0.20274950198875247 },
+  { -0.6363171451391032, -0.7544699931179523, -0.16085869664590305 },
+  { -0.09491494068055183, 0.9952762938652258, 0.02040227696871675 },
+  { -0.12147539681817608, 0.912518531122184, 0.39058118020006855 },
+  { 0.6036169665436186, -0.1289948166675596, 0.7867699123464131 },
+  { 0.18609929606919487, -0.9369136974518086, -0.29590501099124855 },
+  { 0.1708696702971766, 0.2834061903116313, 0.9436548559010236 },
+  { 0.01617601581909669, 0.7308618056446414, -0.6823337581873513 },
+  { -0.5051331382095811, 0.8139088844148443, -0.2870415310597471 },
+  { 0.8897437198439836, 0.1667464713745237, -0.42491378805863184 },
+  { 0.4153135952507312, -0.9054772001586655, -0.08732501126673697 },
+  { 0.8375875931600288, -0.20448915848633517, 0.506587808623481 },
+  { 0.7065710979047263, -0.06146420291909495, 0.7049676839155324 },
+  { 0.23982489027593365, 0.7040535581493041, 0.6684254702369149 },
+  { -0.3855722051562563, -0.9226727866579674, -0.0030005619078307885 },
+  { 0.09980859353216938, 0.9692197244471938, -0.2250585932588133 },
+  { 0.7760270300645299, -0.1823160375742755, -0.6037738906680552 },
+  { -0.9847905494662083, -0.01907071532048601, 0.17269592206884554 },
+  { 0.6792515528260825, -0.3916683187691826, -0.6206555051362048 },
+  { 0.6707608008921226, -0.662983864070185, 0.33246404913783467 },
+  { 0.5044549149742693, -0.8399947335610137, 0.1998351479296481 },
+  { 0.2794650759562989, -0.9540973293794663, -0.10769195602137634 },
+  { -0.094493550773486, 0.31545215446186303, 0.9442250299094954 },
+  { 0.3844725601556173, -0.21058482369757014, 0.8987963520818543 },
+  { -0.5760787257246028, -0.6839942996895422, 0.4475322332075427 },
+  { -0.9680560998301412, 0.10310656684581385, 0.22855288984155403 },
+  { 0.3285888761147128, -0.37266787169107674, -0.8678410038151649 },
+  { -0.9126921950312428, -0.358768854202346, -0.1956473009867189 },
+  { 0.012775172182671204, -0.28602191053424975, 0.9581379137003404 },
+  { 0.6649051966170426, 0.4560261060730796, 0.5915583403954984 },
+  { -0.4837471662777902, -0.7175789167292028, 0.5010680366815985 },
+  { 0.3422167073126302, -0.1454933306538727, -0.9282884336085119 },
+  { -0.008306783317322033, 0.7134060966641275, 0.7007016045317526 },
+  { -0.2984122890331085, 0.829622116799877, 0.47188690283849993 },
+  { -0.27183425540211587, -0.8975160208775457, 0.3472335379224108 },
+  { 0.6781027210298339, 0.723867678333905, 0.12724890567473426 },
+  { 0.892135320665429, -0.010416926179579655, -0.45164815650034645 },
+  { -0.9764620061943007, 0.2139819652963932, 0.02708632472106243 },
+  { -0.7865576823255852, -0.4212621433224528, -0.4515143618734369 },
+  { -0.6444555400252701, 0.66311083197337, 0.38073754930440296 },
+  { 0.2492419756297279, 0.6969001122509647, -0.6724646244441287 },
+  { 0.232052853681027, 0.704140723086163, 0.6710717660505375 },
+  { -0.49764915347236144, 0.0050723016775212374, -0.8673635868561316 },
+  { 0.9707490460024579, -0.16904673222613803, 0.1704977771379504 },
+  { -0.8269361781291835, -0.05231449739551994, 0.5598569019520555 },
+  { -0.29933934945854207, -0.10234764521928093, -0.9486416148281737 },
+  { 0.3138307128538635, -0.044742932957076924, -0.9484241422591657 },
+  { 0.20228417007877583, 0.9281273685967362, 0.31250712343439363 },
+  { 0.8779303756088375, -0.44575483092446017, -0.17475950987237115 },
+  { 0.23592593444416265, -0.11679501705156567, -0.9647268408459325 },
+  { -0.0005810794001341374, -0.9669161218232046, 0.25509385665888634 },
+  { 0.3576214475040818, -0.38009492644559517, -0.8530150919974411 },
+  { 0.17336447040370304, -0.43156687313262243, 0.8852653807848665 },
+  { 0.027034672609855287, -0.5864066258828611, -0.8095655597896665 },
+  { -0.28808361433748975, 0.9527986486825187, 0.09582570750594395 },
+  { -0.9527578923595041, -0.3030229393101068, 0.02072430453692043 },
+  { -0.9760428879572461, 0.029897931475397457, -0.21551425605182334 },
+  { -0.17545835074815058, -0.35456123697178205, -0.91842293982118 },
+  { 0.5929941673695268, -0.8020845963264119, -0.07083938030233268 },
+  { -0.9065474890308365, 0.38569706811790155, -0.17149175425407526 },
+  { -0.6031763415978121, -0.7013678390672233, 0.3798176605410194 },
+  { -0.6268021527649851, -0.6432197956811868, -0.439758292398259 },
+  { 0.9469493995620999, 0.3156497998540333, 0.06043209843359269 },
+  { 0.30576918958954086, 0.8180904276038748, 0.4870659657178527 },
+  { -0.004900873388957252, -0.09381671916003882, -0.9955774227281732 },
+  { -0.14146476294755997, -0.7083415468453362, 0.6915489670709856 },
+  { 0.13553650362254888, -0.7237137834939874, 0.6766596011042723 },
+  { -0.7827255990392908, 0.09325753063910085, 0.6153402876357765 },
+  { -0.5853453893844073, 0.7950887758782688, 0.15875960946919976 },
+  { 0.519184198977855, 0.8483770787645384, 0.10346061936152907 },
+  { -0.7323156625925256, -0.6331306970043732, 0.25071755190338535 },
+  { 0.9107302419643811, 0.15830494258229033, -0.3814576929693743 },
+  { -0.5908428807744546, 0.6499809307154828, -0.4779429672506735 },
+  { 0.6611350407673239, -0.6348805806646504, -0.39978382429071024 },
+  { -0.759005762924318, -0.2325398053647499, 0.608141012240252 },
+  { 0.5894568280577119, 0.1770040333544404, -0.7881689032386403 },
+  { -0.07256219476814568, 0.7223533803495584, -0.6877065666314348 },
+  { -0.740426023644399, 0.424238716977154, 0.5213356064261505 },
+  { -0.7956170657422639, 0.5534727413859227, 0.2462953699167356 },
+  { -0.9160738480344623, -0.382331836852795, 0.12095896608395947 },
+  { 0.8222505132836138, 0.24952838920468026, 0.5115072593675982 },
+  { 0.9268187647405117, 0.2843401830936933, 0.24527053961517056 },
+  { 0.4431412474046082, 0.8087198494058427, 0.38677905841149 },
+  { -0.7682486819590536, 0.3731493598086832, 0.5201475924605887 },
+  { 0.8560699138038885, -0.22887083392584348, 0.46342469081598553 },
+  { 0.9002306733638431, -0.15175471917030467, -0.4081117983401408 },
+  { 0.1492550598663225, -0.986801438972305, 0.06281597843294869 },
+  { -0.7777023004370858, -0.4262212607590262, 0.46207636681813863 },
+  { -0.02823642653660794, 0.09086995449053828, -0.9954623828087781 },
+  { -0.8836019319959688, 0.42008114197126784, -0.2068319606180508 },
+  { 0.5694287764064441, 0.8156212789219464, -0.10253193634175035 },
+  { -0.4477719892068664, 0.8407319646690128, -0.30441749172067567 },
+  { 0.8554115346301894, -0.150776700966703, 0.49551739915690335 },
+  { 0.3505577761769865, -0.14410073011759533, -0.9253886886824486 },
+  { -0.6709176324724968, 0.6672656702428642, 0.3234595117674557 },
+  { -0.2809608811722335, 0.27314193271660553, -0.9200296016122304 },
+  { 0.3399763985981477, 0.7642625643204738, 0.5480134863071592 },
+  { -0.37752508618919645, -0.8897161330007587, 0.25667101896399636 },
+  { -0.48441141019910255, 0.5582165821393091, -0.6736021326373787 },
+  { -0.24539586970261545, -0.610568294855317, -0.7529855406648707 },
+  { -0.835449746085814, -0.4003403658413592, -0.3764987559649507 },
+  { 0.3791413324733552, -0.1257117645590666, -0.9167597298429805 },
+  { -0.28981975674038146, -0.38798451305567194, 0.8749128677942161 },
+  { -0.0864420859794464, -0.6817276568024425, -0.726481360891092 },
+  { -0.24265636407831828, -0.7845203635243934, 0.5706537375570621 },
+  { 0.36577247811096314, -0.3712155209399953, -0.8534691155922474 },
+  { 0.35734083639079306, 0.007179954981576986, 0.9339464518343602 },
+  { 0.3560575227029859, 0.8047715856838357, -0.47493761211609414 },
+  { 0.28623159779129503, -0.7915343067412908, 0.5399489917366516 },
+  { 0.19928812998237377, 0.577781090026417, -0.79148799943904 },
+  { -0.5429090064072952, 0.6217588806033595, 0.5645048318240518 },
+  { -0.6218639929874127, 0.01539267309374784, -0.7829739713686401 },
+  { -0.06921688373026649, 0.7527336105666481, -0.6546763586154372 },
+  { 0.6962694600970919, -0.7138077336511748, 0.07541457628255656 },
+  { -0.4604691756026016, 0.39341631884603717, -0.7957334593854236 },
+  { 0.18182132374900736, -0.904083930243683, -0.3867470146042422 },
+  { 0.07134446962607091, 0.19770882684512872, -0.9776610795369209 },
+  { 0.9943751348798882, 0.1039708391772331, -0.020202864484675627 },
+  { 0.11863198242245986, -0.0429529591529596, -0.9920088185326384 },
+  { -0.45232714368912796, -0.7179378501577438, 0.5291175657572823 },
+  { 0.9695992940833188, 0.23574316393318467, -0.0655924505709412 },
+  { -0.17086549622995262, 0.39815879522720443, -0.9012627563487315 },
+  { -0.3419833333764446, -0.4538048632048129, -0.8228660558222076 },
+  { 0.005645713545803247, -0.8320370338127536, 0.554691355875169 },
+  { -0.6840606887696413, -0.48246093918261856, 0.5470762435374336 },
+  { 0.6343450240455636, 0.6780301906943255, -0.37132391651447627 },
+  { 0.006416179562508337, -0.4343260011544105, -0.9007329001213626 },
+  { 0.7316533395587256, 0.6753723134388235, -0.09249664292749106 },
+  { -0.2911764892590149, -0.3674885431354482, 0.8832714321016958 },
+  { 0.47240185065037965, 0.5033993474122156, 0.7234815744212507 },
+  { 0.2678424911659144, 0.05661216290552282, -0.9617980364594199 },
+  { -0.306466889319291, -0.5884739799605165, 0.7481820772114146 },
+  { -0.7537280409091309, 0.15499634403839763, -0.6386471433287821 },
+  { -0.9135144497846892, 0.09124833951009594, -0.39644052589414563 },
+  { 0.8005176643419961, 0.265768652855768, -0.5371577908172471 },
+  { -0.25828990416986597, -0.8898269092950593, 0.3761574097347062 },
+  { -0.04615329921496099, -0.20455598047124685, 0.9777661907762106 },
+  { -0.5157514205459259, -0.8302339940495393, -0.21145209227957243 },
+  { -0.7740488898617787, 0.3322519600675058, 0.5389405821934814 },
+  { 0.3132071547250125, 0.9409402311423006, -0.128579779308163 },
+  { 0.01241684435310946, -0.4961564056096655, -0.8681443676882364 },
+  { 0.783901710847674, 0.6011609873448721, -0.15525326091463673 },
+  { -0.7008703238964069, 0.565871224590518, 0.4342471027672762 },
+  { -0.01300055869281382, 0.8783177452865017, -0.47790053754783607 },
+  { 0.609415094025833, 0.03348434582559522, 0.7921439526740812 },
+  { -0.2350145824799993, 0.11224577073671609, 0.9654890123525344 },
+  { 0.1324190551345394, 0.12253703609464837, 0.9835902951038173 },
+  { -0.6609845007603856, 0.49528811364879033, 0.5637279257166231 },
+  { -0.699937902384786, 0.43463885873893976, -0.5667239145115526 },
+  { 0.7081800033424988, -0.2505045778797439, 0.660097371095439 },
+  { -0.4606014186466743, 0.49319114166412764, 0.7379761723285552 },
+  { -0.025225211261477386, 0.8601302428178269, -0.5094503450847393 },
+  { -0.8139268299275543, 0.500298712381114, -0.29533762698627053 },
+  { 0.8940427826301697, -0.35666600370884427, -0.27106616281872165 },
+  { 0.45035750720581696, -0.2551408099807989, -0.8556174862552216 },
+  { 0.13533180267788417, 0.35141407325196444, 0.9263873122535828 },
+  { 0.5152574264531322, -0.8088514016401022, -0.283318186055426 },
+  { 0.9142660305797947, -0.1990644421210244, -0.35283278363966003 },
+  { -0.501011974039062, 0.861151169495376, -0.08605617436435653 },
+  { 0.9497457340091527, 0.21299645558572142, -0.2293807983230846 },
+  { -0.24370582071040064, 0.29278942862865465, -0.9245981956694357 },
+  { 0.9415675822371613, 0.14046336062882242, -0.3061380936782027 },
+  { -0.4516033570761283, -0.19704391759217862, -0.870188544177351 },
+  { 0.8809436332817719, -0.37687428161787034, -0.2861889076035703 },
+  { 0.9738938686127194, -0.03523958077217077, -0.2242518776410867 },
+  { 0.7465225967363616, 0.5805436997160844, 0.32507387665261644 },
+  { -0.725789190877791, 0.4495702074728574, -0.5206886583725185 },
+  { 0.44167382782015746, -0.6310363217570708, -0.6377439850300405 },
+  { -0.5457226389451717, -0.8318197686906815, 0.10130485555045632 },
+  { -0.474646083799479, -0.052875081874035224, 0.8785871162557712 },
+  { -0.9199428043548381, -0.29155110414937946, 0.26211293441002464 },
+  { -0.0015970571983380318, 0.09475872710138988, -0.9954989869640398 },
+  { -0.7241196831980141, -0.3870669778055451, 0.5708150655840202 },
+  { 0.6396103109778252, -0.7470707314643181, -0.18106344821696777 },
+  { -0.23018171317374192, 0.7232060582823648, -0.6511446660950898 },
+  { 0.9377369120352504, 0.06636950747281453, -0.3409465827434101 },
+  { 0.7496322146898072, 0.6334000420288441, 0.1919789818108043 },
+  { -0.7846969259081187, -0.2609017697816334, 0.5622997430153778 },
+  { -0.458595562088625, 0.8763793411342342, -0.14713721781297803 },
+  { 0.8541305895651746, 0.24773484632409828, -0.45726183077731575 },
+  { 0.45733385672702126, 0.4697210142765072, -0.7551211242166634 },
+  { -0.5581884086647628, 0.6646565395346681, 0.49664613648562694 },
+  { -0.044262504499427736, -0.5359912654227578, -0.8430623903875377 },
+  { -0.7045069480295063, -0.39316210038123656, 0.5908413687293443 },
+  { -0.21778459126437194, -0.9103082555726626, 0.3520067494297043 },
+  { -0.9180471505985918, -0.39278862987020285, 0.053912164884145485 },
+  { -0.6525724962855456, 0.3537981697749845, 0.6700567081639605 },
+  { -0.2935773923681616, -0.5990056152539371, -0.7449863002663625 },
+  { -0.1503483506796075, 0.5908054906987393, 0.7926816798741747 },
+  { -0.04114575987232547, 0.910726270344765, -0.41095582116383617 },
+  { -0.8374822531556352, -0.17454118521511042, 0.517840564568927 },
+  { 0.6721271452794582, -0.49066060431756503, -0.5545243655144544 },
+  { 0.46795581481905973, 0.20956608721431405, -0.8585449379425124 },
+  { -0.3246716445123222, -0.8419361932248226, 0.4309660889069561 },
+  { -0.7039966210778258, -0.2960424318862901, 0.6455599399233626 },
+  { 0.3453411781936666, 0.937462108996315, 0.04363788308329556 },
+  { -0.5414313667234868, 0.632532629193213, -0.5538542661511767 },
+  { -0.6796871685953174, 0.650557718512661, 0.3388214983298462 },
+  { -0.1296561562304792, 0.6638825592880139, 0.7365115264710623 },
+  { 0.8677982725436977, 0.3051598321032783, 0.39217806547647877 },
+  { -0.7742827474715884, 0.4369166932161106, -0.4578100371955027 },
+  { -0.33786739207302285, -0.19235727573905292, -0.9213274682999656 },
+  { -0.8253849604643337, 0.5628985703771272, 0.04341504931100183 },
+  { 0.7701854716913626, -0.23567973762537503, 0.5926798465178207 },
+  { 0.3526272676051012, 0.5445221062553192, -0.7610188472965905 },
+  { -0.5787408851915955, 0.8154248326368978, -0.011888234803188702 },
+  { 0.4531430272286886, -0.40758896629035485, -0.7928004991373176 },
+  { 0.10695039324347881, -0.45474327508868473, -0.8841776784937981 },
+  { 0.6715162202888675, 0.1600828141245907, -0.7234911599397086 },
+  { 0.43766177664228245, 0.7202632140388712, 0.5382128498732784 },
+  { 0.3125944948478699, 0.9117339433062871, 0.26650684496645316 },
+  { 0.7238779459551383, 0.2039092805507432, 0.6591067627213728 },
+  { 0.8814903845799709, 0.4639122010995174, -0.08809183596710934 },
+  { 0.8536978909343431, 0.33039624437875376, -0.40253972811968414 },
+  { 0.5577229454529066, 0.522123608509104, 0.6452379821064211 },
+  { 0.9799746879324248, 0.16764428281010438, 0.10744768705203601 },
+  { 0.4034554903555658, 0.8368618249733353, -0.3699810173566324 },
+  { 0.5706346918649184, 0.7140299844850184, 0.405631889397954 },
+  { -0.16758736604922053, 0.09421578290329313, -0.9813449245767789 },
+  { 0.10109902956286153, 0.37334427345713866, -0.922167576798387 },
+  { -0.16333784845084592, 0.9386843157859818, 0.3036321830123609 },
+  { -0.5883590598957193, -0.7104408757972991, -0.38614424589134044 },
+  { 0.3099625922972376, 0.9230114736496239, -0.22797589979540853 },
+  { 0.9195637811221659, 0.39166605492240397, 0.03162520940367237 },
+  { -0.16612568626050483, 0.9566028942976501, -0.23940166871982116 },
+  { 0.5101205869633485, -0.27744263360398125, 0.8141268769762215 },
+  { -0.38821184194075553, 0.8440984509225348, 0.3698504710381523 },
+  { -0.0363032863442327, -0.925426146808915, -0.3771849920171974 },
+  { -0.7425798667095698, -0.26831396736436114, -0.6136633902024743 },
+  { -0.5773810228936759, 0.21924873977449044, 0.7864865825362504 },
+  { -0.9475388469286251, 0.31749992776665975, 0.0369314152089691 },
+  { -0.8705391162171867, -0.4444783639924141, 0.2111886149356222 },
+  { 0.823647788344739, -0.003696803358818397, -0.5670896352427421 },
+  { 0.7931755023117459, -0.1009160452902454, -0.6005735378248751 },
+  { 0.027350297686149796, -0.37411300049269186, -0.9269797322912913 },
+  { -0.7999179125180077, 0.1915719325024358, -0.5687104077736886 },
+  { 0.8046108491492195, -0.3732632578301705, -0.4618180613460018 },
+  { -0.668708951183099, -0.23776318264287963, -0.7044835041270507 },
+  { -0.35812580743639666, -0.9222479470841422, -0.14561809690802247 },
+  { 0.7667899216104791, -0.5578327641007808, -0.3175780587702464 },
+  { -0.6909967146707927, -0.31652509562918185, -0.6498733754748753 },
+  { 0.17314996925838225, 0.9832245842775018, 0.05734548821097547 },
+  { 0.05917265336159759, -0.7745277663223399, 0.6297660964912887 },
+  { 0.8448968455803985, -0.44988686201554307, 0.2893978778673056 },
+  { 0.6614480389192008, -0.6693282836122069, -0.33835800650595005 },
+  { 0.789025291944014, 0.380403527959253, -0.48242330435916675 },
+  { -0.18386597986460662, 0.4648408016416194, -0.8660925646705464 },
+  { -0.7569971921821027, 0.2551009346695174, 0.6015635994299782 },
+  { -0.11614570747407553, -0.3891175986441109, 0.9138367846945029 },
+  { -0.16676629096261167, -0.04918192309744819, 0.9847690808707442 },
+  { 0.020479724230082097, 0.839668693433366, 0.5427126920971757 },
+  { -0.47210884609982356, 0.747625254765982, 0.4670864115668467 },
+  { -0.7710829523366549, 0.11071960341244276, 0.6270344887133238 },
+  { 0.16828084603011617, -0.9856449553192519, -0.013622735154818929 },
+  { 0.4603073349006466, 0.11523960152392426, 0.8802482557081672 },
+  { 0.44883385715350593, 0.8455988213657698, -0.28898235582389303 },
+  { -0.9228365522075245, 0.3447692993725801, -0.1717755166485293 },
+  { 0.7723637803310971, -0.2529826774285479, 0.5826267722596862 },
+  { 0.9717075398182323, 0.11765068867754383, -0.20479934695720592 },
+  { 0.9795172749974232, -0.043877429984111704, 0.19652144697109186 },
+  { -0.10880001018416745, 0.6444765630581285, -0.7568437866909572 },
+  { -0.2427117392300113, 0.7193749213696301, -0.6508384854511767 },
+  { 0.35383850098381214, 0.5964871620512708, -0.7204175044580398 },
+  { -0.6772616895405977, -0.06754361863342889, -0.7326352867986341 },
+  { -0.21311112935706486, 0.8949486761919954, -0.39198279748778686 },
+  { 0.1648993173573263, 0.08586473329848943, 0.9825657549043052 },
+  { 0.7262851274235874, 0.06740026767937889, -0.6840812214935091 },
+  { 0.02195781290764652, -0.7520550920868933, -0.6587343872293956 },
+  { -0.3674674692652252, 0.8332641647890073, -0.41308412062228766 },
+  { -0.1558769705370277, -0.25873456334037254, -0.9532884116516184 },
+  { -0.6640026220679145, 0.049137487124792115, 0.746113949236975 },
+  { 0.9183152504921438, -0.31175681523557, 0.2439360343773056 },
+  { -0.8698873173678812, -0.1336077960614582, -0.4748105010571176 },
+  { 0.9762672587808037, -0.16900970824054773, -0.1354177165405631 },
+  { -0.2089976641834638, -0.0759019649975751, -0.9749660856026546 },
+  { 0.312493930151024, -0.43864888713791883, -0.8425762264812795 },
+  { -0.1703697622544048, 0.24754580840383605, 0.9537794382618389 },
+  { 0.8551693678912988, 0.4619677822423099, -0.23509810801135364 },
+  { -0.2426348745477787, 0.1479344269760129, -0.9587719869543865 },
+  { -0.5691934613217441, -0.7832262552382636, -0.2501508278899322 },
+  { 0.07096720698046051, -0.9965607788745519, -0.04278164959814996 },
+  { -0.49491267486106344, -0.4072871864336348, -0.7675796975095426 },
+  { 0.22394725419167633, -0.8398022032187862, -0.4945501863399519 },
+  { 0.9344495173103621, -0.254772146531096, -0.2487875659078823 },
+  { 0.6975573418922094, -0.5941670416867975, -0.40047382104881063 },
+  { -0.7558978941660239, -0.6398236856985821, -0.13872283450986955 },
+  { -0.43239628021017423, -0.5024219518636905, -0.7487360276799053 },
+  { -0.34406881797977745, -0.5523381783887888, -0.7593017747826968 },
+  { 0.5011469491418199, 0.01220020662704805, -0.8652761930875617 },
+  { 0.3274880608186487, 0.7241231608717333, -0.6069573443911611 },
+  { 0.10793257607068941, 0.6519880612642227, -0.7505079126775845 },
+  { 0.6044250694264234, 0.7052602895441197, 0.3705108088045583 },
+  { 0.9819510452214386, 0.011797933075673476, 0.18876692921077562 },
+};
+
+}
@@ -0,0 +1,55 @@
+//******************************************************************************
+///
+/// @file core/material/noisetables.h
+///
+/// Noise generator lookup tables
+/// Auto-generated using metagen-noise.py.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+/// @file
+/// @attention
+///     **DO NOT EDIT THIS FILE!**
+///     Instead, if this file needs fixing, modify metagen-noise.py
+///     or its invocation in `tools/meta-make/Makefile` accordingly,
+///     and re-generate this file as described in @ref tools-metamake (`tools/meta-make/readme.md`).
+
+namespace pov {
+
+/// Pseudo-random permutation of [0..4095], repeated twice.
+extern const unsigned short hashTable[8192];
+
+/// Pseudo-random permutation table of the Perlin noise generator.
+extern const int NoisePermutation[4098];
+
+/// Random unit gradient vectors of the Perlin noise generator.
+extern const double NoiseGradients[4098][3];
+
+}
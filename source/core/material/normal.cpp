@@ -725,6 +725,9 @@ void Post_Tnormal (TNORMAL *Tnormal)
 
         Tnormal->Flags |= POST_DONE;
 
+        if (Tnormal->pattern != nullptr)
+            Optimize_Warps(Tnormal->pattern->warps);
+
         if ((Map = Tnormal->Blend_Map) != nullptr)
         {
             Map->Post((Tnormal->Flags & DONT_SCALE_BUMPS_FLAG) != 0);
@@ -872,6 +875,7 @@ void Perturb_Normal(Vector3d& Layer_Normal, const TNORMAL *Tnormal, const Vector
     else
     {
         shared_ptr<SlopeBlendMap> slopeMap = dynamic_pointer_cast<SlopeBlendMap>(Tnormal->Blend_Map);
+        Vector3d gradient;
 
         Warp_Normal(Layer_Normal,Layer_Normal, Tnormal,
                     Test_Flag(Tnormal,DONT_SCALE_BUMPS_FLAG));
@@ -883,11 +887,27 @@ void Perturb_Normal(Vector3d& Layer_Normal, const TNORMAL *Tnormal, const Vector
         /* warp the center point first - this is the last warp */
         Warp_EPoint(TPoint,EPoint,Tnormal);
 
-        for(i=0; i<=3; i++)
+        if ((slopeMap == nullptr) && !Test_Flag(Tnormal, EXPLICIT_DELTA_FLAG) &&
+            Tnormal->pattern->EvaluateGradient(gradient, TPoint, Intersection, ray, Thread))
+        {
+            // The pyramid samples below add up to 4/3 * Delta times the gradient, so use the same
+            // scale here; an explicit accuracy still takes the sampled path, as it blurs the bumps.
+            Layer_Normal += (Amount * (DBL)Tnormal->Delta * 4.0 / 3.0) * gradient;
+        }
+        else
         {
-            P1 = TPoint + (DBL)Tnormal->Delta * Pyramid_Vect[i]; /* NK delta */
-            value1 = Do_Slope_Map(Evaluate_TPat(Tnormal, P1, Intersection, ray, Thread), slopeMap.get());
-            Layer_Normal += (value1*Amount) * Pyramid_Vect[i];
+            // sample all four points in one go, so that patterns able to evaluate them together can do so
+            Vector3d points[4];
+            DBL values[4];
+
+            for(i=0; i<=3; i++)
+                points[i] = TPoint + (DBL)Tnormal->Delta * Pyramid_Vect[i]; /* NK delta */
+            Evaluate_TPat(Tnormal, values, points, 4, Intersection, ray, Thread);
+            for(i=0; i<=3; i++)
+            {
+                value1 = Do_Slope_Map(values[i], slopeMap.get());
+                Layer_Normal += (value1*Amount) * Pyramid_Vect[i];
+            }
         }
 
         UnWarp_Normal(Layer_Normal,Layer_Normal,Tnormal,
@@ -45,6 +45,10 @@
 #include <limits>
 #include <algorithm>
 
+#if POV_MULTITHREADED
+#include <boost/thread/mutex.hpp>
+#endif
+
 #include "base/fileinputoutput.h"
 
 #include "core/material/blendmap.h"
@@ -285,6 +289,14 @@ ColourBlendMapConstPtr BasicPattern::GetDefaultBlendMap() const { return gpDefau
 
 bool BasicPattern::HasSpecialTurbulenceHandling() const { return false; }
 
+void BasicPattern::EvaluateBatch(DBL *values, const Vector3d *points, unsigned int count, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const
+{
+    for (unsigned int i = 0; i < count; ++i)
+        values[i] = Evaluate(points[i], pIsection, pRay, pThread);
+}
+
+bool BasicPattern::EvaluateGradient(Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const { return false; }
+
 
 ImagePatternImpl::ImagePatternImpl() :
     pImage(nullptr)
@@ -340,8 +352,24 @@ ContinuousPattern::ContinuousPattern(const ContinuousPattern& obj) :
 
 DBL ContinuousPattern::Evaluate(const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const
 {
-    DBL value = EvaluateRaw(EPoint, pIsection, pRay, pThread);
+    return ApplyWave(EvaluateRaw(EPoint, pIsection, pRay, pThread));
+}
+
+void ContinuousPattern::EvaluateBatch(DBL *values, const Vector3d *points, unsigned int count, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const
+{
+    EvaluateRawBatch(values, points, count, pIsection, pRay, pThread);
+    for (unsigned int i = 0; i < count; ++i)
+        values[i] = ApplyWave(values[i]);
+}
+
+void ContinuousPattern::EvaluateRawBatch(DBL *values, const Vector3d *points, unsigned int count, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const
+{
+    for (unsigned int i = 0; i < count; ++i)
+        values[i] = EvaluateRaw(points[i], pIsection, pRay, pThread);
+}
 
+DBL ContinuousPattern::ApplyWave(DBL value) const
+{
     if (waveType == kWaveType_Raw)
         return value;
 
@@ -378,6 +406,59 @@ DBL ContinuousPattern::Evaluate(const Vector3d& EPoint, const Intersection *pIse
     return value;
 }
 
+bool ContinuousPattern::EvaluateGradient(Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const
+{
+    DBL value, slope;
+
+    if (!EvaluateRawGradient(value, gradient, EPoint, pIsection, pRay, pThread))
+        return false;
+
+    if (waveType == kWaveType_Raw)
+        return true;
+
+    // Mirror the wave function as applied by Evaluate(), and apply the chain rule.
+
+    if(waveFrequency != 0.0)
+    {
+        value = fmod(value * waveFrequency + wavePhase, 1.00001);
+        gradient *= waveFrequency;
+    }
+
+    if(value < 0.0)
+        value -= floor(value);
+
+    switch(waveType)
+    {
+        case kWaveType_Ramp:
+            slope = 1.0;
+            break;
+        case kWaveType_Sine:
+            slope = M_PI * cos(value * TWO_M_PI);
+            break;
+        case kWaveType_Triangle:
+            slope = ((value - floor(value)) >= 0.5) ? -2.0 : 2.0;
+            break;
+        case kWaveType_Scallop:
+            slope = M_PI * cos(value * M_PI);
+            if (cycloidal(value * 0.5) < 0.0)
+                slope = -slope;
+            break;
+        case kWaveType_Cubic:
+            slope = 6.0 * value * (1.0 - value);
+            break;
+        case kWaveType_Poly:
+            slope = (value > 0.0) ? waveExponent * pow(value, (DBL) waveExponent - 1.0) : 0.0;
+            break;
+        default:
+            throw POV_EXCEPTION_STRING("Unknown Wave Type.");
+    }
+
+    gradient *= slope;
+    return true;
+}
+
+bool ContinuousPattern::EvaluateRawGradient(DBL& value, Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const { return false; }
+
 unsigned int ContinuousPattern::NumDiscreteBlendMapEntries() const { return 0; }
 bool ContinuousPattern::CanMap() const { return true; }
 
@@ -483,6 +564,7 @@ bool ColourImagePattern::Evaluate(TransColour& result, const Vector3d& EPoint, c
 
     int reg_number;
     DBL xcoor = 0.0, ycoor = 0.0;
+    DBL footprint = 0.0;
 
     // If outside map coverage area, return clear
 
@@ -494,12 +576,55 @@ bool ColourImagePattern::Evaluate(TransColour& result, const Vector3d& EPoint, c
     else
     {
         RGBFTColour rgbft;
-        image_colour_at(pImage, xcoor, ycoor, rgbft, &reg_number, false);
+        if (pImage->Mip_Map_Flag && (pIsection != nullptr) && (pRay != nullptr))
+            footprint = GetFootprint(EPoint, xcoor, ycoor, pIsection, pRay);
+        image_colour_at(pImage, xcoor, ycoor, footprint, rgbft, &reg_number, false);
         result = ToTransColour(rgbft);
         return true;
     }
 }
 
+DBL ColourImagePattern::GetFootprint(const Vector3d& EPoint, DBL xcoor, DBL ycoor, const Intersection *pIsection, const Ray *pRay) const
+{
+    DBL width = pRay->GetFootprint(pIsection->Depth);
+    if (width <= 0.0)
+        return 0.0;
+
+    // Span the cross-section of the ray's footprint by two vectors perpendicular to the ray.
+    Vector3d direction = pRay->Direction.normalized();
+    Vector3d axis[2];
+    axis[0] = cross(direction, (fabs(direction[X]) < 0.5 ? Vector3d(1.0, 0.0, 0.0) : Vector3d(0.0, 1.0, 0.0))).normalized();
+    axis[1] = cross(direction, axis[0]) * width;
+    axis[0] *= width;
+
+    // Bring them into pattern space; only transformations are considered, as other warps have no well-defined scale.
+    for (WarpList::const_reverse_iterator iWarp = warps.rbegin(); iWarp != warps.rend(); iWarp ++)
+    {
+        const TransformWarp* warp = dynamic_cast<const TransformWarp*>(*iWarp);
+        if (warp != nullptr)
+        {
+            MInvTransDirection(axis[0], axis[0], &warp->Trans);
+            MInvTransDirection(axis[1], axis[1], &warp->Trans);
+        }
+    }
+
+    // Measure the extent in image pixels.
+    DBL footprint = 0.0;
+    for (int i = 0; i < 2; i ++)
+    {
+        DBL x, y;
+        if (map_pos(EPoint + axis[i], pImage, &x, &y))
+            continue;
+        DBL dx = fabs(x - xcoor);
+        DBL dy = fabs(y - ycoor);
+        // compensate for wrap-around
+        dx = min(dx, pImage->iwidth  - dx);
+        dy = min(dy, pImage->iheight - dy);
+        footprint = max(footprint, max(dx, dy));
+    }
+    return footprint;
+}
+
 bool ColourImagePattern::HasTransparency() const
 {
     return (!pImage || pImage->Once_Flag || !is_image_opaque(pImage));
@@ -830,7 +955,57 @@ MandelXPattern::MandelXPattern(const MandelXPattern& obj) :
 
 DBL Evaluate_TPat (const TPATTERN *TPat, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread)
 {
-    return TPat->pattern->Evaluate(EPoint, pIsection, pRay, pThread);
+    // Only memoise evaluations made while shading an intersection, as that's what the memo's generations track.
+    if ((pThread == nullptr) || (pIsection == nullptr))
+        return TPat->pattern->Evaluate(EPoint, pIsection, pRay, pThread);
+
+    const BasicPattern *pattern = TPat->pattern.get();
+    DBL value;
+    if (!pThread->mPatternMemo.Find(pattern, pIsection, EPoint, pIsection->PNormal, value))
+    {
+        value = pattern->Evaluate(EPoint, pIsection, pRay, pThread);
+        pThread->mPatternMemo.Store(pattern, pIsection, EPoint, pIsection->PNormal, value);
+    }
+    return value;
+}
+
+void Evaluate_TPat (const TPATTERN *TPat, DBL *values, const Vector3d *points, unsigned int count, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread)
+{
+    const BasicPattern *pattern = TPat->pattern.get();
+
+    if ((pThread == nullptr) || (pIsection == nullptr))
+    {
+        pattern->EvaluateBatch(values, points, count, pIsection, pRay, pThread);
+        return;
+    }
+
+    // Evaluate whatever the memo doesn't know in one batch.
+    const unsigned int kChunkSize = 8;
+    Vector3d missPoints[kChunkSize];
+    DBL missValues[kChunkSize];
+    unsigned int missIndex[kChunkSize];
+
+    for (unsigned int first = 0; first < count; first += kChunkSize)
+    {
+        unsigned int last = min(count, first + kChunkSize);
+        unsigned int misses = 0;
+        for (unsigned int i = first; i < last; ++i)
+        {
+            if (!pThread->mPatternMemo.Find(pattern, pIsection, points[i], pIsection->PNormal, values[i]))
+            {
+                missPoints[misses] = points[i];
+                missIndex[misses++] = i;
+            }
+        }
+        if (misses == 0)
+            continue;
+        pattern->EvaluateBatch(missValues, missPoints, misses, pIsection, pRay, pThread);
+        for (unsigned int i = 0; i < misses; ++i)
+        {
+            values[missIndex[i]] = missValues[i];
+            pThread->mPatternMemo.Store(pattern, pIsection, missPoints[i], pIsection->PNormal, missValues[i]);
+        }
+    }
 }
 
 
@@ -5744,6 +5919,132 @@ DBL CheckerPattern::Evaluate(const Vector3d& EPoint, const Intersection *pIsecti
 ******************************************************************************/
 static int IntPickInCube(int tvx, int tvy, int tvz, Vector3d& p1);
 
+/// Crackle cells shared by all render threads.
+class SharedCrackleCache
+{
+    public:
+
+        /// Gets the cache instance.
+        /// @note   The instance is deliberately never destroyed, as render threads may outlive any static object.
+        static SharedCrackleCache& GetInstance()
+        {
+            static SharedCrackleCache *instance = new SharedCrackleCache();
+            return *instance;
+        }
+
+        /// Looks up a cell.
+        CrackleCacheEntryPtr Find(const CrackleCellCoord& coord);
+
+        /// Adds a cell, unless an equivalent one is already present.
+        /// @return     The cell now cached.
+        CrackleCacheEntryPtr Insert(const CrackleCellCoord& coord, const CrackleCacheEntryPtr& entry);
+
+    protected:
+
+        static const int kShards = 32;
+        static const size_t kMaxShardCells = (size_t(CRACKLE_CACHE_SIZE_LIMIT) * 1024 * 1024) / (kShards * sizeof(CrackleCacheEntry));
+
+        typedef std::list<std::pair<CrackleCellCoord, CrackleCacheEntryPtr> > CellList;
+        typedef boost::unordered_map<CrackleCellCoord, CellList::iterator, boost::hash<CrackleCellCoord> > CellIndex;
+
+        struct Shard
+        {
+            CellList    cells;  ///< Cached cells, most recently used first.
+            CellIndex   index;
+#if POV_MULTITHREADED
+            boost::mutex mutex;
+#endif
+        };
+
+        Shard shards[kShards];
+
+        Shard& GetShard(const CrackleCellCoord& coord) { return shards[hash_value(coord) % kShards]; }
+};
+
+CrackleCacheEntryPtr SharedCrackleCache::Find(const CrackleCellCoord& coord)
+{
+    Shard& shard = GetShard(coord);
+
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(shard.mutex);
+#endif
+
+    CellIndex::iterator found = shard.index.find(coord);
+    if (found == shard.index.end())
+        return CrackleCacheEntryPtr();
+    if (found->second != shard.cells.begin())
+        shard.cells.splice(shard.cells.begin(), shard.cells, found->second);
+    return found->second->second;
+}
+
+CrackleCacheEntryPtr SharedCrackleCache::Insert(const CrackleCellCoord& coord, const CrackleCacheEntryPtr& entry)
+{
+    Shard& shard = GetShard(coord);
+
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(shard.mutex);
+#endif
+
+    // another thread may have computed the same cell in the meantime
+    CellIndex::iterator found = shard.index.find(coord);
+    if (found != shard.index.end())
+        return found->second->second;
+
+    shard.cells.push_front(CellList::value_type(coord, entry));
+    shard.index[coord] = shard.cells.begin();
+
+    // cells evicted here remain valid for as long as any thread still holds them in its own cache
+    while (shard.cells.size() > kMaxShardCells)
+    {
+        shard.index.erase(shard.cells.back().first);
+        shard.cells.pop_back();
+    }
+
+    return entry;
+}
+
+CrackleCache::CrackleCache()
+{
+    // the index never holds more than a fixed number of cells, so we can allocate its buckets right away
+    mIndex.rehash(CRACKLE_THREAD_CACHE_CELLS);
+}
+
+const CrackleCacheEntry* CrackleCache::Find(const CrackleCellCoord& coord)
+{
+    CellIndex::iterator found = mIndex.find(coord);
+    if (found != mIndex.end())
+    {
+        if (found->second != mCells.begin())
+            mCells.splice(mCells.begin(), mCells, found->second);
+        return found->second->second.get();
+    }
+
+    CrackleCacheEntryPtr entry = SharedCrackleCache::GetInstance().Find(coord);
+    if (entry == nullptr)
+        return nullptr;
+    Add(coord, entry);
+    return entry.get();
+}
+
+const CrackleCacheEntry* CrackleCache::Insert(const CrackleCellCoord& coord, const CrackleCacheEntryPtr& entry)
+{
+    CrackleCacheEntryPtr shared = SharedCrackleCache::GetInstance().Insert(coord, entry);
+    Add(coord, shared);
+    return shared.get();
+}
+
+void CrackleCache::Add(const CrackleCellCoord& coord, const CrackleCacheEntryPtr& entry)
+{
+    mCells.push_front(CellList::value_type(coord, entry));
+    mIndex[coord] = mCells.begin();
+
+    if (mCells.size() > CRACKLE_THREAD_CACHE_CELLS)
+    {
+        mIndex.erase(mCells.back().first);
+        mCells.pop_back();
+    }
+}
+
 DBL CracklePattern::EvaluateRaw(const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const
 {
     Vector3d tmpPoint = EPoint;
@@ -5781,12 +6082,9 @@ DBL CracklePattern::EvaluateRaw(const Vector3d& EPoint, const Intersection *pIse
     CrackleCellCoord ccoord(flox, floy, floz, repeat.x(), repeat.y(), repeat.z());
     pThread->Stats()[CrackleCache_Tests]++;
 
-    CrackleCacheEntry dummy_entry;
-    CrackleCacheEntry* entry = &dummy_entry;
-
-    // search for this hash value in the cache
-    CrackleCache::iterator iter = pThread->mCrackleCache.find(ccoord);
-    if (iter == pThread->mCrackleCache.end())
+    // search for this cell in the cache
+    const CrackleCacheEntry* entry = pThread->mCrackleCache.Find(ccoord);
+    if (entry == nullptr)
     {
         /*
          * No, not same unit cube.  Calculate the random points for this new
@@ -5798,20 +6096,7 @@ DBL CracklePattern::EvaluateRaw(const Vector3d& EPoint, const Intersection *pIse
          * cubes glued onto each face.
          */
 
-        // generate a new cache entry, but only if the size of the cache is reasonable.
-        // having to re-calculate entries that would have been cache hits had we not
-        // skipped on adding an entry is less expensive than chewing up immense amounts
-        // of RAM and finally hitting the swapfile. unfortunately there's no good way
-        // to tell how much memory is 'too much' for the cache, so we just use a hard-
-        // coded number for now (ideally we should allow the user to configure this).
-        // keep in mind that the cache memory usage is per-thread, so the more threads,
-        // the more RAM. if we don't do the insert, entry will point at a local variable.
-        if (pThread->mCrackleCache.size() * sizeof(CrackleCache::value_type) < 30 * 1024 * 1024)
-        {
-            iter = pThread->mCrackleCache.insert(pThread->mCrackleCache.end(), CrackleCache::value_type(ccoord, CrackleCacheEntry()));
-            entry = &iter->second;
-            entry->lastUsed = pThread->ProgressIndex();
-        }
+        shared_ptr<CrackleCacheEntry> newEntry(new CrackleCacheEntry());
 
         // see InitializeCrackleCubes() below.
         int *pc = gaCrackleCubeTable;
@@ -5839,14 +6124,16 @@ DBL CracklePattern::EvaluateRaw(const Vector3d& EPoint, const Intersection *pIse
                 wrappingOffset.z() += (cacheZ - wrapped);
                 cacheZ = wrapped;
             }
-            IntPickInCube(cacheX, cacheY, cacheZ, entry->aCellNuclei[i]);
-            entry->aCellNuclei[i] += wrappingOffset;
+            IntPickInCube(cacheX, cacheY, cacheZ, newEntry->aCellNuclei[i]);
+            newEntry->aCellNuclei[i] += wrappingOffset;
         }
+
+        // the cache size is bounded, so we can always insert the new cell
+        entry = pThread->mCrackleCache.Insert(ccoord, newEntry);
     }
     else
     {
         pThread->Stats()[CrackleCache_Tests_Succeeded]++;
-        entry = &iter->second;
     }
 
     // Find the 3 points with the 3 shortest distances from the input point.
@@ -6345,6 +6632,30 @@ DBL FunctionPattern::EvaluateRaw(const Vector3d& EPoint, const Intersection *pIs
     return ((value > 1.0) ? fmod(value, 1.0) : value);
 }
 
+void FunctionPattern::EvaluateRawBatch(DBL *values, const Vector3d *points, unsigned int count, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const
+{
+    const unsigned int kChunkSize = 8;
+    DBL args[kChunkSize * 3];
+    GenericScalarFunctionInstance fn(pFn, pThread);
+
+    for (unsigned int first = 0; first < count; first += kChunkSize)
+    {
+        unsigned int n = min(count - first, kChunkSize);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            args[i * 3 + X] = points[first + i][X];
+            args[i * 3 + Y] = points[first + i][Y];
+            args[i * 3 + Z] = points[first + i][Z];
+        }
+        fn.EvaluateBatch(args, 3, n, &values[first]);
+        for (unsigned int i = 0; i < n; ++i)
+        {
+            if (values[first + i] > 1.0)
+                values[first + i] = fmod(values[first + i], 1.0);
+        }
+    }
+}
+
 
 /*****************************************************************************
 *
@@ -6390,6 +6701,13 @@ DBL GradientPattern::EvaluateRaw(const Vector3d& EPoint, const Intersection *pIs
     return ((Result > 1.0) ? fmod(Result, 1.0) : Result);
 }
 
+bool GradientPattern::EvaluateRawGradient(DBL& value, Vector3d& result, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const
+{
+    value = EvaluateRaw(EPoint, pIsection, pRay, pThread);
+    result = gradient;
+    return true;
+}
+
 
 /*****************************************************************************
 *
@@ -6461,6 +6779,58 @@ DBL GranitePattern::EvaluateRaw(const Vector3d& EPoint, const Intersection *pIse
     return(noise);
 }
 
+bool GranitePattern::EvaluateRawGradient(DBL& value, Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const
+{
+    int noise_generator = GetNoiseGen(pThread);
+
+    int i;
+    DBL temp, freq = 1.0;
+    Vector3d tv1, tv2, slope;
+
+    tv1 = EPoint * 4.0;
+    value = 0.0;
+    gradient = Vector3d(0.0);
+
+    // Same as EvaluateRaw(), except that each octave's slope is accumulated as well.
+    for (i = 0; i < 6; freq *= 2.0, i++)
+    {
+        tv2 = tv1 * freq;
+        temp = NoiseGradient(slope, tv2, noise_generator);
+        slope *= 4.0 * freq;
+
+        switch (noise_generator)
+        {
+            case kNoiseGen_Default:
+            case kNoiseGen_Original:
+                temp = 0.5 - temp;
+                slope = -slope;
+                break;
+
+            default:
+                temp = 1.0 - 2.0 * temp;
+                slope *= -2.0;
+                break;
+        }
+
+        if (temp < 0.0)
+        {
+            temp = -temp;
+            slope = -slope;
+        }
+
+        if ((noise_generator != kNoiseGen_Default) && (noise_generator != kNoiseGen_Original) && (temp > 0.5))
+        {
+            temp = 0.5;
+            slope = Vector3d(0.0);
+        }
+
+        value += temp / freq;
+        gradient += slope / freq;
+    }
+
+    return true;
+}
+
 
 /*****************************************************************************
 *
@@ -7858,6 +8228,12 @@ DBL NoisePattern::EvaluateRaw(const Vector3d& EPoint, const Intersection *pIsect
     return Noise(EPoint, GetNoiseGen(pThread));
 }
 
+bool NoisePattern::EvaluateRawGradient(DBL& value, Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const
+{
+    value = NoiseGradient(gradient, EPoint, GetNoiseGen(pThread));
+    return true;
+}
+
 
 
 /*****************************************************************************
@@ -39,6 +39,8 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include <list>
+
 #include <boost/functional/hash/hash.hpp> // required for crackle
 #include <boost/unordered_map.hpp>
 
@@ -97,7 +99,7 @@ enum PATTERN_IDS
 
 #define NO_FLAGS              0
 #define HAS_FILTER            1
-// value 2 is currently not used
+#define EXPLICIT_DELTA_FLAG   2 /* normal has an explicit accuracy */
 #define POST_DONE             4
 #define DONT_SCALE_BUMPS_FLAG 8 /* scale bumps for normals */
 
@@ -216,6 +218,37 @@ struct BasicPattern
     ///
     virtual DBL Evaluate(const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const = 0;
 
+    /// Evaluates the pattern at several points in space.
+    ///
+    /// @note       Patterns that cannot evaluate several points more efficiently than one after the other do not need to
+    ///             override this method.
+    ///
+    /// @param[out]     values      The pattern's value at each of the points, as per @ref Evaluate().
+    /// @param[in]      points      The points of interest in 3D space.
+    /// @param[in]      count       The number of points.
+    /// @param[in]      pIsection   Additional information about the intersection. Evaluated by some patterns.
+    /// @param[in]      pRay        Additional information about the ray. Evaluated by some patterns.
+    /// @param[in,out]  pThread     Additional thread-local data. Evaluated by some patterns.
+    ///
+    virtual void EvaluateBatch(DBL *values, const Vector3d *points, unsigned int count, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
+
+    /// Evaluates the gradient of the pattern at a given point in space, if it is known analytically.
+    ///
+    /// This allows normal perturbation to do with a single evaluation, rather than sampling the pattern at several
+    /// nearby points to estimate the gradient.
+    ///
+    /// @note       Patterns without an analytic gradient do not need to override this method.
+    ///
+    /// @param[out]     gradient    The gradient of the pattern's value at the given point in space.
+    /// @param[in]      EPoint      The point of interest in 3D space.
+    /// @param[in]      pIsection   Additional information about the intersection. Evaluated by some patterns.
+    /// @param[in]      pRay        Additional information about the ray. Evaluated by some patterns.
+    /// @param[in,out]  pThread     Additional thread-local data. Evaluated by some patterns.
+    /// @return                     `true` if the gradient has been computed, or `false` if the pattern provides no
+    ///                             analytic gradient.
+    ///
+    virtual bool EvaluateGradient(Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
+
     /// Gets the default blend map associated with this pattern.
     ///
     /// While blend maps are generally outside the scope of this class, for legacy reasons some patterns (such as
@@ -325,8 +358,47 @@ struct ContinuousPattern : public BasicPattern
     ///
     virtual DBL EvaluateRaw(const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const = 0;
 
+    /// Evaluates the pattern at several points in space, taking into account the wave function.
+    ///
+    /// @note   Derived classes should _not_ override this, but @ref EvaluateRawBatch() instead.
+    ///
+    virtual void EvaluateBatch(DBL *values, const Vector3d *points, unsigned int count, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
+
+    /// Evaluates the pattern at several points in space, without taking into account the wave function.
+    ///
+    /// @note   Patterns that cannot evaluate several points more efficiently than one after the other do not need to
+    ///         override this method.
+    ///
+    virtual void EvaluateRawBatch(DBL *values, const Vector3d *points, unsigned int count, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
+
+    /// Evaluates the gradient of the pattern at a given point in space, taking into account the wave function.
+    ///
+    /// @note   Derived classes should _not_ override this, but @ref EvaluateRawGradient() instead.
+    ///
+    virtual bool EvaluateGradient(Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
+
+    /// Evaluates the pattern and its gradient at a given point in space, without taking into account the wave function.
+    ///
+    /// @note   Patterns without an analytic gradient do not need to override this method.
+    ///
+    /// @param[out]     value       The pattern's value at the given point in space, as per @ref EvaluateRaw().
+    /// @param[out]     gradient    The gradient of that value.
+    /// @param[in]      EPoint      The point of interest in 3D space.
+    /// @param[in]      pIsection   Additional information about the intersection. Evaluated by some patterns.
+    /// @param[in]      pRay        Additional information about the ray. Evaluated by some patterns.
+    /// @param[in,out]  pThread     Additional thread-local data. Evaluated by some patterns.
+    /// @return                     `true` if the gradient has been computed, or `false` if the pattern provides no
+    ///                             analytic gradient.
+    ///
+    virtual bool EvaluateRawGradient(DBL& value, Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
+
     virtual unsigned int NumDiscreteBlendMapEntries() const;
     virtual bool CanMap() const;
+
+protected:
+
+    /// Applies the wave function to a value obtained from @ref EvaluateRaw().
+    DBL ApplyWave(DBL value) const;
 };
 
 /// Abstract class providing additions to the basic pattern interface, as well as common code, for all
@@ -533,6 +605,7 @@ struct FunctionPattern : public ContinuousPattern
     virtual ~FunctionPattern();
     virtual PatternPtr Clone() const { return BasicPattern::Clone(*this); }
     virtual DBL EvaluateRaw(const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
+    virtual void EvaluateRawBatch(DBL *values, const Vector3d *points, unsigned int count, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
 };
 
 /// Implements the `gradient` pattern.
@@ -543,6 +616,7 @@ struct GradientPattern : public ContinuousPattern
 
     virtual PatternPtr Clone() const { return BasicPattern::Clone(*this); }
     virtual DBL EvaluateRaw(const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
+    virtual bool EvaluateRawGradient(DBL& value, Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
 };
 
 /// Implements the `granite` pattern.
@@ -550,6 +624,7 @@ struct GranitePattern : public ContinuousPattern
 {
     virtual PatternPtr Clone() const { return BasicPattern::Clone(*this); }
     virtual DBL EvaluateRaw(const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
+    virtual bool EvaluateRawGradient(DBL& value, Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
 };
 
 /// Implements the `hexagon` pattern.
@@ -595,6 +670,7 @@ struct NoisePattern : public ContinuousPattern
 {
     virtual PatternPtr Clone() const = 0;
     virtual DBL EvaluateRaw(const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
+    virtual bool EvaluateRawGradient(DBL& value, Vector3d& gradient, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
 };
 
 /// Implements the `object` pattern.
@@ -1097,6 +1173,11 @@ struct ColourImagePattern : public ColourPattern, public ImagePatternImpl
     virtual PatternPtr Clone() const { return BasicPattern::Clone(*this); }
     virtual bool Evaluate(TransColour& result, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread) const;
     virtual bool HasTransparency() const;
+
+protected:
+
+    /// Computes the size of the ray's footprint at the intersection, in image pixels.
+    DBL GetFootprint(const Vector3d& EPoint, DBL xcoor, DBL ycoor, const Intersection *pIsection, const Ray *pRay) const;
 };
 
 
@@ -1118,7 +1199,9 @@ public:
 
     bool operator==(CrackleCellCoord const& other) const
     {
-        return mX == other.mX && mY == other.mY && mZ == other.mZ;
+        // NB: cells close to the edge of a repeating pattern differ from those of a non-repeating one.
+        return mX == other.mX && mY == other.mY && mZ == other.mZ &&
+               mRepeatX == other.mRepeatX && mRepeatY == other.mRepeatY && mRepeatZ == other.mRepeatZ;
     }
 
     /// Function to compute a hash value from the coordinates.
@@ -1161,20 +1244,136 @@ protected:
 /// Helper class to implement the crackle cache.
 struct CrackleCacheEntry
 {
-    /// A kind of timestamp specifying when this particular entry was last used.
-    size_t lastUsed;
-
     /// The pseudo-random points defining the pattern in this particular subset of 3D space.
     Vector3d aCellNuclei[81];
 };
 
-typedef boost::unordered_map<CrackleCellCoord, CrackleCacheEntry, boost::hash<CrackleCellCoord> > CrackleCache;
+typedef shared_ptr<const CrackleCacheEntry> CrackleCacheEntryPtr;
+
+/// Crackle cache of a single render thread.
+///
+/// As the nuclei of a cell depend on nothing but the cell's coordinates, any cell computed by one thread
+/// is also published in a cache shared by all threads, where the other threads pick it up rather than
+/// computing it anew. Both tiers are bounded in size, evicting the least recently used cells first. Cells
+/// are reference-counted and immutable once published, so the per-thread tier holds no copies of its own.
+///
+class CrackleCache
+{
+public:
+
+    CrackleCache();
+
+    /// Looks up a cell, first in the thread's own cache and then in the shared one.
+    /// @note       The cell is only guaranteed to stay valid until the next call to any of the cache's methods.
+    /// @return     The cell, or `nullptr` if it needs to be computed.
+    const CrackleCacheEntry* Find(const CrackleCellCoord& coord);
+
+    /// Adds a freshly computed cell to both the thread's own cache and the shared one.
+    /// @note       The cell is only guaranteed to stay valid until the next call to any of the cache's methods.
+    /// @return     The cell to use, which may be an equivalent one published concurrently by another thread.
+    const CrackleCacheEntry* Insert(const CrackleCellCoord& coord, const CrackleCacheEntryPtr& entry);
+
+protected:
+
+    typedef std::list<std::pair<CrackleCellCoord, CrackleCacheEntryPtr> > CellList;
+    typedef boost::unordered_map<CrackleCellCoord, CellList::iterator, boost::hash<CrackleCellCoord> > CellIndex;
+
+    CellList    mCells; ///< Cells, most recently used first.
+    CellIndex   mIndex; ///< Cells, by coordinate.
+
+    void Add(const CrackleCellCoord& coord, const CrackleCacheEntryPtr& entry);
+};
+
+/// Per-thread memo of pattern values computed while shading a single intersection.
+///
+/// Layered textures, texture maps and averaged textures may evaluate the same pattern at the same point
+/// several times while shading one intersection; the memo allows all but the first of these evaluations
+/// to be skipped. Entries are only valid for the intersection they were computed for: The trace code
+/// starts a new generation whenever it begins shading an intersection, which invalidates all entries
+/// in one go. As patterns such as `slope` or `aoi` also depend on the (possibly perturbed) surface
+/// normal, the normal is part of the key as well.
+///
+class PatternMemo
+{
+public:
+
+    PatternMemo() : mGeneration(1) {}
+
+    /// Invalidates all entries.
+    inline void NewGeneration()
+    {
+        if (++mGeneration == 0)
+        {
+            // generation counter has wrapped around; make sure stale entries can't match by accident
+            for (unsigned int i = 0; i < kSize; ++i)
+                mEntry[i].generation = 0;
+            mGeneration = 1;
+        }
+    }
+
+    /// Looks up a pattern value.
+    /// @return     `true` if a value for the given pattern, intersection, point and normal is present.
+    inline bool Find(const BasicPattern *pattern, const Intersection *pIsection, const Vector3d& point, const Vector3d& normal, DBL& value) const
+    {
+        const Entry& entry = mEntry[Slot(pattern, point)];
+        if ((entry.generation != mGeneration) || (entry.pattern != pattern) || (entry.isect != pIsection) ||
+            !SameVector(entry.point, point) || !SameVector(entry.normal, normal))
+            return false;
+        value = entry.value;
+        return true;
+    }
+
+    /// Stores a pattern value, replacing whatever entry previously occupied the same slot.
+    inline void Store(const BasicPattern *pattern, const Intersection *pIsection, const Vector3d& point, const Vector3d& normal, DBL value)
+    {
+        Entry& entry = mEntry[Slot(pattern, point)];
+        entry.generation = mGeneration;
+        entry.pattern    = pattern;
+        entry.isect      = pIsection;
+        entry.point      = point;
+        entry.normal     = normal;
+        entry.value      = value;
+    }
+
+protected:
+
+    static const unsigned int kSize = 16; ///< Number of entries; must be a power of 2.
+
+    struct Entry
+    {
+        unsigned int        generation;
+        const BasicPattern* pattern;
+        const Intersection* isect;
+        Vector3d            point;
+        Vector3d            normal;
+        DBL                 value;
+        Entry() : generation(0), pattern(nullptr), isect(nullptr) {}
+    };
+
+    Entry           mEntry[kSize];
+    unsigned int    mGeneration;
+
+    static inline bool SameVector(const Vector3d& a, const Vector3d& b)
+    {
+        return (a[X] == b[X]) && (a[Y] == b[Y]) && (a[Z] == b[Z]);
+    }
+
+    static inline unsigned int Slot(const BasicPattern *pattern, const Vector3d& point)
+    {
+        size_t seed = reinterpret_cast<size_t>(pattern) >> 4;
+        boost::hash_combine(seed, point[X]);
+        boost::hash_combine(seed, point[Y]);
+        boost::hash_combine(seed, point[Z]);
+        return (unsigned int)(seed & (kSize - 1));
+    }
+};
 
 
 //******************************************************************************
 // Legacy Global Functions
 
 DBL Evaluate_TPat (const TPATTERN *TPat, const Vector3d& EPoint, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread);
+void Evaluate_TPat (const TPATTERN *TPat, DBL *values, const Vector3d *points, unsigned int count, const Intersection *pIsection, const Ray *pRay, TraceThreadData *pThread);
 void Init_TPat_Fields (TPATTERN *Tpat);
 void Copy_TPat_Fields (TPATTERN *New, const TPATTERN *Old);
 void Translate_Tpattern (TPATTERN *Tpattern, const Vector3d& Vector);
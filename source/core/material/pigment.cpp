@@ -259,6 +259,9 @@ void Post_Pigment(PIGMENT *Pigment, bool* pHasFilter)
 
     Pigment->Flags |= POST_DONE;
 
+    if (Pigment->pattern != nullptr)
+        Optimize_Warps(Pigment->pattern->warps);
+
     switch (Pigment->Type)
     {
         case NO_PATTERN:
@@ -334,6 +337,42 @@ void ColourBlendMap::Post(bool& rHasFilter)
             break;
         }
     }
+
+    if (lookupTable.empty())
+        BuildLookupTable();
+}
+
+void ColourBlendMap::BuildLookupTable()
+{
+    // Only long maps are worth the effort. Maps with sharp transitions (entries sharing the same value) can't be
+    // interpolated between precomputed colours, and the other blend modes depend on the scene's working gamma;
+    // those are evaluated exactly.
+    if ((COLOUR_MAP_LOOKUP_SIZE < 2) || (Blend_Map_Entries.size() < COLOUR_MAP_LOOKUP_MIN_ENTRIES) || (blendMode != 0))
+        return;
+
+    for (size_t i = 1; i < Blend_Map_Entries.size(); i ++)
+    {
+        if (Blend_Map_Entries[i].value <= Blend_Map_Entries[i-1].value)
+            return;
+    }
+
+    DBL first = Blend_Map_Entries.front().value;
+    DBL last  = Blend_Map_Entries.back().value;
+
+    lookupOffset = first;
+    lookupScale  = (COLOUR_MAP_LOOKUP_SIZE - 1) / (last - first);
+    lookupTable.resize(COLOUR_MAP_LOOKUP_SIZE);
+
+    for (int i = 0; i < COLOUR_MAP_LOOKUP_SIZE; i ++)
+    {
+        const BlendMapEntry<TransColour>* Prev;
+        const BlendMapEntry<TransColour>* Cur;
+        DBL prevWeight;
+        DBL curWeight;
+        Search (first + i / lookupScale, Prev, Cur, prevWeight, curWeight);
+        // same as Blend() in the default blend mode
+        lookupTable[i] = Prev->Vals * prevWeight + Cur->Vals * curWeight;
+    }
 }
 
 void PigmentBlendMap::Post(bool& rHasFilter)
@@ -522,6 +561,23 @@ bool ColourBlendMap::Compute(TransColour& colour, DBL value, const Vector3d& TPo
     const BlendMapEntry<TransColour>* Cur;
     DBL prevWeight;
     DBL curWeight;
+
+    if (!lookupTable.empty())
+    {
+        DBL position = (value - lookupOffset) * lookupScale;
+        if (!(position > 0.0))
+            colour = lookupTable.front();
+        else if (position >= lookupTable.size() - 1)
+            colour = lookupTable.back();
+        else
+        {
+            int i = (int)position;
+            DBL weight = position - i;
+            colour = lookupTable[i] * (1.0 - weight) + lookupTable[i+1] * weight;
+        }
+        return true;
+    }
+
     Search (value, Prev, Cur, prevWeight, curWeight);
     if (Prev == Cur)
     {
@@ -652,9 +708,10 @@ void Evaluate_Density_Pigment(vector<PIGMENT*>& Density, const Vector3d& p, Math
 
 //******************************************************************************
 
-ColourBlendMap::ColourBlendMap() : BlendMap<TransColour>(kBlendMapType_Colour) {}
+ColourBlendMap::ColourBlendMap() : BlendMap<TransColour>(kBlendMapType_Colour), lookupOffset(0.0), lookupScale(0.0) {}
 
-ColourBlendMap::ColourBlendMap(int n, const ColourBlendMap::Entry aEntries[]) : BlendMap<TransColour>(kBlendMapType_Colour)
+ColourBlendMap::ColourBlendMap(int n, const ColourBlendMap::Entry aEntries[]) : BlendMap<TransColour>(kBlendMapType_Colour),
+    lookupOffset(0.0), lookupScale(0.0)
 {
     Blend_Map_Entries.reserve(n);
     for (int i = 0; i < n; i ++)
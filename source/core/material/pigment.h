@@ -92,6 +92,15 @@ class ColourBlendMap : public BlendMap<TransColour>, public GenericPigmentBlendM
         virtual void ComputeAverage(TransColour& colour, const Vector3d& EPoint, const Intersection *Intersect, const Ray *ray, TraceThreadData *Thread);
         virtual bool ComputeUVMapped(TransColour& colour, const Intersection *Intersect, const Ray *ray, TraceThreadData *Thread);
         virtual void Post(bool& rHasFilter);
+
+    protected:
+
+        /// Colours precomputed at evenly spaced values, or empty if the map is to be evaluated exactly.
+        vector<TransColour> lookupTable;
+        DBL lookupOffset;   ///< Value corresponding to the first precomputed colour.
+        DBL lookupScale;    ///< Number of precomputed colours per unit of value.
+
+        void BuildLookupTable();
 };
 
 /// Pigment blend map.
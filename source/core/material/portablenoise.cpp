@@ -51,7 +51,7 @@
 namespace pov
 {
 
-extern DBL RTable[]; // defined in core/material/texture.cpp
+extern const DBL RTable[]; // defined in core/material/noise.cpp
 
 #define SCURVE(a) ((a)*(a)*(3.0-2.0*(a)))
 
@@ -95,7 +95,7 @@ extern DBL RTable[]; // defined in core/material/texture.cpp
 DBL PortableNoise(const Vector3d& EPoint, int noise_generator)
 {
     DBL x, y, z;
-    DBL *mp;
+    const DBL *mp;
     int tmp;
     int ix, iy, iz;
     int ixiy_hash, ixjy_hash, jxiy_hash, jxjy_hash;
@@ -253,7 +253,7 @@ DBL PortableNoise(const Vector3d& EPoint, int noise_generator)
 void PortableDNoise(Vector3d& result, const Vector3d& EPoint)
 {
     DBL x, y, z;
-    DBL *mp;
+    const DBL *mp;
     int tmp;
     int ix, iy, iz;
     int ixiy_hash, ixjy_hash, jxiy_hash, jxjy_hash;
@@ -369,4 +369,44 @@ void PortableDNoise(Vector3d& result, const Vector3d& EPoint)
     result[Z] += INCRSUMP(mp, s, x_ix, y_iy, z_jz);
 }
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   MultiNoise, MultiDNoise
+*
+* INPUT
+*
+*   EPoints -- 3-D points at which noise is evaluated
+*   count   -- number of points
+*
+* OUTPUT
+*
+*   results -- noise values, one per point
+*
+* RETURNS
+*
+* AUTHOR
+*
+* DESCRIPTION
+*   Batched versions of "Noise" and "DNoise", evaluating a whole set of points
+*   with a single (dynamically dispatched) call; this allows the compiler to
+*   inline the per-point code and interleave the evaluation of adjacent points.
+*
+* CHANGES
+*
+******************************************************************************/
+
+void PortableMultiNoise(DBL* results, const Vector3d* EPoints, int count, int noise_generator)
+{
+    for (int i = 0; i < count; ++i)
+        results[i] = PortableNoise(EPoints[i], noise_generator);
+}
+
+void PortableMultiDNoise(Vector3d* results, const Vector3d* EPoints, int count)
+{
+    for (int i = 0; i < count; ++i)
+        PortableDNoise(results[i], EPoints[i]);
+}
+
 }
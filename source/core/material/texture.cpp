@@ -54,6 +54,7 @@
 #include "core/material/pattern.h"
 #include "core/material/pigment.h"
 #include "core/material/normal.h"
+#include "core/material/warp.h"
 #include "core/support/imageutil.h"
 
 // this must be the last file included
@@ -547,6 +548,9 @@ void Post_Textures(TEXTURE *Textures)
     {
         if (!((Layer->Flags) & POST_DONE))
         {
+            if (Layer->pattern != nullptr)
+                Optimize_Warps(Layer->pattern->warps);
+
             switch (Layer->Type)
             {
                 case PLAIN_PATTERN:
@@ -686,4 +686,89 @@ void Copy_Warps (WarpList& rNew, const WarpList& old)
         rNew.push_back((*i)->Clone());
 }
 
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Optimize_Warps
+*
+* INPUT
+*
+*   warps -- List of warps of a pattern, as set up by the parser
+*
+* OUTPUT
+*
+*   warps -- Equivalent, but possibly shorter, list of warps
+*
+* RETURNS
+*
+* AUTHOR
+*
+* DESCRIPTION
+*
+*   Simplifies a pattern's list of warps once the pattern is complete, so that
+*   fewer warps need to be applied per evaluation: Consecutive transformations
+*   are merged into a single matrix, and warps without any effect are dropped.
+*
+*   Classic turbulence is left alone, as patterns handling it on their own
+*   expect it to be the first entry.
+*
+* CHANGES
+*
+******************************************************************************/
+
+static bool IsNullWarp (const GenericWarp *warp)
+{
+    if (dynamic_cast<const IdentityWarp*>(warp) != nullptr)
+        return true;
+
+    if (const TransformWarp *transform = dynamic_cast<const TransformWarp*>(warp))
+    {
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 3; j++)
+                if (transform->Trans.matrix[i][j] != ((i == j) ? 1.0 : 0.0))
+                    return false;
+        return true;
+    }
+
+    if (const TurbulenceWarp *turb = dynamic_cast<const TurbulenceWarp*>(warp))
+        return turb->Turbulence.IsNull();
+
+    return false;
+}
+
+void Optimize_Warps (WarpList& warps)
+{
+    WarpList::iterator iWarp = warps.begin();
+
+    while (iWarp != warps.end())
+    {
+        if (TransformWarp *transform = dynamic_cast<TransformWarp*>(*iWarp))
+        {
+            // Warps are applied back to front, so the transformation following in the list
+            // is the one applied last to the object, and must be composed last.
+            WarpList::iterator iNext = iWarp + 1;
+            while (iNext != warps.end())
+            {
+                TransformWarp *next = dynamic_cast<TransformWarp*>(*iNext);
+                if (next == nullptr)
+                    break;
+                Compose_Transforms(&transform->Trans, &next->Trans);
+                delete next;
+                iNext = warps.erase(iNext);
+            }
+        }
+
+        if (IsNullWarp(*iWarp))
+        {
+            delete *iWarp;
+            iWarp = warps.erase(iWarp);
+        }
+        else
+            iWarp ++;
+    }
+}
+
 }
@@ -289,6 +289,7 @@ struct ClassicTurbulence : public GenericTurbulenceWarp
 void Warp_EPoint (Vector3d& TPoint, const Vector3d& EPoint, const TPATTERN *TPat);
 void Destroy_Warps (WarpList& rWarps);
 void Copy_Warps (WarpList& rNew, const WarpList& old);
+void Optimize_Warps (WarpList& rWarps);
 void Warp_Normal (Vector3d& TNorm, const Vector3d& ENorm, const TPATTERN *TPat, bool DontScaleBumps);
 void UnWarp_Normal (Vector3d& TNorm, const Vector3d& ENorm, const TPATTERN *TPat, bool DontScaleBumps);
 
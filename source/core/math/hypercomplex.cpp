@@ -577,6 +577,141 @@ bool HypercomplexZ3FractalRules::Iterate(const Vector3d& IPoint, const Fractal *
 
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   HypercomplexFractalRules::Iterate, HypercomplexZ3FractalRules::Iterate
+*   (lane kernels)
+*
+* INPUT
+*
+*   Points - Points to test
+*   Count  - Number of points, at most FRACTAL_LANES
+*   HCompl - Fractal
+*
+* OUTPUT
+*
+*   Inside - Whether each of the points is inside the set
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Iterate several points together, doing the same arithmetic as the single
+*   point iterations but without keeping an iteration stack. See the
+*   quaternion lane kernels.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void HypercomplexFractalRules::Iterate(const Vector3d *Points, int Count, const Fractal *HCompl, bool *Inside, DBL **) const
+{
+    int i, k, Remaining;
+    DBL x[FRACTAL_LANES], y[FRACTAL_LANES], z[FRACTAL_LANES], w[FRACTAL_LANES];
+    DBL xx, yy, zz, ww;
+    DBL yz, xw;
+    DBL Exit_Value;
+
+    for (k = 0; k < Count; k++)
+    {
+        x[k] = Points[k][X];
+        y[k] = Points[k][Y];
+        z[k] = Points[k][Z];
+        w[k] = (HCompl->SliceDist
+              - HCompl->Slice[X]*x[k]
+              - HCompl->Slice[Y]*y[k]
+              - HCompl->Slice[Z]*z[k])/HCompl->Slice[T];
+
+        Inside[k] = true;
+    }
+
+    Exit_Value = HCompl->Exit_Value;
+
+    Remaining = Count;
+
+    for (i = 1; (i <= HCompl->Num_Iterations) && (Remaining > 0); ++i)
+    {
+        for (k = 0; k < Count; k++)
+        {
+            yz = y[k] * y[k] + z[k] * z[k];
+            xw = x[k] * x[k] + w[k] * w[k];
+
+            if (Inside[k] && ((xw + yz) > Exit_Value))
+            {
+                Inside[k] = false;
+                Remaining--;
+            }
+
+            xx = xw - yz + HCompl->Julia_Parm[X];
+            yy = 2.0 * (x[k] * y[k] - z[k] * w[k]) + HCompl->Julia_Parm[Y];
+            zz = 2.0 * (x[k] * z[k] - w[k] * y[k]) + HCompl->Julia_Parm[Z];
+            ww = 2.0 * (x[k] * w[k] + y[k] * z[k]) + HCompl->Julia_Parm[T];
+
+            x[k] = xx;
+            y[k] = yy;
+            z[k] = zz;
+            w[k] = ww;
+        }
+    }
+}
+
+void HypercomplexZ3FractalRules::Iterate(const Vector3d *Points, int Count, const Fractal *HCompl, bool *Inside, DBL **) const
+{
+    int i, k, Remaining;
+    DBL x[FRACTAL_LANES], y[FRACTAL_LANES], z[FRACTAL_LANES], w[FRACTAL_LANES];
+    DBL xx, yy, zz, ww;
+    DBL Norm;
+    DBL Exit_Value;
+
+    for (k = 0; k < Count; k++)
+    {
+        x[k] = Points[k][X];
+        y[k] = Points[k][Y];
+        z[k] = Points[k][Z];
+        w[k] = (HCompl->SliceDist
+              - HCompl->Slice[X]*x[k]
+              - HCompl->Slice[Y]*y[k]
+              - HCompl->Slice[Z]*z[k])/HCompl->Slice[T];
+
+        Inside[k] = true;
+    }
+
+    Exit_Value = HCompl->Exit_Value;
+
+    Remaining = Count;
+
+    for (i = 1; (i <= HCompl->Num_Iterations) && (Remaining > 0); ++i)
+    {
+        for (k = 0; k < Count; k++)
+        {
+            Norm = x[k] * x[k] + y[k] * y[k] + z[k] * z[k] + w[k] * w[k];
+
+            if (Inside[k] && (Norm > Exit_Value))
+            {
+                Inside[k] = false;
+                Remaining--;
+            }
+
+            HSqr(xx, yy, zz, ww, x[k], y[k], z[k], w[k]);
+
+            x[k] = xx + HCompl->Julia_Parm[X];
+            y[k] = yy + HCompl->Julia_Parm[Y];
+            z[k] = zz + HCompl->Julia_Parm[Z];
+            w[k] = ww + HCompl->Julia_Parm[T];
+        }
+    }
+}
+
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -70,6 +70,7 @@ class HypercomplexFractalRules : public HypercomplexBaseFractalRules
         virtual void CalcNormal (Vector3d&, int, const Fractal *, DBL **) const;
         virtual bool Iterate (const Vector3d&, const Fractal *, DBL **) const;
         virtual bool Iterate (const Vector3d&, const Fractal *, const Vector3d&, DBL *, DBL **) const;
+        virtual void Iterate (const Vector3d *, int, const Fractal *, bool *, DBL **) const;
 };
 
 class HypercomplexFunctionFractalRules : public HypercomplexBaseFractalRules
@@ -92,6 +93,7 @@ class HypercomplexZ3FractalRules : public HypercomplexBaseFractalRules
         virtual void CalcNormal (Vector3d&, int, const Fractal *, DBL **) const;
         virtual bool Iterate (const Vector3d&, const Fractal *, DBL **) const;
         virtual bool Iterate (const Vector3d&, const Fractal *, const Vector3d&, DBL *, DBL **) const;
+        virtual void Iterate (const Vector3d *, int, const Fractal *, bool *, DBL **) const;
 };
 
 class HypercomplexReciprocalFractalRules : public HypercomplexBaseFractalRules
@@ -49,11 +49,7 @@ namespace pov
 ///
 /// @{
 
-#ifdef DYNAMIC_HASHTABLE
-extern unsigned short *hashTable; // GLOBAL VARIABLE
-#else
-extern ALIGN16 unsigned short hashTable[]; // GLOBAL VARIABLE
-#endif
+extern const unsigned short hashTable[]; // defined in core/material/noisetables.cpp
 
 extern const float JitterTable[]; // GLOBAL VARIABLE
 
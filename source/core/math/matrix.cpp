@@ -295,6 +295,111 @@ void MTimesC (MATRIX result, const MATRIX matrix1, const MATRIX matrix2)
     result[3][3] = matrix1[3][0] * matrix2[0][3] + matrix1[3][1] * matrix2[1][3] + matrix1[3][2] * matrix2[2][3] + matrix1[3][3] * matrix2[3][3];
 }
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   MIdentity, MTimesA, MTimesB, MInvers, MToAffine, MFromAffine
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+* DESCRIPTION
+*
+*   Variants of the matrix functions for affine matrices, as used by
+*   transformations, plus conversion to and from full 4x4 matrices.
+*
+*   The products and the inverse give the same values as their 4x4
+*   counterparts would for the full matrices, except that terms known to
+*   be zero are left out.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void MIdentity (AFFINE_MATRIX result)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 3; j++)
+            result[i][j] = ((i == j) ? 1.0 : 0.0);
+    }
+}
+
+void MTimesA (AFFINE_MATRIX result, const AFFINE_MATRIX matrix2)
+{
+    DBL t0, t1, t2;
+
+    for (int i = 0; i < 3; i++)
+    {
+        t0 = result[i][0];
+        t1 = result[i][1];
+        t2 = result[i][2];
+        result[i][0] = t0 * matrix2[0][0] + t1 * matrix2[1][0] + t2 * matrix2[2][0];
+        result[i][1] = t0 * matrix2[0][1] + t1 * matrix2[1][1] + t2 * matrix2[2][1];
+        result[i][2] = t0 * matrix2[0][2] + t1 * matrix2[1][2] + t2 * matrix2[2][2];
+    }
+
+    t0 = result[3][0];
+    t1 = result[3][1];
+    t2 = result[3][2];
+    result[3][0] = t0 * matrix2[0][0] + t1 * matrix2[1][0] + t2 * matrix2[2][0] + matrix2[3][0];
+    result[3][1] = t0 * matrix2[0][1] + t1 * matrix2[1][1] + t2 * matrix2[2][1] + matrix2[3][1];
+    result[3][2] = t0 * matrix2[0][2] + t1 * matrix2[1][2] + t2 * matrix2[2][2] + matrix2[3][2];
+}
+
+void MTimesB (const AFFINE_MATRIX matrix1, AFFINE_MATRIX result)
+{
+    DBL t0, t1, t2, t3;
+
+    for (int j = 0; j < 3; j++)
+    {
+        t0 = result[0][j];
+        t1 = result[1][j];
+        t2 = result[2][j];
+        t3 = result[3][j];
+        result[0][j] = matrix1[0][0] * t0 + matrix1[0][1] * t1 + matrix1[0][2] * t2;
+        result[1][j] = matrix1[1][0] * t0 + matrix1[1][1] * t1 + matrix1[1][2] * t2;
+        result[2][j] = matrix1[2][0] * t0 + matrix1[2][1] * t1 + matrix1[2][2] * t2;
+        result[3][j] = matrix1[3][0] * t0 + matrix1[3][1] * t1 + matrix1[3][2] * t2 + t3;
+    }
+}
+
+void MInvers (AFFINE_MATRIX r, const AFFINE_MATRIX m)
+{
+    MATRIX temp;
+
+    MFromAffine(temp, m);
+    MInvers(temp, temp);
+    MToAffine(r, temp);
+}
+
+void MToAffine (AFFINE_MATRIX result, const MATRIX matrix1)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 3; j++)
+            result[i][j] = matrix1[i][j];
+    }
+}
+
+void MFromAffine (MATRIX result, const AFFINE_MATRIX matrix1)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 3; j++)
+            result[i][j] = matrix1[i][j];
+        result[i][3] = ((i == 3) ? 1.0 : 0.0);
+    }
+}
+
 /*  AAC - These are not used, so they are commented out to save code space...
 
 void MAdd (MATRIX result, MATRIX matrix1, MATRIX matrix2)
@@ -573,17 +678,12 @@ void Compute_Scaling_Transform (TRANSFORM *result, const Vector3d& vector)
 
 void Compute_Matrix_Transform (TRANSFORM *result, const MATRIX matrix)
 {
-    int i;
+    MATRIX inverse;
 
-    for (i = 0; i < 4; i++)
-    {
-        (result->matrix)[i][0] = matrix[i][0];
-        (result->matrix)[i][1] = matrix[i][1];
-        (result->matrix)[i][2] = matrix[i][2];
-        (result->matrix)[i][3] = matrix[i][3];
-    }
+    MToAffine(result->matrix, matrix);
 
-    MInvers(result->inverse, result->matrix);
+    MInvers(inverse, matrix);
+    MToAffine(result->inverse, inverse);
 }
 
 
@@ -677,12 +777,12 @@ void Compute_Translation_Transform (TRANSFORM *transform, const Vector3d& vector
 void Compute_Rotation_Transform (TRANSFORM *transform, const Vector3d& vector)
 {
     DBL cosx, cosy, cosz, sinx, siny, sinz;
-    MATRIX Matrix;
+    MATRIX Matrix, Forward, Inverse;
     Vector3d Radian_Vector;
 
     Radian_Vector = vector * M_PI_180;
 
-    MIdentity (transform->matrix);
+    MIdentity (Forward);
 
     cosx = cos (Radian_Vector[X]);
     sinx = sin (Radian_Vector[X]);
@@ -691,12 +791,12 @@ void Compute_Rotation_Transform (TRANSFORM *transform, const Vector3d& vector)
     cosz = cos (Radian_Vector[Z]);
     sinz = sin (Radian_Vector[Z]);
 
-    (transform->matrix) [1][1] = cosx;
-    (transform->matrix) [2][2] = cosx;
-    (transform->matrix) [1][2] = sinx;
-    (transform->matrix) [2][1] = 0.0 - sinx;
+    Forward [1][1] = cosx;
+    Forward [2][2] = cosx;
+    Forward [1][2] = sinx;
+    Forward [2][1] = 0.0 - sinx;
 
-    MTranspose (transform->inverse, transform->matrix);
+    MTranspose (Inverse, Forward);
 
     MIdentity (Matrix);
 
@@ -705,11 +805,11 @@ void Compute_Rotation_Transform (TRANSFORM *transform, const Vector3d& vector)
     Matrix [0][2] = 0.0 - siny;
     Matrix [2][0] = siny;
 
-    MTimesA (transform->matrix, Matrix);
+    MTimesA (Forward, Matrix);
 
     MTranspose (Matrix);
 
-    MTimesB (Matrix, transform->inverse);
+    MTimesB (Matrix, Inverse);
 
     MIdentity (Matrix);
 
@@ -718,11 +818,14 @@ void Compute_Rotation_Transform (TRANSFORM *transform, const Vector3d& vector)
     Matrix [0][1] = sinz;
     Matrix [1][0] = 0.0 - sinz;
 
-    MTimesA (transform->matrix, Matrix);
+    MTimesA (Forward, Matrix);
 
     MTranspose (Matrix);
 
-    MTimesB (Matrix, transform->inverse);
+    MTimesB (Matrix, Inverse);
+
+    MToAffine (transform->matrix, Forward);
+    MToAffine (transform->inverse, Inverse);
 }
 
 
@@ -838,7 +941,13 @@ void Compute_Axis_Rotation_Transform (TRANSFORM *transform, const Vector3d& Axis
     transform->matrix[2][1] = V1[Y] * V1[Z] * (1.0 - cosx) - V1[X] * sinx;
     transform->matrix[2][2] = V1[Z] * V1[Z] + cosx * (1.0 - V1[Z] * V1[Z]);
 
-    MTranspose(transform->inverse, transform->matrix);
+    // The inverse of a rotation is its transpose.
+    MIdentity(transform->inverse);
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+            transform->inverse[i][j] = transform->matrix[j][i];
+    }
 }
 
 
@@ -58,13 +58,25 @@ namespace pov
 
 typedef DBL MATRIX[4][4]; ///< @todo       Make this obsolete.
 
+/// Affine transformation matrix.
+///
+/// This is a @ref MATRIX with the last column left out, which is implied to be `<0,0,0,1>`; the remaining
+/// elements keep their indices, i.e. the translation is still held in the last row.
+///
+typedef DBL AFFINE_MATRIX[4][3];
 
 typedef struct Transform_Struct TRANSFORM;
 
+/// Transformation along with its inverse.
+///
+/// As all transformations available in the scene description language are affine, both are stored as an
+/// @ref AFFINE_MATRIX, which saves a quarter of the memory per transformed object and lets the transformation
+/// of points and vectors run on contiguous rows of three values.
+///
 struct Transform_Struct
 {
-    MATRIX matrix;
-    MATRIX inverse;
+    AFFINE_MATRIX matrix;
+    AFFINE_MATRIX inverse;
 };
 
 
@@ -83,10 +95,47 @@ void MScale (MATRIX result, const MATRIX matrix1, DBL amount);
 void MTranspose (MATRIX result);
 void MTranspose (MATRIX result, const MATRIX matrix1);
 
+void MIdentity (AFFINE_MATRIX result);
+void MTimesA (AFFINE_MATRIX result, const AFFINE_MATRIX matrix2);
+void MTimesB (const AFFINE_MATRIX matrix1, AFFINE_MATRIX result);
+void MInvers (AFFINE_MATRIX r, const AFFINE_MATRIX m);
+void MToAffine (AFFINE_MATRIX result, const MATRIX matrix1);
+void MFromAffine (MATRIX result, const AFFINE_MATRIX matrix1);
+
 void MTransPoint        (Vector3d& result, const Vector3d& vector, const MATRIX *matrix);
 void MTransDirection    (Vector3d& result, const Vector3d& vector, const MATRIX *matrix);
 void MInvTransNormal    (Vector3d& result, const Vector3d& vector, const MATRIX *matrix);
 
+// The following are inlined, as they sit on the hot path of every ray-object test of transformed objects;
+// each is written as a sum of rows scaled by the vector's components, for the compiler to vectorize.
+
+inline void MTransPoint (Vector3d& result, const Vector3d& vector, const AFFINE_MATRIX *matrix)
+{
+    DBL x = vector[X], y = vector[Y], z = vector[Z];
+    const DBL *r0 = (*matrix)[0], *r1 = (*matrix)[1], *r2 = (*matrix)[2], *r3 = (*matrix)[3];
+    result = Vector3d(x * r0[0] + y * r1[0] + z * r2[0] + r3[0],
+                      x * r0[1] + y * r1[1] + z * r2[1] + r3[1],
+                      x * r0[2] + y * r1[2] + z * r2[2] + r3[2]);
+}
+
+inline void MTransDirection (Vector3d& result, const Vector3d& vector, const AFFINE_MATRIX *matrix)
+{
+    DBL x = vector[X], y = vector[Y], z = vector[Z];
+    const DBL *r0 = (*matrix)[0], *r1 = (*matrix)[1], *r2 = (*matrix)[2];
+    result = Vector3d(x * r0[0] + y * r1[0] + z * r2[0],
+                      x * r0[1] + y * r1[1] + z * r2[1],
+                      x * r0[2] + y * r1[2] + z * r2[2]);
+}
+
+inline void MInvTransNormal (Vector3d& result, const Vector3d& vector, const AFFINE_MATRIX *matrix)
+{
+    DBL x = vector[X], y = vector[Y], z = vector[Z];
+    const DBL *r0 = (*matrix)[0], *r1 = (*matrix)[1], *r2 = (*matrix)[2];
+    result = Vector3d(x * r0[0] + y * r0[1] + z * r0[2],
+                      x * r1[0] + y * r1[1] + z * r1[2],
+                      x * r2[0] + y * r2[1] + z * r2[2]);
+}
+
 inline void MTransPoint        (Vector3d& result, const Vector3d& vector, const TRANSFORM* trans) { MTransPoint     (result, vector, &trans->matrix);  }
 inline void MInvTransPoint     (Vector3d& result, const Vector3d& vector, const TRANSFORM* trans) { MTransPoint     (result, vector, &trans->inverse); }
 inline void MTransDirection    (Vector3d& result, const Vector3d& vector, const TRANSFORM* trans) { MTransDirection (result, vector, &trans->matrix);  }
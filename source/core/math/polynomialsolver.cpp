@@ -101,6 +101,12 @@ const DBL SMALL_ENOUGH = 1.0e-10;
 /* Smallest relative error we want. */
 const DBL RELERROR = 1.0e-12;
 
+/* Newton steps used to polish the roots of the algebraic solvers. */
+const int POLISH_ITERATIONS = 3;
+
+/* Residual, relative to its rounding error bound, above which a polished root is rejected. */
+const DBL POLISH_TOLERANCE = 1.0e-6;
+
 
 /*****************************************************************************
 * Local typedefs
@@ -121,6 +127,8 @@ static int solve_quadratic (const DBL *x, DBL *y);
 static int solve_cubic (const DBL *x, DBL *y);
 static int solve_quartic (const DBL *x, DBL *y);
 static int polysolve (int order, const DBL *Coeffs, DBL *roots);
+static bool polish_roots (int order, const DBL *c, DBL *roots, int n);
+static int solve_algebraic (int order, const DBL *c, DBL *roots);
 static int modp (const polynomial *u, const polynomial *v, polynomial *r);
 static int regula_falsa (int order, const DBL *coef, DBL a, DBL b, DBL *val);
 static int sbisect (int np, const polynomial *sseq, DBL min, DBL max, int atmin, int atmax, DBL *roots);
@@ -942,6 +950,10 @@ static int solve_cubic(const DBL *x, DBL *y)
 
         d = R / sqrt(Q3);
 
+        /* Rounding may push d just outside the domain of acos(). */
+
+        d = max(-1.0, min(1.0, d));
+
         theta = acos(d) / 3.0;
 
         sQ = -2.0 * sqrt(Q);
@@ -1355,13 +1367,17 @@ static int solve_quartic(const DBL *x, DBL *results)
 
     i = solve_cubic(cubic, roots);
 
-    if (i > 0)
-    {
-        z = roots[0];
-    }
-    else
+    /*
+     * Use the largest root of the resolvent, which always satisfies
+     * 2z >= p; anything else below is due to rounding, and is reported
+     * as a degenerate case for the caller to resolve.
+     */
+
+    z = roots[0];
+
+    while (--i > 0)
     {
-        return(0);
+        z = max(z, roots[i]);
     }
 
     d1 = 2.0 * z - p;
@@ -1374,7 +1390,7 @@ static int solve_quartic(const DBL *x, DBL *results)
         }
         else
         {
-            return(0);
+            return(-1);
         }
     }
 
@@ -1384,7 +1400,7 @@ static int solve_quartic(const DBL *x, DBL *results)
 
         if (d2 < 0.0)
         {
-            return(0);
+            return(-1);
         }
 
         d2 = sqrt(d2);
@@ -1444,6 +1460,157 @@ static int solve_quartic(const DBL *x, DBL *results)
 
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   polish_roots
+*
+* INPUT
+*
+*   order - order of polynomial
+*   c     - coefficients, highest order first
+*   roots - roots found by one of the algebraic solvers
+*   n     - number of roots
+*
+* OUTPUT
+*
+*   roots
+*
+* RETURNS
+*
+*   bool - false if any root could not be confirmed
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Refine the roots of the algebraic solvers with a few Newton steps on
+*   the original polynomial, keeping the best estimate of each, and check
+*   that the remaining residual is of the order of the rounding error of
+*   evaluating the polynomial. Roots failing the test indicate a badly
+*   conditioned polynomial that should be left to the Sturm solver.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+static bool polish_roots(int order, const DBL *c, DBL *roots, int n)
+{
+    int i, j, k;
+    DBL x, p, dp, m, best, bestx;
+
+    for (i = 0; i < n; i++)
+    {
+        x = bestx = roots[i];
+        best = HUGE_VAL;
+        m = 0.0;
+
+        for (j = 0; j <= POLISH_ITERATIONS; j++)
+        {
+            /* Evaluate the polynomial, its derivative and a bound on the rounding error. */
+
+            p = c[0];
+            dp = 0.0;
+            m = fabs(c[0]);
+
+            for (k = 1; k <= order; k++)
+            {
+                dp = dp * x + p;
+                p = p * x + c[k];
+                m = m * fabs(x) + fabs(c[k]);
+            }
+
+            if (fabs(p) < best)
+            {
+                best = fabs(p);
+                bestx = x;
+            }
+
+            if ((j == POLISH_ITERATIONS) || (fabs(p) <= RELERROR * m) || (dp == 0.0))
+            {
+                break;
+            }
+
+            x -= p / dp;
+        }
+
+        roots[i] = bestx;
+
+        if (!(best <= POLISH_TOLERANCE * m))
+        {
+            return(false);
+        }
+    }
+
+    return(true);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   solve_algebraic
+*
+* INPUT
+*
+*   order - order of polynomial (3 or 4)
+*   c     - coefficients
+*   roots - roots
+*
+* OUTPUT
+*
+*   roots
+*
+* RETURNS
+*
+*   int - number of roots found
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Solve a cubic or quartic with the algebraic solver, polishing the
+*   roots, and fall back to the Sturm solver only if the algebraic solver
+*   reports a degenerate case or a root does not survive polishing.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+static int solve_algebraic(int order, const DBL *c, DBL *roots)
+{
+    int n;
+
+    if (order == 3)
+    {
+        n = solve_cubic(c, roots);
+    }
+    else
+    {
+        n = solve_quartic(c, roots);
+    }
+
+    if ((n < 0) || !polish_roots(order, c, roots, n))
+    {
+        n = polysolve(order, c, roots);
+    }
+
+    return(n);
+}
+
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1648,7 +1815,7 @@ int Solve_Polynomial(int n, const DBL *c0, DBL *r, int sturm, DBL epsilon, Rende
             }
             else
             {
-                roots = solve_cubic(c, r);
+                roots = solve_algebraic(3, c, r);
             }
 
             break;
@@ -1669,7 +1836,7 @@ int Solve_Polynomial(int n, const DBL *c0, DBL *r, int sturm, DBL epsilon, Rende
                     }
                     else
                     {
-                        roots = solve_cubic(c, r);
+                        roots = solve_algebraic(3, c, r);
                     }
 
                     break;
@@ -1691,7 +1858,7 @@ int Solve_Polynomial(int n, const DBL *c0, DBL *r, int sturm, DBL epsilon, Rende
             }
             else
             {
-                roots = solve_quartic(c, r);
+                roots = solve_algebraic(4, c, r);
             }
 
             break;
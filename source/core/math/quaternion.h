@@ -73,6 +73,7 @@ class JuliaFractalRules : public QuaternionFractalRules
         virtual void CalcNormal (Vector3d&, int, const Fractal *, DBL **) const;
         virtual bool Iterate (const Vector3d&, const Fractal *, DBL **) const;
         virtual bool Iterate (const Vector3d&, const Fractal *, const Vector3d&, DBL *, DBL **) const;
+        virtual void Iterate (const Vector3d *, int, const Fractal *, bool *, DBL **) const;
 };
 
 class Z3FractalRules : public QuaternionFractalRules
@@ -82,6 +83,7 @@ class Z3FractalRules : public QuaternionFractalRules
         virtual void CalcNormal (Vector3d&, int, const Fractal *, DBL **) const;
         virtual bool Iterate (const Vector3d&, const Fractal *, DBL **) const;
         virtual bool Iterate (const Vector3d&, const Fractal *, const Vector3d&, DBL *, DBL **) const;
+        virtual void Iterate (const Vector3d *, int, const Fractal *, bool *, DBL **) const;
 };
 
 /// @}
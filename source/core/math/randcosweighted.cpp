@@ -54,7 +54,7 @@
 namespace pov
 {
 
-BYTE_XYZ kaRandCosWeighted[kRandCosWeightedCount] = {
+const BYTE_XYZ kaRandCosWeighted[kRandCosWeightedCount] = {
     { 250, 71, 127 },
     { 116, 251, 109 },
     { 146, 191, 45 },
@@ -72,7 +72,7 @@ struct BYTE_XYZ
 };
 
 const int kRandCosWeightedCount = 1600;
-extern BYTE_XYZ kaRandCosWeighted[kRandCosWeightedCount];
+extern const BYTE_XYZ kaRandCosWeighted[kRandCosWeightedCount];
 
 inline void VUnpack(Vector3d& dest_vec, const BYTE_XYZ * pack_vec)
 {
@@ -37,6 +37,7 @@
 #include "core/math/randomsequence.h"
 
 #include <cassert>
+#include <cstring>
 
 #include <limits>
 #include <map>
@@ -231,8 +232,15 @@ Vector2d Uniform2dOnSquare(SequentialDoubleGeneratorPtr source)
 
 Vector2d Uniform2dOnDisc(SequentialDoubleGeneratorPtr source)
 {
-    double r = sqrt((*source)());
-    double theta = (*source)() * 2*M_PI;
+    double u = (*source)();
+    double v = (*source)();
+    return Uniform2dOnDisc(Vector2d(u, v));
+}
+
+Vector2d Uniform2dOnDisc(const Vector2d& uv)
+{
+    double r = sqrt(uv.x());
+    double theta = uv.y() * 2*M_PI;
     double x = r * cos(theta);
     double y = r * sin(theta);
     return Vector2d(x, y);
@@ -255,6 +263,13 @@ Vector3d CosWeighted3dOnHemisphere(SequentialDoubleGeneratorPtr source)
     return Vector3d(v.x(), y, v.y());
 }
 
+Vector3d CosWeighted3dOnHemisphere(const Vector2d& uv)
+{
+    Vector2d v = Uniform2dOnDisc(uv);
+    double y = sqrt (max(0.0, 1 - v.lengthSqr()));
+    return Vector3d(v.x(), y, v.y());
+}
+
 
 /**********************************************************************************
  *  Local Types : Abstract Generators
@@ -967,6 +982,117 @@ Vector3d HaltonUniformDirectionGenerator::operator[](size_t i) const
 }
 
 
+/**********************************************************************************
+ *  ScrambledSobolSampleSet implementation
+ *********************************************************************************/
+
+/// Mixes the bits of a 32-bit value (Chris Wellons' "lowbias32" integer hash).
+static inline POV_UINT32 HashSamplerSeed(POV_UINT32 x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+static inline POV_UINT32 CombineSamplerSeed(POV_UINT32 seed, POV_UINT32 v)
+{
+    return seed ^ (v + 0x9e3779b9U + (seed << 6) + (seed >> 2));
+}
+
+static inline POV_UINT32 ReverseBits(POV_UINT32 x)
+{
+    x = ((x >> 1) & 0x55555555U) | ((x & 0x55555555U) << 1);
+    x = ((x >> 2) & 0x33333333U) | ((x & 0x33333333U) << 2);
+    x = ((x >> 4) & 0x0F0F0F0FU) | ((x & 0x0F0F0F0FU) << 4);
+    x = ((x >> 8) & 0x00FF00FFU) | ((x & 0x00FF00FFU) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+/// Owen-scrambles a bit-reversed value, so that each bit is flipped depending on all less significant bits only
+/// (Laine and Karras' hash-based permutation, with constants as suggested by Burley).
+static inline POV_UINT32 LaineKarrasPermutation(POV_UINT32 x, POV_UINT32 seed)
+{
+    x += seed;
+    x ^= x * 0x6c50b47cU;
+    x ^= x * 0xb82f1e52U;
+    x ^= x * 0xc7afe638U;
+    x ^= x * 0x8d22f6e6U;
+    return x;
+}
+
+static inline POV_UINT32 NestedUniformScramble(POV_UINT32 x, POV_UINT32 seed)
+{
+    return ReverseBits(LaineKarrasPermutation(ReverseBits(x), seed));
+}
+
+/// Second dimension of the Sobol sequence; the first is simply the bit-reversed index.
+static inline POV_UINT32 Sobol2(POV_UINT32 index)
+{
+    POV_UINT32 result = 0;
+    for (POV_UINT32 v = 0x80000000U; index != 0; index >>= 1, v ^= v >> 1)
+        if (index & 1)
+            result ^= v;
+    return result;
+}
+
+static inline double SamplerBitsToDouble(POV_UINT32 x)
+{
+    return x * (1.0 / 4294967296.0);
+}
+
+ScrambledSobolSampleSet::ScrambledSobolSampleSet(POV_UINT32 seed) :
+    seed(seed)
+{}
+
+double ScrambledSobolSampleSet::Get1d(unsigned int index) const
+{
+    POV_UINT32 i = NestedUniformScramble(index, seed);
+    return SamplerBitsToDouble(NestedUniformScramble(ReverseBits(i), CombineSamplerSeed(seed, 0)));
+}
+
+Vector2d ScrambledSobolSampleSet::Get2d(unsigned int index) const
+{
+    POV_UINT32 i = NestedUniformScramble(index, seed);
+    return Vector2d(SamplerBitsToDouble(NestedUniformScramble(ReverseBits(i), CombineSamplerSeed(seed, 0))),
+                    SamplerBitsToDouble(NestedUniformScramble(Sobol2(i),      CombineSamplerSeed(seed, 1))));
+}
+
+
+/**********************************************************************************
+ *  LowDiscrepancySampler implementation
+ *********************************************************************************/
+
+LowDiscrepancySampler::LowDiscrepancySampler() :
+    positionSeed(0),
+    setCount(0)
+{}
+
+void LowDiscrepancySampler::SetPosition(DBL x, DBL y)
+{
+    // Derive the seed from the exact position, so that supersamples within a pixel get different seeds as well.
+    float fx = float(x);
+    float fy = float(y);
+    POV_UINT32 bx, by;
+    std::memcpy(&bx, &fx, sizeof(bx));
+    std::memcpy(&by, &fy, sizeof(by));
+    positionSeed = HashSamplerSeed(CombineSamplerSeed(HashSamplerSeed(bx), by));
+    setCount = 0;
+}
+
+ScrambledSobolSampleSet LowDiscrepancySampler::NewSet(SamplerStream stream)
+{
+    return ScrambledSobolSampleSet(HashSamplerSeed(CombineSamplerSeed(CombineSamplerSeed(positionSeed, stream), setCount ++)));
+}
+
+ScrambledSobolSampleSet LowDiscrepancySampler::PixelSet(unsigned int x, unsigned int y, SamplerStream stream)
+{
+    return ScrambledSobolSampleSet(HashSamplerSeed(CombineSamplerSeed(CombineSamplerSeed(HashSamplerSeed(x), y), stream)));
+}
+
+
 /**********************************************************************************
  *  Factory Functions
  *********************************************************************************/
@@ -240,6 +240,23 @@ Vector3d Uniform3dOnSphere(SequentialDoubleGeneratorPtr source);
 */
 Vector3d CosWeighted3dOnHemisphere(SequentialDoubleGeneratorPtr source);
 
+/**
+*  Maps a point on the unit square to the unit disc, preserving uniform distribution.
+*
+*  @param[in]  uv              A point on the unit square.
+*  @return                     The corresponding point on the unit disc.
+*/
+Vector2d Uniform2dOnDisc(const Vector2d& uv);
+
+/**
+*  Maps a point on the unit square to the unit hemisphere, turning uniform into cos-weighted distribution.
+*  @note       The hemisphere is oriented towards positive Y.
+*
+*  @param[in]  uv              A point on the unit square.
+*  @return                     The corresponding point on the unit hemisphere.
+*/
+Vector3d CosWeighted3dOnHemisphere(const Vector2d& uv);
+
 /// @}
 ///
 //******************************************************************************
@@ -354,6 +371,139 @@ SequentialVector2dGeneratorPtr GetSubRandomOnDiscGenerator(unsigned int id, doub
 ///
 SequentialVector2dGeneratorPtr GetSubRandom2dGenerator(unsigned int id, double minX, double maxX, double minY, double maxY, size_t count = 0);
 
+/// @}
+///
+//******************************************************************************
+///
+/// @name Fast Pseudo-Random Number Generator
+///
+/// @{
+
+/// Small pseudo-random number generator for the per-thread hot paths of the renderer.
+///
+/// This is the `pcg32` generator by Melissa O'Neill (PCG-XSH-RR with 64 bits of state). As opposed to the
+/// generators provided by the factories, it is neither accessed through a pointer nor via virtual calls,
+/// so that each number drawn compiles down to a handful of integer instructions.
+///
+class PCGDoubleGenerator final
+{
+    public:
+        typedef double result_type;
+
+        PCGDoubleGenerator(size_t seed = 0) { Seed(seed); }
+
+        /// Seeds the generator; equal seeds give equal sequences.
+        inline void Seed(size_t seed)
+        {
+            state = 0;
+            NextInt();
+            state += POV_UINT64(seed) + kSeedOffset;
+            NextInt();
+        }
+
+        /// Returns the next 32-bit integer from the sequence.
+        inline POV_UINT32 NextInt()
+        {
+            POV_UINT64 old = state;
+            state = old * kMultiplier + kIncrement;
+            POV_UINT32 xorshifted = POV_UINT32(((old >> 18) ^ old) >> 27);
+            POV_UINT32 rot = POV_UINT32(old >> 59);
+            return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+        }
+
+        /// Returns the next number from the sequence, in the range [0..1).
+        inline double operator()()
+        {
+            return NextInt() * (1.0 / 4294967296.0);
+        }
+
+    private:
+        static const POV_UINT64 kMultiplier = 6364136223846793005ull;
+        static const POV_UINT64 kIncrement  = 1442695040888963407ull;
+        static const POV_UINT64 kSeedOffset = 0x853c49e6748fea9bull;
+        POV_UINT64 state;
+};
+
+/// Gets a random point on the unit square with uniform distribution.
+inline Vector2d Uniform2dOnSquare(PCGDoubleGenerator& source)
+{
+    double x = source();
+    double y = source();
+    return Vector2d(x, y);
+}
+
+/// @}
+///
+//******************************************************************************
+///
+/// @name Low-Discrepancy Sampler
+///
+/// The following classes provide sample points for the stochastic effects of the renderer, such as anti-aliasing
+/// jitter, focal blur, area lights, radiosity and media, that are evenly distributed within each set of samples
+/// taken for one effect, yet uncorrelated between sets, effects and pixels.
+///
+/// @{
+
+/// Scene-wide choice of sampler, as set by the `sampling_method` global setting.
+enum SamplingMethod
+{
+    kSamplingMethod_Classic = 1,    ///< Each effect uses its own legacy pseudo-random or sub-random numbers.
+    kSamplingMethod_Sobol   = 2,    ///< All effects use @ref LowDiscrepancySampler.
+};
+
+/// Effects drawing sample sets from @ref LowDiscrepancySampler.
+/// The values are merely mixed into the scrambling seeds, so that different effects never share a set.
+enum SamplerStream
+{
+    kSamplerStream_Pixel = 1,       ///< Sub-pixel position of anti-aliasing and focal blur samples.
+    kSamplerStream_Lens,            ///< Aperture position of focal blur samples.
+    kSamplerStream_AreaLight,       ///< Jitter of area light grid points.
+    kSamplerStream_Radiosity,       ///< Radiosity sample ray directions.
+    kSamplerStream_Media,           ///< Media sample positions.
+};
+
+/// Set of sample points from an Owen-scrambled Sobol sequence.
+///
+/// The set is built from the first two dimensions of the Sobol sequence, with both the order of the points and
+/// their co-ordinates scrambled according to a seed, using the hash-based nested uniform scrambling described by
+/// Brent Burley in "Practical Hash-based Owen Scrambling" (JCGT 2020). Every prefix of the set, and in particular
+/// every prefix with a power-of-two number of points, is well stratified; sets with different seeds behave as if
+/// independent of one another.
+///
+class ScrambledSobolSampleSet final
+{
+    public:
+        ScrambledSobolSampleSet(POV_UINT32 seed = 0);
+        /// Returns a particular number from the set, in the range [0..1).
+        double Get1d(unsigned int index) const;
+        /// Returns a particular point from the set, on the unit square [0..1)x[0..1).
+        Vector2d Get2d(unsigned int index) const;
+    private:
+        POV_UINT32 seed;
+};
+
+/// Per-thread source of low-discrepancy sample sets.
+///
+/// Each set drawn is scrambled with a seed derived from the current image position, the effect and the number of
+/// sets drawn since the position was last set, so that the renders are reproducible regardless of which thread
+/// renders which block, while repeated evaluations of an effect within a pixel, such as one area light seen by
+/// several anti-aliasing samples, still get independent sets.
+///
+class LowDiscrepancySampler final
+{
+    public:
+        LowDiscrepancySampler();
+        /// Selects the image position of the camera ray(s) to be traced next.
+        void SetPosition(DBL x, DBL y);
+        /// Starts a new set of samples for one evaluation of an effect.
+        ScrambledSobolSampleSet NewSet(SamplerStream stream);
+        /// Gets the set of samples for an effect evaluated once per pixel, such as the sub-pixel position.
+        static ScrambledSobolSampleSet PixelSet(unsigned int x, unsigned int y, SamplerStream stream);
+    private:
+        POV_UINT32 positionSeed;
+        POV_UINT32 setCount;
+};
+
 /// @}
 ///
 //******************************************************************************
@@ -83,11 +83,7 @@ namespace pov
 * Local functions
 ******************************************************************************/
 
-DBL linear_interpolate(const SplineEntryList& se, SplineEntryList::size_type i, int k, DBL p);
-DBL quadratic_interpolate(const SplineEntryList& se, SplineEntryList::size_type i, int k, DBL p);
-DBL natural_interpolate(const SplineEntryList& se, SplineEntryList::size_type i, int k, DBL p);
-DBL catmull_rom_interpolate(const SplineEntryList& se, SplineEntryList::size_type i, int k, DBL p);
-SplineEntryList::size_type findt(const GenericSpline * sp, DBL Time);
+SplineEntryList::size_type findt(const GenericSpline * sp, DBL Time, SplineEntryList::size_type hint = 0);
 void mkfree(GenericSpline * sp, SplineEntryList::size_type i);
 void Precompute_Cubic_Coeffs(GenericSpline *sp);
 
@@ -154,7 +150,6 @@ void Precompute_Cubic_Coeffs(GenericSpline *sp)
         }
         sp->SplineEntries[0].coeff[k] = 0;
     }
-    sp->Coeffs_Computed = true;
 
     delete[] h;
     delete[] b;
@@ -167,20 +162,17 @@ void Precompute_Cubic_Coeffs(GenericSpline *sp)
 *
 * FUNCTION
 *
-*       linear_interpolate
+*       LinearSpline::ComputeSegment
 *
 * INPUT
 *
-*       se : a pointer to the entries in the spline
-*       i  : the first point to interpolate between
-*       k  : which dimension of the 5D vector to interpolate in
-*       p  : the parameter to interpolate the value for
+*       i   : the first point of the segment
 *
 * OUTPUT
 *
-* RETURNS
+*       seg : the polynomial of the segment
 *
-*       The value of the kth dimension of the vector linearly interpolated at p
+* RETURNS
 *
 * AUTHOR
 *
@@ -188,18 +180,25 @@ void Precompute_Cubic_Coeffs(GenericSpline *sp)
 *
 * DESCRIPTION
 *
+*       Computes the straight line between points i and i+1.
+*
 * CHANGES
 *
+*       Turned into a precomputed polynomial.
+*
 ******************************************************************************/
 
-DBL linear_interpolate(const SplineEntryList& se, SplineEntryList::size_type i, int k, DBL p)
+void LinearSpline::ComputeSegment(SplineEntryList::size_type i, SplineSegment& seg) const
 {
-    DBL p1, p2, v1, v2;
-    p1 = se[i].par;
-    p2 = se[i+1].par;
-    v1 = se[i].vec[k];
-    v2 = se[i+1].vec[k];
-    return (p-p1)*(v2-v1)/(p2-p1)+v1;
+    const SplineEntryList& se = SplineEntries;
+    DBL h = se[i+1].par - se[i].par;
+    for(int k=0; k<5; k++)
+    {
+        seg.coeff[k][0] = se[i].vec[k];
+        seg.coeff[k][1] = (se[i+1].vec[k] - se[i].vec[k])/h;
+        seg.coeff[k][2] = 0.0;
+        seg.coeff[k][3] = 0.0;
+    }
 }
 
 
@@ -207,21 +206,17 @@ DBL linear_interpolate(const SplineEntryList& se, SplineEntryList::size_type i,
 *
 * FUNCTION
 *
-*       quadratic_interpolate
+*       QuadraticSpline::ComputeSegment
 *
 * INPUT
 *
-*       se : a pointer to the entries in the spline
-*       i  : the second point of three to interpolate between
-*       k  : which dimension of the 5D vector to interpolate in
-*       p  : the parameter to interpolate the value for
+*       i   : the first point of the segment
 *
 * OUTPUT
 *
-* RETURNS
+*       seg : the polynomial of the segment
 *
-*       The value of the kth dimension of the quadratic interpolation of the
-*        vector at p
+* RETURNS
 *
 * AUTHOR
 *
@@ -229,34 +224,50 @@ DBL linear_interpolate(const SplineEntryList& se, SplineEntryList::size_type i,
 *
 * DESCRIPTION
 *
+*       Fits a parabola through points i-1, i and i+1, or through the first
+*       three points in case of the first segment. Splines with only two
+*       points are interpolated linearly.
+*
 * CHANGES
 *
+*       Turned into a precomputed polynomial; the parabola is now set up in
+*       Newton form relative to point i, which is less prone to cancellation
+*       than the former polynomial in the absolute parameter.
+*
 ******************************************************************************/
 
-DBL quadratic_interpolate(const SplineEntryList& se, SplineEntryList::size_type i, int k, DBL p)
+void QuadraticSpline::ComputeSegment(SplineEntryList::size_type i, SplineSegment& seg) const
 {
-    /* fit quadratic function to three point*/
-    DBL n;
-    DBL p1, p2, p3,
-        v1, v2, v3,
-        a, b, c;
-    /* assignments to make life easier */
-    p1=se[i-1].par;    p2=se[i].par;    p3=se[i+1].par;
-    v1=se[i-1].vec[k]; v2=se[i].vec[k]; v3=se[i+1].vec[k];
-
-    n=(p2-p1)*(p3-p1)*(p3-p2);
-
-    /* MWW NOTE: I'm assuming these are correct.  I didn't write them */
-    a=(-p2*v1+p3*v1
-       +p1*v2-p3*v2
-       -p1*v3+p2*v3) /n;
-    b=( p2*p2*v1 - p3*p3*v1
-       -p1*p1*v2 + p3*p3*v2
-       +p1*p1*v3 - p2*p2*v3) /n;
-    c=(-p2*p2*p3*v1+p2*p3*p3*v1
-       +p1*p1*p3*v2-p1*p3*p3*v2
-       -p1*p1*p2*v3+p1*p2*p2*v3) /n;
-    return (a*p+b)*p+c; /* Fast way of doing ap^2+bp+c */
+    const SplineEntryList& se = SplineEntries;
+    if (se.size() == 2)
+    {
+        DBL h = se[1].par - se[0].par;
+        for(int k=0; k<5; k++)
+        {
+            seg.coeff[k][0] = se[0].vec[k];
+            seg.coeff[k][1] = (se[1].vec[k] - se[0].vec[k])/h;
+            seg.coeff[k][2] = 0.0;
+            seg.coeff[k][3] = 0.0;
+        }
+        return;
+    }
+
+    /* fit quadratic function to three points, the first of which is s */
+    SplineEntryList::size_type s = (i > 0 ? i-1 : 0);
+    DBL h1 = se[s+1].par - se[s].par;
+    DBL h2 = se[s+2].par - se[s+1].par;
+    /* offset of the parabola's second point relative to point i */
+    DBL d = (i > 0 ? h1 : -h1);
+    for(int k=0; k<5; k++)
+    {
+        DBL d1 = (se[s+1].vec[k] - se[s].vec[k])/h1;
+        DBL d2 = (se[s+2].vec[k] - se[s+1].vec[k])/h2;
+        DBL a  = (d2 - d1)/(h1 + h2);
+        seg.coeff[k][0] = se[i].vec[k];
+        seg.coeff[k][1] = d1 + a*d;
+        seg.coeff[k][2] = a;
+        seg.coeff[k][3] = 0.0;
+    }
 }
 
 
@@ -264,21 +275,17 @@ DBL quadratic_interpolate(const SplineEntryList& se, SplineEntryList::size_type
 *
 * FUNCTION
 *
-*       natural_interpolate
+*       NaturalSpline::ComputeSegment
 *
 * INPUT
 *
-*       se : a pointer to the entries in the spline
-*       i  : the first point in the interpolation interval
-*       k  : which dimension of the 5D vector to interpolate in
-*       p  : the parameter to interpolate the value for
+*       i   : the first point of the segment
 *
 * OUTPUT
 *
-* RETURNS
+*       seg : the polynomial of the segment
 *
-*       The value of the kth dimension of the natural cubic interpolation
-*        of the vector at p
+* RETURNS
 *
 * AUTHOR
 *
@@ -286,17 +293,26 @@ DBL quadratic_interpolate(const SplineEntryList& se, SplineEntryList::size_type
 *
 * DESCRIPTION
 *
+*       Computes the natural cubic between points i and i+1 from the second
+*       derivatives computed by Precompute_Cubic_Coeffs.
+*
 * CHANGES
 *
+*       Turned into a precomputed polynomial.
+*
 ******************************************************************************/
 
-DBL natural_interpolate(const SplineEntryList& se, SplineEntryList::size_type i, int k, DBL p)
+void NaturalSpline::ComputeSegment(SplineEntryList::size_type i, SplineSegment& seg) const
 {
-    DBL h, tmp;
-    h = se[i+1].par - se[i].par;
-    tmp = se[i].coeff[k]/2.0 + ((p - se[i].par)*(se[i+1].coeff[k] - se[i].coeff[k]))/(6.0*h);
-    tmp = -(h/6.0)*(se[i+1].coeff[k] + 2.0*se[i].coeff[k]) + (se[i+1].vec[k] - se[i].vec[k])/h + (p - se[i].par)*tmp;
-    return se[i].vec[k] + (p - se[i].par)*tmp;
+    const SplineEntryList& se = SplineEntries;
+    DBL h = se[i+1].par - se[i].par;
+    for(int k=0; k<5; k++)
+    {
+        seg.coeff[k][0] = se[i].vec[k];
+        seg.coeff[k][1] = -(h/6.0)*(se[i+1].coeff[k] + 2.0*se[i].coeff[k]) + (se[i+1].vec[k] - se[i].vec[k])/h;
+        seg.coeff[k][2] = se[i].coeff[k]/2.0;
+        seg.coeff[k][3] = (se[i+1].coeff[k] - se[i].coeff[k])/(6.0*h);
+    }
 }
 
 
@@ -304,21 +320,17 @@ DBL natural_interpolate(const SplineEntryList& se, SplineEntryList::size_type i,
 *
 * FUNCTION
 *
-*       catmull_rom_interpolate
+*       CatmullRomSpline::ComputeSegment
 *
 * INPUT
 *
-*       se : a pointer to the entries in the spline
-*       i  : the first point in the interpolation interval
-*       k  : which dimension of the 5D vector to interpolate in
-*       p  : the parameter to interpolate the value for
+*       i   : the first point of the segment
 *
 * OUTPUT
 *
-* RETURNS
+*       seg : the polynomial of the segment
 *
-*       The value of the kth dimension of the Catmull-Rom interpolation of the
-*        vector at p
+* RETURNS
 *
 * AUTHOR
 *
@@ -326,21 +338,91 @@ DBL natural_interpolate(const SplineEntryList& se, SplineEntryList::size_type i,
 *
 * DESCRIPTION
 *
+*       Computes the cubic Hermite curve between points i and i+1, with the
+*       tangents at either end taken as the average slope of the adjacent
+*       segments.
+*
+*       Catmull-Rom splines can't interpolate before the second point or
+*       after the next-to-last one; the first and last segments are set to
+*       the constant value the spline takes there instead.
+*
+* CHANGES
+*
+*       Turned into a precomputed polynomial.
+*
+******************************************************************************/
+
+void CatmullRomSpline::ComputeSegment(SplineEntryList::size_type i, SplineSegment& seg) const
+{
+    const SplineEntryList& se = SplineEntries;
+    if ((i == 0) || (i+2 >= se.size()))
+    {
+        const EXPRESS& c = se[(i == 0) ? 1 : se.size()-2].vec;
+        for(int k=0; k<5; k++)
+        {
+            seg.coeff[k][0] = ((se.size() == 2) ? (se[0].vec[k] + se[1].vec[k])/2.0 : c[k]);
+            seg.coeff[k][1] = 0.0;
+            seg.coeff[k][2] = 0.0;
+            seg.coeff[k][3] = 0.0;
+        }
+        return;
+    }
+
+    DBL dt = se[i+1].par - se[i].par; /* Time between se[i] and se[i+1] */
+    for(int k=0; k<5; k++)
+    {
+        DBL s  = (se[i+1].vec[k] - se[i].vec[k])/dt;
+        DBL m0 = ((se[i].vec[k] - se[i-1].vec[k])/(se[i].par - se[i-1].par) + s)/2.0;
+        DBL m1 = ((se[i+2].vec[k] - se[i+1].vec[k])/(se[i+2].par - se[i+1].par) + s)/2.0;
+        seg.coeff[k][0] = se[i].vec[k];
+        seg.coeff[k][1] = m0;
+        seg.coeff[k][2] = (3.0*s - 2.0*m0 - m1)/dt;
+        seg.coeff[k][3] = (m0 + m1 - 2.0*s)/(dt*dt);
+    }
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*       GenericSpline::EvaluateSegment
+*
+* INPUT
+*
+*       i  : the first point of the segment
+*       p  : the parameter to interpolate the value for
+*
+* OUTPUT
+*
+*       v  : the interpolated values
+*
+* RETURNS
+*
+* AUTHOR
+*
+* DESCRIPTION
+*
+*       Evaluates the polynomial of a segment, from the precomputed table if
+*       available, or by computing the polynomial on the spot otherwise (as is
+*       the case for splines temporarily converted to a different type).
+*
 * CHANGES
 *
 ******************************************************************************/
 
-DBL catmull_rom_interpolate(const SplineEntryList& se, SplineEntryList::size_type i, int k, DBL p)
+void GenericSpline::EvaluateSegment(SplineEntryList::size_type i, DBL p, EXPRESS& v) const
 {
-    DBL dt = (se[i+1].par - se[i].par); /* Time between se[i] and se[i+1] */
-    DBL u = (p - se[i].par)/dt;         /* Fractional time from se[i] to p */
-    DBL dp0 = ((se[i].vec[k] - se[i-1].vec[k])/(se[i].par - se[i-1].par) + (se[i+1].vec[k] - se[i].vec[k])/(se[i+1].par - se[i].par))/2.0 * dt;
-    DBL dp1 = ((se[i+2].vec[k] - se[i+1].vec[k])/(se[i+2].par - se[i+1].par) + (se[i+1].vec[k] - se[i].vec[k])/(se[i+1].par - se[i].par))/2.0 * dt;
-
-    return (se[i].vec[k] * (2*u*u*u - 3*u*u + 1) +
-            se[i+1].vec[k] * (3*u*u - 2*u*u*u) +
-            dp0 * (u*u*u - 2*u*u + u) +
-            dp1 * (u*u*u - u*u) );
+    SplineSegment temp;
+    const SplineSegment* seg = &temp;
+    if (Coeffs_Computed)
+        seg = &Segments[i];
+    else
+        ComputeSegment(i, temp);
+
+    DBL t = p - SplineEntries[i].par;
+    for(int k=0; k<5; k++)
+        v[k] = seg->coeff[k][0] + t*(seg->coeff[k][1] + t*(seg->coeff[k][2] + t*seg->coeff[k][3]));
 }
 
 
@@ -354,6 +436,7 @@ DBL catmull_rom_interpolate(const SplineEntryList& se, SplineEntryList::size_typ
 *
 *       sp   : a pointer to a spline
 *       Time : The parameter to search for
+*       hint : A previous result to try first, or 0 for none
 *
 * OUTPUT
 *
@@ -370,10 +453,11 @@ DBL catmull_rom_interpolate(const SplineEntryList& se, SplineEntryList::size_typ
 * CHANGES
 *
 *       Mark Wagner  6 Nov 2000 : Changed from linear search to binary search
+*       Added the hint, to speed up evaluation at parameters close together.
 *
 ******************************************************************************/
 
-SplineEntryList::size_type findt(const GenericSpline * sp, DBL Time)
+SplineEntryList::size_type findt(const GenericSpline * sp, DBL Time, SplineEntryList::size_type hint)
 {
     SplineEntryList::size_type i, i2;
     const SplineEntryList& se = sp->SplineEntries;
@@ -384,6 +468,13 @@ SplineEntryList::size_type findt(const GenericSpline * sp, DBL Time)
 
     if(Time >= se.back().par) return numEntries;
 
+    /* Try the hinted segment and its successor before resorting to a full search */
+    if((hint > 0) && (hint < numEntries) && (Time > se[hint-1].par))
+    {
+        if(Time <= se[hint].par) return hint;
+        if((hint+1 < numEntries) && (Time <= se[hint+1].par)) return hint+1;
+    }
+
     i = numEntries / 2;
     /* Bracket the proper entry */
     if( Time > se[i].par ) /* i is lower, i2 is upper */
@@ -555,7 +646,11 @@ CatmullRomSpline::CatmullRomSpline(const GenericSpline& o) : GenericSpline(o)
 
 GenericSpline * Copy_Spline(const GenericSpline * Old)
 {
-    return Old->Clone();
+    GenericSpline * New = Old->Clone();
+    // A clone interpolates the same way as the original, so the segment table remains valid.
+    New->Segments = Old->Segments;
+    New->Coeffs_Computed = Old->Coeffs_Computed;
+    return New;
 }
 
 
@@ -740,109 +835,103 @@ void Insert_Spline_Entry(GenericSpline * sp, DBL p, const EXPRESS& v)
 *       Mark Wagner  24 Feb 2002 : Added support for Catmull-Rom interpolation
 *               Re-arranged the code to make future additions cleaner by moving
 *                more of the code into the "switch" statement
+*       Interpolation now evaluates precomputed per-segment polynomials.
 *
 ******************************************************************************/
 
-void LinearSpline::Get(DBL p, EXPRESS& v)
+void GenericSpline::Get(DBL p, EXPRESS& v)
 {
     if (SplineEntries.size() == 1)
         memcpy(&v, &SplineEntries.front().vec, sizeof(EXPRESS));
     else
-    {
         /* Find which spline segment we're in.  i is the control point at the end of the segment */
-        SplineEntryList::size_type i = findt(this, p);
-        for(int k=0; k<5; k++)
-        {
-            /* If outside spline range, return first or last point */
-            if(i == 0)
-                v[k] = SplineEntries.front().vec[k];
-            else if(i >= SplineEntries.size())
-                v[k] = SplineEntries.back().vec[k];
-            /* Else, normal case */
-            else
-                v[k] = linear_interpolate(SplineEntries, i-1, k, p);
-        }
-    }
+        Evaluate(findt(this, p), p, v);
 }
 
-void QuadraticSpline::Get(DBL p, EXPRESS& v)
+void GenericSpline::GetBatch(const DBL* p, unsigned int count, EXPRESS* v)
 {
     if (SplineEntries.size() == 1)
-        memcpy(&v, &SplineEntries.front().vec, sizeof(EXPRESS));
+    {
+        for (unsigned int n = 0; n < count; n++)
+            memcpy(&v[n], &SplineEntries.front().vec, sizeof(EXPRESS));
+    }
     else
     {
-        /* Find which spline segment we're in.  i is the control point at the end of the segment */
-        SplineEntryList::size_type i = findt(this, p);
-        for(int k=0; k<5; k++)
+        SplineEntryList::size_type i = 0;
+        for (unsigned int n = 0; n < count; n++)
         {
-            /* If outside the spline range, return the first or last point */
-            if(i == 0)
-                v[k] = SplineEntries.front().vec[k];
-            else if(i >= SplineEntries.size())
-                v[k] = SplineEntries.back().vec[k];
-            /* If not enough points, reduce order */
-            else if(SplineEntries.size() == 2)
-                v[k] = linear_interpolate(SplineEntries, i-1, k, p);
-            else
-            {
-                /* Normal case: between the second and last points */
-                if(i > 1)
-                    v[k] = quadratic_interpolate(SplineEntries, i-1, k, p);
-                else /* Special case: between first and second points */
-                    v[k] = quadratic_interpolate(SplineEntries, i, k, p);
-            }
+            i = findt(this, p[n], i);
+            Evaluate(i, p[n], v[n]);
         }
     }
 }
 
-void NaturalSpline::Get(DBL p, EXPRESS& v)
+void GenericSpline::Precompute()
 {
-    if (SplineEntries.size() == 1)
+    Coeffs_Computed = false;
+    Segments.resize(SplineEntries.empty() ? 0 : SplineEntries.size() - 1);
+    for (SplineEntryList::size_type i = 0; i < Segments.size(); i++)
+        ComputeSegment(i, Segments[i]);
+    Coeffs_Computed = true;
+}
+
+void NaturalSpline::Precompute()
+{
+    if (SplineEntries.size() >= 2)
+        Precompute_Cubic_Coeffs(this);
+    GenericSpline::Precompute();
+}
+
+void LinearSpline::Evaluate(SplineEntryList::size_type i, DBL p, EXPRESS& v)
+{
+    /* If outside spline range, return first or last point */
+    if(i == 0)
         memcpy(&v, &SplineEntries.front().vec, sizeof(EXPRESS));
+    else if(i >= SplineEntries.size())
+        memcpy(&v, &SplineEntries.back().vec, sizeof(EXPRESS));
+    /* Else, normal case */
     else
-    {
-        if (!Coeffs_Computed)
-            Precompute_Cubic_Coeffs(this);
-        /* Find which spline segment we're in.  i is the control point at the end of the segment */
-        SplineEntryList::size_type i = findt(this, p);
-        for(int k=0; k<5; k++)
-        {
-            /* If outside the spline range, return the first or last point */
-            if(i == 0)
-                v[k] = SplineEntries.front().vec[k];
-            else if(i >= SplineEntries.size())
-                v[k] = SplineEntries.back().vec[k];
-            /* Else, normal case.  cubic_interpolate can handle the case of not enough points */
-            else
-                v[k] = natural_interpolate(SplineEntries, i-1, k, p);
-        }
-    }
+        EvaluateSegment(i-1, p, v);
 }
 
-void CatmullRomSpline::Get(DBL p, EXPRESS& v)
+void QuadraticSpline::Evaluate(SplineEntryList::size_type i, DBL p, EXPRESS& v)
 {
-    if (SplineEntries.size() == 1)
+    /* If outside the spline range, return the first or last point */
+    if(i == 0)
         memcpy(&v, &SplineEntries.front().vec, sizeof(EXPRESS));
+    else if(i >= SplineEntries.size())
+        memcpy(&v, &SplineEntries.back().vec, sizeof(EXPRESS));
+    /* Else, normal case; the segment reduces the order if there are not enough points */
     else
-    {
-        /* Find which spline segment we're in.  i is the control point at the end of the segment */
-        SplineEntryList::size_type i = findt(this, p);
-        for(int k=0; k<5; k++)
-        {
-            /* If only two points, return their average */
-            if(SplineEntries.size() == 2)
-                v[k] = (SplineEntries[0].vec[k] + SplineEntries[1].vec[k])/2.0;
-            /* Catmull-Rom: If only three points, return the second one */
-            else if(i < 2)
-                v[k] = SplineEntries[1].vec[k];
-            /* Catmull-Rom: Can't interpolate before second point or after next-to-last */
-            else if(i >= SplineEntries.size()-1)
-                v[k] = SplineEntries[SplineEntries.size()-2].vec[k];
-            /* Else, normal case */
-            else
-                v[k] = catmull_rom_interpolate(SplineEntries, i-1, k, p);
-        }
-    }
+        EvaluateSegment(i-1, p, v);
+}
+
+void NaturalSpline::Evaluate(SplineEntryList::size_type i, DBL p, EXPRESS& v)
+{
+    /* The segments depend on all the points, so they can't be computed on the spot */
+    if (!Coeffs_Computed)
+        Precompute();
+    /* If outside the spline range, return the first or last point */
+    if(i == 0)
+        memcpy(&v, &SplineEntries.front().vec, sizeof(EXPRESS));
+    else if(i >= SplineEntries.size())
+        memcpy(&v, &SplineEntries.back().vec, sizeof(EXPRESS));
+    /* Else, normal case.  The coefficients can handle the case of not enough points */
+    else
+        EvaluateSegment(i-1, p, v);
+}
+
+void CatmullRomSpline::Evaluate(SplineEntryList::size_type i, DBL p, EXPRESS& v)
+{
+    /* Catmull-Rom: Can't interpolate before second point or after next-to-last;
+     * the first and last segments are constant, so clamp to those */
+    if(i < 1)
+        EvaluateSegment(0, p, v);
+    else if(i >= SplineEntries.size())
+        EvaluateSegment(SplineEntries.size()-2, p, v);
+    /* Else, normal case */
+    else
+        EvaluateSegment(i-1, p, v);
 }
 
 DBL Get_Spline_Val(GenericSpline *sp, DBL p, EXPRESS& v, int *Terms)
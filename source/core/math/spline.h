@@ -70,6 +70,19 @@ struct SplineEntry
 
 typedef vector<SplineEntry> SplineEntryList;
 
+/// Polynomial form of a single spline segment.
+///
+/// Each of the five components is stored as a cubic in the distance from the parameter of the
+/// segment's first control point, so that evaluating the spline boils down to a few
+/// multiply-adds once the segment has been found.
+///
+struct SplineSegment
+{
+    DBL coeff[5][4];
+};
+
+typedef vector<SplineSegment> SplineSegmentList;
+
 typedef int SplineRefCount;
 
 struct GenericSpline
@@ -78,46 +91,82 @@ struct GenericSpline
     GenericSpline(const GenericSpline& o);
     virtual ~GenericSpline();
     SplineEntryList SplineEntries;
+    SplineSegmentList Segments; ///< Polynomial of each segment; only valid if @ref Coeffs_Computed is set.
     bool Coeffs_Computed;
     int Terms;
     SplineRefCount ref_count;
 
-    virtual void Get(DBL p, EXPRESS& v) = 0;
+    void Get(DBL p, EXPRESS& v);
+
+    /// Evaluate the spline at a whole array of parameters.
+    ///
+    /// The segment found for one parameter is tried first for the next one, so runs of
+    /// parameters in ascending or descending order mostly avoid the binary search.
+    ///
+    void GetBatch(const DBL* p, unsigned int count, EXPRESS* v);
+
+    /// Compute the polynomials of all segments.
+    ///
+    /// The parser calls this once a spline is complete; from then on, evaluation no longer
+    /// modifies the spline, so it can be shared between render threads.
+    ///
+    virtual void Precompute();
+
     virtual GenericSpline* Clone() const = 0;
     void AcquireReference();
     void ReleaseReference();
+
+protected:
+
+    /// Evaluate the spline, given the index of the first control point beyond the parameter.
+    virtual void Evaluate(SplineEntryList::size_type i, DBL p, EXPRESS& v) = 0;
+
+    /// Compute the polynomial of the segment starting at control point `i`.
+    virtual void ComputeSegment(SplineEntryList::size_type i, SplineSegment& seg) const = 0;
+
+    /// Evaluate the polynomial of the segment starting at control point `i`.
+    void EvaluateSegment(SplineEntryList::size_type i, DBL p, EXPRESS& v) const;
 };
 
 struct LinearSpline : public GenericSpline
 {
     LinearSpline();
     LinearSpline(const GenericSpline& o);
-    virtual void Get(DBL p, EXPRESS& v);
     virtual GenericSpline* Clone() const { return new LinearSpline(*this); }
+protected:
+    virtual void Evaluate(SplineEntryList::size_type i, DBL p, EXPRESS& v);
+    virtual void ComputeSegment(SplineEntryList::size_type i, SplineSegment& seg) const;
 };
 
 struct QuadraticSpline : public GenericSpline
 {
     QuadraticSpline();
     QuadraticSpline(const GenericSpline& o);
-    virtual void Get(DBL p, EXPRESS& v);
     virtual GenericSpline* Clone() const { return new QuadraticSpline(*this); }
+protected:
+    virtual void Evaluate(SplineEntryList::size_type i, DBL p, EXPRESS& v);
+    virtual void ComputeSegment(SplineEntryList::size_type i, SplineSegment& seg) const;
 };
 
 struct NaturalSpline : public GenericSpline
 {
     NaturalSpline();
     NaturalSpline(const GenericSpline& o);
-    virtual void Get(DBL p, EXPRESS& v);
+    virtual void Precompute();
     virtual GenericSpline* Clone() const { return new NaturalSpline(*this); }
+protected:
+    virtual void Evaluate(SplineEntryList::size_type i, DBL p, EXPRESS& v);
+    virtual void ComputeSegment(SplineEntryList::size_type i, SplineSegment& seg) const;
 };
 
 struct CatmullRomSpline : public GenericSpline
 {
     CatmullRomSpline();
     CatmullRomSpline(const GenericSpline& o);
-    virtual void Get(DBL p, EXPRESS& v);
     virtual GenericSpline* Clone() const { return new CatmullRomSpline(*this); }
+protected:
+    virtual void Evaluate(SplineEntryList::size_type i, DBL p, EXPRESS& v);
+    virtual void ComputeSegment(SplineEntryList::size_type i, SplineSegment& seg) const;
 };
 
 
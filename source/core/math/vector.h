@@ -340,6 +340,12 @@ class GenericVector2d
 
 /// Generic template class to hold a 3D vector.
 ///
+/// @note
+///     The operators are deliberately written as plain per-component code rather than with SIMD
+///     intrinsics: With three components, explicit SSE2 code needs split loads and stores, and
+///     keeps the compiler from vectorising across entire expressions after inlining, which it
+///     does well on its own; specialisations for `double` measured about 10% slower.
+///
 /// @tparam T   Floating-point type to use for the individual vector components.
 ///
 template<typename T>
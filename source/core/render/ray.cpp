@@ -44,21 +44,87 @@
 namespace pov
 {
 
+RayInteriorVector::Data *RayInteriorVector::Allocate(unsigned int capacity)
+{
+    Data *data = static_cast<Data *>(::operator new(sizeof(Data) + (capacity - 1) * sizeof(Interior *)));
+    data->refCount = 1;
+    data->size = 0;
+    data->capacity = capacity;
+    return data;
+}
+
+void RayInteriorVector::Release()
+{
+    if ((mpData != nullptr) && (--mpData->refCount == 0))
+        ::operator delete(mpData);
+}
+
+void RayInteriorVector::push_back(Interior *i)
+{
+    if ((mpData == nullptr) || (mpData->refCount > 1) || (mpData->size == mpData->capacity))
+    {
+        unsigned int oldSize = (unsigned int)size();
+        Data *data = Allocate(max(4u, 2 * oldSize));
+        for (unsigned int n = 0; n < oldSize; n++)
+            data->entries[n] = mpData->entries[n];
+        data->size = oldSize;
+        Release();
+        mpData = data;
+    }
+
+    mpData->entries[mpData->size++] = i;
+}
+
+bool RayInteriorVector::remove(const Interior *i)
+{
+    unsigned int n = 0;
+
+    while ((n < size()) && (mpData->entries[n] != i))
+        n++;
+
+    if (n == size())
+        return false;
+
+    if (mpData->size == 1)
+    {
+        clear();
+        return true;
+    }
+
+    if (mpData->refCount > 1)
+    {
+        Data *data = Allocate(mpData->capacity);
+        for (unsigned int m = 0; m < mpData->size; m++)
+            data->entries[m] = mpData->entries[m];
+        data->size = mpData->size;
+        Release();
+        mpData = data;
+    }
+
+    for (n++; n < mpData->size; n++)
+        mpData->entries[n - 1] = mpData->entries[n];
+    mpData->size--;
+
+    return true;
+}
+
 Ray::Ray(TraceTicket& ticket, RayType rt, bool shadowTest, bool photon, bool radiosity, bool monochromatic, bool pretrace) :
-    ticket(ticket)
+    ticket(ticket),
+    coneWidth(0.0),
+    coneSpread(0.0)
 {
     SetFlags(rt, shadowTest, photon, radiosity, monochromatic, pretrace);
     hollowRay = true;
-    ClearInteriors();
 }
 
 Ray::Ray(TraceTicket& ticket, const Vector3d& ov, const Vector3d& dv, RayType rt, bool shadowTest, bool photon, bool radiosity, bool monochromatic, bool pretrace) :
     BasicRay(ov, dv),
-    ticket(ticket)
+    ticket(ticket),
+    coneWidth(0.0),
+    coneSpread(0.0)
 {
     SetFlags(rt, shadowTest, photon, radiosity, monochromatic, pretrace);
     hollowRay = true;
-    ClearInteriors();
 }
 
 Ray::~Ray()
@@ -71,38 +137,31 @@ void Ray::AppendInterior(Interior *i)
     hollowRay = hollowRay && i->hollow;
 }
 
-void Ray::AppendInteriors(RayInteriorVector& ii)
+void Ray::AppendInteriors(const RayInteriorVector& ii)
 {
-    interiors.reserve(interiors.size() + ii.size());
-
-    for(RayInteriorVector::iterator it(ii.begin()); it != ii.end(); it++)
+    // The common case of a fresh ray can just share the list.
+    if(interiors.empty())
+        interiors = ii;
+    else
     {
-        interiors.push_back(*it);
-        hollowRay = hollowRay && (*it)->hollow;
+        for(RayInteriorVector::const_iterator it(ii.begin()); it != ii.end(); it++)
+            interiors.push_back(*it);
     }
+
+    for(RayInteriorVector::const_iterator it(ii.begin()); it != ii.end(); it++)
+        hollowRay = hollowRay && (*it)->hollow;
 }
 
 bool Ray::RemoveInterior(const Interior *i)
 {
-    bool checkhollow = false;
-    bool found = false;
-
-    for(RayInteriorVector::iterator it(interiors.begin()); it != interiors.end(); it++)
-    {
-        if(*it == i)
-        {
-            checkhollow = ((*it)->hollow == false);
-            interiors.erase(it);
-            found = true;
-            break;
-        }
-    }
+    bool checkhollow = (i->hollow == false);
+    bool found = interiors.remove(i);
 
-    if(checkhollow == true)
+    if(found && checkhollow)
     {
         hollowRay = true;
 
-        for(RayInteriorVector::iterator it(interiors.begin()); it != interiors.end(); it++)
+        for(RayInteriorVector::const_iterator it(interiors.begin()); it != interiors.end(); it++)
             hollowRay = hollowRay && (*it)->hollow;
     }
 
@@ -54,7 +54,61 @@ namespace pov
 
 class Interior;
 
-typedef PooledSimpleVector<Interior *, RAYINTERIOR_VECTOR_SIZE> RayInteriorVector;
+/// List of the interiors a ray is travelling through, innermost last.
+///
+/// Rays are copied far more often than the set of interiors they are in changes, so the list is
+/// shared between copies by reference counting, and only copied when modified while shared.
+/// An empty list holds no storage at all.
+///
+/// @note
+///     The reference count is not thread-safe; lists must not be shared between render threads.
+///
+class RayInteriorVector final
+{
+    public:
+
+        typedef Interior *value_type;
+        typedef Interior * const *const_iterator;
+
+        RayInteriorVector() : mpData(nullptr) {}
+        RayInteriorVector(const RayInteriorVector& o) : mpData(o.mpData) { if (mpData != nullptr) ++mpData->refCount; }
+        ~RayInteriorVector() { Release(); }
+
+        RayInteriorVector& operator=(const RayInteriorVector& o)
+        {
+            if (o.mpData != nullptr)
+                ++o.mpData->refCount;
+            Release();
+            mpData = o.mpData;
+            return *this;
+        }
+
+        const_iterator begin() const { return (mpData != nullptr ? mpData->entries : nullptr); }
+        const_iterator end() const { return (mpData != nullptr ? mpData->entries + mpData->size : nullptr); }
+        size_t size() const { return (mpData != nullptr ? mpData->size : 0); }
+        bool empty() const { return (mpData == nullptr); }
+        Interior *back() const { return mpData->entries[mpData->size - 1]; }
+
+        void push_back(Interior *i);
+        /// Removes the first occurrence of an interior, returning whether it was found.
+        bool remove(const Interior *i);
+        void clear() { Release(); mpData = nullptr; }
+
+    private:
+
+        struct Data
+        {
+            unsigned int refCount;
+            unsigned int size;
+            unsigned int capacity;
+            Interior *entries[1]; ///< Actually `capacity` entries, allocated along with the header.
+        };
+
+        Data *mpData;
+
+        void Release();
+        static Data *Allocate(unsigned int capacity);
+};
 
 class Ray : public BasicRay
 {
@@ -74,13 +128,12 @@ class Ray : public BasicRay
         ~Ray();
 
         void AppendInterior(Interior *i);
-        void AppendInteriors(RayInteriorVector&);
+        void AppendInteriors(const RayInteriorVector&);
         bool RemoveInterior(const Interior *i);
         void ClearInteriors() { interiors.clear(); }
 
         bool IsInterior(const Interior *i) const;
         const RayInteriorVector& GetInteriors() const { return interiors; }
-        RayInteriorVector& GetInteriors() { return interiors; }
 
         void SetSpectralBand(const SpectralBand&);
         const SpectralBand& GetSpectralBand() const;
@@ -105,12 +158,32 @@ class Ray : public BasicRay
         inline TraceTicket& GetTicket() { return ticket; }
         inline const TraceTicket& GetTicket() const { return ticket; }
 
+        /// Sets the ray's footprint.
+        ///
+        /// The footprint is modelled as a cone around the ray, i.e. an isotropic simplification
+        /// of ray differentials; a width and spread of zero (the default) indicate an infinitely
+        /// thin ray, for which no texture filtering will be performed.
+        ///
+        /// @param[in]  width   Width of the footprint at the ray's origin.
+        /// @param[in]  spread  Increase in width per unit of distance travelled along the ray.
+        ///
+        void SetCone(DBL width, DBL spread) { coneWidth = width; coneSpread = spread; }
+
+        /// Sets the ray's footprint to continue that of another ray from a point along it.
+        void ContinueCone(const Ray& other, DBL depth) { coneWidth = other.GetFootprint(depth); coneSpread = other.coneSpread; }
+
+        /// Gets the width of the ray's footprint at a given distance from its origin.
+        DBL GetFootprint(DBL depth) const { return coneWidth + coneSpread * depth; }
+
     private:
 
         RayInteriorVector interiors;
         SpectralBand spectralBand;
         TraceTicket& ticket;
 
+        DBL coneWidth;
+        DBL coneSpread;
+
         bool primaryRay : 1;
         bool reflectionRay : 1;
         bool refractionRay : 1;
@@ -41,7 +41,9 @@
 #include <boost/bind.hpp>
 
 #include "core/bounding/bsptree.h"
+#include "core/bounding/projectionbuffer.h"
 #include "core/lighting/lightsource.h"
+#include "core/lighting/lighttree.h"
 #include "core/lighting/radiosity.h"
 #include "core/lighting/subsurface.h"
 #include "core/material/interior.h"
@@ -59,6 +61,7 @@
 #include "core/scene/tracethreaddata.h"
 #include "core/shape/box.h"
 #include "core/shape/csg.h"
+#include "core/shape/instance.h"
 #include "core/support/imageutil.h"
 
 // this must be the last file included
@@ -69,6 +72,58 @@ namespace pov
 
 #define SHADOW_TOLERANCE 1.0e-3
 
+// rays traced between checks whether the render has been stopped or paused, minus one
+#define COOPERATE_RAY_MASK 0x3f
+
+// fog distances beyond which turbulence changes a fog's attenuation by less than 1e-7
+#define FOG_TURBULENCE_CUTOFF 20.0
+
+// largest fog turbulence lattice coordinate looked up in the cache
+#define FOG_TURBULENCE_GRID_LIMIT 1.0e9
+
+/// Attributes the cost of a scene intersection query to the type of the ray.
+///
+/// The cost is measured as the change of the thread's node and object test counters over the
+/// lifetime of the recorder. For ray packets, the cost is attributed to the packet as a whole.
+///
+class TraversalStatsRecorder
+{
+    public:
+        TraversalStatsRecorder(const Ray& ray, RenderStatistics& stats, size_t count = 1) :
+            mStats(stats),
+            mInfo(traversal_stats[GetRayType(ray)]),
+            mNodes(stats[nChecked] + stats[BSP_Node_Visits]),
+            mObjects(stats[Scene_Object_Tests])
+        {
+            mStats[mInfo.stat_rays_id] += count;
+        }
+
+        ~TraversalStatsRecorder()
+        {
+            mStats[mInfo.stat_nodes_id] += (mStats[nChecked] + mStats[BSP_Node_Visits]) - mNodes;
+            mStats[mInfo.stat_objects_id] += mStats[Scene_Object_Tests] - mObjects;
+        }
+
+    private:
+        RenderStatistics& mStats;
+        const TRAVERSAL_STATS_INFO& mInfo;
+        POV_ULONG mNodes;
+        POV_ULONG mObjects;
+
+        static TraversalRayType GetRayType(const Ray& ray)
+        {
+            if(ray.IsPhotonRay())
+                return kTraversalRay_Photon;
+            if(ray.IsRadiosityRay())
+                return kTraversalRay_Radiosity;
+            if(ray.IsShadowTestRay())
+                return kTraversalRay_Shadow;
+            if(ray.IsPrimaryRay())
+                return kTraversalRay_Camera;
+            return kTraversalRay_Reflection;
+        }
+};
+
 
 bool NoSomethingFlagRayObjectCondition::operator()(const Ray& ray, ConstObjectPtr object, double) const
 {
@@ -83,11 +138,27 @@ bool NoSomethingFlagRayObjectCondition::operator()(const Ray& ray, ConstObjectPt
     return true;
 }
 
+bool NoSomethingFlagRayObjectCondition::GetFlagMask(const Ray& ray, unsigned int& mask) const
+{
+    mask = 0;
+    if(ray.IsImageRay())
+        mask |= NO_IMAGE_FLAG;
+    if(ray.IsReflectionRay())
+        mask |= NO_REFLECTION_FLAG;
+    if(ray.IsRadiosityRay())
+        mask |= NO_RADIOSITY_FLAG;
+    if(ray.IsPhotonRay())
+        mask |= NO_SHADOW_FLAG;
+    return true;
+}
+
 Trace::Trace(shared_ptr<SceneData> sd, TraceThreadData *td, const QualityFlags& qf,
              CooperateFunctor& cf, MediaFunctor& mf, RadiosityFunctor& rf) :
     threadData(td),
     sceneData(sd),
     maxFoundTraceLevel(0),
+    packetIntersection(nullptr),
+    firstHitFeatures(nullptr),
     qualityFlags(qf),
     mailbox(0),
     crandRandomNumberGenerator(0),
@@ -99,15 +170,24 @@ Trace::Trace(shared_ptr<SceneData> sd, TraceThreadData *td, const QualityFlags&
     cooperate(cf),
     media(mf),
     radiosity(rf),
-    lightColorCacheIndex(-1)
+    lightColorCacheIndex(-1),
+    areaLightCacheBlock(0),
+    lightGridJitter(nullptr)
 {
     lightSourceLevel1ShadowCache.resize(max(1, (int) threadData->lightSources.size()));
-    for(vector<ObjectPtr>::iterator i(lightSourceLevel1ShadowCache.begin()); i != lightSourceLevel1ShadowCache.end(); i++)
-        *i = nullptr;
-
     lightSourceOtherShadowCache.resize(max(1, (int) threadData->lightSources.size()));
-    for(vector<ObjectPtr>::iterator i(lightSourceOtherShadowCache.begin()); i != lightSourceOtherShadowCache.end(); i++)
-        *i = nullptr;
+    areaLightVisibility.resize(max(1, (int) threadData->lightSources.size()), kAreaLightPenumbra);
+    if(sceneData->areaLightCacheDistance > 0.0)
+        areaLightCache.resize(threadData->lightSources.size());
+    for(const FOG *fog = sceneData->fog; fog != nullptr; fog = fog->Next)
+    {
+        if((fog->Turb != nullptr) && (fog->Turb_Grid_Resolution > 0))
+        {
+            FogTurbulenceCacheEntry unused = { nullptr, 0, 0, 0, 0.0 };
+            fogTurbulenceCache.assign(FogTurbulenceCacheSize, unused);
+            break;
+        }
+    }
 
     lightColorCache.resize(max(20U, sd->parsedMaxTraceLevel + 1));
     for(LightColorCacheListList::iterator it = lightColorCache.begin(); it != lightColorCache.end(); it++)
@@ -127,13 +207,22 @@ double Trace::TraceRay(Ray& ray, MathColour& colour, ColourChannel& transm, COLC
     bool found;
     NoSomethingFlagRayObjectCondition precond;
     TrueRayObjectCondition postcond;
+    const Intersection *precomputed = packetIntersection;
+
+    packetIntersection = nullptr;
 
     POV_ULONG nrays = threadData->Stats()[Number_Of_Rays]++;
-    if(ray.IsPrimaryRay() || (((unsigned char) nrays & 0x0f) == 0x00))
+    if((nrays & COOPERATE_RAY_MASK) == 0)
         cooperate();
 
+    // With Russian roulette in effect, rays spawning a new trace level are not cut off at the ADC bailout,
+    // but instead survive at random, with a probability proportional to their weight; survivors have their
+    // contribution scaled up accordingly, so that the result is correct on average.
+    double rouletteBailout = max(sceneData->rouletteBailout, ray.GetTicket().adcBailout);
+    bool roulette = (sceneData->rouletteBailout > 0.0) && !continuedRay && (weight < rouletteBailout);
+
     // Check for max. trace level or ADC bailout.
-    if((ray.GetTicket().traceLevel >= ray.GetTicket().maxAllowedTraceLevel) || (weight < ray.GetTicket().adcBailout))
+    if((ray.GetTicket().traceLevel >= ray.GetTicket().maxAllowedTraceLevel) || (!roulette && (weight < ray.GetTicket().adcBailout)))
     {
         if(weight < ray.GetTicket().adcBailout)
             threadData->Stats()[ADC_Saves]++;
@@ -143,10 +232,36 @@ double Trace::TraceRay(Ray& ray, MathColour& colour, ColourChannel& transm, COLC
         return HUGE_VAL;
     }
 
+    double rouletteFactor = 1.0;
+    if(roulette)
+    {
+        unsigned int level = min(max(ray.GetTicket().traceLevel, 1u), 5u) - 1;
+        double survival = weight / rouletteBailout;
+        threadData->Stats()[IntStatsIndex(Roulette_Tests_L1 + level)]++;
+        if(randomNumberGenerator() >= survival)
+        {
+            threadData->Stats()[IntStatsIndex(Roulette_Kills_L1 + level)]++;
+
+            colour.Clear();
+            transm = 0.0;
+            return HUGE_VAL;
+        }
+        rouletteFactor = 1.0 / survival;
+        weight = rouletteBailout;
+    }
+
     if (maxDepth >= EPSILON)
         bestisect.Depth = maxDepth;
 
-    found = FindIntersection(bestisect, ray, precond, postcond);
+    if (precomputed != nullptr)
+    {
+        // The closest intersection has already been found as part of a ray packet;
+        // from here on, the ray is shaded on its own.
+        bestisect = *precomputed;
+        found = (bestisect.Object != nullptr);
+    }
+    else
+        found = FindIntersection(bestisect, ray, precond, postcond);
 
     // Check if we're busy shooting too many radiosity sample rays at an unimportant object
     if (ray.GetTicket().radiosityImportanceQueried >= 0.0)
@@ -210,6 +325,9 @@ double Trace::TraceRay(Ray& ray, MathColour& colour, ColourChannel& transm, COLC
 
     ray.GetTicket().radiosityImportanceQueried = oldRadiosityImportanceQueried;
 
+    if(roulette)
+        colour *= ColourChannel(rouletteFactor);
+
     if(found == false)
         return HUGE_VAL;
     else
@@ -218,6 +336,8 @@ double Trace::TraceRay(Ray& ray, MathColour& colour, ColourChannel& transm, COLC
 
 bool Trace::FindIntersection(Intersection& bestisect, const Ray& ray)
 {
+    TraversalStatsRecorder recorder(ray, threadData->Stats());
+
     switch(sceneData->boundingMethod)
     {
         case 2:
@@ -228,6 +348,8 @@ bool Trace::FindIntersection(Intersection& bestisect, const Ray& ray)
             mailbox.clear();
 
             found = (*(sceneData->tree))(ray, ifn, mailbox, bestisect.Depth);
+            threadData->Stats()[BSP_Mailbox_Hits] += mailbox.redundant();
+            threadData->Stats()[BSP_Node_Visits] += mailbox.visited();
 
             // test infinite objects
             for(vector<ObjectPtr>::iterator it = sceneData->objects.begin() + sceneData->numberOfFiniteObjects; it != sceneData->objects.end(); it++)
@@ -243,10 +365,18 @@ bool Trace::FindIntersection(Intersection& bestisect, const Ray& ray)
 
             return found;
         }
+        case 4:
+        case 5:
+        {
+            if (sceneData->flatBVH != nullptr)
+                return (sceneData->flatBVH->Intersect(flatBVHStack, ray, &bestisect, threadData));
+        }
+        // FALLTHROUGH
         case 1:
+        case 3:
         {
             if (sceneData->boundingSlabs != nullptr)
-                return (Intersect_BBox_Tree(priorityQueue, sceneData->boundingSlabs, ray, &bestisect, threadData));
+                return (Intersect_BBox_Tree(bboxStack, sceneData->boundingSlabs, ray, &bestisect, threadData));
         }
         // FALLTHROUGH
         case 0:
@@ -273,6 +403,12 @@ bool Trace::FindIntersection(Intersection& bestisect, const Ray& ray)
 
 bool Trace::FindIntersection(Intersection& bestisect, const Ray& ray, const RayObjectCondition& precondition, const RayObjectCondition& postcondition)
 {
+    TraversalStatsRecorder recorder(ray, threadData->Stats());
+
+    // Primary rays start at the camera location, and can thus use the vista buffer.
+    if((sceneData->vistaBuffer != nullptr) && ray.IsPrimaryRay() && (ray.Origin - sceneData->vistaBuffer->GetCentre()).IsNull())
+        return FindVistaBufferIntersection(*(sceneData->vistaBuffer), bestisect, ray, precondition, postcondition);
+
     switch(sceneData->boundingMethod)
     {
         case 2:
@@ -283,6 +419,8 @@ bool Trace::FindIntersection(Intersection& bestisect, const Ray& ray, const RayO
             mailbox.clear();
 
             found = (*(sceneData->tree))(ray, ifn, mailbox, bestisect.Depth);
+            threadData->Stats()[BSP_Mailbox_Hits] += mailbox.redundant();
+            threadData->Stats()[BSP_Node_Visits] += mailbox.visited();
 
             // test infinite objects
             for(vector<ObjectPtr>::iterator it = sceneData->objects.begin() + sceneData->numberOfFiniteObjects; it != sceneData->objects.end(); it++)
@@ -301,10 +439,18 @@ bool Trace::FindIntersection(Intersection& bestisect, const Ray& ray, const RayO
 
             return found;
         }
+        case 4:
+        case 5:
+        {
+            if (sceneData->flatBVH != nullptr)
+                return (sceneData->flatBVH->Intersect(flatBVHStack, ray, &bestisect, precondition, postcondition, threadData));
+        }
+        // FALLTHROUGH
         case 1:
+        case 3:
         {
             if (sceneData->boundingSlabs != nullptr)
-                return (Intersect_BBox_Tree(priorityQueue, sceneData->boundingSlabs, ray, &bestisect, precondition, postcondition, threadData));
+                return (Intersect_BBox_Tree(bboxStack, sceneData->boundingSlabs, ray, &bestisect, precondition, postcondition, threadData));
         }
         // FALLTHROUGH
         case 0:
@@ -332,10 +478,229 @@ bool Trace::FindIntersection(Intersection& bestisect, const Ray& ray, const RayO
     return false;
 }
 
+bool Trace::FindIntersections(Intersection *isects, const Ray *rays, size_t count, const RayObjectCondition& precondition,
+                              const RayObjectCondition& postcondition)
+{
+    bool found = false;
+
+    // Packets are only traversed through the bounding slabs; rays that would use the vista
+    // buffer or a BSP tree are traced one at a time.
+    if((count > 1) && (sceneData->boundingSlabs != nullptr) && (sceneData->vistaBuffer == nullptr) &&
+       ((sceneData->boundingMethod == 1) || (sceneData->boundingMethod == 3) || (sceneData->boundingMethod == 4)))
+    {
+        TraversalStatsRecorder recorder(rays[0], threadData->Stats(), count);
+
+        return Intersect_BBox_Tree_Packet(bboxPacketStack, sceneData->boundingSlabs, rays, count, isects, precondition, postcondition, threadData);
+    }
+
+    for(size_t i = 0; i < count; i++)
+    {
+        if(FindIntersection(isects[i], rays[i], precondition, postcondition))
+            found = true;
+    }
+
+    return found;
+}
+
+bool Trace::FindAnyIntersection(Intersection& isect, const Ray& ray, double maxDepth, const RayObjectCondition& precondition,
+                                const RayObjectCondition& postcondition, const RayObjectCondition& terminate)
+{
+    TraversalStatsRecorder recorder(ray, threadData->Stats());
+
+    switch(sceneData->boundingMethod)
+    {
+        case 2:
+        {
+            BSPIntersectAnyCondFunctor ifn(isect, ray, sceneData->objects, threadData, precondition, postcondition, terminate);
+            bool found = false;
+
+            mailbox.clear();
+
+            found = (*(sceneData->tree))(ray, ifn, mailbox, maxDepth);
+            threadData->Stats()[BSP_Mailbox_Hits] += mailbox.redundant();
+            threadData->Stats()[BSP_Node_Visits] += mailbox.visited();
+
+            if(found && terminate(ray, isect.Object, isect.Depth))
+                return true;
+
+            // test infinite objects
+            for(vector<ObjectPtr>::iterator it = sceneData->objects.begin() + sceneData->numberOfFiniteObjects; it != sceneData->objects.end(); it++)
+            {
+                if(precondition(ray, *it, 0.0) == true)
+                {
+                    Intersection tmpisect;
+
+                    if(FindIntersection(*it, tmpisect, ray, postcondition, maxDepth))
+                    {
+                        isect = tmpisect;
+                        found = true;
+
+                        if(terminate(ray, isect.Object, isect.Depth))
+                            break;
+                    }
+                }
+            }
+
+            return found;
+        }
+        case 4:
+        case 5:
+        {
+            if (sceneData->flatBVH != nullptr)
+                return (sceneData->flatBVH->IntersectAny(flatBVHStack, ray, &isect, maxDepth, precondition, postcondition, terminate, threadData));
+        }
+        // FALLTHROUGH
+        case 1:
+        case 3:
+        {
+            if (sceneData->boundingSlabs != nullptr)
+                return (Intersect_BBox_Tree_Any(bboxStack, sceneData->boundingSlabs, ray, &isect, maxDepth, precondition, postcondition, terminate, threadData));
+        }
+        // FALLTHROUGH
+        case 0:
+        {
+            bool found = false;
+
+            for(vector<ObjectPtr>::iterator it = sceneData->objects.begin(); it != sceneData->objects.end(); it++)
+            {
+                if(precondition(ray, *it, 0.0) == true)
+                {
+                    Intersection tmpisect;
+
+                    if(FindIntersection(*it, tmpisect, ray, postcondition, maxDepth))
+                    {
+                        isect = tmpisect;
+                        found = true;
+
+                        if(terminate(ray, isect.Object, isect.Depth))
+                            break;
+                    }
+                }
+            }
+
+            return found;
+        }
+    }
+
+    return false;
+}
+
+bool Trace::FindVistaBufferIntersection(const ProjectionBuffer& buffer, Intersection& bestisect, const Ray& ray,
+                                        const RayObjectCondition& precondition, const RayObjectCondition& postcondition)
+{
+    ProjectionBuffer::Range candidates[2] = { buffer.GetCell(ray.Direction), buffer.GetUnbuffered() };
+    double scale = ray.Direction.length();
+    bool found = false;
+
+    threadData->Stats()[VBuffer_Tests]++;
+
+    // Objects are sorted by distance, so we're done with a list as soon as we reach one that
+    // is farther away than the closest intersection found so far.
+    for(int i = 0; i < 2; i++)
+    {
+        for(const ProjectionBuffer::Entry *entry = candidates[i].first; (entry != candidates[i].last) && (entry->distance < bestisect.Depth * scale); entry++)
+        {
+            if(precondition(ray, entry->object, 0.0) == true)
+            {
+                Intersection isect;
+
+                if(FindIntersection(entry->object, isect, ray, postcondition, bestisect.Depth))
+                {
+                    bestisect = isect;
+                    found = true;
+                }
+            }
+        }
+    }
+
+    if(found)
+        threadData->Stats()[VBuffer_Tests_Succeeded]++;
+
+    return found;
+}
+
+bool Trace::FindLightBufferIntersection(const ProjectionBuffer& buffer, double lightDistance, Intersection& bestisect, const Ray& ray,
+                                        const RayObjectCondition& precondition, const RayObjectCondition& postcondition)
+{
+    TraversalStatsRecorder recorder(ray, threadData->Stats());
+
+    ProjectionBuffer::Range candidates[2] = { buffer.GetCell(-ray.Direction), buffer.GetUnbuffered() };
+    double limit = lightDistance * ray.Direction.length();
+    bool found = false;
+
+    threadData->Stats()[LBuffer_Tests]++;
+
+    // Objects are sorted by distance from the light source, so we're done with a list as soon
+    // as we reach one that is farther away from it than the ray's origin.
+    for(int i = 0; i < 2; i++)
+    {
+        for(const ProjectionBuffer::Entry *entry = candidates[i].first; (entry != candidates[i].last) && (entry->distance < limit); entry++)
+        {
+            if(precondition(ray, entry->object, 0.0) == true)
+            {
+                Intersection isect;
+
+                if(FindIntersection(entry->object, isect, ray, postcondition, bestisect.Depth))
+                {
+                    bestisect = isect;
+                    found = true;
+                }
+            }
+        }
+    }
+
+    if(found)
+        threadData->Stats()[LBuffer_Tests_Succeeded]++;
+
+    return found;
+}
+
+bool Trace::FindAnyLightBufferIntersection(const ProjectionBuffer& buffer, double lightDistance, Intersection& isect, const Ray& ray, double maxDepth,
+                                           const RayObjectCondition& precondition, const RayObjectCondition& postcondition, const RayObjectCondition& terminate)
+{
+    TraversalStatsRecorder recorder(ray, threadData->Stats());
+
+    ProjectionBuffer::Range candidates[2] = { buffer.GetCell(-ray.Direction), buffer.GetUnbuffered() };
+    double limit = lightDistance * ray.Direction.length();
+    bool found = false;
+
+    threadData->Stats()[LBuffer_Tests]++;
+
+    for(int i = 0; i < 2; i++)
+    {
+        for(const ProjectionBuffer::Entry *entry = candidates[i].first; (entry != candidates[i].last) && (entry->distance < limit); entry++)
+        {
+            if(precondition(ray, entry->object, 0.0) == true)
+            {
+                Intersection tmpisect;
+
+                if(FindIntersection(entry->object, tmpisect, ray, postcondition, maxDepth))
+                {
+                    isect = tmpisect;
+                    found = true;
+
+                    if(terminate(ray, isect.Object, isect.Depth))
+                    {
+                        threadData->Stats()[LBuffer_Tests_Succeeded]++;
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    if(found)
+        threadData->Stats()[LBuffer_Tests_Succeeded]++;
+
+    return found;
+}
+
 bool Trace::FindIntersection(ObjectPtr object, Intersection& isect, const Ray& ray, double closest)
 {
     if (object != nullptr)
     {
+        threadData->Stats()[Scene_Object_Tests]++;
+
         BBoxVector3d origin;
         BBoxVector3d invdir;
         BBoxDirection variant;
@@ -357,8 +722,10 @@ bool Trace::FindIntersection(ObjectPtr object, Intersection& isect, const Ray& r
         IStack depthstack(stackPool);
         POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
 
+        ObjectProfileScope profile(threadData, object, ObjectProfileScope::kIntersection);
         if(object->All_Intersections(ray, depthstack, threadData))
         {
+            profile.Hit();
             bool found = false;
             double tmpDepth = 0;
 
@@ -385,10 +752,50 @@ bool Trace::FindIntersection(ObjectPtr object, Intersection& isect, const Ray& r
     return false;
 }
 
+bool Trace::FindIntersection(const ShadowCacheEntry& entry, Intersection& isect, const Ray& ray, double closest)
+{
+    if (entry.component == nullptr)
+        return FindIntersection(entry.object, isect, ray, closest);
+
+    // Only re-test the component of the instance that was hit, rather than the instance's entire prototype.
+
+    threadData->Stats()[Scene_Object_Tests]++;
+
+    IStack depthstack(stackPool);
+    POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+
+    bool found = false;
+
+    if(static_cast<Instance *>(entry.object)->Component_Intersections(entry.component, ray, depthstack, threadData))
+    {
+        while(depthstack->size() > 0)
+        {
+            double tmpDepth = depthstack->top().Depth;
+            if(tmpDepth < closest && tmpDepth >= MIN_ISECT_DEPTH)
+            {
+                isect = depthstack->top();
+                closest = tmpDepth;
+                found = true;
+            }
+
+            depthstack->pop();
+        }
+    }
+
+    return found;
+}
+
+Trace::ShadowCacheEntry::ShadowCacheEntry(const Intersection& isect) :
+    object(isect.Csg != nullptr ? isect.Csg : isect.Object),
+    component(isect.Csg != nullptr ? nullptr : isect.InnerComponent)
+{}
+
 bool Trace::FindIntersection(ObjectPtr object, Intersection& isect, const Ray& ray, const RayObjectCondition& postcondition, double closest)
 {
     if (object != nullptr)
     {
+        threadData->Stats()[Scene_Object_Tests]++;
+
         BBoxVector3d origin;
         BBoxVector3d invdir;
         BBoxDirection variant;
@@ -410,8 +817,10 @@ bool Trace::FindIntersection(ObjectPtr object, Intersection& isect, const Ray& r
         IStack depthstack(stackPool);
         POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
 
+        ObjectProfileScope profile(threadData, object, ObjectProfileScope::kIntersection);
         if(object->All_Intersections(ray, depthstack, threadData))
         {
+            profile.Hit();
             bool found = false;
             double tmpDepth = 0;
 
@@ -447,6 +856,7 @@ void Trace::ComputeTextureColour(Intersection& isect, MathColour& colour, Colour
 {
     // NOTE: when called during the photon pass this method is used to deposit photons
     // on the surface and not, per se, to compute texture color.
+    ObjectProfileScope profile(threadData, isect.Object, ObjectProfileScope::kShading);
     WeightedTextureVector wtextures;
     double normaldirection;
     MathColour tmpCol;
@@ -466,6 +876,9 @@ void Trace::ComputeTextureColour(Intersection& isect, MathColour& colour, Colour
     for (LightColorCacheList::iterator it = lightColorCache[lightColorCacheIndex].begin(); it != lightColorCache[lightColorCacheIndex].end(); it++)
         it->tested = false;
 
+    // pattern values computed for any previous intersection are no longer valid
+    threadData->mPatternMemo.NewGeneration();
+
     // compute the surface normal
     isect.Object->Normal(rawnormal, &isect, threadData);
 
@@ -829,6 +1242,15 @@ void Trace::ComputeLightedTexture(MathColour& resultColour, ColourChannel& resul
         // an image map used just once.
         one_colour_found = (one_colour_found || colour_found);
 
+        // Record the top layer's properties for denoising, if this is the first surface hit by a primary ray.
+        if ((layer_number == 0) && (firstHitFeatures != nullptr) && !firstHitFeatures->found && ray.IsPrimaryRay())
+        {
+            firstHitFeatures->albedo = layCol.colour();
+            firstHitFeatures->normal = layNormal;
+            firstHitFeatures->depth  = isect.Depth;
+            firstHitFeatures->found  = true;
+        }
+
         // This section of code used to be the routine Compute_Reflected_Colour.
         // I copied it in here to rearrange some of it more easily and to
         // see if we could eliminate passing a zillion parameters for no
@@ -1288,6 +1710,7 @@ void Trace::ComputeReflection(const FINISH* finish, const Vector3d& ipoint, Ray&
 
     nray.Direction.normalize();
     nray.Origin = ipoint;
+    nray.ContinueCone(ray, (ipoint - ray.Origin).length());
     threadData->Stats()[Reflected_Rays_Traced]++;
 
     // Trace reflected ray.
@@ -1322,6 +1745,7 @@ bool Trace::ComputeRefraction(const FINISH* finish, Interior *interior, const Ve
 
     // Set up new ray.
     nray.Origin = ipoint;
+    nray.ContinueCone(ray, (ipoint - ray.Origin).length());
 
     // Get ratio of iors depending on the interiors the ray is traversing.
 
@@ -1419,10 +1843,23 @@ bool Trace::ComputeRefraction(const FINISH* finish, Interior *interior, const Ve
             colour.Clear();
             transm = 0.0;
 
-            for(unsigned int i = 0; i < dispersionelements; i++)
+            // With `spectral_samples` in effect, trace only that many of the bands, one picked at random from each
+            // of as many equal slices of the spectrum, so that on average each band still gets its proper weight.
+            unsigned int samples = dispersionelements;
+            double offset = 0.0;
+            if((sceneData->spectralSamples > 0) && ((unsigned int)sceneData->spectralSamples < dispersionelements))
+            {
+                samples = sceneData->spectralSamples;
+                offset = randomNumberGenerator();
+            }
+
+            for(unsigned int sample = 0; sample < samples; sample++)
             {
                 MathColour tempColour;
                 ColourChannel tempTransm;
+                unsigned int i = sample;
+                if(samples < dispersionelements)
+                    i = min((unsigned int)((sample + offset) * dispersionelements / samples), dispersionelements - 1);
 
                 // NB setting the dispersion factor also causes the MonochromaticRay flag to be set
                 SpectralBand spectralBand(i, dispersionelements);
@@ -1434,8 +1871,8 @@ bool Trace::ComputeRefraction(const FINISH* finish, Interior *interior, const Ve
                 transm += tempTransm;
             }
 
-            colour /= ColourChannel(dispersionelements);
-            transm /= ColourChannel(dispersionelements);
+            colour /= ColourChannel(samples);
+            transm /= ColourChannel(samples);
         }
     }
 
@@ -1486,8 +1923,19 @@ void Trace::ComputeDiffuseLight(const FINISH *finish, const Vector3d& ipoint, co
     // global light sources, if not turned off for this object
     if((object->Flags & NO_GLOBAL_LIGHTS_FLAG) != NO_GLOBAL_LIGHTS_FLAG)
     {
-        for(int i = 0; i < threadData->lightSources.size(); i++)
-            ComputeOneDiffuseLight(*threadData->lightSources[i], reye, finish, ipoint, eye, layer_normal, layer_pigment_colour, colour, attenuation, object, relativeIor, i);
+        if(sceneData->lightSourceTree != nullptr)
+        {
+            // only bother with the light sources near enough to matter
+            LightSourceIndexVector lights;
+            sceneData->lightSourceTree->Find(ipoint, lights);
+            for(LightSourceIndexVector::const_iterator i = lights.begin(); i != lights.end(); ++i)
+                ComputeOneDiffuseLight(*threadData->lightSources[*i], reye, finish, ipoint, eye, layer_normal, layer_pigment_colour, colour, attenuation, object, relativeIor, *i);
+        }
+        else
+        {
+            for(int i = 0; i < threadData->lightSources.size(); i++)
+                ComputeOneDiffuseLight(*threadData->lightSources[i], reye, finish, ipoint, eye, layer_normal, layer_pigment_colour, colour, attenuation, object, relativeIor, i);
+        }
     }
 
     // local light sources from a light group, if any
@@ -1662,7 +2110,7 @@ void Trace::ComputeOneDiffuseLight(const LightSource &lightsource, const Vector3
             if (lightColorCache[lightColorCacheIndex][light_index].tested == false)
             {
                 // note that lightColorCache may be re-sized during trace, so we don't store a reference to it across the call
-                TraceShadowRay(lightsource, lightsourcedepth, lightsourceray, ipoint, lightcolour);
+                TraceCachedShadowRay(lightsource, lightsourcedepth, lightsourceray, ipoint, layer_normal, lightcolour);
                 lightColorCache[lightColorCacheIndex][light_index].tested = true;
                 lightColorCache[lightColorCacheIndex][light_index].colour = lightcolour;
             }
@@ -1670,7 +2118,7 @@ void Trace::ComputeOneDiffuseLight(const LightSource &lightsource, const Vector3
                 lightcolour = lightColorCache[lightColorCacheIndex][light_index].colour;
         }
         else
-            TraceShadowRay(lightsource, lightsourcedepth, lightsourceray, ipoint, lightcolour);
+            TraceCachedShadowRay(lightsource, lightsourcedepth, lightsourceray, ipoint, layer_normal, lightcolour);
     }
 
     if(!lightcolour.IsNearZero(EPSILON))
@@ -1757,6 +2205,7 @@ void Trace::ComputeFullAreaDiffuseLight(const LightSource &lightsource, const Ve
 
     MathColour sampleLightcolour = lightcolour / (lightsource.Area_Size1 * lightsource.Area_Size2);
     MathColour attenuatedLightcolour;
+    const Vector2d *jitterPattern = SelectJitterPattern(lightsource);
 
     for(int v = 0; v < lightsource.Area_Size2; ++v)
     {
@@ -1769,7 +2218,12 @@ void Trace::ComputeFullAreaDiffuseLight(const LightSource &lightsource, const Ve
             bool backside = false;
             MathColour tmpCol;
 
-            if(lightsource.Jitter)
+            if(jitterPattern != nullptr)
+            {
+                jitter_u += jitterPattern[u * lightsource.Area_Size2 + v][X];
+                jitter_v += jitterPattern[u * lightsource.Area_Size2 + v][Y];
+            }
+            else if(lightsource.Jitter)
             {
                 jitter_u += randomNumberGenerator() - 0.5;
                 jitter_v += randomNumberGenerator() - 0.5;
@@ -1877,6 +2331,81 @@ void Trace::ComputeOneLightRay(const LightSource &lightsource, double& lightsour
     lightcolour *= attenuation;
 }
 
+void Trace::TraceCachedShadowRay(const LightSource &lightsource, double depth, Ray& lightsourceray, const Vector3d& point,
+                                 const Vector3d& normal, MathColour& colour)
+{
+    if(areaLightCache.empty() || !lightsource.Area_Light || !qualityFlags.areaLights || lightsource.lightGroupLight ||
+       (lightsourceray.GetTicket().traceLevel != 1) || lightsourceray.IsRadiosityRay())
+    {
+        TraceShadowRay(lightsource, depth, lightsourceray, point, colour);
+        return;
+    }
+
+    // The cache only holds samples from the current render block, as those from other blocks are unlikely to be
+    // anywhere near.
+    if(areaLightCacheBlock != threadData->ProgressIndex())
+    {
+        for(vector<AreaLightCache>::iterator i = areaLightCache.begin(); i != areaLightCache.end(); i++)
+        {
+            i->records.clear();
+            i->next = 0;
+        }
+        areaLightCacheBlock = threadData->ProgressIndex();
+    }
+
+    AreaLightCache& cache = areaLightCache[lightsource.index];
+
+    // Interpolate from the nearby samples on a similarly oriented surface, provided there are at least two of them
+    // and they agree to within the tolerance; this also bounds the error of the interpolated value.
+
+    double maxDistSqr = Sqr(sceneData->areaLightCacheDistance);
+    MathColour visibilitySum, visibilityMin(1.0), visibilityMax(0.0);
+    double weightSum = 0.0;
+    int neighbours = 0;
+
+    for(vector<AreaLightCacheRecord>::const_iterator i = cache.records.begin(); i != cache.records.end(); i++)
+    {
+        double distSqr = (i->point - point).lengthSqr();
+        if((distSqr >= maxDistSqr) || (dot(i->normal, normal) < 0.95))
+            continue;
+
+        double weight = 1.0 - sqrt(distSqr / maxDistSqr);
+        visibilitySum += i->visibility * weight;
+        weightSum += weight;
+        for(int c = 0; c < MathColour::channels; c++)
+        {
+            visibilityMin[c] = min(visibilityMin[c], i->visibility[c]);
+            visibilityMax[c] = max(visibilityMax[c], i->visibility[c]);
+        }
+        neighbours++;
+    }
+
+    if((neighbours >= 2) && (weightSum > EPSILON) &&
+       ((visibilityMax - visibilityMin).Max() <= sceneData->areaLightCacheTolerance))
+    {
+        colour *= visibilitySum / weightSum;
+        return;
+    }
+
+    MathColour unshadowed(colour);
+
+    TraceShadowRay(lightsource, depth, lightsourceray, point, colour);
+
+    AreaLightCacheRecord record;
+    record.point = point;
+    record.normal = normal;
+    for(int c = 0; c < MathColour::channels; c++)
+        record.visibility[c] = (unshadowed[c] > EPSILON ? clip(colour[c] / unshadowed[c], 0.0f, 1.0f) : 0.0f);
+
+    if(cache.records.size() < AreaLightCacheSize)
+        cache.records.push_back(record);
+    else
+    {
+        cache.records[cache.next] = record;
+        cache.next = (cache.next + 1) % AreaLightCacheSize;
+    }
+}
+
 // see block_light_source in the v3.6 source
 void Trace::TraceShadowRay(const LightSource &lightsource, double depth, Ray& lightsourceray, const Vector3d& point, MathColour& colour)
 {
@@ -1927,9 +2456,10 @@ void Trace::TraceShadowRay(const LightSource &lightsource, double depth, Ray& li
 // to link the exe, complaining of an unresolved external.
 //
 // TODO: try moving it back in at some point in the future.
-struct NoShadowFlagRayObjectCondition : public RayObjectCondition
+struct NoShadowFlagRayObjectCondition final : public RayObjectCondition
 {
-    virtual bool operator()(const Ray&, ConstObjectPtr object, double) const { return !Test_Flag(object, NO_SHADOW_FLAG); }
+    virtual bool operator()(const Ray&, ConstObjectPtr object, double) const override { return !Test_Flag(object, NO_SHADOW_FLAG); }
+    virtual bool GetFlagMask(const Ray&, unsigned int& mask) const override { mask = NO_SHADOW_FLAG; return true; }
 };
 
 struct SmallToleranceRayObjectCondition : public RayObjectCondition
@@ -1937,6 +2467,11 @@ struct SmallToleranceRayObjectCondition : public RayObjectCondition
     virtual bool operator()(const Ray&, ConstObjectPtr, double dist) const { return dist > SMALL_TOLERANCE; }
 };
 
+struct OpaqueShadowRayObjectCondition : public RayObjectCondition
+{
+    virtual bool operator()(const Ray&, ConstObjectPtr object, double dist) const { return (dist > SHADOW_TOLERANCE) && Test_Flag(object, OPAQUE_FLAG); }
+};
+
 void Trace::TracePointLightShadowRay(const LightSource &lightsource, double& lightsourcedepth, Ray& lightsourceray, MathColour& lightcolour)
 {
     Intersection boundedIntersection;
@@ -1976,32 +2511,55 @@ void Trace::TracePointLightShadowRay(const LightSource &lightsource, double& lig
     NoShadowFlagRayObjectCondition precond;
     SmallToleranceRayObjectCondition postcond;
 
+    // Shadow rays of point lights all end at the light source's centre, and can thus use its light buffer.
+    const ProjectionBuffer *lightBuffer = nullptr;
+
+    if((lightsource.lightGroupLight == false) && !(lightsource.Area_Light && qualityFlags.areaLights) &&
+       (lightsource.index < sceneData->lightBuffers.size()))
+        lightBuffer = sceneData->lightBuffers[lightsource.index];
+
     // check for object in the light source shadow cache (object that fully shadowed during last test) first
 
     if(lightsource.lightGroupLight == false) // we don't cache for light groups
     {
-        if ((lightsourceray.GetTicket().traceLevel == 2) && (lightSourceLevel1ShadowCache[lightsource.index] != nullptr))
-            cacheObject = lightSourceLevel1ShadowCache[lightsource.index];
-        else if (lightSourceOtherShadowCache[lightsource.index] != nullptr)
-            cacheObject = lightSourceOtherShadowCache[lightsource.index];
+        const ShadowCacheEntry *cacheEntry = nullptr;
+
+        if ((lightsourceray.GetTicket().traceLevel == 2) && (lightSourceLevel1ShadowCache[lightsource.index].object != nullptr))
+            cacheEntry = &lightSourceLevel1ShadowCache[lightsource.index];
+        else if (lightSourceOtherShadowCache[lightsource.index].object != nullptr)
+            cacheEntry = &lightSourceOtherShadowCache[lightsource.index];
 
         // if there was an object in the light source shadow cache, check that first
-        if (cacheObject != nullptr)
+        if (cacheEntry != nullptr)
         {
-            if(FindIntersection(cacheObject, boundedIntersection, lightsourceray, lightsourcedepth - projectedDepth) == true)
+            threadData->Stats()[Shadow_Cache_Tests]++;
+
+            cacheObject = cacheEntry->object;
+
+            if(FindIntersection(*cacheEntry, boundedIntersection, lightsourceray, lightsourcedepth - projectedDepth) == true)
             {
                 if(!Test_Flag(boundedIntersection.Object, NO_SHADOW_FLAG))
                 {
-                    ComputeShadowColour(lightsource, boundedIntersection, lightsourceray, lightcolour);
+                    MathColour cachedColour(lightcolour);
+
+                    ComputeShadowColour(lightsource, boundedIntersection, lightsourceray, cachedColour);
 
-                    if(lightcolour.IsNearZero(EPSILON) &&
+                    if(cachedColour.IsNearZero(EPSILON) &&
                        (Test_Flag(boundedIntersection.Object, OPAQUE_FLAG)))
                     {
+                        lightcolour = cachedColour;
                         threadData->Stats()[Shadow_Ray_Tests]++;
                         threadData->Stats()[Shadow_Rays_Succeeded]++;
                         threadData->Stats()[Shadow_Cache_Hits]++;
                         return;
                     }
+
+                    // Having tested only part of an instance, we can't skip the rest of it later on;
+                    // so we'll discard the result and test the instance in full.
+                    if(cacheEntry->component == nullptr)
+                        lightcolour = cachedColour;
+                    else
+                        cacheObject = nullptr;
                 }
                 else
                     cacheObject = nullptr;
@@ -2011,6 +2569,53 @@ void Trace::TracePointLightShadowRay(const LightSource &lightsource, double& lig
         }
     }
 
+    // Unless the shadow cache has already given us a candidate, first look for any opaque object
+    // between the point and the light source, which suffices to prove full shadow regardless of
+    // what else lies along the ray. Only if some object was found but none of them was proven
+    // opaque do we need to walk the intersections in order to accumulate filtered light.
+
+    bool probed = false;
+
+    if((cacheObject == nullptr) && qualityFlags.shadows)
+    {
+        OpaqueShadowRayObjectCondition opaquecond;
+
+        boundedIntersection.Object = boundedIntersection.Csg = nullptr;
+
+        threadData->Stats()[Shadow_Ray_Tests]++;
+        probed = true;
+
+        double maxDepth = min(lightsourcedepth - SHADOW_TOLERANCE, lightsourcedepth - projectedDepth);
+
+        if(lightBuffer != nullptr)
+            foundIntersection = FindAnyLightBufferIntersection(*lightBuffer, lightsourcedepth, boundedIntersection, lightsourceray, maxDepth,
+                                                               precond, postcond, opaquecond);
+        else
+            foundIntersection = FindAnyIntersection(boundedIntersection, lightsourceray, maxDepth, precond, postcond, opaquecond);
+
+        if(foundIntersection == false)
+            // No intersections in the direction of the ray.
+            return;
+
+        if(opaquecond(lightsourceray, boundedIntersection.Object, boundedIntersection.Depth))
+        {
+            threadData->Stats()[Shadow_Rays_Succeeded]++;
+
+            lightcolour.Clear();
+
+            ObjectPtr testObject(boundedIntersection.Csg != nullptr ? boundedIntersection.Csg : boundedIntersection.Object);
+
+            if((lightsource.lightGroupLight == false) && (Test_Flag(testObject, OPAQUE_FLAG)))
+            {
+                if(lightsourceray.GetTicket().traceLevel == 2)
+                    lightSourceLevel1ShadowCache[lightsource.index] = ShadowCacheEntry(boundedIntersection);
+                else
+                    lightSourceOtherShadowCache[lightsource.index] = ShadowCacheEntry(boundedIntersection);
+            }
+            return;
+        }
+    }
+
     foundTransparentObjects = false;
 
     while(true)
@@ -2018,9 +2623,16 @@ void Trace::TracePointLightShadowRay(const LightSource &lightsource, double& lig
         boundedIntersection.Object = boundedIntersection.Csg = nullptr;
         boundedIntersection.Depth = lightsourcedepth - projectedDepth;
 
-        threadData->Stats()[Shadow_Ray_Tests]++;
+        // the probe above has already counted the first test of this ray
+        if(probed)
+            probed = false;
+        else
+            threadData->Stats()[Shadow_Ray_Tests]++;
 
-        foundIntersection = FindIntersection(boundedIntersection, lightsourceray, precond, postcond);
+        if(lightBuffer != nullptr)
+            foundIntersection = FindLightBufferIntersection(*lightBuffer, lightsourcedepth, boundedIntersection, lightsourceray, precond, postcond);
+        else
+            foundIntersection = FindIntersection(boundedIntersection, lightsourceray, precond, postcond);
 
         if((foundIntersection == true) && (boundedIntersection.Object != cacheObject) &&
            (boundedIntersection.Depth < lightsourcedepth - SHADOW_TOLERANCE) &&
@@ -2044,9 +2656,9 @@ void Trace::TracePointLightShadowRay(const LightSource &lightsource, double& lig
                     cacheObject = testObject;
 
                     if(lightsourceray.GetTicket().traceLevel == 2)
-                        lightSourceLevel1ShadowCache[lightsource.index] = cacheObject;
+                        lightSourceLevel1ShadowCache[lightsource.index] = ShadowCacheEntry(boundedIntersection);
                     else
-                        lightSourceOtherShadowCache[lightsource.index] = cacheObject;
+                        lightSourceOtherShadowCache[lightsource.index] = ShadowCacheEntry(boundedIntersection);
                 }
                 break;
             }
@@ -2084,6 +2696,8 @@ void Trace::TraceAreaLightShadowRay(const LightSource &lightsource, double& ligh
     for(size_t ind = 0; ind < lightGrid.size(); ++ind)
         lightGrid[ind].Invalidate();
 
+    lightGridJitter = SelectJitterPattern(lightsource);
+
     axis1Temp = lightsource.Axis1;
     axis2Temp = lightsource.Axis2;
 
@@ -2149,7 +2763,12 @@ void Trace::TraceAreaLightSubsetShadowRay(const LightSource &lightsource, double
             jitter_u = (double)u;
             jitter_v = (double)v;
 
-            if(lightsource.Jitter)
+            if(lightGridJitter != nullptr)
+            {
+                jitter_u += lightGridJitter[u * lightsource.Area_Size2 + v][X];
+                jitter_v += lightGridJitter[u * lightsource.Area_Size2 + v][Y];
+            }
+            else if(lightsource.Jitter)
             {
                 jitter_u += randomNumberGenerator() - 0.5;
                 jitter_v += randomNumberGenerator() - 0.5;
@@ -2202,9 +2821,32 @@ void Trace::TraceAreaLightSubsetShadowRay(const LightSource &lightsource, double
         }
     }
 
+    int adaptiveLevel = lightsource.Adaptive_Level;
+
+    if((level == 0) && (lightsource.Area_Sampling == AREA_SAMPLING_STRATIFIED) &&
+       (lightsource.lightGroupLight == false) && (lightsourceray.GetTicket().traceLevel == 2))
+    {
+        // If the corners agree that the light is either fully visible or fully occluded, and they did so for the
+        // previous point as well, trust that the shadow has no smaller features in between, and skip the
+        // subdivision that `adaptive` would otherwise force.
+
+        bool visible = true;
+        bool occluded = true;
+        for(i = 0; i < 4; i++)
+        {
+            visible  = visible  && (ColourDistance(sample_Colour[i], lightcolour) <= 0.1);
+            occluded = occluded && (ColourDistance(sample_Colour[i], MathColour(0.0)) <= 0.1);
+        }
+
+        AreaLightVisibility visibility = (visible ? kAreaLightVisible : (occluded ? kAreaLightOccluded : kAreaLightPenumbra));
+        if((visibility != kAreaLightPenumbra) && (visibility == areaLightVisibility[lightsource.index]))
+            adaptiveLevel = 0;
+        areaLightVisibility[lightsource.index] = visibility;
+    }
+
     if((u2 - u1 > 1) || (v2 - v1 > 1))
     {
-        if((level < lightsource.Adaptive_Level) ||
+        if((level < adaptiveLevel) ||
            (ColourDistance(sample_Colour[0], sample_Colour[1]) > 0.1) ||
            (ColourDistance(sample_Colour[1], sample_Colour[3]) > 0.1) ||
            (ColourDistance(sample_Colour[3], sample_Colour[2]) > 0.1) ||
@@ -2259,6 +2901,28 @@ void Trace::TraceAreaLightSubsetShadowRay(const LightSource &lightsource, double
     lightcolour = (sample_Colour[0] + sample_Colour[1] + sample_Colour[2] + sample_Colour[3]) * 0.25;
 }
 
+const Vector2d *Trace::SelectJitterPattern(const LightSource &lightsource)
+{
+    if(!lightsource.Jitter)
+        return nullptr;
+
+    if(sceneData->samplingMethod == kSamplingMethod_Sobol)
+    {
+        ScrambledSobolSampleSet set = threadData->sampler.NewSet(kSamplerStream_AreaLight);
+        unsigned int points = lightsource.Area_Size1 * lightsource.Area_Size2;
+        lightGridSamples.resize(points);
+        for(unsigned int i = 0; i < points; i++)
+            lightGridSamples[i] = set.Get2d(i) - 0.5;
+        return &lightGridSamples[0];
+    }
+
+    if(lightsource.Jitter_Patterns.empty())
+        return nullptr;
+
+    int pattern = min(int(randomNumberGenerator() * AREA_LIGHT_JITTER_PATTERNS), AREA_LIGHT_JITTER_PATTERNS - 1);
+    return &lightsource.Jitter_Patterns[pattern * lightsource.Area_Size1 * lightsource.Area_Size2];
+}
+
 // see filter_shadow_ray in v3.6's lighting.cpp
 void Trace::ComputeShadowColour(const LightSource &lightsource, Intersection& isect, Ray& lightsourceray, MathColour& colour)
 {
@@ -2314,6 +2978,9 @@ void Trace::ComputeShadowColour(const LightSource &lightsource, Intersection& is
         return;
     }
 
+    // Pattern values computed for any previous intersection are no longer valid.
+    threadData->mPatternMemo.NewGeneration();
+
     // Get the normal to the surface
     isect.Object->Normal(raw_Normal, &isect, threadData);
 
@@ -2833,31 +3500,21 @@ void Trace::ComputeSky(const Ray& ray, MathColour& colour, ColourChannel& transm
         double att;
         MathColour col;
         TransColour col_Temp;
-        Vector3d p;
 
         col.Clear();
 
         if (sceneData->skysphere != nullptr)
         {
-            // Transform point on unit sphere.
-            if (sceneData->skysphere->Trans != nullptr)
-                MInvTransPoint(p, ray.Direction, sceneData->skysphere->Trans);
+            const SkysphereMap *map = sceneData->skysphere->Map.get();
+
+            // the sky seen directly (or through refraction) is evaluated exactly; reflections and
+            // radiosity samples may use the baked map, the latter at the level matching the sample spacing
+            if ((map != nullptr) && ray.IsRadiosityRay() && (sceneData->radiositySettings.count > 0))
+                map->Evaluate(ray.Direction, map->LevelForAngle(sqrt(TWO_M_PI / sceneData->radiositySettings.count)), col, filCol);
+            else if ((map != nullptr) && ray.IsReflectionRay())
+                map->Evaluate(ray.Direction, 0, col, filCol);
             else
-                p = ray.Direction;
-
-            // TODO - Reverse iterator may be less performant than forward iterator; we might want to
-            //        compare performance with using forward iterators and decrement, or using random access.
-            //        Alternatively, reversing the vector after parsing might be another option.
-            for(vector<PIGMENT*>::const_reverse_iterator i = sceneData->skysphere->Pigments.rbegin(); i != sceneData->skysphere->Pigments.rend(); ++ i)
-            {
-                // Compute sky colour from colour map.
-                Compute_Pigment(col_Temp, *i, p, nullptr, nullptr, threadData);
-
-                att = col_Temp.Opacity();
-
-                col += col_Temp.colour() * att * filCol * sceneData->skysphere->Emission;
-                filCol *= col_Temp.TransmittedColour();
-            }
+                Evaluate_Skysphere(sceneData->skysphere, ray.Direction, col, filCol, threadData);
         }
 
         // apply background as if it was another sky sphere with uniform pigment
@@ -2938,17 +3595,18 @@ double Trace::ComputeConstantFogDepth(const Ray &ray, double depth, double width
     Vector3d p;
     double k;
 
-    if (fog->Turb != nullptr)
+    // The further away the less influence turbulence has; so little beyond
+    // FOG_TURBULENCE_CUTOFF fog distances that we don't bother.
+    if ((fog->Turb != nullptr) && ((fog->Distance < 0.0) || (width < FOG_TURBULENCE_CUTOFF * fog->Distance)))
     {
         depth += width / 2.0;
 
         p = ray.Evaluate(depth);
         p *= fog->Turb->Turbulence;
 
-        // The further away the less influence turbulence has.
         k = exp(-width / fog->Distance);
 
-        width *= (1.0 - k * min(1.0, Turbulence(p, fog->Turb, sceneData->noiseGenerator) * fog->Turb_Depth));
+        width *= (1.0 - k * min(1.0, ComputeFogTurbulence(p, fog) * fog->Turb_Depth));
     }
 
     return (exp(-width / fog->Distance));
@@ -3019,19 +3677,68 @@ double Trace::ComputeGroundFogDepth(const Ray& ray, double depth, double width,
     }
 
     // Apply turbulence.
-    if (fog->Turb != nullptr)
+    // The further away the less influence turbulence has; so little beyond
+    // FOG_TURBULENCE_CUTOFF fog distances that we don't bother.
+    if ((fog->Turb != nullptr) && ((fog->Distance < 0.0) || (width < FOG_TURBULENCE_CUTOFF * fog->Distance)))
     {
         p = (p1 + p2) * 0.5;
         p *= fog->Turb->Turbulence;
 
-        // The further away the less influence turbulence has.
         k = exp(-width / fog->Distance);
-        width *= (1.0 - k * min(1.0, Turbulence(p, fog->Turb, sceneData->noiseGenerator) * fog->Turb_Depth));
+        width *= (1.0 - k * min(1.0, ComputeFogTurbulence(p, fog) * fog->Turb_Depth));
     }
 
     return (exp(-width * fog_density / fog->Distance));
 }
 
+DBL Trace::ComputeFogTurbulence(const Vector3d& p, const FOG *fog)
+{
+    if ((fog->Turb_Grid_Resolution <= 0) || fogTurbulenceCache.empty())
+        return Turbulence(p, fog->Turb, sceneData->noiseGenerator);
+
+    Vector3d g = p * DBL(fog->Turb_Grid_Resolution);
+
+    // lattice coordinates must fit into an int
+    if ((fabs(g[X]) > FOG_TURBULENCE_GRID_LIMIT) || (fabs(g[Y]) > FOG_TURBULENCE_GRID_LIMIT) || (fabs(g[Z]) > FOG_TURBULENCE_GRID_LIMIT))
+        return Turbulence(p, fog->Turb, sceneData->noiseGenerator);
+
+    int x0 = int(floor(g[X]));
+    int y0 = int(floor(g[Y]));
+    int z0 = int(floor(g[Z]));
+    DBL fx = g[X] - x0;
+    DBL fy = g[Y] - y0;
+    DBL fz = g[Z] - z0;
+    DBL corner[8];
+
+    for (int i = 0; i < 8; i++)
+    {
+        int x = x0 + (i & 1);
+        int y = y0 + ((i >> 1) & 1);
+        int z = z0 + ((i >> 2) & 1);
+        FogTurbulenceCacheEntry& entry = fogTurbulenceCache[((unsigned int)x * 73856093u ^ (unsigned int)y * 19349663u ^ (unsigned int)z * 83492791u) & (FogTurbulenceCacheSize - 1)];
+
+        if ((entry.fog != fog) || (entry.x != x) || (entry.y != y) || (entry.z != z))
+        {
+            entry.fog = fog;
+            entry.x = x;
+            entry.y = y;
+            entry.z = z;
+            entry.value = Turbulence(Vector3d(x, y, z) / DBL(fog->Turb_Grid_Resolution), fog->Turb, sceneData->noiseGenerator);
+        }
+
+        corner[i] = entry.value;
+    }
+
+    // trilinear interpolation
+    DBL c00 = corner[0] + (corner[1] - corner[0]) * fx;
+    DBL c10 = corner[2] + (corner[3] - corner[2]) * fx;
+    DBL c01 = corner[4] + (corner[5] - corner[4]) * fx;
+    DBL c11 = corner[6] + (corner[7] - corner[6]) * fx;
+    DBL c0  = c00 + (c10 - c00) * fy;
+    DBL c1  = c01 + (c11 - c01) * fy;
+    return c0 + (c1 - c0) * fz;
+}
+
 void Trace::ComputeShadowMedia(Ray& light_source_ray, Intersection& isect, MathColour& resultcolour, bool media_attenuation_and_interaction)
 {
     if(resultcolour.IsNearZero(EPSILON))
@@ -3484,6 +4191,169 @@ void Trace::ComputeSingleScatteringContribution(const Intersection& out, double
     // TODO FIXME - radiosity should also be taken into account
 }
 
+const SubsurfacePointCloud* Trace::GetSubsurfacePointCloud(const Interior *interior, TraceTicket& ticket)
+{
+    std::map<const Interior*, const SubsurfacePointCloud*>::const_iterator i = ssltPointClouds.find(interior);
+    if (i != ssltPointClouds.end())
+        return i->second;
+
+    const SubsurfacePointCloud* pointCloud = sceneData->subsurfacePointClouds.Get(interior,
+        boost::bind(&Trace::ComputeSubsurfacePointCloud, this, interior, _1, boost::ref(ticket)));
+
+    // a null pointer indicates that we're in the middle of building this very point cloud,
+    // so it will be available to us later; don't cache that
+    if (pointCloud != nullptr)
+        ssltPointClouds[interior] = pointCloud;
+
+    return pointCloud;
+}
+
+bool Trace::UsesSSLTInterior(ConstObjectPtr object, const Interior *interior)
+{
+    if (object->interior.get() == interior)
+        return true;
+
+    if (Test_Flag(object, IS_COMPOUND_OBJECT))
+    {
+        const vector<ObjectPtr>& children = static_cast<const CompoundObject*>(object)->children;
+        for (vector<ObjectPtr>::const_iterator i = children.begin(); i != children.end(); ++i)
+        {
+            if (UsesSSLTInterior(*i, interior))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+void Trace::ComputeSubsurfacePointCloud(const Interior *interior, vector<SubsurfacePointCloud::Point>& points, TraceTicket& ticket)
+{
+    // collect all top-level objects made of the material
+    vector<ObjectPtr> objects;
+    for (vector<ObjectPtr>::const_iterator i = sceneData->objects.begin(); i != sceneData->objects.end(); ++i)
+    {
+        if (UsesSSLTInterior(*i, interior))
+            objects.push_back(*i);
+    }
+    if (objects.empty())
+        return;
+
+    Vector3d lowerLeft(BOUND_HUGE);
+    Vector3d upperRight(-BOUND_HUGE);
+    for (vector<ObjectPtr>::const_iterator i = objects.begin(); i != objects.end(); ++i)
+    {
+        for (int j = X; j <= Z; j++)
+        {
+            lowerLeft[j]  = min(lowerLeft[j],  (double)(*i)->BBox.lowerLeft[j]);
+            upperRight[j] = max(upperRight[j], (double)((*i)->BBox.lowerLeft[j] + (*i)->BBox.size[j]));
+        }
+    }
+
+    // an object without proper bounds can't be covered evenly with points; leave it to the probe rays
+    Vector3d centre = (lowerLeft + upperRight) * 0.5;
+    double radius = (upperRight - lowerLeft).length() * 0.5;
+    if ((radius <= 0.0) || (radius >= CRITICAL_LENGTH))
+        return;
+
+    double eta = interior->IOR / sceneData->atmosphereIOR;
+
+    // Distribute the points by intersecting the surfaces with a set of uniformly distributed lines through
+    // the bounding sphere; by the Cauchy-Crofton formula, each line will hit a surface of area A within the
+    // sphere A/(2*pi*r^2) times on average, so each hit represents the same fraction of the total area.
+    int count = sceneData->subsurfacePointCount;
+    double pointArea = 2.0 * M_PI * Sqr(radius) / count * Sqr(sceneData->mmPerUnit);
+    SequentialVectorGeneratorPtr directionGenerator(GetSubRandomDirectionGenerator(0, count));
+    SequentialVector2dGeneratorPtr offsetGenerator(GetSubRandomOnDiscGenerator(2, radius, count));
+
+    for (int n = 0; n < count; n++)
+    {
+        Vector3d direction = (*directionGenerator)();
+        Vector2d offset = (*offsetGenerator)();
+        Vector3d axisU, axisV;
+        ComputeSurfaceTangents(direction, axisU, axisV);
+        Ray ray(ticket, centre + axisU * offset.x() + axisV * offset.y() - direction * (2.0 * radius), direction, Ray::SubsurfaceRay);
+
+        for (vector<ObjectPtr>::const_iterator i = objects.begin(); i != objects.end(); ++i)
+        {
+            IStack depthstack(stackPool);
+            POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+
+            if ((*i)->All_Intersections(ray, depthstack, threadData))
+            {
+                while (depthstack->size() > 0)
+                {
+                    Intersection isect = depthstack->top();
+                    depthstack->pop();
+
+                    if ((isect.Object == nullptr) || (isect.Object->interior.get() != interior))
+                        continue;
+
+                    ComputeSSLTNormal(isect);
+
+                    SubsurfacePointCloud::Point point;
+                    point.position = isect.IPoint;
+                    point.area = pointArea;
+
+                    // global light sources, if not turned off for this object
+                    if (!Test_Flag(*i, NO_GLOBAL_LIGHTS_FLAG))
+                    {
+                        for (int k = 0; k < threadData->lightSources.size(); k++)
+                            ComputeSubsurfaceIrradiance(*threadData->lightSources[k], isect.IPoint, isect.INormal, eta, point.irradiance, ticket);
+                    }
+
+                    // local light sources from a light group, if any
+                    for (int k = 0; k < (*i)->LLights.size(); k++)
+                        ComputeSubsurfaceIrradiance(*(*i)->LLights[k], isect.IPoint, isect.INormal, eta, point.irradiance, ticket);
+
+                    // radiosity-alike ambient illumination
+                    if ((sceneData->radiositySettings.radiosityEnabled == true) &&
+                        (sceneData->subsurfaceUseRadiosity == true) &&
+                        (Test_Flag(*i, IGNORE_RADIOSITY_FLAG) == false))
+                    {
+                        MathColour ambientcolour;
+                        // TODO FIXME - should support pertubed normals
+                        radiosity.ComputeAmbient(isect.IPoint, isect.INormal, isect.INormal, 1.0 /* TODO - brilliance */, ambientcolour, 1.0, ticket);
+                        // Note: radiosity data is already cosine-weighted, so we're using the surface normal as incident light direction
+                        point.irradiance += ambientcolour * ComputeFt(0.0, eta);
+                    }
+
+                    points.push_back(point);
+                }
+            }
+
+            POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack is in a cleaned-up condition (again)
+        }
+    }
+}
+
+void Trace::ComputeSubsurfaceIrradiance(const LightSource& lightsource, const Vector3d& point, const Vector3d& normal, double eta, MathColour& irradiance, TraceTicket& ticket)
+{
+    // TODO FIXME - part of this code is very alike to ComputeDiffuseContribution1()
+
+    Ray lightsourceray(ticket);
+    double lightsourcedepth;
+    MathColour lightcolour;
+    ComputeOneLightRay(lightsource, lightsourcedepth, lightsourceray, point, lightcolour, true);
+
+    // Don't calculate spotlights when outside of the light's cone.
+    if(lightcolour.IsNearZero(EPSILON))
+        return;
+
+    // [CLi] light coming in almost parallel to the surface is a problem
+    double cos_in = fabs(dot(normal, lightsourceray.Direction));
+    if(cos_in < EPSILON)
+        return;
+
+    if (qualityFlags.shadows && ((lightsource.Projected_Through_Object != nullptr) || (lightsource.Light_Type != FILL_LIGHT_SOURCE)))
+        TraceShadowRay(lightsource, lightsourcedepth, lightsourceray, point, lightcolour);
+
+    // Don't calculate anything more if we're in full shadow
+    if(lightcolour.IsNearZero(EPSILON))
+        return;
+
+    irradiance += lightcolour * (cos_in * ComputeFt(acos(min(cos_in, 1.0)), eta));
+}
+
 bool Trace::SSLTComputeRefractedDirection(const Vector3d& v, const Vector3d& n, double eta, Vector3d& refracted)
 {
     // Phi: angle between normal and -incoming_ray (REye in this case, since it points to Eye)
@@ -3735,68 +4605,86 @@ void Trace::ComputeSubsurfaceScattering(const FINISH *Finish, const MathColour&
 
     // colour dependent diffuse contribution
 
-    double      sampleArea;
-    double      weight;
-    double      weightSum;
-    double      sigma_a_mean        = sigma_a.Greyscale(); // TODO FIXME - use a "fair" average of all three color channels
-    double      sigma_prime_s_mean  = sigma_prime_s.Greyscale(); // TODO FIXME - use a "fair" average of all three color channels
-    double      sigma_prime_t_mean  = sigma_a_mean + sigma_prime_s_mean;
-    double      sigma_tr_mean_sqr   = sigma_a_mean * sigma_prime_t_mean * 3.0;
-    double      sigma_tr_mean       = sqrt(sigma_tr_mean_sqr);
-    int         trueNumSamples;
-
-    bool radiosity_needed = (sceneData->radiositySettings.radiosityEnabled == true) &&
-                            (sceneData->subsurfaceUseRadiosity == true) &&
-                            (radiosity.CheckRadiosityTraceLevel(Eye.GetTicket()) == true) &&
-                            (Test_Flag(out.Object, IGNORE_RADIOSITY_FLAG) == false);
-
-    Vector3d sampleBase;
-    ComputeDiffuseSampleBase(sampleBase, out, vOut, 1.0 / (sigma_prime_t_mean * sceneData->mmPerUnit), Eye.GetTicket());
-
-    weightSum = 0.0;
-    trueNumSamples = 0;
+    const SubsurfacePointCloud* pointCloud = nullptr;
+    if (sceneData->subsurfaceMethod == SUBSURFACE_METHOD_POINT_CLOUD)
+        pointCloud = GetSubsurfacePointCloud(out.Object->interior.get(), Eye.GetTicket());
 
-    for (int i = 0; i < NumSamplesDiffuse; i++)
+    if ((pointCloud != nullptr) && !pointCloud->IsEmpty())
     {
-        Intersection in;
-        ComputeDiffuseSamplePoint(sampleBase, in, sampleArea, Eye.GetTicket());
-
-        // avoid pathological cases
-        if (sampleArea != 0)
+        // sum up the light diffusing from the precomputed irradiance samples
+        SubsurfacePointCloud::Profile profile(sigma_prime_s, sigma_a, eta);
+        MathColour diffuse;
+        pointCloud->Evaluate(out.IPoint, sceneData->mmPerUnit, profile, sceneData->subsurfaceAccuracy, diffuse);
+        // NOTE: Fresnel transmittance at the point of entry is already accounted for in the samples.
+        double phi_out = acos(clip(dot(vOut, out.INormal), -1.0, 1.0));
+        Total_Colour += diffuse * ComputeFt(phi_out, eta);
+    }
+    else
+    {
+        double      sampleArea;
+        double      weight;
+        double      weightSum;
+        double      sigma_a_mean        = sigma_a.Greyscale(); // TODO FIXME - use a "fair" average of all three color channels
+        double      sigma_prime_s_mean  = sigma_prime_s.Greyscale(); // TODO FIXME - use a "fair" average of all three color channels
+        double      sigma_prime_t_mean  = sigma_a_mean + sigma_prime_s_mean;
+        double      sigma_tr_mean_sqr   = sigma_a_mean * sigma_prime_t_mean * 3.0;
+        double      sigma_tr_mean       = sqrt(sigma_tr_mean_sqr);
+        int         trueNumSamples;
+
+        bool radiosity_needed = (sceneData->radiositySettings.radiosityEnabled == true) &&
+                                (sceneData->subsurfaceUseRadiosity == true) &&
+                                (radiosity.CheckRadiosityTraceLevel(Eye.GetTicket()) == true) &&
+                                (Test_Flag(out.Object, IGNORE_RADIOSITY_FLAG) == false);
+
+        Vector3d sampleBase;
+        ComputeDiffuseSampleBase(sampleBase, out, vOut, 1.0 / (sigma_prime_t_mean * sceneData->mmPerUnit), Eye.GetTicket());
+
+        weightSum = 0.0;
+        trueNumSamples = 0;
+
+        for (int i = 0; i < NumSamplesDiffuse; i++)
         {
-            weight = sampleArea;
-            weightSum += weight;
-            trueNumSamples ++;
+            Intersection in;
+            ComputeDiffuseSamplePoint(sampleBase, in, sampleArea, Eye.GetTicket());
 
-            if (IsSameSSLTObject(in.Object, out.Object))
+            // avoid pathological cases
+            if (sampleArea != 0)
             {
-                // radiosity-alike ambient illumination
-                if (radiosity_needed)
-                    // shoot just one random ray to account for ambient illumination (we're averaging stuff anyway)
-                    ComputeDiffuseAmbientContribution1(out, vOut, in, Total_Colour, sigma_prime_s, sigma_a, eta, weight, Eye.GetTicket());
+                weight = sampleArea;
+                weightSum += weight;
+                trueNumSamples ++;
 
-                // global light sources, if not turned off for this object
-                if((out.Object->Flags & NO_GLOBAL_LIGHTS_FLAG) != NO_GLOBAL_LIGHTS_FLAG)
+                if (IsSameSSLTObject(in.Object, out.Object))
                 {
-                    for(int k = 0; k < threadData->lightSources.size(); k++)
-                        ComputeDiffuseContribution1(*threadData->lightSources[k], out, vOut, in, Total_Colour, sigma_prime_s, sigma_a, eta, weight, Eye.GetTicket());
-                }
+                    // radiosity-alike ambient illumination
+                    if (radiosity_needed)
+                        // shoot just one random ray to account for ambient illumination (we're averaging stuff anyway)
+                        ComputeDiffuseAmbientContribution1(out, vOut, in, Total_Colour, sigma_prime_s, sigma_a, eta, weight, Eye.GetTicket());
 
-                // local light sources from a light group, if any
-                if(!out.Object->LLights.empty())
+                    // global light sources, if not turned off for this object
+                    if((out.Object->Flags & NO_GLOBAL_LIGHTS_FLAG) != NO_GLOBAL_LIGHTS_FLAG)
+                    {
+                        for(int k = 0; k < threadData->lightSources.size(); k++)
+                            ComputeDiffuseContribution1(*threadData->lightSources[k], out, vOut, in, Total_Colour, sigma_prime_s, sigma_a, eta, weight, Eye.GetTicket());
+                    }
+
+                    // local light sources from a light group, if any
+                    if(!out.Object->LLights.empty())
+                    {
+                        for(int k = 0; k < out.Object->LLights.size(); k++)
+                            ComputeDiffuseContribution1(*out.Object->LLights[k], out, vOut, in, Total_Colour, sigma_prime_s, sigma_a, eta, weight, Eye.GetTicket());
+                    }
+                }
+                else
                 {
-                    for(int k = 0; k < out.Object->LLights.size(); k++)
-                        ComputeDiffuseContribution1(*out.Object->LLights[k], out, vOut, in, Total_Colour, sigma_prime_s, sigma_a, eta, weight, Eye.GetTicket());
+                    // TODO - what's the proper thing to do?
                 }
             }
-            else
-            {
-                // TODO - what's the proper thing to do?
-            }
         }
+        if (trueNumSamples > 0)
+            Total_Colour /= trueNumSamples;
+
     }
-    if (trueNumSamples > 0)
-        Total_Colour /= trueNumSamples;
 
 #endif
 
@@ -3846,7 +4734,7 @@ void Trace::ComputeSubsurfaceScattering(const FINISH *Finish, const MathColour&
 
         // TODO FIXME - account for fresnel attenuation at interfaces
         PreciseMathColour att = Exp(-sigma_prime_t * dist); // TODO should be sigma_t
-        weight = att.WeightMax();
+        double weight = att.WeightMax();
         if (weight > Eye.GetTicket().adcBailout)
         {
             if (!found)
@@ -39,9 +39,12 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include <map>
 #include <vector>
 
 #include "core/bounding/bsptree.h"
+#include "core/bounding/flatbvh.h"
+#include "core/lighting/subsurface.h"
 #include "core/math/randomsequence.h"
 #include "core/render/ray.h"
 
@@ -57,13 +60,15 @@ namespace pov
 
 typedef struct Fog_Struct FOG;
 class PhotonGatherer;
+class ProjectionBuffer;
 class SceneData;
 class Task;
 class ViewData;
 
-struct NoSomethingFlagRayObjectCondition : public RayObjectCondition
+struct NoSomethingFlagRayObjectCondition final : public RayObjectCondition
 {
-    virtual bool operator()(const Ray& ray, ConstObjectPtr object, double) const;
+    virtual bool operator()(const Ray& ray, ConstObjectPtr object, double) const override;
+    virtual bool GetFlagMask(const Ray& ray, unsigned int& mask) const override;
 };
 
 struct LitInterval
@@ -115,13 +120,13 @@ struct LightSourceIntersectionEntry
 struct LightSourceEntry
 {
     double s0, s1;
-    LightSource *light;
+    const LightSource *light;
 
     LightSourceEntry() :
         s0(0.0), s1(0.0), light(nullptr) { }
-    LightSourceEntry(LightSource *nlight) :
+    LightSourceEntry(const LightSource *nlight) :
         s0(0.0), s1(0.0), light(nlight) { }
-    LightSourceEntry(double ns0, double ns1, LightSource *nlight) :
+    LightSourceEntry(double ns0, double ns1, const LightSource *nlight) :
         s0(ns0), s1(ns1), light(nlight) { }
 
     bool operator<(const LightSourceEntry& other) const { return (s0 < other.s0); }
@@ -173,6 +178,20 @@ struct TraceTicket
     {}
 };
 
+/// Properties of the first surface hit by a primary ray.
+///
+/// These are recorded alongside the colour of a pixel to guide denoising.
+///
+struct FirstHitFeatures
+{
+    MathColour  albedo; ///< Pigment colour of the surface's top texture layer.
+    Vector3d    normal; ///< Perturbed normal of the surface's top texture layer.
+    double      depth;  ///< Distance of the surface from the ray's origin.
+    bool        found;  ///< Whether any surface was hit at all.
+
+    FirstHitFeatures() : albedo(0.0), normal(0.0), depth(0.0), found(false) {}
+};
+
 
 /// Ray tracing and shading engine.
 ///
@@ -247,8 +266,55 @@ class Trace
         bool FindIntersection(ObjectPtr object, Intersection& isect, const Ray& ray, double closest = HUGE_VAL);
         bool FindIntersection(ObjectPtr object, Intersection& isect, const Ray& ray, const RayObjectCondition& postcondition, double closest = HUGE_VAL);
 
+        /// Find the closest intersections of a packet of coherent rays.
+        ///
+        /// The rays traverse the bounding hierarchy together, each one dropping out of subtrees it
+        /// does not hit closer than its nearest intersection found so far. Where packet traversal
+        /// is not available, the rays are traced one at a time instead.
+        ///
+        /// @param[in,out]  isects          Closest intersection for each ray; the Depth members give the
+        ///                                 search distance on input, and are left unchanged for rays
+        ///                                 not hitting anything.
+        /// @param[in]      rays            Rays to trace.
+        /// @param[in]      count           Number of rays, at most `BBOX_PACKET_SIZE`.
+        /// @return                         Whether any of the rays hit an object.
+        ///
+        bool FindIntersections(Intersection *isects, const Ray *rays, size_t count, const RayObjectCondition& precondition,
+                               const RayObjectCondition& postcondition);
+
+        /// Find any intersection closer than `maxDepth`, stopping as soon as one satisfies `terminate`.
+        ///
+        /// Unlike @ref FindIntersection(), this does not guarantee to return the closest
+        /// intersection; if none satisfying `terminate` is found, `isect` receives one of the
+        /// others found, if any.
+        ///
+        bool FindAnyIntersection(Intersection& isect, const Ray& ray, double maxDepth, const RayObjectCondition& precondition,
+                                 const RayObjectCondition& postcondition, const RayObjectCondition& terminate);
+
+        /// Find the closest intersection of a ray starting at the centre of a vista buffer.
+        bool FindVistaBufferIntersection(const ProjectionBuffer& buffer, Intersection& isect, const Ray& ray,
+                                         const RayObjectCondition& precondition, const RayObjectCondition& postcondition);
+
+        /// Find the closest intersection of a ray ending at the centre of a light buffer.
+        ///
+        /// @param[in]      lightDistance   Distance from the ray's origin to the centre.
+        ///
+        bool FindLightBufferIntersection(const ProjectionBuffer& buffer, double lightDistance, Intersection& isect, const Ray& ray,
+                                         const RayObjectCondition& precondition, const RayObjectCondition& postcondition);
+
+        /// Find any intersection of a ray ending at the centre of a light buffer.
+        ///
+        /// See @ref FindAnyIntersection() for details.
+        ///
+        bool FindAnyLightBufferIntersection(const ProjectionBuffer& buffer, double lightDistance, Intersection& isect, const Ray& ray, double maxDepth,
+                                            const RayObjectCondition& precondition, const RayObjectCondition& postcondition, const RayObjectCondition& terminate);
+
         unsigned int GetHighestTraceLevel();
 
+        /// Change the render quality features to use from now on.
+        ///
+        void SetQualityFlags(const QualityFlags& qf) { qualityFlags = qf; }
+
         bool TestShadow(const LightSource &light, double& depth, Ray& light_source_ray, const Vector3d& p, MathColour& colour); // TODO FIXME - this should not be exposed here
 
     protected: // TODO FIXME - should be private
@@ -291,30 +357,104 @@ class Trace
         /// Current index into lightColorCaches.
         int lightColorCacheIndex;
 
+        /// Structure used to interpolate area light shadows between nearby shading points.
+        struct AreaLightCacheRecord
+        {
+            Vector3d    point;
+            Vector3d    normal;
+            MathColour  visibility; ///< Fraction of the light source's colour reaching the point.
+        };
+
+        /// Recent area light shadow samples of a single light source.
+        struct AreaLightCache
+        {
+            vector<AreaLightCacheRecord>    records;
+            size_t                          next;   ///< Index of the record to be replaced next once full.
+        };
+
+        /// Maximum number of shadow samples kept per light source, enough to cover a row of pixels in a typical render block.
+        static const size_t AreaLightCacheSize = 64;
+
+        /// Recent area light shadow samples, per global light source.
+        vector<AreaLightCache> areaLightCache;
+        /// Render block the contents of areaLightCache pertain to.
+        size_t areaLightCacheBlock;
+
+        /// Turbulence sampled at a lattice vertex of a fog's turbulence grid.
+        struct FogTurbulenceCacheEntry
+        {
+            const FOG * fog;        ///< Fog the sample pertains to, or `nullptr` if unused.
+            int         x, y, z;    ///< Lattice vertex.
+            DBL         value;      ///< Turbulence at the vertex.
+        };
+
+        /// Number of lattice vertices kept in fogTurbulenceCache; must be a power of two.
+        static const size_t FogTurbulenceCacheSize = 4096;
+
+        /// Recently sampled lattice vertices of fogs with a turbulence grid, direct-mapped by a hash of the vertex.
+        vector<FogTurbulenceCacheEntry> fogTurbulenceCache;
+
         /// Scene data.
         shared_ptr<SceneData> sceneData;
 
         /// Maximum trace recursion level found.
         unsigned int maxFoundTraceLevel;
+        /// Closest intersection of the next ray passed to @ref TraceRay(), if already found by
+        /// @ref FindIntersections(), or `nullptr`; the ray has hit nothing if its Object is `nullptr`.
+        const Intersection *packetIntersection;
+        /// Where to record the properties of the first surface hit by a primary ray, or `nullptr`.
+        FirstHitFeatures *firstHitFeatures;
         /// Various quality-related flags.
         QualityFlags qualityFlags;
 
-        /// Bounding slabs priority queue.
-        BBoxPriorityQueue priorityQueue;
+        /// Bounding slabs traversal stack.
+        BBoxTraversalStack bboxStack;
+        /// Bounding slabs traversal stack for ray packets.
+        BBoxPacketStack bboxPacketStack;
+        /// Flattened bounding hierarchy traversal stack.
+        FlatBVH::TraversalStack flatBVHStack;
         /// BSP tree mailbox.
         BSPTree::Mailbox mailbox;
         /// Area light grid buffer.
         vector<MathColour> lightGrid;
+        /// Jitter pattern for the area light grid currently being sampled, or `nullptr` to jitter randomly.
+        const Vector2d *lightGridJitter;
+        /// Jitter offsets for an area light grid, drawn from the low-discrepancy sampler.
+        vector<Vector2d> lightGridSamples;
+
+        /// Visibility of an area light as seen from the corners of its grid.
+        enum AreaLightVisibility
+        {
+            kAreaLightPenumbra = 0, ///< Partially occluded, or not known.
+            kAreaLightVisible,      ///< Unoccluded from all corners.
+            kAreaLightOccluded      ///< Fully occluded from all corners.
+        };
+        /// Visibility of each area light from the previous first trace level intersection tested against it.
+        vector<unsigned char> areaLightVisibility;
         /// Fast stack pool.
         IStackPool stackPool;
         /// Fast texture list pool.
         TextureVectorPool texturePool;
         /// Fast WNRX list pool.
         WNRXVectorPool wnrxPool;
+        /// Object that fully shadowed a light source during the last shadow test against it.
+        struct ShadowCacheEntry
+        {
+            /// Occluding object, or `nullptr` if none.
+            ObjectPtr object;
+            /// Component of an instance's prototype to re-test, or `nullptr` to re-test the entire object.
+            ObjectPtr component;
+
+            ShadowCacheEntry() : object(nullptr), component(nullptr) {}
+            ShadowCacheEntry(const Intersection& isect);
+        };
+
+        bool FindIntersection(const ShadowCacheEntry& entry, Intersection& isect, const Ray& ray, double closest);
+
         /// Light source shadow cache for shadow tests of first trace level intersections.
-        vector<ObjectPtr> lightSourceLevel1ShadowCache;
+        vector<ShadowCacheEntry> lightSourceLevel1ShadowCache;
         /// Light source shadow cache for shadow tests of higher trace level intersections.
-        vector<ObjectPtr> lightSourceOtherShadowCache;
+        vector<ShadowCacheEntry> lightSourceOtherShadowCache;
         /// `crand` random number generator.
         unsigned int crandRandomNumberGenerator;
         /// Pseudo-random number sequence.
@@ -327,6 +467,8 @@ class Trace
         vector<SequentialDoubleGeneratorPtr> ssltUniformNumberGenerator;
         /// Sub-random cos-weighted 3d points on hemisphere sequence.
         vector<SequentialVectorGeneratorPtr> ssltCosWeightedDirectionGenerator;
+        /// Subsurface scattering irradiance point clouds already looked up by this thread.
+        std::map<const Interior*, const SubsurfacePointCloud*> ssltPointClouds;
         /// Thread data.
         TraceThreadData *threadData;
 
@@ -570,11 +712,28 @@ class Trace
                                 const Vector3d& ipoint, MathColour& lightcolour, bool forceAttenuate = false);
 
         void TraceShadowRay(const LightSource &light, double depth, Ray& lightsourceray, const Vector3d& point, MathColour& colour);
+
+        /// Trace a shadow ray, or interpolate the result from nearby shadow rays traced earlier in the same render
+        /// block if they are in sufficient agreement. Only area lights at the first trace level are interpolated.
+        ///
+        /// @param[in]      lightsource         Light source.
+        /// @param[in]      depth               Distance to the light source.
+        /// @param[in,out]  lightsourceray      Ray to the light source.
+        /// @param[in]      point               Intersection point.
+        /// @param[in]      normal              Surface normal at the intersection point.
+        /// @param[in,out]  colour              Unshadowed brightness on input, shadowed brightness on output.
+        ///
+        void TraceCachedShadowRay(const LightSource &lightsource, double depth, Ray& lightsourceray, const Vector3d& point,
+                                  const Vector3d& normal, MathColour& colour);
         void TracePointLightShadowRay(const LightSource &lightsource, double& lightsourcedepth, Ray& lightsourceray, MathColour& lightcolour);
         void TraceAreaLightShadowRay(const LightSource &lightsource, double& lightsourcedepth, Ray& lightsourceray,
                                      const Vector3d& ipoint, MathColour& lightcolour);
         void TraceAreaLightSubsetShadowRay(const LightSource &lightsource, double& lightsourcedepth, Ray& lightsourceray,
                                            const Vector3d& ipoint, MathColour& lightcolour, int u1, int  v1, int  u2, int  v2, int level, const Vector3d& axis1, const Vector3d& axis2);
+        /// Pick one of an area light's precomputed jitter patterns at random.
+        /// With the low-discrepancy sampler, generate a fresh pattern instead.
+        /// @return     The selected pattern, or `nullptr` if the area light uses random jitter.
+        const Vector2d *SelectJitterPattern(const LightSource &lightsource);
 
         /// Compute the filtering effect of an object on incident light from a particular light source.
         ///
@@ -760,6 +919,14 @@ class Trace
         void ComputeFog(const Ray& ray, const Intersection& isect, MathColour& colour, ColourChannel& transm);
         double ComputeConstantFogDepth(const Ray &ray, double depth, double width, const FOG *fog);
         double ComputeGroundFogDepth(const Ray& ray, double depth, double width, const FOG *fog);
+
+        /// Compute a fog's turbulence, interpolating it from the fog's turbulence grid if it has one.
+        ///
+        /// @param[in]      p               Point in turbulence space.
+        /// @param[in]      fog             Fog with turbulence.
+        /// @return                         Turbulence at the point.
+        ///
+        DBL ComputeFogTurbulence(const Vector3d& p, const FOG *fog);
         void ComputeRainbow(const Ray& ray, const Intersection& isect, MathColour& colour, ColourChannel& transm);
 
         /// Compute media effect on traversing light rays.
@@ -809,6 +976,10 @@ class Trace
         void ComputeSingleScatteringContribution(const Intersection& out, double dist, double theta_out, double cos_out_prime, const Vector3d& refractedREye, double sigma_t_xo, double sigma_s, MathColour& Lo, double eta, TraceTicket& ticket);
         void ComputeSubsurfaceScattering (const FINISH *Finish, const MathColour& layer_pigment_colour, const Intersection& isect, Ray& Eye, const Vector3d& Layer_Normal, MathColour& colour, double Attenuation);
         bool SSLTComputeRefractedDirection(const Vector3d& v, const Vector3d& n, double eta, Vector3d& refracted);
+        const SubsurfacePointCloud* GetSubsurfacePointCloud(const Interior *interior, TraceTicket& ticket);
+        void ComputeSubsurfacePointCloud(const Interior *interior, vector<SubsurfacePointCloud::Point>& points, TraceTicket& ticket);
+        bool UsesSSLTInterior(ConstObjectPtr object, const Interior *interior);
+        void ComputeSubsurfaceIrradiance(const LightSource& lightsource, const Vector3d& point, const Vector3d& normal, double eta, MathColour& irradiance, TraceTicket& ticket);
 
     ///
     /// @}
@@ -45,6 +45,7 @@
 
 #include <boost/scoped_array.hpp>
 
+#include "core/bounding/flatbvh.h"
 #include "core/material/normal.h"
 #include "core/material/pigment.h"
 #include "core/math/chi2.h"
@@ -54,6 +55,7 @@
 #include "core/render/trace.h"
 #include "core/scene/object.h"
 #include "core/scene/scenedata.h"
+#include "core/scene/tracethreaddata.h"
 #include "core/shape/mesh.h"
 
 // this must be the last file included
@@ -62,11 +64,7 @@
 namespace pov
 {
 
-#ifdef DYNAMIC_HASHTABLE
-extern unsigned short *hashTable; // GLOBAL VARIABLE
-#else
-extern ALIGN16 unsigned short hashTable[]; // GLOBAL VARIABLE
-#endif
+extern const unsigned short hashTable[]; // defined in core/material/noisetables.cpp
 
 const int Grid1Size    = 4;
 const int HexGrid2Size = 7;
@@ -76,6 +74,12 @@ const int HexGrid4Size = 37;
 // Grid size (n x n) used while jittering focal blur sub-pixel position.
 const int SUB_PIXEL_GRID_SIZE = 16;
 
+// Number of samples after which a pixel may be found to be in focus, in adaptive focal blur mode.
+const int FOCAL_BLUR_IN_FOCUS_SAMPLES = 4;
+
+// Largest circle of confusion, in pixels, for a pixel to count as being in focus.
+const float FOCAL_BLUR_IN_FOCUS_COC = 0.5f;
+
 static const Vector2d Grid1[Grid1Size] =
 {
     Vector2d(-0.25,  0.25),
@@ -180,18 +184,137 @@ inline int PseudoRandom(int v)
 }
 
 
-bool HasInteriorPointObjectCondition::operator()(const Vector3d& point, ConstObjectPtr object) const
+
+// Minimum cosine of the angle between the diagonally opposite entries interpolated by a lookup;
+// anything wider suggests a discontinuity of the camera's projection between them.
+const DBL kCameraRayTableMinCosine = 0.99;
+
+bool CameraRayTable::Setup(const Camera& camera, unsigned int width, unsigned int height)
+{
+    bool suitable = false;
+    bool varyingOrigin = false;
+
+    // focal blur and camera normals perturb each ray individually, so interpolation would not do
+    if ((camera.Tnormal == nullptr) && ((camera.Aperture == 0.0) || (camera.Blur_Samples <= 0)))
+    {
+        switch (camera.Type)
+        {
+            case FISHEYE_CAMERA:
+            case OMNIMAX_CAMERA:
+            case PANORAMIC_CAMERA:
+            case ULTRA_WIDE_ANGLE_CAMERA:
+            case CYL_1_CAMERA:
+            case CYL_2_CAMERA:
+            case SPHERICAL_CAMERA:
+                suitable = true;
+                break;
+            case CYL_3_CAMERA:
+            case CYL_4_CAMERA:
+            case USER_DEFINED_CAMERA:
+                suitable = true;
+                varyingOrigin = true;
+                break;
+            case MESH_CAMERA:
+                // the other distribution methods look up their faces directly rather than searching for them,
+                // and pick a different face for each ray of a pixel
+                suitable = (camera.Face_Distribution_Method == 3);
+                varyingOrigin = true;
+                break;
+            default:
+                // the rays of the perspective and orthographic cameras are cheaper to compute than to look up
+                break;
+        }
+    }
+
+    if (!suitable)
+    {
+        imageWidth = imageHeight = columns = rows = 0;
+        vector<SnglVector3d>().swap(directions);
+        vector<Vector3d>().swap(origins);
+        vector<POV_UINT32>().swap(patches);
+        return false;
+    }
+
+    imageWidth = width;
+    imageHeight = height;
+    columns = width + 2;
+    rows = height + 2;
+    size_t entries = size_t(columns) * size_t(rows);
+    directions.assign(entries, SnglVector3d(0.0f));
+    patches.assign(entries, kNoRayPatch);
+    if (varyingOrigin)
+        origins.assign(entries, Vector3d(0.0));
+    else
+        vector<Vector3d>().swap(origins);
+    return true;
+}
+
+void CameraRayTable::Set(unsigned int column, unsigned int row, const Ray& ray, POV_UINT32 patch)
 {
-    return object->interior != nullptr;
+    size_t index = size_t(row) * columns + column;
+    directions[index] = SnglVector3d(ray.Direction);
+    patches[index] = patch;
+    if (!origins.empty())
+        origins[index] = ray.Origin;
 }
 
-bool ContainingInteriorsPointObjectCondition::operator()(const Vector3d& point, ConstObjectPtr object) const
+CameraRayTable::Result CameraRayTable::Lookup(DBL x, DBL y, DBL width, DBL height, Ray& ray) const
 {
-    containingInteriors.push_back(object->interior.get());
-    return true;
+    if ((width != DBL(imageWidth)) || (height != DBL(imageHeight)))
+        return kMiss;
+
+    // Position in units of entries; the comparisons are phrased so as to also reject NaNs.
+    DBL u = x + 0.5;
+    DBL v = y + 0.5;
+    if (!((u >= 0.0) && (u < DBL(columns)) && (v >= 0.0) && (v < DBL(rows))))
+        return kMiss;
+
+    unsigned int column = (unsigned int)u;
+    unsigned int row = (unsigned int)v;
+    DBL fu = u - column;
+    DBL fv = v - row;
+    size_t i00 = size_t(row) * columns + column;
+
+    // Pixel centres, as traced without anti-aliasing, hit an entry exactly.
+    if ((fu == 0.0) && (fv == 0.0))
+    {
+        if (patches[i00] == kNoRayPatch)
+            return kNoRay;
+        ray.Direction = Vector3d(directions[i00]).normalized();
+        if (!origins.empty())
+            ray.Origin = origins[i00];
+        return kHit;
+    }
+
+    if ((column + 1 >= columns) || (row + 1 >= rows))
+        return kMiss;
+
+    size_t i10 = i00 + 1;
+    size_t i01 = i00 + columns;
+    size_t i11 = i01 + 1;
+    POV_UINT32 patch = patches[i00];
+    if ((patch == kNoRayPatch) || (patches[i10] != patch) || (patches[i01] != patch) || (patches[i11] != patch))
+        return kMiss;
+
+    Vector3d d00(directions[i00]);
+    Vector3d d10(directions[i10]);
+    Vector3d d01(directions[i01]);
+    Vector3d d11(directions[i11]);
+    if ((dot(d00, d11) < kCameraRayTableMinCosine) || (dot(d10, d01) < kCameraRayTableMinCosine))
+        return kMiss;
+
+    DBL w00 = (1.0 - fu) * (1.0 - fv);
+    DBL w10 = fu * (1.0 - fv);
+    DBL w01 = (1.0 - fu) * fv;
+    DBL w11 = fu * fv;
+    ray.Direction = (w00 * d00 + w10 * d10 + w01 * d01 + w11 * d11).normalized();
+    if (!origins.empty())
+        ray.Origin = w00 * origins[i00] + w10 * origins[i10] + w01 * origins[i01] + w11 * origins[i11];
+    return kHit;
 }
 
 
+
 TracePixel::TracePixel(shared_ptr<SceneData> sd, const Camera* cam, TraceThreadData *td, unsigned int mtl, DBL adcb, const QualityFlags& qf,
                        CooperateFunctor& cf, MediaFunctor& mf, RadiosityFunctor& af, bool pt) :
                        Trace(sd, td, qf, cf, mf, af),
@@ -200,8 +323,16 @@ TracePixel::TracePixel(shared_ptr<SceneData> sd, const Camera* cam, TraceThreadD
                        focalBlurData(nullptr),
                        maxTraceLevel(mtl),
                        adcBailout(adcb),
-                       pretrace(pt)
+                       pretrace(pt),
+                       costMap(nullptr),
+                       featureMap(nullptr),
+                       cameraRayTable(nullptr),
+                       cameraRayPatch(0)
 {
+    // Rays refer to their tickets, so the latter must never be relocated.
+    packetTickets.reserve(BBOX_PACKET_SIZE);
+    packetRays.reserve(BBOX_PACKET_SIZE);
+
     for (unsigned int i = 0; i < 3; ++i)
     {
         mpCameraLocationFn[i] = nullptr;
@@ -227,6 +358,7 @@ void TracePixel::SetupCamera(const Camera& cam)
 {
     bool normalise = false;
     camera = cam;
+    cameraRayTable = nullptr;
     useFocalBlur = false;
     precomputeContainingInteriors = true;
     cameraDirection = camera.Direction;
@@ -297,10 +429,22 @@ void TracePixel::SetupCamera(const Camera& cam)
     useFocalBlur = ((camera.Aperture != 0.0) && (camera.Blur_Samples > 0));
     if(useFocalBlur == true)
         focalBlurData = new FocalBlurData(camera, threadData);
+    stratifiedFocalBlur = useFocalBlur && ((sceneData->samplingMethod == kSamplingMethod_Sobol) || camera.Blur_Adaptive);
+    focalBlurCoC.clear();
 }
 
 void TracePixel::operator()(DBL x, DBL y, DBL width, DBL height, RGBTColour& colour)
 {
+    CostSample cost;
+    if (costMap != nullptr)
+        BeginCost(cost);
+
+    if (sceneData->samplingMethod == kSamplingMethod_Sobol)
+        threadData->sampler.SetPosition(x, y);
+
+    if (featureMap != nullptr)
+        BeginFeatures();
+
     if(useFocalBlur == false)
     {
         colour.Clear();
@@ -327,6 +471,130 @@ void TracePixel::operator()(DBL x, DBL y, DBL width, DBL height, RGBTColour& col
     }
     else
         TraceRayWithFocalBlur(colour, x, y, width, height);
+
+    if (featureMap != nullptr)
+        EndFeatures(x, y);
+
+    if (costMap != nullptr)
+        EndCost(cost, x, y);
+}
+
+void TracePixel::operator()(const Vector2d *positions, size_t count, DBL width, DBL height, RGBTColour *colours)
+{
+    NoSomethingFlagRayObjectCondition precond;
+    TrueRayObjectCondition postcond;
+
+    // With multiple rays per (sub-)pixel, trace each (sub-)pixel on its own.
+    if ((useFocalBlur == true) || (camera.Rays_Per_Pixel != 1))
+    {
+        for (size_t i = 0; i < count; i++)
+            (*this)(positions[i].x(), positions[i].y(), width, height, colours[i]);
+        return;
+    }
+
+    for (size_t first = 0; first < count; first += BBOX_PACKET_SIZE)
+    {
+        size_t last = min(count, first + BBOX_PACKET_SIZE);
+        size_t numRays = 0;
+
+        CostSample cost;
+        if (costMap != nullptr)
+            BeginCost(cost);
+
+        packetTickets.clear();
+        packetRays.clear();
+
+        for (size_t i = first; i < last; i++)
+        {
+            packetTickets.emplace_back(maxTraceLevel, adcBailout, sceneData->outputAlpha);
+            packetRays.emplace_back(packetTickets.back());
+
+            if (CreateCameraRay(packetRays.back(), positions[i].x(), positions[i].y(), width, height, 0) == true)
+            {
+                packetIntersections[numRays] = Intersection();
+                if (camera.Max_Ray_Distance >= EPSILON)
+                    packetIntersections[numRays].Depth = camera.Max_Ray_Distance;
+                packetPositions[numRays] = i;
+                numRays++;
+            }
+            else
+            {
+                packetRays.pop_back();
+                packetTickets.pop_back();
+                colours[i].Clear();
+                colours[i].transm() = 1.0;
+            }
+        }
+
+        if (numRays == 0)
+            continue;
+
+        FindIntersections(packetIntersections, &packetRays[0], numRays, precond, postcond);
+
+        // the time spent on the packet as a whole is split evenly among its rays
+        double sharedTime = 0.0;
+        if (costMap != nullptr)
+            sharedTime = std::chrono::duration<double, std::micro>(CostClock::now() - cost.start).count() / numRays;
+
+        // Beyond the nearest intersections, the rays diverge; shade them one by one.
+        for (size_t i = 0; i < numRays; i++)
+        {
+            MathColour col;
+            ColourChannel transm = 0.0;
+
+            if (costMap != nullptr)
+                BeginCost(cost);
+
+            if (sceneData->samplingMethod == kSamplingMethod_Sobol)
+                threadData->sampler.SetPosition(positions[packetPositions[i]].x(), positions[packetPositions[i]].y());
+
+            if (featureMap != nullptr)
+                BeginFeatures();
+
+            packetIntersection = &packetIntersections[i];
+            TraceRay(packetRays[i], col, transm, 1.0, false, camera.Max_Ray_Distance);
+            colours[packetPositions[i]] = RGBTColour(ToRGBColour(col), transm);
+
+            if (featureMap != nullptr)
+                EndFeatures(positions[packetPositions[i]].x(), positions[packetPositions[i]].y());
+
+            if (costMap != nullptr)
+                EndCost(cost, positions[packetPositions[i]].x(), positions[packetPositions[i]].y(), sharedTime);
+        }
+    }
+}
+
+void TracePixel::BeginCost(CostSample& sample) const
+{
+    sample.rays = threadData->Stats()[Number_Of_Rays];
+    sample.shadowRays = threadData->Stats()[Shadow_Ray_Tests];
+    sample.start = CostClock::now();
+}
+
+void TracePixel::EndCost(const CostSample& sample, DBL x, DBL y, double sharedTime)
+{
+    double time = std::chrono::duration<double, std::micro>(CostClock::now() - sample.start).count() + sharedTime;
+    unsigned int px = clip<int>(int(floor(x)), costRect.left, min(costRect.right, costMap->GetWidth() - 1));
+    unsigned int py = clip<int>(int(floor(y)), costRect.top, min(costRect.bottom, costMap->GetHeight() - 1));
+
+    costMap->Add(px, py, float(time),
+                 float(threadData->Stats()[Number_Of_Rays] - sample.rays),
+                 float(threadData->Stats()[Shadow_Ray_Tests] - sample.shadowRays));
+}
+
+void TracePixel::BeginFeatures()
+{
+    pixelFeatures = FirstHitFeatures();
+    firstHitFeatures = &pixelFeatures;
+}
+
+void TracePixel::EndFeatures(DBL x, DBL y)
+{
+    firstHitFeatures = nullptr;
+
+    unsigned int px = clip<int>(int(floor(x)), costRect.left, min(costRect.right, featureMap->GetWidth() - 1));
+    unsigned int py = clip<int>(int(floor(y)), costRect.top, min(costRect.bottom, featureMap->GetHeight() - 1));
+    featureMap->Add(px, py, pixelFeatures);
 }
 
 bool TracePixel::CreateCameraRay(Ray& ray, DBL x, DBL y, DBL width, DBL height, size_t ray_number)
@@ -342,6 +610,24 @@ bool TracePixel::CreateCameraRay(Ray& ray, DBL x, DBL y, DBL width, DBL height,
     // Create primary ray according to the camera used.
     ray.Origin = cameraLocation;
 
+    if (cameraRayTable != nullptr)
+    {
+        switch (cameraRayTable->Lookup(x, y, width, height, ray))
+        {
+            case CameraRayTable::kHit:
+                ray.SetCone(0.0, 0.0);
+                InitRayContainerState(ray, cameraRayTable->HasVaryingOrigin());
+                return true;
+            case CameraRayTable::kNoRay:
+                return false;
+            default:
+                break;
+        }
+    }
+
+    // Camera types other than the following do not provide a footprint for texture filtering.
+    ray.SetCone(0.0, 0.0);
+
     switch(camera.Type)
     {
         // Perspective projection (Pinhole camera; POV standard).
@@ -355,6 +641,9 @@ bool TracePixel::CreateCameraRay(Ray& ray, DBL x, DBL y, DBL width, DBL height,
             // Create primary ray.
             ray.Direction = cameraDirection + x0 * cameraRight + y0 * cameraUp;
 
+            // The footprint spreads by the angle subtended by one pixel at the centre of the image.
+            ray.SetCone(0.0, cameraLengthRight / (width * cameraDirection.length()));
+
             // Do focal blurring (by Dan Farmer).
             if(useFocalBlur)
                 JitterCameraRay(ray, x, y, ray_number);
@@ -375,6 +664,9 @@ bool TracePixel::CreateCameraRay(Ray& ray, DBL x, DBL y, DBL width, DBL height,
 
             ray.Origin = cameraLocation + x0 * cameraRight + y0 * cameraUp;
 
+            // The footprint is the size of one pixel, regardless of distance.
+            ray.SetCone(cameraLengthRight / width, 0.0);
+
             if(useFocalBlur)
                 JitterCameraRay(ray, x, y, ray_number);
 
@@ -691,10 +983,12 @@ bool TracePixel::CreateCameraRay(Ray& ray, DBL x, DBL y, DBL width, DBL height,
 
                 // set the ray origin to the centriod of the triangle.
                 const Mesh_Triangle_Struct& tr = mesh->Data->Triangles[faceIndex];
-                ray.Origin = Vector3d(mesh->Data->Vertices[tr.P1] + mesh->Data->Vertices[tr.P2] + mesh->Data->Vertices[tr.P3]) / 3;
+                Vector3d P1, P2, P3;
+                mesh->get_triangle_vertices(&tr, P1, P2, P3);
+                ray.Origin = (P1 + P2 + P3) / 3;
 
                 // set the ray direction according to the normal of the face
-                ray.Direction = Vector3d(mesh->Data->Normals[tr.Normal_Ind]);
+                mesh->get_triangle_normal(&tr, ray.Direction);
 
                 // we use the Z co-ordinate of the camera location to indicate how far, along
                 // the ray's direction, we should move the ray's origin point. this allows the
@@ -747,8 +1041,10 @@ bool TracePixel::CreateCameraRay(Ray& ray, DBL x, DBL y, DBL width, DBL height,
                         Mesh_Triangle_Struct& tr = mesh->Data->Triangles[faceIndex];
 
                         // see comments for distribution method 0
-                        ray.Origin = Vector3d(mesh->Data->Vertices[tr.P1] + mesh->Data->Vertices[tr.P2] + mesh->Data->Vertices[tr.P3]) / 3;
-                        ray.Direction = Vector3d(mesh->Data->Normals[tr.Normal_Ind]);
+                        Vector3d P1, P2, P3;
+                        mesh->get_triangle_vertices(&tr, P1, P2, P3);
+                        ray.Origin = (P1 + P2 + P3) / 3;
+                        mesh->get_triangle_normal(&tr, ray.Direction);
                         ray.Origin = ray.Evaluate(camera.Location[Z]);
                         if (camera.Direction[Z] < -EPSILON)
                             ray.Direction.invert();
@@ -782,8 +1078,10 @@ bool TracePixel::CreateCameraRay(Ray& ray, DBL x, DBL y, DBL width, DBL height,
 
                 // see comments for distribution method 0
                 Mesh_Triangle_Struct& tr = mesh->Data->Triangles[faceIndex];
-                ray.Origin = Vector3d(mesh->Data->Vertices[tr.P1] + mesh->Data->Vertices[tr.P2] + mesh->Data->Vertices[tr.P3]) / 3;
-                ray.Direction = Vector3d(mesh->Data->Normals[tr.Normal_Ind]);
+                Vector3d P1, P2, P3;
+                mesh->get_triangle_vertices(&tr, P1, P2, P3);
+                ray.Origin = (P1 + P2 + P3) / 3;
+                mesh->get_triangle_normal(&tr, ray.Direction);
                 ray.Origin = ray.Evaluate(camera.Location[Z]);
                 if (camera.Direction[Z] < -EPSILON)
                     ray.Direction.invert();
@@ -845,13 +1143,16 @@ bool TracePixel::CreateCameraRay(Ray& ray, DBL x, DBL y, DBL width, DBL height,
                                     continue;
 
                                 // now all we need to do is convert the barycentric co-ordinates back to a point in 3d space which is on the surface of the face
-                                ray.Origin = Vector3d(mesh->Data->Vertices[tr->P1] * B1 + mesh->Data->Vertices[tr->P2] * B2 + mesh->Data->Vertices[tr->P3] * B3);
+                                Vector3d P1, P2, P3;
+                                mesh->get_triangle_vertices(tr, P1, P2, P3);
+                                ray.Origin = P1 * B1 + P2 * B2 + P3 * B3;
 
                                 // we use the one normal for any location on the face, unless smooth is set
-                                ray.Direction = Vector3d(mesh->Data->Normals[tr->Normal_Ind]);
+                                mesh->get_triangle_normal(tr, ray.Direction);
                                 if (camera.Smooth)
                                     mesh->Smooth_Mesh_Normal(ray.Direction, tr, ray.Origin);
 
+                                cameraRayPatch = idx * 32 + bit;
                                 found = true;
                                 break;
                             }
@@ -917,6 +1218,26 @@ bool TracePixel::CreateCameraRay(Ray& ray, DBL x, DBL y, DBL width, DBL height,
     return true;
 }
 
+void TracePixel::FillCameraRayTable(CameraRayTable& table, unsigned int firstRow, unsigned int endRow)
+{
+    DBL width = table.GetImageWidth();
+    DBL height = table.GetImageHeight();
+    TraceTicket ticket(maxTraceLevel, adcBailout, sceneData->outputAlpha);
+
+    for (unsigned int row = firstRow; row < endRow; ++row)
+    {
+        for (unsigned int column = 0; column < table.GetColumns(); ++column)
+        {
+            Ray ray(ticket);
+            cameraRayPatch = 0;
+            if (CreateCameraRay(ray, column - 0.5, row - 0.5, width, height, 0))
+                table.Set(column, row, ray, cameraRayPatch);
+            else
+                table.Set(column, row, ray, CameraRayTable::kNoRayPatch);
+        }
+    }
+}
+
 void TracePixel::InitRayContainerState(Ray& ray, bool compute)
 {
     if((compute == true) || (precomputeContainingInteriors == true)) // TODO - check this logic, in particular that of compute!
@@ -928,16 +1249,25 @@ void TracePixel::InitRayContainerState(Ray& ray, bool compute)
         {
             HasInteriorPointObjectCondition precond;
             ContainingInteriorsPointObjectCondition postcond(containingInteriors);
-            BSPInsideCondFunctor ifn(ray.Origin, sceneData->objects, threadData, precond, postcond);
+            BSPInsideCondFunctor<HasInteriorPointObjectCondition, ContainingInteriorsPointObjectCondition> ifn(ray.Origin, sceneData->objects, threadData, precond, postcond);
 
             mailbox.clear();
             (*sceneData->tree)(ray.Origin, ifn, mailbox);
+            threadData->Stats()[BSP_Mailbox_Hits] += mailbox.redundant();
 
             // test infinite objects
             for(vector<ObjectPtr>::iterator object = sceneData->objects.begin() + sceneData->numberOfFiniteObjects; object != sceneData->objects.end(); object++)
                 if (((*object)->interior != nullptr) && Inside_BBox(ray.Origin, (*object)->BBox) && (*object)->Inside(ray.Origin, threadData))
                     containingInteriors.push_back((*object)->interior.get());
         }
+        else if ((sceneData->boundingSlabs == nullptr) && (sceneData->flatBVH != nullptr))
+        {
+            sceneData->flatBVH->GetCandidatesContaining(ray.Origin, containerCandidates);
+
+            for(vector<ObjectPtr>::iterator object = containerCandidates.begin(); object != containerCandidates.end(); object++)
+                if (((*object)->interior != nullptr) && Inside_BBox(ray.Origin, (*object)->BBox) && (*object)->Inside(ray.Origin, threadData))
+                    containingInteriors.push_back((*object)->interior.get());
+        }
         else if ((sceneData->boundingMethod == 0) || (sceneData->boundingSlabs == nullptr))
         {
             for(vector<ObjectPtr>::iterator object = sceneData->objects.begin(); object != sceneData->objects.end(); object++)
@@ -1006,6 +1336,36 @@ void TracePixel::TraceRayWithFocalBlur(RGBTColour& colour, DBL x, DBL y, DBL wid
     DBL dx, dy, n, randx, randy;
     RGBTColour C, V1, S1, S2;
     int seed = int((x-0.5) * 313.0 + 11.0) + int((y-0.5) * 311.0 + 17.0);
+    bool useSampler = stratifiedFocalBlur;
+    ScrambledSobolSampleSet pixelSampleSet;
+
+    if (useSampler)
+    {
+        // Other effects only use the sampler in the corresponding sampling mode, which has set the position already.
+        if (sceneData->samplingMethod != kSamplingMethod_Sobol)
+            threadData->sampler.SetPosition(x, y);
+        pixelSampleSet = threadData->sampler.NewSet(kSamplerStream_Pixel);
+        lensSampleSet = threadData->sampler.NewSet(kSamplerStream_Lens);
+    }
+
+    // In adaptive mode, samples are tested one by one, and a pixel whose samples all come to lie within a small
+    // circle of confusion is taken to be in focus, ending after a handful of samples. As a blurred object nearby
+    // may still spread into the pixel, the circles of confusion found in the neighbouring pixels count as well.
+    // The estimate depends on a perspective projection, so other camera types only get the per-sample test.
+    bool adaptive = camera.Blur_Adaptive;
+    bool estimateCoC = adaptive && (camera.Type == PERSPECTIVE_CAMERA);
+    int column = int(floor(x));
+    int row = int(floor(y));
+    int columns = int(width);
+    DBL cocScale = 0.0; // circle of confusion, in pixels, of a point at infinity
+    float pixelCoC = 0.0f;
+    float neighbourCoC = 0.0f;
+
+    if (estimateCoC)
+    {
+        cocScale = camera.Aperture * camera.Direction.length() * width / (camera.Focal_Distance * camera.Right.length());
+        neighbourCoC = NeighbourFocalBlurCoC(column, row, columns);
+    }
 
     TraceTicket ticket(maxTraceLevel, adcBailout, sceneData->outputAlpha);
     Ray ray(ticket);
@@ -1023,7 +1383,9 @@ void TracePixel::TraceRayWithFocalBlur(RGBTColour& colour, DBL x, DBL y, DBL wid
         // Trace number of rays given by the list Current_Number_Of_Samples[].
         max_s = 4;
 
-        if (focalBlurData->Current_Number_Of_Samples != nullptr)
+        if (adaptive)
+            max_s = 1;
+        else if (focalBlurData->Current_Number_Of_Samples != nullptr)
         {
             if(focalBlurData->Current_Number_Of_Samples[level] > 0)
             {
@@ -1034,30 +1396,43 @@ void TracePixel::TraceRayWithFocalBlur(RGBTColour& colour, DBL x, DBL y, DBL wid
 
         for(i = 0; (i < max_s) && (nr < camera.Blur_Samples); i++)
         {
-            // Choose sub-pixel location.
-            dxi = PseudoRandom(seed + nr) % SUB_PIXEL_GRID_SIZE;
-            dyi = PseudoRandom(seed + nr + 1) % SUB_PIXEL_GRID_SIZE;
+            if (useSampler)
+            {
+                // Choose sub-pixel location from a stratified set.
+                Vector2d d = pixelSampleSet.Get2d(nr) - 0.5;
+                dx = d.x();
+                dy = d.y();
+            }
+            else
+            {
+                // Choose sub-pixel location.
+                dxi = PseudoRandom(seed + nr) % SUB_PIXEL_GRID_SIZE;
+                dyi = PseudoRandom(seed + nr + 1) % SUB_PIXEL_GRID_SIZE;
 
-            dx = (DBL)(2 * dxi + 1) / (DBL)(2 * SUB_PIXEL_GRID_SIZE) - 0.5;
-            dy = (DBL)(2 * dyi + 1) / (DBL)(2 * SUB_PIXEL_GRID_SIZE) - 0.5;
+                dx = (DBL)(2 * dxi + 1) / (DBL)(2 * SUB_PIXEL_GRID_SIZE) - 0.5;
+                dy = (DBL)(2 * dyi + 1) / (DBL)(2 * SUB_PIXEL_GRID_SIZE) - 0.5;
 
-            Jitter2d(dx, dy, randx, randy);
+                Jitter2d(dx, dy, randx, randy);
 
-            // Add jitter to sub-pixel location.
-            dx += (randx - 0.5) / (DBL)(SUB_PIXEL_GRID_SIZE);
-            dy += (randy - 0.5) / (DBL)(SUB_PIXEL_GRID_SIZE);
+                // Add jitter to sub-pixel location.
+                dx += (randx - 0.5) / (DBL)(SUB_PIXEL_GRID_SIZE);
+                dy += (randy - 0.5) / (DBL)(SUB_PIXEL_GRID_SIZE);
+            }
 
             // remove interiors accumulated from previous iteration (if any)
             ray.ClearInteriors();
 
             // Create and trace ray.
+            // Nothing hit counts as infinitely far away.
+            DBL depth = HUGE_VAL;
+
             if(CreateCameraRay(ray, x + dx, y + dy, width, height, nr))
             {
                 // Increase_Counter(stats[Number_Of_Samples]);
 
                 MathColour tempC;
                 ColourChannel tempT = 0.0;
-                TraceRay(ray, tempC, tempT, 1.0, false, camera.Max_Ray_Distance);
+                depth = TraceRay(ray, tempC, tempT, 1.0, false, camera.Max_Ray_Distance);
                 C = RGBTColour(ToRGBColour(tempC), tempT);
 
                 colour += C;
@@ -1065,6 +1440,9 @@ void TracePixel::TraceRayWithFocalBlur(RGBTColour& colour, DBL x, DBL y, DBL wid
             else
                 C = RGBTColour(0.0, 0.0, 0.0, 1.0);
 
+            if (estimateCoC)
+                pixelCoC = max(pixelCoC, float(cocScale * ((depth < HUGE_VAL) ? fabs(depth - camera.Focal_Distance) / depth : 1.0)));
+
             // Add color to color sum.
 
             S1 += C;
@@ -1087,12 +1465,58 @@ void TracePixel::TraceRayWithFocalBlur(RGBTColour& colour, DBL x, DBL y, DBL wid
         if((nr >= camera.Blur_Samples_Min) &&
            (V1.IsNearZero(focalBlurData->Sample_Threshold[nr - 1])))
             break;
+
+        // Exit if in focus.
+
+        if(estimateCoC && (nr >= FOCAL_BLUR_IN_FOCUS_SAMPLES) && (max(pixelCoC, neighbourCoC) < FOCAL_BLUR_IN_FOCUS_COC))
+            break;
     }
     while(nr < camera.Blur_Samples);
 
+    if (estimateCoC)
+        SetFocalBlurCoC(column, row, columns, pixelCoC);
+
     colour /= (DBL)nr;
 }
 
+float TracePixel::NeighbourFocalBlurCoC(int column, int row, int width)
+{
+    float diameter = 0.0f;
+
+    if (focalBlurCoC.size() != size_t(max(width, 0)))
+        return 0.0f;
+
+    // Go by the pixels to the left and right, and by those in the row above, as far as traced by this thread.
+    for (int i = max(column - 1, 0); i <= min(column + 1, width - 1); i++)
+    {
+        if ((focalBlurCoC[i].row == row) || (focalBlurCoC[i].row == row - 1))
+            diameter = max(diameter, focalBlurCoC[i].diameter);
+    }
+
+    return diameter;
+}
+
+void TracePixel::SetFocalBlurCoC(int column, int row, int width, float diameter)
+{
+    if ((column < 0) || (column >= width))
+        return;
+
+    if (focalBlurCoC.size() != size_t(width))
+    {
+        FocalBlurCoC none = { -2, 0.0f };
+        focalBlurCoC.assign(width, none);
+    }
+
+    // Anti-aliasing may trace the same pixel several times, so keep the largest circle found in it.
+    if (focalBlurCoC[column].row == row)
+        focalBlurCoC[column].diameter = max(focalBlurCoC[column].diameter, diameter);
+    else
+    {
+        focalBlurCoC[column].row = row;
+        focalBlurCoC[column].diameter = diameter;
+    }
+}
+
 void TracePixel::JitterCameraRay(Ray& ray, DBL x, DBL y, size_t ray_number)
 {
     DBL xjit, yjit, xlen, ylen, r;
@@ -1100,12 +1524,23 @@ void TracePixel::JitterCameraRay(Ray& ray, DBL x, DBL y, size_t ray_number)
 
     r = camera.Aperture * 0.5;
 
-    Jitter2d(x, y, xjit, yjit);
-    xjit *= focalBlurData->Max_Jitter * 2.0;
-    yjit *= focalBlurData->Max_Jitter * 2.0;
+    if (stratifiedFocalBlur && !camera.Bokeh)
+    {
+        // Take the aperture position from a stratified set covering the disc of radius 0.5,
+        // instead of jittering a fixed sample grid.
+        Vector2d v = Uniform2dOnDisc(lensSampleSet.Get2d((unsigned int)ray_number)) * 0.5;
+        xlen = r * v.x();
+        ylen = r * v.y();
+    }
+    else
+    {
+        Jitter2d(x, y, xjit, yjit);
+        xjit *= focalBlurData->Max_Jitter * 2.0;
+        yjit *= focalBlurData->Max_Jitter * 2.0;
 
-    xlen = r * (focalBlurData->Sample_Grid[ray_number].x() + xjit);
-    ylen = r * (focalBlurData->Sample_Grid[ray_number].y() + yjit);
+        xlen = r * (focalBlurData->Sample_Grid[ray_number].x() + xjit);
+        ylen = r * (focalBlurData->Sample_Grid[ray_number].y() + yjit);
+    }
 
     // Deflect the position of the eye by the size of the aperture, and in
     // a direction perpendicular to the current direction of view.
@@ -39,8 +39,11 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include <chrono>
 #include <vector>
 
+#include "base/types.h"
+
 #include "core/render/trace.h"
 #include "core/scene/camera.h"
 #include "core/scene/scenedata.h"
@@ -55,18 +58,186 @@ namespace pov
 ///
 /// @{
 
-struct HasInteriorPointObjectCondition : public PointObjectCondition
+struct HasInteriorPointObjectCondition final : public PointObjectCondition
 {
-    virtual bool operator()(const Vector3d& point, ConstObjectPtr object) const;
+    virtual bool operator()(const Vector3d&, ConstObjectPtr object) const override { return object->interior != nullptr; }
 };
 
-struct ContainingInteriorsPointObjectCondition : public PointObjectCondition
+struct ContainingInteriorsPointObjectCondition final : public PointObjectCondition
 {
     ContainingInteriorsPointObjectCondition(RayInteriorVector& ci) : containingInteriors(ci) {}
-    virtual bool operator()(const Vector3d& point, ConstObjectPtr object) const;
+    virtual bool operator()(const Vector3d&, ConstObjectPtr object) const override { containingInteriors.push_back(object->interior.get()); return true; }
     RayInteriorVector &containingInteriors;
 };
 
+/// Render cost of each pixel of an image.
+///
+/// For each pixel, the map accumulates the wall-clock time spent tracing it (in microseconds),
+/// as well as the number of rays and shadow rays traced on its behalf. Render threads only ever
+/// record to the pixels of the block they are working on, so no locking is required.
+///
+class RenderCostMap final
+{
+    public:
+        enum
+        {
+            kTime,
+            kRays,
+            kShadowRays,
+            kChannels
+        };
+
+        RenderCostMap(unsigned int w, unsigned int h) : width(w), height(h), data(size_t(w) * size_t(h) * kChannels, 0.0f) {}
+
+        unsigned int GetWidth() const { return width; }
+        unsigned int GetHeight() const { return height; }
+
+        /// Get the recorded cost, as @ref kChannels values per pixel, in rows from top to bottom.
+        const vector<float>& GetData() const { return data; }
+
+        void Add(unsigned int x, unsigned int y, float time, float rays, float shadowRays)
+        {
+            float *pixel = &data[(size_t(y) * width + x) * kChannels];
+            pixel[kTime]       += time;
+            pixel[kRays]       += rays;
+            pixel[kShadowRays] += shadowRays;
+        }
+
+    private:
+        unsigned int width;
+        unsigned int height;
+        vector<float> data;
+};
+
+/// Properties of the first surfaces hit in each pixel of an image, to guide denoising.
+///
+/// For each pixel, the map accumulates the albedo, normal and depth of the first surface hit by
+/// each ray traced on its behalf, along with the number of rays, so that the averages can be
+/// taken once the render is finished. Rays hitting nothing count towards the number of rays only.
+/// As with @ref RenderCostMap, render threads only ever record to the pixels of the block they
+/// are working on, so no locking is required.
+///
+class RenderFeatureMap final
+{
+    public:
+        enum
+        {
+            kAlbedoRed,
+            kAlbedoGreen,
+            kAlbedoBlue,
+            kNormalX,
+            kNormalY,
+            kNormalZ,
+            kDepth,
+            kRays,
+            kChannels
+        };
+
+        RenderFeatureMap(unsigned int w, unsigned int h) : width(w), height(h), data(size_t(w) * size_t(h) * kChannels, 0.0f) {}
+
+        unsigned int GetWidth() const { return width; }
+        unsigned int GetHeight() const { return height; }
+
+        /// Get the recorded sums, as @ref kChannels values per pixel, in rows from top to bottom.
+        const vector<float>& GetData() const { return data; }
+
+        void Add(unsigned int x, unsigned int y, const FirstHitFeatures& features)
+        {
+            float *pixel = &data[(size_t(y) * width + x) * kChannels];
+            if (features.found)
+            {
+                RGBColour albedo(ToRGBColour(features.albedo));
+                pixel[kAlbedoRed]   += albedo.red();
+                pixel[kAlbedoGreen] += albedo.green();
+                pixel[kAlbedoBlue]  += albedo.blue();
+                pixel[kNormalX]     += float(features.normal.x());
+                pixel[kNormalY]     += float(features.normal.y());
+                pixel[kNormalZ]     += float(features.normal.z());
+                pixel[kDepth]       += float(features.depth);
+            }
+            pixel[kRays] += 1.0f;
+        }
+
+    private:
+        unsigned int width;
+        unsigned int height;
+        vector<float> data;
+};
+
+/// Primary rays of a view, precomputed at the pixel centres.
+///
+/// For camera types whose rays are comparatively costly to set up, i.e. those involving
+/// trigonometry, a search of the camera mesh, or user-defined functions, the rays can be
+/// computed once for the whole view in advance. The table holds the rays through the centres
+/// of all pixels, plus a margin of one pixel around the image; rays through any other position,
+/// such as anti-aliasing samples, are interpolated bilinearly from the four nearest entries.
+/// Where this is not appropriate, i.e. if one of the entries shoots no ray, if they stem from
+/// different faces of a mesh camera, or if their directions differ by too much, the ray is
+/// computed as usual instead.
+///
+/// The table is filled row by row, so that distinct rows may be filled in parallel.
+///
+class CameraRayTable final
+{
+    public:
+        /// Outcome of a table lookup.
+        enum Result
+        {
+            kMiss,  ///< The ray needs to be computed as usual.
+            kHit,   ///< The ray was taken from the table.
+            kNoRay, ///< The camera shoots no ray through this position.
+        };
+
+        /// Marker for entries of positions through which the camera shoots no ray.
+        static const POV_UINT32 kNoRayPatch = 0xFFFFFFFFu;
+
+        CameraRayTable() : imageWidth(0), imageHeight(0), columns(0), rows(0) {}
+
+        /// Set up the table for a view.
+        /// @param[in]  camera  Camera of the view.
+        /// @param[in]  width   Horizontal size of the image in pixels.
+        /// @param[in]  height  Vertical size of the image in pixels.
+        /// @return             Whether the camera benefits from the table; if not, it is left empty.
+        bool Setup(const Camera& camera, unsigned int width, unsigned int height);
+
+        unsigned int GetImageWidth() const { return imageWidth; }
+        unsigned int GetImageHeight() const { return imageHeight; }
+        unsigned int GetColumns() const { return columns; }
+        unsigned int GetRows() const { return rows; }
+
+        /// Whether the rays' origins vary from one position to another.
+        bool HasVaryingOrigin() const { return !origins.empty(); }
+
+        /// Set an entry.
+        /// Entry (0,0) corresponds to the centre of the pixel diagonally outside the top left corner of the image.
+        /// @param[in]  column  Column of the entry.
+        /// @param[in]  row     Row of the entry.
+        /// @param[in]  ray     Primary ray through the position, with normalised direction.
+        /// @param[in]  patch   Part of the camera the ray stems from, e.g. face of a mesh camera, or @ref kNoRayPatch.
+        void Set(unsigned int column, unsigned int row, const Ray& ray, POV_UINT32 patch);
+
+        /// Look up the ray through a given position.
+        /// @param[in]      x       X-coordinate of the position, see @ref TracePixel::operator()().
+        /// @param[in]      y       Y-coordinate of the position, see @ref TracePixel::operator()().
+        /// @param[in]      width   Horizontal size of the image in pixels.
+        /// @param[in]      height  Vertical size of the image in pixels.
+        /// @param[in,out]  ray     Ray to set the direction and, where applicable, origin of.
+        /// @return                 Outcome of the lookup.
+        Result Lookup(DBL x, DBL y, DBL width, DBL height, Ray& ray) const;
+
+    private:
+        unsigned int imageWidth;
+        unsigned int imageHeight;
+        unsigned int columns;
+        unsigned int rows;
+        /// normalised ray directions, in rows from top to bottom
+        vector<SnglVector3d> directions;
+        /// ray origins, if they vary across the image
+        vector<Vector3d> origins;
+        /// part of the camera each ray stems from, or @ref kNoRayPatch
+        vector<POV_UINT32> patches;
+};
+
 class TracePixel : public Trace
 {
     public:
@@ -82,7 +253,59 @@ class TracePixel : public Trace
         /// @param[in]  height  Vertical size of the image in pixels.
         /// @param[out] colour  Computed colour of the (sub-)pixel.
         void operator()(DBL x, DBL y, DBL width, DBL height, RGBTColour& colour);
+
+        /// Trace a set of (sub-)pixels.
+        /// Where the camera shoots a single ray per (sub-)pixel, the rays are traced in packets
+        /// through the bounding hierarchy, and only shaded one at a time once their nearest
+        /// intersections are known. For best performance, the positions should be close together,
+        /// e.g. the samples of a regular anti-aliasing grid.
+        /// @param[in]  positions   Coordinates of the (sub-)pixels' centers, see above.
+        /// @param[in]  count       Number of (sub-)pixels.
+        /// @param[in]  width       Horizontal size of the image in pixels.
+        /// @param[in]  height      Vertical size of the image in pixels.
+        /// @param[out] colours     Computed colours of the (sub-)pixels.
+        void operator()(const Vector2d *positions, size_t count, DBL width, DBL height, RGBTColour *colours);
+
+        /// Record the cost of all (sub-)pixels traced from now on.
+        /// @param[in]  map     Cost map to record to, or `nullptr` to stop recording.
+        void SetCostMap(RenderCostMap *map) { costMap = map; }
+
+        /// Set the block of pixels currently being rendered.
+        /// The cost of (sub-)pixels outside the block, as traced e.g. by anti-aliasing along its
+        /// edges, is attributed to the nearest pixel inside it.
+        void SetCostRectangle(const POVRect& rect) { costRect = rect; }
+
+        /// Record the properties of the first surfaces hit by all (sub-)pixels traced from now on.
+        /// As with the cost, (sub-)pixels outside the block set via @ref SetCostRectangle() are
+        /// attributed to the nearest pixel inside it.
+        /// @param[in]  map     Feature map to record to, or `nullptr` to stop recording.
+        void SetFeatureMap(RenderFeatureMap *map) { featureMap = map; }
+
+        /// Look up the primary rays in a precomputed table from now on.
+        /// The table is dropped again whenever the camera is changed via @ref SetupCamera().
+        /// @param[in]  table   Table matching the current camera, or `nullptr` to compute all rays as usual.
+        void SetCameraRayTable(const CameraRayTable *table) { cameraRayTable = table; }
+
+        /// Compute entries of a precomputed table of primary rays.
+        /// @param[in,out]  table       Table to fill, set up for the current camera.
+        /// @param[in]      firstRow    First row to fill.
+        /// @param[in]      endRow      Row to stop before.
+        void FillCameraRayTable(CameraRayTable& table, unsigned int firstRow, unsigned int endRow);
+
+        /// Compute the primary ray through a (sub-)pixel, ignoring focal blur.
+        /// @return     `false` if the camera shoots no ray through the given position.
+        bool CreatePrimaryRay(Ray& ray, DBL x, DBL y, DBL width, DBL height) { return CreateCameraRay(ray, x, y, width, height, 0); }
     private:
+        typedef std::chrono::steady_clock CostClock;
+
+        /// State of the render at the start of a (sub-)pixel, to measure its cost
+        struct CostSample
+        {
+            CostClock::time_point start;
+            POV_ULONG rays;
+            POV_ULONG shadowRays;
+        };
+
         // Focal blur data
         class FocalBlurData
         {
@@ -105,11 +328,26 @@ class TracePixel : public Trace
 
         };
 
+        /// Largest circle of confusion found in a pixel, for the focal blur of its neighbours to go by
+        struct FocalBlurCoC
+        {
+            int row;
+            float diameter;
+        };
+
         bool useFocalBlur;
         FocalBlurData *focalBlurData;
+        /// whether focal blur samples take their positions from the low-discrepancy sampler
+        bool stratifiedFocalBlur;
+        /// aperture positions of the current focal blur samples, with the low-discrepancy sampler
+        ScrambledSobolSampleSet lensSampleSet;
+        /// circles of confusion, in pixels, of the most recent row traced in each column, in adaptive focal blur mode
+        vector<FocalBlurCoC> focalBlurCoC;
 
         bool precomputeContainingInteriors;
         RayInteriorVector containingInteriors;
+        /// scratch space for finding the objects containing the camera
+        vector<ObjectPtr> containerCandidates;
 
         Vector3d cameraDirection;
         Vector3d cameraRight;
@@ -135,17 +373,48 @@ class TracePixel : public Trace
         /// whether this is just a pretrace, allowing some computations to be skipped
         bool pretrace;
 
+        /// scratch space for the tickets of the current ray packet
+        vector<TraceTicket> packetTickets;
+        /// scratch space for the rays of the current ray packet
+        vector<Ray> packetRays;
+        /// nearest intersections of the current ray packet
+        Intersection packetIntersections[BBOX_PACKET_SIZE];
+        /// indices of the (sub-)pixels traced by the current ray packet
+        size_t packetPositions[BBOX_PACKET_SIZE];
+
+        /// cost map to record to, if any
+        RenderCostMap *costMap;
+        /// block of the image currently being rendered
+        POVRect costRect;
+        /// feature map to record to, if any
+        RenderFeatureMap *featureMap;
+        /// properties of the first surface hit by the current (sub-)pixel
+        FirstHitFeatures pixelFeatures;
+
         /// Thread-local instances of user-defined camera functions
         GenericScalarFunctionInstancePtr mpCameraLocationFn[3];
         GenericScalarFunctionInstancePtr mpCameraDirectionFn[3];
 
+        /// precomputed primary rays, if any
+        const CameraRayTable *cameraRayTable;
+        /// part of the camera the most recent primary ray stems from (see @ref CameraRayTable::Set())
+        POV_UINT32 cameraRayPatch;
+
         bool CreateCameraRay(Ray& ray, DBL x, DBL y, DBL width, DBL height, size_t ray_number);
 
         void InitRayContainerState(Ray& ray, bool compute = false);
         void InitRayContainerStateTree(Ray& ray, BBOX_TREE *node);
 
         void TraceRayWithFocalBlur(RGBTColour& colour, DBL x, DBL y, DBL width, DBL height);
+        float NeighbourFocalBlurCoC(int column, int row, int width);
+        void SetFocalBlurCoC(int column, int row, int width, float diameter);
         void JitterCameraRay(Ray& ray, DBL x, DBL y, size_t ray_number);
+
+        void BeginCost(CostSample& sample) const;
+        void EndCost(const CostSample& sample, DBL x, DBL y, double sharedTime = 0.0);
+
+        void BeginFeatures();
+        void EndFeatures(DBL x, DBL y);
 };
 
 /// @}
@@ -106,6 +106,7 @@ FOG *Create_Fog()
 
     New->Turb = nullptr;
     New->Turb_Depth = 0.5;
+    New->Turb_Grid_Resolution = 0;
 
     New->Next = nullptr;
 
@@ -631,6 +632,162 @@ void Transform_Skysphere(SKYSPHERE *Skysphere, const TRANSFORM *Trans)
     }
 
     Compose_Transforms(Skysphere->Trans, Trans);
+
+    // any baked map no longer matches the skysphere's orientation
+    Skysphere->Map.reset();
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Evaluate_Skysphere
+*
+* INPUT
+*
+*   Skysphere - Pointer to skysphere structure
+*   Direction - Direction to look up
+*
+* OUTPUT
+*
+*   Emission  - Light emitted by the skysphere layers
+*   Filter    - Colour the skysphere layers let through from behind
+*
+* RETURNS
+*
+* DESCRIPTION
+*
+*   Evaluate the skysphere's layers in a given direction, compositing them
+*   like the layers of a layered texture.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void Evaluate_Skysphere(const SKYSPHERE *Skysphere, const Vector3d& Direction, MathColour& Emission, MathColour& Filter, TraceThreadData *Thread)
+{
+    TransColour col_Temp;
+    Vector3d p;
+
+    Emission.Clear();
+    Filter = MathColour(1.0);
+
+    // Transform point on unit sphere.
+    if (Skysphere->Trans != nullptr)
+        MInvTransPoint(p, Direction, Skysphere->Trans);
+    else
+        p = Direction;
+
+    // TODO - Reverse iterator may be less performant than forward iterator; we might want to
+    //        compare performance with using forward iterators and decrement, or using random access.
+    //        Alternatively, reversing the vector after parsing might be another option.
+    for(vector<PIGMENT*>::const_reverse_iterator i = Skysphere->Pigments.rbegin(); i != Skysphere->Pigments.rend(); ++ i)
+    {
+        // Compute sky colour from colour map.
+        Compute_Pigment(col_Temp, *i, p, nullptr, nullptr, Thread);
+
+        Emission += col_Temp.colour() * col_Temp.Opacity() * Filter * Skysphere->Emission;
+        Filter *= col_Temp.TransmittedColour();
+    }
+}
+
+void Skysphere_Struct::Bake(TraceThreadData *ttd)
+{
+    if ((Map_Width <= 0) || (Map_Height <= 0) || (Map != nullptr))
+        return;
+
+    Map = shared_ptr<SkysphereMap>(new SkysphereMap(*this, Map_Width, Map_Height, ttd));
+}
+
+SkysphereMap::SkysphereMap(const Skysphere_Struct& skysphere, int width, int height, TraceThreadData *ttd)
+{
+    levels.resize(1);
+    levels[0].width = width;
+    levels[0].height = height;
+    levels[0].emission.resize(width * height);
+    levels[0].filter.resize(width * height);
+
+    // sample the skysphere at the texel centers; rows run from +y down to -y, columns around the y axis
+    for (int y = 0; y < height; y++)
+    {
+        DBL theta = M_PI * (y + 0.5) / height;
+        for (int x = 0; x < width; x++)
+        {
+            DBL phi = TWO_M_PI * (x + 0.5) / width - M_PI;
+            Vector3d direction(sin(theta) * cos(phi), cos(theta), sin(theta) * sin(phi));
+            Evaluate_Skysphere(&skysphere, direction, levels[0].emission[y * width + x], levels[0].filter[y * width + x], ttd);
+        }
+    }
+
+    // box filter down to a single texel row
+    while ((levels.back().width > 1) || (levels.back().height > 1))
+    {
+        const Level& fine = levels.back();
+        Level coarse;
+        coarse.width = max(1, fine.width / 2);
+        coarse.height = max(1, fine.height / 2);
+        coarse.emission.resize(coarse.width * coarse.height);
+        coarse.filter.resize(coarse.width * coarse.height);
+
+        for (int y = 0; y < coarse.height; y++)
+        {
+            int y0 = min(2 * y, fine.height - 1);
+            int y1 = min(2 * y + 1, fine.height - 1);
+            for (int x = 0; x < coarse.width; x++)
+            {
+                int x0 = min(2 * x, fine.width - 1);
+                int x1 = min(2 * x + 1, fine.width - 1);
+                coarse.emission[y * coarse.width + x] = (fine.emission[y0 * fine.width + x0] + fine.emission[y0 * fine.width + x1] +
+                                                         fine.emission[y1 * fine.width + x0] + fine.emission[y1 * fine.width + x1]) * 0.25;
+                coarse.filter[y * coarse.width + x]   = (fine.filter[y0 * fine.width + x0] + fine.filter[y0 * fine.width + x1] +
+                                                         fine.filter[y1 * fine.width + x0] + fine.filter[y1 * fine.width + x1]) * 0.25;
+            }
+        }
+
+        levels.push_back(coarse);
+    }
+}
+
+void SkysphereMap::Evaluate(const Vector3d& direction, int level, MathColour& emission, MathColour& filter) const
+{
+    const Level& map = levels[min(max(level, 0), int(levels.size()) - 1)];
+
+    // texel coordinates relative to the texel centers
+    DBL u = (atan2(direction[Z], direction[X]) + M_PI) / TWO_M_PI * map.width - 0.5;
+    DBL v = atan2(sqrt(direction[X] * direction[X] + direction[Z] * direction[Z]), direction[Y]) / M_PI * map.height - 0.5;
+
+    int x0 = int(floor(u));
+    int y0 = int(floor(v));
+    DBL fx = u - x0;
+    DBL fy = v - y0;
+
+    // wrap around in longitude, clamp in latitude
+    int x1 = (x0 + 1) % map.width;
+    x0 = (x0 + map.width) % map.width;
+    int y1 = min(y0 + 1, map.height - 1);
+    y0 = max(y0, 0);
+
+    int i00 = y0 * map.width + x0;
+    int i01 = y0 * map.width + x1;
+    int i10 = y1 * map.width + x0;
+    int i11 = y1 * map.width + x1;
+
+    emission = (map.emission[i00] * (1.0 - fx) + map.emission[i01] * fx) * (1.0 - fy) +
+               (map.emission[i10] * (1.0 - fx) + map.emission[i11] * fx) * fy;
+    filter   = (map.filter[i00] * (1.0 - fx) + map.filter[i01] * fx) * (1.0 - fy) +
+               (map.filter[i10] * (1.0 - fx) + map.filter[i11] * fx) * fy;
+}
+
+int SkysphereMap::LevelForAngle(DBL angle) const
+{
+    int level = 0;
+    while ((level + 1 < int(levels.size())) && (M_PI / levels[level].height < angle))
+        level++;
+    return level;
 }
 
 }
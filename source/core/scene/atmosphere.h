@@ -70,6 +70,7 @@ typedef struct Rainbow_Struct RAINBOW;
 typedef struct Skysphere_Struct SKYSPHERE;
 
 struct TurbulenceWarp; // full declaration in core/material/warp.h
+class SkysphereMap;
 
 struct Fog_Struct
 {
@@ -83,6 +84,7 @@ struct Fog_Struct
     Vector3d Up;
     TurbulenceWarp *Turb;
     SNGL Turb_Depth;
+    int Turb_Grid_Resolution; ///< Lattice vertices per unit of turbulence space to cache the turbulence at, or 0.
     FOG *Next;
 };
 
@@ -102,11 +104,48 @@ struct Rainbow_Struct
 
 struct Skysphere_Struct
 {
-    Skysphere_Struct() : Trans(nullptr) {}
+    Skysphere_Struct() : Trans(nullptr), Map_Width(0), Map_Height(0) {}
     ~Skysphere_Struct();
-    MathColour        Emission; ///< Brightness adjustment.
-    vector<PIGMENT *> Pigments; ///< Pigment(s) to use.
-    TRANSFORM *       Trans;    ///< Skysphere transformation.
+    MathColour        Emission;     ///< Brightness adjustment.
+    vector<PIGMENT *> Pigments;     ///< Pigment(s) to use.
+    TRANSFORM *       Trans;        ///< Skysphere transformation.
+    int               Map_Width;    ///< Width of the environment map to bake the skysphere into, or 0.
+    int               Map_Height;   ///< Height of the environment map to bake the skysphere into, or 0.
+    shared_ptr<SkysphereMap> Map;   ///< Baked skysphere, or `nullptr` if the skysphere is to be evaluated directly.
+
+    /// Bakes the skysphere into an environment map, if requested and not done yet.
+    void Bake(TraceThreadData *ttd);
+};
+
+/// Skysphere baked into an environment map.
+///
+/// The map covers all directions in a latitude/longitude layout, with the skysphere's transformation
+/// already applied, and stores both the light emitted by the skysphere's layers and the colour they
+/// let through from behind, so that the background can still be applied at lookup time. Each mip level
+/// halves the resolution of the previous one by box filtering, for rays that sample the sky only coarsely.
+///
+class SkysphereMap
+{
+    public:
+        SkysphereMap(const Skysphere_Struct& skysphere, int width, int height, TraceThreadData *ttd);
+
+        /// Looks up the skysphere in a given direction by bilinear interpolation at a given mip level.
+        void Evaluate(const Vector3d& direction, int level, MathColour& emission, MathColour& filter) const;
+
+        /// Finds the finest mip level whose texels span at least a given angle (in radians).
+        int LevelForAngle(DBL angle) const;
+
+    protected:
+
+        struct Level
+        {
+            int                 width;
+            int                 height;
+            vector<MathColour>  emission;   ///< Light emitted by the skysphere layers.
+            vector<MathColour>  filter;     ///< Colour the skysphere layers let through from behind.
+        };
+
+        vector<Level> levels;
 };
 
 /*****************************************************************************
@@ -128,6 +167,7 @@ void Scale_Skysphere (SKYSPHERE *Skysphere, const Vector3d& Vector);
 void Rotate_Skysphere (SKYSPHERE *Skysphere, const Vector3d& Vector);
 void Translate_Skysphere (SKYSPHERE *Skysphere, const Vector3d& Vector);
 void Transform_Skysphere (SKYSPHERE *Skysphere, const TRANSFORM *Trans);
+void Evaluate_Skysphere (const SKYSPHERE *Skysphere, const Vector3d& Direction, MathColour& Emission, MathColour& Filter, TraceThreadData *Thread);
 
 /// @}
 ///
@@ -229,6 +229,7 @@ void Camera::Init()
     Blur_Samples_Min    = 0;
     Confidence          = 0.9;
     Variance            = 1.0 / 10000.0;
+    Blur_Adaptive       = false;
     Aperture            = 0.0;
     Focal_Distance      = -1.0;
 
@@ -334,6 +335,7 @@ Camera& Camera::operator=(const Camera& src)
     Blur_Samples_Min = src.Blur_Samples_Min;
     Confidence = src.Confidence;
     Variance = src.Variance;
+    Blur_Adaptive = src.Blur_Adaptive;
     Type = src.Type;
     Angle = src.Angle;
     H_Angle = src.H_Angle;
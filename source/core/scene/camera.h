@@ -91,6 +91,7 @@ public:
     int Blur_Samples_Min;           // Minimum number of blur samples to take regardless of confidence settings.
     DBL Confidence;                 // Probability for confidence test.
     DBL Variance;                   // Max. variance for confidence test.
+    bool Blur_Adaptive;             // Stratified focal blur samples, with in-focus pixels ending early.
     int Type;                       // Camera type.
     DBL Angle;                      // Viewing angle.
     DBL H_Angle;                    // Spherical horizontal viewing angle
@@ -106,6 +106,8 @@ bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, Tr
 {
     if (object != nullptr)
     {
+        threadData->Stats()[Scene_Object_Tests]++;
+
         DBL closest = HUGE_VAL;
         BBoxVector3d origin;
         BBoxVector3d invdir;
@@ -128,8 +130,10 @@ bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, Tr
         IStack depthstack(threadData->stackPool);
         POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
 
+        ObjectProfileScope profile(threadData, object, ObjectProfileScope::kIntersection);
         if(object->All_Intersections(ray, depthstack, threadData))
         {
+            profile.Hit();
             bool found = false;
             double tmpDepth = 0;
 
@@ -160,6 +164,8 @@ bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, co
 {
     if (object != nullptr)
     {
+        threadData->Stats()[Scene_Object_Tests]++;
+
         DBL closest = HUGE_VAL;
         BBoxVector3d origin;
         BBoxVector3d invdir;
@@ -182,8 +188,10 @@ bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, co
         IStack depthstack(threadData->stackPool);
         POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
 
+        ObjectProfileScope profile(threadData, object, ObjectProfileScope::kIntersection);
         if(object->All_Intersections(ray, depthstack, threadData))
         {
+            profile.Hit();
             bool found = false;
             double tmpDepth = 0;
 
@@ -214,6 +222,8 @@ bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, BB
 {
     if (object != nullptr)
     {
+        threadData->Stats()[Scene_Object_Tests]++;
+
         DBL closest = HUGE_VAL;
 
         if(object->Intersect_BBox(variant, origin, invdir, closest) == false)
@@ -228,8 +238,10 @@ bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, BB
         IStack depthstack(threadData->stackPool);
         POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
 
+        ObjectProfileScope profile(threadData, object, ObjectProfileScope::kIntersection);
         if(object->All_Intersections(ray, depthstack, threadData))
         {
+            profile.Hit();
             bool found = false;
             double tmpDepth = 0;
 
@@ -260,6 +272,8 @@ bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, BB
 {
     if (object != nullptr)
     {
+        threadData->Stats()[Scene_Object_Tests]++;
+
         DBL closest = HUGE_VAL;
 
         if(object->Intersect_BBox(variant, origin, invdir, closest) == false)
@@ -274,8 +288,10 @@ bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, BB
         IStack depthstack(threadData->stackPool);
         POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
 
+        ObjectProfileScope profile(threadData, object, ObjectProfileScope::kIntersection);
         if(object->All_Intersections(ray, depthstack, threadData))
         {
+            profile.Hit();
             bool found = false;
             double tmpDepth = 0;
 
@@ -302,6 +318,46 @@ bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, BB
     return false;
 }
 
+bool Find_Leaf_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, bool bounded, const RayObjectCondition *postcondition, TraceThreadData *threadData)
+{
+    threadData->Stats()[Scene_Object_Tests]++;
+
+    if(bounded && (Ray_In_Bound(ray, object->Bound, threadData) == false))
+        return false;
+
+    IStack depthstack(threadData->stackPool);
+    POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+
+    ObjectProfileScope profile(threadData, object, ObjectProfileScope::kIntersection);
+    if(object->All_Intersections(ray, depthstack, threadData))
+    {
+        profile.Hit();
+        DBL closest = HUGE_VAL;
+        bool found = false;
+        double tmpDepth = 0;
+
+        while(depthstack->size() > 0)
+        {
+            tmpDepth = depthstack->top().Depth;
+            if(tmpDepth < closest && (ray.IsSubsurfaceRay() || tmpDepth >= MIN_ISECT_DEPTH) &&
+               ((postcondition == nullptr) || (*postcondition)(ray, object, tmpDepth)))
+            {
+                *isect = depthstack->top();
+                closest = tmpDepth;
+                found = true;
+            }
+
+            depthstack->pop();
+        }
+
+        return (found == true);
+    }
+
+    POV_REFPOOL_ASSERT(depthstack->empty()); // verify that the IStack is in a cleaned-up condition (again)
+
+    return false;
+}
+
 
 
 /*****************************************************************************
@@ -825,6 +881,20 @@ void Destroy_Object(ObjectPtr Object)
     }
 }
 
+#if POV_OBJECT_PROFILE
+void Set_Profile_Index(ObjectPtr Object, size_t index)
+{
+    Object->profileIndex = index;
+
+    if (dynamic_cast<CompoundObject *>(Object) != nullptr)
+    {
+        vector<ObjectPtr>& children = (dynamic_cast<CompoundObject *> (Object))->children;
+        for (vector<ObjectPtr>::iterator Sib = children.begin(); Sib != children.end(); Sib++)
+            Set_Profile_Index(*Sib, index);
+    }
+}
+#endif
+
 ObjectBase::~ObjectBase()
 {
     Destroy_Transform(Trans);
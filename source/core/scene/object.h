@@ -167,34 +167,48 @@ namespace pov
 //******************************************************************************
 
 /// Abstract base class for all geometric objects.
+///
+/// @note   The data members are ordered by how soon they are needed when a ray is tested against
+///         the object: Those needed to intersect the object come first, so that they share the
+///         object's first cache line with the virtual table pointer, while those only needed to
+///         shade an intersection follow.
+///
 class ObjectBase
 {
     public:
         int Type; // TODO - make obsolete
+        unsigned int Flags;
+        BoundingBox BBox;
+        TRANSFORM *Trans;
+        vector<ObjectPtr> Bound;
         TEXTURE *Texture;
         TEXTURE *Interior_Texture;
         InteriorPtr interior;
-        vector<ObjectPtr> Bound;
         vector<ObjectPtr> Clip;
         vector<LightSource *> LLights;  ///< Used for light groups.
-        BoundingBox BBox;
-        TRANSFORM *Trans;
         SNGL Ph_Density;
         double RadiosityImportance;
         bool RadiosityImportanceSet;
-        unsigned int Flags;
 
 #ifdef OBJECT_DEBUG_HELPER
         ObjectDebugHelper Debug;
 #endif
 
+#if POV_OBJECT_PROFILE
+        UTF8String declareName;     ///< Identifier the object was declared as, if any.
+        size_t profileIndex;        ///< Entry of @ref SceneData::objectProfileSources the object's cost counts towards.
+#endif
+
         /// Construct object from scratch.
         ObjectBase(int t) :
-            Type(t),
-            Texture(nullptr), Interior_Texture(nullptr), interior(), Trans(nullptr),
-            Ph_Density(0), RadiosityImportance(0.0), RadiosityImportanceSet(false), Flags(0)
+            Type(t), Flags(0), Trans(nullptr),
+            Texture(nullptr), Interior_Texture(nullptr), interior(),
+            Ph_Density(0), RadiosityImportance(0.0), RadiosityImportanceSet(false)
         {
             Make_BBox(BBox, -BOUND_HUGE/2.0, -BOUND_HUGE/2.0, -BOUND_HUGE/2.0, BOUND_HUGE, BOUND_HUGE, BOUND_HUGE);
+#if POV_OBJECT_PROFILE
+            profileIndex = 0;
+#endif
         }
 
         /// Construct object as copy of existing one.
@@ -204,12 +218,16 @@ class ObjectBase
         /// @param[in]  transplant  Whether to move data rather than copy it.
         ///
         ObjectBase(int t, ObjectBase& o, bool transplant) :
-            Type(t),
-            Texture(o.Texture), Interior_Texture(o.Interior_Texture), interior(o.interior), Trans(o.Trans),
+            Type(t), Flags(o.Flags), BBox(o.BBox), Trans(o.Trans), Bound(o.Bound),
+            Texture(o.Texture), Interior_Texture(o.Interior_Texture), interior(o.interior),
+            Clip(o.Clip), LLights(o.LLights),
             Ph_Density(o.Ph_Density), RadiosityImportance(o.RadiosityImportance),
-            RadiosityImportanceSet(o.RadiosityImportanceSet), Flags(o.Flags),
-            Bound(o.Bound), Clip(o.Clip), LLights(o.LLights), BBox(o.BBox)
+            RadiosityImportanceSet(o.RadiosityImportanceSet)
         {
+#if POV_OBJECT_PROFILE
+            declareName = o.declareName;
+            profileIndex = o.profileIndex;
+#endif
             if (transplant)
             {
                 o.Texture = nullptr;
@@ -315,6 +333,9 @@ class LightSource : public CompoundObject
         DBL Fade_Distance, Fade_Power;
         int Area_Size1, Area_Size2;
         int Adaptive_Level;
+        int Area_Sampling;
+        /// Precomputed jitter offsets for each grid point, for each of several patterns; empty unless needed.
+        vector<Vector2d> Jitter_Patterns;
         ObjectPtr Projected_Through_Object;
 
         unsigned Light_Type : 8;
@@ -343,6 +364,8 @@ class LightSource : public CompoundObject
         virtual void Scale(const Vector3d&, const TRANSFORM *);
         virtual void Transform(const TRANSFORM *);
         virtual void Compute_BBox() {}
+
+        void Compute_Jitter_Patterns();
 };
 
 
@@ -392,6 +415,90 @@ bool Find_Intersection(Intersection *Ray_Intersection, ObjectPtr Object, const R
 bool Find_Intersection(Intersection *Ray_Intersection, ObjectPtr Object, const Ray& ray, const RayObjectCondition& postcondition, TraceThreadData *Thread);
 bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, BBoxDirection variant, const BBoxVector3d& origin, const BBoxVector3d& invdir, TraceThreadData *ThreadData);
 bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, BBoxDirection variant, const BBoxVector3d& origin, const BBoxVector3d& invdir, const RayObjectCondition& postcondition, TraceThreadData *ThreadData);
+
+/// Find the nearest intersection of a ray with an object whose bounding box is known to be hit.
+///
+/// This is meant for bounding hierarchies that have already tested the ray against the object's
+/// bounding box, and skips that test; the hierarchy should also keep track of which objects have
+/// a `bounded_by` set, so that the object itself is first accessed by its intersection test.
+///
+/// @param[out] isect           Nearest intersection found.
+/// @param[in]  object          Object to intersect.
+/// @param[in]  ray             Ray to intersect the object with.
+/// @param[in]  bounded         Whether the object has a `bounded_by` set to test first.
+/// @param[in]  postcondition   Condition an intersection must satisfy, or `nullptr` for none.
+/// @param[in]  threadData      Thread-specific data.
+/// @return                     `true` if an intersection was found.
+///
+bool Find_Leaf_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, bool bounded, const RayObjectCondition *postcondition, TraceThreadData *threadData);
+
+/// @name Condition Specialisation
+///
+/// Traversal code is templated on the condition types, so that the common conditions that are
+/// always met or merely test object flags compile into loops of their own, free of per-object
+/// virtual calls. @ref Dispatch_Ray_Object_Conditions() picks the matching instantiation once per
+/// ray, and overloads of the intersection functions drop postconditions that are always met.
+///
+/// @{
+
+/// Ray-object condition testing object flags, as substituted for conditions reporting a flag mask.
+struct FlagMaskRayObjectCondition final
+{
+    unsigned int mask;  ///< Flags any of which make an object fail the condition.
+
+    explicit FlagMaskRayObjectCondition(unsigned int m) : mask(m) {}
+    bool operator()(const Ray&, ConstObjectPtr object, DBL) const { return !Test_Flag(object, mask); }
+};
+
+/// Invoke a traversal with the most specialised equivalents of a pair of ray-object conditions.
+///
+/// @param[in]  ray             Ray the conditions are to be applied to.
+/// @param[in]  precondition    Condition an object must meet to be intersected.
+/// @param[in]  postcondition   Condition an intersection must meet to be accepted.
+/// @param[in]  traversal       Functor with a templated `operator()(precondition, postcondition)`.
+/// @return                     Return value of the traversal.
+///
+template<class Traversal>
+bool Dispatch_Ray_Object_Conditions(const Ray& ray, const RayObjectCondition& precondition, const RayObjectCondition& postcondition, Traversal& traversal)
+{
+    TrueRayObjectCondition alwaysMet;
+    unsigned int mask;
+    bool postTrue = (postcondition.GetFlagMask(ray, mask) && (mask == 0));
+
+    if(precondition.GetFlagMask(ray, mask))
+    {
+        if(mask == 0)
+            return (postTrue ? traversal(alwaysMet, alwaysMet) : traversal(alwaysMet, postcondition));
+
+        FlagMaskRayObjectCondition flagTest(mask);
+        return (postTrue ? traversal(flagTest, alwaysMet) : traversal(flagTest, postcondition));
+    }
+
+    return (postTrue ? traversal(precondition, alwaysMet) : traversal(precondition, postcondition));
+}
+
+inline bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, const TrueRayObjectCondition&, TraceThreadData *threadData)
+{
+    return Find_Intersection(isect, object, ray, threadData);
+}
+
+inline bool Find_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, BBoxDirection variant, const BBoxVector3d& origin, const BBoxVector3d& invdir, const TrueRayObjectCondition&, TraceThreadData *threadData)
+{
+    return Find_Intersection(isect, object, ray, variant, origin, invdir, threadData);
+}
+
+inline bool Find_Leaf_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, bool bounded, const RayObjectCondition& postcondition, TraceThreadData *threadData)
+{
+    return Find_Leaf_Intersection(isect, object, ray, bounded, &postcondition, threadData);
+}
+
+inline bool Find_Leaf_Intersection(Intersection *isect, ObjectPtr object, const Ray& ray, bool bounded, const TrueRayObjectCondition&, TraceThreadData *threadData)
+{
+    return Find_Leaf_Intersection(isect, object, ray, bounded, nullptr, threadData);
+}
+
+/// @}
+
 bool Ray_In_Bound(const Ray& ray, const vector<ObjectPtr>& Bounding_Object, TraceThreadData *Thread);
 bool Point_In_Clip(const Vector3d& IPoint, const vector<ObjectPtr>& Clip, TraceThreadData *Thread);
 ObjectPtr Copy_Object(ObjectPtr Old);
@@ -405,6 +512,19 @@ void Destroy_Object(vector<ObjectPtr>& Object);
 void Destroy_Object(ObjectPtr Object);
 void Destroy_Single_Object(ObjectPtr *ObjectPtr);
 
+#if POV_OBJECT_PROFILE
+/// Name and location of a scene-level object, as reported in the object profile.
+struct ObjectSourceInfo : SourceInfo
+{
+    UTF8String  name;   ///< Identifier the object was declared as, if any.
+    ObjectSourceInfo() = default;
+    ObjectSourceInfo(const UTF8String& n, const SourceInfo& o) : SourceInfo(o), name(n) {}
+};
+
+/// Have the cost of an object, including all its children, count towards the given entry of the object profile.
+void Set_Profile_Index(ObjectPtr Object, size_t index);
+#endif
+
 /// @}
 ///
 //##############################################################################
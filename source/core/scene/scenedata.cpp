@@ -42,8 +42,12 @@
 
 #include "base/version_info.h"
 
+#include "core/bounding/flatbvh.h"
+#include "core/bounding/projectionbuffer.h"
+#include "core/lighting/lighttree.h"
 #include "core/material/pattern.h"
 #include "core/material/noise.h"
+#include "core/math/randomsequence.h"
 #include "core/scene/atmosphere.h"
 
 // this must be the last file included
@@ -69,13 +73,25 @@ SceneData::SceneData() :
     languageVersionSet = false;
     languageVersionLate = false;
     warningLevel = 10; // all warnings
+    parseProfile = false;
+    reuseScene = false;
+    incrementalAnimation = false;
+    animationRunId = 0;
     legacyCharset = LegacyCharset::kUnspecified;
     noiseGenerator = kNoiseGen_RangeCorrected;
     explicitNoiseGenerator = false; // scene has not set the noise generator explicitly
     boundingMethod = 0;
+    samplingMethod = kSamplingMethod_Classic;
+    floatPrefilter = false;
+    spectralSamples = 0;
+    rouletteBailout = 0.0;
+    cameraRayTable = false;
     numberOfWaves = 10;
     parsedMaxTraceLevel = MAX_TRACE_LEVEL_DEFAULT;
     parsedAdcBailout = 1.0 / 255.0; // adc bailout sufficient for displays
+    lightCutoff = 0.0;
+    areaLightCacheDistance = 0.0;
+    areaLightCacheTolerance = 0.05;
     workingGamma.reset();
     workingGammaToSRGB.reset();
     inputFileGamma = SRGBGammaCurve::Get();
@@ -86,17 +102,33 @@ SceneData::SceneData() :
     subsurfaceSamplesDiffuse = 50;
     subsurfaceSamplesSingle = 50;
     subsurfaceUseRadiosity = false;
+    subsurfaceMethod = SUBSURFACE_METHOD_PROBE;
+    subsurfacePointCount = 10000;
+    subsurfaceAccuracy = 0.3;
 
     bspMaxDepth = 0;
     bspObjectIsectCost = bspBaseAccessCost = bspChildAccessCost = bspMissChance = 0.0f;
+    bspBuildThreads = 1;
 
     Fractal_Iteration_Stack_Length = 0;
     Max_Blob_Components = 1000; // TODO FIXME - this gets set in the parser but allocated *before* that in the scene data, and if it is 0 here, a malloc may fail there because the memory requested is zero [trf]
     Max_Bounding_Cylinders = 100; // TODO FIXME - see note for Max_Blob_Components
     boundingSlabs = nullptr;
+    flatBVH = nullptr;
+    vistaBuffer = nullptr;
+    lightSourceTree = nullptr;
+    bboxTreeStats.nodes = bboxTreeStats.leaves = 0;
+    bboxTreeStats.cost = 0.0;
+    bboxTreeStats.objectCost = 0.0;
+    bboxTreeRefitted = false;
+
+    outputWidth = 160.0;
 
     splitUnions = false;
     removeBounds = true;
+    useLightBuffer = false;
+    useVistaBuffer = false;
+    boundingRefit = false;
 
     tree = nullptr;
 }
@@ -118,6 +150,14 @@ SceneData::~SceneData()
         Destroy_Rainbow(rainbow);
         rainbow = next;
     }
+    if (flatBVH != nullptr)
+        delete flatBVH;
+    for (vector<ProjectionBuffer*>::iterator i = lightBuffers.begin(); i != lightBuffers.end(); ++i)
+        delete *i;
+    if (vistaBuffer != nullptr)
+        delete vistaBuffer;
+    if (lightSourceTree != nullptr)
+        delete lightSourceTree;
     if (boundingSlabs != nullptr)
         Destroy_BBox_Tree(boundingSlabs);
     for (vector<TrueTypeFont*>::iterator i = TTFonts.begin(); i != TTFonts.end(); ++i)
@@ -43,7 +43,9 @@
 
 #include "base/image/colourspace.h"
 
+#include "core/bounding/boundingbox.h"
 #include "core/lighting/radiosity.h"
+#include "core/lighting/subsurface.h"
 #include "core/scene/camera.h"
 #include "core/shape/truetype.h"
 
@@ -59,6 +61,9 @@ namespace pov
 using namespace pov_base;
 
 class BSPTree;
+class FlatBVH;
+class LightSourceTree;
+class ProjectionBuffer;
 
 struct Fog_Struct;
 struct Rainbow_Struct;
@@ -127,6 +132,16 @@ class SceneData
         bool explicitNoiseGenerator;
         /// bounding method selector
         unsigned int boundingMethod;
+        /// sampler for the stochastic effects (see @ref SamplingMethod)
+        int samplingMethod;
+        /// whether to pre-test triangles and spheres in single precision (flat bounding hierarchies only)
+        bool floatPrefilter;
+        /// weight below which rays are subjected to Russian roulette, or 0 to use the ADC bailout only
+        double rouletteBailout;
+        /// number of wavelengths to trace at dispersive interfaces, or 0 to trace all
+        int spectralSamples;
+        /// whether to look up the primary rays of costly camera types in a per-view table
+        bool cameraRayTable;
         /// Working gamma.
         pov_base::SimpleGammaCurvePtr workingGamma;
         /// Working gamma to sRGB encoding/decoding.
@@ -151,6 +166,12 @@ class SceneData
         int subsurfaceSamplesSingle;
         /// whether to compute radiosity contribution to subsurface effects
         bool subsurfaceUseRadiosity;
+        /// subsurface scattering computation method (SUBSURFACE_METHOD_PROBE or SUBSURFACE_METHOD_POINT_CLOUD)
+        int subsurfaceMethod;
+        /// number of probe lines to distribute the points of each subsurface scattering point cloud
+        int subsurfacePointCount;
+        /// maximum ratio of size to distance for parts of a subsurface scattering point cloud to be evaluated in aggregate
+        double subsurfaceAccuracy;
 
         // ********************************************************************************
         // temporary variables for BSP testing ... we may or may not keep these in future
@@ -161,6 +182,8 @@ class SceneData
         float bspBaseAccessCost;
         float bspChildAccessCost;
         float bspMissChance;
+        unsigned int bspBuildThreads;
+        UCS2String bspCacheFile;
 
         /// set if real-time raytracing is enabled.
         bool realTimeRaytracing;
@@ -178,6 +201,12 @@ class SceneData
         unsigned int parsedMaxTraceLevel;
         /// adc bailout
         DBL parsedAdcBailout;
+        /// light level below which light sources fading with distance are presumed to contribute nothing, or 0
+        DBL lightCutoff;
+        /// maximum distance across which area light shadows may be interpolated, or 0 to always sample them
+        DBL areaLightCacheDistance;
+        /// maximum difference in area light visibility between the shadow samples used for interpolation
+        DBL areaLightCacheTolerance;
         /// radiosity settings
         SceneRadiositySettings radiositySettings;
 
@@ -185,6 +214,8 @@ class SceneData
         PhotonMap surfacePhotonMap;
         /// generated media photon map data // TODO FIXME - technically camera-independent, but computed for every view [trf]
         PhotonMap mediaPhotonMap;
+        /// generated subsurface scattering irradiance point clouds // TODO FIXME - technically camera-independent, but computed on demand by the first view needing them
+        SubsurfacePointClouds subsurfacePointClouds;
 
         ScenePhotonSettings photonSettings; // TODO FIXME - is modified! [trf]
 
@@ -195,10 +226,24 @@ class SceneData
         // name of the parsed file
         UCS2String inputFile; // TODO - handle differently
         UCS2String headerFile;
+        /// directory to cache pre-tokenized include files in, or empty if disabled
+        UCS2String includeCachePath;
+        /// whether to report where parse time was spent
+        bool parseProfile;
+        /// file to write a timeline of tasks, phases and blocks to, or empty if disabled
+        UCS2String eventTraceFile;
+#if POV_OBJECT_PROFILE
+        /// scene-level objects to gather run-time statistics for, by profile index;
+        /// the first entry stands for all objects not attributed to any other entry
+        vector<ObjectSourceInfo> objectProfileSources;
+#endif
 
         /// Aspect ratio of the output image.
         DBL aspectRatio;
 
+        /// Width of the output image, in pixels.
+        DBL outputWidth;
+
         int defaultFileType;
 
         FrameSettings frameSettings; // TODO - move ???
@@ -206,6 +251,12 @@ class SceneData
         Camera parsedCamera; // TODO - handle differently or move to parser
         bool clocklessAnimation; // TODO - this is support for an experimental feature and may be changed or removed
         vector<Camera> cameras; // TODO - this is support for an experimental feature and may be changed or removed
+        /// whether the scene will be rendered for several animation frames, each with the next of its @ref cameras
+        bool reuseScene;
+        /// whether objects that do not depend on the clock may be carried over from the previous animation frame
+        bool incrementalAnimation;
+        /// identifies the animation the scene is a frame of, or zero if none
+        POV_LONG animationRunId;
 
         // this is for fractal support
         int Fractal_Iteration_Stack_Length; // TODO - move somewhere else
@@ -213,10 +264,20 @@ class SceneData
         // lathe and sor support (bounding cylinders)
         unsigned int Max_Bounding_Cylinders; // TODO - move somewhere else
         BBOX_TREE *boundingSlabs;
+        FlatBVH *flatBVH;
+        /// Light buffer per entry in @ref lightSources, or `nullptr` where not applicable.
+        vector<ProjectionBuffer *> lightBuffers;
+        /// Vista buffer, or `nullptr` if not in use.
+        ProjectionBuffer *vistaBuffer;
+        /// Hierarchy over the global light sources' regions of influence, or `nullptr` if not in use.
+        LightSourceTree *lightSourceTree;
 
         // TODO FIXME move to parser somehow
         bool splitUnions; // INI option, defaults to false
         bool removeBounds; // INI option, defaults to true
+        bool useLightBuffer; // INI option, defaults to false
+        bool useVistaBuffer; // INI option, defaults to false
+        bool boundingRefit; // INI option, defaults to false
 
         // experimental
         BSPTree *tree;
@@ -227,6 +288,10 @@ class SceneData
         unsigned int nodes, splitNodes, objectNodes, emptyNodes, maxObjects, maxDepth, aborts;
         float averageObjects, averageDepth, averageAborts, averageAbortObjects;
 
+        // bounding box hierarchy statistics
+        BBoxTreeStatistics bboxTreeStats;
+        bool bboxTreeRefitted; ///< Whether the hierarchy was carried over from the previous frame.
+
 
         /// Convenience function to determine the effective SDL version.
         ///
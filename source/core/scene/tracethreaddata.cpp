@@ -53,8 +53,9 @@ namespace pov
 TraceThreadData::TraceThreadData(shared_ptr<SceneData> sd, size_t seed) :
     sceneData(sd),
     qualityFlags(9),
-    stochasticRandomGenerator(GetRandomDoubleGenerator(0.0,1.0)),
-    stochasticRandomSeedBase(seed)
+    stochasticRandomGenerator(seed),
+    stochasticRandomSeedBase(seed),
+    lightSources(sd->lightSources)
 {
     for(int i = 0; i < 4; i++)
         Fractal_IStack[i] = nullptr;
@@ -62,7 +63,7 @@ TraceThreadData::TraceThreadData(shared_ptr<SceneData> sd, size_t seed) :
     Max_Blob_Queue_Size = 1;
     Blob_Coefficient_Count = sceneData->Max_Blob_Components * 5;
     Blob_Interval_Count = sceneData->Max_Blob_Components * 2;
-    Blob_Queue = reinterpret_cast<void **>(POV_MALLOC(sizeof(void *), "Blob Queue"));
+    Blob_Queue = reinterpret_cast<const void **>(POV_MALLOC(sizeof(const void *), "Blob Queue"));
     Blob_Coefficients = reinterpret_cast<DBL *>(POV_MALLOC(sizeof(DBL) * Blob_Coefficient_Count, "Blob Coefficients"));
     Blob_Intervals = new Blob_Interval_Struct [Blob_Interval_Count];
     isosurfaceData = reinterpret_cast<ISO_ThreadData *>(POV_MALLOC(sizeof(ISO_ThreadData), "Isosurface Data"));
@@ -75,19 +76,19 @@ TraceThreadData::TraceThreadData(shared_ptr<SceneData> sd, size_t seed) :
     isosurfaceData->Vlength = 0.0;
 
     BCyl_Intervals.reserve(4*sceneData->Max_Bounding_Cylinders);
-    BCyl_RInt.reserve(2*sceneData->Max_Bounding_Cylinders);
-    BCyl_HInt.reserve(2*sceneData->Max_Bounding_Cylinders);
 
     Facets_Last_Seed = 0x80000000;
 
     timeType = kUnknownTime;
     cpuTime = 0;
     realTime = 0;
+    for (int i = 0; i < kHardwareCounterCount; ++i)
+        hardwareCounts[i] = -1;
 
-    stochasticRandomGenerator->Seed(stochasticRandomSeedBase);
-
-    for(vector<LightSource *>::iterator it = sceneData->lightSources.begin(); it != sceneData->lightSources.end(); it++)
-        lightSources.push_back(static_cast<LightSource *> (Copy_Object(*it)));
+#if POV_OBJECT_PROFILE
+    objectProfile.resize(max<size_t>(sceneData->objectProfileSources.size(), 1));
+    objectProfileNested = 0;
+#endif
 
     // all of these are for photons
     LightSource *photonLight = nullptr;
@@ -99,23 +100,18 @@ TraceThreadData::TraceThreadData(shared_ptr<SceneData> sd, size_t seed) :
     passThruThis = false;           // is this a pass-through object?
     passThruPrev = false;           // was the previous object pass-through?
     Light_Is_Global = false;       // is the current light global? (not part of a light_group?)
+    photonDepositProbe = nullptr;
 
-    CrCache_MaxAge = 1;
     progress_index = 0;
 
-    surfacePhotonMap = new PhotonMap();
-    mediaPhotonMap = new PhotonMap();
-
-    // advise the crackle cache's unordered_map that we don't mind hash collisions
-    // while this is a very high load factor, the simple fact is that the cost of
-    // allocating memory at render time (each insert into the table requires an alloc
-    // as the container doesn't pre-emptively allocate, unlike e.g. std::vector) is
-    // quite high, particularly when we have multiple threads contending for the heap
-    // lock.
-    mCrackleCache.max_load_factor(50.0);
+    surfacePhotonSlice = new PhotonMapSlice(&sd->surfacePhotonMap);
+    mediaPhotonSlice = new PhotonMapSlice(&sd->mediaPhotonMap);
 
     numberOfWaves = sd->numberOfWaves;
     Initialize_Waves(waveFrequencies, waveSources, numberOfWaves);
+
+    if (sd->functionContextFactory != nullptr)
+        sd->functionContextFactory->PreallocateContexts(this);
 }
 
 TraceThreadData::~TraceThreadData()
@@ -127,48 +123,29 @@ TraceThreadData::~TraceThreadData()
     POV_FREE(Blob_Queue);
     POV_FREE(isosurfaceData);
     Fractal::Free_Iteration_Stack(Fractal_IStack);
-    delete surfacePhotonMap;
-    delete mediaPhotonMap;
+    delete surfacePhotonSlice;
+    delete mediaPhotonSlice;
     delete[] Blob_Intervals;
-    for(vector<LightSource *>::iterator it = lightSources.begin(); it != lightSources.end(); it++)
-        Destroy_Object(*it);
 }
 
 void TraceThreadData::AfterTile()
 {
-    CrackleCache::iterator it;
-
     // this serves as a render block index
     progress_index++;
 
-    // probably we ought to have a means for the end-user to choose the preferred maximum bytes reserved for the cache
-    // for now, we have hard-coded values. we also do not discard any entries that are from the current block, even if
-    // the cache size is exceeded. also, note that the cache size is per-thread. finally, don't forget that erasing
-    // elements doesn't in and of itself return the freed memory to the heap.
-    if (mCrackleCache.size() * sizeof(CrackleCache::value_type) < 15 * 1024 * 1024)
-        return;
-    while (mCrackleCache.size() * sizeof(CrackleCache::value_type) > 10 * 1024 * 1024)
-    {
-        // search the cache for the oldest entries
-        int oldest = std::numeric_limits<int>::max();
-        for (it = mCrackleCache.begin(); it != mCrackleCache.end(); it++)
-            if (it->second.lastUsed < oldest)
-                oldest = (int) it->second.lastUsed;
-
-        // don't remove any entries from the most recent block
-        if (oldest == progress_index - 1)
-            break;
-
-        for (it = mCrackleCache.begin(); it != mCrackleCache.end(); )
-        {
-            if (it->second.lastUsed == oldest)
-            {
-                it = mCrackleCache.erase(it);
-                continue;
-            }
-            it++;
-        }
-    }
+    // NB: the crackle cache is bounded in size and evicts cells as needed, so it needs no attention here.
+}
+
+#if POV_OBJECT_PROFILE
+ObjectProfile& ObjectProfile::operator+=(const ObjectProfile& o)
+{
+    tests       += o.tests;
+    hits        += o.hits;
+    shadings    += o.shadings;
+    testTime    += o.testTime;
+    shadingTime += o.shadingTime;
+    return *this;
 }
+#endif
 
 }
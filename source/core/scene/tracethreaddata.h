@@ -39,9 +39,11 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include <chrono>
 #include <vector>
 #include <stack>
 
+#include "base/timer.h"
 #include "base/types.h"
 
 #include "core/coretypes.h"
@@ -66,9 +68,25 @@ using namespace pov_base;
 class SceneData;
 struct ISO_ThreadData;
 
-class PhotonMap;
+class PhotonMapSlice;
+class PhotonDepositProbe;
 struct Blob_Interval_Struct;
 
+#if POV_OBJECT_PROFILE
+/// Run-time statistics of a scene-level object, as gathered by a single thread.
+struct ObjectProfile
+{
+    POV_ULONG tests;            ///< Number of intersection tests passing the object's bounding box.
+    POV_ULONG hits;             ///< Number of intersection tests finding any intersection.
+    POV_ULONG shadings;         ///< Number of intersections with the object shaded.
+    POV_ULONG testTime;         ///< Time in nanoseconds spent on intersection tests.
+    POV_ULONG shadingTime;      ///< Time in nanoseconds spent on texture evaluation, not counting secondary rays.
+
+    ObjectProfile() : tests(0), hits(0), shadings(0), testTime(0), shadingTime(0) {}
+    ObjectProfile& operator+=(const ObjectProfile& o);
+};
+#endif
+
 /// Class holding parser thread specific data.
 class TraceThreadData : public ThreadData
 {
@@ -93,7 +111,7 @@ class TraceThreadData : public ThreadData
 
         DBL *Fractal_IStack[4];
         BBoxPriorityQueue Mesh_Queue;
-        void **Blob_Queue;
+        const void **Blob_Queue;
         unsigned int Max_Blob_Queue_Size;
         DBL *Blob_Coefficients;
         Blob_Interval_Struct *Blob_Intervals;
@@ -101,8 +119,6 @@ class TraceThreadData : public ThreadData
         int Blob_Interval_Count;
         ISO_ThreadData *isosurfaceData;     ///< @todo We may want to move this data block to the isosurface code as a local variable.
         vector<BCYL_INT> BCyl_Intervals;
-        vector<BCYL_INT> BCyl_RInt;
-        vector<BCYL_INT> BCyl_HInt;
         IStackPool stackPool;
         vector<GenericFunctionContextPtr> functionContextPool;
         int Facets_Last_Seed;
@@ -110,15 +126,18 @@ class TraceThreadData : public ThreadData
         Vector3d Facets_Cube[81];
 
         /// Common random number generator for all stochastic stuff
-        SeedableDoubleGeneratorPtr stochasticRandomGenerator;
+        PCGDoubleGenerator stochasticRandomGenerator;
         size_t stochasticRandomSeedBase;
 
-        // TODO FIXME - thread-local copy of lightsources. we need this
-        // because various parts of the lighting code seem to make changes
-        // to the lightsource object passed to them (this is not confined
-        // just to the area light shadow code). This code ought to be fixed
-        // to treat the lightsource as const, after which this can go away.
-        vector<LightSource *> lightSources;
+        /// Low-discrepancy sample sets for the stochastic effects, if the scene asks for them
+        /// (see @ref SceneData::samplingMethod).
+        LowDiscrepancySampler sampler;
+
+        /// Light sources of the scene.
+        /// @note
+        ///     The light sources are shared by all threads; the lighting code treats them as read-only,
+        ///     keeping any per-thread state (such as the shadow caches) in the @ref Trace object instead.
+        const vector<LightSource *>& lightSources;
 
         // all of these are for photons
         // most of them should be refactored into parameters, return values, or other objects
@@ -132,10 +151,12 @@ class TraceThreadData : public ThreadData
         int passThruThis;           // is this a pass-through object encountered before the target?
         int passThruPrev;           // was the previous object a pass-through object encountered before the target?
         bool Light_Is_Global;       // is the current light global? (not part of a light_group?)
-        PhotonMap* surfacePhotonMap;
-        PhotonMap* mediaPhotonMap;
+        PhotonMapSlice* surfacePhotonSlice;
+        PhotonMapSlice* mediaPhotonSlice;
+        PhotonDepositProbe* photonDepositProbe; // if set, receives the photons instead of the photon maps
 
         CrackleCache mCrackleCache;
+        PatternMemo mPatternMemo;
 
         // data for waves and ripples pattern
         unsigned int numberOfWaves;
@@ -143,10 +164,9 @@ class TraceThreadData : public ThreadData
         vector<Vector3d> waveSources;
 
         /// Called after a rectangle is finished.
-        /// Used for crackle cache expiry.
         void AfterTile();
 
-        /// Used by the crackle pattern to indicate age of cache entries.
+        /// Used by per-block caches to indicate age of cache entries.
         /// @return     The index of the current rectangle rendered.
         inline size_t ProgressIndex() const { return progress_index; }
 
@@ -164,8 +184,17 @@ class TraceThreadData : public ThreadData
         TimeType timeType;
         POV_LONG cpuTime;
         POV_LONG realTime;
+        /// Hardware performance counts, or -1 where not supported.
+        POV_LONG hardwareCounts[kHardwareCounterCount];
         QualityFlags qualityFlags; // TODO FIXME - remove again
 
+#if POV_OBJECT_PROFILE
+        /// Run-time statistics per entry of @ref SceneData::objectProfileSources.
+        vector<ObjectProfile> objectProfile;
+        /// Time in nanoseconds spent in profiled scopes nested in the current one.
+        POV_ULONG objectProfileNested;
+#endif
+
         inline shared_ptr<const SceneData> GetSceneData() const { return sceneData; }
 
     protected:
@@ -184,12 +213,71 @@ class TraceThreadData : public ThreadData
         /// not available
         TraceThreadData& operator=(const TraceThreadData&);
 
-        /// current number of Tiles to expire crackle cache entries after
-        size_t CrCache_MaxAge;
-        /// current tile index (for crackle cache expiry)
+        /// current tile index (for cache expiry)
         size_t progress_index;
 };
 
+/// Helper class to count the cost of a scope towards an object's run-time statistics.
+///
+/// Time spent in nested scopes, e.g. on the secondary rays spawned while shading an object,
+/// counts towards the objects of the nested scopes only.
+///
+/// @note   Unless @ref POV_OBJECT_PROFILE is enabled, this class does nothing.
+///
+class ObjectProfileScope final
+{
+    public:
+
+        enum Kind
+        {
+            kIntersection,
+            kShading,
+        };
+
+#if POV_OBJECT_PROFILE
+        ObjectProfileScope(TraceThreadData *threadData, ConstObjectPtr object, Kind kind) :
+            mpThreadData(threadData),
+            mKind(kind),
+            mNested(threadData->objectProfileNested)
+        {
+            size_t index = (object != nullptr) ? object->profileIndex : 0;
+            if (index >= threadData->objectProfile.size())
+                threadData->objectProfile.resize(index + 1);
+            mpProfile = &threadData->objectProfile[index];
+            if (kind == kIntersection)
+                ++mpProfile->tests;
+            else
+                ++mpProfile->shadings;
+            threadData->objectProfileNested = 0;
+            mStart = std::chrono::steady_clock::now();
+        }
+
+        ~ObjectProfileScope()
+        {
+            POV_ULONG elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStart).count();
+            POV_ULONG exclusive = elapsed - min(elapsed, mpThreadData->objectProfileNested);
+            if (mKind == kIntersection)
+                mpProfile->testTime += exclusive;
+            else
+                mpProfile->shadingTime += exclusive;
+            mpThreadData->objectProfileNested = mNested + elapsed;
+        }
+
+        void Hit() { ++mpProfile->hits; }
+
+    private:
+
+        TraceThreadData*                        mpThreadData;
+        ObjectProfile*                          mpProfile;
+        Kind                                    mKind;
+        POV_ULONG                               mNested;
+        std::chrono::steady_clock::time_point   mStart;
+#else
+        ObjectProfileScope(TraceThreadData *, ConstObjectPtr, Kind) {}
+        void Hit() {}
+#endif
+};
+
 /// @}
 ///
 //##############################################################################
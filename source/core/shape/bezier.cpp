@@ -42,8 +42,11 @@
 
 #include "base/pov_err.h"
 
+#include "core/bounding/boundingbox.h"
 #include "core/math/matrix.h"
 #include "core/render/ray.h"
+#include "core/scene/camera.h"
+#include "core/scene/scenedata.h"
 #include "core/scene/tracethreaddata.h"
 
 // this must be the last file included
@@ -62,6 +65,9 @@ const DBL BEZIER_TOLERANCE = 1.0e-5;
 #define BEZIER_INTERIOR_NODE 0
 #define BEZIER_LEAF_NODE 1
 
+/* Subdivision level at which an adaptive tessellation stops refining. */
+const int BEZIER_MAX_TESSELLATION_DEPTH = 7;
+
 
 /*****************************************************************************
 *
@@ -781,6 +787,12 @@ void BicubicPatch::Precompute_Patch_Values()
 
         Node_Tree = bezier_tree_builder(&Control_Points, 0.0, 1.0, 0.0, 1.0, 0, max_depth_reached);
     }
+    else if (Patch_Type == 2)
+    {
+        /* The tessellation depends on the view, so it is made on first use. */
+
+        destroy_tessellations();
+    }
 }
 
 
@@ -1547,6 +1559,609 @@ int BicubicPatch::bezier_tree_walker(const BasicRay &ray, const BEZIER_NODE *Nod
 
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   get_tessellation
+*
+* INPUT
+*
+*   Thread - Thread data
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   const Bezier_Tessellation * - adaptive tessellation for the current view
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Get the adaptive tessellation of a type 2 patch, making it if there is
+*   none yet, or if the one there is was made for a different camera (such
+*   as the one in effect when trace() was used while parsing). The first
+*   thread to get here makes it while the others wait, after which it is
+*   shared by all of them. Replaced tessellations are kept until the patch
+*   is destroyed, as other threads may still be using them.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+static bool same_view(const Bezier_Tessellation *Tess, const Camera& camera, DBL width)
+{
+    return ((Tess != nullptr) &&
+            (Tess->Camera_Type == camera.Type) && (Tess->Width == width) &&
+            (Tess->Location - camera.Location).IsNull() &&
+            (Tess->Direction - camera.Direction).IsNull() &&
+            (Tess->Right - camera.Right).IsNull());
+}
+
+const Bezier_Tessellation *BicubicPatch::get_tessellation(TraceThreadData *Thread)
+{
+    const SceneData& scene = *Thread->GetSceneData();
+    const Camera& camera = scene.parsedCamera;
+    Bezier_Tessellation *Tess;
+    vector<Bezier_Triangle> Triangles;
+    BBOX_TREE **Elements, *Root;
+    Vector3d Mins, Maxs, Corner;
+    DBL Pixel_Size, Pixel_Angle;
+    size_t i, n;
+
+    Tess = Tessellation.load(std::memory_order_acquire);
+
+    if (same_view(Tess, camera, scene.outputWidth))
+        return Tess;
+
+    boost::mutex::scoped_lock lock(Tessellation_Mutex);
+
+    Tess = Tessellation.load(std::memory_order_acquire);
+
+    if (same_view(Tess, camera, scene.outputWidth))
+        return Tess;
+
+    if (Tess != nullptr)
+        Retired_Tessellations.push_back(Tess);
+
+    /*
+     * A pixel covers Pixel_Size + d * Pixel_Angle units of a surface facing
+     * the camera at a distance d.
+     */
+
+    Pixel_Size = 0.0;
+    Pixel_Angle = 0.0;
+
+    if (camera.Type == ORTHOGRAPHIC_CAMERA)
+        Pixel_Size = camera.Right.length() / scene.outputWidth;
+    else if (camera.Type != PERSPECTIVE_CAMERA)
+        Pixel_Angle = camera.Angle * M_PI_180 / scene.outputWidth;
+
+    if ((Pixel_Size <= 0.0) && (Pixel_Angle <= 0.0) && (camera.Direction.length() > EPSILON))
+        Pixel_Angle = camera.Right.length() / (camera.Direction.length() * scene.outputWidth);
+
+    Tess = new Bezier_Tessellation;
+
+    Tess->Location    = camera.Location;
+    Tess->Direction   = camera.Direction;
+    Tess->Right       = camera.Right;
+    Tess->Camera_Type = camera.Type;
+    Tess->Width       = scene.outputWidth;
+
+    tessellate_subpatch(&Control_Points, 0.0, 1.0, 0.0, 1.0, 0, camera.Location, Pixel_Size, Pixel_Angle, Triangles);
+
+    n = Triangles.size();
+
+    if (n > 0)
+    {
+        /* Build a bounding hierarchy over the triangles. */
+
+        Elements = reinterpret_cast<BBOX_TREE **>(POV_MALLOC(n*sizeof(BBOX_TREE *), "bicubic patch tessellation"));
+
+        for (i = 0; i < n; i++)
+        {
+            Elements[i] = reinterpret_cast<BBOX_TREE *>(POV_MALLOC(sizeof(BBOX_TREE), "bicubic patch tessellation"));
+
+            Elements[i]->Infinite = false;
+            Elements[i]->Entries  = 0;
+            Elements[i]->Node     = reinterpret_cast<BBOX_TREE **>(&Triangles[i]);
+
+            Mins = Maxs = Triangles[i].P0;
+
+            Corner = Triangles[i].P0 + Triangles[i].E1;
+            Mins = min(Mins, Corner);
+            Maxs = max(Maxs, Corner);
+
+            Corner = Triangles[i].P0 + Triangles[i].E2;
+            Mins = min(Mins, Corner);
+            Maxs = max(Maxs, Corner);
+
+            Make_BBox_from_min_max(Elements[i]->BBox, Mins, Maxs);
+        }
+
+        Build_BBox_Tree_SAH(&Root, n, Elements, 0, nullptr);
+
+        POV_FREE(Elements);
+
+        Tess->Triangles.reserve(n);
+
+        Tess->Tree.resize(1);
+
+        if (Root->Entries == 0)
+        {
+            /* A lone triangle. */
+
+            Tess->Tree[0].First = 0;
+            Tess->Tree[0].Count = 1;
+            Tess->Tree[0].Leaf  = true;
+
+            Make_min_max_from_BBox(Tess->Tree[0].Min, Tess->Tree[0].Max, Root->BBox);
+
+            Tess->Triangles.push_back(Triangles[0]);
+        }
+        else
+            flatten_tessellation_hierarchy(Tess, Root, 0);
+
+        Destroy_BBox_Tree(Root);
+    }
+
+    Tessellation.store(Tess, std::memory_order_release);
+
+    return Tess;
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   tessellate_subpatch
+*
+* INPUT
+*
+*   Patch       - Control points of the subpatch
+*   u0, u1      - Range of the subpatch in u
+*   v0, v1      - Range of the subpatch in v
+*   depth       - Subdivision level of the subpatch
+*   Location    - Camera location
+*   Pixel_Size  - Size of a pixel at the camera
+*   Pixel_Angle - Growth of the size of a pixel with distance
+*
+* OUTPUT
+*
+*   Triangles
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Split the subpatch until it deviates from flat by no more than the
+*   flatness, in pixels, as seen from the camera, and add the two triangles
+*   of each resulting piece. Pieces close to the camera are split the most.
+*   The larger of u_steps and v_steps sets a minimum number of splits.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void BicubicPatch::tessellate_subpatch(const ControlPoints *Patch, DBL u0, DBL u1, DBL v0, DBL v1, int depth, const Vector3d& Location, DBL Pixel_Size, DBL Pixel_Angle, vector<Bezier_Triangle>& Triangles) const
+{
+    ControlPoints Lower_Left, Lower_Right;
+    ControlPoints Upper_Left, Upper_Right;
+    Vector3d center;
+    DBL radiusSqr, Distance, Flatness, ut, vt;
+    DBL uu[3], vv[3];
+
+    bezier_bounding_sphere(Patch, center, &radiusSqr);
+
+    Distance = max(0.0, (center - Location).length() - sqrt(radiusSqr));
+
+    Flatness = determine_subpatch_flatness(Patch);
+
+    if ((depth >= BEZIER_MAX_TESSELLATION_DEPTH) ||
+        ((depth >= U_Steps) && (depth >= V_Steps) &&
+         (Flatness >= 0.0) && (Flatness <= Flatness_Value * (Pixel_Size + Distance * Pixel_Angle))))
+    {
+        /* Same split into triangles as the leaves of a type 1 patch. */
+
+        uu[0] = u0; uu[1] = u0; uu[2] = u1;
+        vv[0] = v0; vv[1] = v1; vv[2] = v1;
+
+        add_tessellation_triangle((*Patch)[0][0], (*Patch)[0][3], (*Patch)[3][3], uu, vv, Triangles);
+
+        uu[1] = u1;
+        vv[2] = v0;
+
+        add_tessellation_triangle((*Patch)[0][0], (*Patch)[3][3], (*Patch)[3][0], uu, vv, Triangles);
+
+        return;
+    }
+
+    ut = (u0 + u1) / 2.0;
+    vt = (v0 + v1) / 2.0;
+
+    bezier_split_left_right(Patch, &Lower_Left, &Lower_Right);
+    bezier_split_up_down(&Lower_Left, &Lower_Left, &Upper_Left);
+    bezier_split_up_down(&Lower_Right, &Lower_Right, &Upper_Right);
+
+    tessellate_subpatch(&Lower_Left, u0, ut, v0, vt, depth + 1, Location, Pixel_Size, Pixel_Angle, Triangles);
+    tessellate_subpatch(&Upper_Left, u0, ut, vt, v1, depth + 1, Location, Pixel_Size, Pixel_Angle, Triangles);
+    tessellate_subpatch(&Lower_Right, ut, u1, v0, vt, depth + 1, Location, Pixel_Size, Pixel_Angle, Triangles);
+    tessellate_subpatch(&Upper_Right, ut, u1, vt, v1, depth + 1, Location, Pixel_Size, Pixel_Angle, Triangles);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   add_tessellation_triangle
+*
+* INPUT
+*
+*   A, B, C - Corners
+*   uu, vv  - Patch coordinates of the corners
+*
+* OUTPUT
+*
+*   Triangles
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Add a triangle to a tessellation, with the surface normals at its
+*   corners, unless it is degenerate.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void BicubicPatch::add_tessellation_triangle(const Vector3d& A, const Vector3d& B, const Vector3d& C, const DBL uu[3], const DBL vv[3], vector<Bezier_Triangle>& Triangles) const
+{
+    Bezier_Triangle Triangle;
+    Vector3d P;
+
+    Triangle.P0 = A;
+    Triangle.E1 = B - A;
+    Triangle.E2 = C - A;
+
+    if (cross(Triangle.E1, Triangle.E2).lengthSqr() <= BEZIER_EPSILON * Triangle.E1.lengthSqr() * Triangle.E2.lengthSqr())
+        return;
+
+    for (int i = 0; i < 3; i++)
+    {
+        bezier_value(&Control_Points, uu[i], vv[i], P, Triangle.N[i]);
+
+        Triangle.U[i] = uu[i];
+        Triangle.V[i] = vv[i];
+    }
+
+    Triangles.push_back(Triangle);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   flatten_tessellation_hierarchy
+*
+* INPUT
+*
+*   Tess  - Tessellation
+*   Node  - Node of the hierarchy built by Build_BBox_Tree_SAH()
+*   index - Slot of the node in the node array
+*
+* OUTPUT
+*
+*   Tess
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Store a node in the node array, gathering its triangle children into a
+*   leaf of their own, and recurse into its other children.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void BicubicPatch::flatten_tessellation_hierarchy(Bezier_Tessellation *Tess, const BBOX_TREE *Node, int index)
+{
+    Vector3d Min, Max;
+    int i, k, first, count, triangles;
+
+    triangles = 0;
+    count = 0;
+
+    for (i = 0; i < Node->Entries; i++)
+    {
+        if (Node->Node[i]->Entries == 0)
+            triangles++;
+        else
+            count++;
+    }
+
+    if (triangles > 0)
+        count++;
+
+    first = (int)Tess->Tree.size();
+
+    Tess->Tree.resize(first + count);
+
+    k = first;
+
+    if (triangles > 0)
+    {
+        Bezier_Tree_Node& Leaf = Tess->Tree[k++];
+
+        Leaf.First = (int)Tess->Triangles.size();
+        Leaf.Count = triangles;
+        Leaf.Leaf  = true;
+
+        for (i = 0; i < Node->Entries; i++)
+        {
+            if (Node->Node[i]->Entries == 0)
+            {
+                Tess->Triangles.push_back(*reinterpret_cast<const Bezier_Triangle *>(Node->Node[i]->Node));
+
+                Make_min_max_from_BBox(Min, Max, Node->Node[i]->BBox);
+
+                if (Tess->Triangles.size() == (size_t)Leaf.First + 1)
+                {
+                    Leaf.Min = Min;
+                    Leaf.Max = Max;
+                }
+                else
+                {
+                    Leaf.Min = min(Leaf.Min, Min);
+                    Leaf.Max = max(Leaf.Max, Max);
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < Node->Entries; i++)
+    {
+        if (Node->Node[i]->Entries != 0)
+            flatten_tessellation_hierarchy(Tess, Node->Node[i], k++);
+    }
+
+    /* The node's box encloses those of its children. */
+
+    Bezier_Tree_Node& Inner = Tess->Tree[index];
+
+    Inner.First = first;
+    Inner.Count = count;
+    Inner.Leaf  = false;
+    Inner.Min   = Tess->Tree[first].Min;
+    Inner.Max   = Tess->Tree[first].Max;
+
+    for (k = first + 1; k < first + count; k++)
+    {
+        Inner.Min = min(Inner.Min, Tess->Tree[k].Min);
+        Inner.Max = max(Inner.Max, Tess->Tree[k].Max);
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   intersect_tessellation_node
+*
+* INPUT
+*
+*   ray         - Ray to test
+*   Tess        - Tessellation
+*   Node        - Node of the tessellation's hierarchy, known to be hit by the ray
+*   Depth_Stack - Intersection stack
+*   Thread      - Thread data
+*
+* OUTPUT
+*
+*   Depth_Stack
+*
+* RETURNS
+*
+*   int - number of intersections found
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Intersect the triangles of a leaf, interpolating the surface normals
+*   and patch coordinates of their corners, or recurse into those children
+*   of an inner node whose boxes the ray passes through.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+int BicubicPatch::intersect_tessellation_node(const BasicRay &ray, const Bezier_Tessellation *Tess, const Bezier_Tree_Node *Node, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    const Bezier_Tree_Node *Child;
+    const Bezier_Triangle *Triangle;
+    Vector3d pvec, tvec, qvec, P, N;
+    Vector2d UV, uv_point, tpoint;
+    DBL det, a, b, r, Depth, t0, t1, tmin, tmax;
+    int i, j, cnt = 0;
+
+    if (Node->Leaf)
+    {
+        for (i = Node->First; i < Node->First + Node->Count; i++)
+        {
+            Triangle = &Tess->Triangles[i];
+
+            pvec = cross(ray.Direction, Triangle->E2);
+
+            det = dot(Triangle->E1, pvec);
+
+            if (fabs(det) < BEZIER_EPSILON)
+                continue;
+
+            det = 1.0 / det;
+
+            tvec = ray.Origin - Triangle->P0;
+
+            a = dot(tvec, pvec) * det;
+
+            if ((a < 0.0) || (a > 1.0))
+                continue;
+
+            qvec = cross(tvec, Triangle->E1);
+
+            b = dot(ray.Direction, qvec) * det;
+
+            if ((b < 0.0) || (a + b > 1.0))
+                continue;
+
+            Depth = dot(Triangle->E2, qvec) * det;
+
+            if (Depth < BEZIER_TOLERANCE)
+                continue;
+
+            P = ray.Evaluate(Depth);
+
+            if (!Clip.empty() && !Point_In_Clip(P, Clip, Thread))
+                continue;
+
+            r = 1.0 - a - b;
+
+            N = Triangle->N[0] * r + Triangle->N[1] * a + Triangle->N[2] * b;
+
+            if (N.lengthSqr() > BEZIER_EPSILON)
+                N.normalize();
+            else
+                N = Vector3d(1.0, 0.0, 0.0);
+
+            /* transform current point from uv space to texture space */
+            uv_point[0] = r * Triangle->V[0] + a * Triangle->V[1] + b * Triangle->V[2];
+            uv_point[1] = r * Triangle->U[0] + a * Triangle->U[1] + b * Triangle->U[2];
+            Compute_Texture_UV(uv_point, ST, tpoint);
+
+            UV[U] = tpoint[0];
+            UV[V] = tpoint[1];
+            Depth_Stack->push(Intersection(Depth, P, N, UV, this));
+
+            cnt++;
+        }
+
+        return (cnt);
+    }
+
+    for (i = 0; i < Node->Count; i++)
+    {
+        Child = &Tess->Tree[Node->First + i];
+
+        tmin = 0.0;
+        tmax = BOUND_HUGE;
+
+        for (j = X; j <= Z; j++)
+        {
+            if (ray.Direction[j] == 0.0)
+            {
+                if ((ray.Origin[j] < Child->Min[j]) || (ray.Origin[j] > Child->Max[j]))
+                    break;
+            }
+            else
+            {
+                t0 = (Child->Min[j] - ray.Origin[j]) / ray.Direction[j];
+                t1 = (Child->Max[j] - ray.Origin[j]) / ray.Direction[j];
+
+                if (t0 > t1)
+                    std::swap(t0, t1);
+
+                tmin = max(tmin, t0);
+                tmax = min(tmax, t1);
+
+                if (tmin > tmax)
+                    break;
+            }
+        }
+
+        if (j > Z)
+            cnt += intersect_tessellation_node(ray, Tess, Child, Depth_Stack, Thread);
+    }
+
+    return (cnt);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   destroy_tessellations
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Free the adaptive tessellation of the patch, and those it replaced.
+*   Only to be used while no ray can be tested against the patch.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void BicubicPatch::destroy_tessellations()
+{
+    delete Tessellation.exchange(nullptr);
+
+    for (vector<Bezier_Tessellation *>::iterator i = Retired_Tessellations.begin(); i != Retired_Tessellations.end(); ++i)
+        delete *i;
+
+    Retired_Tessellations.clear();
+}
+
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1628,6 +2243,17 @@ bool BicubicPatch::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceT
 
             break;
 
+        case 2:
+
+            {
+                const Bezier_Tessellation *Tess = get_tessellation(Thread);
+
+                if (!Tess->Tree.empty())
+                    cnt = intersect_tessellation_node(ray, Tess, &Tess->Tree[0], Depth_Stack, Thread);
+            }
+
+            break;
+
         default:
 
             throw POV_EXCEPTION_STRING("Bad patch type in All_Bicubic_Patch_Intersections.");
@@ -1921,6 +2547,8 @@ BicubicPatch::BicubicPatch() : NonsolidObject(BICUBIC_PATCH_OBJECT)
     Node_Tree = nullptr;
     Weights = nullptr;
 
+    Tessellation = nullptr;
+
     /*
      * NOTE: Control_Points[4][4] is initialized in Parse_Bicubic_Patch.
      * Bounding_Sphere_Center,Bounding_Sphere_Radius, Normal_Vector[], and
@@ -2040,6 +2668,8 @@ BicubicPatch::~BicubicPatch()
         }
     }
 
+    destroy_tessellations();
+
     if (Weights != nullptr)
         POV_FREE(Weights);
 }
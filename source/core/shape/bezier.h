@@ -39,6 +39,10 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include <atomic>
+
+#include <boost/thread.hpp>
+
 #include "core/scene/object.h"
 
 namespace pov
@@ -68,6 +72,7 @@ namespace pov
 ******************************************************************************/
 
 typedef DBL BEZIER_WEIGHTS[4][4];
+typedef struct BBox_Tree_Struct BBOX_TREE;
 typedef struct Bezier_Node_Struct BEZIER_NODE;
 typedef struct Bezier_Child_Struct BEZIER_CHILDREN;
 typedef struct Bezier_Vertices_Struct BEZIER_VERTICES;
@@ -92,6 +97,41 @@ struct Bezier_Node_Struct
     void *Data_Ptr;     // Either pointer to vertices or pointer to children
 };
 
+/// Triangle of an adaptive patch tessellation, set up for a quick ray test.
+struct Bezier_Triangle
+{
+    Vector3d P0;        ///< First corner.
+    Vector3d E1, E2;    ///< Edges from the first corner to the other two.
+    Vector3d N[3];      ///< Surface normals at the corners.
+    DBL U[3], V[3];     ///< Patch coordinates of the corners.
+};
+
+/// Node of an adaptive patch tessellation's bounding hierarchy.
+///
+/// The nodes are kept in a flat array, with the children of each inner node in consecutive
+/// slots. A leaf refers to a run of triangles in @ref Bezier_Tessellation::Triangles.
+///
+struct Bezier_Tree_Node
+{
+    Vector3d Min;   ///< Lower corner of the node's bounding box.
+    Vector3d Max;   ///< Upper corner of the node's bounding box.
+    int First;      ///< Index of the first child node, or of the first triangle of a leaf.
+    int Count;      ///< Number of child nodes, or of triangles in a leaf.
+    bool Leaf;      ///< Whether the node is a leaf.
+};
+
+/// Adaptive tessellation of a patch (type 2), made for a particular view.
+struct Bezier_Tessellation
+{
+    Vector3d Location;                  ///< Location of the camera it was made for.
+    Vector3d Direction;                 ///< Direction of the camera it was made for.
+    Vector3d Right;                     ///< Right vector of the camera it was made for.
+    int Camera_Type;                    ///< Type of the camera it was made for.
+    DBL Width;                          ///< Image width it was made for.
+    vector<Bezier_Tree_Node> Tree;      ///< Bounding hierarchy.
+    vector<Bezier_Triangle> Triangles;  ///< Triangles, in leaf order.
+};
+
 class BicubicPatch : public NonsolidObject
 {
     public:
@@ -105,6 +145,9 @@ class BicubicPatch : public NonsolidObject
         BEZIER_NODE *Node_Tree;
         BEZIER_WEIGHTS *Weights;
 
+        /// Adaptive tessellation (type 2) for the current view, made on first use.
+        std::atomic<Bezier_Tessellation *> Tessellation;
+
         BicubicPatch();
         virtual ~BicubicPatch();
 
@@ -145,6 +188,16 @@ class BicubicPatch : public NonsolidObject
         static BEZIER_CHILDREN *create_bezier_child_block(void);
         static bool subpatch_normal(const Vector3d& v1, const Vector3d& v2, const Vector3d& v3, Vector3d& Result, DBL *d);
         static void Compute_Texture_UV(const Vector2d& p, const Vector2d st[4], Vector2d& t);
+
+        vector<Bezier_Tessellation *> Retired_Tessellations; ///< Made for earlier views; may still be in use.
+        boost::mutex Tessellation_Mutex;                      ///< Lock this when replacing the tessellation.
+
+        const Bezier_Tessellation *get_tessellation(TraceThreadData *Thread);
+        void tessellate_subpatch(const ControlPoints *, DBL, DBL, DBL, DBL, int, const Vector3d&, DBL, DBL, vector<Bezier_Triangle>&) const;
+        void add_tessellation_triangle(const Vector3d&, const Vector3d&, const Vector3d&, const DBL [3], const DBL [3], vector<Bezier_Triangle>&) const;
+        static void flatten_tessellation_hierarchy(Bezier_Tessellation *, const BBOX_TREE *, int);
+        int intersect_tessellation_node(const BasicRay&, const Bezier_Tessellation *, const Bezier_Tree_Node *, IStack&, TraceThreadData *Thread);
+        void destroy_tessellations();
 };
 
 /// @}
@@ -102,7 +102,6 @@
 #include "base/pov_err.h"
 
 #include "core/bounding/boundingbox.h"
-#include "core/bounding/boundingsphere.h"
 #include "core/material/texture.h"
 #include "core/math/matrix.h"
 #include "core/math/polynomialsolver.h"
@@ -129,6 +128,9 @@ const DBL INSIDE_TOLERANCE = 1.0e-6;
 const int ENTERING = 0;
 const int EXITING  = BLOB_ENTER_EXIT_FLAG;
 
+/* Max. number of components collapsed into a leaf of the hierarchy. */
+const int BLOB_LEAF_SIZE = 16;
+
 
 /*****************************************************************************
 *
@@ -590,6 +592,8 @@ bool Blob::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadDat
 *   Store the points of intersection. Keep track of: whether this is
 *   the start or end point of the hit, which component was pierced
 *   by the ray, and the point along the ray that the hit occured at.
+*   The hits are merely appended; determine_influences() sorts them
+*   once all components have been tested.
 *
 * CHANGES
 *
@@ -597,73 +601,68 @@ bool Blob::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadDat
 *   Sep 1995 : Changed to allow use of memcpy if memmove isn't available. [AED]
 *   Jul 1996 : Changed to use POV_MEMMOVE, which can be memmove or pov_memmove.
 *   Oct 1996 : Changed to avoid unnecessary compares. [DB]
+*   Oct 2026 : Append only, replacing the insertion sort.
 *
 ******************************************************************************/
 
 void Blob::insert_hit(const Blob_Element *Element, DBL t0, DBL t1, Blob_Interval_Struct *intervals, unsigned int *cnt)
 {
-    unsigned int k;
-
     /* We are entering the component. */
 
     intervals[*cnt].type    = Element->Type | ENTERING;
     intervals[*cnt].bound   = t0;
     intervals[*cnt].Element = Element;
 
-    for (k = 0; t0 > intervals[k].bound; k++);
-
-    if (k < *cnt)
-    {
-        /*
-         * This hit point is smaller than one that already exists -->
-         * bump the rest and insert it here.
-         */
-
-        POV_MEMMOVE(&intervals[k+1], &intervals[k], (*cnt-k)*sizeof(Blob_Interval_Struct));
+    (*cnt)++;
 
-        /* We are entering the component. */
-
-        intervals[k].type    = Element->Type | ENTERING;
-        intervals[k].bound   = t0;
-        intervals[k].Element = Element;
-
-        (*cnt)++;
-
-        /* We are exiting the component. */
-
-        intervals[*cnt].type    = Element->Type | EXITING;
-        intervals[*cnt].bound   = t1;
-        intervals[*cnt].Element = Element;
-
-        for (k = k + 1; t1 > intervals[k].bound; k++);
-
-        if (k < *cnt)
-        {
-            POV_MEMMOVE(&intervals[k+1], &intervals[k], (*cnt-k)*sizeof(Blob_Interval_Struct));
+    /* We are exiting the component. */
 
-            /* We are exiting the component. */
+    intervals[*cnt].type    = Element->Type | EXITING;
+    intervals[*cnt].bound   = t1;
+    intervals[*cnt].Element = Element;
 
-            intervals[k].type    = Element->Type | EXITING;
-            intervals[k].bound   = t1;
-            intervals[k].Element = Element;
-        }
+    (*cnt)++;
+}
 
-        (*cnt)++;
-    }
-    else
-    {
-        /* Just plop the start and end points at the end of the list */
 
-        (*cnt)++;
 
-        /* We are exiting the component. */
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   interval_less
+*
+* INPUT
+*
+*   a, b - Hits to compare
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   bool - true if a comes first along the ray
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Order hits by depth; at equal depths, components are entered before
+*   others are exited.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
 
-        intervals[*cnt].type    = Element->Type | EXITING;
-        intervals[*cnt].bound   = t1;
-        intervals[*cnt].Element = Element;
+bool Blob::interval_less(const Blob_Interval_Struct& a, const Blob_Interval_Struct& b)
+{
+    if (a.bound != b.bound)
+        return (a.bound < b.bound);
 
-        (*cnt)++;
-    }
+    return ((a.type & BLOB_ENTER_EXIT_FLAG) < (b.type & BLOB_ENTER_EXIT_FLAG));
 }
 
 
@@ -1256,14 +1255,13 @@ int Blob::intersect_element(const Vector3d& P, const Vector3d& D, const Blob_Ele
 int Blob::determine_influences(const Vector3d& P, const Vector3d& D, DBL mindist, Blob_Interval_Struct *intervals, TraceThreadData *Thread) const
 {
     unsigned int cnt, size;
-    DBL b, t, t0, t1;
-    Vector3d V1;
-    BSPHERE_TREE *Tree;
-    BSPHERE_TREE **Queue = reinterpret_cast<BSPHERE_TREE **>(Thread->Blob_Queue);
+    DBL t0, t1;
+    const Blob_Node *Node, *Child;
+    const Blob_Node **Queue = reinterpret_cast<const Blob_Node **>(Thread->Blob_Queue);
 
     cnt = 0;
 
-    if (Data->Tree == nullptr)
+    if (Data->Tree.empty())
     {
         /* There's no bounding hierarchy so just step through all elements. */
 
@@ -1281,56 +1279,154 @@ int Blob::determine_influences(const Vector3d& P, const Vector3d& D, DBL mindist
 
         size = 0;
 
-        Queue[size++] = Data->Tree;
+        Queue[size++] = &Data->Tree[0];
 
         while (size > 0)
         {
-            Tree = Queue[--size];
+            Node = Queue[--size];
 
             /* Test if current node is a leaf. */
 
-            if (Tree->Entries <= 0)
+            if (Node->Spheres >= 0)
             {
-                /* Test element. */
+                /* Test elements. */
 
-                if (intersect_element(P, D, reinterpret_cast<Blob_Element *>(Tree->Node), mindist, &t0, &t1, Thread))
-                {
-                    insert_hit(reinterpret_cast<Blob_Element *>(Tree->Node), t0, t1, intervals, &cnt);
-                }
+                intersect_leaf(Node, P, D, mindist, intervals, &cnt, Thread);
             }
             else
             {
                 /* Test all sub-nodes. */
 
-                for (int i = 0; i < (int)Tree->Entries; i++)
+                for (int i = 0; i < Node->Count; i++)
                 {
 #ifdef BLOB_EXTRA_STATS
                     Thread->Stats()[Blob_Bound_Tests]++;
 #endif
 
-                    V1 = Tree->Node[i]->C - P;
-                    b = dot(V1, D);
-                    t = V1.lengthSqr();
+                    Child = &Data->Tree[Node->First + i];
 
-                    if ((t - Sqr(b)) <= Tree->Node[i]->r2)
+                    if (intersect_node(Child, P, D))
                     {
 #ifdef BLOB_EXTRA_STATS
                         Thread->Stats()[Blob_Bound_Tests_Succeeded]++;
 #endif
 
-                        if (insert_node(Tree->Node[i], &size, Thread))
-                            Queue = reinterpret_cast<BSPHERE_TREE **>(Thread->Blob_Queue);
+                        if (insert_node(Child, &size, Thread))
+                            Queue = reinterpret_cast<const Blob_Node **>(Thread->Blob_Queue);
                     }
                 }
             }
         }
     }
 
+    /* Sort the hits along the ray. */
+
+    std::sort(intervals, intervals + cnt, interval_less);
+
     return (cnt);
 }
 
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   intersect_leaf
+*
+* INPUT
+*
+*   Node       - Leaf of the bounding hierarchy
+*   P, D       - Ray = P + t * D
+*   mindist    - Min. valid distance
+*
+* OUTPUT
+*
+*   intervals  - List of intersections found
+*   cnt        - Number of hits in intervals
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Intersect the ray with all components of a leaf. The sphere components
+*   are first tested in a single pass over the leaf's sphere arrays, which
+*   the compiler can vectorise; only the spheres actually hit are then
+*   processed one at a time.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void Blob::intersect_leaf(const Blob_Node *Node, const Vector3d& P, const Vector3d& D, DBL mindist, Blob_Interval_Struct *intervals, unsigned int *cnt, TraceThreadData *Thread) const
+{
+    int i, k, n;
+    DBL b[BLOB_LEAF_SIZE], d[BLOB_LEAF_SIZE];
+    DBL t0, t1, vx, vy, vz;
+    const int last = Node->First + Node->Spheres;
+    const DBL *CX = Data->Spheres.X.data();
+    const DBL *CY = Data->Spheres.Y.data();
+    const DBL *CZ = Data->Spheres.Z.data();
+    const DBL *R2 = Data->Spheres.rad2.data();
+
+    for (i = Node->First; i < last; i += n)
+    {
+        n = min(last - i, BLOB_LEAF_SIZE);
+
+#ifdef BLOB_EXTRA_STATS
+        Thread->Stats()[Blob_Element_Tests] += n;
+#endif
+
+        for (k = 0; k < n; k++)
+        {
+            vx = P[X] - CX[i+k];
+            vy = P[Y] - CY[i+k];
+            vz = P[Z] - CZ[i+k];
+
+            b[k] = vx * D[X] + vy * D[Y] + vz * D[Z];
+            d[k] = b[k] * b[k] - (vx * vx + vy * vy + vz * vz) + R2[i+k];
+        }
+
+        for (k = 0; k < n; k++)
+        {
+            if (d[k] < EPSILON)
+                continue;
+
+            d[k] = sqrt(d[k]);
+
+            t1 = - b[k] + d[k];  if (t1 < mindist) { t1 = 0.0; }
+            t0 = - b[k] - d[k];  if (t0 < mindist) { t0 = 0.0; }
+
+            if (t0 == t1)
+                continue;
+
+#ifdef BLOB_EXTRA_STATS
+            Thread->Stats()[Blob_Element_Tests_Succeeded]++;
+#endif
+
+            insert_hit(Data->Order[i+k], t0, t1, intervals, cnt);
+        }
+    }
+
+    /* Test the remaining components one at a time. */
+
+    for (i = last; i < Node->First + Node->Count; i++)
+    {
+        if (intersect_element(P, D, Data->Order[i], mindist, &t0, &t1, Thread))
+        {
+            insert_hit(Data->Order[i], t0, t1, intervals, cnt);
+        }
+    }
+}
+
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1489,14 +1585,13 @@ DBL Blob::calculate_element_field(const Blob_Element *Element, const Vector3d& P
 DBL Blob::calculate_field_value(const Vector3d& P, TraceThreadData *Thread) const
 {
     unsigned int size;
-    DBL density, rad2;
-    Vector3d V1;
-    BSPHERE_TREE *Tree;
-    BSPHERE_TREE **Queue = reinterpret_cast<BSPHERE_TREE **>(Thread->Blob_Queue);
+    DBL density;
+    const Blob_Node *Node, *Child;
+    const Blob_Node **Queue = reinterpret_cast<const Blob_Node **>(Thread->Blob_Queue);
 
     density = 0.0;
 
-    if (Data->Tree == nullptr)
+    if (Data->Tree.empty())
     {
         /* There's no tree --> step through all elements. */
 
@@ -1511,33 +1606,31 @@ DBL Blob::calculate_field_value(const Vector3d& P, TraceThreadData *Thread) cons
 
         size = 0;
 
-        Queue[size++] = Data->Tree;
+        Queue[size++] = &Data->Tree[0];
 
         while (size > 0)
         {
-            Tree = Queue[--size];
+            Node = Queue[--size];
 
             /* Test if current node is a leaf. */
 
-            if (Tree->Entries <= 0)
+            if (Node->Spheres >= 0)
             {
-                density += calculate_element_field(reinterpret_cast<Blob_Element *>(Tree->Node), P);
+                density += calculate_leaf_field(Node, P);
             }
             else
             {
                 /* Test all sub-nodes. */
 
-                for (int i = 0; i < (int)Tree->Entries; i++)
+                for (int i = 0; i < Node->Count; i++)
                 {
                     /* Insert sub-node if we are inside. */
 
-                    V1 = P - Tree->Node[i]->C;
+                    Child = &Data->Tree[Node->First + i];
 
-                    rad2 = V1.lengthSqr();
-
-                    if (rad2 <= Tree->Node[i]->r2)
-                        if (insert_node(Tree->Node[i], &size, Thread))
-                            Queue = reinterpret_cast<BSPHERE_TREE **>(Thread->Blob_Queue);
+                    if (inside_node(Child, P))
+                        if (insert_node(Child, &size, Thread))
+                            Queue = reinterpret_cast<const Blob_Node **>(Thread->Blob_Queue);
                 }
             }
         }
@@ -1548,6 +1641,93 @@ DBL Blob::calculate_field_value(const Vector3d& P, TraceThreadData *Thread) cons
 
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   calculate_leaf_field
+*
+* INPUT
+*
+*   Node    - Leaf of the bounding hierarchy
+*   P       - Point whos field value is calculated
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   DBL - Field value of the leaf's components
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Sum up the field values of all components of a leaf. The sphere
+*   components are accumulated four at a time into independent sums,
+*   which allows the compiler to vectorise the loop without having to
+*   reorder the additions itself.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+DBL Blob::calculate_leaf_field(const Blob_Node *Node, const Vector3d& P) const
+{
+    int i, k;
+    DBL vx, vy, vz, r2, density;
+    DBL sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+    const int last = Node->First + Node->Spheres;
+    const DBL *CX = Data->Spheres.X.data();
+    const DBL *CY = Data->Spheres.Y.data();
+    const DBL *CZ = Data->Spheres.Z.data();
+    const DBL *R2 = Data->Spheres.rad2.data();
+    const DBL *C0 = Data->Spheres.c0.data();
+    const DBL *C1 = Data->Spheres.c1.data();
+    const DBL *C2 = Data->Spheres.c2.data();
+
+    for (i = Node->First; i + 4 <= last; i += 4)
+    {
+        for (k = 0; k < 4; k++)
+        {
+            vx = P[X] - CX[i+k];
+            vy = P[Y] - CY[i+k];
+            vz = P[Z] - CZ[i+k];
+
+            r2 = vx * vx + vy * vy + vz * vz;
+
+            sum[k] += (r2 < R2[i+k]) ? r2 * (r2 * C0[i+k] + C1[i+k]) + C2[i+k] : 0.0;
+        }
+    }
+
+    for (k = 0; i < last; i++, k++)
+    {
+        vx = P[X] - CX[i];
+        vy = P[Y] - CY[i];
+        vz = P[Z] - CZ[i];
+
+        r2 = vx * vx + vy * vy + vz * vz;
+
+        sum[k] += (r2 < R2[i]) ? r2 * (r2 * C0[i] + C1[i]) + C2[i] : 0.0;
+    }
+
+    density = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+
+    /* Add the remaining components one at a time. */
+
+    for (i = last; i < Node->First + Node->Count; i++)
+    {
+        density += calculate_element_field(Data->Order[i], P);
+    }
+
+    return (density);
+}
+
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1803,10 +1983,10 @@ void Blob::Normal(Vector3d& Result, Intersection *Inter, TraceThreadData *Thread
 {
     int i;
     unsigned int size;
-    DBL dist, val;
-    Vector3d New_Point, V1;
-    BSPHERE_TREE *Tree;
-    BSPHERE_TREE **Queue = reinterpret_cast<BSPHERE_TREE **>(Thread->Blob_Queue);
+    DBL val;
+    Vector3d New_Point;
+    const Blob_Node *Node, *Child;
+    const Blob_Node **Queue = reinterpret_cast<const Blob_Node **>(Thread->Blob_Queue);
 
     /* Transform the point into the blob space. */
     getLocalIPoint(New_Point, Inter);
@@ -1815,7 +1995,7 @@ void Blob::Normal(Vector3d& Result, Intersection *Inter, TraceThreadData *Thread
 
     /* For each component that contributes to this point, add its bit to the normal */
 
-    if (Data->Tree == nullptr)
+    if (Data->Tree.empty())
     {
         /* There's no tree --> step through all elements. */
 
@@ -1830,33 +2010,32 @@ void Blob::Normal(Vector3d& Result, Intersection *Inter, TraceThreadData *Thread
 
         size = 0;
 
-        Queue[size++] = Data->Tree;
+        Queue[size++] = &Data->Tree[0];
 
         while (size > 0)
         {
-            Tree = Queue[--size];
+            Node = Queue[--size];
 
             /* Test if current node is a leaf. */
 
-            if (Tree->Entries <= 0)
+            if (Node->Spheres >= 0)
             {
-                element_normal(Result, New_Point, reinterpret_cast<Blob_Element *>(Tree->Node));
+                for (i = Node->First; i < Node->First + Node->Count; i++)
+                    element_normal(Result, New_Point, Data->Order[i]);
             }
             else
             {
                 /* Test all sub-nodes. */
 
-                for (i = 0; i < (int)Tree->Entries; i++)
+                for (i = 0; i < Node->Count; i++)
                 {
                     /* Insert sub-node if we are inside. */
 
-                    V1 = New_Point - Tree->Node[i]->C;
+                    Child = &Data->Tree[Node->First + i];
 
-                    dist = V1.lengthSqr();
-
-                    if (dist <= Tree->Node[i]->r2)
-                        if (insert_node(Tree->Node[i], &size, Thread))
-                            Queue = reinterpret_cast<BSPHERE_TREE **>(Thread->Blob_Queue);
+                    if (inside_node(Child, New_Point))
+                        if (insert_node(Child, &size, Thread))
+                            Queue = reinterpret_cast<const Blob_Node **>(Thread->Blob_Queue);
                 }
             }
         }
@@ -2417,7 +2596,6 @@ Blob_Element::~Blob_Element ()
 Blob_Data::Blob_Data (int Count)
 {
     References = 1;
-    Tree = nullptr;
     Entry.resize(Count);
 }
 
@@ -2431,8 +2609,6 @@ void Blob_Data::ReleaseReference (void)
 {
     if (--References == 0)
     {
-        Destroy_Bounding_Sphere_Hierarchy(Tree);
-
         /*
          * Make sure to destroy multiple references of a texture
          * and/or transformation only once. Multiple references
@@ -2585,7 +2761,7 @@ int Blob::Make_Blob(DBL threshold, Blob_List_Struct *BlobList, int npoints, Trac
 
     Compute_BBox();
 
-    /* Create bounding sphere hierarchy. */
+    /* Create bounding hierarchy. */
 
     if (Test_Flag(this, HIERARCHY_FLAG))
         build_bounding_hierarchy();
@@ -2677,46 +2853,435 @@ bool Blob::IsOpaque() const
 *
 * DESCRIPTION
 *
-*   Create the bounding sphere hierarchy.
+*   Create the bounding hierarchy. The components' bounding boxes are
+*   sorted into a tree using the surface area heuristic, which is then
+*   flattened into an array of nodes; small subtrees become leaves
+*   holding up to BLOB_LEAF_SIZE components.
 *
 * CHANGES
 *
 *   Oct 1994 : Creation. (Derived from the bounding slab creation code)
+*   Oct 2026 : Replaced bounding sphere hierarchy with a flat box hierarchy.
 *
 ******************************************************************************/
 
 void Blob::build_bounding_hierarchy()
 {
-    int i, nElem, maxelements;
-    BSPHERE_TREE **Elements;
+    int i, nElem;
+    DBL r2, r;
+    Vector3d C;
+    BBOX_TREE **Elements;
+    BBOX_TREE *Root = nullptr;
 
     nElem = (int)Data->Entry.size();
 
-    maxelements = 2 * nElem;
+    if (nElem == 0)
+    {
+        return;
+    }
 
     /*
      * Now allocate an array to hold references to these elements.
      */
 
-    Elements = reinterpret_cast<BSPHERE_TREE **>(POV_MALLOC(maxelements*sizeof(BSPHERE_TREE *), "blob bounding hierarchy"));
+    Elements = reinterpret_cast<BBOX_TREE **>(POV_MALLOC(nElem*sizeof(BBOX_TREE *), "blob bounding hierarchy"));
 
     /* Init list with blob elements. */
 
     for (i = 0; i < nElem; i++)
     {
-        Elements[i] = reinterpret_cast<BSPHERE_TREE *>(POV_MALLOC(sizeof(BSPHERE_TREE), "blob bounding hierarchy"));
+        Elements[i] = reinterpret_cast<BBOX_TREE *>(POV_MALLOC(sizeof(BBOX_TREE), "blob bounding hierarchy"));
 
-        Elements[i]->Entries = 0;
-        Elements[i]->Node    = reinterpret_cast<BSPHERE_TREE **>(&Data->Entry[i]);
+        Elements[i]->Infinite = false;
+        Elements[i]->Entries  = 0;
+        Elements[i]->Node     = reinterpret_cast<BBOX_TREE **>(&Data->Entry[i]);
 
-        get_element_bounding_sphere(&Data->Entry[i], Elements[i]->C, &Elements[i]->r2);
+        get_element_bounding_sphere(&Data->Entry[i], C, &r2);
+
+        r = sqrt(r2);
+
+        Make_BBox(Elements[i]->BBox, C[X] - r, C[Y] - r, C[Z] - r, 2.0 * r, 2.0 * r, 2.0 * r);
     }
 
-    Build_Bounding_Sphere_Hierarchy(&Data->Tree, nElem, &Elements);
+    Build_BBox_Tree_SAH(&Root, nElem, Elements, 0, nullptr);
 
     /* Get rid of the Elements array. */
 
     POV_FREE(Elements);
+
+    /* Flatten the tree, starting with the root node. */
+
+    Data->Order.reserve(nElem);
+
+    Data->Tree.resize(1);
+
+    flatten_bounding_hierarchy(Root, 0);
+
+    Destroy_BBox_Tree(Root);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   flatten_bounding_hierarchy
+*
+* INPUT
+*
+*   Node  - Bounding box tree node
+*   index - Slot of the node in the flat hierarchy
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Turn a subtree with no more than BLOB_LEAF_SIZE components into a leaf.
+*   Otherwise the node's component children are gathered into a leaf of
+*   their own, and its other children are flattened recursively into
+*   consecutive slots.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void Blob::flatten_bounding_hierarchy(const BBOX_TREE *Node, int index)
+{
+    int i, k, first, count;
+    vector<const Blob_Element *> Elements;
+
+    if (collect_elements(Node, Elements, BLOB_LEAF_SIZE))
+    {
+        make_leaf(index, Elements);
+        return;
+    }
+
+    Elements.clear();
+
+    count = 0;
+
+    for (i = 0; i < Node->Entries; i++)
+    {
+        if (Node->Node[i]->Entries == 0)
+            Elements.push_back(reinterpret_cast<const Blob_Element *>(Node->Node[i]->Node));
+        else
+            count++;
+    }
+
+    if (!Elements.empty())
+        count++;
+
+    first = (int)Data->Tree.size();
+
+    Data->Tree.resize(first + count);
+
+    k = first;
+
+    if (!Elements.empty())
+        make_leaf(k++, Elements);
+
+    for (i = 0; i < Node->Entries; i++)
+    {
+        if (Node->Node[i]->Entries != 0)
+            flatten_bounding_hierarchy(Node->Node[i], k++);
+    }
+
+    /* The node's box encloses those of its children. */
+
+    Blob_Node& Inner = Data->Tree[index];
+
+    Inner.First   = first;
+    Inner.Count   = count;
+    Inner.Spheres = -1;
+    Inner.Min     = Data->Tree[first].Min;
+    Inner.Max     = Data->Tree[first].Max;
+
+    for (k = first + 1; k < first + count; k++)
+    {
+        for (i = X; i <= Z; i++)
+        {
+            Inner.Min[i] = min(Inner.Min[i], Data->Tree[k].Min[i]);
+            Inner.Max[i] = max(Inner.Max[i], Data->Tree[k].Max[i]);
+        }
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   collect_elements
+*
+* INPUT
+*
+*   Node  - Bounding box tree node
+*   limit - Max. number of elements to collect
+*
+* OUTPUT
+*
+*   Elements - Elements found in the subtree
+*
+* RETURNS
+*
+*   bool - false if the subtree holds more than limit elements
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool Blob::collect_elements(const BBOX_TREE *Node, vector<const Blob_Element *>& Elements, size_t limit)
+{
+    if (Node->Entries == 0)
+    {
+        Elements.push_back(reinterpret_cast<const Blob_Element *>(Node->Node));
+
+        return (Elements.size() <= limit);
+    }
+
+    for (short i = 0; i < Node->Entries; i++)
+    {
+        if (!collect_elements(Node->Node[i], Elements, limit))
+            return (false);
+    }
+
+    return (true);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   make_leaf
+*
+* INPUT
+*
+*   index    - Slot of the leaf in the flat hierarchy
+*   Elements - Elements of the leaf
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Append the elements to the blob's component order, spheres first, copy
+*   the sphere parameters into their arrays and compute the leaf's box.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void Blob::make_leaf(int index, vector<const Blob_Element *>& Elements)
+{
+    int i;
+    DBL r2, r;
+    Vector3d C;
+    Blob_Node& Leaf = Data->Tree[index];
+    Blob_Sphere_Data& Spheres = Data->Spheres;
+
+    vector<const Blob_Element *>::iterator split = std::stable_partition(Elements.begin(), Elements.end(), is_sphere_element);
+
+    Leaf.First   = (int)Data->Order.size();
+    Leaf.Count   = (int)Elements.size();
+    Leaf.Spheres = (int)(split - Elements.begin());
+    Leaf.Min     = Vector3d( BOUND_HUGE);
+    Leaf.Max     = Vector3d(-BOUND_HUGE);
+
+    for (vector<const Blob_Element *>::iterator e = Elements.begin(); e != Elements.end(); ++e)
+    {
+        Data->Order.push_back(*e);
+
+        Spheres.X.push_back((*e)->O[X]);
+        Spheres.Y.push_back((*e)->O[Y]);
+        Spheres.Z.push_back((*e)->O[Z]);
+        Spheres.rad2.push_back((*e)->rad2);
+        Spheres.c0.push_back((*e)->c[0]);
+        Spheres.c1.push_back((*e)->c[1]);
+        Spheres.c2.push_back((*e)->c[2]);
+
+        get_element_bounding_sphere(*e, C, &r2);
+
+        r = sqrt(r2);
+
+        for (i = X; i <= Z; i++)
+        {
+            Leaf.Min[i] = min(Leaf.Min[i], C[i] - r);
+            Leaf.Max[i] = max(Leaf.Max[i], C[i] + r);
+        }
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   is_sphere_element
+*
+* INPUT
+*
+*   Element - Pointer to element structure
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   bool - true if the element is a sphere
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool Blob::is_sphere_element(const Blob_Element *Element)
+{
+    return (Element->Type == BLOB_SPHERE);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   intersect_node
+*
+* INPUT
+*
+*   Node - Node of the bounding hierarchy
+*   P, D - Ray = P + t * D
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   bool - true if the ray's line passes through the node's box
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Slab test of the node's box against the whole line, as the bounding
+*   sphere test it replaces did.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool Blob::intersect_node(const Blob_Node *Node, const Vector3d& P, const Vector3d& D)
+{
+    DBL t0, t1, tmin, tmax;
+
+    tmin = -BOUND_HUGE;
+    tmax =  BOUND_HUGE;
+
+    for (int i = X; i <= Z; i++)
+    {
+        if (D[i] == 0.0)
+        {
+            if ((P[i] < Node->Min[i]) || (P[i] > Node->Max[i]))
+                return (false);
+        }
+        else
+        {
+            t0 = (Node->Min[i] - P[i]) / D[i];
+            t1 = (Node->Max[i] - P[i]) / D[i];
+
+            if (t0 > t1)
+                std::swap(t0, t1);
+
+            tmin = max(tmin, t0);
+            tmax = min(tmax, t1);
+
+            if (tmin > tmax)
+                return (false);
+        }
+    }
+
+    return (true);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   inside_node
+*
+* INPUT
+*
+*   Node - Node of the bounding hierarchy
+*   P    - Point to test
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   bool - true if the point lies within the node's box
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool Blob::inside_node(const Blob_Node *Node, const Vector3d& P)
+{
+    return ((P[X] >= Node->Min[X]) && (P[X] <= Node->Max[X]) &&
+            (P[Y] >= Node->Min[Y]) && (P[Y] <= Node->Max[Y]) &&
+            (P[Z] >= Node->Min[Z]) && (P[Z] <= Node->Max[Z]));
 }
 
 
@@ -2755,17 +3320,16 @@ void Blob::build_bounding_hierarchy()
 void Blob::Determine_Textures(Intersection *isect, bool hitinside, WeightedTextureVector& textures, TraceThreadData *Thread)
 {
     unsigned int size;
-    DBL rad2;
-    Vector3d V1, P;
-    Blob_Element *Element;
-    BSPHERE_TREE *Tree;
+    Vector3d P;
+    const Blob_Element *Element;
+    const Blob_Node *Node, *Child;
     size_t firstinserted = textures.size();
-    BSPHERE_TREE **Queue = reinterpret_cast<BSPHERE_TREE **>(Thread->Blob_Queue);
+    const Blob_Node **Queue = reinterpret_cast<const Blob_Node **>(Thread->Blob_Queue);
 
     /* Transform the point into the blob space. */
     getLocalIPoint(P, isect);
 
-    if (Data->Tree == nullptr)
+    if (Data->Tree.empty())
     {
         /* There's no tree --> step through all elements. */
 
@@ -2781,33 +3345,35 @@ void Blob::Determine_Textures(Intersection *isect, bool hitinside, WeightedTextu
 
         size = 0;
 
-        Queue[size++] = Data->Tree;
+        Queue[size++] = &Data->Tree[0];
 
         while (size > 0)
         {
-            Tree = Queue[--size];
+            Node = Queue[--size];
 
             /* Test if current node is a leaf. */
 
-            if (Tree->Entries <= 0)
+            if (Node->Spheres >= 0)
             {
-                determine_element_texture(reinterpret_cast<Blob_Element *>(Tree->Node), Element_Texture[((Blob_Element *)Tree->Node)->index], P, textures);
+                for (int i = Node->First; i < Node->First + Node->Count; i++)
+                {
+                    Element = Data->Order[i];
+                    determine_element_texture(Element, Element_Texture[Element->index], P, textures);
+                }
             }
             else
             {
                 /* Test all sub-nodes. */
 
-                for (int i = 0; i < (int)Tree->Entries; i++)
+                for (int i = 0; i < Node->Count; i++)
                 {
                     /* Insert sub-node if we are inside. */
 
-                    V1 = P - Tree->Node[i]->C;
-
-                    rad2 = V1.lengthSqr();
+                    Child = &Data->Tree[Node->First + i];
 
-                    if (rad2 <= Tree->Node[i]->r2)
-                        if (insert_node(Tree->Node[i], &size, Thread))
-                            Queue = reinterpret_cast<BSPHERE_TREE **>(Thread->Blob_Queue);
+                    if (inside_node(Child, P))
+                        if (insert_node(Child, &size, Thread))
+                            Queue = reinterpret_cast<const Blob_Node **>(Thread->Blob_Queue);
                 }
             }
         }
@@ -3156,17 +3722,17 @@ void Blob::Invert_Blob_Element(Blob_Element *Element)
 *
 ******************************************************************************/
 
-bool Blob::insert_node(BSPHERE_TREE *Node, unsigned int *size, TraceThreadData *Thread)
+bool Blob::insert_node(const Blob_Node *Node, unsigned int *size, TraceThreadData *Thread)
 {
     /* Resize queue if necessary. */
     bool rval = false ;
-    BSPHERE_TREE **Queue = reinterpret_cast<BSPHERE_TREE **>(Thread->Blob_Queue);
+    const Blob_Node **Queue = reinterpret_cast<const Blob_Node **>(Thread->Blob_Queue);
 
     if (*size >= Thread->Max_Blob_Queue_Size)
     {
         Thread->Max_Blob_Queue_Size = (*size + 1) * 3 / 2;
-        Queue = reinterpret_cast<BSPHERE_TREE **>(POV_REALLOC(Queue, Thread->Max_Blob_Queue_Size*sizeof(BSPHERE_TREE *), "blob queue"));
-        Thread->Blob_Queue = reinterpret_cast<void **>(Queue);
+        Queue = reinterpret_cast<const Blob_Node **>(POV_REALLOC(Queue, Thread->Max_Blob_Queue_Size*sizeof(const Blob_Node *), "blob queue"));
+        Thread->Blob_Queue = reinterpret_cast<const void **>(Queue);
         rval = true ;
     }
 
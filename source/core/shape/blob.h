@@ -39,7 +39,6 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
-#include "core/bounding/boundingsphere.h"
 #include "core/scene/object.h"
 
 namespace pov
@@ -82,6 +81,7 @@ namespace pov
 
 #define BLOB_EXTRA_STATS 1
 
+typedef struct BBox_Tree_Struct BBOX_TREE;
 
 
 /*****************************************************************************
@@ -104,13 +104,41 @@ class Blob_Element
         ~Blob_Element();
 };
 
+/// Node of a blob's component hierarchy.
+///
+/// The nodes are kept in a flat array, with the children of each inner node in consecutive
+/// slots. A leaf refers to a run of components in @ref Blob_Data::Order, sphere components first.
+///
+struct Blob_Node
+{
+    Vector3d Min;   ///< Lower corner of the node's bounding box.
+    Vector3d Max;   ///< Upper corner of the node's bounding box.
+    int First;      ///< Index of the first child node, or of the first component of a leaf.
+    int Count;      ///< Number of child nodes, or of components in a leaf.
+    int Spheres;    ///< Number of sphere components of a leaf, or -1 for an inner node.
+};
+
+/// Parameters of the sphere components in a blob's hierarchy, one array per member.
+///
+/// The arrays are indexed like @ref Blob_Data::Order, so that the spheres of a leaf can be
+/// processed in a single tight loop; entries of other component types are unused.
+///
+struct Blob_Sphere_Data
+{
+    vector<DBL> X, Y, Z;    ///< Centres.
+    vector<DBL> rad2;       ///< Squared radii.
+    vector<DBL> c0, c1, c2; ///< Field coefficients.
+};
+
 class Blob_Data
 {
     public:
         int Number_Of_Components;   /* Number of components     */
         DBL Threshold;              /* Blob threshold           */
         vector<Blob_Element> Entry; /* Array of blob components */
-        BSPHERE_TREE *Tree;         /* Bounding hierarchy       */
+        vector<Blob_Node> Tree;     /* Bounding hierarchy       */
+        vector<const Blob_Element *> Order; /* Components in leaf order */
+        Blob_Sphere_Data Spheres;   /* Leaf sphere parameters   */
 
         Blob_Data(int count = 0);
         ~Blob_Data();
@@ -183,10 +211,20 @@ class Blob : public ObjectBase
 
         static void get_element_bounding_sphere(const Blob_Element *Element, Vector3d& Center, DBL *Radius2);
         void build_bounding_hierarchy();
+        void flatten_bounding_hierarchy(const BBOX_TREE *Node, int index);
+        void make_leaf(int index, vector<const Blob_Element *>& Elements);
+        static bool collect_elements(const BBOX_TREE *Node, vector<const Blob_Element *>& Elements, size_t limit);
+        static bool is_sphere_element(const Blob_Element *Element);
+
+        static bool intersect_node(const Blob_Node *Node, const Vector3d& P, const Vector3d& D);
+        static bool inside_node(const Blob_Node *Node, const Vector3d& P);
+        void intersect_leaf(const Blob_Node *Node, const Vector3d& P, const Vector3d& D, DBL mindist, Blob_Interval_Struct *intervals, unsigned int *cnt, TraceThreadData *Thread) const;
+        DBL calculate_leaf_field(const Blob_Node *Node, const Vector3d& P) const;
 
         void determine_element_texture(const Blob_Element *Element, TEXTURE *Texture, const Vector3d& P, WeightedTextureVector&);
 
-        static bool insert_node(BSPHERE_TREE *Node, unsigned int *size, TraceThreadData *Thread);
+        static bool insert_node(const Blob_Node *Node, unsigned int *size, TraceThreadData *Thread);
+        static bool interval_less(const Blob_Interval_Struct& a, const Blob_Interval_Struct& b);
 
         void getLocalIPoint(Vector3d& lip, Intersection *isect) const;
 };
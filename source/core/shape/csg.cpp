@@ -61,6 +61,12 @@ namespace pov
 #define MERGE_OBJECT        (IS_COMPOUND_OBJECT | IS_CSG_OBJECT)
 #define INTERSECTION_OBJECT (IS_COMPOUND_OBJECT | IS_CSG_OBJECT)
 
+/* CSG objects with fewer children than this are not worth a hierarchy. */
+const size_t CSG_HIERARCHY_MIN_CHILDREN = 4;
+
+/* Relative padding of child boxes, covering the rounding of their float bounds. */
+const DBL CSG_BOX_MARGIN = 1.0e-5;
+
 
 
 inline bool Test_Ray_Flags(const Ray& ray, ConstObjectPtr obj)
@@ -74,104 +80,653 @@ inline bool Test_Ray_Flags(const Ray& ray, ConstObjectPtr obj)
              ( ray.IsPhotonRay() && !Test_Flag(obj, NO_SHADOW_FLAG) ) );
 }
 
-inline bool Test_Ray_Flags_Shadow(const Ray& ray, ConstObjectPtr obj)
+inline bool Test_Ray_Flags_Shadow(const Ray& ray, ConstObjectPtr obj)
+{
+    // TODO CLARIFY - why does this function not ignore NO_IMAGE_FLAG for primary rays, as Test_Ray_Flags() does? [CLi]
+    return ( ( !ray.IsPhotonRay() &&
+               (!Test_Flag(obj, NO_IMAGE_FLAG) || ray.IsImageRay() == false) &&
+               (!Test_Flag(obj, NO_REFLECTION_FLAG) || ray.IsReflectionRay() == false) &&
+               (!Test_Flag(obj, NO_RADIOSITY_FLAG) || ray.IsRadiosityRay() == false) ) ||
+             ( ray.IsPhotonRay() && !Test_Flag(obj, NO_SHADOW_FLAG) ) ||
+             ( ray.IsShadowTestRay() && !Test_Flag(obj, NO_SHADOW_FLAG) ) );
+}
+
+// Light sources only have an inside if they have a looks_like object.
+inline bool Has_Inside(ConstObjectPtr obj)
+{
+    return (!(obj->Type & LIGHT_SOURCE_OBJECT) || !(reinterpret_cast<const LightSource *>(obj))->children.empty());
+}
+
+// Merges, which pass the ray, count the inside tests made to filter their hits.
+inline bool Inside_Child(const Vector3d& IPoint, ObjectPtr Object, const Ray *ray, TraceThreadData *Thread)
+{
+    if (ray != nullptr)
+        Thread->Stats()[CSG_Merge_Inside_Tests]++;
+
+    return Inside_Object(IPoint, Object, Thread);
+}
+
+inline bool Point_In_Box(const Vector3d& P, const Vector3d& Min, const Vector3d& Max)
+{
+    return ((P[X] >= Min[X]) && (P[X] <= Max[X]) &&
+            (P[Y] >= Min[Y]) && (P[Y] <= Max[Y]) &&
+            (P[Z] >= Min[Z]) && (P[Z] <= Max[Z]));
+}
+
+// Whether the ray passes through the box in front of its origin.
+inline bool Ray_In_Box(const Ray& ray, const Vector3d& Min, const Vector3d& Max)
+{
+    DBL t0, t1, tmin, tmax;
+
+    tmin = 0.0;
+    tmax = BOUND_HUGE;
+
+    for (int j = X; j <= Z; j++)
+    {
+        if (ray.Direction[j] == 0.0)
+        {
+            if ((ray.Origin[j] < Min[j]) || (ray.Origin[j] > Max[j]))
+                return false;
+        }
+        else
+        {
+            t0 = (Min[j] - ray.Origin[j]) / ray.Direction[j];
+            t1 = (Max[j] - ray.Origin[j]) / ray.Direction[j];
+
+            if (t0 > t1)
+                std::swap(t0, t1);
+
+            tmin = max(tmin, t0);
+            tmax = min(tmax, t1);
+
+            if (tmin > tmax)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+inline void Make_CSG_Entry(CSGEntry& Entry, ObjectPtr Object)
+{
+    DBL Margin;
+
+    Make_min_max_from_BBox(Entry.Min, Entry.Max, Object->BBox);
+
+    for (int j = X; j <= Z; j++)
+    {
+        Margin = CSG_BOX_MARGIN * (1.0 + max(fabs(Entry.Min[j]), fabs(Entry.Max[j])));
+
+        Entry.Min[j] -= Margin;
+        Entry.Max[j] += Margin;
+    }
+
+    Entry.Object = Object;
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   All_CSG_Union_Intersections
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Sep 1994 : Added code to count intersection tests. [DB]
+*
+******************************************************************************/
+
+bool CSGUnion::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    bool Found;
+
+    Thread->Stats()[Ray_CSG_Union_Tests]++;
+
+    // Use shortcut if no clip.
+
+    if(Clip.empty())
+        Found = Intersect_Children(ray, Depth_Stack, Depth_Stack, Thread);
+    else
+    {
+        IStack Local_Stack(Thread->stackPool);
+        POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+
+        Found = Intersect_Children(ray, Depth_Stack, Local_Stack, Thread);
+
+        POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack is in a cleaned-up condition (again)
+    }
+
+    if(Found)
+        Thread->Stats()[Ray_CSG_Union_Tests_Succeeded]++;
+
+    return (Found);
+}
+
+bool CSGUnion::Intersect_Child(ObjectPtr child, const Ray& ray, IStack& Depth_Stack, IStack& Local_Stack, TraceThreadData *Thread)
+{
+    bool Found = false;
+
+    if(Test_Ray_Flags(ray, child)) // TODO CLARIFY - why does CSGUnion use Test_Ray_Flags(), while CSGMerge uses Test_Ray_Flags_Shadow(), and CSGIntersection uses neither?
+    {
+        if(child->Bound.empty() == true || Ray_In_Bound(ray, child->Bound, Thread))
+        {
+            // Without clip the hits go straight to the intersection stack.
+
+            if(Clip.empty())
+                return child->All_Intersections(ray, Depth_Stack, Thread);
+
+            if(child->All_Intersections(ray, Local_Stack, Thread))
+            {
+                while(Local_Stack->size() > 0)
+                {
+                    if(Point_In_Clip(Local_Stack->top().IPoint, Clip, Thread))
+                    {
+                        Local_Stack->top().Csg = this;
+
+                        Depth_Stack->push(Local_Stack->top());
+
+                        Found = true;
+                    }
+
+                    Local_Stack->pop();
+                }
+            }
+        }
+    }
+
+    return (Found);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   All_CSG_Intersection_Intersections
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Sep 1994 : Added code to count intersection tests. [DB]
+*
+******************************************************************************/
+
+bool CSGIntersection::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    bool Found;
+    IStack Local_Stack(Thread->stackPool);
+    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+
+    Thread->Stats()[Ray_CSG_Intersection_Tests]++;
+
+    Found = Intersect_Children(ray, Depth_Stack, Local_Stack, Thread);
+
+    if(Found)
+        Thread->Stats()[Ray_CSG_Intersection_Tests_Succeeded]++;
+
+    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack is in a cleaned-up condition (again)
+    return (Found);
+}
+
+bool CSGIntersection::Intersect_Child(ObjectPtr child, const Ray& ray, IStack& Depth_Stack, IStack& Local_Stack, TraceThreadData *Thread)
+{
+    bool Found = false;
+
+    if (child->Bound.empty() == true || Ray_In_Bound(ray, child->Bound, Thread))
+    {
+        if(child->All_Intersections(ray, Local_Stack, Thread))
+        {
+            while(Local_Stack->size() > 0)
+            {
+                if(Inside_All_Children(Local_Stack->top().IPoint, child, Thread))
+                {
+                    if(Clip.empty() || Point_In_Clip(Local_Stack->top().IPoint, Clip, Thread))
+                    {
+                        Local_Stack->top().Csg = this;
+
+                        Depth_Stack->push(Local_Stack->top());
+
+                        Found = true;
+                    }
+                }
+
+                Local_Stack->pop();
+            }
+        }
+    }
+
+    return (Found);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   All_CSG_Merge_Intersections
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Sep 1994 : Added code to count intersection tests. [DB]
+*
+******************************************************************************/
+
+bool CSGMerge::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    bool Found;
+    IStack Local_Stack(Thread->stackPool);
+    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+
+    Thread->Stats()[Ray_CSG_Merge_Tests]++;
+
+    // FIXME - though the name is misleading, the OPTIMISE_SHADOW_TEST flag can be used to
+    //  determine if we're in a shadow ray, but it SHOULD be renamed.
+    // We should probably change Optimization_Flags to a "ray-type" variable, that will tell
+    // us if it is primary, reflection, refraction, shadow, primary photon, photon refleciton, or photon refraction ray.
+    int shadow_flag = ray.IsShadowTestRay(); // TODO FIXME - why is this flag not used?!
+
+    Found = Intersect_Children(ray, Depth_Stack, Local_Stack, Thread);
+
+    if (Found)
+        Thread->Stats()[Ray_CSG_Merge_Tests_Succeeded]++;
+
+    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack is in a cleaned-up condition (again)
+    return (Found);
+}
+
+bool CSGMerge::Intersect_Child(ObjectPtr child, const Ray& ray, IStack& Depth_Stack, IStack& Local_Stack, TraceThreadData *Thread)
+{
+    bool Found = false;
+
+    if ( Test_Ray_Flags_Shadow(ray, child) )// TODO CLARIFY - why does CSGUnion use Test_Ray_Flags(), while CSGMerge uses Test_Ray_Flags_Shadow(), and CSGIntersection uses neither?
+    {
+        if (child->Bound.empty() == true || Ray_In_Bound (ray, child->Bound, Thread))
+        {
+            if (child->All_Intersections (ray, Local_Stack, Thread))
+            {
+                while (Local_Stack->size() > 0)
+                {
+                    if (Clip.empty() || Point_In_Clip(Local_Stack->top().IPoint, Clip, Thread))
+                    {
+                        Thread->Stats()[CSG_Merge_Hit_Tests]++;
+
+                        // Hits inside any other child are not on the surface of the merge.
+                        if (!Inside_Any_Child(Local_Stack->top().IPoint, child, &ray, Thread))
+                        {
+                            Local_Stack->top().Csg = this;
+
+                            Found = true;
+
+                            Depth_Stack->push(Local_Stack->top());
+                        }
+                    }
+
+                    Local_Stack->pop();
+                }
+            }
+        }
+    }
+
+    return (Found);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Inside_CSG_Union
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+bool CSGUnion::Inside(const Vector3d& IPoint, TraceThreadData *Thread) const
+{
+    return Inside_Any_Child(IPoint, nullptr, nullptr, Thread);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Inside_CSG_Intersection
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+bool CSGIntersection::Inside(const Vector3d& IPoint, TraceThreadData *Thread) const
+{
+    return Inside_All_Children(IPoint, nullptr, Thread);
+}
+
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   CSG::Intersect_Children
+*
+* INPUT
+*
+*   ray         - Ray to test
+*   Depth_Stack - Intersection stack of the CSG object
+*   Local_Stack - Scratch stack for the hits of a child
+*   Thread      - Thread data
+*
+* OUTPUT
+*
+*   Depth_Stack
+*
+* RETURNS
+*
+*   bool - true if any hit was added
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Intersect the children of the CSG object. Children held in a bounding
+*   hierarchy are only intersected if the ray passes through their boxes.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool CSG::Intersect_Children(const Ray& ray, IStack& Depth_Stack, IStack& Local_Stack, TraceThreadData *Thread)
+{
+    bool Found = false;
+
+    if (!Hierarchy)
+    {
+        for(vector<ObjectPtr>::const_iterator Current_Sib = children.begin(); Current_Sib != children.end(); Current_Sib++)
+        {
+            if (Intersect_Child(*Current_Sib, ray, Depth_Stack, Local_Stack, Thread))
+                Found = true;
+        }
+
+        return (Found);
+    }
+
+    if (!SolidTree.empty() && intersect_node(SolidTree, Solids, 0, ray, Depth_Stack, Local_Stack, Thread))
+        Found = true;
+
+    if (!CutterTree.empty() && intersect_node(CutterTree, Cutters, 0, ray, Depth_Stack, Local_Stack, Thread))
+        Found = true;
+
+    for(vector<ObjectPtr>::const_iterator Current_Sib = Others.begin(); Current_Sib != Others.end(); Current_Sib++)
+    {
+        if (Intersect_Child(*Current_Sib, ray, Depth_Stack, Local_Stack, Thread))
+            Found = true;
+    }
+
+    return (Found);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   CSG::intersect_node
+*
+* INPUT
+*
+*   Tree        - Bounding hierarchy
+*   Entries     - Children of the hierarchy in leaf order
+*   index       - Node of the hierarchy to test
+*   ray         - Ray to test
+*   Depth_Stack - Intersection stack of the CSG object
+*   Local_Stack - Scratch stack for the hits of a child
+*   Thread      - Thread data
+*
+* OUTPUT
+*
+*   Depth_Stack
+*
+* RETURNS
+*
+*   bool - true if any hit was added
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Intersect the children below a node of a bounding hierarchy, skipping
+*   the nodes and children whose boxes the ray misses.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool CSG::intersect_node(const vector<CSGNode>& Tree, const vector<CSGEntry>& Entries, int index, const Ray& ray, IStack& Depth_Stack, IStack& Local_Stack, TraceThreadData *Thread)
 {
-    // TODO CLARIFY - why does this function not ignore NO_IMAGE_FLAG for primary rays, as Test_Ray_Flags() does? [CLi]
-    return ( ( !ray.IsPhotonRay() &&
-               (!Test_Flag(obj, NO_IMAGE_FLAG) || ray.IsImageRay() == false) &&
-               (!Test_Flag(obj, NO_REFLECTION_FLAG) || ray.IsReflectionRay() == false) &&
-               (!Test_Flag(obj, NO_RADIOSITY_FLAG) || ray.IsRadiosityRay() == false) ) ||
-             ( ray.IsPhotonRay() && !Test_Flag(obj, NO_SHADOW_FLAG) ) ||
-             ( ray.IsShadowTestRay() && !Test_Flag(obj, NO_SHADOW_FLAG) ) );
+    const CSGNode& Node = Tree[index];
+    bool Found = false;
+    int i;
+
+    if (!Ray_In_Box(ray, Node.Min, Node.Max))
+        return false;
+
+    if (Node.Leaf)
+    {
+        for (i = Node.First; i < Node.First + Node.Count; i++)
+        {
+            if (Ray_In_Box(ray, Entries[i].Min, Entries[i].Max) &&
+                Intersect_Child(Entries[i].Object, ray, Depth_Stack, Local_Stack, Thread))
+                Found = true;
+        }
+    }
+    else
+    {
+        for (i = Node.First; i < Node.First + Node.Count; i++)
+        {
+            if (intersect_node(Tree, Entries, i, ray, Depth_Stack, Local_Stack, Thread))
+                Found = true;
+        }
+    }
+
+    return (Found);
 }
 
+
+
 /*****************************************************************************
 *
 * FUNCTION
 *
-*   All_CSG_Union_Intersections
+*   CSG::Inside_Any_Child
 *
 * INPUT
 *
+*   IPoint - Point to test
+*   skip   - Child to leave out, or nullptr
+*   ray    - Ray whose type decides which children count, or nullptr for all
+*   Thread - Thread data
+*
 * OUTPUT
 *
 * RETURNS
 *
+*   bool - true if the point is inside any of the children
+*
 * AUTHOR
 *
 *   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   -
+*   Test a point against the children as a union does. A point outside the
+*   box of a solid child is not inside it, while a point outside the box of
+*   a cutter is always inside it.
 *
 * CHANGES
 *
-*   Sep 1994 : Added code to count intersection tests. [DB]
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-bool CSGUnion::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+bool CSG::Inside_Any_Child(const Vector3d& IPoint, ConstObjectPtr skip, const Ray *ray, TraceThreadData *Thread) const
 {
-    int Found;
-
-    Thread->Stats()[Ray_CSG_Union_Tests]++;
-
-    Found = false;
-
-    // Use shortcut if no clip.
-
-    if(Clip.empty())
+    if (!Hierarchy)
     {
         for(vector<ObjectPtr>::const_iterator Current_Sib = children.begin(); Current_Sib != children.end(); Current_Sib++)
         {
-            if(Test_Ray_Flags(ray, (*Current_Sib))) // TODO CLARIFY - why does CSGUnion use Test_Ray_Flags(), while CSGMerge uses Test_Ray_Flags_Shadow(), and CSGIntersection uses neither?
+            if ((*Current_Sib != skip) && Has_Inside(*Current_Sib) && ((ray == nullptr) || Test_Ray_Flags_Shadow(*ray, *Current_Sib)))
             {
-                if((*Current_Sib)->Bound.empty() == true || Ray_In_Bound(ray, (*Current_Sib)->Bound, Thread))
-                {
-                    if((*Current_Sib)->All_Intersections(ray, Depth_Stack, Thread))
-                        Found = true;
-                }
+                if (Inside_Child(IPoint, *Current_Sib, ray, Thread))
+                    return (true);
             }
         }
+
+        return (false);
     }
-    else
+
+    if (!SolidTree.empty() && inside_any_node(0, IPoint, skip, ray, Thread))
+        return (true);
+
+    for(vector<CSGEntry>::const_iterator Entry = Cutters.begin(); Entry != Cutters.end(); Entry++)
     {
-        IStack Local_Stack(Thread->stackPool);
-        POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+        if ((Entry->Object != skip) && ((ray == nullptr) || Test_Ray_Flags_Shadow(*ray, Entry->Object)))
+        {
+            if (!Point_In_Box(IPoint, Entry->Min, Entry->Max) || Inside_Child(IPoint, Entry->Object, ray, Thread))
+                return (true);
+        }
+    }
 
-        for(vector<ObjectPtr>::const_iterator Current_Sib = children.begin(); Current_Sib != children.end(); Current_Sib++)
+    for(vector<ObjectPtr>::const_iterator Current_Sib = Others.begin(); Current_Sib != Others.end(); Current_Sib++)
+    {
+        if ((*Current_Sib != skip) && Has_Inside(*Current_Sib) && ((ray == nullptr) || Test_Ray_Flags_Shadow(*ray, *Current_Sib)))
         {
-            if(Test_Ray_Flags(ray, (*Current_Sib))) // TODO CLARIFY - why does CSGUnion use Test_Ray_Flags(), while CSGMerge uses Test_Ray_Flags_Shadow(), and CSGIntersection uses neither?
-            {
-                if((*Current_Sib)->Bound.empty() == true || Ray_In_Bound(ray, (*Current_Sib)->Bound, Thread))
-                {
-                    if((*Current_Sib)->All_Intersections (ray, Local_Stack, Thread))
-                    {
-                        while(Local_Stack->size() > 0)
-                        {
-                            if(Clip.empty() || Point_In_Clip(Local_Stack->top().IPoint, Clip, Thread))
-                            {
-                                Local_Stack->top().Csg = this;
+            if (Inside_Child(IPoint, *Current_Sib, ray, Thread))
+                return (true);
+        }
+    }
+
+    return (false);
+}
 
-                                Depth_Stack->push(Local_Stack->top());
+bool CSG::inside_any_node(int index, const Vector3d& IPoint, ConstObjectPtr skip, const Ray *ray, TraceThreadData *Thread) const
+{
+    const CSGNode& Node = SolidTree[index];
+    int i;
 
-                                Found = true;
-                            }
+    if (!Point_In_Box(IPoint, Node.Min, Node.Max))
+        return (false);
 
-                            Local_Stack->pop();
-                        }
-                    }
-                }
+    if (Node.Leaf)
+    {
+        for (i = Node.First; i < Node.First + Node.Count; i++)
+        {
+            const CSGEntry& Entry = Solids[i];
+
+            if ((Entry.Object != skip) && ((ray == nullptr) || Test_Ray_Flags_Shadow(*ray, Entry.Object)))
+            {
+                if (Point_In_Box(IPoint, Entry.Min, Entry.Max) && Inside_Child(IPoint, Entry.Object, ray, Thread))
+                    return (true);
             }
         }
-        POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack is in a cleaned-up condition (again)
+    }
+    else
+    {
+        for (i = Node.First; i < Node.First + Node.Count; i++)
+        {
+            if (inside_any_node(i, IPoint, skip, ray, Thread))
+                return (true);
+        }
     }
 
-    if(Found)
-        Thread->Stats()[Ray_CSG_Union_Tests_Succeeded]++;
-
-    return (Found);
+    return (false);
 }
 
 
@@ -180,86 +735,107 @@ bool CSGUnion::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThrea
 *
 * FUNCTION
 *
-*   All_CSG_Intersection_Intersections
+*   CSG::Inside_All_Children
 *
 * INPUT
 *
+*   IPoint - Point to test
+*   skip   - Child to leave out, or nullptr
+*   Thread - Thread data
+*
 * OUTPUT
 *
 * RETURNS
 *
+*   bool - true if the point is inside all of the children
+*
 * AUTHOR
 *
 *   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   -
+*   Test a point against the children as an intersection does. Only the
+*   cutters whose boxes contain the point need a closer look, which is what
+*   keeps differences with many cutters fast.
 *
 * CHANGES
 *
-*   Sep 1994 : Added code to count intersection tests. [DB]
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-bool CSGIntersection::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+bool CSG::Inside_All_Children(const Vector3d& IPoint, ConstObjectPtr skip, TraceThreadData *Thread) const
 {
-    int Maybe_Found, Found;
-    IStack Local_Stack(Thread->stackPool);
-    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+    if (!Hierarchy)
+    {
+        for(vector<ObjectPtr>::const_iterator Current_Sib = children.begin(); Current_Sib != children.end(); Current_Sib++)
+        {
+            if ((*Current_Sib != skip) && Has_Inside(*Current_Sib))
+            {
+                if (!Inside_Object(IPoint, *Current_Sib, Thread))
+                    return (false);
+            }
+        }
 
-    Thread->Stats()[Ray_CSG_Intersection_Tests]++;
+        return (true);
+    }
+
+    for(vector<CSGEntry>::const_iterator Entry = Solids.begin(); Entry != Solids.end(); Entry++)
+    {
+        if (Entry->Object != skip)
+        {
+            if (!Point_In_Box(IPoint, Entry->Min, Entry->Max) || !Inside_Object(IPoint, Entry->Object, Thread))
+                return (false);
+        }
+    }
 
-    Found = false;
+    if (!CutterTree.empty() && !inside_all_node(0, IPoint, skip, Thread))
+        return (false);
 
-    for(vector<ObjectPtr>::const_iterator Current_Sib = children.begin(); Current_Sib != children.end(); Current_Sib++)
+    for(vector<ObjectPtr>::const_iterator Current_Sib = Others.begin(); Current_Sib != Others.end(); Current_Sib++)
     {
-        if ((*Current_Sib)->Bound.empty() == true || Ray_In_Bound(ray, (*Current_Sib)->Bound, Thread))
+        if ((*Current_Sib != skip) && Has_Inside(*Current_Sib))
         {
-            if((*Current_Sib)->All_Intersections(ray, Local_Stack, Thread))
-            {
-                while(Local_Stack->size() > 0)
-                {
-                    Maybe_Found = true;
+            if (!Inside_Object(IPoint, *Current_Sib, Thread))
+                return (false);
+        }
+    }
 
-                    for(vector<ObjectPtr>::const_iterator Inside_Sib = children.begin(); Inside_Sib != children.end(); Inside_Sib++)
-                    {
-                        if(*Inside_Sib != *Current_Sib)
-                        {
-                            if(!((*Inside_Sib)->Type & LIGHT_SOURCE_OBJECT) || (!(reinterpret_cast<LightSource *>(*Inside_Sib))->children.empty()))
-                            {
-                                if(!Inside_Object(Local_Stack->top().IPoint, *Inside_Sib, Thread))
-                                {
-                                    Maybe_Found = false;
-                                    break;
-                                }
-                            }
-                        }
-                    }
+    return (true);
+}
 
-                    if(Maybe_Found)
-                    {
-                        if(Clip.empty() || Point_In_Clip(Local_Stack->top().IPoint, Clip, Thread))
-                        {
-                            Local_Stack->top().Csg = this;
+bool CSG::inside_all_node(int index, const Vector3d& IPoint, ConstObjectPtr skip, TraceThreadData *Thread) const
+{
+    const CSGNode& Node = CutterTree[index];
+    int i;
 
-                            Depth_Stack->push(Local_Stack->top());
+    if (!Point_In_Box(IPoint, Node.Min, Node.Max))
+        return (true);
 
-                            Found = true;
-                        }
-                    }
+    if (Node.Leaf)
+    {
+        for (i = Node.First; i < Node.First + Node.Count; i++)
+        {
+            const CSGEntry& Entry = Cutters[i];
 
-                    Local_Stack->pop();
-                }
+            if ((Entry.Object != skip) && Point_In_Box(IPoint, Entry.Min, Entry.Max))
+            {
+                if (!Inside_Object(IPoint, Entry.Object, Thread))
+                    return (false);
             }
         }
     }
+    else
+    {
+        for (i = Node.First; i < Node.First + Node.Count; i++)
+        {
+            if (!inside_all_node(i, IPoint, skip, Thread))
+                return (false);
+        }
+    }
 
-    if(Found)
-        Thread->Stats()[Ray_CSG_Intersection_Tests_Succeeded]++;
-
-    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack is in a cleaned-up condition (again)
-    return (Found);
+    return (true);
 }
 
 
@@ -268,7 +844,7 @@ bool CSGIntersection::All_Intersections(const Ray& ray, IStack& Depth_Stack, Tra
 *
 * FUNCTION
 *
-*   All_CSG_Merge_Intersections
+*   CSG::Build_Hierarchy
 *
 * INPUT
 *
@@ -282,82 +858,73 @@ bool CSGIntersection::All_Intersections(const Ray& ray, IStack& Depth_Stack, Tra
 *
 * DESCRIPTION
 *
-*   -
+*   Sort the children into solids, whose boxes bound their inside, cutters,
+*   i.e. inverted children whose boxes bound what they cut away, and others,
+*   and build a bounding hierarchy over each of the first two groups. CSG
+*   objects with few children do without.
 *
 * CHANGES
 *
-*   Sep 1994 : Added code to count intersection tests. [DB]
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-bool CSGMerge::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+void CSG::Build_Hierarchy()
 {
-    int Found;
-    bool inside_flag;
-    IStack Local_Stack(Thread->stackPool);
-    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+    CSGEntry Entry;
 
-    Thread->Stats()[Ray_CSG_Merge_Tests]++;
+    Solids.clear();
+    Cutters.clear();
+    Others.clear();
+    SolidTree.clear();
+    CutterTree.clear();
 
-    Found = false;
+    Hierarchy = false;
 
-    // FIXME - though the name is misleading, the OPTIMISE_SHADOW_TEST flag can be used to
-    //  determine if we're in a shadow ray, but it SHOULD be renamed.
-    // We should probably change Optimization_Flags to a "ray-type" variable, that will tell
-    // us if it is primary, reflection, refraction, shadow, primary photon, photon refleciton, or photon refraction ray.
-    int shadow_flag = ray.IsShadowTestRay(); // TODO FIXME - why is this flag not used?!
+    if (children.size() < CSG_HIERARCHY_MIN_CHILDREN)
+        return;
 
-    for(vector<ObjectPtr>::const_iterator Sib1 = children.begin(); Sib1 != children.end(); Sib1++)
+    for(vector<ObjectPtr>::iterator Current_Sib = children.begin(); Current_Sib != children.end(); Current_Sib++)
     {
-        if ( Test_Ray_Flags_Shadow(ray, (*Sib1)) )// TODO CLARIFY - why does CSGUnion use Test_Ray_Flags(), while CSGMerge uses Test_Ray_Flags_Shadow(), and CSGIntersection uses neither?
-        {
-            if ((*Sib1)->Bound.empty() == true || Ray_In_Bound (ray, (*Sib1)->Bound, Thread))
-            {
-                if ((*Sib1)->All_Intersections (ray, Local_Stack, Thread))
-                {
-                    while (Local_Stack->size() > 0)
-                    {
-                        if (Clip.empty() || Point_In_Clip(Local_Stack->top().IPoint, Clip, Thread))
-                        {
-                            inside_flag = true;
-
-                            for(vector<ObjectPtr>::const_iterator Sib2 = children.begin(); (Sib2 != children.end()) && (inside_flag == true); Sib2++)
-                            {
-                                if (*Sib1 != *Sib2)
-                                {
-                                    if (!((*Sib2)->Type & LIGHT_SOURCE_OBJECT) || (!(reinterpret_cast<LightSource *>(*Sib2))->children.empty()))
-                                    {
-                                        if ( Test_Ray_Flags_Shadow(ray, (*Sib2)) )// TODO CLARIFY - why does CSGUnion use Test_Ray_Flags(), while CSGMerge uses Test_Ray_Flags_Shadow(), and CSGIntersection uses neither?
-                                        {
-                                            if (Inside_Object(Local_Stack->top().IPoint, *Sib2, Thread))
-                                                inside_flag = false;
-                                        }
-                                    }
-                                }
-                            }
-
-                            if (inside_flag == true)
-                            {
-                                Local_Stack->top().Csg = this;
-
-                                Found = true;
-
-                                Depth_Stack->push(Local_Stack->top());
-                            }
-                        }
+        ObjectPtr Object = *Current_Sib;
 
-                        Local_Stack->pop();
-                    }
-                }
-            }
+        /*
+         * Same reservations as in Compute_BBox(), plus boxes too large to be
+         * of use. Planes and quadrics are inverted without the inverted flag.
+         */
+
+        if (((Object->Type & LIGHT_SOURCE_OBJECT) != 0) ||
+            (dynamic_cast<HField *>(Object) != nullptr) || // FIXME
+            (dynamic_cast<Quadric *>(Object) != nullptr) || // FIXME
+            (dynamic_cast<Plane *>(Object) != nullptr) || // FIXME
+            (Object->BBox.size[X] > CRITICAL_LENGTH) ||
+            (Object->BBox.size[Y] > CRITICAL_LENGTH) ||
+            (Object->BBox.size[Z] > CRITICAL_LENGTH))
+        {
+            Others.push_back(Object);
+            continue;
         }
+
+        Make_CSG_Entry(Entry, Object);
+
+        if (!Test_Flag(Object, INVERTED_FLAG))
+            Solids.push_back(Entry);
+        else if (Object->Clip.empty())
+            Cutters.push_back(Entry);
+        else
+            Others.push_back(Object);
     }
 
-    if (Found)
-        Thread->Stats()[Ray_CSG_Merge_Tests_Succeeded]++;
+    if (Solids.empty() && Cutters.empty())
+    {
+        Others.clear();
+        return;
+    }
 
-    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack is in a cleaned-up condition (again)
-    return (Found);
+    build_tree(Solids, SolidTree);
+    build_tree(Cutters, CutterTree);
+
+    Hierarchy = true;
 }
 
 
@@ -366,12 +933,17 @@ bool CSGMerge::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThrea
 *
 * FUNCTION
 *
-*   Inside_CSG_Union
+*   CSG::build_tree
 *
 * INPUT
 *
+*   Entries - Children to build the hierarchy over
+*
 * OUTPUT
 *
+*   Entries - Children in leaf order
+*   Tree    - Flattened hierarchy
+*
 * RETURNS
 *
 * AUTHOR
@@ -380,26 +952,64 @@ bool CSGMerge::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThrea
 *
 * DESCRIPTION
 *
-*   -
+*   Build a box hierarchy over some of the children using the surface area
+*   heuristic, and flatten it into the node array.
 *
 * CHANGES
 *
-*   -
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-bool CSGUnion::Inside(const Vector3d& IPoint, TraceThreadData *Thread) const
+void CSG::build_tree(vector<CSGEntry>& Entries, vector<CSGNode>& Tree)
 {
-    for(vector<ObjectPtr>::const_iterator Current_Sib = children.begin(); Current_Sib != children.end(); Current_Sib++)
+    BBOX_TREE **Elements, *Root;
+    vector<CSGEntry> Ordered;
+    size_t i, nElem;
+
+    nElem = Entries.size();
+
+    if (nElem == 0)
+        return;
+
+    Tree.resize(1);
+
+    if (nElem == 1)
     {
-        if(!((*Current_Sib)->Type & LIGHT_SOURCE_OBJECT) || (!(reinterpret_cast<LightSource *>(*Current_Sib))->children.empty()))
-        {
-            if(Inside_Object(IPoint, *Current_Sib, Thread))
-                return (true);
-        }
+        /* A lone child makes a leaf of its own. */
+
+        Tree[0].Min   = Entries[0].Min;
+        Tree[0].Max   = Entries[0].Max;
+        Tree[0].First = 0;
+        Tree[0].Count = 1;
+        Tree[0].Leaf  = true;
+
+        return;
     }
 
-    return (false);
+    Elements = reinterpret_cast<BBOX_TREE **>(POV_MALLOC(nElem*sizeof(BBOX_TREE *), "CSG bounding hierarchy"));
+
+    for (i = 0; i < nElem; i++)
+    {
+        Elements[i] = reinterpret_cast<BBOX_TREE *>(POV_MALLOC(sizeof(BBOX_TREE), "CSG bounding hierarchy"));
+
+        Elements[i]->Infinite = false;
+        Elements[i]->Entries  = 0;
+        Elements[i]->Node     = reinterpret_cast<BBOX_TREE **>(&Entries[i]);
+        Make_BBox_from_min_max(Elements[i]->BBox, Entries[i].Min, Entries[i].Max);
+    }
+
+    Build_BBox_Tree_SAH(&Root, nElem, Elements, 0, nullptr);
+
+    POV_FREE(Elements);
+
+    Ordered.reserve(nElem);
+
+    flatten_hierarchy(Root, 0, Tree, Ordered);
+
+    Destroy_BBox_Tree(Root);
+
+    Entries.swap(Ordered);
 }
 
 
@@ -408,12 +1018,18 @@ bool CSGUnion::Inside(const Vector3d& IPoint, TraceThreadData *Thread) const
 *
 * FUNCTION
 *
-*   Inside_CSG_Intersection
+*   CSG::flatten_hierarchy
 *
 * INPUT
 *
+*   Node    - Node of the hierarchy built by Build_BBox_Tree_SAH()
+*   index   - Slot of the node in the node array
+*
 * OUTPUT
 *
+*   Tree    - Node array
+*   Entries - Children in leaf order
+*
 * RETURNS
 *
 * AUTHOR
@@ -422,23 +1038,89 @@ bool CSGUnion::Inside(const Vector3d& IPoint, TraceThreadData *Thread) const
 *
 * DESCRIPTION
 *
-*   -
+*   Store a node in the node array, gathering its child objects into a leaf
+*   of their own, and recurse into its other children.
 *
 * CHANGES
 *
-*   -
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-bool CSGIntersection::Inside(const Vector3d& IPoint, TraceThreadData *Thread) const
+void CSG::flatten_hierarchy(const BBOX_TREE *Node, int index, vector<CSGNode>& Tree, vector<CSGEntry>& Entries)
 {
-    for(vector<ObjectPtr>::const_iterator Current_Sib = children.begin(); Current_Sib != children.end(); Current_Sib++)
-        if(!((*Current_Sib)->Type & LIGHT_SOURCE_OBJECT) || (!(reinterpret_cast<LightSource *>(*Current_Sib))->children.empty()))
-            if(!Inside_Object(IPoint, (*Current_Sib), Thread))
-                return (false);
-    return (true);
-}
+    int i, k, first, count, objects;
+
+    objects = 0;
+    count = 0;
+
+    for (i = 0; i < Node->Entries; i++)
+    {
+        if (Node->Node[i]->Entries == 0)
+            objects++;
+        else
+            count++;
+    }
+
+    if (objects > 0)
+        count++;
+
+    first = (int)Tree.size();
+
+    Tree.resize(first + count);
+
+    k = first;
 
+    if (objects > 0)
+    {
+        CSGNode& Leaf = Tree[k++];
+
+        Leaf.First = (int)Entries.size();
+        Leaf.Count = objects;
+        Leaf.Leaf  = true;
+
+        for (i = 0; i < Node->Entries; i++)
+        {
+            if (Node->Node[i]->Entries == 0)
+            {
+                Entries.push_back(*reinterpret_cast<const CSGEntry *>(Node->Node[i]->Node));
+
+                if (Entries.size() == (size_t)Leaf.First + 1)
+                {
+                    Leaf.Min = Entries.back().Min;
+                    Leaf.Max = Entries.back().Max;
+                }
+                else
+                {
+                    Leaf.Min = min(Leaf.Min, Entries.back().Min);
+                    Leaf.Max = max(Leaf.Max, Entries.back().Max);
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < Node->Entries; i++)
+    {
+        if (Node->Node[i]->Entries != 0)
+            flatten_hierarchy(Node->Node[i], k++, Tree, Entries);
+    }
+
+    /* The node's box encloses those of its children. */
+
+    CSGNode& Inner = Tree[index];
+
+    Inner.First = first;
+    Inner.Count = count;
+    Inner.Leaf  = false;
+    Inner.Min   = Tree[first].Min;
+    Inner.Max   = Tree[first].Max;
+
+    for (k = first + 1; k < first + count; k++)
+    {
+        Inner.Min = min(Inner.Min, Tree[k].Min);
+        Inner.Max = max(Inner.Max, Tree[k].Max);
+    }
+}
 
 
 
@@ -475,6 +1157,8 @@ void CSG::Translate(const Vector3d& Vector, const TRANSFORM *tr)
         Translate_Object (*Current_Sib, Vector, tr) ;
 
     Recompute_BBox(&BBox, tr);
+
+    Build_Hierarchy();
 }
 
 
@@ -512,6 +1196,8 @@ void CSG::Rotate(const Vector3d& Vector, const TRANSFORM *tr)
         Rotate_Object (*Current_Sib, Vector, tr) ;
 
     Recompute_BBox(&BBox, tr);
+
+    Build_Hierarchy();
 }
 
 
@@ -549,6 +1235,8 @@ void CSG::Scale(const Vector3d& Vector, const TRANSFORM *tr)
         Scale_Object (*Current_Sib, Vector, tr) ;
 
     Recompute_BBox(&BBox, tr);
+
+    Build_Hierarchy();
 }
 
 
@@ -586,6 +1274,8 @@ void CSG::Transform(const TRANSFORM *tr)
         Transform_Object(*Current_Sib, tr);
 
     Recompute_BBox(&BBox, tr);
+
+    Build_Hierarchy();
 }
 
 /*****************************************************************************
@@ -780,6 +1470,8 @@ ObjectPtr CSGUnion::Copy()
     for(vector<ObjectPtr>::iterator i(children.begin()); i != children.end(); i++)
         New->children.push_back(Copy_Object(*i));
 
+    New->Build_Hierarchy();
+
     if(Type & LIGHT_GROUP_OBJECT)
     {
         New->LLights.clear();
@@ -800,6 +1492,8 @@ ObjectPtr CSGMerge::Copy()
     for(vector<ObjectPtr>::iterator i(children.begin()); i != children.end(); i++)
         New->children.push_back(Copy_Object(*i));
 
+    New->Build_Hierarchy();
+
     if(Type & LIGHT_GROUP_OBJECT)
     {
         New->LLights.clear();
@@ -820,6 +1514,8 @@ ObjectPtr CSGIntersection::Copy()
     for(vector<ObjectPtr>::iterator i(children.begin()); i != children.end(); i++)
         New->children.push_back(Copy_Object(*i));
 
+    New->Build_Hierarchy();
+
     if(Type & LIGHT_GROUP_OBJECT)
     {
         New->LLights.clear();
@@ -949,6 +1645,8 @@ void CSG::Compute_BBox()
                 Make_BBox(BBox, -BOUND_HUGE/2, -BOUND_HUGE/2, -BOUND_HUGE/2, BOUND_HUGE, BOUND_HUGE, BOUND_HUGE);
         }
     }
+
+    Build_Hierarchy();
 }
 
 
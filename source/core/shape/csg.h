@@ -68,11 +68,33 @@ namespace pov
 * Global typedefs
 ******************************************************************************/
 
+/// Node of the bounding hierarchy of a CSG object's children.
+///
+/// The nodes are kept in a flat array, with the children of each inner node in consecutive
+/// slots. A leaf refers to a run of entries in the matching @ref CSGEntry array.
+///
+struct CSGNode
+{
+    Vector3d Min;   ///< Lower corner of the node's bounding box.
+    Vector3d Max;   ///< Upper corner of the node's bounding box.
+    int First;      ///< Index of the first child node, or of the first entry of a leaf.
+    int Count;      ///< Number of child nodes, or of entries in a leaf.
+    bool Leaf;      ///< Whether the node is a leaf.
+};
+
+/// Child of a CSG object held in a bounding hierarchy, along with its slightly padded box.
+struct CSGEntry
+{
+    Vector3d Min;
+    Vector3d Max;
+    ObjectPtr Object;
+};
+
 class CSG : public CompoundObject
 {
     public:
-        CSG(int t) : CompoundObject(t) {}
-        CSG(int t, CompoundObject& o, bool transplant) : CompoundObject(t, o, transplant) {}
+        CSG(int t) : CompoundObject(t), Hierarchy(false) {}
+        CSG(int t, CompoundObject& o, bool transplant) : CompoundObject(t, o, transplant) { Build_Hierarchy(); }
 
         int do_split;
 
@@ -85,6 +107,38 @@ class CSG : public CompoundObject
         virtual void Compute_BBox();
 
         void Determine_Textures(Intersection *isect, bool hitinside, WeightedTextureVector& textures, TraceThreadData *Threaddata);
+    protected:
+        /// Children whose boxes bound their interior, in leaf order of @ref SolidTree.
+        vector<CSGEntry> Solids;
+        /// Inverted unclipped children, whose boxes bound what they exclude, in leaf order of @ref CutterTree.
+        vector<CSGEntry> Cutters;
+        /// Children that fit neither hierarchy, such as infinite ones and light sources.
+        vector<ObjectPtr> Others;
+        vector<CSGNode> SolidTree;      ///< Hierarchy over @ref Solids, empty if not used.
+        vector<CSGNode> CutterTree;     ///< Hierarchy over @ref Cutters, empty if not used.
+        bool Hierarchy;                 ///< Whether the children are held in the hierarchies.
+
+        /// Intersect one child, adding the hits that survive to the intersection stack.
+        ///
+        /// @param[in]      child           Child to intersect.
+        /// @param[in]      ray             Ray to test.
+        /// @param[in,out]  Depth_Stack     Intersection stack of the CSG object.
+        /// @param[in,out]  Local_Stack     Scratch stack for the child's hits.
+        /// @param[in]      Thread          Thread data.
+        /// @return                         Whether a hit was added.
+        ///
+        virtual bool Intersect_Child(ObjectPtr child, const Ray& ray, IStack& Depth_Stack, IStack& Local_Stack, TraceThreadData *Thread) = 0;
+
+        void Build_Hierarchy();
+        bool Intersect_Children(const Ray& ray, IStack& Depth_Stack, IStack& Local_Stack, TraceThreadData *Thread);
+        bool Inside_Any_Child(const Vector3d& IPoint, ConstObjectPtr skip, const Ray *ray, TraceThreadData *Thread) const;
+        bool Inside_All_Children(const Vector3d& IPoint, ConstObjectPtr skip, TraceThreadData *Thread) const;
+    private:
+        static void flatten_hierarchy(const BBOX_TREE *Node, int index, vector<CSGNode>& Tree, vector<CSGEntry>& Entries);
+        static void build_tree(vector<CSGEntry>& Entries, vector<CSGNode>& Tree);
+        bool intersect_node(const vector<CSGNode>& Tree, const vector<CSGEntry>& Entries, int index, const Ray& ray, IStack& Depth_Stack, IStack& Local_Stack, TraceThreadData *Thread);
+        bool inside_any_node(int index, const Vector3d& IPoint, ConstObjectPtr skip, const Ray *ray, TraceThreadData *Thread) const;
+        bool inside_all_node(int index, const Vector3d& IPoint, ConstObjectPtr skip, TraceThreadData *Thread) const;
 };
 
 class CSGUnion : public CSG
@@ -99,6 +153,8 @@ class CSGUnion : public CSG
         virtual bool All_Intersections(const Ray&, IStack&, TraceThreadData *);
         virtual bool Inside(const Vector3d&, TraceThreadData *) const;
         virtual ObjectPtr Invert();
+    protected:
+        virtual bool Intersect_Child(ObjectPtr, const Ray&, IStack&, IStack&, TraceThreadData *);
 };
 
 class CSGMerge : public CSGUnion
@@ -110,6 +166,8 @@ class CSGMerge : public CSGUnion
         virtual ObjectPtr Copy();
 
         virtual bool All_Intersections(const Ray&, IStack&, TraceThreadData *);
+    protected:
+        virtual bool Intersect_Child(ObjectPtr, const Ray&, IStack&, IStack&, TraceThreadData *);
 };
 
 class CSGIntersection : public CSG
@@ -125,6 +183,8 @@ class CSGIntersection : public CSG
         virtual ObjectPtr Invert();
 
         bool isDifference;
+    protected:
+        virtual bool Intersect_Child(ObjectPtr, const Ray&, IStack&, IStack&, TraceThreadData *);
 };
 
 /// @}
@@ -126,6 +126,9 @@ bool Fractal::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThread
     Vector3d IPoint, Mid_Point, Next_Point, Real_Pt;
     Vector3d Real_Normal, F_Normal;
     Vector3d Direction;
+    Vector3d Lane_Point[FRACTAL_LANES];
+    bool Lane_Inside[FRACTAL_LANES];
+    int Lanes, k;
     BasicRay New_Ray;
 
     Thread->Stats()[Ray_Fractal_Tests]++;
@@ -210,6 +213,51 @@ bool Fractal::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThread
          * position in IPoint...
          */
 
+        /*
+         * Inside the set every step is of Precision, so several steps can be
+         * tested at once. Stop at the last point before the set is left.
+         */
+
+        if (CurrentIsInside && (Dist <= Precision))
+        {
+            while (1)
+            {
+                Lanes = (int)min((DBL)FRACTAL_LANES, floor((Depth_Max - Depth) / Precision));
+
+                if (Lanes < 1)
+                {
+                    if (Intersection_Found)
+                        Thread->Stats()[Ray_Fractal_Tests_Succeeded]++;
+                    return (Intersection_Found);
+                }
+
+                for (k = 0; k < Lanes; k++)
+                    Lane_Point[k] = Next_Point + ((k + 1) * Precision) * Direction;
+
+                Rules->Iterate(Lane_Point, Lanes, this, Lane_Inside, Thread->Fractal_IStack);
+
+                for (k = 0; (k < Lanes) && Lane_Inside[k]; k++)
+                    ;
+
+                if (k == Lanes)
+                {
+                    Next_Point = Lane_Point[Lanes - 1];
+                    Depth += Lanes * Precision;
+                    continue;
+                }
+
+                if (k > 0)
+                {
+                    Next_Point = Lane_Point[k - 1];
+                    Depth += k * Precision;
+                }
+
+                break;
+            }
+
+            Dist = Precision;
+        }
+
         while (1)
         {
             if (Dist < Precision)
@@ -873,4 +921,44 @@ void Fractal::Free_Iteration_Stack(DBL **IStack)
     }
 }
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   FractalRules::Iterate (lane kernel)
+*
+* INPUT
+*
+*   Points    - Points to test
+*   Count     - Number of points
+*   fractal   - Fractal
+*   IterStack - Iteration stack, left undefined
+*
+* OUTPUT
+*
+*   Inside    - Whether each of the points is inside the set
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Test the points one after the other, for the algebras without a lane
+*   kernel of their own.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void FractalRules::Iterate(const Vector3d *Points, int Count, const Fractal *fractal, bool *Inside, DBL **IterStack) const
+{
+    for (int k = 0; k < Count; k++)
+        Inside[k] = Iterate(Points[k], fractal, IterStack);
+}
+
 }
@@ -59,6 +59,9 @@ namespace pov
 #define QUATERNION_TYPE    0
 #define HYPERCOMPLEX_TYPE  1
 
+/* Number of points along a ray tested together while marching inside the set */
+#define FRACTAL_LANES      4
+
 /* Hcmplx function stypes must come first */
 #define EXP_STYPE          0
 #define LN_STYPE           1
@@ -0,0 +1,703 @@
+//******************************************************************************
+///
+/// @file core/shape/hair.cpp
+///
+/// Implementation of the hair geometric primitive.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "core/shape/hair.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "base/mathutil.h"
+#include "base/memoryaccounting.h"
+#include "base/pov_err.h"
+
+#include "core/bounding/boundingbox.h"
+#include "core/math/matrix.h"
+#include "core/render/ray.h"
+#include "core/scene/tracethreaddata.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+/*****************************************************************************
+* Local preprocessor defines
+******************************************************************************/
+
+const DBL DEPTH_TOLERANCE = 1e-6;
+
+/// Identifier at the start of a binary hair file.
+const char HAIR_FILE_MAGIC[8] = { 'P', 'O', 'V', 'H', 'A', 'I', 'R', 0 };
+
+/// Version of the binary hair file format.
+const unsigned int HAIR_FILE_VERSION = 1;
+
+/// Value identifying the byte order of a binary hair file.
+const unsigned int HAIR_FILE_BYTE_ORDER = 0x01020304;
+
+/// Deviation from a straight line, relative to the radius, below which a piece of a segment is
+/// intersected as if it were straight.
+const DBL HAIR_FLATNESS = 0.05;
+
+/// Maximum number of times a segment is halved when intersected.
+const int HAIR_MAX_SUBDIVISIONS = 10;
+
+/// Header of a binary hair file.
+///
+/// The header is followed by the number of points of each strand as `unsigned int`, then the
+/// points of all strands as quadruples of `float`, giving x, y, z and radius. All data is in the
+/// in-memory layout of the platform reading the file.
+///
+struct Hair_File_Header
+{
+    char Magic[8];                  ///< @ref HAIR_FILE_MAGIC.
+    unsigned int Version;           ///< @ref HAIR_FILE_VERSION.
+    unsigned int Byte_Order;        ///< @ref HAIR_FILE_BYTE_ORDER.
+    unsigned int Flags;             ///< Reserved for future use; must be zero.
+    unsigned int Number_Of_Strands; ///< Number of strands.
+    unsigned int Number_Of_Points;  ///< Number of points of all strands.
+    unsigned int Reserved;
+};
+
+/// Nearest hit on a segment found so far, in the segment's ray-aligned coordinate system.
+struct HairHit
+{
+    DBL Depth;                      ///< Distance along the ray.
+    DBL U;                          ///< Curve parameter.
+    DBL Side;                       ///< Signed distance from the curve, relative to the radius.
+    Vector3d Normal;                ///< Cylinder normal.
+};
+
+/// Bézier form of a segment, in the ray-aligned coordinate system.
+struct HairCurve
+{
+    Vector3d Control[4];
+    DBL Radii[4];
+    DBL Depth_Tolerance;
+};
+
+/*****************************************************************************
+* Static functions
+******************************************************************************/
+
+/// Convert a spline segment to Bézier form.
+///
+/// @param[in]  type        Spline type.
+/// @param[in]  Points      Points the segment is derived from, as x, y, z and radius.
+/// @param[out] Control     Bézier control points.
+/// @param[out] Radii       Bézier control values of the radius.
+///
+static void bezier_segment(int type, const float *Points, Vector3d *Control, DBL *Radii)
+{
+    DBL p[4][4];
+
+    for (int i = 0; i < ((type == LINEAR_SPLINE_HAIR) ? 2 : 4); i++)
+        for (int a = 0; a < 4; a++)
+            p[i][a] = Points[4*i + a];
+
+    for (int a = 0; a < 4; a++)
+    {
+        DBL b[4];
+
+        switch (type)
+        {
+            case B_SPLINE_HAIR:
+                b[0] = (p[0][a] + 4.0 * p[1][a] + p[2][a]) / 6.0;
+                b[1] = (4.0 * p[1][a] + 2.0 * p[2][a]) / 6.0;
+                b[2] = (2.0 * p[1][a] + 4.0 * p[2][a]) / 6.0;
+                b[3] = (p[1][a] + 4.0 * p[2][a] + p[3][a]) / 6.0;
+                break;
+
+            case CATMULL_ROM_SPLINE_HAIR:
+                b[0] = p[1][a];
+                b[1] = p[1][a] + (p[2][a] - p[0][a]) / 6.0;
+                b[2] = p[2][a] - (p[3][a] - p[1][a]) / 6.0;
+                b[3] = p[2][a];
+                break;
+
+            default:
+                b[0] = p[0][a];
+                b[1] = (2.0 * p[0][a] + p[1][a]) / 3.0;
+                b[2] = (p[0][a] + 2.0 * p[1][a]) / 3.0;
+                b[3] = p[1][a];
+                break;
+        }
+
+        for (int i = 0; i < 4; i++)
+        {
+            if (a < 3)
+                Control[i][a] = b[i];
+            else
+                Radii[i] = b[i];
+        }
+    }
+}
+
+/// Bounds of a cubic Bézier curve with radius.
+///
+/// By the convex hull property of Bézier curves, the curve and its radius are bounded by their
+/// control points and values.
+///
+static void bezier_bounds(const Vector3d *Control, const DBL *Radii, Vector3d& Min, Vector3d& Max)
+{
+    DBL MaxRadius = max(0.0, max(max(Radii[0], Radii[1]), max(Radii[2], Radii[3])));
+
+    for (int a = 0; a < 3; a++)
+    {
+        Min[a] = min(min(Control[0][a], Control[1][a]), min(Control[2][a], Control[3][a])) - MaxRadius;
+        Max[a] = max(max(Control[0][a], Control[1][a]), max(Control[2][a], Control[3][a])) + MaxRadius;
+    }
+}
+
+/// Split a cubic Bézier curve in half.
+template<typename T>
+static void bezier_split(const T *c, T *left, T *right)
+{
+    T c01  = (c[0] + c[1]) * 0.5;
+    T c12  = (c[1] + c[2]) * 0.5;
+    T c23  = (c[2] + c[3]) * 0.5;
+    T c012 = (c01 + c12) * 0.5;
+    T c123 = (c12 + c23) * 0.5;
+    T mid  = (c012 + c123) * 0.5;
+
+    left[0]  = c[0];  left[1]  = c01;  left[2]  = c012; left[3]  = mid;
+    right[0] = mid;   right[1] = c123; right[2] = c23;  right[3] = c[3];
+}
+
+/// Evaluate a cubic Bézier curve.
+template<typename T>
+static T bezier_evaluate(const T *c, DBL t)
+{
+    DBL s = 1.0 - t;
+    return c[0] * (s * s * s) + c[1] * (3.0 * s * s * t) + c[2] * (3.0 * s * t * t) + c[3] * (t * t * t);
+}
+
+/// Intersect a piece of a segment with the ray along the z axis through the origin.
+///
+/// The piece is halved until it is deemed flat, then intersected as a straight ribbon facing the
+/// ray, and the hit is computed from the curve itself at the closest parameter value. The
+/// half-plane tests at either end of the straight piece make adjacent pieces meet without gaps
+/// or overlaps.
+///
+/// @param[in]      Curve       Complete segment.
+/// @param[in]      Control     Control points of the piece.
+/// @param[in]      Radii       Control values of the radius of the piece.
+/// @param[in]      u0          Curve parameter at the start of the piece.
+/// @param[in]      u1          Curve parameter at the end of the piece.
+/// @param[in]      Depth       Number of subdivisions left.
+/// @param[in,out]  Hit         Nearest hit found so far.
+///
+static void intersect_piece(const HairCurve& Curve, const Vector3d *Control, const DBL *Radii, DBL u0, DBL u1, int Depth, HairHit& Hit)
+{
+    DBL MaxRadius = max(max(Radii[0], Radii[1]), max(Radii[2], Radii[3]));
+
+    if (MaxRadius <= 0.0)
+        return;
+
+    Vector3d Min, Max;
+
+    bezier_bounds(Control, Radii, Min, Max);
+
+    if ((Min[X] > 0.0) || (Max[X] < 0.0) || (Min[Y] > 0.0) || (Max[Y] < 0.0) ||
+        (Max[Z] < Curve.Depth_Tolerance) || (Min[Z] > Hit.Depth))
+        return;
+
+    if (Depth > 0)
+    {
+        Vector3d CLeft[4], CRight[4];
+        DBL RLeft[4], RRight[4];
+        DBL um = 0.5 * (u0 + u1);
+
+        bezier_split(Control, CLeft, CRight);
+        bezier_split(Radii, RLeft, RRight);
+
+        intersect_piece(Curve, CLeft,  RLeft,  u0, um, Depth - 1, Hit);
+        intersect_piece(Curve, CRight, RRight, um, u1, Depth - 1, Hit);
+        return;
+    }
+
+    // The ray must pass beyond the start and before the end of the piece.
+
+    if ((Control[1][Y] - Control[0][Y]) * -Control[0][Y] + Control[0][X] * (Control[0][X] - Control[1][X]) < 0.0)
+        return;
+
+    if ((Control[2][Y] - Control[3][Y]) * -Control[3][Y] + Control[3][X] * (Control[3][X] - Control[2][X]) < 0.0)
+        return;
+
+    Vector2d Chord(Control[3][X] - Control[0][X], Control[3][Y] - Control[0][Y]);
+    DBL ChordSqr = Chord.lengthSqr();
+
+    if (ChordSqr == 0.0)
+        return;
+
+    DBL w = -(Control[0][X] * Chord[X] + Control[0][Y] * Chord[Y]) / ChordSqr;
+    DBL u = clip(u0 + w * (u1 - u0), u0, u1);
+
+    Vector3d Centre = bezier_evaluate(Curve.Control, u);
+    DBL Radius = bezier_evaluate(Curve.Radii, u);
+    DBL DistanceSqr = Sqr(Centre[X]) + Sqr(Centre[Y]);
+
+    if ((Radius <= 0.0) || (DistanceSqr > Sqr(Radius)))
+        return;
+
+    // Rays starting on the strand itself, such as shadow rays, must not hit it again, so the
+    // curve must lie farther along the ray than its radius.
+    if (Centre[Z] <= Radius)
+        return;
+
+    DBL Lateral = sqrt(DistanceSqr) / Radius;
+    DBL Front = sqrt(max(0.0, 1.0 - Sqr(Lateral)));
+    DBL t = Centre[Z] - Radius * Front;
+
+    if ((t <= Curve.Depth_Tolerance) || (t >= Hit.Depth))
+        return;
+
+    Vector3d Tangent = bezier_evaluate(Curve.Control, min(u + EPSILON, 1.0)) - bezier_evaluate(Curve.Control, max(u - EPSILON, 0.0));
+
+    Hit.Depth = t;
+    Hit.U = u;
+    Hit.Side = ((Tangent[X] * -Centre[Y] - Tangent[Y] * -Centre[X]) >= 0.0) ? Lateral : -Lateral;
+    Hit.Normal = Vector3d(-Centre[X] / Radius, -Centre[Y] / Radius, -Front);
+}
+
+/// Segments of a hair object, presented to the hierarchy builder.
+struct HairElements : public CompactBVH::Elements
+{
+    const HairData *Data;
+    const std::vector<HairSegment>& Segments;
+
+    HairElements(const HairData *d, const std::vector<HairSegment>& s) : Data(d), Segments(s) {}
+
+    virtual unsigned int size() const { return (unsigned int)Segments.size(); }
+    virtual void GetBounds(unsigned int i, Vector3d& Min, Vector3d& Max) const
+    {
+        Vector3d Control[4];
+        DBL Radii[4];
+
+        bezier_segment(Data->Spline_Type, Data->Points + 4 * size_t(Segments[i].Point), Control, Radii);
+        bezier_bounds(Control, Radii, Min, Max);
+    }
+};
+
+/*****************************************************************************/
+
+Hair::Hair() : ObjectBase(HAIR_OBJECT)
+{
+    Trans = nullptr;
+
+    Data = nullptr;
+}
+
+ObjectPtr Hair::Copy()
+{
+    Hair *New = new Hair();
+
+    Destroy_Transform(New->Trans);
+    *New = *this;
+    New->Trans = Copy_Transform(Trans);
+
+    New->Data = Data;
+    if (New->Data != nullptr)
+        New->Data->References++;
+
+    return (New);
+}
+
+Hair::~Hair()
+{
+    if ((Data != nullptr) && (--(Data->References) == 0))
+    {
+        if (Data->Strands != nullptr)
+            POV_FREE(Data->Strands);
+        if (Data->Points != nullptr)
+            POV_FREE(Data->Points);
+        if (Data->Segments != nullptr)
+            POV_FREE(Data->Segments);
+        if (Data->Nodes != nullptr)
+            POV_FREE(Data->Nodes);
+
+        MemoryAccounting::Release(kMemoryGeometry, Data->Accounted_Size);
+
+        POV_FREE(Data);
+    }
+}
+
+bool Hair::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    const CompactBVH::Node *Stack[CompactBVH::kMaxDepth];
+    const CompactBVH::Node *Node;
+    int Top = 0;
+    bool found = false;
+    DBL len;
+    BasicRay New_Ray;
+    Vector3d InvDir;
+    Vector3d U, V;
+
+    Thread->Stats()[Ray_Hair_Tests]++;
+
+    // Transform the ray into the hair's space.
+
+    if (Trans != nullptr)
+    {
+        MInvTransRay(New_Ray, ray, Trans);
+
+        len = New_Ray.Direction.length();
+        New_Ray.Direction /= len;
+    }
+    else
+    {
+        New_Ray = ray;
+
+        len = 1.0;
+    }
+
+    InvDir = Vector3d(1.0 / New_Ray.Direction[X], 1.0 / New_Ray.Direction[Y], 1.0 / New_Ray.Direction[Z]);
+
+    // Axes of the coordinate system aligned with the ray.
+    U = cross(New_Ray.Direction, (fabs(New_Ray.Direction[X]) < 0.5 ? Vector3d(1.0, 0.0, 0.0) : Vector3d(0.0, 1.0, 0.0))).normalized();
+    V = cross(New_Ray.Direction, U);
+
+    Node = Data->Nodes;
+
+    if (!CompactBVH::IntersectNode(*Node, New_Ray.Origin, InvDir))
+        return false;
+
+    for (;;)
+    {
+        if (Node->count > 0)
+        {
+            for (unsigned int i = Node->index; i < Node->index + Node->count; i++)
+            {
+                if (intersect_segment(Data->Segments[i], New_Ray, U, V, len, Depth_Stack, Thread))
+                    found = true;
+            }
+        }
+        else
+        {
+            const CompactBVH::Node *Left  = Node + 1;
+            const CompactBVH::Node *Right = Data->Nodes + Node->index;
+            bool HitLeft  = CompactBVH::IntersectNode(*Left,  New_Ray.Origin, InvDir);
+            bool HitRight = CompactBVH::IntersectNode(*Right, New_Ray.Origin, InvDir);
+
+            if (HitLeft)
+            {
+                if (HitRight)
+                {
+                    POV_ASSERT(Top < CompactBVH::kMaxDepth);
+                    Stack[Top++] = Right;
+                }
+                Node = Left;
+                continue;
+            }
+            else if (HitRight)
+            {
+                Node = Right;
+                continue;
+            }
+        }
+
+        if (Top == 0)
+            break;
+
+        Node = Stack[--Top];
+    }
+
+    if (found)
+        Thread->Stats()[Ray_Hair_Tests_Succeeded]++;
+
+    return found;
+}
+
+/// Test a segment against a ray, reporting the nearest hit if any.
+///
+/// @param[in]      Segment     Segment to test.
+/// @param[in]      ray         Ray in the hair's space, with unit direction.
+/// @param[in]      U           First axis perpendicular to the ray.
+/// @param[in]      V           Second axis perpendicular to the ray.
+/// @param[in]      len         Length of the ray direction before normalization.
+/// @param[in,out]  Depth_Stack Intersection stack.
+/// @param[in]      Thread      Thread data.
+/// @return                     `true` if the segment was hit.
+///
+bool Hair::intersect_segment(const HairSegment& Segment, const BasicRay& ray, const Vector3d& U, const Vector3d& V, DBL len, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    HairCurve Curve;
+    HairHit Hit;
+    Vector3d Control[4];
+    int Depth = 0;
+
+    Thread->Stats()[Ray_Hair_Segment_Tests]++;
+
+    get_segment(Segment, Control, Curve.Radii);
+
+    for (int i = 0; i < 4; i++)
+    {
+        Vector3d P = Control[i] - ray.Origin;
+        Curve.Control[i] = Vector3d(dot(P, U), dot(P, V), dot(P, ray.Direction));
+    }
+
+    Curve.Depth_Tolerance = DEPTH_TOLERANCE * len;
+
+    // Subdivide until the deviation of the pieces from straight lines drops below a fraction of
+    // the radius; halving a cubic curve reduces its deviation to a quarter.
+    DBL Deviation = 0.0;
+    for (int i = 0; i < 2; i++)
+        for (int a = 0; a < 3; a++)
+            Deviation = max(Deviation, fabs(Curve.Control[i][a] - 2.0 * Curve.Control[i+1][a] + Curve.Control[i+2][a]));
+
+    DBL Flatness = HAIR_FLATNESS * max(max(Curve.Radii[0], Curve.Radii[1]), max(Curve.Radii[2], Curve.Radii[3]));
+
+    if ((Deviation > 0.0) && (Flatness > 0.0))
+        Depth = clip(int(ceil(0.5 * log(sqrt(2.0) * 6.0 * Deviation / (8.0 * Flatness)) / log(2.0))), 0, HAIR_MAX_SUBDIVISIONS);
+
+    Hit.Depth = BOUND_HUGE;
+
+    intersect_piece(Curve, Curve.Control, Curve.Radii, 0.0, 1.0, Depth, Hit);
+
+    if ((Hit.Depth >= BOUND_HUGE) || (Hit.Depth / len >= MAX_DISTANCE))
+        return false;
+
+    Thread->Stats()[Ray_Hair_Segment_Tests_Succeeded]++;
+
+    DBL Distance = Hit.Depth / len;
+    Vector3d IPoint;
+    Vector3d INormal = U * Hit.Normal[X] + V * Hit.Normal[Y] + ray.Direction * Hit.Normal[Z];
+
+    if (Trans != nullptr)
+    {
+        MTransPoint(IPoint, ray.Evaluate(Hit.Depth), Trans);
+        MTransNormal(INormal, INormal, Trans);
+    }
+    else
+        IPoint = ray.Evaluate(Hit.Depth);
+
+    INormal.normalize();
+
+    if (!Clip.empty() && !Point_In_Clip(IPoint, Clip, Thread))
+        return false;
+
+    // The u coordinate runs along the strand, the v coordinate across it.
+    const HairStrand& Strand = Data->Strands[Segment.Strand];
+    DBL Segments = DBL(Strand.Number_Of_Points - Min_Points(Data->Spline_Type) + 1);
+    Vector2d UV((DBL(Segment.Point - Strand.First_Point) + Hit.U) / Segments, 0.5 * (Hit.Side + 1.0));
+
+    Depth_Stack->push(Intersection(Distance, IPoint, INormal, UV, this));
+
+    return true;
+}
+
+bool Hair::Inside(const Vector3d&, TraceThreadData *) const
+{
+    return false;
+}
+
+void Hair::Normal(Vector3d& Result, Intersection *Inter, TraceThreadData *) const
+{
+    Result = Inter->INormal;
+}
+
+void Hair::UVCoord(Vector2d& Result, const Intersection *Inter, TraceThreadData *) const
+{
+    Result = Inter->Iuv;
+}
+
+void Hair::Translate(const Vector3d&, const TRANSFORM *tr)
+{
+    Transform(tr);
+}
+
+void Hair::Rotate(const Vector3d&, const TRANSFORM *tr)
+{
+    Transform(tr);
+}
+
+void Hair::Scale(const Vector3d&, const TRANSFORM *tr)
+{
+    Transform(tr);
+}
+
+void Hair::Transform(const TRANSFORM *tr)
+{
+    if (Trans == nullptr)
+        Trans = Create_Transform();
+
+    Recompute_BBox(&BBox, tr);
+
+    Compose_Transforms(Trans, tr);
+}
+
+void Hair::Compute_BBox()
+{
+    const CompactBVH::Node *Root = Data->Nodes;
+
+    Make_BBox_from_min_max(BBox, Vector3d(Root->min[X], Root->min[Y], Root->min[Z]),
+                                 Vector3d(Root->max[X], Root->max[Y], Root->max[Z]));
+
+    if (Trans != nullptr)
+        Recompute_BBox(&BBox, Trans);
+}
+
+void Hair::get_segment(const HairSegment& Segment, Vector3d *Control, DBL *Radii) const
+{
+    bezier_segment(Data->Spline_Type, Data->Points + 4 * size_t(Segment.Point), Control, Radii);
+}
+
+void Hair::Compute(int type, const unsigned int *strands, unsigned int count, const float *data, unsigned int points)
+{
+    std::vector<HairSegment> Segments;
+    std::vector<unsigned int> Order;
+    std::vector<CompactBVH::Node> Nodes;
+    const unsigned int Minimum = Min_Points(type);
+    unsigned int First = 0;
+
+    Data = reinterpret_cast<HairData *>(POV_MALLOC(sizeof(HairData), "hair data"));
+
+    Data->References = 1;
+    Data->Spline_Type = type;
+    Data->Number_Of_Strands = count;
+    Data->Number_Of_Points = points;
+    Data->Accounted_Size = 0;
+
+    Data->Strands = reinterpret_cast<HairStrand *>(POV_MALLOC(count * sizeof(HairStrand), "hair data"));
+    Data->Points = reinterpret_cast<float *>(POV_MALLOC(4 * size_t(points) * sizeof(float), "hair data"));
+    memcpy(Data->Points, data, 4 * size_t(points) * sizeof(float));
+
+    for (unsigned int s = 0; s < count; s++)
+    {
+        POV_ASSERT(strands[s] >= Minimum);
+
+        Data->Strands[s].First_Point = First;
+        Data->Strands[s].Number_Of_Points = strands[s];
+
+        for (unsigned int p = First; p + Minimum <= First + strands[s]; p++)
+        {
+            HairSegment Segment;
+            Segment.Point = p;
+            Segment.Strand = s;
+            Segments.push_back(Segment);
+        }
+
+        First += strands[s];
+    }
+
+    POV_ASSERT(First == points);
+
+    CompactBVH::Build(HairElements(Data, Segments), Order, Nodes);
+
+    Data->Number_Of_Segments = (unsigned int)Segments.size();
+    Data->Segments = reinterpret_cast<HairSegment *>(POV_MALLOC(Segments.size() * sizeof(HairSegment), "hair data"));
+    for (size_t i = 0; i < Segments.size(); i++)
+        Data->Segments[i] = Segments[Order[i]];
+
+    Data->Number_Of_Nodes = (unsigned int)Nodes.size();
+    Data->Nodes = reinterpret_cast<CompactBVH::Node *>(POV_MALLOC(Data->Number_Of_Nodes * sizeof(CompactBVH::Node), "hair data"));
+    memcpy(Data->Nodes, Nodes.data(), Data->Number_Of_Nodes * sizeof(CompactBVH::Node));
+
+    account_data();
+}
+
+bool Hair::Load_File(int type, const MappedFile *file)
+{
+    const char *Base;
+    const Hair_File_Header *Header;
+    const unsigned int *Strands;
+    const float *Points;
+    size_t Size;
+    POV_ULONG Total = 0;
+
+    Base = reinterpret_cast<const char *>(file->GetData());
+
+    if ((Base == nullptr) || (file->GetSize() < sizeof(Hair_File_Header)))
+        return false;
+
+    Header = reinterpret_cast<const Hair_File_Header *>(Base);
+
+    if ((memcmp(Header->Magic, HAIR_FILE_MAGIC, sizeof(HAIR_FILE_MAGIC)) != 0) ||
+        (Header->Version != HAIR_FILE_VERSION) ||
+        (Header->Byte_Order != HAIR_FILE_BYTE_ORDER) ||
+        (Header->Flags != 0))
+        return false;
+
+    if ((Header->Number_Of_Strands == 0) ||
+        (Header->Number_Of_Points > (SIZE_MAX - sizeof(Hair_File_Header)) / (4 * sizeof(float) + sizeof(unsigned int))) ||
+        (Header->Number_Of_Strands > Header->Number_Of_Points))
+        return false;
+
+    Strands = reinterpret_cast<const unsigned int *>(Base + sizeof(Hair_File_Header));
+    Points = reinterpret_cast<const float *>(Base + sizeof(Hair_File_Header) + size_t(Header->Number_Of_Strands) * sizeof(unsigned int));
+    Size = sizeof(Hair_File_Header) + size_t(Header->Number_Of_Strands) * sizeof(unsigned int) + size_t(Header->Number_Of_Points) * 4 * sizeof(float);
+
+    if (Size > file->GetSize())
+        return false;
+
+    for (unsigned int i = 0; i < Header->Number_Of_Strands; i++)
+    {
+        if (Strands[i] < Min_Points(type))
+            return false;
+        Total += Strands[i];
+    }
+
+    if (Total != static_cast<POV_ULONG>(Header->Number_Of_Points))
+        return false;
+
+    for (size_t i = 0; i < 4 * size_t(Header->Number_Of_Points); i++)
+    {
+        if (!POV_ISFINITE(Points[i]) || (((i & 3) == 3) && (Points[i] < 0.0f)))
+            return false;
+    }
+
+    Compute(type, Strands, Header->Number_Of_Strands, Points, Header->Number_Of_Points);
+
+    return true;
+}
+
+void Hair::account_data()
+{
+    size_t Size = sizeof(HairData) +
+                  Data->Number_Of_Strands * sizeof(HairStrand) +
+                  4 * size_t(Data->Number_Of_Points) * sizeof(float) +
+                  Data->Number_Of_Segments * sizeof(HairSegment) +
+                  Data->Number_Of_Nodes * sizeof(CompactBVH::Node);
+
+    MemoryAccounting::Allocate(kMemoryGeometry, Size - Data->Accounted_Size);
+    Data->Accounted_Size = Size;
+}
+
+}
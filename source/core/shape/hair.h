@@ -0,0 +1,185 @@
+//******************************************************************************
+///
+/// @file core/shape/hair.h
+///
+/// Declarations related to the hair geometric primitive.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_CORE_HAIR_H
+#define POVRAY_CORE_HAIR_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "core/configcore.h"
+
+#include "base/filemapping.h"
+
+#include "core/bounding/compactbvh.h"
+#include "core/scene/object.h"
+
+namespace pov
+{
+
+//##############################################################################
+///
+/// @addtogroup PovCoreShape
+///
+/// @{
+
+//******************************************************************************
+///
+/// @name Object Types
+///
+/// @{
+
+#define HAIR_OBJECT (PATCH_OBJECT)
+
+/// @}
+///
+//******************************************************************************
+
+/// @name Spline Types
+/// @{
+
+#define B_SPLINE_HAIR           0   ///< Uniform cubic B-spline, approximating the points.
+#define CATMULL_ROM_SPLINE_HAIR 1   ///< Catmull-Rom spline, interpolating all but the first and last point.
+#define LINEAR_SPLINE_HAIR      2   ///< Straight segments between the points.
+
+/// @}
+
+/// Strand of a hair object.
+struct HairStrand
+{
+    unsigned int First_Point;       ///< Index of the strand's first point.
+    unsigned int Number_Of_Points;  ///< Number of points of the strand.
+};
+
+/// Segment of a hair strand.
+struct HairSegment
+{
+    unsigned int Point;             ///< Index of the segment's first point.
+    unsigned int Strand;            ///< Index of the segment's strand.
+};
+
+/// Strand data of a hair object, shared between copies of the object.
+///
+/// The points are held in single precision as x, y, z and radius. The segments are held in the
+/// order of the leaves of the bounding volume hierarchy; each refers to the four consecutive
+/// points it is derived from, or two for linear strands.
+///
+struct HairData
+{
+    int References;                 ///< Number of objects referring to the data.
+    int Spline_Type;                ///< Spline type, one of the `*_HAIR` constants.
+    unsigned int Number_Of_Strands; ///< Number of strands.
+    unsigned int Number_Of_Points;  ///< Number of points of all strands.
+    unsigned int Number_Of_Segments;///< Number of segments of all strands.
+    HairStrand *Strands;            ///< Strands.
+    float *Points;                  ///< Points of all strands, as x, y, z and radius.
+    HairSegment *Segments;          ///< Segments of all strands, in hierarchy order.
+    CompactBVH::Node *Nodes;        ///< Bounding volume hierarchy, root node first.
+    unsigned int Number_Of_Nodes;   ///< Number of nodes in the hierarchy.
+    size_t Accounted_Size;          ///< Memory accounted for the data.
+};
+
+/// Large set of thin curves with varying radius, such as hair, fur or grass.
+///
+/// Each strand is a cubic spline through a sequence of points with radii, converted segment by
+/// segment to Bézier form when tested against a ray. Rather than solving for the exact surface of
+/// the swept sphere, each segment is intersected as a ribbon facing the ray, by recursively
+/// subdividing it in a coordinate system aligned with the ray until the pieces are flat enough to
+/// be treated as straight. The normal is that of a cylinder around the curve, which looks the same
+/// for curves as thin as these are meant to be; as a consequence, hair is a patch object without
+/// an inside.
+///
+/// Each point takes 16 bytes and each segment 8 bytes, plus on average some 20 bytes for the nodes
+/// of the bounding volume hierarchy, so that millions of strands remain affordable where as many
+/// sphere sweeps would not.
+///
+class Hair : public ObjectBase
+{
+    public:
+
+        HairData *Data;                 ///< Strand data.
+
+        Hair();
+        virtual ~Hair();
+
+        virtual ObjectPtr Copy();
+
+        virtual bool All_Intersections(const Ray&, IStack&, TraceThreadData *);
+        virtual bool Inside(const Vector3d&, TraceThreadData *) const;
+        virtual void Normal(Vector3d&, Intersection *, TraceThreadData *) const;
+        virtual void UVCoord(Vector2d&, const Intersection *, TraceThreadData *) const;
+        virtual void Translate(const Vector3d&, const TRANSFORM *);
+        virtual void Rotate(const Vector3d&, const TRANSFORM *);
+        virtual void Scale(const Vector3d&, const TRANSFORM *);
+        virtual void Transform(const TRANSFORM *);
+        virtual void Compute_BBox();
+
+        /// Minimum number of points per strand for a given spline type.
+        static unsigned int Min_Points(int type) { return (type == LINEAR_SPLINE_HAIR) ? 2 : 4; }
+
+        /// Set up the hair from strands of points.
+        ///
+        /// @param[in]  type        Spline type, one of the `*_HAIR` constants.
+        /// @param[in]  strands     Number of points of each strand; each must be at least
+        ///                         @ref Min_Points(), and their sum must be `points`.
+        /// @param[in]  count       Number of strands.
+        /// @param[in]  data        Points of all strands, as x, y, z and radius.
+        /// @param[in]  points      Number of points.
+        ///
+        void Compute(int type, const unsigned int *strands, unsigned int count, const float *data, unsigned int points);
+
+        /// Set up the hair from a memory-mapped binary hair file.
+        ///
+        /// The strands are copied out of the file, so the caller remains responsible for it.
+        ///
+        /// @param[in]  type        Spline type, one of the `*_HAIR` constants.
+        /// @param[in]  file        Mapped binary hair file.
+        /// @return                 `false` if the file is not a valid binary hair file, or
+        ///                         has strands too short for the spline type.
+        ///
+        bool Load_File(int type, const MappedFile *file);
+
+    protected:
+
+        bool intersect_segment(const HairSegment& Segment, const BasicRay& ray, const Vector3d& U, const Vector3d& V, DBL len, IStack& Depth_Stack, TraceThreadData *Thread);
+        void get_segment(const HairSegment& Segment, Vector3d *Control, DBL *Radii) const;
+        void account_data();
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_CORE_HAIR_H
@@ -59,6 +59,7 @@
 #include "core/shape/heightfield.h"
 
 #include <algorithm>
+#include <atomic>
 
 #include "base/pov_err.h"
 
@@ -88,12 +89,20 @@ const DBL HFIELD_OFFSET = 0.001;
 
 const DBL HFIELD_TOLERANCE = 1.0e-6;
 
+/// Width and depth, in cells, of the tiles at the bottom of the min-max hierarchy.
+const int HFIELD_LEAF_SIZE = 8;
+
+/// Width and depth, in grid points, of the blocks in which the normals of smoothed height fields are computed.
+const int HFIELD_NORMAL_BLOCK_SIZE = 64;
+
+/// Maximum number of blocks of normals cached per smoothed height field.
+/// Once it is reached, normals in the remaining blocks are computed per grid point whenever needed.
+const int HFIELD_MAX_NORMAL_BLOCKS = 1024;
+
 
 //****************************************************************************
 // Local Types
 
-typedef short HF_Normals[3];
-
 struct HFBlock
 {
     int xmin, xmax;
@@ -101,17 +110,37 @@ struct HFBlock
     DBL ymin, ymax;
 };
 
+struct HFMinMax
+{
+    HF_VAL ymin, ymax;
+};
+
+/// One level of the min-max hierarchy.
+///
+/// Level 0 holds one node per tile of @ref HFIELD_LEAF_SIZE by @ref HFIELD_LEAF_SIZE cells; each
+/// further level halves the number of nodes along each axis, until a single node covers the
+/// whole height field.
+///
+struct HFLevel
+{
+    int size_x, size_z;
+    HFMinMax *Node;
+};
+
 struct HFData
 {
     int References;
-    int Normals_Height;  /* Needed for Destructor */
     int max_x, max_z;
     HF_VAL min_y, max_y;
     int block_max_x, block_max_z;
-    int block_width_x, block_width_z;
+    int normal_blocks_x, normal_blocks_z;
+    int levels;
     HF_VAL **Map;
-    HF_Normals **Normals;
+    std::atomic<short *> *Normals;  ///< Blocks of normals for smoothed height fields, computed when first needed.
+    std::atomic<int> normal_blocks_cached;  ///< Number of blocks of normals computed so far.
     HFBlock **Block;
+    HFLevel *Level;
+    shared_ptr<MappedFile> File;    ///< Raw file the rows of the map point into, if any.
 };
 
 
@@ -339,18 +368,10 @@ void HField::Normal(Vector3d& Result, Intersection *Inter, TraceThreadData *Thre
 
     if (Test_Flag(this, SMOOTHED_FLAG))
     {
-        n[0][X] = Data->Normals[pz][px][0];
-        n[0][Y] = Data->Normals[pz][px][1];
-        n[0][Z] = Data->Normals[pz][px][2];
-        n[1][X] = Data->Normals[pz][px+1][0];
-        n[1][Y] = Data->Normals[pz][px+1][1];
-        n[1][Z] = Data->Normals[pz][px+1][2];
-        n[2][X] = Data->Normals[pz+1][px][0];
-        n[2][Y] = Data->Normals[pz+1][px][1];
-        n[2][Z] = Data->Normals[pz+1][px][2];
-        n[3][X] = Data->Normals[pz+1][px+1][0];
-        n[3][Y] = Data->Normals[pz+1][px+1][1];
-        n[3][Z] = Data->Normals[pz+1][px+1][2];
+        get_normal(n[0], px,   pz);
+        get_normal(n[1], px+1, pz);
+        get_normal(n[2], px,   pz+1);
+        get_normal(n[3], px+1, pz+1);
 
         for (i = 0; i < 4; i++)
         {
@@ -750,10 +771,14 @@ int HField::add_single_normal(HF_VAL **data, int xsize, int zsize, int x0, int z
 *
 * INPUT
 *
+*   bx, bz - Index of the block of normals to compute
+*
 * OUTPUT
 *
 * RETURNS
 *
+*   short * - The block's normals
+*
 * AUTHOR
 *
 *   Doug Muir, David Buck, Drew Wells
@@ -762,61 +787,200 @@ int HField::add_single_normal(HF_VAL **data, int xsize, int zsize, int x0, int z
 *
 *   Given a height field that only contains an elevation grid, this
 *   routine will walk through the data and produce averaged normals
-*   for all points on the grid.
+*   for all points of one block of the grid.
 *
 * CHANGES
 *
-*   -
+*   Oct 2026 : Normals are now computed one block at a time, when first
+*              needed, rather than for all points when the height field
+*              is created.
 *
 ******************************************************************************/
 
-void HField::smooth_height_field(int xsize, int zsize)
+const short *HField::smooth_height_field(int bx, int bz) const
 {
-    int i, j, k;
-    Vector3d N;
-    HF_VAL **map = Data->Map;
-
-    /* First off, allocate all the memory needed to store the normal information */
-
-    Data->Normals_Height = zsize+1;
+    int i, j;
+    int xsize, zsize;
+    short *block;
+    short *expected = nullptr;
 
-    Data->Normals = new HF_Normals*[zsize+1];
+    xsize = Data->max_x + 1;
+    zsize = Data->max_z + 1;
 
-    for (i = 0; i <= zsize; i++)
-    {
-        Data->Normals[i] = new HF_Normals[xsize+1];
-    }
+    block = new short[3 * HFIELD_NORMAL_BLOCK_SIZE * HFIELD_NORMAL_BLOCK_SIZE];
 
     /*
      * For now we will do it the hard way - by generating the normals
      * individually for each elevation point.
      */
 
-    for (i = 0; i <= zsize; i++)
+    try
     {
-        for (j = 0; j <= xsize; j++)
+        for (i = bz * HFIELD_NORMAL_BLOCK_SIZE; i <= min((bz + 1) * HFIELD_NORMAL_BLOCK_SIZE - 1, zsize); i++)
         {
-            N = Vector3d(0.0, 0.0, 0.0);
+            for (j = bx * HFIELD_NORMAL_BLOCK_SIZE; j <= min((bx + 1) * HFIELD_NORMAL_BLOCK_SIZE - 1, xsize); j++)
+            {
+                smooth_normal(block + 3 * ((i % HFIELD_NORMAL_BLOCK_SIZE) * HFIELD_NORMAL_BLOCK_SIZE + (j % HFIELD_NORMAL_BLOCK_SIZE)), j, i);
+            }
+        }
+    }
+    catch (...)
+    {
+        delete[] block;
+        throw;
+    }
+
+    /* Another thread may have computed the same block in the meantime; if so, use that one. */
+
+    if (!Data->Normals[bz * Data->normal_blocks_x + bx].compare_exchange_strong(expected, block, std::memory_order_acq_rel))
+    {
+        delete[] block;
+        block = expected;
+
+        Data->normal_blocks_cached.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    return(block);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   smooth_normal
+*
+* INPUT
+*
+*   x, z   - Grid point
+*
+* OUTPUT
+*
+*   normal - Averaged normal at the grid point, scaled to 32767
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   Doug Muir, David Buck, Drew Wells
+*
+* DESCRIPTION
+*
+*   Average the normals of the triangles surrounding a grid point.
+*
+* CHANGES
+*
+*   Oct 2026 : Split off from smooth_height_field.
+*
+******************************************************************************/
+
+void HField::smooth_normal(short *normal, int x, int z) const
+{
+    int k;
+    int xsize, zsize;
+    Vector3d N(0.0, 0.0, 0.0);
+    HF_VAL **map = Data->Map;
+
+    xsize = Data->max_x + 1;
+    zsize = Data->max_z + 1;
+
+    k = 0;
+
+    k += add_single_normal(map, xsize, zsize, x, z, x+1, z, x, z+1, N);
+    k += add_single_normal(map, xsize, zsize, x, z, x, z+1, x-1, z, N);
+    k += add_single_normal(map, xsize, zsize, x, z, x-1, z, x, z-1, N);
+    k += add_single_normal(map, xsize, zsize, x, z, x, z-1, x+1, z, N);
+
+    if (k == 0)
+    {
+        throw POV_EXCEPTION_STRING("Failed to find any normals at.");
+    }
+
+    N.normalize();
+
+    normal[0] = (short)(32767 * N[X]);
+    normal[1] = (short)(32767 * N[Y]);
+    normal[2] = (short)(32767 * N[Z]);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   get_normal
+*
+* INPUT
+*
+*   x, z - Grid point
+*
+* OUTPUT
+*
+*   N    - Averaged normal at the grid point
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Look up the normal of a smoothed height field at a grid point,
+*   computing the normals of the surrounding block if necessary.
+*
+*   At most HFIELD_MAX_NORMAL_BLOCKS blocks are cached, so that memory
+*   use is bounded for huge height fields; beyond that, the normal of
+*   the grid point alone is computed each time it is needed.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void HField::get_normal(Vector3d& N, int x, int z) const
+{
+    int bx, bz;
+    const short *block, *normal;
+    short point[3];
+
+    bx = x / HFIELD_NORMAL_BLOCK_SIZE;
+    bz = z / HFIELD_NORMAL_BLOCK_SIZE;
 
-            k = 0;
+    block = Data->Normals[bz * Data->normal_blocks_x + bx].load(std::memory_order_acquire);
 
-            k += add_single_normal(map, xsize, zsize, j, i, j+1, i, j, i+1, N);
-            k += add_single_normal(map, xsize, zsize, j, i, j, i+1, j-1, i, N);
-            k += add_single_normal(map, xsize, zsize, j, i, j-1, i, j, i-1, N);
-            k += add_single_normal(map, xsize, zsize, j, i, j, i-1, j+1, i, N);
+    if (block == nullptr)
+    {
+        /* Reserve a place in the cache for the block, if there is one left. */
 
-            if (k == 0)
+        if (Data->normal_blocks_cached.load(std::memory_order_relaxed) < HFIELD_MAX_NORMAL_BLOCKS)
+        {
+            if (Data->normal_blocks_cached.fetch_add(1, std::memory_order_relaxed) < HFIELD_MAX_NORMAL_BLOCKS)
+            {
+                block = smooth_height_field(bx, bz);
+            }
+            else
             {
-                throw POV_EXCEPTION_STRING("Failed to find any normals at.");
+                Data->normal_blocks_cached.fetch_sub(1, std::memory_order_relaxed);
             }
+        }
+
+        if (block == nullptr)
+        {
+            smooth_normal(point, x, z);
 
-            N.normalize();
+            N = Vector3d(point[0], point[1], point[2]);
 
-            Data->Normals[i][j][0] = (short)(32767 * N[X]);
-            Data->Normals[i][j][1] = (short)(32767 * N[Y]);
-            Data->Normals[i][j][2] = (short)(32767 * N[Z]);
+            return;
         }
     }
+
+    normal = block + 3 * ((z % HFIELD_NORMAL_BLOCK_SIZE) * HFIELD_NORMAL_BLOCK_SIZE + (x % HFIELD_NORMAL_BLOCK_SIZE));
+
+    N = Vector3d(normal[0], normal[1], normal[2]);
 }
 
 
@@ -839,8 +1003,7 @@ void HField::smooth_height_field(int xsize, int zsize)
 *
 * DESCRIPTION
 *
-*   Copy image data into height field map. Create bounding blocks
-*   for the block traversal. Calculate normals for smoothed height fields.
+*   Copy image data into height field map.
 *
 * CHANGES
 *
@@ -851,7 +1014,6 @@ void HField::smooth_height_field(int xsize, int zsize)
 void HField::Compute_HField(const ImageData *image)
 {
     int x, z, max_x, max_z;
-    HF_VAL min_y, max_y, temp_y;
 
     /* Get height field map size. */
 
@@ -869,6 +1031,129 @@ void HField::Compute_HField(const ImageData *image)
 
     /* Copy map. */
 
+    for (z = 0; z < max_z; z++)
+    {
+        for (x = 0; x < max_x; x++)
+        {
+            Data->Map[z][x] = image_height_at(image, x, max_z - z - 1);
+        }
+    }
+
+    init_hfield(max_x, max_z);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Map_HField
+*
+* INPUT
+*
+*   file          - Raw height field file
+*   width, height - Size of the height field
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Use the rows of a memory-mapped raw height field file as the
+*   height field map, without copying them. The file holds unsigned
+*   16-bit little-endian heights, row by row with the top row first,
+*   and must be large enough for the given size.
+*
+*   On big-endian machines the file's contents are byte-swapped into
+*   a copy instead.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void HField::Map_HField(const shared_ptr<MappedFile>& file, int width, int height)
+{
+    int x, z;
+    const HF_VAL probe = 1;
+    const HF_VAL *data = reinterpret_cast<const HF_VAL *>(file->GetData());
+    const HF_VAL *row;
+
+    Data->Map = new HF_VAL*[height];
+
+    if (*reinterpret_cast<const unsigned char *>(&probe) == 1)
+    {
+        /* Point the rows straight into the file; the map is never written to once set up. */
+
+        for (z = 0; z < height; z++)
+        {
+            Data->Map[z] = const_cast<HF_VAL *>(data + (size_t)(height - z - 1) * width);
+        }
+
+        Data->File = file;
+    }
+    else
+    {
+        for (z = 0; z < height; z++)
+        {
+            row = data + (size_t)(height - z - 1) * width;
+
+            Data->Map[z] = new HF_VAL[width];
+
+            for (x = 0; x < width; x++)
+            {
+                Data->Map[z][x] = (HF_VAL)((row[x] >> 8) | (row[x] << 8));
+            }
+        }
+    }
+
+    init_hfield(width, height);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   init_hfield
+*
+* INPUT
+*
+*   max_x, max_z - Size of the height field map
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   Doug Muir, David Buck, Drew Wells
+*
+* DESCRIPTION
+*
+*   Find the height range of the map, and create bounding blocks for
+*   the block traversal. Prepare storage for the normals of smoothed
+*   height fields, which are computed when first needed.
+*
+* CHANGES
+*
+*   Oct 2026 : Split off from Compute_HField.
+*
+******************************************************************************/
+
+void HField::init_hfield(int max_x, int max_z)
+{
+    int i, x, z;
+    HF_VAL min_y, max_y, temp_y;
+
     min_y = 65535L;
     max_y = 0;
 
@@ -876,9 +1161,7 @@ void HField::Compute_HField(const ImageData *image)
     {
         for (x = 0; x < max_x; x++)
         {
-            temp_y = image_height_at(image, x, max_z - z - 1);
-
-            Data->Map[z][x] = temp_y;
+            temp_y = Data->Map[z][x];
 
             min_y = min(min_y, temp_y);
             max_y = max(max_y, temp_y);
@@ -893,11 +1176,19 @@ void HField::Compute_HField(const ImageData *image)
     bounding_corner1[Y] = max((DBL)min_y, bounding_corner1[Y]) - HFIELD_OFFSET;
     bounding_corner2[Y] = (DBL)max_y + HFIELD_OFFSET;
 
-    /* Compute smoothed height field. */
+    /* Prepare for smoothed height field. */
 
     if (Test_Flag(this, SMOOTHED_FLAG))
     {
-        smooth_height_field(max_x-1, max_z-1);
+        Data->normal_blocks_x = (max_x + HFIELD_NORMAL_BLOCK_SIZE - 1) / HFIELD_NORMAL_BLOCK_SIZE;
+        Data->normal_blocks_z = (max_z + HFIELD_NORMAL_BLOCK_SIZE - 1) / HFIELD_NORMAL_BLOCK_SIZE;
+
+        Data->Normals = new std::atomic<short *>[Data->normal_blocks_x * Data->normal_blocks_z];
+
+        for (i = 0; i < Data->normal_blocks_x * Data->normal_blocks_z; i++)
+        {
+            Data->Normals[i] = nullptr;
+        }
     }
 
     Data->max_x = max_x-2;
@@ -932,38 +1223,23 @@ void HField::Compute_HField(const ImageData *image)
 *
 *   Feb 1995 : Creation.
 *
+*   Oct 2026 : Replaced the single level of blocks by a min-max hierarchy
+*              with one node per tile of HFIELD_LEAF_SIZE cells at the
+*              bottom, so long and grazing rays skip empty space in a
+*              logarithmic number of steps.
+*
 ******************************************************************************/
 
 void HField::build_hfield_blocks()
 {
-    int x, z, nx, nz, wx, wz;
-    int i, j;
+    int x, z, i, j, k;
     int xmin, xmax, zmin, zmax;
-    DBL y, ymin, ymax, water;
-
-    /* Get block size. */
-
-    nx = max(1, (int)(sqrt((DBL)Data->max_x)));
-    nz = max(1, (int)(sqrt((DBL)Data->max_z)));
-
-    /* Get dimensions of sub-block. */
-
-    wx = (int)ceil((DBL)(Data->max_x + 2) / (DBL)nx);
-    wz = (int)ceil((DBL)(Data->max_z + 2) / (DBL)nz);
-
-    /* Increase number of sub-blocks if necessary. */
-
-    if (nx * wx < Data->max_x + 2)
-    {
-        nx++;
-    }
+    HF_VAL y, ymin, ymax;
+    const HFLevel *Below;
+    HFLevel *Level;
 
-    if (nz * wz < Data->max_z + 2)
-    {
-        nz++;
-    }
-
-    if (!Test_Flag(this, HIERARCHY_FLAG) || ((nx == 1) && (nz == 1)))
+    if (!Test_Flag(this, HIERARCHY_FLAG) ||
+        ((Data->max_x < HFIELD_LEAF_SIZE) && (Data->max_z < HFIELD_LEAF_SIZE)))
     {
         /* We don't want a bounding hierarchy. Just use one block. */
 
@@ -982,71 +1258,92 @@ void HField::build_hfield_blocks()
         Data->block_max_x = 1;
         Data->block_max_z = 1;
 
-        Data->block_width_x = Data->max_x + 2;
-        Data->block_width_z = Data->max_y + 2;
-
-//      Debug_Info("Height field: %d x %d (1 x 1 blocks)\n", Data->max_x+2, Data->max_z+2);
-
         return;
     }
 
-//  Debug_Info("Height field: %d x %d (%d x %d blocks)\n", Data->max_x+2, Data->max_z+2, nx, nz);
+    /* Count the levels needed to get down to a single node. */
 
-    /* Allocate memory for blocks. */
+    Data->levels = 1;
 
-    Data->Block = new HFBlock*[nz];
+    for (x = (Data->max_x + HFIELD_LEAF_SIZE) / HFIELD_LEAF_SIZE,
+         z = (Data->max_z + HFIELD_LEAF_SIZE) / HFIELD_LEAF_SIZE; (x > 1) || (z > 1); x = (x + 1) / 2, z = (z + 1) / 2)
+    {
+        Data->levels++;
+    }
 
-    /* Store block information. */
+    Data->Level = new HFLevel[Data->levels];
 
-    Data->block_max_x = nx;
-    Data->block_max_z = nz;
+    /* Find min. and max. height of each tile; a tile's cells also use the heights along its far edges. */
 
-    Data->block_width_x = wx;
-    Data->block_width_z = wz;
+    Level = &Data->Level[0];
 
-    water = bounding_corner1[Y];
+    Level->size_x = (Data->max_x + HFIELD_LEAF_SIZE) / HFIELD_LEAF_SIZE;
+    Level->size_z = (Data->max_z + HFIELD_LEAF_SIZE) / HFIELD_LEAF_SIZE;
+    Level->Node = new HFMinMax[Level->size_x * Level->size_z];
 
-    for (z = 0; z < nz; z++)
+    for (z = 0; z < Level->size_z; z++)
     {
-        Data->Block[z] = new HFBlock[nx];
+        zmin = z * HFIELD_LEAF_SIZE;
+        zmax = min(zmin + HFIELD_LEAF_SIZE, Data->max_z + 1);
 
-        for (x = 0; x < nx; x++)
+        for (x = 0; x < Level->size_x; x++)
         {
-            /* Get block's borders. */
-
-            xmin = x * wx;
-            zmin = z * wz;
+            xmin = x * HFIELD_LEAF_SIZE;
+            xmax = min(xmin + HFIELD_LEAF_SIZE, Data->max_x + 1);
 
-            xmax = min((x + 1) * wx - 1, Data->max_x);
-            zmax = min((z + 1) * wz - 1, Data->max_z);
+            ymin = Data->Map[zmin][xmin];
+            ymax = ymin;
 
-            /* Find min. and max. height in current block. */
-
-            ymin = BOUND_HUGE;
-            ymax = -BOUND_HUGE;
-
-            for (i = xmin; i <= xmax+1; i++)
+            for (j = zmin; j <= zmax; j++)
             {
-                for (j = zmin; j <= zmax+1; j++)
+                for (i = xmin; i <= xmax; i++)
                 {
-                    y = Get_Height(i, j);
+                    y = Data->Map[j][i];
 
                     ymin = min(ymin, y);
                     ymax = max(ymax, y);
                 }
             }
 
-            /* Store block's borders. */
+            Level->Node[z * Level->size_x + x].ymin = ymin;
+            Level->Node[z * Level->size_x + x].ymax = ymax;
+        }
+    }
+
+    /* Merge each 2 by 2 group of nodes into one node of the next level. */
+
+    for (k = 1; k < Data->levels; k++)
+    {
+        Below = &Data->Level[k - 1];
+        Level = &Data->Level[k];
+
+        Level->size_x = (Below->size_x + 1) / 2;
+        Level->size_z = (Below->size_z + 1) / 2;
+        Level->Node = new HFMinMax[Level->size_x * Level->size_z];
+
+        for (z = 0; z < Level->size_z; z++)
+        {
+            for (x = 0; x < Level->size_x; x++)
+            {
+                ymin = Below->Node[2 * z * Below->size_x + 2 * x].ymin;
+                ymax = Below->Node[2 * z * Below->size_x + 2 * x].ymax;
 
-            Data->Block[z][x].xmin = xmin;
-            Data->Block[z][x].xmax = xmax;
-            Data->Block[z][x].zmin = zmin;
-            Data->Block[z][x].zmax = zmax;
+                for (j = 2 * z; j <= min(2 * z + 1, Below->size_z - 1); j++)
+                {
+                    for (i = 2 * x; i <= min(2 * x + 1, Below->size_x - 1); i++)
+                    {
+                        ymin = min(ymin, Below->Node[j * Below->size_x + i].ymin);
+                        ymax = max(ymax, Below->Node[j * Below->size_x + i].ymax);
+                    }
+                }
 
-            Data->Block[z][x].ymin = max(ymin, water) - HFIELD_OFFSET;
-            Data->Block[z][x].ymax = ymax + HFIELD_OFFSET;
+                Level->Node[z * Level->size_x + x].ymin = ymin;
+                Level->Node[z * Level->size_x + x].ymax = ymax;
+            }
         }
     }
+
+//  Debug_Info("Height field: %d x %d (%d levels)\n", Data->max_x+2, Data->max_z+2, Data->levels);
 }
 
 
@@ -1224,7 +1521,9 @@ HField::HField() : ObjectBase(HFIELD_OBJECT)
 
     Data->References = 1;
 
-    Data->Normals_Height = 0;
+    Data->normal_blocks_x = 0;
+    Data->normal_blocks_z = 0;
+    Data->normal_blocks_cached = 0;
 
     Data->Map     = nullptr;
     Data->Normals = nullptr;
@@ -1235,8 +1534,10 @@ HField::HField() : ObjectBase(HFIELD_OBJECT)
     Data->block_max_x = 0;
     Data->block_max_z = 0;
 
-    Data->block_width_x = 0;
-    Data->block_width_z = 0;
+    Data->levels = 0;
+
+    Data->Block = nullptr;
+    Data->Level = nullptr;
 
     Set_Flag(this, HIERARCHY_FLAG);
 }
@@ -1328,11 +1629,16 @@ HField::~HField()
     {
         if (Data->Map != nullptr)
         {
-            for (i = 0; i < Data->max_z+2; i++)
+            /* Rows pointing into a mapped file are released along with the mapping. */
+
+            if (!Data->File)
             {
-                if (Data->Map[i] != nullptr)
+                for (i = 0; i < Data->max_z+2; i++)
                 {
-                    delete[] Data->Map[i];
+                    if (Data->Map[i] != nullptr)
+                    {
+                        delete[] Data->Map[i];
+                    }
                 }
             }
 
@@ -1341,9 +1647,9 @@ HField::~HField()
 
         if (Data->Normals != nullptr)
         {
-            for (i = 0; i < Data->Normals_Height; i++)
+            for (i = 0; i < Data->normal_blocks_x * Data->normal_blocks_z; i++)
             {
-                delete[] Data->Normals[i];
+                delete[] Data->Normals[i].load();
             }
 
             delete[] Data->Normals;
@@ -1359,6 +1665,16 @@ HField::~HField()
             delete[] Data->Block;
         }
 
+        if (Data->Level != nullptr)
+        {
+            for (i = 0; i < Data->levels; i++)
+            {
+                delete[] Data->Level[i].Node;
+            }
+
+            delete[] Data->Level;
+        }
+
         delete Data;
     }
 }
@@ -1855,6 +2171,9 @@ bool HField::dda_traversal(const BasicRay &ray, const Vector3d& Start, const HFB
 *
 *   Feb 1995 : Creation.
 *
+*   Oct 2026 : The walk over a single level of blocks has been replaced by
+*              a top-down descent of the min-max hierarchy.
+*
 *   Aug 1996 : Fixed bug as reported by Dean M. Phillips:
 *              "I found a bug in the height field code which resulted
 *              in "Illegal grid value in dda_traversal()." messages
@@ -1867,18 +2186,9 @@ bool HField::dda_traversal(const BasicRay &ray, const Vector3d& Start, const HFB
 
 bool HField::block_traversal(const BasicRay &ray, const Vector3d& Start, IStack &HField_Stack, const BasicRay &RRay, DBL mindist, DBL maxdist, TraceThreadData *Thread)
 {
-    int xmax, zmax;
-    int x, z, nx, nz, signx, signz;
-    int found = false;
-    int dx_zero, dz_zero;
+    int x, z;
     DBL px, pz, dx, dy, dz;
-    DBL maxdv;
-    DBL ymin, ymax, y1, y2;
     DBL neary, fary;
-    DBL k1, k2, dist;
-    Vector3d nearP;
-    Vector3d farP;
-    HFBlock *Block;
 
     px = Start[X];
     pz = Start[Z];
@@ -1887,8 +2197,6 @@ bool HField::block_traversal(const BasicRay &ray, const Vector3d& Start, IStack
     dy = ray.Direction[Y];
     dz = ray.Direction[Z];
 
-    maxdv = (dx > dz) ? dx : dz;
-
     /* First test for 'perpendicular' rays. */
 
     if ((fabs(dx) < EPSILON) && (fabs(dz) < EPSILON))
@@ -1910,172 +2218,206 @@ bool HField::block_traversal(const BasicRay &ray, const Vector3d& Start, IStack
         return intersect_pixel(x, z, ray, min(neary, fary), max(neary, fary), HField_Stack, RRay, mindist, maxdist, Thread);
     }
 
-    /* If we don't have blocks we just step through the grid. */
+    /* If we don't have a hierarchy we just step through the grid. */
 
-    if ((Data->block_max_x <= 1) && (Data->block_max_z <= 1))
+    if (Data->levels == 0)
     {
         return dda_traversal(ray, Start, &Data->Block[0][0], HField_Stack, RRay, mindist, maxdist, Thread);
     }
 
-    /* Get dimensions of grid. */
-
-    xmax = Data->block_max_x;
-    zmax = Data->block_max_z;
-
-    ymin = (DBL)Data->min_y - EPSILON;
-    ymax = (DBL)Data->max_y + EPSILON;
+    /* Otherwise descend from the single node at the top. */
 
-    dx_zero = (fabs(dx) < EPSILON);
-    dz_zero = (fabs(dz) < EPSILON);
-
-    signx = sign(dx);
-    signz = sign(dz);
-
-    /* Walk on the block grid. */
-
-    px /= Data->block_width_x;
-    pz /= Data->block_width_z;
+    return node_traversal(ray, Data->levels - 1, 0, 0, mindist, maxdist, HField_Stack, RRay, mindist, maxdist, Thread);
+}
 
-    x = (int)px;
-    z = (int)pz;
 
-    nearP = Start;
 
-    neary = Start[Y];
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   node_traversal
+*
+* INPUT
+*
+*   Ray    - Current ray
+*   Level  - Level of the node in the min-max hierarchy
+*   x, z   - Index of the node within its level
+*   t0, t1 - Part of the ray within the parent node
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   int - true if intersection was found
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Clip the ray to a node of the min-max hierarchy and skip the node
+*   if the clipped ray passes entirely above or below its heights.
+*   Otherwise visit the node's children front to back, or step through
+*   the cells of a bottom level tile.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
 
-    /*
-     * Here comes the block walk algorithm.
-     */
+bool HField::node_traversal(const BasicRay &ray, int level, int x, int z, DBL t0, DBL t1, IStack &HField_Stack, const BasicRay &RRay, DBL mindist, DBL maxdist, TraceThreadData *Thread)
+{
+    int i, width;
+    int found = false;
+    int nearx, nearz;
+    int childx[4], childz[4];
+    DBL xmin, xmax, zmin, zmax;
+    DBL k1, k2, tx, tz;
+    DBL y1, y2, ymin, ymax;
+    const HFLevel *Level = &Data->Level[level];
+    const HFMinMax *Node = &Level->Node[z * Level->size_x + x];
+    HFBlock Block;
 
-    do
-    {
 #ifdef HFIELD_EXTRA_STATS
-        Thread->Stats()[Ray_HField_Block_Tests]++;
+    Thread->Stats()[Ray_HField_Block_Tests]++;
 #endif
 
-        /* Get current block. */
+    /* Get the node's borders. */
 
-        Block = &Data->Block[z][x];
+    width = HFIELD_LEAF_SIZE << level;
 
-        /* Intersect ray with bounding planes. */
+    xmin = (DBL)(x * width);
+    zmin = (DBL)(z * width);
 
-        if (dx_zero)
-        {
-            k1 = BOUND_HUGE;
-        }
-        else
-        {
-            if (signx >= 0)
-            {
-                k1 = ((DBL)Block->xmax + 1.0 - ray.Origin[X]) / dx;
-            }
-            else
-            {
-                k1 = ((DBL)Block->xmin - ray.Origin[X]) / dx;
-            }
-        }
+    xmax = (DBL)min((x + 1) * width, Data->max_x + 1);
+    zmax = (DBL)min((z + 1) * width, Data->max_z + 1);
 
-        if (dz_zero)
+    /* Clip the ray to the node. */
+
+    if (fabs(ray.Direction[X]) < EPSILON)
+    {
+        if ((ray.Origin[X] < xmin - EPSILON) || (ray.Origin[X] > xmax + EPSILON))
         {
-            k2 = BOUND_HUGE;
+            return(false);
         }
-        else
+    }
+    else
+    {
+        k1 = (xmin - ray.Origin[X]) / ray.Direction[X];
+        k2 = (xmax - ray.Origin[X]) / ray.Direction[X];
+
+        t0 = max(t0, min(k1, k2));
+        t1 = min(t1, max(k1, k2));
+    }
+
+    if (fabs(ray.Direction[Z]) < EPSILON)
+    {
+        if ((ray.Origin[Z] < zmin - EPSILON) || (ray.Origin[Z] > zmax + EPSILON))
         {
-            if (signz >= 0)
-            {
-                k2 = ((DBL)Block->zmax + 1.0 - ray.Origin[Z]) / dz;
-            }
-            else
-            {
-                k2 = ((DBL)Block->zmin - ray.Origin[Z]) / dz;
-            }
+            return(false);
         }
+    }
+    else
+    {
+        k1 = (zmin - ray.Origin[Z]) / ray.Direction[Z];
+        k2 = (zmax - ray.Origin[Z]) / ray.Direction[Z];
 
-        /* Figure out the indices of the next block. */
+        t0 = max(t0, min(k1, k2));
+        t1 = min(t1, max(k1, k2));
+    }
 
-        if (dz_zero || ((!dx_zero) && (k1<k2 - EPSILON / maxdv) && (k1>0.0)))
-/*      if ((k1 < k2 - EPSILON / maxdv) && (k1 > 0.0)) */
-        {
-            /* Step along the x-axis. */
+    if (t0 > t1)
+    {
+        return(false);
+    }
 
-            dist = k1;
+    /* Can we hit the node at all? */
 
-            nx = x + signx;
-            nz = z;
-        }
-        else
-        {
-            if (dz_zero || ((!dx_zero) && (k1<k2 + EPSILON / maxdv) && (k1>0.0)))
-/*          if ((k1 < k2 + EPSILON / maxdv) && (k1 > 0.0))  */
-            {
-                /* Step along both axis (very rare case). */
+    y1 = ray.Origin[Y] + t0 * ray.Direction[Y];
+    y2 = ray.Origin[Y] + t1 * ray.Direction[Y];
 
-                dist = k1;
+    if (y1 > y2)
+    {
+        std::swap(y1, y2);
+    }
 
-                nx = x + signx;
-                nz = z + signz;
-            }
-            else
-            {
-                /* Step along the z-axis. */
+    ymin = max((DBL)Node->ymin, bounding_corner1[Y]) - HFIELD_OFFSET;
+    ymax = (DBL)Node->ymax + HFIELD_OFFSET;
 
-                dist = k2;
+    if ((y1 > ymax + EPSILON) || (y2 < ymin - EPSILON))
+    {
+        return(false);
+    }
 
-                nx = x;
-                nz = z + signz;
-            }
-        }
+#ifdef HFIELD_EXTRA_STATS
+    Thread->Stats()[Ray_HField_Block_Tests_Succeeded]++;
+#endif
 
-        /* Get point where ray leaves current block. */
+    if (level == 0)
+    {
+        /* Step through the cells of the tile. */
 
-        farP = ray.Evaluate(dist);
+        Block.xmin = (int)xmin;
+        Block.xmax = (int)xmax - 1;
+        Block.zmin = (int)zmin;
+        Block.zmax = (int)zmax - 1;
 
-        fary = farP[Y];
+        Block.ymin = ymin;
+        Block.ymax = ymax;
 
-        if (neary < fary)
-        {
-            y1 = neary;
-            y2 = fary;
-        }
-        else
-        {
-            y1 = fary;
-            y2 = neary;
-        }
+        return dda_traversal(ray, ray.Evaluate(t0), &Block, HField_Stack, RRay, mindist, maxdist, Thread);
+    }
 
-        /* Can we hit current block at all? */
+    /*
+     * Visit the children front to back. The ray starts out in the child
+     * nearest to its origin, and then crosses whichever of the two
+     * splitting planes it meets first.
+     */
 
-        if ((y1 <= (DBL)Block->ymax + EPSILON) && (y2 >= (DBL)Block->ymin - EPSILON))
-        {
-            /* Test current block. */
+    nearx = (ray.Direction[X] >= 0.0) ? 0 : 1;
+    nearz = (ray.Direction[Z] >= 0.0) ? 0 : 1;
 
-#ifdef HFIELD_EXTRA_STATS
-            Thread->Stats()[Ray_HField_Block_Tests_Succeeded]++;
-#endif
+    tx = (fabs(ray.Direction[X]) < EPSILON) ? BOUND_HUGE : (xmin + (DBL)(width / 2) - ray.Origin[X]) / ray.Direction[X];
+    tz = (fabs(ray.Direction[Z]) < EPSILON) ? BOUND_HUGE : (zmin + (DBL)(width / 2) - ray.Origin[Z]) / ray.Direction[Z];
 
-            if (dda_traversal(ray, nearP, &Data->Block[z][x], HField_Stack, RRay, mindist, maxdist, Thread))
-            {
-                if (Type & IS_CHILD_OBJECT)
-                {
-                    found = true;
-                }
-                else
-                {
-                    return(true);
-                }
-            }
-        }
+    childx[0] = nearx;     childz[0] = nearz;
+    childx[3] = 1 - nearx; childz[3] = 1 - nearz;
 
-        /* Step to next block. */
+    if (tx <= tz)
+    {
+        childx[1] = 1 - nearx; childz[1] = nearz;
+        childx[2] = nearx;     childz[2] = 1 - nearz;
+    }
+    else
+    {
+        childx[1] = nearx;     childz[1] = 1 - nearz;
+        childx[2] = 1 - nearx; childz[2] = nearz;
+    }
 
-        x = nx;
-        z = nz;
+    Level = &Data->Level[level - 1];
 
-        nearP = farP;
+    for (i = 0; i < 4; i++)
+    {
+        if ((2 * x + childx[i] >= Level->size_x) || (2 * z + childz[i] >= Level->size_z))
+        {
+            continue;
+        }
 
-        neary = fary;
+        if (node_traversal(ray, level - 1, 2 * x + childx[i], 2 * z + childz[i], t0, t1, HField_Stack, RRay, mindist, maxdist, Thread))
+        {
+            if (Type & IS_CHILD_OBJECT)
+            {
+                found = true;
+            }
+            else
+            {
+                return(true);
+            }
+        }
     }
-    while ((x >= 0) && (x < xmax) && (z >= 0) && (z < zmax) && (neary >= ymin) && (neary <= ymax));
 
     return(found);
 }
@@ -39,6 +39,8 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include "base/filemapping.h"
+
 #include "core/scene/object.h"
 
 namespace pov
@@ -79,8 +81,9 @@ class ImageData;
 /// The shape is implemented as a collection of triangles which are calculated as needed.
 ///
 /// The basic intersection routine first computes the ray's intersection with the box marking the limits of the shape,
-/// then follows the line from one intersection point to the other, testing the two triangles which form the pixel for
-/// an intersection with the ray at each step.
+/// then descends a hierarchy of minimum and maximum heights to skip regions the ray passes above or below, and finally
+/// follows the line through the remaining tiles, testing the two triangles which form the pixel for an intersection
+/// with the ray at each step.
 ///
 class HField : public ObjectBase
 {
@@ -104,13 +107,18 @@ class HField : public ObjectBase
         virtual void Compute_BBox();
 
         void Compute_HField(const ImageData *image);
+        void Map_HField(const shared_ptr<MappedFile>& file, int width, int height);
     protected:
         static DBL normalize(Vector3d& A, const Vector3d& B);
-        void smooth_height_field(int xsize, int zsize);
+        void init_hfield(int max_x, int max_z);
+        const short *smooth_height_field(int bx, int bz) const;
+        void smooth_normal(short *normal, int x, int z) const;
+        void get_normal(Vector3d& N, int x, int z) const;
         bool intersect_pixel(int x, int z, const BasicRay& ray, DBL height1, DBL height2, IStack &HField_Stack, const BasicRay &RRay, DBL mindist, DBL maxdist, TraceThreadData *Thread);
         static int add_single_normal(HF_VAL **data, int xsize, int zsize, int x0, int z0,int x1, int z1,int x2, int z2, Vector3d& N);
         bool dda_traversal(const BasicRay &ray, const Vector3d& Start, const HFBlock *Block, IStack &HField_Stack, const BasicRay &RRay, DBL mindist, DBL maxdist, TraceThreadData *Thread);
         bool block_traversal(const BasicRay &ray, const Vector3d& Start, IStack &HField_Stack, const BasicRay &RRay, DBL mindist, DBL maxdist, TraceThreadData *Thread);
+        bool node_traversal(const BasicRay &ray, int level, int x, int z, DBL t0, DBL t1, IStack &HField_Stack, const BasicRay &RRay, DBL mindist, DBL maxdist, TraceThreadData *Thread);
         void build_hfield_blocks();
 };
 
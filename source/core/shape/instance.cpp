@@ -0,0 +1,633 @@
+//******************************************************************************
+///
+/// @file core/shape/instance.cpp
+///
+/// Implementation of the instance geometric primitive.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+/****************************************************************************
+*
+*  Explanation:
+*
+*    An instance references an object (the prototype) that is shared by all
+*    copies of the instance, so that copying it costs little more than a
+*    transformation. The prototype is parsed and post-processed once; if it
+*    is a union, a bounding box hierarchy over its children is built once as
+*    well and used for all copies.
+*
+*  Syntax:
+*
+*    instance
+*    {
+*      OBJECT
+*      [ OBJECT_MODIFIERS... ]
+*    }
+*
+*****************************************************************************/
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "core/shape/instance.h"
+
+#include <algorithm>
+
+#include "core/bounding/boundingbox.h"
+#include "core/material/interior.h"
+#include "core/material/pigment.h"
+#include "core/material/texture.h"
+#include "core/math/matrix.h"
+#include "core/render/ray.h"
+#include "core/scene/tracethreaddata.h"
+#include "core/shape/csg.h"
+#include "core/shape/mesh.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+/*****************************************************************************
+* Local functions
+******************************************************************************/
+
+// Same ray type test as applied by unions to their children.
+inline bool Test_Ray_Flags(const Ray& ray, ConstObjectPtr obj)
+{
+    return ( ( !ray.IsPhotonRay() &&
+               (!Test_Flag(obj, NO_IMAGE_FLAG) || ray.IsImageRay() == false || ray.IsPrimaryRay() == true) &&
+               (!Test_Flag(obj, NO_REFLECTION_FLAG) || ray.IsReflectionRay() == false) &&
+               (!Test_Flag(obj, NO_RADIOSITY_FLAG) || ray.IsRadiosityRay() == false) ) ||
+             ( ray.IsPhotonRay() && !Test_Flag(obj, NO_SHADOW_FLAG) ) );
+}
+
+// Test whether a texture evaluates the same regardless of where it is hit,
+// in which case it can be shared by all instances as-is.
+static bool Is_Position_Independent(const TEXTURE *Texture)
+{
+    for (const TEXTURE *Layer = Texture; Layer != nullptr; Layer = Layer->Next)
+    {
+        if ((Layer->Type != PLAIN_PATTERN) || (Layer->Tnormal != nullptr))
+            return false;
+
+        if ((Layer->Pigment != nullptr) &&
+            (Layer->Pigment->Type != NO_PATTERN) &&
+            (Layer->Pigment->Type != PLAIN_PATTERN) &&
+            (Layer->Pigment->Type != COLOUR_PATTERN))
+            return false;
+    }
+
+    return true;
+}
+
+static void Collect_Textures(ConstObjectPtr Object, const InstanceData *Data, vector<TEXTURE *>& Textures)
+{
+    if (!Test_Flag(Object, UV_FLAG))
+    {
+        TEXTURE *Candidates[2] = { Object->Texture, Object->Interior_Texture };
+
+        for (int i = 0; i < 2; i++)
+        {
+            if ((Candidates[i] != nullptr) && (Candidates[i] != Data->Default_Texture) && !Is_Position_Independent(Candidates[i]))
+                Textures.push_back(Candidates[i]);
+        }
+
+        const Mesh *mesh = dynamic_cast<const Mesh *>(Object);
+        if (mesh != nullptr)
+        {
+            for (MeshIndex i = 0; i < mesh->Number_Of_Textures; i++)
+            {
+                if ((mesh->Textures[i] != nullptr) && !Is_Position_Independent(mesh->Textures[i]))
+                    Textures.push_back(mesh->Textures[i]);
+            }
+        }
+    }
+
+    if (Object->Type & IS_COMPOUND_OBJECT)
+    {
+        const CompoundObject *compound = reinterpret_cast<const CompoundObject *>(Object);
+
+        for (vector<ObjectPtr>::const_iterator Sib = compound->children.begin(); Sib != compound->children.end(); Sib++)
+            Collect_Textures(*Sib, Data, Textures);
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   All_Intersections
+*
+* INPUT
+*
+*   ray         - Ray
+*   Depth_Stack - Intersection stack
+*
+* OUTPUT
+*
+*   Depth_Stack
+*
+* RETURNS
+*
+*   int - true, if an intersection was found
+*
+* DESCRIPTION
+*
+*   Transform the ray into prototype space once, intersect it with the
+*   prototype, and convert the resulting intersections back to world space.
+*   The prototype's component that was hit is remembered in the intersection
+*   to compute the normal and texture later on.
+*
+******************************************************************************/
+
+bool Instance::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    return Intersect_Local(ray, nullptr, Depth_Stack, Thread);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Component_Intersections
+*
+* INPUT
+*
+*   Component   - Top-level component of the prototype, as reported in an
+*                 intersection's InnerComponent
+*   ray         - Ray
+*   Depth_Stack - Intersection stack
+*
+* OUTPUT
+*
+*   Depth_Stack
+*
+* RETURNS
+*
+*   int - true, if an intersection was found
+*
+* DESCRIPTION
+*
+*   Like All_Intersections, but only test a single component of the
+*   prototype, e.g. to re-test an object found to cast a shadow before.
+*
+******************************************************************************/
+
+bool Instance::Component_Intersections(ObjectPtr Component, const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    return Intersect_Local(ray, Component, Depth_Stack, Thread);
+}
+
+
+
+bool Instance::Intersect_Local(const Ray& ray, ObjectPtr Component, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    bool Found;
+    DBL len;
+    Vector3d N;
+    Ray New_Ray(ray);
+
+    /* Transform the ray into prototype space. */
+
+    MInvTransRay(New_Ray, ray, Trans);
+
+    len = New_Ray.Normalize();
+
+    IStack Local_Stack(Thread->stackPool);
+    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+
+    if (Component != nullptr)
+        Found = Intersect_Prototype(New_Ray, Component, Local_Stack, Thread);
+    else if (Data->Tree != nullptr)
+    {
+        if (!Data->Prototype->Bound.empty() && !Ray_In_Bound(New_Ray, Data->Prototype->Bound, Thread))
+            return false;
+
+        Rayinfo rayinfo(New_Ray);
+
+        Found = Intersect_Tree(New_Ray, rayinfo, Data->Tree, Local_Stack, Thread);
+    }
+    else
+        Found = Intersect_Prototype(New_Ray, Data->Prototype, Local_Stack, Thread);
+
+    while (Local_Stack->size() > 0)
+    {
+        Intersection& Local = Local_Stack->top();
+
+        /* Keep the component's auxiliary data, but move the hit into world space. */
+
+        if (Local.haveNormal)
+        {
+            N = Local.INormal;
+            if (Test_Flag(Local.Object, INVERTED_FLAG))
+                N.invert();
+            MTransNormal(Local.INormal, N, Trans);
+            Local.INormal.normalize();
+        }
+
+        Local.InnerObject = Local.Object;
+        Local.InnerComponent = (Local.Csg != nullptr) ? Local.Csg : Local.Object;
+        Local.Object = this;
+        Local.Csg = nullptr;
+        Local.Depth /= len;
+        Local.IPoint = ray.Evaluate(Local.Depth);
+
+        Depth_Stack->push(Local);
+
+        Local_Stack->pop();
+    }
+
+    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack is in a cleaned-up condition (again)
+
+    return (Found);
+}
+
+
+
+bool Instance::Intersect_Prototype(const Ray& ray, ObjectPtr object, IStack& Depth_Stack, TraceThreadData *Thread) const
+{
+    if (!object->Bound.empty() && !Ray_In_Bound(ray, object->Bound, Thread))
+        return false;
+
+    return object->All_Intersections(ray, Depth_Stack, Thread);
+}
+
+
+
+bool Instance::Intersect_Tree(const Ray& ray, const Rayinfo& rayinfo, const BBOX_TREE *Node, IStack& Depth_Stack, TraceThreadData *Thread) const
+{
+    DBL Depth;
+    bool Found;
+    ObjectPtr Object;
+
+    if (!Intersect_BBox_Node(Node, &Node->BBox, &rayinfo, Depth, Thread->Stats()))
+        return false;
+
+    if (Node->Entries)
+    {
+        Found = false;
+
+        for (short i = 0; i < Node->Entries; i++)
+        {
+            if (Intersect_Tree(ray, rayinfo, Node->Node[i], Depth_Stack, Thread))
+                Found = true;
+        }
+
+        return (Found);
+    }
+
+    Object = reinterpret_cast<ObjectPtr>(Node->Node);
+
+    if (!Test_Ray_Flags(ray, Object))
+        return false;
+
+    return Intersect_Prototype(ray, Object, Depth_Stack, Thread);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Get_Local_Intersection
+*
+* DESCRIPTION
+*
+*   Reconstruct the intersection with the prototype's component, in
+*   prototype space, from an intersection with the instance.
+*
+******************************************************************************/
+
+void Instance::Get_Local_Intersection(Intersection& Local, const Intersection *Inter) const
+{
+    Local = *Inter;
+
+    MInvTransPoint(Local.IPoint, Inter->IPoint, Trans);
+
+    Local.Object = Inter->InnerObject;
+    Local.InnerObject = nullptr;
+    Local.InnerComponent = nullptr;
+    Local.Csg = (Data->Prototype->Type & IS_CSG_OBJECT) ? Data->Prototype : nullptr;
+}
+
+
+
+bool Instance::Inside(const Vector3d& IPoint, TraceThreadData *Thread) const
+{
+    Vector3d New_Point;
+
+    MInvTransPoint(New_Point, IPoint, Trans);
+
+    return (Inside_Object(New_Point, Data->Prototype, Thread) != (Test_Flag(this, INVERTED_FLAG) != 0));
+}
+
+
+
+void Instance::Normal(Vector3d& Result, Intersection *Inter, TraceThreadData *Thread) const
+{
+    Intersection Local;
+
+    if (Inter->haveNormal || (Inter->InnerObject == nullptr))
+    {
+        Result = Inter->INormal;
+        return;
+    }
+
+    Get_Local_Intersection(Local, Inter);
+
+    Inter->InnerObject->Normal(Result, &Local, Thread);
+
+    if (Test_Flag(Inter->InnerObject, INVERTED_FLAG))
+        Result.invert();
+
+    MTransNormal(Result, Result, Trans);
+
+    Result.normalize();
+}
+
+
+
+void Instance::UVCoord(Vector2d& Result, const Intersection *Inter, TraceThreadData *Thread) const
+{
+    Intersection Local;
+
+    if (Inter->InnerObject == nullptr)
+    {
+        ObjectBase::UVCoord(Result, Inter, Thread);
+        return;
+    }
+
+    Get_Local_Intersection(Local, Inter);
+
+    Inter->InnerObject->UVCoord(Result, &Local, Thread);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Determine_Textures
+*
+* DESCRIPTION
+*
+*   Use the texture of the prototype's component that was hit, substituting
+*   the instance's own transformed copy where the texture depends on
+*   position. Parts of the prototype that received no texture of their own
+*   use the instance's texture.
+*
+******************************************************************************/
+
+void Instance::Determine_Textures(Intersection *isect, bool hitinside, WeightedTextureVector& textures, TraceThreadData *Thread)
+{
+    ObjectPtr Inner = isect->InnerObject;
+
+    if (Inner != nullptr)
+    {
+        if (Test_Flag(Inner, MULTITEXTURE_FLAG) ||
+            ((Inner->Texture == nullptr) && Test_Flag(Inner, CUTAWAY_TEXTURES_FLAG)))
+        {
+            Intersection Local;
+            size_t first = textures.size();
+
+            Get_Local_Intersection(Local, isect);
+
+            Inner->Determine_Textures(&Local, hitinside, textures, Thread);
+
+            for (size_t i = first; i < textures.size(); i++)
+                textures[i].texture = Map_Texture(textures[i].texture);
+
+            if (textures.size() > first)
+                return;
+        }
+        else if (hitinside && (Inner->Interior_Texture != nullptr))
+        {
+            textures.push_back(WeightedTexture(1.0, Map_Texture(Inner->Interior_Texture)));
+            return;
+        }
+        else if ((Inner->Texture != nullptr) && (Inner->Texture != Data->Default_Texture))
+        {
+            textures.push_back(WeightedTexture(1.0, Map_Texture(Inner->Texture)));
+            return;
+        }
+    }
+
+    ObjectBase::Determine_Textures(isect, hitinside, textures, Thread);
+}
+
+
+
+TEXTURE *Instance::Map_Texture(TEXTURE *texture) const
+{
+    if (texture == Data->Default_Texture)
+        return Texture;
+
+    vector<TEXTURE *>::const_iterator i = std::lower_bound(Data->Textures.begin(), Data->Textures.end(), texture, std::less<TEXTURE *>());
+
+    if ((i != Data->Textures.end()) && (*i == texture))
+        return Local_Textures[i - Data->Textures.begin()];
+
+    return texture;
+}
+
+
+
+bool Instance::IsOpaque() const
+{
+    return ObjectBase::IsOpaque() && Data->Prototype->IsOpaque();
+}
+
+
+
+void Instance::Translate(const Vector3d&, const TRANSFORM *tr)
+{
+    Transform(tr);
+}
+
+
+
+void Instance::Rotate(const Vector3d&, const TRANSFORM *tr)
+{
+    Transform(tr);
+}
+
+
+
+void Instance::Scale(const Vector3d&, const TRANSFORM *tr)
+{
+    Transform(tr);
+}
+
+
+
+void Instance::Transform(const TRANSFORM *tr)
+{
+    Compose_Transforms(Trans, tr);
+
+    Compute_BBox();
+
+    if (!Test_Flag(this, UV_FLAG))
+        for (vector<TEXTURE *>::iterator i = Local_Textures.begin(); i != Local_Textures.end(); i++)
+            Transform_Textures(*i, tr);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Instance
+*
+* DESCRIPTION
+*
+*   Create an instance of an already post-processed prototype, taking
+*   ownership of it. The prototype's untextured parts are identified by
+*   the default texture they were given during post-processing.
+*
+******************************************************************************/
+
+Instance::Instance() : ObjectBase(INSTANCE_OBJECT)
+{
+    Set_Flag(this, MULTITEXTURE_FLAG);
+
+    Trans = Create_Transform();
+
+    Data = nullptr;
+}
+
+Instance::Instance(ObjectPtr prototype, TEXTURE *defaultTexture) : ObjectBase(INSTANCE_OBJECT)
+{
+    unsigned int numberOfFiniteObjects, numberOfInfiniteObjects, numberOfLightSources;
+
+    Set_Flag(this, MULTITEXTURE_FLAG);
+
+    Trans = Create_Transform();
+
+    Data = new InstanceData;
+
+    Data->References = 1;
+    Data->Prototype = prototype;
+    Data->Tree = nullptr;
+    Data->Default_Texture = defaultTexture;
+
+    /* Build the bottom level hierarchy, unless the union needs to see all of its children's intersections. */
+
+    if ((dynamic_cast<CSGUnion *>(prototype) != nullptr) && (dynamic_cast<CSGMerge *>(prototype) == nullptr) &&
+        prototype->Clip.empty())
+    {
+        vector<ObjectPtr> children((reinterpret_cast<CSGUnion *>(prototype))->children);
+
+        if (children.size() > 1)
+            Build_Bounding_Slabs(&Data->Tree, children, numberOfFiniteObjects, numberOfInfiniteObjects, numberOfLightSources, kBBoxTreeBuild_BinnedSAH);
+    }
+
+    Collect_Textures(prototype, Data, Data->Textures);
+
+    std::sort(Data->Textures.begin(), Data->Textures.end(), std::less<TEXTURE *>());
+    Data->Textures.erase(std::unique(Data->Textures.begin(), Data->Textures.end()), Data->Textures.end());
+
+    Local_Textures.reserve(Data->Textures.size());
+    for (vector<TEXTURE *>::const_iterator i = Data->Textures.begin(); i != Data->Textures.end(); i++)
+        Local_Textures.push_back(Copy_Textures(*i));
+
+    if (prototype->interior != nullptr)
+        interior = InteriorPtr(new Interior(*(prototype->interior)));
+
+    Compute_BBox();
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Copy
+*
+* DESCRIPTION
+*
+*   Copy an instance.
+*
+*   NOTE: The prototype is not copied, only the number of references is
+*         counted, so that the destructor knows if it can be destroyed.
+*
+******************************************************************************/
+
+ObjectPtr Instance::Copy()
+{
+    Instance *New = new Instance();
+
+    Destroy_Transform(New->Trans);
+    *New = *this;
+    New->Trans = Copy_Transform(Trans);
+
+    New->Data = Data;
+    New->Data->References++;
+
+    for (vector<TEXTURE *>::iterator i = New->Local_Textures.begin(); i != New->Local_Textures.end(); i++)
+        *i = Copy_Textures(*i);
+
+    return (New);
+}
+
+
+
+Instance::~Instance()
+{
+    for (vector<TEXTURE *>::iterator i = Local_Textures.begin(); i != Local_Textures.end(); i++)
+        Destroy_Textures(*i);
+
+    if ((Data != nullptr) && (--(Data->References) == 0))
+    {
+        Destroy_BBox_Tree(Data->Tree);
+
+        Destroy_Object(Data->Prototype);
+
+        delete Data;
+    }
+}
+
+
+
+void Instance::Compute_BBox()
+{
+    BBox = Data->Prototype->BBox;
+
+    Recompute_BBox(&BBox, Trans);
+}
+
+}
@@ -0,0 +1,134 @@
+//******************************************************************************
+///
+/// @file core/shape/instance.h
+///
+/// Declarations related to the instance geometric primitive.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_CORE_INSTANCE_H
+#define POVRAY_CORE_INSTANCE_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "core/configcore.h"
+
+#include "core/scene/object.h"
+
+namespace pov
+{
+
+//##############################################################################
+///
+/// @addtogroup PovCoreShape
+///
+/// @{
+
+//******************************************************************************
+///
+/// @name Object Types
+///
+/// @{
+
+#define INSTANCE_OBJECT (BASIC_OBJECT)
+
+/// @}
+///
+//******************************************************************************
+
+typedef struct BBox_Tree_Struct BBOX_TREE;
+
+/*****************************************************************************
+* Global typedefs
+******************************************************************************/
+
+/// Geometry shared by all copies of an instance.
+///
+/// The prototype is held in its own coordinate space; each @ref Instance referencing it merely
+/// adds a transformation of its own. For union prototypes, a bounding box hierarchy over the
+/// union's children is built once and shared as well, forming the bottom level of a two-level
+/// scheme whose top level is the scene's own bounding hierarchy over the instances.
+///
+struct InstanceData
+{
+    int References;             ///< Number of instances referencing the data.
+    ObjectPtr Prototype;        ///< Instanced object, in prototype space.
+    BBOX_TREE *Tree;            ///< Bounding box tree over the prototype's children, or `nullptr`.
+    TEXTURE *Default_Texture;   ///< Texture given to untextured parts of the prototype, or `nullptr`.
+    vector<TEXTURE *> Textures; ///< Position-dependent textures used in the prototype, in pointer order.
+};
+
+/// Lightweight copy of a shared prototype object.
+///
+/// Intersections are computed by transforming the ray into prototype space once per instance,
+/// and then descending into the prototype's own bounding box tree. Textures are taken from the
+/// prototype's components; those depending on position are kept per instance as transformed
+/// copies, while untextured parts of the prototype use the instance's own texture.
+///
+class Instance : public ObjectBase
+{
+    public:
+        InstanceData *Data;                 ///< Shared prototype data.
+        vector<TEXTURE *> Local_Textures;   ///< Per-instance copies of the prototype's position-dependent textures.
+
+        Instance(ObjectPtr prototype, TEXTURE *defaultTexture);
+        virtual ~Instance();
+
+        virtual ObjectPtr Copy();
+
+        virtual bool All_Intersections(const Ray&, IStack&, TraceThreadData *);
+        bool Component_Intersections(ObjectPtr Component, const Ray&, IStack&, TraceThreadData *);
+        virtual bool Inside(const Vector3d&, TraceThreadData *) const;
+        virtual void Normal(Vector3d&, Intersection *, TraceThreadData *) const;
+        virtual void UVCoord(Vector2d&, const Intersection *, TraceThreadData *) const;
+        virtual void Translate(const Vector3d&, const TRANSFORM *);
+        virtual void Rotate(const Vector3d&, const TRANSFORM *);
+        virtual void Scale(const Vector3d&, const TRANSFORM *);
+        virtual void Transform(const TRANSFORM *);
+        virtual void Compute_BBox();
+        virtual void Determine_Textures(Intersection *, bool, WeightedTextureVector&, TraceThreadData *);
+        virtual bool IsOpaque() const;
+
+    protected:
+        Instance();
+
+        bool Intersect_Local(const Ray& ray, ObjectPtr Component, IStack& Depth_Stack, TraceThreadData *Thread);
+        bool Intersect_Prototype(const Ray& ray, ObjectPtr object, IStack& Depth_Stack, TraceThreadData *Thread) const;
+        bool Intersect_Tree(const Ray& ray, const Rayinfo& rayinfo, const BBOX_TREE *Node, IStack& Depth_Stack, TraceThreadData *Thread) const;
+        void Get_Local_Intersection(Intersection& Local, const Intersection *Inter) const;
+        TEXTURE *Map_Texture(TEXTURE *texture) const;
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_CORE_INSTANCE_H
@@ -41,12 +41,17 @@
 #include "core/shape/isosurface.h"
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "base/messenger.h"
 
 #include "core/math/matrix.h"
 #include "core/render/ray.h"
 #include "core/scene/tracethreaddata.h"
+#include "core/shape/mesh.h"
 
 // this must be the last file included
 #include "base/povdebug.h"
@@ -58,12 +63,32 @@ namespace pov
 * Local preprocessor defines
 ******************************************************************************/
 
+/// Number of cells along each axis of the grid of gradients learned with `evaluate`.
+#define ISO_GRADIENT_GRID_SIZE 8
+
+/// Number of times the container is subdivided along each axis when computing a tight bounding box.
+#define ISO_TIGHT_BBOX_DEPTH 4
+
+/// Gradients found while rendering an isosurface.
+///
+/// The data is shared by all copies of the isosurface and updated concurrently by all render
+/// threads, so the values only ever grow and are updated atomically.
+///
+/// With `evaluate`, the gradient is also learned separately for each cell of a coarse grid laid
+/// over the container in the isosurface's local co-ordinates, so that regions where the function
+/// is well-behaved are not stepped through as cautiously as the steepest region found so far.
+///
 struct ISO_Max_Gradient
 {
-    DBL max_gradient, gradient;
-    DBL eval_max, eval_cnt, eval_gradient_sum, eval_var;
+    std::atomic<DBL> max_gradient, gradient;
+    std::atomic<DBL> eval_max, eval_cnt, eval_gradient_sum, eval_var;
     bool reported;
 
+    std::once_flag gridOnce;
+    std::unique_ptr<std::atomic<DBL>[]> grid;   ///< Learned gradient per cell, or `nullptr` unless `evaluate` is used.
+    Vector3d gridMin;                           ///< Lower corner of the grid.
+    Vector3d gridScale;                         ///< Cells per unit along each axis.
+
     ISO_Max_Gradient() :
         max_gradient(0.0),
         gradient(0.0),
@@ -86,6 +111,20 @@ private:
 inline void intrusive_ptr_add_ref(ISO_Max_Gradient* f) { ++f->mRefCounter; }
 inline void intrusive_ptr_release(ISO_Max_Gradient* f) { if (!(--f->mRefCounter)) delete f; }
 
+static inline void AtomicMax(std::atomic<DBL>& a, DBL v)
+{
+    DBL old = a.load(std::memory_order_relaxed);
+    while ((old < v) && !a.compare_exchange_weak(old, v, std::memory_order_relaxed))
+        ;
+}
+
+static inline void AtomicAdd(std::atomic<DBL>& a, DBL v)
+{
+    DBL old = a.load(std::memory_order_relaxed);
+    while (!a.compare_exchange_weak(old, old + v, std::memory_order_relaxed))
+        ;
+}
+
 
 /*****************************************************************************
 *
@@ -122,6 +161,15 @@ bool IsoSurface::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThr
     Vector3d Plocal, Dlocal;
     DBL tmax = 0.0, tmin = 0.0, tmp = 0.0;
     DBL maxg = max_gradient;
+
+    if(eval == true)
+    {
+        std::call_once(mginfo->gridOnce, &IsoSurface::Init_Gradient_Grid, this);
+        maxg = max(maxg, mginfo->max_gradient.load(std::memory_order_relaxed));
+    }
+    if((secondaryMesh != nullptr) && (ray.IsShadowTestRay() || ray.IsRadiosityRay() || ray.IsPhotonRay()))
+        return Secondary_Mesh_Intersections(ray, Depth_Stack, Thread);
+
     int i = 0 ; /* count of intervals in stack - 1      */
     int IFound = false;
     int begin = 0, end = 0;
@@ -247,10 +295,7 @@ bool IsoSurface::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThr
     }
 
     if(eval == true)
-    {
-        DBL temp_max_gradient = max_gradient; // TODO FIXME - works around nasty gcc (found using 4.0.1) bug failing to honor casting away of volatile on pass by value on template argument lookup [trf]
-        max_gradient = max((DBL)temp_max_gradient, maxg); // TODO FIXME - This is not thread-safe but should be!!! [trf]
-    }
+        AtomicMax(mginfo->max_gradient, maxg);
 
     return (IFound);
 }
@@ -536,6 +581,9 @@ void IsoSurface::Transform(const TRANSFORM* tr)
 
     Compose_Transforms(Trans, tr);
 
+    if (secondaryMesh != nullptr)
+        secondaryMesh->Transform(tr);
+
     Compute_BBox();
 }
 
@@ -588,9 +636,11 @@ IsoSurface::IsoSurface() :
     closed = true;
 
     max_gradient = 1.1;
-    gradient = 0.0;
     threshold = 0.0;
 
+    secondaryMesh = nullptr;
+    secondaryTolerance = 0.0;
+
     mginfo = intrusive_ptr<ISO_Max_Gradient>(new ISO_Max_Gradient());
 }
 
@@ -637,6 +687,9 @@ ObjectPtr IsoSurface::Copy()
 
     New->container = shared_ptr<ContainedByShape>(container->Copy());
 
+    if (secondaryMesh != nullptr)
+        New->secondaryMesh = static_cast<Mesh *>(secondaryMesh->Copy());
+
     return (New);
 }
 
@@ -670,6 +723,7 @@ ObjectPtr IsoSurface::Copy()
 IsoSurface::~IsoSurface()
 {
     delete Function;
+    delete secondaryMesh;
 }
 
 /*****************************************************************************
@@ -701,12 +755,7 @@ IsoSurface::~IsoSurface()
 
 void IsoSurface::DispatchShutdownMessages(GenericMessenger& messenger)
 {
-    // TODO FIXME - works around nasty gcc (found using 4.0.1) bug failing to honor casting
-    // away of volatile on pass by value on template argument lookup [trf]
-    DBL temp_max_gradient = max_gradient;
-
-    mginfo->gradient = max(gradient, mginfo->gradient);
-    mginfo->max_gradient = max((DBL)temp_max_gradient, mginfo->max_gradient);
+    AtomicMax(mginfo->max_gradient, max_gradient);
 
     if (mginfo->IsShared())
     {
@@ -723,10 +772,13 @@ void IsoSurface::DispatchShutdownMessages(GenericMessenger& messenger)
         {
             // Only show the warning if necessary!
             // BTW, not being too picky here is a feature and not a bug ;-)  [trf]
-            if ((mginfo->gradient > EPSILON) && (mginfo->max_gradient > EPSILON))
+            DBL found = mginfo->gradient;
+            DBL given = mginfo->max_gradient;
+
+            if ((found > EPSILON) && (given > EPSILON))
             {
-                DBL diff = mginfo->max_gradient - mginfo->gradient;
-                DBL prop = fabs(mginfo->max_gradient / mginfo->gradient);
+                DBL diff = given - found;
+                DBL prop = fabs(given / found);
 
                 if (((prop <= 0.9) && (diff <= -0.5)) || (((prop <= 0.95) || (diff <= -0.1)) && (mginfo->max_gradient < 10.0)))
                 {
@@ -734,8 +786,8 @@ void IsoSurface::DispatchShutdownMessages(GenericMessenger& messenger)
                                         "The maximum gradient found was %0.3f, but max_gradient of the\n"
                                         "isosurface was set to %0.3f. The isosurface may contain holes!\n"
                                         "Adjust max_gradient to get a proper rendering of the isosurface.",
-                                        (float)(mginfo->gradient),
-                                        (float)(mginfo->max_gradient));
+                                        (float)(found),
+                                        (float)(given));
                 }
                 else if ((diff >= 10.0) || ((prop >= 1.1) && (diff >= 0.5)))
                 {
@@ -743,25 +795,27 @@ void IsoSurface::DispatchShutdownMessages(GenericMessenger& messenger)
                                         "The maximum gradient found was %0.3f, but max_gradient of\n"
                                         "the isosurface was set to %0.3f. Adjust max_gradient to\n"
                                         "get a faster rendering of the isosurface.",
-                                        (float)(mginfo->gradient),
-                                        (float)(mginfo->max_gradient));
+                                        (float)(found),
+                                        (float)(given));
                 }
             }
         }
         else
         {
-            DBL diff = (mginfo->eval_max / max(mginfo->eval_max - mginfo->eval_var, EPSILON));
+            DBL evalMax = mginfo->eval_max;
+            DBL evalVar = mginfo->eval_var;
+            DBL diff = (evalMax / max(evalMax - evalVar, EPSILON));
 
-            if ((eval_param[0] > mginfo->eval_max) || (eval_param[1] > diff))
+            if ((eval_param[0] > evalMax) || (eval_param[1] > diff))
             {
-                mginfo->eval_cnt = max(mginfo->eval_cnt, 1.0); // make sure it won't be zero
+                DBL evalCnt = max(mginfo->eval_cnt.load(), 1.0); // make sure it won't be zero
 
                 messenger.InfoAt(*fnInfo,
                                     "Evaluate found a maximum gradient of %0.3f and an average\n"
                                     "gradient of %0.3f. The maximum gradient variation was %0.3f.\n",
-                                    (float)(mginfo->eval_max),
-                                    (float)(mginfo->eval_gradient_sum / mginfo->eval_cnt),
-                                    (float)(mginfo->eval_var));
+                                    (float)(evalMax),
+                                    (float)(mginfo->eval_gradient_sum / evalCnt),
+                                    (float)(evalVar));
             }
         }
     }
@@ -803,6 +857,555 @@ void IsoSurface::Compute_BBox()
 }
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   IsoSurface::Init_Gradient_Grid
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Lay the grid of learned gradients over the container's bounding box,
+*   with every cell starting out at max_gradient. Called once for all copies
+*   of the isosurface, by whichever render thread gets there first.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void IsoSurface::Init_Gradient_Grid()
+{
+    const int cells = ISO_GRADIENT_GRID_SIZE * ISO_GRADIENT_GRID_SIZE * ISO_GRADIENT_GRID_SIZE;
+    BoundingBox box;
+
+    container->ComputeBBox(box);
+
+    for (int i = X; i <= Z; i++)
+    {
+        mginfo->gridMin[i] = box.lowerLeft[i];
+        mginfo->gridScale[i] = (box.size[i] > EPSILON) ? ISO_GRADIENT_GRID_SIZE / box.size[i] : 0.0;
+    }
+
+    mginfo->grid.reset(new std::atomic<DBL>[cells]);
+    for (int i = 0; i < cells; i++)
+        mginfo->grid[i].store(max_gradient, std::memory_order_relaxed);
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   IsoSurface::Gradient_Cells
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Find the range of grid cells spanned by the part of the ray between t1
+*   and t2. Points outside the grid are clamped to its border cells.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void IsoSurface::Gradient_Cells(const ISO_ThreadData& itd, DBL t1, DBL t2, int *lo, int *hi) const
+{
+    const DBL last = ISO_GRADIENT_GRID_SIZE - 1;
+
+    for (int i = X; i <= Z; i++)
+    {
+        DBL c1 = (itd.Pglobal[i] + t1 * itd.Dglobal[i] - mginfo->gridMin[i]) * mginfo->gridScale[i];
+        DBL c2 = (itd.Pglobal[i] + t2 * itd.Dglobal[i] - mginfo->gridMin[i]) * mginfo->gridScale[i];
+
+        if (c1 > c2)
+            std::swap(c1, c2);
+
+        lo[i] = (int)floor(clip(c1, 0.0, last));
+        hi[i] = (int)floor(clip(c2, 0.0, last));
+    }
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   IsoSurface::Region_Gradient
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   DBL - the largest gradient learned along the part of the ray
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+DBL IsoSurface::Region_Gradient(const ISO_ThreadData& itd, DBL t1, DBL t2) const
+{
+    int lo[3], hi[3];
+    DBL g = 0.0;
+
+    Gradient_Cells(itd, t1, t2, lo, hi);
+
+    for (int z = lo[Z]; z <= hi[Z]; z++)
+        for (int y = lo[Y]; y <= hi[Y]; y++)
+            for (int x = lo[X]; x <= hi[X]; x++)
+                g = max(g, mginfo->grid[(z * ISO_GRADIENT_GRID_SIZE + y) * ISO_GRADIENT_GRID_SIZE + x].load(std::memory_order_relaxed));
+
+    return g;
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   IsoSurface::Raise_Region_Gradient
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Raise the gradient learned along the part of the ray to at least g.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void IsoSurface::Raise_Region_Gradient(const ISO_ThreadData& itd, DBL t1, DBL t2, DBL g) const
+{
+    int lo[3], hi[3];
+
+    Gradient_Cells(itd, t1, t2, lo, hi);
+
+    for (int z = lo[Z]; z <= hi[Z]; z++)
+        for (int y = lo[Y]; y <= hi[Y]; y++)
+            for (int x = lo[X]; x <= hi[X]; x++)
+                AtomicMax(mginfo->grid[(z * ISO_GRADIENT_GRID_SIZE + y) * ISO_GRADIENT_GRID_SIZE + x], g);
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   IsoSurface::Build_Secondary_Mesh
+*
+* INPUT
+*
+*   resolution - Number of grid cells along each axis
+*   Thread     - Thread data used to evaluate the function
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   bool - false if no surface was found
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Tessellate the isosurface using marching tetrahedra on a regular grid
+*   over the container's bounding box, splitting each cell into six
+*   tetrahedra around its main diagonal so that neighbouring cells match.
+*   Grid points outside the container count as outside the surface, so a
+*   closed isosurface is capped roughly where the container cuts it; for an
+*   open one, cells reaching outside the container are left empty.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+/// Corners of a grid cell, as offsets along X, Y and Z.
+static const int kIsoCellCorner[8][3] = {
+    { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 },
+    { 0, 0, 1 }, { 1, 0, 1 }, { 1, 1, 1 }, { 0, 1, 1 }
+};
+
+/// Tetrahedra sharing the diagonal from corner 0 to corner 6 that a grid cell is split into.
+static const int kIsoCellTetrahedra[6][4] = {
+    { 0, 5, 1, 6 }, { 0, 1, 2, 6 }, { 0, 2, 3, 6 },
+    { 0, 3, 7, 6 }, { 0, 7, 4, 6 }, { 0, 4, 5, 6 }
+};
+
+typedef std::unordered_map<unsigned long long, MeshIndex> IsoEdgeVertexMap;
+
+static MeshIndex IsoEdgeVertex(int a, int b, const vector<Vector3d>& points, const vector<DBL>& values, const vector<bool>& outside,
+                               IsoEdgeVertexMap& edges, vector<Vector3d>& vertices)
+{
+    unsigned long long key;
+    DBL t;
+
+    if (a > b)
+        std::swap(a, b);
+
+    key = (unsigned long long)a * points.size() + b;
+
+    IsoEdgeVertexMap::const_iterator it = edges.find(key);
+    if (it != edges.end())
+        return it->second;
+
+    if (outside[a] || outside[b])
+        t = 0.5;
+    else
+        t = values[a] / (values[a] - values[b]);
+
+    vertices.push_back(points[a] + t * (points[b] - points[a]));
+    edges[key] = vertices.size() - 1;
+
+    return vertices.size() - 1;
+}
+
+bool IsoSurface::Build_Secondary_Mesh(int resolution, TraceThreadData *Thread)
+{
+    const int n = resolution + 1;
+    GenericScalarFunctionInstance fn(Function, Thread);
+    BoundingBox box;
+    Vector3d step;
+    vector<Vector3d> points(n * n * n);
+    vector<DBL> values(n * n * n);
+    vector<bool> outside(n * n * n);
+    vector<Vector3d> vertices;
+    vector<MeshIndex> triangles;
+    IsoEdgeVertexMap edges;
+    int corner[8], in[4], out[4], ni, no;
+    MeshIndex v[4];
+
+    container->ComputeBBox(box);
+    step = Vector3d(box.size) / resolution;
+
+    for (int z = 0, i = 0; z < n; z++)
+    {
+        for (int y = 0; y < n; y++)
+        {
+            for (int x = 0; x < n; x++, i++)
+            {
+                points[i] = Vector3d(box.lowerLeft[X] + x * step[X],
+                                     box.lowerLeft[Y] + y * step[Y],
+                                     box.lowerLeft[Z] + z * step[Z]);
+                outside[i] = !container->Inside(points[i]);
+                values[i] = EvaluatePolarized(fn, points[i]);
+            }
+        }
+    }
+
+    for (int z = 0; z < resolution; z++)
+    {
+        for (int y = 0; y < resolution; y++)
+        {
+            for (int x = 0; x < resolution; x++)
+            {
+                for (int k = 0; k < 8; k++)
+                    corner[k] = ((z + kIsoCellCorner[k][Z]) * n + y + kIsoCellCorner[k][Y]) * n + x + kIsoCellCorner[k][X];
+
+                for (int tet = 0; tet < 6; tet++)
+                {
+                    ni = no = 0;
+                    for (int k = 0; k < 4; k++)
+                    {
+                        int c = corner[kIsoCellTetrahedra[tet][k]];
+
+                        if ((closed == false) && outside[c])
+                            break;
+
+                        if (!outside[c] && (values[c] < 0.0))
+                            in[ni++] = c;
+                        else
+                            out[no++] = c;
+                    }
+
+                    if ((ni + no < 4) || (ni == 0) || (no == 0))
+                        continue;
+
+                    if (ni == 1)
+                    {
+                        for (int k = 0; k < 3; k++)
+                            triangles.push_back(IsoEdgeVertex(in[0], out[k], points, values, outside, edges, vertices));
+                    }
+                    else if (ni == 3)
+                    {
+                        for (int k = 0; k < 3; k++)
+                            triangles.push_back(IsoEdgeVertex(out[0], in[k], points, values, outside, edges, vertices));
+                    }
+                    else
+                    {
+                        v[0] = IsoEdgeVertex(in[0], out[0], points, values, outside, edges, vertices);
+                        v[1] = IsoEdgeVertex(in[0], out[1], points, values, outside, edges, vertices);
+                        v[2] = IsoEdgeVertex(in[1], out[1], points, values, outside, edges, vertices);
+                        v[3] = IsoEdgeVertex(in[1], out[0], points, values, outside, edges, vertices);
+
+                        triangles.push_back(v[0]); triangles.push_back(v[1]); triangles.push_back(v[2]);
+                        triangles.push_back(v[0]); triangles.push_back(v[2]); triangles.push_back(v[3]);
+                    }
+                }
+            }
+        }
+    }
+
+    delete secondaryMesh;
+    secondaryMesh = new Mesh();
+
+    if (!secondaryMesh->Init_From_Triangles(vertices, vector<Vector2d>(), triangles))
+    {
+        delete secondaryMesh;
+        secondaryMesh = nullptr;
+        return false;
+    }
+
+    if (Trans != nullptr)
+        secondaryMesh->Transform(Trans);
+
+    // the mesh may be off the surface by up to about a cell's diagonal
+    secondaryTolerance = step.length();
+
+    return true;
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   IsoSurface::Secondary_Mesh_Intersections
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Intersect a ray with the tessellated isosurface. Hits close to the ray's
+*   origin are ignored, as rays leaving the exact surface would otherwise hit
+*   the mesh right away. The hits are reported as hits on the isosurface, so
+*   that its own texture is used and the normal is taken from the function.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+bool IsoSurface::Secondary_Mesh_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    Vector3d Dlocal;
+    DBL minDepth;
+    bool found = false;
+
+    if (Trans != nullptr)
+        MInvTransDirection(Dlocal, ray.Direction, Trans);
+    else
+        Dlocal = ray.Direction;
+
+    minDepth = secondaryTolerance / Dlocal.length();
+
+    IStack Local_Stack(Thread->stackPool);
+    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+
+    secondaryMesh->All_Intersections(ray, Local_Stack, Thread);
+
+    while (Local_Stack->size() > 0)
+    {
+        const Intersection& Local = Local_Stack->top();
+
+        if ((Local.Depth > minDepth) && (Clip.empty() || Point_In_Clip(Local.IPoint, Clip, Thread)))
+        {
+            Depth_Stack->push(Intersection(Local.Depth, Local.IPoint, this, 0, 0));
+            found = true;
+        }
+
+        Local_Stack->pop();
+    }
+
+    return found;
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   IsoSurface::Compute_Tight_BBox
+*
+* INPUT
+*
+*   Thread - Thread data used to evaluate the function
+*
+* OUTPUT
+*
+*   box    - Bounding box in world co-ordinates
+*
+* RETURNS
+*
+*   bool - false if the container's bounding box could not be improved upon
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Bound the parts of the container that may be inside or on the surface,
+*   by recursively subdividing the container's bounding box and dropping the
+*   cells where interval evaluation shows the function to be on the outside
+*   of the threshold throughout. The result is padded by the accuracy, as
+*   the root solver may report hits that far off the surface, and by the
+*   secondary mesh's tolerance if there is one, as the mesh may stray from
+*   the surface by up to a grid cell.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+bool IsoSurface::Compute_Tight_BBox(BoundingBox& box, TraceThreadData *Thread) const
+{
+    GenericScalarFunctionInstance fn(Function, Thread);
+    Vector3d lo, hi, Min(BOUND_HUGE), Max(-BOUND_HUGE);
+    DBL pad;
+
+    container->ComputeBBox(box);
+    Make_min_max_from_BBox(lo, hi, box);
+
+    if (!Tight_BBox_Cell(fn, lo, hi, ISO_TIGHT_BBOX_DEPTH, Min, Max))
+        return false;
+
+    // no part of the container may be inside; leave it to the regular bounding
+    if ((Min[X] > Max[X]) || (Min[Y] > Max[Y]) || (Min[Z] > Max[Z]))
+        return false;
+
+    pad = accuracy;
+    if (secondaryMesh != nullptr)
+        pad = max(pad, secondaryTolerance);
+
+    Min -= Vector3d(pad);
+    Max += Vector3d(pad);
+    Min = max(Min, lo);
+    Max = min(Max, hi);
+
+    if ((Min[X] <= lo[X]) && (Min[Y] <= lo[Y]) && (Min[Z] <= lo[Z]) &&
+        (Max[X] >= hi[X]) && (Max[Y] >= hi[Y]) && (Max[Z] >= hi[Z]))
+        return false;
+
+    Make_BBox_from_min_max(box, Min, Max);
+
+    if (Trans != nullptr)
+        Recompute_BBox(&box, Trans);
+
+    return true;
+}
+
+bool IsoSurface::Tight_BBox_Cell(GenericScalarFunctionInstance& fn, const Vector3d& lo, const Vector3d& hi, int depth, Vector3d& Min, Vector3d& Max) const
+{
+    DBL flo, fhi, lower, upper;
+    Vector3d mid, clo, chi;
+
+    // nothing to learn from cells already within the box found so far
+    if ((lo[X] >= Min[X]) && (lo[Y] >= Min[Y]) && (lo[Z] >= Min[Z]) &&
+        (hi[X] <= Max[X]) && (hi[Y] <= Max[Y]) && (hi[Z] <= Max[Z]))
+        return true;
+
+    if (!fn.EvaluateInterval(*lo, *hi, 3, flo, fhi))
+        return false;
+
+    // bounds of the polarized function, which is negative inside
+    if (positivePolarity)
+    {
+        lower = threshold - fhi;
+        upper = threshold - flo;
+    }
+    else
+    {
+        lower = flo - threshold;
+        upper = fhi - threshold;
+    }
+
+    if (lower > 0.0)
+        return true;
+
+    if ((upper < 0.0) || (depth == 0))
+    {
+        Min = min(Min, lo);
+        Max = max(Max, hi);
+        return true;
+    }
+
+    mid = 0.5 * (lo + hi);
+
+    for (int k = 0; k < 8; k++)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            clo[i] = (k & (1 << i)) ? mid[i] : lo[i];
+            chi[i] = (k & (1 << i)) ? hi[i] : mid[i];
+        }
+
+        if (!Tight_BBox_Cell(fn, clo, chi, depth - 1, Min, Max))
+            return false;
+    }
+
+    return true;
+}
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -832,6 +1435,7 @@ void IsoSurface::Compute_BBox()
 bool IsoSurface::Function_Find_Root(ISO_ThreadData& itd, const Vector3d& PP, const Vector3d& DD, DBL* Depth1, DBL* Depth2, DBL& maxg, bool in_shadow_test, TraceThreadData* pThreadData)
 {
     DBL dt, t21, l_b, l_e, oldmg;
+    DBL t[2], f[2];
     ISO_Pair EP1, EP2;
     Vector3d VTmp;
 
@@ -860,16 +1464,20 @@ bool IsoSurface::Function_Find_Root(ISO_ThreadData& itd, const Vector3d& PP, con
 
     itd.cache = false;
     EP1.t = *Depth1;
-    EP1.f = Float_Function(itd, *Depth1);
+    EP2.t = *Depth2;
+    t[0] = *Depth1;
+    t[1] = *Depth2;
+    Float_Functions(itd, t, 2, f);
+    EP1.f = f[0];
+    EP2.f = f[1];
     itd.fmax = EP1.f;
     if((closed == false) && (EP1.f < 0.0))
     {
         itd.Inv3 *= -1;
         EP1.f *= -1;
+        EP2.f *= -1;
     }
 
-    EP2.t = *Depth2;
-    EP2.f = Float_Function(itd, *Depth2);
     itd.fmax = min(EP2.f, itd.fmax);
 
     oldmg = maxg;
@@ -877,20 +1485,14 @@ bool IsoSurface::Function_Find_Root(ISO_ThreadData& itd, const Vector3d& PP, con
     if((eval == true) && (oldmg > eval_param[0]))
         maxg = oldmg * eval_param[2];
     dt = maxg * itd.Vlength * t21;
-    if(Function_Find_Root_R(itd, &EP1, &EP2, dt, t21, 1.0 / (itd.Vlength * t21), maxg, pThreadData))
+    if(Function_Find_Root_R(itd, &EP1, &EP2, dt, t21, 1.0 / (itd.Vlength * t21), maxg, pThreadData, nullptr))
     {
         if(eval == true)
         {
-            DBL curvar = fabs(maxg - oldmg);
-
-            if(curvar > mginfo->eval_var)
-                mginfo->eval_var = curvar;
-
-            mginfo->eval_cnt++;
-            mginfo->eval_gradient_sum += maxg;
-
-            if(maxg > mginfo->eval_max)
-                mginfo->eval_max = maxg;
+            AtomicMax(mginfo->eval_var, fabs(maxg - oldmg));
+            AtomicAdd(mginfo->eval_cnt, 1.0);
+            AtomicAdd(mginfo->eval_gradient_sum, maxg);
+            AtomicMax(mginfo->eval_max, maxg);
         }
 
         *Depth1 = itd.tl;
@@ -928,7 +1530,18 @@ bool IsoSurface::Function_Find_Root(ISO_ThreadData& itd, const Vector3d& PP, con
 *
 * DESCRIPTION
 *
-*   -
+*   Bisects the interval between EP1 and EP2. If pMid is not NULL, it holds
+*   the function's value at the interval's midpoint, evaluated in advance.
+*
+*   Whenever the midpoint is evaluated, and the halves are long enough to be
+*   bisected in turn, their midpoints are evaluated along with it in a single
+*   batch, as there is a good chance they will be needed.
+*
+*   Where the function can be bounded over the interval using interval
+*   arithmetic, the interval is only bisected if the bounds allow for a
+*   root. Otherwise, max_gradient is used to decide whether the function can
+*   reach zero between the end points. With evaluate, the gradient learned
+*   in the grid cells the interval passes through is used instead.
 *
 * CHANGES
 *
@@ -936,19 +1549,28 @@ bool IsoSurface::Function_Find_Root(ISO_ThreadData& itd, const Vector3d& PP, con
 *
 ******************************************************************************/
 
-bool IsoSurface::Function_Find_Root_R(ISO_ThreadData& itd, const ISO_Pair* EP1, const ISO_Pair* EP2, DBL dt, DBL t21, DBL len, DBL& maxg, TraceThreadData* pThreadData)
+bool IsoSurface::Function_Find_Root_R(ISO_ThreadData& itd, const ISO_Pair* EP1, const ISO_Pair* EP2, DBL dt, DBL t21, DBL len, DBL& maxg, TraceThreadData* pThreadData, const DBL* pMid)
 {
     ISO_Pair EPa;
-    DBL temp;
+    DBL temp, lower, regional;
+    DBL t[3], f[3];
+    bool ahead, root;
 
     temp = fabs((EP2->f - EP1->f) * len);
-    if(gradient < temp)
-        gradient = temp;
+    AtomicMax(mginfo->gradient, temp);
 
-    if((eval == true) && (maxg < temp * eval_param[1]))
+    if(eval == true)
     {
-        maxg = temp * eval_param[1] * eval_param[1];
-        dt = maxg * itd.Vlength * t21;
+        regional = Region_Gradient(itd, EP1->t, EP2->t);
+        if(regional > eval_param[0])
+            regional *= eval_param[2];
+        if(regional < temp * eval_param[1])
+        {
+            regional = temp * eval_param[1] * eval_param[1];
+            Raise_Region_Gradient(itd, EP1->t, EP2->t, regional);
+        }
+        maxg = max(maxg, regional);
+        dt = regional * itd.Vlength * t21;
     }
 
     if(t21 < accuracy)
@@ -962,16 +1584,39 @@ bool IsoSurface::Function_Find_Root_R(ISO_ThreadData& itd, const ISO_Pair* EP1,
             return false;
     }
 
-    if((EP1->f + EP2->f - dt) < 0)
+    if(Interval_Function(itd, EP1->t, EP2->t, lower))
+        root = (lower < 0.0);
+    else
+        root = ((EP1->f + EP2->f - dt) < 0);
+
+    if(root)
     {
         t21 *= 0.5;
         dt *= 0.5;
         EPa.t = EP1->t + t21;
-        EPa.f = Float_Function(itd, EPa.t);
+
+        // evaluate the midpoints of the halves ahead if these are long enough to be bisected
+        ahead = (t21 >= accuracy);
+        t[0] = EPa.t;
+        t[1] = EP1->t + t21 * 0.5;
+        t[2] = EPa.t + t21 * 0.5;
+        if(pMid != nullptr)
+        {
+            EPa.f = *pMid;
+            if(ahead)
+                Float_Functions(itd, &t[1], 2, &f[1]);
+        }
+        else if(ahead)
+        {
+            Float_Functions(itd, t, 3, f);
+            EPa.f = f[0];
+        }
+        else
+            EPa.f = Float_Function(itd, EPa.t);
 
         itd.fmax = min(EPa.f, itd.fmax);
-        if(!Function_Find_Root_R(itd, EP1, &EPa, dt, t21, len * 2.0, maxg, pThreadData))
-            return (Function_Find_Root_R(itd, &EPa, EP2, dt, t21, len * 2.0,maxg, pThreadData));
+        if(!Function_Find_Root_R(itd, EP1, &EPa, dt, t21, len * 2.0, maxg, pThreadData, ahead ? &f[1] : nullptr))
+            return (Function_Find_Root_R(itd, &EPa, EP2, dt, t21, len * 2.0,maxg, pThreadData, ahead ? &f[2] : nullptr));
         else
             return true;
     }
@@ -1015,6 +1660,54 @@ DBL IsoSurface::Float_Function(ISO_ThreadData& itd, DBL t) const
     return ((DBL)itd.Inv3 * EvaluatePolarized (*itd.pFn, VTmp));
 }
 
+void IsoSurface::Float_Functions(ISO_ThreadData& itd, const DBL* t, unsigned int count, DBL* f) const
+{
+    DBL args[3 * 3];
+
+    POV_ASSERT(count <= 3);
+
+    for(unsigned int i = 0; i < count; i++)
+    {
+        args[i * 3 + X] = itd.Pglobal[X] + t[i] * itd.Dglobal[X];
+        args[i * 3 + Y] = itd.Pglobal[Y] + t[i] * itd.Dglobal[Y];
+        args[i * 3 + Z] = itd.Pglobal[Z] + t[i] * itd.Dglobal[Z];
+    }
+
+    itd.pFn->EvaluateBatch(args, 3, count, f);
+
+    for(unsigned int i = 0; i < count; i++)
+    {
+        if (positivePolarity)
+            f[i] = (DBL)itd.Inv3 * (threshold - f[i]);
+        else
+            f[i] = (DBL)itd.Inv3 * (f[i] - threshold);
+    }
+}
+
+bool IsoSurface::Interval_Function(ISO_ThreadData& itd, DBL t1, DBL t2, DBL& lower) const
+{
+    DBL lo[3], hi[3];
+    DBL flo, fhi;
+
+    for(unsigned int i = 0; i < 3; i++)
+    {
+        lo[i] = itd.Pglobal[i] + t1 * itd.Dglobal[i];
+        hi[i] = itd.Pglobal[i] + t2 * itd.Dglobal[i];
+        if(lo[i] > hi[i])
+            std::swap(lo[i], hi[i]);
+    }
+
+    if(!itd.pFn->EvaluateInterval(lo, hi, 3, flo, fhi))
+        return false;
+
+    if (positivePolarity)
+        lower = (itd.Inv3 > 0) ? (threshold - fhi) : (flo - threshold);
+    else
+        lower = (itd.Inv3 > 0) ? (flo - threshold) : (threshold - fhi);
+
+    return true;
+}
+
 
 /*****************************************************************************/
 
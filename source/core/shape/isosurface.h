@@ -83,6 +83,7 @@ typedef unsigned char IsosurfaceMaxTrace;
 struct ISO_Pair { DBL t,f; };
 
 struct ISO_Max_Gradient;
+class Mesh;
 
 struct ISO_ThreadData
 {
@@ -102,8 +103,7 @@ class IsoSurface : public ObjectBase
     public:
 
         GenericScalarFunctionPtr Function;
-        volatile DBL max_gradient; // modified during render if `eval` is set
-        DBL gradient;
+        DBL max_gradient;
         DBL threshold;
         DBL accuracy;
         DBL eval_param[3];
@@ -114,6 +114,9 @@ class IsoSurface : public ObjectBase
 
         shared_ptr<ContainedByShape> container;
 
+        Mesh *secondaryMesh;        ///< Approximation used for shadow, radiosity and photon rays, or `nullptr`.
+        DBL secondaryTolerance;     ///< Distance from the ray origin within which hits on @ref secondaryMesh are ignored.
+
         IsoSurface();
         virtual ~IsoSurface();
 
@@ -131,18 +134,46 @@ class IsoSurface : public ObjectBase
 
         virtual void DispatchShutdownMessages(GenericMessenger& messenger);
 
+        /// Tessellate the isosurface into a mesh to use for shadow, radiosity and photon rays.
+        ///
+        /// @param  resolution  Number of grid cells along each axis of the container.
+        /// @return             `false` if no surface was found.
+        ///
+        bool Build_Secondary_Mesh(int resolution, TraceThreadData *Thread);
+
+        /// Compute a bounding box for the parts of the container that may be inside or on the surface.
+        ///
+        /// The container is subdivided where interval evaluation of the function cannot rule out the
+        /// surface, and the cells it can rule out are dropped, so the result is conservative.
+        ///
+        /// @param[out] box     Bounding box in world co-ordinates.
+        /// @return             `false` if the function does not support interval evaluation, or
+        ///                     no part of the container could be ruled out.
+        ///
+        bool Compute_Tight_BBox(BoundingBox& box, TraceThreadData *Thread) const;
+
     protected:
+        bool Secondary_Mesh_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread);
+
         bool Function_Find_Root(ISO_ThreadData& itd, const Vector3d&, const Vector3d&, DBL*, DBL*, DBL& max_gradient, bool in_shadow_test, TraceThreadData* pThreadData);
-        bool Function_Find_Root_R(ISO_ThreadData& itd, const ISO_Pair*, const ISO_Pair*, DBL, DBL, DBL, DBL& max_gradient, TraceThreadData* pThreadData);
+        bool Function_Find_Root_R(ISO_ThreadData& itd, const ISO_Pair*, const ISO_Pair*, DBL, DBL, DBL, DBL& max_gradient, TraceThreadData* pThreadData, const DBL* pMid);
+
+        void Init_Gradient_Grid();
+        void Gradient_Cells(const ISO_ThreadData& itd, DBL t1, DBL t2, int *lo, int *hi) const;
+        DBL Region_Gradient(const ISO_ThreadData& itd, DBL t1, DBL t2) const;
+        void Raise_Region_Gradient(const ISO_ThreadData& itd, DBL t1, DBL t2, DBL g) const;
 
         inline DBL Float_Function(ISO_ThreadData& itd, DBL t) const;
+        void Float_Functions(ISO_ThreadData& itd, const DBL* t, unsigned int count, DBL* f) const;
+        bool Interval_Function(ISO_ThreadData& itd, DBL t1, DBL t2, DBL& lower) const;
+        bool Tight_BBox_Cell(GenericScalarFunctionInstance& fn, const Vector3d& lo, const Vector3d& hi, int depth, Vector3d& Min, Vector3d& Max) const;
         inline DBL EvaluateAbs (GenericScalarFunctionInstance& fn, Vector3d& p) const;
         inline DBL EvaluatePolarized (GenericScalarFunctionInstance& fn, Vector3d& p) const;
         inline bool IsInside (GenericScalarFunctionInstance& fn, Vector3d& p) const;
 
     private:
 
-        intrusive_ptr<ISO_Max_Gradient> mginfo; // global, but just a statistic (read: not thread safe but we don't care) [trf]
+        intrusive_ptr<ISO_Max_Gradient> mginfo; ///< Gradients found during render, shared by all copies.
 };
 
 /// @}
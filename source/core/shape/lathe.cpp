@@ -281,10 +281,8 @@ bool Lathe::Intersect(const BasicRay& ray, IStack& Depth_Stack, TraceThreadData
 
     // Intersect all cylindrical bounds.
     vector<BCYL_INT>& intervals = Thread->BCyl_Intervals;
-    vector<BCYL_INT>& rint = Thread->BCyl_RInt;
-    vector<BCYL_INT>& hint = Thread->BCyl_HInt;
 
-    if((cnt = Intersect_BCyl(Spline->BCyl, intervals, rint, hint, P, D)) == 0)
+    if((cnt = Intersect_BCyl(Spline->BCyl, intervals, P, D)) == 0)
         return false;
 
     #ifdef LATHE_EXTRA_STATS
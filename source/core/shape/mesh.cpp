@@ -48,6 +48,16 @@
 *      triangle { <CORNER1>, <CORNER2>, <CORNER3>, texture { NAME } }
 *      smooth_triangle { <CORNER1>, <NORMAL1>, <CORNER2>, <NORMAL2>, <CORNER3>, <NORMAL3>, texture { NAME } }
 *      ...
+*      [ compact ]
+*      [ save_file FILE_NAME ]
+*      [ hierarchy FLAG ]
+*    }
+*
+*    mesh2
+*    {
+*      load_file FILE_NAME
+*      [ texture_list { ... } ]
+*      [ inside_vector <DIRECTION> ]
 *      [ hierarchy FLAG ]
 *    }
 *
@@ -61,8 +71,15 @@
 #include "core/shape/mesh.h"
 
 #include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cstring>
 #include <limits>
+#include <map>
 
+#include <boost/bind.hpp>
+
+#include "base/memoryaccounting.h"
 #include "base/pov_err.h"
 
 #include "core/bounding/boundingbox.h"
@@ -90,6 +107,94 @@ const int HASH_SIZE = 1000;
 
 const int INITIAL_NUMBER_OF_ENTRIES = 256;
 
+/// Safety factor applied to the rounding error estimate of the triangle pack test.
+const DBL PACK_ERROR_FACTOR = 32.0;
+
+/// Largest quantised vertex coordinate of a compact mesh.
+const DBL MESH_QUANTISATION_STEPS = 65535.0;
+
+/// Scale of the octahedral normal encoding of a compact mesh.
+const DBL MESH_OCT_NORMAL_SCALE = 32767.0;
+
+/// Identification of a binary mesh file.
+const char MESH_FILE_MAGIC[8] = { 'P', 'O', 'V', 'M', 'E', 'S', 'H', 0 };
+
+/// Version of the binary mesh file format.
+const unsigned int MESH_FILE_VERSION = 1;
+
+/// Marker to recognize binary mesh files written with a different byte order.
+const unsigned int MESH_FILE_BYTE_ORDER = 0x01020304;
+
+/// Alignment of the sections of a binary mesh file.
+const size_t MESH_FILE_ALIGNMENT = 16;
+
+/// Flag of a binary mesh file's header: The mesh has an inside vector.
+const unsigned int MESH_FILE_INSIDE_VECTOR = 1;
+
+/// Flag of a binary mesh file's header: All triangles of the mesh are textured.
+const unsigned int MESH_FILE_FULLY_TEXTURED = 2;
+
+/// Maximum depth of the bounding box tree accepted from a binary mesh file.
+/// The trees are walked recursively, so a damaged file must not make them arbitrarily deep.
+const int MESH_FILE_MAX_TREE_DEPTH = 256;
+
+/// Smallest number of triangles for which a mesh's tree is built on a worker thread.
+const MeshIndex MESH_DEFERRED_BUILD_MIN_TRIANGLES = 4096;
+
+
+
+/*****************************************************************************
+* Local typedefs
+******************************************************************************/
+
+/// Header of a binary mesh file.
+///
+/// The header is followed by the vertices, normals, UV coordinates and triangles of the mesh,
+/// then the nodes of its bounding box tree in pre-order, and finally the triangle packs
+/// referenced by the tree's leaves. Each of these sections starts at a multiple of
+/// @ref MESH_FILE_ALIGNMENT bytes, and all data is in the in-memory layout of the platform.
+///
+struct Mesh_File_Header
+{
+    char Magic[8];                  ///< @ref MESH_FILE_MAGIC.
+    unsigned int Version;           ///< @ref MESH_FILE_VERSION.
+    unsigned int Byte_Order;        ///< @ref MESH_FILE_BYTE_ORDER.
+    unsigned int Vector_Size;       ///< Size of @ref MeshVector.
+    unsigned int UV_Size;           ///< Size of @ref MeshUVVector.
+    unsigned int Triangle_Size;     ///< Size of @ref MESH_TRIANGLE.
+    unsigned int Node_Size;         ///< Size of @ref Mesh_File_Node.
+    unsigned int Flags;             ///< Combination of the `MESH_FILE_*` flags.
+    MeshIndex Number_Of_Vertices;
+    MeshIndex Number_Of_Normals;
+    MeshIndex Number_Of_UVCoords;
+    MeshIndex Number_Of_Triangles;
+    MeshIndex Number_Of_Textures;   ///< Number of textures referenced by the triangles.
+    MeshIndex Number_Of_Nodes;      ///< Number of bounding box tree nodes, zero if there is no tree.
+    MeshIndex Number_Of_Packs;
+    unsigned int Reserved;
+    DBL Inside_Vect[3];
+};
+
+/// Node of the bounding box tree in a binary mesh file.
+struct Mesh_File_Node
+{
+    BoundingBox BBox;
+    int Entries;                    ///< Number of children, which follow the node; zero for a leaf.
+    MeshIndex Pack;                 ///< Index of a leaf's triangle pack.
+};
+
+/// Triangle pack in a binary mesh file.
+struct Mesh_File_Pack
+{
+    MeshIndex Triangles[4];         ///< Indices of the triangles in the pack, `-1` for unused entries.
+};
+
+/// Offsets of the sections of a binary mesh file.
+struct Mesh_File_Layout
+{
+    size_t Vertices, Normals, UVCoords, Triangles, Nodes, Packs, Size;
+};
+
 
 
 /*****************************************************************************
@@ -99,6 +204,20 @@ const int INITIAL_NUMBER_OF_ENTRIES = 256;
 HASH_TABLE **Mesh::Vertex_Hash_Table;
 HASH_TABLE **Mesh::Normal_Hash_Table;
 UV_HASH_TABLE **Mesh::UV_Hash_Table;
+MemoryArena Mesh::Hash_Arena(kMemoryParser);
+
+/*****************************************************************************
+* Static functions
+******************************************************************************/
+
+static unsigned int test_triangle_pack(const BasicRay& ray, const MESH_TRIANGLE_PACK *Pack);
+static Vector3d derive_triangle_normal(const Vector3d& P1, const Vector3d& P2, const Vector3d& P3, bool Swapped);
+static MeshOctNormal encode_normal(const Vector3d& N);
+static void mesh_file_layout(const Mesh_File_Header& Header, Mesh_File_Layout& Layout);
+static size_t mesh_file_section(size_t& Offset, size_t Size);
+static bool write_mesh_file_section(OStream& stream, size_t& Position, size_t Offset, const void *Section, size_t Size);
+static void collect_bbox_nodes(const BBOX_TREE *Node, const MESH_TRIANGLE_PACK *Packs, vector<Mesh_File_Node>& Nodes);
+static BBOX_TREE *restore_bbox_node(const Mesh_File_Node *Nodes, MeshIndex Number_Of_Nodes, MeshIndex& Next, int Depth, vector<BBOX_TREE *>& Leaves);
 
 /*****************************************************************************
 *
@@ -196,10 +315,14 @@ bool Mesh::Intersect(const BasicRay& ray, IStack& Depth_Stack, TraceThreadData *
     {
         /* There's no bounding hierarchy so just step through all elements. */
 
+        Thread->Stats()[Ray_Mesh_Triangle_Tests] += Data->Number_Of_Triangles;
+
         for (i = 0; i < Data->Number_Of_Triangles; i++)
         {
             if (intersect_mesh_triangle(New_Ray, &Data->Triangles[i], &t))
             {
+                Thread->Stats()[Ray_Mesh_Triangle_Tests_Succeeded]++;
+
                 if (test_hit(&Data->Triangles[i], ray, t, len, Depth_Stack, Thread))
                 {
                     found = true;
@@ -359,7 +482,7 @@ void Mesh::Normal(Vector3d& Result, Intersection *Inter, TraceThreadData *Thread
     }
     else
     {
-        Result = Vector3d(Data->Normals[Triangle->Normal_Ind]);
+        get_triangle_normal(Triangle, Result);
 
         if (Trans != nullptr)
         {
@@ -403,11 +526,12 @@ void Mesh::Smooth_Mesh_Normal(Vector3d& Result, const MESH_TRIANGLE *Triangle, c
     int axis;
     DBL u, v;
     DBL k1, k2, k3;
-    Vector3d PIMinusP1, N1, N2, N3;
+    Vector3d PIMinusP1, N1, N2, N3, P1, P2, P3;
 
     get_triangle_normals(Triangle, N1, N2, N3);
+    get_triangle_vertices(Triangle, P1, P2, P3);
 
-    PIMinusP1 = IPoint - Vector3d(Data->Vertices[Triangle->P1]);
+    PIMinusP1 = IPoint - P1;
 
     u = dot(PIMinusP1, Vector3d(Triangle->Perp));
 
@@ -419,9 +543,9 @@ void Mesh::Smooth_Mesh_Normal(Vector3d& Result, const MESH_TRIANGLE *Triangle, c
     {
         axis = Triangle->vAxis;
 
-        k1 = Data->Vertices[Triangle->P1][axis];
-        k2 = Data->Vertices[Triangle->P2][axis];
-        k3 = Data->Vertices[Triangle->P3][axis];
+        k1 = P1[axis];
+        k2 = P2[axis];
+        k3 = P3[axis];
 
         v = (PIMinusP1[axis] / u + k1 - k2) / (k3 - k2);
 
@@ -716,15 +840,42 @@ Mesh::~Mesh()
         POV_FREE(Textures);
     }
 
-    if (--(Data->References) == 0)
+    if ((Data != nullptr) && (--(Data->References) == 0))
     {
         Destroy_BBox_Tree(Data->Tree);
 
+        if (Data->Packs != nullptr)
+        {
+            POV_FREE(Data->Packs);
+        }
+
+        if (Data->Pack_Geometry != nullptr)
+        {
+            POV_FREE(Data->Pack_Geometry);
+        }
+
+        /* The arrays of a mapped binary mesh file are released with the file. */
+
+        if (Data->File != nullptr)
+        {
+            delete Data->File;
+
+            Data->Normals   = nullptr;
+            Data->UVCoords  = nullptr;
+            Data->Vertices  = nullptr;
+            Data->Triangles = nullptr;
+        }
+
         if (Data->Normals != nullptr)
         {
             POV_FREE(Data->Normals);
         }
 
+        if (Data->QNormals != nullptr)
+        {
+            POV_FREE(Data->QNormals);
+        }
+
         /* NK 1998 */
         if (Data->UVCoords != nullptr)
         {
@@ -737,11 +888,18 @@ Mesh::~Mesh()
             POV_FREE(Data->Vertices);
         }
 
+        if (Data->QVertices != nullptr)
+        {
+            POV_FREE(Data->QVertices);
+        }
+
         if (Data->Triangles != nullptr)
         {
             POV_FREE(Data->Triangles);
         }
 
+        MemoryAccounting::Release(kMemoryGeometry, Data->Accounted_Size);
+
         POV_FREE(Data);
     }
 }
@@ -796,6 +954,69 @@ void Mesh::Compute_BBox()
     }
 
     Make_BBox_from_min_max(BBox, mins, maxs);
+
+    account_data();
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   account_data
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+* DESCRIPTION
+*
+*   Bring the memory accounted for the mesh data up to date. Arrays mapped
+*   from a binary mesh file are not accounted for, and neither are the nodes
+*   of the bounding box tree.
+*
+*   The data may be shared with copies of the mesh being processed on other
+*   threads; as each update accounts for the difference to the size last
+*   accounted for, the totals remain consistent regardless.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void Mesh::account_data()
+{
+    size_t Size = sizeof(MESH_DATA) + Data->Number_Of_Packs * sizeof(MESH_TRIANGLE_PACK);
+
+    if (Data->Pack_Geometry != nullptr)
+    {
+        Size += Data->Number_Of_Packs * sizeof(MESH_PACK_GEOMETRY);
+    }
+
+    if (Data->File == nullptr)
+    {
+        Size += Data->Number_Of_Triangles * sizeof(MESH_TRIANGLE) +
+                Data->Number_Of_UVCoords * sizeof(MeshUVVector);
+        Size += Data->Number_Of_Vertices * ((Data->QVertices != nullptr) ? sizeof(MeshQVector) : sizeof(MeshVector));
+        Size += Data->Number_Of_Normals * ((Data->QNormals != nullptr) ? sizeof(MeshOctNormal) : sizeof(MeshVector));
+    }
+
+    size_t Previous = Data->Accounted_Size.exchange(Size);
+
+    if (Size > Previous)
+    {
+        MemoryAccounting::Allocate(kMemoryGeometry, Size - Previous);
+    }
+    else
+    {
+        MemoryAccounting::Release(kMemoryGeometry, Previous - Size);
+    }
 }
 
 
@@ -933,6 +1154,8 @@ bool Mesh::Compute_Mesh_Triangle(MESH_TRIANGLE *Triangle, bool Smooth, const Vec
         pP2 = &P2;
     }
 
+    Triangle->Swapped = swap;
+
     if (Smooth)
     {
     //  compute_smooth_triangle(Triangle, *pP1, *pP2, P3);
@@ -1031,10 +1254,22 @@ void Mesh::compute_smooth_triangle(MESH_TRIANGLE *Triangle, const Vector3d& P1,
 bool Mesh::intersect_mesh_triangle(const BasicRay &ray, const MESH_TRIANGLE *Triangle, DBL *Depth) const
 {
     DBL NormalDotOrigin, NormalDotDirection;
-    DBL s, t;
+    DBL s, t, Distance;
     Vector3d P1, P2, P3, S_Normal;
 
-    S_Normal = Vector3d(Data->Normals[Triangle->Normal_Ind]);
+    if (Data->QVertices == nullptr)
+    {
+        S_Normal = Vector3d(Data->Normals[Triangle->Normal_Ind]);
+        Distance = Triangle->Distance;
+    }
+    else
+    {
+        /* Compact meshes derive the triangle's plane from its vertices. */
+
+        get_triangle_vertices(Triangle, P1, P2, P3);
+        S_Normal = derive_triangle_normal(P1, P2, P3, Triangle->Swapped);
+        Distance = -dot(S_Normal, P1);
+    }
 
     NormalDotDirection = dot(S_Normal, ray.Direction);
 
@@ -1045,14 +1280,17 @@ bool Mesh::intersect_mesh_triangle(const BasicRay &ray, const MESH_TRIANGLE *Tri
 
     NormalDotOrigin = dot(S_Normal, ray.Origin);
 
-    *Depth = -(Triangle->Distance + NormalDotOrigin) / NormalDotDirection;
+    *Depth = -(Distance + NormalDotOrigin) / NormalDotDirection;
 
     if ((*Depth < DEPTH_TOLERANCE) || (*Depth > MAX_DISTANCE))
     {
         return(false);
     }
 
-    get_triangle_vertices(Triangle, P1, P2, P3);
+    if (Data->QVertices == nullptr)
+    {
+        get_triangle_vertices(Triangle, P1, P2, P3);
+    }
 
     switch (Triangle->Dominant_Axis)
     {
@@ -1147,7 +1385,7 @@ void Mesh::MeshUV(const Vector3d& P, const MESH_TRIANGLE *Triangle, Vector2d& Re
     get_triangle_vertices(Triangle, P1, P2, P3);
     B[0] = P2 - P1;
     B[1] = P3 - P1;
-    B[2] = Vector3d(Data->Normals[Triangle->Normal_Ind]);
+    get_triangle_normal(Triangle, B[2]);
 
     if (!MInvers3(B, IB)) {
         // Failed to invert - that means this is a degenerate triangle
@@ -1265,6 +1503,7 @@ void Mesh::Init_Mesh_Triangle(MESH_TRIANGLE *Triangle)
 {
     Triangle->Smooth = false;
     Triangle->ThreeTex = false;
+    Triangle->Swapped = false;
     Triangle->Dominant_Axis = 0;
     Triangle->vAxis         = 0;
 
@@ -1338,6 +1577,165 @@ void Mesh::get_triangle_bbox(const MESH_TRIANGLE *Triangle, BoundingBox *BBox) c
 
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Compact_Mesh
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Convert the mesh to compact storage, see the declaration for details.
+*
+*   Setting up the triangles again from the quantised vertices keeps each
+*   triangle's data consistent with the vertices it shares with its
+*   neighbours, so that no gaps open up between them.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void Mesh::Compact_Mesh()
+{
+    MeshIndex i;
+    int k, a;
+    bool Swapped;
+    unsigned int Key;
+    Vector3d Lo(BOUND_HUGE), Hi(-BOUND_HUGE), P1, P2, P3, N;
+    MESH_TRIANGLE *Triangle;
+    MeshIndex *Index[3];
+    vector<MeshIndex> Remap;
+    vector<MeshOctNormal> Codes;
+    std::map<unsigned int, MeshIndex> Known;
+    std::map<unsigned int, MeshIndex>::iterator Found;
+
+    if ((Data->QVertices != nullptr) || (Data->File != nullptr))
+    {
+        return;
+    }
+
+    /* Quantise the vertices to a grid spanning the mesh. */
+
+    for (i = 0; i < Data->Number_Of_Vertices; i++)
+    {
+        Lo = min(Lo, Vector3d(Data->Vertices[i]));
+        Hi = max(Hi, Vector3d(Data->Vertices[i]));
+    }
+
+    Data->QOrigin = Lo;
+    Data->QScale = (Hi - Lo) / MESH_QUANTISATION_STEPS;
+
+    Data->QVertices = reinterpret_cast<MeshQVector *>(POV_MALLOC(max(Data->Number_Of_Vertices, MeshIndex(1)) * sizeof(MeshQVector), "triangle mesh data"));
+
+    for (i = 0; i < Data->Number_Of_Vertices; i++)
+    {
+        for (a = X; a <= Z; a++)
+        {
+            if (Data->QScale[a] > 0.0)
+                Data->QVertices[i].Coord[a] = (unsigned short)clip(floor((Data->Vertices[i][a] - Lo[a]) / Data->QScale[a] + 0.5), 0.0, MESH_QUANTISATION_STEPS);
+            else
+                Data->QVertices[i].Coord[a] = 0;
+        }
+    }
+
+    POV_FREE(Data->Vertices);
+    Data->Vertices = nullptr;
+
+    /*
+     * Encode the normals of smooth triangles, merging those that end up
+     * equal. Flat triangles' normals are dropped, as they are derived from
+     * the vertices from now on.
+     */
+
+    Remap.assign(Data->Number_Of_Normals, -1);
+
+    for (i = 0; i < Data->Number_Of_Triangles; i++)
+    {
+        Triangle = &Data->Triangles[i];
+
+        Index[0] = &Triangle->N1;
+        Index[1] = &Triangle->N2;
+        Index[2] = &Triangle->N3;
+
+        for (k = 0; k < 3; k++)
+        {
+            if (!Triangle->Smooth)
+            {
+                *Index[k] = -1;
+                continue;
+            }
+
+            if (Remap[*Index[k]] < 0)
+            {
+                MeshOctNormal Code = encode_normal(Vector3d(Data->Normals[*Index[k]]));
+
+                Key = ((unsigned int)(unsigned short)Code.U << 16) | (unsigned int)(unsigned short)Code.V;
+
+                Found = Known.find(Key);
+
+                if (Found == Known.end())
+                {
+                    Found = Known.insert(std::make_pair(Key, MeshIndex(Codes.size()))).first;
+                    Codes.push_back(Code);
+                }
+
+                Remap[*Index[k]] = Found->second;
+            }
+
+            *Index[k] = Remap[*Index[k]];
+        }
+
+        Triangle->Normal_Ind = -1;
+    }
+
+    POV_FREE(Data->Normals);
+    Data->Normals = nullptr;
+
+    Data->Number_Of_Normals = MeshIndex(Codes.size());
+    Data->QNormals = reinterpret_cast<MeshOctNormal *>(POV_MALLOC(max(Data->Number_Of_Normals, MeshIndex(1)) * sizeof(MeshOctNormal), "triangle mesh data"));
+
+    for (i = 0; i < Data->Number_Of_Normals; i++)
+    {
+        Data->QNormals[i] = Codes[i];
+    }
+
+    /* Set up the triangles again from the quantised vertices. */
+
+    for (i = 0; i < Data->Number_Of_Triangles; i++)
+    {
+        Triangle = &Data->Triangles[i];
+
+        get_triangle_vertices(Triangle, P1, P2, P3);
+
+        Swapped = Triangle->Swapped;
+
+        /*
+         * Any swap now further reverses the winding; triangles that have
+         * become degenerate keep their data, and are never hit as their
+         * derived normal is zero.
+         */
+
+        if (Compute_Mesh_Triangle(Triangle, Triangle->Smooth, P1, P2, P3, N))
+        {
+            Triangle->Swapped = (Swapped != bool(Triangle->Swapped));
+        }
+    }
+}
+
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1358,6 +1756,10 @@ void Mesh::get_triangle_bbox(const MESH_TRIANGLE *Triangle, BoundingBox *BBox) c
 *
 *   Create the bounding box hierarchy.
 *
+*   The hierarchy is built using the surface area heuristic, and its lowest
+*   levels are then collapsed into leaves holding packs of up to four
+*   triangles each.
+*
 * CHANGES
 *
 *   Feb 1995 : Creation. (Derived from the bounding slab creation code)
@@ -1366,21 +1768,32 @@ void Mesh::get_triangle_bbox(const MESH_TRIANGLE *Triangle, BoundingBox *BBox) c
 
 void Mesh::Build_Mesh_BBox_Tree()
 {
-    MeshIndex i, nElem, maxelements;
+    MeshIndex i, nElem;
     BBOX_TREE **Triangles;
+    BBOX_TREE *Tree = nullptr;
 
     if (!Test_Flag(this, HIERARCHY_FLAG))
     {
         return;
     }
 
+    /* Binary mesh files come with their tree. */
+
+    if ((Data->File != nullptr) && restore_bbox_tree())
+    {
+        return;
+    }
+
     nElem = Data->Number_Of_Triangles;
 
-    maxelements = 2 * nElem;
+    if (nElem == 0)
+    {
+        return;
+    }
 
     /* Now allocate an array to hold references to these elements. */
 
-    Triangles = reinterpret_cast<BBOX_TREE **>(POV_MALLOC(maxelements*sizeof(BBOX_TREE *), "mesh bbox tree"));
+    Triangles = reinterpret_cast<BBOX_TREE **>(POV_MALLOC(nElem*sizeof(BBOX_TREE *), "mesh bbox tree"));
 
     /* Init list with mesh elements. */
 
@@ -1395,12 +1808,54 @@ void Mesh::Build_Mesh_BBox_Tree()
         get_triangle_bbox(&Data->Triangles[i], &Triangles[i]->BBox);
     }
 
-    size_t maxfinitecount = 0;
-    Build_BBox_Tree(&Data->Tree, nElem, Triangles, 0, nullptr, maxfinitecount);
+    Build_BBox_Tree_SAH(&Tree, nElem, Triangles, 0, nullptr);
 
     /* Get rid of the Triangles array. */
 
     POV_FREE(Triangles);
+
+    /* Collapse the lowest levels of the tree into triangle packs. */
+
+    vector<BBOX_TREE *> Leaves;
+    vector<const MESH_TRIANGLE *> Members;
+
+    build_triangle_packs(Tree, Leaves, Members);
+
+    Data->Number_Of_Packs = MeshIndex(Leaves.size());
+
+    Data->Packs = reinterpret_cast<MESH_TRIANGLE_PACK *>(POV_MALLOC(Leaves.size()*sizeof(MESH_TRIANGLE_PACK), "mesh bbox tree"));
+
+    /* Compact meshes do without the single precision copy of the packs. */
+
+    if (Data->QVertices == nullptr)
+    {
+        Data->Pack_Geometry = reinterpret_cast<MESH_PACK_GEOMETRY *>(POV_MALLOC(Leaves.size()*sizeof(MESH_PACK_GEOMETRY), "mesh bbox tree"));
+    }
+
+    for (i = 0; i < Data->Number_Of_Packs; i++)
+    {
+        int Count = 0;
+
+        while ((Count < 4) && (Members[4*i+Count] != nullptr))
+        {
+            Count++;
+        }
+
+        init_triangle_pack(&Data->Packs[i], (Data->Pack_Geometry != nullptr) ? &Data->Pack_Geometry[i] : nullptr, &Members[4*i], Count);
+
+        Leaves[i]->Node = reinterpret_cast<BBOX_TREE **>(&Data->Packs[i]);
+    }
+
+    /*
+     * The tree may be built on a worker thread (see MeshTreeBuilder), so
+     * publish it last; until then the mesh is simply tested without it.
+     */
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Data->Tree = Tree;
+
+    account_data();
 }
 
 
@@ -1409,57 +1864,452 @@ void Mesh::Build_Mesh_BBox_Tree()
 *
 * FUNCTION
 *
-*   intersect_bbox_tree
+*   build_triangle_packs
 *
 * INPUT
 *
-*   Mesh     - Mesh object
-*   Ray      - Current ray
-*   Orig_Ray - Original, untransformed ray
-*   len      - Length of the transformed ray direction
+*   Node - Bounding box tree node
 *
 * OUTPUT
 *
-*   Depth_Stack - Stack of intersections
+*   Leaves  - List of leaves to hold the packs
+*   Members - Triangles of each pack, four entries per leaf
 *
 * RETURNS
 *
-*   bool - true if an intersection was found
-*
 * AUTHOR
 *
-*   Dieter Bayer
-*
 * DESCRIPTION
 *
-*   Intersect a ray with the bounding box tree of a mesh.
+*   Turn each node that has only triangles as children, and no more than
+*   four of them, into a leaf; any other triangle becomes a leaf of its own.
+*   Unused entries in the list of pack members are set to `nullptr`.
 *
 * CHANGES
 *
-*   Feb 1995 : Creation.
+*   -
 *
 ******************************************************************************/
 
-bool Mesh::intersect_bbox_tree(const BasicRay &ray, const BasicRay &Orig_Ray, DBL len, IStack& Depth_Stack, TraceThreadData *Thread)
+void Mesh::build_triangle_packs(BBOX_TREE *Node, vector<BBOX_TREE *>& Leaves, vector<const MESH_TRIANGLE *>& Members) const
 {
-    bool found;
-    MeshIndex i;
-    DBL Best, Depth;
-    const BBOX_TREE *Node, *Root;
-    bool OldStyle = has_inside_vector;
-
-    /* Create the direction vectors for this ray. */
-    Rayinfo rayinfo(ray);
+    short i;
+    bool bottom;
 
-    /* Start with an empty priority queue. */
-    Thread->Mesh_Queue.Clear();
-    found = false;
+    if (Node->Entries == 0)
+    {
+        Leaves.push_back(Node);
+        Members.push_back(reinterpret_cast<const MESH_TRIANGLE *>(Node->Node));
+        Members.resize(Members.size() + 3, nullptr);
+        return;
+    }
 
-    Best = BOUND_HUGE;
+    bottom = (Node->Entries <= 4);
 
-#ifdef BBOX_EXTRA_STATS
-    Thread->Stats()[totalQueueResets]++;
-#endif
+    for (i = 0; (i < Node->Entries) && bottom; i++)
+    {
+        bottom = (Node->Node[i]->Entries == 0);
+    }
+
+    if (!bottom)
+    {
+        for (i = 0; i < Node->Entries; i++)
+        {
+            build_triangle_packs(Node->Node[i], Leaves, Members);
+        }
+        return;
+    }
+
+    for (i = 0; i < Node->Entries; i++)
+    {
+        Members.push_back(reinterpret_cast<const MESH_TRIANGLE *>(Node->Node[i]->Node));
+        POV_FREE(Node->Node[i]);
+    }
+    Members.resize(Members.size() + 4 - Node->Entries, nullptr);
+
+    POV_FREE(Node->Node);
+
+    Node->Node = nullptr;
+    Node->Entries = 0;
+
+    Leaves.push_back(Node);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   restore_bbox_tree
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   bool - false if the mesh's binary mesh file has no usable tree
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Re-create the bounding box hierarchy stored in the mesh's binary mesh
+*   file, which is much faster than building it anew.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool Mesh::restore_bbox_tree()
+{
+    const char *Base;
+    const Mesh_File_Header *Header;
+    const Mesh_File_Node *Nodes;
+    const Mesh_File_Pack *Packs;
+    Mesh_File_Layout Layout;
+    vector<BBOX_TREE *> Leaves;
+    const MESH_TRIANGLE *Members[4];
+    BBOX_TREE *Tree;
+    MeshIndex i, Next;
+    int k, Count;
+    bool Complete;
+
+    Base = reinterpret_cast<const char *>(Data->File->GetData());
+    Header = reinterpret_cast<const Mesh_File_Header *>(Base);
+
+    if (Header->Number_Of_Nodes == 0)
+    {
+        return false;
+    }
+
+    mesh_file_layout(*Header, Layout);
+
+    Nodes = reinterpret_cast<const Mesh_File_Node *>(Base + Layout.Nodes);
+    Packs = reinterpret_cast<const Mesh_File_Pack *>(Base + Layout.Packs);
+
+    /* Check the packs before setting anything up. */
+
+    for (i = 0; i < Header->Number_Of_Packs; i++)
+    {
+        for (k = 0; k < 4; k++)
+        {
+            if ((Packs[i].Triangles[k] >= Data->Number_Of_Triangles) || ((k == 0) && (Packs[i].Triangles[k] < 0)))
+            {
+                return false;
+            }
+        }
+    }
+
+    Leaves.assign(Header->Number_Of_Packs, nullptr);
+
+    Next = 0;
+
+    Tree = restore_bbox_node(Nodes, Header->Number_Of_Nodes, Next, 0, Leaves);
+
+    /* Every node must be used, and every pack must have its leaf. */
+
+    Complete = (Tree != nullptr) && (Next == Header->Number_Of_Nodes);
+
+    for (i = 0; Complete && (i < Header->Number_Of_Packs); i++)
+    {
+        Complete = (Leaves[i] != nullptr);
+    }
+
+    if (!Complete)
+    {
+        Destroy_BBox_Tree(Tree);
+
+        return false;
+    }
+
+    Data->Number_Of_Packs = Header->Number_Of_Packs;
+
+    Data->Packs = reinterpret_cast<MESH_TRIANGLE_PACK *>(POV_MALLOC(Data->Number_Of_Packs*sizeof(MESH_TRIANGLE_PACK), "mesh bbox tree"));
+
+    Data->Pack_Geometry = reinterpret_cast<MESH_PACK_GEOMETRY *>(POV_MALLOC(Data->Number_Of_Packs*sizeof(MESH_PACK_GEOMETRY), "mesh bbox tree"));
+
+    for (i = 0; i < Data->Number_Of_Packs; i++)
+    {
+        for (Count = 0; (Count < 4) && (Packs[i].Triangles[Count] >= 0); Count++)
+        {
+            Members[Count] = &Data->Triangles[Packs[i].Triangles[Count]];
+        }
+
+        init_triangle_pack(&Data->Packs[i], &Data->Pack_Geometry[i], Members, Count);
+
+        Leaves[i]->Node = reinterpret_cast<BBOX_TREE **>(&Data->Packs[i]);
+    }
+
+    /* Publish the tree last, see Build_Mesh_BBox_Tree(). */
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Data->Tree = Tree;
+
+    account_data();
+
+    return true;
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   restore_bbox_node
+*
+* INPUT
+*
+*   Nodes           - Nodes of a binary mesh file's tree, in pre-order
+*   Number_Of_Nodes - Number of nodes
+*   Next            - Index of the node to restore
+*   Depth           - Depth of the node in the tree
+*   Leaves          - Leaves of the tree restored so far, by pack
+*
+* OUTPUT
+*
+*   Next   - Index of the node following the node's subtree
+*   Leaves - Leaves of the tree restored so far, by pack
+*
+* RETURNS
+*
+*   BBOX_TREE * - Restored subtree, or nullptr if the nodes are damaged
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Re-create a node and its subtree. The leaves are left for the caller
+*   to point to their triangle packs. Subtrees reaching deeper than
+*   MESH_FILE_MAX_TREE_DEPTH are treated as damaged.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+static BBOX_TREE *restore_bbox_node(const Mesh_File_Node *Nodes, MeshIndex Number_Of_Nodes, MeshIndex& Next, int Depth, vector<BBOX_TREE *>& Leaves)
+{
+    const Mesh_File_Node *Record;
+    BBOX_TREE *Node, *Child;
+    short i;
+
+    if ((Next >= Number_Of_Nodes) || (Depth >= MESH_FILE_MAX_TREE_DEPTH))
+    {
+        return nullptr;
+    }
+
+    Record = &Nodes[Next++];
+
+    if ((Record->Entries < 0) || (Record->Entries > SHRT_MAX) ||
+        ((Record->Entries == 0) && ((Record->Pack < 0) || (size_t(Record->Pack) >= Leaves.size()) || (Leaves[Record->Pack] != nullptr))))
+    {
+        return nullptr;
+    }
+
+    Node = reinterpret_cast<BBOX_TREE *>(POV_MALLOC(sizeof(BBOX_TREE), "mesh bbox tree"));
+
+    Node->BBox     = Record->BBox;
+    Node->Infinite = false;
+    Node->Entries  = 0;
+    Node->Node     = nullptr;
+
+    if (Record->Entries == 0)
+    {
+        Leaves[Record->Pack] = Node;
+
+        return Node;
+    }
+
+    Node->Node = reinterpret_cast<BBOX_TREE **>(POV_MALLOC(Record->Entries*sizeof(BBOX_TREE *), "mesh bbox tree"));
+
+    for (i = 0; i < Record->Entries; i++)
+    {
+        Child = restore_bbox_node(Nodes, Number_Of_Nodes, Next, Depth + 1, Leaves);
+
+        if (Child == nullptr)
+        {
+            if (i == 0)
+            {
+                POV_FREE(Node->Node);
+
+                Node->Node = nullptr;
+            }
+
+            Destroy_BBox_Tree(Node);
+
+            return nullptr;
+        }
+
+        Node->Node[i] = Child;
+        Node->Entries = i + 1;
+    }
+
+    return Node;
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   init_triangle_pack
+*
+* INPUT
+*
+*   Triangles - Triangles to store in the pack
+*   Count     - Number of triangles, at most four
+*
+* OUTPUT
+*
+*   Pack     - Triangle pack
+*   Geometry - Geometry of the pack, or `nullptr` if none is kept
+*
+* RETURNS
+*
+* AUTHOR
+*
+* DESCRIPTION
+*
+*   Set up the single precision copy of the triangles used by
+*   test_triangle_pack().
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void Mesh::init_triangle_pack(MESH_TRIANGLE_PACK *Pack, MESH_PACK_GEOMETRY *Geometry, const MESH_TRIANGLE * const *Triangles, int Count) const
+{
+    int i, k;
+    Vector3d P[4][3];
+    Vector3d Lo(BOUND_HUGE), Hi(-BOUND_HUGE);
+
+    Pack->Count = Count;
+    Pack->Geometry = Geometry;
+
+    for (k = 0; k < 4; k++)
+    {
+        Pack->Triangles[k] = (k < Count) ? Triangles[k] : nullptr;
+    }
+
+    if (Geometry == nullptr)
+    {
+        return;
+    }
+
+    for (k = 0; k < Count; k++)
+    {
+        get_triangle_vertices(Triangles[k], P[k][0], P[k][1], P[k][2]);
+
+        for (i = 0; i < 3; i++)
+        {
+            Lo = min(Lo, P[k][i]);
+            Hi = max(Hi, P[k][i]);
+        }
+    }
+
+    Geometry->Centre = midpoint(Lo, Hi);
+    Geometry->Radius = 0.0;
+
+    for (k = 0; k < 4; k++)
+    {
+        Vector3d V0, E1, E2;
+
+        if (k < Count)
+        {
+            V0 = P[k][0] - Geometry->Centre;
+            E1 = P[k][1] - P[k][0];
+            E2 = P[k][2] - P[k][0];
+
+            for (i = 0; i < 3; i++)
+            {
+                Geometry->Radius = max(Geometry->Radius, (P[k][i] - Geometry->Centre).length());
+            }
+        }
+
+        for (i = X; i <= Z; i++)
+        {
+            Geometry->V0[i][k] = float(V0[i]);
+            Geometry->E1[i][k] = float(E1[i]);
+            Geometry->E2[i][k] = float(E2[i]);
+        }
+
+        Geometry->Extent[k] = float(E1.length() + E2.length());
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   intersect_bbox_tree
+*
+* INPUT
+*
+*   Mesh     - Mesh object
+*   Ray      - Current ray
+*   Orig_Ray - Original, untransformed ray
+*   len      - Length of the transformed ray direction
+*
+* OUTPUT
+*
+*   Depth_Stack - Stack of intersections
+*
+* RETURNS
+*
+*   bool - true if an intersection was found
+*
+* AUTHOR
+*
+*   Dieter Bayer
+*
+* DESCRIPTION
+*
+*   Intersect a ray with the bounding box tree of a mesh.
+*
+* CHANGES
+*
+*   Feb 1995 : Creation.
+*
+******************************************************************************/
+
+bool Mesh::intersect_bbox_tree(const BasicRay &ray, const BasicRay &Orig_Ray, DBL len, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    bool found;
+    MeshIndex i;
+    DBL Best, Depth;
+    const BBOX_TREE *Node, *Root;
+    const MESH_TRIANGLE_PACK *Pack;
+    unsigned int Candidates;
+    bool OldStyle = has_inside_vector;
+
+    /* Create the direction vectors for this ray. */
+    Rayinfo rayinfo(ray);
+
+    /* Start with an empty priority queue. */
+    Thread->Mesh_Queue.Clear();
+    found = false;
+
+    Best = BOUND_HUGE;
+
+#ifdef BBOX_EXTRA_STATS
+    Thread->Stats()[totalQueueResets]++;
+#endif
 
     /* Check top node. */
 
@@ -1501,21 +2351,817 @@ bool Mesh::intersect_bbox_tree(const BasicRay &ray, const BasicRay &Orig_Ray, DB
         }
         else
         {
-            /* This is a leaf so test the contained triangle. */
+            /* This is a leaf so test the contained triangles. */
 
-            if (intersect_mesh_triangle(ray, reinterpret_cast<MESH_TRIANGLE *>(Node->Node), &Depth))
-            {
-                if (test_hit(reinterpret_cast<MESH_TRIANGLE *>(Node->Node), Orig_Ray, Depth, len, Depth_Stack, Thread))
+            Pack = reinterpret_cast<const MESH_TRIANGLE_PACK *>(Node->Node);
+
+            Candidates = test_triangle_pack(ray, Pack);
+
+            Thread->Stats()[Ray_Mesh_Triangle_Tests] += Pack->Count;
+
+            for (i = 0; i < Pack->Count; i++)
+            {
+                if ((Candidates & (1u << i)) && intersect_mesh_triangle(ray, Pack->Triangles[i], &Depth))
                 {
-                    found = true;
+                    Thread->Stats()[Ray_Mesh_Triangle_Tests_Succeeded]++;
+
+                    if (test_hit(Pack->Triangles[i], Orig_Ray, Depth, len, Depth_Stack, Thread))
+                    {
+                        found = true;
+
+                        Best = min(Best, Depth);
+                    }
+                }
+            }
+        }
+    }
+
+    return(found);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   test_triangle_pack
+*
+* INPUT
+*
+*   Ray  - Current ray, in mesh space and with normalized direction
+*   Pack - Triangle pack
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   unsigned int - Bit mask of the triangles that may be hit by the ray
+*
+* AUTHOR
+*
+* DESCRIPTION
+*
+*   Test a ray against all triangles of a pack at once, using the
+*   Moeller-Trumbore algorithm on the single precision copy of the
+*   triangles. The loop is free of branches, so that the compiler can
+*   vectorize it.
+*
+*   To make sure no hit is ever missed, the barycentric coordinate bounds
+*   are widened by a generous estimate of the rounding error, and no
+*   depth test is done; triangles reported by this function must therefore
+*   be confirmed with intersect_mesh_triangle().
+*
+*   Packs of compact meshes have no single precision copy, so all of their
+*   triangles are reported.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static unsigned int test_triangle_pack(const BasicRay& ray, const MESH_TRIANGLE_PACK *Pack)
+{
+    const MESH_PACK_GEOMETRY *Geometry = Pack->Geometry;
+
+    if (Geometry == nullptr)
+        return ((1u << Pack->Count) - 1);
+
+    Vector3d Origin = ray.Origin - Geometry->Centre;
+
+    // Moving the origin along the ray to the point closest to the pack leaves the barycentric
+    // coordinates unchanged, but keeps the single precision rounding errors small.
+    Origin -= ray.Direction * dot(Origin, ray.Direction);
+
+    const float ox = float(Origin[X]), oy = float(Origin[Y]), oz = float(Origin[Z]);
+    const float dx = float(ray.Direction[X]), dy = float(ray.Direction[Y]), dz = float(ray.Direction[Z]);
+
+    // Rounding errors scale with the magnitude of the vectors involved.
+    const float Slack = float(PACK_ERROR_FACTOR * FLT_EPSILON * (Origin.length() + 2.0 * Geometry->Radius));
+    const float Scale = float(PACK_ERROR_FACTOR * FLT_EPSILON);
+
+    unsigned int hit[4];
+
+    for (int k = 0; k < 4; k++)
+    {
+        const float e1x = Geometry->E1[X][k], e1y = Geometry->E1[Y][k], e1z = Geometry->E1[Z][k];
+        const float e2x = Geometry->E2[X][k], e2y = Geometry->E2[Y][k], e2z = Geometry->E2[Z][k];
+
+        const float tx = ox - Geometry->V0[X][k];
+        const float ty = oy - Geometry->V0[Y][k];
+        const float tz = oz - Geometry->V0[Z][k];
+
+        const float px = dy * e2z - dz * e2y;
+        const float py = dz * e2x - dx * e2z;
+        const float pz = dx * e2y - dy * e2x;
+
+        const float qx = ty * e1z - tz * e1y;
+        const float qy = tz * e1x - tx * e1z;
+        const float qz = tx * e1y - ty * e1x;
+
+        const float det = e1x * px + e1y * py + e1z * pz;
+        const float sgn = (det < 0.0f) ? -1.0f : 1.0f;
+
+        const float u = sgn * (tx * px + ty * py + tz * pz);
+        const float v = sgn * (dx * qx + dy * qy + dz * qz);
+        const float err = (Slack + Scale * Geometry->Extent[k]) * Geometry->Extent[k];
+
+        hit[k] = (u >= -err) & (v >= -err) & (u + v <= sgn * det + 2.0f * err);
+    }
+
+    return (hit[0] | (hit[1] << 1) | (hit[2] << 2) | (hit[3] << 3)) & ((1u << Pack->Count) - 1);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   mesh_hash
+*
+* INPUT
+*
+*   aPoint - Normal/Vertex to store
+*
+* OUTPUT
+*
+*   Hash_Table - Normal/Vertex hash table
+*   Number     - Number of normals/vertices
+*   Max        - Max. number of normals/vertices
+*   Elements   - List of normals/vertices
+*
+* RETURNS
+*
+*   MeshIndex - Index of normal/vertex into the normals/vertices list
+*
+* AUTHOR
+*
+*   Dieter Bayer
+*
+* DESCRIPTION
+*
+*   Try to locate a triangle normal/vertex in the normal/vertex list.
+*   If the vertex is not found its stored in the normal/vertex list.
+*
+* CHANGES
+*
+*   Feb 1995 : Creation. (With help from Steve Anger's RAW2POV code)
+*
+******************************************************************************/
+
+MeshIndex Mesh::mesh_hash(HASH_TABLE **Hash_Table, MeshIndex *Number, MeshIndex  *Max, MeshVector **Elements, const Vector3d& aPoint)
+{
+    int hash;
+    MeshVector D, P;
+    HASH_TABLE *p;
+
+    P = MeshVector(aPoint);
+
+    /* Get hash value. */
+
+    // TODO - This is inefficient for very small meshes. Maybe scale by 2^N (or 2^-N) into the range 1.0..2.0 first.
+    hash = (unsigned int)((int)(326.0*P[X])^(int)(694.7*P[Y])^(int)(1423.6*P[Z])) % HASH_SIZE;
+
+    /* Try to find normal/vertex. */
+
+    for (p = Hash_Table[hash]; p != nullptr; p = p->Next)
+    {
+        D = p->P - P;
+
+        if ((fabs(D[X]) < EPSILON) && (fabs(D[Y]) < EPSILON) && (fabs(D[Z]) < EPSILON))
+        {
+            break;
+        }
+    }
+
+    if ((p != nullptr) && (p->Index >= 0))
+    {
+        return(p->Index);
+    }
+
+    /* Add new normal/vertex to the list and hash table. */
+
+    if ((*Number) >= (*Max))
+    {
+        if ((*Max) >= std::numeric_limits<MeshIndex>::max()/2)
+        {
+            throw POV_EXCEPTION_STRING("Too many normals/vertices in mesh.");
+        }
+
+        (*Max) *= 2;
+
+        (*Elements) = reinterpret_cast<MeshVector *>(POV_REALLOC((*Elements), (*Max)*sizeof(MeshVector), "mesh data"));
+    }
+
+    (*Elements)[*Number] = P;
+
+    p = Hash_Arena.Allocate<HASH_TABLE>();
+
+    p->P = P;
+
+    p->Index = *Number;
+
+    p->Next = Hash_Table[hash];
+
+    Hash_Table[hash] = p;
+
+    return((*Number)++);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Mesh_Hash_Vertex
+*
+* INPUT
+*
+*   Vertex - Vertex to store
+*
+* OUTPUT
+*
+*   Number_Of_Vertices - Number of vertices
+*   Max_Vertices       - Max. number of vertices
+*   Vertices           - List of vertices
+*
+* RETURNS
+*
+*   MeshIndex - Index of vertex into the vertices list
+*
+* AUTHOR
+*
+*   Dieter Bayer
+*
+* DESCRIPTION
+*
+*   Try to locate a triangle vertex in the vertex list.
+*   If the vertex is not found its stored in the vertex list.
+*
+* CHANGES
+*
+*   Feb 1995 : Creation. (With help from Steve Anger's RAW2POV code)
+*
+******************************************************************************/
+
+MeshIndex Mesh::Mesh_Hash_Vertex(MeshIndex *Number_Of_Vertices, MeshIndex *Max_Vertices, MeshVector **Vertices, const Vector3d& Vertex)
+{
+    return(mesh_hash(Vertex_Hash_Table, Number_Of_Vertices, Max_Vertices, Vertices, Vertex));
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Mesh_Hash_Normal
+*
+* INPUT
+*
+*   Normal - Normal to store
+*
+* OUTPUT
+*
+*   Number_Of_Normals - Number of normals
+*   Max_Normals       - Max. number of normals
+*   Normals           - List of normals
+*
+* RETURNS
+*
+*   MeshIndex - Index of normal into the normals list
+*
+* AUTHOR
+*
+*   Dieter Bayer
+*
+* DESCRIPTION
+*
+*   Try to locate a triangle normal in the normal list.
+*   If the normal is not found its stored in the normal list.
+*
+* CHANGES
+*
+*   Feb 1995 : Creation. (With help from Steve Anger's RAW2POV code)
+*
+******************************************************************************/
+
+MeshIndex Mesh::Mesh_Hash_Normal(MeshIndex *Number_Of_Normals, MeshIndex *Max_Normals, MeshVector **Normals, const Vector3d& S_Normal)
+{
+    return(mesh_hash(Normal_Hash_Table, Number_Of_Normals, Max_Normals, Normals, S_Normal));
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Mesh_Hash_Texture
+*
+* INPUT
+*
+*   Texture - Texture to store
+*
+* OUTPUT
+*
+*   Number_Of_Textures - Number of textures
+*   Max_Textures       - Max. number of textures
+*   Textures           - List of textures
+*
+* RETURNS
+*
+*   MeshIndex - Index of texture into the texture list
+*
+* AUTHOR
+*
+*   Dieter Bayer
+*
+* DESCRIPTION
+*
+*   Try to locate a texture in the texture list.
+*   If the texture is not found its stored in the texture list.
+*
+* CHANGES
+*
+*   Feb 1995 : Creation.
+*
+******************************************************************************/
+
+MeshIndex Mesh::Mesh_Hash_Texture(MeshIndex *Number_Of_Textures, MeshIndex *Max_Textures, TEXTURE ***Textures, TEXTURE *Texture)
+{
+    MeshIndex i;
+
+    if (Texture == nullptr)
+    {
+        return(-1);
+    }
+
+    /* Just do a linear search. */
+
+    for (i = 0; i < *Number_Of_Textures; i++)
+    {
+        if ((*Textures)[i] == Texture)
+        {
+            break;
+        }
+    }
+
+    if (i == *Number_Of_Textures)
+    {
+        if ((*Number_Of_Textures) >= (*Max_Textures))
+        {
+            if ((*Max_Textures) >= std::numeric_limits<MeshIndex>::max()/2)
+            {
+                throw POV_EXCEPTION_STRING("Too many textures in mesh.");
+            }
+
+            (*Max_Textures) *= 2;
+
+            (*Textures) = reinterpret_cast<TEXTURE **>(POV_REALLOC((*Textures), (*Max_Textures)*sizeof(TEXTURE *), "mesh data"));
+        }
+
+        (*Textures)[(*Number_Of_Textures)++] = Copy_Texture_Pointer(Texture);
+    }
+
+    return(i);
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Mesh_Hash_UV
+*
+* INPUT
+*
+*   aPoint - UV vector to store
+*
+* OUTPUT
+*
+*   Hash_Table - UV vector hash table
+*   Number     - Number of UV vectors
+*   Max        - Max. number of UV vectors
+*   Elements   - List of UV vectors
+*
+* RETURNS
+*
+*   MeshIndex - Index of UV vector into the UV vector list
+*
+* AUTHOR
+*
+*   Dieter Bayer / Nathan Kopp
+*
+* DESCRIPTION
+*
+*   adapted from mesh_hash
+*
+* CHANGES
+*
+*
+******************************************************************************/
+
+MeshIndex Mesh::Mesh_Hash_UV(MeshIndex *Number, MeshIndex *Max, MeshUVVector **Elements, const Vector2d& aPoint)
+{
+    int hash;
+    MeshUVVector D, P;
+    UV_HASH_TABLE *p;
+
+    P = MeshUVVector(aPoint);
+
+    /* Get hash value. */
+
+    // TODO - This is inefficient for very small meshes. Maybe scale by 2^N (or 2^-N) into the range 1.0..2.0 first.
+    hash = (unsigned int)((int)(326.0*P[U])^(int)(694.7*P[V])) % HASH_SIZE;
+
+    /* Try to find normal/vertex. */
+
+    for (p = UV_Hash_Table[hash]; p != nullptr; p = p->Next)
+    {
+        /* VSub(D, p->P, P); */
+        D = p->P - P;
+
+        if ((fabs(D[U]) < EPSILON) && (fabs(D[V]) < EPSILON))
+        {
+            break;
+        }
+    }
+
+    if ((p != nullptr) && (p->Index >= 0))
+    {
+        return(p->Index);
+    }
+
+    /* Add new normal/vertex to the list and hash table. */
+
+    if ((*Number) >= (*Max))
+    {
+        if ((*Max) >= std::numeric_limits<MeshIndex>::max()/2)
+        {
+            throw POV_EXCEPTION_STRING("Too many normals/vertices in mesh.");
+        }
+
+        (*Max) *= 2;
+
+        (*Elements) = reinterpret_cast<MeshUVVector *>(POV_REALLOC((*Elements), (*Max)*sizeof(MeshUVVector), "mesh data"));
+    }
+
+    (*Elements)[*Number] = P;
+
+    p = Hash_Arena.Allocate<UV_HASH_TABLE>();
+
+    p->P = P;
+
+    p->Index = *Number;
+
+    p->Next = UV_Hash_Table[hash];
+
+    UV_Hash_Table[hash] = p;
+
+    return((*Number)++);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Create_Mesh_Hash_Tables
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   Dieter Bayer
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Feb 1995 : Creation.
+*
+******************************************************************************/
+
+void Mesh::Create_Mesh_Hash_Tables()
+{
+    MeshIndex i;
+
+    Vertex_Hash_Table = reinterpret_cast<HASH_TABLE **>(POV_MALLOC(HASH_SIZE*sizeof(HASH_TABLE *), "mesh hash table"));
+
+    for (i = 0; i < HASH_SIZE; i++)
+    {
+        Vertex_Hash_Table[i] = nullptr;
+    }
+
+    Normal_Hash_Table = reinterpret_cast<HASH_TABLE **>(POV_MALLOC(HASH_SIZE*sizeof(HASH_TABLE *), "mesh hash table"));
+
+    for (i = 0; i < HASH_SIZE; i++)
+    {
+        Normal_Hash_Table[i] = nullptr;
+    }
+
+    /* NK 1998 */
+    UV_Hash_Table = reinterpret_cast<UV_HASH_TABLE **>(POV_MALLOC(HASH_SIZE*sizeof(UV_HASH_TABLE *), "mesh hash table"));
+
+    for (i = 0; i < HASH_SIZE; i++)
+    {
+        UV_Hash_Table[i] = nullptr;
+    }
+    /* NK ---- */
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Destroy_Mesh_Hash_Tables
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   Dieter Bayer
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Feb 1995 : Creation.
+*   Oct 2026 : Hash table entries are allocated from an arena.
+*
+******************************************************************************/
+
+void Mesh::Destroy_Mesh_Hash_Tables()
+{
+    // The entries themselves are all released in one go.
+    Hash_Arena.Reset();
+
+    POV_FREE(Vertex_Hash_Table);
+    POV_FREE(Normal_Hash_Table);
+    POV_FREE(UV_Hash_Table);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   get_triangle_vertices
+*
+* INPUT
+*
+*   Mesh     - Mesh object
+*   Triangle - Triangle
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   P1, P2, P3 - Vertices of the triangle
+*
+* AUTHOR
+*
+*   Dieter Bayer
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Feb 1995 : Creation.
+*
+******************************************************************************/
+
+void Mesh::get_triangle_vertices(const MESH_TRIANGLE *Triangle, Vector3d& P1, Vector3d& P2, Vector3d& P3) const
+{
+    if (Data->QVertices == nullptr)
+    {
+        P1 = Vector3d(Data->Vertices[Triangle->P1]);
+        P2 = Vector3d(Data->Vertices[Triangle->P2]);
+        P3 = Vector3d(Data->Vertices[Triangle->P3]);
+    }
+    else
+    {
+        P1 = get_vertex(Triangle->P1);
+        P2 = get_vertex(Triangle->P2);
+        P3 = get_vertex(Triangle->P3);
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   get_triangle_normal
+*
+* INPUT
+*
+*   Triangle - Triangle
+*
+* OUTPUT
+*
+*   N - Unsmoothed normal of the triangle
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Look up the triangle's normal, or derive it from the vertices in case
+*   of a compact mesh.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void Mesh::get_triangle_normal(const MESH_TRIANGLE *Triangle, Vector3d& N) const
+{
+    Vector3d P1, P2, P3;
+
+    if (Data->QVertices == nullptr)
+    {
+        N = Vector3d(Data->Normals[Triangle->Normal_Ind]);
+    }
+    else
+    {
+        get_triangle_vertices(Triangle, P1, P2, P3);
+
+        N = derive_triangle_normal(P1, P2, P3, Triangle->Swapped);
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   derive_triangle_normal
+*
+* INPUT
+*
+*   P1, P2, P3 - Vertices of the triangle, in stored order
+*   Swapped    - Whether the stored order reverses the original winding
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   Vector3d - Normal of the triangle, or zero if it is degenerate
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Compute the normal the same way Compute_Mesh_Triangle() does, so that
+*   it points to the same side as the normal of the triangle given in the
+*   scene.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+static Vector3d derive_triangle_normal(const Vector3d& P1, const Vector3d& P2, const Vector3d& P3, bool Swapped)
+{
+    Vector3d N = cross(P3 - P1, P2 - P1);
+    DBL Length = N.length();
+
+    if (Length == 0.0)
+        return N;
+
+    return N / (Swapped ? -Length : Length);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   get_vertex
+*
+* INPUT
+*
+*   Index - Index of the vertex
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   Vector3d - The vertex
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+Vector3d Mesh::get_vertex(MeshIndex Index) const
+{
+    if (Data->QVertices == nullptr)
+        return Vector3d(Data->Vertices[Index]);
+
+    const MeshQVector& Q = Data->QVertices[Index];
+
+    return Vector3d(Data->QOrigin[X] + Q.Coord[X] * Data->QScale[X],
+                    Data->QOrigin[Y] + Q.Coord[Y] * Data->QScale[Y],
+                    Data->QOrigin[Z] + Q.Coord[Z] * Data->QScale[Z]);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   get_normal
+*
+* INPUT
+*
+*   Index - Index of the normal
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   Vector3d - The normal
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Look up a normal, decoding it from the octahedral encoding in case of
+*   a compact mesh: the upper half of the unit sphere is mapped onto the
+*   diamond |u| + |v| <= 1, and the lower half onto the corners folded
+*   out of it.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+Vector3d Mesh::get_normal(MeshIndex Index) const
+{
+    DBL u, v, w;
+
+    if (Data->QNormals == nullptr)
+        return Vector3d(Data->Normals[Index]);
+
+    u = Data->QNormals[Index].U / MESH_OCT_NORMAL_SCALE;
+    v = Data->QNormals[Index].V / MESH_OCT_NORMAL_SCALE;
+    w = 1.0 - fabs(u) - fabs(v);
+
+    if (w < 0.0)
+    {
+        DBL t = u;
 
-                    Best = Depth;
-                }
-            }
-        }
+        u = (1.0 - fabs(v)) * ((t >= 0.0) ? 1.0 : -1.0);
+        v = (1.0 - fabs(t)) * ((v >= 0.0) ? 1.0 : -1.0);
     }
 
-    return(found);
+    return Vector3d(u, v, w).normalized();
 }
 
 
@@ -1524,95 +3170,60 @@ bool Mesh::intersect_bbox_tree(const BasicRay &ray, const BasicRay &Orig_Ray, DB
 *
 * FUNCTION
 *
-*   mesh_hash
+*   encode_normal
 *
 * INPUT
 *
-*   aPoint - Normal/Vertex to store
+*   N - Normal to encode
 *
 * OUTPUT
 *
-*   Hash_Table - Normal/Vertex hash table
-*   Number     - Number of normals/vertices
-*   Max        - Max. number of normals/vertices
-*   Elements   - List of normals/vertices
-*
 * RETURNS
 *
-*   MeshIndex - Index of normal/vertex into the normals/vertices list
+*   MeshOctNormal - Octahedral encoding of the normal's direction
 *
 * AUTHOR
 *
-*   Dieter Bayer
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   Try to locate a triangle normal/vertex in the normal/vertex list.
-*   If the vertex is not found its stored in the normal/vertex list.
+*   Inverse of the decoding done by get_normal().
 *
 * CHANGES
 *
-*   Feb 1995 : Creation. (With help from Steve Anger's RAW2POV code)
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-MeshIndex Mesh::mesh_hash(HASH_TABLE **Hash_Table, MeshIndex *Number, MeshIndex  *Max, MeshVector **Elements, const Vector3d& aPoint)
+static MeshOctNormal encode_normal(const Vector3d& N)
 {
-    int hash;
-    MeshVector D, P;
-    HASH_TABLE *p;
-
-    P = MeshVector(aPoint);
-
-    /* Get hash value. */
-
-    // TODO - This is inefficient for very small meshes. Maybe scale by 2^N (or 2^-N) into the range 1.0..2.0 first.
-    hash = (unsigned int)((int)(326.0*P[X])^(int)(694.7*P[Y])^(int)(1423.6*P[Z])) % HASH_SIZE;
-
-    /* Try to find normal/vertex. */
-
-    for (p = Hash_Table[hash]; p != nullptr; p = p->Next)
-    {
-        D = p->P - P;
+    MeshOctNormal Code;
+    DBL u, v, l;
 
-        if ((fabs(D[X]) < EPSILON) && (fabs(D[Y]) < EPSILON) && (fabs(D[Z]) < EPSILON))
-        {
-            break;
-        }
-    }
+    l = fabs(N[X]) + fabs(N[Y]) + fabs(N[Z]);
 
-    if ((p != nullptr) && (p->Index >= 0))
+    if (l == 0.0)
     {
-        return(p->Index);
+        Code.U = Code.V = 0;
+        return Code;
     }
 
-    /* Add new normal/vertex to the list and hash table. */
+    u = N[X] / l;
+    v = N[Y] / l;
 
-    if ((*Number) >= (*Max))
+    if (N[Z] < 0.0)
     {
-        if ((*Max) >= std::numeric_limits<MeshIndex>::max()/2)
-        {
-            throw POV_EXCEPTION_STRING("Too many normals/vertices in mesh.");
-        }
-
-        (*Max) *= 2;
+        DBL t = u;
 
-        (*Elements) = reinterpret_cast<MeshVector *>(POV_REALLOC((*Elements), (*Max)*sizeof(MeshVector), "mesh data"));
+        u = (1.0 - fabs(v)) * ((t >= 0.0) ? 1.0 : -1.0);
+        v = (1.0 - fabs(t)) * ((v >= 0.0) ? 1.0 : -1.0);
     }
 
-    (*Elements)[*Number] = P;
-
-    p = reinterpret_cast<HASH_TABLE *>(POV_MALLOC(sizeof(HASH_TABLE), "mesh data"));
-
-    p->P = P;
-
-    p->Index = *Number;
-
-    p->Next = Hash_Table[hash];
-
-    Hash_Table[hash] = p;
+    Code.U = (signed short)floor(clip(u, -1.0, 1.0) * MESH_OCT_NORMAL_SCALE + 0.5);
+    Code.V = (signed short)floor(clip(v, -1.0, 1.0) * MESH_OCT_NORMAL_SCALE + 0.5);
 
-    return((*Number)++);
+    return Code;
 }
 
 
@@ -1621,21 +3232,18 @@ MeshIndex Mesh::mesh_hash(HASH_TABLE **Hash_Table, MeshIndex *Number, MeshIndex
 *
 * FUNCTION
 *
-*   Mesh_Hash_Vertex
+*   get_triangle_normals
 *
 * INPUT
 *
-*   Vertex - Vertex to store
+*   Mesh     - Mesh object
+*   Triangle - Triangle
 *
 * OUTPUT
 *
-*   Number_Of_Vertices - Number of vertices
-*   Max_Vertices       - Max. number of vertices
-*   Vertices           - List of vertices
-*
 * RETURNS
 *
-*   MeshIndex - Index of vertex into the vertices list
+*   N1, N2, N3 - Normals of the triangle
 *
 * AUTHOR
 *
@@ -1643,230 +3251,333 @@ MeshIndex Mesh::mesh_hash(HASH_TABLE **Hash_Table, MeshIndex *Number, MeshIndex
 *
 * DESCRIPTION
 *
-*   Try to locate a triangle vertex in the vertex list.
-*   If the vertex is not found its stored in the vertex list.
+*   -
 *
 * CHANGES
 *
-*   Feb 1995 : Creation. (With help from Steve Anger's RAW2POV code)
+*   Feb 1995 : Creation.
 *
 ******************************************************************************/
 
-MeshIndex Mesh::Mesh_Hash_Vertex(MeshIndex *Number_Of_Vertices, MeshIndex *Max_Vertices, MeshVector **Vertices, const Vector3d& Vertex)
+void Mesh::get_triangle_normals(const MESH_TRIANGLE *Triangle, Vector3d& N1, Vector3d& N2, Vector3d& N3) const
 {
-    return(mesh_hash(Vertex_Hash_Table, Number_Of_Vertices, Max_Vertices, Vertices, Vertex));
+    N1 = get_normal(Triangle->N1);
+    N2 = get_normal(Triangle->N2);
+    N3 = get_normal(Triangle->N3);
 }
 
 
-
 /*****************************************************************************
 *
 * FUNCTION
 *
-*   Mesh_Hash_Normal
+*   get_triangle_uvcoords
 *
 * INPUT
 *
-*   Normal - Normal to store
+*   Mesh     - Mesh object
+*   Triangle - Triangle
 *
 * OUTPUT
 *
-*   Number_Of_Normals - Number of normals
-*   Max_Normals       - Max. number of normals
-*   Normals           - List of normals
-*
 * RETURNS
 *
-*   MeshIndex - Index of normal into the normals list
+*   UV1, UV2, UV3 - UV coordinates of the triangle's corners
 *
 * AUTHOR
 *
-*   Dieter Bayer
+*   Nathan Kopp
 *
 * DESCRIPTION
 *
-*   Try to locate a triangle normal in the normal list.
-*   If the normal is not found its stored in the normal list.
+*   adapted from get_triangle_normals
 *
 * CHANGES
 *
-*   Feb 1995 : Creation. (With help from Steve Anger's RAW2POV code)
-*
 ******************************************************************************/
 
-MeshIndex Mesh::Mesh_Hash_Normal(MeshIndex *Number_Of_Normals, MeshIndex *Max_Normals, MeshVector **Normals, const Vector3d& S_Normal)
+void Mesh::get_triangle_uvcoords(const MESH_TRIANGLE *Triangle, Vector2d& UV1, Vector2d& UV2, Vector2d& UV3) const
 {
-    return(mesh_hash(Normal_Hash_Table, Number_Of_Normals, Max_Normals, Normals, S_Normal));
+    UV1 = Vector2d(Data->UVCoords[Triangle->UV1]);
+    UV2 = Vector2d(Data->UVCoords[Triangle->UV2]);
+    UV3 = Vector2d(Data->UVCoords[Triangle->UV3]);
 }
 
 
-
 /*****************************************************************************
 *
 * FUNCTION
 *
-*   Mesh_Hash_Texture
+*   Mesh::Init_From_Triangles
 *
 * INPUT
 *
-*   Texture - Texture to store
+*   vertices  - Vertex positions
+*   uvcoords  - UV coordinates per vertex, or empty
+*   triangles - Vertex indices, three per triangle
 *
 * OUTPUT
 *
-*   Number_Of_Textures - Number of textures
-*   Max_Textures       - Max. number of textures
-*   Textures           - List of textures
-*
 * RETURNS
 *
-*   MeshIndex - Index of texture into the texture list
+*   bool - false if there are no valid triangles
 *
 * AUTHOR
 *
-*   Dieter Bayer
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   Try to locate a texture in the texture list.
-*   If the texture is not found its stored in the texture list.
+*   Set up the mesh data from lists generated by code rather than parsed,
+*   and build the bounding box tree over the triangles.
 *
 * CHANGES
 *
-*   Feb 1995 : Creation.
+*   -
 *
 ******************************************************************************/
 
-MeshIndex Mesh::Mesh_Hash_Texture(MeshIndex *Number_Of_Textures, MeshIndex *Max_Textures, TEXTURE ***Textures, TEXTURE *Texture)
+bool Mesh::Init_From_Triangles(const vector<Vector3d>& vertices, const vector<Vector2d>& uvcoords, const vector<MeshIndex>& triangles)
 {
+    vector<MESH_TRIANGLE> tris;
+    vector<MeshVector> normals;
+    MESH_TRIANGLE tri;
+    Vector3d N;
     MeshIndex i;
 
-    if (Texture == nullptr)
+    tris.reserve(triangles.size() / 3);
+    normals.reserve(triangles.size() / 3);
+
+    for (size_t j = 0; j + 2 < triangles.size(); j += 3)
     {
-        return(-1);
-    }
+        Init_Mesh_Triangle(&tri);
 
-    /* Just do a linear search. */
+        tri.P1 = triangles[j];
+        tri.P2 = triangles[j + 1];
+        tri.P3 = triangles[j + 2];
 
-    for (i = 0; i < *Number_Of_Textures; i++)
-    {
-        if ((*Textures)[i] == Texture)
+        if (uvcoords.empty())
+            tri.UV1 = tri.UV2 = tri.UV3 = 0;
+        else
         {
-            break;
+            tri.UV1 = tri.P1;
+            tri.UV2 = tri.P2;
+            tri.UV3 = tri.P3;
         }
-    }
 
-    if (i == *Number_Of_Textures)
-    {
-        if ((*Number_Of_Textures) >= (*Max_Textures))
-        {
-            if ((*Max_Textures) >= std::numeric_limits<MeshIndex>::max()/2)
-            {
-                throw POV_EXCEPTION_STRING("Too many textures in mesh.");
-            }
+        if (!Compute_Mesh_Triangle(&tri, false, vertices[tri.P1], vertices[tri.P2], vertices[tri.P3], N))
+            continue;
 
-            (*Max_Textures) *= 2;
+        tri.Normal_Ind = normals.size();
+        normals.push_back(MeshVector(N));
+        tris.push_back(tri);
+    }
 
-            (*Textures) = reinterpret_cast<TEXTURE **>(POV_REALLOC((*Textures), (*Max_Textures)*sizeof(TEXTURE *), "mesh data"));
-        }
+    if (tris.empty())
+        return false;
 
-        (*Textures)[(*Number_Of_Textures)++] = Copy_Texture_Pointer(Texture);
-    }
+    Data = reinterpret_cast<MESH_DATA *>(POV_MALLOC(sizeof(MESH_DATA), "triangle mesh data"));
+
+    Data->References = 1;
+    Data->Tree = nullptr;
+    Data->Packs = nullptr;
+    Data->Pack_Geometry = nullptr;
+    Data->Number_Of_Packs = 0;
+    Data->Inside_Vect = Vector3d(0.0);
+    Data->QVertices = nullptr;
+    Data->QNormals = nullptr;
+    Data->File = nullptr;
+    Data->Accounted_Size = 0;
+
+    has_inside_vector = false;
+    Type |= PATCH_OBJECT;
+
+    Data->Number_Of_Normals = normals.size();
+    Data->Normals = reinterpret_cast<MeshVector *>(POV_MALLOC(Data->Number_Of_Normals * sizeof(MeshVector), "triangle mesh data"));
+    for (i = 0; i < Data->Number_Of_Normals; i++)
+        Data->Normals[i] = normals[i];
+
+    Data->Number_Of_Vertices = vertices.size();
+    Data->Vertices = reinterpret_cast<MeshVector *>(POV_MALLOC(Data->Number_Of_Vertices * sizeof(MeshVector), "triangle mesh data"));
+    for (i = 0; i < Data->Number_Of_Vertices; i++)
+        Data->Vertices[i] = MeshVector(vertices[i]);
+
+    Data->Number_Of_UVCoords = max(uvcoords.size(), (size_t)1);
+    Data->UVCoords = reinterpret_cast<MeshUVVector *>(POV_MALLOC(Data->Number_Of_UVCoords * sizeof(MeshUVVector), "triangle mesh data"));
+    if (uvcoords.empty())
+        Data->UVCoords[0] = MeshUVVector(0.0, 0.0);
+    for (i = 0; i < (MeshIndex)uvcoords.size(); i++)
+        Data->UVCoords[i] = uvcoords[i];
+
+    Data->Number_Of_Triangles = tris.size();
+    Data->Triangles = reinterpret_cast<MESH_TRIANGLE *>(POV_MALLOC(Data->Number_Of_Triangles * sizeof(MESH_TRIANGLE), "triangle mesh data"));
+    for (i = 0; i < Data->Number_Of_Triangles; i++)
+        Data->Triangles[i] = tris[i];
 
-    return(i);
+    Build_Mesh_BBox_Tree();
+    Compute_BBox();
+
+    return true;
 }
 
+
+
 /*****************************************************************************
 *
 * FUNCTION
 *
-*   Mesh_Hash_UV
+*   Map_Mesh_File
 *
 * INPUT
 *
-*   aPoint - UV vector to store
+*   file - Memory-mapped binary mesh file
 *
 * OUTPUT
 *
-*   Hash_Table - UV vector hash table
-*   Number     - Number of UV vectors
-*   Max        - Max. number of UV vectors
-*   Elements   - List of UV vectors
+*   textures - Number of textures referenced by the triangles
 *
 * RETURNS
 *
-*   MeshIndex - Index of UV vector into the UV vector list
+*   bool - false if the file is not a valid binary mesh file
 *
 * AUTHOR
 *
-*   Dieter Bayer / Nathan Kopp
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   adapted from mesh_hash
+*   Set up the mesh data to use the arrays of a binary mesh file in place.
+*   The triangles' indices and axes are checked, so that a damaged file
+*   cannot make us access memory outside the arrays.
 *
 * CHANGES
 *
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-MeshIndex Mesh::Mesh_Hash_UV(MeshIndex *Number, MeshIndex *Max, MeshUVVector **Elements, const Vector2d& aPoint)
+bool Mesh::Map_Mesh_File(MappedFile *file, MeshIndex& textures)
 {
-    int hash;
-    MeshUVVector D, P;
-    UV_HASH_TABLE *p;
-
-    P = MeshUVVector(aPoint);
+    const char *Base;
+    const Mesh_File_Header *Header;
+    const MESH_TRIANGLE *Triangle;
+    Mesh_File_Layout Layout;
+    MeshIndex i;
 
-    /* Get hash value. */
+    Base = reinterpret_cast<const char *>(file->GetData());
 
-    // TODO - This is inefficient for very small meshes. Maybe scale by 2^N (or 2^-N) into the range 1.0..2.0 first.
-    hash = (unsigned int)((int)(326.0*P[U])^(int)(694.7*P[V])) % HASH_SIZE;
+    if ((Base == nullptr) || (file->GetSize() < sizeof(Mesh_File_Header)))
+    {
+        return false;
+    }
 
-    /* Try to find normal/vertex. */
+    Header = reinterpret_cast<const Mesh_File_Header *>(Base);
 
-    for (p = UV_Hash_Table[hash]; p != nullptr; p = p->Next)
+    if ((memcmp(Header->Magic, MESH_FILE_MAGIC, sizeof(MESH_FILE_MAGIC)) != 0) ||
+        (Header->Version != MESH_FILE_VERSION) ||
+        (Header->Byte_Order != MESH_FILE_BYTE_ORDER) ||
+        (Header->Vector_Size != sizeof(MeshVector)) ||
+        (Header->UV_Size != sizeof(MeshUVVector)) ||
+        (Header->Triangle_Size != sizeof(MESH_TRIANGLE)) ||
+        (Header->Node_Size != sizeof(Mesh_File_Node)))
     {
-        /* VSub(D, p->P, P); */
-        D = p->P - P;
-
-        if ((fabs(D[U]) < EPSILON) && (fabs(D[V]) < EPSILON))
-        {
-            break;
-        }
+        return false;
     }
 
-    if ((p != nullptr) && (p->Index >= 0))
+    if ((Header->Number_Of_Vertices <= 0) || (Header->Number_Of_Normals < 0) ||
+        (Header->Number_Of_UVCoords <= 0) || (Header->Number_Of_Triangles <= 0) ||
+        (Header->Number_Of_Textures < 0) || (Header->Number_Of_Nodes < 0) ||
+        (Header->Number_Of_Packs < 0))
     {
-        return(p->Index);
+        return false;
     }
 
-    /* Add new normal/vertex to the list and hash table. */
+    mesh_file_layout(*Header, Layout);
 
-    if ((*Number) >= (*Max))
+    if (Layout.Size > file->GetSize())
     {
-        if ((*Max) >= std::numeric_limits<MeshIndex>::max()/2)
+        return false;
+    }
+
+    for (i = 0; i < Header->Number_Of_Triangles; i++)
+    {
+        Triangle = reinterpret_cast<const MESH_TRIANGLE *>(Base + Layout.Triangles) + i;
+
+        if ((Triangle->P1 < 0) || (Triangle->P1 >= Header->Number_Of_Vertices) ||
+            (Triangle->P2 < 0) || (Triangle->P2 >= Header->Number_Of_Vertices) ||
+            (Triangle->P3 < 0) || (Triangle->P3 >= Header->Number_Of_Vertices) ||
+            (Triangle->Normal_Ind < 0) || (Triangle->Normal_Ind >= Header->Number_Of_Normals) ||
+            (Triangle->UV1 < 0) || (Triangle->UV1 >= Header->Number_Of_UVCoords) ||
+            (Triangle->UV2 < 0) || (Triangle->UV2 >= Header->Number_Of_UVCoords) ||
+            (Triangle->UV3 < 0) || (Triangle->UV3 >= Header->Number_Of_UVCoords) ||
+            (Triangle->Texture >= Header->Number_Of_Textures) ||
+            (Triangle->Dominant_Axis > Z) || (Triangle->vAxis > Z))
         {
-            throw POV_EXCEPTION_STRING("Too many normals/vertices in mesh.");
+            return false;
         }
 
-        (*Max) *= 2;
+        if (Triangle->Smooth &&
+            ((Triangle->N1 < 0) || (Triangle->N1 >= Header->Number_Of_Normals) ||
+             (Triangle->N2 < 0) || (Triangle->N2 >= Header->Number_Of_Normals) ||
+             (Triangle->N3 < 0) || (Triangle->N3 >= Header->Number_Of_Normals)))
+        {
+            return false;
+        }
 
-        (*Elements) = reinterpret_cast<MeshUVVector *>(POV_REALLOC((*Elements), (*Max)*sizeof(MeshUVVector), "mesh data"));
+        if (Triangle->ThreeTex &&
+            ((Triangle->Texture < 0) ||
+             (Triangle->Texture2 < 0) || (Triangle->Texture2 >= Header->Number_Of_Textures) ||
+             (Triangle->Texture3 < 0) || (Triangle->Texture3 >= Header->Number_Of_Textures)))
+        {
+            return false;
+        }
     }
 
-    (*Elements)[*Number] = P;
+    /* The arrays are mapped read-only, and must never be modified. */
 
-    p = reinterpret_cast<UV_HASH_TABLE *>(POV_MALLOC(sizeof(UV_HASH_TABLE), "mesh data"));
+    Data = reinterpret_cast<MESH_DATA *>(POV_MALLOC(sizeof(MESH_DATA), "triangle mesh data"));
 
-    p->P = P;
+    Data->References = 1;
+    Data->Tree = nullptr;
+    Data->Packs = nullptr;
+    Data->Pack_Geometry = nullptr;
+    Data->Number_Of_Packs = 0;
+    Data->QVertices = nullptr;
+    Data->QNormals = nullptr;
+    Data->File = file;
+    Data->Accounted_Size = 0;
 
-    p->Index = *Number;
+    Data->Number_Of_Vertices  = Header->Number_Of_Vertices;
+    Data->Number_Of_Normals   = Header->Number_Of_Normals;
+    Data->Number_Of_UVCoords  = Header->Number_Of_UVCoords;
+    Data->Number_Of_Triangles = Header->Number_Of_Triangles;
 
-    p->Next = UV_Hash_Table[hash];
+    Data->Vertices  = const_cast<MeshVector *>(reinterpret_cast<const MeshVector *>(Base + Layout.Vertices));
+    Data->Normals   = const_cast<MeshVector *>(reinterpret_cast<const MeshVector *>(Base + Layout.Normals));
+    Data->UVCoords  = const_cast<MeshUVVector *>(reinterpret_cast<const MeshUVVector *>(Base + Layout.UVCoords));
+    Data->Triangles = const_cast<MESH_TRIANGLE *>(reinterpret_cast<const MESH_TRIANGLE *>(Base + Layout.Triangles));
 
-    UV_Hash_Table[hash] = p;
+    Data->Inside_Vect = Vector3d(Header->Inside_Vect[X], Header->Inside_Vect[Y], Header->Inside_Vect[Z]);
 
-    return((*Number)++);
+    has_inside_vector = ((Header->Flags & MESH_FILE_INSIDE_VECTOR) != 0);
+
+    if (has_inside_vector)
+    {
+        Type &= ~PATCH_OBJECT;
+    }
+    else
+    {
+        Type |= PATCH_OBJECT;
+    }
+
+    if ((Header->Flags & MESH_FILE_FULLY_TEXTURED) != 0)
+    {
+        Type |= TEXTURED_OBJECT;
+    }
+
+    textures = Header->Number_Of_Textures;
+
+    return true;
 }
 
 
@@ -1875,54 +3586,116 @@ MeshIndex Mesh::Mesh_Hash_UV(MeshIndex *Number, MeshIndex *Max, MeshUVVector **E
 *
 * FUNCTION
 *
-*   Create_Mesh_Hash_Tables
+*   Write_Mesh_File
 *
 * INPUT
 *
+*   stream - Stream to write to
+*
 * OUTPUT
 *
 * RETURNS
 *
+*   bool - false if the file could not be written
+*
 * AUTHOR
 *
-*   Dieter Bayer
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   -
+*   Write the mesh data, including its bounding box tree, as a binary mesh
+*   file that can be mapped into memory by Map_Mesh_File().
 *
 * CHANGES
 *
-*   Feb 1995 : Creation.
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-void Mesh::Create_Mesh_Hash_Tables()
+bool Mesh::Write_Mesh_File(OStream& stream) const
 {
+    Mesh_File_Header Header;
+    Mesh_File_Layout Layout;
+    vector<Mesh_File_Node> Nodes;
+    vector<Mesh_File_Pack> Packs;
+    size_t Position;
     MeshIndex i;
+    int k;
+    bool Fully_Textured;
 
-    Vertex_Hash_Table = reinterpret_cast<HASH_TABLE **>(POV_MALLOC(HASH_SIZE*sizeof(HASH_TABLE *), "mesh hash table"));
-
-    for (i = 0; i < HASH_SIZE; i++)
+    if ((Data->Vertices == nullptr) || (Data->Normals == nullptr))
     {
-        Vertex_Hash_Table[i] = nullptr;
+        return false;
     }
 
-    Normal_Hash_Table = reinterpret_cast<HASH_TABLE **>(POV_MALLOC(HASH_SIZE*sizeof(HASH_TABLE *), "mesh hash table"));
+    /* The object's type flags may also reflect its modifiers, so check the triangles. */
 
-    for (i = 0; i < HASH_SIZE; i++)
+    Fully_Textured = true;
+
+    for (i = 0; Fully_Textured && (i < Data->Number_Of_Triangles); i++)
     {
-        Normal_Hash_Table[i] = nullptr;
+        Fully_Textured = (Data->Triangles[i].Texture >= 0);
     }
 
-    /* NK 1998 */
-    UV_Hash_Table = reinterpret_cast<UV_HASH_TABLE **>(POV_MALLOC(HASH_SIZE*sizeof(UV_HASH_TABLE *), "mesh hash table"));
+    if (Data->Tree != nullptr)
+    {
+        collect_bbox_nodes(Data->Tree, Data->Packs, Nodes);
 
-    for (i = 0; i < HASH_SIZE; i++)
+        Packs.resize(Data->Number_Of_Packs);
+
+        for (i = 0; i < Data->Number_Of_Packs; i++)
+        {
+            for (k = 0; k < 4; k++)
+            {
+                if (k < Data->Packs[i].Count)
+                    Packs[i].Triangles[k] = MeshIndex(Data->Packs[i].Triangles[k] - Data->Triangles);
+                else
+                    Packs[i].Triangles[k] = -1;
+            }
+        }
+    }
+
+    memset(&Header, 0, sizeof(Header));
+
+    memcpy(Header.Magic, MESH_FILE_MAGIC, sizeof(MESH_FILE_MAGIC));
+
+    Header.Version       = MESH_FILE_VERSION;
+    Header.Byte_Order    = MESH_FILE_BYTE_ORDER;
+    Header.Vector_Size   = sizeof(MeshVector);
+    Header.UV_Size       = sizeof(MeshUVVector);
+    Header.Triangle_Size = sizeof(MESH_TRIANGLE);
+    Header.Node_Size     = sizeof(Mesh_File_Node);
+    Header.Flags         = (has_inside_vector ? MESH_FILE_INSIDE_VECTOR : 0) |
+                           (Fully_Textured ? MESH_FILE_FULLY_TEXTURED : 0);
+
+    Header.Number_Of_Vertices  = Data->Number_Of_Vertices;
+    Header.Number_Of_Normals   = Data->Number_Of_Normals;
+    Header.Number_Of_UVCoords  = Data->Number_Of_UVCoords;
+    Header.Number_Of_Triangles = Data->Number_Of_Triangles;
+    Header.Number_Of_Textures  = Number_Of_Textures;
+    Header.Number_Of_Nodes     = MeshIndex(Nodes.size());
+    Header.Number_Of_Packs     = MeshIndex(Packs.size());
+
+    if (has_inside_vector)
     {
-        UV_Hash_Table[i] = nullptr;
+        Header.Inside_Vect[X] = Data->Inside_Vect[X];
+        Header.Inside_Vect[Y] = Data->Inside_Vect[Y];
+        Header.Inside_Vect[Z] = Data->Inside_Vect[Z];
     }
-    /* NK ---- */
+
+    mesh_file_layout(Header, Layout);
+
+    Position = 0;
+
+    return write_mesh_file_section(stream, Position, 0, &Header, sizeof(Header)) &&
+           write_mesh_file_section(stream, Position, Layout.Vertices, Data->Vertices, Data->Number_Of_Vertices * sizeof(MeshVector)) &&
+           write_mesh_file_section(stream, Position, Layout.Normals, Data->Normals, Data->Number_Of_Normals * sizeof(MeshVector)) &&
+           write_mesh_file_section(stream, Position, Layout.UVCoords, Data->UVCoords, Data->Number_Of_UVCoords * sizeof(MeshUVVector)) &&
+           write_mesh_file_section(stream, Position, Layout.Triangles, Data->Triangles, Data->Number_Of_Triangles * sizeof(MESH_TRIANGLE)) &&
+           write_mesh_file_section(stream, Position, Layout.Nodes, Nodes.data(), Nodes.size() * sizeof(Mesh_File_Node)) &&
+           write_mesh_file_section(stream, Position, Layout.Packs, Packs.data(), Packs.size() * sizeof(Mesh_File_Pack)) &&
+           write_mesh_file_section(stream, Position, Layout.Size, nullptr, 0);
 }
 
 
@@ -1931,17 +3704,21 @@ void Mesh::Create_Mesh_Hash_Tables()
 *
 * FUNCTION
 *
-*   Destroy_Mesh_Hash_Tables
+*   mesh_file_layout
 *
 * INPUT
 *
+*   Header - Header of a binary mesh file
+*
 * OUTPUT
 *
+*   Layout - Offsets of the file's sections
+*
 * RETURNS
 *
 * AUTHOR
 *
-*   Dieter Bayer
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
@@ -1949,61 +3726,23 @@ void Mesh::Create_Mesh_Hash_Tables()
 *
 * CHANGES
 *
-*   Feb 1995 : Creation.
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-void Mesh::Destroy_Mesh_Hash_Tables()
+static void mesh_file_layout(const Mesh_File_Header& Header, Mesh_File_Layout& Layout)
 {
-    MeshIndex i;
-    HASH_TABLE *Temp;
-    /* NK 1998 */
-    UV_HASH_TABLE *UVTemp;
-    /* NK ---- */
-
-    for (i = 0; i < HASH_SIZE; i++)
-    {
-        while (Vertex_Hash_Table[i] != nullptr)
-        {
-            Temp = Vertex_Hash_Table[i];
-
-            Vertex_Hash_Table[i] = Temp->Next;
-
-            POV_FREE(Temp);
-        }
-    }
-
-    POV_FREE(Vertex_Hash_Table);
-
-    for (i = 0; i < HASH_SIZE; i++)
-    {
-        while (Normal_Hash_Table[i] != nullptr)
-        {
-            Temp = Normal_Hash_Table[i];
-
-            Normal_Hash_Table[i] = Temp->Next;
-
-            POV_FREE(Temp);
-        }
-    }
-
-    POV_FREE(Normal_Hash_Table);
-
-    /* NK 1998 */
-    for (i = 0; i < HASH_SIZE; i++)
-    {
-        while (UV_Hash_Table[i] != nullptr)
-        {
-            UVTemp = UV_Hash_Table[i];
+    size_t Offset = 0;
 
-            UV_Hash_Table[i] = UVTemp->Next;
-
-            POV_FREE(UVTemp);
-        }
-    }
+    mesh_file_section(Offset, sizeof(Mesh_File_Header));
 
-    POV_FREE(UV_Hash_Table);
-    /* NK ---- */
+    Layout.Vertices  = mesh_file_section(Offset, size_t(Header.Number_Of_Vertices) * sizeof(MeshVector));
+    Layout.Normals   = mesh_file_section(Offset, size_t(Header.Number_Of_Normals) * sizeof(MeshVector));
+    Layout.UVCoords  = mesh_file_section(Offset, size_t(Header.Number_Of_UVCoords) * sizeof(MeshUVVector));
+    Layout.Triangles = mesh_file_section(Offset, size_t(Header.Number_Of_Triangles) * sizeof(MESH_TRIANGLE));
+    Layout.Nodes     = mesh_file_section(Offset, size_t(Header.Number_Of_Nodes) * sizeof(Mesh_File_Node));
+    Layout.Packs     = mesh_file_section(Offset, size_t(Header.Number_Of_Packs) * sizeof(Mesh_File_Pack));
+    Layout.Size      = Offset;
 }
 
 
@@ -2012,22 +3751,24 @@ void Mesh::Destroy_Mesh_Hash_Tables()
 *
 * FUNCTION
 *
-*   get_triangle_vertices
+*   mesh_file_section
 *
 * INPUT
 *
-*   Mesh     - Mesh object
-*   Triangle - Triangle
+*   Offset - Offset of the end of the previous section
+*   Size   - Size of the section
 *
 * OUTPUT
 *
+*   Offset - Offset of the end of the section, including padding
+*
 * RETURNS
 *
-*   P1, P2, P3 - Vertices of the triangle
+*   size_t - Offset of the section
 *
 * AUTHOR
 *
-*   Dieter Bayer
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
@@ -2035,15 +3776,17 @@ void Mesh::Destroy_Mesh_Hash_Tables()
 *
 * CHANGES
 *
-*   Feb 1995 : Creation.
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-void Mesh::get_triangle_vertices(const MESH_TRIANGLE *Triangle, Vector3d& P1, Vector3d& P2, Vector3d& P3) const
+static size_t mesh_file_section(size_t& Offset, size_t Size)
 {
-    P1 = Vector3d(Data->Vertices[Triangle->P1]);
-    P2 = Vector3d(Data->Vertices[Triangle->P2]);
-    P3 = Vector3d(Data->Vertices[Triangle->P3]);
+    size_t Start = Offset;
+
+    Offset = (Offset + Size + MESH_FILE_ALIGNMENT - 1) & ~(MESH_FILE_ALIGNMENT - 1);
+
+    return Start;
 }
 
 
@@ -2052,78 +3795,123 @@ void Mesh::get_triangle_vertices(const MESH_TRIANGLE *Triangle, Vector3d& P1, Ve
 *
 * FUNCTION
 *
-*   get_triangle_normals
+*   write_mesh_file_section
 *
 * INPUT
 *
-*   Mesh     - Mesh object
-*   Triangle - Triangle
+*   stream   - Stream to write to
+*   Position - Number of bytes written so far
+*   Offset   - Offset of the section
+*   Section  - Data of the section
+*   Size     - Size of the section
 *
 * OUTPUT
 *
+*   Position - Number of bytes written so far
+*
 * RETURNS
 *
-*   N1, N2, N3 - Normals of the triangle
+*   bool - false if the section could not be written
 *
 * AUTHOR
 *
-*   Dieter Bayer
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   -
+*   Pad the file with zeros up to the section's offset, then write the
+*   section.
 *
 * CHANGES
 *
-*   Feb 1995 : Creation.
+*   Oct 2026 : Creation.
 *
 ******************************************************************************/
 
-void Mesh::get_triangle_normals(const MESH_TRIANGLE *Triangle, Vector3d& N1, Vector3d& N2, Vector3d& N3) const
+static bool write_mesh_file_section(OStream& stream, size_t& Position, size_t Offset, const void *Section, size_t Size)
 {
-    N1 = Vector3d(Data->Normals[Triangle->N1]);
-    N2 = Vector3d(Data->Normals[Triangle->N2]);
-    N3 = Vector3d(Data->Normals[Triangle->N3]);
+    static const char Padding[MESH_FILE_ALIGNMENT] = { 0 };
+
+    if (Offset > Position)
+    {
+        if (!stream.write(Padding, Offset - Position))
+        {
+            return false;
+        }
+
+        Position = Offset;
+    }
+
+    if (Size > 0)
+    {
+        if (!stream.write(Section, Size))
+        {
+            return false;
+        }
+
+        Position += Size;
+    }
+
+    return true;
 }
 
 
+
 /*****************************************************************************
 *
 * FUNCTION
 *
-*   get_triangle_uvcoords
+*   collect_bbox_nodes
 *
 * INPUT
 *
-*   Mesh     - Mesh object
-*   Triangle - Triangle
+*   Node  - Bounding box tree node
+*   Packs - Triangle packs of the mesh
 *
 * OUTPUT
 *
-* RETURNS
+*   Nodes - Nodes of the subtree, appended in pre-order
 *
-*   UV1, UV2, UV3 - UV coordinates of the triangle's corners
+* RETURNS
 *
 * AUTHOR
 *
-*   Nathan Kopp
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   adapted from get_triangle_normals
+*   -
 *
 * CHANGES
 *
+*   Oct 2026 : Creation.
+*
 ******************************************************************************/
 
-void Mesh::get_triangle_uvcoords(const MESH_TRIANGLE *Triangle, Vector2d& UV1, Vector2d& UV2, Vector2d& UV3) const
+static void collect_bbox_nodes(const BBOX_TREE *Node, const MESH_TRIANGLE_PACK *Packs, vector<Mesh_File_Node>& Nodes)
 {
-    UV1 = Vector2d(Data->UVCoords[Triangle->UV1]);
-    UV2 = Vector2d(Data->UVCoords[Triangle->UV2]);
-    UV3 = Vector2d(Data->UVCoords[Triangle->UV3]);
+    Mesh_File_Node Record;
+    short i;
+
+    Record.BBox    = Node->BBox;
+    Record.Entries = Node->Entries;
+    Record.Pack    = -1;
+
+    if (Node->Entries == 0)
+    {
+        Record.Pack = MeshIndex(reinterpret_cast<const MESH_TRIANGLE_PACK *>(Node->Node) - Packs);
+    }
+
+    Nodes.push_back(Record);
+
+    for (i = 0; i < Node->Entries; i++)
+    {
+        collect_bbox_nodes(Node->Node[i], Packs, Nodes);
+    }
 }
 
 
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -2250,7 +4038,7 @@ void Mesh::UVCoord(Vector2d& Result, const Intersection *Inter, TraceThreadData
     Vector3d vA, vB;
     Vector3d Side1, Side2;
     const MESH_TRIANGLE *Triangle;
-    Vector3d P;
+    Vector3d P, P1, P2, P3;
 
     if (Trans != nullptr)
         MInvTransPoint(P, Inter->IPoint, Trans);
@@ -2259,14 +4047,16 @@ void Mesh::UVCoord(Vector2d& Result, const Intersection *Inter, TraceThreadData
 
     Triangle = reinterpret_cast<const MESH_TRIANGLE *>(Inter->Pointer);
 
+    get_triangle_vertices(Triangle, P1, P2, P3);
+
     /* ---------------- this is for P1 ---------------- */
     /* Side1 is opposite side, Side2 is an adjacent side (vector pointing away) */
-    Side1 = Vector3d(Data->Vertices[Triangle->P3] - Data->Vertices[Triangle->P2]);
-    Side2 = Vector3d(Data->Vertices[Triangle->P3] - Data->Vertices[Triangle->P1]);
+    Side1 = P3 - P2;
+    Side2 = P3 - P1;
 
     /* find A */
     /* A is a vector from this vertex to the intersection point */
-    vA = P - Vector3d(Data->Vertices[Triangle->P1]);
+    vA = P - P1;
 
     /* find B */
     /* B is a vector from this intersection to the opposite side (Side1) */
@@ -2284,11 +4074,11 @@ void Mesh::UVCoord(Vector2d& Result, const Intersection *Inter, TraceThreadData
     w1 = 1+t1/t2;
 
     /* ---------------- this is for P2 ---------------- */
-    Side1 = Vector3d(Data->Vertices[Triangle->P3] - Data->Vertices[Triangle->P1]);
-    Side2 = Vector3d(Data->Vertices[Triangle->P3] - Data->Vertices[Triangle->P2]);
+    Side1 = P3 - P1;
+    Side2 = P3 - P2;
 
     /* find A */
-    vA = P - Vector3d(Data->Vertices[Triangle->P2]);
+    vA = P - P2;
 
     /* find B */
     t1 = dot(Side2, Side1);
@@ -2301,11 +4091,11 @@ void Mesh::UVCoord(Vector2d& Result, const Intersection *Inter, TraceThreadData
     w2 = 1+t1/t2;
 
     /* ---------------- this is for P3 ---------------- */
-    Side1 = Vector3d(Data->Vertices[Triangle->P2] - Data->Vertices[Triangle->P1]);
-    Side2 = Vector3d(Data->Vertices[Triangle->P2] - Data->Vertices[Triangle->P3]);
+    Side1 = P2 - P1;
+    Side2 = P2 - P3;
 
     /* find A */
-    vA = P - Vector3d(Data->Vertices[Triangle->P3]);
+    vA = P - P3;
 
     /* find B */
     t1 = dot(Side2, Side1);
@@ -2359,6 +4149,8 @@ bool Mesh::inside_bbox_tree(const BasicRay &ray, TraceThreadData *Thread) const
     MeshIndex i, found;
     DBL Best, Depth;
     const BBOX_TREE *Node, *Root;
+    const MESH_TRIANGLE_PACK *Pack;
+    unsigned int Candidates;
 
     /* Create the direction vectors for this ray. */
     Rayinfo rayinfo(ray);
@@ -2393,14 +4185,21 @@ bool Mesh::inside_bbox_tree(const BasicRay &ray, TraceThreadData *Thread) const
         }
         else
         {
-            /* This is a leaf so test the contained triangle. */
+            /* This is a leaf so test the contained triangles. */
+
+            Pack = reinterpret_cast<const MESH_TRIANGLE_PACK *>(Node->Node);
 
-            if (intersect_mesh_triangle(ray, reinterpret_cast<MESH_TRIANGLE *>(Node->Node), &Depth))
+            Candidates = test_triangle_pack(ray, Pack);
+
+            for (i = 0; i < Pack->Count; i++)
             {
-                /* actually, this should push onto a local depth stack and
-                   make sure that we don't have the same intersection point from
-                   two (or three) different triangles!!!!! */
-                found++;
+                if ((Candidates & (1u << i)) && intersect_mesh_triangle(ray, Pack->Triangles[i], &Depth))
+                {
+                    /* actually, this should push onto a local depth stack and
+                       make sure that we don't have the same intersection point from
+                       two (or three) different triangles!!!!! */
+                    found++;
+                }
             }
         }
     }
@@ -2427,9 +4226,7 @@ void Mesh::Determine_Textures(Intersection *isect, bool hitinside, WeightedTextu
         else
             epoint = isect->IPoint;
 
-        p1 = Vector3d(Data->Vertices[tri->P1]);
-        p2 = Vector3d(Data->Vertices[tri->P2]);
-        p3 = Vector3d(Data->Vertices[tri->P3]);
+        get_triangle_vertices(tri, p1, p2, p3);
 
         w1 = 1.0 - COLC(SmoothTriangle::Calculate_Smooth_T(epoint, p1, p2, p3));
         w2 = 1.0 - COLC(SmoothTriangle::Calculate_Smooth_T(epoint, p2, p3, p1));
@@ -2447,4 +4244,210 @@ void Mesh::Determine_Textures(Intersection *isect, bool hitinside, WeightedTextu
         textures.push_back(WeightedTexture(1.0, Texture));
 }
 
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   MeshTreeBuilder::MeshTreeBuilder
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*   Oct 2026 : Trees are built on the job scheduler instead of dedicated
+*              worker threads.
+*
+******************************************************************************/
+
+MeshTreeBuilder::MeshTreeBuilder()
+{
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   MeshTreeBuilder::~MeshTreeBuilder
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*   Oct 2026 : Trees are built on the job scheduler instead of dedicated
+*              worker threads.
+*
+******************************************************************************/
+
+MeshTreeBuilder::~MeshTreeBuilder()
+{
+    /* Destroying the job group waits for the remaining trees. */
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   MeshTreeBuilder::Build
+*
+* INPUT
+*
+*   mesh - Mesh to build the tree for
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Small meshes are built right away, as handing them over would cost
+*   more than it saves. For larger ones a shell sharing the mesh data is
+*   queued, keeping the data alive until the tree is finished.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*   Oct 2026 : Trees are built on the job scheduler instead of dedicated
+*              worker threads.
+*
+******************************************************************************/
+
+void MeshTreeBuilder::Build(Mesh *mesh)
+{
+    Mesh *shell;
+
+    if (!Test_Flag(mesh, HIERARCHY_FLAG) || (mesh->Data->Number_Of_Triangles < MESH_DEFERRED_BUILD_MIN_TRIANGLES))
+    {
+        mesh->Build_Mesh_BBox_Tree();
+
+        return;
+    }
+
+    shell = new Mesh();
+
+    shell->Data = mesh->Data;
+    shell->Data->References++;
+
+    mJobs.Run(boost::bind(&MeshTreeBuilder::Work, shell));
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   MeshTreeBuilder::Wait
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*   Oct 2026 : Trees are built on the job scheduler instead of dedicated
+*              worker threads.
+*
+******************************************************************************/
+
+void MeshTreeBuilder::Wait()
+{
+    mJobs.Wait();
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   MeshTreeBuilder::Work
+*
+* INPUT
+*
+*   shell - Shell of the mesh to build the tree for
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Job building one queued tree.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*   Oct 2026 : Turned from a worker thread main loop into a job.
+*
+******************************************************************************/
+
+void MeshTreeBuilder::Work(Mesh *shell)
+{
+    try
+    {
+        shell->Build_Mesh_BBox_Tree();
+    }
+    catch (...)
+    {
+        /* Dropping the shell releases the data if the mesh is gone by now. */
+
+        delete shell;
+
+        throw;
+    }
+
+    delete shell;
+}
+
 }
@@ -39,6 +39,13 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include <atomic>
+
+#include "base/fileinputoutput.h"
+#include "base/filemapping.h"
+#include "base/jobscheduler.h"
+#include "base/memoryarena.h"
+
 #include "core/scene/object.h"
 
 namespace pov
@@ -70,6 +77,8 @@ typedef struct BBox_Tree_Struct BBOX_TREE;
 
 typedef struct Mesh_Data_Struct MESH_DATA;
 typedef struct Mesh_Triangle_Struct MESH_TRIANGLE;
+typedef struct Mesh_Triangle_Pack_Struct MESH_TRIANGLE_PACK;
+typedef struct Mesh_Pack_Geometry_Struct MESH_PACK_GEOMETRY;
 
 typedef struct Hash_Table_Struct HASH_TABLE;
 typedef struct UV_Hash_Table_Struct UV_HASH_TABLE;
@@ -81,9 +90,21 @@ typedef SnglVector3d MeshVector;   ///< Data type used to store vertices and nor
 typedef Vector2d     MeshUVVector; ///< Data type used to store UV coordinates.
 typedef signed int   MeshIndex;    ///< Data type used to store indices into vertices / normals / uv coordinate / texture tables. Must be signed and able to hold 2*max.
 
+/// Vertex of a compact mesh, quantised to 16 bits per axis within the mesh's bounds.
+struct MeshQVector
+{
+    unsigned short Coord[3];
+};
+
+/// Normal of a compact mesh, as a unit vector in 16 bit octahedral encoding.
+struct MeshOctNormal
+{
+    signed short U, V;
+};
+
 struct Mesh_Data_Struct
 {
-    int References;                    ///< Number of references to the mesh.
+    std::atomic<int> References;       ///< Number of references to the mesh, which may be held by other threads.
     MeshIndex Number_Of_UVCoords;      ///< Number of UV coords in the mesh.
     MeshIndex Number_Of_Normals;       ///< Number of normals in the mesh.
     MeshIndex Number_Of_Triangles;     ///< Number of trinagles in the mesh.
@@ -92,7 +113,16 @@ struct Mesh_Data_Struct
     MeshUVVector *UVCoords;            ///< Array of UV coordinates
     MESH_TRIANGLE *Triangles;          ///< Array of triangles.
     BBOX_TREE *Tree;                   ///< Bounding box tree for mesh.
+    MESH_TRIANGLE_PACK *Packs;         ///< Array of triangle packs referenced by the tree's leaves.
+    MESH_PACK_GEOMETRY *Pack_Geometry; ///< Array of single precision copies of the packs, or `nullptr` for compact meshes.
+    MeshIndex Number_Of_Packs;         ///< Number of triangle packs in the mesh.
     Vector3d Inside_Vect;              ///< vector to use to test 'inside'
+    MeshQVector *QVertices;            ///< Quantised vertices of a compact mesh, replacing @ref Vertices; `nullptr` otherwise.
+    MeshOctNormal *QNormals;           ///< Encoded normals of a compact mesh, replacing @ref Normals.
+    Vector3d QOrigin;                  ///< Origin of the vertex quantisation grid of a compact mesh.
+    Vector3d QScale;                   ///< Spacing of the vertex quantisation grid of a compact mesh.
+    MappedFile *File;                  ///< Binary mesh file that the vertex, normal, UV coordinate and triangle arrays are mapped from (read-only), or `nullptr`.
+    std::atomic<size_t> Accounted_Size; ///< Memory accounted for the mesh data so far.
 };
 
 struct Mesh_Triangle_Struct
@@ -112,6 +142,33 @@ struct Mesh_Triangle_Struct
     unsigned int Dominant_Axis:2;  ///< Dominant axis.
     unsigned int vAxis:2;          ///< Axis for smooth triangle.
     unsigned int ThreeTex:1;       ///< Color Triangle Patch.
+    unsigned int Swapped:1;        ///< Vertices were reordered, reversing the winding given in the scene.
+};
+
+/// Leaf of a mesh's bounding box tree, holding up to four triangles.
+///
+/// Unless the mesh is compact, each pack has a single precision copy of its triangles' geometry,
+/// so that all of them can be tested against a ray at once. As this test is only meant to weed
+/// out misses, each candidate it reports is confirmed using the triangle's own data.
+///
+struct Mesh_Triangle_Pack_Struct
+{
+    const MESH_TRIANGLE *Triangles[4];      ///< Triangles in the pack.
+    int Count;                              ///< Number of triangles in the pack.
+    const MESH_PACK_GEOMETRY *Geometry;     ///< Single precision copy of the triangles, or `nullptr` for compact meshes.
+};
+
+/// Geometry of a triangle pack, in structure-of-arrays form and single precision, relative to a
+/// common reference point.
+///
+struct Mesh_Pack_Geometry_Struct
+{
+    float V0[3][4];                         ///< First vertex of each triangle, relative to @ref Centre.
+    float E1[3][4];                         ///< Edge from first to second vertex of each triangle.
+    float E2[3][4];                         ///< Edge from first to third vertex of each triangle.
+    float Extent[4];                        ///< Sum of the edge lengths of each triangle.
+    Vector3d Centre;                        ///< Reference point of the pack.
+    DBL Radius;                             ///< Largest distance of any vertex from @ref Centre.
 };
 
 struct Hash_Table_Struct
@@ -158,6 +215,61 @@ class Mesh : public ObjectBase
         bool Compute_Mesh_Triangle(MESH_TRIANGLE *Triangle, bool Smooth, const Vector3d& P1, const Vector3d& P2, const Vector3d& P3, Vector3d& S_Normal) const;
 
         void Build_Mesh_BBox_Tree();
+
+        /// Convert the mesh to compact storage.
+        ///
+        /// Vertices are quantised to 16 bits per axis within the mesh's bounds, and the normals
+        /// of smooth triangles are stored in octahedral encoding, merging those that become
+        /// equal. Flat triangle normals are no longer stored but derived from the vertices when
+        /// needed, and the bounding box tree's leaves do without a single precision copy of
+        /// their triangles. The triangles are set up again from the quantised vertices.
+        ///
+        /// @note   Must be called before @ref Build_Mesh_BBox_Tree().
+        ///
+        void Compact_Mesh();
+
+        /// Set up the mesh from a memory-mapped binary mesh file.
+        ///
+        /// The mesh's vertex, normal, UV coordinate and triangle arrays are used in place, and
+        /// the mesh takes ownership of the file. The file's bounding box tree, if any, is used
+        /// by @ref Build_Mesh_BBox_Tree() instead of building a new one. Textures are not part
+        /// of the file, and must be supplied by the caller.
+        ///
+        /// @param[in]  file        Mapped binary mesh file.
+        /// @param[out] textures    Number of textures referenced by the triangles.
+        /// @return                 `false` if the file is not a valid binary mesh file for
+        ///                         this platform, in which case the mesh is not set up and
+        ///                         the file is not taken over.
+        ///
+        bool Map_Mesh_File(MappedFile *file, MeshIndex& textures);
+
+        /// Write the mesh to a binary mesh file.
+        ///
+        /// The file holds the mesh's data in its in-memory layout, so that it can be mapped
+        /// directly, and is thus only meant to be read on the same platform by the same build.
+        ///
+        /// @note   Must be called after @ref Build_Mesh_BBox_Tree(), and not for compact meshes.
+        ///
+        /// @param  stream  Stream to write to.
+        /// @return         `false` if the file could not be written.
+        ///
+        bool Write_Mesh_File(OStream& stream) const;
+
+        void get_triangle_vertices(const MESH_TRIANGLE *Triangle, Vector3d& P1, Vector3d& P2, Vector3d& P3) const;
+        void get_triangle_normal(const MESH_TRIANGLE *Triangle, Vector3d& N) const;
+
+        /// Set up the mesh from plain vertex and triangle lists.
+        ///
+        /// This is meant for meshes generated from other shapes. Vertices are not merged, and
+        /// degenerate triangles are dropped.
+        ///
+        /// @param  vertices    Vertex positions.
+        /// @param  uvcoords    UV coordinates of each vertex, or empty to give all vertices the
+        ///                     UV coordinates (0,0).
+        /// @param  triangles   Three indices into @p vertices per triangle.
+        /// @return             `false` if no triangles are left, in which case the mesh is not set up.
+        ///
+        bool Init_From_Triangles(const vector<Vector3d>& vertices, const vector<Vector2d>& uvcoords, const vector<MeshIndex>& triangles);
         bool Degenerate(const Vector3d& P1, const Vector3d& P2, const Vector3d& P3);
         void Init_Mesh_Triangle(MESH_TRIANGLE *Triangle);
         void Destroy_Mesh_Hash_Tables();
@@ -178,7 +290,12 @@ class Mesh : public ObjectBase
         void get_triangle_bbox(const MESH_TRIANGLE *Triangle, BoundingBox *BBox) const;
         bool intersect_bbox_tree(const BasicRay& ray, const BasicRay& Orig_Ray, DBL len, IStack& Depth_Stack, TraceThreadData *Thread);
         bool inside_bbox_tree(const BasicRay& ray, TraceThreadData *Thread) const;
-        void get_triangle_vertices(const MESH_TRIANGLE *Triangle, Vector3d& P1, Vector3d& P2, Vector3d& P3) const;
+        bool restore_bbox_tree();
+        void account_data();
+        void build_triangle_packs(BBOX_TREE *Node, vector<BBOX_TREE *>& Leaves, vector<const MESH_TRIANGLE *>& Members) const;
+        void init_triangle_pack(MESH_TRIANGLE_PACK *Pack, MESH_PACK_GEOMETRY *Geometry, const MESH_TRIANGLE * const *Triangles, int Count) const;
+        Vector3d get_vertex(MeshIndex Index) const;
+        Vector3d get_normal(MeshIndex Index) const;
         void get_triangle_normals(const MESH_TRIANGLE *Triangle, Vector3d& N1, Vector3d& N2, Vector3d& N3) const;
         void get_triangle_uvcoords(const MESH_TRIANGLE *Triangle, Vector2d& U1, Vector2d& U2, Vector2d& U3) const;
         static MeshIndex mesh_hash(HASH_TABLE **Hash_Table, MeshIndex *Number, MeshIndex *Max, MeshVector **Elements, const Vector3d& aPoint);
@@ -189,6 +306,49 @@ private:
         static HASH_TABLE **Vertex_Hash_Table;
         static HASH_TABLE **Normal_Hash_Table;
         static UV_HASH_TABLE **UV_Hash_Table;
+        static MemoryArena Hash_Arena; // holds the entries of all three hash tables
+};
+
+/// Builder of mesh bounding box trees on the job scheduler.
+///
+/// This allows the parser to go on while the trees of large meshes are being built. Each
+/// queued mesh is represented by a private mesh object sharing the mesh's data, so the mesh
+/// itself may be copied or destroyed in the meantime; but its tree must not be used before
+/// @ref Wait() has returned.
+///
+class MeshTreeBuilder
+{
+    public:
+
+        MeshTreeBuilder();
+
+        /// Destroy the builder, after finishing all queued meshes.
+        ///
+        ~MeshTreeBuilder();
+
+        /// Build a mesh's bounding box tree, on a worker thread if the mesh is large enough.
+        ///
+        /// @param  mesh    Mesh whose data and modifiers have been set up completely.
+        ///
+        void Build(Mesh *mesh);
+
+        /// Wait until all queued meshes are finished.
+        ///
+        /// @note   Any error that occurred while building a tree is re-thrown here.
+        ///
+        void Wait();
+
+    private:
+
+        JobGroup mJobs;                     ///< Trees being built on the job scheduler.
+
+        static void Work(Mesh *shell);
+
+        /// not available
+        MeshTreeBuilder(const MeshTreeBuilder&);
+
+        /// not available
+        MeshTreeBuilder& operator=(const MeshTreeBuilder&);
 };
 
 /// @}
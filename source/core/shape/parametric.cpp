@@ -42,6 +42,7 @@
 #include "core/math/matrix.h"
 #include "core/render/ray.h"
 #include "core/scene/tracethreaddata.h"
+#include "core/shape/mesh.h"
 
 // this must be the last file included
 #include "base/povdebug.h"
@@ -108,6 +109,9 @@ bool Parametric::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThr
     DBL Intervals_Hi[2][32];
     int SectorNum[32];
 
+    if ((secondaryMesh != nullptr) && (ray.IsShadowTestRay() || ray.IsRadiosityRay() || ray.IsPhotonRay()))
+        return Secondary_Mesh_Intersections(ray, Depth_Stack, Thread);
+
     Thread->Stats()[Ray_Par_Bound_Tests]++;
 
     if (!container->Intersect(ray, Trans, Depth1, Depth2, Side1, Side2))
@@ -623,6 +627,8 @@ void Parametric::Transform(const TRANSFORM* tr)
     if (Trans == nullptr)
         Trans = Create_Transform();
     Compose_Transforms(Trans, tr);
+    if (secondaryMesh != nullptr)
+        secondaryMesh->Transform(tr);
     Compute_BBox();
 }
 
@@ -665,6 +671,9 @@ ObjectPtr Parametric::Copy()
 
     New->container = shared_ptr<ContainedByShape>(container->Copy());
 
+    if (secondaryMesh != nullptr)
+        New->secondaryMesh = static_cast<Mesh *>(secondaryMesh->Copy());
+
     return (New);
 }
 
@@ -699,6 +708,7 @@ Parametric::~Parametric()
     delete Function[1];
     delete Function[2];
     Destroy_PrecompParVal();
+    delete secondaryMesh;
 }
 
 
@@ -740,6 +750,8 @@ Parametric::Parametric() : NonsolidObject(PARAMETRIC_OBJECT)
     accuracy = 0.001;
     max_gradient = 1;
     PData = nullptr;
+    secondaryMesh = nullptr;
+    secondaryTolerance = 0.0;
 }
 
 
@@ -922,6 +934,170 @@ void Parametric::Precompute_Parametric_Values(char flags, int depth, TraceThread
 }
 
 
+/*****************************************************************************
+ *
+ * FUNCTION
+ *
+ *   Parametric::Build_Secondary_Mesh
+ *
+ * INPUT
+ *
+ *   resolution - Number of grid cells along each of U and V
+ *   Thread     - Thread data used to evaluate the functions
+ *
+ * OUTPUT
+ *
+ * RETURNS
+ *
+ *   bool - false if no part of the surface lies within the container
+ *
+ * AUTHOR
+ *
+ *   POV-Ray Team
+ *
+ * DESCRIPTION
+ *
+ *   Tessellate the surface along a regular grid in UV space, two triangles
+ *   per cell. Cells with any corner outside the container are left out.
+ *
+ * CHANGES
+ *
+ *   -
+ *
+ ******************************************************************************/
+
+bool Parametric::Build_Secondary_Mesh(int resolution, TraceThreadData *Thread)
+{
+    const int n = resolution + 1;
+    std::array<GenericScalarFunctionInstance,3> aFn = {
+        GenericScalarFunctionInstance(Function[0], Thread),
+        GenericScalarFunctionInstance(Function[1], Thread),
+        GenericScalarFunctionInstance(Function[2], Thread)
+    };
+    vector<Vector3d> vertices(n * n);
+    vector<Vector2d> uvcoords(n * n);
+    vector<bool> outside(n * n);
+    vector<MeshIndex> triangles;
+    Vector2d uv;
+    DBL diagonal = 0.0;
+
+    for (int v = 0, i = 0; v < n; v++)
+    {
+        for (int u = 0; u < n; u++, i++)
+        {
+            uv[U] = umin + (umax - umin) * u / resolution;
+            uv[V] = vmin + (vmax - vmin) * v / resolution;
+            uvcoords[i] = uv;
+            vertices[i] = Vector3d(aFn[X].Evaluate(uv), aFn[Y].Evaluate(uv), aFn[Z].Evaluate(uv));
+            outside[i] = !container->Inside(vertices[i]);
+        }
+    }
+
+    for (int v = 0; v < resolution; v++)
+    {
+        for (int u = 0; u < resolution; u++)
+        {
+            MeshIndex p1 = v * n + u;
+            MeshIndex p2 = p1 + 1;
+            MeshIndex p3 = p2 + n;
+            MeshIndex p4 = p1 + n;
+
+            if (outside[p1] || outside[p2] || outside[p3] || outside[p4])
+                continue;
+
+            triangles.push_back(p1); triangles.push_back(p2); triangles.push_back(p3);
+            triangles.push_back(p1); triangles.push_back(p3); triangles.push_back(p4);
+
+            diagonal = max(diagonal, max((vertices[p3] - vertices[p1]).length(), (vertices[p4] - vertices[p2]).length()));
+        }
+    }
+
+    delete secondaryMesh;
+    secondaryMesh = new Mesh();
+
+    if (!secondaryMesh->Init_From_Triangles(vertices, uvcoords, triangles))
+    {
+        delete secondaryMesh;
+        secondaryMesh = nullptr;
+        return false;
+    }
+
+    if (Trans != nullptr)
+        secondaryMesh->Transform(Trans);
+
+    // the mesh may be off the surface by up to about a cell's diagonal
+    secondaryTolerance = diagonal;
+
+    return true;
+}
+
+
+/*****************************************************************************
+ *
+ * FUNCTION
+ *
+ *   Parametric::Secondary_Mesh_Intersections
+ *
+ * INPUT
+ *
+ * OUTPUT
+ *
+ * RETURNS
+ *
+ * AUTHOR
+ *
+ *   POV-Ray Team
+ *
+ * DESCRIPTION
+ *
+ *   Intersect a ray with the tessellated surface. Hits close to the ray's
+ *   origin are ignored, as rays leaving the exact surface would otherwise hit
+ *   the mesh right away. The hits are reported as hits on the parametric
+ *   surface, with UV coordinates interpolated across the triangle hit.
+ *
+ * CHANGES
+ *
+ *   -
+ *
+ ******************************************************************************/
+
+bool Parametric::Secondary_Mesh_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    Vector3d Dlocal;
+    Vector2d uv;
+    DBL minDepth;
+    bool found = false;
+
+    if (Trans != nullptr)
+        MInvTransDirection(Dlocal, ray.Direction, Trans);
+    else
+        Dlocal = ray.Direction;
+
+    minDepth = secondaryTolerance / Dlocal.length();
+
+    IStack Local_Stack(Thread->stackPool);
+    POV_REFPOOL_ASSERT(Local_Stack->empty()); // verify that the IStack pulled from the pool is in a cleaned-up condition
+
+    secondaryMesh->All_Intersections(ray, Local_Stack, Thread);
+
+    while (Local_Stack->size() > 0)
+    {
+        const Intersection& Local = Local_Stack->top();
+
+        if ((Local.Depth > minDepth) && (Clip.empty() || Point_In_Clip(Local.IPoint, Clip, Thread)))
+        {
+            secondaryMesh->UVCoord(uv, &Local, Thread);
+            Depth_Stack->push(Intersection(Local.Depth, Local.IPoint, uv, this));
+            found = true;
+        }
+
+        Local_Stack->pop();
+    }
+
+    return found;
+}
+
+
 /*****************************************************************************
  *
  * FUNCTION
@@ -1079,13 +1255,21 @@ void Parametric::Evaluate_Function_Interval_UV(GenericScalarFunctionInstance& fn
     DBL f_0_min, f_0_max;
     DBL f_1_min, f_1_max;
     DBL junk;
+    DBL args[4 * 2];
+    DBL f[4];
+
+    /* Calculate the values at each corner, all in one batch */
 
-    /* Calculate the values at each corner */
+    args[0] = fnvec_low[U]; args[1] = fnvec_low[V];
+    args[2] = fnvec_low[U]; args[3] = fnvec_hi[V];
+    args[4] = fnvec_hi[U];  args[5] = fnvec_low[V];
+    args[6] = fnvec_hi[U];  args[7] = fnvec_hi[V];
+    fn.EvaluateBatch(args, 2, 4, f);
 
-    f_0_0 = fn.Evaluate(fnvec_low[U], fnvec_low[V]) - threshold;
-    f_0_1 = fn.Evaluate(fnvec_low[U], fnvec_hi[V])  - threshold;
-    f_1_0 = fn.Evaluate(fnvec_hi[U],  fnvec_low[V]) - threshold;
-    f_1_1 = fn.Evaluate(fnvec_hi[U],  fnvec_hi[V])  - threshold;
+    f_0_0 = f[0] - threshold;
+    f_0_1 = f[1] - threshold;
+    f_1_0 = f[2] - threshold;
+    f_1_1 = f[3] - threshold;
 
     /* Determine a min and a max along the left edge of the patch */
     Interval( fnvec_hi[V]-fnvec_low[V], f_0_0, f_0_1, max_gradient, &f_0_min, &f_0_max);
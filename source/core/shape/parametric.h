@@ -82,6 +82,7 @@ struct PrecompParValues_Struct
 };
 
 class FPUContext;
+class Mesh;
 
 class Parametric : public NonsolidObject
 {
@@ -94,6 +95,9 @@ class Parametric : public NonsolidObject
 
         shared_ptr<ContainedByShape> container;
 
+        Mesh *secondaryMesh;        ///< Approximation used for shadow, radiosity and photon rays, or `nullptr`.
+        DBL secondaryTolerance;     ///< Distance from the ray origin within which hits on @ref secondaryMesh are ignored.
+
         Parametric();
         virtual ~Parametric();
 
@@ -110,7 +114,16 @@ class Parametric : public NonsolidObject
         virtual void Compute_BBox();
 
         void Precompute_Parametric_Values(char flags, int depth, TraceThreadData *Thread);
+
+        /// Tessellate the surface into a mesh to use for shadow, radiosity and photon rays.
+        ///
+        /// @param  resolution  Number of grid cells along each of U and V.
+        /// @return             `false` if no part of the surface lies within the container.
+        ///
+        bool Build_Secondary_Mesh(int resolution, TraceThreadData *Thread);
     protected:
+        bool Secondary_Mesh_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread);
+
         void Precomp_Par_Int(int depth, DBL umin, DBL vmin, DBL umax, DBL vmax, GenericScalarFunctionInstance aFn[3]);
         PRECOMP_PAR_DATA *Copy_PrecompParVal();
         void Destroy_PrecompParVal();
@@ -0,0 +1,658 @@
+//******************************************************************************
+///
+/// @file core/shape/pointcloud.cpp
+///
+/// Implementation of the point cloud geometric primitive.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "core/shape/pointcloud.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "base/memoryaccounting.h"
+#include "base/pov_err.h"
+
+#include "core/bounding/boundingbox.h"
+#include "core/material/texture.h"
+#include "core/math/matrix.h"
+#include "core/render/ray.h"
+#include "core/scene/tracethreaddata.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+/*****************************************************************************
+* Local preprocessor defines
+******************************************************************************/
+
+const DBL DEPTH_TOLERANCE = 1e-6;
+
+/// Identifier at the start of a binary particle file.
+const char POINT_CLOUD_FILE_MAGIC[8] = { 'P', 'O', 'V', 'P', 'C', 'L', 'D', 0 };
+
+/// Version of the binary particle file format.
+const unsigned int POINT_CLOUD_FILE_VERSION = 1;
+
+/// Value identifying the byte order of a binary particle file.
+const unsigned int POINT_CLOUD_FILE_BYTE_ORDER = 0x01020304;
+
+/// Flag indicating that a binary particle file holds a radius per particle.
+const unsigned int POINT_CLOUD_FILE_RADII = 1;
+
+/// Flag indicating that a binary particle file holds a texture index per particle.
+const unsigned int POINT_CLOUD_FILE_TEXTURES = 2;
+
+/// Maximum number of particles in a leaf of the hierarchy; also the width of the pre-test.
+const unsigned int POINT_CLOUD_LEAF_SIZE = CompactBVH::kLeafSize;
+
+/// Safety factor applied to the rounding error estimate of the particle pre-test.
+const DBL POINT_CLOUD_ERROR_FACTOR = 32.0;
+
+/// Header of a binary particle file.
+///
+/// The header is followed by the particles' positions as triples of `float`, then their radii
+/// as `float` if @ref POINT_CLOUD_FILE_RADII is set, and finally their texture indices as
+/// `unsigned short` if @ref POINT_CLOUD_FILE_TEXTURES is set. All data is in the in-memory
+/// layout of the platform reading the file.
+///
+struct Point_Cloud_File_Header
+{
+    char Magic[8];                  ///< @ref POINT_CLOUD_FILE_MAGIC.
+    unsigned int Version;           ///< @ref POINT_CLOUD_FILE_VERSION.
+    unsigned int Byte_Order;        ///< @ref POINT_CLOUD_FILE_BYTE_ORDER.
+    unsigned int Flags;             ///< Combination of the `POINT_CLOUD_FILE_*` flags.
+    unsigned int Count;             ///< Number of particles.
+    float Radius;                   ///< Radius of all particles, if they have none of their own.
+    unsigned int Reserved;
+};
+
+/*****************************************************************************
+* Static functions
+******************************************************************************/
+
+/// Particle positions and radii as read from the file, presented to the hierarchy builder.
+struct PointCloudElements : public CompactBVH::Elements
+{
+    const float *Position;
+    const float *Radii;
+    float Radius;
+    unsigned int Count;
+
+    PointCloudElements(const float *p, const float *r, float rad, unsigned int n) : Position(p), Radii(r), Radius(rad), Count(n) {}
+
+    virtual unsigned int size() const { return Count; }
+    virtual void GetBounds(unsigned int i, Vector3d& Min, Vector3d& Max) const
+    {
+        Vector3d Centre(Position[3*i + X], Position[3*i + Y], Position[3*i + Z]);
+        DBL r = (Radii != nullptr) ? Radii[i] : Radius;
+        Min = Centre - r;
+        Max = Centre + r;
+    }
+};
+
+/*****************************************************************************/
+
+PointCloud::PointCloud() : ObjectBase(POINT_CLOUD_OBJECT)
+{
+    Trans = nullptr;
+
+    Data = nullptr;
+
+    Number_Of_Textures = 0;
+    Textures = nullptr;
+}
+
+ObjectPtr PointCloud::Copy()
+{
+    PointCloud *New = new PointCloud();
+
+    Destroy_Transform(New->Trans);
+    *New = *this;
+    New->Trans = Copy_Transform(Trans);
+
+    New->Data = Data;
+    if (New->Data != nullptr)
+        New->Data->References++;
+
+    if (Textures != nullptr)
+    {
+        New->Textures = reinterpret_cast<TEXTURE **>(POV_MALLOC(Number_Of_Textures*sizeof(TEXTURE *), "point cloud data"));
+        for (int i = 0; i < Number_Of_Textures; i++)
+            New->Textures[i] = Copy_Textures(Textures[i]);
+    }
+
+    return New;
+}
+
+PointCloud::~PointCloud()
+{
+    if (Textures != nullptr)
+    {
+        for (int i = 0; i < Number_Of_Textures; i++)
+            Destroy_Textures(Textures[i]);
+
+        POV_FREE(Textures);
+    }
+
+    if ((Data != nullptr) && (--(Data->References) == 0))
+    {
+        if (Data->X != nullptr)
+            POV_FREE(Data->X);
+        if (Data->Y != nullptr)
+            POV_FREE(Data->Y);
+        if (Data->Z != nullptr)
+            POV_FREE(Data->Z);
+        if (Data->Radii != nullptr)
+            POV_FREE(Data->Radii);
+        if (Data->Textures != nullptr)
+            POV_FREE(Data->Textures);
+        if (Data->Nodes != nullptr)
+            POV_FREE(Data->Nodes);
+
+        MemoryAccounting::Release(kMemoryGeometry, Data->Accounted_Size);
+
+        POV_FREE(Data);
+    }
+}
+
+bool PointCloud::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    const CompactBVH::Node *Stack[CompactBVH::kMaxDepth];
+    const CompactBVH::Node *Node;
+    int Top = 0;
+    bool found = false;
+    DBL len;
+    BasicRay New_Ray;
+    Vector3d InvDir;
+
+    Thread->Stats()[Ray_Point_Cloud_Tests]++;
+
+    // Transform the ray into the point cloud's space.
+
+    if (Trans != nullptr)
+    {
+        MInvTransRay(New_Ray, ray, Trans);
+
+        len = New_Ray.Direction.length();
+        New_Ray.Direction /= len;
+    }
+    else
+    {
+        New_Ray = ray;
+
+        len = 1.0;
+    }
+
+    InvDir = Vector3d(1.0 / New_Ray.Direction[X], 1.0 / New_Ray.Direction[Y], 1.0 / New_Ray.Direction[Z]);
+
+    Node = Data->Nodes;
+
+    if (!CompactBVH::IntersectNode(*Node, New_Ray.Origin, InvDir))
+        return false;
+
+    for (;;)
+    {
+        if (Node->count > 0)
+        {
+            if (intersect_leaf(Node, New_Ray, ray, len, Depth_Stack, Thread))
+                found = true;
+        }
+        else
+        {
+            const CompactBVH::Node *Left  = Node + 1;
+            const CompactBVH::Node *Right = Data->Nodes + Node->index;
+            bool HitLeft  = CompactBVH::IntersectNode(*Left,  New_Ray.Origin, InvDir);
+            bool HitRight = CompactBVH::IntersectNode(*Right, New_Ray.Origin, InvDir);
+
+            if (HitLeft)
+            {
+                if (HitRight)
+                {
+                    POV_ASSERT(Top < CompactBVH::kMaxDepth);
+                    Stack[Top++] = Right;
+                }
+                Node = Left;
+                continue;
+            }
+            else if (HitRight)
+            {
+                Node = Right;
+                continue;
+            }
+        }
+
+        if (Top == 0)
+            break;
+
+        Node = Stack[--Top];
+    }
+
+    if (found)
+        Thread->Stats()[Ray_Point_Cloud_Tests_Succeeded]++;
+
+    return found;
+}
+
+/// Test the particles of a leaf against a ray.
+///
+/// All particles of the leaf are first tested at once in single precision, relative to the point
+/// on the ray closest to the leaf, with tolerances erring on the side of reporting a hit. The
+/// candidates are then intersected in double precision.
+///
+bool PointCloud::intersect_leaf(const CompactBVH::Node *Node, const BasicRay& ray, const BasicRay& Orig_Ray, DBL len, IStack& Depth_Stack, TraceThreadData *Thread)
+{
+    const unsigned int First = Node->index;
+    const unsigned int Count = Node->count;
+    bool found = false;
+
+    Vector3d Centre(0.5 * (DBL(Node->min[X]) + DBL(Node->max[X])),
+                    0.5 * (DBL(Node->min[Y]) + DBL(Node->max[Y])),
+                    0.5 * (DBL(Node->min[Z]) + DBL(Node->max[Z])));
+    DBL HalfDiagonal = 0.5 * Vector3d(DBL(Node->max[X]) - DBL(Node->min[X]),
+                                      DBL(Node->max[Y]) - DBL(Node->min[Y]),
+                                      DBL(Node->max[Z]) - DBL(Node->min[Z])).length();
+
+    // Moving the origin along the ray to the point closest to the leaf leaves the perpendicular
+    // distances unchanged, but keeps the single precision rounding errors small.
+    Vector3d Origin = ray.Origin + ray.Direction * dot(Centre - ray.Origin, ray.Direction);
+    DBL Magnitude = max3(fabs(Origin[X]), fabs(Origin[Y]), fabs(Origin[Z]));
+
+    const float ox = float(Origin[X]), oy = float(Origin[Y]), oz = float(Origin[Z]);
+    const float dx = float(ray.Direction[X]), dy = float(ray.Direction[Y]), dz = float(ray.Direction[Z]);
+
+    // Rounding errors scale with the magnitude of the values involved; the particle positions
+    // are exact, but the origin is not.
+    const float Scale = float(POINT_CLOUD_ERROR_FACTOR * FLT_EPSILON);
+    const float Slack = float(POINT_CLOUD_ERROR_FACTOR * FLT_EPSILON * Magnitude * HalfDiagonal);
+
+    const float *px = Data->X + First;
+    const float *py = Data->Y + First;
+    const float *pz = Data->Z + First;
+
+    float r[POINT_CLOUD_LEAF_SIZE];
+    unsigned int hit[POINT_CLOUD_LEAF_SIZE];
+
+    for (unsigned int k = 0; k < POINT_CLOUD_LEAF_SIZE; k++)
+        r[k] = (Data->Radii != nullptr) ? Data->Radii[First + k] : Data->Radius;
+
+    for (unsigned int k = 0; k < POINT_CLOUD_LEAF_SIZE; k++)
+    {
+        const float tx = px[k] - ox;
+        const float ty = py[k] - oy;
+        const float tz = pz[k] - oz;
+
+        const float b  = tx * dx + ty * dy + tz * dz;
+        const float tt = tx * tx + ty * ty + tz * tz;
+        const float rr = r[k] * r[k];
+
+        hit[k] = ((rr - tt + b * b) >= -(Scale * (tt + rr) + Slack)) ? 1u : 0u;
+    }
+
+    unsigned int mask = (hit[0] | (hit[1] << 1) | (hit[2] << 2) | (hit[3] << 3)) & ((1u << Count) - 1);
+
+    Thread->Stats()[Ray_Point_Cloud_Particle_Tests] += Count;
+
+    for (unsigned int k = 0; mask != 0; k++, mask >>= 1)
+    {
+        if ((mask & 1) == 0)
+            continue;
+
+        const unsigned int i = First + k;
+        Vector3d OC = Vector3d(Data->X[i], Data->Y[i], Data->Z[i]) - ray.Origin;
+        DBL Radius = r[k];
+        DBL b = dot(OC, ray.Direction);
+        DBL Discriminant = b * b - (OC.lengthSqr() - Radius * Radius);
+
+        if (Discriminant < 0.0)
+            continue;
+
+        Thread->Stats()[Ray_Point_Cloud_Particle_Tests_Succeeded]++;
+
+        DBL s = sqrt(Discriminant);
+        DBL Depth[2] = { (b - s) / len, (b + s) / len };
+
+        for (int j = 0; j < 2; j++)
+        {
+            if ((Depth[j] > DEPTH_TOLERANCE) && (Depth[j] < MAX_DISTANCE))
+            {
+                Vector3d IPoint = Orig_Ray.Evaluate(Depth[j]);
+
+                if (Clip.empty() || Point_In_Clip(IPoint, Clip, Thread))
+                {
+                    Depth_Stack->push(Intersection(Depth[j], IPoint, this, int(i)));
+                    found = true;
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+bool PointCloud::Inside(const Vector3d& IPoint, TraceThreadData *Thread) const
+{
+    const CompactBVH::Node *Stack[CompactBVH::kMaxDepth];
+    const CompactBVH::Node *Node;
+    int Top = 0;
+    Vector3d P;
+
+    if (Trans != nullptr)
+        MInvTransPoint(P, IPoint, Trans);
+    else
+        P = IPoint;
+
+    Node = Data->Nodes;
+
+    if (!CompactBVH::InsideNode(*Node, P))
+        return Test_Flag(this, INVERTED_FLAG);
+
+    for (;;)
+    {
+        if (Node->count > 0)
+        {
+            for (unsigned int i = Node->index; i < Node->index + Node->count; i++)
+            {
+                DBL Radius = (Data->Radii != nullptr) ? Data->Radii[i] : Data->Radius;
+
+                if ((Vector3d(Data->X[i], Data->Y[i], Data->Z[i]) - P).lengthSqr() <= Sqr(Radius))
+                    return !Test_Flag(this, INVERTED_FLAG);
+            }
+        }
+        else
+        {
+            const CompactBVH::Node *Left  = Node + 1;
+            const CompactBVH::Node *Right = Data->Nodes + Node->index;
+            bool InLeft  = CompactBVH::InsideNode(*Left,  P);
+            bool InRight = CompactBVH::InsideNode(*Right, P);
+
+            if (InLeft)
+            {
+                if (InRight)
+                {
+                    POV_ASSERT(Top < CompactBVH::kMaxDepth);
+                    Stack[Top++] = Right;
+                }
+                Node = Left;
+                continue;
+            }
+            else if (InRight)
+            {
+                Node = Right;
+                continue;
+            }
+        }
+
+        if (Top == 0)
+            break;
+
+        Node = Stack[--Top];
+    }
+
+    return Test_Flag(this, INVERTED_FLAG);
+}
+
+void PointCloud::Normal(Vector3d& Result, Intersection *Inter, TraceThreadData *Thread) const
+{
+    const unsigned int i = (unsigned int)Inter->i1;
+    Vector3d IPoint;
+
+    if (Trans != nullptr)
+        MInvTransPoint(IPoint, Inter->IPoint, Trans);
+    else
+        IPoint = Inter->IPoint;
+
+    Result = IPoint - Vector3d(Data->X[i], Data->Y[i], Data->Z[i]);
+
+    if (Trans != nullptr)
+        MTransNormal(Result, Result, Trans);
+
+    Result.normalize();
+}
+
+void PointCloud::Translate(const Vector3d&, const TRANSFORM *tr)
+{
+    Transform(tr);
+}
+
+void PointCloud::Rotate(const Vector3d&, const TRANSFORM *tr)
+{
+    Transform(tr);
+}
+
+void PointCloud::Scale(const Vector3d&, const TRANSFORM *tr)
+{
+    Transform(tr);
+}
+
+void PointCloud::Transform(const TRANSFORM *tr)
+{
+    if (Trans == nullptr)
+        Trans = Create_Transform();
+
+    Recompute_BBox(&BBox, tr);
+
+    Compose_Transforms(Trans, tr);
+
+    if (!Test_Flag(this, UV_FLAG))
+        for (int i = 0; i < Number_Of_Textures; i++)
+            Transform_Textures(Textures[i], tr);
+}
+
+void PointCloud::Compute_BBox()
+{
+    const CompactBVH::Node *Root = Data->Nodes;
+
+    Make_BBox_from_min_max(BBox, Vector3d(Root->min[X], Root->min[Y], Root->min[Z]),
+                                 Vector3d(Root->max[X], Root->max[Y], Root->max[Z]));
+
+    if (Trans != nullptr)
+        Recompute_BBox(&BBox, Trans);
+}
+
+void PointCloud::Determine_Textures(Intersection *isect, bool hitinside, WeightedTextureVector& textures, TraceThreadData *Threaddata)
+{
+    if ((Interior_Texture != nullptr) && (hitinside == true))
+        textures.push_back(WeightedTexture(1.0, Interior_Texture));
+    else if ((Textures != nullptr) && (Data->Textures != nullptr))
+        textures.push_back(WeightedTexture(1.0, Textures[Data->Textures[isect->i1]]));
+    else if (Texture != nullptr)
+        textures.push_back(WeightedTexture(1.0, Texture));
+}
+
+bool PointCloud::IsOpaque() const
+{
+    if (Test_Flag(this, MULTITEXTURE_FLAG))
+    {
+        for (int i = 0; i < Number_Of_Textures; i++)
+        {
+            // If any particle's texture isn't opaque the point cloud is neither.
+            if ((Textures[i] != nullptr) && !Test_Opacity(Textures[i]))
+                return false;
+        }
+    }
+
+    // Otherwise it's a question of whether the common texture is opaque or not.
+    return (Texture == nullptr) || Test_Opacity(Texture);
+}
+
+bool PointCloud::Load_File(const MappedFile *file, int& textures)
+{
+    const char *Base;
+    const Point_Cloud_File_Header *Header;
+    const float *Position;
+    const float *Radii = nullptr;
+    const unsigned short *Indices = nullptr;
+    size_t Size;
+
+    Base = reinterpret_cast<const char *>(file->GetData());
+
+    if ((Base == nullptr) || (file->GetSize() < sizeof(Point_Cloud_File_Header)))
+        return false;
+
+    Header = reinterpret_cast<const Point_Cloud_File_Header *>(Base);
+
+    if ((memcmp(Header->Magic, POINT_CLOUD_FILE_MAGIC, sizeof(POINT_CLOUD_FILE_MAGIC)) != 0) ||
+        (Header->Version != POINT_CLOUD_FILE_VERSION) ||
+        (Header->Byte_Order != POINT_CLOUD_FILE_BYTE_ORDER) ||
+        ((Header->Flags & ~(POINT_CLOUD_FILE_RADII | POINT_CLOUD_FILE_TEXTURES)) != 0))
+        return false;
+
+    // Particles are identified by an `int` in intersections.
+    if ((Header->Count == 0) || (Header->Count > (unsigned int)INT_MAX) ||
+        (Header->Count > (SIZE_MAX - sizeof(Point_Cloud_File_Header)) / (5 * sizeof(float) + sizeof(unsigned short))))
+        return false;
+
+    Size = sizeof(Point_Cloud_File_Header) + size_t(Header->Count) * 3 * sizeof(float);
+    Position = reinterpret_cast<const float *>(Base + sizeof(Point_Cloud_File_Header));
+
+    if ((Header->Flags & POINT_CLOUD_FILE_RADII) != 0)
+    {
+        Radii = reinterpret_cast<const float *>(Base + Size);
+        Size += size_t(Header->Count) * sizeof(float);
+    }
+    else if (!POV_ISFINITE(Header->Radius) || (Header->Radius <= 0.0f))
+        return false;
+
+    if ((Header->Flags & POINT_CLOUD_FILE_TEXTURES) != 0)
+    {
+        Indices = reinterpret_cast<const unsigned short *>(Base + Size);
+        Size += size_t(Header->Count) * sizeof(unsigned short);
+    }
+
+    if (Size > file->GetSize())
+        return false;
+
+    for (unsigned int i = 0; i < 3 * Header->Count; i++)
+    {
+        if (!POV_ISFINITE(Position[i]))
+            return false;
+    }
+
+    if (Radii != nullptr)
+    {
+        for (unsigned int i = 0; i < Header->Count; i++)
+        {
+            if (!POV_ISFINITE(Radii[i]) || (Radii[i] < 0.0f))
+                return false;
+        }
+    }
+
+    textures = 0;
+    if (Indices != nullptr)
+    {
+        for (unsigned int i = 0; i < Header->Count; i++)
+            textures = max(textures, int(Indices[i]) + 1);
+    }
+
+    Data = reinterpret_cast<PointCloudData *>(POV_MALLOC(sizeof(PointCloudData), "point cloud data"));
+
+    Data->References = 1;
+    Data->Count = Header->Count;
+    Data->Radius = (Radii != nullptr) ? 0.0f : Header->Radius;
+    Data->Accounted_Size = 0;
+
+    build_hierarchy(Position, Radii, Indices);
+
+    return true;
+}
+
+/// Build the bounding volume hierarchy, and store the particles in the order of its leaves.
+void PointCloud::build_hierarchy(const float *Position, const float *Radii, const unsigned short *Indices)
+{
+    const unsigned int Count = Data->Count;
+    // Pad the arrays so that a full leaf can be read starting at any particle.
+    const size_t Padded = size_t(Count) + POINT_CLOUD_LEAF_SIZE - 1;
+    std::vector<unsigned int> Order;
+    std::vector<CompactBVH::Node> Nodes;
+
+    CompactBVH::Build(PointCloudElements(Position, Radii, Data->Radius, Count), Order, Nodes);
+
+    Data->Number_Of_Nodes = (unsigned int)Nodes.size();
+    Data->Nodes = reinterpret_cast<CompactBVH::Node *>(POV_MALLOC(Data->Number_Of_Nodes * sizeof(CompactBVH::Node), "point cloud data"));
+    memcpy(Data->Nodes, Nodes.data(), Data->Number_Of_Nodes * sizeof(CompactBVH::Node));
+
+    Data->X = reinterpret_cast<float *>(POV_MALLOC(Padded * sizeof(float), "point cloud data"));
+    Data->Y = reinterpret_cast<float *>(POV_MALLOC(Padded * sizeof(float), "point cloud data"));
+    Data->Z = reinterpret_cast<float *>(POV_MALLOC(Padded * sizeof(float), "point cloud data"));
+    Data->Radii = (Radii != nullptr) ? reinterpret_cast<float *>(POV_MALLOC(Padded * sizeof(float), "point cloud data")) : nullptr;
+    Data->Textures = (Indices != nullptr) ? reinterpret_cast<unsigned short *>(POV_MALLOC(Count * sizeof(unsigned short), "point cloud data")) : nullptr;
+
+    for (unsigned int i = 0; i < Count; i++)
+    {
+        unsigned int k = Order[i];
+
+        Data->X[i] = Position[3*k + X];
+        Data->Y[i] = Position[3*k + Y];
+        Data->Z[i] = Position[3*k + Z];
+
+        if (Radii != nullptr)
+            Data->Radii[i] = Radii[k];
+
+        if (Indices != nullptr)
+            Data->Textures[i] = Indices[k];
+    }
+
+    for (size_t i = Count; i < Padded; i++)
+    {
+        Data->X[i] = Data->Y[i] = Data->Z[i] = 0.0f;
+
+        if (Radii != nullptr)
+            Data->Radii[i] = 0.0f;
+    }
+
+    account_data();
+}
+
+void PointCloud::account_data()
+{
+    size_t Padded = size_t(Data->Count) + POINT_CLOUD_LEAF_SIZE - 1;
+    size_t Size = sizeof(PointCloudData) + Data->Number_Of_Nodes * sizeof(CompactBVH::Node) + 3 * Padded * sizeof(float);
+
+    if (Data->Radii != nullptr)
+        Size += Padded * sizeof(float);
+
+    if (Data->Textures != nullptr)
+        Size += Data->Count * sizeof(unsigned short);
+
+    MemoryAccounting::Allocate(kMemoryGeometry, Size - Data->Accounted_Size);
+    Data->Accounted_Size = Size;
+}
+
+}
@@ -0,0 +1,149 @@
+//******************************************************************************
+///
+/// @file core/shape/pointcloud.h
+///
+/// Declarations related to the point cloud geometric primitive.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_CORE_POINTCLOUD_H
+#define POVRAY_CORE_POINTCLOUD_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "core/configcore.h"
+
+#include "base/filemapping.h"
+
+#include "core/bounding/compactbvh.h"
+#include "core/scene/object.h"
+
+namespace pov
+{
+
+//##############################################################################
+///
+/// @addtogroup PovCoreShape
+///
+/// @{
+
+//******************************************************************************
+///
+/// @name Object Types
+///
+/// @{
+
+#define POINT_CLOUD_OBJECT (BASIC_OBJECT)
+
+/// @}
+///
+//******************************************************************************
+
+/// Particle data of a point cloud, shared between copies of the object.
+///
+/// The particles are held in packed structure-of-arrays form, in single precision and in the
+/// order of the leaves of the bounding volume hierarchy, so that each leaf refers to a contiguous
+/// range of up to four particles. The arrays are padded so that four particles can be read
+/// starting at any leaf.
+///
+struct PointCloudData
+{
+    int References;                 ///< Number of objects referring to the data.
+    unsigned int Count;             ///< Number of particles.
+    float *X;                       ///< Particle centre x coordinates.
+    float *Y;                       ///< Particle centre y coordinates.
+    float *Z;                       ///< Particle centre z coordinates.
+    float *Radii;                   ///< Particle radii, or `nullptr` if all share @ref Radius.
+    unsigned short *Textures;       ///< Particle texture indices, or `nullptr` if untextured.
+    float Radius;                   ///< Common radius of particles without their own.
+    CompactBVH::Node *Nodes;        ///< Bounding volume hierarchy, root node first.
+    unsigned int Number_Of_Nodes;   ///< Number of nodes in the hierarchy.
+    size_t Accounted_Size;          ///< Memory accounted for the data.
+};
+
+/// Large set of spheres, loaded from a binary particle file.
+///
+/// Each particle takes 16 bytes for its position and radius, 2 bytes for its optional texture
+/// index, and on average some 20 bytes for the nodes of the bounding volume hierarchy, so that
+/// clouds of millions of particles remain affordable where as many sphere objects would not.
+///
+/// The spheres in each leaf of the hierarchy are tested against a ray at once with a
+/// branch-free, four-lane single precision loop written for the compiler to vectorize; as this
+/// test is only meant to weed out misses, each candidate it reports is confirmed in double
+/// precision.
+///
+class PointCloud : public ObjectBase
+{
+    public:
+
+        PointCloudData *Data;           ///< Particle data.
+        int Number_Of_Textures;         ///< Number of textures in @ref Textures.
+        TEXTURE **Textures;             ///< Textures referenced by the particles' indices.
+
+        PointCloud();
+        virtual ~PointCloud();
+
+        virtual ObjectPtr Copy();
+
+        virtual bool All_Intersections(const Ray&, IStack&, TraceThreadData *);
+        virtual bool Inside(const Vector3d&, TraceThreadData *) const;
+        virtual void Normal(Vector3d&, Intersection *, TraceThreadData *) const;
+        virtual void Translate(const Vector3d&, const TRANSFORM *);
+        virtual void Rotate(const Vector3d&, const TRANSFORM *);
+        virtual void Scale(const Vector3d&, const TRANSFORM *);
+        virtual void Transform(const TRANSFORM *);
+        virtual void Compute_BBox();
+        virtual void Determine_Textures(Intersection *, bool, WeightedTextureVector&, TraceThreadData *);
+        virtual bool IsOpaque() const override;
+
+        /// Set up the point cloud from a memory-mapped binary particle file.
+        ///
+        /// The particles are copied out of the file, so the caller remains responsible for it.
+        /// Textures are not part of the file, and must be supplied by the caller.
+        ///
+        /// @param[in]  file        Mapped binary particle file.
+        /// @param[out] textures    Number of textures referenced by the particles.
+        /// @return                 `false` if the file is not a valid binary particle file.
+        ///
+        bool Load_File(const MappedFile *file, int& textures);
+
+    protected:
+
+        void build_hierarchy(const float *Position, const float *Radii, const unsigned short *Textures);
+        bool intersect_leaf(const CompactBVH::Node *Node, const BasicRay& ray, const BasicRay& Orig_Ray, DBL len, IStack& Depth_Stack, TraceThreadData *Thread);
+        void account_data();
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_CORE_POINTCLOUD_H
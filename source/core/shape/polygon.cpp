@@ -85,6 +85,12 @@ const DBL DEPTH_TOLERANCE = 1.0e-8;
 /* If |x| < ZERO_TOLERANCE x is assumed to be 0. */
 const DBL ZERO_TOLERANCE = 1.0e-10;
 
+/* Minimal number of points for the inside test to use horizontal bands. */
+const int BAND_MIN_POINTS = 16;
+
+/* Maximal average number of bands an edge may be filed in. */
+const int BAND_MAX_ENTRIES_PER_EDGE = 8;
+
 
 
 /*****************************************************************************
@@ -214,7 +220,7 @@ bool Polygon::Intersect(const BasicRay& ray, DBL *Depth, TraceThreadData *Thread
     x = p[X] + *Depth * d[X];
     y = p[Y] + *Depth * d[Y];
 
-    if (in_polygon(Data->Number, Data->Points, x, y))
+    if ((Data->Bands > 0) ? in_bands(Data, x, y) : in_polygon(Data->Number, Data->Points, x, y))
     {
         Thread->Stats()[Ray_Polygon_Tests_Succeeded]++;
 
@@ -641,7 +647,7 @@ void Polygon::Compute_Polygon(int number, Vector3d *points)
     int i;
     DBL x, y, z, d;
     Vector3d o, u, v, w, N;
-    MATRIX a, b;
+    MATRIX a, b, c;
 
     /* Create polygon data. */
 
@@ -654,6 +660,8 @@ void Polygon::Compute_Polygon(int number, Vector3d *points)
         Data->Number = number;
 
         Data->Points = new Vector2d[number];
+
+        Data->Bands = 0;
     }
     else
     {
@@ -730,9 +738,11 @@ void Polygon::Compute_Polygon(int number, Vector3d *points)
     b[1][2] =  w[Y];
     b[2][2] =  w[Z];
 
-    MTimesC(Trans->inverse, a, b);
+    MTimesC(c, a, b);
+    MToAffine(Trans->inverse, c);
 
-    MInvers(Trans->matrix, Trans->inverse);
+    MInvers(c, c);
+    MToAffine(Trans->matrix, c);
 
     /* Project points onto the u,v-plane (3D --> 2D) */
 
@@ -760,11 +770,174 @@ void Polygon::Compute_Polygon(int number, Vector3d *points)
 
     S_Normal.normalize();
 
+    Compute_Bands();
+
     Compute_BBox();
 }
 
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Compute_Bands
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* DESCRIPTION
+*
+*   Split the polygon's v range into horizontal bands of equal height and
+*   file each edge with every band its v range overlaps, so that the inside
+*   test only needs to look at the few edges of the band the test point
+*   lies in instead of all of them.
+*
+*   The number of bands starts out at the number of edges, and is halved
+*   until the edges spanning many bands no longer blow up the lists.
+*
+*   Polygons with only a few points are left to the plain crossings test.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void Polygon::Compute_Bands()
+{
+    int i, first, band, lo, hi, entries;
+    DBL vmin, vmax;
+    std::vector<int> edges;
+
+    Data->Bands = 0;
+
+    if ((Data->Number < BAND_MIN_POINTS) || Test_Flag(this, DEGENERATE_FLAG))
+        return;
+
+    /* Collect the edges in_polygon() would test; edge i runs from point i to i+1. */
+    /* Horizontal edges never straddle the test ray, so we leave them out.         */
+
+    first = 0;
+
+    for (i = 1; i < Data->Number; )
+    {
+        if (Data->Points[i-1][Y] != Data->Points[i][Y])
+            edges.push_back(i-1);
+
+        if ((i < Data->Number-2) && (Data->Points[i][X] == Data->Points[first][X]) && (Data->Points[i][Y] == Data->Points[first][Y]))
+        {
+            i += 2;
+
+            first = i-1;
+        }
+        else
+            i++;
+    }
+
+    vmin =  BOUND_HUGE;
+    vmax = -BOUND_HUGE;
+
+    for (i = 0; i < Data->Number; i++)
+    {
+        vmin = min(vmin, Data->Points[i][Y]);
+        vmax = max(vmax, Data->Points[i][Y]);
+    }
+
+    if (edges.empty() || (vmax <= vmin))
+        return;
+
+    /* Find a band count that keeps the lists reasonably short. */
+
+    Data->BandMin = vmin;
+
+    for (Data->Bands = int(edges.size()); ; Data->Bands /= 2)
+    {
+        Data->BandScale = DBL(Data->Bands) / (vmax - vmin);
+
+        entries = 0;
+
+        for (i = 0; i < int(edges.size()); i++)
+        {
+            band_range(edges[i], lo, hi);
+
+            entries += hi - lo + 1;
+        }
+
+        if ((Data->Bands == 1) || (entries <= BAND_MAX_ENTRIES_PER_EDGE * int(edges.size())))
+            break;
+    }
+
+    /* File the edges with the bands. */
+
+    Data->BandStart.assign(Data->Bands + 1, 0);
+    Data->BandEdges.resize(entries);
+
+    for (i = 0; i < int(edges.size()); i++)
+    {
+        band_range(edges[i], lo, hi);
+
+        for (band = lo; band <= hi; band++)
+            Data->BandStart[band+1]++;
+    }
+
+    for (band = 0; band < Data->Bands; band++)
+        Data->BandStart[band+1] += Data->BandStart[band];
+
+    std::vector<int> fill(Data->BandStart.begin(), Data->BandStart.end() - 1);
+
+    for (i = 0; i < int(edges.size()); i++)
+    {
+        band_range(edges[i], lo, hi);
+
+        for (band = lo; band <= hi; band++)
+            Data->BandEdges[fill[band]++] = edges[i];
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   band_range
+*
+* INPUT
+*
+*   edge - First point of the edge
+*
+* OUTPUT
+*
+*   lo, hi - First and last band the edge overlaps
+*
+* RETURNS
+*
+* DESCRIPTION
+*
+*   Find the bands an edge must be filed with. This must map v values to
+*   bands exactly the way in_bands() does.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void Polygon::band_range(int edge, int& lo, int& hi) const
+{
+    DBL v0 = Data->Points[edge][Y];
+    DBL v1 = Data->Points[edge+1][Y];
+
+    lo = min(int((min(v0, v1) - Data->BandMin) * Data->BandScale), Data->Bands-1);
+    hi = min(int((max(v0, v1) - Data->BandMin) * Data->BandScale), Data->Bands-1);
+}
+
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -973,4 +1146,72 @@ bool Polygon::in_polygon(int number, Vector2d *points, DBL u, DBL  v)
     return(inside_flag);
 }
 
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   in_bands
+*
+* INPUT
+*
+*   Data - Polygon data, with bands computed
+*   u, v - 2D-coordinates of the point to test
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   int - true, if inside
+*
+* DESCRIPTION
+*
+*   Same as in_polygon(), but only testing the edges filed with the band
+*   the point lies in.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+bool Polygon::in_bands(const POLYGON_DATA *data, DBL u, DBL v)
+{
+    int i, band, yflag0, yflag1;
+    bool inside_flag;
+    DBL b;
+    const DBL *vtx0, *vtx1;
+
+    /* No edge can straddle a ray below the polygon's v range. */
+
+    if (v <= data->BandMin)
+        return(false);
+
+    /* Rounding may put v at the very top into a band beyond the last, so clamp. */
+
+    b = (v - data->BandMin) * data->BandScale;
+
+    band = int(min(b, DBL(data->Bands-1)));
+
+    inside_flag = false;
+
+    for (i = data->BandStart[band]; i < data->BandStart[band+1]; i++)
+    {
+        vtx0 = &data->Points[data->BandEdges[i]][X];
+        vtx1 = &data->Points[data->BandEdges[i]+1][X];
+
+        yflag0 = (vtx0[Y] >= v);
+        yflag1 = (vtx1[Y] >= v);
+
+        if ((yflag0 != yflag1) &&
+            (((vtx1[Y]-v) * (vtx0[X]-vtx1[X]) >= (vtx1[X]-u) * (vtx0[Y]-vtx1[Y])) == yflag1))
+        {
+            inside_flag = !inside_flag;
+        }
+    }
+
+    return(inside_flag);
+}
+
 }
@@ -39,6 +39,8 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include <vector>
+
 #include "core/scene/object.h"
 
 namespace pov
@@ -74,6 +76,10 @@ struct Polygon_Data_Struct
     int References;
     int Number;
     Vector2d *Points;
+    int Bands;                  /* Number of horizontal bands, 0 if not used    */
+    DBL BandMin, BandScale;     /* Lower v bound of the bands, bands per unit v */
+    std::vector<int> BandStart; /* First entry of each band, plus the end      */
+    std::vector<int> BandEdges; /* First point of each edge crossing a band    */
 };
 
 class Polygon : public NonsolidObject
@@ -100,7 +106,10 @@ class Polygon : public NonsolidObject
         void Compute_Polygon(int number, Vector3d *points);
     protected:
         bool Intersect(const BasicRay& ray, DBL *Depth, TraceThreadData *Thread) const;
+        void Compute_Bands();
+        void band_range(int edge, int& lo, int& hi) const;
         static bool in_polygon(int number, Vector2d *points, DBL u, DBL  v);
+        static bool in_bands(const POLYGON_DATA *data, DBL u, DBL v);
 };
 
 /// @}
@@ -185,13 +185,14 @@ bool Prism::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadDa
 {
     bool Found = false ;
     Vector3d IPoint;
-    int j, n;
+    int i, j, n;
     DBL k, u, v, w, h, len;
     DBL x[4];
     DBL y[3];
     DBL k1, k2, k3;
     Vector3d P, D;
     PRISM_SPLINE_ENTRY *Entry;
+    PRISM_SPLINE_NODE *Node;
     DBL distance ;
 
     /* Don't test degenerate prisms. */
@@ -299,104 +300,130 @@ bool Prism::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadDa
 
             if ((fabs(D[X]) > EPSILON) || (fabs(D[Z]) > EPSILON)) // Quick bailout if ray is parallel to all sides
             {
-                Entry = Spline->Entry;
-                for (j = 0; j < Number; j++, Entry++)
+                i = 0;
+
+                while (i < Spline->Nodes)
                 {
-#ifdef PRISM_EXTRA_STATS
-                    Thread->Stats()[Prism_Bound_Tests]++;
-#endif
-                    /* Test spline's bounding rectangle (modified Cohen-Sutherland). */
-                    if (((D[X] >= 0.0) && (P[X] > Entry->x2)) ||
-                        ((D[X] <= 0.0) && (P[X] < Entry->x1)) ||
-                        ((D[Z] >= 0.0) && (P[Z] > Entry->y2)) ||
-                        ((D[Z] <= 0.0) && (P[Z] < Entry->y1)))
+                    Node = &Spline->Node[i];
+
+                    /* Skip the segments below the node if its bounding rectangle can't be hit. */
+                    if (((D[X] >= 0.0) && (P[X] > Node->x2)) ||
+                        ((D[X] <= 0.0) && (P[X] < Node->x1)) ||
+                        ((D[Z] >= 0.0) && (P[Z] > Node->y2)) ||
+                        ((D[Z] <= 0.0) && (P[Z] < Node->y1)) ||
+                        !test_rectangle(P, D, Node->x1, Node->y1, Node->x2, Node->y2))
                     {
+                        i = Node->Skip;
                         continue;
                     }
 
-                    /* Number of roots found. */
-                    n = 0;
-                    switch (Spline_Type)
+                    if (Node->Number == 0)
                     {
-                        case LINEAR_SPLINE :
+                        i++;
+                        continue;
+                    }
 
+                    Entry = &Spline->Entry[Node->First];
+                    for (j = Node->First; j < Node->First + Node->Number; j++, Entry++)
+                    {
 #ifdef PRISM_EXTRA_STATS
-                            Thread->Stats()[Prism_Bound_Tests_Succeeded]++;
+                        Thread->Stats()[Prism_Bound_Tests]++;
 #endif
-                            /* Solve linear equation. */
-
-                            x[0] = Entry->C[X] * D[Z] - Entry->C[Y] * D[X];
-                            x[1] = D[Z] * (Entry->D[X] - P[X]) - D[X] * (Entry->D[Y] - P[Z]);
-                            if (fabs(x[0]) > EPSILON)
-                                y[n++] = -x[1] / x[0];
-                            break;
+                        /* Test spline's bounding rectangle (modified Cohen-Sutherland). */
+                        if (((D[X] >= 0.0) && (P[X] > Entry->x2)) ||
+                            ((D[X] <= 0.0) && (P[X] < Entry->x1)) ||
+                            ((D[Z] >= 0.0) && (P[Z] > Entry->y2)) ||
+                            ((D[Z] <= 0.0) && (P[Z] < Entry->y1)))
+                        {
+                            continue;
+                        }
 
-                        case QUADRATIC_SPLINE :
+                        /* Number of roots found. */
+                        n = 0;
+                        switch (Spline_Type)
+                        {
+                            case LINEAR_SPLINE :
 
 #ifdef PRISM_EXTRA_STATS
-                            Thread->Stats()[Prism_Bound_Tests_Succeeded]++;
+                                Thread->Stats()[Prism_Bound_Tests_Succeeded]++;
 #endif
+                                /* Solve linear equation. */
 
-                            /* Solve quadratic equation. */
+                                x[0] = Entry->C[X] * D[Z] - Entry->C[Y] * D[X];
+                                x[1] = D[Z] * (Entry->D[X] - P[X]) - D[X] * (Entry->D[Y] - P[Z]);
+                                if (fabs(x[0]) > EPSILON)
+                                    y[n++] = -x[1] / x[0];
+                                break;
 
-                            x[0] = Entry->B[X] * D[Z] - Entry->B[Y] * D[X];
-                            x[1] = Entry->C[X] * D[Z] - Entry->C[Y] * D[X];
-                            x[2] = D[Z] * (Entry->D[X] - P[X]) - D[X] * (Entry->D[Y] - P[Z]);
-
-                            n = Solve_Polynomial(2, x, y, false, 0.0, Thread->Stats());
-                            break;
+                            case QUADRATIC_SPLINE :
 
-                        case CUBIC_SPLINE :
-                        case BEZIER_SPLINE :
-                            if (test_rectangle(P, D, Entry->x1, Entry->y1, Entry->x2, Entry->y2))
-                            {
 #ifdef PRISM_EXTRA_STATS
                                 Thread->Stats()[Prism_Bound_Tests_Succeeded]++;
 #endif
 
-                                /* Solve cubic equation. */
-                                x[0] = Entry->A[X] * D[Z] - Entry->A[Y] * D[X];
-                                x[1] = Entry->B[X] * D[Z] - Entry->B[Y] * D[X];
-                                x[2] = Entry->C[X] * D[Z] - Entry->C[Y] * D[X];
-                                x[3] = D[Z] * (Entry->D[X] - P[X]) - D[X] * (Entry->D[Y] - P[Z]);
-                                n = Solve_Polynomial(3, x, y, Test_Flag(this, STURM_FLAG), 0.0, Thread->Stats());
-                            }
-                            break;
-                    }
+                                /* Solve quadratic equation. */
 
-                    /* Test roots for valid intersections. */
-                    while (n--)
-                    {
-                        w = y[n];
+                                x[0] = Entry->B[X] * D[Z] - Entry->B[Y] * D[X];
+                                x[1] = Entry->C[X] * D[Z] - Entry->C[Y] * D[X];
+                                x[2] = D[Z] * (Entry->D[X] - P[X]) - D[X] * (Entry->D[Y] - P[Z]);
 
-                        if ((w >= 0.0) && (w <= 1.0))
+                                n = Solve_Polynomial(2, x, y, false, 0.0, Thread->Stats());
+                                break;
+
+                            case CUBIC_SPLINE :
+                            case BEZIER_SPLINE :
+                                if (test_rectangle(P, D, Entry->x1, Entry->y1, Entry->x2, Entry->y2))
+                                {
+#ifdef PRISM_EXTRA_STATS
+                                    Thread->Stats()[Prism_Bound_Tests_Succeeded]++;
+#endif
+
+                                    /* Solve cubic equation. */
+                                    x[0] = Entry->A[X] * D[Z] - Entry->A[Y] * D[X];
+                                    x[1] = Entry->B[X] * D[Z] - Entry->B[Y] * D[X];
+                                    x[2] = Entry->C[X] * D[Z] - Entry->C[Y] * D[X];
+                                    x[3] = D[Z] * (Entry->D[X] - P[X]) - D[X] * (Entry->D[Y] - P[Z]);
+                                    n = Solve_Polynomial(3, x, y, Test_Flag(this, STURM_FLAG), 0.0, Thread->Stats());
+                                }
+                                break;
+                        }
+
+                        /* Test roots for valid intersections. */
+                        while (n--)
                         {
-                            if (fabs(D[X]) > EPSILON)
-                            {
-                                k = (w * (w * (w * Entry->A[X] + Entry->B[X]) + Entry->C[X]) + Entry->D[X] - P[X]) / D[X];
-                            }
-                            else
-                            {
-                                k = (w * (w * (w * Entry->A[Y] + Entry->B[Y]) + Entry->C[Y]) + Entry->D[Y] - P[Z]) / D[Z];
-                            }
+                            w = y[n];
 
-                            /* Verify that intersection height is valid. */
-                            h = P[Y] + k * D[Y];
-                            if ((h >= Height1) && (h <= Height2))
+                            if ((w >= 0.0) && (w <= 1.0))
                             {
-                                distance = k / len;
-                                if ((distance > DEPTH_TOLERANCE) && (distance < MAX_DISTANCE))
+                                if (fabs(D[X]) > EPSILON)
                                 {
-                                    IPoint = ray.Evaluate(distance);
-                                    if (Clip.empty() || Point_In_Clip(IPoint, Clip, Thread))
+                                    k = (w * (w * (w * Entry->A[X] + Entry->B[X]) + Entry->C[X]) + Entry->D[X] - P[X]) / D[X];
+                                }
+                                else
+                                {
+                                    k = (w * (w * (w * Entry->A[Y] + Entry->B[Y]) + Entry->C[Y]) + Entry->D[Y] - P[Z]) / D[Z];
+                                }
+
+                                /* Verify that intersection height is valid. */
+                                h = P[Y] + k * D[Y];
+                                if ((h >= Height1) && (h <= Height2))
+                                {
+                                    distance = k / len;
+                                    if ((distance > DEPTH_TOLERANCE) && (distance < MAX_DISTANCE))
                                     {
-                                        Depth_Stack->push (Intersection (distance, IPoint, this, SPLINE_HIT, j, w));
-                                        Found = true;
+                                        IPoint = ray.Evaluate(distance);
+                                        if (Clip.empty() || Point_In_Clip(IPoint, Clip, Thread))
+                                        {
+                                            Depth_Stack->push (Intersection (distance, IPoint, this, SPLINE_HIT, j, w));
+                                            Found = true;
+                                        }
                                     }
                                 }
                             }
                         }
                     }
+
+                    i = Node->Skip;
                 }
             }
 
@@ -485,105 +512,130 @@ bool Prism::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceThreadDa
             // test is more complex, and there's also no clear-cut use case where it could be
             // expected to kick in frequently enough to be of any benefit.)
 
-            Entry = Spline->Entry ;
-            for (j = 0; j < Number; j++, Entry++)
+            i = 0;
+
+            while (i < Spline->Nodes)
             {
-                /* Test spline's bounding rectangle (modified Cohen-Sutherland). */
-                if (((D[X] >= 0.0) && (P[X] > Entry->x2)) ||
-                    ((D[X] <= 0.0) && (P[X] < Entry->x1)) ||
-                    ((D[Z] >= 0.0) && (P[Z] > Entry->y2)) ||
-                    ((D[Z] <= 0.0) && (P[Z] < Entry->y1)))
+                Node = &Spline->Node[i];
+
+                /* Skip the segments below the node if its bounding rectangle can't be hit. */
+                if (((D[X] >= 0.0) && (P[X] > Node->x2)) ||
+                    ((D[X] <= 0.0) && (P[X] < Node->x1)) ||
+                    ((D[Z] >= 0.0) && (P[Z] > Node->y2)) ||
+                    ((D[Z] <= 0.0) && (P[Z] < Node->y1)))
                 {
+                    i = Node->Skip;
                     continue;
                 }
 
-                /* Number of roots found. */
+                if (Node->Number == 0)
+                {
+                    i++;
+                    continue;
+                }
 
-                n = 0;
-                switch (Spline_Type)
+                Entry = &Spline->Entry[Node->First];
+                for (j = Node->First; j < Node->First + Node->Number; j++, Entry++)
                 {
-                    case LINEAR_SPLINE :
+                    /* Test spline's bounding rectangle (modified Cohen-Sutherland). */
+                    if (((D[X] >= 0.0) && (P[X] > Entry->x2)) ||
+                        ((D[X] <= 0.0) && (P[X] < Entry->x1)) ||
+                        ((D[Z] >= 0.0) && (P[Z] > Entry->y2)) ||
+                        ((D[Z] <= 0.0) && (P[Z] < Entry->y1)))
+                    {
+                        continue;
+                    }
+
+                    /* Number of roots found. */
 
-                        /* Solve linear equation. */
-                        x[0] = Entry->C[X] * k1 + Entry->C[Y] * k2;
-                        x[1] = Entry->D[X] * k1 + Entry->D[Y] * k2 + k3;
+                    n = 0;
+                    switch (Spline_Type)
+                    {
+                        case LINEAR_SPLINE :
 
-                        if (fabs(x[0]) > EPSILON)
-                            y[n++] = -x[1] / x[0];
-                        break;
+                            /* Solve linear equation. */
+                            x[0] = Entry->C[X] * k1 + Entry->C[Y] * k2;
+                            x[1] = Entry->D[X] * k1 + Entry->D[Y] * k2 + k3;
 
-                    case QUADRATIC_SPLINE :
+                            if (fabs(x[0]) > EPSILON)
+                                y[n++] = -x[1] / x[0];
+                            break;
 
-                        /* Solve quadratic equation. */
-                        x[0] = Entry->B[X] * k1 + Entry->B[Y] * k2;
-                        x[1] = Entry->C[X] * k1 + Entry->C[Y] * k2;
-                        x[2] = Entry->D[X] * k1 + Entry->D[Y] * k2 + k3;
+                        case QUADRATIC_SPLINE :
 
-                        n = Solve_Polynomial(2, x, y, false, 0.0, Thread->Stats());
-                        break;
+                            /* Solve quadratic equation. */
+                            x[0] = Entry->B[X] * k1 + Entry->B[Y] * k2;
+                            x[1] = Entry->C[X] * k1 + Entry->C[Y] * k2;
+                            x[2] = Entry->D[X] * k1 + Entry->D[Y] * k2 + k3;
 
-                    case CUBIC_SPLINE :
-                    case BEZIER_SPLINE :
+                            n = Solve_Polynomial(2, x, y, false, 0.0, Thread->Stats());
+                            break;
 
-                        /* Solve cubic equation. */
-                        x[0] = Entry->A[X] * k1 + Entry->A[Y] * k2;
-                        x[1] = Entry->B[X] * k1 + Entry->B[Y] * k2;
-                        x[2] = Entry->C[X] * k1 + Entry->C[Y] * k2;
-                        x[3] = Entry->D[X] * k1 + Entry->D[Y] * k2 + k3;
+                        case CUBIC_SPLINE :
+                        case BEZIER_SPLINE :
 
-                        n = Solve_Polynomial(3, x, y, Test_Flag(this, STURM_FLAG), 0.0, Thread->Stats());
-                        break;
-                }
+                            /* Solve cubic equation. */
+                            x[0] = Entry->A[X] * k1 + Entry->A[Y] * k2;
+                            x[1] = Entry->B[X] * k1 + Entry->B[Y] * k2;
+                            x[2] = Entry->C[X] * k1 + Entry->C[Y] * k2;
+                            x[3] = Entry->D[X] * k1 + Entry->D[Y] * k2 + k3;
 
-                /* Test roots for valid intersections. */
+                            n = Solve_Polynomial(3, x, y, Test_Flag(this, STURM_FLAG), 0.0, Thread->Stats());
+                            break;
+                    }
 
-                while (n--)
-                {
-                    w = y[n];
+                    /* Test roots for valid intersections. */
 
-                    if ((w >= 0.0) && (w <= 1.0))
+                    while (n--)
                     {
-                        k = w * (w * (w * Entry->A[X] + Entry->B[X]) + Entry->C[X]) + Entry->D[X];
-                        h = D[X] - k * D[Y];
+                        w = y[n];
 
-                        if (fabs(h) > EPSILON)
-                        {
-                            k = (k * P[Y] - P[X]) / h;
-                        }
-                        else
+                        if ((w >= 0.0) && (w <= 1.0))
                         {
-                            k = w * (w * (w * Entry->A[Y] + Entry->B[Y]) + Entry->C[Y]) + Entry->D[Y];
-
-                            h = D[Z] - k * D[Y];
+                            k = w * (w * (w * Entry->A[X] + Entry->B[X]) + Entry->C[X]) + Entry->D[X];
+                            h = D[X] - k * D[Y];
 
                             if (fabs(h) > EPSILON)
                             {
-                                k = (k * P[Y] - P[Z]) / h;
+                                k = (k * P[Y] - P[X]) / h;
                             }
                             else
                             {
-                                /* This should never happen! */
-                                continue;
+                                k = w * (w * (w * Entry->A[Y] + Entry->B[Y]) + Entry->C[Y]) + Entry->D[Y];
+
+                                h = D[Z] - k * D[Y];
+
+                                if (fabs(h) > EPSILON)
+                                {
+                                    k = (k * P[Y] - P[Z]) / h;
+                                }
+                                else
+                                {
+                                    /* This should never happen! */
+                                    continue;
+                                }
                             }
-                        }
 
-                        /* Verify that intersection height is valid. */
-                        h = P[Y] + k * D[Y];
-                        if ((h >= Height1) && (h <= Height2))
-                        {
-                            distance = k / len;
-                            if ((distance > DEPTH_TOLERANCE) && (distance < MAX_DISTANCE))
+                            /* Verify that intersection height is valid. */
+                            h = P[Y] + k * D[Y];
+                            if ((h >= Height1) && (h <= Height2))
                             {
-                                IPoint = ray.Evaluate(distance);
-                                if (Clip.empty() || Point_In_Clip(IPoint, Clip, Thread))
+                                distance = k / len;
+                                if ((distance > DEPTH_TOLERANCE) && (distance < MAX_DISTANCE))
                                 {
-                                    Depth_Stack->push (Intersection (distance, IPoint, this, SPLINE_HIT, j, w));
-                                    Found = true;
+                                    IPoint = ray.Evaluate(distance);
+                                    if (Clip.empty() || Point_In_Clip(IPoint, Clip, Thread))
+                                    {
+                                        Depth_Stack->push (Intersection (distance, IPoint, this, SPLINE_HIT, j, w));
+                                        Found = true;
+                                    }
                                 }
                             }
                         }
                     }
                 }
+
+                i = Node->Skip;
             }
             break;
 
@@ -1060,6 +1112,8 @@ Prism::~Prism()
 {
     if (--(Spline->References) == 0)
     {
+        if (Spline->Node != nullptr)
+            POV_FREE(Spline->Node);
         POV_FREE(Spline->Entry);
         POV_FREE(Spline);
     }
@@ -1143,11 +1197,12 @@ void Prism::Compute_BBox()
 
 int Prism::in_curve(DBL u, DBL v, TraceThreadData *Thread) const
 {
-    int i, n, NC;
+    int i, j, n, NC;
     DBL k, w;
     DBL x[4];
     DBL y[3];
     PRISM_SPLINE_ENTRY Entry;
+    const PRISM_SPLINE_NODE *Node;
 
     NC = 0;
 
@@ -1156,36 +1211,59 @@ int Prism::in_curve(DBL u, DBL v, TraceThreadData *Thread) const
     if ((u >= u1) && (u <= u2) &&
         (v >= v1) && (v <= v2))
     {
-        for (i = 0; i < Number; i++)
+        i = 0;
+
+        while (i < Spline->Nodes)
         {
-            Entry = Spline->Entry[i];
+            Node = &Spline->Node[i];
+
+            /* Skip the segments below the node if none of them can be hit. */
+
+            if ((v < Node->v1) || (v > Node->v2) || (u > Node->u2))
+            {
+                i = Node->Skip;
+                continue;
+            }
 
-            /* Test if current segment can be hit. */
+            if (Node->Number == 0)
+            {
+                i++;
+                continue;
+            }
 
-            if ((v >= Entry.v1) && (v <= Entry.v2) && (u <= Entry.u2))
+            for (j = Node->First; j < Node->First + Node->Number; j++)
             {
-                x[0] = Entry.A[Y];
-                x[1] = Entry.B[Y];
-                x[2] = Entry.C[Y];
-                x[3] = Entry.D[Y] - v;
+                Entry = Spline->Entry[j];
 
-                n = Solve_Polynomial(3, x, y, Test_Flag(this, STURM_FLAG), 0.0, Thread->Stats());
+                /* Test if current segment can be hit. */
 
-                while (n--)
+                if ((v >= Entry.v1) && (v <= Entry.v2) && (u <= Entry.u2))
                 {
-                    w = y[n];
+                    x[0] = Entry.A[Y];
+                    x[1] = Entry.B[Y];
+                    x[2] = Entry.C[Y];
+                    x[3] = Entry.D[Y] - v;
 
-                    if ((w >= 0.0) && (w <= 1.0))
+                    n = Solve_Polynomial(3, x, y, Test_Flag(this, STURM_FLAG), 0.0, Thread->Stats());
+
+                    while (n--)
                     {
-                        k  = w * (w * (w * Entry.A[X] + Entry.B[X]) + Entry.C[X]) + Entry.D[X] - u;
+                        w = y[n];
 
-                        if (k >= 0.0)
+                        if ((w >= 0.0) && (w <= 1.0))
                         {
-                            NC++;
+                            k  = w * (w * (w * Entry.A[X] + Entry.B[X]) + Entry.C[X]) + Entry.D[X] - u;
+
+                            if (k >= 0.0)
+                            {
+                                NC++;
+                            }
                         }
                     }
                 }
             }
+
+            i = Node->Skip;
         }
     }
 
@@ -1381,6 +1459,8 @@ void Prism::Compute_Prism(Vector2d *P, TraceThreadData *Thread)
         Spline = reinterpret_cast<PRISM_SPLINE *>(POV_MALLOC(sizeof(PRISM_SPLINE), "spline segments of prism"));
         Spline->References = 1;
         Spline->Entry = reinterpret_cast<PRISM_SPLINE_ENTRY *>(POV_MALLOC(Number*sizeof(PRISM_SPLINE_ENTRY), "spline segments of prism"));
+        Spline->Nodes = 0;
+        Spline->Node = nullptr;
     }
     else
     {
@@ -1724,6 +1804,141 @@ void Prism::Compute_Prism(Vector2d *P, TraceThreadData *Thread)
         y1 = ymin;
         y2 = ymax;
     }
+
+    /* Build the bounding hierarchy over the segments. */
+
+    if (Number > 0)
+    {
+        Spline->Nodes = count_nodes(Number);
+        Spline->Node = reinterpret_cast<PRISM_SPLINE_NODE *>(POV_MALLOC(Spline->Nodes*sizeof(PRISM_SPLINE_NODE), "bounding hierarchy of prism"));
+
+        build_nodes(0, 0, Number);
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   count_nodes
+*
+* INPUT
+*
+*   number - Number of segments
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   int - number of hierarchy nodes needed
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Count the nodes of a bounding hierarchy over the given number of
+*   segments, as built by build_nodes().
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+int Prism::count_nodes(int number)
+{
+    if (number <= PRISM_MAX_LEAF_ENTRIES)
+    {
+        return(1);
+    }
+
+    return(1 + count_nodes(number / 2) + count_nodes(number - number / 2));
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   build_nodes
+*
+* INPUT
+*
+*   index  - Slot of the node to build
+*   first  - First segment below the node
+*   number - Number of segments below the node
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   int - slot following the node's subtree
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Build the bounding hierarchy over a range of segments by halving it
+*   until the ranges fit into a leaf. Consecutive segments of a spline lie
+*   close together, so this needs no spatial sorting. Each node gets the
+*   union of its segments' bounding rectangles, in both the (x,z) plane
+*   used by the ray tests and the <u,v> plane used by in_curve().
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+int Prism::build_nodes(int index, int first, int number)
+{
+    int i, half;
+    PRISM_SPLINE_NODE *Node;
+    const PRISM_SPLINE_ENTRY *Entry;
+
+    Node = &Spline->Node[index];
+
+    Node->x1 = Node->y1 = Node->v1 =  BOUND_HUGE;
+    Node->x2 = Node->y2 = Node->v2 = Node->u2 = -BOUND_HUGE;
+
+    for (i = first; i < first + number; i++)
+    {
+        Entry = &Spline->Entry[i];
+
+        Node->x1 = min(Node->x1, Entry->x1);
+        Node->y1 = min(Node->y1, Entry->y1);
+        Node->x2 = max(Node->x2, Entry->x2);
+        Node->y2 = max(Node->y2, Entry->y2);
+
+        Node->v1 = min(Node->v1, Entry->v1);
+        Node->u2 = max(Node->u2, Entry->u2);
+        Node->v2 = max(Node->v2, Entry->v2);
+    }
+
+    Node->First = first;
+
+    if (number <= PRISM_MAX_LEAF_ENTRIES)
+    {
+        Node->Number = number;
+        Node->Skip   = index + 1;
+    }
+    else
+    {
+        half = number / 2;
+
+        Node->Number = 0;
+        Node->Skip   = build_nodes(index + 1, first, half);
+        Node->Skip   = build_nodes(Node->Skip, first + half, number - half);
+    }
+
+    return(Node->Skip);
 }
 
 }
@@ -74,6 +74,10 @@ namespace pov
 
 #define PRISM_EXTRA_STATS 1
 
+/* Maximum number of segments in a leaf of the bounding hierarchy. */
+
+#define PRISM_MAX_LEAF_ENTRIES 4
+
 
 
 /*****************************************************************************
@@ -82,6 +86,7 @@ namespace pov
 
 typedef struct Prism_Spline_Struct PRISM_SPLINE;
 typedef struct Prism_Spline_Entry_Struct PRISM_SPLINE_ENTRY;
+typedef struct Prism_Spline_Node_Struct PRISM_SPLINE_NODE;
 
 struct Prism_Spline_Entry_Struct
 {
@@ -90,10 +95,28 @@ struct Prism_Spline_Entry_Struct
     Vector2d A, B, C, D; /* Coefficients of segment            */
 };
 
+/*
+ * Node of the bounding hierarchy over a range of consecutive segments.
+ * The nodes are stored in depth-first order, so the first child of an
+ * inner node follows it, and Skip gives the node to continue with once
+ * a subtree is done.
+ */
+
+struct Prism_Spline_Node_Struct
+{
+    DBL x1, y1, x2, y2;  /* Min./Max. coordinates of segments            */
+    DBL v1, u2, v2;      /* Min./Max. coordinates of segments in <u,v>   */
+    int First;           /* First segment of a leaf                      */
+    int Number;          /* Number of segments, 0 for inner nodes        */
+    int Skip;            /* Node following the subtree                   */
+};
+
 struct Prism_Spline_Struct
 {
     int References;
     PRISM_SPLINE_ENTRY *Entry;
+    int Nodes;
+    PRISM_SPLINE_NODE *Node;
 };
 
 class Prism : public ObjectBase
@@ -125,6 +148,8 @@ class Prism : public ObjectBase
     protected:
         int in_curve(DBL u, DBL v, TraceThreadData *Thread) const;
         static bool test_rectangle(const Vector3d& P, const Vector3d& D, DBL x1, DBL y1, DBL x2, DBL y2);
+        static int count_nodes(int number);
+        int build_nodes(int index, int first, int number);
 };
 
 /// @}
@@ -354,12 +354,13 @@ void Quadric::Normal(Vector3d& Result, Intersection *Inter, TraceThreadData *Thr
 
 void Quadric::Transform(const TRANSFORM *tr)
 {
-    MATRIX Quadric_Matrix, Transform_Transposed;
+    MATRIX Quadric_Matrix, Transform_Inverse, Transform_Transposed;
 
     Quadric_To_Matrix (Quadric_Matrix);
+    MFromAffine (Transform_Inverse, tr->inverse);
 
-    MTimesB (tr->inverse, Quadric_Matrix);
-    MTranspose (Transform_Transposed, tr->inverse);
+    MTimesB (Transform_Inverse, Quadric_Matrix);
+    MTranspose (Transform_Transposed, Transform_Inverse);
     MTimesA (Quadric_Matrix, Transform_Transposed);
 
     Matrix_To_Quadric (Quadric_Matrix);
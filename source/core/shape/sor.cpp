@@ -337,10 +337,8 @@ bool Sor::Intersect(const BasicRay& ray, IStack& Depth_Stack, TraceThreadData *T
 
     /* Intersect all cylindrical bounds. */
     vector<BCYL_INT>& intervals = Thread->BCyl_Intervals;
-    vector<BCYL_INT>& rint = Thread->BCyl_RInt;
-    vector<BCYL_INT>& hint = Thread->BCyl_HInt;
 
-    if ((cnt = Intersect_BCyl(Spline->BCyl, intervals, rint, hint, P, D)) == 0)
+    if ((cnt = Intersect_BCyl(Spline->BCyl, intervals, P, D)) == 0)
     {
 #ifdef SOR_EXTRA_STATS
         if (found)
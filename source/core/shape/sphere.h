@@ -86,6 +86,9 @@ class Sphere : public ObjectBase
 
         static bool Intersect(const BasicRay& ray, const Vector3d& Center, DBL Radius2, DBL *Depth1, DBL  *Depth2);
 
+        /// Whether the primitive is in ellipsoidal mode (see @ref Do_Ellipsoid).
+        bool IsEllipsoid() const { return Do_Ellipsoid; }
+
     private:
 
         /// Ellipsoid mode flag.
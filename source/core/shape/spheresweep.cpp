@@ -166,14 +166,14 @@ bool SphereSweep::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceTh
 {
     // TODO - To improve performance, we might use thread-local buffers for all sphere sweeps.
     SPHSWEEP_INT    *Isect = reinterpret_cast<SPHSWEEP_INT *>(POV_MALLOC(sizeof(SPHSWEEP_INT) * SPHSWEEP_MAX_ISECT, "sphere sweep intersections"));
-    SPHSWEEP_INT    *Sphere_Isect = reinterpret_cast<SPHSWEEP_INT *>(POV_MALLOC(sizeof(SPHSWEEP_INT) * 2 * Num_Spheres, "Sphere sweep sphere intersections"));
-    SPHSWEEP_INT    *Segment_Isect = reinterpret_cast<SPHSWEEP_INT *>(POV_MALLOC(sizeof(SPHSWEEP_INT) * 12 * Num_Segments, "Sphere sweep segment intersections"));
+    SPHSWEEP_INT    Segment_Isect[12];
     BasicRay        New_Ray;
     DBL             len;
     bool            Intersection_Found = false;
     int             Num_Isect = 0;
     int             Num_Seg_Isect;
-    int             i, j;
+    int             Last;
+    int             i, j, k;
 
     Thread->Stats()[Ray_Sphere_Sweep_Tests]++;
 
@@ -190,34 +190,56 @@ bool SphereSweep::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceTh
         New_Ray.Direction /= len;
     }
 
-    // Intersections with single spheres
-    for(i = 0; i < Num_Spheres; i++)
+    // Walk the bounding hierarchy, skipping the parts of the sphere sweep
+    // in nodes whose bounding box the ray (a line in fact) misses
+    i = 0;
+    while (i < Num_Nodes)
     {
-        // Test for end of vector
-        if (Num_Isect + 2 <= SPHSWEEP_MAX_ISECT)
+        if (!Intersect_Node(New_Ray, &Node[i]))
         {
-            // Are there intersections with this sphere?
-            if (Intersect_Sphere(New_Ray, &Sphere[i], Isect + Num_Isect))
-                Num_Isect += 2;
+            i = Node[i].Skip;
+            continue;
         }
-    }
 
-    // Intersections with segments
-    for(i = 0; i < Num_Segments; i++)
-    {
-        // Are there intersections with this segment?
-        Num_Seg_Isect = Intersect_Segment(New_Ray, &Segment[i], Segment_Isect, Thread);
+        if (Node[i].Number == 0)
+        {
+            i++;
+            continue;
+        }
+
+        Last = Node[i].First + Node[i].Number;
 
-        // Test for end of vector
-        if(Num_Isect + Num_Seg_Isect <= SPHSWEEP_MAX_ISECT)
+        // Intersections with single spheres
+        for(j = Node[i].First; j < ((Last == Num_Segments) ? Num_Spheres : Last); j++)
         {
-            for (j = 0; j < Num_Seg_Isect; j++)
+            // Test for end of vector
+            if (Num_Isect + 2 <= SPHSWEEP_MAX_ISECT)
             {
-                // Add intersection
-                Isect[Num_Isect] = Segment_Isect[j];
-                Num_Isect++;
+                // Are there intersections with this sphere?
+                if (Intersect_Sphere(New_Ray, &Sphere[j], Isect + Num_Isect))
+                    Num_Isect += 2;
             }
         }
+
+        // Intersections with segments
+        for(j = Node[i].First; j < Last; j++)
+        {
+            // Are there intersections with this segment?
+            Num_Seg_Isect = Intersect_Segment(New_Ray, &Segment[j], Segment_Isect, Thread);
+
+            // Test for end of vector
+            if(Num_Isect + Num_Seg_Isect <= SPHSWEEP_MAX_ISECT)
+            {
+                for (k = 0; k < Num_Seg_Isect; k++)
+                {
+                    // Add intersection
+                    Isect[Num_Isect] = Segment_Isect[k];
+                    Num_Isect++;
+                }
+            }
+        }
+
+        i = Node[i].Skip;
     }
 
     // Any intersections?
@@ -259,8 +281,6 @@ bool SphereSweep::All_Intersections(const Ray& ray, IStack& Depth_Stack, TraceTh
     }
 
     POV_FREE(Isect);
-    POV_FREE(Sphere_Isect);
-    POV_FREE(Segment_Isect);
 
     return Intersection_Found;
 }
@@ -757,6 +777,12 @@ bool SphereSweep::Inside(const Vector3d& IPoint, TraceThreadData *Thread) const
             // For each segment...
             for(i = 0; i < Num_Segments; i++)
             {
+                // Skip segments whose bounding box doesn't contain the point
+                if ((New_Point[X] < Segment[i].Min[X]) || (New_Point[X] > Segment[i].Max[X]) ||
+                    (New_Point[Y] < Segment[i].Min[Y]) || (New_Point[Y] > Segment[i].Max[Y]) ||
+                    (New_Point[Z] < Segment[i].Min[Z]) || (New_Point[Z] > Segment[i].Max[Z]))
+                    continue;
+
                 // Pre-calculate vector
                 Vector = New_Point - Segment[i].Center_Coef[0];
 
@@ -795,6 +821,12 @@ bool SphereSweep::Inside(const Vector3d& IPoint, TraceThreadData *Thread) const
             // For each segment...
             for(i = 0; i < Num_Segments; i++)
             {
+                // Skip segments whose bounding box doesn't contain the point
+                if ((New_Point[X] < Segment[i].Min[X]) || (New_Point[X] > Segment[i].Max[X]) ||
+                    (New_Point[Y] < Segment[i].Min[Y]) || (New_Point[Y] > Segment[i].Max[Y]) ||
+                    (New_Point[Z] < Segment[i].Min[Z]) || (New_Point[Z] > Segment[i].Max[Z]))
+                    continue;
+
                 // Pre-calculate vector
                 Vector = New_Point - Segment[i].Center_Coef[0];
 
@@ -956,6 +988,7 @@ ObjectPtr SphereSweep::Copy()
 
     New->Segment = nullptr;
     New->Sphere = nullptr;
+    New->Node = nullptr;
     New->Interpolation = Interpolation;
 
     New->Num_Modeling_Spheres = Num_Modeling_Spheres;
@@ -1169,6 +1202,9 @@ SphereSweep::SphereSweep() : ObjectBase(SPHERE_SWEEP_OBJECT)
     Num_Segments = 0;
     Segment = nullptr;
 
+    Num_Nodes = 0;
+    Node = nullptr;
+
     Depth_Tolerance = DEPTH_TOLERANCE;
 
     Trans = nullptr;
@@ -1257,6 +1293,9 @@ SphereSweep::~SphereSweep()
     POV_FREE(Modeling_Sphere);
     POV_FREE(Sphere);
     POV_FREE(Segment);
+
+    if (Node != nullptr)
+        POV_FREE(Node);
 }
 
 
@@ -1625,6 +1664,281 @@ void SphereSweep::Compute()
         Sphere[last_sph].Radius +=
                Segment[last_seg].Radius_Coef[coef];
     }
+
+    // Calculate the bounding hierarchy
+
+    for(i = 0; i < Num_Segments; i++)
+        Compute_Segment_BBox(&Segment[i]);
+
+    // Allocate memory if necessary
+    if (Node == nullptr)
+    {
+        Num_Nodes = Count_Nodes(Num_Segments);
+        size = Num_Nodes * sizeof(SPHSWEEP_NODE);
+        Node = reinterpret_cast<SPHSWEEP_NODE *>(POV_MALLOC(size, "sphere sweep bounding hierarchy"));
+    }
+
+    Build_Nodes(0, 0, Num_Segments);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Compute_Segment_BBox
+*
+* INPUT
+*
+*   Segment
+*
+* OUTPUT
+*
+*   Segment
+*
+* RETURNS
+*
+*   -
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Calculate the bounding box of a segment. The center and radius
+*   polynomials are converted to Bezier form, whose control points
+*   enclose them for u in [0, 1].
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void SphereSweep::Compute_Segment_BBox(SPHSWEEP_SEG *Segment)
+{
+    Vector3d    Center;
+    DBL         Radius;
+    DBL         Max_Radius;
+    DBL         Factor;
+    int         Degree;
+    int         i, j;
+
+    Degree = Segment->Num_Coefs - 1;
+
+    Segment->Min = Vector3d(BOUND_HUGE);
+    Segment->Max = Vector3d(-BOUND_HUGE);
+
+    Max_Radius = 0.0;
+
+    for(i = 0; i <= Degree; i++)
+    {
+        // i-th Bezier control point: sum of C(i,j)/C(Degree,j) * coef[j]
+        Center = Vector3d(0.0);
+        Radius = 0.0;
+        Factor = 1.0;
+
+        for(j = 0; j <= i; j++)
+        {
+            if (j > 0)
+                Factor *= double(i - j + 1) / double(Degree - j + 1);
+
+            Center += Factor * Segment->Center_Coef[j];
+            Radius += Factor * Segment->Radius_Coef[j];
+        }
+
+        Segment->Min = min(Segment->Min, Center);
+        Segment->Max = max(Segment->Max, Center);
+
+        Max_Radius = max(Max_Radius, fabs(Radius));
+    }
+
+    Segment->Min -= Vector3d(Max_Radius);
+    Segment->Max += Vector3d(Max_Radius);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Count_Nodes
+*
+* INPUT
+*
+*   Number of segments
+*
+* OUTPUT
+*
+*   -
+*
+* RETURNS
+*
+*   Number of hierarchy nodes needed
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Count the nodes of a bounding hierarchy over the given number of
+*   segments, as built by Build_Nodes.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+int SphereSweep::Count_Nodes(int Number)
+{
+    if (Number <= SPH_SWP_MAX_LEAF_SEGMENTS)
+        return 1;
+
+    return 1 + Count_Nodes(Number / 2) + Count_Nodes(Number - Number / 2);
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Build_Nodes
+*
+* INPUT
+*
+*   Slot of the node to build, first segment and number of segments below it
+*
+* OUTPUT
+*
+*   Object
+*
+* RETURNS
+*
+*   Slot following the node's subtree
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Build the bounding hierarchy over a range of segments by halving it
+*   until the ranges fit into a leaf. Consecutive segments lie close
+*   together, so this needs no spatial sorting.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+int SphereSweep::Build_Nodes(int Index, int First, int Number)
+{
+    SPHSWEEP_NODE   *Current = &Node[Index];
+    int             Half;
+    int             i;
+
+    Current->Min = Vector3d(BOUND_HUGE);
+    Current->Max = Vector3d(-BOUND_HUGE);
+
+    for(i = First; i < First + Number; i++)
+    {
+        Current->Min = min(Current->Min, Segment[i].Min);
+        Current->Max = max(Current->Max, Segment[i].Max);
+    }
+
+    Current->First = First;
+
+    if (Number <= SPH_SWP_MAX_LEAF_SEGMENTS)
+    {
+        Current->Number = Number;
+        Current->Skip = Index + 1;
+    }
+    else
+    {
+        Half = Number / 2;
+
+        Current->Number = 0;
+        Current->Skip = Build_Nodes(Index + 1, First, Half);
+        Current->Skip = Build_Nodes(Current->Skip, First + Half, Number - Half);
+    }
+
+    return Current->Skip;
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Intersect_Node
+*
+* INPUT
+*
+*   Ray, Node
+*
+* OUTPUT
+*
+*   -
+*
+* RETURNS
+*
+*   Boolean - does the ray hit the node's bounding box?
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Test the ray against the bounding box of a node. The whole line
+*   is tested, as the search for invalid intersections also needs
+*   those behind the ray's origin.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool SphereSweep::Intersect_Node(const BasicRay &ray, const SPHSWEEP_NODE *Node)
+{
+    DBL     tmin = -BOUND_HUGE;
+    DBL     tmax = BOUND_HUGE;
+    DBL     t1, t2;
+    int     i;
+
+    for(i = X; i <= Z; i++)
+    {
+        if (ray.Direction[i] == 0.0)
+        {
+            if ((ray.Origin[i] < Node->Min[i]) || (ray.Origin[i] > Node->Max[i]))
+                return false;
+        }
+        else
+        {
+            t1 = (Node->Min[i] - ray.Origin[i]) / ray.Direction[i];
+            t2 = (Node->Max[i] - ray.Origin[i]) / ray.Direction[i];
+
+            if (t1 > t2)
+                std::swap(t1, t2);
+
+            tmin = max(tmin, t1);
+            tmax = min(tmax, t2);
+
+            if (tmin > tmax)
+                return false;
+        }
+    }
+
+    return true;
 }
 
 
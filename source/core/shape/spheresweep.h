@@ -77,6 +77,9 @@ namespace pov
 /* Maximum number of coefficients of the polynomials describing one segment */
 #define SPH_SWP_MAX_COEFS               4
 
+/* Maximum number of segments in a leaf of the bounding hierarchy */
+#define SPH_SWP_MAX_LEAF_SEGMENTS       4
+
 
 
 /*****************************************************************************
@@ -86,6 +89,7 @@ namespace pov
 typedef struct Sphere_Sweep_Sphere_Struct SPHSWEEP_SPH;
 typedef struct Sphere_Sweep_Segment_Struct SPHSWEEP_SEG;
 typedef struct Sphere_Sweep_Intersection_Structure SPHSWEEP_INT;
+typedef struct Sphere_Sweep_Node_Struct SPHSWEEP_NODE;
 
 /* Single sphere, used to connect two adjacent segments */
 struct Sphere_Sweep_Sphere_Struct
@@ -103,6 +107,19 @@ struct Sphere_Sweep_Segment_Struct
     int           Num_Coefs;                      /* Number of coefficients        */
     Vector3d      Center_Coef[SPH_SWP_MAX_COEFS]; /* Coefs of center polynomial    */
     DBL           Radius_Coef[SPH_SWP_MAX_COEFS]; /* Coefs of radius polynomial    */
+    Vector3d      Min, Max;                       /* Bounding box of the segment   */
+};
+
+/* Node of the bounding hierarchy over a range of consecutive segments,
+   stored in depth-first order, so that the first child of an inner node
+   follows it. A leaf also holds the single spheres opening its segments
+   and, if it holds the last segment, the sphere closing that one. */
+struct Sphere_Sweep_Node_Struct
+{
+    Vector3d    Min, Max;   /* Bounding box of the segments  */
+    int         First;      /* First segment of a leaf       */
+    int         Number;     /* Number of segments, 0 if inner */
+    int         Skip;       /* Node following the subtree    */
 };
 
 // Temporary storage for intersection values
@@ -124,6 +141,8 @@ class SphereSweep : public ObjectBase
         SPHSWEEP_SPH    *Sphere;                /* Spheres that close segments   */
         int             Num_Segments;           /* Number of tubular segments    */
         SPHSWEEP_SEG    *Segment;               /* Tubular segments              */
+        int             Num_Nodes;              /* Number of hierarchy nodes     */
+        SPHSWEEP_NODE   *Node;                  /* Bounding hierarchy            */
         DBL             Depth_Tolerance;        /* Preferred depth tolerance     */
 
         SphereSweep();
@@ -169,6 +188,10 @@ class SphereSweep : public ObjectBase
         static int Find_Valid_Points(SPHSWEEP_INT *Inter, int Num_Inter, const BasicRay &ray);
 
         static int Comp_Isects(const void *Intersection_1, const void *Intersection_2);
+        static bool Intersect_Node(const BasicRay &ray, const SPHSWEEP_NODE *Node);
+        static void Compute_Segment_BBox(SPHSWEEP_SEG *Segment);
+        static int Count_Nodes(int Number);
+        int Build_Nodes(int Index, int First, int Number);
         static int bezier_01(int degree, const DBL* Coef, DBL* Roots, bool sturm, DBL tolerance, TraceThreadData *Thread);
 };
 
@@ -41,6 +41,8 @@
 #include <map>
 #include <vector>
 
+#include <boost/thread.hpp>
+
 #include "base/fileinputoutput.h"
 
 #include "core/bounding/boundingbox.h"
@@ -257,6 +259,9 @@ struct GlyphStruct
     Contour *contours;            /* Array of outline contours */
     USHORT unitsPerEm;            /* Max units character */
     GlyphIndex myMetrics;         /* Which glyph index this is for metrics */
+
+    GlyphStruct() : contours(nullptr) {}
+    ~GlyphStruct() { delete[] contours; }
 };
 
 typedef struct KernData_struct
@@ -290,7 +295,7 @@ typedef struct longHorMertric
 } longHorMetric;
 
 
-typedef std::map<USHORT, GlyphPtr> GlyphPtrMap;
+typedef std::map<USHORT, shared_ptr<GlyphStruct> > GlyphPtrMap;
 
 struct CMAPSelector
 {
@@ -332,6 +337,7 @@ struct TrueTypeInfo
     ULONG glyf_table_offset;
     USHORT numGlyphs;                 /* How many symbols in this file */
     USHORT unitsPerEm;                /* The "resolution" of this font */
+    ULONG checkSum;                   /* Whole-file checksum, to identify the font */
     SHORT indexToLocFormat;           /* 0 - short format, 1 - long format */
     ULONG *loca_table;                /* Mapping from characters to glyphs */
     GlyphPtrMap glyphsByChar;         /* Cached info for this font */
@@ -356,6 +362,43 @@ const BYTE tag_HorizHeader[]    = "hhea"; /* 0x68686561; */
 const BYTE tag_HorizMetric[]    = "hmtx"; /* 0x686d7478; */
 const BYTE tag_TTCFontFile[]    = "ttcf"; /* */
 
+/*
+ * Glyphs depend only on the font data, so once converted they are kept in a
+ * process-wide cache, and shared by all fonts and scenes using the same
+ * font file. Fonts are told apart by name and by the checksum and layout
+ * recorded in the file itself, which catches a changed file of the same
+ * name.
+ */
+
+struct GlyphCacheKey
+{
+    UCS2String filename;          /* Font file name, empty for built-in fonts */
+    ULONG checkSum;               /* Whole-file checksum from the head table */
+    ULONG glyfOffset;             /* Location of the glyph data, tells fonts of a collection apart */
+    GlyphIndex glyphIndex;
+
+    bool operator<(const GlyphCacheKey& other) const
+    {
+        if (checkSum != other.checkSum)
+            return (checkSum < other.checkSum);
+        if (glyfOffset != other.glyfOffset)
+            return (glyfOffset < other.glyfOffset);
+        if (glyphIndex != other.glyphIndex)
+            return (glyphIndex < other.glyphIndex);
+        return (filename < other.filename);
+    }
+};
+
+typedef std::map<GlyphCacheKey, shared_ptr<GlyphStruct> > GlyphCacheMap;
+
+/* Cached glyphs beyond which those no longer used by any font are dropped. */
+const size_t GLYPH_CACHE_SIZE = 4096;
+
+static GlyphCacheMap gGlyphCache;
+#if POV_MULTITHREADED
+static boost::mutex gGlyphCacheMutex;
+#endif
+
 /*****************************************************************************
 * Static functions
 ******************************************************************************/
@@ -377,6 +420,7 @@ void ProcessHheaTable(TrueTypeFont *ffile, int hhea_table_offset);
 void ProcessHmtxTable(TrueTypeFont *ffile, int hmtx_table_offset);
 GlyphPtr ProcessCharacter(TrueTypeFont *ffile, UCS4 search_char, GlyphIndex *glyph_index);
 GlyphIndex ProcessCharMap(TrueTypeFont *ffile, UCS4 search_char);
+shared_ptr<GlyphStruct> LookupGlyph(TrueTypeFont *ffile, GlyphIndex glyph_index, UCS4 c);
 
 /// @pre The glyph index shall be 0.
 /// @pre If the return value is `false`, the glyph index shall be 0.
@@ -988,6 +1032,7 @@ void ProcessHeadTable(TrueTypeFont *ffile, int head_table_offset)
 
     ffile->info->indexToLocFormat = fontHeader.indexToLocFormat;
     ffile->info->unitsPerEm = fontHeader.unitsPerEm;
+    ffile->info->checkSum = fontHeader.checkSumAdjustment;
 }
 
 /* Determine the relative offsets of glyphs */
@@ -1231,6 +1276,87 @@ void ProcessHmtxTable (TrueTypeFont *ffile, int hmtx_table_offset)
     }
 }
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   LookupGlyph
+*
+* INPUT
+*
+*   ffile       - font
+*   glyph_index - glyph to look up
+*   c           - character, for diagnostics only
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   shared_ptr<GlyphStruct> - the glyph
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Get a glyph from the process-wide glyph cache, extracting it from the
+*   font file if no font using the same file has done so yet.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+shared_ptr<GlyphStruct> LookupGlyph(TrueTypeFont *ffile, GlyphIndex glyph_index, UCS4 c)
+{
+    GlyphCacheKey key;
+    GlyphCacheMap::iterator iGlyph;
+    shared_ptr<GlyphStruct> glyph;
+
+    key.filename   = ffile->filename;
+    key.checkSum   = ffile->info->checkSum;
+    key.glyfOffset = ffile->info->glyf_table_offset;
+    key.glyphIndex = glyph_index;
+
+    {
+#if POV_MULTITHREADED
+        boost::mutex::scoped_lock lock(gGlyphCacheMutex);
+#endif
+
+        iGlyph = gGlyphCache.find(key);
+        if (iGlyph != gGlyphCache.end())
+            return (*iGlyph).second;
+    }
+
+    /* Extract the glyph without holding the lock; the font file is ours alone. */
+
+    glyph = shared_ptr<GlyphStruct>(ExtractGlyphInfo(ffile, glyph_index, c));
+
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(gGlyphCacheMutex);
+#endif
+
+    /* Make room by dropping glyphs that only the cache still refers to. */
+
+    if (gGlyphCache.size() >= GLYPH_CACHE_SIZE)
+    {
+        for (iGlyph = gGlyphCache.begin(); iGlyph != gGlyphCache.end(); )
+        {
+            if ((*iGlyph).second.unique())
+                gGlyphCache.erase(iGlyph++);
+            else
+                ++iGlyph;
+        }
+    }
+
+    /* Another scene may have beaten us to it, in which case we use its glyph. */
+
+    return gGlyphCache.insert(GlyphCacheMap::value_type(key, glyph)).first->second;
+}
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1270,7 +1396,7 @@ GlyphPtr ProcessCharacter(TrueTypeFont *ffile, UCS4 search_char, GlyphIndex *gly
         Debug_Info("Cached glyph: %c/%u\n",(char)search_char,(*iGlyph).second->glyph_index);
 #endif
         *glyph_index = (*iGlyph).second->glyph_index;
-        return (*iGlyph).second;
+        return (*iGlyph).second.get();
     }
 
     *glyph_index = ProcessCharMap(ffile, search_char);
@@ -1288,10 +1414,10 @@ GlyphPtr ProcessCharacter(TrueTypeFont *ffile, UCS4 search_char, GlyphIndex *gly
         Debug_Info("Cached glyph: %c/%u\n",(char)search_char,(*iGlyph).second->glyph_index);
 #endif
         *glyph_index = (*iGlyph).second->glyph_index;
-        return (*iGlyph).second;
+        return (*iGlyph).second.get();
     }
 
-    GlyphPtr glyph = ExtractGlyphInfo(ffile, *glyph_index, search_char);
+    shared_ptr<GlyphStruct> glyph = LookupGlyph(ffile, *glyph_index, search_char);
 
     /* Add this glyph to the ones we already know about */
 
@@ -1300,7 +1426,7 @@ GlyphPtr ProcessCharacter(TrueTypeFont *ffile, UCS4 search_char, GlyphIndex *gly
 
     /* Glyph is all built */
 
-    return glyph;
+    return glyph.get();
 }
 
 /*****************************************************************************
@@ -3138,6 +3264,7 @@ TrueTypeInfo::TrueTypeInfo() :
     glyf_table_offset(0),
     numGlyphs(0),
     unitsPerEm(0),
+    checkSum(0),
     indexToLocFormat(0),
     loca_table(nullptr),
     numberOfHMetrics(0),
@@ -3152,13 +3279,6 @@ TrueTypeInfo::~TrueTypeInfo()
     if (loca_table != nullptr)
         delete[] loca_table;
 
-    for (GlyphPtrMap::iterator iGlyph = glyphsByIndex.begin(); iGlyph != glyphsByIndex.end(); ++iGlyph)
-    {
-        if ((*iGlyph).second->contours != nullptr)
-            delete[] (*iGlyph).second->contours;
-        delete (*iGlyph).second;
-    }
-
     if (kerning_tables.tables != nullptr)
     {
         for (int i = 0; i < kerning_tables.nTables; i++)
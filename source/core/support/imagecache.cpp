@@ -0,0 +1,335 @@
+//******************************************************************************
+///
+/// @file core/support/imagecache.cpp
+///
+/// Implementations related to the shared image file cache.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "core/support/imagecache.h"
+
+#include <list>
+
+#include <boost/thread.hpp>
+
+#include "base/image/tiledimage.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+namespace
+{
+
+struct CachedImage
+{
+    ImageCache::Key key;
+    Image *image;
+    vector<string> warnings;    ///< Warnings issued when the image was read.
+    size_t size;                ///< Estimated memory footprint of the image, in bytes.
+    int references;             ///< Number of references handed out.
+};
+
+/// Cached images, most recently used first.
+class CachedImageList : public std::list<CachedImage>
+{
+    public:
+        ~CachedImageList()
+        {
+            for (iterator i = begin(); i != end(); ++i)
+                delete i->image;
+        }
+};
+
+CachedImageList gCachedImages;
+#if POV_MULTITHREADED
+boost::mutex gCachedImagesMutex;
+#endif
+
+size_t EstimateSize(const Image *image)
+{
+    // tiles paged in are accounted for by the tile cache instead
+    if (dynamic_cast<const pov_base::TiledImage *>(image) != nullptr)
+        return 0;
+
+    size_t bytesPerPixel;
+    switch (image->GetImageDataType())
+    {
+        case Image::Bit_Map:
+        case Image::Colour_Map:
+        case Image::Gray_Int8:
+        case Image::Gray_Gamma8:
+            bytesPerPixel = 1;
+            break;
+        case Image::Gray_Int16:
+        case Image::Gray_Gamma16:
+        case Image::GrayA_Int8:
+        case Image::GrayA_Gamma8:
+            bytesPerPixel = 2;
+            break;
+        case Image::RGB_Int8:
+        case Image::RGB_Gamma8:
+            bytesPerPixel = 3;
+            break;
+        case Image::GrayA_Int16:
+        case Image::GrayA_Gamma16:
+        case Image::RGBA_Int8:
+        case Image::RGBA_Gamma8:
+            bytesPerPixel = 4;
+            break;
+        case Image::RGB_Int16:
+        case Image::RGB_Gamma16:
+            bytesPerPixel = 6;
+            break;
+        case Image::RGBA_Int16:
+        case Image::RGBA_Gamma16:
+            bytesPerPixel = 8;
+            break;
+        default:
+            bytesPerPixel = 5 * sizeof(float);
+            break;
+    }
+    return size_t(image->GetWidth()) * size_t(image->GetHeight()) * bytesPerPixel;
+}
+
+/// Discards least recently used images no longer referenced, until the remaining ones fit the limit.
+/// @note   The caller must hold the mutex.
+void EvictUnused()
+{
+    size_t unusedSize = 0;
+    for (CachedImageList::iterator i = gCachedImages.begin(); i != gCachedImages.end(); ++i)
+        if (i->references == 0)
+            unusedSize += i->size;
+
+    const size_t limit = size_t(IMAGE_CACHE_SIZE_LIMIT) * 1024 * 1024;
+    CachedImageList::iterator i = gCachedImages.end();
+    while ((unusedSize > limit) && (i != gCachedImages.begin()))
+    {
+        --i;
+        if (i->references == 0)
+        {
+            unusedSize -= i->size;
+            delete i->image;
+            i = gCachedImages.erase(i);
+        }
+    }
+}
+
+}
+
+bool ImageCache::Key::operator==(const Key& other) const
+{
+    return (fileType              == other.fileType) &&
+           (fileSize              == other.fileSize) &&
+           (contentHash           == other.contentHash) &&
+           (itype                 == other.itype) &&
+           (gammaOverride         == other.gammaOverride) &&
+           (gammacorrect          == other.gammacorrect) &&
+           (premultipliedOverride == other.premultipliedOverride) &&
+           (premultiplied         == other.premultiplied) &&
+           (tiled                 == other.tiled) &&
+           (defaultGamma          == other.defaultGamma) &&
+           (workingGamma          == other.workingGamma) &&
+           (filename              == other.filename);
+}
+
+POV_UINT64 ImageCache::Key::GetSignature() const
+{
+    // 64-bit FNV-1a hash over the relevant parameters
+    POV_UINT64 values[10] = {
+        contentHash,
+        POV_UINT64(fileSize),
+        POV_UINT64(fileType),
+        POV_UINT64(itype),
+        (defaultGamma == nullptr ? 0 : POV_UINT64(defaultGamma->GetTypeId()) + 1),
+        (defaultGamma == nullptr ? 0 : POV_UINT64(defaultGamma->GetParam() * 1.0e6)),
+        (workingGamma == nullptr ? 0 : POV_UINT64(workingGamma->GetTypeId()) + 1),
+        (workingGamma == nullptr ? 0 : POV_UINT64(workingGamma->GetParam() * 1.0e6)),
+        POV_UINT64(gammaOverride) | (POV_UINT64(gammacorrect) << 1) |
+            (POV_UINT64(premultipliedOverride) << 2) | (POV_UINT64(premultiplied) << 3),
+        1   // version of the derived data format
+    };
+    POV_UINT64 hash = 0xcbf29ce484222325ULL;
+    for (int i = 0; i < 10; i++)
+    {
+        for (int b = 0; b < 8; b++)
+        {
+            hash ^= (values[i] >> (b * 8)) & 0xFF;
+            hash *= 0x100000001b3ULL;
+        }
+    }
+    return hash;
+}
+
+bool ImageCache::MakeKey(Key& key, const UCS2String& filename, int fileType, IStream *file, const Image::ReadOptions& options)
+{
+    POV_OFF_T start = file->tellg();
+    if (start < 0)
+        return false;
+
+    // 64-bit FNV-1a hash of the file contents
+    POV_UINT64 hash = 0xcbf29ce484222325ULL;
+    POV_OFF_T size = 0;
+    vector<unsigned char> buffer(65536);
+    size_t count;
+    while ((count = file->readUpTo(&buffer[0], buffer.size())) > 0)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            hash ^= buffer[i];
+            hash *= 0x100000001b3ULL;
+        }
+        size += count;
+    }
+
+    file->clearstate();
+    if (!file->seekg(start))
+        return false;
+
+    key.filename              = filename;
+    key.fileType              = fileType;
+    key.fileSize              = size;
+    key.contentHash           = hash;
+    key.itype                 = options.itype;
+    key.defaultGamma          = options.defaultGamma;
+    key.workingGamma          = options.workingGamma;
+    key.gammaOverride         = options.gammaOverride;
+    key.gammacorrect          = options.gammacorrect;
+    key.premultipliedOverride = options.premultipliedOverride;
+    key.premultiplied         = options.premultiplied;
+    key.tiled                 = false;
+    return true;
+}
+
+Image *ImageCache::Acquire(const Key& key, const Image::ReadOptions& options)
+{
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(gCachedImagesMutex);
+#endif
+
+    for (CachedImageList::iterator i = gCachedImages.begin(); i != gCachedImages.end(); ++i)
+    {
+        if (i->key == key)
+        {
+            i->references++;
+            gCachedImages.splice(gCachedImages.begin(), gCachedImages, i);
+            options.warnings.insert(options.warnings.end(), i->warnings.begin(), i->warnings.end());
+            return i->image;
+        }
+    }
+    return nullptr;
+}
+
+Image *ImageCache::Insert(const Key& key, Image *image, const Image::ReadOptions& options)
+{
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(gCachedImagesMutex);
+#endif
+
+    for (CachedImageList::iterator i = gCachedImages.begin(); i != gCachedImages.end(); ++i)
+    {
+        if (i->key == key)
+        {
+            delete image;
+            i->references++;
+            gCachedImages.splice(gCachedImages.begin(), gCachedImages, i);
+            return i->image;
+        }
+    }
+
+    gCachedImages.push_front(CachedImage());
+    CachedImage& entry = gCachedImages.front();
+    entry.key        = key;
+    entry.image      = image;
+    entry.warnings   = options.warnings;
+    entry.size       = EstimateSize(image);
+    entry.references = 1;
+
+    EvictUnused();
+    return image;
+}
+
+bool ImageCache::Release(const Image *image)
+{
+#if POV_MULTITHREADED
+    boost::mutex::scoped_lock lock(gCachedImagesMutex);
+#endif
+
+    for (CachedImageList::iterator i = gCachedImages.begin(); i != gCachedImages.end(); ++i)
+    {
+        if (i->image == image)
+        {
+            POV_ASSERT(i->references > 0);
+            if (--i->references == 0)
+                EvictUnused();
+            return true;
+        }
+    }
+    return false;
+}
+
+Image *ImageCache::Unshare(Image *image)
+{
+    if ((image == nullptr) || !image->IsIndexed())
+        return image;
+
+    {
+#if POV_MULTITHREADED
+        boost::mutex::scoped_lock lock(gCachedImagesMutex);
+#endif
+        bool cached = false;
+        for (CachedImageList::iterator i = gCachedImages.begin(); i != gCachedImages.end(); ++i)
+        {
+            if (i->image == image)
+            {
+                cached = true;
+                break;
+            }
+        }
+        if (!cached)
+            return image;
+    }
+
+    vector<Image::RGBFTMapEntry> map;
+    image->GetColourMap(map);
+    Image *copy = Image::Create(image->GetWidth(), image->GetHeight(), image->GetImageDataType(), map);
+    copy->SetPremultiplied(image->IsPremultiplied());
+    for (unsigned int y = 0; y < image->GetHeight(); y++)
+        for (unsigned int x = 0; x < image->GetWidth(); x++)
+            copy->SetIndexedValue(x, y, image->GetIndexedValue(x, y));
+
+    Release(image);
+    return copy;
+}
+
+}
@@ -0,0 +1,152 @@
+//******************************************************************************
+///
+/// @file core/support/imagecache.h
+///
+/// Declarations related to the shared image file cache.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2019 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_CORE_IMAGECACHE_H
+#define POVRAY_CORE_IMAGECACHE_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "core/configcore.h"
+
+#include "base/fileinputoutput.h"
+#include "base/image/image.h"
+
+namespace pov
+{
+
+using pov_base::Image;
+using pov_base::IStream;
+using pov_base::SimpleGammaCurvePtr;
+using pov_base::UCS2String;
+
+//##############################################################################
+///
+/// @addtogroup PovCoreSupportImageUtil
+///
+/// @{
+
+/// Process-wide cache of decoded image files.
+///
+/// Scenes frequently use the same image file in several places, and animations read the
+/// same files anew for each frame. The cache lets all of these share a single decoded
+/// copy of an image, as long as it was read with identical options.
+///
+/// Images are identified by their resolved file name, their file type, the read options
+/// affecting the decoded data, and the size and a hash of the file's contents; the latter
+/// ensures that files modified between frames are picked up again. Each image handed out
+/// by the cache holds a reference, to be returned via @ref Release(). Images no longer
+/// referenced remain cached until the total size of such images exceeds
+/// @ref IMAGE_CACHE_SIZE_LIMIT, at which point the least recently used ones are discarded.
+///
+/// @note
+///     Images obtained from the cache are shared, and must not be modified; use
+///     @ref Unshare() to obtain a private copy first.
+///
+class ImageCache
+{
+    public:
+
+        struct Key
+        {
+            UCS2String filename;        ///< Fully resolved file name.
+            int fileType;               ///< File type as specified in the scene.
+            POV_OFF_T fileSize;         ///< Size of the file contents.
+            POV_UINT64 contentHash;     ///< Hash of the file contents.
+            Image::ImageDataType itype;
+            SimpleGammaCurvePtr defaultGamma;   ///< Gamma curve, compared by identity as matching curves are shared anyway.
+            SimpleGammaCurvePtr workingGamma;   ///< Gamma curve, compared by identity as matching curves are shared anyway.
+            bool gammaOverride : 1;
+            bool gammacorrect : 1;
+            bool premultipliedOverride : 1;
+            bool premultiplied : 1;
+            bool tiled : 1;                     ///< Whether the image is paged in from a tile cache file.
+
+            bool operator==(const Key& other) const;
+
+            /// Condenses the key into a single value identifying the image contents and read
+            /// options, suitable to validate data derived from the image across sessions.
+            POV_UINT64 GetSignature() const;
+        };
+
+        /// Sets up a cache key for an image file.
+        ///
+        /// The file is read once in its entirety to compute the hash of its contents, then
+        /// rewound to its start. The key is set up for an image held in memory.
+        ///
+        /// @return     `false` if the file could not be rewound, in which case it must not be cached.
+        ///
+        static bool MakeKey(Key& key, const UCS2String& filename, int fileType, IStream *file, const Image::ReadOptions& options);
+
+        /// Looks up an image, adding a reference to it if found.
+        ///
+        /// Any warnings issued when the image was originally read are appended to the
+        /// options' warnings list.
+        ///
+        /// @return     The cached image, or `nullptr` if not found.
+        ///
+        static Image *Acquire(const Key& key, const Image::ReadOptions& options);
+
+        /// Adds a freshly read image to the cache, holding a reference to it.
+        ///
+        /// The cache takes ownership of the image. If another thread has cached the same image
+        /// in the meantime, the new copy is discarded in favour of the existing one.
+        ///
+        /// @return     The cached image.
+        ///
+        static Image *Insert(const Key& key, Image *image, const Image::ReadOptions& options);
+
+        /// Returns a reference to an image.
+        ///
+        /// @return     `false` if the image is not owned by the cache, in which case the caller remains responsible for it.
+        ///
+        static bool Release(const Image *image);
+
+        /// Obtains an image that may safely be modified.
+        ///
+        /// If the image is owned by the cache, the reference to it is returned, and a private
+        /// copy is created in its stead; otherwise, the image itself is returned.
+        ///
+        /// @note
+        ///     Only indexed images are currently supported.
+        ///
+        static Image *Unshare(Image *image);
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_CORE_IMAGECACHE_H
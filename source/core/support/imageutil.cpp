@@ -39,11 +39,13 @@
 #include <boost/scoped_ptr.hpp>
 
 #include "base/pov_err.h"
+#include "base/image/tiledimage.h"
 
 #include "core/colour/spectral.h"
 #include "core/material/normal.h"
 #include "core/material/pattern.h"
 #include "core/material/texture.h"
+#include "core/support/imagecache.h"
 
 #ifdef SYS_IMAGE_HEADER
 #include SYS_IMAGE_HEADER
@@ -91,6 +93,8 @@ static void norm_dist(DBL *factors, DBL x, DBL y);
 static void cubic(DBL *factors, DBL x);
 static void Interp(const ImageData *image, DBL xcoor, DBL ycoor, RGBFTColour& colour, int *index, bool premul);
 static void InterpolateBicubic(const ImageData *image, DBL xcoor, DBL ycoor, RGBFTColour& colour, int *index, bool premul);
+static void InterpolateMipMap(const ImageData *image, DBL xcoor, DBL ycoor, DBL footprint, RGBFTColour& colour, int *index, bool premul);
+static void InterpolateMipMapLevel(const ImageData *image, const Image *level, DBL xcoor, DBL ycoor, RGBFTColour& colour, bool premul);
 
 /*
  * 2-D to 3-D Procedural Texture Mapping of a Bitmapped Image onto an Object:
@@ -387,6 +391,14 @@ void image_colour_at(const ImageData *image, DBL xcoor, DBL ycoor, RGBFTColour&
 }
 
 void image_colour_at(const ImageData *image, DBL xcoor, DBL ycoor, RGBFTColour& colour, int *index, bool premul)
+{
+    image_colour_at(image, xcoor, ycoor, 0.0, colour, index, premul);
+}
+
+// The footprint is the size of the area to be filtered, in image pixels; values of 1 or less
+// indicate that the image is to be sampled according to its interpolation type as usual.
+
+void image_colour_at(const ImageData *image, DBL xcoor, DBL ycoor, DBL footprint, RGBFTColour& colour, int *index, bool premul)
 {
     *index = -1;
 
@@ -400,17 +412,22 @@ void image_colour_at(const ImageData *image, DBL xcoor, DBL ycoor, RGBFTColour&
     bool getPremul = doProperTransmitAll ? (premul && image->data->IsPremultiplied()) :
                                            (premul || image->data->IsPremultiplied());
 
-    switch(image->Interpolation_Type)
+    if ((footprint > 1.0) && image->Mip_Map_Flag && !image->data->IsIndexed())
+        InterpolateMipMap(image, xcoor, ycoor, footprint, colour, index, getPremul);
+    else
     {
-        case NO_INTERPOLATION:
-            no_interpolation(image, xcoor, ycoor, colour, index, getPremul);
-            break;
-        case BICUBIC:
-            InterpolateBicubic(image, xcoor, ycoor, colour, index, getPremul);
-            break;
-        default:
-            Interp(image, xcoor, ycoor, colour, index, getPremul);
-            break;
+        switch(image->Interpolation_Type)
+        {
+            case NO_INTERPOLATION:
+                no_interpolation(image, xcoor, ycoor, colour, index, getPremul);
+                break;
+            case BICUBIC:
+                InterpolateBicubic(image, xcoor, ycoor, colour, index, getPremul);
+                break;
+            default:
+                Interp(image, xcoor, ycoor, colour, index, getPremul);
+                break;
+        }
     }
     bool havePremul = getPremul;
 
@@ -522,6 +539,7 @@ HF_VAL image_height_at(const ImageData *image, int x, int y)
 
 bool is_image_opaque(const ImageData *image)
 {
+    image->Resolve();
     return image->data->IsOpaque();
 }
 
@@ -924,6 +942,9 @@ static int planar_image_map(const Vector3d& EPoint, const ImageData *image, DBL
 
 int map_pos(const Vector3d& EPoint, const ImageData* image, DBL *xcoor, DBL *ycoor)
 {
+    // Images are normally resolved by the end of parsing, but may be used earlier by parse-time functions.
+    image->Resolve();
+
     // Determine which mapper to use.
 
     switch(image->Map_Type)
@@ -1179,6 +1200,99 @@ static void InterpolateBicubic(const ImageData *image, DBL xcoor, DBL  ycoor, RG
 
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   InterpolateMipMap
+*
+* INPUT
+*
+*   footprint - size of the area to filter, in image pixels
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+* DESCRIPTION
+*
+*   Filters the image over an area of the given size, by interpolating
+*   bilinearly within the two reduced-resolution copies of the image whose
+*   pixel sizes bracket the footprint, and linearly between those two.
+*
+* CHANGES
+*
+******************************************************************************/
+
+static void InterpolateMipMap(const ImageData *image, DBL xcoor, DBL ycoor, DBL footprint, RGBFTColour& colour, int *index, bool premul)
+{
+    const vector<Image *>& levels = image->GetMipMap();
+    DBL lod = min(log(footprint) / log(2.0), (DBL)levels.size());
+    int lower = (int)lod;
+    DBL weight = lod - lower;
+
+    InterpolateMipMapLevel(image, (lower == 0 ? image->data : levels[lower-1]), xcoor, ycoor, colour, premul);
+
+    if (weight > 0.0)
+    {
+        RGBFTColour upperColour;
+        InterpolateMipMapLevel(image, levels[lower], xcoor, ycoor, upperColour, premul);
+        colour = RGBFTColour(PreciseRGBFTColour(colour) * (1.0 - weight) + PreciseRGBFTColour(upperColour) * weight);
+    }
+
+    if (image->AllTransmitLegacyMode)
+    {
+        // Legacy versions applied "transmit/filter all" before interpolation,
+        // and with little respect to an image's inherent alpha information.
+        colour.transm() += image->AllTransmit;
+        colour.filter() += image->AllFilter;
+    }
+
+    *index = -1;
+}
+
+static void InterpolateMipMapLevel(const ImageData *image, const Image *level, DBL xcoor, DBL ycoor, RGBFTColour& colour, bool premul)
+{
+    int levelWidth  = level->GetWidth();
+    int levelHeight = level->GetHeight();
+    int ixcoor, iycoor, x, y;
+    RGBFTColour cornerColour;
+    PreciseRGBFTColour tempColour;
+
+    // Convert to the level's pixel coordinates, relative to the pixel centres.
+    xcoor = xcoor * levelWidth  / image->iwidth  - 0.5;
+    ycoor = ycoor * levelHeight / image->iheight - 0.5;
+
+    ixcoor = (int)floor(xcoor);
+    iycoor = (int)floor(ycoor);
+    xcoor -= ixcoor;
+    ycoor -= iycoor;
+
+    for (int j = 0; j < 2; j ++)
+    {
+        for (int i = 0; i < 2; i ++)
+        {
+            if (image->Once_Flag)
+            {
+                x = clip(ixcoor + i, 0, levelWidth  - 1);
+                y = clip(iycoor + j, 0, levelHeight - 1);
+            }
+            else
+            {
+                x = (int)wrap((DBL)(ixcoor + i), (DBL)levelWidth);
+                y = (int)wrap((DBL)(iycoor + j), (DBL)levelHeight);
+            }
+            level->GetRGBFTValue(x, y, cornerColour, premul);
+            tempColour += PreciseRGBFTColour(cornerColour) * ((i ? xcoor : 1.0 - xcoor) * (j ? ycoor : 1.0 - ycoor));
+        }
+    }
+    colour = RGBFTColour(tempColour);
+}
+
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1300,6 +1414,7 @@ ImageData::ImageData() :
     Interpolation_Type(NO_INTERPOLATION),
     Once_Flag(false),
     AllTransmitLegacyMode(false),
+    Mip_Map_Flag(false),
     Use(USE_NONE),
     Gradient(1.0,-1.0,0.0),
     iwidth(0), iheight(0),
@@ -1307,11 +1422,12 @@ ImageData::ImageData() :
     Offset(0.0, 0.0),
     AllFilter(0.0), AllTransmit(0.0),
     Object(nullptr),
-    data(nullptr)
+    data(nullptr),
 #ifdef POV_VIDCAP_IMPL
     // beta-test feature
-    ,VidCap(nullptr)
+    VidCap(nullptr),
 #endif
+    mipMapBuilt(false)
 {}
 
 
@@ -1394,8 +1510,108 @@ ImageData::~ImageData()
         delete VidCap;
 #endif
 
-    if (data != nullptr)
+    if ((data != nullptr) && !ImageCache::Release(data))
         delete data;
+
+    for (vector<Image *>::iterator i = mipMap.begin(); i != mipMap.end(); ++i)
+        delete *i;
+}
+
+const vector<Image *>& ImageData::GetMipMap() const
+{
+    if (!mipMapBuilt)
+    {
+#if POV_MULTITHREADED
+        boost::mutex::scoped_lock lock(mipMapMutex);
+#endif
+        if (!mipMapBuilt)
+        {
+            BuildMipMap();
+            mipMapBuilt = true;
+        }
+    }
+    return mipMap;
+}
+
+void ImageData::FinishPending() const
+{
+    shared_ptr<PendingImage> decode;
+    decode.swap(pending);
+
+    ImageData *self = const_cast<ImageData *>(this);
+    self->data = decode->Wait();
+    self->iwidth = data->GetWidth();
+    self->iheight = data->GetHeight();
+
+    // sizes and offsets were set up based on a 1x1 pixel image
+    self->width *= iwidth;
+    self->height *= iheight;
+    self->Offset[U] *= iwidth;
+    self->Offset[V] *= iheight;
+}
+
+void ImageData::BuildMipMap() const
+{
+    if (data->IsIndexed())
+        return;
+
+    // Images paged in from tile cache files come with reduced-resolution copies of their own.
+    const TiledImage *tiled = dynamic_cast<const TiledImage *>(data);
+    if (tiled != nullptr)
+    {
+        for (unsigned int i = 1; i <= tiled->GetLevelCount(); i ++)
+            mipMap.push_back(tiled->CreateLevel(i));
+        return;
+    }
+
+    // Use linear encoding regardless of the original image, as the filtering needs to be done in linear space anyway.
+    Image::ImageDataType type;
+    if (data->IsFloat() || data->HasFilterTransmit())
+        type = Image::RGBFT_Float;
+    else if (data->IsGrayscale())
+        type = (data->HasAlphaChannel() ? Image::GrayA_Int16 : Image::Gray_Int16);
+    else
+        type = (data->HasAlphaChannel() ? Image::RGBA_Int16 : Image::RGB_Int16);
+
+    const Image *source = data;
+    unsigned int sourceWidth  = data->GetWidth();
+    unsigned int sourceHeight = data->GetHeight();
+    RGBFTColour colour;
+
+    while ((sourceWidth > 1) || (sourceHeight > 1))
+    {
+        unsigned int levelWidth  = max(sourceWidth  / 2, 1u);
+        unsigned int levelHeight = max(sourceHeight / 2, 1u);
+        Image *level = Image::Create(levelWidth, levelHeight, type);
+        level->SetPremultiplied(true);
+
+        // Each pixel averages the 2x2 (or, for odd sizes, up to 3x3) pixels of the previous level it covers.
+        for (unsigned int y = 0; y < levelHeight; y ++)
+        {
+            unsigned int y0 = (y * sourceHeight) / levelHeight;
+            unsigned int y1 = ((y + 1) * sourceHeight) / levelHeight;
+            for (unsigned int x = 0; x < levelWidth; x ++)
+            {
+                unsigned int x0 = (x * sourceWidth) / levelWidth;
+                unsigned int x1 = ((x + 1) * sourceWidth) / levelWidth;
+                PreciseRGBFTColour sum;
+                for (unsigned int sy = y0; sy < y1; sy ++)
+                {
+                    for (unsigned int sx = x0; sx < x1; sx ++)
+                    {
+                        source->GetRGBFTValue(sx, sy, colour, true);
+                        sum += PreciseRGBFTColour(colour);
+                    }
+                }
+                level->SetRGBFTValue(x, y, RGBFTColour(sum / (DBL)((x1 - x0) * (y1 - y0))));
+            }
+        }
+
+        mipMap.push_back(level);
+        source       = level;
+        sourceWidth  = levelWidth;
+        sourceHeight = levelHeight;
+    }
 }
 
 
@@ -40,6 +40,8 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include <boost/thread.hpp>
+
 #include "base/image/image.h"
 
 #include "core/coretypes.h"
@@ -97,6 +99,25 @@ enum
     USE_ALPHA        = 3
 };
 
+/// Input image still being decoded in the background.
+///
+/// The parser sets this up for images whose pixels are not needed right away, so that decoding them
+/// overlaps with parsing the remainder of the scene; see @ref ImageData::Resolve().
+///
+class PendingImage
+{
+    public:
+        virtual ~PendingImage() {}
+
+        /// Wait for the decode to finish.
+        ///
+        /// @note   Any error that occurred while decoding is re-thrown here.
+        ///
+        /// @return The decoded image, owned by the caller.
+        ///
+        virtual Image *Wait() = 0;
+};
+
 class ImageData
 {
     public:
@@ -105,6 +126,7 @@ class ImageData
         int Interpolation_Type;
         bool Once_Flag : 1;
         bool AllTransmitLegacyMode : 1;
+        bool Mip_Map_Flag : 1; // Filter lookups according to the ray footprint
         char Use;
         Vector3d Gradient;
         int iwidth, iheight;
@@ -122,8 +144,44 @@ class ImageData
         POV_VIDCAP_IMPL *VidCap;
 #endif
 
+        /// Decode of @ref data still in progress, if any.
+        ///
+        /// While it is, @ref iwidth and @ref iheight are set to 1, so that sizes and offsets derived
+        /// from them can be rescaled once the actual dimensions are known.
+        ///
+        mutable shared_ptr<PendingImage> pending;
+
         ImageData();
         ~ImageData();
+
+        /// Make sure @ref data is available, waiting for a pending decode if necessary.
+        ///
+        /// @note
+        ///     This is not thread-safe; the parser resolves all images before rendering starts.
+        ///
+        void Resolve() const { if (pending != nullptr) FinishPending(); }
+
+        /// Gets the reduced-resolution copies of the image, building them on first use.
+        ///
+        /// Each level has half the resolution of the previous one (rounded down), the first
+        /// level having half the resolution of the image itself, down to a size of 1x1 pixel.
+        /// The levels are stored in linear encoding, and with premultiplied alpha.
+        ///
+        /// @note
+        ///     Indexed images have no reduced-resolution copies.
+        ///
+        const vector<Image *>& GetMipMap() const;
+
+    protected:
+
+        mutable vector<Image *> mipMap;
+        mutable volatile bool mipMapBuilt;
+#if POV_MULTITHREADED
+        mutable boost::mutex mipMapMutex;
+#endif
+
+        void BuildMipMap() const;
+        void FinishPending() const;
 };
 
 typedef ImageData *ImageDataPtr;
@@ -133,6 +191,7 @@ TEXTURE *material_map(const Vector3d& IPoint, const TEXTURE *Texture);
 void bump_map(const Vector3d& EPoint, const TNORMAL *Tnormal, Vector3d& normal);
 void image_colour_at(const ImageData *image, DBL xcoor, DBL ycoor, RGBFTColour& colour, int *index); // TODO ALPHA - caller should decide whether to prefer premultiplied or non-premultiplied alpha
 void image_colour_at(const ImageData *image, DBL xcoor, DBL ycoor, RGBFTColour& colour, int *index, bool premul);
+void image_colour_at(const ImageData *image, DBL xcoor, DBL ycoor, DBL footprint, RGBFTColour& colour, int *index, bool premul);
 HF_VAL image_height_at(const ImageData *image, int x, int y);
 bool is_image_opaque(const ImageData *image);
 int map_pos(const Vector3d& EPoint, const ImageData* pImage, DBL *xcoor, DBL *ycoor);
@@ -48,6 +48,8 @@
 
 #include <climits>
 
+#include "base/memoryaccounting.h"
+
 #include "core/coretypes.h"
 #include "core/math/vector.h"
 
@@ -130,7 +132,7 @@ struct ot_id_struct
 };
 
 // These are the structures that make up the oct-tree itself, known as nodes
-struct ot_node_struct
+struct ot_node_struct : public MemoryAccounted<kMemoryRadiosity>
 {
     OT_ID    Id;
     OT_BLOCK *Values;
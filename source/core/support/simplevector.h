@@ -614,6 +614,19 @@ private:
 
 //******************************************************************************
 
+/// Number of heap allocations made so far by the calling thread's vector pools.
+///
+/// Once the pools have warmed up, tracing should no longer need any; render tasks report the
+/// increase during their run in the render statistics.
+///
+inline POV_ULONG& VectorPoolHeapAllocations()
+{
+    static thread_local POV_ULONG count = 0;
+    return count;
+}
+
+//******************************************************************************
+
 /// Helper class for @ref PooledSimpleVector
 ///
 /// @attention
@@ -650,6 +663,7 @@ public:
         if (mPool.empty())
         {
             p = new VECTOR_T();
+            VectorPoolHeapAllocations()++;
         }
         else
         {
@@ -657,14 +671,22 @@ public:
             mPool.pop_back();
         }
         p->clear();
-        if (mSizeHint != 0)
+        if (p->capacity() < mSizeHint)
+        {
             p->reserve(mSizeHint);
+            VectorPoolHeapAllocations()++;
+        }
         return p;
     }
 
     void release(VECTOR_T* p)
     {
-        mSizeHint = p->capacity();
+        // A vector returned with more capacity than we handed it out with must have grown while in use.
+        if (p->capacity() > mSizeHint)
+        {
+            mSizeHint = p->capacity();
+            VectorPoolHeapAllocations()++;
+        }
         mPool.push_back(p);
     }
 
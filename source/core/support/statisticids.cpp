@@ -93,6 +93,10 @@ const INTERSECTION_STATS_INFO intersection_stats[kPOVList_Stat_Last] =
       "Disc" },
     { kPOVList_Stat_FractalTest,        Ray_Fractal_Tests, Ray_Fractal_Tests_Succeeded,
       "Fractal" },
+    { kPOVList_Stat_HairTest,           Ray_Hair_Tests, Ray_Hair_Tests_Succeeded,
+      "Hair" },
+    { kPOVList_Stat_HairSegmentTest,    Ray_Hair_Segment_Tests, Ray_Hair_Segment_Tests_Succeeded,
+      "Hair Segment" },
     { kPOVList_Stat_HFTest,             Ray_HField_Tests, Ray_HField_Tests_Succeeded,
       "Height Field" },
     { kPOVList_Stat_HFBoxTest,          Ray_HField_Box_Tests, Ray_HField_Box_Tests_Succeeded,
@@ -117,8 +121,14 @@ const INTERSECTION_STATS_INFO intersection_stats[kPOVList_Stat_Last] =
       "Lemon" },
     { kPOVList_Stat_MeshTest,           Ray_Mesh_Tests, Ray_Mesh_Tests_Succeeded,
       "Mesh" },
+    { kPOVList_Stat_MeshTriangleTest,   Ray_Mesh_Triangle_Tests, Ray_Mesh_Triangle_Tests_Succeeded,
+      "Mesh Triangle" },
     { kPOVList_Stat_OvusTest,           Ray_Ovus_Tests, Ray_Ovus_Tests_Succeeded,
       "Ovus" },
+    { kPOVList_Stat_PointCloudTest,     Ray_Point_Cloud_Tests, Ray_Point_Cloud_Tests_Succeeded,
+      "Point Cloud" },
+    { kPOVList_Stat_PointCloudParticleTest, Ray_Point_Cloud_Particle_Tests, Ray_Point_Cloud_Particle_Tests_Succeeded,
+      "Point Cloud Particle" },
     { kPOVList_Stat_PlaneTest,          Ray_Plane_Tests, Ray_Plane_Tests_Succeeded,
       "Plane" },
     { kPOVList_Stat_PolygonTest,        Ray_Polygon_Tests, Ray_Polygon_Tests_Succeeded,
@@ -166,4 +176,14 @@ const INTERSECTION_STATS_INFO intersection_stats[kPOVList_Stat_Last] =
     { kPOVList_Stat_Last, MaxIntStat, MaxIntStat, nullptr }
 };
 
+const TRAVERSAL_STATS_INFO traversal_stats[] =
+{
+    { Traversal_Camera_Rays,     Traversal_Camera_Nodes,     Traversal_Camera_Objects,     "Camera" },
+    { Traversal_Shadow_Rays,     Traversal_Shadow_Nodes,     Traversal_Shadow_Objects,     "Shadow" },
+    { Traversal_Reflection_Rays, Traversal_Reflection_Nodes, Traversal_Reflection_Objects, "Reflection/Refraction" },
+    { Traversal_Radiosity_Rays,  Traversal_Radiosity_Nodes,  Traversal_Radiosity_Objects,  "Radiosity" },
+    { Traversal_Photon_Rays,     Traversal_Photon_Nodes,     Traversal_Photon_Objects,     "Photon" },
+    { MaxIntStat, MaxIntStat, MaxIntStat, nullptr }
+};
+
 }
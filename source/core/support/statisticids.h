@@ -66,6 +66,8 @@ enum
     kPOVList_Stat_CSGUnionTest,
     kPOVList_Stat_DiscTest,
     kPOVList_Stat_FractalTest,
+    kPOVList_Stat_HairTest,
+    kPOVList_Stat_HairSegmentTest,
     kPOVList_Stat_HFTest,
     kPOVList_Stat_HFBoxTest,
     kPOVList_Stat_HFTriangleTest,
@@ -77,6 +79,9 @@ enum
     kPOVList_Stat_LatheTest,
     kPOVList_Stat_LatheBdTest,
     kPOVList_Stat_MeshTest,
+    kPOVList_Stat_MeshTriangleTest,
+    kPOVList_Stat_PointCloudTest,
+    kPOVList_Stat_PointCloudParticleTest,
     kPOVList_Stat_PlaneTest,
     kPOVList_Stat_PolygonTest,
     kPOVList_Stat_PrismTest,
@@ -144,6 +149,10 @@ typedef enum INTSTATS
     Ray_Disc_Tests_Succeeded,
     Ray_Fractal_Tests,
     Ray_Fractal_Tests_Succeeded,
+    Ray_Hair_Tests,
+    Ray_Hair_Tests_Succeeded,
+    Ray_Hair_Segment_Tests,
+    Ray_Hair_Segment_Tests_Succeeded,
     Ray_HField_Tests,
     Ray_HField_Tests_Succeeded,
     Ray_HField_Box_Tests,
@@ -168,8 +177,14 @@ typedef enum INTSTATS
     Ray_Lemon_Tests_Succeeded,
     Ray_Mesh_Tests,
     Ray_Mesh_Tests_Succeeded,
+    Ray_Mesh_Triangle_Tests,
+    Ray_Mesh_Triangle_Tests_Succeeded,
     Ray_Ovus_Tests,
     Ray_Ovus_Tests_Succeeded,
+    Ray_Point_Cloud_Tests,
+    Ray_Point_Cloud_Tests_Succeeded,
+    Ray_Point_Cloud_Particle_Tests,
+    Ray_Point_Cloud_Particle_Tests_Succeeded,
     Ray_Plane_Tests,
     Ray_Plane_Tests_Succeeded,
     Ray_Polygon_Tests,
@@ -236,9 +251,29 @@ typedef enum INTSTATS
     Transmitted_Rays_Traced,
     Internal_Reflected_Rays_Traced,
     Shadow_Cache_Hits,
+    Shadow_Cache_Tests,
     Shadow_Rays_Succeeded,
     Shadow_Ray_Tests,
 
+    /* Russian roulette */
+    Roulette_Tests_L1,                // rays subjected to Russian roulette at trace level 1
+    Roulette_Tests_L2,                //  ...
+    Roulette_Tests_L3,
+    Roulette_Tests_L4,
+    Roulette_Tests_L5ff,              // rays subjected to Russian roulette at trace level 5 or deeper
+    Roulette_Kills_L1,                // rays terminated by Russian roulette at trace level 1
+    Roulette_Kills_L2,                //  ...
+    Roulette_Kills_L3,
+    Roulette_Kills_L4,
+    Roulette_Kills_L5ff,              // rays terminated by Russian roulette at trace level 5 or deeper
+
+    /* CSG */
+    CSG_Merge_Hit_Tests,              // hits of merge children tested against their siblings
+    CSG_Merge_Inside_Tests,           // sibling inside tests made for them
+
+    Trace_Heap_Allocations,           // heap allocations of thread-local scratch storage while tracing
+    Reused_Camera_Rays,               // camera ray samples taken from an earlier pass or neighbouring block rather than traced
+
     nChecked,
     nEnqueued,
     totalQueues,
@@ -315,6 +350,27 @@ typedef enum INTSTATS
     Radiosity_QueryCount_R3,          // ...
     Radiosity_QueryCount_R4ff,        // ...
 
+    BSP_Mailbox_Hits,                 // object tests in BSP tree avoided by mailbox
+    BSP_Node_Visits,                  // nodes visited during BSP tree traversal
+    Scene_Object_Tests,               // top-level scene objects tested for intersection
+
+    // bounding hierarchy traversal cost by ray type, see traversal_stats
+    Traversal_Camera_Rays,
+    Traversal_Camera_Nodes,
+    Traversal_Camera_Objects,
+    Traversal_Shadow_Rays,
+    Traversal_Shadow_Nodes,
+    Traversal_Shadow_Objects,
+    Traversal_Reflection_Rays,
+    Traversal_Reflection_Nodes,
+    Traversal_Reflection_Objects,
+    Traversal_Radiosity_Rays,
+    Traversal_Radiosity_Nodes,
+    Traversal_Radiosity_Objects,
+    Traversal_Photon_Rays,
+    Traversal_Photon_Nodes,
+    Traversal_Photon_Objects,
+
     /* Must be the last */
     MaxIntStat
 
@@ -342,6 +398,28 @@ typedef struct intersection_stats_info
 
 extern const INTERSECTION_STATS_INFO intersection_stats[];
 
+/// Ray types distinguished in the bounding hierarchy traversal statistics.
+enum TraversalRayType
+{
+    kTraversalRay_Camera,       ///< Primary rays.
+    kTraversalRay_Shadow,       ///< Shadow test rays, except those listed below.
+    kTraversalRay_Reflection,   ///< Reflected and refracted rays, except those listed below.
+    kTraversalRay_Radiosity,    ///< Rays traced to gather radiosity samples.
+    kTraversalRay_Photon,       ///< Rays traced to shoot photons.
+    kTraversalRay_Last
+};
+
+typedef struct traversal_stats_info
+{
+    IntStatsIndex stat_rays_id;
+    IntStatsIndex stat_nodes_id;
+    IntStatsIndex stat_objects_id;
+    const char *infotext;
+} TRAVERSAL_STATS_INFO;
+
+/// Counters of the bounding hierarchy traversal statistics, indexed by @ref TraversalRayType.
+extern const TRAVERSAL_STATS_INFO traversal_stats[];
+
 /// @}
 ///
 //##############################################################################
@@ -39,6 +39,7 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "core/configcore.h"
 
+#include <atomic>
 #include <vector>
 
 #include "core/support/statisticids.h"
@@ -55,24 +56,34 @@ namespace pov
 
 using namespace pov_base;
 
+/// Statistics counter.
+///
+/// Each counter must only ever be modified by a single thread, but may be read by any thread at any
+/// time, e.g. to report progress. To this end, the value is accessed with relaxed atomic operations,
+/// which compile to plain loads and stores on all common platforms, yet guarantee that readers never
+/// see a torn value.
+///
 template <typename T>
-class Counter
+class Counter final
 {
     public:
-        Counter() { value = 0; } // assumes for all types of T that 0 is a valid assignment
-        virtual ~Counter() { }
-        inline T operator+(T other) { return value + other; }
-        inline T operator-(T other) { return value - other; }
-        inline T operator++(int) { return value++; }
-        inline T operator--(int) { return value--; }
-        inline void operator+=(T other) { value += other; }
-        inline void operator-=(T other) { value -= other; }
-        inline const T operator=(T other) { value = other; return value; }
-        inline operator T() const { return value; }
-        bool SafeRead(unsigned int maxattempts, T *result) const;
+        Counter() : value(0) {} // assumes for all types of T that 0 is a valid assignment
+        Counter(const Counter& other) : value(other.Read()) {}
+        inline Counter& operator=(const Counter& other) { Write(other.Read()); return *this; }
+        inline T operator+(T other) const { return Read() + other; }
+        inline T operator-(T other) const { return Read() - other; }
+        inline T operator++(int) { T old = Read(); Write(old + 1); return old; }
+        inline T operator--(int) { T old = Read(); Write(old - 1); return old; }
+        inline void operator+=(T other) { Write(Read() + other); }
+        inline void operator-=(T other) { Write(Read() - other); }
+        inline const T operator=(T other) { Write(other); return other; }
+        inline operator T() const { return Read(); }
+        inline T Read() const { return value.load(std::memory_order_relaxed); }
 
     private:
-        volatile T value;
+        inline void Write(T v) { value.store(v, std::memory_order_relaxed); }
+
+        std::atomic<T> value;
 };
 
 template <typename T, int numElem>
@@ -97,6 +108,11 @@ class StatisticsBase
 typedef StatisticsBase<POV_ULONG, MaxIntStat> IntStatistics;
 typedef StatisticsBase<double, MaxFPStat> FPStatistics;
 
+/// Render statistics of a single thread.
+///
+/// The counters are padded to keep them clear of the cache lines of any neighbouring data, so that
+/// updating them never slows down other threads.
+///
 class RenderStatistics
 {
 public:
@@ -114,8 +130,10 @@ public:
     inline void operator+=(const RenderStatistics& rhs) { intStats += rhs.intStats; fpStats += rhs.fpStats; }
 
 protected:
+    char leadingPadding[POV_CACHE_LINE_SIZE];
     IntStatistics intStats;
     FPStatistics fpStats;
+    char trailingPadding[POV_CACHE_LINE_SIZE];
 };
 
 /// @}
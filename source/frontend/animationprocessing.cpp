@@ -36,6 +36,9 @@
 // Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
 #include "frontend/animationprocessing.h"
 
+// C++ standard header files
+#include <atomic>
+
 #include "povms/povmsid.h"
 
 // this must be the last file included
@@ -45,8 +48,11 @@ namespace pov_frontend
 {
 
 AnimationProcessing::AnimationProcessing(POVMS_Object& options) :
-    renderOptions(options)
+    renderOptions(options),
+    runId(0)
 {
+    static std::atomic<POVMSLong> lastRunId(0);
+
     bool cyclic = renderOptions.TryGetBool(kPOVAttrib_CyclicAnimation, false);
 
     initialFrame = max(renderOptions.TryGetInt(kPOVAttrib_InitialFrame, 1), 0);
@@ -116,16 +122,32 @@ AnimationProcessing::AnimationProcessing(POVMS_Object& options) :
     frameNumberDigits = 1;
     for(POVMSInt i = finalFrame; i >= 10; i /= 10)
         frameNumberDigits++;
+
+    // objects carried over between frames must come from a frame of the same animation
+    if(renderOptions.TryGetBool(kPOVAttrib_IncrementalAnimation, false))
+        runId = ++lastRunId;
 }
 
-POVMS_Object AnimationProcessing::GetFrameRenderOptions()
+POVMS_Object AnimationProcessing::GetFrameRenderOptions(int ahead)
 {
     POVMS_Object opts(renderOptions);
+    POVMSInt frameNumber = nominalFrameNumber + ahead * frameStep;
+    POVMSFloat frameClock = clockValue;
+
+    if(ahead > 0)
+        frameClock = POVMSFloat(double(clockDelta * double(frameNumber - initialFrame)) + double(initialClock));
+
+    opts.SetFloat(kPOVAttrib_Clock, frameClock);
+
+    // when the scene is parsed only once, each frame is rendered with the next of the scene's cameras
+    if(renderOptions.TryGetBool(kPOVAttrib_ReuseScene, false))
+        opts.SetInt(kPOVAttrib_CameraIndex, frameNumber - initialFrame);
 
-    opts.SetFloat(kPOVAttrib_Clock, clockValue);
+    if(runId != 0)
+        opts.SetLong(kPOVAttrib_AnimationRunId, runId);
 
     // append to console files if not first frame (user can set this for first frame via command line to append all data to existing files, so don't set it to false)
-    if(nominalFrameNumber > subsetStartFrame)
+    if(frameNumber > subsetStartFrame)
         opts.SetBool(kPOVAttrib_AppendConsoleFiles, true);
 
     POVMS_List declares;
@@ -149,7 +171,7 @@ POVMS_Object AnimationProcessing::GetFrameRenderOptions()
 
     POVMS_Object frame_number(kPOVMSType_WildCard);
     frame_number.SetString(kPOVAttrib_Identifier, "frame_number");
-    frame_number.SetFloat(kPOVAttrib_Value, nominalFrameNumber);
+    frame_number.SetFloat(kPOVAttrib_Value, frameNumber);
     declares.Append(frame_number);
 
     POVMS_Object initial_clock(kPOVMSType_WildCard);
@@ -177,9 +199,9 @@ void AnimationProcessing::ComputeNextFrame()
     clockValue = POVMSFloat(double(clockDelta * double(nominalFrameNumber - initialFrame)) + double(initialClock));
 }
 
-bool AnimationProcessing::MoreFrames()
+bool AnimationProcessing::MoreFrames(int ahead)
 {
-    return (nominalFrameNumber+frameStep <= subsetEndFrame);
+    return (nominalFrameNumber+(ahead+1)*frameStep <= subsetEndFrame);
 }
 
 POVMSInt AnimationProcessing::GetNominalFrameNumber()
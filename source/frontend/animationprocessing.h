@@ -53,9 +53,18 @@ class AnimationProcessing
     public:
         AnimationProcessing(POVMS_Object& options);
 
-        POVMS_Object GetFrameRenderOptions();
+        /// Get the render options of the current frame, or of a frame further ahead.
+        ///
+        /// @param  ahead   Number of frames to look ahead of the current one.
+        ///
+        POVMS_Object GetFrameRenderOptions(int ahead = 0);
         void ComputeNextFrame();
-        bool MoreFrames();
+
+        /// Check whether there are more frames to render after the current one, or after a frame further ahead.
+        ///
+        /// @param  ahead   Number of frames to look ahead of the current one.
+        ///
+        bool MoreFrames(int ahead = 0);
 
         /// Get nominal frame number.
         POVMSInt GetNominalFrameNumber();
@@ -97,6 +106,9 @@ class AnimationProcessing
 
         double clockDelta;
         int frameNumberDigits;
+
+        /// Identifies this animation to the parser, or zero if frames are parsed independently.
+        POVMSLong runId;
 };
 
 }
@@ -0,0 +1,248 @@
+//******************************************************************************
+///
+/// @file frontend/denoiser.cpp
+///
+/// Denoising stage of the output pipeline.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "frontend/denoiser.h"
+
+// C++ variants of C standard header files
+#include <cmath>
+
+// Standard C++ header files
+#include <algorithm>
+
+// Boost header files
+#include <boost/bind.hpp>
+
+// POV-Ray header files (base module)
+#include "base/jobscheduler.h"
+#include "base/pov_err.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_frontend
+{
+
+/// Number of filter passes; pass i has its taps 2^i pixels apart.
+const int kDenoisePasses = 5;
+
+/// Number of rows filtered by each job.
+const unsigned int kDenoiseStripeRows = 16;
+
+/// Bias added to the albedo before it is divided out, so that dark surfaces don't amplify the noise.
+const float kDenoiseAlbedoBias = 0.01f;
+
+/// Tolerated difference in albedo.
+const float kDenoiseAlbedoSigma = 0.1f;
+
+/// Tolerated relative difference in depth per pixel of distance between taps.
+const float kDenoiseDepthSigma = 0.02f;
+
+/// Tolerated relative difference in brightness in the first pass, at a strength of 1; halved with each pass.
+const float kDenoiseColourSigma = 0.5f;
+
+/// B3 spline weights of the filter taps.
+static const float kDenoiseKernel[5] = { 1.0f / 16.0f, 1.0f / 4.0f, 3.0f / 8.0f, 1.0f / 4.0f, 1.0f / 16.0f };
+
+/// Settings and buffers of a single filter pass.
+struct DenoisePass
+{
+    const DenoiseFeatures *features;
+    const float *input;
+    float *output;
+    int step;
+    float colourSigma;
+};
+
+static inline float Luminance(const float *colour)
+{
+    return 0.2126f * colour[0] + 0.7152f * colour[1] + 0.0722f * colour[2];
+}
+
+static void FilterRows(const DenoisePass *pass, unsigned int firstRow, unsigned int endRow)
+{
+    const DenoiseFeatures& features = *pass->features;
+    int width = int(features.width);
+    int height = int(features.height);
+    int step = pass->step;
+    float colourScale = 1.0f / (pass->colourSigma * pass->colourSigma);
+    float albedoScale = 1.0f / (kDenoiseAlbedoSigma * kDenoiseAlbedoSigma);
+    float depthScale = 1.0f / (kDenoiseDepthSigma * float(step));
+
+    for (int y = int(firstRow); y < int(endRow); y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            size_t p = size_t(y) * width + x;
+            const float *cp = pass->input + p * 3;
+            float *op = pass->output + p * 3;
+            float zp = features.depth[p];
+
+            if (zp <= 0.0f)
+            {
+                op[0] = cp[0]; op[1] = cp[1]; op[2] = cp[2];
+                continue;
+            }
+
+            const float *np = &features.normal[p * 3];
+            const float *ap = &features.albedo[p * 3];
+            float lp = Luminance(cp);
+            float sum[3] = { 0.0f, 0.0f, 0.0f };
+            float weightSum = 0.0f;
+
+            for (int j = -2; j <= 2; j++)
+            {
+                int qy = y + j * step;
+                if ((qy < 0) || (qy >= height))
+                    continue;
+
+                for (int i = -2; i <= 2; i++)
+                {
+                    int qx = x + i * step;
+                    if ((qx < 0) || (qx >= width))
+                        continue;
+
+                    size_t q = size_t(qy) * width + qx;
+                    float zq = features.depth[q];
+                    if (zq <= 0.0f)
+                        continue;
+
+                    // the normals need to be close to parallel; raise their cosine to the 64th power
+                    const float *nq = &features.normal[q * 3];
+                    float cosine = std::max(0.0f, np[0] * nq[0] + np[1] * nq[1] + np[2] * nq[2]);
+                    for (int k = 0; k < 6; k++)
+                        cosine *= cosine;
+                    if (cosine <= 0.0f)
+                        continue;
+
+                    const float *aq = &features.albedo[q * 3];
+                    const float *cq = pass->input + q * 3;
+                    float dz = std::fabs(zp - zq) / zp;
+                    float da = (ap[0] - aq[0]) * (ap[0] - aq[0]) + (ap[1] - aq[1]) * (ap[1] - aq[1]) + (ap[2] - aq[2]) * (ap[2] - aq[2]);
+                    float lq = Luminance(cq);
+                    float dl = std::fabs(lp - lq) / (lp + lq + 1.0e-4f);
+
+                    float weight = kDenoiseKernel[i + 2] * kDenoiseKernel[j + 2] * cosine *
+                                   std::exp(-dz * depthScale - da * albedoScale - dl * dl * colourScale);
+                    sum[0] += weight * cq[0];
+                    sum[1] += weight * cq[1];
+                    sum[2] += weight * cq[2];
+                    weightSum += weight;
+                }
+            }
+
+            if (weightSum > 0.0f)
+            {
+                op[0] = sum[0] / weightSum;
+                op[1] = sum[1] / weightSum;
+                op[2] = sum[2] / weightSum;
+            }
+            else
+            {
+                op[0] = cp[0]; op[1] = cp[1]; op[2] = cp[2];
+            }
+        }
+    }
+}
+
+void EdgeAwareDenoiser::Denoise(Image& image, const DenoiseFeatures& features)
+{
+    unsigned int width = image.GetWidth();
+    unsigned int height = image.GetHeight();
+    size_t pixels = size_t(width) * size_t(height);
+
+    if ((features.width != width) || (features.height != height) ||
+        (features.albedo.size() != pixels * 3) || (features.normal.size() != pixels * 3) || (features.depth.size() != pixels))
+        throw POV_EXCEPTION(kInvalidDataSizeErr, "Size of denoising features does not match image size!");
+
+    // divide out the albedo, leaving only the illumination to be filtered
+    std::vector<float> illumination(pixels * 3);
+    std::vector<float> scratch(pixels * 3);
+    for (unsigned int y = 0; y < height; y++)
+    {
+        for (unsigned int x = 0; x < width; x++)
+        {
+            size_t p = size_t(y) * width + x;
+            float *c = &illumination[p * 3];
+            float filter, transm;
+            image.GetRGBFTValue(x, y, c[0], c[1], c[2], filter, transm);
+            if (features.depth[p] > 0.0f)
+            {
+                for (int k = 0; k < 3; k++)
+                    c[k] /= features.albedo[p * 3 + k] + kDenoiseAlbedoBias;
+            }
+        }
+    }
+
+    DenoisePass pass;
+    pass.features = &features;
+    pass.colourSigma = mStrength * kDenoiseColourSigma;
+    for (int i = 0; i < kDenoisePasses; i++)
+    {
+        pass.input = &illumination[0];
+        pass.output = &scratch[0];
+        pass.step = 1 << i;
+
+        JobGroup jobs;
+        for (unsigned int row = 0; row < height; row += kDenoiseStripeRows)
+            jobs.Run(boost::bind(&FilterRows, &pass, row, std::min(row + kDenoiseStripeRows, height)));
+        jobs.Wait();
+
+        illumination.swap(scratch);
+        pass.colourSigma *= 0.5f;
+    }
+
+    // restore the albedo
+    for (unsigned int y = 0; y < height; y++)
+    {
+        for (unsigned int x = 0; x < width; x++)
+        {
+            size_t p = size_t(y) * width + x;
+            if (features.depth[p] <= 0.0f)
+                continue;
+
+            const float *c = &illumination[p * 3];
+            float red, green, blue, filter, transm;
+            image.GetRGBFTValue(x, y, red, green, blue, filter, transm);
+            image.SetRGBFTValue(x, y,
+                                c[0] * (features.albedo[p * 3]     + kDenoiseAlbedoBias),
+                                c[1] * (features.albedo[p * 3 + 1] + kDenoiseAlbedoBias),
+                                c[2] * (features.albedo[p * 3 + 2] + kDenoiseAlbedoBias),
+                                filter, transm);
+        }
+    }
+}
+
+}
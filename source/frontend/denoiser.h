@@ -0,0 +1,108 @@
+//******************************************************************************
+///
+/// @file frontend/denoiser.h
+///
+/// Denoising stage of the output pipeline.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_FRONTEND_DENOISER_H
+#define POVRAY_FRONTEND_DENOISER_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "frontend/configfrontend.h"
+
+#include <vector>
+
+#include "base/image/image.h"
+
+namespace pov_frontend
+{
+
+using namespace pov_base;
+
+/// Properties of the first surfaces hit in each pixel of an image, guiding a @ref Denoiser.
+///
+/// All values are averages over the rays traced on behalf of a pixel, in rows from top to bottom.
+/// Pixels in which nothing was hit have a depth of zero.
+///
+struct DenoiseFeatures
+{
+    unsigned int width;
+    unsigned int height;
+    std::vector<float> albedo;  ///< Pigment colour, three values per pixel.
+    std::vector<float> normal;  ///< Unit surface normal, three values per pixel.
+    std::vector<float> depth;   ///< Distance from the camera, one value per pixel.
+
+    DenoiseFeatures() : width(0), height(0) {}
+};
+
+/// Interface of a denoising stage of the output pipeline.
+///
+/// The built-in implementation is @ref EdgeAwareDenoiser; front-ends may plug in an external
+/// denoiser instead via @ref ImageProcessing::SetDenoiser().
+///
+class Denoiser
+{
+    public:
+        virtual ~Denoiser() {}
+
+        /// Denoise an image in place.
+        /// @param[in,out]  image       Rendered image.
+        /// @param[in]      features    Surfaces hit in each pixel of the image.
+        virtual void Denoise(Image& image, const DenoiseFeatures& features) = 0;
+};
+
+/// Edge-aware wavelet filter guided by the surfaces hit in each pixel.
+///
+/// The image is first divided by the albedo, so that only the illumination is filtered, while
+/// texture detail is restored afterwards. The illumination is then smoothed by a few passes of
+/// an "à trous" wavelet filter of growing footprint, whose taps are weighted down wherever the
+/// normal, depth, albedo or brightness differ from the centre pixel's, so that the edges of
+/// objects and shadows are preserved. See Dammertz et al., "Edge-Avoiding À-Trous Wavelet
+/// Transform for fast Global Illumination Filtering", HPG 2010.
+///
+/// Pixels in which nothing was hit are left alone.
+///
+class EdgeAwareDenoiser final : public Denoiser
+{
+    public:
+        /// @param[in]  strength    Tolerance for differences in brightness; higher values smooth more.
+        EdgeAwareDenoiser(float strength = 1.0f) : mStrength(strength) {}
+
+        virtual void Denoise(Image& image, const DenoiseFeatures& features);
+
+    private:
+        float mStrength;
+};
+
+}
+
+#endif // POVRAY_FRONTEND_DENOISER_H
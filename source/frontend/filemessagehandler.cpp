@@ -36,6 +36,11 @@
 // Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
 #include "frontend/filemessagehandler.h"
 
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <set>
+
 #include "base/fileinputoutput.h"
 
 #include "frontend/renderfrontend.h"
@@ -46,6 +51,133 @@
 namespace pov_frontend
 {
 
+/// Listings of the directories searched for files, shared by all renders in the process.
+///
+/// Searching for a file means trying each library path with each file name extension in turn,
+/// and on network file systems each failed attempt may take milliseconds. Instead, each
+/// directory searched is listed once, and the listing is used to rule out names that do not
+/// exist there; names that may exist are still checked on the file system as before.
+///
+/// A listing is re-read when the directory's modification time has changed, which is checked
+/// once per search, and dropped when a file is created in the directory. Listings of
+/// directories modified within the last few seconds are not relied upon, as further changes
+/// might go unnoticed within the resolution of the modification time.
+///
+class DirectoryCache
+{
+    public:
+
+        DirectoryCache() : mSearch(0) {}
+
+        /// Start a new search, returning its number.
+        unsigned int BeginSearch()
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            return ++mSearch;
+        }
+
+        /// Check whether a file may exist, returning `false` only if it is known not to.
+        bool MayExist(const Path& file, unsigned int search);
+
+        /// Forget what is known about the directory of a file.
+        void Invalidate(const Path& file)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mListings.erase(Directory(file));
+        }
+
+    private:
+
+        /// Directory listing.
+        struct Listing
+        {
+            std::set<UCS2String> names;     ///< Entry names, with ASCII letters folded to lower case.
+            POV_LONG stamp;                 ///< Modification time of the directory when listed.
+            unsigned int search;            ///< Search in which the modification time was last checked.
+            bool valid;                     ///< Whether the listing may be relied upon.
+        };
+
+        /// Seconds within which a directory counts as recently modified.
+        static const POV_LONG kRecentSeconds = 2;
+
+        std::map<UCS2String, Listing> mListings;
+        std::mutex mMutex;
+        unsigned int mSearch;
+
+        static UCS2String Directory(const Path& file)
+        {
+            Path dir(file);
+            dir.SetFile(UCS2String());
+            return dir();
+        }
+
+        /// Fold ASCII letters to lower case, returning `false` if the name has other characters.
+        static bool Fold(UCS2String& name)
+        {
+            for (UCS2String::iterator i = name.begin(); i != name.end(); i++)
+            {
+                if (*i >= 0x80)
+                    return false;
+                if ((*i >= 'A') && (*i <= 'Z'))
+                    *i += 'a' - 'A';
+            }
+            return true;
+        }
+
+        void Read(const UCS2String& dir, Listing& listing);
+};
+
+bool DirectoryCache::MayExist(const Path& file, unsigned int search)
+{
+    UCS2String name(file.GetFile());
+    POV_LONG stamp;
+
+    // names are compared case-insensitively to suit all file systems; leave anything else alone
+    if (name.empty() || !Fold(name))
+        return true;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    UCS2String dir(Directory(file));
+    std::map<UCS2String, Listing>::iterator i = mListings.find(dir);
+
+    if (i == mListings.end())
+    {
+        i = mListings.insert(std::make_pair(dir, Listing())).first;
+        Read(dir, i->second);
+        i->second.search = search;
+    }
+    else if (i->second.search != search)
+    {
+        i->second.search = search;
+        if (!GetDirectoryStamp(dir, stamp) || (stamp != i->second.stamp) || !i->second.valid)
+            Read(dir, i->second);
+    }
+
+    return (!i->second.valid || (i->second.names.count(name) > 0));
+}
+
+void DirectoryCache::Read(const UCS2String& dir, Listing& listing)
+{
+    vector<UCS2String> names;
+
+    listing.names.clear();
+    listing.valid = ReadDirectory(dir, names, listing.stamp) &&
+                    (listing.stamp / 1000000000 + kRecentSeconds < POV_LONG(std::time(nullptr)));
+
+    if (!listing.valid)
+        return;
+
+    for (vector<UCS2String>::iterator i = names.begin(); i != names.end(); i++)
+    {
+        // names that cannot be folded are never looked up
+        if (Fold(*i))
+            listing.names.insert(*i);
+    }
+}
+
+static DirectoryCache gDirectoryCache;
+
 FileMessageHandler::FileMessageHandler()
 {
 }
@@ -77,6 +209,8 @@ bool FileMessageHandler::FindFile(const list<Path>& lps, POVMS_Object& msg, POVM
     POVMS_List files;
     Path path;
 
+    unsigned int search = gDirectoryCache.BeginSearch();
+
     msg.Get(kPOVAttrib_ReadFile, files);
 
     for(int i = 1; i <= files.GetListSize(); i++)
@@ -85,7 +219,7 @@ bool FileMessageHandler::FindFile(const list<Path>& lps, POVMS_Object& msg, POVM
 
         files.GetNth(i, attr);
 
-        path = FindFilePath(lps, Path(attr.GetUCS2String()));
+        path = FindFilePath(lps, Path(attr.GetUCS2String()), search);
 
         if(path.Empty() == false)
             break;
@@ -98,7 +232,7 @@ bool FileMessageHandler::FindFile(const list<Path>& lps, POVMS_Object& msg, POVM
 
 bool FileMessageHandler::ReadFile(const list<Path>& lps, POVMS_Object& msg, POVMS_Object& result)
 {
-    Path path(FindFilePath(lps, Path(msg.GetUCS2String(kPOVAttrib_ReadFile))));
+    Path path(FindFilePath(lps, Path(msg.GetUCS2String(kPOVAttrib_ReadFile)), gDirectoryCache.BeginSearch()));
 
     if(path.Empty() == false)
         result.SetUCS2String(kPOVAttrib_LocalFile, path().c_str());
@@ -106,16 +240,22 @@ bool FileMessageHandler::ReadFile(const list<Path>& lps, POVMS_Object& msg, POVM
     return (path.Empty() == false);
 }
 
-void FileMessageHandler::CreatedFile(POVMS_Object&)
+void FileMessageHandler::CreatedFile(POVMS_Object& msg)
+{
+    gDirectoryCache.Invalidate(Path(msg.GetUCS2String(kPOVAttrib_CreatedFile)));
+}
+
+bool FileMessageHandler::FileExists(const Path& p, unsigned int search)
 {
+    return gDirectoryCache.MayExist(p, search) && CheckIfFileExists(p);
 }
 
-Path FileMessageHandler::FindFilePath(const list<Path>& lps, const Path& f)
+Path FileMessageHandler::FindFilePath(const list<Path>& lps, const Path& f, unsigned int search)
 {
     // check the current working dir (or full path if supplied) first
     // note that if the file doesn't have a path and it is found in the
     // CWD, the CWD is not returned as part of the path.
-    if(CheckIfFileExists(f) == true)
+    if(FileExists(f, search) == true)
         return f;
 
     // if the path is absolute there's no point in checking the include paths;
@@ -129,7 +269,7 @@ Path FileMessageHandler::FindFilePath(const list<Path>& lps, const Path& f)
     {
         Path path (*i, f);
 
-        if(CheckIfFileExists(path) == true)
+        if(FileExists(path, search) == true)
             return path;
     }
 
@@ -67,7 +67,9 @@ class FileMessageHandler
         virtual bool ReadFile(const list<Path>&, POVMS_Object&, POVMS_Object&);
         virtual void CreatedFile(POVMS_Object&);
 
-        Path FindFilePath(const list<Path>&, const Path&);
+        /// Check whether a file exists, ruling out files known not to exist without accessing the file system.
+        bool FileExists(const Path&, unsigned int search);
+        Path FindFilePath(const list<Path>&, const Path&, unsigned int search);
 };
 
 }
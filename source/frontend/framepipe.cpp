@@ -0,0 +1,175 @@
+//******************************************************************************
+///
+/// @file frontend/framepipe.cpp
+///
+/// Implementations related to streaming rendered frames to an external process.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "frontend/framepipe.h"
+
+// Boost header files
+#include <boost/bind.hpp>
+
+// POV-Ray header files (base module)
+#include "base/pov_err.h"
+#include "base/image/encoding.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_frontend
+{
+
+FramePipe::FramePipe(const shared_ptr<ShelloutProcessing>& sp) :
+    shelloutProcessing(sp),
+    pipe(nullptr),
+    queued(false),
+    closing(false),
+    failed(false)
+{
+    pipe = shelloutProcessing->OpenOutputPipe();
+    writer.reset(new boost::thread(boost::bind(&FramePipe::WriterThread, this)));
+}
+
+FramePipe::~FramePipe()
+{
+    try
+    {
+        Finish();
+    }
+    catch(...)
+    {
+        // ignore any error here
+    }
+}
+
+void FramePipe::WriteFrame(const Image& image, const Image::WriteOptions& options)
+{
+    unsigned int width = image.GetWidth();
+    unsigned int height = image.GetHeight();
+    bool alpha = options.AlphaIsEnabled();
+    bool premul = options.AlphaIsPremultiplied(false);
+    unsigned int channels = (alpha ? 4 : 3);
+    GammaCurvePtr gamma = options.GetTranscodingGammaCurve(SRGBGammaCurve::Get());
+    IntEncoder encoder(gamma, 255);
+    DitherStrategy& dither = *options.ditherStrategy;
+    unsigned int r, g, b, a;
+
+    // encode the frame here rather than in the writer thread, as the image is about to be
+    // re-used for rendering the next frame
+    encodeBuffer.resize(size_t(width) * height * channels);
+    unsigned char *p = encodeBuffer.data();
+    for (unsigned int y = 0; y < height; y++)
+    {
+        for (unsigned int x = 0; x < width; x++)
+        {
+            if (alpha)
+            {
+                GetEncodedRGBAValue(&image, x, y, encoder, r, g, b, a, dither, premul);
+                *p++ = (unsigned char) r;
+                *p++ = (unsigned char) g;
+                *p++ = (unsigned char) b;
+                *p++ = (unsigned char) a;
+            }
+            else
+            {
+                GetEncodedRGBValue(&image, x, y, encoder, r, g, b, dither);
+                *p++ = (unsigned char) r;
+                *p++ = (unsigned char) g;
+                *p++ = (unsigned char) b;
+            }
+        }
+    }
+
+    boost::mutex::scoped_lock lock(mutex);
+
+    while (queued && !failed)
+        queueChanged.wait(lock);
+    if (failed)
+        throw POV_EXCEPTION(kFileDataErr, "Error writing to output pipe command");
+
+    encodeBuffer.swap(queuedBuffer);
+    queued = true;
+    queueChanged.notify_all();
+}
+
+int FramePipe::Finish()
+{
+    if (pipe == nullptr)
+        return -1;
+
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        closing = true;
+        queueChanged.notify_all();
+    }
+    writer->join();
+    writer.reset();
+
+    if (std::fflush(pipe) != 0)
+        failed = true;
+    int result = shelloutProcessing->CloseOutputPipe(pipe);
+    pipe = nullptr;
+
+    if (failed)
+        throw POV_EXCEPTION(kFileDataErr, "Error writing to output pipe command");
+    return result;
+}
+
+void FramePipe::WriterThread()
+{
+    for (;;)
+    {
+        {
+            boost::mutex::scoped_lock lock(mutex);
+
+            while (!queued && !closing)
+                queueChanged.wait(lock);
+            if (!queued)
+                return;
+
+            queuedBuffer.swap(writeBuffer);
+            queued = false;
+            queueChanged.notify_all();
+        }
+
+        if (std::fwrite(writeBuffer.data(), 1, writeBuffer.size(), pipe) != writeBuffer.size())
+        {
+            boost::mutex::scoped_lock lock(mutex);
+            failed = true;
+            queueChanged.notify_all();
+            return;
+        }
+    }
+}
+
+}
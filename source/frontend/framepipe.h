@@ -0,0 +1,108 @@
+//******************************************************************************
+///
+/// @file frontend/framepipe.h
+///
+/// Streaming of rendered frames to an external process.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_FRONTEND_FRAMEPIPE_H
+#define POVRAY_FRONTEND_FRAMEPIPE_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "frontend/configfrontend.h"
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#include "base/image/image.h"
+
+#include "frontend/shelloutprocessing.h"
+
+namespace pov_frontend
+{
+
+using namespace pov_base;
+
+/// Stream of rendered frames to an external process, e.g. a video encoder.
+///
+/// Each frame is written to the standard input of the output pipe command as raw 8-bit RGB
+/// (or RGBA if alpha output is enabled) pixels, in rows from top to bottom, without any header.
+/// The frames are written in the order given, by a thread of their own, so that the next frame
+/// can be rendered while the command is still reading the previous one.
+///
+class FramePipe
+{
+    public:
+        /// Start the output pipe command.
+        /// @param[in]  sp          Shellout processing of the render, providing the command.
+        FramePipe(const shared_ptr<ShelloutProcessing>& sp);
+
+        /// Close the pipe, ignoring any errors, if @ref Finish() has not been called.
+        ~FramePipe();
+
+        /// Queue a frame to be written to the pipe.
+        /// The frame is encoded before returning, so the image may be re-used straight away; if the
+        /// previous frame is still waiting to be written, this waits until that has been started.
+        /// @param[in]  image       Rendered frame.
+        /// @param[in]  options     Encoding options of the output file, for gamma, dithering and alpha.
+        void WriteFrame(const Image& image, const Image::WriteOptions& options);
+
+        /// Write any queued frames, close the pipe and wait for the command to exit.
+        /// @return     Exit code of the command, or -1 if not known.
+        int Finish();
+
+    private:
+
+        shared_ptr<ShelloutProcessing> shelloutProcessing;
+        std::FILE *pipe;
+        std::vector<unsigned char> encodeBuffer;    ///< Frame being encoded, owned by the caller.
+        std::vector<unsigned char> queuedBuffer;    ///< Frame waiting to be written.
+        std::vector<unsigned char> writeBuffer;     ///< Frame being written, owned by the writer thread.
+        bool queued;
+        bool closing;
+        bool failed;
+        boost::mutex mutex;
+        boost::condition_variable queueChanged;
+        std::unique_ptr<boost::thread> writer;
+
+        void WriterThread();
+
+        FramePipe();
+        FramePipe(const FramePipe&);
+        FramePipe& operator=(const FramePipe&);
+};
+
+}
+
+#endif // POVRAY_FRONTEND_FRAMEPIPE_H
@@ -36,11 +36,20 @@
 // Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
 #include "frontend/imagemessagehandler.h"
 
+// Standard C++ header files
+#include <deque>
+#include <memory>
+
+// Boost header files
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
 // POV-Ray header files (base module)
 #include "base/image/colourspace.h"
 #include "base/image/dither.h"
 #include "base/image/encoding.h"
 #include "base/image/image.h"
+#include "base/pixelexchange.h"
 
 // POV-Ray header files (frontend module)
 #include "frontend/display.h"
@@ -52,6 +61,167 @@
 namespace pov_frontend
 {
 
+/// Maximum number of display updates waiting to be drawn before the message thread has to wait.
+const size_t kMaxQueuedDisplayUpdates = 256;
+
+/// Rendered pixels to be converted and drawn on a preview display.
+struct DisplayUpdate
+{
+    shared_ptr<Display> display;
+    GammaCurvePtr gamma;
+    bool greyscale;
+    unsigned int pixelSize;
+    POVRect rect;                   ///< Block of pixels, unless positions are given.
+    vector<POVMSInt> positions;     ///< Positions of individual pixels, two values each.
+    vector<RGBTColour> colours;
+};
+
+/// Worker thread converting rendered pixels for the preview display and drawing them.
+///
+/// Encoding the pixels for the display and drawing them would otherwise hold up the message
+/// thread, which also stores the pixels in the final image. Updates are drawn in the order queued.
+///
+class DisplayUpdateQueue
+{
+    public:
+        DisplayUpdateQueue();
+        ~DisplayUpdateQueue();
+
+        /// Queue an update, waiting if too many are queued already.
+        void Push(std::unique_ptr<DisplayUpdate>& update);
+
+    private:
+        std::deque<DisplayUpdate*> queue;
+        bool closing;
+        boost::mutex mutex;
+        boost::condition_variable queueChanged;
+        boost::thread worker;
+
+        void Run();
+        static void Draw(const DisplayUpdate& update);
+};
+
+DisplayUpdateQueue::DisplayUpdateQueue() :
+    closing(false),
+    worker(boost::bind(&DisplayUpdateQueue::Run, this))
+{
+}
+
+DisplayUpdateQueue::~DisplayUpdateQueue()
+{
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        closing = true;
+        queueChanged.notify_all();
+    }
+    worker.join();
+}
+
+void DisplayUpdateQueue::Push(std::unique_ptr<DisplayUpdate>& update)
+{
+    boost::mutex::scoped_lock lock(mutex);
+
+    while(queue.size() >= kMaxQueuedDisplayUpdates)
+        queueChanged.wait(lock);
+
+    queue.push_back(update.release());
+    queueChanged.notify_all();
+}
+
+void DisplayUpdateQueue::Run()
+{
+    for(;;)
+    {
+        std::unique_ptr<DisplayUpdate> update;
+        {
+            boost::mutex::scoped_lock lock(mutex);
+
+            while(queue.empty() && !closing)
+                queueChanged.wait(lock);
+            if(queue.empty())
+                return;
+
+            update.reset(queue.front());
+            queue.pop_front();
+            queueChanged.notify_all();
+        }
+
+        try
+        {
+            Draw(*update);
+        }
+        catch(std::exception&)
+        {
+            // the preview display is not essential to the render, so just carry on
+        }
+    }
+}
+
+void DisplayUpdateQueue::Draw(const DisplayUpdate& update)
+{
+    vector<Display::RGBA8> rgbas;
+    IntEncoder displayEncoder(update.gamma, 255);
+    bool block = update.positions.empty();
+
+    rgbas.reserve(update.colours.size());
+
+    for(size_t i = 0; i < update.colours.size(); i++)
+    {
+        RGBTColour gcol(update.colours[i]);
+        Display::RGBA8 rgba;
+        unsigned int x(block ? update.rect.left + i % update.rect.GetWidth() : update.positions[i * 2]);
+        unsigned int y(block ? update.rect.top  + i / update.rect.GetWidth() : update.positions[i * 2 + 1]);
+        float dither = GetDitherOffset(x, y);
+
+        // TODO ALPHA - display may profit from receiving the data in its original, premultiplied form
+        // Premultiplied alpha was good for the math, but the display expects non-premultiplied alpha, so fix this if possible.
+        AlphaUnPremultiply(gcol);
+
+        if (update.greyscale)
+        {
+            rgba.red    = displayEncoder.Encode(gcol.Greyscale(), dither);
+            rgba.green  = rgba.red;
+            rgba.blue   = rgba.red;
+        }
+        else
+        {
+            rgba.red    = displayEncoder.Encode(gcol.red(),   dither);
+            rgba.green  = displayEncoder.Encode(gcol.green(), dither);
+            rgba.blue   = displayEncoder.Encode(gcol.blue(),  dither);
+        }
+        rgba.alpha = IntEncode(gcol.alpha(), 255, dither);
+
+        rgbas.push_back(rgba);
+    }
+
+    if (rgbas.empty())
+        return;
+
+    if (block == false)
+    {
+        for(size_t i = 0; i < rgbas.size(); i++)
+        {
+            unsigned int x(update.positions[i * 2]);
+            unsigned int y(update.positions[i * 2 + 1]);
+
+            if(update.pixelSize == 1)
+                update.display->DrawPixel(x, y, rgbas[i]);
+            else
+                update.display->DrawFilledRectangle(x, y, x + update.pixelSize - 1, y + update.pixelSize - 1, rgbas[i]);
+        }
+    }
+    else if(update.pixelSize == 1)
+        update.display->DrawPixelBlock(update.rect.left, update.rect.top, update.rect.right, update.rect.bottom, &rgbas[0]);
+    else
+    {
+        for(unsigned int y = update.rect.top; y <= update.rect.bottom; y += update.pixelSize)
+        {
+            for(unsigned int x = update.rect.left; x <= update.rect.right; x += update.pixelSize)
+                update.display->DrawFilledRectangle(x, y, x + update.pixelSize - 1, y + update.pixelSize - 1, rgbas[0]);
+        }
+    }
+}
+
 ImageMessageHandler::ImageMessageHandler()
 {
 }
@@ -82,6 +252,12 @@ void ImageMessageHandler::HandleMessage(const SceneData& sd, const ViewData& vd,
         case kPOVMsgIdent_FilledRectangleSet:
             DrawFilledRectangleSet(sd, vd, msg, final);
             break;
+        case kPOVMsgIdent_CostMapSet:
+            StoreCostMap(sd, vd, msg);
+            break;
+        case kPOVMsgIdent_FeatureMapSet:
+            StoreFeatureMap(sd, vd, msg);
+            break;
     }
 }
 
@@ -100,49 +276,37 @@ void ImageMessageHandler::DrawPixelSet(const SceneData& sd, const ViewData& vd,
     if((pixelpositions.size() / 2) != (pixelcolors.size() / 5))
         throw POV_EXCEPTION(kInvalidDataSizeErr, "Number of pixel colors and pixel positions does not match!");
 
+    std::unique_ptr<DisplayUpdate> update;
+    if (vd.display != nullptr)
+    {
+        update.reset(new DisplayUpdate());
+        update->display = vd.display;
+        update->gamma = vd.displayGamma;
+        update->greyscale = vd.greyscaleDisplay;
+        update->pixelSize = psize;
+        update->colours.reserve(pixelcolors.size() / 5);
+    }
+
     for(int i = 0, ii = 0; (i < pixelcolors.size()) && (ii < pixelpositions.size()); i += 5, ii += 2)
     {
         RGBTColour col(pixelcolors[i], pixelcolors[i + 1], pixelcolors[i + 2], pixelcolors[i + 4]); // NB pixelcolors[i + 3] is an unused channel
-        RGBTColour gcol(col);
         unsigned int x(pixelpositions[ii]);
         unsigned int y(pixelpositions[ii + 1]);
-        Display::RGBA8 rgba;
-        float dither = GetDitherOffset(x, y);
 
-        if (vd.display != nullptr)
+        if (update != nullptr)
         {
-            // TODO ALPHA - display may profit from receiving the data in its original, premultiplied form
-            // Premultiplied alpha was good for the math, but the display expects non-premultiplied alpha, so fix this if possible.
-            AlphaUnPremultiply(gcol);
-
-            if (vd.greyscaleDisplay)
-            {
-                rgba.red  = IntEncode(vd.displayGamma, gcol.Greyscale(), 255, dither);
-                rgba.green = rgba.red;
-                rgba.blue  = rgba.red;
-            }
-            else
-            {
-                rgba.red   = IntEncode(vd.displayGamma, gcol.red(),   255, dither);
-                rgba.green = IntEncode(vd.displayGamma, gcol.green(), 255, dither);
-                rgba.blue  = IntEncode(vd.displayGamma, gcol.blue(),  255, dither);
-            }
-            rgba.alpha = IntEncode(gcol.alpha(), 255, dither);
+            update->positions.push_back(x);
+            update->positions.push_back(y);
+            update->colours.push_back(col);
         }
 
         if(psize == 1)
         {
-            if (vd.display != nullptr)
-                vd.display->DrawPixel(x, y, rgba);
-
             if (final && (vd.image != nullptr) && (x < vd.image->GetWidth()) && (y < vd.image->GetHeight()))
                 vd.image->SetRGBTValue(x, y, col);
         }
         else
         {
-            if (vd.display != nullptr)
-                vd.display->DrawFilledRectangle(x, y, x + psize - 1, y + psize - 1, rgba);
-
             if (final && (vd.image != nullptr))
             {
                 for(unsigned int py = 0; (py < psize) && (y + py < vd.image->GetHeight()); py++)
@@ -154,6 +318,9 @@ void ImageMessageHandler::DrawPixelSet(const SceneData& sd, const ViewData& vd,
         }
     }
 
+    if (update != nullptr)
+        QueueDisplayUpdate(update);
+
     if (final && (vd.imageBackup != nullptr))
     {
         msg.Write(*vd.imageBackup);
@@ -164,65 +331,52 @@ void ImageMessageHandler::DrawPixelSet(const SceneData& sd, const ViewData& vd,
 void ImageMessageHandler::DrawPixelBlockSet(const SceneData& sd, const ViewData& vd, POVMS_Object& msg, bool final)
 {
     POVRect rect(msg.GetInt(kPOVAttrib_Left), msg.GetInt(kPOVAttrib_Top), msg.GetInt(kPOVAttrib_Right), msg.GetInt(kPOVAttrib_Bottom));
-    POVMS_Attribute pixelattr;
     vector<RGBTColour> cols;
-    vector<Display::RGBA8> rgbas;
     unsigned int psize(msg.GetInt(kPOVAttrib_PixelSize));
     int i = 0;
 
-    msg.Get(kPOVAttrib_PixelBlock, pixelattr);
-
-    vector<POVMSFloat> pixelvector(pixelattr.GetFloatVector());
-
-    cols.reserve(rect.GetArea());
-    rgbas.reserve(rect.GetArea());
-
-    for(i = 0; i < rect.GetArea() *  5; i += 5)
+    if(msg.Exist(kPOVAttrib_PixelBlockRef) == true)
     {
-        RGBTColour col(pixelvector[i], pixelvector[i + 1], pixelvector[i + 2], pixelvector[i + 4]); // NB pixelvector[i + 3] is an unused channel
-        RGBTColour gcol(col);
-        Display::RGBA8 rgba;
-        unsigned int x(rect.left + (i/5) % rect.GetWidth());
-        unsigned int y(rect.top  + (i/5) / rect.GetWidth());
-        float dither = GetDitherOffset(x, y);
-
-        if (vd.display != nullptr)
+        // pixels handed over by reference; if the render engine discarded them already, the view is gone anyway
+        if(PixelBlockExchange::Withdraw(msg.GetLong(kPOVAttrib_PixelBlockRef), cols) == false)
+            return;
+        if(cols.size() < rect.GetArea())
+            throw POV_EXCEPTION(kInvalidDataSizeErr, "Pixel block is smaller than its rectangle!");
+
+        // the render state file needs the pixels themselves
+        if(final && (vd.imageBackup != nullptr))
         {
-            // TODO ALPHA - display may profit from receiving the data in its original, premultiplied form
-            // Premultiplied alpha was good for the math, but the display expects non-premultiplied alpha, so fix this if possible.
-            AlphaUnPremultiply(gcol);
+            vector<POVMSFloat> pixelvector;
 
-            if (vd.greyscaleDisplay)
-            {
-                rgba.red    = IntEncode(vd.displayGamma, gcol.Greyscale(), 255, dither);
-                rgba.green  = rgba.red;
-                rgba.blue   = rgba.red;
-            }
-            else
+            pixelvector.reserve(cols.size() * 5);
+
+            for(vector<RGBTColour>::const_iterator c(cols.begin()); c != cols.end(); c++)
             {
-                rgba.red    = IntEncode(vd.displayGamma, gcol.red(),   255, dither);
-                rgba.green  = IntEncode(vd.displayGamma, gcol.green(), 255, dither);
-                rgba.blue   = IntEncode(vd.displayGamma, gcol.blue(),  255, dither);
+                pixelvector.push_back(c->red());
+                pixelvector.push_back(c->green());
+                pixelvector.push_back(c->blue());
+                pixelvector.push_back(0.0); // unused component
+                pixelvector.push_back(c->transm());
             }
-            rgba.alpha = IntEncode(gcol.alpha(), 255, dither);
 
-            rgbas.push_back(rgba);
+            POVMS_Attribute pixelattr(pixelvector);
+
+            msg.Remove(kPOVAttrib_PixelBlockRef);
+            msg.Set(kPOVAttrib_PixelBlock, pixelattr);
         }
-        cols.push_back(col);
     }
-
-    if (vd.display != nullptr)
+    else
     {
-        if(psize == 1)
-            vd.display->DrawPixelBlock(rect.left, rect.top, rect.right, rect.bottom, &rgbas[0]);
-        else
-        {
-            for(unsigned int y = rect.top, i = 0; y <= rect.bottom; y += psize)
-            {
-                for(unsigned int x = rect.left; x <= rect.right; x += psize, i++)
-                    vd.display->DrawFilledRectangle(x, y, x + psize - 1, y + psize - 1, rgbas[0]);
-            }
-        }
+        POVMS_Attribute pixelattr;
+
+        msg.Get(kPOVAttrib_PixelBlock, pixelattr);
+
+        vector<POVMSFloat> pixelvector(pixelattr.GetFloatVector());
+
+        cols.reserve(rect.GetArea());
+
+        for(i = 0; i < rect.GetArea() * 5; i += 5)
+            cols.push_back(RGBTColour(pixelvector[i], pixelvector[i + 1], pixelvector[i + 2], pixelvector[i + 4])); // NB pixelvector[i + 3] is an unused channel
     }
 
     if (final && (vd.image != nullptr))
@@ -238,6 +392,23 @@ void ImageMessageHandler::DrawPixelBlockSet(const SceneData& sd, const ViewData&
                 }
             }
         }
+
+        if (vd.imageProcessing != nullptr)
+            vd.imageProcessing->CompletedRectangle(rect.left, rect.top, rect.right, rect.bottom);
+    }
+
+    // leave the conversion for the display to the display update thread
+    if (vd.display != nullptr)
+    {
+        std::unique_ptr<DisplayUpdate> update(new DisplayUpdate());
+        update->display = vd.display;
+        update->gamma = vd.displayGamma;
+        update->greyscale = vd.greyscaleDisplay;
+        update->pixelSize = psize;
+        update->rect = rect;
+        cols.resize(rect.GetArea());
+        update->colours.swap(cols);
+        QueueDisplayUpdate(update);
     }
 
     if (final && (vd.imageBackup != nullptr))
@@ -259,4 +430,34 @@ void ImageMessageHandler::DrawFilledRectangleSet(const SceneData& sd, const View
 {
 }
 
+void ImageMessageHandler::QueueDisplayUpdate(std::unique_ptr<DisplayUpdate>& update)
+{
+    if (displayUpdates == nullptr)
+        displayUpdates = shared_ptr<DisplayUpdateQueue>(new DisplayUpdateQueue());
+
+    displayUpdates->Push(update);
+}
+
+void ImageMessageHandler::StoreCostMap(const SceneData& sd, const ViewData& vd, POVMS_Object& msg)
+{
+    if (vd.imageProcessing == nullptr)
+        return;
+
+    POVMS_Attribute costattr;
+    msg.Get(kPOVAttrib_PixelCosts, costattr);
+
+    vd.imageProcessing->SetCostMap(msg.GetInt(kPOVAttrib_Width), msg.GetInt(kPOVAttrib_Height), costattr.GetFloatVector());
+}
+
+void ImageMessageHandler::StoreFeatureMap(const SceneData& sd, const ViewData& vd, POVMS_Object& msg)
+{
+    if (vd.imageProcessing == nullptr)
+        return;
+
+    POVMS_Attribute featureattr;
+    msg.Get(kPOVAttrib_PixelFeatures, featureattr);
+
+    vd.imageProcessing->SetFeatureMap(msg.GetInt(kPOVAttrib_Width), msg.GetInt(kPOVAttrib_Height), featureattr.GetFloatVector());
+}
+
 }
@@ -39,6 +39,8 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "frontend/configfrontend.h"
 
+#include <memory>
+
 #include "povms/povmscpp.h"
 
 namespace pov_frontend
@@ -48,6 +50,8 @@ using namespace pov_base;
 
 struct SceneData;
 struct ViewData;
+struct DisplayUpdate;
+class DisplayUpdateQueue;
 
 class ImageMessageHandler
 {
@@ -62,6 +66,13 @@ class ImageMessageHandler
         virtual void DrawPixelRowSet(const SceneData&, const ViewData&, POVMS_Object&, bool final);
         virtual void DrawRectangleFrameSet(const SceneData&, const ViewData&, POVMS_Object&, bool final);
         virtual void DrawFilledRectangleSet(const SceneData&, const ViewData&, POVMS_Object&, bool final);
+        virtual void StoreCostMap(const SceneData&, const ViewData&, POVMS_Object&);
+        virtual void StoreFeatureMap(const SceneData&, const ViewData&, POVMS_Object&);
+    private:
+        void QueueDisplayUpdate(std::unique_ptr<DisplayUpdate>& update);
+
+        /// Pixels waiting to be converted and drawn on the preview display, created on demand.
+        shared_ptr<DisplayUpdateQueue> displayUpdates;
 };
 
 }
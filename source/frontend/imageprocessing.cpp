@@ -39,7 +39,11 @@
 // Standard C++ header files
 #include <memory>
 
+// Boost header files
+#include <boost/bind.hpp>
+
 // POV-Ray header files (base module)
+#include "base/safemath.h"
 #include "base/image/dither.h"
 #include "base/image/image.h"
 
@@ -49,10 +53,6 @@
 // this must be the last file included
 #include "base/povdebug.h"
 
-// TODO: update ImageProcessing with the means of accepting and caching
-// blocks of pixels as opposed to individual ones, with a back-end that
-// can serialize completed rows to the final image output file.
-
 namespace pov_frontend
 {
 
@@ -63,7 +63,11 @@ enum
     Z = 2
 };
 
-ImageProcessing::ImageProcessing(unsigned int width, unsigned int height)
+ImageProcessing::ImageProcessing(unsigned int width, unsigned int height) :
+    streaming(false),
+    streamNextRow(0),
+    outputQueueSize(0),
+    outputClosing(false)
 {
     image = shared_ptr<Image>(Image::Create(width, height, Image::RGBFT_Float));
     toStderr = toStdout = false;
@@ -72,22 +76,64 @@ ImageProcessing::ImageProcessing(unsigned int width, unsigned int height)
     image->SetPremultiplied(true); // POV-Ray uses premultiplied opacity for its math, so that's what will end up in the image container
 }
 
-ImageProcessing::ImageProcessing(POVMS_Object& ropts)
+/// Choose the most compact frame buffer format that still serves the output file type.
+///
+/// High dynamic range output gets half-precision floating-point storage, while all other output
+/// gets 16-bit storage encoded with the output file's gamma (or sRGB if unspecified), which
+/// exceeds the precision of any such file format even after dithering. Filter is dropped in
+/// either case, as no output file format has room for it.
+///
+/// @param[in]  ropts   Render options.
+/// @param[out] gamma   Encoding gamma the frame buffer is to be set up with, if any.
+/// @return             Frame buffer data type.
+///
+static Image::ImageDataType GetFrameBufferType(POVMS_Object& ropts, GammaCurvePtr& gamma)
 {
-    unsigned int width(ropts.TryGetInt(kPOVAttrib_Width, 160));
-    unsigned int height(ropts.TryGetInt(kPOVAttrib_Height, 120));
-    unsigned int blockSize(ropts.TryGetInt(kPOVAttrib_RenderBlockSize, 32));
-    unsigned int maxBufferMem(ropts.TryGetInt(kPOVAttrib_MaxImageBufferMem, 128)); // number is megabytes
+    switch(ropts.TryGetInt(kPOVAttrib_OutputFileType, DEFAULT_OUTPUT_FORMAT))
+    {
+        case kPOVList_FileType_OpenEXR:
+        case kPOVList_FileType_RadianceHDR:
+            return Image::RGBA_Half;
 
-    image = shared_ptr<Image>(Image::Create(width, height, Image::RGBFT_Float, maxBufferMem, blockSize * blockSize));
+        default:
+            if (ropts.Exist(kPOVAttrib_FileGammaType))
+                gamma = GetGammaCurve((GammaTypeId)ropts.GetInt(kPOVAttrib_FileGammaType), ropts.GetFloat(kPOVAttrib_FileGamma));
+            else
+                gamma = SRGBGammaCurve::Get();
+            return Image::RGBA_Gamma16;
+    }
+}
+
+ImageProcessing::ImageProcessing(POVMS_Object& ropts) :
+    streaming(false),
+    streamNextRow(0),
+    outputQueueSize(0),
+    outputClosing(false)
+{
+    unsigned int blockSize(ropts.TryGetInt(kPOVAttrib_RenderBlockSize, 32));
+    bufferWidth = ropts.TryGetInt(kPOVAttrib_Width, 160);
+    bufferHeight = ropts.TryGetInt(kPOVAttrib_Height, 120);
+    bufferMaxMem = ropts.TryGetInt(kPOVAttrib_MaxImageBufferMem, 128); // number is megabytes
+    bufferBlockPixels = blockSize * blockSize;
+
+    // the packed formats use 8 bytes per pixel; anything beyond the memory budget is left to
+    // the disk-backed full-precision image
+    bufferType = GetFrameBufferType(ropts, bufferGamma);
+    if ((bufferMaxMem > 0) && (SafeUnsignedProduct<POV_ULONG>(bufferWidth, bufferHeight, 8u) / 1048576 > bufferMaxMem))
+        bufferType = Image::RGBFT_Float;
+
+    image = NextFrameBuffer();
     toStdout = OutputIsStdout(ropts);
     toStderr = OutputIsStderr(ropts);
 
-    // TODO FIXME - find a better place for this
-    image->SetPremultiplied(true); // POV-Ray uses premultiplied opacity for its math, so that's what will end up in the image container
+    outputQueueSize = clip(ropts.TryGetInt(kPOVAttrib_OutputQueueSize, 2), 0, 64);
 }
 
-ImageProcessing::ImageProcessing(shared_ptr<Image>& img)
+ImageProcessing::ImageProcessing(shared_ptr<Image>& img) :
+    streaming(false),
+    streamNextRow(0),
+    outputQueueSize(0),
+    outputClosing(false)
 {
     image = img;
     toStderr = toStdout = false;
@@ -98,89 +144,47 @@ ImageProcessing::ImageProcessing(shared_ptr<Image>& img)
 
 ImageProcessing::~ImageProcessing()
 {
+    // complete the files still queued, but leave any error unreported
+    {
+        boost::mutex::scoped_lock lock(outputMutex);
+        outputClosing = true;
+        outputQueueChanged.notify_all();
+    }
+    if(outputWriter != nullptr)
+        outputWriter->join();
 }
 
 UCS2String ImageProcessing::WriteImage(POVMS_Object& ropts, POVMSInt frame, int digits)
 {
     if(ropts.TryGetBool(kPOVAttrib_OutputToFile, true) == true)
     {
-        Image::WriteOptions wopts;
-        Image::ImageFileType imagetype = Image::SYS;
-        unsigned int filetype = POV_File_Image_System;
+        boost::mutex::scoped_lock lock(streamMutex);
 
-        wopts.bitsPerChannel = clip(ropts.TryGetInt(kPOVAttrib_BitsPerColor, 8), 1, 16);
-        wopts.alphaMode = (ropts.TryGetBool(kPOVAttrib_OutputAlpha, false) ? Image::kAlphaMode_Default : Image::kAlphaMode_None );
-        wopts.compression = (ropts.Exist(kPOVAttrib_Compression) ? clip(ropts.GetInt(kPOVAttrib_Compression), 0, 255) : -1);
-        wopts.grayscale = ropts.TryGetBool(kPOVAttrib_GrayscaleOutput, false);
-
-        switch(ropts.TryGetInt(kPOVAttrib_OutputFileType, DEFAULT_OUTPUT_FORMAT))
+        // if the file is being written while rendering, just add the rows still missing
+        if(streaming == true)
         {
-            case kPOVList_FileType_Targa:
-                imagetype = Image::TGA;
-                filetype = POV_File_Image_Targa;
-                break;
-            case kPOVList_FileType_CompressedTarga:
-                // TODO - this file type is obsolete, as Targa compression can now
-                // be controlled using the `Compression` INI setting.
-                imagetype = Image::TGA;
-                filetype = POV_File_Image_Targa;
-                wopts.compression = 1;
-                break;
-            case kPOVList_FileType_PNG:
-                imagetype = Image::PNG;
-                filetype = POV_File_Image_PNG;
-                break;
-            case kPOVList_FileType_JPEG:
-                imagetype = Image::JPEG;
-                filetype = POV_File_Image_JPEG;
-                break;
-            case kPOVList_FileType_PPM:
-                imagetype = Image::PPM;
-                filetype = POV_File_Image_PPM;
-                break;
-            case kPOVList_FileType_BMP:
-                imagetype = Image::BMP;
-                filetype = POV_File_Image_BMP;
-                break;
-            case kPOVList_FileType_OpenEXR:
-                imagetype = Image::EXR;
-                filetype = POV_File_Image_EXR;
-                break;
-            case kPOVList_FileType_RadianceHDR:
-                imagetype = Image::HDR;
-                filetype = POV_File_Image_HDR;
-                break;
-            case kPOVList_FileType_System:
-                imagetype = Image::SYS;
-                filetype = POV_File_Image_System;
-                break;
-            default:
-                throw POV_EXCEPTION_STRING("Invalid file type for output");
+            WriteStreamedRows(image->GetHeight());
+            streamWriter->Finish();
+            streamWriter.reset();
+            streamFile.reset();
+            streaming = false;
+            WriteCostMap(streamFilename);
+            return streamFilename;
         }
 
-        GammaTypeId gammaType;
-        float gamma;
-        if (ropts.Exist(kPOVAttrib_FileGammaType))
-        {
-            gammaType = (GammaTypeId)ropts.GetInt(kPOVAttrib_FileGammaType);
-            gamma = ropts.GetFloat(kPOVAttrib_FileGamma);
-            wopts.encodingGamma = GetGammaCurve(gammaType, gamma);
-        }
-        else
+        DenoiseImage(ropts);
+
+        Image::WriteOptions wopts;
+        unsigned int filetype;
+        Image::ImageFileType imagetype = GetWriteOptions(ropts, wopts, filetype);
+
+        // hand the image over to the output pipe command rather than writing a file
+        if(framePipe != nullptr)
         {
-            // if user didn't explicitly specify File_Gamma, use the file format specific default.
-            wopts.encodingGamma.reset();
+            framePipe->WriteFrame(*image, wopts);
+            costMap.reset();
+            return UCS2String();
         }
-        // NB: RenderFrontend<...>::CreateView should have dealt with kPOVAttrib_LegacyGammaMode already and updated kPOVAttrib_WorkingGammaType and kPOVAttrib_WorkingGamma to fit.
-        gammaType = (GammaTypeId)ropts.TryGetInt(kPOVAttrib_WorkingGammaType, DEFAULT_WORKING_GAMMA_TYPE);
-        gamma = ropts.TryGetFloat(kPOVAttrib_WorkingGamma, DEFAULT_WORKING_GAMMA);
-        wopts.workingGamma = GetGammaCurve(gammaType, gamma);
-
-        bool dither = ropts.TryGetBool(kPOVAttrib_Dither, false);
-        DitherMethodId ditherMethod = DitherMethodId::kNone;
-        if (dither)
-            ditherMethod = ropts.TryGetEnum(kPOVAttrib_DitherMethod, DitherMethodId::kBlueNoise);
-        wopts.ditherStrategy = GetDitherStrategy(ditherMethod, image->GetWidth());
 
         // in theory this should always return a filename since the frontend code
         // sets it via a call to GetOutputFilename() before the render starts.
@@ -188,20 +192,389 @@ UCS2String ImageProcessing::WriteImage(POVMS_Object& ropts, POVMSInt frame, int
         if(filename.empty() == true)
             filename = GetOutputFilename(ropts, frame, digits);
 
+        // leave encoding and writing the file to the output writer thread; the next frame gets
+        // another frame buffer from GetImage()
+        if((outputQueueSize > 0) && (toStdout == false) && (toStderr == false))
+        {
+            shared_ptr<OutputJob> job(new OutputJob());
+            job->image = image;
+            job->imageType = imagetype;
+            job->fileType = filetype;
+            job->options = wopts;
+            job->filename = filename;
+            job->costMap = std::move(costMap);
+            QueueOutput(job);
+            image.reset();
+            return filename;
+        }
+
         std::unique_ptr<OStream> imagefile(NewOStream(filename.c_str(), filetype, false)); // TODO - check file permissions somehow without macro [ttrf]
         if (imagefile == nullptr)
             throw POV_EXCEPTION_CODE(kCannotOpenFileErr);
 
         Image::Write(imagetype, imagefile.get(), image.get(), wopts);
+        WriteCostMap(filename);
 
         return filename;
     }
     else
+    {
+        costMap.reset();
+        denoiseFeatures.reset();
         return UCS2String();
+    }
+}
+
+void ImageProcessing::FinishWriting()
+{
+    boost::mutex::scoped_lock lock(outputMutex);
+
+    while(outputQueue.empty() == false)
+        outputQueueChanged.wait(lock);
+
+    if(outputError != nullptr)
+    {
+        pov_base::Exception e(*outputError);
+        outputError.reset();
+        throw e;
+    }
+}
+
+void ImageProcessing::QueueOutput(const shared_ptr<OutputJob>& job)
+{
+    boost::mutex::scoped_lock lock(outputMutex);
+
+    // back-pressure: don't let the render get more than a few frames ahead of the writer
+    while((outputQueue.size() >= outputQueueSize) && (outputError == nullptr))
+        outputQueueChanged.wait(lock);
+
+    if(outputError != nullptr)
+    {
+        pov_base::Exception e(*outputError);
+        outputError.reset();
+        throw e;
+    }
+
+    outputQueue.push_back(job);
+    outputQueueChanged.notify_all();
+
+    if(outputWriter == nullptr)
+        outputWriter.reset(new boost::thread(boost::bind(&ImageProcessing::OutputWriterThread, this)));
+}
+
+shared_ptr<Image> ImageProcessing::NextFrameBuffer()
+{
+    {
+        boost::mutex::scoped_lock lock(outputMutex);
+
+        if(spareImages.empty() == false)
+        {
+            shared_ptr<Image> img(spareImages.back());
+            spareImages.pop_back();
+            return img;
+        }
+    }
+
+    shared_ptr<Image> img(Image::Create(bufferWidth, bufferHeight, bufferType, bufferMaxMem, bufferBlockPixels));
+    GammaCurvePtr gamma(bufferGamma);
+    if (gamma != nullptr)
+        img->TryDeferDecoding(gamma, img->GetMaxIntValue());
+
+    // TODO FIXME - find a better place for this
+    img->SetPremultiplied(true); // POV-Ray uses premultiplied opacity for its math, so that's what will end up in the image container
+    return img;
+}
+
+void ImageProcessing::OutputWriterThread()
+{
+    for(;;)
+    {
+        shared_ptr<OutputJob> job;
+        {
+            boost::mutex::scoped_lock lock(outputMutex);
+
+            while(outputQueue.empty() && (outputClosing == false))
+                outputQueueChanged.wait(lock);
+            if(outputQueue.empty())
+                return;
+
+            // the job stays in the queue until written, so that the queue bounds the number of frame buffers
+            job = outputQueue.front();
+        }
+
+        try
+        {
+            std::unique_ptr<OStream> imagefile(NewOStream(job->filename.c_str(), job->fileType, false));
+            if (imagefile == nullptr)
+                throw POV_EXCEPTION_CODE(kCannotOpenFileErr);
+
+            Image::Write(job->imageType, imagefile.get(), job->image.get(), job->options);
+            imagefile.reset();
+            WriteCostMap(job->filename, job->costMap.get());
+        }
+        catch(pov_base::Exception& e)
+        {
+            boost::mutex::scoped_lock lock(outputMutex);
+            if(outputError == nullptr)
+                outputError.reset(new pov_base::Exception(e));
+        }
+        catch(std::exception& e)
+        {
+            boost::mutex::scoped_lock lock(outputMutex);
+            if(outputError == nullptr)
+                outputError.reset(new pov_base::Exception(POV_EXCEPTION_STRING(e.what())));
+        }
+
+        {
+            boost::mutex::scoped_lock lock(outputMutex);
+
+            outputQueue.pop_front();
+            if(spareImages.size() < outputQueueSize)
+                spareImages.push_back(job->image);
+            outputQueueChanged.notify_all();
+        }
+    }
+}
+
+void ImageProcessing::StartStreaming(POVMS_Object& ropts, POVMSInt frame, int digits)
+{
+    boost::mutex::scoped_lock lock(streamMutex);
+
+    streamWriter.reset();
+    streamFile.reset();
+    streaming = false;
+
+    // each pixel of the final image must arrive exactly once, and none may be read back from the
+    // output file of an earlier render
+    if((ropts.TryGetBool(kPOVAttrib_StreamOutput, false) == false) ||
+       (ropts.TryGetBool(kPOVAttrib_OutputToFile, true) == false) ||
+       (ropts.TryGetBool(kPOVAttrib_ContinueTrace, false) == true) ||
+       (ropts.TryGetInt(kPOVAttrib_PhotonPasses, 1) > 1) ||
+       (ropts.TryGetFloat(kPOVAttrib_TimeBudget, 0.0f) > 0.0f) ||
+       (ropts.TryGetBool(kPOVAttrib_Denoise, false) == true) ||
+       (framePipe != nullptr) ||
+       OutputIsStdout(ropts) || OutputIsStderr())
+        return;
+
+    streamFileType = GetWriteOptions(ropts, streamOptions, streamFileKind);
+    if(Image::CanWriteRows(streamFileType) == false)
+        return;
+
+    streamFilename = ropts.TryGetUCS2String(kPOVAttrib_OutputFile, "");
+    if(streamFilename.empty() == true)
+        streamFilename = GetOutputFilename(ropts, frame, digits);
+
+    // the file itself is only created once the first row is complete, as starting the render may
+    // still remove an output file of the same name
+    streamRowPixels.assign(image->GetHeight(), 0);
+    streamNextRow = 0;
+    streaming = true;
+}
+
+void ImageProcessing::CompletedRectangle(unsigned int left, unsigned int top, unsigned int right, unsigned int bottom)
+{
+    boost::mutex::scoped_lock lock(streamMutex);
+
+    if(streaming == false)
+        return;
+
+    for(unsigned int y = top; (y <= bottom) && (y < streamRowPixels.size()); y++)
+        streamRowPixels[y] += right - left + 1;
+
+    unsigned int endRow = streamNextRow;
+    while((endRow < streamRowPixels.size()) && (streamRowPixels[endRow] >= image->GetWidth()))
+        endRow++;
+
+    if(endRow > streamNextRow)
+        WriteStreamedRows(endRow);
+}
+
+void ImageProcessing::WriteStreamedRows(unsigned int endRow)
+{
+    if(streamWriter == nullptr)
+    {
+        streamFile.reset(NewOStream(streamFilename.c_str(), streamFileKind, false));
+        if(streamFile == nullptr)
+            throw POV_EXCEPTION_CODE(kCannotOpenFileErr);
+        streamWriter.reset(Image::NewRowWriter(streamFileType, streamFile.get(), image.get(), streamOptions));
+    }
+
+    for(; streamNextRow < endRow; streamNextRow++)
+        streamWriter->WriteRow(image.get());
+}
+
+void ImageProcessing::SetCostMap(unsigned int width, unsigned int height, const vector<POVMSFloat>& costs)
+{
+    boost::mutex::scoped_lock lock(streamMutex);
+
+    if(costs.size() != SafeUnsignedProduct<size_t>(width, height, 3u))
+        throw POV_EXCEPTION(kInvalidDataSizeErr, "Size of render cost map does not match image size!");
+
+    costMap.reset(Image::Create(width, height, Image::RGBFT_Float));
+
+    vector<POVMSFloat>::const_iterator i(costs.begin());
+    for(unsigned int y = 0; y < height; y++)
+    {
+        for(unsigned int x = 0; x < width; x++, i += 3)
+            costMap->SetRGBValue(x, y, i[0], i[1], i[2]);
+    }
+}
+
+void ImageProcessing::SetFeatureMap(unsigned int width, unsigned int height, const vector<POVMSFloat>& features)
+{
+    boost::mutex::scoped_lock lock(streamMutex);
+
+    if(features.size() != SafeUnsignedProduct<size_t>(width, height, 7u))
+        throw POV_EXCEPTION(kInvalidDataSizeErr, "Size of render feature map does not match image size!");
+
+    denoiseFeatures.reset(new DenoiseFeatures());
+    denoiseFeatures->width = width;
+    denoiseFeatures->height = height;
+    denoiseFeatures->albedo.reserve(size_t(width) * height * 3);
+    denoiseFeatures->normal.reserve(size_t(width) * height * 3);
+    denoiseFeatures->depth.reserve(size_t(width) * height);
+
+    for(vector<POVMSFloat>::const_iterator i(features.begin()); i != features.end(); i += 7)
+    {
+        denoiseFeatures->albedo.insert(denoiseFeatures->albedo.end(), i, i + 3);
+        denoiseFeatures->normal.insert(denoiseFeatures->normal.end(), i + 3, i + 6);
+        denoiseFeatures->depth.push_back(i[6]);
+    }
+}
+
+void ImageProcessing::DenoiseImage(POVMS_Object& ropts)
+{
+    if(denoiseFeatures == nullptr)
+        return;
+
+    std::unique_ptr<DenoiseFeatures> features(std::move(denoiseFeatures));
+    if(ropts.TryGetBool(kPOVAttrib_Denoise, false) == false)
+        return;
+
+    if(denoiser != nullptr)
+        denoiser->Denoise(*image, *features);
+    else
+        EdgeAwareDenoiser(ropts.TryGetFloat(kPOVAttrib_DenoiseStrength, 1.0f)).Denoise(*image, *features);
+}
+
+void ImageProcessing::WriteCostMap(const UCS2String& filename)
+{
+    std::unique_ptr<Image> map(std::move(costMap));
+    if(toStdout || toStderr)
+        return;
+
+    WriteCostMap(filename, map.get());
+}
+
+void ImageProcessing::WriteCostMap(const UCS2String& filename, const Image *map)
+{
+    if(map == nullptr)
+        return;
+
+    // name the file after the output file, e.g. "scene.png" gets "scene.cost.hdr"
+    Path path(filename);
+    UCS2String file = path.GetFile();
+    UCS2String::size_type dot = file.rfind(UCS2('.'));
+    if(dot != UCS2String::npos)
+        file.erase(dot);
+    file += ASCIItoUCS2String(".cost.hdr");
+    path.SetFile(file);
+
+    std::unique_ptr<OStream> mapfile(NewOStream(path().c_str(), POV_File_Image_HDR, false));
+    if (mapfile == nullptr)
+        throw POV_EXCEPTION_CODE(kCannotOpenFileErr);
+
+    // the default options leave the values as they are
+    Image::Write(Image::HDR, mapfile.get(), map, Image::WriteOptions());
+}
+
+Image::ImageFileType ImageProcessing::GetWriteOptions(POVMS_Object& ropts, Image::WriteOptions& wopts, unsigned int& filetype)
+{
+    Image::ImageFileType imagetype = Image::SYS;
+    filetype = POV_File_Image_System;
+
+    wopts.bitsPerChannel = clip(ropts.TryGetInt(kPOVAttrib_BitsPerColor, 8), 1, 16);
+    wopts.alphaMode = (ropts.TryGetBool(kPOVAttrib_OutputAlpha, false) ? Image::kAlphaMode_Default : Image::kAlphaMode_None );
+    wopts.compression = (ropts.Exist(kPOVAttrib_Compression) ? clip(ropts.GetInt(kPOVAttrib_Compression), 0, 255) : -1);
+    wopts.grayscale = ropts.TryGetBool(kPOVAttrib_GrayscaleOutput, false);
+    wopts.tiled = ropts.TryGetBool(kPOVAttrib_TiledOutput, false);
+
+    switch(ropts.TryGetInt(kPOVAttrib_OutputFileType, DEFAULT_OUTPUT_FORMAT))
+    {
+        case kPOVList_FileType_Targa:
+            imagetype = Image::TGA;
+            filetype = POV_File_Image_Targa;
+            break;
+        case kPOVList_FileType_CompressedTarga:
+            // TODO - this file type is obsolete, as Targa compression can now
+            // be controlled using the `Compression` INI setting.
+            imagetype = Image::TGA;
+            filetype = POV_File_Image_Targa;
+            wopts.compression = 1;
+            break;
+        case kPOVList_FileType_PNG:
+            imagetype = Image::PNG;
+            filetype = POV_File_Image_PNG;
+            break;
+        case kPOVList_FileType_JPEG:
+            imagetype = Image::JPEG;
+            filetype = POV_File_Image_JPEG;
+            break;
+        case kPOVList_FileType_PPM:
+            imagetype = Image::PPM;
+            filetype = POV_File_Image_PPM;
+            break;
+        case kPOVList_FileType_BMP:
+            imagetype = Image::BMP;
+            filetype = POV_File_Image_BMP;
+            break;
+        case kPOVList_FileType_OpenEXR:
+            imagetype = Image::EXR;
+            filetype = POV_File_Image_EXR;
+            break;
+        case kPOVList_FileType_RadianceHDR:
+            imagetype = Image::HDR;
+            filetype = POV_File_Image_HDR;
+            break;
+        case kPOVList_FileType_System:
+            imagetype = Image::SYS;
+            filetype = POV_File_Image_System;
+            break;
+        default:
+            throw POV_EXCEPTION_STRING("Invalid file type for output");
+    }
+
+    GammaTypeId gammaType;
+    float gamma;
+    if (ropts.Exist(kPOVAttrib_FileGammaType))
+    {
+        gammaType = (GammaTypeId)ropts.GetInt(kPOVAttrib_FileGammaType);
+        gamma = ropts.GetFloat(kPOVAttrib_FileGamma);
+        wopts.encodingGamma = GetGammaCurve(gammaType, gamma);
+    }
+    else
+    {
+        // if user didn't explicitly specify File_Gamma, use the file format specific default.
+        wopts.encodingGamma.reset();
+    }
+    // NB: RenderFrontend<...>::CreateView should have dealt with kPOVAttrib_LegacyGammaMode already and updated kPOVAttrib_WorkingGammaType and kPOVAttrib_WorkingGamma to fit.
+    gammaType = (GammaTypeId)ropts.TryGetInt(kPOVAttrib_WorkingGammaType, DEFAULT_WORKING_GAMMA_TYPE);
+    gamma = ropts.TryGetFloat(kPOVAttrib_WorkingGamma, DEFAULT_WORKING_GAMMA);
+    wopts.workingGamma = GetGammaCurve(gammaType, gamma);
+
+    bool dither = ropts.TryGetBool(kPOVAttrib_Dither, false);
+    DitherMethodId ditherMethod = DitherMethodId::kNone;
+    if (dither)
+        ditherMethod = ropts.TryGetEnum(kPOVAttrib_DitherMethod, DitherMethodId::kBlueNoise);
+    wopts.ditherStrategy = GetDitherStrategy(ditherMethod, image->GetWidth());
+
+    return imagetype;
 }
 
 shared_ptr<Image>& ImageProcessing::GetImage()
 {
+    if(image == nullptr)
+        image = NextFrameBuffer();
     return image;
 }
 
@@ -39,14 +39,19 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "frontend/configfrontend.h"
 
+#include <deque>
+#include <memory>
+
+#include <boost/thread.hpp>
+
+#include "base/fileinputoutput.h"
 #include "base/stringutilities.h"
+#include "base/image/image.h"
 
 #include "povms/povmscpp.h"
 
-namespace pov_base
-{
-class Image;
-}
+#include "frontend/denoiser.h"
+#include "frontend/framepipe.h"
 
 namespace pov_frontend
 {
@@ -61,8 +66,46 @@ class ImageProcessing
         ImageProcessing(shared_ptr<Image>& img);
         virtual ~ImageProcessing();
 
+        /// Write the output file of the image.
+        /// Unless disabled via the output queue size, the file is encoded and written by a thread of its own,
+        /// and @ref GetImage() provides another frame buffer so that the next frame can be rendered right
+        /// away; if the queue is full, this waits until the oldest frame queued has been written.
+        /// Errors writing a queued frame are thrown by the next call, or by @ref FinishWriting().
         UCS2String WriteImage(POVMS_Object& ropts, POVMSInt frame = 0, int digits = 0);
 
+        /// Wait until all output files queued by @ref WriteImage() have been written.
+        /// @throws     The error encountered writing any of them, if any.
+        void FinishWriting();
+
+        /// Prepare to write the output file row by row while rendering, if the options and file type permit.
+        /// Must be called before the render is started; @ref WriteImage() then completes the file.
+        void StartStreaming(POVMS_Object& ropts, POVMSInt frame = 0, int digits = 0);
+
+        /// Note a rectangle of the final image as rendered, writing the rows completed by it if streaming.
+        void CompletedRectangle(unsigned int left, unsigned int top, unsigned int right, unsigned int bottom);
+
+        /// Set the render cost of each pixel, to be written alongside the output file by @ref WriteImage().
+        /// The cost map is written as a Radiance HDR file, holding the render time in microseconds,
+        /// the number of rays and the number of shadow rays in the red, green and blue channels.
+        /// @param[in]  width   Width of the cost map.
+        /// @param[in]  height  Height of the cost map.
+        /// @param[in]  costs   Three values per pixel, in rows from top to bottom.
+        void SetCostMap(unsigned int width, unsigned int height, const vector<POVMSFloat>& costs);
+
+        /// Set the first surfaces hit in each pixel, to guide the denoising of the image by @ref WriteImage().
+        /// @param[in]  width       Width of the feature map.
+        /// @param[in]  height      Height of the feature map.
+        /// @param[in]  features    Albedo, normal and depth per pixel, i.e. seven values, in rows from top to bottom.
+        void SetFeatureMap(unsigned int width, unsigned int height, const vector<POVMSFloat>& features);
+
+        /// Plug in a denoiser to use instead of the built-in @ref EdgeAwareDenoiser.
+        /// @param[in]  d           Denoiser, or `nullptr` to revert to the built-in one.
+        void SetDenoiser(const shared_ptr<Denoiser>& d) { denoiser = d; }
+
+        /// Stream the image to an output pipe command in @ref WriteImage(), instead of writing an output file.
+        /// @param[in]  p           Frame pipe, or `nullptr` to revert to writing output files.
+        void SetFramePipe(const shared_ptr<FramePipe>& p) { framePipe = p; }
+
         shared_ptr<Image>& GetImage();
 
         UCS2String GetOutputFilename(POVMS_Object& ropts, POVMSInt frame, int digits);
@@ -76,6 +119,60 @@ class ImageProcessing
         bool toStdout;
         bool toStderr;
 
+        bool streaming;
+        Image::ImageFileType streamFileType;
+        unsigned int streamFileKind;
+        Image::WriteOptions streamOptions;
+        UCS2String streamFilename;
+        std::unique_ptr<OStream> streamFile;
+        std::unique_ptr<Image::RowWriter> streamWriter;
+        vector<unsigned int> streamRowPixels;
+        unsigned int streamNextRow;
+        boost::mutex streamMutex;
+
+        std::unique_ptr<Image> costMap;
+
+        std::unique_ptr<DenoiseFeatures> denoiseFeatures;
+        shared_ptr<Denoiser> denoiser;
+
+        shared_ptr<FramePipe> framePipe;
+
+        /// Output file queued for writing by the output writer thread.
+        struct OutputJob
+        {
+            shared_ptr<Image> image;
+            Image::ImageFileType imageType;
+            unsigned int fileType;
+            Image::WriteOptions options;
+            UCS2String filename;
+            std::unique_ptr<Image> costMap;
+        };
+
+        unsigned int outputQueueSize;   ///< Maximum number of frames queued for writing, or 0 to write synchronously.
+        std::deque<shared_ptr<OutputJob> > outputQueue; ///< Frames queued, including the one being written.
+        vector<shared_ptr<Image> > spareImages; ///< Frame buffers of frames written, for re-use.
+        std::unique_ptr<pov_base::Exception> outputError;
+        bool outputClosing;
+        std::unique_ptr<boost::thread> outputWriter;
+        boost::mutex outputMutex;
+        boost::condition_variable outputQueueChanged;
+
+        unsigned int bufferWidth;
+        unsigned int bufferHeight;
+        Image::ImageDataType bufferType;
+        GammaCurvePtr bufferGamma;
+        unsigned int bufferMaxMem;
+        unsigned int bufferBlockPixels;
+
+        Image::ImageFileType GetWriteOptions(POVMS_Object& ropts, Image::WriteOptions& wopts, unsigned int& filetype);
+        void WriteStreamedRows(unsigned int endRow);
+        void WriteCostMap(const UCS2String& filename);
+        static void WriteCostMap(const UCS2String& filename, const Image *map);
+        void QueueOutput(const shared_ptr<OutputJob>& job);
+        shared_ptr<Image> NextFrameBuffer();
+        void OutputWriterThread();
+        void DenoiseImage(POVMS_Object& ropts);
+
     private:
         ImageProcessing();
         ImageProcessing(const ImageProcessing&);
@@ -99,14 +99,17 @@ struct ProcessOptions::INI_Parser_Table RenderOptions_INI_Table[] =
     { "Antialias_Depth",     kPOVAttrib_AntialiasDepth,     kPOVMSType_Int },
     { "Antialias_Gamma",     kPOVAttrib_AntialiasGamma,     kPOVMSType_Float },
     { "Antialias_Threshold", kPOVAttrib_AntialiasThreshold, kPOVMSType_Float },
+    { "Antialias_Time_Limit",kPOVAttrib_AntialiasTimeLimit, kPOVMSType_Float },
     { "Append_File",         kPOVAttrib_AppendConsoleFiles, kPOVMSType_Bool },
 
     { "Bits_Per_Color",      kPOVAttrib_BitsPerColor,       kPOVMSType_Int,         kINIOptFlag_SuppressWrite },
     { "Bits_Per_Colour",     kPOVAttrib_BitsPerColor,       kPOVMSType_Int },
     { "Bounding",            kPOVAttrib_Bounding,           kPOVMSType_Bool },
     { "Bounding_Method",     kPOVAttrib_BoundingMethod,     kPOVMSType_Int },
+    { "Bounding_Refit",      kPOVAttrib_BoundingRefit,      kPOVMSType_Bool },
     { "Bounding_Threshold",  kPOVAttrib_BoundingThreshold,  kPOVMSType_Int },
     { "BSP_BaseAccessCost",  kPOVAttrib_BSP_BaseAccessCost, kPOVMSType_Float },
+    { "BSP_Cache_File",      kPOVAttrib_BSP_CacheFile,      kPOVMSType_UCS2String },
     { "BSP_ChildAccessCost", kPOVAttrib_BSP_ChildAccessCost,kPOVMSType_Float },
     { "BSP_ISectCost",       kPOVAttrib_BSP_ISectCost,      kPOVMSType_Float },
     { "BSP_MaxDepth",        kPOVAttrib_BSP_MaxDepth,       kPOVMSType_Int },
@@ -118,6 +121,7 @@ struct ProcessOptions::INI_Parser_Table RenderOptions_INI_Table[] =
     { "Clockless_Animation", kPOVAttrib_ClocklessAnimation, kPOVMSType_Bool },
     { "Compression",         kPOVAttrib_Compression,        kPOVMSType_Int },
     { "Continue_Trace",      kPOVAttrib_ContinueTrace,      kPOVMSType_Bool },
+    { "Cost_Map",            kPOVAttrib_CostMap,            kPOVMSType_Bool },
     { "Create_Continue_Trace_Log", kPOVAttrib_BackupTrace,  kPOVMSType_Bool },
     { "Create_Histogram",    0,                             0 },
     { "Create_Ini",          kPOVAttrib_CreateIni,          kPOVMSType_UCS2String },
@@ -126,6 +130,8 @@ struct ProcessOptions::INI_Parser_Table RenderOptions_INI_Table[] =
     { "Debug_Console",       kPOVAttrib_DebugConsole,       kPOVMSType_Bool },
     { "Debug_File",          kPOVAttrib_DebugFile,          kPOVMSType_UCS2String },
     { "Declare",             kPOVAttrib_Declare,            kUseSpecialHandler },
+    { "Denoise",             kPOVAttrib_Denoise,            kPOVMSType_Bool },
+    { "Denoise_Strength",    kPOVAttrib_DenoiseStrength,    kPOVMSType_Float },
     { "Display",             kPOVAttrib_Display,            kPOVMSType_Bool },
     { "Display_Gamma",       kPOVAttrib_DisplayGamma,       kUseSpecialHandler },
     { "Dither",              kPOVAttrib_Dither,             kPOVMSType_Bool },
@@ -134,6 +140,7 @@ struct ProcessOptions::INI_Parser_Table RenderOptions_INI_Table[] =
 
     { "End_Column",          kPOVAttrib_Right,              kPOVMSType_Float },
     { "End_Row",             kPOVAttrib_Bottom,             kPOVMSType_Float },
+    { "Event_Trace_File",    kPOVAttrib_EventTraceFile,     kPOVMSType_UCS2String },
 
     { "Fatal_Console",       kPOVAttrib_FatalConsole,       kPOVMSType_Bool },
     { "Fatal_Error_Command", kPOVAttrib_FatalErrorCommand,  kUseSpecialHandler },
@@ -157,7 +164,9 @@ struct ProcessOptions::INI_Parser_Table RenderOptions_INI_Table[] =
     { "Initial_Clock",       kPOVAttrib_InitialClock,       kPOVMSType_Float },
     { "Initial_Frame",       kPOVAttrib_InitialFrame,       kPOVMSType_Int },
     { "Input_File_Name",     kPOVAttrib_InputFile,          kPOVMSType_UCS2String },
+    { "Include_Cache_Path",  kPOVAttrib_IncludeCachePath,   kPOVMSType_UCS2String },
     { "Include_Header",      kPOVAttrib_IncludeHeader,      kPOVMSType_UCS2String },
+    { "Incremental_Animation", kPOVAttrib_IncrementalAnimation, kPOVMSType_Bool },
     { "Include_Ini",         kPOVAttrib_IncludeIni,         kUseSpecialHandler },
 
     { "Jitter_Amount",       kPOVAttrib_JitterAmount,       kPOVMSType_Float },
@@ -172,10 +181,15 @@ struct ProcessOptions::INI_Parser_Table RenderOptions_INI_Table[] =
     { "Output_Alpha",        kPOVAttrib_OutputAlpha,        kPOVMSType_Bool },
     { "Output_File_Name",    kPOVAttrib_OutputFile,         kPOVMSType_UCS2String },
     { "Output_File_Type",    kPOVAttrib_OutputFileType,     kUseSpecialHandler },
+    { "Output_Pipe_Command", kPOVAttrib_OutputPipeCommand,  kUseSpecialHandler },
+    { "Output_Queue_Size",   kPOVAttrib_OutputQueueSize,    kPOVMSType_Int },
     { "Output_To_File",      kPOVAttrib_OutputToFile,       kPOVMSType_Bool },
 
     { "Palette",             kPOVAttrib_Palette,            kUseSpecialHandler },
+    { "Parse_Profile",       kPOVAttrib_ParseProfile,       kPOVMSType_Bool },
     { "Pause_When_Done",     kPOVAttrib_PauseWhenDone,      kPOVMSType_Bool },
+    { "Photon_Passes",       kPOVAttrib_PhotonPasses,       kPOVMSType_Int },
+    { "Pipeline_Frames",     kPOVAttrib_PipelineFrames,     kPOVMSType_Int },
     { "Post_Frame_Command",  kPOVAttrib_PostFrameCommand,   kUseSpecialHandler },
     { "Post_Frame_Return",   kPOVAttrib_PostFrameCommand,   kUseSpecialHandler },
     { "Post_Scene_Command",  kPOVAttrib_PostSceneCommand,   kUseSpecialHandler },
@@ -191,6 +205,10 @@ struct ProcessOptions::INI_Parser_Table RenderOptions_INI_Table[] =
 
     { "Radiosity_File_Name", kPOVAttrib_RadiosityFileName,  kPOVMSType_UCS2String },
     { "Radiosity_From_File", kPOVAttrib_RadiosityFromFile,  kPOVMSType_Bool },
+    { "Radiosity_Incremental", kPOVAttrib_RadiosityIncremental, kPOVMSType_Bool },
+    { "Radiosity_Merge_File", kPOVAttrib_RadiosityMergeFile, kUseSpecialHandler },
+    { "Radiosity_Pretrace_Only", kPOVAttrib_RadiosityPretraceOnly, kPOVMSType_Bool },
+    { "Radiosity_Skip_Pretrace", kPOVAttrib_RadiositySkipPretrace, kPOVMSType_Bool },
     { "Radiosity_To_File",   kPOVAttrib_RadiosityToFile,    kPOVMSType_Bool },
     { "Radiosity_Vain_Pretrace", kPOVAttrib_RadiosityVainPretrace, kPOVMSType_Bool },
     { "Real_Time_Raytracing",kPOVAttrib_RealTimeRaytracing, kPOVMSType_Bool },
@@ -199,7 +217,10 @@ struct ProcessOptions::INI_Parser_Table RenderOptions_INI_Table[] =
     { "Render_Block_Step",   kPOVAttrib_RenderBlockStep,    kPOVMSType_Int },
     { "Render_Console",      kPOVAttrib_RenderConsole,      kPOVMSType_Bool },
     { "Render_File",         kPOVAttrib_RenderFile,         kPOVMSType_UCS2String },
+    { "Render_Node",         kPOVAttrib_RenderNode,         kPOVMSType_Int },
+    { "Render_Nodes",        kPOVAttrib_RenderNodes,        kPOVMSType_Int },
     { "Render_Pattern",      kPOVAttrib_RenderPattern,      kPOVMSType_Int },
+    { "Reuse_Scene",         kPOVAttrib_ReuseScene,         kPOVMSType_Bool },
 
     { "Sampling_Method",     kPOVAttrib_SamplingMethod,     kPOVMSType_Int },
     { "Split_Unions",        kPOVAttrib_SplitUnions,        kPOVMSType_Bool },
@@ -208,11 +229,15 @@ struct ProcessOptions::INI_Parser_Table RenderOptions_INI_Table[] =
     { "Statistic_Console",   kPOVAttrib_StatisticsConsole,  kPOVMSType_Bool },
     { "Statistic_File",      kPOVAttrib_StatisticsFile,     kPOVMSType_UCS2String },
     { "Stochastic_Seed",     kPOVAttrib_StochasticSeed,     kPOVMSType_Int },
+    { "Stream_Output",       kPOVAttrib_StreamOutput,       kPOVMSType_Bool },
     { "Subset_End_Frame",    kPOVAttrib_SubsetEndFrame,     kPOVMSType_Float },
     { "Subset_Start_Frame",  kPOVAttrib_SubsetStartFrame,   kPOVMSType_Float },
 
     { "Test_Abort_Count",    kPOVAttrib_TestAbortCount,     kPOVMSType_Int },
     { "Test_Abort",          kPOVAttrib_TestAbort,          kPOVMSType_Bool },
+    { "Thread_Affinity",     kPOVAttrib_ThreadAffinity,     kPOVMSType_Bool },
+    { "Tiled_Output",        kPOVAttrib_TiledOutput,        kPOVMSType_Bool },
+    { "Time_Budget",         kPOVAttrib_TimeBudget,         kPOVMSType_Float },
 
     { "User_Abort_Command",  kPOVAttrib_UserAbortCommand,   kUseSpecialHandler },
     { "User_Abort_Return",   kPOVAttrib_UserAbortCommand,   kUseSpecialHandler },
@@ -225,6 +250,7 @@ struct ProcessOptions::INI_Parser_Table RenderOptions_INI_Table[] =
     { "Warning_Console",     kPOVAttrib_WarningConsole,     kPOVMSType_Bool },
     { "Warning_File",        kPOVAttrib_WarningFile,        kPOVMSType_UCS2String },
     { "Warning_Level",       kPOVAttrib_WarningLevel,       kPOVMSType_Int },
+    { "Wavefront_Tracing",   kPOVAttrib_WavefrontTracing,   kPOVMSType_Bool },
     { "Width",               kPOVAttrib_Width,              kPOVMSType_Int },
     { "Work_Threads",        kPOVAttrib_MaxRenderThreads,   kPOVMSType_Int },
 
@@ -401,6 +427,7 @@ int ProcessRenderOptions::ReadSpecialOptionHandler(INI_Parser_Table *option, cha
 
         case kPOVAttrib_IncludeIni:
         case kPOVAttrib_LibraryPath:
+        case kPOVAttrib_RadiosityMergeFile:
 
             // parse INI file (recursive)
             if(option->key == kPOVAttrib_IncludeIni)
@@ -477,6 +504,7 @@ int ProcessRenderOptions::ReadSpecialOptionHandler(INI_Parser_Table *option, cha
             break;
 
         case kPOVAttrib_FatalErrorCommand:
+        case kPOVAttrib_OutputPipeCommand:
         case kPOVAttrib_PostFrameCommand:
         case kPOVAttrib_PostSceneCommand:
         case kPOVAttrib_PreFrameCommand:
@@ -741,6 +769,7 @@ int ProcessRenderOptions::WriteSpecialOptionHandler(INI_Parser_Table *option, PO
             break;
 
         case kPOVAttrib_LibraryPath:
+        case kPOVAttrib_RadiosityMergeFile:
 
             err = POVMSObject_Get(obj, &list, option->key);
             if(err != 0)
@@ -773,6 +802,7 @@ int ProcessRenderOptions::WriteSpecialOptionHandler(INI_Parser_Table *option, PO
             break;
 
         case kPOVAttrib_FatalErrorCommand:
+        case kPOVAttrib_OutputPipeCommand:
         case kPOVAttrib_PostFrameCommand:
         case kPOVAttrib_PostSceneCommand:
         case kPOVAttrib_PreFrameCommand:
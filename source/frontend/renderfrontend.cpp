@@ -142,6 +142,8 @@ RenderFrontendBase::RenderFrontendBase(POVMSContext ctx) :
     InstallFront(kPOVMsgClass_ViewImage, kPOVMsgIdent_PixelRowSet, this, &RenderFrontendBase::HandleMessage);
     InstallFront(kPOVMsgClass_ViewImage, kPOVMsgIdent_RectangleFrameSet, this, &RenderFrontendBase::HandleMessage);
     InstallFront(kPOVMsgClass_ViewImage, kPOVMsgIdent_FilledRectangleSet, this, &RenderFrontendBase::HandleMessage);
+    InstallFront(kPOVMsgClass_ViewImage, kPOVMsgIdent_CostMapSet, this, &RenderFrontendBase::HandleMessage);
+    InstallFront(kPOVMsgClass_ViewImage, kPOVMsgIdent_FeatureMapSet, this, &RenderFrontendBase::HandleMessage);
 
     InstallFront(kPOVMsgClass_FileAccess, kPOVMsgIdent_FindFile, this, &RenderFrontendBase::HandleMessage);
     InstallFront(kPOVMsgClass_FileAccess, kPOVMsgIdent_ReadFile, this, &RenderFrontendBase::HandleMessage);
@@ -603,6 +605,11 @@ void RenderFrontendBase::MakeBackupPath(POVMS_Object& ropts, ViewData& vd, const
     vd.imageBackupFile.SetFile(GetFileName(Path(vd.imageBackupFile.GetFile())) + ASCIItoUCS2String(".pov-state"));
 }
 
+UCS2String RenderFrontendBase::MakeCheckpointPath(const ViewData& vd, const char *suffix)
+{
+    return vd.imageBackupFile() + ASCIItoUCS2String(suffix);
+}
+
 void RenderFrontendBase::NewBackup(POVMS_Object& ropts, ViewData& vd, const Path& outputpath)
 {
     vd.imageBackup.reset();
@@ -963,6 +970,9 @@ void ParserOptions(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
     tsb->printf("  Remove bounds.......%s\n  Split unions........%s\n",
                   GetOptionSwitchString(msg, kPOVAttrib_RemoveBounds, true),
                   GetOptionSwitchString(msg, kPOVAttrib_SplitUnions, false));
+    tsb->printf("  Light buffer........%s\n  Vista buffer........%s\n",
+                  GetOptionSwitchString(msg, kPOVAttrib_LightBuffer, false),
+                  GetOptionSwitchString(msg, kPOVAttrib_VistaBuffer, false));
 
     tsb->printf("  Library paths:\n");
     if(POVMSObject_Get(msg, &attr, kPOVAttrib_LibraryPath) == kNoErr)
@@ -1008,21 +1018,12 @@ void RenderOptions(POVMS_Object& obj, TextStreamBuffer *tsb)
     else
         tsb->printf("  Bounding boxes.......Off\n");
 
-    /*
-    tsb->printf("  Light Buffer........%s\n", GetOptionSwitchString(msg, kPOVAttrib_LightBuffer, true));
-    tsb->printf("  Vista Buffer........%-3s", GetOptionSwitchString(msg, kPOVAttrib_VistaBuffer, true));
-    b = false;
-    (void)POVMSUtil_GetBool(msg, kPOVAttrib_VistaBuffer, &b);
-    if(b == true)
-        tsb->printf("  Draw Vista Buffer...%s", GetOptionSwitchString(msg, kPOVAttrib_DrawVistas, false));
-    tsb->printf("\n");
-*/
 
     if(obj.TryGetBool(kPOVAttrib_Antialias, false) == true)
     {
         int method = 0;
         if(obj.TryGetBool(kPOVAttrib_Antialias, false) == true)
-            method = clip(obj.TryGetInt(kPOVAttrib_SamplingMethod, 1), 0, 3); // TODO FIXME - magic number in clip
+            method = clip(obj.TryGetInt(kPOVAttrib_SamplingMethod, 1), 0, 4); // TODO FIXME - magic number in clip
         int depth = clip(obj.TryGetInt(kPOVAttrib_AntialiasDepth, 3), 1, 9); // TODO FIXME - magic number in clip
         float threshold = clip(obj.TryGetFloat(kPOVAttrib_AntialiasThreshold, 0.3f), 0.0f, 1.0f);
         float aagamma = obj.TryGetFloat(kPOVAttrib_AntialiasGamma, 2.5f);
@@ -1328,6 +1329,82 @@ void ParserStatistics(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
         tsb->printf("BSP Max Depth Stopped Nodes:  %10d (%3.1f%%)   Objects/Node:   %8.2f\n",
                     cppmsg.TryGetInt(kPOVAttrib_BSPAborts, 0), cppmsg.TryGetFloat(kPOVAttrib_BSPAverageAborts, 0.0f) * 100.0f,
                     cppmsg.TryGetFloat(kPOVAttrib_BSPAverageAbortObjects, 0.0f));
+        if(cppmsg.Exist(kPOVAttrib_HierarchyObjectCost) == true)
+            tsb->printf("BSP Expected Node Visits/Ray:   %8.2f          Object Tests/Ray: %8.2f\n",
+                        cppmsg.TryGetFloat(kPOVAttrib_HierarchyNodeCost, 0.0f), cppmsg.TryGetFloat(kPOVAttrib_HierarchyObjectCost, 0.0f));
+    }
+
+    if(cppmsg.Exist(kPOVAttrib_BBoxTreeNodes) == true)
+    {
+        tsb->printf("----------------------------------------------------------------------------\n");
+        tsb->printf("BVH Nodes:        %10d\n", cppmsg.TryGetInt(kPOVAttrib_BBoxTreeNodes, 0));
+        if(cppmsg.Exist(kPOVAttrib_HierarchyObjectCost) == true)
+            tsb->printf("BVH Expected Box Tests/Ray:     %8.2f          Object Tests/Ray: %8.2f\n",
+                        cppmsg.TryGetFloat(kPOVAttrib_BBoxTreeCost, 0.0f), cppmsg.TryGetFloat(kPOVAttrib_HierarchyObjectCost, 0.0f));
+        else
+            tsb->printf("BVH Expected Box Tests/Ray:     %8.2f\n", cppmsg.TryGetFloat(kPOVAttrib_BBoxTreeCost, 0.0f));
+        if(cppmsg.TryGetBool(kPOVAttrib_BBoxTreeRefitted, false))
+            tsb->printf("BVH Refitted from previous frame\n");
+        if(cppmsg.Exist(kPOVAttrib_FlatBVHNodes) == true)
+            tsb->printf("BVH 4-Wide Nodes: %10d (%d bytes each)\n", cppmsg.TryGetInt(kPOVAttrib_FlatBVHNodes, 0), cppmsg.TryGetInt(kPOVAttrib_FlatBVHNodeSize, 0));
+    }
+
+    if(cppmsg.Exist(kPOVAttrib_HierarchyDepths) == true)
+    {
+        vector<POVMSInt> depths(cppmsg.GetIntVector(kPOVAttrib_HierarchyDepths));
+        vector<POVMSInt> leafSizes(cppmsg.GetIntVector(kPOVAttrib_HierarchyLeafSizes));
+        double total = 0.0;
+        double sum = 0.0;
+
+        for(size_t d = 0; d < depths.size(); d++)
+        {
+            total += depths[d];
+            sum += double(d) * depths[d];
+        }
+
+        // group the depths so as to print no more than 16 lines
+        size_t width = max(size_t(1), (depths.size() + 15) / 16);
+
+        tsb->printf("----------------------------------------------------------------------------\n");
+        tsb->printf("Hierarchy Leaf Depth Average:   %8.2f          Maximum:      %10d\n",
+                    (total > 0.0) ? sum / total : 0.0, int(depths.size()) - 1);
+        tsb->printf("Leaf Depth                   Leaves  Percentage\n");
+        for(size_t first = 0; first < depths.size(); first += width)
+        {
+            size_t last = min(first + width, depths.size()) - 1;
+            double count = 0.0;
+
+            for(size_t d = first; d <= last; d++)
+                count += depths[d];
+
+            if(last > first)
+                tsb->printf("  %4d - %4d       %14.0f  %8.2f\n", int(first), int(last), count, 100.0 * count / total);
+            else
+                tsb->printf("  %4d              %14.0f  %8.2f\n", int(first), count, 100.0 * count / total);
+        }
+
+        total = 0.0;
+        for(size_t n = 0; n < leafSizes.size(); n++)
+            total += leafSizes[n];
+
+        // group the sizes beyond 4 by powers of two
+        tsb->printf("Objects per Leaf Node         Nodes  Percentage\n");
+        for(size_t first = 0; first < leafSizes.size(); first = (first <= 4 ? first + 1 : first * 2 - 1))
+        {
+            size_t last = min((first <= 4 ? first : first * 2 - 2), leafSizes.size() - 1);
+            double count = 0.0;
+
+            for(size_t n = first; n <= last; n++)
+                count += leafSizes[n];
+
+            if(count < 0.5)
+                continue;
+
+            if(last > first)
+                tsb->printf("  %4d - %4d       %14.0f  %8.2f\n", int(first), int(last), count, 100.0 * count / total);
+            else
+                tsb->printf("  %4d              %14.0f  %8.2f\n", int(first), count, 100.0 * count / total);
+        }
     }
 
     tsb->printf("----------------------------------------------------------------------------\n");
@@ -1374,6 +1451,37 @@ void RenderStatistics(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
     tsb->printf("Rays:    %15.0f   Saved:   %15.0f   Max Level: %d/%d\n",
                 POVMSLongToCDouble(l), POVMSLongToCDouble(l2), i, i2);
 
+    if(POVMSObject_Get(msg, &attr, kPOVAttrib_RouletteStats) == kNoErr)
+    {
+        int cnt = 0;
+
+        if(POVMSAttrList_Count(&attr, &cnt) == kNoErr)
+        {
+            POVMSObject obj;
+            int ii, level;
+
+            for(ii = 1; ii <= cnt; ii++)
+            {
+                if(POVMSAttrList_GetNth(&attr, ii, &obj) == kNoErr)
+                {
+                    level = 0;
+                    l = l2 = 0;
+                    (void)POVMSUtil_GetInt(&obj, kPOVAttrib_TraceLevel, &level);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_RouletteTests, &l);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_RouletteKills, &l2);
+
+                    if(POVMSLongToCDouble(l) > 0.5)
+                        tsb->printf("Roulette L%d%s%11.0f   Killed:  %15.0f\n",
+                                    level, (ii == cnt ? "+:" : ": "), POVMSLongToCDouble(l), POVMSLongToCDouble(l2));
+
+                    (void)POVMSAttr_Delete(&obj);
+                }
+            }
+        }
+
+        (void)POVMSAttr_Delete(&attr);
+    }
+
     tsb->printf("----------------------------------------------------------------------------\n");
     tsb->printf("Ray->Shape Intersection          Tests       Succeeded  Percentage\n");
     tsb->printf("----------------------------------------------------------------------------\n");
@@ -1413,6 +1521,47 @@ void RenderStatistics(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
         (void)POVMSAttr_Delete(&attr);
     }
 
+    if(POVMSObject_Get(msg, &attr, kPOVAttrib_TraversalStats) == kNoErr)
+    {
+        int cnt = 0;
+
+        if(POVMSAttrList_Count(&attr, &cnt) == kNoErr)
+        {
+            POVMSObject obj;
+            POVMSLong l3;
+            int ii, len;
+            char str[40];
+
+            tsb->printf("----------------------------------------------------------------------------\n");
+            tsb->printf("Hierarchy Traversal              Rays       Nodes/Ray  Objects/Ray\n");
+            tsb->printf("----------------------------------------------------------------------------\n");
+
+            for(ii = 1; ii <= cnt; ii++)
+            {
+                if(POVMSAttrList_GetNth(&attr, ii, &obj) == kNoErr)
+                {
+                    len = 40;
+                    str[0] = 0;
+                    (void)POVMSUtil_GetString(&obj, kPOVAttrib_ObjectName, str, &len);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_TraversalRays, &l);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_TraversalNodes, &l2);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_TraversalObjects, &l3);
+
+                    if(POVMSLongToCDouble(l) > 0.5)
+                    {
+                        tsb->printf("%-22s  %14.0f  %14.2f  %11.2f\n", str, POVMSLongToCDouble(l),
+                                      POVMSLongToCDouble(l2) / POVMSLongToCDouble(l),
+                                      POVMSLongToCDouble(l3) / POVMSLongToCDouble(l));
+                    }
+
+                    (void)POVMSAttr_Delete(&obj);
+                }
+            }
+        }
+
+        (void)POVMSAttr_Delete(&attr);
+    }
+
     (void)POVMSUtil_GetLong(msg, kPOVAttrib_IsoFindRoot, &l);
     (void)POVMSUtil_GetLong(msg, kPOVAttrib_FunctionVMCalls, &l2);
     if((POVMSLongToCDouble(l) > 0.5) || (POVMSLongToCDouble(l2) > 0.5))
@@ -1424,6 +1573,153 @@ void RenderStatistics(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
             tsb->printf("Function VM calls:  %15.0f\n", POVMSLongToCDouble(l2));
     }
 
+    if(POVMSObject_Get(msg, &attr, kPOVAttrib_FunctionVMProfile) == kNoErr)
+    {
+        int cnt = 0;
+
+        if(POVMSAttrList_Count(&attr, &cnt) == kNoErr)
+        {
+            POVMSObject obj;
+            POVMSFloat f;
+            UCS2 filename[1024];
+            int ii, len;
+            char str[40];
+
+            tsb->printf("----------------------------------------------------------------------------\n");
+            tsb->printf("Function Profile                 Calls    Instructions     Time (s)\n");
+            tsb->printf("----------------------------------------------------------------------------\n");
+
+            for(ii = 1; ii <= cnt; ii++)
+            {
+                if(POVMSAttrList_GetNth(&attr, ii, &obj) == kNoErr)
+                {
+                    len = 40;
+                    str[0] = 0;
+                    f = 0.0f;
+                    (void)POVMSUtil_GetString(&obj, kPOVAttrib_ObjectName, str, &len);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_FunctionVMCalls, &l);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_FunctionVMInstr, &l2);
+                    (void)POVMSUtil_GetFloat(&obj, kPOVAttrib_FunctionVMTime, &f);
+
+                    tsb->printf("%-22s  %14.0f  %14.0f  %11.3f\n", (str[0] != 0) ? str : "(anonymous)",
+                                  POVMSLongToCDouble(l), POVMSLongToCDouble(l2), (double)f);
+
+                    len = sizeof(filename);
+                    if((POVMSUtil_GetUCS2String(&obj, kPOVAttrib_FileName, filename, &len) == kNoErr) &&
+                       (POVMSUtil_GetLong(&obj, kPOVAttrib_Line, &l3) == kNoErr) && (l3 > 0))
+                    {
+                        // TODO FIXME: we ought to support UCS2 string output.
+                        POVMSUCS2String fn(filename);
+                        tsb->printf("  File: %s  Line: %ld\n", UCS2toASCIIString(fn).c_str(), (long)l3);
+                    }
+
+                    (void)POVMSAttr_Delete(&obj);
+                }
+            }
+        }
+
+        (void)POVMSAttr_Delete(&attr);
+    }
+
+    if(POVMSObject_Get(msg, &attr, kPOVAttrib_FunctionVMOpcodes) == kNoErr)
+    {
+        int cnt = 0;
+
+        if(POVMSAttrList_Count(&attr, &cnt) == kNoErr)
+        {
+            POVMSObject obj;
+            double total = 0.0;
+            int ii, len;
+            char str[40];
+
+            for(ii = 1; ii <= cnt; ii++)
+            {
+                if(POVMSAttrList_GetNth(&attr, ii, &obj) == kNoErr)
+                {
+                    if(POVMSUtil_GetLong(&obj, kPOVAttrib_FunctionVMInstr, &l) == kNoErr)
+                        total += POVMSLongToCDouble(l);
+                    (void)POVMSAttr_Delete(&obj);
+                }
+            }
+
+            tsb->printf("----------------------------------------------------------------------------\n");
+            tsb->printf("Function VM Instruction          Count    Percent\n");
+            tsb->printf("----------------------------------------------------------------------------\n");
+
+            for(ii = 1; ii <= cnt; ii++)
+            {
+                if(POVMSAttrList_GetNth(&attr, ii, &obj) == kNoErr)
+                {
+                    len = 40;
+                    str[0] = 0;
+                    (void)POVMSUtil_GetString(&obj, kPOVAttrib_ObjectName, str, &len);
+
+                    if((POVMSUtil_GetLong(&obj, kPOVAttrib_FunctionVMInstr, &l) == kNoErr) && (total > 0.5))
+                        tsb->printf("%-22s  %14.0f  %8.2f\n", str, POVMSLongToCDouble(l),
+                                      100.0 * POVMSLongToCDouble(l) / total);
+
+                    (void)POVMSAttr_Delete(&obj);
+                }
+            }
+        }
+
+        (void)POVMSAttr_Delete(&attr);
+    }
+
+    if(POVMSObject_Get(msg, &attr, kPOVAttrib_ObjectProfile) == kNoErr)
+    {
+        int cnt = 0;
+
+        if(POVMSAttrList_Count(&attr, &cnt) == kNoErr)
+        {
+            POVMSObject obj;
+            POVMSFloat f, f2;
+            POVMSLong l4;
+            UCS2 filename[1024];
+            int ii, len;
+            char str[64];
+
+            tsb->printf("----------------------------------------------------------------------------\n");
+            tsb->printf("Object Profile            Tests        Hits   Time (s)      Shaded   Time (s)\n");
+            tsb->printf("----------------------------------------------------------------------------\n");
+
+            for(ii = 1; ii <= cnt; ii++)
+            {
+                if(POVMSAttrList_GetNth(&attr, ii, &obj) == kNoErr)
+                {
+                    len = sizeof(str);
+                    str[0] = 0;
+                    l3 = 0;
+                    f = f2 = 0.0f;
+                    (void)POVMSUtil_GetString(&obj, kPOVAttrib_ObjectName, str, &len);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_Line, &l3);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_ObjectTests, &l);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_ObjectHits, &l2);
+                    (void)POVMSUtil_GetFloat(&obj, kPOVAttrib_ObjectTestTime, &f);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_ObjectShadings, &l4);
+                    (void)POVMSUtil_GetFloat(&obj, kPOVAttrib_ObjectShadingTime, &f2);
+
+                    tsb->printf("%-18s %12.0f %11.0f %10.3f %11.0f %10.3f\n",
+                                  (str[0] != 0) ? str : ((l3 > 0) ? "(unnamed)" : "(other)"),
+                                  POVMSLongToCDouble(l), POVMSLongToCDouble(l2), (double)f,
+                                  POVMSLongToCDouble(l4), (double)f2);
+
+                    len = sizeof(filename);
+                    if((POVMSUtil_GetUCS2String(&obj, kPOVAttrib_FileName, filename, &len) == kNoErr) && (l3 > 0))
+                    {
+                        // TODO FIXME: we ought to support UCS2 string output.
+                        POVMSUCS2String fn(filename);
+                        tsb->printf("  File: %s  Line: %ld\n", UCS2toASCIIString(fn).c_str(), (long)l3);
+                    }
+
+                    (void)POVMSAttr_Delete(&obj);
+                }
+            }
+        }
+
+        (void)POVMSAttr_Delete(&attr);
+    }
+
     (void)POVMSUtil_GetLong(msg, kPOVAttrib_CrackleCacheTest, &l);
     (void)POVMSUtil_GetLong(msg, kPOVAttrib_CrackleCacheTestSuc, &l2);
     if((POVMSLongToCDouble(l) > 0.5) || (POVMSLongToCDouble(l2) > 0.5))
@@ -1436,6 +1732,14 @@ void RenderStatistics(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
                             100.0 * POVMSLongToCDouble(l2) / POVMSLongToCDouble(l));
     }
 
+    (void)POVMSUtil_GetLong(msg, kPOVAttrib_MeshTest, &l);
+    (void)POVMSUtil_GetLong(msg, kPOVAttrib_MeshTriangleTest, &l2);
+    if((POVMSLongToCDouble(l) > 0.5) && (POVMSLongToCDouble(l2) > 0.5))
+    {
+        tsb->printf("----------------------------------------------------------------------------\n");
+        tsb->printf("Mesh triangles tested per ray: %11.2f\n", POVMSLongToCDouble(l2) / POVMSLongToCDouble(l));
+    }
+
     tsb->printf("----------------------------------------------------------------------------\n");
 
     (void)POVMSUtil_GetLong(msg, kPOVAttrib_PolynomTest, &l);
@@ -1469,11 +1773,35 @@ void RenderStatistics(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
         tsb->printf("Shadow Ray Tests:   %15.0f   Succeeded:       %15.0f\n",
                       POVMSLongToCDouble(l), POVMSLongToCDouble(l2));
 
-        (void)POVMSUtil_GetLong(msg, kPOVAttrib_ShadowCacheHits, &l);
+        (void)POVMSUtil_GetLong(msg, kPOVAttrib_ShadowCacheTests, &l);
         if(POVMSLongToCDouble(l) > 0.5)
-            tsb->printf("Shadow Cache Hits:  %15.0f\n", POVMSLongToCDouble(l));
+        {
+            (void)POVMSUtil_GetLong(msg, kPOVAttrib_ShadowCacheHits, &l2);
+            tsb->printf("Shadow Cache Tests: %15.0f   Hits:            %15.0f (%.2f %%)\n",
+                          POVMSLongToCDouble(l), POVMSLongToCDouble(l2), 100.0 * POVMSLongToCDouble(l2) / POVMSLongToCDouble(l));
+        }
     }
 
+    (void)POVMSUtil_GetLong(msg, kPOVAttrib_BSPMailboxHits, &l);
+    if(POVMSLongToCDouble(l) > 0.5)
+        tsb->printf("BSP Mailbox Hits:   %15.0f\n", POVMSLongToCDouble(l));
+
+    (void)POVMSUtil_GetLong(msg, kPOVAttrib_MergeHitTests, &l);
+    if(POVMSLongToCDouble(l) > 0.5)
+    {
+        (void)POVMSUtil_GetLong(msg, kPOVAttrib_MergeInsideTests, &l2);
+        tsb->printf("Merge Hit Tests:    %15.0f   Inside Tests:    %15.0f (%4.2f)\n",
+                      POVMSLongToCDouble(l), POVMSLongToCDouble(l2), POVMSLongToCDouble(l2) / POVMSLongToCDouble(l));
+    }
+
+    (void)POVMSUtil_GetLong(msg, kPOVAttrib_TraceHeapAllocs, &l);
+    if(POVMSLongToCDouble(l) > 0.5)
+        tsb->printf("Scratch Heap Allocs:%15.0f\n", POVMSLongToCDouble(l));
+
+    (void)POVMSUtil_GetLong(msg, kPOVAttrib_ReusedCameraRays, &l);
+    if(POVMSLongToCDouble(l) > 0.5)
+        tsb->printf("Reused Camera Rays: %15.0f\n", POVMSLongToCDouble(l));
+
     (void)POVMSUtil_GetLong(msg, kPOVAttrib_ReflectedRays, &l);
     if(POVMSLongToCDouble(l) > 0.5)
     {
@@ -1709,6 +2037,44 @@ void RenderStatistics(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
     if(POVMSLongToCDouble(l) > 0.5)
         tsb->printf("Peak memory used:   %15.0f bytes\n", POVMSLongToCDouble(l));
 
+    if(POVMSObject_Get(msg, &attr, kPOVAttrib_MemoryStats) == kNoErr)
+    {
+        int cnt = 0;
+
+        if((POVMSAttrList_Count(&attr, &cnt) == kNoErr) && (cnt > 0))
+        {
+            POVMSObject obj;
+            int ii, len;
+            char str[40];
+
+            tsb->printf("Memory Use              Current (bytes)      Peak (bytes)\n");
+
+            for(ii = 1; ii <= cnt; ii++)
+            {
+                if(POVMSAttrList_GetNth(&attr, ii, &obj) == kNoErr)
+                {
+                    len = sizeof(str);
+                    str[0] = 0;
+                    l = l2 = 0;
+                    (void)POVMSUtil_GetString(&obj, kPOVAttrib_MemoryCategory, str, &len);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_MemoryCurrent, &l);
+                    (void)POVMSUtil_GetLong(&obj, kPOVAttrib_MemoryPeak, &l2);
+
+                    if(POVMSLongToCDouble(l2) > 0.5)
+                        tsb->printf("  %-18s %18.0f %17.0f\n", str, POVMSLongToCDouble(l), POVMSLongToCDouble(l2));
+
+                    (void)POVMSAttr_Delete(&obj);
+                }
+            }
+
+            l = 0;
+            (void)POVMSUtil_GetLong(msg, kPOVAttrib_AccountedMemory, &l);
+            tsb->printf("  %-18s %18s %17.0f\n", "Total", "", POVMSLongToCDouble(l));
+        }
+
+        (void)POVMSAttr_Delete(&attr);
+    }
+
     tsb->printf("----------------------------------------------------------------------------\n");
 
     POVMSObject_Delete(msg);
@@ -1804,6 +2170,22 @@ const char *GetOptionSwitchString(POVMSObjectPtr msg, POVMSType key, bool defaul
     return ".Off";
 }
 
+/// Print the hardware performance counts of a phase, if the backend could sample them.
+static void HardwareCounts(POVMS_Object& elapsedTime, TextStreamBuffer *tsb)
+{
+    if((elapsedTime.Exist(kPOVAttrib_CPUCycles) == false) || (elapsedTime.Exist(kPOVAttrib_Instructions) == false))
+        return;
+
+    double cycles = double(elapsedTime.TryGetLong(kPOVAttrib_CPUCycles, 0));
+    double instructions = double(elapsedTime.TryGetLong(kPOVAttrib_Instructions, 0));
+
+    tsb->printf("              %.3f G cycles, %.2f instructions per cycle\n", cycles * 1.0e-9, (cycles > 0.0) ? instructions / cycles : 0.0);
+    if((instructions > 0.0) && (elapsedTime.Exist(kPOVAttrib_CacheMisses) == true) && (elapsedTime.Exist(kPOVAttrib_BranchMisses) == true))
+        tsb->printf("              %.2f cache misses, %.2f branch misses per 1000 instructions\n",
+                    double(elapsedTime.TryGetLong(kPOVAttrib_CacheMisses, 0)) * 1000.0 / instructions,
+                    double(elapsedTime.TryGetLong(kPOVAttrib_BranchMisses, 0)) * 1000.0 / instructions);
+}
+
 void ParserTime(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
 {
     POV_LONG i = 0;
@@ -1831,6 +2213,7 @@ void ParserTime(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
         }
         else
             tsb->printf("              using %d thread(s)\n", int(parseTime.TryGetInt(kPOVAttrib_TimeSamples, 1)));
+        HardwareCounts(parseTime, tsb);
     }
     else
         tsb->printf("  Parse Time:       No parsing\n");
@@ -1851,6 +2234,7 @@ void ParserTime(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
         }
         else
             tsb->printf("              using %d thread(s)\n", int(boundingTime.TryGetInt(kPOVAttrib_TimeSamples, 1)));
+        HardwareCounts(boundingTime, tsb);
     }
     else
         tsb->printf("  Bounding Time:    No bounding\n");
@@ -1884,6 +2268,7 @@ void RenderTime(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
         }
         else
             tsb->printf("              using %d thread(s)\n", int(photonTime.TryGetInt(kPOVAttrib_TimeSamples, 1)));
+        HardwareCounts(photonTime, tsb);
     }
     else
         tsb->printf("  Photon Time:      No photons\n");
@@ -1904,6 +2289,7 @@ void RenderTime(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
         }
         else
             tsb->printf("              using %d thread(s)\n", int(radiosityTime.TryGetInt(kPOVAttrib_TimeSamples, 1)));
+        HardwareCounts(radiosityTime, tsb);
     }
     else
         tsb->printf("  Radiosity Time:   No radiosity\n");
@@ -1924,6 +2310,7 @@ void RenderTime(POVMS_Object& cppmsg, TextStreamBuffer *tsb)
         }
         else
             tsb->printf("              using %d thread(s)\n", int(renderTime.TryGetInt(kPOVAttrib_TimeSamples, 1)));
+        HardwareCounts(renderTime, tsb);
     }
     else
         tsb->printf("  Trace Time:       No trace\n");
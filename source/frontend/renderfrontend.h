@@ -140,6 +140,7 @@ struct ViewData
     ViewState state;
 
     mutable shared_ptr<Image> image;
+    mutable shared_ptr<ImageProcessing> imageProcessing;
     mutable shared_ptr<Display> display;
     mutable shared_ptr<OStream> imageBackup;
     GammaCurvePtr displayGamma;
@@ -251,6 +252,7 @@ class RenderFrontendBase : public POVMS_MessageReceiver
         virtual void OutputFatalError(const string&, int) = 0;
 
         void MakeBackupPath(POVMS_Object& ropts, ViewData& vd, const Path& outputpath);
+        UCS2String MakeCheckpointPath(const ViewData& vd, const char *suffix);
         void NewBackup(POVMS_Object& ropts, ViewData& vd, const Path& outputpath);
         void ContinueBackup(POVMS_Object& ropts, ViewData& vd, ViewId vid, POVMSInt& serial, vector<POVMSInt>& skip, const Path& outputpath);
 };
@@ -542,6 +544,7 @@ RenderFrontendBase::ViewId RenderFrontend<PARSER_MH, FILE_MH, RENDER_MH, IMAGE_M
                         throw POV_EXCEPTION_STRING("Invalid partial rendered image. Image size does not match!");
 
                     vh.data.image = img;
+                    vh.data.imageProcessing = imageProcessing;
                 }
                 else
                     vh.data.image = shared_ptr<Image>(Image::Create(width, height, Image::RGBFT_Float));
@@ -692,6 +695,13 @@ void RenderFrontend<PARSER_MH, FILE_MH, RENDER_MH, IMAGE_MH>::StartRender(ViewId
             }
         }
 
+        // keep the radiosity cache and photon maps alongside the render state, so that continuing doesn't have to compute them again
+        if(vhi->second.data.imageBackup != nullptr)
+        {
+            obj.SetUCS2String(kPOVAttrib_CheckpointRadiosityFile, RenderFrontendBase::MakeCheckpointPath(vhi->second.data, ".rca").c_str());
+            obj.SetUCS2String(kPOVAttrib_CheckpointPhotonFile, RenderFrontendBase::MakeCheckpointPath(vhi->second.data, ".ph").c_str());
+        }
+
         RenderFrontendBase::StartRender(vhi->second.data, vid, obj);
         HandleRenderMessage(vid, kPOVMsgIdent_RenderOptions, obj);
     }
@@ -799,6 +809,8 @@ void RenderFrontend<PARSER_MH, FILE_MH, RENDER_MH, IMAGE_MH>::HandleRenderMessag
             {
                 vhi->second.data.imageBackup.reset();
                 PlatformBase::GetInstance().DeleteLocalFile (vhi->second.data.imageBackupFile().c_str());
+                PlatformBase::GetInstance().DeleteLocalFile (RenderFrontendBase::MakeCheckpointPath(vhi->second.data, ".rca").c_str());
+                PlatformBase::GetInstance().DeleteLocalFile (RenderFrontendBase::MakeCheckpointPath(vhi->second.data, ".ph").c_str());
             }
         }
         else if(ident == kPOVMsgIdent_Failed)
@@ -165,7 +165,10 @@ void RenderMessageHandler::Progress(Console *console, POVMS_Object& obj, bool ve
                 percent = (pc * 100) / pt;
 
             sstr << Message2Console::GetProgressTime(obj, kPOVAttrib_RealTime)
-                 << "Rendering completed " << pc << " of " << pt << " pixels (" << percent << "%) and " << pp << " pixels pending    \r";
+                 << "Rendering completed " << pc << " of " << pt << " pixels (" << percent << "%) and " << pp << " pixels pending";
+            if(obj.Exist(kPOVAttrib_AccountedMemory))
+                sstr << ", " << (obj.GetLong(kPOVAttrib_AccountedMemory) >> 20) << " MB used";
+            sstr << "    \r";
             break;
         }
     }
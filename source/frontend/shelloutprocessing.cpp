@@ -159,6 +159,7 @@ ShelloutProcessing::ShelloutProcessing(POVMS_Object& opts, const string& scene,
     shellouts[postScene].reset(new ShelloutAction(this, kPOVAttrib_PostSceneCommand, opts));
     shellouts[userAbort].reset(new ShelloutAction(this, kPOVAttrib_UserAbortCommand, opts));
     shellouts[fatalError].reset(new ShelloutAction(this, kPOVAttrib_FatalErrorCommand, opts));
+    outputPipe.reset(new ShelloutAction(this, kPOVAttrib_OutputPipeCommand, opts));
 }
 
 ShelloutProcessing::~ShelloutProcessing()
@@ -647,4 +648,23 @@ bool ShelloutProcessing::ExecuteCommand(const string& cmd, const string& params)
     throw POV_EXCEPTION(kCannotOpenFileErr, "Shellouts not implemented on this platform");
 }
 
+std::FILE *ShelloutProcessing::OpenOutputPipe(void)
+{
+    if (!outputPipe->IsSet())
+        throw POV_EXCEPTION(kParamErr, "No output pipe command set");
+
+    outputPipe->ExpandParameters(sceneName, outputFile, imageWidth, imageHeight, clockVal, frameNo);
+    if (!ShelloutsSupported() || !CommandPermitted(outputPipe->Command(), outputPipe->Parameters()))
+        throw POV_EXCEPTION(kCannotOpenFileErr, str(boost::format("Execution of output pipe command '%1%' prohibited") % outputPipe->Command()));
+
+    return ExecutePipeCommand(outputPipe->Command(), outputPipe->Parameters());
+}
+
+// start the given command with its standard input connected to the returned stream.
+// the default implementation does not support piping to processes.
+std::FILE *ShelloutProcessing::ExecutePipeCommand(const string& cmd, const string& params)
+{
+    throw POV_EXCEPTION(kCannotOpenFileErr, "Output pipe commands not implemented on this platform");
+}
+
 }
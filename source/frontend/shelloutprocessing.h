@@ -39,6 +39,8 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "frontend/configfrontend.h"
 
+#include <cstdio>
+
 #include <boost/format.hpp>
 
 #include "povms/povmscpp.h"
@@ -234,6 +236,20 @@ public:
     // return true if this platform supports shellouts.
     virtual bool ShelloutsSupported(void) { return false; }
 
+    // true if an output pipe command was specified, i.e. the rendered frames are to be
+    // streamed to the standard input of that command rather than written to output files.
+    bool OutputPipeSet(void) const { return outputPipe->IsSet(); }
+
+    // start the output pipe command and return a stream connected to its standard input.
+    // the parameters are expanded as for the other shellouts, so SetOutputFile() and
+    // SetFrameClock() should be called first if %o, %n or %k are to be meaningful. throws
+    // a kCannotOpenFileErr exception if the command is prohibited or cannot be started.
+    std::FILE *OpenOutputPipe(void);
+
+    // close a stream returned by OpenOutputPipe(), wait for the command to exit, and return
+    // its exit code (or -1 if it could not be determined).
+    int CloseOutputPipe(std::FILE *pipe) { return CollectPipeCommand(pipe); }
+
 protected:
     int exitCode;
     int cancelReturn;
@@ -268,6 +284,7 @@ protected:
     boost::format cancelFormat;
     boost::format skipFormat;
     ShelloutPtr shellouts[lastShelloutEvent];
+    ShelloutPtr outputPipe;
 
     // helper method
     string GetPhaseName(shelloutEvent event);
@@ -315,6 +332,17 @@ protected:
     virtual int CollectCommand(string& output) { return -2; }
     virtual int CollectCommand(void) { return -2; }
 
+    // start the given command with the supplied (already expanded) parameters, with its
+    // standard input connected to the returned stream, and return without waiting for it.
+    // the command is independent of the shellouts above and may run alongside them. if
+    // piping to processes is not supported, or the command cannot be started, throw a
+    // kCannotOpenFile exception with an appropriate message.
+    virtual std::FILE *ExecutePipeCommand(const string& cmd, const string& params);
+
+    // close the stream returned by ExecutePipeCommand(), wait for the process to exit and
+    // return its exit code, or -1 if that is not known.
+    virtual int CollectPipeCommand(std::FILE *pipe) { return -1; }
+
     // return true if the requested shellout command is permitted. this method is
     // called just before a shellout runs. if it fails, an exception will generally
     // be thrown by the caller (the method itself should not throw an exception).
@@ -113,6 +113,7 @@ class SimpleFrontend
         shared_ptr<ShelloutProcessing> shelloutProcessing;
         boost::function<Console *()> createConsole;
         boost::function<Display *(unsigned int, unsigned int)> createDisplay;
+        bool sceneKept; // parsed scene is kept for the next frame (Reuse_Scene)
 };
 
 template<class PARSER_MH, class FILE_MH, class RENDER_MH, class IMAGE_MH>
@@ -124,7 +125,8 @@ SimpleFrontend<PARSER_MH, FILE_MH, RENDER_MH, IMAGE_MH>::SimpleFrontend(POVMSCon
     backendAddress(addr),
     state(kReady),
     createConsole(cfn),
-    createDisplay(dfn)
+    createDisplay(dfn),
+    sceneKept(false)
 {
     renderFrontend.ConnectToBackend(backendAddress, msg, result, console);
 }
@@ -146,6 +148,7 @@ bool SimpleFrontend<PARSER_MH, FILE_MH, RENDER_MH, IMAGE_MH>::Start(POVMS_Object
         return false;
 
     animationProcessing.reset();
+    sceneKept = false;
 
     POVMS_List declares;
     if(opts.Exist(kPOVAttrib_Declare) == true)
@@ -293,21 +296,26 @@ State SimpleFrontend<PARSER_MH, FILE_MH, RENDER_MH, IMAGE_MH>::Process()
                 return kFailed;
             }
 
-            try { sceneId = renderFrontend.CreateScene(backendAddress, options, createConsole); }
-            catch(pov_base::Exception&)
+            // a scene kept from the previous frame is already parsed and ready to render
+            if (!sceneKept)
             {
-                state = kFailed;
-                // TODO - output failure message
-                return kFailed;
-            }
+                try { sceneId = renderFrontend.CreateScene(backendAddress, options, createConsole); }
+                catch(pov_base::Exception&)
+                {
+                    state = kFailed;
+                    // TODO - output failure message
+                    return kFailed;
+                }
 
-            try { renderFrontend.StartParser(sceneId, options); }
-            catch(pov_base::Exception&)
-            {
-                state = kFailed;
-                // TODO - output failure message
-                return kFailed;
+                try { renderFrontend.StartParser(sceneId, options); }
+                catch(pov_base::Exception&)
+                {
+                    state = kFailed;
+                    // TODO - output failure message
+                    return kFailed;
+                }
             }
+            sceneKept = false;
 
             state = kParsing;
 
@@ -401,7 +409,12 @@ State SimpleFrontend<PARSER_MH, FILE_MH, RENDER_MH, IMAGE_MH>::Process()
                     if ((animationProcessing != nullptr) && (animationProcessing->MoreFrames() == true))
                     {
                         try { renderFrontend.CloseView(viewId); } catch(...) { } // Ignore any error here!
-                        try { renderFrontend.CloseScene(sceneId); } catch(...) { } // Ignore any error here!
+                        if (options.TryGetBool(kPOVAttrib_ReuseScene, false))
+                            sceneKept = true;
+                        else
+                        {
+                            try { renderFrontend.CloseScene(sceneId); } catch(...) { } // Ignore any error here!
+                        }
                         animationProcessing->ComputeNextFrame();
                         state = kStarting;
                         return kStarting;
@@ -104,6 +104,7 @@ FNCode::FNCode(Parser *pa, FunctionCode *f, bool is_local, const char *n)
     max_stack_size = 0;
     stack_pointer = 0;
     parameter_stack_pointer = 0;
+    cacheable = false;
 
     parser = pa;
     functionVM = parser->GetFunctionVM();
@@ -132,6 +133,7 @@ FNCode::FNCode(Parser *pa, FunctionCode *f, bool is_local, const char *n)
     function->private_copy_method = nullptr;
     function->private_destroy_method = nullptr;
     function->private_data = nullptr;
+    function->cache_id = 0;
 
     if(is_local == true)
         function->flags |= FN_LOCAL_FLAG;
@@ -220,7 +222,8 @@ void FNCode::Parameter()
 * DESCRIPTION
 *
 *   Take an expression tree and compiles it into code understood by the
-*   virtual machine.
+*   virtual machine. Code compiled for an identical function, possibly by
+*   an earlier parse, is taken from the cache of compiled functions.
 *
 *     R0        R1        R2        R3        R4        R5        R6        R7
 *   right 1   right 2     x,        y,        z,      left 1    left 2    left 3
@@ -235,6 +238,28 @@ void FNCode::Parameter()
 void FNCode::Compile(ExprNode *expression)
 {
     unsigned int gpos = 0;
+    bool optimise = false;
+    std::string key;
+    std::map<unsigned int, FUNCTION> callees;
+
+    // functions with private data (pigments, patterns, splines, transforms) are unique
+    cacheable = (POV_VM_FUNCTION_CACHE > 0) && (function->private_data == nullptr);
+#if (DEBUG_FLOATFUNCTION == 1)
+    if ((asm_input != nullptr) || (asm_output != nullptr))
+        cacheable = false;
+#endif
+    if(cacheable)
+    {
+        // the key is made up of everything the compiled code depends on
+        key.append(reinterpret_cast<const char *>(&function->return_size), sizeof(function->return_size));
+        key.append(reinterpret_cast<const char *>(&function->flags), sizeof(function->flags));
+        key.append(reinterpret_cast<const char *>(&function->parameter_cnt), sizeof(function->parameter_cnt));
+        for(unsigned int i = 0; i < function->parameter_cnt; i++)
+            key.append(function->parameter[i]).push_back('\0');
+        cacheable = cache_key(expression, key, callees);
+        if(cacheable && functionVM->LoadCachedFunction(key, *function, callees))
+            return;
+    }
 
     // allocate some program memory in advance
     max_program_size = 256;
@@ -308,19 +333,31 @@ void FNCode::Compile(ExprNode *expression)
         max_stack_size = function->parameter_cnt;
         stack_pointer = function->parameter_cnt;
 
+        // evaluate repeated function calls only once, ahead of the expression
+        compile_common_subexpressions(expression);
+
         // compile the expression
         compile_recursive(expression);
 
         // fill in "grow max_stack_size" now
         compile_instruction(gpos, OPCODE_GROW, 0, 0, max_stack_size);
+
+        optimise = true;
     }
 
     // return from function
     compile_instruction(OPCODE_RTS, 0, 0, 0);
 
+    // remove instructions whose results are never used
+    if(optimise == true)
+        optimise_program();
+
     // set optimal size of program memory
     function->program = reinterpret_cast<Instruction *>(POV_REALLOC(function->program, sizeof(Instruction) * function->program_size, "fn: program"));
 
+    if(cacheable)
+        functionVM->StoreCachedFunction(key, *function);
+
 #if (DEBUG_FLOATFUNCTION == 1)
     if (asm_output != nullptr)
     {
@@ -466,6 +503,419 @@ void FNCode::SetFlag(unsigned int flag, char *str)
 #endif
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   same_expression
+*
+* INPUT
+*
+*   a, b - expression (sub-) trees to compare
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   bool - true if both trees compute the same value
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Compares two expression trees node by node, including the nodes
+*   following them in their lists.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static bool same_expression(const ExprNode *a, const ExprNode *b)
+{
+    for (; (a != nullptr) && (b != nullptr); a = a->next, b = b->next)
+    {
+        if(a->op != b->op)
+            return false;
+
+        switch(a->op)
+        {
+            case OP_CONSTANT:
+                // bitwise, so that -0.0 and 0.0 remain distinct
+                if(memcmp(&a->number, &b->number, sizeof(DBL)) != 0)
+                    return false;
+                break;
+            case OP_VARIABLE:
+            case OP_MEMBER:
+                if(strcmp(a->variable, b->variable) != 0)
+                    return false;
+                break;
+            case OP_CALL:
+                if(a->call.token != b->call.token)
+                    return false;
+                if(((a->call.token == FUNCT_ID_TOKEN) || (a->call.token == VECTFUNCT_ID_TOKEN)) && (a->call.fn != b->call.fn))
+                    return false;
+                break;
+            case OP_TRAP:
+                if(a->trap != b->trap)
+                    return false;
+                break;
+            default:
+                break;
+        }
+
+        if(same_expression(a->child, b->child) == false)
+            return false;
+    }
+
+    return (a == b);
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   FNCode::cache_key
+*
+* INPUT
+*
+*   expr - expression tree to describe
+*
+* OUTPUT
+*
+*   key - receives the description of the expression tree
+*   callees - receives the functions called, by their cache identifiers
+*
+* RETURNS
+*
+*   bool - false if the function cannot be cached
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Describe an expression tree for looking up the function in the cache of
+*   compiled functions. Called functions are described by their own cache
+*   identifiers, so functions calling functions that are not cached, or
+*   calling themselves, cannot be cached.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+bool FNCode::cache_key(ExprNode *expr, std::string& key, std::map<unsigned int, FUNCTION>& callees)
+{
+    for(ExprNode *i = expr; i != nullptr; i = i->next)
+    {
+        key.append(reinterpret_cast<const char *>(&i->op), sizeof(i->op));
+
+        switch(i->op)
+        {
+            case OP_CONSTANT:
+                key.append(reinterpret_cast<const char *>(&i->number), sizeof(i->number));
+                break;
+            case OP_VARIABLE:
+            case OP_MEMBER:
+                key.append(i->variable).push_back('\0');
+                break;
+            case OP_CALL:
+                key.append(reinterpret_cast<const char *>(&i->call.token), sizeof(i->call.token));
+                if((i->call.token == FUNCT_ID_TOKEN) || (i->call.token == VECTFUNCT_ID_TOKEN))
+                {
+                    FunctionCode *f;
+
+                    if(strcmp(i->call.name, function->sourceInfo.name.c_str()) == 0)
+                        return false;
+
+                    f = functionVM->GetFunction(i->call.fn);
+                    if(f->cache_id == 0)
+                        return false;
+
+                    key.append(reinterpret_cast<const char *>(&f->cache_id), sizeof(f->cache_id));
+                    callees[f->cache_id] = i->call.fn;
+                }
+                break;
+            case OP_TRAP:
+                key.append(reinterpret_cast<const char *>(&i->trap), sizeof(i->trap));
+                break;
+        }
+
+        if(i->child != nullptr)
+        {
+            key.push_back('(');
+            if(cache_key(i->child, key, callees) == false)
+                return false;
+        }
+        else
+            key.push_back('.');
+    }
+
+    key.push_back(')');
+
+    return true;
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   FNCode::compile_common_subexpressions
+*
+* INPUT
+*
+*   expr - expression tree that will be compiled
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Finds function calls with identical parameters that are evaluated more
+*   than once, and compiles each of them once into a stack location at the
+*   beginning of the function. Afterwards compile_recursive loads the result
+*   instead of calling the function again. Calls inside the alternatives of
+*   a selection only share results computed anyway, and calls inside sum or
+*   product loops are left alone, as the loop variable may hide parameters.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void FNCode::compile_common_subexpressions(ExprNode *expr)
+{
+    vector<Subexpression> found;
+    vector<int> hoisted;        // hoisted group leaders in order of decision
+    vector<bool> loaded;        // candidate will be replaced by a load
+    vector<int> representative; // per group leader, the candidate to compile
+    vector<bool> done;
+    unsigned int cnt = 0;
+    unsigned int emitted = 0;
+
+    common_subexpressions.clear();
+    common_subexpression_ready.clear();
+
+    find_subexpressions(expr, false, -1, found);
+
+    // group structurally identical calls
+    for (size_t i = 0; i < found.size(); i++)
+    {
+        found[i].group = int(i);
+        for (size_t j = 0; j < i; j++)
+        {
+            if((found[j].group == int(j)) && (same_expression(found[j].node, found[i].node) == true))
+            {
+                found[i].group = int(j);
+                break;
+            }
+        }
+    }
+
+    // decide which groups to evaluate only once, outermost calls first, so
+    // calls inside calls that are loaded anyway are not counted again
+    loaded.resize(found.size(), false);
+    representative.resize(found.size(), -1);
+    for (size_t g = 0; g < found.size(); g++)
+    {
+        unsigned int uses = 0;
+        int first = -1;
+
+        if(found[g].group != int(g))
+            continue;
+
+        for (size_t i = g; i < found.size(); i++)
+        {
+            bool hidden = false;
+
+            if(found[i].group != int(g))
+                continue;
+            for (int e = found[i].enclosing; (e >= 0) && (hidden == false); e = found[e].enclosing)
+                hidden = loaded[e];
+            if(hidden == true)
+                continue;
+
+            uses++;
+            if((first < 0) && (found[i].conditional == false))
+                first = int(i);
+        }
+
+        if((uses < 2) || (first < 0))
+            continue;
+
+        for (size_t i = g; i < found.size(); i++)
+        {
+            if(found[i].group == int(g))
+            {
+                loaded[i] = (int(i) != first);
+                common_subexpressions[found[i].node] = cnt;
+            }
+        }
+        representative[g] = first;
+        hoisted.push_back(int(g));
+        cnt++;
+    }
+
+    if(cnt == 0)
+        return;
+
+    // reserve the stack locations between the parameters and the temporary variables
+    common_subexpression_ready.resize(cnt, false);
+    stack_pointer += cnt;
+    max_stack_size = (unsigned int)max((int)stack_pointer, (int)max_stack_size);
+
+    // compile each call after those it contains
+    done.resize(cnt, false);
+    while(emitted < cnt)
+    {
+        for (unsigned int h = 0; h < cnt; h++)
+        {
+            int first = representative[hoisted[h]];
+            bool waiting = false;
+
+            if(done[h] == true)
+                continue;
+
+            for (size_t i = first + 1; (i < found.size()) && (waiting == false); i++)
+            {
+                if((found[i].group == found[first].group) || (representative[found[i].group] < 0))
+                    continue;
+                for (int e = found[i].enclosing; e >= 0; e = found[e].enclosing)
+                {
+                    if(e == first)
+                    {
+                        waiting = (common_subexpression_ready[common_subexpressions[found[i].node]] == false);
+                        break;
+                    }
+                }
+            }
+            if(waiting == true)
+                continue;
+
+            compile_call(found[first].node->child, found[first].node->call.fn, found[first].node->call.token, found[first].node->call.name);
+            compile_instruction(OPCODE_STORE, 1, 0, function->parameter_cnt + h);
+            common_subexpression_ready[h] = true;
+            done[h] = true;
+            emitted++;
+        }
+    }
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   FNCode::find_subexpressions
+*
+* INPUT
+*
+*   expr - expression (sub-) tree to search
+*   conditional - whether the tree is only evaluated by one alternative of
+*                 a selection
+*   enclosing - innermost candidate containing the tree, or -1
+*
+* OUTPUT
+*
+*   found - candidates in the order they appear in the tree
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Collects the function calls that are worth evaluating only once.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void FNCode::find_subexpressions(ExprNode *expr, bool conditional, int enclosing, vector<Subexpression>& found)
+{
+    for (ExprNode *i = expr; i != nullptr; i = i->next)
+    {
+        if(i->op != OP_CALL)
+        {
+            if (i->child != nullptr)
+                find_subexpressions(i->child, conditional, enclosing, found);
+            continue;
+        }
+
+        int inner = enclosing;
+
+        switch(i->call.token)
+        {
+            case SUM_TOKEN:
+            case PROD_TOKEN:
+                continue;
+            case SELECT_TOKEN:
+                if (i->child != nullptr)
+                {
+                    find_subexpressions(i->child->child, conditional, enclosing, found);
+                    for (ExprNode *p = i->child->next; p != nullptr; p = p->next)
+                        find_subexpressions(p->child, true, enclosing, found);
+                }
+                continue;
+            case FUNCT_ID_TOKEN:
+            case SIN_TOKEN:
+            case COS_TOKEN:
+            case TAN_TOKEN:
+            case ASIN_TOKEN:
+            case ACOS_TOKEN:
+            case ATAN_TOKEN:
+            case SINH_TOKEN:
+            case COSH_TOKEN:
+            case TANH_TOKEN:
+            case ASINH_TOKEN:
+            case ACOSH_TOKEN:
+            case ATANH_TOKEN:
+            case SQRT_TOKEN:
+            case EXP_TOKEN:
+            case LN_TOKEN:
+            case LOG_TOKEN:
+            case ATAN2_TOKEN:
+            case MOD_TOKEN:
+            case DIV_TOKEN:
+            {
+                Subexpression candidate;
+
+                candidate.node = i;
+                candidate.enclosing = enclosing;
+                candidate.group = -1;
+                candidate.conditional = conditional;
+                found.push_back(candidate);
+                inner = int(found.size()) - 1;
+                break;
+            }
+            default:
+                break;
+        }
+
+        for (ExprNode *p = i->child; p != nullptr; p = p->next)
+            find_subexpressions(p->child, conditional, inner, found);
+    }
+}
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -534,6 +984,7 @@ void FNCode::compile_recursive(ExprNode *expr)
                         {
                             compile_instruction(OPCODE_LOADI, 0, 5, functionVM->AddConstant(1.0));
                             parser->Warning("Zero power optimised to constant 1.0!");
+                            cacheable = false; // so the warning is repeated whenever the function is parsed
                             continue;
                         }
                         else if(i->child->number == 2.0)
@@ -588,6 +1039,11 @@ void FNCode::compile_recursive(ExprNode *expr)
                             compile_instruction(OPCODE_MUL, 5, 5, 0);
                             continue;
                         }
+                        else if((i->child->number == floor(i->child->number)) && (fabs(i->child->number) <= 16.0))
+                        {
+                            compile_power(int(i->child->number));
+                            continue;
+                        }
                         break;
                 }
             }
@@ -611,8 +1067,14 @@ void FNCode::compile_recursive(ExprNode *expr)
                 compile_member(expr->variable);
                 break;
             case OP_CALL:
-                compile_call(i->child, i->call.fn, i->call.token, i->call.name);
+            {
+                std::map<const ExprNode *, unsigned int>::const_iterator cse = common_subexpressions.find(i);
+                if((cse != common_subexpressions.end()) && (common_subexpression_ready[cse->second] == true))
+                    compile_instruction(OPCODE_LOAD, 1, 0, function->parameter_cnt + cse->second);
+                else
+                    compile_call(i->child, i->call.fn, i->call.token, i->call.name);
                 break;
+            }
             case OP_CMP_EQ:
                 compile_instruction(OPCODE_CMP, 0, 5, 0);
                 compile_instruction(OPCODE_SEQ, 0, 5, 0);
@@ -690,6 +1152,66 @@ void FNCode::compile_recursive(ExprNode *expr)
 }
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   FNCode::compile_power
+*
+* INPUT
+*
+*   n - integer exponent
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Compiles raising r5 to an integer power by repeated squaring, and for
+*   negative exponents taking the reciprocal of the result.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void FNCode::compile_power(int n)
+{
+    unsigned int m = (unsigned int)abs(n);
+    int bit = 0;
+
+    if(m > 1)
+    {
+        // keep the base in r0
+        compile_instruction(OPCODE_MOVE, 5, 0, 0);
+
+        // find the highest bit, which the base itself accounts for
+        while((m >> (bit + 1)) != 0)
+            bit++;
+
+        for(bit--; bit >= 0; bit--)
+        {
+            compile_instruction(OPCODE_MUL, 5, 5, 0);
+            if(((m >> bit) & 1) != 0)
+                compile_instruction(OPCODE_MUL, 0, 5, 0);
+        }
+    }
+
+    if(n < 0)
+    {
+        compile_instruction(OPCODE_LOADI, 0, 0, functionVM->AddConstant(1.0));
+        compile_instruction(OPCODE_DIV, 5, 0, 0);
+        compile_instruction(OPCODE_MOVE, 0, 5, 0);
+    }
+}
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -2070,6 +2592,305 @@ unsigned int FNCode::compile_instruction(unsigned int pos, unsigned int op, unsi
 }
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   FNCode::optimise_program
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Removes instructions whose results are never used, such as registers
+*   saved around calls that are overwritten afterwards, parameters reloaded
+*   after the last call, or values stored to the stack and never loaded.
+*   Which registers and stack locations are in use at each instruction is
+*   determined taking branches into account. Code the compiler does not
+*   generate itself is left unchanged.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void FNCode::optimise_program()
+{
+    const unsigned int CCR = 1 << 8;
+    const unsigned int ALL = 0x1ff;
+    unsigned int size = function->program_size;
+    unsigned int slots = 0;
+    unsigned int removed_cnt = 0;
+    int offset = 0;
+    vector<int> sp_offset(size, 0);
+    vector<unsigned int> use(size, 0);
+    vector<unsigned int> def(size, 0);
+    vector<int> load_slot(size, -1);
+    vector<int> store_slot(size, -1);
+    vector<bool> removable(size, false);
+    vector<bool> removed(size, false);
+    vector<int> target(size, -1);
+    vector<bool> falls_through(size, true);
+    vector<bool> calls(size, false);
+
+    // decode the instructions, tracking the stack pointer offset of calls
+    for(unsigned int pc = 0; pc < size; pc++)
+    {
+        unsigned int op = GET_OP(function->program[pc]);
+        unsigned int k = GET_K(function->program[pc]);
+        unsigned int i = (op >> 6) & 15;
+        unsigned int s = (op >> 3) & 7;
+        unsigned int d = op & 7;
+
+        sp_offset[pc] = offset;
+
+        switch(i)
+        {
+            case 0: // add, sub, mul, div, mod
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+                use[pc] = (1 << s) | (1 << d);
+                def[pc] = 1 << d;
+                removable[pc] = true;
+                break;
+            case 5: // move, neg, abs
+            case 7:
+            case 8:
+                use[pc] = 1 << s;
+                def[pc] = 1 << d;
+                removable[pc] = true;
+                break;
+            case 6: // cmp
+                use[pc] = (1 << s) | (1 << d);
+                def[pc] = CCR;
+                removable[pc] = true;
+                break;
+            case 9:
+                if(s == 5) // loadi
+                    def[pc] = 1 << d;
+                else if(s == 6) // cmpi
+                {
+                    use[pc] = 1 << d;
+                    def[pc] = CCR;
+                }
+                else if(s < 5) // addi, subi, muli, divi, modi
+                {
+                    use[pc] = 1 << d;
+                    def[pc] = 1 << d;
+                }
+                else
+                    return;
+                removable[pc] = true;
+                break;
+            case 10:
+                if(s < 6) // seq, sne, slt, sle, sgt, sge
+                    use[pc] = CCR;
+                else // teq, tne
+                    use[pc] = 1 << d;
+                def[pc] = 1 << d;
+                removable[pc] = true;
+                break;
+            case 11: // load
+                if(s == 1)
+                    load_slot[pc] = offset + k;
+                else if(s != 0)
+                    return;
+                def[pc] = 1 << d;
+                removable[pc] = true;
+                break;
+            case 12: // store
+                if(s == 1)
+                {
+                    store_slot[pc] = offset + k;
+                    removable[pc] = true;
+                }
+                else if(s != 0)
+                    return;
+                use[pc] = 1 << d;
+                break;
+            case 13: // branches
+                if(s > 5)
+                    return;
+                use[pc] = CCR;
+                target[pc] = k;
+                break;
+            case 14: // exceptions
+                use[pc] = (1 << d) | ((s == 6) ? 1 : 0);
+                break;
+            case 15:
+                if(op == OPCODE_JMP)
+                {
+                    target[pc] = k;
+                    falls_through[pc] = false;
+                }
+                else if(op == OPCODE_RTS)
+                {
+                    use[pc] = 1;
+                    falls_through[pc] = false;
+                }
+                else if(op == OPCODE_CALL)
+                {
+                    // the called function uses its parameters and overwrites all registers
+                    def[pc] = ALL;
+                    calls[pc] = true;
+                }
+                else if(op == OPCODE_SYS1)
+                {
+                    use[pc] = 1;
+                    def[pc] = 1;
+                }
+                else if(op == OPCODE_SYS2)
+                {
+                    use[pc] = 3;
+                    def[pc] = 1;
+                }
+                else if(op == OPCODE_PUSH)
+                    offset += k;
+                else if(op == OPCODE_POP)
+                    offset -= k;
+                else if((op != OPCODE_GROW) && (op != OPCODE_NOP))
+                    return;
+                break;
+        }
+
+        if(offset < 0)
+            return;
+        if(load_slot[pc] >= 0)
+            slots = max(slots, (unsigned int)(load_slot[pc] + 1));
+        if(store_slot[pc] >= 0)
+            slots = max(slots, (unsigned int)(store_slot[pc] + 1));
+        slots = max(slots, (unsigned int)(offset + 1));
+    }
+
+    // branches must not cross a call sequence
+    for(unsigned int pc = 0; pc < size; pc++)
+    {
+        if(target[pc] >= 0)
+        {
+            if((target[pc] >= int(size)) || (sp_offset[pc] != 0) || (sp_offset[target[pc]] != 0))
+                return;
+        }
+    }
+
+    vector<unsigned int> live_regs(size + 1, 0);
+    vector< vector<bool> > live_slots(size + 1, vector<bool>(slots, false));
+    bool again = true;
+
+    while(again == true)
+    {
+        bool changed = true;
+
+        again = false;
+
+        // determine the registers and stack locations used after each instruction
+        while(changed == true)
+        {
+            changed = false;
+
+            for(unsigned int pc = size; pc-- > 0; )
+            {
+                unsigned int regs = 0;
+                vector<bool> mem(slots, false);
+
+                if(falls_through[pc] == true)
+                {
+                    regs |= live_regs[pc + 1];
+                    for(unsigned int j = 0; j < slots; j++)
+                        mem[j] = mem[j] || live_slots[pc + 1][j];
+                }
+                if(target[pc] >= 0)
+                {
+                    regs |= live_regs[target[pc]];
+                    for(unsigned int j = 0; j < slots; j++)
+                        mem[j] = mem[j] || live_slots[target[pc]][j];
+                }
+
+                if(removed[pc] == false)
+                {
+                    regs = (regs & ~def[pc]) | use[pc];
+                    if(store_slot[pc] >= 0)
+                        mem[store_slot[pc]] = false;
+                    if(load_slot[pc] >= 0)
+                        mem[load_slot[pc]] = true;
+                    if(calls[pc] == true)
+                    {
+                        for(unsigned int j = sp_offset[pc]; j < slots; j++)
+                            mem[j] = true;
+                    }
+                }
+
+                if((regs != live_regs[pc]) || (mem != live_slots[pc]))
+                {
+                    live_regs[pc] = regs;
+                    live_slots[pc].swap(mem);
+                    changed = true;
+                }
+            }
+        }
+
+        // remove instructions nothing depends on
+        for(unsigned int pc = 0; pc < size; pc++)
+        {
+            unsigned int regs = 0;
+            bool needed = false;
+
+            if((removed[pc] == true) || (removable[pc] == false))
+                continue;
+
+            if(falls_through[pc] == true)
+                regs |= live_regs[pc + 1];
+            if(store_slot[pc] >= 0)
+                needed = live_slots[pc + 1][store_slot[pc]];
+
+            if(((regs & def[pc]) == 0) && (needed == false))
+            {
+                removed[pc] = true;
+                removed_cnt++;
+                again = true;
+            }
+        }
+    }
+
+    if(removed_cnt == 0)
+        return;
+
+    // close the gaps and adjust the branch targets
+    vector<unsigned int> position(size + 1, 0);
+    unsigned int cnt = 0;
+
+    for(unsigned int pc = 0; pc < size; pc++)
+    {
+        position[pc] = cnt;
+        if(removed[pc] == false)
+            cnt++;
+    }
+    position[size] = cnt;
+
+    for(unsigned int pc = 0; pc < size; pc++)
+    {
+        if(removed[pc] == true)
+            continue;
+        if(target[pc] >= 0)
+            function->program[position[pc]] = MAKE_INSTRUCTION(GET_OP(function->program[pc]), position[target[pc]]);
+        else
+            function->program[position[pc]] = function->program[pc];
+    }
+
+    function->program_size = cnt;
+}
+
+
 #if (DEBUG_FLOATFUNCTION == 1)
 
 /*****************************************************************************
@@ -41,6 +41,9 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "parser/configparser.h"
 
+#include <map>
+#include <string>
+
 #include "vm/fnpovfpu.h"
 
 #include "parser/reservedwords.h"
@@ -135,6 +138,15 @@ class FNCode
 #endif
 
     private:
+        // function call that may be evaluated only once
+        struct Subexpression
+        {
+            ExprNode *node;
+            int enclosing;      // innermost candidate containing this one, or -1
+            int group;          // first structurally identical candidate
+            bool conditional;   // only evaluated in one branch of a selection
+        };
+
         FunctionCode *function;
         Parser *parser;
         intrusive_ptr<FunctionVM> functionVM;
@@ -144,6 +156,10 @@ class FNCode
         unsigned int stack_pointer;
         unsigned int parameter_stack_pointer;
         int level;
+        bool cacheable;
+
+        std::map<const ExprNode *, unsigned int> common_subexpressions; // call node to stack location
+        vector<bool> common_subexpression_ready;
 
         #if (DEBUG_FLOATFUNCTION == 1)
 
@@ -156,7 +172,11 @@ class FNCode
         FNCode();
         FNCode(FNCode&);
 
+        bool cache_key(ExprNode *expr, std::string& key, std::map<unsigned int, FUNCTION>& callees);
+        void compile_common_subexpressions(ExprNode *expr);
+        void find_subexpressions(ExprNode *expr, bool conditional, int enclosing, vector<Subexpression>& found);
         void compile_recursive(ExprNode *expr);
+        void compile_power(int n);
         void compile_member(char *name);
         void compile_call(ExprNode *expr, FUNCTION fn, int token, char *name);
         void compile_select(ExprNode *expr);
@@ -170,6 +190,7 @@ class FNCode
         void compile_pop_result(unsigned int local_k);
         unsigned int compile_instruction(unsigned int, unsigned int, unsigned int, unsigned int);
         unsigned int compile_instruction(unsigned int, unsigned int, unsigned int, unsigned int, unsigned int);
+        void optimise_program();
 
         #if (DEBUG_FLOATFUNCTION == 1)
 
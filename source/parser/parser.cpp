@@ -38,6 +38,7 @@
 
 // C++ variants of C standard header files
 #include <cctype>
+#include <climits>
 #include <cmath>
 #include <cstdarg>
 #include <cstdio>
@@ -49,9 +50,13 @@
 // Boost header files
 #include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <boost/thread/mutex.hpp>
 
 // POV-Ray header files (base module)
 #include "base/fileutil.h"
+#include "base/image/tiledimage.h"
+#include "base/jobscheduler.h"
+#include "base/platformbase.h"
 #include "base/types.h"
 
 // POV-Ray header files (core module)
@@ -70,6 +75,7 @@
 #include "core/material/texture.h"
 #include "core/math/matrix.h"
 #include "core/math/polynomialsolver.h"
+#include "core/math/randomsequence.h"
 #include "core/math/spline.h"
 #include "core/math/vector.h"
 #include "core/scene/atmosphere.h"
@@ -83,7 +89,9 @@
 #include "core/shape/csg.h"
 #include "core/shape/disc.h"
 #include "core/shape/fractal.h"
+#include "core/shape/hair.h"
 #include "core/shape/heightfield.h"
+#include "core/shape/instance.h"
 #include "core/shape/isosurface.h"
 #include "core/shape/lathe.h"
 #include "core/shape/lemon.h"
@@ -91,6 +99,7 @@
 #include "core/shape/ovus.h"
 #include "core/shape/parametric.h"
 #include "core/shape/plane.h"
+#include "core/shape/pointcloud.h"
 #include "core/shape/polynomial.h"
 #include "core/shape/polygon.h"
 #include "core/shape/prism.h"
@@ -102,6 +111,7 @@
 #include "core/shape/torus.h"
 #include "core/shape/triangle.h"
 #include "core/shape/truetype.h"
+#include "core/support/imagecache.h"
 #include "core/support/imageutil.h"
 #include "core/support/octree.h"
 
@@ -125,6 +135,32 @@ using namespace pov;
 const DBL INFINITE_VOLUME = BOUND_HUGE;
 
 
+/*****************************************************************************
+* Local functions
+******************************************************************************/
+
+/// Find a light source or instance within an object that is to be instanced.
+static ConstObjectPtr Find_Uninstanceable(ConstObjectPtr Object)
+{
+    if ((Object->Type & LIGHT_SOURCE_OBJECT) || (dynamic_cast<const Instance *>(Object) != nullptr))
+        return Object;
+
+    if (Object->Type & IS_COMPOUND_OBJECT)
+    {
+        const CompoundObject *Compound = reinterpret_cast<const CompoundObject *>(Object);
+
+        for (vector<ObjectPtr>::const_iterator Sib = Compound->children.begin(); Sib != Compound->children.end(); Sib++)
+        {
+            ConstObjectPtr Found = Find_Uninstanceable(*Sib);
+            if (Found != nullptr)
+                return Found;
+        }
+    }
+
+    return nullptr;
+}
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -156,6 +192,16 @@ Parser::Parser(shared_ptr<SceneData> sd, const Options& opts,
     mpFunctionVM(new FunctionVM),
     fnVMContext(new FPUContext(mpFunctionVM.get(), GetParserDataPtr())),
     Destroying_Frame(false),
+    mExpressionArena(kMemoryParser),
+    mExpressionTrees(0),
+    mCompiledRValuesPurgeSize(1024),
+    mCompilingRValue(false),
+    mClockDependentReads(0),
+    mSubscriptDepth(0),
+    mObjectBodyDepth(0),
+    mObjectBodyTable(0),
+    mObjectBodyImpure(false),
+    mObjectReuseDisabled(false),
     mTokenCount(0),
     mTokensSinceLastProgressReport(0),
     next_rand(nullptr)
@@ -169,6 +215,16 @@ Parser::Parser(shared_ptr<SceneData> sd, const Options& opts,
 
 Parser::~Parser()
 {
+    // discard the decodes of any images not resolved due to an error
+    for (vector<ImageData *>::iterator i = mPendingImages.begin(); i != mPendingImages.end(); ++i)
+    {
+        (*i)->pending.reset();
+        Destroy_Image(*i);
+    }
+
+    for (std::map<CompiledRValueKey, CompiledRValue>::iterator i = maCompiledRValues.begin(); i != maCompiledRValues.end(); ++i)
+        Release_Compiled_RValue(i->second);
+
     // NB: We need to keep fnVMContext around until all functions have been destroyed.
     delete fnVMContext;
 }
@@ -188,8 +244,24 @@ void Parser::Run()
         {
             Init_Random_Generators();
 
+            if (sceneData->parseProfile)
+                mpProfiler.reset(new ParseProfiler());
+
+#if POV_OBJECT_PROFILE
+            sceneData->objectProfileSources.assign(1, ObjectSourceInfo());
+#endif
+
+            if (sceneData->incrementalAnimation && (sceneData->animationRunId != 0))
+            {
+                mpPreviousObjects = ReusableObjectCache::Retrieve(sceneData->inputFile, sceneData->animationRunId);
+                mpReusableObjects.reset(new ReusableObjectCache(sceneData->inputFile, sceneData->animationRunId));
+            }
+
             Initialize_Tokenizer();
 
+            if (mpProfiler != nullptr)
+                mpProfiler->Enter(ParseProfiler::kScene, "", sceneData->inputFile.c_str(), 0);
+
             Default_Texture = Create_Texture ();
             Default_Texture->Pigment = Create_Pigment();
             Default_Texture->Tnormal = nullptr;
@@ -217,8 +289,10 @@ void Parser::Run()
                     if(i->second[0] == '\"')
                     {
                         string tmp(i->second, 1, i->second.length() - 2);
+                        UCS2 *str = String_Literal_To_UCS2(tmp);
                         Temp_Entry = mSymbolStack.GetGlobalTable()->Add_Symbol(i->first, STRING_ID_TOKEN);
-                        Temp_Entry->Data = String_Literal_To_UCS2(tmp);
+                        Temp_Entry->Data = reinterpret_cast<void *>(new AssignableString(str));
+                        POV_FREE(str);
                     }
                     else
                     {
@@ -226,6 +300,9 @@ void Parser::Run()
                         Temp_Entry->Data = Create_Float();
                         *(reinterpret_cast<DBL *>(Temp_Entry->Data)) = std::atof(i->second.c_str());
                     }
+
+                    if ((mpReusableObjects != nullptr) && (i->first == "frame_number"))
+                        maClockDependentData.insert(&(Temp_Entry->Data));
                 }
             }
 
@@ -233,6 +310,27 @@ void Parser::Run()
 
             Parse_Frame();
 
+            // wait for any mesh bounding trees still being built
+            mMeshTreeBuilder.Wait();
+
+            // wait for any input images still being decoded
+            Resolve_Images();
+
+            Tighten_BBoxes();
+            Share_Materials();
+
+            if (mpReusableObjects != nullptr)
+            {
+                mpPreviousObjects.reset();
+                ReusableObjectCache::Retain(std::move(mpReusableObjects));
+            }
+
+            if (mpProfiler != nullptr)
+            {
+                mpProfiler->Report(Debug_Message_Buffer);
+                mpProfiler.reset();
+            }
+
             // post process atmospheric media
             for (vector<Media>::iterator i(sceneData->atmosphere.begin()); i != sceneData->atmosphere.end(); i++)
                 i->PostProcess();
@@ -803,6 +901,7 @@ ObjectPtr Parser::Parse_Bicubic_Patch ()
 {
     BicubicPatch *Object;
     int i, j;
+    bool legacyType = false;
 
     Parse_Begin ();
 
@@ -818,6 +917,7 @@ ObjectPtr Parser::Parse_Bicubic_Patch ()
         CASE_FLOAT_UNGET
             VersionWarning(150, "Should use keywords for bicubic parameters.");
             Object->Patch_Type = (int)Parse_Float();
+            legacyType = true;
             if (Object->Patch_Type == 2 ||
                 Object->Patch_Type == 3)
             {
@@ -868,12 +968,19 @@ ObjectPtr Parser::Parse_Bicubic_Patch ()
         END_CASE
     END_EXPECT
 
-    if (Object->Patch_Type > 1)
+    // Legacy types 2 and 3 predate the adaptive type 2.
+    if ((Object->Patch_Type > 2) || (legacyType && (Object->Patch_Type > 1)))
     {
         Object->Patch_Type = 1;
         Warning("Patch type no longer supported. Using type 1.");
     }
 
+    // The flatness of an adaptive patch is in pixels.
+    if ((Object->Patch_Type == 2) && (Object->Flatness_Value <= 0.0))
+    {
+        Object->Flatness_Value = 1.0;
+    }
+
     if (Object->Patch_Type < 0)
     {
         Error("Undefined bicubic patch type.");
@@ -1095,6 +1202,7 @@ ObjectPtr Parser::Parse_Blob()
     /* Finally, process the information */
 
     int components = Object->Make_Blob(threshold, blob_components, npoints, GetParserDataPtr());
+    NoteSideEffect(); // scene-wide limits must account for this object
     if (components > sceneData->Max_Blob_Components)
         sceneData->Max_Blob_Components = components;
 
@@ -2245,6 +2353,10 @@ bool Parser::Parse_Camera_Mods(Camera& New)
                 Error("Focal blur samples minimum must not be larger than maximum.");
         END_CASE
 
+        CASE (ADAPTIVE_TOKEN)
+            New.Blur_Adaptive = (Allow_Float(1.0) > 0.0);
+        END_CASE
+
         CASE (CONFIDENCE_TOKEN)
             k1 = Parse_Float();
             if ((k1 > 0.0) && (k1 < 1.0))
@@ -2338,7 +2450,11 @@ ObjectPtr Parser::Parse_CSG(int CSG_Type)
     else
         Object = new CSGIntersection((CSG_Type & CSG_DIFFERENCE_TYPE) != 0);
 
-    while ((Local = Parse_Object()) != nullptr)
+    // difference must invert its children right away
+    bool instances = !(CSG_Type & CSG_DIFFERENCE_TYPE);
+    vector<InstanceTransformer::Operation> operations;
+
+    while ((Local = (instances ? Parse_Object_Instance(operations) : Parse_Object())) != nullptr)
     {
         if((CSG_Type & CSG_INTERSECTION_TYPE) && (Local->Type & PATCH_OBJECT))
             Warning("Patch objects not allowed in intersection.");
@@ -2352,6 +2468,8 @@ ObjectPtr Parser::Parse_CSG(int CSG_Type)
             Light_Source_Union = false;
         Local->Type |= IS_CHILD_OBJECT;
         Link(Local, Object->children);
+        if (!operations.empty())
+            mInstanceTransformer.Submit(Local, operations);
     }
 
     if(Light_Source_Union)
@@ -2360,6 +2478,9 @@ ObjectPtr Parser::Parse_CSG(int CSG_Type)
     if(Object_Count < 2)
         VersionWarning(150, "Should have at least 2 objects in csg.");
 
+    if (!mInstanceTransformer.Wait())
+        PossibleError("Inconsistent object parameters.");
+
     Object->Compute_BBox();
 
     // if the invert flag is in the object mods, the returned pointer will be
@@ -2549,6 +2670,153 @@ ObjectPtr Parser::Parse_Disc ()
 
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parse_Hair
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   OBJECT
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Read a hair object. The strands are either given inline, each as a
+*   number of points followed by that many pairs of position and radius,
+*   or loaded from a binary hair file, which is mapped into memory just
+*   long enough to copy them out and build their hierarchy.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+ObjectPtr Parser::Parse_Hair()
+{
+    Hair *Object;
+    int Spline_Type = B_SPLINE_HAIR;
+    char *Name;
+    UCS2String fileName;
+    vector<unsigned int> Strands;
+    vector<float> Points;
+    Vector3d Position;
+    DBL Radius;
+    int i, n;
+
+    Parse_Begin();
+
+    Object = reinterpret_cast<Hair *>(Parse_Object_Id());
+    if (Object != nullptr)
+        return (reinterpret_cast<ObjectPtr>(Object));
+
+    Object = new Hair();
+
+    EXPECT_ONE
+        CASE(B_SPLINE_TOKEN)
+            Spline_Type = B_SPLINE_HAIR;
+        END_CASE
+        CASE(CUBIC_SPLINE_TOKEN)
+            Spline_Type = CATMULL_ROM_SPLINE_HAIR;
+        END_CASE
+        CASE(LINEAR_SPLINE_TOKEN)
+            Spline_Type = LINEAR_SPLINE_HAIR;
+        END_CASE
+        OTHERWISE
+            UNGET
+        END_CASE
+    END_EXPECT
+
+    EXPECT
+        CASE(LOAD_FILE_TOKEN)
+            if (!Strands.empty())
+                Error("Hair cannot have both strands and load_file.");
+
+            Name = Parse_C_String(true);
+
+            if (Locate_File(ASCIItoUCS2String(Name), POV_File_Data_Hair, fileName, true) == nullptr)
+            {
+                POV_FREE(Name);
+                Error("Cannot open binary hair file.");
+            }
+            POV_FREE(Name);
+
+            {
+                MappedFile file;
+
+                if (!file.Open(UCS2toASCIIString(fileName).c_str()))
+                    Error("Cannot map binary hair file '%s'.", UCS2toASCIIString(fileName).c_str());
+
+                if (!Object->Load_File(Spline_Type, &file))
+                    Error("'%s' is not a valid binary hair file for this platform and spline type.", UCS2toASCIIString(fileName).c_str());
+            }
+            EXIT
+        END_CASE
+
+        CASE(STRAND_TOKEN)
+            Parse_Begin();
+
+            n = (int)Parse_Float();
+            if (n < (int)Hair::Min_Points(Spline_Type))
+                Error("Hair strand needs at least %d points for this spline type.", (int)Hair::Min_Points(Spline_Type));
+
+            Parse_Comma();
+
+            for (i = 0; i < n; i++)
+            {
+                Parse_Vector(Position);
+                Parse_Comma();
+                Radius = Parse_Float();
+                if (Radius < 0.0)
+                    Error("Hair strand radius cannot be negative.");
+
+                Points.push_back(float(Position[X]));
+                Points.push_back(float(Position[Y]));
+                Points.push_back(float(Position[Z]));
+                Points.push_back(float(Radius));
+
+                // NB we allow for a trailing comma at the end of the list,
+                // to facilitate auto-generation of lists.
+                Parse_Comma();
+            }
+
+            Strands.push_back((unsigned int)n);
+
+            Parse_End();
+        END_CASE
+
+        OTHERWISE
+            UNGET
+            EXIT
+        END_CASE
+    END_EXPECT
+
+    if (Object->Data == nullptr)
+    {
+        if (Strands.empty())
+            Error("Hair needs at least one strand.");
+
+        Object->Compute(Spline_Type, Strands.data(), (unsigned int)Strands.size(), Points.data(), (unsigned int)(Points.size() / 4));
+    }
+
+    Object->Compute_BBox();
+
+    Parse_Object_Mods(reinterpret_cast<ObjectPtr>(Object));
+
+    return (reinterpret_cast<ObjectPtr>(Object));
+}
+
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -2572,7 +2840,12 @@ ObjectPtr Parser::Parse_HField ()
     Vector3d Local_Vector;
     DBL Temp_Water_Level;
     HField *Object;
-    ImageData *image;
+    ImageData *image = nullptr;
+    shared_ptr<MappedFile> file;
+    int width, height;
+    char *Name;
+    UCS2String fileName;
+    size_t samples;
 
     Parse_Begin ();
 
@@ -2582,11 +2855,60 @@ ObjectPtr Parser::Parse_HField ()
 
     Object = new HField();
 
-    image = Parse_Image (HF_FILE);
-    image->Use = USE_NONE;
+    EXPECT_ONE
+        CASE (RAW_TOKEN)
+            Name = Parse_C_String(true);
+
+            width = height = 0;
+
+            EXPECT_ONE
+                CASE (COMMA_TOKEN)
+                    width = Parse_Int_With_Range(2, INT_MAX, "raw height field width");
+                    Parse_Comma();
+                    height = Parse_Int_With_Range(2, INT_MAX, "raw height field height");
+                END_CASE
+
+                OTHERWISE
+                    UNGET
+                END_CASE
+            END_EXPECT
+
+            if (Locate_File(ASCIItoUCS2String(Name), POV_File_Data_RAW, fileName, true) == nullptr)
+            {
+                POV_FREE(Name);
+                Error("Cannot open raw height field file.");
+            }
+            POV_FREE(Name);
+
+            file = shared_ptr<MappedFile>(new MappedFile());
+            if (!file->Open(UCS2toASCIIString(fileName).c_str()))
+                Error("Cannot map raw height field file '%s'.", UCS2toASCIIString(fileName).c_str());
+
+            samples = file->GetSize() / sizeof(HF_VAL);
+
+            if (width == 0)
+            {
+                // without an explicit size the height field must be square
+                width = height = int(sqrt(DBL(samples)) + 0.5);
+                if ((width < 2) || (size_t(width) * size_t(width) != samples))
+                    Error("Raw height field file '%s' is not square; specify its width and height.", UCS2toASCIIString(fileName).c_str());
+            }
+            else if (size_t(width) * size_t(height) > samples)
+                Error("Raw height field file '%s' is too small for %d x %d heights.", UCS2toASCIIString(fileName).c_str(), width, height);
+        END_CASE
+
+        OTHERWISE
+            UNGET
+            image = Parse_Image (HF_FILE);
+            image->Use = USE_NONE;
+
+            width = image->width;
+            height = image->height;
+        END_CASE
+    END_EXPECT
 
     Object->bounding_corner1 = Vector3d(0.0, 0.0, 0.0);
-    Object->bounding_corner2 = Vector3d(image->width - 1.0, 65536.0, image->height - 1.0);
+    Object->bounding_corner2 = Vector3d(width - 1.0, 65536.0, height - 1.0);
 
     Local_Vector = Vector3d(1.0) / Object->bounding_corner2;
 
@@ -2612,12 +2934,19 @@ ObjectPtr Parser::Parse_HField ()
 
     Parse_Object_Mods(reinterpret_cast<ObjectPtr>(Object));
 
-    Object->Compute_HField(image);
+    if (file)
+    {
+        Object->Map_HField(file, width, height);
+    }
+    else
+    {
+        Object->Compute_HField(image);
+
+        Destroy_Image(image);
+    }
 
     Object->Compute_BBox();
 
-    Destroy_Image(image);
-
     return (reinterpret_cast<ObjectPtr>(Object));
 }
 
@@ -2644,6 +2973,8 @@ ObjectPtr Parser::Parse_HField ()
 ObjectPtr Parser::Parse_Isosurface()
 {
     IsoSurface *Object;
+    int meshResolution = 0;
+    ParseProfiler::Scope profile(mpProfiler.get(), ParseProfiler::kObject, "isosurface", CurrentFileName(), CurrentFilePosition().line);
 
     Parse_Begin();
 
@@ -2701,6 +3032,10 @@ ObjectPtr Parser::Parse_Isosurface()
             Object->positivePolarity = (Parse_Float() > 0);
         END_CASE
 
+        CASE (SECONDARY_MESH_TOKEN)
+            meshResolution = Parse_Int_With_Range (1, 1024, "isosurface secondary_mesh");
+        END_CASE
+
         OTHERWISE
             UNGET
             EXIT
@@ -2720,6 +3055,9 @@ ObjectPtr Parser::Parse_Isosurface()
 
     Parse_Object_Mods (reinterpret_cast<ObjectPtr>(Object));
 
+    if ((meshResolution > 0) && !Object->Build_Secondary_Mesh(meshResolution, GetParserDataPtr()))
+        Warning("Isosurface 'secondary_mesh' found no surface; exact intersections are used for all rays.");
+
     return (reinterpret_cast<ObjectPtr>(Object));
 }
 
@@ -2978,6 +3316,7 @@ ObjectPtr Parser::Parse_Julia_Fractal ()
     Parse_Object_Mods(reinterpret_cast<ObjectPtr>(Object));
 
     int num_iterations = Object->SetUp_Fractal();
+    NoteSideEffect(); // scene-wide limits must account for this object
     if (num_iterations > sceneData->Fractal_Iteration_Stack_Length)
     {
         sceneData->Fractal_Iteration_Stack_Length = num_iterations;
@@ -3189,18 +3528,83 @@ ObjectPtr Parser::Parse_Lathe()
 
     POV_FREE(Points);
 
+    NoteSideEffect(); // scene-wide limits must account for this object
     if (Object->Spline->BCyl->number > sceneData->Max_Bounding_Cylinders)
     {
         TraceThreadData *td = GetParserDataPtr();
         sceneData->Max_Bounding_Cylinders = Object->Spline->BCyl->number;
         td->BCyl_Intervals.reserve(4*sceneData->Max_Bounding_Cylinders);
-        td->BCyl_RInt.reserve(2*sceneData->Max_Bounding_Cylinders);
-        td->BCyl_HInt.reserve(2*sceneData->Max_Bounding_Cylinders);
     }
 
     return (reinterpret_cast<ObjectPtr>(Object));
 }
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parse_Instance
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   Instance object
+*
+* DESCRIPTION
+*
+*   Parse an instance of an object. The object is post-processed right away
+*   and then shared by all copies of the instance; copying an instance
+*   identifier therefore only copies its transformation and texture.
+*
+* CHANGES
+*
+******************************************************************************/
+
+ObjectPtr Parser::Parse_Instance()
+{
+    ObjectPtr Prototype;
+    ConstObjectPtr Offender;
+    ObjectPtr ptr;
+    bool Untextured;
+
+    Parse_Begin();
+
+    Prototype = Parse_Object();
+    if (Prototype == nullptr)
+        Expectation_Error("object");
+
+    if (dynamic_cast<Instance *>(Prototype) != nullptr)
+    {
+        // Instancing an instance is just another copy of it.
+        ptr = Prototype;
+    }
+    else
+    {
+        Offender = Find_Uninstanceable(Prototype);
+        if (Offender != nullptr)
+        {
+            if (Offender->Type & LIGHT_SOURCE_OBJECT)
+                Error("Light sources cannot be instanced.");
+            else
+                Error("Instances cannot be nested inside the object of another instance.");
+        }
+
+        // Post-processing gives untextured objects a copy of the default texture; the instance
+        // uses its own texture for those parts instead, so it needs to know which texture that is.
+        Untextured = (Prototype->Texture == nullptr);
+        Post_Process(Prototype, nullptr);
+
+        ptr = new Instance(Prototype, Untextured ? Prototype->Texture : nullptr);
+    }
+
+    Parse_Object_Mods(ptr);
+
+    return (ptr);
+}
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -3712,6 +4116,16 @@ ObjectPtr Parser::Parse_Light_Source ()
             Object->Adaptive_Level = (int)Parse_Float();
         END_CASE
 
+        CASE (AREA_SAMPLING_TOKEN)
+            Object->Area_Sampling = (int)Parse_Float();
+            if ((Object->Area_Sampling != AREA_SAMPLING_CLASSIC) && (Object->Area_Sampling != AREA_SAMPLING_STRATIFIED))
+                Error("area_sampling must be 1 or 2.");
+            if (!(Object->Area_Light))
+            {
+                Warning("Area_sampling only affects area_light");
+            }
+        END_CASE
+
         CASE (MEDIA_ATTENUATION_TOKEN)
             Object->Media_Attenuation = Allow_Float(1.0) > 0.0;
         END_CASE
@@ -3782,6 +4196,9 @@ ObjectPtr Parser::Parse_Light_Source ()
         }
     }
 
+    if (Object->Area_Light && Object->Jitter && (Object->Area_Sampling == AREA_SAMPLING_STRATIFIED))
+        Object->Compute_Jitter_Patterns();
+
     return (reinterpret_cast<ObjectPtr>(Object));
 }
 
@@ -3818,6 +4235,8 @@ ObjectPtr Parser::Parse_Light_Source ()
 ObjectPtr Parser::Parse_Mesh()
 {
     Mesh *Object;
+    UCS2String saveName;
+    ParseProfiler::Scope profile(mpProfiler.get(), ParseProfiler::kObject, "mesh", CurrentFileName(), CurrentFilePosition().line);
 
     Parse_Begin();
 
@@ -3858,6 +4277,8 @@ ObjectPtr Parser::Parse_Mesh()
 
 #endif
 
+    saveName = Parse_Mesh_Save_File();
+
     // Create bounding box.
 
     Object->Compute_BBox();
@@ -3866,9 +4287,16 @@ ObjectPtr Parser::Parse_Mesh()
 
     Parse_Object_Mods (reinterpret_cast<ObjectPtr>(Object));
 
-    // Create bounding box tree.
+    // Create bounding box tree; saved meshes need it right away.
+
+    if (!saveName.empty())
+    {
+        Object->Build_Mesh_BBox_Tree();
 
-    Object->Build_Mesh_BBox_Tree();
+        Save_Mesh_File (Object, saveName);
+    }
+    else
+        mMeshTreeBuilder.Build (Object);
 
     return Object;
 }
@@ -3891,6 +4319,7 @@ void Parser::Parse_Mesh1 (Mesh* Object)
     Vector3d Inside_Vect;
     TEXTURE *t2, *t3;
     bool foundZeroNormal=false;
+    bool compact=false;
 
     Inside_Vect = Vector3d(0.0, 0.0, 0.0);
 
@@ -4129,6 +4558,10 @@ void Parser::Parse_Mesh1 (Mesh* Object)
         END_CASE
         /* NK ---- */
 
+        CASE(COMPACT_TOKEN)
+            compact = true;
+        END_CASE
+
         OTHERWISE
             UNGET
             EXIT
@@ -4154,6 +4587,13 @@ void Parser::Parse_Mesh1 (Mesh* Object)
     Object->Data->References = 1;
 
     Object->Data->Tree = nullptr;
+    Object->Data->Packs = nullptr;
+    Object->Data->Pack_Geometry = nullptr;
+    Object->Data->Number_Of_Packs = 0;
+    Object->Data->QVertices = nullptr;
+    Object->Data->QNormals = nullptr;
+    Object->Data->File = nullptr;
+    Object->Data->Accounted_Size = 0;
     /* NK 1998 */
 
     if( (fabs(Inside_Vect[X]) < EPSILON) &&  (fabs(Inside_Vect[Y]) < EPSILON) &&  (fabs(Inside_Vect[Z]) < EPSILON))
@@ -4251,6 +4691,9 @@ void Parser::Parse_Mesh1 (Mesh* Object)
     POV_FREE(Triangles);
     POV_FREE(Vertices);
 
+    if (compact)
+        Object->Compact_Mesh();
+
 /*
     Render_Info("Mesh: %ld bytes: %ld vertices, %ld normals, %ld textures, %ld triangles, %ld uv-coords\n",
         Object->Data->Number_Of_Normals*sizeof(MeshVector)+
@@ -4297,6 +4740,8 @@ void Parser::Parse_Mesh1 (Mesh* Object)
 ObjectPtr Parser::Parse_Mesh2()
 {
     Mesh *Object;
+    UCS2String saveName;
+    ParseProfiler::Scope profile(mpProfiler.get(), ParseProfiler::kObject, "mesh2", CurrentFileName(), CurrentFilePosition().line);
 
     Parse_Begin();
 
@@ -4310,6 +4755,8 @@ ObjectPtr Parser::Parse_Mesh2()
 
     Parse_Mesh2 (Object);
 
+    saveName = Parse_Mesh_Save_File();
+
     // Create bounding box.
 
     Object->Compute_BBox();
@@ -4318,9 +4765,16 @@ ObjectPtr Parser::Parse_Mesh2()
 
     Parse_Object_Mods (reinterpret_cast<ObjectPtr>(Object));
 
-    // Create bounding box tree.
+    // Create bounding box tree; saved meshes need it right away.
+
+    if (!saveName.empty())
+    {
+        Object->Build_Mesh_BBox_Tree();
 
-    Object->Build_Mesh_BBox_Tree();
+        Save_Mesh_File (Object, saveName);
+    }
+    else
+        mMeshTreeBuilder.Build (Object);
 
     return Object;
 }
@@ -4336,6 +4790,7 @@ void Parser::Parse_Mesh2 (Mesh* Object)
     bool found_uv_indices = false;
     bool fully_textured = true;
     bool foundZeroNormal = false;
+    bool compact = false;
 
     DBL l1, l2;
     Vector3d D1, D2, P1, P2, P3, N1, N;
@@ -4350,6 +4805,18 @@ void Parser::Parse_Mesh2 (Mesh* Object)
 
     Inside_Vect = Vector3d(0.0, 0.0, 0.0);
 
+    /* A binary mesh file replaces all of the mesh data. */
+    EXPECT_ONE
+        CASE(LOAD_FILE_TOKEN)
+            Parse_Mesh_File(Object);
+            return;
+        END_CASE
+
+        OTHERWISE
+            UNGET
+        END_CASE
+    END_EXPECT
+
     /* normals, uvcoords, and textures are optional */
     number_of_vertices = 0;
     number_of_uvcoords = 0;
@@ -4702,6 +5169,10 @@ void Parser::Parse_Mesh2 (Mesh* Object)
             Parse_Vector(Inside_Vect);
         END_CASE
 
+        CASE(COMPACT_TOKEN)
+            compact = true;
+        END_CASE
+
         OTHERWISE
             UNGET
             EXIT
@@ -4828,6 +5299,13 @@ void Parser::Parse_Mesh2 (Mesh* Object)
     Object->Data = reinterpret_cast<MESH_DATA *>(POV_MALLOC(sizeof(MESH_DATA), "triangle mesh data"));
     Object->Data->References = 1;
     Object->Data->Tree = nullptr;
+    Object->Data->Packs = nullptr;
+    Object->Data->Pack_Geometry = nullptr;
+    Object->Data->Number_Of_Packs = 0;
+    Object->Data->QVertices = nullptr;
+    Object->Data->QNormals = nullptr;
+    Object->Data->File = nullptr;
+    Object->Data->Accounted_Size = 0;
     /* NK 1998 */
     /*YS* 31/12/1999 */
 
@@ -4864,6 +5342,9 @@ void Parser::Parse_Mesh2 (Mesh* Object)
         Set_Flag(Object, MULTITEXTURE_FLAG);
     }
 
+    if (compact)
+        Object->Compact_Mesh();
+
 /*
     Render_Info("Mesh2: %ld bytes: %ld vertices, %ld normals, %ld textures, %ld triangles, %ld uv-coords\n",
         Object->Data->Number_Of_Normals*sizeof(MeshVector)+
@@ -4884,23 +5365,245 @@ void Parser::Parse_Mesh2 (Mesh* Object)
 *
 * FUNCTION
 *
-*   Parse_Mesh_Texture
+*   Parse_Mesh_File
 *
 * INPUT
 *
+*   Object - Mesh to set up
+*
 * OUTPUT
 *
 * RETURNS
 *
-*   OBJECT
-*
 * AUTHOR
 *
-*   Dieter Bayer
+*   POV-Ray Team
 *
 * DESCRIPTION
 *
-*   Read an individual triangle mesh texture.
+*   Read the body of a mesh2 that is loaded from a binary mesh file. The
+*   file is mapped into memory and used in place, so that neither the
+*   tokenizer nor the vertex hash tables are involved. As textures cannot
+*   be stored in the file, they must be given in a texture_list, in the
+*   order in which they were numbered when the file was saved.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void Parser::Parse_Mesh_File (Mesh* Object)
+{
+    int i;
+    int number_of_textures = -1;
+    MeshIndex file_textures;
+    char *Name;
+    UCS2String fileName;
+    MappedFile *file;
+    TEXTURE **Textures = nullptr;
+    Vector3d Inside_Vect;
+
+    Name = Parse_C_String(true);
+
+    if (Locate_File(ASCIItoUCS2String(Name), POV_File_Data_Mesh, fileName, true) == nullptr)
+    {
+        POV_FREE(Name);
+        Error("Cannot open binary mesh file.");
+    }
+    POV_FREE(Name);
+
+    file = new MappedFile();
+    if (!file->Open(UCS2toASCIIString(fileName).c_str()))
+    {
+        delete file;
+        Error("Cannot map binary mesh file '%s'.", UCS2toASCIIString(fileName).c_str());
+    }
+
+    if (!Object->Map_Mesh_File(file, file_textures))
+    {
+        delete file;
+        Error("'%s' is not a binary mesh file written by this version of POV-Ray on this platform.", UCS2toASCIIString(fileName).c_str());
+    }
+
+    EXPECT
+        CASE(TEXTURE_LIST_TOKEN)
+            if (number_of_textures >= 0)
+                Error("Duplicate texture_list block.");
+
+            Parse_Begin();
+
+            number_of_textures = (int)Parse_Float();  Parse_Comma();
+
+            if (number_of_textures>0)
+            {
+                Textures = reinterpret_cast<TEXTURE **>(POV_MALLOC(number_of_textures*sizeof(TEXTURE *), "triangle mesh data"));
+
+                for(i=0; i<number_of_textures; i++)
+                {
+                    GET(TEXTURE_TOKEN);
+                    Parse_Begin();
+                    Textures[i] = Parse_Texture();
+                    Post_Textures(Textures[i]);
+                    Parse_End();
+                    Parse_Comma();
+                }
+            }
+
+            Parse_End();
+        END_CASE
+
+        CASE(INSIDE_VECTOR_TOKEN)
+            Parse_Vector(Inside_Vect);
+
+            if (Inside_Vect.IsNearNull(EPSILON))
+            {
+                Object->has_inside_vector=false;
+                Object->Type |= PATCH_OBJECT;
+            }
+            else
+            {
+                Object->Data->Inside_Vect = Inside_Vect.normalized();
+                Object->has_inside_vector=true;
+                Object->Type &= ~PATCH_OBJECT;
+            }
+        END_CASE
+
+        OTHERWISE
+            UNGET
+            EXIT
+        END_CASE
+    END_EXPECT
+
+    if (number_of_textures < 0)
+        number_of_textures = 0;
+
+    if (number_of_textures != file_textures)
+        Error("Binary mesh file '%s' requires a texture_list of %d textures.", UCS2toASCIIString(fileName).c_str(), (int)file_textures);
+
+    Object->Textures = Textures;
+    Object->Number_Of_Textures = number_of_textures;
+
+    if (number_of_textures)
+    {
+        Set_Flag(Object, MULTITEXTURE_FLAG);
+    }
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parse_Mesh_Save_File
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   UCS2String - Name of the binary mesh file to save the mesh to, if any
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Read the optional save_file keyword that follows the data of a mesh or
+*   mesh2. This is how existing scenes are converted to binary mesh files.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+UCS2String Parser::Parse_Mesh_Save_File ()
+{
+    char *Name;
+    UCS2String fileName;
+
+    EXPECT_ONE
+        CASE(SAVE_FILE_TOKEN)
+            Name = Parse_C_String(true);
+            fileName = ASCIItoUCS2String(Name);
+            POV_FREE(Name);
+        END_CASE
+
+        OTHERWISE
+            UNGET
+        END_CASE
+    END_EXPECT
+
+    return fileName;
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Save_Mesh_File
+*
+* INPUT
+*
+*   Object   - Mesh to save
+*   fileName - Name of the binary mesh file
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Write a fully set up mesh, including its bounding box tree, to a
+*   binary mesh file.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void Parser::Save_Mesh_File (const Mesh* Object, const UCS2String& fileName)
+{
+    if (Object->Data->QVertices != nullptr)
+        Error("Compact meshes cannot be saved to a binary mesh file.");
+
+    std::unique_ptr<OStream> file(CreateFile(fileName, POV_File_Data_Mesh, false));
+
+    if (file == nullptr)
+        Error("Cannot open binary mesh file %s (write).", UCS2toASCIIString(fileName).c_str());
+
+    if (!Object->Write_Mesh_File(*file))
+        Error("Cannot write binary mesh file %s.", UCS2toASCIIString(fileName).c_str());
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parse_Mesh_Texture
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   OBJECT
+*
+* AUTHOR
+*
+*   Dieter Bayer
+*
+* DESCRIPTION
+*
+*   Read an individual triangle mesh texture.
 *
 * CHANGES
 *
@@ -4956,6 +5659,136 @@ TEXTURE *Parser::Parse_Mesh_Texture (TEXTURE **t2, TEXTURE **t3)
 }
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parse_Point_Cloud
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   OBJECT
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Read a point cloud. The particles are loaded from a binary particle
+*   file, which is mapped into memory just long enough to copy them out and
+*   build their hierarchy. Per-particle texture indices refer to the
+*   textures of a texture_list, as in a mesh2.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+ObjectPtr Parser::Parse_Point_Cloud()
+{
+    PointCloud *Object;
+    int i;
+    int number_of_textures = -1;
+    int file_textures;
+    char *Name;
+    UCS2String fileName;
+    TEXTURE **Textures = nullptr;
+
+    Parse_Begin();
+
+    Object = reinterpret_cast<PointCloud *>(Parse_Object_Id());
+    if (Object != nullptr)
+    {
+        return(reinterpret_cast<ObjectPtr>(Object));
+    }
+
+    Object = new PointCloud();
+
+    GET(LOAD_FILE_TOKEN);
+
+    Name = Parse_C_String(true);
+
+    if (Locate_File(ASCIItoUCS2String(Name), POV_File_Data_Particles, fileName, true) == nullptr)
+    {
+        POV_FREE(Name);
+        Error("Cannot open binary particle file.");
+    }
+    POV_FREE(Name);
+
+    {
+        MappedFile file;
+
+        if (!file.Open(UCS2toASCIIString(fileName).c_str()))
+            Error("Cannot map binary particle file '%s'.", UCS2toASCIIString(fileName).c_str());
+
+        if (!Object->Load_File(&file, file_textures))
+            Error("'%s' is not a valid binary particle file for this platform.", UCS2toASCIIString(fileName).c_str());
+    }
+
+    EXPECT
+        CASE(TEXTURE_LIST_TOKEN)
+            if (number_of_textures >= 0)
+                Error("Duplicate texture_list block.");
+
+            Parse_Begin();
+
+            number_of_textures = (int)Parse_Float();  Parse_Comma();
+
+            if (number_of_textures>0)
+            {
+                Textures = reinterpret_cast<TEXTURE **>(POV_MALLOC(number_of_textures*sizeof(TEXTURE *), "point cloud data"));
+
+                for(i=0; i<number_of_textures; i++)
+                {
+                    GET(TEXTURE_TOKEN);
+                    Parse_Begin();
+                    Textures[i] = Parse_Texture();
+                    Post_Textures(Textures[i]);
+                    Parse_End();
+                    Parse_Comma();
+                }
+            }
+
+            Parse_End();
+        END_CASE
+
+        OTHERWISE
+            UNGET
+            EXIT
+        END_CASE
+    END_EXPECT
+
+    if (number_of_textures < 0)
+        number_of_textures = 0;
+
+    if (number_of_textures < file_textures)
+        Error("Binary particle file '%s' requires a texture_list of at least %d textures.", UCS2toASCIIString(fileName).c_str(), file_textures);
+
+    if ((number_of_textures > 0) && (file_textures == 0))
+        Warning("Binary particle file '%s' has no texture indices; ignoring texture_list.", UCS2toASCIIString(fileName).c_str());
+
+    Object->Textures = Textures;
+    Object->Number_Of_Textures = number_of_textures;
+
+    if (file_textures > 0)
+    {
+        Set_Flag(Object, MULTITEXTURE_FLAG);
+    }
+
+    Object->Compute_BBox();
+
+    Parse_Object_Mods(reinterpret_cast<ObjectPtr>(Object));
+
+    return(reinterpret_cast<ObjectPtr>(Object));
+}
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -5144,6 +5977,7 @@ ObjectPtr Parser::Parse_Parametric(void)
     DBL         temp;
     char        PrecompFlag = 0;
     int         PrecompDepth = 1;
+    int         meshResolution = 0;
     Vector2d    tempUV;
 
     Parse_Begin();
@@ -5245,6 +6079,10 @@ ObjectPtr Parser::Parse_Parametric(void)
             ParseContainedBy(Object->container, Object);
         END_CASE
 
+        CASE(SECONDARY_MESH_TOKEN)
+            meshResolution = Parse_Int_With_Range(1, 4096, "parametric secondary_mesh");
+        END_CASE
+
         OTHERWISE
             UNGET
             EXIT
@@ -5256,6 +6094,9 @@ ObjectPtr Parser::Parse_Parametric(void)
     if(PrecompFlag != 0)
         Object->Precompute_Parametric_Values(PrecompFlag, PrecompDepth, GetParserDataPtr());
 
+    if((meshResolution > 0) && !Object->Build_Secondary_Mesh(meshResolution, GetParserDataPtr()))
+        Warning("Parametric 'secondary_mesh' lies entirely outside the container; exact intersections are used for all rays.");
+
     return (reinterpret_cast<ObjectPtr>(Object));
 }
 
@@ -6084,13 +6925,12 @@ ObjectPtr Parser::Parse_Sor()
 
     POV_FREE (Points);
 
+    NoteSideEffect(); // scene-wide limits must account for this object
     if (Object->Spline->BCyl->number > sceneData->Max_Bounding_Cylinders)
     {
         TraceThreadData *td = GetParserDataPtr();
         sceneData->Max_Bounding_Cylinders = Object->Spline->BCyl->number;
         td->BCyl_Intervals.reserve(4*sceneData->Max_Bounding_Cylinders);
-        td->BCyl_RInt.reserve(2*sceneData->Max_Bounding_Cylinders);
-        td->BCyl_HInt.reserve(2*sceneData->Max_Bounding_Cylinders);
     }
 
     return (reinterpret_cast<ObjectPtr>(Object));
@@ -6654,6 +7494,9 @@ TrueTypeFont *Parser::OpenFontFile(const char *asciifn, const int font_id, POV_U
     UCS2String ign;
     UCS2String formalFilename;
 
+    // fonts are owned by the scene, so text objects cannot be carried over to another frame
+    NoteSideEffect();
+
     if (asciifn != nullptr)
     {
         formalFilename = ASCIItoUCS2String(asciifn);
@@ -6740,6 +7583,9 @@ ObjectPtr Parser::Parse_Object ()
 {
     ObjectPtr Object = nullptr;
 
+    if ((mpReusableObjects != nullptr) && (mObjectBodyDepth == 0))
+        return Parse_Reusable_Object();
+
     EXPECT_ONE
 
         CASE (ISOSURFACE_TOKEN)
@@ -6802,6 +7648,14 @@ ObjectPtr Parser::Parse_Object ()
             Object = Parse_Ovus();
         END_CASE
 
+        CASE (POINT_CLOUD_TOKEN)
+            Object = Parse_Point_Cloud();
+        END_CASE
+
+        CASE (HAIR_TOKEN)
+            Object = Parse_Hair();
+        END_CASE
+
         CASE (TORUS_TOKEN)
             Object = Parse_Torus ();
         END_CASE
@@ -6816,6 +7670,10 @@ ObjectPtr Parser::Parse_Object ()
             Object = Parse_Lemon();
         END_CASE
 
+        CASE (INSTANCE_TOKEN)
+            Object = Parse_Instance();
+        END_CASE
+
         /* Parse polygon primitive. [DB 8/94] */
 
         CASE (POLYGON_TOKEN)
@@ -6934,6 +7792,323 @@ ObjectPtr Parser::Parse_Object ()
 
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parse_Reusable_Object
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   Object, or `nullptr` if the next token does not start an object.
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Parse an outermost object statement, or skip it and return a copy of the
+*   object the previous frame of the same animation parsed at the same place,
+*   provided that nothing about the statement depends on the clock.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+ObjectPtr Parser::Parse_Reusable_Object()
+{
+    // statements cheaper than this are not worth keeping around
+    static const POV_LONG kMinReusableTokens = 1000;
+
+    Get_Token();
+
+    ReusableObjectCache::Key key;
+    key.fileName = mTokenizer.GetInputStreamName();
+    key.offset   = CurrentFilePosition().offset;
+
+    bool stable = (ClockDependentContextTable() < 0) && !mObjectReuseDisabled;
+    key.occurrence = mpReusableObjects->Visit(key.fileName, key.offset, stable);
+    stable = stable && (key.occurrence != ReusableObjectCache::kUnstable);
+
+    const ReusableObjectCache::Entry* pEntry = nullptr;
+    if (stable && (mpPreviousObjects != nullptr) && !mHavePendingRawToken)
+        pEntry = mpPreviousObjects->Find(key);
+
+    if (pEntry != nullptr)
+    {
+        for (vector<ReusableObjectCache::Assignment>::const_iterator i = pEntry->assignments.begin(); i != pEntry->assignments.end(); ++i)
+            if (i->table > mSymbolStack.GetLocalTableIndex())
+                pEntry = nullptr;
+    }
+    if (pEntry != nullptr)
+    {
+        for (vector<std::pair<int, unsigned int>>::const_iterator i = pEntry->randomStates.begin(); i != pEntry->randomStates.end(); ++i)
+            if ((unsigned int)(i->first) >= Number_Of_Random_Generators ||
+                (((size_t)(i->first) < maClockDependentRandom.size()) && maClockDependentRandom[i->first]))
+                pEntry = nullptr;
+    }
+
+    if ((pEntry != nullptr) && mTokenizer.GoToBookmark(pEntry->end))
+    {
+        mToken.sourceFile = mTokenizer.GetInputStream();
+
+        for (vector<ReusableObjectCache::Assignment>::const_iterator i = pEntry->assignments.begin(); i != pEntry->assignments.end(); ++i)
+        {
+            SymbolTable* pTable = mSymbolStack.GetTable(i->table);
+            SYM_ENTRY* pSymbol = pTable->Find_Symbol(i->name.c_str());
+            if (pSymbol == nullptr)
+                pSymbol = pTable->Add_Symbol(i->name, i->type);
+            else
+                SymbolTable::Destroy_Ident_Data(pSymbol->Data, pSymbol->Token_Number);
+            pSymbol->Token_Number = i->type;
+            pSymbol->Data = SymbolTable::Copy_Identifier(i->data, i->type);
+            maClockDependentData.erase(&(pSymbol->Data));
+        }
+
+        for (vector<std::pair<int, unsigned int>>::const_iterator i = pEntry->randomStates.begin(); i != pEntry->randomStates.end(); ++i)
+            next_rand[i->first] = i->second;
+
+        ObjectPtr Object = Copy_Object(pEntry->object);
+        mpReusableObjects->Adopt(key, *mpPreviousObjects);
+        return Object;
+    }
+
+    UNGET
+
+    int                                  oldBodyTable       = mObjectBodyTable;
+    bool                                 oldBodyImpure      = mObjectBodyImpure;
+    std::set<std::pair<int, UTF8String>> oldBodyAssignments;
+    std::set<int>                        oldBodyRandom;
+    oldBodyAssignments.swap(maObjectBodyAssignments);
+    oldBodyRandom.swap(maObjectBodyRandom);
+
+    ++mObjectBodyDepth;
+    mObjectBodyTable  = mSymbolStack.GetLocalTableIndex();
+    mObjectBodyImpure = false;
+
+    POV_LONG reads        = mClockDependentReads;
+    POV_LONG tokens       = mTokenCount;
+    size_t   condDepth    = Cond_Stack.size();
+    size_t   includeDepth = maIncludeStack.size();
+
+    ObjectPtr Object;
+    try
+    {
+        Object = Parse_Object();
+    }
+    catch (...)
+    {
+        --mObjectBodyDepth;
+        throw;
+    }
+    --mObjectBodyDepth;
+
+    std::set<std::pair<int, UTF8String>> assigned;
+    std::set<int>                        random;
+    assigned.swap(maObjectBodyAssignments);
+    random.swap(maObjectBodyRandom);
+    bool impure = mObjectBodyImpure;
+
+    mObjectBodyTable  = oldBodyTable;
+    mObjectBodyImpure = oldBodyImpure;
+    maObjectBodyAssignments.swap(oldBodyAssignments);
+    maObjectBodyRandom.swap(oldBodyRandom);
+
+    if ((Object == nullptr) || !stable || impure || mObjectReuseDisabled ||
+        (mClockDependentReads != reads) || (mTokenCount - tokens < kMinReusableTokens) ||
+        mToken.Unget_Token || mHavePendingRawToken ||
+        (Cond_Stack.size() != condDepth) || (maIncludeStack.size() != includeDepth))
+        return Object;
+
+    ReusableObjectCache::Entry entry;
+    entry.end = mTokenizer.GetColdBookmark();
+    if (entry.end.fileName != key.fileName)
+        return Object;
+
+    for (std::set<std::pair<int, UTF8String>>::const_iterator i = assigned.begin(); i != assigned.end(); ++i)
+    {
+        SYM_ENTRY* pSymbol = mSymbolStack.GetTable(i->first)->Find_Symbol(i->second.c_str());
+        bool replayable = (pSymbol != nullptr);
+        if (replayable)
+        {
+            switch (pSymbol->Token_Number)
+            {
+                case FILE_ID_TOKEN:
+                case MACRO_ID_TOKEN:
+                case PARAMETER_ID_TOKEN:
+                case FUNCT_ID_TOKEN:
+                case VECTFUNCT_ID_TOKEN:
+                    replayable = false;
+                    break;
+
+                default:
+                    break;
+            }
+        }
+        if (!replayable)
+        {
+            for (vector<ReusableObjectCache::Assignment>::iterator j = entry.assignments.begin(); j != entry.assignments.end(); ++j)
+                SymbolTable::Destroy_Ident_Data(j->data, j->type);
+            return Object;
+        }
+        ReusableObjectCache::Assignment assignment;
+        assignment.table = i->first;
+        assignment.name  = i->second;
+        assignment.type  = pSymbol->Token_Number;
+        assignment.data  = SymbolTable::Copy_Identifier(pSymbol->Data, pSymbol->Token_Number);
+        entry.assignments.push_back(assignment);
+    }
+
+    for (std::set<int>::const_iterator i = random.begin(); i != random.end(); ++i)
+        entry.randomStates.push_back(std::make_pair(*i, next_rand[*i]));
+
+    // mesh bounding trees must be complete before the object can be copied
+    mMeshTreeBuilder.Wait();
+    entry.object = Copy_Object(Object);
+    mpReusableObjects->Insert(key, entry);
+
+    return Object;
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parse_Object_Instance
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   Object, or `nullptr` if the next token does not start an object.
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Parse an object inside a CSG. If it is a copy of a declared compound
+*   object with nothing but transformations applied to it, the
+*   transformations are not applied but returned, for the caller to hand
+*   them to the InstanceTransformer.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+ObjectPtr Parser::Parse_Object_Instance(vector<InstanceTransformer::Operation>& operations)
+{
+    ObjectPtr Object;
+    InstanceTransformer::Operation operation;
+    MATRIX Local_Matrix;
+
+    Get_Token();
+    if (CurrentTokenId() != OBJECT_TOKEN)
+    {
+        UNGET
+        return Parse_Object();
+    }
+
+    Parse_Begin();
+
+    Get_Token();
+    if (CurrentTokenId() != OBJECT_ID_TOKEN)
+    {
+        UNGET
+        Object = Parse_Object();
+        if (!Object)
+            Expectation_Error("object");
+        Object = Parse_Object_Mods(Object);
+        if (!Object->Precompute())
+            PossibleError("Inconsistent object parameters.");
+        return Object;
+    }
+
+    Object = Copy_Object(CurrentTokenDataPtr<ObjectPtr>());
+    if (!Object->Precompute())
+        PossibleError("Inconsistent object parameters.");
+
+    // transforming a single primitive is not worth handing over
+    if (dynamic_cast<CSG *>(Object) != nullptr)
+    {
+        EXPECT
+            CASE (TRANSLATE_TOKEN)
+                operation.kind = InstanceTransformer::kTranslate;
+                Parse_Vector(operation.vector);
+                Compute_Translation_Transform(&operation.trans, operation.vector);
+                operations.push_back(operation);
+            END_CASE
+
+            CASE (ROTATE_TOKEN)
+                operation.kind = InstanceTransformer::kRotate;
+                Parse_Vector(operation.vector);
+                Compute_Rotation_Transform(&operation.trans, operation.vector);
+                operations.push_back(operation);
+            END_CASE
+
+            CASE (SCALE_TOKEN)
+                operation.kind = InstanceTransformer::kScale;
+                Parse_Scale_Vector(operation.vector);
+                Compute_Scaling_Transform(&operation.trans, operation.vector);
+                operations.push_back(operation);
+            END_CASE
+
+            CASE (TRANSFORM_TOKEN)
+                operation.kind = InstanceTransformer::kTransform;
+                operation.trans = *Parse_Transform(&operation.trans);
+                operations.push_back(operation);
+            END_CASE
+
+            CASE (MATRIX_TOKEN)
+                operation.kind = InstanceTransformer::kTransform;
+                Parse_Matrix(Local_Matrix);
+                Compute_Matrix_Transform(&operation.trans, Local_Matrix);
+                operations.push_back(operation);
+            END_CASE
+
+            OTHERWISE
+                UNGET
+                EXIT
+            END_CASE
+        END_EXPECT
+
+        Get_Token();
+        bool closed = (CurrentTokenId() == RIGHT_CURLY_TOKEN);
+        UNGET
+
+        if (closed)
+        {
+            Parse_End();
+            return Object;
+        }
+
+        // other modifiers follow, which need the transformed object
+        InstanceTransformer::Apply(Object, operations);
+        operations.clear();
+    }
+
+    Object = Parse_Object_Mods(Object);
+    if (!Object->Precompute())
+        PossibleError("Inconsistent object parameters.");
+    return Object;
+}
+
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -6959,6 +8134,8 @@ void Parser::Parse_Default ()
     TNORMAL *Local_Tnormal;
     FINISH  *Local_Finish;
 
+    POV_LONG reads = mClockDependentReads;
+
     Not_In_Default = false;
     Parse_Begin();
 
@@ -7033,6 +8210,8 @@ void Parser::Parse_Default ()
     Parse_End();
 
     Not_In_Default = true;
+
+    NoteGlobalEffect(reads);
 }
 
 
@@ -7082,6 +8261,13 @@ void Parser::Parse_Frame ()
             {
                 Post_Pigment(*i);
             }
+            if (Local_Skysphere->Map_Width > 0)
+            {
+                if (sceneData->EffectiveLanguageVersion() < 370)
+                    Warning("Sky sphere bake requires version 3.7 or later; sky sphere will be evaluated directly.");
+                else
+                    Local_Skysphere->Bake(GetParserDataPtr());
+            }
         END_CASE
 
         CASE (FOG_TOKEN)
@@ -7119,7 +8305,7 @@ void Parser::Parse_Frame ()
         CASE (CAMERA_TOKEN)
             if (sceneData->EffectiveLanguageVersion() >= 350)
             {
-                if (sceneData->clocklessAnimation == false)
+                if ((sceneData->clocklessAnimation == false) && (sceneData->reuseScene == false))
                 {
                     if (had_camera == true)
                         Warning("More than one camera in scene. Ignoring previous camera(s).");
@@ -7129,7 +8315,7 @@ void Parser::Parse_Frame ()
             }
 
             Parse_Camera(sceneData->parsedCamera);
-            if (sceneData->clocklessAnimation == true)
+            if ((sceneData->clocklessAnimation == true) || (sceneData->reuseScene == true))
                 sceneData->cameras.push_back(sceneData->parsedCamera);
         END_CASE
 
@@ -7198,12 +8384,21 @@ void Parser::Parse_Frame ()
         END_CASE
 
         OTHERWISE
+        {
             UNGET
+#if POV_OBJECT_PROFILE
+            SourceInfo profileSource(UCS2String(CurrentFileName()), CurrentFilePosition());
+#endif
             Object = Parse_Object();
             if (Object == nullptr)
                 Expectation_Error ("object or directive");
             Post_Process (Object, nullptr);
+#if POV_OBJECT_PROFILE
+            sceneData->objectProfileSources.push_back(ObjectSourceInfo(Object->declareName, profileSource));
+            Set_Profile_Index(Object, sceneData->objectProfileSources.size() - 1);
+#endif
             Link_To_Frame (Object);
+        }
         END_CASE
     END_EXPECT
 }
@@ -7230,6 +8425,8 @@ void Parser::Parse_Frame ()
 
 void Parser::Parse_Global_Settings()
 {
+    POV_LONG reads = mClockDependentReads;
+
     Parse_Begin();
     EXPECT
         CASE (IRID_WAVELENGTH_TOKEN)
@@ -7310,6 +8507,62 @@ void Parser::Parse_Global_Settings()
             sceneData->parsedAdcBailout = Parse_Float ();
         END_CASE
 
+        CASE (SAMPLING_METHOD_TOKEN)
+            sceneData->samplingMethod = (int)Parse_Float();
+            if ((sceneData->samplingMethod != kSamplingMethod_Classic) && (sceneData->samplingMethod != kSamplingMethod_Sobol))
+                Error("sampling_method must be 1 or 2.");
+        END_CASE
+
+        CASE (FLOAT_PREFILTER_TOKEN)
+            sceneData->floatPrefilter = (Allow_Float(1.0) > 0.0);
+        END_CASE
+
+        CASE (RUSSIAN_ROULETTE_TOKEN)
+            if ((sceneData->rouletteBailout = Parse_Float()) < 0.0)
+                Error("russian_roulette must not be negative.");
+        END_CASE
+
+        CASE (SPECTRAL_SAMPLES_TOKEN)
+            if ((sceneData->spectralSamples = (int)Parse_Float()) < 0)
+                Error("spectral_samples must not be negative.");
+        END_CASE
+
+        CASE (CAMERA_RAY_TABLE_TOKEN)
+            sceneData->cameraRayTable = (Allow_Float(1.0) > 0.0);
+        END_CASE
+
+        CASE (LIGHT_CUTOFF_TOKEN)
+            if ((sceneData->lightCutoff = Parse_Float ()) < 0.0)
+            {
+                Error("light_cutoff must not be negative.");
+            }
+        END_CASE
+
+        CASE (AREA_LIGHT_CACHE_TOKEN)
+            Parse_Begin();
+            EXPECT
+                CASE (DISTANCE_TOKEN)
+                    if ((sceneData->areaLightCacheDistance = Parse_Float()) < 0.0)
+                    {
+                        Error("Area light cache distance must not be negative.");
+                    }
+                END_CASE
+
+                CASE (TOLERANCE_TOKEN)
+                    if ((sceneData->areaLightCacheTolerance = Parse_Float()) < 0.0)
+                    {
+                        Error("Area light cache tolerance must not be negative.");
+                    }
+                END_CASE
+
+                OTHERWISE
+                    UNGET
+                    EXIT
+                END_CASE
+            END_EXPECT
+            Parse_End();
+        END_CASE
+
         CASE (NUMBER_OF_WAVES_TOKEN)
             {
                 int numberOfWaves = (int) Parse_Float ();
@@ -7363,6 +8616,8 @@ void Parser::Parse_Global_Settings()
             //  sceneData->photonSettings.photonReflectionBlur = false; // off by default
 
             sceneData->photonSettings.surfaceCount = 0;
+            sceneData->photonSettings.adaptiveCount = false;
+            sceneData->photonSettings.importance = 1.0; // shoot all directions alike by default
             //  sceneData->photonSettings.globalCount = 0;
 
             sceneData->surfacePhotonMap.minGatherRad = -1;
@@ -7419,10 +8674,20 @@ void Parser::Parse_Global_Settings()
                     sceneData->photonSettings.surfaceCount = (int)Parse_Float();
                 END_CASE
 
+                CASE (ADAPTIVE_TOKEN)
+                    sceneData->photonSettings.adaptiveCount = ((int)Parse_Float() != 0);
+                END_CASE
+
                 CASE (AUTOSTOP_TOKEN)
                     sceneData->photonSettings.autoStopPercent = Parse_Float();
                 END_CASE
 
+                CASE (IMPORTANCE_TOKEN)
+                    sceneData->photonSettings.importance = Parse_Float();
+                    if ((sceneData->photonSettings.importance <= 0.0) || (sceneData->photonSettings.importance > 1.0))
+                        Error("photon importance must be greater than zero and no more than one.");
+                END_CASE
+
                 CASE (ADC_BAILOUT_TOKEN)
                     sceneData->photonSettings.adcBailout = Parse_Float ();
                 END_CASE
@@ -7664,6 +8929,15 @@ void Parser::Parse_Global_Settings()
                     sceneData->radiositySettings.brilliance = ((int)Parse_Float() != 0);
                 END_CASE
 
+                CASE (METHOD_TOKEN)
+                    sceneData->radiositySettings.cacheMethod = (int)Parse_Float();
+                    if ((sceneData->radiositySettings.cacheMethod != RADIOSITY_CACHE_OCTREE) &&
+                        (sceneData->radiositySettings.cacheMethod != RADIOSITY_CACHE_SPATIAL_HASH))
+                    {
+                        Error("Radiosity method must be 1 (octree) or 2 (spatial hash).");
+                    }
+                END_CASE
+
                 OTHERWISE
                     UNGET
                     EXIT
@@ -7697,6 +8971,29 @@ void Parser::Parse_Global_Settings()
                     sceneData->subsurfaceUseRadiosity = ((int)Parse_Float() != 0);
                 END_CASE
 
+                CASE (METHOD_TOKEN)
+                    sceneData->subsurfaceMethod = (int)Parse_Float();
+                    if ((sceneData->subsurfaceMethod != SUBSURFACE_METHOD_PROBE) &&
+                        (sceneData->subsurfaceMethod != SUBSURFACE_METHOD_POINT_CLOUD))
+                    {
+                        Error("Subsurface method must be 1 (probe rays) or 2 (point cloud).");
+                    }
+                END_CASE
+
+                CASE (COUNT_TOKEN)
+                    if ((sceneData->subsurfacePointCount = (int)Parse_Float()) <= 0)
+                    {
+                        Error("Subsurface count must be a positive number.");
+                    }
+                END_CASE
+
+                CASE (ACCURACY_TOKEN)
+                    if ((sceneData->subsurfaceAccuracy = Parse_Float()) < 0.0)
+                    {
+                        Error("Subsurface accuracy must not be negative.");
+                    }
+                END_CASE
+
                 OTHERWISE
                     UNGET
                     EXIT
@@ -7711,6 +9008,399 @@ void Parser::Parse_Global_Settings()
         END_CASE
     END_EXPECT
     Parse_End();
+
+    NoteGlobalEffect(reads);
+}
+
+
+
+// Get the common extent of a set of bounding or clipping objects. Planes, while infinite
+// themselves, confine this extent to their side if they are perpendicular to an axis, so that
+// objects clipped by such planes on all sides can be bounded.
+static void Bound_Clip_Min_Max(const vector<ObjectPtr>& Objects, Vector3d& Min, Vector3d& Max)
+{
+    Vector3d TmpMin, TmpMax;
+
+    Min = Vector3d(-BOUND_HUGE);
+    Max = Vector3d(BOUND_HUGE);
+
+    for(vector<ObjectPtr>::const_iterator Sib = Objects.begin(); Sib != Objects.end(); Sib++)
+    {
+        if(!Test_Flag((*Sib), INVERTED_FLAG))
+        {
+            if(dynamic_cast<const Plane *>(*Sib) != nullptr)
+                Quadric::Compute_Plane_Min_Max(dynamic_cast<const Plane *>(*Sib), TmpMin, TmpMax);
+            else
+                Make_min_max_from_BBox(TmpMin, TmpMax, (*Sib)->BBox);
+
+            for(int i = X; i <= Z; i++)
+            {
+                Min[i] = max(Min[i], TmpMin[i]);
+                Max[i] = min(Max[i], TmpMax[i]);
+            }
+        }
+    }
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Restrict_BBox
+*
+* INPUT
+*
+*   Object - Object whose bounding and clipping objects have been set up
+*
+* OUTPUT
+*
+*   Object
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Shrink an object's bounding box to those of its bounding and clipping
+*   objects. Split off from Parse_Object_Mods, as it must also be applied
+*   to objects transformed by the InstanceTransformer.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+static void Restrict_BBox(ObjectPtr Object)
+{
+    DBL V1, V2;
+    Vector3d Min, Max;
+    BoundingBox BBox;
+
+    /*
+     * Assign bounding objects' bounding box to object
+     * if object's bounding box is larger. [DB 9/94]
+     */
+
+    if(!Object->Bound.empty())
+    {
+        /* Get bounding objects bounding box. */
+
+        Bound_Clip_Min_Max(Object->Bound, Min, Max);
+
+        Make_BBox_from_min_max(BBox, Min, Max);
+
+        /* Get bounding boxes' volumes. */
+
+        // TODO - Area is probably a better measure to decide which box is better.
+        // TODO - Doesn't this mechanism prevent users from reliably overriding broken default boxes?
+        BOUNDS_VOLUME(V1, BBox);
+        BOUNDS_VOLUME(V2, Object->BBox);
+
+        if (V1 < V2)
+        {
+            Object->BBox = BBox;
+        }
+    }
+
+    /*
+     * Assign clipping objects' bounding box to object
+     * if object's bounding box is larger. [DB 9/94]
+     */
+
+    if(!Object->Clip.empty())
+    {
+        /* Get clipping objects bounding box. */
+
+        Bound_Clip_Min_Max(Object->Clip, Min, Max);
+
+        Make_BBox_from_min_max(BBox, Min, Max);
+
+        /* Get bounding boxes' volumes. */
+
+        // TODO - Area is probably a better measure to decide which box is better.
+        BOUNDS_VOLUME(V1, BBox);
+        BOUNDS_VOLUME(V2, Object->BBox);
+
+        if (V1 < V2)
+        {
+            Object->BBox = BBox;
+        }
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Subtract_Box_Cutters
+*
+* INPUT
+*
+*   Objects  - Children of a CSG intersection, or clipping objects
+*   Min, Max - Bounding box of the CSG or clipped object
+*
+* OUTPUT
+*
+*   Min, Max
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Cut off the parts of a bounding box that inverted, untransformed and
+*   unclipped boxes among a CSG intersection's children or an object's
+*   clipping objects cut away, which is
+*   the case where such a box spans the bounding box along two axes and
+*   reaches past one of its ends along the third. The spans must be strict,
+*   as points on a box's surface are not cut away.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+static void Subtract_Box_Cutters(const vector<ObjectPtr>& Objects, Vector3d& Min, Vector3d& Max)
+{
+    bool changed = true;
+
+    // cutting away one end may make another box span the rest
+    while (changed)
+    {
+        changed = false;
+
+        for (vector<ObjectPtr>::const_iterator Sib = Objects.begin(); Sib != Objects.end(); Sib++)
+        {
+            const Box *Cutter = dynamic_cast<const Box *>(*Sib);
+
+            if ((Cutter == nullptr) || !Test_Flag(Cutter, INVERTED_FLAG) || (Cutter->Trans != nullptr) || !Cutter->Clip.empty())
+                continue;
+
+            for (int a = X; a <= Z; a++)
+            {
+                int b = (a + 1) % 3;
+                int c = (a + 2) % 3;
+
+                if ((Cutter->bounds[0][b] >= Min[b]) || (Cutter->bounds[1][b] <= Max[b]) ||
+                    (Cutter->bounds[0][c] >= Min[c]) || (Cutter->bounds[1][c] <= Max[c]))
+                    continue;
+
+                if ((Cutter->bounds[0][a] < Min[a]) && (Cutter->bounds[1][a] > Min[a]) && (Cutter->bounds[1][a] < Max[a]))
+                {
+                    Min[a] = Cutter->bounds[1][a];
+                    changed = true;
+                }
+                else if ((Cutter->bounds[1][a] > Max[a]) && (Cutter->bounds[0][a] < Max[a]) && (Cutter->bounds[0][a] > Min[a]))
+                {
+                    Max[a] = Cutter->bounds[0][a];
+                    changed = true;
+                }
+            }
+        }
+    }
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parser::Tighten_BBox
+*
+* INPUT
+*
+*   Object - Object to tighten the bounding box of, along with its children
+*
+* OUTPUT
+*
+*   Object
+*
+* RETURNS
+*
+*   bool - true if the object's bounding box has shrunk
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Shrink an object's bounding box where more can be inferred about its
+*   extent than its bounding box was set up with: CSG objects are bounded
+*   anew from their children once those have been tightened, boxes cut away
+*   from CSG differences and clipped objects are subtracted, isosurfaces are bounded by the
+*   parts of their container they may occupy, and clipped objects are
+*   bounded by the intersection of their own and their clipping objects'
+*   boxes rather than the smaller of the two. The result is always within
+*   the original box, so bounding boxes only ever shrink.
+*
+*   Inverted objects are left alone, as their boxes have a different
+*   meaning to CSG objects.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool Parser::Tighten_BBox(ObjectPtr Object)
+{
+    DBL Old_Volume, New_Volume;
+    Vector3d Min, Max, TmpMin, TmpMax;
+    BoundingBox Old_BBox = Object->BBox;
+    BoundingBox BBox;
+
+    if (Test_Flag(Object, INVERTED_FLAG) || ((Object->Type & LIGHT_SOURCE_OBJECT) != 0))
+        return false;
+
+    Make_min_max_from_BBox(Min, Max, Old_BBox);
+
+    CSG *Csg = dynamic_cast<CSG *>(Object);
+    IsoSurface *Iso = dynamic_cast<IsoSurface *>(Object);
+
+    if (Csg != nullptr)
+    {
+        bool childChanged = false;
+
+        for (vector<ObjectPtr>::iterator Sib = Csg->children.begin(); Sib != Csg->children.end(); Sib++)
+        {
+            if (Tighten_BBox(*Sib))
+                childChanged = true;
+        }
+
+        // also rebuilds the hierarchy over the children's boxes
+        if (childChanged)
+        {
+            Csg->Compute_BBox();
+            Make_min_max_from_BBox(TmpMin, TmpMax, Object->BBox);
+            Object->BBox = Old_BBox;
+
+            Min = max(Min, TmpMin);
+            Max = min(Max, TmpMax);
+        }
+
+        if (dynamic_cast<CSGIntersection *>(Object) != nullptr)
+            Subtract_Box_Cutters(Csg->children, Min, Max);
+    }
+    else if (Iso != nullptr)
+    {
+        if (Iso->Compute_Tight_BBox(BBox, GetParserDataPtr()))
+        {
+            Make_min_max_from_BBox(TmpMin, TmpMax, BBox);
+
+            Min = max(Min, TmpMin);
+            Max = min(Max, TmpMax);
+        }
+    }
+
+    if (!Object->Clip.empty())
+    {
+        Bound_Clip_Min_Max(Object->Clip, TmpMin, TmpMax);
+
+        Min = max(Min, TmpMin);
+        Max = min(Max, TmpMax);
+
+        Subtract_Box_Cutters(Object->Clip, Min, Max);
+    }
+
+    // an empty box would leave the object out of the scene altogether; rather be safe
+    if ((Min[X] > Max[X]) || (Min[Y] > Max[Y]) || (Min[Z] > Max[Z]))
+        return false;
+
+    Make_BBox_from_min_max(BBox, Min, Max);
+
+    BOUNDS_VOLUME(Old_Volume, Old_BBox);
+    BOUNDS_VOLUME(New_Volume, BBox);
+
+    if (New_Volume >= Old_Volume)
+        return false;
+
+    Object->BBox = BBox;
+
+    if (New_Volume <= INFINITE_VOLUME)
+        Clear_Flag(Object, INFINITE_FLAG);
+
+    return true;
+}
+
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parser::Tighten_BBoxes
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Tighten the bounding boxes of all objects in the scene once parsing is
+*   done, and report how much the total volume of the finite ones shrank.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void Parser::Tighten_BBoxes()
+{
+    DBL Old_Total = 0.0, New_Total = 0.0, Volume;
+    int tightened = 0, madeFinite = 0;
+
+    for (vector<ObjectPtr>::iterator Object = sceneData->objects.begin(); Object != sceneData->objects.end(); Object++)
+    {
+        bool wasInfinite = (Test_Flag(*Object, INFINITE_FLAG) != 0);
+
+        BOUNDS_VOLUME(Volume, (*Object)->BBox);
+        if (!wasInfinite)
+            Old_Total += Volume;
+
+        if (!Tighten_BBox(*Object))
+        {
+            if (!wasInfinite)
+                New_Total += Volume;
+            continue;
+        }
+
+        tightened++;
+
+        BOUNDS_VOLUME(Volume, (*Object)->BBox);
+        if (!wasInfinite)
+            New_Total += Volume;
+        else if (!Test_Flag(*Object, INFINITE_FLAG))
+            madeFinite++;
+    }
+
+    if (tightened == 0)
+        return;
+
+    Debug_Info("Tightened the bounding boxes of %d objects", tightened);
+    if (Old_Total > 0.0)
+        Debug_Info(", shrinking the total volume of finite ones by %.1f%%", 100.0 * (1.0 - New_Total / Old_Total));
+    if (madeFinite > 0)
+        Debug_Info("; %d objects are no longer infinite", madeFinite);
+    Debug_Info(".\n");
 }
 
 
@@ -7737,12 +9427,10 @@ void Parser::Parse_Global_Settings()
 // (this will only happen if Object is CSG and the invert_object keyword is parsed)
 ObjectPtr Parser::Parse_Object_Mods (ObjectPtr Object)
 {
-    DBL V1, V2;
     Vector3d Min, Max;
     Vector3d Local_Vector;
     MATRIX Local_Matrix;
     TRANSFORM Local_Trans;
-    BoundingBox BBox;
     TEXTURE *Local_Texture;
     TEXTURE *Local_Int_Texture;
     MATERIAL Local_Material;
@@ -8112,92 +9800,15 @@ ObjectPtr Parser::Parse_Object_Mods (ObjectPtr Object)
         END_CASE
     END_EXPECT
 
-    /*
-     * Assign bounding objects' bounding box to object
-     * if object's bounding box is larger. [DB 9/94]
-     */
-
-    if(!Object->Bound.empty())
-    {
-        /* Get bounding objects bounding box. */
+    Restrict_BBox(Object);
 
-        Min = Vector3d(-BOUND_HUGE);
-        Max = Vector3d(BOUND_HUGE);
+    if ((Object->Texture == nullptr) && (Object->Interior_Texture != nullptr))
+        Error("Interior texture requires an exterior texture.");
 
-        for(vector<ObjectPtr>::iterator Sib = Object->Bound.begin(); Sib != Object->Bound.end(); Sib++)
-        {
-            if(!Test_Flag((*Sib), INVERTED_FLAG))
-            {
-                Min[X] = max(Min[X], (DBL)((*Sib)->BBox.lowerLeft[X]));
-                Min[Y] = max(Min[Y], (DBL)((*Sib)->BBox.lowerLeft[Y]));
-                Min[Z] = max(Min[Z], (DBL)((*Sib)->BBox.lowerLeft[Z]));
-                Max[X] = min(Max[X], (DBL)((*Sib)->BBox.lowerLeft[X] + (*Sib)->BBox.size[X]));
-                Max[Y] = min(Max[Y], (DBL)((*Sib)->BBox.lowerLeft[Y] + (*Sib)->BBox.size[Y]));
-                Max[Z] = min(Max[Z], (DBL)((*Sib)->BBox.lowerLeft[Z] + (*Sib)->BBox.size[Z]));
-            }
-        }
+    Parse_End ();
 
-        Make_BBox_from_min_max(BBox, Min, Max);
-
-        /* Get bounding boxes' volumes. */
-
-        // TODO - Area is probably a better measure to decide which box is better.
-        // TODO - Doesn't this mechanism prevent users from reliably overriding broken default boxes?
-        BOUNDS_VOLUME(V1, BBox);
-        BOUNDS_VOLUME(V2, Object->BBox);
-
-        if (V1 < V2)
-        {
-            Object->BBox = BBox;
-        }
-    }
-
-    /*
-     * Assign clipping objects' bounding box to object
-     * if object's bounding box is larger. [DB 9/94]
-     */
-
-    if(!Object->Clip.empty())
-    {
-        /* Get clipping objects bounding box. */
-
-        Min = Vector3d(-BOUND_HUGE);
-        Max = Vector3d(BOUND_HUGE);
-
-        for(vector<ObjectPtr>::iterator Sib = Object->Clip.begin(); Sib != Object->Clip.end(); Sib++)
-        {
-            if(!Test_Flag((*Sib), INVERTED_FLAG))
-            {
-                Min[X] = max(Min[X], (DBL)((*Sib)->BBox.lowerLeft[X]));
-                Min[Y] = max(Min[Y], (DBL)((*Sib)->BBox.lowerLeft[Y]));
-                Min[Z] = max(Min[Z], (DBL)((*Sib)->BBox.lowerLeft[Z]));
-                Max[X] = min(Max[X], (DBL)((*Sib)->BBox.lowerLeft[X] + (*Sib)->BBox.size[X]));
-                Max[Y] = min(Max[Y], (DBL)((*Sib)->BBox.lowerLeft[Y] + (*Sib)->BBox.size[Y]));
-                Max[Z] = min(Max[Z], (DBL)((*Sib)->BBox.lowerLeft[Z] + (*Sib)->BBox.size[Z]));
-            }
-        }
-
-        Make_BBox_from_min_max(BBox, Min, Max);
-
-        /* Get bounding boxes' volumes. */
-
-        // TODO - Area is probably a better measure to decide which box is better.
-        BOUNDS_VOLUME(V1, BBox);
-        BOUNDS_VOLUME(V2, Object->BBox);
-
-        if (V1 < V2)
-        {
-            Object->BBox = BBox;
-        }
-    }
-
-    if ((Object->Texture == nullptr) && (Object->Interior_Texture != nullptr))
-        Error("Interior texture requires an exterior texture.");
-
-    Parse_End ();
-
-    return Object;
-}
+    return Object;
+}
 
 
 
@@ -8733,6 +10344,8 @@ void Parser::Parse_Declare(bool is_local, bool after_hash)
     POV_EXPERIMENTAL_ASSERT(IsOkToDeclare());
     SetOkToDeclare(false);
 
+    POV_LONG lvalueReads = mClockDependentReads;
+
     if ((sceneData->EffectiveLanguageVersion() >= 350) && (after_hash == false))
     {
         PossibleError("'declare' should be changed to '#declare'.\n"
@@ -8963,9 +10576,44 @@ void Parser::Parse_Declare(bool is_local, bool after_hash)
         lvalue.numberPtr = numberPtr;
         lvalue.dataPtr = dataPtr;
         lvalue.symEntry = Temp_Entry;
+        if ((Temp_Entry == nullptr) && CurrentTokenIsArrayElement())
+        {
+            POV_PARSER_ASSERT(dataPtr == &(mToken.array->DataPtrs[mToken.arrayIndex]));
+            lvalue.array = mToken.array;
+            lvalue.arrayIndex = mToken.arrayIndex;
+        }
+        else
+            lvalue.array = nullptr;
         lvalue.previous = Previous;
         lvalue.allowRedefine = allow_redefine;
         lvalue.optional = optional;
+        if ((Temp_Entry != nullptr) && (Temp_Entry->Token_Number == DUMMY_SYMBOL_TOKEN))
+        {
+            // not in any symbol table
+            lvalue.rootDataPtr = nullptr;
+            lvalue.viaParameter = false;
+            lvalue.context = MAX_NUMBER_OF_TABLES;
+        }
+        else if (CurrentTokenIsContainerElement())
+        {
+            lvalue.rootDataPtr = mToken.rootDataPtr;
+            lvalue.viaParameter = mToken.is_parameter_ref;
+            lvalue.context = mToken.context;
+        }
+        else if (Temp_Entry != nullptr)
+        {
+            lvalue.rootDataPtr = nullptr;
+            lvalue.viaParameter = false;
+            lvalue.context = Local_Index;
+            lvalue.name = CurrentTokenText();
+        }
+        else
+        {
+            lvalue.rootDataPtr = nullptr;
+            lvalue.viaParameter = mToken.is_parameter_ref;
+            lvalue.context = mToken.context;
+            lvalue.name = CurrentTokenText();
+        }
         lvalues.push_back(lvalue);
 
         if (lvectorDeclare && (lvalues.size() >= 5))
@@ -9003,6 +10651,10 @@ void Parser::Parse_Declare(bool is_local, bool after_hash)
 
     LValue_Ok = false;
 
+    // subscripts that depend on the clock make it unpredictable which array element is assigned
+    bool dependentLocation = (mClockDependentReads != lvalueReads);
+    POV_LONG valueReads = mClockDependentReads;
+
     GET (EQUALS_TOKEN)
     SetOkToDeclare(true);
 
@@ -9116,6 +10768,17 @@ void Parser::Parse_Declare(bool is_local, bool after_hash)
         }
     }
 
+    bool dependentValue = (mClockDependentReads != valueReads);
+    for (vector<LValue>::iterator i = lvalues.begin(); i != lvalues.end(); ++i)
+        NoteAssignment(*i, dependentLocation, dependentValue);
+
+    // move any assigned array elements (back) into packed storage
+    for (vector<LValue>::iterator i = lvalues.begin(); i != lvalues.end(); ++i)
+    {
+        if (i->array != nullptr)
+            i->array->Pack(i->arrayIndex);
+    }
+
     // discard any dummy symbol entries we may have created as stand-in for omitted identifiers
     // in tuple-style declarations
     for (vector<LValue>::iterator i = lvalues.begin(); i != lvalues.end(); ++i)
@@ -9172,6 +10835,9 @@ bool Parser::Parse_RValue (TokenId Previous, TokenId *NumberPtr, void **DataPtr,
     SYM_ENTRY* symbol_entry;
     SymbolTable* symbol_entry_table;
 
+    if (SemiFlag && !ParFlag && Parse_Compiled_RValue(Previous, NumberPtr, DataPtr, allow_redefine))
+        return true;
+
     bool oldParseOptionalRVaue = parseOptionalRValue;
     parseOptionalRValue = allowUndefined;
 
@@ -9318,6 +10984,9 @@ bool Parser::Parse_RValue (TokenId Previous, TokenId *NumberPtr, void **DataPtr,
                 else
                 {
                     // pass by reference
+                    if (CurrentTokenIsArrayElement())
+                        // The macro may replace the element's data via the parameter.
+                        mToken.array->Alias(mToken.arrayIndex);
                     New_Par            = reinterpret_cast<POV_PARAM *>(POV_MALLOC(sizeof(POV_PARAM),"parameter"));
                     New_Par->NumberPtr = mToken.NumberPtr;
                     New_Par->DataPtr   = mToken.DataPtr;
@@ -9571,7 +11240,7 @@ bool Parser::Parse_RValue (TokenId Previous, TokenId *NumberPtr, void **DataPtr,
         CASE5 (STRING_LITERAL_TOKEN,CHR_TOKEN,SUBSTR_TOKEN,STR_TOKEN,VSTR_TOKEN)
         CASE4 (CONCAT_TOKEN,STRUPR_TOKEN,STRLWR_TOKEN,DATETIME_TOKEN)
             UNGET
-            Temp_Data  = Parse_String();
+            Temp_Data  = reinterpret_cast<void *>(Parse_String_Value());
             *NumberPtr = STRING_ID_TOKEN;
             Test_Redefine(Previous,NumberPtr,*DataPtr, allow_redefine);
             *DataPtr   = Temp_Data;
@@ -9597,6 +11266,10 @@ bool Parser::Parse_RValue (TokenId Previous, TokenId *NumberPtr, void **DataPtr,
             Found = (Local_Object != nullptr);
             if (Found)
             {
+#if POV_OBJECT_PROFILE
+                if (sym != nullptr)
+                    Local_Object->declareName = sym->name;
+#endif
                 *NumberPtr   = OBJECT_ID_TOKEN;
                 Test_Redefine(Previous,NumberPtr,*DataPtr, allow_redefine);
                 *DataPtr     = reinterpret_cast<void *>(Local_Object);
@@ -10008,8 +11681,22 @@ void Parser::Post_Process (ObjectPtr Object, ObjectPtr Parent)
     }
 
     if (Object->interior != nullptr)
+    {
         Object->interior->PostProcess();
 
+        for (vector<Media>::iterator i = Object->interior->media.begin(); i != Object->interior->media.end(); ++i)
+        {
+            if (i->Density_Grid_Resolution > 0)
+            {
+                BOUNDS_VOLUME(Volume, Object->BBox);
+                if (Volume > INFINITE_VOLUME)
+                    Warning("density_grid ignored for media in an unbounded object.");
+                else
+                    i->BakeDensity(Vector3d(Object->BBox.lowerLeft), Vector3d(Object->BBox.lowerLeft + Object->BBox.size), GetParserDataPtr());
+            }
+        }
+    }
+
     if ((Object->Texture == nullptr) &&
         !(Object->Type & TEXTURED_OBJECT) &&
         !(Object->Type & LIGHT_SOURCE_OBJECT))
@@ -10651,134 +12338,647 @@ void Parser::Warning(WarningLevel level, const MessageContext& loc, const char *
     va_list marker;
     char localvsbuffer[1024];
 
-    va_start(marker, format);
-    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
-    va_end(marker);
+    va_start(marker, format);
+    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
+    va_end(marker);
+
+    mMessageFactory.WarningAt(level, loc, "%s", localvsbuffer);
+}
+
+void Parser::VersionWarning(unsigned int sinceVersion, const char *format,...)
+{
+    if(sceneData->EffectiveLanguageVersion() >= sinceVersion)
+    {
+        va_list marker;
+        char localvsbuffer[1024];
+
+        va_start(marker, format);
+        std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
+        va_end(marker);
+
+        Warning(kWarningLanguage, localvsbuffer);
+    }
+}
+
+void Parser::PossibleError(const char *format,...)
+{
+    va_list marker;
+    char localvsbuffer[1024];
+
+    va_start(marker, format);
+    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
+    va_end(marker);
+
+    if (HaveCurrentMessageContext())
+        mMessageFactory.PossibleErrorAt(CurrentMessageContext(), "%s", localvsbuffer);
+    else
+        mMessageFactory.PossibleError("%s", localvsbuffer);
+}
+
+void Parser::Error(const char *format,...)
+{
+#if POV_BOMB_ON_ERROR
+    POV_ASSERT_HARD(false);
+#endif
+
+    va_list marker;
+    char localvsbuffer[1024];
+
+    va_start(marker, format);
+    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
+    va_end(marker);
+
+    if (HaveCurrentMessageContext())
+        mMessageFactory.ErrorAt(POV_EXCEPTION(kParseErr, localvsbuffer), CurrentMessageContext(), "%s", localvsbuffer);
+    else
+        mMessageFactory.Error(POV_EXCEPTION(kParseErr, localvsbuffer), "%s", localvsbuffer);
+}
+
+void Parser::Error(const MessageContext& loc, const char *format, ...)
+{
+#if POV_BOMB_ON_ERROR
+    POV_ASSERT_HARD(false);
+#endif
+
+    va_list marker;
+    char localvsbuffer[1024];
+
+    va_start(marker, format);
+    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
+    va_end(marker);
+
+    mMessageFactory.ErrorAt(POV_EXCEPTION(kParseErr, localvsbuffer), loc, "%s", localvsbuffer);
+}
+
+void Parser::ErrorInfo(const MessageContext& loc, const char *format,...)
+{
+    va_list marker;
+    char localvsbuffer[1024];
+
+    va_start(marker, format);
+    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
+    va_end(marker);
+
+    mMessageFactory.PossibleErrorAt(loc, "%s", localvsbuffer);
+}
+
+int Parser::Debug_Info(const char *format,...)
+{
+    va_list marker;
+    char localvsbuffer[1024];
+
+    va_start(marker, format);
+    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
+    va_end(marker);
+
+    Debug_Message_Buffer.printf("%s", localvsbuffer);
+
+    return 0;
+}
+
+void Parser::FlushDebugMessageBuffer()
+{
+    Debug_Message_Buffer.flush();
+}
+
+Parser::DebugTextStreamBuffer::DebugTextStreamBuffer(GenericMessenger& m) :
+    TextStreamBuffer (1024*8, 160),
+    mMessenger(m)
+{
+    // do nothing
+}
+
+Parser::DebugTextStreamBuffer::~DebugTextStreamBuffer()
+{
+    // do nothing
+}
+
+void Parser::DebugTextStreamBuffer::lineoutput(const char *str, unsigned int chars)
+{
+    char buffer[256];
+
+    buffer[0] = 0;
+    strncat(buffer, str, min((unsigned int)255, chars));
+
+    mMessenger.UserDebug(buffer);
+}
+
+void Parser::DebugTextStreamBuffer::directoutput(const char *, unsigned int)
+{
+    // do nothing
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   ParseProfiler::Enter, ParseProfiler::Leave, ParseProfiler::Report
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Collect and report parse time statistics per macro, include file, loop
+*   and heavy object.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+const size_t ParseProfiler::kNoFrame;
+
+bool ParseProfiler::Key::operator<(const Key& o) const
+{
+    if (kind != o.kind)
+        return (kind < o.kind);
+    if (line != o.line)
+        return (line < o.line);
+    if (fileName != o.fileName)
+        return (fileName < o.fileName);
+    return (name < o.name);
+}
+
+size_t ParseProfiler::Enter(Kind kind, const char* name, const UCS2* fileName, POV_LONG line)
+{
+    Key key;
+    key.kind     = kind;
+    key.name     = name;
+    key.fileName = fileName;
+    key.line     = line;
+
+    Frame frame;
+    frame.pEntry = &mEntries[key];
+    frame.nested = Clock::duration::zero();
+    ++frame.pEntry->count;
+    ++frame.pEntry->active;
+    maFrames.push_back(frame);
+
+    // Start the clock last, so that the bookkeeping is charged to the enclosing frame.
+    maFrames.back().start = Clock::now();
+    return maFrames.size() - 1;
+}
+
+void ParseProfiler::Leave(size_t depth)
+{
+    if (maFrames.size() <= depth)
+        return;
+
+    Clock::time_point now = Clock::now();
+    while (maFrames.size() > depth)
+    {
+        Frame& frame = maFrames.back();
+        Clock::duration elapsed = now - frame.start;
+        frame.pEntry->exclusive += elapsed - frame.nested;
+        if (--frame.pEntry->active == 0)
+            frame.pEntry->inclusive += elapsed;
+        maFrames.pop_back();
+        if (!maFrames.empty())
+            maFrames.back().nested += elapsed;
+    }
+}
+
+void ParseProfiler::Report(TextStreamBuffer& out)
+{
+    static const char* const kKindNames[] = { "scene", "include", "macro", "loop", "loop", "object" };
+
+    Leave(0);
+
+    vector<std::map<Key, Entry>::const_iterator> order;
+    order.reserve(mEntries.size());
+    for (std::map<Key, Entry>::const_iterator i = mEntries.begin(); i != mEntries.end(); ++i)
+        order.push_back(i);
+    std::stable_sort(order.begin(), order.end(), SortByInclusiveTime);
+
+    out.printf("Parse Time Profile\n");
+    out.printf("  Inclusive  Exclusive      Count  Construct\n");
+    for (vector<std::map<Key, Entry>::const_iterator>::const_iterator i = order.begin(); i != order.end(); ++i)
+    {
+        const Key&   key   = (*i)->first;
+        const Entry& entry = (*i)->second;
+        std::string location = UCS2toASCIIString(key.fileName);
+        if (key.line > 0)
+            location += ":" + std::to_string(key.line);
+        out.printf("%9.3fs %9.3fs %10s  %-7s %s%s%s\n",
+                   std::chrono::duration<double>(entry.inclusive).count(),
+                   std::chrono::duration<double>(entry.exclusive).count(),
+                   std::to_string(entry.count).c_str(), kKindNames[key.kind],
+                   key.name.c_str(), (key.name.empty() ? "" : " "), location.c_str());
+    }
+}
+
+bool ParseProfiler::SortByInclusiveTime(const std::map<Key, Entry>::const_iterator& a,
+                                        const std::map<Key, Entry>::const_iterator& b)
+{
+    return (a->second.inclusive > b->second.inclusive);
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   ReusableObjectCache::Visit, ReusableObjectCache::Retrieve,
+*   ReusableObjectCache::Retain
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Keep the clock-independent objects of one animation frame around for the
+*   next frame of the same animation to pick up. Only the most recent frame's
+*   objects are retained; objects a frame does not reuse are discarded.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+// NB: The retained cache is deliberately leaked at program exit, as the
+// objects it holds may refer to data that has already been torn down by then.
+static boost::mutex gRetainedObjectsMutex;
+static ReusableObjectCache* gpRetainedObjects = nullptr;
+
+const size_t ReusableObjectCache::kUnstable;
+
+bool ReusableObjectCache::Key::operator<(const Key& o) const
+{
+    if (offset != o.offset)
+        return (offset < o.offset);
+    if (occurrence != o.occurrence)
+        return (occurrence < o.occurrence);
+    return (fileName < o.fileName);
+}
+
+ReusableObjectCache::ReusableObjectCache(const UCS2String& inputFile, POV_LONG runId) :
+    mInputFile(inputFile),
+    mRunId(runId)
+{}
+
+ReusableObjectCache::~ReusableObjectCache()
+{
+    for (std::map<Key, Entry>::iterator i = mEntries.begin(); i != mEntries.end(); ++i)
+        Release(i->second);
+}
+
+size_t ReusableObjectCache::Visit(const UCS2String& fileName, POV_OFF_T offset, bool stable)
+{
+    size_t& count = mVisits[std::make_pair(fileName, offset)];
+    if (count == kUnstable)
+        return kUnstable;
+    if (!stable)
+    {
+        count = kUnstable;
+        return kUnstable;
+    }
+    return count++;
+}
+
+const ReusableObjectCache::Entry* ReusableObjectCache::Find(const Key& key) const
+{
+    std::map<Key, Entry>::const_iterator i = mEntries.find(key);
+    if (i == mEntries.end())
+        return nullptr;
+    return &(i->second);
+}
+
+void ReusableObjectCache::Insert(const Key& key, const Entry& entry)
+{
+    std::map<Key, Entry>::iterator i = mEntries.find(key);
+    if (i != mEntries.end())
+    {
+        Release(i->second);
+        i->second = entry;
+    }
+    else
+        mEntries.insert(std::make_pair(key, entry));
+}
+
+void ReusableObjectCache::Adopt(const Key& key, ReusableObjectCache& other)
+{
+    std::map<Key, Entry>::iterator i = other.mEntries.find(key);
+    if (i == other.mEntries.end())
+        return;
+    Insert(key, i->second);
+    other.mEntries.erase(i);
+}
+
+std::unique_ptr<ReusableObjectCache> ReusableObjectCache::Retrieve(const UCS2String& inputFile, POV_LONG runId)
+{
+    std::unique_ptr<ReusableObjectCache> pCache;
+    {
+        boost::mutex::scoped_lock lock(gRetainedObjectsMutex);
+        pCache.reset(gpRetainedObjects);
+        gpRetainedObjects = nullptr;
+    }
+    if ((pCache != nullptr) && ((pCache->mRunId != runId) || (pCache->mInputFile != inputFile)))
+        pCache.reset();
+    return pCache;
+}
+
+void ReusableObjectCache::Retain(std::unique_ptr<ReusableObjectCache>&& pCache)
+{
+    pCache->mVisits.clear();
+    ReusableObjectCache* pOld;
+    {
+        boost::mutex::scoped_lock lock(gRetainedObjectsMutex);
+        pOld = gpRetainedObjects;
+        gpRetainedObjects = pCache.release();
+    }
+    delete pOld;
+}
+
+void ReusableObjectCache::Release(Entry& entry)
+{
+    Destroy_Object(entry.object);
+    entry.object = nullptr;
+    for (vector<Assignment>::iterator i = entry.assignments.begin(); i != entry.assignments.end(); ++i)
+        SymbolTable::Destroy_Ident_Data(i->data, i->type);
+    entry.assignments.clear();
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   ClockDependentContextTable, NoteCondition, NoteAssignment, NoteRandomDraw,
+*   NoteGlobalEffect
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Track which identifiers, random number generators and control flow depend
+*   on the clock, to tell which objects may be reused in the next frame.
+*
+*   A statement in a clock-dependent context (a conditional, loop or include
+*   that depends on the clock) taints whatever it assigns. If it assigns to an
+*   identifier that outlives the context, whether that identifier exists or
+*   what value it has may change from frame to frame in ways that cannot be
+*   tracked, so reuse is disabled for the rest of the frame.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+int Parser::ClockDependentContextTable() const
+{
+    int table = -1;
+    for (vector<IncludeStackEntry>::const_iterator i = maIncludeStack.begin(); i != maIncludeStack.end(); ++i)
+        if ((i->clockDependentTable >= 0) && ((table < 0) || (i->clockDependentTable < table)))
+            table = i->clockDependentTable;
+    for (vector<CS_ENTRY>::const_iterator i = Cond_Stack.begin(); i != Cond_Stack.end(); ++i)
+        if ((i->clockDependentTable >= 0) && ((table < 0) || (i->clockDependentTable < table)))
+            table = i->clockDependentTable;
+    return table;
+}
 
-    mMessageFactory.WarningAt(level, loc, "%s", localvsbuffer);
+void Parser::NoteCondition(POV_LONG readsBefore)
+{
+    if ((mpReusableObjects == nullptr) || (mClockDependentReads == readsBefore) || Cond_Stack.empty())
+        return;
+    if (Cond_Stack.back().clockDependentTable < 0)
+        Cond_Stack.back().clockDependentTable = mSymbolStack.GetLocalTableIndex();
 }
 
-void Parser::VersionWarning(unsigned int sinceVersion, const char *format,...)
+void Parser::NoteAssignment(void** dataPtr, const void* container, int table, const UTF8String* name,
+                            bool dependentLocation, bool dependentValue)
 {
-    if(sceneData->EffectiveLanguageVersion() >= sinceVersion)
+    if ((mpReusableObjects == nullptr) || mObjectReuseDisabled)
+        return;
+
+    int context = ClockDependentContextTable();
+    if (dependentLocation || ((context >= 0) && (table <= context)))
     {
-        va_list marker;
-        char localvsbuffer[1024];
+        mObjectReuseDisabled = true;
+        return;
+    }
 
-        va_start(marker, format);
-        std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
-        va_end(marker);
+    if (dependentValue || (context >= 0))
+    {
+        maClockDependentData.insert(dataPtr);
+        if (container != nullptr)
+            maClockDependentData.insert(container);
+    }
+    else
+        maClockDependentData.erase(dataPtr);
 
-        Warning(kWarningLanguage, localvsbuffer);
+    if ((mObjectBodyDepth > 0) && (table <= mObjectBodyTable))
+    {
+        if ((table < 0) || (name == nullptr) || name->empty())
+            mObjectBodyImpure = true;
+        else
+            maObjectBodyAssignments.insert(std::make_pair(table, *name));
     }
 }
 
-void Parser::PossibleError(const char *format,...)
+void Parser::NoteAssignment(const LValue& lvalue, bool dependentLocation, bool dependentValue)
 {
-    va_list marker;
-    char localvsbuffer[1024];
-
-    va_start(marker, format);
-    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
-    va_end(marker);
-
-    if (HaveCurrentMessageContext())
-        mMessageFactory.PossibleErrorAt(CurrentMessageContext(), "%s", localvsbuffer);
-    else
-        mMessageFactory.PossibleError("%s", localvsbuffer);
+    void** dataPtr = lvalue.dataPtr;
+    if ((lvalue.array != nullptr) && (lvalue.arrayIndex < lvalue.array->DataPtrs.size()))
+        dataPtr = &(lvalue.array->DataPtrs[lvalue.arrayIndex]);
+    NoteAssignment(dataPtr, lvalue.rootDataPtr, (lvalue.viaParameter ? -1 : lvalue.context), &lvalue.name,
+                   dependentLocation, dependentValue);
 }
 
-void Parser::Error(const char *format,...)
+void Parser::NoteRandomDraw(int stream)
 {
-#if POV_BOMB_ON_ERROR
-    POV_ASSERT_HARD(false);
-#endif
-
-    va_list marker;
-    char localvsbuffer[1024];
-
-    va_start(marker, format);
-    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
-    va_end(marker);
-
-    if (HaveCurrentMessageContext())
-        mMessageFactory.ErrorAt(POV_EXCEPTION(kParseErr, localvsbuffer), CurrentMessageContext(), "%s", localvsbuffer);
-    else
-        mMessageFactory.Error(POV_EXCEPTION(kParseErr, localvsbuffer), "%s", localvsbuffer);
+    if (mpReusableObjects == nullptr)
+        return;
+    if (maClockDependentRandom.size() <= (size_t)stream)
+        maClockDependentRandom.resize(stream + 1, false);
+    if (maClockDependentRandom[stream])
+        NoteClockRead();
+    if (ClockDependentContextTable() >= 0)
+        maClockDependentRandom[stream] = true;
+    if (mObjectBodyDepth > 0)
+        maObjectBodyRandom.insert(stream);
 }
 
-void Parser::Error(const MessageContext& loc, const char *format, ...)
+void Parser::NoteGlobalEffect(POV_LONG readsBefore)
 {
-#if POV_BOMB_ON_ERROR
-    POV_ASSERT_HARD(false);
-#endif
+    NoteSideEffect();
+    if ((mpReusableObjects != nullptr) && ((mClockDependentReads != readsBefore) || (ClockDependentContextTable() >= 0)))
+        mObjectReuseDisabled = true;
+}
 
-    va_list marker;
-    char localvsbuffer[1024];
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   InstanceTransformer::InstanceTransformer, InstanceTransformer::Submit,
+*   InstanceTransformer::Wait, InstanceTransformer::Apply,
+*   InstanceTransformer::Work
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Worker threads for transforming object copies, started only once there
+*   is work for them. Copying stays with the parser thread, as copies share
+*   reference-counted data with their originals; transforming a fresh copy
+*   only touches data that copy owns.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
 
-    va_start(marker, format);
-    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
-    va_end(marker);
+InstanceTransformer::InstanceTransformer() :
+    mMaxThreads(max(1u, boost::thread::hardware_concurrency())),
+    mIdleThreads(0),
+    mBusyThreads(0),
+    mStopping(false),
+    mConsistent(true)
+{}
 
-    mMessageFactory.ErrorAt(POV_EXCEPTION(kParseErr, localvsbuffer), loc, "%s", localvsbuffer);
+InstanceTransformer::~InstanceTransformer()
+{
+    {
+        boost::mutex::scoped_lock lock(mMutex);
+        mStopping = true;
+    }
+    mQueued.notify_all();
+    mThreads.join_all();
 }
 
-void Parser::ErrorInfo(const MessageContext& loc, const char *format,...)
+void InstanceTransformer::Submit(ObjectPtr object, vector<Operation>& operations)
 {
-    va_list marker;
-    char localvsbuffer[1024];
+    boost::mutex::scoped_lock lock(mMutex);
 
-    va_start(marker, format);
-    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
-    va_end(marker);
+    mQueue.push_back(Job());
+    mQueue.back().object = object;
+    mQueue.back().operations.swap(operations);
 
-    mMessageFactory.PossibleErrorAt(loc, "%s", localvsbuffer);
+    if ((mQueue.size() > mIdleThreads) && (mThreads.size() < mMaxThreads))
+        mThreads.create_thread(boost::bind(&InstanceTransformer::Work, this));
+    else
+        mQueued.notify_one();
 }
 
-int Parser::Debug_Info(const char *format,...)
+bool InstanceTransformer::Wait()
 {
-    va_list marker;
-    char localvsbuffer[1024];
+    std::exception_ptr error;
+    bool consistent;
 
-    va_start(marker, format);
-    std::vsnprintf(localvsbuffer, sizeof(localvsbuffer), format, marker);
-    va_end(marker);
+    {
+        boost::mutex::scoped_lock lock(mMutex);
 
-    Debug_Message_Buffer.printf("%s", localvsbuffer);
+        while (!mQueue.empty() || (mBusyThreads > 0))
+            mDone.wait(lock);
 
-    return 0;
-}
+        std::swap(error, mError);
+        consistent = mConsistent;
+        mConsistent = true;
+    }
 
-void Parser::FlushDebugMessageBuffer()
-{
-    Debug_Message_Buffer.flush();
-}
+    if (error)
+        std::rethrow_exception(error);
 
-Parser::DebugTextStreamBuffer::DebugTextStreamBuffer(GenericMessenger& m) :
-    TextStreamBuffer (1024*8, 160),
-    mMessenger(m)
-{
-    // do nothing
+    return consistent;
 }
 
-Parser::DebugTextStreamBuffer::~DebugTextStreamBuffer()
+void InstanceTransformer::Apply(ObjectPtr object, const vector<Operation>& operations)
 {
-    // do nothing
+    for (vector<Operation>::const_iterator i = operations.begin(); i != operations.end(); ++i)
+    {
+        switch (i->kind)
+        {
+            case kTranslate: Translate_Object(object, i->vector, &i->trans); break;
+            case kRotate:    Rotate_Object   (object, i->vector, &i->trans); break;
+            case kScale:     Scale_Object    (object, i->vector, &i->trans); break;
+            case kTransform: Transform_Object(object, &i->trans);            break;
+        }
+    }
 }
 
-void Parser::DebugTextStreamBuffer::lineoutput(const char *str, unsigned int chars)
+void InstanceTransformer::Work()
 {
-    char buffer[256];
+    Job job;
 
-    buffer[0] = 0;
-    strncat(buffer, str, min((unsigned int)255, chars));
+    boost::mutex::scoped_lock lock(mMutex);
 
-    mMessenger.UserDebug(buffer);
-}
+    while (true)
+    {
+        while (mQueue.empty() && !mStopping)
+        {
+            mIdleThreads++;
+            mQueued.wait(lock);
+            mIdleThreads--;
+        }
 
-void Parser::DebugTextStreamBuffer::directoutput(const char *, unsigned int)
-{
-    // do nothing
+        if (mQueue.empty())
+            return;
+
+        job.object = mQueue.front().object;
+        job.operations.swap(mQueue.front().operations);
+        mQueue.pop_front();
+
+        mBusyThreads++;
+
+        lock.unlock();
+
+        bool consistent = true;
+        try
+        {
+            // same as the tail end of Parse_Object_Mods and Parse_Object
+            Apply(job.object, job.operations);
+            Restrict_BBox(job.object);
+            consistent = job.object->Precompute();
+        }
+        catch (...)
+        {
+            boost::mutex::scoped_lock errorLock(mMutex);
+            if (!mError)
+                mError = std::current_exception();
+        }
+
+        lock.lock();
+
+        if (!consistent)
+            mConsistent = false;
+
+        mBusyThreads--;
+
+        if (mQueue.empty() && (mBusyThreads == 0))
+            mDone.notify_all();
+    }
 }
 
 /*****************************************************************************
@@ -10931,12 +13131,8 @@ OStream *Parser::CreateFile(const UCS2String& filename, unsigned int stype, bool
 
 /*****************************************************************************/
 
-Image *Parser::Read_Image(int filetype, const UCS2 *filename, const Image::ReadOptions& options)
+static void GetImageFileType(int filetype, unsigned int& stype, Image::ImageFileType& type)
 {
-    unsigned int stype;
-    Image::ImageFileType type;
-    UCS2String ign;
-
     switch(filetype)
     {
         case GIF_FILE:
@@ -10994,13 +13190,181 @@ Image *Parser::Read_Image(int filetype, const UCS2 *filename, const Image::ReadO
         default:
             throw POV_EXCEPTION(kDataTypeErr, "Unknown file type.");
     }
+}
+
+Image *Parser::Read_Image(int filetype, const UCS2 *filename, const Image::ReadOptions& options, bool tiled)
+{
+    unsigned int stype;
+    Image::ImageFileType type;
+    UCS2String resolvedName;
+
+    GetImageFileType(filetype, stype, type);
+
+    shared_ptr<IStream> file = Locate_File(filename, stype, resolvedName, true);
+
+    if (file == nullptr)
+        throw POV_EXCEPTION(kCannotOpenFileErr, "Cannot find image file.");
+
+    // share the decoded image with any other use of the same file, in this or earlier frames
+    ImageCache::Key key;
+    if (!ImageCache::MakeKey(key, resolvedName, filetype, file.get(), options))
+    {
+        if (tiled)
+            Warning("Cannot page in image file from tile cache file; reading it into memory instead.");
+        return Image::Read(type, file.get(), options);
+    }
+    key.tiled = tiled;
+
+    Image *image = ImageCache::Acquire(key, options);
+    if (image != nullptr)
+        return image;
+
+    if (tiled)
+    {
+        // use the tile cache file left by an earlier session if possible, otherwise convert the image once
+        char buffer[32];
+        std::sprintf(buffer, "povtiles%016llx.dat", (unsigned long long)key.GetSignature());
+        UCS2String tileFilename = PlatformBase::GetInstance().GetTemporaryPath() + ASCIItoUCS2String(buffer);
+        image = TiledImage::Open(tileFilename, key.GetSignature());
+        if (image == nullptr)
+        {
+            Image *decoded = Image::Read(type, file.get(), options);
+            if (decoded == nullptr)
+                return nullptr;
+            if (decoded->IsIndexed())
+            {
+                Warning("Colour-mapped images are not paged in from tile cache files.");
+                key.tiled = false;
+                return ImageCache::Insert(key, decoded, options);
+            }
+            try
+            {
+                TiledImage::Convert(tileFilename, key.GetSignature(), decoded);
+            }
+            catch (...)
+            {
+                delete decoded;
+                throw;
+            }
+            delete decoded;
+            image = TiledImage::Open(tileFilename, key.GetSignature());
+            if (image == nullptr)
+                throw POV_EXCEPTION(kFileDataErr, "Cannot read back image tile cache file.");
+        }
+    }
+    else
+        image = Image::Read(type, file.get(), options);
+
+    if (image != nullptr)
+        image = ImageCache::Insert(key, image, options);
+    return image;
+}
+
+/*****************************************************************************/
+
+/// Decodes an image file on the job scheduler while parsing continues.
+class Parser::ImageDecoder final : public PendingImage
+{
+    public:
+
+        ImageDecoder(Parser *parser, Image::ImageFileType type, const shared_ptr<IStream>& file,
+                     const Image::ReadOptions& options, const char *name) :
+            cached(false), mParser(parser), mType(type), mFile(file), mOptions(options), mName(name), mImage(nullptr)
+        {
+            mOptions.warnings.clear();
+            mJobs.Run(boost::bind(&ImageDecoder::Decode, this));
+        }
+
+        virtual ~ImageDecoder() override
+        {
+            try
+            {
+                mJobs.Wait();
+            }
+            catch (...)
+            {
+                // the image is being discarded anyway
+            }
+            delete mImage;
+        }
+
+        virtual Image *Wait() override
+        {
+            mJobs.Wait();
+            mFile.reset();
+
+            for (vector<string>::iterator it = mOptions.warnings.begin(); it != mOptions.warnings.end(); it++)
+                mParser->Warning("%s: %s", mName.c_str(), it->c_str());
+
+            Image *image = mImage;
+            mImage = nullptr;
+            if (image == nullptr)
+                mParser->Error("Cannot read image '%s'.", mName.c_str());
+            if (cached)
+                image = ImageCache::Insert(key, image, mOptions);
+            return image;
+        }
+
+        ImageCache::Key key;            ///< Image cache key, if @ref cached is set.
+        bool cached;                    ///< Whether the decoded image is to be shared via the image cache.
+
+    private:
+
+        Parser *mParser;
+        Image::ImageFileType mType;
+        shared_ptr<IStream> mFile;
+        Image::ReadOptions mOptions;
+        string mName;
+        Image *mImage;                  ///< Decoded image, until handed out by @ref Wait().
+        JobGroup mJobs;
+
+        void Decode()
+        {
+            mImage = Image::Read(mType, mFile.get(), mOptions);
+        }
+};
+
+void Parser::Read_Image_Deferred(ImageData *image, int filetype, const UCS2 *filename, const Image::ReadOptions& options, const char *name)
+{
+    unsigned int stype;
+    Image::ImageFileType type;
+    UCS2String resolvedName;
+
+    GetImageFileType(filetype, stype, type);
 
-    shared_ptr<IStream> file = Locate_File(filename, stype, ign, true);
+    shared_ptr<IStream> file = Locate_File(filename, stype, resolvedName, true);
 
     if (file == nullptr)
         throw POV_EXCEPTION(kCannotOpenFileErr, "Cannot find image file.");
 
-    return Image::Read(type, file.get(), options);
+    ImageCache::Key key;
+    bool cached = ImageCache::MakeKey(key, resolvedName, filetype, file.get(), options);
+    if (cached)
+    {
+        image->data = ImageCache::Acquire(key, options);
+        if (image->data != nullptr)
+            return;
+    }
+
+    shared_ptr<ImageDecoder> decoder(new ImageDecoder(this, type, file, options, name));
+    decoder->key = key;
+    decoder->cached = cached;
+
+    image->pending = decoder;
+    image->iwidth = image->iheight = 1;
+    image->width = image->height = 1.0;
+    mPendingImages.push_back(Copy_Image(image));
+}
+
+void Parser::Resolve_Images()
+{
+    while (!mPendingImages.empty())
+    {
+        ImageData *image = mPendingImages.back();
+        image->Resolve();
+        mPendingImages.pop_back();
+        Destroy_Image(image);
+    }
 }
 
 /*****************************************************************************/
@@ -11090,12 +13454,89 @@ void Parser::POV_ARRAY::Shrink()
     }
 }
 
-Parser::POV_ARRAY::POV_ARRAY(const POV_ARRAY& obj)
+// Packed storage of homogeneous numeric arrays.
+//
+// The elements of arrays of floats, vectors or colours are kept in a contiguous buffer owned by
+// the array, rather than in individually allocated objects, with `DataPtrs` pointing into that
+// buffer. Since generic code replaces or destroys an identifier's data through the `DataPtrs`
+// entry, any element about to be accessed in such a manner is first unpacked (i.e. replaced by an
+// individually allocated copy), and packed again once the access is complete; elements that may
+// be accessed via macro parameters passed by reference are never packed again.
+
+// A packed element always resides at the position in the buffer corresponding to its index.
+template<typename T>
+static inline bool IsPackedArrayElement(const vector<T>& buffer, const vector<void*>& dataPtrs, size_t i)
+{
+    return ((i < buffer.size()) && (dataPtrs[i] == &buffer[i]));
+}
+
+template<typename T>
+static void PackArrayElement(vector<T>& buffer, vector<void*>& dataPtrs, size_t i)
+{
+    if (i >= buffer.size())
+    {
+        // Grow the buffer, and point the packed elements to their new location.
+        vector<T> newBuffer(std::max(dataPtrs.size(), buffer.size() * 2));
+        for (size_t k = 0; k < buffer.size(); ++k)
+        {
+            newBuffer[k] = buffer[k];
+            if (IsPackedArrayElement(buffer, dataPtrs, k))
+                dataPtrs[k] = &newBuffer[k];
+        }
+        buffer.swap(newBuffer);
+    }
+    buffer[i] = *reinterpret_cast<const T*>(dataPtrs[i]);
+    dataPtrs[i] = &buffer[i];
+}
+
+bool Parser::POV_ARRAY::IsPacked(size_t i) const
+{
+    switch (Type_)
+    {
+        case FLOAT_ID_TOKEN:    return IsPackedArrayElement(PackedFloats,  DataPtrs, i);
+        case VECTOR_ID_TOKEN:   return IsPackedArrayElement(PackedVectors, DataPtrs, i);
+        case COLOUR_ID_TOKEN:   return IsPackedArrayElement(PackedColours, DataPtrs, i);
+        default:                return false;
+    }
+}
+
+void Parser::POV_ARRAY::Pack(size_t i)
+{
+    if (mixedType || aliased || (DataPtrs[i] == nullptr) || IsPacked(i))
+        return;
+    void* element = DataPtrs[i];
+    switch (Type_)
+    {
+        case FLOAT_ID_TOKEN:    PackArrayElement(PackedFloats,  DataPtrs, i); break;
+        case VECTOR_ID_TOKEN:   PackArrayElement(PackedVectors, DataPtrs, i); break;
+        case COLOUR_ID_TOKEN:   PackArrayElement(PackedColours, DataPtrs, i); break;
+        default:                return;
+    }
+    SymbolTable::Destroy_Ident_Data(element, Type_);
+}
+
+void Parser::POV_ARRAY::Unpack(size_t i)
+{
+    if (IsPacked(i))
+        DataPtrs[i] = SymbolTable::Copy_Identifier(DataPtrs[i], Type_);
+}
+
+void Parser::POV_ARRAY::Alias(size_t i)
+{
+    Unpack(i);
+    aliased = true;
+}
+
+Parser::POV_ARRAY::POV_ARRAY(const POV_ARRAY& obj) :
+    PackedFloats(obj.PackedFloats),
+    PackedVectors(obj.PackedVectors),
+    PackedColours(obj.PackedColours)
 {
     maxDim = obj.maxDim;
     Type_ = obj.Type_;
     resizable = obj.resizable;
     mixedType = obj.mixedType;
+    aliased = false;
     for (int i = 0; i < POV_ARRAY::kMaxDimensions; ++i)
     {
         Sizes[i] = obj.Sizes[i];
@@ -11103,14 +13544,26 @@ Parser::POV_ARRAY::POV_ARRAY(const POV_ARRAY& obj)
     }
     DataPtrs.resize(obj.DataPtrs.size());
     for (int i = 0; i < obj.DataPtrs.size(); i++)
-        DataPtrs[i] = SymbolTable::Copy_Identifier(obj.DataPtrs[i], obj.ElementType(i));
+    {
+        if (!obj.IsPacked(i))
+            DataPtrs[i] = SymbolTable::Copy_Identifier(obj.DataPtrs[i], obj.ElementType(i));
+        else if (Type_ == FLOAT_ID_TOKEN)
+            DataPtrs[i] = &PackedFloats[i];
+        else if (Type_ == VECTOR_ID_TOKEN)
+            DataPtrs[i] = &PackedVectors[i];
+        else
+            DataPtrs[i] = &PackedColours[i];
+    }
     Types = obj.Types;
 }
 
 Parser::POV_ARRAY::~POV_ARRAY()
 {
     for (int i = 0; i < this->DataPtrs.size(); ++i)
-        SymbolTable::Destroy_Ident_Data(this->DataPtrs[i], this->ElementType(i));
+    {
+        if (!IsPacked(i))
+            SymbolTable::Destroy_Ident_Data(this->DataPtrs[i], this->ElementType(i));
+    }
 }
 
 Parser::POV_ARRAY* Parser::POV_ARRAY::Clone() const
@@ -41,9 +41,17 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "parser/configparser.h"
 
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <set>
 #include <string>
+#include <unordered_set>
 
 #include "base/image/image.h"
+#include "base/memoryarena.h"
 #include "base/messenger.h"
 #include "base/stringutilities.h"
 #include "base/textstream.h"
@@ -53,6 +61,7 @@
 #include "core/material/pigment.h"
 #include "core/material/warp.h"
 #include "core/scene/camera.h"
+#include "core/shape/mesh.h"
 
 #include "parser/fncode.h"
 #include "parser/parsertypes.h"
@@ -189,6 +198,231 @@ struct BetaFlags
     {}
 };
 
+/// Profiler attributing parse time to macros, include files, loops and heavy objects.
+///
+/// Time is measured between matching @ref Enter() and @ref Leave() calls. Time spent
+/// in a nested frame counts towards the exclusive time of that frame only, and towards
+/// the inclusive time of all enclosing frames. Recursive invocations of the same
+/// construct count towards its inclusive time only once.
+class ParseProfiler final
+{
+    public:
+
+        enum Kind
+        {
+            kScene,
+            kInclude,
+            kMacro,
+            kWhileLoop,
+            kForLoop,
+            kObject,
+        };
+
+        /// Sentinel depth indicating that no frame was opened.
+        static const size_t kNoFrame = size_t(-1);
+
+        /// Open a frame for a construct, returning the depth to pass to @ref Leave().
+        /// @param  kind        Type of construct.
+        /// @param  name        Name of the construct, e.g. the macro name.
+        /// @param  fileName    File in which the construct is defined.
+        /// @param  line        Line at which the construct is defined, or 0 for whole files.
+        size_t Enter(Kind kind, const char* name, const UCS2* fileName, POV_LONG line);
+
+        /// Close the frame opened at the given depth, along with any frames nested in it.
+        /// @note   Frames still open inside constructs exited prematurely, e.g. by `#break`,
+        ///         are closed by the first @ref Leave() call for an enclosing frame.
+        void Leave(size_t depth);
+
+        /// Close all frames and write the collected statistics, by decreasing inclusive time.
+        void Report(TextStreamBuffer& out);
+
+        /// Helper class to time a construct for the lifetime of a scope.
+        class Scope final
+        {
+            public:
+                Scope(ParseProfiler* pProfiler, Kind kind, const char* name, const UCS2* fileName, POV_LONG line) :
+                    mpProfiler(pProfiler),
+                    mDepth(pProfiler != nullptr ? pProfiler->Enter(kind, name, fileName, line) : kNoFrame)
+                {}
+                ~Scope() { if (mpProfiler != nullptr) mpProfiler->Leave(mDepth); }
+            private:
+                ParseProfiler*  mpProfiler;
+                size_t          mDepth;
+        };
+
+    private:
+
+        using Clock = std::chrono::steady_clock;
+
+        struct Key
+        {
+            Kind        kind;
+            std::string name;
+            UCS2String  fileName;
+            POV_LONG    line;
+            bool operator<(const Key& o) const;
+        };
+
+        struct Entry
+        {
+            Clock::duration inclusive;
+            Clock::duration exclusive;
+            POV_LONG        count;
+            int             active;     ///< Number of open frames for this entry.
+            Entry() : inclusive(0), exclusive(0), count(0), active(0) {}
+        };
+
+        struct Frame
+        {
+            Entry*              pEntry;
+            Clock::time_point   start;
+            Clock::duration     nested;     ///< Time spent in nested frames.
+        };
+
+        std::map<Key, Entry>    mEntries;
+        vector<Frame>           maFrames;
+
+        static bool SortByInclusiveTime(const std::map<Key, Entry>::const_iterator& a,
+                                        const std::map<Key, Entry>::const_iterator& b);
+};
+
+/// Objects parsed in one animation frame that the next frame may use instead of parsing them again.
+///
+/// An object qualifies if neither its own statement nor anything that led up to it depends
+/// on the clock. Objects are identified by source location, and by how often that location
+/// has been visited so far, so that e.g. the 5th object created by a macro in one frame is
+/// matched with the 5th object created by the same macro in the next.
+class ReusableObjectCache final
+{
+    public:
+
+        struct Key
+        {
+            UCS2String  fileName;
+            POV_OFF_T   offset;
+            size_t      occurrence;
+            bool operator<(const Key& o) const;
+        };
+
+        /// Identifier assigned by the statement, to be re-assigned when the statement is skipped.
+        struct Assignment
+        {
+            int         table;  ///< Index of the symbol table.
+            UTF8String  name;
+            TokenId     type;
+            void*       data;
+        };
+
+        struct Entry
+        {
+            ObjectPtr                       object;
+            RawTokenizer::ColdBookmark      end;            ///< Position just past the object's statement.
+            vector<Assignment>              assignments;
+            vector<std::pair<int, unsigned int>> randomStates; ///< Final state of each random number generator used.
+        };
+
+        /// Sentinel occurrence indicating that a location has been visited in a clock-dependent context.
+        static const size_t kUnstable = size_t(-1);
+
+        ReusableObjectCache(const UCS2String& inputFile, POV_LONG runId);
+        ~ReusableObjectCache();
+
+        /// Count a visit to a source location, returning the occurrence number or @ref kUnstable.
+        size_t Visit(const UCS2String& fileName, POV_OFF_T offset, bool stable);
+
+        const Entry* Find(const Key& key) const;
+
+        /// Add an entry, taking ownership of its object and assignment data.
+        void Insert(const Key& key, const Entry& entry);
+
+        /// Move an entry over from another cache.
+        void Adopt(const Key& key, ReusableObjectCache& other);
+
+        bool Empty() const { return mEntries.empty(); }
+
+        /// Take the cache left by the previous frame of the same animation, if any.
+        static std::unique_ptr<ReusableObjectCache> Retrieve(const UCS2String& inputFile, POV_LONG runId);
+
+        /// Leave a cache for the next frame to pick up.
+        static void Retain(std::unique_ptr<ReusableObjectCache>&& pCache);
+
+    private:
+
+        UCS2String  mInputFile;
+        POV_LONG    mRunId;
+        std::map<Key, Entry> mEntries;
+        std::map<std::pair<UCS2String, POV_OFF_T>, size_t> mVisits;
+
+        static void Release(Entry& entry);
+};
+
+/// Applies the transformations of object copies on worker threads.
+///
+/// Loops scattering many instances of a declared compound object spend much of their time
+/// transforming each copy child by child. The parser queues such copies here and carries on
+/// parsing, waiting for the transformations only when it needs the objects again.
+///
+class InstanceTransformer final
+{
+    public:
+
+        enum OperationKind { kTranslate, kRotate, kScale, kTransform };
+
+        struct Operation
+        {
+            OperationKind   kind;
+            Vector3d        vector;
+            TRANSFORM       trans;
+        };
+
+        InstanceTransformer();
+
+        /// Destroy the transformer, after finishing all queued objects.
+        ~InstanceTransformer();
+
+        /// Queue an object to be transformed, taking over the operations.
+        ///
+        /// @note   The object must not be accessed until @ref Wait() has returned.
+        ///
+        void Submit(ObjectPtr object, vector<Operation>& operations);
+
+        /// Wait until all queued objects are finished.
+        ///
+        /// @note   Any error that occurred while transforming an object is re-thrown here.
+        ///
+        /// @return `false` if any object's parameters turned out inconsistent.
+        ///
+        bool Wait();
+
+        /// Apply transformations right away.
+        static void Apply(ObjectPtr object, const vector<Operation>& operations);
+
+    private:
+
+        struct Job
+        {
+            ObjectPtr           object;
+            vector<Operation>   operations;
+        };
+
+        std::deque<Job> mQueue;             ///< Objects waiting to be transformed.
+        boost::thread_group mThreads;       ///< Worker threads, started as needed.
+        unsigned int mMaxThreads;           ///< Maximum number of worker threads.
+        unsigned int mIdleThreads;          ///< Number of worker threads waiting for work.
+        unsigned int mBusyThreads;          ///< Number of worker threads transforming an object.
+        bool mStopping;                     ///< Set to make the worker threads exit once the queue is empty.
+        bool mConsistent;                   ///< Cleared if an object failed to precompute.
+        std::exception_ptr mError;          ///< First error that occurred while transforming an object.
+        boost::mutex mMutex;                ///< Protects all of the above except @ref mThreads.
+        boost::condition_variable mQueued;  ///< Signalled when an object is queued or the transformer is stopping.
+        boost::condition_variable mDone;    ///< Signalled when the last queued object is finished.
+
+        void Work();
+
+        InstanceTransformer(const InstanceTransformer&) = delete;
+        InstanceTransformer& operator=(const InstanceTransformer&) = delete;
+};
+
 /*****************************************************************************
 * Global typedefs
 ******************************************************************************/
@@ -227,6 +461,8 @@ class Parser
 
         // tokenize.h/tokenize.cpp
 
+        struct POV_ARRAY;
+
         /// Structure holding information about the current token
         struct Token_Struct : MessageContext
         {
@@ -240,12 +476,16 @@ class Parser
             TokenId *NumberPtr;
             void **DataPtr;
             SymbolTable* table;                             ///< table or dictionary the token references an element of
+            POV_ARRAY* array;                               ///< array the token references an element of (if @ref is_array_elem is set)
+            size_t arrayIndex;                              ///< linear index of the array element (if @ref is_array_elem is set)
             bool Unget_Token            : 1;                ///< `true` if @ref Get_Token() must re-issue this token as-is.
             bool ungetRaw               : 1;                ///< `true` if @ref Get_Token() must re-evaluate this token from raw.
             bool End_Of_File            : 1;
             bool is_array_elem          : 1;                ///< true if token is actually an array element reference
             bool is_mixed_array_elem    : 1;                ///< true if token is actually a mixed-type array element reference
             bool is_dictionary_elem     : 1;                ///< true if token is actually a dictionary element reference
+            bool is_parameter_ref       : 1;                ///< true if token was resolved via a by-reference macro parameter
+            void **rootDataPtr;                             ///< value slot of the identifier a container element belongs to, or @ref DataPtr
 
             virtual UCS2String GetFileName() const override { return sourceFile->Name(); }
             virtual POV_LONG GetLine() const override { return raw.lexeme.position.line; }
@@ -259,8 +499,14 @@ class Parser
             void**       dataPtr;
             TokenId      previous;
             SYM_ENTRY*   symEntry;
+            POV_ARRAY*   array;
+            size_t       arrayIndex;
+            void**       rootDataPtr;   ///< Slot of the outermost container, if the identifier is a container element.
             bool         allowRedefine : 1;
             bool         optional      : 1;
+            bool         viaParameter  : 1;
+            int          context;       ///< Index of the symbol table holding the identifier.
+            UTF8String   name;          ///< Name of the identifier, or empty if it is a container element.
         };
 
         struct MacroParameter
@@ -278,8 +524,7 @@ class Parser
             RawTokenizer::ColdBookmark source;
             LexemePosition endPosition; ///< The position _after_ the `#` in the terminating `#end` directive.
             vector<MacroParameter> parameters;
-            unsigned char *Cache;
-            size_t CacheSize;
+            TokenCacheStreamPtr Cache;  ///< Pre-tokenized macro body, if available.
         };
 
         struct POV_ARRAY : public Assignable
@@ -291,8 +536,12 @@ class Parser
             size_t Mags[kMaxDimensions];
             vector<void*> DataPtrs;
             vector<TokenId> Types;
+            vector<DBL> PackedFloats;               ///< Contiguous storage of packed float elements.
+            vector<Vector3d> PackedVectors;         ///< Contiguous storage of packed vector elements.
+            vector<RGBFTColour> PackedColours;      ///< Contiguous storage of packed colour elements.
             bool resizable : 1;
             bool mixedType : 1;
+            bool aliased : 1;                       ///< Whether elements may be referenced by macro parameters.
             bool IsInitialized() const;
             bool HasElement(size_t i) const;
             const TokenId& ElementType(size_t i) const;
@@ -302,6 +551,10 @@ class Parser
             void GrowBy(size_t delta);
             void GrowTo(size_t delta);
             void Shrink();
+            bool IsPacked(size_t i) const;
+            void Pack(size_t i);
+            void Unpack(size_t i);
+            void Alias(size_t i);
             POV_ARRAY() = default;
             POV_ARRAY(const POV_ARRAY& obj);
             virtual ~POV_ARRAY();
@@ -405,6 +658,8 @@ class Parser
         ObjectPtr Parse_Object_Mods (ObjectPtr Object);
 
         ObjectPtr Parse_Object (void);
+        ObjectPtr Parse_Reusable_Object (void);
+        ObjectPtr Parse_Object_Instance (vector<InstanceTransformer::Operation>& operations);
         void Parse_Bound_Clip (vector<ObjectPtr>& objects, bool notexture = true);
         void Parse_Default (void);
         void Parse_Declare (bool is_local, bool after_hash);
@@ -442,7 +697,16 @@ class Parser
         shared_ptr<IStream> Locate_File(const UCS2String& formalFileName, unsigned int stype, UCS2String& actualFileName, bool err_flag = false);
 
         OStream *CreateFile(const UCS2String& filename, unsigned int stype, bool append);
-        Image *Read_Image(int filetype, const UCS2 *filename, const Image::ReadOptions& options);
+        Image *Read_Image(int filetype, const UCS2 *filename, const Image::ReadOptions& options, bool tiled = false);
+
+        /// Start reading an image file in the background, leaving the decode pending in the image.
+        ///
+        /// If the image is available from the image cache, it is attached right away instead.
+        ///
+        void Read_Image_Deferred(ImageData *image, int filetype, const UCS2 *filename, const Image::ReadOptions& options, const char *name);
+
+        /// Wait for all images still being read in the background.
+        void Resolve_Images();
 
         // tokenize.h/tokenize.cpp
         void Get_Token (void);
@@ -485,6 +749,8 @@ class Parser
         void Parse_Version();
         void Open_Include (void);
         void IncludeHeader(const UCS2String& temp);
+        shared_ptr<IStream> Open_Cached_Include(const shared_ptr<IStream>& is);
+        shared_ptr<IStream> Map_Text_File(const shared_ptr<IStream>& is, const UCS2String& actualFileName);
         void pre_init_tokenizer (void);
         void Initialize_Tokenizer (void);
         void Terminate_Tokenizer (void);
@@ -567,6 +833,7 @@ class Parser
         char *Parse_C_String(bool pathname = false);
         void ParseString(UTF8String& s, bool pathname = false);
         UCS2 *Parse_String(bool pathname = false, bool require = true);
+        AssignableString *Parse_String_Value(bool pathname = false);
         std::string Parse_ASCIIString(bool pathname = false, bool require = true);
 
         UCS2 *String_Literal_To_UCS2(const std::string& str);
@@ -639,6 +906,85 @@ class Parser
 
         Camera Default_Camera;
 
+        /// Builds mesh bounding trees while parsing continues.
+        MeshTreeBuilder mMeshTreeBuilder;
+
+        class ImageDecoder;
+
+        /// Images with a decode that may still be pending, each holding a reference.
+        vector<ImageData *> mPendingImages;
+
+        /// Transforms copies of declared compound objects while parsing continues.
+        InstanceTransformer mInstanceTransformer;
+
+        /// Holds the nodes of function expression trees while they are being compiled.
+        MemoryArena mExpressionArena;
+
+        /// Number of expression trees in @ref mExpressionArena that have not been deleted yet.
+        unsigned int mExpressionTrees;
+
+        /// @name Compiled Assignments
+        /// Float expressions assigned by `#declare` or `#local` inside loops and macros are
+        /// compiled into functions once they are seen again, and subsequently evaluated by the
+        /// virtual machine instead of being parsed anew, as long as the identifiers they refer to
+        /// still hold floats.
+        /// @{
+
+        struct CompiledRValue
+        {
+            std::weak_ptr<IStream>      stream;     ///< Stream the expression was found in.
+            RawTokenizer::ColdBookmark  end;        ///< Position just before the terminating semicolon.
+            vector<UTF8String>          names;      ///< Identifiers the expression refers to, in order of parameters.
+            vector<SymbolHash>          hashes;     ///< Hashes of @ref names.
+            FUNCTION                    fn;
+            int                         tokens;     ///< Number of tokens making up the expression.
+            int                         sightings;  ///< Number of times the expression has been parsed conventionally.
+            bool                        compiled;
+            bool                        uncacheable;
+            CompiledRValue() : fn(0), tokens(0), sightings(0), compiled(false), uncacheable(false) {}
+        };
+
+        using CompiledRValueKey = std::pair<const IStream*, POV_OFF_T>;
+
+        std::map<CompiledRValueKey, CompiledRValue> maCompiledRValues;
+        size_t mCompiledRValuesPurgeSize;   ///< Size of @ref maCompiledRValues at which to drop stale entries.
+        bool mCompilingRValue;              ///< Whether the function syntax parser is compiling an assignment.
+
+        /// @}
+
+        /// Parse-time profiler, or `nullptr` if profiling is disabled.
+        std::unique_ptr<ParseProfiler> mpProfiler;
+
+        /// @name Incremental Animation
+        /// Bookkeeping to tell which objects do not depend on the clock and may be carried over
+        /// to the next frame. All of this is inactive unless @ref mpReusableObjects is set.
+        /// @{
+
+        std::unique_ptr<ReusableObjectCache> mpReusableObjects;     ///< Objects of this frame the next frame may reuse.
+        std::unique_ptr<ReusableObjectCache> mpPreviousObjects;     ///< Objects the previous frame left for reuse.
+        std::unordered_set<const void*> maClockDependentData;       ///< Identifier value slots and arrays that depend on the clock.
+        vector<bool>    maClockDependentRandom;                     ///< Random number generators whose state depends on the clock.
+        POV_LONG        mClockDependentReads;                       ///< Number of clock-dependent values read so far.
+        int             mSubscriptDepth;                            ///< Nesting depth of array and dictionary subscripts.
+        int             mObjectBodyDepth;                           ///< Nesting depth of objects parsed for reuse.
+        int             mObjectBodyTable;                           ///< Local symbol table index at the start of the object.
+        bool            mObjectBodyImpure;                          ///< Whether the object's statement had effects that cannot be replayed.
+        std::set<std::pair<int, UTF8String>> maObjectBodyAssignments;   ///< Non-local identifiers assigned by the object's statement.
+        std::set<int>   maObjectBodyRandom;                         ///< Random number generators used by the object's statement.
+        bool            mObjectReuseDisabled;                       ///< Whether something happened that rules out reuse for the rest of the frame.
+
+        int ClockDependentContextTable() const;
+        void NoteClockRead() { ++mClockDependentReads; }
+        void NoteRead(const void* p) { if ((mpReusableObjects != nullptr) && (maClockDependentData.count(p) != 0)) ++mClockDependentReads; }
+        void NoteCondition(POV_LONG readsBefore);
+        void NoteAssignment(void** dataPtr, const void* container, int table, const UTF8String* name, bool dependentLocation, bool dependentValue);
+        void NoteAssignment(const LValue& lvalue, bool dependentLocation, bool dependentValue);
+        void NoteRandomDraw(int stream);
+        void NoteSideEffect() { if (mObjectBodyDepth > 0) mObjectBodyImpure = true; }
+        void NoteGlobalEffect(POV_LONG readsBefore);
+
+        /// @}
+
         // tokenize.h/tokenize.cpp
         typedef enum cond_type
         {
@@ -667,9 +1013,12 @@ class Parser
             RawTokenizer::HotBookmark   returnToBookmark;
             int                         condStackSize;
             int                         braceStackSize;
+            size_t                      profileDepth;   ///< Profiler frame depth of the include file.
+            int                         clockDependentTable; ///< Local symbol table index if the file name depends on the clock, or -1.
 
             IncludeStackEntry(const RawTokenizer::HotBookmark& rtb, int css, int bss) :
-                returnToBookmark(rtb), condStackSize(css), braceStackSize(bss)
+                returnToBookmark(rtb), condStackSize(css), braceStackSize(bss), profileDepth(ParseProfiler::kNoFrame),
+                clockDependentTable(-1)
             {}
         };
         vector<IncludeStackEntry> maIncludeStack;
@@ -685,7 +1034,9 @@ class Parser
             UTF8String Loop_Identifier;
             DBL For_Loop_End;
             DBL For_Loop_Step;
-            CS_ENTRY() : Cond_Type(BUSY_COND), PMac(nullptr) {}
+            size_t profileDepth;    ///< Profiler frame depth of the loop or macro invocation.
+            int clockDependentTable; ///< Local symbol table index if the condition depends on the clock, or -1.
+            CS_ENTRY() : Cond_Type(BUSY_COND), PMac(nullptr), profileDepth(ParseProfiler::kNoFrame), clockDependentTable(-1) {}
             ~CS_ENTRY() {}
         };
 
@@ -734,7 +1085,9 @@ class Parser
         ObjectPtr Parse_Cylinder(void);
         ObjectPtr Parse_Disc(void);
         ObjectPtr Parse_Julia_Fractal(void);
+        ObjectPtr Parse_Hair();
         ObjectPtr Parse_HField(void);
+        ObjectPtr Parse_Instance();
         ObjectPtr Parse_Lathe(void);
         ObjectPtr Parse_Lemon();
         ObjectPtr Parse_Light_Source();
@@ -744,6 +1097,7 @@ class Parser
 
         ObjectPtr Parse_Ovus();
         ObjectPtr Parse_Plane();
+        ObjectPtr Parse_Point_Cloud();
         ObjectPtr Parse_Poly(int order);
         ObjectPtr Parse_Polynom();
         ObjectPtr Parse_Polygon();
@@ -763,6 +1117,9 @@ class Parser
 #endif
         void Parse_Mesh1 (Mesh*);
         void Parse_Mesh2 (Mesh*);
+        void Parse_Mesh_File (Mesh*);
+        UCS2String Parse_Mesh_Save_File ();
+        void Save_Mesh_File (const Mesh*, const UCS2String&);
 
         TEXTURE *Parse_Mesh_Texture(TEXTURE **t2, TEXTURE **t3);
         ObjectPtr Parse_TrueType(void);
@@ -780,6 +1137,9 @@ class Parser
         void Link(ObjectPtr New_Object, vector<ObjectPtr>& Object_List_Root);
         void Link_To_Frame(ObjectPtr Object);
         void Post_Process(ObjectPtr Object, ObjectPtr Parent);
+        bool Tighten_BBox(ObjectPtr Object);
+        void Tighten_BBoxes();
+        void Share_Materials();
 
         void Parse_Global_Settings();
         void Global_Setting_Warn();
@@ -813,6 +1173,7 @@ class Parser
         void Parse_Fopen(void);
         void Parse_Fclose(void);
         void Parse_Read(void);
+        void Parse_Array_Read(POV_ARRAY *a);
         void Parse_Write(void);
         int Parse_Read_Value(DATA_FILE *User_File, TokenId Previous, TokenId *NumberPtr, void **DataPtr);
         bool Parse_Read_Float_Value(DBL& val, DATA_FILE *User_File);
@@ -823,6 +1184,7 @@ class Parser
 
         // parstxtr.h/parstxtr.cpp
         void Make_Pattern_Image(ImageData *image, FUNCTION_PTR fn, int token);
+        void Bake_Pigment(PIGMENT *Pigment, int width, int height);
 
         PatternPtr ParseDensityFilePattern();
         PatternPtr ParseImagePattern();
@@ -850,6 +1212,7 @@ class Parser
         UCS2 *Parse_Str(bool pathname);
         UCS2 *Parse_VStr(bool pathname);
         UCS2 *Parse_Concat(bool pathname);
+        AssignableString *Parse_Concat_Value(bool pathname);
         UCS2 *Parse_Chr(bool pathname);
         UCS2 *Parse_Datetime(bool pathname);
         UCS2 *Parse_Substr(bool pathname);
@@ -865,6 +1228,9 @@ class Parser
         int Parse_Inside();
         bool Parse_Call();
         DBL Parse_Function_Call();
+        bool Parse_Compiled_RValue(TokenId Previous, TokenId *NumberPtr, void **DataPtr, bool allow_redefine);
+        bool Compile_RValue(CompiledRValue& entry, const RawTokenizer::HotBookmark& start);
+        void Release_Compiled_RValue(CompiledRValue& entry);
         void Parse_Vector_Function_Call(EXPRESS& Express, int *Terms);
         void Parse_Spline_Call(EXPRESS& Express, int *Terms);
 
@@ -900,6 +1266,7 @@ class Parser
         ExprNode *FNSyntax_ParseExpression();
         ExprNode *FNSyntax_GetTrapExpression(unsigned int);
         void FNSyntax_DeleteExpression(ExprNode *);
+        void delete_expr(ExprNode *node);
 
         ExprNode *parse_expr();
         TokenId expr_get_token();
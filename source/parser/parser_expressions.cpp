@@ -38,6 +38,7 @@
 
 // C++ variants of C standard header files
 #include <cctype>
+#include <cmath>
 #include <cstdlib>
 
 // C++ standard header files
@@ -247,6 +248,9 @@ void Parser::Parse_Trace(Vector3d& Res)
     Ray ray(ticket);
     Vector3d Local_Normal;
 
+    // Mesh bounding trees may still be under construction.
+    mMeshTreeBuilder.Wait();
+
     Parse_Paren_Begin();
 
     EXPECT_ONE
@@ -332,6 +336,9 @@ int Parser::Parse_Inside()
     Vector3d Local_Vector;
     int Result = 0;
 
+    // Mesh bounding trees may still be under construction.
+    mMeshTreeBuilder.Wait();
+
     Parse_Paren_Begin();
 
     EXPECT_ONE
@@ -480,6 +487,419 @@ DBL Parser::Parse_Function_Call()
     return result;
 }
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parse_Compiled_RValue
+*
+* INPUT
+*
+*   Previous, allow_redefine - as for Parse_RValue
+*
+* OUTPUT
+*
+*   NumberPtr, DataPtr - the identifier to assign to
+*
+* RETURNS
+*
+*   bool - whether the expression has been evaluated from its compiled form
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Evaluate the float expression of a `#declare` or `#local` inside a loop
+*   or macro from its compiled form, skipping over its tokens. Expressions
+*   are compiled when they are parsed for the second time; until then, or
+*   if the expression does not qualify, or if any of the identifiers it
+*   refers to no longer holds a float, nothing is consumed and the caller
+*   parses the expression conventionally.
+*
+*   Only operators and functions whose virtual machine implementation gives
+*   the same results as the parser's are accepted. Non-finite results are
+*   left to the parser as well, so that its warnings and errors are issued
+*   as usual.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool Parser::Parse_Compiled_RValue(TokenId Previous, TokenId *NumberPtr, void **DataPtr, bool allow_redefine)
+{
+    DBL params[MAX_FUNCTION_PARAMETER_LIST];
+    void **dataPtrs[MAX_FUNCTION_PARAMETER_LIST];
+    bool repeated = false;
+
+    if (mToken.Unget_Token || mHavePendingRawToken)
+        return false;
+
+    for (vector<CS_ENTRY>::const_iterator i = Cond_Stack.begin(); i != Cond_Stack.end(); ++i)
+    {
+        if ((i->Cond_Type == WHILE_COND) || (i->Cond_Type == FOR_COND) || (i->Cond_Type == INVOKING_MACRO_COND))
+            repeated = true;
+    }
+    if (!repeated)
+        return false;
+
+    RawTokenizer::HotBookmark start = mTokenizer.GetHotBookmark();
+
+    if (maCompiledRValues.size() >= mCompiledRValuesPurgeSize)
+    {
+        // drop entries for streams that have been closed, e.g. by macros re-opening their file
+        for (std::map<CompiledRValueKey, CompiledRValue>::iterator i = maCompiledRValues.begin(); i != maCompiledRValues.end(); )
+        {
+            if (i->second.stream.expired())
+            {
+                Release_Compiled_RValue(i->second);
+                i = maCompiledRValues.erase(i);
+            }
+            else
+                ++i;
+        }
+        mCompiledRValuesPurgeSize = max(size_t(1024), maCompiledRValues.size() * 2);
+    }
+
+    CompiledRValue& entry = maCompiledRValues[CompiledRValueKey(start.pStream.get(), start.offset)];
+    if (entry.stream.lock() != start.pStream)
+    {
+        // new entry, or a stale one for a stream that happened to occupy the same memory
+        Release_Compiled_RValue(entry);
+        entry = CompiledRValue();
+        entry.stream = start.pStream;
+    }
+
+    if (entry.uncacheable)
+        return false;
+
+    if (!entry.compiled)
+    {
+        if (++entry.sightings < 2)
+            return false;
+        if (!Compile_RValue(entry, start))
+            entry.uncacheable = true;
+        // this time round, leave the expression to the parser
+        return false;
+    }
+
+    for (size_t i = 0; i < entry.names.size(); ++i)
+    {
+        SYM_ENTRY *symbol = mSymbolStack.Find_Symbol(entry.names[i], entry.hashes[i]);
+        if ((symbol == nullptr) || symbol->deprecated)
+            return false;
+        TokenId *numberPtr = &(symbol->Token_Number);
+        void **dataPtr = &(symbol->Data);
+        if (*numberPtr == PARAMETER_ID_TOKEN)
+        {
+            POV_PARAM *par = reinterpret_cast<POV_PARAM *>(symbol->Data);
+            numberPtr = par->NumberPtr;
+            dataPtr = par->DataPtr;
+        }
+        if ((*numberPtr != FLOAT_ID_TOKEN) || (*dataPtr == nullptr))
+            return false;
+        params[i] = *reinterpret_cast<DBL *>(*dataPtr);
+        dataPtrs[i] = dataPtr;
+    }
+
+    for (size_t i = 0; i < entry.names.size(); ++i)
+        fnVMContext->SetLocal(i, params[i]);
+    DBL result = POVFPU_Run(fnVMContext, entry.fn);
+    if (!std::isfinite(result))
+        return false;
+
+    RawTokenizer::HotBookmark end(start.pStream, entry.end, entry.end.characterEncoding,
+                                  entry.end.nominalEndOfLine, entry.end.allowNestedBlockComments);
+    if (!GoToBookmark(end))
+    {
+        GoToBookmark(start); // TODO handle errors
+        return false;
+    }
+
+    for (size_t i = 0; i < entry.names.size(); ++i)
+        NoteRead(dataPtrs[i]);
+    mTokenCount += entry.tokens;
+    mTokensSinceLastProgressReport += entry.tokens;
+
+    *NumberPtr = FLOAT_ID_TOKEN;
+    Test_Redefine(Previous, NumberPtr, *DataPtr, allow_redefine);
+    *DataPtr   = reinterpret_cast<void *>(Create_Float());
+    *(reinterpret_cast<DBL *>(*DataPtr)) = result;
+
+    return true;
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Compile_RValue
+*
+* INPUT
+*
+*   entry - cache entry to fill in
+*   start - position of the expression
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   bool - whether the expression could be compiled
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Check whether the expression at the given position qualifies for
+*   compilation and, if so, compile it into a function taking the values of
+*   the identifiers it refers to as parameters. The expression must consist
+*   of float literals, identifiers currently holding floats, `pi`, `tau`,
+*   the four basic arithmetic operators, parentheses and a selection of
+*   internal functions, and must be terminated by a semicolon.
+*
+*   In either case, the tokenizer is returned to the given position.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+bool Parser::Compile_RValue(CompiledRValue& entry, const RawTokenizer::HotBookmark& start)
+{
+    // maximum number of tokens an expression may span to be compiled
+    const int kMaxCompiledRValueTokens = 256;
+
+    struct Paren
+    {
+        int args;
+        int minArgs;
+        int maxArgs;
+    };
+
+    vector<Paren> parens;
+    RawToken raw;
+    bool operand = true;
+    bool done = false;
+    int tokens = 0;
+
+    while (!done)
+    {
+        RawTokenizer::HotBookmark before = mTokenizer.GetHotBookmark();
+
+        if ((tokens >= kMaxCompiledRValueTokens) || !mTokenizer.GetNextToken(raw))
+            break;
+
+        if (operand)
+        {
+            Paren paren = { 0, 0, 0 };
+            switch (raw.GetTokenId())
+            {
+                case FLOAT_TOKEN:
+                case PI_TOKEN:
+                case TAU_TOKEN:
+                    operand = false;
+                    break;
+
+                case IDENTIFIER_TOKEN:
+                    {
+                        SYM_ENTRY *symbol = mSymbolStack.Find_Symbol(raw.lexeme.text, raw.symbolHash);
+                        if ((symbol == nullptr) || symbol->deprecated)
+                        {
+                            done = true;
+                            break;
+                        }
+                        TokenId number = symbol->Token_Number;
+                        if (number == PARAMETER_ID_TOKEN)
+                            number = *(reinterpret_cast<POV_PARAM *>(symbol->Data)->NumberPtr);
+                        if (number != FLOAT_ID_TOKEN)
+                        {
+                            done = true;
+                            break;
+                        }
+                        if (std::find(entry.names.begin(), entry.names.end(), raw.lexeme.text) == entry.names.end())
+                        {
+                            entry.names.push_back(raw.lexeme.text);
+                            entry.hashes.push_back(raw.symbolHash);
+                        }
+                        operand = false;
+                    }
+                    break;
+
+                case PLUS_TOKEN:
+                case DASH_TOKEN:
+                    break;
+
+                case LEFT_PAREN_TOKEN:
+                    parens.push_back(paren);
+                    break;
+
+                case ABS_TOKEN:
+                case ACOS_TOKEN:
+                case ACOSH_TOKEN:
+                case ASIN_TOKEN:
+                case ASINH_TOKEN:
+                case ATAN_TOKEN:
+                case ATANH_TOKEN:
+                case CEIL_TOKEN:
+                case COS_TOKEN:
+                case COSH_TOKEN:
+                case EXP_TOKEN:
+                case FLOOR_TOKEN:
+                case SIN_TOKEN:
+                case SINH_TOKEN:
+                case SQRT_TOKEN:
+                case TAN_TOKEN:
+                case TANH_TOKEN:
+                    paren.args = 1;
+                    paren.minArgs = 1;
+                    paren.maxArgs = 1;
+                    break;
+
+                case MAX_TOKEN:
+                case MIN_TOKEN:
+                    paren.args = 1;
+                    paren.minArgs = 2;
+                    paren.maxArgs = kMaxCompiledRValueTokens;
+                    break;
+
+                default:
+                    done = true;
+                    break;
+            }
+
+            if (paren.args > 0)
+            {
+                ++tokens;
+                if (!mTokenizer.GetNextToken(raw) || (raw.GetTokenId() != LEFT_PAREN_TOKEN))
+                    break;
+                parens.push_back(paren);
+            }
+        }
+        else
+        {
+            switch (raw.GetTokenId())
+            {
+                case PLUS_TOKEN:
+                case DASH_TOKEN:
+                case STAR_TOKEN:
+                case SLASH_TOKEN:
+                    operand = true;
+                    break;
+
+                case RIGHT_PAREN_TOKEN:
+                    if (parens.empty() || (parens.back().args < parens.back().minArgs))
+                        done = true;
+                    else
+                        parens.pop_back();
+                    break;
+
+                case COMMA_TOKEN:
+                    if (parens.empty() || (parens.back().args >= parens.back().maxArgs))
+                        done = true;
+                    else
+                    {
+                        ++parens.back().args;
+                        operand = true;
+                    }
+                    break;
+
+                case SEMI_COLON_TOKEN:
+                    if (parens.empty())
+                    {
+                        entry.end = RawTokenizer::ColdBookmark(before.GetFileName(), before, before.characterEncoding,
+                                                               before.nominalEndOfLine, before.allowNestedBlockComments);
+                        entry.tokens = tokens;
+                        entry.compiled = true;
+                    }
+                    done = true;
+                    break;
+
+                default:
+                    done = true;
+                    break;
+            }
+        }
+
+        ++tokens;
+    }
+
+    if (!GoToBookmark(start))
+        Error("Unable to seek back to expression."); // should never happen
+
+    if (!entry.compiled || entry.names.empty() || (entry.names.size() > MAX_FUNCTION_PARAMETER_LIST) || (entry.tokens < 3))
+    {
+        entry.compiled = false;
+        return false;
+    }
+
+    // compile the expression as-is, since the optimiser may regroup constants and change the result
+    FunctionCode function;
+    FNCode f(this, &function, false, nullptr);
+    function.parameter_cnt = entry.names.size();
+    for (size_t i = 0; i < entry.names.size(); ++i)
+        function.parameter[i] = POV_STRDUP(entry.names[i].c_str());
+
+    mCompilingRValue = true;
+    mExpressionTrees++;
+    ExprNode *expression = parse_expr();
+    mCompilingRValue = false;
+    f.Compile(expression);
+    FNSyntax_DeleteExpression(expression);
+
+    entry.fn = mpFunctionVM->AddFunction(&function);
+
+    // return to the start of the expression, for the parser to take it from there
+    if (!GoToBookmark(start))
+        Error("Unable to seek back to expression."); // should never happen
+    mToken.Unget_Token = false;
+    InvalidateCurrentToken();
+
+    return true;
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Release_Compiled_RValue
+*
+* INPUT
+*
+*   entry - cache entry
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Release the function compiled for an assignment, if any.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+void Parser::Release_Compiled_RValue(CompiledRValue& entry)
+{
+    if (entry.compiled)
+        mpFunctionVM->RemoveFunction(entry.fn);
+    entry.compiled = false;
+}
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -776,6 +1196,7 @@ void Parser::Parse_Num_Factor (EXPRESS& Express,int *Terms)
                     break;
 
                 case CLOCK_TOKEN:
+                    NoteClockRead();
                     Val = clockValue;
                     break;
 
@@ -805,6 +1226,7 @@ void Parser::Parse_Num_Factor (EXPRESS& Express,int *Terms)
                     break;
 
                 case FILE_EXISTS_TOKEN:
+                    NoteClockRead(); // files may come and go between frames
                     Parse_Paren_Begin();
 
                     Local_C_String=Parse_C_String();
@@ -1025,9 +1447,11 @@ void Parser::Parse_Num_Factor (EXPRESS& Express,int *Terms)
 
                 case STRLEN_TOKEN:
                     Parse_Paren_Begin();
-                    Local_String=Parse_String();
-                    Val = (DBL)UCS2_strlen(Local_String);
-                    POV_FREE(Local_String);
+                    {
+                        AssignableString *str = Parse_String_Value();
+                        Val = (DBL)str->size();
+                        delete str;
+                    }
                     Parse_Paren_End();
                     break;
 
@@ -1075,13 +1499,25 @@ void Parser::Parse_Num_Factor (EXPRESS& Express,int *Terms)
                     break;
 
                 case SEED_TOKEN:
-                    Val = stream_seed((int)Parse_Float_Param());
+                    {
+                        POV_LONG reads = mClockDependentReads;
+                        i = (int)Parse_Float_Param();
+                        // adding a generator renumbers all subsequent ones
+                        NoteGlobalEffect(mClockDependentReads);
+                        Val = stream_seed(i);
+                        if (mpReusableObjects != nullptr)
+                        {
+                            maClockDependentRandom.resize(Number_Of_Random_Generators, false);
+                            maClockDependentRandom[(int)Val] = (mClockDependentReads != reads) || (ClockDependentContextTable() >= 0);
+                        }
+                    }
                     break;
 
                 case RAND_TOKEN:
                     i = (int)Parse_Float_Param();
                     if ((i < 0) || (i >= Number_Of_Random_Generators))
                         Error("Illegal random number generator.");
+                    NoteRandomDraw(i);
                     Val = stream_rand(i);
                     break;
 
@@ -1110,6 +1546,7 @@ void Parser::Parse_Num_Factor (EXPRESS& Express,int *Terms)
                     break;
 
                 case NOW_TOKEN:
+                    NoteClockRead();
                     {
                         static boost::posix_time::ptime y2k(boost::gregorian::date(2000,1,1));
                         boost::posix_time::ptime now(boost::posix_time::microsec_clock::universal_time());
@@ -1231,6 +1668,7 @@ void Parser::Parse_Num_Factor (EXPRESS& Express,int *Terms)
                             Pigment = CurrentTokenDataPtr<PIGMENT*>();
                             if (const ImagePatternImpl *pattern = dynamic_cast<ImagePatternImpl*>(Pigment->pattern.get()))
                             {
+                                pattern->pImage->Resolve();
                                 Vect[X] = pattern->pImage->iwidth;
                                 Vect[Y] = pattern->pImage->iheight;
                                 Vect[Z] = 0;
@@ -3705,6 +4143,7 @@ GenericSpline *Parser::Parse_Spline()
             Error("Spline must have at least one entry.");
 
     New->Terms = MaxTerms; // keep number of supplied terms
+    New->Precompute();
 
     Allow_Identifier_In_Call = old_allow_id;
 
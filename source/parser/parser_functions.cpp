@@ -177,6 +177,7 @@ ExprNode *Parser::FNSyntax_ParseExpression()
 {
     ExprNode *expression = nullptr;
 
+    mExpressionTrees++;
     expression = parse_expr();
     optimise_expr(expression);
 
@@ -218,6 +219,7 @@ ExprNode *Parser::FNSyntax_GetTrapExpression(unsigned int trap)
 {
     ExprNode *expression = nullptr;
 
+    mExpressionTrees++;
     expression = new_expr_node(0, OP_TRAP);
     expression->trap = trap;
 
@@ -245,44 +247,67 @@ ExprNode *Parser::FNSyntax_GetTrapExpression(unsigned int trap)
 *
 * DESCRIPTION
 *
-*   Delete an expression (sub-) tree.
+*   Delete an expression tree obtained from FNSyntax_ParseExpression or
+*   FNSyntax_GetTrapExpression.
+*
+*   Expression nodes are allocated from an arena, which is reset once the
+*   last outstanding tree has been deleted.
 *
 * CHANGES
 *
-*   -
+*   Oct 2026 : Nodes are allocated from an arena.
 *
 ******************************************************************************/
 
 void Parser::FNSyntax_DeleteExpression(ExprNode *node)
 {
-    ExprNode *temp = nullptr;
+    delete_expr(node);
+
+    if ((mExpressionTrees > 0) && (--mExpressionTrees == 0))
+        mExpressionArena.Reset();
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   delete_expr
+*
+* INPUT
+*
+*   node - root node of the (sub-) tree to delete
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Delete an expression (sub-) tree, releasing the functions it references.
+*   The nodes themselves remain in the expression arena.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
 
+void Parser::delete_expr(ExprNode *node)
+{
     for (ExprNode *i = node; i != nullptr; i = i->next)
     {
-        if (temp != nullptr)
-        {
-            POV_FREE(temp);
-        }
+        delete_expr(i->child);
 
-        FNSyntax_DeleteExpression(i->child);
-
-        if((i->op == OP_VARIABLE) || (i->op == OP_MEMBER))
-        {
-            POV_FREE(i->variable);
-        }
-        else if(i->op == OP_CALL)
+        if(i->op == OP_CALL)
         {
             if((i->call.token == FUNCT_ID_TOKEN) || (i->call.token == VECTFUNCT_ID_TOKEN))
                 mpFunctionVM->RemoveFunction(i->call.fn);
-            POV_FREE(i->call.name);
         }
-
-        temp = i;
-    }
-
-    if (temp != nullptr)
-    {
-        POV_FREE(temp);
     }
 }
 
@@ -406,6 +431,7 @@ TokenId Parser::expr_get_token()
         return FLOAT_ID_TOKEN;
     else if(CurrentTokenFunctionId() == CLOCK_TOKEN)
     {
+        NoteClockRead();
         mToken.Token_Float = clockValue;
         return FLOAT_TOKEN;
     }
@@ -440,6 +466,9 @@ TokenId Parser::expr_get_token()
             return FLOAT_TOKEN;
         else if(CurrentTokenFunctionId() == FLOAT_ID_TOKEN)
         {
+            // identifiers of compiled assignments are parameters rather than constants
+            if(mCompilingRValue)
+                return FLOAT_ID_TOKEN;
             mToken.Token_Float = CurrentTokenData<DBL>();
             return FLOAT_TOKEN;
         }
@@ -447,6 +476,10 @@ TokenId Parser::expr_get_token()
         return FUNCT_ID_TOKEN;
     }
 
+    // the semicolon terminating a compiled assignment ends the expression
+    if(mCompilingRValue && (CurrentTokenId() == SEMI_COLON_TOKEN))
+        return RIGHT_CURLY_TOKEN;
+
     return CurrentTokenId();
 }
 
@@ -486,7 +519,7 @@ ExprNode *Parser::new_expr_node(int stage, int op)
 {
     ExprNode *node = nullptr;
 
-    node = reinterpret_cast<ExprNode *>(POV_MALLOC(sizeof(ExprNode), "ExprNode"));
+    node = mExpressionArena.Allocate<ExprNode>();
     node->parent = nullptr;
     node->child = nullptr;
     node->prev = nullptr;
@@ -683,7 +716,7 @@ bool Parser::expr_call(ExprNode *&current, int stage, int op)
     else
         node->call.fn = 0;
     node->call.token = CurrentTokenFunctionId();
-    node->call.name = POV_STRDUP(CurrentTokenText().c_str());
+    node->call.name = mExpressionArena.Duplicate(CurrentTokenText().c_str());
     while (current->child != nullptr)
         current = current->child;
 
@@ -760,7 +793,7 @@ bool Parser::expr_put(ExprNode *&current, int stage, int op)
     }
     else
     {
-        node->variable = POV_STRDUP(CurrentTokenText().c_str());
+        node->variable = mExpressionArena.Duplicate(CurrentTokenText().c_str());
     }
 
     current->child = node;
@@ -947,7 +980,7 @@ bool Parser::expr_err(ExprNode *&, int stage, int)
 
 void Parser::optimise_expr(ExprNode *node)
 {
-    ExprNode *left,*right,*ptr,*temp;
+    ExprNode *left,*right,*ptr;
     DBL result;
     bool have_result;
     int op,cnt;
@@ -960,7 +993,6 @@ void Parser::optimise_expr(ExprNode *node)
         if(node->call.token == POW_TOKEN)
         {
             node->op = OP_FIRST;
-            POV_FREE(node->call.name);
             if (node->child != nullptr)
             {
                 node->child->op = OP_LEFTMOST;
@@ -1000,7 +1032,7 @@ void Parser::optimise_expr(ExprNode *node)
                             ptr->child = nullptr;
 
                             if (node->next != nullptr)
-                                FNSyntax_DeleteExpression(node->next);
+                                delete_expr(node->next);
 
                             if(op == OP_NEG)
                             {
@@ -1009,7 +1041,6 @@ void Parser::optimise_expr(ExprNode *node)
                                 else
                                     node->number = -(left->number);
                             }
-                            POV_FREE(left);
                             node->op = OP_CONSTANT;
                             node->child = nullptr;
                             node->prev = nullptr;
@@ -1038,9 +1069,15 @@ void Parser::optimise_expr(ExprNode *node)
 
             optimise_expr(right);
 
+            // the operations are evaluated from left to right, so unless the
+            // left operand is the first one in the list, it may only be combined
+            // with the right one if that does not change the result
             if ((left != nullptr) && (right != nullptr) &&
-                (((ptr->op != OP_MUL) && (ptr->op != OP_DIV)) ||
-                 !left_subtree_has_variable_expr(ptr)))
+                ((ptr->prev == node) ||
+                 ((ptr->prev->op == OP_ADD) && (ptr->op == OP_ADD)) ||
+                 ((ptr->prev->op == OP_MUL) && ((ptr->op == OP_MUL) || (ptr->op == OP_DIV))) ||
+                 ((ptr->prev->op == OP_AND) && (ptr->op == OP_AND)) ||
+                 ((ptr->prev->op == OP_OR) && (ptr->op == OP_OR))))
             {
                 if((left->op == OP_CONSTANT) && (right->op == OP_CONSTANT))
                 {
@@ -1094,13 +1131,10 @@ void Parser::optimise_expr(ExprNode *node)
 
                     if(have_result == true)
                     {
-                        temp = ptr;
                         ptr->prev->next = ptr->next;
                         if(ptr->next != nullptr)
                             ptr->next->prev = ptr->prev;
                         ptr = ptr->prev;
-                        POV_FREE(temp->child);
-                        POV_FREE(temp);
                         left->number = result;
                     }
                 }
@@ -1110,16 +1144,22 @@ void Parser::optimise_expr(ExprNode *node)
         {
             if ((node->child->op == OP_CONSTANT) && (node->child->next == nullptr))
             {
-                node->number = left->number;
+                node->number = node->child->number;
                 node->op = OP_CONSTANT;
-                POV_FREE(node->child);
                 node->child = nullptr;
             }
         }
     }
     else
     {
-        optimise_expr(node->child);
+        if(node->op == OP_CALL)
+        {
+            // each parameter is an expression of its own
+            for (ptr = node->child; ptr != nullptr; ptr = ptr->next)
+                optimise_expr(ptr);
+        }
+        else
+            optimise_expr(node->child);
 
         optimise_call(node);
 
@@ -1128,7 +1168,6 @@ void Parser::optimise_expr(ExprNode *node)
             if ((node->child->op == OP_CONSTANT) && (node->child->next == nullptr))
             {
                 node->number = node->child->number;
-                POV_FREE(node->child);
                 node->child = nullptr;
                 node->op = OP_CONSTANT;
             }
@@ -1157,7 +1196,9 @@ void Parser::optimise_expr(ExprNode *node)
 *
 * DESCRIPTION
 *
-*   Optimises a function call if it has only constant arguments
+*   Optimises a function call if it has only constant arguments, or
+*   replaces a selection with a constant condition by the selected
+*   parameter.
 *
 * CHANGES
 *
@@ -1167,113 +1208,204 @@ void Parser::optimise_expr(ExprNode *node)
 
 void Parser::optimise_call(ExprNode *node)
 {
+    ExprNode *param = nullptr;
+    ExprNode *selected = nullptr;
     DBL result = 0.0;
-    bool have_result = true;;
+    DBL arg = 0.0;
+    DBL arg2 = 0.0;
+    bool have_result = true;
+    int cnt = 0;
 
     if(node->op != OP_CALL)
         return;
     if (node->child == nullptr)
         return;
-    if(node->child->op != OP_CONSTANT)
+
+    // each parameter is wrapped in the root node of its own expression
+    for (param = node->child; param != nullptr; param = param->next)
+    {
+        if ((param->child == nullptr) || (param->child->op != OP_CONSTANT) || (param->child->next != nullptr))
+        {
+            if ((cnt == 0) && (node->call.token == SELECT_TOKEN))
+                return;
+            have_result = false;
+        }
+        cnt++;
+    }
+
+    if(node->call.token == SELECT_TOKEN)
+    {
+        // with a constant condition only one alternative is ever used
+        if((cnt != 3) && (cnt != 4))
+            return;
+
+        arg = node->child->child->number;
+        if(arg < 0.0)
+            selected = node->child->next;
+        else if((cnt == 3) || (arg == 0.0))
+            selected = node->child->next->next;
+        else
+            selected = node->child->next->next->next;
+
+        if (selected->child == nullptr)
+            return;
+
+        param = selected->child;
+        selected->child = nullptr;
+        delete_expr(node->child);
+
+        if((param->op == OP_CONSTANT) && (param->next == nullptr))
+        {
+            node->number = param->number;
+            node->op = OP_CONSTANT;
+            node->child = nullptr;
+        }
+        else
+        {
+            node->op = OP_FIRST;
+            node->child = param;
+            for (; param != nullptr; param = param->next)
+                param->parent = node;
+        }
         return;
+    }
+
+    if(have_result == false)
+        return;
+
+    // leave wrong parameter counts to be reported by the compiler
+    switch(node->call.token)
+    {
+        case MIN_TOKEN:
+        case MAX_TOKEN:
+            if(cnt < 2)
+                return;
+            break;
+        case ATAN2_TOKEN:
+        case MOD_TOKEN:
+        case DIV_TOKEN:
+            if(cnt != 2)
+                return;
+            break;
+        default:
+            if(cnt != 1)
+                return;
+            break;
+    }
+
+    arg = node->child->child->number;
+    if (node->child->next != nullptr)
+        arg2 = node->child->next->child->number;
 
     switch(node->call.token)
     {
         case SIN_TOKEN:
-            result = sin(node->child->number);
+            result = sin(arg);
             break;
         case COS_TOKEN:
-            result = cos(node->child->number);
+            result = cos(arg);
             break;
         case TAN_TOKEN:
-            result = tan(node->child->number);
+            result = tan(arg);
             break;
         case ASIN_TOKEN:
-            result = asin(node->child->number);
+            result = asin(arg);
             break;
         case ACOS_TOKEN:
-            result = acos(node->child->number);
+            result = acos(arg);
             break;
         case ATAN_TOKEN:
-            result = atan(node->child->number);
+            result = atan(arg);
             break;
         case SINH_TOKEN:
-            result = sinh(node->child->number);
+            result = sinh(arg);
             break;
         case COSH_TOKEN:
-            result = cosh(node->child->number);
+            result = cosh(arg);
             break;
         case TANH_TOKEN:
-            result = tanh(node->child->number);
+            result = tanh(arg);
             break;
         case ASINH_TOKEN:
-            result = asinh(node->child->number);
+            result = asinh(arg);
             break;
         case ACOSH_TOKEN:
-            result = acosh(node->child->number);
+            result = acosh(arg);
             break;
         case ATANH_TOKEN:
-            result = atanh(node->child->number);
+            result = atanh(arg);
             break;
         case ABS_TOKEN:
-            result = fabs(node->child->number);
+            result = fabs(arg);
             break;
         case RADIANS_TOKEN:
-            result = node->child->number * M_PI / 180.0;
+            result = arg * (M_PI / 180.0); // match VM code
             break;
         case DEGREES_TOKEN:
-            result = node->child->number * 180.0 / M_PI;
+            result = arg * (180.0 / M_PI); // match VM code
             break;
         case FLOOR_TOKEN:
-            result = floor(node->child->number);
+            result = floor(arg);
             break;
         case INT_TOKEN:
-            result = (int)(node->child->number);
+            result = (int)(arg);
             break;
         case CEIL_TOKEN:
-            result = ceil(node->child->number);
+            result = ceil(arg);
             break;
         case SQRT_TOKEN:
-            result = sqrt(node->child->number);
+            result = sqrt(arg);
+            break;
+        case SQR_TOKEN:
+            result = arg * arg;
             break;
         case EXP_TOKEN:
-            result = exp(node->child->number);
+            result = exp(arg);
             break;
         case LN_TOKEN:
-            if(node->child->number > 0.0)
-                result = log(node->child->number);
+            if(arg > 0.0)
+                result = log(arg);
             else
                 Error("Domain error in 'ln'.");
             break;
         case LOG_TOKEN:
-            if(node->child->number > 0.0)
-                result = log10(node->child->number);
+            if(arg > 0.0)
+                result = log10(arg);
             else
                 Error("Domain error in 'log'.");
             break;
         case MIN_TOKEN:
-            have_result = false;
+            // compare in the same order as the VM code, which also decides the result for NaNs
+            result = arg;
+            for (param = node->child->next; param != nullptr; param = param->next)
+            {
+                if(!((param->child->number > result) || (param->child->number == result)))
+                    result = param->child->number;
+            }
             break;
         case MAX_TOKEN:
-            have_result = false;
+            result = arg;
+            for (param = node->child->next; param != nullptr; param = param->next)
+            {
+                if(param->child->number > result)
+                    result = param->child->number;
+            }
             break;
         case ATAN2_TOKEN:
-            have_result = false;
-            break;
-        case POW_TOKEN:
-            have_result = false;
+            result = atan2(arg, arg2);
             break;
         case MOD_TOKEN:
-            have_result = false;
-            break;
-        case SELECT_TOKEN:
-            have_result = false;
-            break;
-        case FUNCT_ID_TOKEN:
-            have_result = false;
+            // leave division by zero to be reported by the VM
+            if(arg2 != 0.0)
+                result = fmod(arg, arg2);
+            else
+                have_result = false;
             break;
-        case VECTFUNCT_ID_TOKEN:
-            have_result = false;
+        case DIV_TOKEN:
+            if(arg2 != 0.0)
+                result = (int)(arg / arg2); // match VM code
+            else
+                have_result = false;
             break;
         default:
             have_result = false;
@@ -1282,10 +1414,9 @@ void Parser::optimise_call(ExprNode *node)
 
     if(have_result == true)
     {
-        POV_FREE(node->call.name);
+        delete_expr(node->child);
         node->number = result;
         node->op = OP_CONSTANT;
-        POV_FREE(node->child);
         node->child = nullptr;
     }
 }
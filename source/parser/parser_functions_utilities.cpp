@@ -98,6 +98,7 @@ FUNCTION_PTR Parser::Parse_Function(void)
 
     Parse_End();
 
+    NoteSideEffect(); // the function table is per-scene
     *ptr = mpFunctionVM->AddFunction(&function);
 
     return ptr;
@@ -144,6 +145,7 @@ FUNCTION_PTR Parser::Parse_FunctionContent(void)
     f.Compile(expression);
     FNSyntax_DeleteExpression(expression);
 
+    NoteSideEffect(); // the function table is per-scene
     *ptr = mpFunctionVM->AddFunction(&function);
 
     return ptr;
@@ -345,6 +347,7 @@ FUNCTION_PTR Parser::Parse_DeclareFunction(TokenId *token_id, const char *fn_nam
 
     Parse_End();
 
+    NoteSideEffect(); // the function table is per-scene
     *ptr = mpFunctionVM->AddFunction(&function);
 
     return ptr;
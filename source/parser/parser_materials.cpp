@@ -36,9 +36,14 @@
 // Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
 #include "parser/parser.h"
 
+#include <unordered_map>
+
 #include "base/fileutil.h"
 #include "base/image/image.h"
+#include "base/image/tiledimage.h"
+#include "base/jobscheduler.h"
 #include "base/path.h"
+#include "base/platformbase.h"
 
 #include "core/lighting/lightgroup.h"
 #include "core/material/blendmap.h"
@@ -56,6 +61,7 @@
 #include "core/scene/scenedata.h"
 #include "core/scene/tracethreaddata.h"
 #include "core/shape/isosurface.h"
+#include "core/support/imagecache.h"
 #include "core/support/imageutil.h"
 
 #include "vm/fnpovfpu.h"
@@ -171,6 +177,123 @@ void Parser::Make_Pattern_Image(ImageData *image, FUNCTION_PTR fn, int token)
     mpFunctionVM->DestroyFunction(fn);
 }
 
+/// Number of points at which a pigment is sampled to tell whether a bake file still matches it.
+static const int kBakeFingerprintSamples = 64;
+
+static void HashBakeData(POV_UINT64& hash, const void *data, size_t size)
+{
+    // FNV-1a
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= p[i];
+        hash *= 1099511628211ULL;
+    }
+}
+
+/// Replaces a pigment with an image map of the pigment's colours.
+///
+/// The pigment is sampled over the unit square in the x-y plane at z=0, i.e. the area covered by
+/// `uv_mapping` and by a planar `image_map`, at the centre of each pixel. The result is also kept in
+/// a bake file in the temporary directory, from which later frames or renders read it back rather
+/// than sampling the pigment again; the file is identified by the bake resolution along with a
+/// fingerprint of the pigment's colours at a few points.
+///
+void Parser::Bake_Pigment(PIGMENT *Pigment, int width, int height)
+{
+    TraceThreadData *Thread = GetParserDataPtr();
+    PIGMENT *source = Copy_Pigment(Pigment);
+    Image *baked = nullptr;
+    TransColour colour;
+
+    try
+    {
+        Post_Pigment(source);
+
+        POV_UINT64 signature = 14695981039346656037ULL;
+        HashBakeData(signature, &width, sizeof(width));
+        HashBakeData(signature, &height, sizeof(height));
+        for (int i = 0; i < kBakeFingerprintSamples; ++i)
+        {
+            Vector3d point((i + 0.5) / kBakeFingerprintSamples, std::fmod(i * 0.6180339887, 1.0), 0.0);
+            colour.Clear();
+            Compute_Pigment(colour, source, point, nullptr, nullptr, Thread);
+            RGBFTColour rgbft = ToRGBFTColour(colour);
+            float channels[5] = { rgbft.red(), rgbft.green(), rgbft.blue(), rgbft.filter(), rgbft.transm() };
+            HashBakeData(signature, channels, sizeof(channels));
+        }
+
+        char buffer[32];
+        std::sprintf(buffer, "povbake%016llx.dat", (unsigned long long)signature);
+        UCS2String bakeFilename = PlatformBase::GetInstance().GetTemporaryPath() + ASCIItoUCS2String(buffer);
+
+        baked = Image::Create(width, height, Image::RGBFT_Float);
+        baked->SetPremultiplied(false);
+
+        TiledImage *cached = TiledImage::Open(bakeFilename, signature);
+        if (cached != nullptr)
+        {
+            float r, g, b, f, t;
+            for (int y = 0; y < height; ++y)
+                for (int x = 0; x < width; ++x)
+                {
+                    cached->GetRGBFTValue(x, y, r, g, b, f, t);
+                    baked->SetRGBFTValue(x, y, r, g, b, f, t);
+                }
+            delete cached;
+        }
+        else
+        {
+            // NB: image rows are stored top to bottom, while y points upward.
+            for (int y = 0; y < height; ++y)
+            {
+                for (int x = 0; x < width; ++x)
+                {
+                    Vector3d point((x + 0.5) / width, 1.0 - (y + 0.5) / height, 0.0);
+                    colour.Clear();
+                    Compute_Pigment(colour, source, point, nullptr, nullptr, Thread);
+                    baked->SetRGBFTValue(x, y, ToRGBFTColour(colour));
+                }
+            }
+
+            try
+            {
+                TiledImage::Convert(bakeFilename, signature, baked);
+            }
+            catch (pov_base::Exception&)
+            {
+                Warning("Cannot write pigment bake file; the pigment will be baked again next time.");
+            }
+        }
+    }
+    catch (...)
+    {
+        delete baked;
+        Destroy_Pigment(source);
+        throw;
+    }
+
+    ImageData *image = Create_Image();
+    image->data = baked;
+    image->iwidth  = width;
+    image->iheight = height;
+    image->width   = (SNGL)width;
+    image->height  = (SNGL)height;
+    image->Use = USE_COLOUR;
+    image->Interpolation_Type = BILINEAR;
+
+    shared_ptr<ColourImagePattern> pattern(new ColourImagePattern());
+    pattern->pImage = image;
+
+    Pigment->Type = IMAGE_MAP_PATTERN;
+    Pigment->pattern = pattern;
+    Pigment->Blend_Map.reset();
+    if (source->Flags & HAS_FILTER)
+        Pigment->Flags |= HAS_FILTER;
+
+    Destroy_Pigment(source);
+}
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -365,6 +488,7 @@ ImageData *Parser::Parse_Image(int Legal, bool GammaCorrect)
 
         UCS2String filename = ASCIItoUCS2String(Name);
         Image::ReadOptions options;
+        bool tiled = false;
 
         switch (sceneData->gammaMode)
         {
@@ -422,6 +546,10 @@ ImageData *Parser::Parse_Image(int Legal, bool GammaCorrect)
                 options.premultipliedOverride = true;
                 options.premultiplied = ((int)Parse_Float() != 0);
             END_CASE
+            CASE (TILED_TOKEN)
+                // User wants the image to be paged in tile by tile rather than held in memory.
+                tiled = ((int)Allow_Float(1.0) != 0);
+            END_CASE
             OTHERWISE
                 UNGET
                 EXIT
@@ -479,8 +607,11 @@ ImageData *Parser::Parse_Image(int Legal, bool GammaCorrect)
             Error("Beta-test video capture feature not implemented on this platform.");
 #endif
         }
+        else if (!tiled && !(Legal & HF_FILE) && (JobGroup::Concurrency() > 1))
+            // the pixels are not needed before the scene is complete, so decode while parsing continues
+            Read_Image_Deferred(image, filetype, filename.c_str(), options, Name);
         else
-            image->data = Read_Image(filetype, filename.c_str(), options);
+            image->data = Read_Image(filetype, filename.c_str(), options, tiled);
 
         if (!options.warnings.empty())
             for (vector<string>::iterator it = options.warnings.begin(); it != options.warnings.end(); it++)
@@ -489,13 +620,16 @@ ImageData *Parser::Parse_Image(int Legal, bool GammaCorrect)
         POV_FREE(Name);
     }
 
-    if (image->data == nullptr)
-        Error("Cannot read image.");
+    if (image->pending == nullptr)
+    {
+        if (image->data == nullptr)
+            Error("Cannot read image.");
 
-    image->iwidth = image->data->GetWidth();
-    image->iheight = image->data->GetHeight();
-    image->width = (SNGL) image->iwidth;
-    image->height = (SNGL) image->iheight;
+        image->iwidth = image->data->GetWidth();
+        image->iheight = image->data->GetHeight();
+        image->width = (SNGL) image->iwidth;
+        image->height = (SNGL) image->iheight;
+    }
 
     return image;
 }
@@ -588,6 +722,10 @@ void Parser::Parse_Image_Map (PIGMENT *Pigment)
             }
         END_CASE
 
+        CASE (MIP_MAP_TOKEN)
+            image->Mip_Map_Flag = ((int)Allow_Float(1.0) != 0);
+        END_CASE
+
         CASE (MAP_TYPE_TOKEN)
             image->Map_Type = (int) Parse_Float ();
             switch(image->Map_Type)
@@ -632,6 +770,8 @@ void Parser::Parse_Image_Map (PIGMENT *Pigment)
             // FALLTHROUGH
 
         CASE (COLOUR_KEY_TOKEN)
+            // colour map modifications need the actual image data
+            image->Resolve();
             switch(mToken.Function_Id)
             {
                 case FILTER_TOKEN:
@@ -643,6 +783,7 @@ void Parser::Parse_Image_Map (PIGMENT *Pigment)
                                 image->AllFilter = filter;
                                 if (image->data->IsIndexed())
                                 {
+                                    image->data = ImageCache::Unshare(image->data);
                                     if (image->data->HasFilterTransmit() == false)
                                     {
                                         vector<Image::RGBFTMapEntry> map;
@@ -672,6 +813,7 @@ void Parser::Parse_Image_Map (PIGMENT *Pigment)
                             {
                                 float r, g, b, f, t;
 
+                                image->data = ImageCache::Unshare(image->data);
                                 if (image->data->HasFilterTransmit() == false)
                                 {
                                     vector<Image::RGBFTMapEntry> map;
@@ -696,6 +838,7 @@ void Parser::Parse_Image_Map (PIGMENT *Pigment)
                                 image->AllTransmit = transmit;
                                 if (image->data->IsIndexed())
                                 {
+                                    image->data = ImageCache::Unshare(image->data);
                                     if (image->data->HasFilterTransmit() == false)
                                     {
                                         vector<Image::RGBFTMapEntry> map;
@@ -725,6 +868,7 @@ void Parser::Parse_Image_Map (PIGMENT *Pigment)
                             {
                                 float r, g, b, f, t;
 
+                                image->data = ImageCache::Unshare(image->data);
                                 if (image->data->HasFilterTransmit() == false)
                                 {
                                     vector<Image::RGBFTMapEntry> map;
@@ -1342,6 +1486,8 @@ void Parser::Parse_Pattern (PATTERN_T *New, BlendMapTypeId TPat_Type)
     int i;
     TraceThreadData *Thread = GetParserDataPtr();
     ContinuousPattern* pContinuousPattern;
+    int bakeWidth = 0;
+    int bakeHeight = 0;
 
     EXPECT_ONE
         CASE (AGATE_TOKEN)
@@ -1692,6 +1838,7 @@ void Parser::Parse_Pattern (PATTERN_T *New, BlendMapTypeId TPat_Type)
                 Error("accuracy can only be used with normal patterns.");
             }
             (reinterpret_cast<TNORMAL *>(New))->Delta = Parse_Float();
+            Set_Flag(New, EXPLICIT_DELTA_FLAG);
         END_CASE
 
         CASE (SOLID_TOKEN)
@@ -2148,6 +2295,18 @@ void Parser::Parse_Pattern (PATTERN_T *New, BlendMapTypeId TPat_Type)
                 Only_In("repeat","crackle");
         END_CASE
 
+        CASE (BAKE_TOKEN)
+            if (TPat_Type != kBlendMapType_Pigment)
+                Only_In("bake","pigment");
+            Parse_Begin();
+            bakeWidth = (int)Parse_Float();
+            Parse_Comma();
+            bakeHeight = (int)Parse_Float();
+            if ((bakeWidth < 1) || (bakeHeight < 1))
+                Error("Bake resolution must be at least 1x1.");
+            Parse_End();
+        END_CASE
+
         OTHERWISE
             UNGET
             EXIT
@@ -2169,6 +2328,9 @@ void Parser::Parse_Pattern (PATTERN_T *New, BlendMapTypeId TPat_Type)
 
     if (!New->pattern->Precompute())
         Error("Unspecified parse error in pattern.");
+
+    if (bakeWidth > 0)
+        Bake_Pigment(reinterpret_cast<PIGMENT *>(New), bakeWidth, bakeHeight);
 }
 
 
@@ -3691,6 +3853,13 @@ void Parser::Parse_Media(vector<Media>& medialist)
             Parse_End();
         END_CASE
 
+        CASE (DENSITY_GRID_TOKEN)
+            if ((IMedia->Density_Grid_Resolution = (int)Parse_Float()) < 0)
+            {
+                Error("density_grid resolution in media must not be negative.");
+            }
+        END_CASE
+
         CASE (TRANSLATE_TOKEN)
             Parse_Vector (Local_Vector);
             Compute_Translation_Transform(&Local_Trans, Local_Vector);
@@ -3959,6 +4128,13 @@ FOG *Parser::Parse_Fog()
             Fog->Turb_Depth = Parse_Float();
         END_CASE
 
+        CASE (DENSITY_GRID_TOKEN)
+            if ((Fog->Turb_Grid_Resolution = (int)Parse_Float()) < 0)
+            {
+                Error("density_grid resolution in fog must not be negative.");
+            }
+        END_CASE
+
         CASE (UP_TOKEN)
             Parse_Vector(Fog->Up);
         END_CASE
@@ -4280,6 +4456,16 @@ SKYSPHERE *Parser::Parse_Skysphere()
             Parse_Colour(Skysphere->Emission);
         END_CASE
 
+        CASE (BAKE_TOKEN)
+            Parse_Begin();
+            Skysphere->Map_Width = (int)Parse_Float();
+            Parse_Comma();
+            Skysphere->Map_Height = (int)Parse_Float();
+            if ((Skysphere->Map_Width < 1) || (Skysphere->Map_Height < 1))
+                Error("Bake resolution must be at least 1x1.");
+            Parse_End();
+        END_CASE
+
         CASE (TRANSLATE_TOKEN)
             Parse_Vector (Local_Vector);
             Translate_Skysphere(Skysphere, Local_Vector);
@@ -5510,4 +5696,221 @@ void Parser::Parse_PatternFunction(TPATTERN *New)
         Error("Unspecified parse error in pattern.");
 }
 
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Share_Materials
+*
+* INPUT
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Once parsing is done, have objects with identical textures or interiors
+*   share a single instance, as scenes generated by macros tend to create a
+*   separate copy of each for every object. Textures are reference counted
+*   and carry no identity of their own, but only plain textures, i.e. layers
+*   of uniformly coloured pigments and finishes without normals, are simple
+*   enough to compare. Interiors do carry an identity, as rays keep track of
+*   the interiors they are in, so only those of opaque objects are shared,
+*   and only if without media and not already shared with another object.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+/// Statistics and lookup tables of the material sharing pass.
+struct MaterialSharing
+{
+    std::unordered_map<string, TEXTURE *> textures;
+    std::unordered_map<string, InteriorPtr> interiors;
+    size_t sharedTextures;
+    size_t sharedInteriors;
+    size_t savedBytes;
+
+    MaterialSharing() : sharedTextures(0), sharedInteriors(0), savedBytes(0) {}
+};
+
+template<typename T>
+static inline void Append_Key(string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+static inline void Append_Key(string& key, const MathColour& colour)
+{
+    for (int i = 0; i < MathColour::channels; i++)
+        Append_Key(key, colour[i]);
+}
+
+static inline void Append_Key(string& key, const TransColour& colour)
+{
+    Append_Key(key, colour.colour());
+    Append_Key(key, colour.filter());
+    Append_Key(key, colour.transm());
+}
+
+// Compose the key identifying a finish; must cover all the members of FINISH.
+static void Finish_Key(string& key, const FINISH *Finish)
+{
+    Append_Key(key, Finish->Diffuse);
+    Append_Key(key, Finish->DiffuseBack);
+    Append_Key(key, Finish->Brilliance);
+#if POV_PARSER_EXPERIMENTAL_BRILLIANCE_OUT
+    Append_Key(key, Finish->BrillianceOut);
+#endif
+    Append_Key(key, Finish->BrillianceAdjust);
+    Append_Key(key, Finish->BrillianceAdjustRad);
+    Append_Key(key, Finish->Specular);
+    Append_Key(key, Finish->Roughness);
+    Append_Key(key, Finish->Phong);
+    Append_Key(key, Finish->Phong_Size);
+    Append_Key(key, Finish->Irid);
+    Append_Key(key, Finish->Irid_Film_Thickness);
+    Append_Key(key, Finish->Irid_Turb);
+    Append_Key(key, Finish->Temp_Caustics);
+    Append_Key(key, Finish->Temp_IOR);
+    Append_Key(key, Finish->Temp_Dispersion);
+    Append_Key(key, Finish->Temp_Refract);
+    Append_Key(key, Finish->Reflect_Exp);
+    Append_Key(key, Finish->Crand);
+    Append_Key(key, Finish->Metallic);
+    Append_Key(key, Finish->Ambient);
+    Append_Key(key, Finish->Emission);
+    Append_Key(key, Finish->Reflection_Max);
+    Append_Key(key, Finish->Reflection_Min);
+    Append_Key(key, Finish->SubsurfaceTranslucency);
+    Append_Key(key, Finish->SubsurfaceAnisotropy);
+    Append_Key(key, Finish->Reflection_Falloff);
+    Append_Key(key, Finish->Reflection_Fresnel);
+    Append_Key(key, Finish->Fresnel);
+    Append_Key(key, Finish->Reflect_Metallic);
+    Append_Key(key, Finish->Conserve_Energy);
+    Append_Key(key, Finish->UseSubsurface);
+    Append_Key(key, Finish->AlphaKnockout);
+}
+
+// Compose the key identifying a plain texture, returning false if the texture is not plain.
+// Warps are left out, as they have no effect on uniform colours.
+static bool Plain_Texture_Key(string& key, const TEXTURE *Texture, size_t& bytes)
+{
+    key.clear();
+    bytes = 0;
+
+    for (const TEXTURE *Layer = Texture; Layer != nullptr; Layer = Layer->Next)
+    {
+        const PIGMENT *Pigment = Layer->Pigment;
+
+        if ((Layer->Type != PLAIN_PATTERN) || (Layer->Blend_Map != nullptr) || !Layer->Materials.empty() ||
+            (Layer->Tnormal != nullptr) || (Layer->Finish == nullptr) || (Pigment == nullptr) ||
+            (Pigment->Type != PLAIN_PATTERN) || (Pigment->Blend_Map != nullptr))
+            return false;
+
+        Append_Key(key, Layer->Flags);
+        Append_Key(key, Pigment->Flags);
+        Append_Key(key, Pigment->colour);
+        Append_Key(key, Pigment->Quick_Colour);
+        Finish_Key(key, Layer->Finish);
+
+        bytes += sizeof(TEXTURE) + sizeof(PIGMENT) + sizeof(FINISH);
+    }
+
+    return true;
+}
+
+// Compose the key identifying an interior, returning false if it has media.
+static bool Interior_Key(string& key, const Interior *interior)
+{
+    if (!interior->media.empty())
+        return false;
+
+    key.clear();
+    Append_Key(key, interior->hollow);
+    Append_Key(key, interior->Disp_NElems);
+    Append_Key(key, interior->IOR);
+    Append_Key(key, interior->Dispersion);
+    Append_Key(key, interior->Caustics);
+    Append_Key(key, interior->Old_Refract);
+    Append_Key(key, interior->Fade_Distance);
+    Append_Key(key, interior->Fade_Power);
+    Append_Key(key, interior->Fade_Colour);
+    Append_Key(key, (interior->subsurface != nullptr));
+
+    return true;
+}
+
+static void Share_Texture(TEXTURE *& Texture, MaterialSharing& sharing, string& key)
+{
+    size_t bytes;
+
+    if ((Texture == nullptr) || !Plain_Texture_Key(key, Texture, bytes))
+        return;
+
+    std::pair<std::unordered_map<string, TEXTURE *>::iterator, bool> found =
+        sharing.textures.insert(std::make_pair(key, Texture));
+
+    if (found.second || (found.first->second == Texture))
+        return;
+
+    if (Texture->References == 1)
+        sharing.savedBytes += bytes;
+
+    Destroy_Textures(Texture);
+    Texture = Copy_Texture_Pointer(found.first->second);
+    sharing.sharedTextures++;
+}
+
+static void Share_Object_Materials(ObjectPtr Object, MaterialSharing& sharing, string& key)
+{
+    Share_Texture(Object->Texture, sharing, key);
+    Share_Texture(Object->Interior_Texture, sharing, key);
+
+    if ((Object->interior != nullptr) && Test_Flag(Object, OPAQUE_FLAG) &&
+        (Object->interior.use_count() == 1) && Interior_Key(key, Object->interior.get()))
+    {
+        std::pair<std::unordered_map<string, InteriorPtr>::iterator, bool> found =
+            sharing.interiors.insert(std::make_pair(key, Object->interior));
+
+        if (!found.second)
+        {
+            Object->interior = found.first->second;
+            sharing.sharedInteriors++;
+            sharing.savedBytes += sizeof(Interior);
+        }
+    }
+
+    if (Object->Type & IS_COMPOUND_OBJECT)
+    {
+        for (vector<ObjectPtr>::iterator Sib = (reinterpret_cast<CompoundObject *>(Object))->children.begin(); Sib != (reinterpret_cast<CompoundObject *>(Object))->children.end(); Sib++)
+            Share_Object_Materials(*Sib, sharing, key);
+    }
+}
+
+void Parser::Share_Materials()
+{
+    MaterialSharing sharing;
+    string key;
+
+    for (vector<ObjectPtr>::iterator Object = sceneData->objects.begin(); Object != sceneData->objects.end(); Object++)
+        Share_Object_Materials(*Object, sharing, key);
+
+    if ((sharing.sharedTextures == 0) && (sharing.sharedInteriors == 0))
+        return;
+
+    Debug_Info("Shared %lu duplicate textures and %lu duplicate interiors, saving about %lu bytes.\n",
+               (unsigned long)sharing.sharedTextures, (unsigned long)sharing.sharedInteriors, (unsigned long)sharing.savedBytes);
+}
+
 }
@@ -185,6 +185,7 @@ void Parser::Parse_Obj (Mesh* mesh)
     bool foundZeroNormal = false;
     bool fullyTextured = true;
     bool havePolygonFaces = false;
+    bool compact = false;
 
     FaceData face;
     MaterialData material;
@@ -253,6 +254,10 @@ void Parser::Parse_Obj (Mesh* mesh)
             Parse_Vector (insideVector);
         END_CASE
 
+        CASE (COMPACT_TOKEN)
+            compact = true;
+        END_CASE
+
         OTHERWISE
             UNGET
             EXIT
@@ -544,6 +549,13 @@ void Parser::Parse_Obj (Mesh* mesh)
     mesh->Data = reinterpret_cast<MESH_DATA *>(POV_MALLOC(sizeof(MESH_DATA), "triangle mesh data"));
     mesh->Data->References = 1;
     mesh->Data->Tree = nullptr;
+    mesh->Data->Packs = nullptr;
+    mesh->Data->Pack_Geometry = nullptr;
+    mesh->Data->Number_Of_Packs = 0;
+    mesh->Data->QVertices = nullptr;
+    mesh->Data->QNormals = nullptr;
+    mesh->Data->File = nullptr;
+    mesh->Data->Accounted_Size = 0;
 
     mesh->has_inside_vector = insideVector.IsNearNull (EPSILON);
     if (mesh->has_inside_vector)
@@ -571,6 +583,9 @@ void Parser::Parse_Obj (Mesh* mesh)
 
     if (!materialList.empty())
         Set_Flag(mesh, MULTITEXTURE_FLAG);
+
+    if (compact)
+        mesh->Compact_Mesh();
 }
 
 }
@@ -218,9 +218,7 @@ UCS2 *Parser::Parse_String(bool pathname, bool require)
         END_CASE
 
         CASE(STRING_ID_TOKEN)
-            len = UCS2_strlen(CurrentTokenDataPtr<UCS2*>()) + 1;
-            New = reinterpret_cast<UCS2 *>(POV_MALLOC(len * sizeof(UCS2), "UCS2 String"));
-            POV_MEMCPY(reinterpret_cast<void *>(New), CurrentTokenDataPtr<void*>(), len * sizeof(UCS2));
+            New = CurrentTokenDataPtr<AssignableString*>()->Duplicate();
             EXIT
         END_CASE
 
@@ -239,6 +237,62 @@ UCS2 *Parser::Parse_String(bool pathname, bool require)
 }
 
 
+/*****************************************************************************
+ *
+ * FUNCTION
+ *
+ *   Parse_String_Value
+ *
+ * INPUT
+ *
+ *   pathname - whether the string is a file name
+ *
+ * OUTPUT
+ *
+ * RETURNS
+ *
+ *   New string value, to be destroyed by the caller
+ *
+ * AUTHOR
+ *
+ * DESCRIPTION
+ *
+ *   Parse a string expression, like Parse_String, but without copying string
+ *   identifiers, and without copying the first string passed to `concat` if
+ *   it can be extended in place; see AssignableString.
+ *
+ * CHANGES
+ *
+ *   Oct 2026 : Creation.
+ *
+******************************************************************************/
+
+AssignableString *Parser::Parse_String_Value(bool pathname)
+{
+    AssignableString *New;
+    UCS2 *str;
+
+    EXPECT_ONE
+        CASE(STRING_ID_TOKEN)
+            New = CurrentTokenDataPtr<AssignableString*>()->Clone();
+        END_CASE
+
+        CASE(CONCAT_TOKEN)
+            New = Parse_Concat_Value(pathname);
+        END_CASE
+
+        OTHERWISE
+            UNGET
+            str = Parse_String(pathname);
+            New = new AssignableString(str);
+            POV_FREE(str);
+        END_CASE
+    END_EXPECT
+
+    return New;
+}
+
+
 //****************************************************************************
 
 
@@ -438,12 +492,22 @@ UCS2 *Parser::Parse_VStr(bool pathname)
 
 UCS2 *Parser::Parse_Concat(bool pathname)
 {
-    UCS2 *str;
-    UCS2 *New;
+    AssignableString *str = Parse_Concat_Value(pathname);
+    UCS2 *New = str->Duplicate();
+
+    delete str;
+
+    return New;
+}
+
+AssignableString *Parser::Parse_Concat_Value(bool pathname)
+{
+    AssignableString *str;
+    AssignableString *New;
 
     Parse_Paren_Begin();
 
-    New = Parse_String();
+    New = Parse_String_Value();
 
     EXPECT
         CASE(RIGHT_PAREN_TOKEN)
@@ -454,9 +518,9 @@ UCS2 *Parser::Parse_Concat(bool pathname)
         OTHERWISE
             UNGET
             Parse_Comma();
-            str = Parse_String(pathname);
-            New = UCS2_strcat(New, str);
-            POV_FREE(str);
+            str = Parse_String_Value(pathname);
+            New->Append(str->data(), str->size());
+            delete str;
         END_CASE
     END_EXPECT
 
@@ -617,13 +681,13 @@ UCS2 *Parser::Parse_Datetime(bool pathname)
 
 UCS2 *Parser::Parse_Substr(bool pathname)
 {
-    UCS2 *str;
+    AssignableString *str;
     UCS2 *New;
     int l, d;
 
     Parse_Paren_Begin();
 
-    str = Parse_String(pathname);
+    str = Parse_String_Value(pathname);
     Parse_Comma();
     l = (int)Parse_Float();
     Parse_Comma();
@@ -631,14 +695,13 @@ UCS2 *Parser::Parse_Substr(bool pathname)
 
     Parse_Paren_End();
 
-    if(((l + d - 1) > UCS2_strlen(str)) || (l < 0) || (d < 0))
+    if(((l + d - 1) > (POV_LONG)str->size()) || (l < 0) || (d < 0))
         Error("Illegal parameters in substr.");
 
-    New = reinterpret_cast<UCS2 *>(POV_MALLOC(sizeof(UCS2) * (d + 1), "temporary string"));
-    UCS2_strncpy(New, &(str[l - 1]), d);
-    New[d] = 0;
+    // Copy just the substring rather than the entire string.
+    New = str->Duplicate((l > 0) ? l - 1 : 0, d);
 
-    POV_FREE(str);
+    delete str;
 
     return New;
 }
@@ -43,11 +43,17 @@
 #include "parser/parser.h"
 
 #include <cctype>
+#include <cstdlib>
+#include <cstring>
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 
+#include <boost/thread.hpp>
+
 #include "base/fileinputoutput.h"
+#include "base/filemapping.h"
 #include "base/stringutilities.h"
 #include "base/version_info.h"
 
@@ -105,7 +111,7 @@ void Parser::Initialize_Tokenizer()
     if (rfile == nullptr)
         Error("Cannot open input file.");
 
-    SetInputStream(rfile);
+    SetInputStream(Map_Text_File(rfile, actualFileName));
 
     mHavePendingRawToken = false;
 
@@ -327,6 +333,8 @@ void Parser::Get_Token ()
                 }
             }
             GoToBookmark(maIncludeStack.back().returnToBookmark); // TODO handle errors
+            if (mpProfiler != nullptr)
+                mpProfiler->Leave(maIncludeStack.back().profileDepth);
             maIncludeStack.pop_back();
 
             continue;
@@ -469,6 +477,10 @@ void Parser::Read_Symbol(const RawToken& rawToken)
     int pseudoDictionary = -1;
     RawToken nextRawToken;
     bool haveNextRawToken;
+    void** rootDataPtr = nullptr;
+    bool viaParameter = false;
+    // Looking up an identifier to assign to does not read its value, but evaluating subscripts does.
+    bool reading = (!LValue_Ok || (mSubscriptDepth > 0));
 
     if (rawToken.isReservedWord && !parseRawIdentifiers)
     {
@@ -509,7 +521,7 @@ void Parser::Read_Symbol(const RawToken& rawToken)
         else
         {
             /* See if it's a previously declared identifier. */
-            Temp_Entry = mSymbolStack.Find_Symbol(rawToken.lexeme.text.c_str(), &Local_Index);
+            Temp_Entry = mSymbolStack.Find_Symbol(rawToken.lexeme.text, rawToken.symbolHash, &Local_Index);
             if (Temp_Entry != nullptr)
             {
                 if (Temp_Entry->deprecated && !Temp_Entry->deprecatedShown)
@@ -574,6 +586,11 @@ void Parser::Read_Symbol(const RawToken& rawToken)
                             a = reinterpret_cast<POV_ARRAY *>(*(mToken.DataPtr));
                             j = 0;
 
+                            if (rootDataPtr == nullptr)
+                                rootDataPtr = mToken.DataPtr;
+                            if (reading)
+                                NoteRead(mToken.DataPtr);
+
                             if (a == nullptr)
                                 // This happens in e.g. `#declare Foo[A][B]=...` when `Foo` is an
                                 // array of arrays and `Foo[A]` is uninitialized.
@@ -582,7 +599,9 @@ void Parser::Read_Symbol(const RawToken& rawToken)
                             for (i=0; i <= a->maxDim; i++)
                             {
                                 Parse_Square_Begin();
+                                ++mSubscriptDepth;
                                 val=Parse_Float();
+                                --mSubscriptDepth;
                                 k=(int)(val + EPSILON);
 
                                 if ((k < 0) || (val < -EPSILON))
@@ -616,7 +635,13 @@ void Parser::Read_Symbol(const RawToken& rawToken)
                                     Error("Attempt to access uninitialized array element.");
                             }
 
+                            // Elements that may be replaced or destroyed must not reside in packed storage.
+                            if (LValue_Ok || Inside_Ifdef)
+                                a->Unpack(j);
+
                             mToken.DataPtr = &(a->DataPtrs[j]);
+                            mToken.array = a;
+                            mToken.arrayIndex = j;
                             mToken.is_mixed_array_elem = a->mixedType;
                             mToken.NumberPtr = &(a->ElementType(j));
                             mToken.Token_Id = *mToken.NumberPtr;
@@ -654,7 +679,13 @@ void Parser::Read_Symbol(const RawToken& rawToken)
                                 }
                             }
                             else
+                            {
                                 table = reinterpret_cast<SymbolTable*>(*(mToken.DataPtr));
+                                if (rootDataPtr == nullptr)
+                                    rootDataPtr = mToken.DataPtr;
+                                if (reading)
+                                    NoteRead(mToken.DataPtr);
+                            }
 
                             if (haveNextRawToken && (nextRawToken.lexeme.category == Lexeme::kOther) && (nextRawToken.lexeme.text == "."))
                             {
@@ -673,7 +704,7 @@ void Parser::Read_Symbol(const RawToken& rawToken)
                                 if (mToken.Token_Id != IDENTIFIER_TOKEN)
                                     Expectation_Error ("dictionary element identifier");
 
-                                Temp_Entry = table->Find_Symbol (CurrentTokenText().c_str());
+                                Temp_Entry = table->Find_Symbol (CurrentTokenText(), mToken.raw.symbolHash);
                             }
                             else if (haveNextRawToken && (nextRawToken.lexeme.category == Lexeme::kOther) && (nextRawToken.lexeme.text == "["))
                             {
@@ -684,7 +715,9 @@ void Parser::Read_Symbol(const RawToken& rawToken)
                                 }
 
                                 Parse_Square_Begin();
+                                ++mSubscriptDepth;
                                 dictIndex = Parse_C_String();
+                                --mSubscriptDepth;
                                 Parse_Square_End();
 
                                 Temp_Entry = table->Find_Symbol (dictIndex);
@@ -728,6 +761,7 @@ void Parser::Read_Symbol(const RawToken& rawToken)
                             mToken.is_dictionary_elem = false;
                             mToken.NumberPtr = Par->NumberPtr;
                             mToken.DataPtr   = Par->DataPtr;
+                            viaParameter     = true;
                         }
                         break;
 
@@ -742,6 +776,16 @@ void Parser::Read_Symbol(const RawToken& rawToken)
             if (mToken.DataPtr != nullptr)
                 mToken.Data = *(mToken.DataPtr);
             mToken.context = Local_Index;
+            mToken.rootDataPtr = (rootDataPtr != nullptr ? rootDataPtr : mToken.DataPtr);
+            mToken.is_parameter_ref = viaParameter;
+            if (mpReusableObjects != nullptr)
+            {
+                if (reading)
+                    NoteRead(mToken.DataPtr);
+                // functions live in this frame's virtual machine, so objects using them cannot be carried over
+                if ((mToken.Function_Id == FUNCT_ID_TOKEN) || (mToken.Function_Id == VECTFUNCT_ID_TOKEN))
+                    NoteSideEffect();
+            }
             if (dictIndex != nullptr)
                 mToken.raw.lexeme.text = dictIndex;
             return;
@@ -1128,7 +1172,10 @@ void Parser::Parse_Directive()
             }
             else
             {
-                if (Parse_Ifdef_Param())
+                POV_LONG reads = mClockDependentReads;
+                bool defined = Parse_Ifdef_Param();
+                NoteCondition(reads);
+                if (defined)
                 {
                     Cond_Stack.back().Cond_Type=IF_TRUE_COND;
                 }
@@ -1151,7 +1198,10 @@ void Parser::Parse_Directive()
             }
             else
             {
-                if (Parse_Ifdef_Param())
+                POV_LONG reads = mClockDependentReads;
+                bool defined = Parse_Ifdef_Param();
+                NoteCondition(reads);
+                if (defined)
                 {
                     Cond_Stack.back().Cond_Type=IF_FALSE_COND;
                     Skip_Tokens(IF_FALSE_COND);
@@ -1199,6 +1249,9 @@ void Parser::Parse_Directive()
             }
             else
             {
+                if (mpProfiler != nullptr)
+                    Cond_Stack.back().profileDepth = mpProfiler->Enter(ParseProfiler::kWhileLoop, "#while", CurrentFileName(), CurrentFilePosition().line);
+
                 Cond_Stack.back().returnToBookmark = GetHotBookmark();
 
                 Value=Parse_Cond_Param();
@@ -1226,6 +1279,9 @@ void Parser::Parse_Directive()
             }
             else
             {
+                if (mpProfiler != nullptr)
+                    Cond_Stack.back().profileDepth = mpProfiler->Enter(ParseProfiler::kForLoop, "#for", CurrentFileName(), CurrentFilePosition().line);
+
                 DBL End, Step;
                 if (Parse_For_Param (Cond_Stack.back().Loop_Identifier, &End, &Step))
                 {
@@ -1441,22 +1497,18 @@ void Parser::Parse_Directive()
 
                             PMac->endPosition = hashPosition;
                             POV_OFF_T macroLength = CurrentFilePosition() - PMac->source;
-                            /// @todo Re-enable cached macros.
                             if (macroLength <= MaxCachedMacroSize)
                             {
-                                PMac->CacheSize = macroLength;
-                                PMac->Cache = new unsigned char[PMac->CacheSize];
+                                // Tokenize the macro body once, so that invocations can replay the
+                                // tokens instead of scanning the source text again.
                                 RawTokenizer::HotBookmark pos = GetHotBookmark();
-                                mTokenizer.GoToBookmark(PMac->source);
-                                if (!mTokenizer.GetRaw(PMac->Cache, PMac->CacheSize))
-                                {
-                                    delete[] PMac->Cache;
-                                    PMac->Cache = nullptr;
-                                }
+                                PMac->Cache = mTokenizer.CacheTokens(PMac->source, PMac->endPosition);
                                 GoToBookmark(pos); // TODO handle errors
                             }
                         }
                     }
+                    if (mpProfiler != nullptr)
+                        mpProfiler->Leave(Cond_Stack.back().profileDepth);
                     Cond_Stack.pop_back();
                     if (Cond_Stack.empty())
                         Error("Mis-matched '#end'.");
@@ -1509,6 +1561,11 @@ void Parser::Parse_Directive()
                         DBL  End        = Cond_Stack.back().For_Loop_End;
                         DBL  Step       = Cond_Stack.back().For_Loop_Step;
 
+                        // the loop body may have assigned a clock-dependent value to the loop variable
+                        POV_LONG reads = mClockDependentReads;
+                        NoteRead(&(Entry->Data));
+                        NoteCondition(reads);
+
                         *CurrentPtr = *CurrentPtr + Step;
 
                         if ( ((Step > 0) && (*CurrentPtr > End + EPSILON)) ||
@@ -1616,6 +1673,7 @@ void Parser::Parse_Directive()
                     ts[124] = ts[125] = ts[126] = '.';
                     ts[127] = 0;
                 }
+                NoteSideEffect();
                 Warning("%s", ts);
                 POV_FREE(ts);
             }
@@ -1663,6 +1721,7 @@ void Parser::Parse_Directive()
                     ts[156] = ts[157] = ts[158] = '.';
                     ts[159] = 0;
                 }
+                NoteSideEffect();
                 Debug_Info("%s", ts);
                 POV_FREE(ts);
             }
@@ -1747,6 +1806,8 @@ void Parser::Parse_Directive()
                     CASE4 (DENSITY_ID_TOKEN, ARRAY_ID_TOKEN, DENSITY_MAP_ID_TOKEN, UV_ID_TOKEN)
                     CASE4 (VECTOR_4D_ID_TOKEN, RAINBOW_ID_TOKEN, FOG_ID_TOKEN, SKYSPHERE_ID_TOKEN)
                     CASE3 (MATERIAL_ID_TOKEN, SPLINE_ID_TOKEN, DICTIONARY_ID_TOKEN)
+                        if (mToken.is_array_elem)
+                            mToken.array->Unpack(mToken.arrayIndex);
                         mToken.table->Remove_Symbol (CurrentTokenText().c_str(), mToken.is_array_elem, mToken.DataPtr, CurrentTokenId());
                         if (mToken.is_mixed_array_elem)
                             *mToken.NumberPtr = IDENTIFIER_TOKEN;
@@ -1757,6 +1818,8 @@ void Parser::Parse_Directive()
                         {
                             case VECTOR_ID_TOKEN:
                             case FLOAT_ID_TOKEN:
+                                if (mToken.is_array_elem)
+                                    mToken.array->Unpack(mToken.arrayIndex);
                                 mToken.table->Remove_Symbol (CurrentTokenText().c_str(), mToken.is_array_elem, mToken.DataPtr, CurrentTokenId());
                                 if (mToken.is_mixed_array_elem)
                                     *mToken.NumberPtr = IDENTIFIER_TOKEN;
@@ -1772,6 +1835,7 @@ void Parser::Parse_Directive()
                         Parse_Error(IDENTIFIER_TOKEN);
                     END_CASE
                 END_EXPECT
+                NoteAssignment(mToken.DataPtr, nullptr, (mToken.is_parameter_ref ? -1 : mToken.context), nullptr, false, false);
                 SetOkToDeclare(true);
             }
         END_CASE
@@ -1860,6 +1924,7 @@ void Parser::Parse_Version()
         sceneData->languageVersionLate = true;
     POV_EXPERIMENTAL_ASSERT(IsOkToDeclare());
     SetOkToDeclare(false);
+    POV_LONG reads = mClockDependentReads;
     bool wasParsingVersionDirective = parsingVersionDirective;
     parsingVersionDirective = true;
     EXPECT_ONE
@@ -1939,6 +2004,8 @@ void Parser::Parse_Version()
         Error("Your scene file requires POV-Ray version %g or later!\n", (DBL)(sceneData->EffectiveLanguageVersion() / 100.0));
     }
 
+    NoteGlobalEffect(reads);
+
     SetOkToDeclare(true);
     parsingVersionDirective = wasParsingVersionDirective;
 }
@@ -1965,12 +2032,18 @@ void Parser::Open_Include()
 {
     char *asciiFileName;
     UCS2String formalFileName; // Name the file is known by to the user.
+    POV_LONG reads = mClockDependentReads;
 
     asciiFileName = Parse_C_String(true);
     formalFileName = ASCIItoUCS2String(asciiFileName);
     POV_FREE(asciiFileName);
 
+    size_t depth = maIncludeStack.size();
     IncludeHeader(formalFileName);
+
+    // which file is included may depend on the clock
+    if ((mpReusableObjects != nullptr) && (mClockDependentReads != reads) && (maIncludeStack.size() > depth))
+        maIncludeStack.back().clockDependentTable = mSymbolStack.GetLocalTableIndex() - 1;
 }
 
 
@@ -2138,6 +2211,7 @@ Parser::Macro *Parser::Parse_Macro()
     New = new Macro(CurrentTokenText().c_str());
 
     Table_Entry->Data=reinterpret_cast<void *>(New);
+    NoteAssignment(&(Table_Entry->Data), nullptr, mSymbolStack.GetGlobalTableIndex(), nullptr, false, false);
 
     EXPECT_ONE
         CASE (LEFT_PAREN_TOKEN)
@@ -2259,6 +2333,7 @@ void Parser::Invoke_Macro()
         {
             bool finalParameter = (i == PMac->parameters.size()-1);
             Table_Entries[i] = SymbolTable::Create_Entry (PMac->parameters[i].name, IDENTIFIER_TOKEN);
+            POV_LONG reads = mClockDependentReads;
             if (!Parse_RValue(IDENTIFIER_TOKEN, &(Table_Entries[i]->Token_Number), &(Table_Entries[i]->Data), nullptr, true, false, true, true, true, Local_Index))
             {
                 EXPECT_ONE
@@ -2293,6 +2368,9 @@ void Parser::Invoke_Macro()
                 SymbolTable::Destroy_Entry (Table_Entries[i]);
                 Table_Entries[i] = nullptr;
             }
+            else
+                // parameters go into the macro's own symbol table, which is more local than any existing one
+                NoteAssignment(&(Table_Entries[i]->Data), nullptr, MAX_NUMBER_OF_TABLES, nullptr, false, (mClockDependentReads != reads));
             properlyDelimited = Parse_Comma();
         }
     }
@@ -2304,6 +2382,9 @@ void Parser::Invoke_Macro()
     Cond_Stack.back().returnToBookmark   = GetHotBookmark();
     Cond_Stack.back().PMac               = PMac;
 
+    if (mpProfiler != nullptr)
+        Cond_Stack.back().profileDepth = mpProfiler->Enter(ParseProfiler::kMacro, PMac->Macro_Name, PMac->source.fileName.c_str(), PMac->source.line);
+
     /* Gotta have new symbol table in case #local is used */
     mSymbolStack.PushTable();
 
@@ -2327,13 +2408,14 @@ void Parser::Invoke_Macro()
         shared_ptr<IStream> is;
         if (PMac->Cache)
         {
-            is = std::make_shared<IMemStream>(Cond_Stack.back().PMac->Cache, PMac->CacheSize, PMac->source.fileName, PMac->source.offset);
+            is = PMac->Cache;
         }
         else
         {
             is = Locate_File (PMac->source.fileName, POV_File_Text_Macro, ign, true);
             if (is == nullptr)
                 Error ("Cannot open macro file '%s'.", UCS2toASCIIString(PMac->source.fileName).c_str());
+            is = Map_Text_File(is, ign);
         }
         mTokenizer.SetInputStream(is);
     }
@@ -2372,14 +2454,15 @@ void Parser::Return_From_Macro()
     // Always destroy macro locals
     mSymbolStack.PopTable();
 
+    if (mpProfiler != nullptr)
+        mpProfiler->Leave(Cond_Stack.back().profileDepth);
     Cond_Stack.pop_back();
     if (Cond_Stack.empty())
         Error("Mis-matched '#end'.");
 }
 
 Parser::Macro::Macro(const char *s) :
-    Macro_Name(POV_STRDUP(s)),
-    Cache(nullptr)
+    Macro_Name(POV_STRDUP(s))
 {}
 
 Parser::Macro::~Macro()
@@ -2392,9 +2475,6 @@ Parser::Macro::~Macro()
     {
         POV_FREE(parameters[i].name);
     }
-
-    if (Cache != nullptr)
-        delete[] Cache;
 }
 
 Parser::POV_ARRAY *Parser::Parse_Array_Declare (void)
@@ -2405,6 +2485,7 @@ Parser::POV_ARRAY *Parser::Parse_Array_Declare (void)
 
     New = new POV_ARRAY;
     New->resizable = false;
+    New->aliased = false;
     New->mixedType = AllowToken(MIXED_TOKEN);
 
     i=0;
@@ -2466,6 +2547,12 @@ Parser::POV_ARRAY *Parser::Parse_Array_Declare (void)
                 Parse_Initalizer(0,0,New);
         END_CASE
 
+        CASE(READ_TOKEN)
+            if (!New->resizable || New->mixedType)
+                Error("Only dynamically sized arrays of a single type can be read from a data file.");
+            Parse_Array_Read(New);
+        END_CASE
+
         OTHERWISE
             UNGET
         END_CASE
@@ -2569,8 +2656,12 @@ void Parser::Parse_Initalizer (int Sub, size_t Base, POV_ARRAY *a)
             else
                 finalParameter = (i == (a->Sizes[Sub]-1));
 
-            if (!Parse_RValue (a->ElementType(Base+i), &(a->ElementType(Base+i)), &(a->DataPtrs[Base+i]),
-                               nullptr, false, false, true, false, true, MAX_NUMBER_OF_TABLES))
+            if (Parse_RValue (a->ElementType(Base+i), &(a->ElementType(Base+i)), &(a->DataPtrs[Base+i]),
+                              nullptr, false, false, true, false, true, MAX_NUMBER_OF_TABLES))
+            {
+                a->Pack(Base+i);
+            }
+            else
             {
                 EXPECT_ONE
                     CASE (IDENTIFIER_TOKEN)
@@ -2636,6 +2727,8 @@ void Parser::Parse_Fopen(void)
     GET(IDENTIFIER_TOKEN)
     Entry = mSymbolStack.GetGlobalTable()->Add_Symbol (CurrentTokenText(), FILE_ID_TOKEN);
     Entry->Data=reinterpret_cast<void *>(New);
+    // the file may have been written by a previous frame, so anything read from it may vary
+    NoteAssignment(&(Entry->Data), nullptr, mSymbolStack.GetGlobalTableIndex(), nullptr, false, true);
 
     asciiFileName = Parse_C_String(true);
     fileName = ASCIItoUCS2String(asciiFileName);
@@ -2695,6 +2788,7 @@ void Parser::Parse_Fclose(void)
             Got_EOF=false;
             Data->inTokenizer = nullptr;
             Data->Out_File = nullptr;
+            NoteAssignment(mToken.DataPtr, nullptr, mSymbolStack.GetGlobalTableIndex(), nullptr, false, true);
             mSymbolStack.GetGlobalTable()->Remove_Symbol(CurrentTokenText().c_str(), false, nullptr, 0);
         END_CASE
 
@@ -2728,6 +2822,8 @@ void Parser::Parse_Read()
     // directive (or the user forgetting portions of the directive).
     User_File->busyParsing = true;
 
+    NoteSideEffect();
+
     Parse_Comma(); /* Scene file comma between File_Id and 1st data ident */
 
     LValue_Ok = true;
@@ -2738,6 +2834,7 @@ void Parser::Parse_Read()
             {
                 Temp_Entry = mSymbolStack.GetGlobalTable()->Add_Symbol (CurrentTokenText(), IDENTIFIER_TOKEN);
                 End_File = Parse_Read_Value (User_File, CurrentTokenId(), &(Temp_Entry->Token_Number), &(Temp_Entry->Data));
+                NoteAssignment(&(Temp_Entry->Data), nullptr, mSymbolStack.GetGlobalTableIndex(), nullptr, false, true);
                 mToken.is_array_elem = false;
                 mToken.is_mixed_array_elem = false;
                 mToken.is_dictionary_elem = false;
@@ -2749,6 +2846,8 @@ void Parser::Parse_Read()
             if (!End_File)
             {
                 End_File = Parse_Read_Value (User_File, CurrentTokenId(), mToken.NumberPtr, mToken.DataPtr);
+                NoteAssignment(mToken.DataPtr, (CurrentTokenIsContainerElement() ? mToken.rootDataPtr : nullptr),
+                               (mToken.is_parameter_ref ? -1 : mToken.context), nullptr, false, true);
                 mToken.is_array_elem = false;
                 mToken.is_mixed_array_elem = false;
                 mToken.is_dictionary_elem = false;
@@ -2763,7 +2862,13 @@ void Parser::Parse_Read()
                 case FLOAT_ID_TOKEN:
                     if (!End_File)
                     {
+                        POV_ARRAY* a = (CurrentTokenIsArrayElement() ? mToken.array : nullptr);
+                        size_t index = mToken.arrayIndex;
                         End_File = Parse_Read_Value (User_File, CurrentTokenFunctionId(), mToken.NumberPtr, mToken.DataPtr);
+                        NoteAssignment(mToken.DataPtr, (CurrentTokenIsContainerElement() ? mToken.rootDataPtr : nullptr),
+                                       (mToken.is_parameter_ref ? -1 : mToken.context), nullptr, false, true);
+                        if (a != nullptr)
+                            a->Pack(index);
                         Parse_Comma(); /* Scene file comma between 2 idents */
                     }
                     break;
@@ -2888,7 +2993,7 @@ int Parser::Parse_Read_Value(DATA_FILE *User_File, TokenId Previous, TokenId *Nu
                 *NumberPtr = STRING_ID_TOKEN;
                 Test_Redefine(Previous,NumberPtr,*DataPtr);
                 POV_PARSER_ASSERT(dynamic_pointer_cast<const StringValue>(User_File->inToken.value) != nullptr);
-                *DataPtr   = UCS2_strdup(dynamic_pointer_cast<const StringValue>(User_File->inToken.value)->GetData().c_str());
+                *DataPtr   = reinterpret_cast<void *>(new AssignableString(dynamic_pointer_cast<const StringValue>(User_File->inToken.value)->GetData().c_str()));
                 break;
 
             default:
@@ -2930,13 +3035,287 @@ bool Parser::Parse_Read_Float_Value(DBL& val, DATA_FILE* User_File)
     }
 }
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Parse_Array_Read
+*
+* INPUT
+*
+*   a - freshly declared, dynamically sized array
+*
+* OUTPUT
+*
+*   a - filled with the contents of the data file
+*
+* RETURNS
+*
+* AUTHOR
+*
+* DESCRIPTION
+*
+*   Parse the file name following `array read`, and fill the array with the
+*   numbers in that file in one go, bypassing the scanner.
+*
+*   The file holds one element per line, each made up of one, three or five
+*   numbers for a float, vector or colour respectively; all lines must have
+*   the same number of values. Values may be separated by white space, commas
+*   or semicolons, and angle brackets are ignored, so that both CSV files and
+*   files of vectors written by `#write` can be read. Empty lines and the
+*   remainder of a line following `//` are skipped.
+*
+*   The file is memory-mapped and split into portions at line boundaries,
+*   which are parsed in parallel, and the values are stored directly in the
+*   array's packed storage.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+/// Minimum size of the portions of a data file parsed in parallel.
+static const size_t kMinDataChunkSize = 1024*1024;
+
+/// Maximum length of a single number in a data file.
+static const size_t kMaxDataNumberLength = 63;
+
+/// Portion of a numeric data file, and the values parsed from it.
+struct NumericDataChunk
+{
+    const char *begin;          ///< First character of the portion.
+    const char *end;            ///< End of the portion; always at the end of a line.
+    vector<DBL> values;         ///< Values parsed, in order.
+    int width;                  ///< Number of values per line, or zero if there were none.
+    const char *widthAt;        ///< End of the first line that had values.
+    const char *error;          ///< Location of the first malformed value or line, or `nullptr`.
+
+    NumericDataChunk() : begin(nullptr), end(nullptr), width(0), widthAt(nullptr), error(nullptr) {}
+};
+
+static inline bool IsNumericDataSeparator(char c)
+{
+    return (isspace((unsigned char)c) || (c == ',') || (c == ';') || (c == '<') || (c == '>'));
+}
+
+static inline bool IsNumericDataCharacter(char c)
+{
+    return (isdigit((unsigned char)c) || (c == '+') || (c == '-') || (c == '.') || (c == 'e') || (c == 'E'));
+}
+
+static bool EndNumericDataLine(NumericDataChunk& chunk, int& count, const char *p)
+{
+    if (count > 0)
+    {
+        if (chunk.width == 0)
+        {
+            chunk.width = count;
+            chunk.widthAt = p;
+        }
+        else if (count != chunk.width)
+        {
+            chunk.error = p;
+            return false;
+        }
+    }
+    count = 0;
+    return true;
+}
+
+static void ParseNumericData(NumericDataChunk& chunk)
+{
+    char buffer[kMaxDataNumberLength + 1];
+    const char *p = chunk.begin;
+    int count = 0;
+
+    // Typical data files have some ten characters per value.
+    chunk.values.reserve((chunk.end - chunk.begin) / 10);
+
+    while (p < chunk.end)
+    {
+        if (*p == '\n')
+        {
+            if (!EndNumericDataLine(chunk, count, p))
+                return;
+            ++p;
+        }
+        else if (IsNumericDataSeparator(*p))
+            ++p;
+        else if ((*p == '/') && (p + 1 < chunk.end) && (p[1] == '/'))
+        {
+            while ((p < chunk.end) && (*p != '\n'))
+                ++p;
+        }
+        else
+        {
+            const char *start = p;
+            while ((p < chunk.end) && IsNumericDataCharacter(*p))
+                ++p;
+
+            size_t length = p - start;
+            if ((length == 0) || (length > kMaxDataNumberLength) || ((p < chunk.end) && !IsNumericDataSeparator(*p)))
+            {
+                chunk.error = start;
+                return;
+            }
+
+            // Copy the number, as the file's contents are not null-terminated.
+            char *stop;
+            std::memcpy(buffer, start, length);
+            buffer[length] = '\0';
+            DBL value = std::strtod(buffer, &stop);
+            if (stop != buffer + length)
+            {
+                chunk.error = start;
+                return;
+            }
+
+            chunk.values.push_back(value);
+            ++count;
+        }
+    }
+
+    EndNumericDataLine(chunk, count, p);
+}
+
+/// Functor parsing a portion of a numeric data file in a worker thread.
+struct NumericDataParser
+{
+    NumericDataChunk *chunk;
+
+    NumericDataParser(NumericDataChunk *c) : chunk(c) {}
+    void operator()() { ParseNumericData(*chunk); }
+};
+
+void Parser::Parse_Array_Read(POV_ARRAY *a)
+{
+    UCS2String fileName;
+    MappedFile file;
+    char *name;
+
+    POV_PARSER_ASSERT(a->resizable && !a->mixedType && a->DataPtrs.empty());
+
+    // The file may have been written by a previous frame, so its contents may vary.
+    NoteSideEffect();
+    NoteClockRead();
+
+    name = Parse_C_String(true);
+    if (Locate_File(ASCIItoUCS2String(name), POV_File_Text_User, fileName, true) == nullptr)
+    {
+        POV_FREE(name);
+        Error("Cannot open data file.");
+    }
+    POV_FREE(name);
+
+    if (!file.Open(UCS2toASCIIString(fileName).c_str()))
+        Error("Cannot map data file '%s'.", UCS2toASCIIString(fileName).c_str());
+
+    const char *data = reinterpret_cast<const char *>(file.GetData());
+    size_t size = file.GetSize();
+    size_t chunks = std::max(size_t(1), std::min(size / kMinDataChunkSize, size_t(boost::thread::hardware_concurrency())));
+    vector<NumericDataChunk> chunk(chunks);
+    const char *p = data;
+
+    // Split the file at the first line break past each nominal boundary.
+    for (size_t i = 0; i < chunks; ++i)
+    {
+        const char *end = data + size;
+        if (i < chunks - 1)
+        {
+            const char *from = std::max(p, data + size * (i + 1) / chunks);
+            const char *lineBreak = reinterpret_cast<const char *>(std::memchr(from, '\n', end - from));
+            if (lineBreak != nullptr)
+                end = lineBreak + 1;
+        }
+        chunk[i].begin = p;
+        chunk[i].end = end;
+        p = end;
+    }
+
+    {
+        boost::thread_group threads;
+        for (size_t i = 1; i < chunks; ++i)
+            threads.create_thread(NumericDataParser(&chunk[i]));
+        ParseNumericData(chunk[0]);
+        threads.join_all();
+    }
+
+    size_t count = 0;
+    int width = 0;
+    for (size_t i = 0; i < chunks; ++i)
+    {
+        const char *error = chunk[i].error;
+        if ((error == nullptr) && (chunk[i].width != 0) && (width != 0) && (chunk[i].width != width))
+            error = chunk[i].widthAt;
+        if (error != nullptr)
+            Error("Malformed or inconsistent line %d in data file '%s'.",
+                  int(std::count(data, error, '\n') + 1), UCS2toASCIIString(fileName).c_str());
+        if (width == 0)
+            width = chunk[i].width;
+        count += chunk[i].values.size();
+    }
+
+    if (count == 0)
+        return;
+
+    if ((width != 1) && (width != 3) && (width != 5))
+        Error("Data file '%s' must have one, three or five values per line.", UCS2toASCIIString(fileName).c_str());
+
+    count /= width;
+    if (count > size_t(std::numeric_limits<int>::max()))
+        Error("Too many elements in data file '%s'.", UCS2toASCIIString(fileName).c_str());
+
+    a->Sizes[0] = int(count);
+    a->DataPtrs.resize(count);
+
+    size_t k = 0;
+    switch (width)
+    {
+        case 1:
+            a->Type_ = FLOAT_ID_TOKEN;
+            a->PackedFloats.resize(count);
+            for (size_t i = 0; i < chunks; ++i)
+                for (size_t j = 0; j < chunk[i].values.size(); ++j, ++k)
+                {
+                    a->PackedFloats[k] = chunk[i].values[j];
+                    a->DataPtrs[k] = &a->PackedFloats[k];
+                }
+            break;
+
+        case 3:
+            a->Type_ = VECTOR_ID_TOKEN;
+            a->PackedVectors.resize(count);
+            for (size_t i = 0; i < chunks; ++i)
+                for (size_t j = 0; j < chunk[i].values.size(); j += 3, ++k)
+                {
+                    a->PackedVectors[k] = Vector3d(chunk[i].values[j], chunk[i].values[j+1], chunk[i].values[j+2]);
+                    a->DataPtrs[k] = &a->PackedVectors[k];
+                }
+            break;
+
+        case 5:
+            a->Type_ = COLOUR_ID_TOKEN;
+            a->PackedColours.resize(count);
+            for (size_t i = 0; i < chunks; ++i)
+                for (size_t j = 0; j < chunk[i].values.size(); j += 5, ++k)
+                {
+                    const DBL *v = &chunk[i].values[j];
+                    a->PackedColours[k] = RGBFTColour(v[0], v[1], v[2], v[3], v[4]);
+                    a->DataPtrs[k] = &a->PackedColours[k];
+                }
+            break;
+    }
+}
+
 void Parser::Parse_Write(void)
 {
-    char *temp;
     DATA_FILE *User_File;
     EXPRESS Express;
     int Terms;
 
+    NoteSideEffect();
+
     Parse_Paren_Begin();
 
     GET(FILE_ID_TOKEN)
@@ -3016,15 +3395,22 @@ void Parser::Parse_Write(void)
         CASE5 (STRING_LITERAL_TOKEN,CHR_TOKEN,SUBSTR_TOKEN,STR_TOKEN,VSTR_TOKEN)
         CASE5 (CONCAT_TOKEN,STRUPR_TOKEN,STRLWR_TOKEN,DATETIME_TOKEN,STRING_ID_TOKEN)
             UNGET
-            temp=Parse_C_String();
-            if(strlen(temp) > 512)
             {
-                for(char *ptr = temp; *ptr != 0; ptr++)
-                    User_File->Out_File->printf("%c", *ptr);
+                // Stream the string in portions, rather than converting it as a whole.
+                AssignableString *str = Parse_String_Value();
+                const UCS2 *data = str->data();
+                char buffer[513];
+                size_t i = 0;
+                while (i < str->size())
+                {
+                    size_t n;
+                    for (n = 0; (n < 512) && (i < str->size()); ++n, ++i)
+                        buffer[n] = (((data[i] > 127) && (sceneData->EffectiveLanguageVersion() >= 350)) ? ' ' : (char)data[i]);
+                    buffer[n] = '\0';
+                    User_File->Out_File->printf("%s", buffer);
+                }
+                delete str;
             }
-            else
-                User_File->Out_File->printf("%s", temp);
-            POV_FREE(temp);
         END_CASE
 
         CASE_VECTOR_UNGET
@@ -3080,6 +3466,8 @@ DBL Parser::Parse_Cond_Param(void)
     bool Old_Sk = Skipping;
     DBL Val;
 
+    POV_LONG reads = mClockDependentReads;
+
     SetOkToDeclare(false);
     Skipping      = false;
 
@@ -3088,6 +3476,8 @@ DBL Parser::Parse_Cond_Param(void)
     SetOkToDeclare(oldOkToDeclare);
     Skipping      = Old_Sk;
 
+    NoteCondition(reads);
+
     return(Val);
 }
 
@@ -3096,6 +3486,8 @@ void Parser::Parse_Cond_Param2(DBL *V1,DBL *V2)
     bool oldOkToDeclare = IsOkToDeclare();
     bool Old_Sk = Skipping;
 
+    POV_LONG reads = mClockDependentReads;
+
     SetOkToDeclare(false);
     Skipping      = false;
 
@@ -3103,6 +3495,8 @@ void Parser::Parse_Cond_Param2(DBL *V1,DBL *V2)
 
     SetOkToDeclare(oldOkToDeclare);
     Skipping      = Old_Sk;
+
+    NoteCondition(reads);
 }
 
 void Parser::Inc_CS_Index()
@@ -3239,6 +3633,8 @@ int Parser::Parse_For_Param (UTF8String& identifierName, DBL* EndPtr, DBL* StepP
     Test_Redefine(Previous,mToken.NumberPtr,*mToken.DataPtr, true);
     *mToken.DataPtr   = reinterpret_cast<void *>(Create_Float());
     DBL* CurrentPtr = (reinterpret_cast<DBL *>(*mToken.DataPtr));
+    void** dataPtr = mToken.DataPtr;
+    POV_LONG reads = mClockDependentReads;
 
     identifierName = CurrentTokenText();
 
@@ -3254,6 +3650,9 @@ int Parser::Parse_For_Param (UTF8String& identifierName, DBL* EndPtr, DBL* StepP
 
     Parse_Paren_End();
 
+    NoteAssignment(dataPtr, nullptr, mSymbolStack.GetLocalTableIndex(), &identifierName, false, (mClockDependentReads != reads));
+    NoteCondition(reads);
+
     return ((*StepPtr > 0) && (*CurrentPtr < *EndPtr + EPSILON)) ||
            ((*StepPtr < 0) && (*CurrentPtr > *EndPtr - EPSILON));
 }
@@ -3289,7 +3688,10 @@ void Parser::IncludeHeader(const UCS2String& formalFileName)
     if (is == nullptr)
         Error ("Cannot open include file %s.", UCS2toASCIIString(formalFileName).c_str());
 
-    SetInputStream(is);
+    if (mpProfiler != nullptr)
+        maIncludeStack.back().profileDepth = mpProfiler->Enter(ParseProfiler::kInclude, "", actualFileName.c_str(), 0);
+
+    SetInputStream(Open_Cached_Include(Map_Text_File(is, actualFileName)));
 
     mSymbolStack.PushTable();
 
@@ -3298,4 +3700,159 @@ void Parser::IncludeHeader(const UCS2String& formalFileName)
     CheckFileSignature();
 }
 
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Map_Text_File
+*
+* INPUT
+*
+*   is             - the text file as located
+*   actualFileName - the file's name in the file system
+*
+* RETURNS
+*
+*   The stream to parse the text file from
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Where the platform supports memory-mapped files, maps the text file into
+*   memory, so that the scanner can process it in place instead of copying it
+*   through its buffer chunk by chunk. Falls back to the original stream if
+*   the file cannot be mapped.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+shared_ptr<IStream> Parser::Map_Text_File(const shared_ptr<IStream>& is, const UCS2String& actualFileName)
+{
+#if !POV_USE_DEFAULT_FILE_MAPPING
+    if ((is == nullptr) || actualFileName.empty())
+        return is;
+
+    shared_ptr<MappedFile> file(new MappedFile());
+    if (!file->Open(UCS2toASCIIString(actualFileName).c_str()) || (file->GetSize() == 0))
+        return is;
+
+    // The scanner works through the file front to back, so have it read in ahead of time.
+    file->Prefetch();
+
+    // Keep the formal name, as that is what bookmarks and messages refer to.
+    return std::make_shared<IMappedFileStream>(file, is->Name());
+#else
+    return is;
+#endif
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   Open_Cached_Include
+*
+* INPUT
+*
+*   is - the include file as located
+*
+* RETURNS
+*
+*   The stream to parse the include file from
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   If include caching is enabled, reads the entire include file and replaces
+*   it by a stream carrying its raw tokens. The tokens are read from the token
+*   cache file if one exists for the same file contents; otherwise the file is
+*   tokenized and the token cache file is (re-)written.
+*
+* CHANGES
+*
+*   Oct 2026 : Creation.
+*
+******************************************************************************/
+
+// 64 bit FNV-1a hash
+static inline void HashIncludeCacheKey(POV_UINT64& hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+}
+
+shared_ptr<IStream> Parser::Open_Cached_Include(const shared_ptr<IStream>& is)
+{
+    if (sceneData->includeCachePath.empty())
+        return is;
+
+    // The entire contents are needed anyway, to identify the file as well as to back the cache.
+    vector<unsigned char> contents;
+    const size_t kChunkSize = 65536;
+    for (;;)
+    {
+        size_t used = contents.size();
+        contents.resize(used + kChunkSize);
+        size_t count = is->readUpTo(contents.data() + used, kChunkSize);
+        contents.resize(used + count);
+        if (count < kChunkSize)
+            break;
+    }
+
+    POV_UINT64 key = 0xCBF29CE484222325ull;
+    HashIncludeCacheKey(key, contents.data(), contents.size());
+
+    UCS2String fileName(is->Name());
+    POV_UINT64 nameHash = 0xCBF29CE484222325ull;
+    HashIncludeCacheKey(nameHash, fileName.data(), fileName.size() * sizeof(UCS2));
+
+    char cacheName[32];
+    sprintf(cacheName, "%016llx.tkc", (unsigned long long) nameHash);
+    UCS2String cacheFileName(sceneData->includeCachePath);
+    if ((cacheFileName.back() != POV_PATH_SEPARATOR) && (cacheFileName.back() != '/'))
+        cacheFileName += POV_PATH_SEPARATOR;
+    cacheFileName += ASCIItoUCS2String(cacheName);
+
+    unsigned char *data = new unsigned char[max(contents.size(), size_t(1))];
+    if (!contents.empty())
+        memcpy(data, contents.data(), contents.size());
+    TokenCacheStreamPtr pCache = std::make_shared<TokenCacheStream>(data, contents.size(), fileName);
+
+    UCS2String ign;
+    shared_ptr<IStream> cacheFile(Locate_File(cacheFileName, POV_File_Data_TKC, ign, false));
+    if ((cacheFile != nullptr) && mTokenizer.ReadTokenCache(*cacheFile, key, pCache, is))
+        return pCache;
+
+    if (!mTokenizer.CacheTokens(pCache, is))
+    {
+        // Leave it to the conventional scanning to deal with whatever went wrong.
+        if (!is->seekg(0))
+            Error("Unable to file seek in include file.");
+        return is;
+    }
+
+    // The cache is merely an optimization, so failing to write it is not an error.
+    std::unique_ptr<OStream> newCacheFile(CreateFile(cacheFileName, POV_File_Data_TKC, false));
+    if ((newCacheFile != nullptr) && *newCacheFile)
+        RawTokenizer::WriteTokenCache(*newCacheFile, key, *pCache);
+
+    return pCache;
+}
+
 }
@@ -37,7 +37,11 @@
 #include "parser/parsertypes.h"
 
 // C++ variants of C standard header files
+//  (none at the moment)
+
 // C++ standard header files
+#include <algorithm>
+
 // Boost header files
 //  (none at the moment)
 
@@ -128,4 +132,36 @@ InvalidEscapeSequenceException::InvalidEscapeSequenceException(const UCS2String&
     offendingText(otb, ote)
 {}
 
+//******************************************************************************
+
+void AssignableString::Append(const UCS2 *s, size_t count)
+{
+    if (mBuffer == nullptr)
+        mBuffer = std::make_shared<UCS2String>();
+    else if (mBuffer->size() != mSize)
+        // Another value sharing the buffer has been extended already.
+        mBuffer = std::make_shared<UCS2String>(*mBuffer, 0, mSize);
+    mBuffer->append(s, count);
+    mSize += count;
+}
+
+void AssignableString::Append(const UCS2 *s)
+{
+    size_t count = 0;
+    while (s[count] != 0)
+        ++count;
+    Append(s, count);
+}
+
+UCS2 *AssignableString::Duplicate(size_t start, size_t count) const
+{
+    POV_PARSER_ASSERT(start <= mSize);
+    count = std::min(count, mSize - start);
+    UCS2 *s = reinterpret_cast<UCS2 *>(POV_MALLOC((count + 1) * sizeof(UCS2), "UCS2 String"));
+    if (count > 0)
+        POV_MEMCPY(s, mBuffer->data() + start, count * sizeof(UCS2));
+    s[count] = 0;
+    return s;
+}
+
 }
@@ -68,6 +68,9 @@ enum TokenId : int;
 using StreamPtr = shared_ptr<pov_base::IStream>;
 using ConstStreamPtr = shared_ptr<const pov_base::IStream>;
 
+/// Hash value of an identifier, as used to look up symbols.
+using SymbolHash = POV_UINT32;
+
 //------------------------------------------------------------------------------
 
 struct LexemePosition : pov::SourcePosition
@@ -191,6 +194,45 @@ struct Assignable
     virtual Assignable* Clone() const = 0;
 };
 
+/// Value of a string identifier.
+///
+/// Strings built piece by piece, e.g. via `#declare S = concat(S, ...)` in a loop, would take
+/// quadratic time if every step copied the string built so far. Instead, values share an
+/// append-only buffer, each value being a prefix of that buffer: Copying a value merely shares
+/// the buffer, and appending to a value that extends to the end of its buffer appends to the
+/// buffer in place. Only appending to a value that another value has already been extended
+/// beyond copies the value into a buffer of its own.
+///
+/// @note   The contents are not null-terminated; use @ref Duplicate() to obtain a C-style string.
+///
+struct AssignableString : public Assignable
+{
+    AssignableString() : mSize(0) {}
+    explicit AssignableString(const UCS2 *s) : mSize(0) { Append(s); }
+    AssignableString(const AssignableString& obj) : mBuffer(obj.mBuffer), mSize(obj.mSize) {}
+    virtual AssignableString* Clone() const override { return new AssignableString(*this); }
+
+    /// Get the number of characters.
+    size_t size() const { return mSize; }
+
+    /// Get the characters.
+    const UCS2 *data() const { return (mBuffer == nullptr ? nullptr : mBuffer->data()); }
+
+    /// Append characters.
+    void Append(const UCS2 *s, size_t count);
+
+    /// Append a null-terminated string.
+    void Append(const UCS2 *s);
+
+    /// Create a null-terminated copy, allocated with `POV_MALLOC`.
+    UCS2 *Duplicate(size_t start = 0, size_t count = UCS2String::npos) const;
+
+private:
+
+    shared_ptr<UCS2String> mBuffer;
+    size_t mSize;
+};
+
 //------------------------------------------------------------------------------
 
 struct ParserOptions
@@ -37,13 +37,18 @@
 #include "parser/rawtokenizer.h"
 
 // C++ variants of C standard header files
+#include <cstring>
+
 // C++ standard header files
+#include <algorithm>
+
 // Boost header files
 // POV-Ray header files (base module)
 //  (none at the moment)
 
 // POV-Ray header files (parser module)
 #include "parser/reservedwords.h"
+#include "parser/symboltable.h"
 
 // this must be the last file included
 #include "base/povdebug.h"
@@ -78,9 +83,52 @@ TokenId RawToken::GetTokenId() const
 
 //******************************************************************************
 
+TokenCacheStream::TokenCacheStream(unsigned char* data, size_t size, const Scanner::ColdBookmark& origin) :
+    IMemStream(data, size, origin.fileName, origin.offset),
+    begin(origin),
+    mpData(data)
+{}
+
+TokenCacheStream::TokenCacheStream(unsigned char* data, size_t size, const UCS2String& formalName) :
+    IMemStream(data, size, formalName, 0),
+    mpData(data)
+{
+    end.offset = size;
+}
+
+size_t TokenCacheStream::FindToken(POV_OFF_T offset) const
+{
+    size_t lo = 0;
+    size_t hi = tokens.size();
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if (tokens[mid].lexeme.position.offset < offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+LexemePosition TokenCacheStream::GetPosition(size_t index) const
+{
+    if (index < tokens.size())
+        return tokens[index].lexeme.position;
+    return end;
+}
+
+bool TokenCacheStream::Contains(POV_OFF_T offset) const
+{
+    return (offset >= begin.offset) && (offset <= end.offset);
+}
+
+//******************************************************************************
+
 RawTokenizer::KnownWordInfo::KnownWordInfo() :
     id(int(NOT_A_TOKEN)),
     expressionId(NOT_A_TOKEN),
+    hash(0),
     isReservedWord(false),
     isPseudoIdentifier(false)
 {}
@@ -88,7 +136,8 @@ RawTokenizer::KnownWordInfo::KnownWordInfo() :
 //******************************************************************************
 
 RawTokenizer::RawTokenizer() :
-    mNextIdentifierId(TOKEN_COUNT+1)
+    mNextIdentifierId(TOKEN_COUNT+1),
+    mTokenCacheIndex(0)
 {
     for (auto i = Reserved_Words; i->Token_Name != nullptr; ++i)
     {
@@ -99,6 +148,7 @@ RawTokenizer::RawTokenizer() :
         KnownWordInfo& knownWord = mKnownWords[i->Token_Name];
         knownWord.id = i->Token_Number;
         knownWord.expressionId = GetExpressionId(i->Token_Number);
+        knownWord.hash = SymbolTable::GetHashValue(i->Token_Name);
         knownWord.isReservedWord = true;
         knownWord.isPseudoIdentifier = ((knownWord.id == GLOBAL_TOKEN) || (knownWord.id == LOCAL_TOKEN));
     }
@@ -106,7 +156,10 @@ RawTokenizer::RawTokenizer() :
 
 void RawTokenizer::SetInputStream(StreamPtr pStream)
 {
-    mScanner.SetInputStream(pStream);
+    mpTokenCache = std::dynamic_pointer_cast<TokenCacheStream>(pStream);
+    mTokenCacheIndex = 0;
+    if (mpTokenCache == nullptr)
+        mScanner.SetInputStream(pStream);
 }
 
 void RawTokenizer::SetStringEncoding(CharacterEncodingID encoding)
@@ -123,14 +176,28 @@ void pov_parser::RawTokenizer::SetNestedBlockComments(bool allow)
 
 bool RawTokenizer::GetNextToken(RawToken& token)
 {
+    if (mpTokenCache != nullptr)
+    {
+        if (mTokenCacheIndex >= mpTokenCache->tokens.size())
+            return false;
+        token = mpTokenCache->tokens[mTokenCacheIndex++];
+        return true;
+    }
+
     if (!mScanner.GetNextLexeme(token.lexeme))
         return false;
 
+    return ProcessLexeme(token, mScanner.GetInputStream());
+}
+
+bool RawTokenizer::ProcessLexeme(RawToken& token, const ConstStreamPtr& pSource)
+{
+    token.symbolHash = 0;
     switch (token.lexeme.category)
     {
         case Lexeme::kWord:             if (ProcessWordLexeme(token))           return true;
         case Lexeme::kFloatLiteral:     if (ProcessFloatLiteralLexeme(token))   return true;
-        case Lexeme::kStringLiteral:    if (ProcessStringLiteralLexeme(token))  return true;
+        case Lexeme::kStringLiteral:    if (ProcessStringLiteralLexeme(token, pSource)) return true;
         case Lexeme::kOther:            if (ProcessOtherLexeme(token))          return true;
         case Lexeme::kUTF8SignatureBOM: if (ProcessSignatureLexeme(token))      return true;
         default:                        POV_PARSER_PANIC();                     return true;
@@ -139,6 +206,21 @@ bool RawTokenizer::GetNextToken(RawToken& token)
 
 bool RawTokenizer::GetNextDirective(RawToken& token)
 {
+    if (mpTokenCache != nullptr)
+    {
+        const std::vector<RawToken>& tokens = mpTokenCache->tokens;
+        while (mTokenCacheIndex < tokens.size())
+        {
+            if (tokens[mTokenCacheIndex].id == int(HASH_TOKEN))
+            {
+                token = tokens[mTokenCacheIndex++];
+                return true;
+            }
+            ++mTokenCacheIndex;
+        }
+        return false;
+    }
+
     if (!mScanner.GetNextDirective(token.lexeme))
         return false;
 
@@ -164,9 +246,11 @@ bool RawTokenizer::ProcessWordLexeme(RawToken& token)
     {
         i.id = ++mNextIdentifierId;
         i.expressionId = IDENTIFIER_TOKEN;
+        i.hash = SymbolTable::GetHashValue(token.lexeme.text.c_str(), token.lexeme.text.size());
     }
     token.id = i.id;
     token.expressionId = i.expressionId;
+    token.symbolHash = i.hash;
     token.value = nullptr;
     token.isReservedWord = i.isReservedWord;
     token.isPseudoIdentifier = i.isPseudoIdentifier;
@@ -190,7 +274,7 @@ bool RawTokenizer::ProcessFloatLiteralLexeme(RawToken& token)
     return true;
 }
 
-bool RawTokenizer::ProcessStringLiteralLexeme(RawToken& token)
+bool RawTokenizer::ProcessStringLiteralLexeme(RawToken& token, const ConstStreamPtr& pSource)
 {
     POV_PARSER_ASSERT(token.lexeme.category == Lexeme::kStringLiteral);
     POV_PARSER_ASSERT(token.lexeme.text.size() >= 2);
@@ -282,7 +366,7 @@ bool RawTokenizer::ProcessStringLiteralLexeme(RawToken& token)
 
                 if (isInvalid && (pAmbiguousValue->invalidEscapeSequence == nullptr))
                     pAmbiguousValue->invalidEscapeSequence = new AmbiguousStringValue::InvalidEscapeSequenceInfo(
-                        mScanner.GetInputStream(), token.lexeme.position, escapeSequenceBegin, escapeSequenceEnd);
+                        pSource, token.lexeme.position, escapeSequenceBegin, escapeSequenceEnd);
             }
             else
             {
@@ -441,40 +525,330 @@ TokenId pov_parser::RawTokenizer::GetExpressionId(TokenId tokenId)
 
 //------------------------------------------------------------------------------
 
-bool RawTokenizer::GetRaw(unsigned char* buffer, size_t size)
+TokenCacheStreamPtr RawTokenizer::CacheTokens(const ColdBookmark& begin, const LexemePosition& end)
 {
-    return mScanner.GetRaw(buffer, size);
+    if (end.offset < begin.offset)
+        return nullptr;
+
+    ConstStreamPtr pSource = GetInputStream();
+
+    // Position the scanner at the start of the section; when replaying a token cache
+    // (e.g. a macro declared within a cached macro), read from the cache's own copy of the data.
+    if (mpTokenCache != nullptr)
+    {
+        if (!mpTokenCache->Contains(begin.offset) || !mpTokenCache->Contains(end.offset))
+            return nullptr;
+        HotBookmark cacheBegin(mpTokenCache, begin, begin.characterEncoding, begin.nominalEndOfLine, begin.allowNestedBlockComments);
+        mpTokenCache = nullptr;
+        if (!mScanner.GoToBookmark(cacheBegin))
+            return nullptr;
+    }
+    else if (!mScanner.GoToBookmark(begin))
+        return nullptr;
+
+    // The section includes the terminating `#`.
+    size_t size = size_t(end.offset - begin.offset) + 1;
+    std::unique_ptr<unsigned char[]> data(new unsigned char[size]);
+    if (!mScanner.GetRaw(data.get(), size))
+        return nullptr;
+
+    TokenCacheStreamPtr pCache = std::make_shared<TokenCacheStream>(data.release(), size, begin);
+
+    // Tokenize the copy using a dedicated scanner, so that the copy is scanned with
+    // exactly the same settings the original would have been scanned with.
+    Scanner scanner;
+    if (!scanner.GoToBookmark(HotBookmark(pCache, begin, begin.characterEncoding, begin.nominalEndOfLine, begin.allowNestedBlockComments)))
+        return nullptr;
+
+    try
+    {
+        RawToken token;
+        while (scanner.GetNextLexeme(token.lexeme))
+        {
+            if (!ProcessLexeme(token, pSource))
+                return nullptr;
+            pCache->tokens.push_back(token);
+            if (token.lexeme.position.offset >= end.offset)
+                break;
+        }
+    }
+    catch (const TokenizerException&)
+    {
+        // Sections skipped during parsing may contain stuff that doesn't tokenize;
+        // such sections are left to be scanned the conventional way.
+        return nullptr;
+    }
+
+    if (pCache->tokens.empty() || (pCache->tokens.back().lexeme.position != end) ||
+        (pCache->tokens.back().id != int(HASH_TOKEN)))
+        return nullptr;
+
+    pCache->end = end;
+    pCache->end.offset += 1;
+    pCache->end.column += 1;
+    pCache->tokens.shrink_to_fit();
+
+    return pCache;
+}
+
+bool RawTokenizer::CacheTokens(const TokenCacheStreamPtr& pCache, const ConstStreamPtr& pSource)
+{
+    Scanner scanner;
+    scanner.SetInputStream(pCache);
+    pCache->begin = scanner.GetColdBookmark();
+    pCache->tokens.clear();
+
+    try
+    {
+        RawToken token;
+        while (scanner.GetNextLexeme(token.lexeme))
+        {
+            if (!ProcessLexeme(token, pSource))
+                return false;
+            // Mimic the parser switching encodings when it encounters a signature.
+            if (pCache->tokens.empty() && (token.id == int(UTF8_SIGNATURE_TOKEN)))
+                scanner.SetCharacterEncoding(CharacterEncodingID::kUTF8);
+            pCache->tokens.push_back(token);
+        }
+    }
+    catch (const TokenizerException&)
+    {
+        // Leave it to the conventional scanning to report the error.
+        pCache->tokens.clear();
+        return false;
+    }
+
+    pCache->end = scanner.GetColdBookmark();
+    pCache->tokens.shrink_to_fit();
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+static const char kTokenCacheFileMagic[8] = { 'P', 'O', 'V', 'T', 'K', 'C', '\r', '\n' };
+static const POV_UINT32 kTokenCacheFileVersion = 1;
+
+struct TokenCacheFileHeader
+{
+    char        magic[8];
+    POV_UINT32  version;
+    POV_UINT32  recordSize;
+    POV_UINT64  key;
+    POV_UINT64  dataSize;
+    POV_UINT64  lexemes;
+    POV_UINT64  textSize;
+    POV_INT64   endLine;
+    POV_INT64   endColumn;
+};
+
+struct TokenCacheFileRecord
+{
+    POV_UINT64  offset;
+    POV_INT64   line;
+    POV_INT64   column;
+    POV_UINT64  textOffset;
+    POV_UINT32  textSize;
+    POV_UINT32  category;
+    DBL         floatValue;
+};
+
+bool RawTokenizer::ReadTokenCache(IStream& file, POV_UINT64 key, const TokenCacheStreamPtr& pCache, const ConstStreamPtr& pSource)
+{
+    TokenCacheFileHeader header;
+
+    if (!file.read(&header, sizeof(header)))
+        return false;
+
+    if ((memcmp(header.magic, kTokenCacheFileMagic, sizeof(kTokenCacheFileMagic)) != 0) ||
+        (header.version != kTokenCacheFileVersion) || (header.recordSize != sizeof(TokenCacheFileRecord)) ||
+        (header.key != key) || (header.dataSize != POV_UINT64(pCache->end.offset)))
+        return false; // stale or foreign file
+
+    // Every lexeme starts at a distinct offset within the source and holds some of its text,
+    // so a header claiming more of either is damaged; don't let it make us allocate absurd amounts.
+    if ((header.lexemes > header.dataSize) || (header.textSize > header.dataSize))
+        return false;
+
+    std::vector<TokenCacheFileRecord> records(header.lexemes);
+    std::vector<char> text(header.textSize);
+
+    if ((header.lexemes > 0) && !file.read(records.data(), records.size() * sizeof(TokenCacheFileRecord)))
+        return false;
+    if ((header.textSize > 0) && !file.read(text.data(), text.size()))
+        return false;
+
+    Scanner scanner;
+    scanner.SetInputStream(pCache);
+    pCache->begin = scanner.GetColdBookmark();
+    pCache->tokens.clear();
+    pCache->tokens.reserve(records.size());
+
+    RawToken token;
+    POV_UINT64 nextOffset = 0;
+    for (auto& record : records)
+    {
+        // Make sure a damaged file cannot cause out-of-bounds accesses, or violate assumptions
+        // made by the scanner about the lexemes it produces.
+        if ((record.offset < nextOffset) || (record.offset >= header.dataSize) ||
+            (record.textSize == 0) || (record.textOffset > header.textSize) ||
+            (record.textSize > header.textSize - record.textOffset) ||
+            (record.category > Lexeme::kUTF8SignatureBOM))
+            return false;
+        nextOffset = record.offset + 1;
+
+        token.lexeme.text.assign(text.data() + record.textOffset, record.textSize);
+        token.lexeme.position.offset = POV_OFF_T(record.offset);
+        token.lexeme.position.line   = record.line;
+        token.lexeme.position.column = record.column;
+        token.lexeme.category = Lexeme::Category(record.category);
+
+        switch (token.lexeme.category)
+        {
+            case Lexeme::kFloatLiteral:
+                // Spare us the conversion from text.
+                token.id = int(FLOAT_TOKEN);
+                token.expressionId = FLOAT_FUNCT_TOKEN;
+                token.floatValue = record.floatValue;
+                token.value = nullptr;
+                token.isReservedWord = false;
+                token.isPseudoIdentifier = false;
+                break;
+
+            case Lexeme::kStringLiteral:
+                if ((record.textSize < 2) || (token.lexeme.text.front() != '"') || (token.lexeme.text.back() != '"'))
+                    return false;
+                if (!ProcessLexeme(token, pSource))
+                    return false;
+                break;
+
+            case Lexeme::kOther:
+                if (record.textSize > 2)
+                    return false;
+                if (!ProcessLexeme(token, pSource))
+                    return false;
+                break;
+
+            default:
+                if (!ProcessLexeme(token, pSource))
+                    return false;
+                break;
+        }
+
+        pCache->tokens.push_back(token);
+    }
+
+    pCache->end.line   = header.endLine;
+    pCache->end.column = header.endColumn;
+
+    return true;
+}
+
+bool RawTokenizer::WriteTokenCache(OStream& file, POV_UINT64 key, const TokenCacheStream& cache)
+{
+    TokenCacheFileHeader header;
+    std::vector<TokenCacheFileRecord> records(cache.tokens.size());
+    std::vector<char> text;
+
+    for (size_t i = 0; i < cache.tokens.size(); ++i)
+    {
+        const RawToken& token = cache.tokens[i];
+        TokenCacheFileRecord& record = records[i];
+        memset(&record, 0, sizeof(record));
+        record.offset     = POV_UINT64(token.lexeme.position.offset);
+        record.line       = token.lexeme.position.line;
+        record.column     = token.lexeme.position.column;
+        record.textOffset = text.size();
+        record.textSize   = POV_UINT32(token.lexeme.text.size());
+        record.category   = POV_UINT32(token.lexeme.category);
+        if (token.lexeme.category == Lexeme::kFloatLiteral)
+            record.floatValue = token.floatValue;
+        text.insert(text.end(), token.lexeme.text.begin(), token.lexeme.text.end());
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, kTokenCacheFileMagic, sizeof(kTokenCacheFileMagic));
+    header.version    = kTokenCacheFileVersion;
+    header.recordSize = sizeof(TokenCacheFileRecord);
+    header.key        = key;
+    header.dataSize   = POV_UINT64(cache.end.offset);
+    header.lexemes    = records.size();
+    header.textSize   = text.size();
+    header.endLine    = cache.end.line;
+    header.endColumn  = cache.end.column;
+
+    if (!file.write(&header, sizeof(header)))
+        return false;
+    if (!records.empty() && !file.write(records.data(), records.size() * sizeof(TokenCacheFileRecord)))
+        return false;
+    if (!text.empty() && !file.write(text.data(), text.size()))
+        return false;
+
+    return true;
 }
 
 //------------------------------------------------------------------------------
 
 pov_parser::ConstStreamPtr RawTokenizer::GetInputStream() const
 {
+    if (mpTokenCache != nullptr)
+        return mpTokenCache;
     return mScanner.GetInputStream();
 }
 
 pov_base::UCS2String RawTokenizer::GetInputStreamName() const
 {
+    if (mpTokenCache != nullptr)
+        return mpTokenCache->Name();
     return mScanner.GetInputStreamName();
 }
 
 pov_parser::RawTokenizer::HotBookmark RawTokenizer::GetHotBookmark()
 {
+    if (mpTokenCache != nullptr)
+    {
+        const Scanner::ColdBookmark& begin = mpTokenCache->begin;
+        return HotBookmark(mpTokenCache, mpTokenCache->GetPosition(mTokenCacheIndex),
+                           begin.characterEncoding, begin.nominalEndOfLine, begin.allowNestedBlockComments);
+    }
     return mScanner.GetHotBookmark();
 }
 
 pov_parser::RawTokenizer::ColdBookmark RawTokenizer::GetColdBookmark() const
 {
+    if (mpTokenCache != nullptr)
+    {
+        const Scanner::ColdBookmark& begin = mpTokenCache->begin;
+        return ColdBookmark(mpTokenCache->Name(), mpTokenCache->GetPosition(mTokenCacheIndex),
+                            begin.characterEncoding, begin.nominalEndOfLine, begin.allowNestedBlockComments);
+    }
     return mScanner.GetColdBookmark();
 }
 
 bool RawTokenizer::GoToBookmark(const HotBookmark& bookmark)
 {
+    TokenCacheStreamPtr pCache = std::dynamic_pointer_cast<TokenCacheStream>(bookmark.pStream);
+    if (pCache != nullptr)
+    {
+        if (!pCache->Contains(bookmark.offset))
+            return false;
+        mpTokenCache = pCache;
+        mTokenCacheIndex = pCache->FindToken(bookmark.offset);
+        return true;
+    }
+    mpTokenCache = nullptr;
     return mScanner.GoToBookmark(bookmark);
 }
 
 bool RawTokenizer::GoToBookmark(const ColdBookmark& bookmark)
 {
+    if (mpTokenCache != nullptr)
+    {
+        if ((bookmark.fileName != mpTokenCache->Name()) || !mpTokenCache->Contains(bookmark.offset))
+            return false;
+        mTokenCacheIndex = mpTokenCache->FindToken(bookmark.offset);
+        return true;
+    }
     return mScanner.GoToBookmark(bookmark);
 }
 
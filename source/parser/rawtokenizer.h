@@ -44,10 +44,11 @@
 
 // C++ standard header files
 #include <unordered_map>
+#include <vector>
 
 // Boost header files
 // POV-Ray header files (base module)
-//  (none at the moment)
+#include "base/fileinputoutput.h"
 
 // POV-Ray header files (parser module)
 #include "parser/parsertypes.h"
@@ -146,6 +147,11 @@ struct RawToken
     /// _cooked tokenizer_ to carry the value of the identifier.
     ConstValuePtr value;
 
+    /// Hash value of the token text as used for symbol lookup.
+    /// For words, this is set by the _raw tokenizer_ once per distinct word, so that
+    /// identifiers need not be hashed again on every lookup. For other tokens this is zero.
+    SymbolHash symbolHash;
+
     /// Whether the token is a reserved word.
     /// @note
     ///     This flag is _not_ set for operators.
@@ -160,6 +166,51 @@ struct RawToken
     TokenId GetTokenId() const;
 };
 
+//------------------------------------------------------------------------------
+
+/// In-memory copy of a section of an input stream, carrying its raw tokens.
+///
+/// Besides providing the copied data like a regular @ref IMemStream, this
+/// stream also holds the raw tokens the data was found to comprise, so that
+/// the raw tokenizer can replay them instead of scanning the data again.
+/// Bookmarks referring to this stream are resolved to the corresponding index
+/// in the token sequence.
+///
+class TokenCacheStream final : public IMemStream
+{
+public:
+
+    /// Create a new token cache stream.
+    /// @note
+    ///     The stream takes ownership of the data buffer.
+    TokenCacheStream(unsigned char* data, size_t size, const Scanner::ColdBookmark& origin);
+
+    /// Create a new token cache stream for an entire file.
+    /// @note
+    ///     The stream takes ownership of the data buffer.
+    TokenCacheStream(unsigned char* data, size_t size, const UCS2String& formalName);
+
+    /// Get the index of the first token starting at or after a given position.
+    size_t FindToken(POV_OFF_T offset) const;
+
+    /// Get the position of the token at a given index.
+    /// For the index past the last token, this is the end of the data.
+    LexemePosition GetPosition(size_t index) const;
+
+    /// Whether a given position lies within the cached section.
+    bool Contains(POV_OFF_T offset) const;
+
+    std::vector<RawToken>           tokens; ///< The raw tokens, in order of their position.
+    Scanner::ColdBookmark           begin;  ///< Scanner state at the start of the cached section.
+    LexemePosition                  end;    ///< Position of the end of the cached section.
+
+private:
+
+    std::unique_ptr<unsigned char[]> mpData;
+};
+
+using TokenCacheStreamPtr = shared_ptr<TokenCacheStream>;
+
 //******************************************************************************
 
 /// Class implementing the parser's _raw tokenizer_ stage.
@@ -193,6 +244,9 @@ public:
     /// Set or change the input stream.
     /// @note
     ///     The input stream must already be opened.
+    /// @note
+    ///     If the input stream is a @ref TokenCacheStream, its cached tokens
+    ///     are replayed rather than scanning its data.
     void SetInputStream(StreamPtr pStream);
 
     /// Change encoding setting.
@@ -207,12 +261,37 @@ public:
     /// Advance to the next `#` token in the input stream.
     bool GetNextDirective(RawToken& token);
 
-    /// Read raw data.
-    /// @deprecated
-    ///     This method is only intended as a temporary measure to implement
-    ///     binary-level macro caching, to provide a reference for performance
-    ///     testing of the envisioned token-level macro caching.
-    bool GetRaw(unsigned char* buffer, size_t size);
+    /// Pre-tokenize a section of the current input stream.
+    ///
+    /// The section starts at the given bookmark and ends with the lexeme at the
+    /// given position, which must be a `#`. The tokenizer is left positioned
+    /// at an undefined location, and should be re-positioned via a bookmark.
+    ///
+    /// @return The token cache stream, or `nullptr` if the section could not
+    ///     be tokenized.
+    TokenCacheStreamPtr CacheTokens(const ColdBookmark& begin, const LexemePosition& end);
+
+    /// Pre-tokenize the entire data of a token cache stream.
+    ///
+    /// @param[in,out]  pCache      The token cache stream to fill in.
+    /// @param[in]      pSource     The stream the data was originally read from.
+    /// @return                     Whether the data could be tokenized.
+    bool CacheTokens(const TokenCacheStreamPtr& pCache, const ConstStreamPtr& pSource);
+
+    /// Fill in a token cache stream from a token cache file.
+    ///
+    /// Rather than raw tokens, the file holds the lexemes they were created
+    /// from, as the IDs of identifiers are specific to each raw tokenizer.
+    ///
+    /// @param[in]      file        The token cache file.
+    /// @param[in]      key         The key the file must match, identifying the data.
+    /// @param[in,out]  pCache      The token cache stream to fill in.
+    /// @param[in]      pSource     The stream the data was originally read from.
+    /// @return                     Whether the file was valid and matched the key.
+    bool ReadTokenCache(IStream& file, POV_UINT64 key, const TokenCacheStreamPtr& pCache, const ConstStreamPtr& pSource);
+
+    /// Write a token cache stream filled in by @ref CacheTokens() to a token cache file.
+    static bool WriteTokenCache(OStream& file, POV_UINT64 key, const TokenCacheStream& cache);
 
     /// Get current stream for comparison.
     ConstStreamPtr GetInputStream() const;
@@ -236,21 +315,25 @@ private:
 
     struct KnownWordInfo
     {
-        int     id;
-        TokenId expressionId;
-        bool    isReservedWord     : 1;
-        bool    isPseudoIdentifier : 1;
+        int         id;
+        TokenId     expressionId;
+        SymbolHash  hash;
+        bool        isReservedWord     : 1;
+        bool        isPseudoIdentifier : 1;
         KnownWordInfo();
     };
 
     Scanner                                         mScanner;
     std::unordered_map<UTF8String, KnownWordInfo>   mKnownWords;
     unsigned int                                    mNextIdentifierId;
+    TokenCacheStreamPtr                             mpTokenCache;       ///< Token cache being replayed, if any.
+    size_t                                          mTokenCacheIndex;   ///< Index of the next token to replay.
 
+    bool ProcessLexeme(RawToken& token, const ConstStreamPtr& pSource);
     bool ProcessWordLexeme(RawToken& token);
     bool ProcessOtherLexeme(RawToken& token);
     bool ProcessFloatLiteralLexeme(RawToken& token);
-    bool ProcessStringLiteralLexeme(RawToken& token);
+    bool ProcessStringLiteralLexeme(RawToken& token, const ConstStreamPtr& pSource);
     bool ProcessSignatureLexeme(RawToken& token);
 
     bool ProcessUCSEscapeDigits(UCS4& c, UTF8String::const_iterator& i, UTF8String::const_iterator& escapeSequenceEnd, unsigned int digits);
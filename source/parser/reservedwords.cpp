@@ -88,6 +88,8 @@ const RESERVED_WORD Reserved_Words[] = {
     { ARC_ANGLE_TOKEN,              "arc_angle" },
     { AREA_ILLUMINATION_TOKEN,      "area_illumination" },
     { AREA_LIGHT_TOKEN,             "area_light" },
+    { AREA_LIGHT_CACHE_TOKEN,       "area_light_cache" },
+    { AREA_SAMPLING_TOKEN,          "area_sampling" },
     { ARRAY_TOKEN,                  "array" },
     { ASC_TOKEN,                    "asc" },
     { ASCII_TOKEN,                  "ascii" },
@@ -101,6 +103,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { AVERAGE_TOKEN,                "average" },
 
     { BACKGROUND_TOKEN,             "background" },
+    { BAKE_TOKEN,                   "bake" },
     { BEZIER_SPLINE_TOKEN,          "bezier_spline" },
     { BICUBIC_PATCH_TOKEN,          "bicubic_patch" },
     { BITWISE_AND_TOKEN,            "bitwise_and" },
@@ -134,6 +137,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { BUMPS_TOKEN,                  "bumps" },
 
     { CAMERA_TOKEN,                 "camera" },
+    { CAMERA_RAY_TABLE_TOKEN,       "camera_ray_table" },
     { CASE_TOKEN,                   "case" },
     { CAUSTICS_TOKEN,               "caustics" },
     { CEIL_TOKEN,                   "ceil" },
@@ -149,6 +153,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { COLLECT_TOKEN,                "collect" },
     { COLOUR_TOKEN,                 "colour" },
     { COLOUR_MAP_TOKEN,             "colour_map" },
+    { COMPACT_TOKEN,                "compact" },
     { COMPONENT_TOKEN,              "component" },
     { COMPOSITE_TOKEN,              "composite" },
     { CONCAT_TOKEN,                 "concat" },
@@ -181,6 +186,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { DEGREES_TOKEN,                "degrees" },
     { DENSITY_TOKEN,                "density" },
     { DENSITY_FILE_TOKEN,           "density_file" },
+    { DENSITY_GRID_TOKEN,           "density_grid" },
     { DENSITY_MAP_TOKEN,            "density_map" },
     { DENTS_TOKEN,                  "dents" },
     { DEPRECATED_TOKEN,             "deprecated" },
@@ -233,6 +239,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { FISHEYE_TOKEN,                "fisheye" },
     { FLATNESS_TOKEN,               "flatness" },
     { FLIP_TOKEN,                   "flip" },
+    { FLOAT_PREFILTER_TOKEN,        "float_prefilter" },
     { FLOOR_TOKEN,                  "floor" },
     { FOCAL_POINT_TOKEN,            "focal_point" },
     { FOG_TOKEN,                    "fog" },
@@ -258,6 +265,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { GRAY_THRESHOLD_TOKEN,         "gray_threshold" },
     { GREEN_TOKEN,                  "green" },
 
+    { HAIR_TOKEN,                   "hair" },
     { HDR_TOKEN,                    "hdr" },
     { HEIGHT_FIELD_TOKEN,           "height_field" },
     { HEXAGON_TOKEN,                "hexagon" },
@@ -276,6 +284,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { INCLUDE_TOKEN,                "include" },
     { INSIDE_TOKEN,                 "inside" },
     { INSIDE_VECTOR_TOKEN,          "inside_vector" },
+    { INSTANCE_TOKEN,               "instance" },
     { INT_TOKEN,                    "int" },
     { INTERIOR_TOKEN,               "interior" },
     { INTERIOR_TEXTURE_TOKEN,       "interior_texture" },
@@ -298,6 +307,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { LATHE_TOKEN,                  "lathe" },
     { LEMON_TOKEN,                  "lemon" },
     { LEOPARD_TOKEN,                "leopard" },
+    { LIGHT_CUTOFF_TOKEN,           "light_cutoff" },
     { LIGHT_GROUP_TOKEN,            "light_group" },
     { LIGHT_SOURCE_TOKEN,           "light_source" },
     { LINEAR_SPLINE_TOKEN,          "linear_spline" },
@@ -342,6 +352,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { MIN_TOKEN,                    "min" },
     { MIN_EXTENT_TOKEN,             "min_extent" },
     { MINIMUM_REUSE_TOKEN,          "minimum_reuse" },
+    { MIP_MAP_TOKEN,                "mip_map" },
     { MIXED_TOKEN,                  "mixed" },
     { MM_PER_UNIT_TOKEN,            "mm_per_unit" },
     { MOD_TOKEN,                    "mod" },
@@ -404,6 +415,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { PLANE_TOKEN,                  "plane" },
     { PNG_TOKEN,                    "png" },
     { POINT_AT_TOKEN,               "point_at" },
+    { POINT_CLOUD_TOKEN,            "point_cloud" },
     { POLARITY_TOKEN,               "polarity" },
     { POLY_TOKEN,                   "poly" },
     { POLY_WAVE_TOKEN,              "poly_wave" },
@@ -442,6 +454,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { RAND_TOKEN,                   "rand" },
     { RANGE_TOKEN,                  "range" },
     { RATIO_TOKEN,                  "ratio" },
+    { RAW_TOKEN,                    "raw" },
     { READ_TOKEN,                   "read" },
     { RECIPROCAL_TOKEN,             "reciprocal" },
     { RECURSION_LIMIT_TOKEN,        "recursion_limit" },
@@ -459,8 +472,10 @@ const RESERVED_WORD Reserved_Words[] = {
     { RIPPLES_TOKEN,                "ripples" },
     { ROTATE_TOKEN,                 "rotate" },
     { ROUGHNESS_TOKEN,              "roughness" },
+    { RUSSIAN_ROULETTE_TOKEN,       "russian_roulette" },
 
     { SAMPLES_TOKEN,                "samples" },
+    { SAMPLING_METHOD_TOKEN,        "sampling_method" },
     { SAVE_FILE_TOKEN,              "save_file" },
 #if 0 // sred, sgreen and sblue tokens not enabled at present
     { SBLUE_TOKEN,                  "sblue" },
@@ -468,6 +483,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { SCALE_TOKEN,                  "scale" },
     { SCALLOP_WAVE_TOKEN,           "scallop_wave" },
     { SCATTERING_TOKEN,             "scattering" },
+    { SECONDARY_MESH_TOKEN,         "secondary_mesh" },
     { SEED_TOKEN,                   "seed" },
     { SELECT_TOKEN,                 "select" },
 #if 0 // sred, sgreen and sblue tokens not enabled at present
@@ -493,6 +509,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { SOLID_TOKEN,                  "solid" },
     { SOR_TOKEN,                    "sor" },
     { SPACING_TOKEN,                "spacing" },
+    { SPECTRAL_SAMPLES_TOKEN,       "spectral_samples" },
     { SPECULAR_TOKEN,               "specular" },
     { SPHERE_TOKEN,                 "sphere" },
     { SPHERE_SWEEP_TOKEN,           "sphere_sweep" },
@@ -516,6 +533,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { STATISTICS_TOKEN,             "statistics" },
     { STR_TOKEN,                    "str" },
     { STRCMP_TOKEN,                 "strcmp" },
+    { STRAND_TOKEN,                 "strand" },
     { STRENGTH_TOKEN,               "strength" },
     { STRLEN_TOKEN,                 "strlen" },
     { STRLWR_TOKEN,                 "strlwr" },
@@ -546,6 +564,7 @@ const RESERVED_WORD Reserved_Words[] = {
     { TIFF_TOKEN,                   "tiff" },
     { TIGHTNESS_TOKEN,              "tightness" },
     { TILE2_TOKEN,                  "tile2" },
+    { TILED_TOKEN,                  "tiled" },
     { TILES_TOKEN,                  "tiles" },
     { TILING_TOKEN,                 "tiling" },
     { TOLERANCE_TOKEN,              "tolerance" },
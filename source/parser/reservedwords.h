@@ -242,6 +242,8 @@ enum TokenId : int
     ARC_ANGLE_TOKEN,
     AREA_ILLUMINATION_TOKEN,
     AREA_LIGHT_TOKEN,
+    AREA_LIGHT_CACHE_TOKEN,
+    AREA_SAMPLING_TOKEN,
     ARRAY_TOKEN,
     ARRAY_ID_TOKEN,
     ASCII_TOKEN,
@@ -254,6 +256,7 @@ enum TokenId : int
     BACK_QUOTE_TOKEN,
     BACK_SLASH_TOKEN,
     BACKGROUND_TOKEN,
+    BAKE_TOKEN,
     BAR_TOKEN,
     BEZIER_SPLINE_TOKEN,
     BICUBIC_PATCH_TOKEN,
@@ -284,6 +287,7 @@ enum TokenId : int
 
     CAMERA_TOKEN,
     CAMERA_ID_TOKEN,
+    CAMERA_RAY_TABLE_TOKEN,
     CASE_TOKEN,
     CAUSTICS_TOKEN,
     CELLS_TOKEN,
@@ -298,6 +302,7 @@ enum TokenId : int
     COLOUR_MAP_TOKEN,
     COLOUR_MAP_ID_TOKEN,
     COMMA_TOKEN,
+    COMPACT_TOKEN,
     COMPONENT_TOKEN,
     COMPOSITE_TOKEN,
     CONCAT_TOKEN,
@@ -329,6 +334,7 @@ enum TokenId : int
     DENSITY_TOKEN,
     DENSITY_ID_TOKEN,
     DENSITY_FILE_TOKEN,
+    DENSITY_GRID_TOKEN,
     DENSITY_MAP_TOKEN,
     DENSITY_MAP_ID_TOKEN,
     DENTS_TOKEN,
@@ -380,6 +386,7 @@ enum TokenId : int
     FISHEYE_TOKEN,
     FLATNESS_TOKEN,
     FLIP_TOKEN,
+    FLOAT_PREFILTER_TOKEN,
     FOCAL_POINT_TOKEN,
     FOG_TOKEN,
     FOG_ID_TOKEN,
@@ -404,6 +411,7 @@ enum TokenId : int
     GRANITE_TOKEN,
     GRAY_THRESHOLD_TOKEN,
 
+    HAIR_TOKEN,
     HASH_TOKEN,
     HAT_TOKEN,
     HDR_TOKEN,
@@ -424,6 +432,7 @@ enum TokenId : int
     IMPORTANCE_TOKEN,
     INCLUDE_TOKEN,
     INSIDE_VECTOR_TOKEN,
+    INSTANCE_TOKEN,
     INTERIOR_TOKEN,
     INTERIOR_ID_TOKEN,
     INTERIOR_TEXTURE_TOKEN,
@@ -450,6 +459,7 @@ enum TokenId : int
     LEFT_SQUARE_TOKEN,
     LEMON_TOKEN,
     LEOPARD_TOKEN,
+    LIGHT_CUTOFF_TOKEN,
     LIGHT_GROUP_TOKEN,
     LIGHT_SOURCE_TOKEN,
     LINEAR_SPLINE_TOKEN,
@@ -491,6 +501,7 @@ enum TokenId : int
     METHOD_TOKEN,
     METRIC_TOKEN,
     MINIMUM_REUSE_TOKEN,
+    MIP_MAP_TOKEN,
     MIXED_TOKEN,
     MM_PER_UNIT_TOKEN,
     MORTAR_TOKEN,
@@ -556,6 +567,7 @@ enum TokenId : int
     PLUS_TOKEN,
     PNG_TOKEN,
     POINT_AT_TOKEN,
+    POINT_CLOUD_TOKEN,
     POLARITY_TOKEN,
     POLY_TOKEN,
     POLY_WAVE_TOKEN,
@@ -592,6 +604,7 @@ enum TokenId : int
     RAMP_WAVE_TOKEN,
     RANGE_TOKEN,
     RATIO_TOKEN,
+    RAW_TOKEN,
     READ_TOKEN,
     RECIPROCAL_TOKEN,
     RECURSION_LIMIT_TOKEN,
@@ -611,12 +624,15 @@ enum TokenId : int
     RIPPLES_TOKEN,
     ROTATE_TOKEN,
     ROUGHNESS_TOKEN,
+    RUSSIAN_ROULETTE_TOKEN,
 
     SAMPLES_TOKEN,
+    SAMPLING_METHOD_TOKEN,
     SAVE_FILE_TOKEN,
     SCALE_TOKEN,
     SCALLOP_WAVE_TOKEN,
     SCATTERING_TOKEN,
+    SECONDARY_MESH_TOKEN,
     SEMI_COLON_TOKEN,
     SHADOWLESS_TOKEN,
     SINE_WAVE_TOKEN,
@@ -640,6 +656,7 @@ enum TokenId : int
     SOLID_TOKEN,
     SOR_TOKEN,
     SPACING_TOKEN,
+    SPECTRAL_SAMPLES_TOKEN,
     SPECULAR_TOKEN,
     SPHERE_TOKEN,
     SPHERE_SWEEP_TOKEN,
@@ -656,6 +673,7 @@ enum TokenId : int
     STAR_TOKEN,
     STATISTICS_TOKEN,
     STR_TOKEN,
+    STRAND_TOKEN,
     STRENGTH_TOKEN,
     STRING_ID_TOKEN,
     STRING_LITERAL_TOKEN,
@@ -687,6 +705,7 @@ enum TokenId : int
     TIGHTNESS_TOKEN,
     TILDE_TOKEN,
     TILE2_TOKEN,
+    TILED_TOKEN,
     TILES_TOKEN,
     TILING_TOKEN,
     TOLERANCE_TOKEN,
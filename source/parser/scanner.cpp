@@ -531,6 +531,14 @@ static inline bool IsASCIIWhitespace(Scanner::Character c)
             (c == 0x20));   // ASCII SP ("Space")
 }
 
+/// Test whether character qualifies as ASCII whitespace other than end-of-line.
+static bool IsASCIIBlank(Scanner::Character c)
+{
+    return ((c == 0x09) ||  // ASCII HT ("Tab")
+            (c == 0x1A) ||  // DOS EOF character
+            (c == 0x20));   // ASCII SP ("Space")
+}
+
 /// Test whether character qualifies as printable ASCII.
 static bool IsPrintableASCII(Scanner::Character c)
 {
@@ -562,14 +570,16 @@ static bool IsASCIIIdentifierChar2(Scanner::Character c)
 //******************************************************************************
 
 Scanner::Buffer::Buffer() :
+    mpBegin(maData),
     mpEnd(maData),
     mpPos(maData)
 {}
 
 void Scanner::Buffer::Clear()
 {
-    mpEnd = maData;
-    mpPos  = maData;
+    mpBegin = maData;
+    mpEnd   = maData;
+    mpPos   = maData;
 }
 
 void Scanner::Buffer::Advance(size_t delta)
@@ -581,26 +591,27 @@ void Scanner::Buffer::Advance(size_t delta)
 
 void Scanner::Buffer::AdvanceTo(size_t offset)
 {
-    POV_PARSER_ASSERT(mpEnd >= maData);
-    POV_PARSER_ASSERT(mpEnd - maData >= offset);
-    mpPos = maData + offset;
+    POV_PARSER_ASSERT(mpEnd >= mpBegin);
+    POV_PARSER_ASSERT(mpEnd - mpBegin >= offset);
+    mpPos = mpBegin + offset;
 }
 
 size_t Scanner::Buffer::Capacity() const
 {
-    return kCapacity;
+    // External data is never refilled, so it is considered filled to capacity.
+    return (IsExternal() ? TotalCount() : kCapacity);
 }
 
 size_t Scanner::Buffer::TotalCount() const
 {
-    POV_PARSER_ASSERT(mpEnd >= maData);
-    return (mpEnd - maData);
+    POV_PARSER_ASSERT(mpEnd >= mpBegin);
+    return (mpEnd - mpBegin);
 }
 
 size_t Scanner::Buffer::ProcessedCount() const
 {
-    POV_PARSER_ASSERT(mpPos >= maData);
-    return (mpPos - maData);
+    POV_PARSER_ASSERT(mpPos >= mpBegin);
+    return (mpPos - mpBegin);
 }
 
 size_t Scanner::Buffer::PendingCount() const
@@ -642,17 +653,36 @@ void Scanner::Buffer::GetBulk(Octet* dst, size_t count)
     Advance(count);
 }
 
+const Scanner::Octet* Scanner::Buffer::PendingData() const
+{
+    return mpPos;
+}
+
 void Scanner::Buffer::Refill(StreamPtr pStream)
 {
     POV_PARSER_ASSERT(IsExhausted());
-    mpPos = maData;
-    mpEnd = maData + pStream->readUpTo(maData, Capacity());
+    mpBegin = maData;
+    mpPos   = maData;
+    mpEnd   = maData + pStream->readUpTo(maData, kCapacity);
+}
+
+void Scanner::Buffer::SetExternal(const Octet* data, size_t size)
+{
+    mpBegin = data;
+    mpEnd   = data + size;
+    mpPos   = data;
+}
+
+bool Scanner::Buffer::IsExternal() const
+{
+    return (mpBegin != maData);
 }
 
 //------------------------------------------------------------------------------
 
 Scanner::BufferedSource::BufferedSource() :
     mpStream(nullptr),
+    mpMemStream(nullptr),
     mBase(0),
     mExhausted(true)
 {}
@@ -660,9 +690,15 @@ Scanner::BufferedSource::BufferedSource() :
 void Scanner::BufferedSource::SetInputStream(StreamPtr pStream)
 {
     mpStream = pStream;
-    mBase = mpStream->tellg();
+    mpMemStream = dynamic_cast<const IMemStream*>(pStream.get());
     mBuffer.Clear();
     mExhausted = false;
+    if (IsInMemory())
+    {
+        (void)SeekAndRefill(mpStream->tellg());
+        return;
+    }
+    mBase = mpStream->tellg();
     (void)RefillBuffer();
 }
 
@@ -682,7 +718,11 @@ bool Scanner::BufferedSource::SetInputStream(StreamPtr pStream, POV_OFF_T pos)
     {
         // Requested position is not in the buffer at the moment.
         // Make sure we have the right stream, then refill the buffer.
-        mpStream = pStream;
+        if (mpStream != pStream)
+        {
+            mpStream = pStream;
+            mpMemStream = dynamic_cast<const IMemStream*>(pStream.get());
+        }
         mExhausted = false;
         return SeekAndRefill(pos);
     }
@@ -698,8 +738,29 @@ UCS2String Scanner::BufferedSource::GetInputStreamName() const
     return mpStream->Name();
 }
 
+bool Scanner::BufferedSource::IsInMemory() const
+{
+    return (mpMemStream != nullptr);
+}
+
 bool Scanner::BufferedSource::SeekAndRefill(POV_OFF_T pos)
 {
+    if (IsInMemory())
+    {
+        // The data is already in memory, so rather than copying it to the buffer
+        // we just point the buffer at it.
+        mBase = mpMemStream->GetFormalStart();
+        mBuffer.SetExternal(mpMemStream->GetData(), mpMemStream->GetSize());
+        if ((pos < mBase) || (pos - mBase > mBuffer.TotalCount()))
+        {
+            mExhausted = true;
+            return false;
+        }
+        mBuffer.AdvanceTo(pos - mBase);
+        mExhausted = mBuffer.IsExhausted();
+        return true;
+    }
+
     mBuffer.Clear();
     bool seekOk = mpStream->seekg(pos);
     mBase = mpStream->tellg();
@@ -722,7 +783,12 @@ bool Scanner::BufferedSource::Advance()
         // Buffer not exhausted yet; ready for next octet.
         return true;
 
-    // Buffer exhausted.
+    return ContinueExhaustedBuffer();
+}
+
+bool Scanner::BufferedSource::ContinueExhaustedBuffer()
+{
+    POV_PARSER_ASSERT(mBuffer.IsExhausted());
 
     // Quick-check whether the stream may still have pending octets.
     if (mBuffer.IsLean())
@@ -750,6 +816,12 @@ bool Scanner::BufferedSource::Advance(size_t delta)
         POV_PARSER_ASSERT(!mBuffer.IsExhausted());
         return true;
     }
+    else if (delta == mBuffer.PendingCount())
+    {
+        // Requested position is just past the buffer.
+        mBuffer.Advance(delta);
+        return ContinueExhaustedBuffer();
+    }
     else
     {
         // Requested position is not in the buffer at the moment.
@@ -779,10 +851,20 @@ Scanner::Octet Scanner::BufferedSource::CurrentPending() const
     return mBuffer.CurrentPending();
 }
 
+const Scanner::Octet* Scanner::BufferedSource::PendingData() const
+{
+    return mBuffer.PendingData();
+}
+
+size_t Scanner::BufferedSource::PendingCount() const
+{
+    return mBuffer.PendingCount();
+}
+
 bool Scanner::BufferedSource::CompareSignature(const Octet* seq, size_t seqLen) const
 {
     POV_PARSER_ASSERT(IsFresh());
-    POV_PARSER_ASSERT(seqLen <= mBuffer.Capacity());
+    POV_PARSER_ASSERT(mBuffer.IsExternal() || (seqLen <= mBuffer.Capacity()));
     if (mBuffer.PendingCount() < seqLen)
         return false;
     return mBuffer.ComparePending(seq, seqLen);
@@ -821,6 +903,12 @@ bool Scanner::BufferedSource::RefillBuffer()
 {
     POV_PARSER_ASSERT(mBuffer.IsExhausted());
     POV_PARSER_ASSERT(!IsExhausted());
+    if (IsInMemory())
+    {
+        // In-memory data is scanned in place in its entirety, so there's nothing left to refill from.
+        mExhausted = true;
+        return false;
+    }
     mBase += mBuffer.TotalCount();
     mBuffer.Refill(mpStream);
     mExhausted = mBuffer.IsExhausted();
@@ -900,6 +988,10 @@ bool Scanner::GetNextLexeme(Lexeme& lexeme)
         // Skip over any whitespace (including blank lines).
         while (IsNextCharacterWhitespace())
         {
+            if (!AdvanceASCIIRun(IsASCIIBlank))
+                return false;
+            if (!IsNextCharacterWhitespace())
+                break;
             if (!AdvanceCharacter())
                 return false;
         }
@@ -1035,8 +1127,7 @@ bool Scanner::GetNextWordLexeme(Lexeme& lexeme)
     lexeme.category = Lexeme::kWord;
 
     // Read identifier name.
-    while (AdvanceCharacter(&lexeme.text) && IsNextCharacterIdentifierChar2())
-    {}
+    (void)AdvanceASCIIRun(IsASCIIIdentifierChar2, &lexeme.text);
 
     return true;
 }
@@ -1112,8 +1203,7 @@ bool Scanner::GetNextFloatLiteralDigits(Lexeme& lexeme)
         return false;
     POV_PARSER_ASSERT(IsNextCharacterASCII());
 
-    while (AdvanceASCII(&lexeme.text) && IsNextCharacterDecimalDigit())
-        POV_PARSER_ASSERT(IsNextCharacterASCII());
+    (void)AdvanceASCIIRun(IsDecimalDigit, &lexeme.text);
 
     return true;
 }
@@ -1343,6 +1433,30 @@ bool Scanner::AdvanceASCII(UTF8String* pLexemeText)
     return AdvanceOctet();
 }
 
+bool Scanner::AdvanceASCIIRun(bool (*isRunCharacter)(Character), UTF8String* pLexemeText)
+{
+    while (!mSource.IsExhausted())
+    {
+        const Octet* pPending = mSource.PendingData();
+        size_t pendingCount = mSource.PendingCount();
+        size_t count = 0;
+        while ((count < pendingCount) && isRunCharacter(pPending[count]))
+            ++count;
+        if (count == 0)
+            return true;
+        if (pLexemeText != nullptr)
+            pLexemeText->append(reinterpret_cast<const char*>(pPending), count);
+        // The run contains no end-of-line characters, so it's all on the current line.
+        mCurrentPosition.column += count;
+        mCurrentPosition.offset += count;
+        if (!mSource.Advance(count))
+            return false;
+        if (count < pendingCount)
+            return true;
+    }
+    return false;
+}
+
 bool Scanner::AdvanceCharacter(UTF8String* pLexemeText)
 {
     if (IsNextCharacterASCII())
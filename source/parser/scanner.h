@@ -283,17 +283,28 @@ private:
         /// @post Current position shall be advanced.
         inline void GetBulk(Octet* dst, size_t count);
 
+        /// Get pointer to current pending octet.
+        inline const Octet* PendingData() const;
+
         /// Refill from stream.
         /// @pre Buffer shall be exhausted.
         inline void Refill(StreamPtr pStream);
 
+        /// Use data held in memory elsewhere in place of the buffer.
+        /// @note The data must remain valid until the buffer is cleared.
+        inline void SetExternal(const Octet* data, size_t size);
+
+        /// Test whether the buffer refers to data held in memory elsewhere.
+        inline bool IsExternal() const;
+
     protected:
 
         static constexpr size_t kCapacity = 64 * 1024; ///< Maximum capacity.
 
-        Octet   maData[kCapacity];  ///< Array holding the buffered data.
-        Octet*  mpEnd;              ///< Pointer to end of data (first unoccupied octet).
-        Octet*  mpPos;              ///< Pointer to current pending octet.
+        Octet           maData[kCapacity];  ///< Array holding the buffered data.
+        const Octet*    mpBegin;            ///< Pointer to start of data (either @ref maData or external).
+        const Octet*    mpEnd;              ///< Pointer to end of data (first unoccupied octet).
+        const Octet*    mpPos;              ///< Pointer to current pending octet.
     };
 
     //------------------------------------------------------------------------------
@@ -310,6 +321,9 @@ private:
         /// Get current stream name for comparison.
         UCS2String GetInputStreamName() const;
 
+        /// Test whether the current stream is held in memory, and scanned in place.
+        inline bool IsInMemory() const;
+
         /// Change buffer window position and refill buffer.
         /// @return `true` if file seek was successful.
         inline bool SeekAndRefill(POV_OFF_T pos);
@@ -336,6 +350,12 @@ private:
         /// @pre Source shall have at least one pending octet.
         inline Octet CurrentPending() const;
 
+        /// Get pointer to the pending octets in the current buffer window.
+        inline const Octet* PendingData() const;
+
+        /// Get number of pending octets in the current buffer window.
+        inline size_t PendingCount() const;
+
         /// Test whether first octets match given octet sequence.
         ///
         /// @pre
@@ -362,12 +382,18 @@ private:
         ///
         inline bool RefillBuffer();
 
+        /// Move on after the current buffer window has been exhausted.
+        /// @return `true` if another octet is available.
+        inline bool ContinueExhaustedBuffer();
+
     //protected:
 
         StreamPtr   mpStream;   ///< Input data stream to read from.
 
     protected:
 
+        const IMemStream* mpMemStream; ///< Input data stream if held in memory (scanned in place), or `nullptr`.
+
         Buffer      mBuffer;    ///< Buffer to hold chunks of data from stream.
         POV_OFF_T   mBase;      ///< Offset of current buffer window from start of stream.
         bool        mExhausted; ///< Whether both buffer and stream have been exhausted.
@@ -617,6 +643,25 @@ private:
     ///
     inline bool AdvanceASCII(UTF8String* pLexemeText = nullptr);
 
+    /// Copy or discard a run of ASCII characters in bulk, advancing buffer accordingly.
+    ///
+    /// Characters are processed directly from the buffer (or, for in-memory
+    /// input, straight from the input data) until the first character not
+    /// satisfying the given predicate.
+    ///
+    /// @pre
+    ///     The predicate shall only be satisfied by non-end-of-line ASCII
+    ///     characters.
+    ///
+    /// @param[in]  isRunCharacter  Predicate identifying the characters to
+    ///                             process.
+    /// @param[in]  pLexemeText     Pointer to string to receive the copied
+    ///                             characters, or `nullptr` to discard.
+    /// @return                     `true` if another character is available
+    ///                             after the operation.
+    ///
+    bool AdvanceASCIIRun(bool (*isRunCharacter)(Character), UTF8String* pLexemeText = nullptr);
+
     /// Transcode or discard arbitrary character, advancing buffer accordingly.
     ///
     /// @pre
@@ -37,7 +37,11 @@
 #include "parser/symboltable.h"
 
 // C++ variants of C standard header files
+#include <cstring>
+
 // C++ standard header files
+#include <algorithm>
+
 // Boost header files
 //  (none at the moment)
 
@@ -70,37 +74,26 @@ using namespace pov;
 
 //******************************************************************************
 
-SymbolTable::SymbolTable()
-{
-    for (int i = 0; i < SYM_TABLE_SIZE; i++)
-        mapHashTable[i] = nullptr;
-}
+SymbolTable::SymbolTable() :
+    mCount(0)
+{}
 
-SymbolTable::SymbolTable(const SymbolTable& obj)
+SymbolTable::SymbolTable(const SymbolTable& obj) :
+    maSlots(obj.maSlots),
+    mCount(obj.mCount)
 {
-    for (int i = SYM_TABLE_SIZE - 1; i >= 0; i--)
+    // The copied entries have the same names and hence the same slots.
+    for (auto& slot : maSlots)
     {
-        SYM_ENTRY* oldEntry = obj.mapHashTable[i];
-        while (oldEntry)
-        {
-            SYM_ENTRY* newEntry = Copy_Entry(oldEntry);
-            newEntry->next = obj.mapHashTable[i];
-            mapHashTable[i] = newEntry;
-            oldEntry = oldEntry->next;
-        }
+        if (slot.entry != nullptr)
+            slot.entry = Copy_Entry(slot.entry);
     }
 }
 
 SymbolTable::~SymbolTable()
 {
-    for (int i = SYM_TABLE_SIZE - 1; i >= 0; i--)
-    {
-        SYM_ENTRY *entry = mapHashTable[i];
-        while (entry)
-        {
-            entry = Destroy_Entry(entry);
-        }
-    }
+    for (auto& slot : maSlots)
+        Destroy_Entry(slot.entry);
 }
 
 //------------------------------------------------------------------------------
@@ -117,6 +110,7 @@ SYM_ENTRY* SymbolTable::Create_Entry(const UTF8String& Name, TokenId Number)
     New->Deprecation_Message = nullptr;
     New->ref_count = 1;
     New->name = Name;
+    New->hash = GetHashValue(Name.c_str(), Name.size());
 
     return New;
 }
@@ -135,20 +129,15 @@ SYM_ENTRY* SymbolTable::Copy_Entry(const SYM_ENTRY* oldEntry)
     newEntry->Deprecation_Message = nullptr;
     newEntry->ref_count = 1;
     newEntry->name = oldEntry->name;
+    newEntry->hash = oldEntry->hash;
 
     return newEntry;
 }
 
-SYM_ENTRY* SymbolTable::Destroy_Entry(SYM_ENTRY *Entry)
+void SymbolTable::Destroy_Entry(SYM_ENTRY *Entry)
 {
-    SYM_ENTRY *Next;
-
     if (Entry == nullptr)
-        return nullptr;
-
-    // always unhook the entry from hash table (if it is still member of one)
-    Next = Entry->next;
-    Entry->next = nullptr;
+        return;
 
     if (Entry->ref_count <= 0)
         POV_PARSER_PANIC(); // Error("Internal error: Symbol reference counter underflow");
@@ -162,8 +151,6 @@ SYM_ENTRY* SymbolTable::Destroy_Entry(SYM_ENTRY *Entry)
 
         delete Entry;
     }
-
-    return Next;
 }
 
 //------------------------------------------------------------------------------
@@ -171,7 +158,6 @@ SYM_ENTRY* SymbolTable::Destroy_Entry(SYM_ENTRY *Entry)
 void* SymbolTable::Copy_Identifier(void* Data, int Type)
 {
     VECTOR_4D* v4p;
-    std::size_t len;
     void *New = nullptr;
 
     if (Data == nullptr)
@@ -224,7 +210,9 @@ void* SymbolTable::Copy_Identifier(void* Data, int Type)
             New = reinterpret_cast<void*>(Copy_Material(reinterpret_cast<MATERIAL *>(Data)));
             break;
         case TEXTURE_ID_TOKEN:
-            New = reinterpret_cast<void*>(Copy_Textures(reinterpret_cast<TEXTURE *>(Data)));
+            // Textures held by identifiers are never modified in place (any use as an actual
+            // texture takes a copy first), so they can safely be shared by reference count.
+            New = reinterpret_cast<void*>(Copy_Texture_Pointer(reinterpret_cast<TEXTURE *>(Data)));
             break;
         case OBJECT_ID_TOKEN:
             New = reinterpret_cast<void*>(Copy_Object(reinterpret_cast<ObjectPtr>(Data)));
@@ -261,9 +249,7 @@ void* SymbolTable::Copy_Identifier(void* Data, int Type)
             New = reinterpret_cast<void*>(Copy_Skysphere(reinterpret_cast<SKYSPHERE *>(Data)));
             break;
         case STRING_ID_TOKEN:
-            len = UCS2_strlen(reinterpret_cast<UCS2*>(Data)) + 1;
-            New = reinterpret_cast<UCS2*>(POV_MALLOC(len * sizeof(UCS2), "UCS2 String"));
-            POV_MEMCPY(reinterpret_cast<void*>(New), reinterpret_cast<void*>(Data), len * sizeof(UCS2));
+            New = CloneData<Assignable>(Data);
             break;
         case ARRAY_ID_TOKEN:
             New = CloneData<Assignable>(Data);
@@ -373,7 +359,7 @@ void SymbolTable::Destroy_Ident_Data(void *Data, int Type)
             DeleteData<Assignable>(Data);
             break;
         case STRING_ID_TOKEN:
-            POV_FREE(Data);
+            DeleteData<Assignable>(Data);
             break;
         case ARRAY_ID_TOKEN:
             DeleteData<Assignable>(Data);
@@ -404,10 +390,28 @@ void SymbolTable::Destroy_Ident_Data(void *Data, int Type)
 
 void SymbolTable::Add_Entry(SYM_ENTRY *Table_Entry)
 {
-    int i = get_hash_value(Table_Entry->name.c_str());
+    if (2 * (mCount + 1) > maSlots.size())
+        Grow();
+
+    size_t mask = maSlots.size() - 1;
+    Slot newSlot = { Table_Entry->hash, Table_Entry };
+
+    // An entry shadows any existing entry of the same name, so it must be found first;
+    // we therefore take over the slot of such an entry, and move that entry further down
+    // the probe sequence instead.
+    for (size_t i = newSlot.hash & mask; ; i = (i + 1) & mask)
+    {
+        Slot& slot = maSlots[i];
+        if (slot.entry == nullptr)
+        {
+            slot = newSlot;
+            break;
+        }
+        if ((slot.hash == newSlot.hash) && (slot.entry->name == newSlot.entry->name))
+            std::swap(slot, newSlot);
+    }
 
-    Table_Entry->next = mapHashTable[i];
-    mapHashTable[i] = Table_Entry;
+    ++mCount;
 }
 
 SYM_ENTRY *SymbolTable::Add_Symbol(const UTF8String& Name, TokenId Number)
@@ -422,7 +426,14 @@ SYM_ENTRY *SymbolTable::Add_Symbol(const UTF8String& Name, TokenId Number)
 
 SYM_ENTRY* SymbolTable::Find_Symbol(const char* name) const
 {
-    return Find_Symbol(name, get_hash_value(name));
+    size_t length = std::strlen(name);
+    return Find_Symbol(name, length, GetHashValue(name, length));
+}
+
+SYM_ENTRY* SymbolTable::Find_Symbol(const UTF8String& name, SymbolHash hash) const
+{
+    POV_PARSER_ASSERT(hash == GetHashValue(name.c_str(), name.size()));
+    return Find_Symbol(name.c_str(), name.size(), hash);
 }
 
 void SymbolTable::Remove_Symbol(const char *Name, bool is_array_elem, void **DataPtr, int ttype)
@@ -443,28 +454,42 @@ void SymbolTable::Remove_Symbol(const char *Name, bool is_array_elem, void **Dat
     }
     else
     {
-        SYM_ENTRY *Entry;
-        SYM_ENTRY **EntryPtr;
+        size_t length = std::strlen(Name);
+        SymbolHash hash = GetHashValue(Name, length);
 
-        int i = get_hash_value(Name);
+        if (maSlots.empty())
+            POV_PARSER_PANIC();
+
+        size_t mask = maSlots.size() - 1;
+        size_t i = hash & mask;
+        for (;;)
+        {
+            const Slot& slot = maSlots[i];
+            if (slot.entry == nullptr)
+                POV_PARSER_PANIC();
+            if ((slot.hash == hash) && (slot.entry->name.size() == length) &&
+                (std::memcmp(Name, slot.entry->name.data(), length) == 0))
+                break;
+            i = (i + 1) & mask;
+        }
 
-        EntryPtr = &(mapHashTable[i]);
-        Entry = *EntryPtr;
+        Destroy_Entry(maSlots[i].entry);
+        --mCount;
 
-        while (Entry)
+        // Close the gap, moving back any subsequent entries of the same cluster that would
+        // otherwise no longer be reachable from their home slots.
+        for (size_t j = (i + 1) & mask; maSlots[j].entry != nullptr; j = (j + 1) & mask)
         {
-            if (strcmp(Name, Entry->name.c_str()) == 0)
+            size_t home = maSlots[j].hash & mask;
+            bool reachable = (i <= j) ? ((i < home) && (home <= j))
+                                      : ((i < home) || (home <= j));
+            if (!reachable)
             {
-                *EntryPtr = Entry->next;
-                Destroy_Entry(Entry);
-                return;
+                maSlots[i] = maSlots[j];
+                i = j;
             }
-
-            EntryPtr = &(Entry->next);
-            Entry = *EntryPtr;
         }
-
-        POV_PARSER_PANIC();
+        maSlots[i].entry = nullptr;
     }
 }
 
@@ -514,31 +539,63 @@ template<typename T> void SymbolTable::DeleteData(void* data)
 
 //------------------------------------------------------------------------------
 
-SYM_ENTRY* SymbolTable::Find_Symbol(const char* Name, int hash) const
+SYM_ENTRY* SymbolTable::Find_Symbol(const char* Name, size_t length, SymbolHash hash) const
 {
-    SYM_ENTRY* Entry = mapHashTable[hash];
+    if (maSlots.empty())
+        return nullptr;
 
-    while (Entry)
+    size_t mask = maSlots.size() - 1;
+    for (size_t i = hash & mask; ; i = (i + 1) & mask)
     {
-        if (strcmp(Name, Entry->name.c_str()) == 0)
-            return Entry;
-
-        Entry = Entry->next;
+        const Slot& slot = maSlots[i];
+        if (slot.entry == nullptr)
+            return nullptr;
+        if ((slot.hash == hash) && (slot.entry->name.size() == length) &&
+            (std::memcmp(Name, slot.entry->name.data(), length) == 0))
+            return slot.entry;
     }
-
-    return Entry;
 }
 
-int SymbolTable::get_hash_value(const char *s)
+void SymbolTable::Grow()
 {
-    unsigned int i = 0;
+    std::vector<Slot> aOldSlots(std::max(maSlots.size() * 2, size_t(SYM_TABLE_MIN_SIZE)), Slot{ 0, nullptr });
+    maSlots.swap(aOldSlots);
 
-    while (*s)
+    // Re-inserting in the old slot order keeps entries of the same name in shadowing order,
+    // as the newest of them is always encountered first when scanning from its home slot
+    // (unless the cluster wraps around, in which case we start the scan at an empty slot).
+    size_t mask = maSlots.size() - 1;
+    size_t oldCount = aOldSlots.size();
+    size_t start = 0;
+    while ((start < oldCount) && (aOldSlots[start].entry != nullptr))
+        ++start;
+    for (size_t k = 0; k < oldCount; ++k)
     {
-        i = (i << 1) ^ *s++;
+        const Slot& oldSlot = aOldSlots[(start + k) % oldCount];
+        if (oldSlot.entry == nullptr)
+            continue;
+        size_t i = oldSlot.hash & mask;
+        while (maSlots[i].entry != nullptr)
+            i = (i + 1) & mask;
+        maSlots[i] = oldSlot;
     }
+}
 
-    return((int)(i % SYM_TABLE_SIZE));
+SymbolHash SymbolTable::GetHashValue(const char* s, size_t length)
+{
+    // 32 bit FNV-1a hash
+    SymbolHash hash = 0x811C9DC5u;
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash ^= (unsigned char)s[i];
+        hash *= 0x01000193u;
+    }
+    return hash;
+}
+
+SymbolHash SymbolTable::GetHashValue(const char* s)
+{
+    return GetHashValue(s, std::strlen(s));
 }
 
 //******************************************************************************
@@ -592,16 +649,27 @@ SYM_ENTRY *SymbolStack::Add_Symbol(int Index, const UTF8String& Name, TokenId Nu
 
 SYM_ENTRY* SymbolStack::Find_Symbol(int index, const char* name)
 {
-    return Tables[index]->Find_Symbol(name, SymbolTable::get_hash_value(name));
+    return Tables[index]->Find_Symbol(name);
 }
 
 SYM_ENTRY* SymbolStack::Find_Symbol(const char* name, int* pIndex)
+{
+    size_t length = std::strlen(name);
+    return Find_Symbol(name, length, SymbolTable::GetHashValue(name, length), pIndex);
+}
+
+SYM_ENTRY* SymbolStack::Find_Symbol(const UTF8String& name, SymbolHash hash, int* pIndex)
+{
+    POV_PARSER_ASSERT(hash == SymbolTable::GetHashValue(name.c_str(), name.size()));
+    return Find_Symbol(name.c_str(), name.size(), hash, pIndex);
+}
+
+SYM_ENTRY* SymbolStack::Find_Symbol(const char* name, size_t length, SymbolHash hash, int* pIndex)
 {
     SYM_ENTRY *entry;
-    int hash = SymbolTable::get_hash_value(name);
     for (int index = Table_Index; index >= SYM_TABLE_GLOBAL; --index)
     {
-        entry = Tables[index]->Find_Symbol(name, hash);
+        entry = Tables[index]->Find_Symbol(name, length, hash);
         if (entry)
         {
             if (pIndex != nullptr)
@@ -44,6 +44,7 @@
 
 // C++ standard header files
 #include <memory>
+#include <vector>
 
 // Boost header files
 //  (none at the moment)
@@ -63,7 +64,7 @@ using namespace pov_base;
 //------------------------------------------------------------------------------
 
 const int MAX_NUMBER_OF_TABLES = 100;
-const int SYM_TABLE_SIZE = 257;
+const int SYM_TABLE_MIN_SIZE = 16; ///< Number of slots allocated for a symbol table on first use; must be a power of 2.
 
 typedef struct Sym_Table_Entry SYM_ENTRY;
 typedef unsigned short SymTableEntryRefCount;
@@ -77,8 +78,8 @@ enum
 /// Structure holding information about a symbol
 struct Sym_Table_Entry
 {
-    SYM_ENTRY *next;            ///< Reference to next symbol with same hash
     UTF8String name;            ///< Symbol name
+    SymbolHash hash;            ///< Hash value of the symbol name
     char *Deprecation_Message;  ///< Warning to print if the symbol is deprecated
     void *Data;                 ///< Reference to the symbol value
     TokenId Token_Number;       ///< Unique ID of this symbol
@@ -100,7 +101,7 @@ struct SymbolTable
 
     static SYM_ENTRY* Create_Entry(const UTF8String& Name, TokenId Number);
     static SYM_ENTRY* Copy_Entry(const SYM_ENTRY* oldEntry);
-    static SYM_ENTRY* Destroy_Entry(SYM_ENTRY* Entry);
+    static void Destroy_Entry(SYM_ENTRY* Entry);
 
     // Payload Data Lifetime
 
@@ -112,25 +113,42 @@ struct SymbolTable
     void Add_Entry(SYM_ENTRY *Table_Entry);
     SYM_ENTRY *Add_Symbol(const UTF8String& Name, TokenId Number);
     SYM_ENTRY* Find_Symbol(const char* s) const;
+    SYM_ENTRY* Find_Symbol(const UTF8String& s, SymbolHash hash) const;
     void Remove_Symbol(const char *Name, bool is_array_elem, void **DataPtr, int ttype);
 
     static void Acquire_Entry_Reference(SYM_ENTRY *Entry);
     static void Release_Entry_Reference(SYM_ENTRY *Entry);
 
+    /// Compute the hash value of a symbol name.
+    static SymbolHash GetHashValue(const char* s, size_t length);
+    static SymbolHash GetHashValue(const char* s);
+
 protected:
 
     template<typename T> static void* CopyConstructData(const void*);
     template<typename T> static void* CloneData(const void*);
     template<typename T> static void DeleteData(void*);
 
-    SYM_ENTRY* Find_Symbol(const char* s, int hash) const;
-    static int get_hash_value(const char *s);
+    SYM_ENTRY* Find_Symbol(const char* s, size_t length, SymbolHash hash) const;
 
     friend class SymbolStack;
 
 private:
 
-    SYM_ENTRY* mapHashTable[SYM_TABLE_SIZE];
+    /// Hash table slot.
+    /// The hash value is duplicated here so that probing does not need to dereference the entries.
+    struct Slot
+    {
+        SymbolHash hash;
+        SYM_ENTRY* entry;
+    };
+
+    /// Open-addressing hash table with linear probing.
+    /// The number of slots is either zero or a power of 2, and at most half of them are in use.
+    std::vector<Slot> maSlots;
+    size_t mCount;
+
+    void Grow();
 };
 
 using SymbolTablePtr = std::shared_ptr<SymbolTable>;
@@ -158,6 +176,7 @@ public:
     SYM_ENTRY *Add_Symbol(int Index, const UTF8String& Name, TokenId Number);
     SYM_ENTRY* Find_Symbol(int index, const char* s);
     SYM_ENTRY* Find_Symbol(const char* s, int* pIndex = nullptr);
+    SYM_ENTRY* Find_Symbol(const UTF8String& s, SymbolHash hash, int* pIndex = nullptr);
     void Remove_Symbol(int Index, const char *Name, bool is_array_elem, void **DataPtr, int ttype);
 
     //------------------------------------------------------------------------------
@@ -176,6 +195,8 @@ public:
 
 protected:
 
+    SYM_ENTRY* Find_Symbol(const char* s, size_t length, SymbolHash hash, int* pIndex);
+
     SymbolTable* Tables[MAX_NUMBER_OF_TABLES];
     int Table_Index;
 };
@@ -198,6 +198,48 @@ struct POVMS_Sys_QueueNode_Default
     };
 #endif
 
+// Note: Object nodes, attribute data and list items are small and are
+// allocated and freed at a high rate while messages are built, streamed
+// and parsed, so they are recycled through per-thread free lists of a few
+// block sizes. Memory tracing needs to see every allocation, and thread
+// local storage requires C++, so pooling is disabled in these cases.
+#if defined(_DEBUG_POVMS_TRACE_MEMORY_) || !defined(__cplusplus)
+    #ifndef POVMS_NO_POOL
+        #define POVMS_NO_POOL
+    #endif
+#endif
+
+#ifdef POVMS_NO_POOL
+    #define POVMS_Pool_Malloc(s)          POVMS_Sys_Malloc(s)
+    #define POVMS_Pool_Realloc(p,s)       POVMS_Sys_Realloc(p,s)
+    #define POVMS_Pool_Free(p)            POVMS_Sys_Free(p)
+#else
+    static const int kPOVMSPoolSizeClasses              = 5;    // block sizes 16, 32, 64, 128 and 256 bytes
+    static const size_t kPOVMSPoolMinBlockSize          = 16;
+    static const int kPOVMSPoolMaxCachedBlocks          = 256;  // per size class and thread
+
+    typedef union POVMSPoolBlockHeader POVMSPoolBlockHeader;
+    typedef struct POVMSPoolCache POVMSPoolCache;
+
+    union POVMSPoolBlockHeader
+    {
+        POVMSPoolBlockHeader *next; // while in a free list
+        int sizeclass;              // while in use; kPOVMSPoolSizeClasses for blocks too large to pool
+        POVMSLong alignlong;
+        double aligndouble;
+    };
+
+    struct POVMSPoolCache
+    {
+        POVMSPoolBlockHeader *freelist[kPOVMSPoolSizeClasses];
+        int cached[kPOVMSPoolSizeClasses];
+        POVMSBool released;
+
+        POVMSPoolCache();
+        ~POVMSPoolCache();
+    };
+#endif
+
 
 /*****************************************************************************
 * Local typedefs
@@ -292,6 +334,13 @@ void POVMS_Sys_Trace_Insert(POVMSMemoryTraceHeader *ptr);
 void POVMS_Sys_Trace_Remove(POVMSMemoryTraceHeader *ptr);
 #endif
 
+#ifndef POVMS_NO_POOL
+int POVMS_Pool_SizeClass(size_t size);
+void *POVMS_Pool_Malloc(size_t size);
+void *POVMS_Pool_Realloc(void *ptr, size_t size);
+void POVMS_Pool_Free(void *ptr);
+#endif
+
 
 /*****************************************************************************
 *
@@ -1396,7 +1445,7 @@ POVMS_EXPORT int POVMS_CDECL POVMSStream_Read(struct POVMSData *data, POVMSStrea
             data->root = POVMS_NULLPTR;
             for(cnt = 0; cnt < data->size; cnt++)
             {
-                POVMSNode *cur = (POVMSNode *)POVMS_Sys_Malloc(sizeof(POVMSNode));
+                POVMSNode *cur = (POVMSNode *)POVMS_Pool_Malloc(sizeof(POVMSNode));
                 cur->last = POVMS_NULLPTR;
                 cur->next = data->root;
                 if (data->root != POVMS_NULLPTR)
@@ -1407,46 +1456,46 @@ POVMS_EXPORT int POVMS_CDECL POVMSStream_Read(struct POVMSData *data, POVMSStrea
             }
             break;
         case kPOVMSType_List:
-            data->ptr = (void *)POVMS_Sys_Malloc(sizeof(POVMSData) * data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(sizeof(POVMSData) * data->size);
             for(cnt = 0; cnt < data->size; cnt++)
                 ret += POVMSStream_Read(&(data->items[cnt]), stream + ret, maxstreamsize);
             break;
         case kPOVMSType_CString:
-            data->ptr = (void *)POVMS_Sys_Malloc(data->size + 1);
+            data->ptr = (void *)POVMS_Pool_Malloc(data->size + 1);
             ret += POVMSStream_ReadString((char *)(data->ptr), stream + ret, data->size, maxstreamsize);
             ((char *)(data->ptr))[data->size] = '\0';
             data->size++;
             break;
         case kPOVMSType_UCS2String:
-            data->ptr = (void *)POVMS_Sys_Malloc(data->size + sizeof(POVMSUCS2));
+            data->ptr = (void *)POVMS_Pool_Malloc(data->size + sizeof(POVMSUCS2));
             ret += POVMSStream_ReadUCS2String((POVMSUCS2 *)(data->ptr), stream + ret, data->size / sizeof(POVMSUCS2), maxstreamsize);
             ((POVMSUCS2 *)(data->ptr))[data->size / sizeof(POVMSUCS2)] = '\0';
             data->size += sizeof(POVMSUCS2);
             break;
         case kPOVMSType_Int:
             data->size = sizeof(POVMSInt);
-            data->ptr = (void *)POVMS_Sys_Malloc(data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(data->size);
             ret += POVMSStream_ReadInt(((POVMSInt *)(data->ptr)), stream + ret, maxstreamsize);
             break;
         case kPOVMSType_Long:
             data->size = sizeof(POVMSLong);
-            data->ptr = (void *)POVMS_Sys_Malloc(data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(data->size);
             ret += POVMSStream_ReadLong(((POVMSLong *)(data->ptr)), stream + ret, maxstreamsize);
             break;
         case kPOVMSType_Float:
             data->size = sizeof(POVMSFloat);
-            data->ptr = (void *)POVMS_Sys_Malloc(data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(data->size);
             ret += POVMSStream_ReadFloat(((POVMSFloat *)(data->ptr)), stream + ret, maxstreamsize);
             break;
         case kPOVMSType_Bool:
             data->size = 1;
-            data->ptr = (void *)POVMS_Sys_Malloc(data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(data->size);
             POVMSStream_ReadDataUnordered(stream + ret, (POVMSStream *)(data->ptr), data->size);
             ret += 1;
             break;
         case kPOVMSType_Type:
             data->size = sizeof(POVMSType);
-            data->ptr = (void *)POVMS_Sys_Malloc(data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(data->size);
             ret += POVMSStream_ReadType(((POVMSType *)(data->ptr)), stream + ret, maxstreamsize);
             break;
         case kPOVMSType_Void:
@@ -1454,36 +1503,36 @@ POVMS_EXPORT int POVMS_CDECL POVMSStream_Read(struct POVMSData *data, POVMSStrea
             data->ptr = POVMS_NULLPTR;
             break;
         case kPOVMSType_VectorInt:
-            data->ptr = (void *)POVMS_Sys_Malloc(sizeof(POVMSInt) * data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(sizeof(POVMSInt) * data->size);
             for(int i = 0; i < data->size; i++)
                 ret += POVMSStream_ReadInt(&(((POVMSInt *)(data->ptr))[i]), stream + ret, maxstreamsize);
             data->size = sizeof(POVMSInt) * data->size;
             break;
         case kPOVMSType_VectorLong:
-            data->ptr = (void *)POVMS_Sys_Malloc(sizeof(POVMSLong) * data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(sizeof(POVMSLong) * data->size);
             for(int i = 0; i < data->size; i++)
                 ret += POVMSStream_ReadLong(&(((POVMSLong *)(data->ptr))[i]), stream + ret, maxstreamsize);
             data->size = sizeof(POVMSLong) * data->size;
             break;
         case kPOVMSType_VectorFloat:
-            data->ptr = (void *)POVMS_Sys_Malloc(sizeof(POVMSFloat) * data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(sizeof(POVMSFloat) * data->size);
             for(int i = 0; i < data->size; i++)
                 ret += POVMSStream_ReadFloat(&(((POVMSFloat *)(data->ptr))[i]), stream + ret, maxstreamsize);
             data->size = sizeof(POVMSFloat) * data->size;
             break;
         case kPOVMSType_VectorType:
-            data->ptr = (void *)POVMS_Sys_Malloc(sizeof(POVMSType) * data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(sizeof(POVMSType) * data->size);
             for(int i = 0; i < data->size; i++)
                 ret += POVMSStream_ReadType(&(((POVMSType *)(data->ptr))[i]), stream + ret, maxstreamsize);
             data->size = sizeof(POVMSType) * data->size;
             break;
         case kPOVMSType_Address:
-            data->ptr = (void *)POVMS_Sys_Malloc(sizeof(POVMSAddress));
+            data->ptr = (void *)POVMS_Pool_Malloc(sizeof(POVMSAddress));
             ret += POVMS_Sys_AddressFromStream((POVMSAddress *)(data->ptr), stream + ret, data->size);
             data->size = sizeof(POVMSAddress);
             break;
         default:
-            data->ptr = (void *)POVMS_Sys_Malloc(data->size);
+            data->ptr = (void *)POVMS_Pool_Malloc(data->size);
             POVMSStream_ReadDataUnordered(stream + ret, (POVMSStream *)(data->ptr), data->size);
             ret += data->size;
             break;
@@ -2351,7 +2400,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSObject_Delete(POVMSObjectPtr object)
         cur = cur->next;
         POVMSAttr_Delete(&del->data);
 
-        POVMS_Sys_Free((void *)del);
+        POVMS_Pool_Free((void *)del);
     }
 
     object->type = kPOVMSType_Object;
@@ -2547,7 +2596,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSObject_Set(POVMSObjectPtr object, POVM
     }
     else
     {
-        in = (POVMSNode *)POVMS_Sys_Malloc(sizeof(POVMSNode));
+        in = (POVMSNode *)POVMS_Pool_Malloc(sizeof(POVMSNode));
         if (!POVMS_ASSERT(in != POVMS_NULLPTR, "POVMSObject_Set failed, out of memory"))
             err = kOutOfMemoryErr;
         else
@@ -2617,7 +2666,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSObject_Remove(POVMSObjectPtr object, P
 
         object->size--;
 
-        POVMS_Sys_Free((void *)del);
+        POVMS_Pool_Free((void *)del);
     }
 
     object->type = kPOVMSType_Object;
@@ -3075,10 +3124,10 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSAttr_Delete(POVMSAttributePtr attr)
     else if(attr->type == kPOVMSType_Address)
     {
         // NetPOVMS_DeleteAddress((POVMSAddressPtr)(attr->ptr));
-        POVMS_Sys_Free((void *)(attr->ptr));
+        POVMS_Pool_Free((void *)(attr->ptr));
     }
     else if (attr->ptr != POVMS_NULLPTR)
-        POVMS_Sys_Free((void *)(attr->ptr));
+        POVMS_Pool_Free((void *)(attr->ptr));
 
     attr->type = kPOVMSType_Null;
     attr->size = 0;
@@ -3128,7 +3177,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSAttr_Copy(POVMSAttributePtr sourceattr
 
         if (sourceattr->ptr != POVMS_NULLPTR)
         {
-            destattr->ptr =(void *)POVMS_Sys_Malloc(sourceattr->size);
+            destattr->ptr =(void *)POVMS_Pool_Malloc(sourceattr->size);
             if (!POVMS_ASSERT(destattr->ptr != POVMS_NULLPTR, "POVMSAttr_Copy failed, out of memory"))
                 return kMemFullErr;
 
@@ -3218,7 +3267,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSAttr_Set(POVMSAttributePtr attr, POVMS
 
     if (datasize > 0)
     {
-        attr->ptr = (void *)POVMS_Sys_Malloc(datasize);
+        attr->ptr = (void *)POVMS_Pool_Malloc(datasize);
         if (!POVMS_ASSERT(attr->ptr != POVMS_NULLPTR, "POVMSAttr_Set failed, out of memory"))
             return kMemFullErr;
 
@@ -3393,7 +3442,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSAttrList_Copy(POVMSAttributeListPtr so
     {
         if (sourcelist->ptr != POVMS_NULLPTR)
         {
-            destlist->ptr = (void *)POVMS_Sys_Malloc(sizeof(POVMSData) * sourcelist->size);
+            destlist->ptr = (void *)POVMS_Pool_Malloc(sizeof(POVMSData) * sourcelist->size);
             if (!POVMS_ASSERT(destlist->ptr != POVMS_NULLPTR, "POVMSAttrList_Copy failed, out of memory"))
                 return kOutOfMemoryErr;
         }
@@ -3413,7 +3462,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSAttrList_Copy(POVMSAttributeListPtr so
                 err = POVMSAttr_Delete(&(destlist->items[cnt]));
                 POVMS_ASSERT(err == kNoErr, "POVMSAttr_Delete in POVMSAttrList_Copy failed. Possible memory leak.");
             }
-            POVMS_Sys_Free((void *)(destlist->items));
+            POVMS_Pool_Free((void *)(destlist->items));
             err = kObjectAccessErr;
         }
     }
@@ -3449,7 +3498,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSAttrList_Append(POVMSAttributeListPtr
     if (item == POVMS_NULLPTR)
         return kNoErr;
 
-    temp_items = (POVMSData *)POVMS_Sys_Realloc((void *)(attr->items), sizeof(POVMSData) * (attr->size + 1));
+    temp_items = (POVMSData *)POVMS_Pool_Realloc((void *)(attr->items), sizeof(POVMSData) * (attr->size + 1));
     if (!POVMS_ASSERT(temp_items != POVMS_NULLPTR, "POVMSAttrList_Append failed, out of memory"))
     {
         err = kOutOfMemoryErr;
@@ -3492,7 +3541,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSAttrList_AppendN(POVMSAttributeListPtr
     if (item == POVMS_NULLPTR)
         return kNoErr;
 
-    temp_items = (POVMSData *)POVMS_Sys_Realloc((void *)(attr->items), sizeof(POVMSData) * (attr->size + cnt));
+    temp_items = (POVMSData *)POVMS_Pool_Realloc((void *)(attr->items), sizeof(POVMSData) * (attr->size + cnt));
     if (!POVMS_ASSERT(temp_items != POVMS_NULLPTR, "POVMSAttrList_Append failed, out of memory"))
     {
         err = kNoErr;
@@ -3516,7 +3565,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSAttrList_AppendN(POVMSAttributeListPtr
                 err = POVMSAttr_Delete(&(attr->items[cnt]));
                 POVMS_ASSERT(err == kNoErr, "POVMSAttr_Delete in POVMSAttrList_AppendN failed. Possible memory leak.");
             }
-            POVMS_Sys_Free((void *)(attr->items));
+            POVMS_Pool_Free((void *)(attr->items));
             err = kObjectAccessErr;
         }
     }
@@ -3665,7 +3714,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSAttrList_RemoveNth(POVMSAttributeListP
     {
         if(attr->size < index)
             POVMS_Sys_Memmove((void *)(&(attr->items[index - 1])), (void *)(&(attr->items[index])), sizeof(POVMSData) * (attr->size - index));
-        temp_items = (POVMSData *)POVMS_Sys_Realloc((void *)(attr->items), sizeof(POVMSData) * (attr->size - 1));
+        temp_items = (POVMSData *)POVMS_Pool_Realloc((void *)(attr->items), sizeof(POVMSData) * (attr->size - 1));
         if (!POVMS_ASSERT(temp_items != POVMS_NULLPTR, "POVMSAttrList_RemoveNth failed, out of memory"))
             err = kOutOfMemoryErr;
         else
@@ -3713,7 +3762,7 @@ POVMS_EXPORT POVMSResult POVMS_CDECL POVMSAttrList_Clear(POVMSAttributeListPtr a
     }
 
     if (attr->items != POVMS_NULLPTR)
-        POVMS_Sys_Free((void *)(attr->items));
+        POVMS_Pool_Free((void *)(attr->items));
 
     attr->type = kPOVMSType_Null;
     attr->size = 0;
@@ -4695,6 +4744,144 @@ int POVMS_Sys_AddressToStreamSize_Default(POVMSAddress)
     return (2 + sizeof(POVMSAddress));
 }
 
+/*****************************************************************************
+* POVMS small block pool functions
+******************************************************************************/
+
+#ifndef POVMS_NO_POOL
+
+static thread_local POVMSPoolCache gPOVMSPoolCache;
+
+POVMSPoolCache::POVMSPoolCache() :
+    released(POVMSFalse)
+{
+    for(int i = 0; i < kPOVMSPoolSizeClasses; i++)
+    {
+        freelist[i] = POVMS_NULLPTR;
+        cached[i] = 0;
+    }
+}
+
+POVMSPoolCache::~POVMSPoolCache()
+{
+    for(int i = 0; i < kPOVMSPoolSizeClasses; i++)
+    {
+        while(freelist[i] != POVMS_NULLPTR)
+        {
+            POVMSPoolBlockHeader *block = freelist[i];
+            freelist[i] = block->next;
+            POVMS_Sys_Free((void *)block);
+        }
+        cached[i] = 0;
+    }
+
+    // blocks freed by this thread from now on (e.g. by destructors of other
+    // thread local objects) go straight back to the system
+    released = POVMSTrue;
+}
+
+int POVMS_Pool_SizeClass(size_t size)
+{
+    size_t blocksize = kPOVMSPoolMinBlockSize;
+
+    for(int i = 0; i < kPOVMSPoolSizeClasses; i++, blocksize <<= 1)
+    {
+        if(size <= blocksize)
+            return i;
+    }
+
+    return kPOVMSPoolSizeClasses;
+}
+
+void *POVMS_Pool_Malloc(size_t size)
+{
+    POVMSPoolBlockHeader *block = POVMS_NULLPTR;
+    int sizeclass = POVMS_Pool_SizeClass(size);
+
+    if(sizeclass < kPOVMSPoolSizeClasses)
+    {
+        POVMSPoolCache& cache = gPOVMSPoolCache;
+
+        block = cache.freelist[sizeclass];
+        if(block != POVMS_NULLPTR)
+        {
+            cache.freelist[sizeclass] = block->next;
+            cache.cached[sizeclass]--;
+        }
+        else
+            block = (POVMSPoolBlockHeader *)POVMS_Sys_Malloc(sizeof(POVMSPoolBlockHeader) + (kPOVMSPoolMinBlockSize << sizeclass));
+    }
+    else
+        block = (POVMSPoolBlockHeader *)POVMS_Sys_Malloc(sizeof(POVMSPoolBlockHeader) + size);
+
+    if(block == POVMS_NULLPTR)
+        return POVMS_NULLPTR;
+
+    block->sizeclass = sizeclass;
+
+    return (void *)(block + 1);
+}
+
+void *POVMS_Pool_Realloc(void *ptr, size_t size)
+{
+    if(ptr == POVMS_NULLPTR)
+        return POVMS_Pool_Malloc(size);
+
+    POVMSPoolBlockHeader *block = ((POVMSPoolBlockHeader *)ptr) - 1;
+    int oldclass = block->sizeclass;
+    int newclass = POVMS_Pool_SizeClass(size);
+
+    if((oldclass == kPOVMSPoolSizeClasses) && (newclass == kPOVMSPoolSizeClasses))
+    {
+        block = (POVMSPoolBlockHeader *)POVMS_Sys_Realloc((void *)block, sizeof(POVMSPoolBlockHeader) + size);
+        if(block == POVMS_NULLPTR)
+            return POVMS_NULLPTR;
+        return (void *)(block + 1);
+    }
+    else if(oldclass == newclass)
+        return ptr;
+
+    void *newptr = POVMS_Pool_Malloc(size);
+    if(newptr == POVMS_NULLPTR)
+        return POVMS_NULLPTR;
+
+    // an unpooled old block is always larger than the new one
+    size_t copysize = size;
+    if((oldclass < kPOVMSPoolSizeClasses) && ((kPOVMSPoolMinBlockSize << oldclass) < size))
+        copysize = (kPOVMSPoolMinBlockSize << oldclass);
+
+    POVMS_Sys_Memmove(newptr, ptr, copysize);
+    POVMS_Pool_Free(ptr);
+
+    return newptr;
+}
+
+void POVMS_Pool_Free(void *ptr)
+{
+    if(ptr == POVMS_NULLPTR)
+        return;
+
+    POVMSPoolBlockHeader *block = ((POVMSPoolBlockHeader *)ptr) - 1;
+    int sizeclass = block->sizeclass;
+
+    if(sizeclass < kPOVMSPoolSizeClasses)
+    {
+        POVMSPoolCache& cache = gPOVMSPoolCache;
+
+        if((cache.released == POVMSFalse) && (cache.cached[sizeclass] < kPOVMSPoolMaxCachedBlocks))
+        {
+            block->next = cache.freelist[sizeclass];
+            cache.freelist[sizeclass] = block;
+            cache.cached[sizeclass]++;
+            return;
+        }
+    }
+
+    POVMS_Sys_Free((void *)block);
+}
+
+#endif
+
 /*****************************************************************************
 * POVMS memory debugging functions
 ******************************************************************************/
@@ -35,6 +35,7 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <utility>
 
 #include <zlib.h>
 
@@ -333,6 +334,12 @@ POVMS_Attribute::POVMS_Attribute(const POVMS_Attribute& source)
         throw POV_EXCEPTION_CODE(err);
 }
 
+POVMS_Attribute::POVMS_Attribute(POVMS_Attribute&& source) noexcept
+{
+    data = source.data;
+    source.DetachData();
+}
+
 POVMS_Attribute::~POVMS_Attribute() noexcept(false)
 {
     int err;
@@ -355,6 +362,23 @@ POVMS_Attribute& POVMS_Attribute::operator=(const POVMS_Attribute& source)
     return *this;
 }
 
+POVMS_Attribute& POVMS_Attribute::operator=(POVMS_Attribute&& source)
+{
+    if(&source != this)
+    {
+        int err;
+
+        err = POVMSAttr_Delete(&data);
+        if(err != pov_base::kNoErr)
+            throw POV_EXCEPTION_CODE(err);
+
+        data = source.data;
+        source.DetachData();
+    }
+
+    return *this;
+}
+
 void POVMS_Attribute::Get(POVMSType type, void *data, int *maxdatasize)
 {
     int err;
@@ -599,6 +623,12 @@ POVMS_List::POVMS_List(const POVMS_List& source)
         throw POV_EXCEPTION_CODE(err);
 }
 
+POVMS_List::POVMS_List(POVMS_List&& source) noexcept
+{
+    data = source.data;
+    source.DetachData();
+}
+
 POVMS_List::~POVMS_List() noexcept(false)
 {
     int err;
@@ -621,6 +651,23 @@ POVMS_List& POVMS_List::operator=(const POVMS_List& source)
     return *this;
 }
 
+POVMS_List& POVMS_List::operator=(POVMS_List&& source)
+{
+    if(&source != this)
+    {
+        int err;
+
+        err = POVMSAttrList_Delete(&data);
+        if(err != pov_base::kNoErr)
+            throw POV_EXCEPTION_CODE(err);
+
+        data = source.data;
+        source.DetachData();
+    }
+
+    return *this;
+}
+
 void POVMS_List::Append(POVMS_Attribute& item)
 {
     int err;
@@ -822,6 +869,12 @@ POVMS_Object::POVMS_Object(const POVMS_Object& source)
     }
 }
 
+POVMS_Object::POVMS_Object(POVMS_Object&& source) noexcept
+{
+    data = source.data;
+    source.DetachData();
+}
+
 POVMS_Object::~POVMS_Object() noexcept(false)
 {
     int err;
@@ -844,6 +897,23 @@ POVMS_Object& POVMS_Object::operator=(const POVMS_Object& source)
     return *this;
 }
 
+POVMS_Object& POVMS_Object::operator=(POVMS_Object&& source)
+{
+    if(&source != this)
+    {
+        int err;
+
+        err = POVMSObject_Delete(&data);
+        if(err != pov_base::kNoErr)
+            throw POV_EXCEPTION_CODE(err);
+
+        data = source.data;
+        source.DetachData();
+    }
+
+    return *this;
+}
+
 void POVMS_Object::Get(POVMSType key, POVMS_Attribute& attr)
 {
     int err;
@@ -1561,6 +1631,15 @@ POVMS_Message::POVMS_Message(POVMS_Object& convert, POVMSType msgclass, POVMSTyp
         throw POV_EXCEPTION_CODE(err);
 }
 
+POVMS_Message::POVMS_Message(POVMS_Object&& convert, POVMSType msgclass, POVMSType msgid) : POVMS_Object(std::move(convert))
+{
+    int err;
+
+    err = POVMSMsg_SetupMessage(&data, msgclass, msgid);
+    if(err != pov_base::kNoErr)
+        throw POV_EXCEPTION_CODE(err);
+}
+
 POVMS_Message::POVMS_Message(POVMSObject& convert) : POVMS_Object(convert)
 {
 }
@@ -1573,6 +1652,10 @@ POVMS_Message::POVMS_Message(const POVMS_Message& source) : POVMS_Object(source)
 {
 }
 
+POVMS_Message::POVMS_Message(POVMS_Message&& source) noexcept : POVMS_Object(std::move(source))
+{
+}
+
 POVMS_Message& POVMS_Message::operator=(const POVMS_Message& source)
 {
     int err;
@@ -1586,6 +1669,13 @@ POVMS_Message& POVMS_Message::operator=(const POVMS_Message& source)
     return *this;
 }
 
+POVMS_Message& POVMS_Message::operator=(POVMS_Message&& source)
+{
+    POVMS_Object::operator=(std::move(source));
+
+    return *this;
+}
+
 POVMSType POVMS_Message::GetClass()
 {
     POVMSType type;
@@ -95,9 +95,11 @@ class POVMS_Attribute : public POVMS_Container
         POVMS_Attribute(std::vector<POVMSType>& value);
         POVMS_Attribute(POVMSAttribute& convert);
         POVMS_Attribute(const POVMS_Attribute& source);
+        POVMS_Attribute(POVMS_Attribute&& source) noexcept;
         virtual ~POVMS_Attribute() noexcept(false);
 
         POVMS_Attribute& operator=(const POVMS_Attribute& source);
+        POVMS_Attribute& operator=(POVMS_Attribute&& source);
 
         void Get(POVMSType type, void *data, int *maxdatasize);
         void Set(POVMSType type, const void *data, int datasize);
@@ -128,9 +130,11 @@ class POVMS_List : public POVMS_Container
         POVMS_List();
         POVMS_List(POVMSAttributeList& convert);
         POVMS_List(const POVMS_List& source);
+        POVMS_List(POVMS_List&& source) noexcept;
         virtual ~POVMS_List() noexcept(false);
 
         POVMS_List& operator=(const POVMS_List& source);
+        POVMS_List& operator=(POVMS_List&& source);
 
         void Append(POVMS_Attribute& item);
         void Append(POVMS_List& item);
@@ -196,9 +200,11 @@ class POVMS_Object : public POVMS_Container
         POVMS_Object(POVMSObject& convert);
         POVMS_Object(POVMSObjectPtr convert);
         POVMS_Object(const POVMS_Object& source);
+        POVMS_Object(POVMS_Object&& source) noexcept;
         ~POVMS_Object() noexcept(false);
 
         POVMS_Object& operator=(const POVMS_Object& source);
+        POVMS_Object& operator=(POVMS_Object&& source);
 
         void Get(POVMSType key, POVMS_Attribute& attr);
         void Get(POVMSType key, POVMS_List& attr);
@@ -281,11 +287,15 @@ class POVMS_Message : public POVMS_Object
         POVMS_Message();
         POVMS_Message(POVMSType objclass, POVMSType msgclass = kPOVMSType_WildCard, POVMSType msgid = kPOVMSType_WildCard);
         POVMS_Message(POVMS_Object& convert, POVMSType msgclass = kPOVMSType_WildCard, POVMSType msgid = kPOVMSType_WildCard);
+        /// Turn an object into a message without copying its attributes; `convert` is left a null object.
+        POVMS_Message(POVMS_Object&& convert, POVMSType msgclass = kPOVMSType_WildCard, POVMSType msgid = kPOVMSType_WildCard);
         POVMS_Message(POVMSObject& convert);
         POVMS_Message(POVMSObjectPtr convert);
         POVMS_Message(const POVMS_Message& source);
+        POVMS_Message(POVMS_Message&& source) noexcept;
 
         POVMS_Message& operator=(const POVMS_Message& source);
+        POVMS_Message& operator=(POVMS_Message&& source);
 
         POVMSType GetClass();
         POVMSType GetIdentifier();
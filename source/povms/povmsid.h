@@ -148,6 +148,12 @@ enum
     kPOVObjectClass_ElapsedTime         = 'ETim',
 
     kPOVObjectClass_IsectStat           = 'ISta',
+    kPOVObjectClass_TraversalStat       = 'TSta',
+    kPOVObjectClass_FunctionStat        = 'FSta',
+    kPOVObjectClass_OpcodeStat          = 'OSta',
+    kPOVObjectClass_ObjectStat          = 'ObSt',
+    kPOVObjectClass_MemoryStat          = 'MSta',
+    kPOVObjectClass_RouletteStat        = 'RrSt',
     kPOVObjectClass_SceneCamera         = 'SCam',
 
     kPOVObjectClass_ShellCommand        = 'SCmd',
@@ -222,6 +228,8 @@ enum
     kPOVMsgIdent_PixelRowSet         = 'RxRS',
     kPOVMsgIdent_RectangleFrameSet   = 'ReFS',
     kPOVMsgIdent_FilledRectangleSet  = 'FiRS',
+    kPOVMsgIdent_CostMapSet          = 'CoMS',
+    kPOVMsgIdent_FeatureMapSet       = 'FeMS',
 
     // SceneOutput, ViewOutput
     kPOVMsgIdent_Warning             = 'Warn',
@@ -263,6 +271,7 @@ enum
 
     kPOVAttrib_PlatformData          = 'PlaD',
     kPOVAttrib_MaxRenderThreads      = 'MRTh',
+    kPOVAttrib_ThreadAffinity        = 'ThAf',
     kPOVAttrib_SceneCamera           = 'SCam',
 
     // universal use
@@ -294,6 +303,8 @@ enum
 
     kPOVAttrib_ContinueTrace         = 'ConT',
     kPOVAttrib_BackupTrace           = 'BacT',
+    kPOVAttrib_CheckpointRadiosityFile = 'CkRa',  ///< (UCS2String) Radiosity cache kept alongside the render state file.
+    kPOVAttrib_CheckpointPhotonFile  = 'CkPh',  ///< (UCS2String) Photon maps kept alongside the render state file.
 
     kPOVAttrib_Verbose               = 'Verb',
     kPOVAttrib_DebugConsole          = 'DCon',
@@ -343,6 +354,13 @@ enum
     kPOVAttrib_OutputFile            = 'OFNa',
     kPOVAttrib_OutputPath            = 'OPat',
     kPOVAttrib_Compression           = 'OFCo',
+    kPOVAttrib_StreamOutput          = 'OStr',  ///< (Bool) Write the output file row by row while rendering.
+    kPOVAttrib_TiledOutput           = 'OTil',  ///< (Bool) Write a tiled, multi-resolution output file.
+    kPOVAttrib_CostMap               = 'OCMa',  ///< (Bool) Write the render cost of each pixel alongside the output file.
+    kPOVAttrib_Denoise               = 'ODen',  ///< (Bool) Denoise the output image, guided by the surfaces hit in each pixel.
+    kPOVAttrib_DenoiseStrength       = 'ODSt',  ///< (Float) Strength of the built-in denoising filter.
+    kPOVAttrib_OutputPipeCommand     = 'OPip',  ///< (Object) Command to stream the raw frames to instead of writing output files.
+    kPOVAttrib_OutputQueueSize       = 'OQue',  ///< (Int) Number of frames to queue for writing in the background, or 0 to write them synchronously.
 
     kPOVAttrib_HistogramFileType     = 'HFTy', // currently not supported by code
     kPOVAttrib_HistogramFile         = 'HFNa', // currently not supported by code
@@ -365,11 +383,18 @@ enum
     // options handled by scene/parser
     kPOVAttrib_InputFile             = 'IFNa',
     kPOVAttrib_IncludeHeader         = 'IncH',
+    kPOVAttrib_IncludeCachePath      = 'IncC',
+    kPOVAttrib_ParseProfile          = 'PPrf',
+    kPOVAttrib_EventTraceFile        = 'EvTF',  ///< (UCS2String) Write a timeline of tasks, render phases and blocks to this file.
 
     kPOVAttrib_WarningLevel          = 'WLev',
     kPOVAttrib_Declare               = 'Decl',
     kPOVAttrib_Clock                 = 'Clck',
     kPOVAttrib_ClocklessAnimation    = 'Ckla',
+    kPOVAttrib_ReuseScene            = 'RSce',
+    kPOVAttrib_IncrementalAnimation  = 'IncA',
+    kPOVAttrib_PipelineFrames        = 'PiFr',
+    kPOVAttrib_AnimationRunId        = 'ARun',
     kPOVAttrib_RealTimeRaytracing    = 'RTRa',
     kPOVAttrib_Version               = 'Vers',
 
@@ -391,20 +416,26 @@ enum
     kPOVAttrib_JitterAmount          = 'AAJA',
     kPOVAttrib_AntialiasGamma        = 'AAGa',
     kPOVAttrib_AntialiasGammaType    = 'AAGT', // currently not supported by code
+    kPOVAttrib_AntialiasTimeLimit    = 'AATL',
     kPOVAttrib_Quality               = 'Qual',
     kPOVAttrib_HighReproducibility   = 'HRep',
     kPOVAttrib_StochasticSeed        = 'Seed',
+    kPOVAttrib_WavefrontTracing      = 'WavT',
+    kPOVAttrib_TimeBudget            = 'TBud',
+    kPOVAttrib_PhotonPasses          = 'PhPa',
 
     kPOVAttrib_Bounding              = 'Boun',
     kPOVAttrib_BoundingMethod        = 'BdMe',
     kPOVAttrib_BoundingThreshold     = 'BdTh',
+    kPOVAttrib_BoundingRefit         = 'BdRf',
     kPOVAttrib_BSP_MaxDepth          = 'BspD',
     kPOVAttrib_BSP_ISectCost         = 'BspI',
     kPOVAttrib_BSP_BaseAccessCost    = 'BspB',
     kPOVAttrib_BSP_ChildAccessCost   = 'BspC',
     kPOVAttrib_BSP_MissChance        = 'BspM',
-    kPOVAttrib_LightBuffer           = 'LBuf', // currently not supported by code
-    kPOVAttrib_VistaBuffer           = 'VBuf', // currently not supported by code
+    kPOVAttrib_BSP_CacheFile         = 'BspF',
+    kPOVAttrib_LightBuffer           = 'LBuf',
+    kPOVAttrib_VistaBuffer           = 'VBuf',
     kPOVAttrib_RemoveBounds          = 'RmBd',
     kPOVAttrib_SplitUnions           = 'SplU',
 
@@ -416,6 +447,10 @@ enum
 
     kPOVAttrib_RadiosityFileName     = 'RaFN',
     kPOVAttrib_RadiosityFromFile     = 'RaFF',
+    kPOVAttrib_RadiosityIncremental  = 'RaIn',
+    kPOVAttrib_RadiosityMergeFile    = 'RaMF',
+    kPOVAttrib_RadiosityPretraceOnly = 'RaPO',
+    kPOVAttrib_RadiositySkipPretrace = 'RaSP',
     kPOVAttrib_RadiosityToFile       = 'RaTF',
     kPOVAttrib_RadiosityVainPretrace = 'RaVP',
 
@@ -463,6 +498,15 @@ enum
     kPOVAttrib_BSPAborts             = 'BAbo',
     kPOVAttrib_BSPAverageAborts      = 'BAAb',
     kPOVAttrib_BSPAverageAbortObjects = 'BAAO',
+    kPOVAttrib_BBoxTreeNodes         = 'BTNo',
+    kPOVAttrib_BBoxTreeCost          = 'BTCo',
+    kPOVAttrib_FlatBVHNodes          = 'BTWN',
+    kPOVAttrib_FlatBVHNodeSize       = 'BTWS',
+    kPOVAttrib_BBoxTreeRefitted      = 'BTRf',
+    kPOVAttrib_HierarchyNodeCost     = 'HNoC',
+    kPOVAttrib_HierarchyObjectCost   = 'HObC',
+    kPOVAttrib_HierarchyDepths       = 'HDep',
+    kPOVAttrib_HierarchyLeafSizes    = 'HLfS',
 
     // statistics generated by view/render (radiosity)
     kPOVAttrib_RadGatherCount        = 'RGCt',
@@ -556,6 +600,12 @@ enum
     kPOVAttrib_ShadowTest            = 'ShdT',
     kPOVAttrib_ShadowTestSuc         = 'ShdS',
     kPOVAttrib_ShadowCacheHits       = 'ShdC',
+    kPOVAttrib_ShadowCacheTests      = 'ShdQ',
+    kPOVAttrib_BSPMailboxHits        = 'BMbH',
+    kPOVAttrib_MergeHitTests         = 'MrgH',
+    kPOVAttrib_MergeInsideTests      = 'MrgI',
+    kPOVAttrib_TraceHeapAllocs       = 'THpA',
+    kPOVAttrib_ReusedCameraRays      = 'RCRa',
 
     kPOVAttrib_PolynomTest           = 'PnmT',
     kPOVAttrib_RootsEliminated       = 'REli',
@@ -574,14 +624,43 @@ enum
     kPOVAttrib_IsoFindRoot           = 'IFRo',
     kPOVAttrib_FunctionVMCalls       = 'FVMC',
     kPOVAttrib_FunctionVMInstrEst    = 'FVMI',
+    kPOVAttrib_FunctionVMInstr       = 'FVMX',
+    kPOVAttrib_FunctionVMTime        = 'FVMT',
+    kPOVAttrib_FunctionVMProfile     = 'FVMP',
+    kPOVAttrib_FunctionVMOpcodes     = 'FVMO',
+
+    kPOVAttrib_ObjectProfile         = 'OPrf',  ///< (List) Run-time statistics of each scene-level object.
+    kPOVAttrib_ObjectTests           = 'OPTe',  ///< (Long) Intersection tests passing the object's bounding box.
+    kPOVAttrib_ObjectHits            = 'OPHi',  ///< (Long) Intersection tests finding any intersection.
+    kPOVAttrib_ObjectTestTime        = 'OPTT',  ///< (Float) Time in seconds spent on intersection tests.
+    kPOVAttrib_ObjectShadings        = 'OPSh',  ///< (Long) Intersections shaded.
+    kPOVAttrib_ObjectShadingTime     = 'OPST',  ///< (Float) Time in seconds spent on texture evaluation.
+
+    kPOVAttrib_MemoryStats           = 'MeSt',  ///< (List) Memory used by each subsystem.
+    kPOVAttrib_MemoryCategory        = 'MCat',  ///< (String) Name of the subsystem.
+    kPOVAttrib_MemoryCurrent         = 'MCur',  ///< (Long) Memory in use at the end of the render, in bytes.
+    kPOVAttrib_MemoryPeak            = 'MPea',  ///< (Long) Highest memory use since parsing started, in bytes.
+    kPOVAttrib_AccountedMemory       = 'AcMe',  ///< (Long) Memory currently in use by all subsystems together, in bytes.
+
+    kPOVAttrib_RouletteStats         = 'RrSs',  ///< (List) Russian roulette statistics for each trace level.
+    kPOVAttrib_RouletteTests         = 'RrTe',  ///< (Long) Rays subjected to Russian roulette.
+    kPOVAttrib_RouletteKills         = 'RrKi',  ///< (Long) Rays terminated by Russian roulette.
 
     kPOVAttrib_CrackleCacheTest      = 'CrCT',
     kPOVAttrib_CrackleCacheTestSuc   = 'CrCS',
 
+    kPOVAttrib_MeshTest              = 'MshR',
+    kPOVAttrib_MeshTriangleTest      = 'MshT',
+
     kPOVAttrib_ObjectIStats          = 'OISt',
     kPOVAttrib_ISectsTests           = 'ITst',
     kPOVAttrib_ISectsSucceeded       = 'ISuc',
 
+    kPOVAttrib_TraversalStats        = 'TrSt',
+    kPOVAttrib_TraversalRays         = 'TrRa',
+    kPOVAttrib_TraversalNodes        = 'TrNo',
+    kPOVAttrib_TraversalObjects      = 'TrOb',
+
     kPOVAttrib_MinAlloc              = 'MinA',
     kPOVAttrib_MaxAlloc              = 'MaxA',
     kPOVAttrib_CallsToAlloc          = 'CTAl',
@@ -600,6 +679,11 @@ enum
     kPOVAttrib_RealTime              = 'ReaT',
     kPOVAttrib_CPUTime               = 'CPUT',
     kPOVAttrib_TimeSamples           = 'TSam',
+    kPOVAttrib_MeanRealTime          = 'MReT',
+    kPOVAttrib_CPUCycles             = 'HwCy',
+    kPOVAttrib_Instructions          = 'HwIn',
+    kPOVAttrib_CacheMisses           = 'HwCM',
+    kPOVAttrib_BranchMisses          = 'HwBM',
 
     // parser progress
     kPOVAttrib_CurrentTokenCount     = 'CTCo',
@@ -618,10 +702,13 @@ enum
     kPOVAttrib_PixelId               = 'PiId',  ///< (Int) ID of render block; only set if rendered to completion.
     kPOVAttrib_PixelSize             = 'PiSi',
     kPOVAttrib_PixelBlock            = 'PBlo',
+    kPOVAttrib_PixelBlockRef         = 'PBRe',  ///< (Long) Handle of pixel block deposited with @ref pov_base::PixelBlockExchange.
     kPOVAttrib_PixelColors           = 'PCol',
     kPOVAttrib_PixelPositions        = 'PPos',
     kPOVAttrib_PixelSkipList         = 'PSLi',
     kPOVAttrib_PixelFinal            = 'PFin',  ///< (Void) Set if pixel data is relevant for final image.
+    kPOVAttrib_PixelCosts            = 'PCos',  ///< (FloatVector) Render time, rays and shadow rays of each pixel.
+    kPOVAttrib_PixelFeatures         = 'PFea',  ///< (FloatVector) Average albedo, normal and depth of the first surfaces hit in each pixel.
 
     // scene/view error reporting and TBD
     kPOVAttrib_CurrentLine           = 'CurL',
@@ -645,6 +732,8 @@ enum
     // Rendering order
     kPOVAttrib_RenderBlockStep       = 'RBSt',
     kPOVAttrib_RenderPattern         = 'RPat',
+    kPOVAttrib_RenderNode            = 'RNod',  ///< (Int) Number of this machine among those sharing the frame, starting at 1.
+    kPOVAttrib_RenderNodes           = 'RNds',  ///< (Int) Number of machines sharing the frame.
 
     // helpers
     kPOVAttrib_StartColumn           = kPOVAttrib_Left,
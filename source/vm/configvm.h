@@ -59,9 +59,60 @@
     #define SYS_MATH_RETURN double
 #endif
 
+/// @def POV_VM_JIT
+/// Translate functions to native code.
+///
+/// Define as non-zero integer to have functions translated to native x86-64 code as they are
+/// added to the virtual machine, or zero to always use the interpreter. Functions the translator
+/// cannot handle are still run by the interpreter.
+///
+/// @note   The translator requires an x86-64 CPU, the System V calling convention, and `mmap()` to
+///         obtain executable memory. It should therefore only be enabled by system-specific
+///         configurations that know these to be available.
+///
+#ifndef POV_VM_JIT
+    #define POV_VM_JIT 0
+#endif
+
 // Function that executes functions, the parameter is the function index
 #ifndef POVFPU_Run
-    #define POVFPU_Run(ctx, fn) POVFPU_RunDefault(ctx, fn)
+    #if POV_VM_JIT
+        #define POVFPU_Run(ctx, fn) POVFPU_RunJIT(ctx, fn)
+    #else
+        #define POVFPU_Run(ctx, fn) POVFPU_RunDefault(ctx, fn)
+    #endif
+#endif
+
+/// @def POV_VM_BATCH_SIZE
+/// Maximum number of points evaluated together by the batched interpreter.
+///
+/// The batched interpreter decodes each instruction once and then applies it to all points, which
+/// the compiler can map to SIMD lanes. Values of 4 or 8 are sensible; the limit is 32.
+///
+#ifndef POV_VM_BATCH_SIZE
+    #define POV_VM_BATCH_SIZE 8
+#endif
+
+/// @def POV_VM_FUNCTION_CACHE
+/// Size of the cache of compiled functions, in bytes.
+///
+/// Compiled functions are kept in a cache shared by all parses, so that functions from include
+/// files used by many scenes, or by every frame of an animation, need not be compiled again. When
+/// the cache grows beyond this size, it is emptied. Define as zero to disable the cache.
+///
+#ifndef POV_VM_FUNCTION_CACHE
+    #define POV_VM_FUNCTION_CACHE (16*1024*1024)
+#endif
+
+/// @def POV_VM_PREALLOCATED_CONTEXTS
+/// Maximum number of function contexts set up for each render thread in advance.
+///
+/// Each render thread is given one context per function in the scene, up to this number, when
+/// it is created, so that evaluating functions (including nested function patterns) does not
+/// need to allocate memory while tracing. Further contexts are still created on demand.
+///
+#ifndef POV_VM_PREALLOCATED_CONTEXTS
+    #define POV_VM_PREALLOCATED_CONTEXTS 16
 #endif
 
 // Adjust to add system specific handling of functions like just-in-time compilation
@@ -111,6 +162,34 @@
     #define POV_VM_DEBUG POV_DEBUG
 #endif
 
+/// @def POV_VM_JIT_VERIFY
+/// Check native code translated from functions against the interpreter.
+///
+/// Define as non-zero integer to have every call to a translated function also run in the
+/// interpreter, raising an error if the results differ, or zero to disable.
+///
+/// @note   Unlike other debugging aids, this setting defaults to zero even in debug builds.
+///
+#ifndef POV_VM_JIT_VERIFY
+    #define POV_VM_JIT_VERIFY 0
+#endif
+
+/// @def POV_VM_PROFILE
+/// Gather run-time statistics on functions.
+///
+/// Define as 1 to have the calls, instructions executed and time spent counted for each function
+/// and reported with the render statistics, as 2 to also count how often each instruction is
+/// executed, or zero to disable.
+///
+/// @note   Unlike other debugging aids, this setting defaults to zero even in debug builds.
+///
+/// @note   While profiling, functions are not translated to native code, so that their
+///         instructions can be counted.
+///
+#ifndef POV_VM_PROFILE
+    #define POV_VM_PROFILE 0
+#endif
+
 /// @}
 ///
 //******************************************************************************
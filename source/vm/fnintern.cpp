@@ -78,6 +78,10 @@ namespace pov
 #define PARAM_N_Y(offset) (ptr[offset + 1])
 #define PARAM_N_Z(offset) (ptr[offset + 2])
 #define PARAM_N(index,offset) (ptr[index + offset + 3])
+#define PARAM_L_X(lane) (ptr[lane][0])
+#define PARAM_L_Y(lane) (ptr[lane][1])
+#define PARAM_L_Z(lane) (ptr[lane][2])
+#define PARAM_L(lane,index) (ptr[lane][index + 3])
 
 #define ROT2D(p,d,ang) if (p>0) {x2=sqrt(x2+PARAM_Z*PARAM_Z)- d; th=ang*M_PI_180; \
     if (th!=0){ PARAM_X= x2*cos(th)-PARAM_Y*sin(th); PARAM_Y= x2*sin(th)+PARAM_Y*cos(th);} else PARAM_X=x2; \
@@ -168,6 +172,11 @@ DBL f_noise3d(FPUContext *ctx, DBL *ptr, unsigned int fn); // 76
 DBL f_pattern(FPUContext *ctx, DBL *ptr, unsigned int fn); // 77
 DBL f_noise_generator(FPUContext *ctx, DBL *ptr, unsigned int fn); // 78
 
+void f_hetero_mf_batch(FPUContext *ctx, DBL **ptr, DBL *result, unsigned int count, unsigned int fn); // 29
+void f_ridged_mf_batch(FPUContext *ctx, DBL **ptr, DBL *result, unsigned int count, unsigned int fn); // 59
+void f_noise3d_batch(FPUContext *ctx, DBL **ptr, DBL *result, unsigned int count, unsigned int fn); // 76
+void f_noise_generator_batch(FPUContext *ctx, DBL **ptr, DBL *result, unsigned int count, unsigned int fn); // 78
+
 void f_pigment(FPUContext *ctx, DBL *ptr, unsigned int fn, unsigned int sp); // 0
 void f_transform(FPUContext *ctx, DBL *ptr, unsigned int fn, unsigned int sp); // 1
 void f_spline(FPUContext *ctx, DBL *ptr, unsigned int fn, unsigned int sp); // 2
@@ -179,86 +188,86 @@ void f_spline(FPUContext *ctx, DBL *ptr, unsigned int fn, unsigned int sp); // 2
 
 const Trap POVFPU_TrapTable[] =
 {
-    { f_algbr_cyl1,              5 + 3 }, // 0
-    { f_algbr_cyl2,              5 + 3 }, // 1
-    { f_algbr_cyl3,              5 + 3 }, // 2
-    { f_algbr_cyl4,              5 + 3 }, // 3
-    { f_bicorn,                  2 + 3 }, // 4
-    { f_bifolia,                 2 + 3 }, // 5
-    { f_blob,                    5 + 3 }, // 6
-    { f_blob2,                   4 + 3 }, // 7
-    { f_boy_surface,             2 + 3 }, // 8
-    { f_comma,                   1 + 3 }, // 9
-    { f_cross_ellipsoids,        4 + 3 }, // 10
-    { f_crossed_trough,          1 + 3 }, // 11
-    { f_cubic_saddle,            1 + 3 }, // 12
-    { f_cushion,                 1 + 3 }, // 13
-    { f_devils_curve,            1 + 3 }, // 14
-    { f_devils_curve_2d,         6 + 3 }, // 15
-    { f_dupin_cyclid,            6 + 3 }, // 16
-    { f_ellipsoid,               3 + 3 }, // 17
-    { f_enneper,                 1 + 3 }, // 18
-    { f_flange_cover,            4 + 3 }, // 19
-    { f_folium_surface,          3 + 3 }, // 20
-    { f_folium_surface_2d,       6 + 3 }, // 21
-    { f_glob,                    1 + 3 }, // 22
-    { f_heart,                   1 + 3 }, // 23
-    { f_helical_torus,          10 + 3 }, // 24
-    { f_helix1,                  7 + 3 }, // 25
-    { f_helix2,                  7 + 3 }, // 26
-    { f_hex_x,                   1 + 3 }, // 27
-    { f_hex_y,                   1 + 3 }, // 28
-    { f_hetero_mf,               6 + 3 }, // 29
-    { f_hunt_surface,            1 + 3 }, // 30
-    { f_hyperbolic_torus,        3 + 3 }, // 31
-    { f_isect_ellipsoids,        4 + 3 }, // 32
-    { f_kampyle_of_eudoxus,      3 + 3 }, // 33
-    { f_kampyle_of_eudoxus_2d,   6 + 3 }, // 34
-    { f_klein_bottle,            1 + 3 }, // 35
-    { f_kummer_surface_v1,       1 + 3 }, // 36
-    { f_kummer_surface_v2,       4 + 3 }, // 37
-    { f_lemniscate_of_gerono,    1 + 3 }, // 38
-    { f_lemniscate_of_gerono_2d, 6 + 3 }, // 39
-    { f_mesh1,                   5 + 3 }, // 40
-    { f_mitre,                   1 + 3 }, // 41
-    { f_nodal_cubic,             1 + 3 }, // 42
-    { f_odd,                     1 + 3 }, // 43
-    { f_ovals_of_cassini,        4 + 3 }, // 44
-    { f_paraboloid,              1 + 3 }, // 45
-    { f_parabolic_torus,         3 + 3 }, // 46
-    { f_ph,                      0 + 3 }, // 47
-    { f_pillow,                  1 + 3 }, // 48
-    { f_piriform,                1 + 3 }, // 49
-    { f_piriform_2d,             7 + 3 }, // 50
-    { f_poly4,                   5 + 3 }, // 51
-    { f_polytubes,               6 + 3 }, // 52
-    { f_quantum,                 1 + 3 }, // 53
-    { f_quartic_paraboloid,      1 + 3 }, // 54
-    { f_quartic_saddle,          1 + 3 }, // 55
-    { f_quartic_cylinder,        3 + 3 }, // 56
-    { f_r,                       0 + 3 }, // 57
-    { f_ridge,                   6 + 3 }, // 58
-    { f_ridged_mf,               6 + 3 }, // 59
-    { f_rounded_box,             4 + 3 }, // 60
-    { f_sphere,                  1 + 3 }, // 61
-    { f_spikes,                  5 + 3 }, // 62
-    { f_spikes_2d,               4 + 3 }, // 63
-    { f_spiral,                  6 + 3 }, // 64
-    { f_steiners_roman,          1 + 3 }, // 65
-    { f_strophoid,               4 + 3 }, // 66
-    { f_strophoid_2d,            7 + 3 }, // 67
-    { f_superellipsoid,          2 + 3 }, // 68
-    { f_th,                      0 + 3 }, // 69
-    { f_torus,                   2 + 3 }, // 70
-    { f_torus2,                  3 + 3 }, // 71
-    { f_torus_gumdrop,           1 + 3 }, // 72
-    { f_umbrella,                1 + 3 }, // 73
-    { f_witch_of_agnesi,         2 + 3 }, // 74
-    { f_witch_of_agnesi_2d,      6 + 3 }, // 75
-    { f_noise3d,                 0 + 3 }, // 76
-    { f_pattern,                 0 + 3 }, // 77
-    { f_noise_generator,         1 + 3 }, // 78
-    { nullptr, 0 }
+    { f_algbr_cyl1,              5 + 3, nullptr }, // 0
+    { f_algbr_cyl2,              5 + 3, nullptr }, // 1
+    { f_algbr_cyl3,              5 + 3, nullptr }, // 2
+    { f_algbr_cyl4,              5 + 3, nullptr }, // 3
+    { f_bicorn,                  2 + 3, nullptr }, // 4
+    { f_bifolia,                 2 + 3, nullptr }, // 5
+    { f_blob,                    5 + 3, nullptr }, // 6
+    { f_blob2,                   4 + 3, nullptr }, // 7
+    { f_boy_surface,             2 + 3, nullptr }, // 8
+    { f_comma,                   1 + 3, nullptr }, // 9
+    { f_cross_ellipsoids,        4 + 3, nullptr }, // 10
+    { f_crossed_trough,          1 + 3, nullptr }, // 11
+    { f_cubic_saddle,            1 + 3, nullptr }, // 12
+    { f_cushion,                 1 + 3, nullptr }, // 13
+    { f_devils_curve,            1 + 3, nullptr }, // 14
+    { f_devils_curve_2d,         6 + 3, nullptr }, // 15
+    { f_dupin_cyclid,            6 + 3, nullptr }, // 16
+    { f_ellipsoid,               3 + 3, nullptr }, // 17
+    { f_enneper,                 1 + 3, nullptr }, // 18
+    { f_flange_cover,            4 + 3, nullptr }, // 19
+    { f_folium_surface,          3 + 3, nullptr }, // 20
+    { f_folium_surface_2d,       6 + 3, nullptr }, // 21
+    { f_glob,                    1 + 3, nullptr }, // 22
+    { f_heart,                   1 + 3, nullptr }, // 23
+    { f_helical_torus,          10 + 3, nullptr }, // 24
+    { f_helix1,                  7 + 3, nullptr }, // 25
+    { f_helix2,                  7 + 3, nullptr }, // 26
+    { f_hex_x,                   1 + 3, nullptr }, // 27
+    { f_hex_y,                   1 + 3, nullptr }, // 28
+    { f_hetero_mf,               6 + 3, f_hetero_mf_batch }, // 29
+    { f_hunt_surface,            1 + 3, nullptr }, // 30
+    { f_hyperbolic_torus,        3 + 3, nullptr }, // 31
+    { f_isect_ellipsoids,        4 + 3, nullptr }, // 32
+    { f_kampyle_of_eudoxus,      3 + 3, nullptr }, // 33
+    { f_kampyle_of_eudoxus_2d,   6 + 3, nullptr }, // 34
+    { f_klein_bottle,            1 + 3, nullptr }, // 35
+    { f_kummer_surface_v1,       1 + 3, nullptr }, // 36
+    { f_kummer_surface_v2,       4 + 3, nullptr }, // 37
+    { f_lemniscate_of_gerono,    1 + 3, nullptr }, // 38
+    { f_lemniscate_of_gerono_2d, 6 + 3, nullptr }, // 39
+    { f_mesh1,                   5 + 3, nullptr }, // 40
+    { f_mitre,                   1 + 3, nullptr }, // 41
+    { f_nodal_cubic,             1 + 3, nullptr }, // 42
+    { f_odd,                     1 + 3, nullptr }, // 43
+    { f_ovals_of_cassini,        4 + 3, nullptr }, // 44
+    { f_paraboloid,              1 + 3, nullptr }, // 45
+    { f_parabolic_torus,         3 + 3, nullptr }, // 46
+    { f_ph,                      0 + 3, nullptr }, // 47
+    { f_pillow,                  1 + 3, nullptr }, // 48
+    { f_piriform,                1 + 3, nullptr }, // 49
+    { f_piriform_2d,             7 + 3, nullptr }, // 50
+    { f_poly4,                   5 + 3, nullptr }, // 51
+    { f_polytubes,               6 + 3, nullptr }, // 52
+    { f_quantum,                 1 + 3, nullptr }, // 53
+    { f_quartic_paraboloid,      1 + 3, nullptr }, // 54
+    { f_quartic_saddle,          1 + 3, nullptr }, // 55
+    { f_quartic_cylinder,        3 + 3, nullptr }, // 56
+    { f_r,                       0 + 3, nullptr }, // 57
+    { f_ridge,                   6 + 3, nullptr }, // 58
+    { f_ridged_mf,               6 + 3, f_ridged_mf_batch }, // 59
+    { f_rounded_box,             4 + 3, nullptr }, // 60
+    { f_sphere,                  1 + 3, nullptr }, // 61
+    { f_spikes,                  5 + 3, nullptr }, // 62
+    { f_spikes_2d,               4 + 3, nullptr }, // 63
+    { f_spiral,                  6 + 3, nullptr }, // 64
+    { f_steiners_roman,          1 + 3, nullptr }, // 65
+    { f_strophoid,               4 + 3, nullptr }, // 66
+    { f_strophoid_2d,            7 + 3, nullptr }, // 67
+    { f_superellipsoid,          2 + 3, nullptr }, // 68
+    { f_th,                      0 + 3, nullptr }, // 69
+    { f_torus,                   2 + 3, nullptr }, // 70
+    { f_torus2,                  3 + 3, nullptr }, // 71
+    { f_torus_gumdrop,           1 + 3, nullptr }, // 72
+    { f_umbrella,                1 + 3, nullptr }, // 73
+    { f_witch_of_agnesi,         2 + 3, nullptr }, // 74
+    { f_witch_of_agnesi_2d,      6 + 3, nullptr }, // 75
+    { f_noise3d,                 0 + 3, f_noise3d_batch }, // 76
+    { f_pattern,                 0 + 3, nullptr }, // 77
+    { f_noise_generator,         1 + 3, f_noise_generator_batch }, // 78
+    { nullptr, 0, nullptr }
 };
 
 const TrapS POVFPU_TrapSTable[] =
@@ -1290,4 +1299,175 @@ void f_spline(FPUContext *ctx, DBL *ptr, unsigned int fn, unsigned int sp) // 2
     }
 }
 
+
+/*****************************************************************************
+* Batched functions
+******************************************************************************/
+
+// test whether all points of a batch agree on the parameters first to last-1
+static bool f_batch_uniform(DBL **ptr, unsigned int count, unsigned int first, unsigned int last)
+{
+    for (unsigned int l = 1; l < count; l++)
+    {
+        for (unsigned int i = first; i < last; i++)
+        {
+            if (PARAM_L(l, i) != PARAM_L(0, i))
+                return false;
+        }
+    }
+    return true;
+}
+
+void f_hetero_mf_batch(FPUContext *ctx, DBL **ptr, DBL *result, unsigned int count, unsigned int fn) // 29
+{
+    Vector3d V1[POV_VM_BATCH_SIZE];
+    DBL noise[POV_VM_BATCH_SIZE];
+    DBL rem;
+    unsigned int l;
+
+    POV_ASSERT(count <= POV_VM_BATCH_SIZE);
+
+    // the octaves can only be evaluated side by side if all points agree on the parameters
+    if (!f_batch_uniform(ptr, count, 0, 6))
+    {
+        for (l = 0; l < count; l++)
+            result[l] = f_hetero_mf(ctx, ptr[l], fn);
+        return;
+    }
+
+    int ngen = (int)PARAM_L(0, 5) & 3;
+    for (l = 0; l < count; l++)
+        V1[l] = Vector3d(PARAM_L_X(l), PARAM_L_Y(l), PARAM_L_Z(l));
+
+    MultiNoise(noise, V1, count, ngen);
+    for (l = 0; l < count; l++)
+    {
+        result[l] = (noise[l]*2.0 - 1.0) + PARAM_L(0, 3);
+        V1[l] *= PARAM_L(0, 1);
+    }
+
+    DBL p1_2_mp0 = pow(PARAM_L(0, 1), -PARAM_L(0, 0)), ea = p1_2_mp0;
+    for (int i = 1; i < PARAM_L(0, 2); i++)
+    {
+        MultiNoise(noise, V1, count, ngen);
+        for (l = 0; l < count; l++)
+        {
+            DBL inc = ((noise[l]*2.0 - 1.0) + PARAM_L(0, 3)) * ea;
+
+            for (int p = (int) PARAM_L(0, 4); p > 0; --p)
+                inc *= result[l];
+
+            result[l] += inc;
+            V1[l] *= PARAM_L(0, 1);
+        }
+        ea *= p1_2_mp0;
+    }
+
+    rem = PARAM_L(0, 2) - (int) PARAM_L(0, 2);
+    if(rem != 0.0)
+    {
+        MultiNoise(noise, V1, count, ngen);
+        for (l = 0; l < count; l++)
+        {
+            DBL inc = ((noise[l]*2.0 - 1.0) + PARAM_L(0, 3)) * ea;
+            result[l] += rem * inc * result[l];
+        }
+    }
+}
+
+void f_ridged_mf_batch(FPUContext *ctx, DBL **ptr, DBL *result, unsigned int count, unsigned int fn) // 59
+{
+    FunctionCode *f = ctx->functionvm->GetFunction(fn);
+    Vector3d V1[POV_VM_BATCH_SIZE];
+    DBL noise[POV_VM_BATCH_SIZE];
+    DBL signal[POV_VM_BATCH_SIZE];
+    DBL *ea,weight,s;
+    unsigned int l;
+    int i;
+
+    POV_ASSERT(count <= POV_VM_BATCH_SIZE);
+
+    // the exponent array is set up by the first call to the scalar version
+    if ((f->private_data == nullptr) || !f_batch_uniform(ptr, count, 0, 6))
+    {
+        for (l = 0; l < count; l++)
+            result[l] = f_ridged_mf(ctx, ptr[l], fn);
+        return;
+    }
+
+    ea = reinterpret_cast<DBL *>(f->private_data);
+    int ngen = (int)PARAM_L(0, 5) & 0x03;
+    for (l = 0; l < count; l++)
+        V1[l] = Vector3d(PARAM_L_X(l), PARAM_L_Y(l), PARAM_L_Z(l));
+
+    MultiNoise(noise, V1, count, ngen);
+    for (l = 0; l < count; l++)
+    {
+        s = noise[l]*2.0-1.0;
+        if (s < 0.0 )
+            s = -s;
+        s = PARAM_L(0, 3) - s;
+        s *= s;
+        signal[l] = s;
+        result[l] = s;
+    }
+
+    for (i=1; i<PARAM_L(0, 2); i++)
+    {
+        for (l = 0; l < count; l++)
+            V1[l] *= PARAM_L(0, 1);
+
+        MultiNoise(noise, V1, count, ngen);
+        for (l = 0; l < count; l++)
+        {
+            weight = signal[l] * PARAM_L(0, 4);
+            if (weight > 1.0)
+                weight = 1.0;
+            if (weight < 0.0)
+                weight = 0.0;
+            s = noise[l]*2.0-1.0;
+            if (s < 0.0 )
+                s = -s;
+            s = PARAM_L(0, 3) - s;
+            s *= s;
+            s *= weight;
+            signal[l] = s;
+            result[l] += s * ea[i];
+        }
+    }
+}
+
+void f_noise3d_batch(FPUContext *ctx, DBL **ptr, DBL *result, unsigned int count, unsigned int) // 76
+{
+    Vector3d Vec[POV_VM_BATCH_SIZE];
+
+    POV_ASSERT(count <= POV_VM_BATCH_SIZE);
+
+    for (unsigned int l = 0; l < count; l++)
+        Vec[l] = Vector3d(PARAM_L_X(l), PARAM_L_Y(l), PARAM_L_Z(l));
+
+    MultiNoise(result, Vec, count, ctx->threaddata->GetSceneData()->noiseGenerator);
+}
+
+void f_noise_generator_batch(FPUContext *ctx, DBL **ptr, DBL *result, unsigned int count, unsigned int) // 78
+{
+    Vector3d Vec[POV_VM_BATCH_SIZE];
+    unsigned int first, n;
+
+    POV_ASSERT(count <= POV_VM_BATCH_SIZE);
+
+    for (unsigned int l = 0; l < count; l++)
+        Vec[l] = Vector3d(PARAM_L_X(l), PARAM_L_Y(l), PARAM_L_Z(l));
+
+    // submit runs of points using the same generator together
+    for (first = 0; first < count; first += n)
+    {
+        int ngen = (int)PARAM_L(first, 0) & 0x03;
+
+        for (n = 1; (first + n < count) && (((int)PARAM_L(first + n, 0) & 0x03) == ngen); n++) { }
+
+        MultiNoise(&result[first], &Vec[first], n, ngen);
+    }
+}
+
 }
@@ -52,6 +52,9 @@ typedef struct
 {
     DBL (*fn)(FPUContext *ctx, DBL *ptr, unsigned int fn);
     unsigned int parameter_cnt;
+    /// Optional entry point evaluating the function at several points of the batched
+    /// interpreter at once, given one parameter pointer per point; `nullptr` if none.
+    void (*batchfn)(FPUContext *ctx, DBL **ptr, DBL *result, unsigned int count, unsigned int fn);
 } Trap;
 
 typedef struct
@@ -0,0 +1,945 @@
+//******************************************************************************
+///
+/// @file vm/fnjit.cpp
+///
+/// This module implements the translation of render-time functions to native
+/// x86-64 code.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+/**
+
+@file
+@par Native Code Layout
+
+Each function is translated as a whole when it is added to the virtual machine,
+into code following the System V calling convention:
+
+    int code(FunctionJITFrame *frame, unsigned int sp, DBL *result);
+
+The virtual machine's state is kept in registers as follows:
+
+    R0 - R7     xmm0 - xmm7
+    CC          r15d, encoded as in the interpreter (1 = eq, 2 = lt, 0 = gt)
+    SP          r12d
+    frame       rbx
+    result      r14
+    local(0)    r13, i.e. the address of the stack element at SP
+
+xmm8, rax, rcx and rdx are used as scratch registers. Registers R0 - R7 are
+spilled to the native stack frame around calls to C functions, which also
+serve as the only way for exceptions to be raised: Such calls go through
+thunks catching any exception and storing it in the frame, upon which the
+native code returns immediately with a non-zero value.
+
+Calls to other functions are made directly to their native code, so only
+functions whose callees have all been translated can be translated
+themselves. Unlike in the interpreter, the callee starts out with cleared
+registers and CC, and the caller's registers other than R0 and its CC are
+preserved across the call; as the function compiler reloads all registers
+it needs after a call, this makes no difference to compiled functions.
+The jsr instruction and global variables are not supported, as the function
+compiler never emits them.
+
+*/
+
+// Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
+#include "vm/fnjit.h"
+
+#if POV_VM_JIT
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include <sys/mman.h>
+
+#include "core/scene/tracethreaddata.h"
+
+#include "vm/fnintern.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov
+{
+
+static_assert(std::is_same<DBL, double>::value &&
+              std::is_same<SYS_MATH_PARAM, double>::value &&
+              std::is_same<SYS_MATH_RETURN, double>::value,
+              "Function translation requires double precision floating-point values.");
+
+#ifndef MAP_ANONYMOUS
+    #define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/*****************************************************************************
+* Local preprocessor defines
+******************************************************************************/
+
+// general purpose registers
+#define RAX 0
+#define RCX 1
+#define RDX 2
+#define RBX 3
+#define RSP 4
+#define RSI 6
+#define RDI 7
+#define R8  8
+#define R12 12
+#define R13 13
+#define R14 14
+#define R15 15
+
+// scratch SSE register; xmm0 - xmm7 hold R0 - R7
+#define XTMP 8
+
+// condition codes
+#define CC_B  0x2
+#define CC_AE 0x3
+#define CC_E  0x4
+#define CC_NE 0x5
+#define CC_BE 0x6
+#define CC_A  0x7
+#define CC_P  0xA
+#define CC_NP 0xB
+
+// extended opcodes of the immediate group 1 instructions
+#define ALU_ADD 0
+#define ALU_SUB 5
+#define ALU_CMP 7
+
+// native stack frame, above the saved registers
+#define FRAME_SPILL  0  // R0 - R7
+#define FRAME_RESULT 64 // result of calls
+#define FRAME_SIZE   80 // keeps the stack 16-byte aligned
+
+#define SIGN_MASK ((POV_UINT64)0x8000000000000000ull)
+
+/*****************************************************************************
+* Local typedefs
+******************************************************************************/
+
+/// Minimal x86-64 code emitter, covering the instructions the translator needs.
+class JITAssembler
+{
+    public:
+
+        /// @param[in]  labels  Number of labels to reserve, typically one per instruction.
+        JITAssembler(size_t labels) : labelOffset(labels, -1) {}
+
+        int NewLabel()
+        {
+            labelOffset.push_back(-1);
+            return int(labelOffset.size() - 1);
+        }
+
+        void Bind(int label) { labelOffset[label] = (long)code.size(); }
+
+        void Byte(unsigned int b) { code.push_back((unsigned char)b); }
+
+        void Dword(POV_UINT32 d)
+        {
+            for (int i = 0; i < 4; i++)
+                Byte((d >> (i * 8)) & 0xFF);
+        }
+
+        void Qword(POV_UINT64 q)
+        {
+            for (int i = 0; i < 8; i++)
+                Byte((unsigned int)(q >> (i * 8)) & 0xFF);
+        }
+
+        void Rex(bool w, int reg, int index, int base)
+        {
+            unsigned int rex = 0x40 | (w ? 0x08 : 0) | ((reg & 8) ? 0x04 : 0) | ((index & 8) ? 0x02 : 0) | ((base & 8) ? 0x01 : 0);
+            if (rex != 0x40)
+                Byte(rex);
+        }
+
+        void ModRMReg(int reg, int rm) { Byte(0xC0 | ((reg & 7) << 3) | (rm & 7)); }
+
+        /// Memory operand `[base + disp]`, always using a 32-bit displacement.
+        void ModRMMem(int reg, int base, int disp)
+        {
+            Byte(0x80 | ((reg & 7) << 3) | (base & 7));
+            if ((base & 7) == RSP)
+                Byte(0x24);
+            Dword((POV_UINT32)disp);
+        }
+
+        void GprRR(bool w, unsigned int opcode, int reg, int rm)
+        {
+            Rex(w, reg, 0, rm);
+            Byte(opcode);
+            ModRMReg(reg, rm);
+        }
+
+        void GprRM(bool w, unsigned int opcode, int reg, int base, int disp)
+        {
+            Rex(w, reg, 0, base);
+            Byte(opcode);
+            ModRMMem(reg, base, disp);
+        }
+
+        /// `lea reg, [base + index * (1 << scale)]`; base must not be rbp or r13.
+        void LeaIndex(bool w, int reg, int base, int index, int scale)
+        {
+            Rex(w, reg, index, base);
+            Byte(0x8D);
+            Byte(0x04 | ((reg & 7) << 3));
+            Byte((scale << 6) | ((index & 7) << 3) | (base & 7));
+        }
+
+        void AluImm(bool w, int ext, int reg, POV_UINT32 imm)
+        {
+            Rex(w, 0, 0, reg);
+            Byte(0x81);
+            ModRMReg(ext, reg);
+            Dword(imm);
+        }
+
+        void MovImm32(int reg, POV_UINT32 imm)
+        {
+            Rex(false, 0, 0, reg);
+            Byte(0xB8 | (reg & 7));
+            Dword(imm);
+        }
+
+        void MovImm64(int reg, POV_UINT64 imm)
+        {
+            Rex(true, 0, 0, reg);
+            Byte(0xB8 | (reg & 7));
+            Qword(imm);
+        }
+
+        void Push(int reg) { Rex(false, 0, 0, reg); Byte(0x50 | (reg & 7)); }
+        void Pop(int reg)  { Rex(false, 0, 0, reg); Byte(0x58 | (reg & 7)); }
+
+        /// `setcc` into one of al, cl or dl.
+        void Setcc(int cc, int reg) { Byte(0x0F); Byte(0x90 | cc); ModRMReg(0, reg); }
+
+        /// `movzx reg32, reg8` for one of al, cl or dl.
+        void Movzx(int reg, int rm) { Byte(0x0F); Byte(0xB6); ModRMReg(reg, rm); }
+
+        void SseRR(unsigned int prefix, unsigned int opcode, int reg, int rm)
+        {
+            Byte(prefix);
+            Rex(false, reg, 0, rm);
+            Byte(0x0F);
+            Byte(opcode);
+            ModRMReg(reg, rm);
+        }
+
+        void SseRM(unsigned int prefix, unsigned int opcode, int reg, int base, int disp)
+        {
+            Byte(prefix);
+            Rex(false, reg, 0, base);
+            Byte(0x0F);
+            Byte(opcode);
+            ModRMMem(reg, base, disp);
+        }
+
+        /// SSE instruction with a 64-bit constant from the literal pool as source operand.
+        void SseRConst(unsigned int prefix, unsigned int opcode, int reg, POV_UINT64 value)
+        {
+            Byte(prefix);
+            Rex(false, reg, 0, 0);
+            Byte(0x0F);
+            Byte(opcode);
+            Byte(0x05 | ((reg & 7) << 3)); // [rip + disp32]
+            ConstFixup fixup = { code.size(), Constant(value) };
+            constFixups.push_back(fixup);
+            Dword(0);
+        }
+
+        template<typename T> void Call(T function)
+        {
+            MovImm64(RAX, (POV_UINT64)reinterpret_cast<size_t>(function));
+            Byte(0xFF);
+            Byte(0xD0);
+        }
+
+        void Jump(int label) { Byte(0xE9); LabelRef(label); }
+        void JumpIf(int cc, int label) { Byte(0x0F); Byte(0x80 | cc); LabelRef(label); }
+
+        /// Resolve all references and append the literal pool.
+        void Finish()
+        {
+            for (vector<LabelFixup>::const_iterator i = labelFixups.begin(); i != labelFixups.end(); ++i)
+            {
+                POV_VM_ASSERT(labelOffset[i->label] >= 0);
+                Patch(i->position, labelOffset[i->label] - long(i->position + 4));
+            }
+            while ((code.size() % 8) != 0)
+                Byte(0xCC);
+            size_t pool = code.size();
+            for (vector<POV_UINT64>::const_iterator i = constants.begin(); i != constants.end(); ++i)
+                Qword(*i);
+            for (vector<ConstFixup>::const_iterator i = constFixups.begin(); i != constFixups.end(); ++i)
+                Patch(i->position, long(pool + i->index * 8) - long(i->position + 4));
+        }
+
+        vector<unsigned char> code;
+
+    private:
+
+        struct LabelFixup
+        {
+            size_t position;
+            int label;
+        };
+
+        struct ConstFixup
+        {
+            size_t position;
+            size_t index;
+        };
+
+        vector<long> labelOffset;
+        vector<LabelFixup> labelFixups;
+        vector<POV_UINT64> constants;
+        vector<ConstFixup> constFixups;
+
+        void LabelRef(int label)
+        {
+            LabelFixup fixup = { code.size(), label };
+            labelFixups.push_back(fixup);
+            Dword(0);
+        }
+
+        size_t Constant(POV_UINT64 value)
+        {
+            for (size_t i = 0; i < constants.size(); i++)
+                if (constants[i] == value)
+                    return i;
+            constants.push_back(value);
+            return constants.size() - 1;
+        }
+
+        void Patch(size_t position, long rel)
+        {
+            POV_UINT32 d = (POV_UINT32)rel;
+            for (int i = 0; i < 4; i++)
+                code[position + i] = (unsigned char)((d >> (i * 8)) & 0xFF);
+        }
+};
+
+/*****************************************************************************
+* Local functions
+******************************************************************************/
+
+// The following functions are called from native code. Any exception must be
+// caught here, as it cannot be propagated through the native stack frames.
+
+static int JIT_Exception(FunctionJITFrame *frame, FUNCTION fn, const char *msg)
+{
+    try
+    {
+        POVFPU_Exception(frame->context, fn, msg);
+    }
+    catch (...)
+    {
+        *frame->exception = std::current_exception();
+        return 1;
+    }
+    return 0;
+}
+
+static int JIT_Trap(FunctionJITFrame *frame, unsigned int sp, FUNCTION fn, unsigned int k, DBL *result)
+{
+    try
+    {
+        *result = POVFPU_TrapTable[k].fn(frame->context, &((*frame->dblstack)[sp]), fn);
+    }
+    catch (...)
+    {
+        *frame->exception = std::current_exception();
+        return 1;
+    }
+    return 0;
+}
+
+static int JIT_TrapS(FunctionJITFrame *frame, unsigned int sp, FUNCTION fn, unsigned int k)
+{
+    try
+    {
+        POVFPU_TrapSTable[k].fn(frame->context, &((*frame->dblstack)[sp]), fn, sp);
+    }
+    catch (...)
+    {
+        *frame->exception = std::current_exception();
+        return 1;
+    }
+    return 0;
+}
+
+static int JIT_Grow(FunctionJITFrame *frame, unsigned int sp, FUNCTION fn, unsigned int k)
+{
+    FPUContext *context = frame->context;
+
+    try
+    {
+        if((unsigned int)(sp + k) >= (unsigned int)MAX_K)
+        {
+            POVFPU_Exception(context, fn, "Stack full. Possible infinite recursive function call.");
+        }
+        else if(sp + k >= context->maxdblstacksize)
+        {
+            unsigned int newsize = context->maxdblstacksize + max(k + 1, (unsigned int)INITIAL_DBL_STACK_SIZE);
+            context->dblstackbase = context->ResizeStack(context->dblstackbase, context->maxdblstacksize, newsize);
+            context->maxdblstacksize = newsize;
+        }
+    }
+    catch (...)
+    {
+        *frame->exception = std::current_exception();
+        return 1;
+    }
+    return 0;
+}
+
+static SYS_MATH_RETURN JIT_Mod(SYS_MATH_PARAM r0, SYS_MATH_PARAM r1)
+{
+    return fmod(r0, r1);
+}
+
+static POV_UINT64 JIT_Bits(DBL value)
+{
+    POV_UINT64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static void JIT_SaveRegisters(JITAssembler& a, int first)
+{
+    for (int r = first; r < 8; r++)
+        a.SseRM(0xF2, 0x11, r, RSP, FRAME_SPILL + r * 8);   // movsd [rsp+r*8], xmm<r>
+}
+
+static void JIT_RestoreRegisters(JITAssembler& a, int first)
+{
+    for (int r = first; r < 8; r++)
+        a.SseRM(0xF2, 0x10, r, RSP, FRAME_SPILL + r * 8);   // movsd xmm<r>, [rsp+r*8]
+}
+
+/// Point r13 at the stack element at SP, after SP or the stack base may have changed.
+static void JIT_ReloadStack(JITAssembler& a)
+{
+    a.GprRM(true, 0x8B, RAX, RBX, offsetof(FunctionJITFrame, dblstack));   // mov rax, [rbx+dblstack]
+    a.GprRM(true, 0x8B, RAX, RAX, 0);                                       // mov rax, [rax]
+    a.LeaIndex(true, R13, RAX, R12, 3);                                     // lea r13, [rax+r12*8]
+}
+
+/// Return immediately if a thunk reported an exception.
+static void JIT_CheckStatus(JITAssembler& a, int abort)
+{
+    a.Byte(0x85);                                                           // test eax, eax
+    a.ModRMReg(RAX, RAX);
+    a.JumpIf(CC_NE, abort);
+}
+
+static void JIT_RaiseException(JITAssembler& a, FUNCTION fn, const char *msg, int abort)
+{
+    JIT_SaveRegisters(a, 0);
+    a.GprRR(true, 0x89, RBX, RDI);                                          // mov rdi, rbx
+    a.MovImm32(RSI, fn);
+    a.MovImm64(RDX, (POV_UINT64)reinterpret_cast<size_t>(msg));
+    a.Call(JIT_Exception);
+    JIT_CheckStatus(a, abort);
+    JIT_RestoreRegisters(a, 0);
+}
+
+/// Compute CC from the flags set by `ucomisd Rs, Rd`.
+static void JIT_SetCC(JITAssembler& a)
+{
+    a.Setcc(CC_A, RAX);                                                     // Rs > Rd
+    a.Setcc(CC_E, RCX);
+    a.Setcc(CC_NP, RDX);
+    a.Byte(0x20);                                                           // and cl, dl
+    a.ModRMReg(RDX, RCX);
+    a.Movzx(RAX, RAX);
+    a.Movzx(RCX, RCX);
+    a.LeaIndex(false, R15, RCX, RAX, 1);                                    // lea r15d, [rcx+rax*2]
+}
+
+/// Compare CC as needed by the set and branch instructions.
+/// @return     Condition code that is set if the condition holds.
+static int JIT_TestCC(JITAssembler& a, unsigned int cond)
+{
+    static const POV_UINT32 value[6]    = { 1,    1,     2,    1,     0,    1     };
+    static const int        cc[6]       = { CC_E, CC_NE, CC_E, CC_AE, CC_E, CC_BE };
+
+    a.AluImm(false, ALU_CMP, R15, value[cond]);
+    return cc[cond];
+}
+
+static void JIT_BoolToRegister(JITAssembler& a, int d)
+{
+    a.Movzx(RAX, RAX);
+    a.SseRR(0xF2, 0x2A, d, RAX);                                            // cvtsi2sd xmm<d>, eax
+}
+
+/// Rd = fmod(Rd, Rs), or Rd = fmod(Rd, const) if `s` is negative.
+static void JIT_EmitMod(JITAssembler& a, int d, int s, DBL c)
+{
+    JIT_SaveRegisters(a, 0);
+    a.SseRM(0xF2, 0x10, 0, RSP, FRAME_SPILL + d * 8);
+    if (s >= 0)
+        a.SseRM(0xF2, 0x10, 1, RSP, FRAME_SPILL + s * 8);
+    else
+        a.SseRConst(0xF2, 0x10, 1, JIT_Bits(c));
+    a.Call(JIT_Mod);
+    a.SseRM(0xF2, 0x11, 0, RSP, FRAME_SPILL + d * 8);
+    JIT_RestoreRegisters(a, 0);
+}
+
+static bool JIT_Translate(JITAssembler& a, const FunctionCode& f, FUNCTION fn, const vector<DBL>& consts, const vector<FunctionEntry>& functions)
+{
+    static const unsigned int sseMathOp[4] = { 0x58, 0x5C, 0x59, 0x5E };   // addsd, subsd, mulsd, divsd
+
+    const unsigned int size = f.program_size;
+    const int done = a.NewLabel();
+    const int leave = a.NewLabel();
+    const int abort = a.NewLabel();
+
+    // prologue
+    a.Push(RBX);
+    a.Push(R12);
+    a.Push(R13);
+    a.Push(R14);
+    a.Push(R15);
+    a.AluImm(true, ALU_SUB, RSP, FRAME_SIZE);
+    a.GprRR(true, 0x89, RDI, RBX);                                          // mov rbx, rdi
+    a.GprRR(false, 0x89, RSI, R12);                                         // mov r12d, esi
+    a.GprRR(true, 0x89, RDX, R14);                                          // mov r14, rdx
+    JIT_ReloadStack(a);
+    a.GprRR(false, 0x31, R15, R15);                                         // xor r15d, r15d
+    for (int r = 0; r < 8; r++)
+        a.SseRR(0x66, 0x57, r, r);                                          // xorpd xmm<r>, xmm<r>
+
+    for (unsigned int pc = 0; pc < size; pc++)
+    {
+        const unsigned int op = GET_OP(f.program[pc]);
+        const unsigned int k = GET_K(f.program[pc]);
+        const int i = op >> 6;
+        const int s = (op >> 3) & 7;
+        const int d = op & 7;
+
+        a.Bind(pc);
+
+        switch (i)
+        {
+            case 0:                                     // add   Rs, Rd
+            case 1:                                     // sub   Rs, Rd
+            case 2:                                     // mul   Rs, Rd
+            case 3:                                     // div   Rs, Rd
+                a.SseRR(0xF2, sseMathOp[i], d, s);
+                break;
+            case 4:                                     // mod   Rs, Rd
+                JIT_EmitMod(a, d, s, 0.0);
+                break;
+            case 5:                                     // move  Rs, Rd
+                if (s != d)
+                    a.SseRR(0x66, 0x28, d, s);          // movapd
+                break;
+            case 6:                                     // cmp   Rs, Rd
+                a.SseRR(0x66, 0x2E, s, d);              // ucomisd
+                JIT_SetCC(a);
+                break;
+            case 7:                                     // neg   Rs, Rd
+            case 8:                                     // abs   Rs, Rd
+                if (s != d)
+                    a.SseRR(0x66, 0x28, d, s);
+                a.SseRConst(0xF2, 0x10, XTMP, (i == 7) ? SIGN_MASK : ~SIGN_MASK);
+                a.SseRR(0x66, (i == 7) ? 0x57 : 0x54, d, XTMP); // xorpd or andpd
+                break;
+            case 9:
+                if ((s <= 6) && (k >= consts.size()))
+                    return false;
+                switch (s)
+                {
+                    case 0:                             // addi  k, Rd
+                    case 1:                             // subi  k, Rd
+                    case 2:                             // muli  k, Rd
+                    case 3:                             // divi  k, Rd
+                        a.SseRConst(0xF2, sseMathOp[s], d, JIT_Bits(consts[k]));
+                        break;
+                    case 4:                             // modi  k, Rd
+                        JIT_EmitMod(a, d, -1, consts[k]);
+                        break;
+                    case 5:                             // loadi k, Rd
+                        a.SseRConst(0xF2, 0x10, d, JIT_Bits(consts[k]));
+                        break;
+                    case 6:                             // cmpi  k, Rd
+                        a.SseRConst(0xF2, 0x10, XTMP, JIT_Bits(consts[k]));
+                        a.SseRR(0x66, 0x2E, XTMP, d);
+                        JIT_SetCC(a);
+                        break;
+                }
+                break;
+            case 10:
+                if (s <= 5)                             // seq, sne, slt, sle, sgt, sge   Rd
+                    a.Setcc(JIT_TestCC(a, s), RAX);
+                else
+                {
+                    a.SseRR(0x66, 0x57, XTMP, XTMP);
+                    a.SseRR(0x66, 0x2E, d, XTMP);
+                    if (s == 6)                         // teq   Rd
+                    {
+                        a.Setcc(CC_E, RAX);
+                        a.Setcc(CC_NP, RCX);
+                        a.Byte(0x20);                   // and al, cl
+                    }
+                    else                                // tne   Rd
+                    {
+                        a.Setcc(CC_NE, RAX);
+                        a.Setcc(CC_P, RCX);
+                        a.Byte(0x08);                   // or al, cl
+                    }
+                    a.ModRMReg(RCX, RAX);
+                }
+                JIT_BoolToRegister(a, d);
+                break;
+            case 11:
+                if (s == 0)                             // load  0(k), Rd
+                    return false;
+                if (s == 1)                             // load  SP(k), Rd
+                    a.SseRM(0xF2, 0x10, d, R13, k * 8);
+                break;
+            case 12:
+                if (s == 0)                             // store Rs, 0(k)
+                    return false;
+                if (s == 1)                             // store Rs, SP(k)
+                    a.SseRM(0xF2, 0x11, d, R13, k * 8);
+                break;
+            case 13:                                    // beq, bne, blt, ble, bgt, bge   k
+                if ((s <= 5) && (d == 0))
+                {
+                    if (k >= size)
+                        return false;
+                    a.JumpIf(JIT_TestCC(a, s), k);
+                }
+                break;
+            case 14:
+                if (s <= 6)
+                {
+                    const int raise = a.NewLabel();
+                    const int next = a.NewLabel();
+
+                    a.SseRR(0x66, 0x57, XTMP, XTMP);
+                    switch (s)
+                    {
+                        case 0:                         // xeq   Rs
+                            a.SseRR(0x66, 0x2E, d, XTMP);
+                            a.JumpIf(CC_P, next);
+                            a.JumpIf(CC_E, raise);
+                            break;
+                        case 1:                         // xne   Rs
+                            a.SseRR(0x66, 0x2E, d, XTMP);
+                            a.JumpIf(CC_P, raise);
+                            a.JumpIf(CC_NE, raise);
+                            break;
+                        case 2:                         // xlt   Rs
+                            a.SseRR(0x66, 0x2E, XTMP, d);
+                            a.JumpIf(CC_A, raise);
+                            break;
+                        case 3:                         // xle   Rs
+                            a.SseRR(0x66, 0x2E, XTMP, d);
+                            a.JumpIf(CC_AE, raise);
+                            break;
+                        case 4:                         // xgt   Rs
+                            a.SseRR(0x66, 0x2E, d, XTMP);
+                            a.JumpIf(CC_A, raise);
+                            break;
+                        case 5:                         // xge   Rs
+                            a.SseRR(0x66, 0x2E, d, XTMP);
+                            a.JumpIf(CC_AE, raise);
+                            break;
+                        case 6:                         // xdz   R0, Rs
+                            a.SseRR(0x66, 0x2E, 0, XTMP);
+                            a.JumpIf(CC_P, next);
+                            a.JumpIf(CC_NE, next);
+                            a.SseRR(0x66, 0x2E, d, XTMP);
+                            a.JumpIf(CC_P, next);
+                            a.JumpIf(CC_E, raise);
+                            break;
+                    }
+                    a.Jump(next);
+                    a.Bind(raise);
+                    JIT_RaiseException(a, fn, nullptr, abort);
+                    a.Bind(next);
+                }
+                break;
+            case 15:
+                switch ((s << 3) | d)
+                {
+                    case 0:                             // jsr   k
+                        return false;
+                    case 1:                             // jmp   k
+                        if (k >= size)
+                            return false;
+                        a.Jump(k);
+                        break;
+                    case 2:                             // rts
+                        a.Jump(done);
+                        break;
+                    case 3:                             // call  k
+                        if ((k == fn) || (k >= functions.size()) ||
+                            (functions[k].reference_count == 0) || (functions[k].jit.code == nullptr))
+                            return false;
+                        JIT_SaveRegisters(a, 1);
+                        a.GprRR(true, 0x89, RBX, RDI);              // mov rdi, rbx
+                        a.GprRR(false, 0x89, R12, RSI);             // mov esi, r12d
+                        a.GprRM(true, 0x8D, RDX, RSP, FRAME_RESULT);// lea rdx, [rsp+result]
+                        a.Call(functions[k].jit.code);
+                        JIT_CheckStatus(a, abort);
+                        JIT_RestoreRegisters(a, 1);
+                        a.SseRM(0xF2, 0x10, 0, RSP, FRAME_RESULT);
+                        JIT_ReloadStack(a);
+                        break;
+                    case 4:                             // sys1  k
+                    case 5:                             // sys2  k
+                        if (k >= ((d == 4) ? POVFPU_Sys1TableSize : POVFPU_Sys2TableSize))
+                            return false;
+                        JIT_SaveRegisters(a, 1);
+                        if (d == 4)
+                            a.Call(POVFPU_Sys1Table[k]);
+                        else
+                            a.Call(POVFPU_Sys2Table[k]);
+                        JIT_RestoreRegisters(a, 1);
+                        break;
+                    case 6:                             // trap  k
+                    case 7:                             // traps k
+                        if (k >= ((d == 6) ? POVFPU_TrapTableSize : POVFPU_TrapSTableSize))
+                            return false;
+                        JIT_SaveRegisters(a, 0);
+                        a.GprRR(true, 0x89, RBX, RDI);              // mov rdi, rbx
+                        a.GprRR(false, 0x89, R12, RSI);             // mov esi, r12d
+                        a.MovImm32(RDX, fn);
+                        a.MovImm32(RCX, k);
+                        if (d == 6)
+                        {
+                            a.GprRM(true, 0x8D, R8, RSP, FRAME_RESULT); // lea r8, [rsp+result]
+                            a.Call(JIT_Trap);
+                        }
+                        else
+                            a.Call(JIT_TrapS);
+                        JIT_CheckStatus(a, abort);
+                        JIT_RestoreRegisters(a, 0);
+                        if (d == 6)
+                            a.SseRM(0xF2, 0x10, 0, RSP, FRAME_RESULT);
+                        JIT_ReloadStack(a);
+                        break;
+                    case 8:                             // grow  k
+                    {
+                        const int slow = a.NewLabel();
+                        const int next = a.NewLabel();
+
+                        a.GprRM(false, 0x8D, RAX, R12, k);          // lea eax, [r12+k]
+                        a.AluImm(false, ALU_CMP, RAX, MAX_K);
+                        a.JumpIf(CC_AE, slow);
+                        a.GprRM(true, 0x8B, RCX, RBX, offsetof(FunctionJITFrame, maxdblstacksize));
+                        a.GprRM(false, 0x3B, RAX, RCX, 0);          // cmp eax, [rcx]
+                        a.JumpIf(CC_B, next);
+                        a.Bind(slow);
+                        JIT_SaveRegisters(a, 0);
+                        a.GprRR(true, 0x89, RBX, RDI);
+                        a.GprRR(false, 0x89, R12, RSI);
+                        a.MovImm32(RDX, fn);
+                        a.MovImm32(RCX, k);
+                        a.Call(JIT_Grow);
+                        JIT_CheckStatus(a, abort);
+                        JIT_RestoreRegisters(a, 0);
+                        JIT_ReloadStack(a);
+                        a.Bind(next);
+                        break;
+                    }
+                    case 9:                             // push  k
+                    {
+                        const int next = a.NewLabel();
+
+                        a.GprRM(false, 0x8D, RAX, R12, k);
+                        a.GprRM(true, 0x8B, RCX, RBX, offsetof(FunctionJITFrame, maxdblstacksize));
+                        a.GprRM(false, 0x3B, RAX, RCX, 0);
+                        a.JumpIf(CC_B, next);
+                        JIT_RaiseException(a, fn, "Function evaluation stack overflow.", abort);
+                        a.Bind(next);
+                        a.AluImm(false, ALU_ADD, R12, k);
+                        JIT_ReloadStack(a);
+                        break;
+                    }
+                    case 10:                            // pop   k
+                    {
+                        const int next = a.NewLabel();
+
+                        a.AluImm(false, ALU_CMP, R12, k);
+                        a.JumpIf(CC_AE, next);
+                        JIT_RaiseException(a, fn, "Function evaluation stack underflow.", abort);
+                        a.Bind(next);
+                        a.AluImm(false, ALU_SUB, R12, k);
+                        JIT_ReloadStack(a);
+                        break;
+                    }
+                    default:                            // nop
+                        break;
+                }
+                break;
+            default:                                    // nop
+                break;
+        }
+    }
+
+    // epilogue
+    a.Bind(done);
+    a.SseRM(0xF2, 0x11, 0, R14, 0);                                         // movsd [r14], xmm0
+    a.GprRR(false, 0x31, RAX, RAX);                                         // xor eax, eax
+    a.Bind(leave);
+    a.AluImm(true, ALU_ADD, RSP, FRAME_SIZE);
+    a.Pop(R15);
+    a.Pop(R14);
+    a.Pop(R13);
+    a.Pop(R12);
+    a.Pop(RBX);
+    a.Byte(0xC3);                                                           // ret
+    a.Bind(abort);
+    a.MovImm32(RAX, 1);
+    a.Jump(leave);
+
+    a.Finish();
+    return true;
+}
+
+/*****************************************************************************/
+
+bool POVFPU_JITCompile(FunctionEntry& entry, FUNCTION fn, const vector<DBL>& consts, const vector<FunctionEntry>& functions)
+{
+    entry.jit.code = nullptr;
+    entry.jit.memory = nullptr;
+    entry.jit.size = 0;
+
+    // while profiling, leave functions to the interpreter so that their instructions can be counted
+    if ((entry.fn.program == nullptr) || (entry.fn.program_size == 0) || POV_VM_PROFILE)
+        return false;
+
+    JITAssembler a(entry.fn.program_size);
+    if (!JIT_Translate(a, entry.fn, fn, consts, functions))
+        return false;
+
+    void *memory = mmap(nullptr, a.code.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+        return false;
+    memcpy(memory, &a.code[0], a.code.size());
+    if (mprotect(memory, a.code.size(), PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(memory, a.code.size());
+        return false;
+    }
+
+    entry.jit.code = reinterpret_cast<FunctionJITCode>(memory);
+    entry.jit.memory = memory;
+    entry.jit.size = a.code.size();
+    return true;
+}
+
+void POVFPU_JITDelete(FunctionJIT& jit)
+{
+    if (jit.memory != nullptr)
+        munmap(jit.memory, jit.size);
+    jit.code = nullptr;
+    jit.memory = nullptr;
+    jit.size = 0;
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_RunJIT
+*
+* INPUT
+*
+*   fn - function reference number
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   DBL - result found in R0
+*
+* DESCRIPTION
+*
+*   Execute a compiled function, using its native code if available and
+*   the interpreter otherwise.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+DBL POVFPU_RunJIT(FPUContext *context, FUNCTION fn)
+{
+    const FunctionEntry& entry = context->functionvm->functions[fn];
+
+    if (entry.jit.code == nullptr)
+        return POVFPU_RunDefault(context, fn);
+
+    context->threaddata->Stats()[Ray_Function_VM_Calls]++;
+
+#if POV_VM_JIT_VERIFY
+    DBL parameters[MAX_FUNCTION_PARAMETER_LIST];
+    unsigned int parameterCount = min((unsigned int)entry.fn.parameter_cnt, context->maxdblstacksize);
+    for (unsigned int i = 0; i < parameterCount; i++)
+        parameters[i] = context->dblstackbase[i];
+#endif
+
+    std::exception_ptr exception;
+    FunctionJITFrame frame = { context, &context->dblstackbase, &context->maxdblstacksize, &exception };
+    DBL result = 0.0;
+
+    if (entry.jit.code(&frame, 0, &result) != 0)
+        std::rethrow_exception(exception);
+
+#if POV_VM_JIT_VERIFY
+    for (unsigned int i = 0; i < parameterCount; i++)
+        context->dblstackbase[i] = parameters[i];
+    DBL expected = POVFPU_RunDefault(context, fn);
+    if ((JIT_Bits(result) != JIT_Bits(expected)) && !(std::isnan(result) && std::isnan(expected)))
+        throw POV_EXCEPTION_STRING("Native code for function returned a different result than the interpreter.");
+#endif
+
+    return result;
+}
+
+}
+
+#endif // POV_VM_JIT
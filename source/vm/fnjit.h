@@ -0,0 +1,82 @@
+//******************************************************************************
+///
+/// @file vm/fnjit.h
+///
+/// This module contains declarations for the translation of render-time
+/// functions to native code.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+#ifndef POVRAY_VM_FNJIT_H
+#define POVRAY_VM_FNJIT_H
+
+// Module config header file must be the first file included within POV-Ray unit header files
+#include "vm/configvm.h"
+
+#include <exception>
+#include <vector>
+
+#include "vm/fnpovfpu.h"
+
+namespace pov
+{
+
+#if POV_VM_JIT
+
+/// State shared by all native code run from a single call to @ref POVFPU_RunJIT.
+///
+/// @note   The native code accesses the fields at fixed offsets, so this must remain a plain
+///         structure.
+///
+struct FunctionJITFrame
+{
+    FPUContext *context;
+    DBL **dblstack;                 ///< The context's stack base, which moves when the stack grows.
+    unsigned int *maxdblstacksize;  ///< The context's stack size.
+    std::exception_ptr *exception;  ///< Receives exceptions thrown by code called from native code.
+};
+
+/// Translate a function to native code.
+///
+/// Functions using instructions the translator does not handle, or calling other functions that
+/// have not been translated, are left to the interpreter.
+///
+/// @return     `true` if native code was generated.
+///
+bool POVFPU_JITCompile(FunctionEntry& entry, FUNCTION fn, const vector<DBL>& consts, const vector<FunctionEntry>& functions);
+
+/// Release a function's native code, if any.
+void POVFPU_JITDelete(FunctionJIT& jit);
+
+#endif // POV_VM_JIT
+
+}
+
+#endif // POVRAY_VM_FNJIT_H
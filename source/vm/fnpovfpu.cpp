@@ -231,17 +231,26 @@ Density of instruction set: 916 / 1024 = 0.8945
 // Unit header file must be the first file included within POV-Ray *.cpp files (pulls in config)
 #include "vm/fnpovfpu.h"
 
+#include <cfloat>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 
 #include <algorithm>
+#if POV_VM_PROFILE
+#include <chrono>
+#endif
+#include <unordered_map>
+
+#include <boost/thread.hpp>
 
 #include "base/mathutil.h"
+#include "base/memoryaccounting.h"
 
 #include "core/scene/tracethreaddata.h"
 
 #include "vm/fnintern.h"
+#include "vm/fnjit.h"
 
 // this must be the last file included
 #include "base/povdebug.h"
@@ -393,10 +402,87 @@ namespace pov
 #define OP_INT_SPECIAL_CASE(a,b,c) \
     case ((a*64)+(b*4)+c):
 
+// apply a statement to all points of the batched interpreter that are at the current instruction
+#define BATCH_LANES(op) \
+    { \
+        if(mask == all) \
+        { \
+            for(l = 0; l < count; l++) \
+                { op; } \
+        } \
+        else \
+        { \
+            for(l = 0; l < count; l++) \
+                if(mask & (1u << l)) \
+                    { op; } \
+        } \
+    }
+
+#if POV_VM_PROFILE
+    // start gathering statistics on a call from outside the virtual machine
+    #define PROFILE_START(n) \
+        FunctionProfile *profile = POVFPU_StartProfile(context, functions, fn); \
+        POVFPU_ProfileTimer profiletimer(profile); \
+        profile->calls += (n);
+    // continue with the statistics of the function just called
+    #define PROFILE_CALL(n) \
+        profile = &context->profile[fn]; \
+        profile->calls += (n);
+    // continue with the statistics of the function just returned to
+    #define PROFILE_RETURN() \
+        profile = &context->profile[fn];
+    #if POV_VM_PROFILE > 1
+        #define PROFILE_INSTRUCTION(op, n) \
+            { profile->instructions += (n); context->opcodeprofile[op] += (n); }
+    #else
+        #define PROFILE_INSTRUCTION(op, n) \
+            { profile->instructions += (n); }
+    #endif
+#else
+    #define PROFILE_START(n)
+    #define PROFILE_CALL(n)
+    #define PROFILE_RETURN()
+    #define PROFILE_INSTRUCTION(op, n)
+#endif
+
 /*****************************************************************************
 * Local typedefs
 ******************************************************************************/
 
+/// Compiled function held by the cache of compiled functions.
+///
+/// Compiled code refers to constants and called functions by their reference numbers in the
+/// virtual machine holding it. Cached code instead refers to the entry's own lists of constant
+/// values and of called functions, and is mapped to the virtual machine it is loaded into.
+///
+struct FunctionCacheEntry
+{
+    unsigned int id;                    ///< Unique identifier, standing in for the function in the keys of functions calling it.
+    vector<Instruction> program;
+    vector<DBL> consts;                 ///< Values of the constants used.
+    vector<unsigned int> callees;       ///< Identifiers of the functions called.
+    unsigned int parameter_cnt;
+    vector<std::string> parameters;     ///< Parameter names, where present.
+};
+
+typedef shared_ptr<const FunctionCacheEntry> FunctionCacheEntryPtr;
+
+#if POV_VM_PROFILE
+/// Measures the time spent in a call from outside the virtual machine.
+class POVFPU_ProfileTimer
+{
+    public:
+        POVFPU_ProfileTimer(FunctionProfile *p) : profile(p), start(std::chrono::steady_clock::now()) {}
+        ~POVFPU_ProfileTimer()
+        {
+            profile->time += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        }
+    private:
+        FunctionProfile *profile;
+        std::chrono::steady_clock::time_point start;
+};
+#endif
+
 
 /*****************************************************************************
 * Local functions
@@ -404,6 +490,7 @@ namespace pov
 
 SYS_MATH_RETURN math_int(SYS_MATH_PARAM i);
 SYS_MATH_RETURN math_div(SYS_MATH_PARAM i1, SYS_MATH_PARAM i2);
+static bool POVFPU_IntervalSupported(const FunctionCode& f, const vector<FunctionEntry>& functions);
 
 
 /*****************************************************************************
@@ -503,6 +590,12 @@ const Sys2 POVFPU_Sys2Table[] =
 const unsigned int POVFPU_Sys1TableSize = 19;
 const unsigned int POVFPU_Sys2TableSize = 4;
 
+// Compiled functions shared by all virtual machines, by the key given by the function compiler.
+static std::unordered_map<std::string, FunctionCacheEntryPtr> gFunctionCache;
+static size_t gFunctionCacheSize = 0;
+static unsigned int gFunctionCacheNextId = 1;
+static boost::mutex gFunctionCacheMutex;
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -677,6 +770,10 @@ void FunctionVM::Reset()
         if(i->reference_count > 0) // ignore the reference count [trf]
         {
             SYS_DELETE_FUNCTION(&(*i));
+#if POV_VM_JIT
+            POVFPU_JITDelete(i->jit);
+#endif
+            MemoryAccounting::Release(kMemoryVM, sizeof(Instruction) * i->fn.program_size);
             FNCode_Delete(&(i->fn));
             i->reference_count = 0;
         }
@@ -725,8 +822,8 @@ void FPUContext::SetLocal(unsigned int k, DBL v)
         size_t diff = ((size_t)(dblstack)) - ((size_t)(dblstackbase));
         #endif
 
-        maxdblstacksize = max(k + 1, (unsigned int)INITIAL_DBL_STACK_SIZE);
-        dblstackbase = reinterpret_cast<DBL *>(POV_REALLOC(dblstackbase, sizeof(DBL) * maxdblstacksize, "fn: stack"));
+        dblstackbase = ResizeStack(dblstackbase, maxdblstacksize, k + 1);
+        maxdblstacksize = k + 1;
 
         #if (SYS_FUNCTIONS == 1)
         dblstack = reinterpret_cast<DBL *>(((size_t)(dblstackbase)) + diff);
@@ -776,6 +873,51 @@ DBL FPUContext::GetLocal(unsigned int k)
 }
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_SetBatchLocal
+*
+* INPUT
+*
+*   lane - point of the batched interpreter
+*   k - stack offset
+*   v - value to set
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Set a floating-point value on the stack position of one point of the
+*   batched interpreter. Allocate or grow the stack if necessary.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void FPUContext::SetBatchLocal(unsigned int lane, unsigned int k, DBL v)
+{
+    POV_VM_ASSERT(lane < POV_VM_BATCH_SIZE);
+
+    if(k >= maxbatchstacksize[lane])
+    {
+        batchstackbase[lane] = ResizeStack(batchstackbase[lane], maxbatchstacksize[lane], k + 1);
+        maxbatchstacksize[lane] = k + 1;
+    }
+
+    batchstackbase[lane][k] = v;
+}
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1033,12 +1175,210 @@ FUNCTION FunctionVM::AddFunction(FunctionCode *f)
 
     functions[fn].fn = *f;
     functions[fn].reference_count = 1;
+    MemoryAccounting::Allocate(kMemoryVM, sizeof(Instruction) * f->program_size);
+    functions[fn].interval = false;
+    functions[fn].interval = POVFPU_IntervalSupported(functions[fn].fn, functions);
     SYS_ADD_FUNCTION(fn);
+#if POV_VM_JIT
+    POVFPU_JITCompile(functions[fn], fn, consts, functions);
+#endif
 
     return fn;
 }
 
 
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   FunctionVM::LoadCachedFunction
+*
+* INPUT
+*
+*   key - description of the function as given by the function compiler
+*   callees - functions called, by the cache identifiers used in the key
+*
+* OUTPUT
+*
+*   f - function to receive the code
+*
+* RETURNS
+*
+*   bool - true if the code was found in the cache
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Fetch code compiled for an identical function, possibly by an earlier
+*   parse, from the cache of compiled functions. The constants and called
+*   functions are mapped to this virtual machine, and a reference to each
+*   function called is taken as the function compiler would.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+bool FunctionVM::LoadCachedFunction(const std::string& key, FunctionCode& f, const std::map<unsigned int, FUNCTION>& callees)
+{
+    FunctionCacheEntryPtr entry;
+    unsigned int i;
+
+    {
+        boost::mutex::scoped_lock lock(gFunctionCacheMutex);
+        std::unordered_map<std::string, FunctionCacheEntryPtr>::const_iterator found = gFunctionCache.find(key);
+        if(found == gFunctionCache.end())
+            return false;
+        entry = found->second;
+    }
+
+    vector<FUNCTION> fnmap(entry->callees.size());
+    for(i = 0; i < entry->callees.size(); i++)
+    {
+        std::map<unsigned int, FUNCTION>::const_iterator callee = callees.find(entry->callees[i]);
+        if(callee == callees.end())
+            return false;
+        fnmap[i] = callee->second;
+    }
+
+    vector<unsigned int> constmap(entry->consts.size());
+    for(i = 0; i < entry->consts.size(); i++)
+        constmap[i] = AddConstant(entry->consts[i]);
+
+    f.program_size = entry->program.size();
+    f.program = reinterpret_cast<Instruction *>(POV_MALLOC(sizeof(Instruction) * f.program_size, "fn: program"));
+    for(i = 0; i < f.program_size; i++)
+    {
+        unsigned int op = GET_OP(entry->program[i]);
+        unsigned int k = GET_K(entry->program[i]);
+
+        if(((op >> 6) & 15) == 9) // addi, subi, muli, divi, modi, loadi, cmpi
+            k = constmap[k];
+        else if(op == OPCODE_CALL)
+        {
+            k = fnmap[k];
+            (void)GetFunctionAndReference(k);
+        }
+        f.program[i] = MAKE_INSTRUCTION(op, k);
+    }
+
+    // the parameters named in the key are already there, only defaults are missing
+    for(i = f.parameter_cnt; i < entry->parameters.size(); i++)
+        f.parameter[i] = POV_STRDUP(entry->parameters[i].c_str());
+    f.parameter_cnt = entry->parameter_cnt;
+    f.cache_id = entry->id;
+
+    return true;
+}
+
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   FunctionVM::StoreCachedFunction
+*
+* INPUT
+*
+*   key - description of the function as given by the function compiler
+*
+* OUTPUT
+*
+*   f - compiled function, receiving its cache identifier
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Add a newly compiled function to the cache of compiled functions, so
+*   that later parses can reuse it. Functions using global variables, or
+*   calling functions that are not cached, are not added.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+void FunctionVM::StoreCachedFunction(const std::string& key, FunctionCode& f)
+{
+    shared_ptr<FunctionCacheEntry> entry(new FunctionCacheEntry);
+    std::map<unsigned int, unsigned int> constmap;
+    std::map<unsigned int, unsigned int> fnmap;
+    size_t size;
+    unsigned int i;
+
+    entry->program.resize(f.program_size);
+    for(i = 0; i < f.program_size; i++)
+    {
+        unsigned int op = GET_OP(f.program[i]);
+        unsigned int k = GET_K(f.program[i]);
+
+        if(((op >> 6) & 15) == 9) // addi, subi, muli, divi, modi, loadi, cmpi
+        {
+            if(constmap.find(k) == constmap.end())
+            {
+                constmap[k] = entry->consts.size();
+                entry->consts.push_back(consts[k]);
+            }
+            k = constmap[k];
+        }
+        else if(op == OPCODE_CALL)
+        {
+            if((k >= functions.size()) || (functions[k].fn.cache_id == 0))
+                return;
+            if(fnmap.find(k) == fnmap.end())
+            {
+                fnmap[k] = entry->callees.size();
+                entry->callees.push_back(functions[k].fn.cache_id);
+            }
+            k = fnmap[k];
+        }
+        else if((op == OPCODE_JSR) || ((((op >> 6) & 15) == 11 || ((op >> 6) & 15) == 12) && (((op >> 3) & 7) == 0)))
+            return; // jsr and global variables are never emitted by the function compiler
+        entry->program[i] = MAKE_INSTRUCTION(op, k);
+    }
+
+    entry->parameter_cnt = f.parameter_cnt;
+    for(i = 0; (i < f.parameter_cnt) && (f.parameter[i] != nullptr); i++)
+        entry->parameters.push_back(f.parameter[i]);
+
+    size = key.size() + sizeof(Instruction) * entry->program.size() + sizeof(DBL) * entry->consts.size();
+    if(size > POV_VM_FUNCTION_CACHE)
+        return;
+
+    boost::mutex::scoped_lock lock(gFunctionCacheMutex);
+
+    // another parse may have compiled the same function in the meantime
+    std::unordered_map<std::string, FunctionCacheEntryPtr>::const_iterator found = gFunctionCache.find(key);
+    if(found != gFunctionCache.end())
+    {
+        f.cache_id = found->second->id;
+        return;
+    }
+
+    if(gFunctionCacheSize + size > POV_VM_FUNCTION_CACHE)
+    {
+        // identifiers are never reused, so keys referring to discarded entries simply miss
+        gFunctionCache.clear();
+        gFunctionCacheSize = 0;
+    }
+
+    entry->id = gFunctionCacheNextId++;
+    gFunctionCache[key] = entry;
+    gFunctionCacheSize += size;
+    f.cache_id = entry->id;
+}
+
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1083,11 +1423,15 @@ void FunctionVM::RemoveFunction(FUNCTION fn)
             unsigned int i = 0;
 
             SYS_DELETE_FUNCTION(&f);
+#if POV_VM_JIT
+            POVFPU_JITDelete(functions[fn].jit);
+#endif
             for(i = 0; i < f.fn.program_size; i++)
             {
                 if(GET_OP(f.fn.program[i]) == OPCODE_CALL)
                     RemoveFunction(GET_K(f.fn.program[i]));
             }
+            MemoryAccounting::Release(kMemoryVM, sizeof(Instruction) * f.fn.program_size);
             FNCode_Delete(&(f.fn));
 
             // we use unused entries to store a linked list of those, for easier later re-use
@@ -1156,6 +1500,138 @@ void POVFPU_Exception(FPUContext *context, FUNCTION fn, const char *msg)
 }
 
 
+#if POV_VM_PROFILE
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_StartProfile
+*
+* INPUT
+*
+*   functions - all functions
+*   fn - function reference number
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   FunctionProfile * - statistics of the function
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Makes room in a context for the statistics of all functions, as the
+*   statistics must not move while a function runs.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static inline FunctionProfile *POVFPU_StartProfile(FPUContext *context, const vector<FunctionEntry>& functions, FUNCTION fn)
+{
+    if(context->profile.size() < functions.size())
+        context->profile.resize(functions.size());
+
+    return &context->profile[fn];
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_CountLanes
+*
+* INPUT
+*
+*   mask - points of the batched interpreter
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   unsigned int - number of points in the mask
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static inline unsigned int POVFPU_CountLanes(unsigned int mask)
+{
+    unsigned int count = 0;
+
+    for(; mask != 0; mask &= mask - 1)
+        count++;
+
+    return count;
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_MergeProfile
+*
+* INPUT
+*
+*   fromprofile, fromopcodes - statistics to add
+*
+* OUTPUT
+*
+*   profile, opcodes - statistics to add to
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   -
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static void POVFPU_MergeProfile(vector<FunctionProfile>& profile, vector<POV_ULONG>& opcodes,
+                                const vector<FunctionProfile>& fromprofile, const vector<POV_ULONG>& fromopcodes)
+{
+    if(profile.size() < fromprofile.size())
+        profile.resize(fromprofile.size());
+    for(size_t i = 0; i < fromprofile.size(); i++)
+    {
+        profile[i].calls += fromprofile[i].calls;
+        profile[i].instructions += fromprofile[i].instructions;
+        profile[i].time += fromprofile[i].time;
+    }
+
+    if(opcodes.size() < fromopcodes.size())
+        opcodes.resize(fromopcodes.size());
+    for(size_t i = 0; i < fromopcodes.size(); i++)
+        opcodes[i] += fromopcodes[i];
+}
+
+#endif // POV_VM_PROFILE
+
 /*****************************************************************************
 *
 * FUNCTION
@@ -1216,12 +1692,14 @@ DBL POVFPU_RunDefault(FPUContext *context, FUNCTION fn)
 #endif
 
     context->threaddata->Stats()[Ray_Function_VM_Calls]++;
+    PROFILE_START(1);
 
     program = functions[fn].fn.program;
 
     while(true)
     {
         k = GET_K(program[pc]);
+        PROFILE_INSTRUCTION(GET_OP(program[pc]), 1);
         switch(GET_OP(program[pc]))
         {
             OP_MATH_AOP(0,+);           // add   Rs, Rd
@@ -1324,6 +1802,7 @@ DBL POVFPU_RunDefault(FPUContext *context, FUNCTION fn)
                 pc = pstack[psp].pc; // old position, will be incremented
                 fn = pstack[psp].fn;
                 program = functions[fn].fn.program;
+                PROFILE_RETURN();
                 break;
             OP_SPECIAL_CASE(15,0,3)                     // call  k
                 pstack[psp].pc = pc;
@@ -1334,6 +1813,7 @@ DBL POVFPU_RunDefault(FPUContext *context, FUNCTION fn)
                 fn = k;
                 program = functions[fn].fn.program;
                 pc = 0;
+                PROFILE_CALL(1);
                 continue; // prevent increment of pc
 
             OP_SPECIAL_CASE(15,0,4)                     // sys1  k
@@ -1360,8 +1840,9 @@ DBL POVFPU_RunDefault(FPUContext *context, FUNCTION fn)
                 }
                 else if(sp + k >= maxdblstacksize)
                 {
-                    maxdblstacksize = context->maxdblstacksize = context->maxdblstacksize + max(k + 1, (unsigned int)INITIAL_DBL_STACK_SIZE);
-                    dblstack = context->dblstackbase = reinterpret_cast<DBL *>(POV_REALLOC(dblstack, sizeof(DBL) * maxdblstacksize, "fn: stack"));
+                    unsigned int newsize = maxdblstacksize + max(k + 1, (unsigned int)INITIAL_DBL_STACK_SIZE);
+                    dblstack = context->dblstackbase = context->ResizeStack(dblstack, maxdblstacksize, newsize);
+                    maxdblstacksize = context->maxdblstacksize = newsize;
                 }
                 break;
             OP_SPECIAL_CASE(15,1,1)                     // push  k
@@ -1468,19 +1949,1106 @@ DBL POVFPU_RunDefault(FPUContext *context, FUNCTION fn)
 *
 * FUNCTION
 *
-*   FNCode_Delete
+*   POVFPU_Condition
 *
 * INPUT
 *
-*   f - function to delete
+*   cond - condition code of a branch or set instruction
+*   ccr - condition code register
 *
 * OUTPUT
 *
 * RETURNS
 *
+*   bool - true if the condition holds
+*
 * AUTHOR
 *
-*   Thorsten Froehlich
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Evaluates the condition of a branch or set instruction for one point of
+*   the batched interpreter.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static inline bool POVFPU_Condition(unsigned int cond, unsigned int ccr)
+{
+    switch(cond)
+    {
+        case 0: return (ccr == 1); // eq
+        case 1: return (ccr != 1); // ne
+        case 2: return (ccr == 2); // lt
+        case 3: return (ccr >= 1); // le
+        case 4: return (ccr == 0); // gt
+        case 5: return (ccr <= 1); // ge
+        default: return false;
+    }
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_RunBatch
+*
+* INPUT
+*
+*   fn - function reference number
+*   count - number of points, at most POV_VM_BATCH_SIZE
+*
+* OUTPUT
+*
+*   results - R0 for each point
+*
+* RETURNS
+*
+*   bool - false if the points have to be evaluated one by one instead
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Evaluates a function at several points at once. The arguments of each
+*   point have to be placed on its own stack using SetBatchLocal. Registers
+*   hold one value per point, and each instruction is decoded once and then
+*   applied to all points, in loops the compiler can map to SIMD lanes.
+*
+*   Where a conditional branch splits the points, each continues at its own
+*   program counter, and the points furthest behind are run first. This
+*   joins them up again where the paths merge, as after min, max or select.
+*   Calls and returns are shared by all points though, so if the points
+*   reach one while still apart, evaluation is abandoned. As functions have
+*   no side effects, the caller can then simply start over one by one.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+bool POVFPU_RunBatch(FPUContext *context, FUNCTION fn, unsigned int count, DBL *results)
+{
+    vector<FunctionEntry>& functions(context->functionvm->functions);
+    vector<DBL>& consts(context->functionvm->consts);
+    vector<DBL>& globals(context->functionvm->globals);
+    StackFrame *pstack = context->pstackbase;
+    DBL **dblstack = context->batchstackbase;
+    unsigned int *maxdblstacksize = context->maxbatchstacksize;
+    DBL r[8][POV_VM_BATCH_SIZE];
+    unsigned int ccr[POV_VM_BATCH_SIZE];
+    unsigned int sp[POV_VM_BATCH_SIZE];
+    unsigned int lanepc[POV_VM_BATCH_SIZE];
+    Instruction *program = nullptr;
+    DBL *rs = nullptr;
+    DBL *rd = nullptr;
+    DBL c = 0.0;
+    unsigned int all = 0;
+    unsigned int mask = 0;
+    unsigned int taken = 0;
+    unsigned int op = 0, s = 0, d = 0, l = 0;
+    unsigned int k = 0;
+    unsigned int pc = 0;
+    unsigned int psp = 0;
+    bool diverged = false;
+
+    static_assert(POV_VM_BATCH_SIZE <= 32, "POV_VM_BATCH_SIZE must not exceed the width of the point masks");
+    POV_VM_ASSERT((count > 0) && (count <= POV_VM_BATCH_SIZE));
+
+    all = mask = 0xffffffffu >> (32 - count);
+
+    for(l = 0; l < count; l++)
+    {
+        if(dblstack[l] == nullptr)
+            context->SetBatchLocal(l, 0, 0.0);
+        for(s = 0; s < 8; s++)
+            r[s][l] = 0.0;
+        ccr[l] = 0;
+        sp[l] = 0;
+    }
+
+    context->threaddata->Stats()[Ray_Function_VM_Calls] += count;
+    PROFILE_START(count);
+
+    program = functions[fn].fn.program;
+
+    while(true)
+    {
+        if(diverged)
+        {
+            // continue with the points furthest behind
+            pc = MAX_K;
+            for(l = 0; l < count; l++)
+                pc = min(pc, lanepc[l]);
+            mask = 0;
+            for(l = 0; l < count; l++)
+                if(lanepc[l] == pc)
+                    mask |= (1u << l);
+            diverged = (mask != all);
+        }
+
+        k = GET_K(program[pc]);
+        op = GET_OP(program[pc]);
+        s = (op >> 3) & 7;
+        d = op & 7;
+        rs = r[s];
+        rd = r[d];
+        PROFILE_INSTRUCTION(op, (mask == all) ? count : POVFPU_CountLanes(mask));
+
+        switch(op >> 6)
+        {
+            case 0: BATCH_LANES(rd[l] = rd[l] + rs[l]); break;      // add   Rs, Rd
+            case 1: BATCH_LANES(rd[l] = rd[l] - rs[l]); break;      // sub   Rs, Rd
+            case 2: BATCH_LANES(rd[l] = rd[l] * rs[l]); break;      // mul   Rs, Rd
+            case 3: BATCH_LANES(rd[l] = rd[l] / rs[l]); break;      // div   Rs, Rd
+            case 4: BATCH_LANES(rd[l] = fmod(rd[l], rs[l])); break; // mod   Rs, Rd
+            case 5: BATCH_LANES(rd[l] = rs[l]); break;              // move  Rs, Rd
+            case 6: BATCH_LANES(ccr[l] = (((rs[l] > rd[l]) & 1) << 1) | ((rs[l] == rd[l]) & 1)); break; // cmp   Rs, Rd
+            case 7: BATCH_LANES(rd[l] = -rs[l]); break;             // neg   Rs, Rd
+            case 8: BATCH_LANES(rd[l] = fabs(rs[l])); break;        // abs   Rs, Rd
+            case 9:
+                if(s == 7)
+                    break;                                          // nop
+                c = consts[k];
+                switch(s)
+                {
+                    case 0: BATCH_LANES(rd[l] = rd[l] + c); break;      // addi  k, Rd
+                    case 1: BATCH_LANES(rd[l] = rd[l] - c); break;      // subi  k, Rd
+                    case 2: BATCH_LANES(rd[l] = rd[l] * c); break;      // muli  k, Rd
+                    case 3: BATCH_LANES(rd[l] = rd[l] / c); break;      // divi  k, Rd
+                    case 4: BATCH_LANES(rd[l] = fmod(rd[l], c)); break; // modi  k, Rd
+                    case 5: BATCH_LANES(rd[l] = c); break;              // loadi k, Rd
+                    case 6: BATCH_LANES(ccr[l] = (((c > rd[l]) & 1) << 1) | ((c == rd[l]) & 1)); break; // cmpi  k, Rs
+                }
+                break;
+            case 10:
+                if(s == 6)
+                    BATCH_LANES(rd[l] = (rd[l] == 0.0))             // teq   Rd
+                else if(s == 7)
+                    BATCH_LANES(rd[l] = (rd[l] != 0.0))             // tne   Rd
+                else
+                    BATCH_LANES(rd[l] = POVFPU_Condition(s, ccr[l])) // seq ... sge   Rd
+                break;
+            case 11:
+                if(s == 0)
+                    BATCH_LANES(rd[l] = globals[k])                 // load  0(k), Rd
+                else if(s == 1)
+                    BATCH_LANES(rd[l] = dblstack[l][sp[l] + k])     // load  SP(k), Rd
+                break;
+            case 12:
+                if(s == 0)
+                    BATCH_LANES(globals[k] = rd[l])                 // store Rs, 0(k)
+                else if(s == 1)
+                    BATCH_LANES(dblstack[l][sp[l] + k] = rd[l])     // store Rs, SP(k)
+                break;
+            case 13:                                                // beq ... bge   k
+                if((d != 0) || (s > 5))
+                    break;                                          // nop
+                taken = 0;
+                for(l = 0; l < count; l++)
+                    if((mask & (1u << l)) && POVFPU_Condition(s, ccr[l]))
+                        taken |= (1u << l);
+                if(taken == 0)
+                    break;
+                if(!diverged)
+                {
+                    if(taken == all)
+                    {
+                        pc = k;
+                        continue; // prevent increment of pc
+                    }
+                    for(l = 0; l < count; l++)
+                        lanepc[l] = pc;
+                    diverged = true;
+                }
+                BATCH_LANES(lanepc[l] = ((taken & (1u << l)) ? k : pc + 1));
+                continue; // prevent increment of pc
+            case 14:
+                switch(s)
+                {
+                    case 0: BATCH_LANES(if(rd[l] == 0.0) POVFPU_Exception(context, fn)); break; // xeq   Rd
+                    case 1: BATCH_LANES(if(rd[l] != 0.0) POVFPU_Exception(context, fn)); break; // xne   Rd
+                    case 2: BATCH_LANES(if(rd[l] <  0.0) POVFPU_Exception(context, fn)); break; // xlt   Rd
+                    case 3: BATCH_LANES(if(rd[l] <= 0.0) POVFPU_Exception(context, fn)); break; // xle   Rd
+                    case 4: BATCH_LANES(if(rd[l] >  0.0) POVFPU_Exception(context, fn)); break; // xgt   Rd
+                    case 5: BATCH_LANES(if(rd[l] >= 0.0) POVFPU_Exception(context, fn)); break; // xge   Rd
+                    case 6: BATCH_LANES(if((r[0][l] == 0.0) && (rd[l] == 0.0)) POVFPU_Exception(context, fn)); break; // xdz   R0, Rd
+                }
+                break;
+            case 15:
+                if(s == 0)
+                {
+                    switch(d)
+                    {
+                        case 0:                                     // jsr   k
+                            if(diverged)
+                                return false;
+                            pstack[psp].pc = pc;
+                            pstack[psp].fn = fn;
+                            psp++;
+                            if(psp >= MAX_CALL_STACK_SIZE)
+                                POVFPU_Exception(context, fn, "Maximum function evaluation recursion level reached.");
+                            pc = k;
+                            continue; // prevent increment of pc
+                        case 1:                                     // jmp   k
+                            if(diverged)
+                                BATCH_LANES(lanepc[l] = k)
+                            else
+                                pc = k;
+                            continue; // prevent increment of pc
+                        case 2:                                     // rts
+                            if(diverged)
+                                return false;
+                            if(psp == 0)
+                            {
+                                for(l = 0; l < count; l++)
+                                    results[l] = r[0][l];
+                                return true;
+                            }
+                            psp--;
+                            pc = pstack[psp].pc; // old position, will be incremented
+                            fn = pstack[psp].fn;
+                            program = functions[fn].fn.program;
+                            PROFILE_RETURN();
+                            break;
+                        case 3:                                     // call  k
+                            if(diverged)
+                                return false;
+                            pstack[psp].pc = pc;
+                            pstack[psp].fn = fn;
+                            psp++;
+                            if(psp >= MAX_CALL_STACK_SIZE)
+                                POVFPU_Exception(context, fn, "Maximum function evaluation recursion level reached.");
+                            fn = k;
+                            program = functions[fn].fn.program;
+                            pc = 0;
+                            PROFILE_CALL(count);
+                            continue; // prevent increment of pc
+                        case 4:                                     // sys1  k
+                            BATCH_LANES(r[0][l] = POVFPU_Sys1Table[k](r[0][l]));
+                            break;
+                        case 5:                                     // sys2  k
+                            BATCH_LANES(r[0][l] = POVFPU_Sys2Table[k](r[0][l], r[1][l]));
+                            break;
+                        case 6:                                     // trap  k
+                            if(POVFPU_TrapTable[k].batchfn != nullptr)
+                            {
+                                // evaluate all points at once, e.g. sharing vectorised noise calls
+                                DBL *trapptr[POV_VM_BATCH_SIZE];
+                                DBL trapresult[POV_VM_BATCH_SIZE];
+                                unsigned int n = 0;
+
+                                BATCH_LANES(trapptr[n++] = &dblstack[l][sp[l]]);
+                                POVFPU_TrapTable[k].batchfn(context, trapptr, trapresult, n, fn);
+                                n = 0;
+                                BATCH_LANES(r[0][l] = trapresult[n++]);
+                                break;
+                            }
+                            // traps work on the context's stack, so lend them the point's own
+                            BATCH_LANES(std::swap(context->dblstackbase, dblstack[l]);
+                                        std::swap(context->maxdblstacksize, maxdblstacksize[l]);
+                                        r[0][l] = POVFPU_TrapTable[k].fn(context, &context->dblstackbase[sp[l]], fn);
+                                        std::swap(context->dblstackbase, dblstack[l]);
+                                        std::swap(context->maxdblstacksize, maxdblstacksize[l]));
+                            break;
+                        case 7:                                     // traps k
+                            BATCH_LANES(std::swap(context->dblstackbase, dblstack[l]);
+                                        std::swap(context->maxdblstacksize, maxdblstacksize[l]);
+                                        POVFPU_TrapSTable[k].fn(context, &context->dblstackbase[sp[l]], fn, sp[l]);
+                                        std::swap(context->dblstackbase, dblstack[l]);
+                                        std::swap(context->maxdblstacksize, maxdblstacksize[l]));
+                            break;
+                    }
+                }
+                else if(s == 1)
+                {
+                    switch(d)
+                    {
+                        case 0:                                     // grow  k
+                            BATCH_LANES(if((unsigned int)((unsigned int)sp[l] + (unsigned int)k) >= (unsigned int)MAX_K)
+                                            POVFPU_Exception(context, fn, "Stack full. Possible infinite recursive function call.");
+                                        else if(sp[l] + k >= maxdblstacksize[l])
+                                        {
+                                            unsigned int newsize = maxdblstacksize[l] + max(k + 1, (unsigned int)INITIAL_DBL_STACK_SIZE);
+                                            dblstack[l] = context->ResizeStack(dblstack[l], maxdblstacksize[l], newsize);
+                                            maxdblstacksize[l] = newsize;
+                                        });
+                            break;
+                        case 1:                                     // push  k
+                            BATCH_LANES(if(sp[l] + k >= maxdblstacksize[l])
+                                            POVFPU_Exception(context, fn, "Function evaluation stack overflow.");
+                                        sp[l] += k);
+                            break;
+                        case 2:                                     // pop   k
+                            BATCH_LANES(if(k > sp[l])
+                                            POVFPU_Exception(context, fn, "Function evaluation stack underflow.");
+                                        sp[l] -= k);
+                            break;
+                    }
+                }
+                break;
+        }
+
+        if(diverged)
+            BATCH_LANES(lanepc[l] = pc + 1)
+        else
+            pc++;
+    }
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_IntervalSupported
+*
+* INPUT
+*
+*   f - function to check
+*   functions - functions it may call
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   bool - true if POVFPU_RunInterval can evaluate the function
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Checks a function for instructions the interval interpreter cannot
+*   handle at all, so that it does not have to find out over and over again
+*   at render time. These are calls to internal functions, stores to global
+*   variables, and calls to functions having either.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static bool POVFPU_IntervalSupported(const FunctionCode& f, const vector<FunctionEntry>& functions)
+{
+    for(unsigned int i = 0; i < f.program_size; i++)
+    {
+        unsigned int op = GET_OP(f.program[i]);
+        unsigned int k = GET_K(f.program[i]);
+
+        switch(op)
+        {
+            case OPCODE_TRAP:
+            case OPCODE_TRAPS:
+                return false;
+            case OPCODE_CALL:
+                if((k >= functions.size()) || (functions[k].interval == false))
+                    return false;
+                break;
+            default:
+                if(((op >> 6) == 12) && (((op >> 3) & 7) == 0))
+                    return false;
+                break;
+        }
+    }
+
+    return true;
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_IntervalPeriodic
+*
+* INPUT
+*
+*   lo, hi - interval
+*   offset - phase
+*   period - period
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   bool - true if the interval contains offset + n * period for some n
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Helper locating the extrema and poles of periodic functions.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static inline bool POVFPU_IntervalPeriodic(DBL lo, DBL hi, DBL offset, DBL period)
+{
+    return (offset + ceil((lo - offset) / period) * period <= hi);
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_IntervalCorners
+*
+* INPUT
+*
+*   f - function of two arguments
+*   alo, ahi - interval of the first argument
+*   blo, bhi - interval of the second argument
+*
+* OUTPUT
+*
+*   lo, hi - smallest and largest value at the corners
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Bounds a function of two arguments that is monotonic in each of them
+*   over the rectangle given by the intervals.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static inline void POVFPU_IntervalCorners(Sys2 f, DBL alo, DBL ahi, DBL blo, DBL bhi, DBL& lo, DBL& hi)
+{
+    DBL v[4] = { f(alo, blo), f(alo, bhi), f(ahi, blo), f(ahi, bhi) };
+
+    lo = min(min(v[0], v[1]), min(v[2], v[3]));
+    hi = max(max(v[0], v[1]), max(v[2], v[3]));
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_IntervalMod
+*
+* INPUT
+*
+*   alo, ahi - interval of the dividend
+*   blo, bhi - interval of the divisor
+*
+* OUTPUT
+*
+*   lo, hi - interval of the remainder
+*
+* RETURNS
+*
+*   bool - false if the remainder cannot be bounded
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Bounds fmod for a constant divisor. Within one period the remainder
+*   grows with the dividend, otherwise it may take any value between zero
+*   and the divisor on the side of the dividend.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static inline bool POVFPU_IntervalMod(DBL alo, DBL ahi, DBL blo, DBL bhi, DBL& lo, DBL& hi)
+{
+    DBL b = fabs(blo);
+
+    if((blo != bhi) || (b == 0.0))
+        return false;
+
+    if(trunc(alo / b) == trunc(ahi / b))
+    {
+        lo = fmod(alo, b);
+        hi = fmod(ahi, b);
+    }
+    else
+    {
+        lo = (alo >= 0.0) ? 0.0 : -b;
+        hi = (ahi <= 0.0) ? 0.0 : b;
+    }
+
+    return true;
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_IntervalCondition
+*
+* INPUT
+*
+*   cond - condition of a branch or set instruction
+*   ccrs - set of possible condition codes, one bit per code
+*
+* OUTPUT
+*
+* RETURNS
+*
+*   unsigned int - bit 0 set if the condition may be false, bit 1 if it
+*                  may be true
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Evaluates a condition for the interval interpreter.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+static inline unsigned int POVFPU_IntervalCondition(unsigned int cond, unsigned int ccrs)
+{
+    unsigned int result = 0;
+
+    for(unsigned int ccr = 0; ccr < 3; ccr++)
+    {
+        if(ccrs & (1u << ccr))
+            result |= (POVFPU_Condition(cond, ccr) ? 2 : 1);
+    }
+
+    return result;
+}
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   POVFPU_RunInterval
+*
+* INPUT
+*
+*   fn - function reference number
+*
+* OUTPUT
+*
+*   lower, upper - bounds of R0
+*
+* RETURNS
+*
+*   bool - false if the function could not be bounded
+*
+* AUTHOR
+*
+*   POV-Ray Team
+*
+* DESCRIPTION
+*
+*   Evaluates a function in interval arithmetic, giving bounds of its value
+*   over a whole box of arguments. The lower bounds of the arguments have to
+*   be placed on the stack of the first point of the batched interpreter,
+*   and the upper bounds on that of the second, using SetBatchLocal.
+*
+*   Conditional branches are followed only as long as their outcome is the
+*   same over the whole box. Where it is not, as well as where an exception
+*   might be raised or a value becomes infinite, evaluation is abandoned,
+*   and the caller has to do without the bounds.
+*
+* CHANGES
+*
+*   -
+*
+******************************************************************************/
+
+#define INTERVAL_CHECK(lo, hi) \
+    if(!(((lo) <= (hi)) && ((lo) >= -DBL_MAX) && ((hi) <= DBL_MAX))) \
+        return false;
+
+bool POVFPU_RunInterval(FPUContext *context, FUNCTION fn, DBL& lower, DBL& upper)
+{
+    vector<FunctionEntry>& functions(context->functionvm->functions);
+    vector<DBL>& consts(context->functionvm->consts);
+    vector<DBL>& globals(context->functionvm->globals);
+    StackFrame *pstack = context->pstackbase;
+    DBL **dblstack = context->batchstackbase;
+    unsigned int *maxdblstacksize = context->maxbatchstacksize;
+    DBL rlo[8], rhi[8];
+    DBL lo = 0.0, hi = 0.0;
+    DBL c = 0.0;
+    unsigned int ccrs = 0;
+    unsigned int sp = 0;
+    Instruction *program = nullptr;
+    unsigned int op = 0, s = 0, d = 0, l = 0;
+    unsigned int k = 0;
+    unsigned int pc = 0;
+    unsigned int psp = 0;
+
+    static_assert(POV_VM_BATCH_SIZE >= 2, "The interval interpreter requires the stacks of two points of the batched interpreter");
+
+    if(functions[fn].interval == false)
+        return false;
+
+    for(l = 0; l < 2; l++)
+    {
+        if(dblstack[l] == nullptr)
+            context->SetBatchLocal(l, 0, 0.0);
+    }
+    for(s = 0; s < 8; s++)
+        rlo[s] = rhi[s] = 0.0;
+
+    context->threaddata->Stats()[Ray_Function_VM_Calls]++;
+    PROFILE_START(1);
+
+    program = functions[fn].fn.program;
+
+    while(true)
+    {
+        k = GET_K(program[pc]);
+        op = GET_OP(program[pc]);
+        s = (op >> 3) & 7;
+        d = op & 7;
+        PROFILE_INSTRUCTION(op, 1);
+
+        switch(op >> 6)
+        {
+            case 0:                                                 // add   Rs, Rd
+                rlo[d] += rlo[s];
+                rhi[d] += rhi[s];
+                INTERVAL_CHECK(rlo[d], rhi[d]);
+                break;
+            case 1:                                                 // sub   Rs, Rd
+                lo = rlo[d] - rhi[s];
+                hi = rhi[d] - rlo[s];
+                INTERVAL_CHECK(lo, hi);
+                rlo[d] = lo;
+                rhi[d] = hi;
+                break;
+            case 2:                                                 // mul   Rs, Rd
+                if(s == d)
+                {
+                    // squares cannot be negative, which the general case would not know
+                    lo = rlo[d] * rlo[d];
+                    hi = rhi[d] * rhi[d];
+                    if(rlo[d] >= 0.0)
+                    {
+                        rlo[d] = lo;
+                        rhi[d] = hi;
+                    }
+                    else if(rhi[d] <= 0.0)
+                    {
+                        rlo[d] = hi;
+                        rhi[d] = lo;
+                    }
+                    else
+                    {
+                        rlo[d] = 0.0;
+                        rhi[d] = max(lo, hi);
+                    }
+                }
+                else
+                {
+                    lo = rlo[d];
+                    hi = rhi[d];
+                    rlo[d] = min(min(lo * rlo[s], lo * rhi[s]), min(hi * rlo[s], hi * rhi[s]));
+                    rhi[d] = max(max(lo * rlo[s], lo * rhi[s]), max(hi * rlo[s], hi * rhi[s]));
+                }
+                INTERVAL_CHECK(rlo[d], rhi[d]);
+                break;
+            case 3:                                                 // div   Rs, Rd
+                if((rlo[s] <= 0.0) && (rhi[s] >= 0.0))
+                    return false;
+                lo = rlo[d];
+                hi = rhi[d];
+                rlo[d] = min(min(lo / rlo[s], lo / rhi[s]), min(hi / rlo[s], hi / rhi[s]));
+                rhi[d] = max(max(lo / rlo[s], lo / rhi[s]), max(hi / rlo[s], hi / rhi[s]));
+                INTERVAL_CHECK(rlo[d], rhi[d]);
+                break;
+            case 4:                                                 // mod   Rs, Rd
+                if(!POVFPU_IntervalMod(rlo[d], rhi[d], rlo[s], rhi[s], rlo[d], rhi[d]))
+                    return false;
+                break;
+            case 5:                                                 // move  Rs, Rd
+                rlo[d] = rlo[s];
+                rhi[d] = rhi[s];
+                break;
+            case 6:                                                 // cmp   Rs, Rd
+                ccrs = 0;
+                if(rlo[s] < rhi[d])
+                    ccrs |= 1;                                      // less
+                if((rlo[s] <= rhi[d]) && (rlo[d] <= rhi[s]))
+                    ccrs |= 2;                                      // equal
+                if(rhi[s] > rlo[d])
+                    ccrs |= 4;                                      // greater
+                break;
+            case 7:                                                 // neg   Rs, Rd
+                lo = -rhi[s];
+                rhi[d] = -rlo[s];
+                rlo[d] = lo;
+                break;
+            case 8:                                                 // abs   Rs, Rd
+                lo = rlo[s];
+                hi = rhi[s];
+                if(hi <= 0.0)
+                {
+                    rlo[d] = -hi;
+                    rhi[d] = -lo;
+                }
+                else if(lo < 0.0)
+                {
+                    rlo[d] = 0.0;
+                    rhi[d] = max(-lo, hi);
+                }
+                else
+                {
+                    rlo[d] = lo;
+                    rhi[d] = hi;
+                }
+                break;
+            case 9:
+                if(s == 7)
+                    break;                                          // nop
+                c = consts[k];
+                switch(s)
+                {
+                    case 0: rlo[d] += c; rhi[d] += c; break;        // addi  k, Rd
+                    case 1: rlo[d] -= c; rhi[d] -= c; break;        // subi  k, Rd
+                    case 2:                                         // muli  k, Rd
+                        rlo[d] *= c;
+                        rhi[d] *= c;
+                        if(c < 0.0)
+                            std::swap(rlo[d], rhi[d]);
+                        break;
+                    case 3:                                         // divi  k, Rd
+                        if(c == 0.0)
+                            return false;
+                        rlo[d] /= c;
+                        rhi[d] /= c;
+                        if(c < 0.0)
+                            std::swap(rlo[d], rhi[d]);
+                        break;
+                    case 4:                                         // modi  k, Rd
+                        if(!POVFPU_IntervalMod(rlo[d], rhi[d], c, c, rlo[d], rhi[d]))
+                            return false;
+                        break;
+                    case 5: rlo[d] = rhi[d] = c; break;             // loadi k, Rd
+                    case 6:                                         // cmpi  k, Rs
+                        ccrs = 0;
+                        if(c < rhi[d])
+                            ccrs |= 1;
+                        if((c <= rhi[d]) && (rlo[d] <= c))
+                            ccrs |= 2;
+                        if(c > rlo[d])
+                            ccrs |= 4;
+                        break;
+                }
+                INTERVAL_CHECK(rlo[d], rhi[d]);
+                break;
+            case 10:
+                if(s == 6)                                          // teq   Rd
+                {
+                    lo = ((rlo[d] == 0.0) && (rhi[d] == 0.0)) ? 1.0 : 0.0;
+                    hi = ((rlo[d] <= 0.0) && (rhi[d] >= 0.0)) ? 1.0 : 0.0;
+                }
+                else if(s == 7)                                     // tne   Rd
+                {
+                    lo = ((rlo[d] > 0.0) || (rhi[d] < 0.0)) ? 1.0 : 0.0;
+                    hi = ((rlo[d] != 0.0) || (rhi[d] != 0.0)) ? 1.0 : 0.0;
+                }
+                else                                                // seq ... sge   Rd
+                {
+                    l = POVFPU_IntervalCondition(s, ccrs);
+                    lo = (l == 2) ? 1.0 : 0.0;
+                    hi = (l & 2) ? 1.0 : 0.0;
+                }
+                rlo[d] = lo;
+                rhi[d] = hi;
+                break;
+            case 11:
+                if(s == 0)                                          // load  0(k), Rd
+                    rlo[d] = rhi[d] = globals[k];
+                else if(s == 1)                                     // load  SP(k), Rd
+                {
+                    rlo[d] = dblstack[0][sp + k];
+                    rhi[d] = dblstack[1][sp + k];
+                }
+                break;
+            case 12:
+                if(s == 0)                                          // store Rs, 0(k)
+                    return false;
+                else if(s == 1)                                     // store Rs, SP(k)
+                {
+                    dblstack[0][sp + k] = rlo[d];
+                    dblstack[1][sp + k] = rhi[d];
+                }
+                break;
+            case 13:                                                // beq ... bge   k
+                if((d != 0) || (s > 5))
+                    break;                                          // nop
+                l = POVFPU_IntervalCondition(s, ccrs);
+                if(l == 3)
+                    return false;
+                if(l == 2)
+                {
+                    pc = k;
+                    continue; // prevent increment of pc
+                }
+                break;
+            case 14:
+                switch(s)
+                {
+                    case 0: if((rlo[d] <= 0.0) && (rhi[d] >= 0.0)) return false; break;    // xeq   Rd
+                    case 1: if((rlo[d] != 0.0) || (rhi[d] != 0.0)) return false; break;    // xne   Rd
+                    case 2: if(rlo[d] <  0.0) return false; break;                          // xlt   Rd
+                    case 3: if(rlo[d] <= 0.0) return false; break;                          // xle   Rd
+                    case 4: if(rhi[d] >  0.0) return false; break;                          // xgt   Rd
+                    case 5: if(rhi[d] >= 0.0) return false; break;                          // xge   Rd
+                    case 6:                                                                 // xdz   R0, Rd
+                        if((rlo[0] <= 0.0) && (rhi[0] >= 0.0) && (rlo[d] <= 0.0) && (rhi[d] >= 0.0))
+                            return false;
+                        break;
+                }
+                break;
+            case 15:
+                if(s == 0)
+                {
+                    switch(d)
+                    {
+                        case 0:                                     // jsr   k
+                            pstack[psp].pc = pc;
+                            pstack[psp].fn = fn;
+                            psp++;
+                            if(psp >= MAX_CALL_STACK_SIZE)
+                                return false;
+                            pc = k;
+                            continue; // prevent increment of pc
+                        case 1:                                     // jmp   k
+                            pc = k;
+                            continue; // prevent increment of pc
+                        case 2:                                     // rts
+                            if(psp == 0)
+                            {
+                                lower = rlo[0];
+                                upper = rhi[0];
+                                return true;
+                            }
+                            psp--;
+                            pc = pstack[psp].pc; // old position, will be incremented
+                            fn = pstack[psp].fn;
+                            program = functions[fn].fn.program;
+                            PROFILE_RETURN();
+                            break;
+                        case 3:                                     // call  k
+                            pstack[psp].pc = pc;
+                            pstack[psp].fn = fn;
+                            psp++;
+                            if(psp >= MAX_CALL_STACK_SIZE)
+                                return false;
+                            fn = k;
+                            program = functions[fn].fn.program;
+                            pc = 0;
+                            PROFILE_CALL(1);
+                            continue; // prevent increment of pc
+                        case 4:                                     // sys1  k
+                            lo = rlo[0];
+                            hi = rhi[0];
+                            switch(k)
+                            {
+                                case 0:                             // sin
+                                case 1:                             // cos
+                                    rlo[0] = min(POVFPU_Sys1Table[k](lo), POVFPU_Sys1Table[k](hi));
+                                    rhi[0] = max(POVFPU_Sys1Table[k](lo), POVFPU_Sys1Table[k](hi));
+                                    if(POVFPU_IntervalPeriodic(lo, hi, (k == 0) ? M_PI_2 : 0.0, TWO_M_PI))
+                                        rhi[0] = 1.0;
+                                    if(POVFPU_IntervalPeriodic(lo, hi, (k == 0) ? -M_PI_2 : M_PI, TWO_M_PI))
+                                        rlo[0] = -1.0;
+                                    break;
+                                case 2:                             // tan
+                                    if(POVFPU_IntervalPeriodic(lo, hi, M_PI_2, M_PI))
+                                        return false;
+                                    rlo[0] = tan(lo);
+                                    rhi[0] = tan(hi);
+                                    break;
+                                case 3:                             // asin
+                                case 4:                             // acos
+                                case 11:                            // atanh
+                                    if((lo < -1.0) || (hi > 1.0))
+                                        return false;
+                                    rlo[0] = POVFPU_Sys1Table[k](lo);
+                                    rhi[0] = POVFPU_Sys1Table[k](hi);
+                                    if(k == 4)
+                                        std::swap(rlo[0], rhi[0]);
+                                    break;
+                                case 7:                             // cosh
+                                    rlo[0] = ((lo <= 0.0) && (hi >= 0.0)) ? 1.0 : min(cosh(lo), cosh(hi));
+                                    rhi[0] = max(cosh(lo), cosh(hi));
+                                    break;
+                                case 10:                            // acosh
+                                    if(lo < 1.0)
+                                        return false;
+                                    rlo[0] = acosh(lo);
+                                    rhi[0] = acosh(hi);
+                                    break;
+                                case 14:                            // sqrt
+                                    if(lo < 0.0)
+                                        return false;
+                                    rlo[0] = sqrt(lo);
+                                    rhi[0] = sqrt(hi);
+                                    break;
+                                case 16:                            // log
+                                case 17:                            // log10
+                                    if(lo <= 0.0)
+                                        return false;
+                                    rlo[0] = POVFPU_Sys1Table[k](lo);
+                                    rhi[0] = POVFPU_Sys1Table[k](hi);
+                                    break;
+                                case 5:                             // atan
+                                case 6:                             // sinh
+                                case 8:                             // tanh
+                                case 9:                             // asinh
+                                case 12:                            // floor
+                                case 13:                            // ceil
+                                case 15:                            // exp
+                                case 18:                            // int
+                                    rlo[0] = POVFPU_Sys1Table[k](lo);
+                                    rhi[0] = POVFPU_Sys1Table[k](hi);
+                                    break;
+                                default:
+                                    return false;
+                            }
+                            INTERVAL_CHECK(rlo[0], rhi[0]);
+                            break;
+                        case 5:                                     // sys2  k
+                            switch(k)
+                            {
+                                case TRAP_SYS2_POW:
+                                    c = rlo[1];
+                                    if((c == rhi[1]) && (c == floor(c)))
+                                    {
+                                        // integer powers are monotonic on either side of zero
+                                        lo = pow(rlo[0], c);
+                                        hi = pow(rhi[0], c);
+                                        if((rlo[0] > 0.0) || (rhi[0] < 0.0) || (c == 0.0))
+                                            POVFPU_IntervalCorners(pow, rlo[0], rhi[0], c, c, rlo[0], rhi[0]);
+                                        else if(c < 0.0)
+                                            return false;
+                                        else if(fmod(c, 2.0) == 0.0)
+                                        {
+                                            rlo[0] = 0.0;
+                                            rhi[0] = max(lo, hi);
+                                        }
+                                        else
+                                        {
+                                            rlo[0] = lo;
+                                            rhi[0] = hi;
+                                        }
+                                    }
+                                    else if((rlo[0] > 0.0) || ((rlo[0] == 0.0) && (c > 0.0)))
+                                        POVFPU_IntervalCorners(pow, rlo[0], rhi[0], c, rhi[1], rlo[0], rhi[0]);
+                                    else
+                                        return false;
+                                    break;
+                                case TRAP_SYS2_ATAN2:
+                                    // avoid the discontinuity along the negative x axis
+                                    if((rlo[1] > 0.0) || (rlo[0] > 0.0) || (rhi[0] < 0.0))
+                                        POVFPU_IntervalCorners(atan2, rlo[0], rhi[0], rlo[1], rhi[1], rlo[0], rhi[0]);
+                                    else
+                                        return false;
+                                    break;
+                                case TRAP_SYS2_MOD:
+                                    if(!POVFPU_IntervalMod(rlo[0], rhi[0], rlo[1], rhi[1], rlo[0], rhi[0]))
+                                        return false;
+                                    break;
+                                case TRAP_SYS2_DIV:
+                                    if((rlo[1] <= 0.0) && (rhi[1] >= 0.0))
+                                        return false;
+                                    POVFPU_IntervalCorners(math_div, rlo[0], rhi[0], rlo[1], rhi[1], rlo[0], rhi[0]);
+                                    break;
+                                default:
+                                    return false;
+                            }
+                            INTERVAL_CHECK(rlo[0], rhi[0]);
+                            break;
+                        default:                                    // trap  k, traps k
+                            return false;
+                    }
+                }
+                else if(s == 1)
+                {
+                    switch(d)
+                    {
+                        case 0:                                     // grow  k
+                            if((unsigned int)((unsigned int)sp + (unsigned int)k) >= (unsigned int)MAX_K)
+                                return false;
+                            for(l = 0; l < 2; l++)
+                            {
+                                if(sp + k >= maxdblstacksize[l])
+                                {
+                                    unsigned int newsize = maxdblstacksize[l] + max(k + 1, (unsigned int)INITIAL_DBL_STACK_SIZE);
+                                    dblstack[l] = context->ResizeStack(dblstack[l], maxdblstacksize[l], newsize);
+                                    maxdblstacksize[l] = newsize;
+                                }
+                            }
+                            break;
+                        case 1:                                     // push  k
+                            if((sp + k >= maxdblstacksize[0]) || (sp + k >= maxdblstacksize[1]))
+                                return false;
+                            sp += k;
+                            break;
+                        case 2:                                     // pop   k
+                            if(k > sp)
+                                return false;
+                            sp -= k;
+                            break;
+                    }
+                }
+                break;
+        }
+
+        pc++;
+    }
+}
+
+#undef INTERVAL_CHECK
+
+/*****************************************************************************
+*
+* FUNCTION
+*
+*   FNCode_Delete
+*
+* INPUT
+*
+*   f - function to delete
+*
+* OUTPUT
+*
+* RETURNS
+*
+* AUTHOR
+*
+*   Thorsten Froehlich
 *
 * DESCRIPTION
 *
@@ -1601,11 +3169,54 @@ DBL FunctionVM::CustomFunction::Execute(GenericFunctionContextPtr pGenericContex
     return POVFPU_Run (pContext, *mpFn);
 }
 
+void FunctionVM::CustomFunction::ExecuteBatch(GenericFunctionContextPtr pGenericContext, const DBL* args, unsigned int argCount, unsigned int count, DBL* results)
+{
+    FPUContext* pContext = GetFPUContextPtr(pGenericContext);
+
+#if POV_VM_JIT
+    // native code beats interpreting several points at once
+    if (mpVm->functions[*mpFn].jit.code != nullptr)
+    {
+        GenericScalarFunction::ExecuteBatch(pGenericContext, args, argCount, count, results);
+        return;
+    }
+#endif
+
+    while (count > 0)
+    {
+        unsigned int n = min(count, (unsigned int)POV_VM_BATCH_SIZE);
+
+        for (unsigned int i = 0; i < n; i++)
+            for (unsigned int j = 0; j < argCount; j++)
+                pContext->SetBatchLocal(i, j, args[i * argCount + j]);
+
+        if (!POVFPU_RunBatch(pContext, *mpFn, n, results))
+            GenericScalarFunction::ExecuteBatch(pGenericContext, args, argCount, n, results);
+
+        args += n * argCount;
+        results += n;
+        count -= n;
+    }
+}
+
 GenericScalarFunctionPtr FunctionVM::CustomFunction::Clone() const
 {
     return new CustomFunction(mpVm.get(), mpVm->CopyFunction(mpFn));
 }
 
+bool FunctionVM::CustomFunction::ExecuteInterval(GenericFunctionContextPtr pGenericContext, const DBL* lower, const DBL* upper, unsigned int argCount, DBL& lowerResult, DBL& upperResult)
+{
+    FPUContext* pContext = GetFPUContextPtr(pGenericContext);
+
+    for (unsigned int j = 0; j < argCount; j++)
+    {
+        pContext->SetBatchLocal(0, j, lower[j]);
+        pContext->SetBatchLocal(1, j, upper[j]);
+    }
+
+    return POVFPU_RunInterval(pContext, *mpFn, lowerResult, upperResult);
+}
+
 const CustomFunctionSourceInfo* FunctionVM::CustomFunction::GetSourceInfo() const
 {
     return &(mpVm->GetFunction(*mpFn)->sourceInfo);
@@ -1627,17 +3238,144 @@ GenericFunctionContextPtr FunctionVM::CreateFunctionContext(TraceThreadData* pTd
     return new FPUContext(this, pTd);
 }
 
+void FunctionVM::PreallocateContexts(TraceThreadData* pTd)
+{
+    size_t count = 0;
+
+    for(vector<FunctionEntry>::const_iterator i = functions.begin(); i != functions.end(); ++i)
+    {
+        if(i->reference_count != 0)
+            count++;
+    }
+
+    count = min(count, (size_t)POV_VM_PREALLOCATED_CONTEXTS);
+
+    pTd->functionContextPool.reserve(count);
+    while(pTd->functionContextPool.size() < count)
+        pTd->functionContextPool.push_back(new FPUContext(this, pTd));
+}
+
+
+#if POV_VM_PROFILE
+
+static bool POVFPU_CompareProfile(const CustomFunctionProfile& a, const CustomFunctionProfile& b)
+{
+    return (a.instructions > b.instructions);
+}
+
+static bool POVFPU_CompareOpcodeProfile(const CustomFunctionOpcodeProfile& a, const CustomFunctionOpcodeProfile& b)
+{
+    return (a.count > b.count);
+}
+
+void FunctionVM::GetProfile(vector<CustomFunctionProfile>& functionProfiles, vector<CustomFunctionOpcodeProfile>& opcodeProfiles) const
+{
+    boost::mutex::scoped_lock lock(profileMutex);
+    vector<FunctionProfile> totalProfile(profile);
+    vector<POV_ULONG> totalOpcodes(opcodeprofile);
+
+    for(std::set<FPUContext *>::const_iterator i = profileContexts.begin(); i != profileContexts.end(); i++)
+        POVFPU_MergeProfile(totalProfile, totalOpcodes, (*i)->profile, (*i)->opcodeprofile);
+
+    functionProfiles.clear();
+    for(FUNCTION fn = 0; (fn < totalProfile.size()) && (fn < functions.size()); fn++)
+    {
+        // statistics of functions since removed may have been merged into those of functions
+        // re-using their reference number; this is a diagnostic, so we don't mind
+        if((totalProfile[fn].calls == 0) || (functions[fn].reference_count == 0))
+            continue;
+
+        CustomFunctionProfile p;
+        p.sourceInfo = functions[fn].fn.sourceInfo;
+        p.calls = totalProfile[fn].calls;
+        p.instructions = totalProfile[fn].instructions;
+        p.time = DBL(totalProfile[fn].time) * 1.0e-9;
+        functionProfiles.push_back(p);
+    }
+    std::sort(functionProfiles.begin(), functionProfiles.end(), POVFPU_CompareProfile);
+
+    // add up the different register and addressing variants of each instruction
+    opcodeProfiles.clear();
+    for(unsigned int op = 0; op < totalOpcodes.size(); op++)
+    {
+        if(totalOpcodes[op] == 0)
+            continue;
+
+        const char *name = "unknown";
+        for(unsigned int ii = 0; POVFPU_Opcodes[ii].name != nullptr; ii++)
+        {
+            unsigned int mask = 0x03FF;
+            if((POVFPU_Opcodes[ii].type == ITYPE_R) || (POVFPU_Opcodes[ii].type == ITYPE_M))
+                mask = 0x03C0;
+            else if((POVFPU_Opcodes[ii].type == ITYPE_I) || (POVFPU_Opcodes[ii].type == ITYPE_S))
+                mask = 0x03F8;
+            if(POVFPU_Opcodes[ii].code == (op & mask))
+            {
+                name = POVFPU_Opcodes[ii].name;
+                break;
+            }
+        }
+
+        size_t i = 0;
+        while((i < opcodeProfiles.size()) && (strcmp(opcodeProfiles[i].name, name) != 0))
+            i++;
+        if(i == opcodeProfiles.size())
+        {
+            CustomFunctionOpcodeProfile p;
+            p.name = name;
+            p.count = 0;
+            opcodeProfiles.push_back(p);
+        }
+        opcodeProfiles[i].count += totalOpcodes[op];
+    }
+    std::sort(opcodeProfiles.begin(), opcodeProfiles.end(), POVFPU_CompareOpcodeProfile);
+}
+
+void FunctionVM::AddProfileContext(FPUContext *context)
+{
+    boost::mutex::scoped_lock lock(profileMutex);
+
+    profileContexts.insert(context);
+}
+
+void FunctionVM::RemoveProfileContext(FPUContext *context)
+{
+    boost::mutex::scoped_lock lock(profileMutex);
+
+    POVFPU_MergeProfile(profile, opcodeprofile, context->profile, context->opcodeprofile);
+    profileContexts.erase(context);
+}
+
+#endif // POV_VM_PROFILE
 
 /*****************************************************************************/
 
 FPUContext::FPUContext(FunctionVM* pVm, TraceThreadData* pThreadData) :
     maxdblstacksize(INITIAL_DBL_STACK_SIZE),
-    dblstackbase(reinterpret_cast<DBL *>(POV_MALLOC(sizeof(DBL) * INITIAL_DBL_STACK_SIZE, "fn: dblstack"))),
-    pstackbase(reinterpret_cast<StackFrame *>(POV_MALLOC(sizeof(StackFrame) * MAX_CALL_STACK_SIZE, "fn: pstack"))),
     functionvm(pVm),
     threaddata(pThreadData),
     nextArgument(0)
 {
+    // The value stacks (the context's own plus one per batch lane) and the call stack all start
+    // out in a single block, so that setting up a context takes just one allocation.
+    arena = reinterpret_cast<char *>(POV_MALLOC(sizeof(DBL) * INITIAL_DBL_STACK_SIZE * (POV_VM_BATCH_SIZE + 1) +
+                                                sizeof(StackFrame) * MAX_CALL_STACK_SIZE, "fn: stacks"));
+
+    dblstackbase = reinterpret_cast<DBL *>(arena);
+    for(unsigned int i = 0; i < POV_VM_BATCH_SIZE; i++)
+    {
+        batchstackbase[i] = dblstackbase + INITIAL_DBL_STACK_SIZE * (i + 1);
+        maxbatchstacksize[i] = INITIAL_DBL_STACK_SIZE;
+    }
+    pstackbase = reinterpret_cast<StackFrame *>(dblstackbase + INITIAL_DBL_STACK_SIZE * (POV_VM_BATCH_SIZE + 1));
+
+#if POV_VM_PROFILE
+    #if POV_VM_PROFILE > 1
+    opcodeprofile.resize(1024, 0);
+    #endif
+    functionvm->AddProfileContext(this);
+#endif
+
     #if (SYS_FUNCTIONS == 1)
     context->dblstack = context->dblstackbase;
     #endif
@@ -1645,8 +3383,37 @@ FPUContext::FPUContext(FunctionVM* pVm, TraceThreadData* pThreadData) :
 
 FPUContext::~FPUContext()
 {
-    POV_FREE(dblstackbase);
-    POV_FREE(pstackbase);
+#if POV_VM_PROFILE
+    functionvm->RemoveProfileContext(this);
+#endif
+
+    FreeStack(dblstackbase);
+    for(unsigned int i = 0; i < POV_VM_BATCH_SIZE; i++)
+        FreeStack(batchstackbase[i]);
+    POV_FREE(arena);
+}
+
+bool FPUContext::InArena(const DBL *stack) const
+{
+    const DBL *base = reinterpret_cast<const DBL *>(arena);
+
+    return ((stack >= base) && (stack < base + INITIAL_DBL_STACK_SIZE * (POV_VM_BATCH_SIZE + 1)));
+}
+
+DBL *FPUContext::ResizeStack(DBL *stack, unsigned int oldsize, unsigned int newsize)
+{
+    if(!InArena(stack))
+        return reinterpret_cast<DBL *>(POV_REALLOC(stack, sizeof(DBL) * newsize, "fn: stack"));
+
+    DBL *moved = reinterpret_cast<DBL *>(POV_MALLOC(sizeof(DBL) * newsize, "fn: stack"));
+    memcpy(moved, stack, sizeof(DBL) * min(oldsize, newsize));
+    return moved;
+}
+
+void FPUContext::FreeStack(DBL *stack)
+{
+    if(!InArena(stack))
+        POV_FREE(stack);
 }
 
 }
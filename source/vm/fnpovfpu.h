@@ -42,9 +42,15 @@
 // Module config header file must be the first file included within POV-Ray unit header files
 #include "vm/configvm.h"
 
+#include <map>
 #include <set>
+#include <string>
 #include <vector>
 
+#if POV_VM_PROFILE
+#include <boost/thread.hpp>
+#endif
+
 #include "base/textstream.h"
 
 #include "core/coretypes.h"
@@ -132,19 +138,51 @@ struct FunctionCode
     FNCODE_PRIVATE_COPY_METHOD private_copy_method;
     FNCODE_PRIVATE_DESTROY_METHOD private_destroy_method;
     void *private_data;
+    unsigned int cache_id; // entry in the cache of compiled functions, or 0 if not cached
 };
 
 typedef unsigned int FUNCTION;
 typedef FUNCTION * FUNCTION_PTR;
 
+#if POV_VM_JIT
+struct FunctionJITFrame;
+
+/// Native code translated from a function.
+/// @return     Non-zero if an exception was thrown by code called from the native code.
+typedef int (*FunctionJITCode)(FunctionJITFrame *frame, unsigned int sp, DBL *result);
+
+struct FunctionJIT
+{
+    FunctionJITCode code;       ///< Entry point, or `nullptr` if the function is interpreted.
+    void *memory;               ///< Executable memory holding the code.
+    size_t size;                ///< Size of the executable memory.
+};
+#endif
+
 struct FunctionEntry
 {
     FunctionCode fn;            // valid if reference_count != 0
     FUNCTION next_unreferenced; // valid if reference_count == 0
     unsigned int reference_count;
+    bool interval;              // valid if reference_count != 0; false if POVFPU_RunInterval is bound to fail
+#if POV_VM_JIT
+    FunctionJIT jit;            // valid if reference_count != 0
+#endif
     SYS_FUNCTION_ENTRY
 };
 
+#if POV_VM_PROFILE
+/// Run-time statistics of a function, as gathered by a single context.
+struct FunctionProfile
+{
+    POV_ULONG calls;            ///< Number of calls, including those from other functions.
+    POV_ULONG instructions;     ///< Number of instructions executed, not counting those of functions called.
+    POV_ULONG time;             ///< Time in nanoseconds spent in calls from outside, including functions called.
+
+    FunctionProfile() : calls(0), instructions(0), time(0) {}
+};
+#endif
+
 struct StackFrame
 {
     unsigned int pc;
@@ -166,9 +204,30 @@ class FPUContext : public GenericFunctionContext
         DBL *dblstack;
         #endif
         int nextArgument;
+        DBL *batchstackbase[POV_VM_BATCH_SIZE];         ///< Per-point stacks of the batched interpreter, allocated on demand.
+        unsigned int maxbatchstacksize[POV_VM_BATCH_SIZE];
 
         void SetLocal(unsigned int k, DBL v);
         DBL GetLocal(unsigned int k);
+        void SetBatchLocal(unsigned int lane, unsigned int k, DBL v);
+
+        /// Resize one of the context's value stacks.
+        ///
+        /// Stacks still in the context's arena are moved to the heap, all others are reallocated.
+        ///
+        DBL *ResizeStack(DBL *stack, unsigned int oldsize, unsigned int newsize);
+
+#if POV_VM_PROFILE
+        vector<FunctionProfile> profile;    ///< Statistics per function reference number.
+        vector<POV_ULONG> opcodeprofile;    ///< Number of times each instruction was executed, per opcode.
+#endif
+
+    private:
+        /// Single block holding the call stack and the initial value stacks.
+        char *arena;
+
+        bool InArena(const DBL *stack) const;
+        void FreeStack(DBL *stack);
 };
 
 
@@ -243,6 +302,11 @@ extern const unsigned int POVFPU_Sys2TableSize;
 
 void POVFPU_Exception(FPUContext *context, FUNCTION fn, const char *msg = nullptr);
 DBL POVFPU_RunDefault(FPUContext *context, FUNCTION k);
+bool POVFPU_RunBatch(FPUContext *context, FUNCTION k, unsigned int count, DBL *results);
+bool POVFPU_RunInterval(FPUContext *context, FUNCTION k, DBL& lower, DBL& upper);
+#if POV_VM_JIT
+DBL POVFPU_RunJIT(FPUContext *context, FUNCTION k);
+#endif
 
 void FNCode_Delete(FunctionCode *);
 
@@ -250,6 +314,11 @@ class FunctionVM : public GenericFunctionContextFactory
 {
         friend void POVFPU_Exception(FPUContext *, FUNCTION, const char *);
         friend DBL POVFPU_RunDefault(FPUContext *, FUNCTION);
+        friend bool POVFPU_RunBatch(FPUContext *, FUNCTION, unsigned int, DBL *);
+        friend bool POVFPU_RunInterval(FPUContext *, FUNCTION, DBL&, DBL&);
+#if POV_VM_JIT
+        friend DBL POVFPU_RunJIT(FPUContext *, FUNCTION);
+#endif
 
     public:
 
@@ -263,6 +332,8 @@ class FunctionVM : public GenericFunctionContextFactory
                 virtual void InitArguments(GenericFunctionContextPtr pContext);
                 virtual void PushArgument(GenericFunctionContextPtr pContext, DBL arg);
                 virtual DBL Execute(GenericFunctionContextPtr pContext);
+                virtual void ExecuteBatch(GenericFunctionContextPtr pContext, const DBL* args, unsigned int argCount, unsigned int count, DBL* results);
+                virtual bool ExecuteInterval(GenericFunctionContextPtr pContext, const DBL* lower, const DBL* upper, unsigned int argCount, DBL& lowerResult, DBL& upperResult);
                 virtual GenericScalarFunctionPtr Clone() const;
                 virtual const CustomFunctionSourceInfo* GetSourceInfo() const;
             protected:
@@ -287,10 +358,21 @@ class FunctionVM : public GenericFunctionContextFactory
         FUNCTION AddFunction(FunctionCode *f);
         void RemoveFunction(FUNCTION fn);
 
+        bool LoadCachedFunction(const std::string& key, FunctionCode& f, const std::map<unsigned int, FUNCTION>& callees);
+        void StoreCachedFunction(const std::string& key, FunctionCode& f);
+
         FUNCTION_PTR CopyFunction(FUNCTION_PTR pK);
         void DestroyFunction(FUNCTION_PTR pK);
 
         virtual GenericFunctionContextPtr CreateFunctionContext(TraceThreadData* pTd);
+        virtual void PreallocateContexts(TraceThreadData* pTd);
+
+#if POV_VM_PROFILE
+        virtual void GetProfile(vector<CustomFunctionProfile>& functions, vector<CustomFunctionOpcodeProfile>& opcodes) const;
+
+        void AddProfileContext(FPUContext *context);
+        void RemoveProfileContext(FPUContext *context);
+#endif
 
     private:
 
@@ -298,6 +380,13 @@ class FunctionVM : public GenericFunctionContextFactory
         FUNCTION nextUnreferenced;
         vector<DBL> globals;
         vector<DBL> consts;
+
+#if POV_VM_PROFILE
+        mutable boost::mutex profileMutex;
+        std::set<FPUContext *> profileContexts;     ///< Contexts currently gathering statistics.
+        vector<FunctionProfile> profile;            ///< Statistics of contexts already destroyed.
+        vector<POV_ULONG> opcodeprofile;
+#endif
 };
 
 }
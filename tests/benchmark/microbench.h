@@ -0,0 +1,215 @@
+//******************************************************************************
+///
+/// @file tests/benchmark/microbench.h
+///
+/// Common declarations for POV-Ray subsystem microbenchmarks.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+#ifndef POVRAY_MICROBENCH_H
+#define POVRAY_MICROBENCH_H
+
+// C++ variants of C standard header files
+// (none at the moment)
+
+// C++ standard header files
+#include <chrono>
+#include <string>
+#include <vector>
+
+// POV-Ray header files (base module)
+#include "base/types.h"
+
+// POV-Ray header files (core module)
+#include "core/coretypes.h"
+
+namespace pov
+{
+class SceneData;
+class TraceThreadData;
+}
+
+namespace pov_microbench
+{
+
+//##############################################################################
+///
+/// @defgroup PovMicrobench Subsystem Microbenchmarks
+///
+/// Focused, reproducible timings of individual hot paths.
+///
+/// Each microbenchmark prepares a fixed workload from a deterministic random sequence, then
+/// processes it repeatedly for a minimum amount of time, reporting the number of items
+/// (points, rays, tokens, pixels etc.) handled. The driver repeats every microbenchmark a few
+/// times and writes the median, minimum and maximum throughput as JSON for trend tracking.
+///
+/// @{
+
+/// Measurement state handed to a microbenchmark.
+///
+/// A microbenchmark performs its set-up, then loops as long as @ref KeepRunning() returns
+/// `true`, reporting the number of items processed in each pass via @ref AddItems(). The clock
+/// starts with the first call to @ref KeepRunning(), so set-up is not included in the timing.
+///
+/// @note
+///     The overhead of @ref KeepRunning() is that of reading the clock, so each pass should do
+///     a reasonable amount of work, i.e. a batch of items rather than a single one.
+///
+class MicrobenchState final
+{
+    public:
+
+        explicit MicrobenchState(double minTime);
+
+        /// Check whether another pass is required.
+        bool KeepRunning();
+
+        /// Account for items processed in the current pass.
+        void AddItems(POV_ULONG items) { mItems += items; }
+
+        /// Attach a free-form note to the result, e.g. the implementation variant measured.
+        void SetLabel(const std::string& label) { mLabel = label; }
+
+        /// Mark the microbenchmark as not applicable to this build.
+        void Skip(const std::string& reason) { mSkipReason = reason; }
+
+        double GetSeconds() const { return mSeconds; }
+        POV_ULONG GetItems() const { return mItems; }
+        const std::string& GetLabel() const { return mLabel; }
+        const std::string& GetSkipReason() const { return mSkipReason; }
+        bool IsSkipped() const { return !mSkipReason.empty(); }
+
+    private:
+
+        typedef std::chrono::steady_clock Clock;
+
+        Clock::time_point   mStart;
+        double              mMinTime;
+        double              mSeconds;
+        POV_ULONG           mItems;
+        bool                mStarted;
+        std::string         mLabel;
+        std::string         mSkipReason;
+};
+
+typedef void (*MicrobenchFunction)(MicrobenchState& state);
+
+struct MicrobenchInfo
+{
+    const char*         group;
+    const char*         name;
+    const char*         unit;       ///< What the items counted by the microbenchmark are.
+    MicrobenchFunction  function;
+};
+
+/// Get the list of all microbenchmarks, in order of registration.
+std::vector<MicrobenchInfo>& GetMicrobenchRegistry();
+
+struct MicrobenchRegistrar final
+{
+    MicrobenchRegistrar(const char* group, const char* name, const char* unit, MicrobenchFunction function);
+};
+
+/// Define and register a microbenchmark.
+///
+/// The macro is to be followed by the function body, which receives a @ref MicrobenchState
+/// named `state`.
+///
+#define POV_MICROBENCH(group,name,unit) \
+    static void Microbench_##group##_##name(pov_microbench::MicrobenchState& state); \
+    static pov_microbench::MicrobenchRegistrar gMicrobenchRegistrar_##group##_##name(#group, #name, unit, Microbench_##group##_##name); \
+    static void Microbench_##group##_##name(pov_microbench::MicrobenchState& state)
+
+/// Keep the compiler from discarding a computation whose result is otherwise unused.
+void KeepResult(double value);
+
+/// Deterministic pseudo-random number generator.
+///
+/// The sequence depends on nothing but the seed, so every run of a microbenchmark processes
+/// the exact same workload, regardless of platform or standard library.
+///
+class MicrobenchRandom final
+{
+    public:
+
+        explicit MicrobenchRandom(POV_UINT32 seed = 2463534242u) : mState(seed) {}
+
+        /// Get a value in the range [0,1).
+        double operator()()
+        {
+            // xorshift32
+            mState ^= mState << 13;
+            mState ^= mState >> 17;
+            mState ^= mState << 5;
+            return mState * (1.0 / 4294967296.0);
+        }
+
+        /// Get a value in the range [lo,hi).
+        double operator()(double lo, double hi) { return lo + (hi - lo) * (*this)(); }
+
+        /// Get a point in the axis-aligned box [lo,hi).
+        pov::Vector3d Point(double lo, double hi);
+
+        /// Get a direction uniformly distributed over the unit sphere.
+        pov::Vector3d Direction();
+
+    private:
+
+        POV_UINT32 mState;
+};
+
+/// Minimal scene and per-thread data, for exercising core code outside of a render.
+class MicrobenchScene final
+{
+    public:
+
+        MicrobenchScene();
+        ~MicrobenchScene();
+
+        const shared_ptr<pov::SceneData>& GetSceneData() const { return mpSceneData; }
+        pov::TraceThreadData* GetThreadData() const { return mpThreadData; }
+
+    private:
+
+        shared_ptr<pov::SceneData>  mpSceneData;
+        pov::TraceThreadData*       mpThreadData;
+
+        MicrobenchScene(const MicrobenchScene&);
+        MicrobenchScene& operator=(const MicrobenchScene&);
+};
+
+/// @}
+///
+//##############################################################################
+
+}
+
+#endif // POVRAY_MICROBENCH_H
@@ -0,0 +1,205 @@
+//******************************************************************************
+///
+/// @file tests/benchmark/microbench_bounding.cpp
+///
+/// Microbenchmarks of the bounding hierarchy traversal methods.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+// configcore.h must always be the first POV file included within core *.cpp files
+// (and as we're exercising core code, we should consider ourselves part of it);
+// microbench.h must follow suite.
+#include "core/configcore.h"
+#include "microbench.h"
+
+// POV-Ray header files (core module)
+#include "core/bounding/boundingbox.h"
+#include "core/bounding/bsptree.h"
+#include "core/bounding/flatbvh.h"
+#include "core/render/ray.h"
+#include "core/render/trace.h"
+#include "core/scene/object.h"
+#include "core/scene/scenedata.h"
+#include "core/scene/tracethreaddata.h"
+#include "core/shape/sphere.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_microbench
+{
+
+using namespace pov;
+
+const int kBoundingObjects = 20000;
+const int kBoundingRays = 4096;
+
+/// Scene of small spheres scattered throughout a cube, plus rays crossing it.
+class BoundingWorkload final
+{
+    public:
+
+        MicrobenchScene scene;
+        TraceTicket ticket;
+        vector<ObjectPtr> objects;
+        std::vector<Ray> rays;
+
+        BoundingWorkload() :
+            ticket(1, 0.0)
+        {
+            MicrobenchRandom rng;
+
+            objects.reserve(kBoundingObjects);
+            for (int i = 0; i < kBoundingObjects; i++)
+            {
+                Sphere* object = new Sphere();
+                object->Center = rng.Point(-20.0, 20.0);
+                object->Radius = rng(0.05, 0.4);
+                object->Compute_BBox();
+                objects.push_back(object);
+            }
+
+            rays.reserve(kBoundingRays);
+            for (int i = 0; i < kBoundingRays; i++)
+                rays.push_back(Ray(ticket, rng.Point(-20.0, 20.0), rng.Direction()));
+        }
+
+        ~BoundingWorkload()
+        {
+            Destroy_Object(objects);
+        }
+};
+
+class BoundingObjects final : public BSPTree::Objects
+{
+    public:
+
+        BoundingObjects(const vector<ObjectPtr>& objects) : mObjects(objects) {}
+
+        virtual unsigned int size() const { return mObjects.size(); }
+        virtual float GetMin(unsigned int axis, unsigned int i) const { return mObjects[i]->BBox.lowerLeft[axis]; }
+        virtual float GetMax(unsigned int axis, unsigned int i) const { return (mObjects[i]->BBox.lowerLeft[axis] + mObjects[i]->BBox.size[axis]); }
+
+    private:
+
+        const vector<ObjectPtr>& mObjects;
+};
+
+class BoundingProgress final : public BSPTree::Progress
+{
+    public:
+
+        virtual void operator()(unsigned int) const {}
+};
+
+static void RunBBoxTree(MicrobenchState& state, BBoxTreeBuildMethod method, bool flatten)
+{
+    BoundingWorkload workload;
+    TraceThreadData* threadData = workload.scene.GetThreadData();
+
+    BBOX_TREE* root = nullptr;
+    unsigned int numberOfFiniteObjects, numberOfInfiniteObjects, numberOfLightSources;
+    Build_Bounding_Slabs(&root, workload.objects, numberOfFiniteObjects, numberOfInfiniteObjects, numberOfLightSources, method);
+
+    FlatBVH* flatBVH = nullptr;
+    FlatBVH::TraversalStack flatStack;
+    if (flatten)
+        flatBVH = new FlatBVH(root);
+
+    BBoxTraversalStack stack;
+    POV_ULONG hits = 0;
+    while (state.KeepRunning())
+    {
+        for (std::vector<Ray>::const_iterator i = workload.rays.begin(); i != workload.rays.end(); ++i)
+        {
+            Intersection isect;
+            bool found;
+            if (flatBVH != nullptr)
+                found = flatBVH->Intersect(flatStack, *i, &isect, threadData);
+            else
+                found = Intersect_BBox_Tree(stack, root, *i, &isect, threadData);
+            if (found)
+                hits++;
+        }
+        state.AddItems(workload.rays.size());
+    }
+    KeepResult(double(hits));
+
+    delete flatBVH;
+    Destroy_BBox_Tree(root);
+}
+
+POV_MICROBENCH(bounding, slabs, "rays")
+{
+    RunBBoxTree(state, kBBoxTreeBuild_Slabs, false);
+}
+
+POV_MICROBENCH(bounding, sah, "rays")
+{
+    RunBBoxTree(state, kBBoxTreeBuild_BinnedSAH, false);
+}
+
+POV_MICROBENCH(bounding, flat_bvh, "rays")
+{
+    RunBBoxTree(state, kBBoxTreeBuild_BinnedSAH, true);
+}
+
+POV_MICROBENCH(bounding, bsp, "rays")
+{
+    BoundingWorkload workload;
+    TraceThreadData* threadData = workload.scene.GetThreadData();
+    const SceneData& sceneData = *workload.scene.GetSceneData();
+
+    unsigned int nodes, splitNodes, objectNodes, emptyNodes, maxObjects, maxDepth, aborts;
+    float averageObjects, averageDepth, averageAborts, averageAbortObjects;
+    BSPTree tree(sceneData.bspMaxDepth, sceneData.bspObjectIsectCost, sceneData.bspBaseAccessCost, sceneData.bspChildAccessCost, sceneData.bspMissChance);
+    tree.build(BoundingProgress(), BoundingObjects(workload.objects),
+               nodes, splitNodes, objectNodes, emptyNodes, maxObjects, averageObjects, maxDepth, averageDepth,
+               aborts, averageAborts, averageAbortObjects, UCS2String());
+
+    BSPTree::Mailbox mailbox(workload.objects.size());
+    POV_ULONG hits = 0;
+    while (state.KeepRunning())
+    {
+        for (std::vector<Ray>::const_iterator i = workload.rays.begin(); i != workload.rays.end(); ++i)
+        {
+            Intersection isect;
+            BSPIntersectFunctor ifn(isect, *i, workload.objects, threadData);
+            mailbox.clear();
+            if (tree(*i, ifn, mailbox, isect.Depth))
+                hits++;
+        }
+        state.AddItems(workload.rays.size());
+    }
+    KeepResult(double(hits));
+}
+
+}
@@ -0,0 +1,127 @@
+//******************************************************************************
+///
+/// @file tests/benchmark/microbench_image.cpp
+///
+/// Microbenchmarks of image file encoding.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+// configbase.h must always be the first POV file included within base *.cpp files
+// (and as we're exercising base code, we should consider ourselves part of it);
+// microbench.h must follow suite.
+#include "base/configbase.h"
+#include "microbench.h"
+
+// C++ variants of C standard header files
+#include <cstdio>
+
+// C++ standard header files
+#include <memory>
+
+// POV-Ray header files (base module)
+#include "base/fileinputoutput.h"
+#include "base/stringutilities.h"
+#include "base/image/colourspace.h"
+#include "base/image/image.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_microbench
+{
+
+using namespace pov_base;
+
+const unsigned int kImageSize = 512;
+const char* const kImageFileName = "povbench.tmp";
+
+/// Create an image resembling a render: smooth gradients with a bit of noise.
+static Image* MakeImage()
+{
+    MicrobenchRandom rng;
+    Image* image = Image::Create(kImageSize, kImageSize, Image::RGBFT_Float);
+    for (unsigned int y = 0; y < kImageSize; y++)
+    {
+        for (unsigned int x = 0; x < kImageSize; x++)
+        {
+            float u = float(x) / kImageSize;
+            float v = float(y) / kImageSize;
+            float n = float(rng(-0.02, 0.02));
+            image->SetRGBFTValue(x, y, u + n, v + n, 0.5f * (u + v) + n, 0.0f, 0.0f);
+        }
+    }
+    return image;
+}
+
+static void RunImageEncode(MicrobenchState& state, Image::ImageFileType type, unsigned char bitsPerChannel)
+{
+    std::unique_ptr<Image> image(MakeImage());
+
+    Image::WriteOptions options;
+    options.workingGamma = NeutralGammaCurve::Get();
+    options.encodingGamma = SRGBGammaCurve::Get();
+    options.bitsPerChannel = bitsPerChannel;
+
+    while (state.KeepRunning())
+    {
+        OStream file(ASCIItoUCS2String(kImageFileName));
+        if (!file)
+        {
+            state.Skip("cannot create temporary file");
+            break;
+        }
+        Image::Write(type, &file, image.get(), options);
+        state.AddItems(kImageSize * kImageSize);
+    }
+
+    std::remove(kImageFileName);
+}
+
+POV_MICROBENCH(image, png_encode, "pixels")
+{
+    RunImageEncode(state, Image::PNG, 8);
+}
+
+POV_MICROBENCH(image, png_encode_16bit, "pixels")
+{
+    RunImageEncode(state, Image::PNG, 16);
+}
+
+POV_MICROBENCH(image, exr_encode, "pixels")
+{
+#ifndef OPENEXR_MISSING
+    RunImageEncode(state, Image::EXR, 16);
+#else
+    state.Skip("built without OpenEXR support");
+#endif
+}
+
+}
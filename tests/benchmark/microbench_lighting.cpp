@@ -0,0 +1,135 @@
+//******************************************************************************
+///
+/// @file tests/benchmark/microbench_lighting.cpp
+///
+/// Microbenchmarks of photon gathering and radiosity sample lookup.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+// configcore.h must always be the first POV file included within core *.cpp files
+// (and as we're exercising core code, we should consider ourselves part of it);
+// microbench.h must follow suite.
+#include "core/configcore.h"
+#include "microbench.h"
+
+// POV-Ray header files (core module)
+#include "core/lighting/photons.h"
+#include "core/lighting/radiosity.h"
+#include "core/support/octree.h"
+#include "core/support/statistics.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_microbench
+{
+
+using namespace pov;
+
+const int kLightingSamples = 200000;
+const int kLightingLookups = 4096;
+
+/// Photon gathering on a floor evenly covered by photons, as in a caustics scene.
+POV_MICROBENCH(photons, gather, "gathers")
+{
+    MicrobenchRandom rng;
+    ScenePhotonSettings settings;
+    PhotonMap map;
+
+    for (int i = 0; i < kLightingSamples; i++)
+    {
+        Photon* photon = map.AllocatePhoton();
+        photon->Loc = PhotonLocation(Vector3d(rng(-10.0, 10.0), 0.0, rng(-10.0, 10.0)));
+        photon->colour = PhotonColour(RGBColour(0.001));
+        photon->init(0);
+        photon->theta = (signed char)(rng(-127.0, 127.0));
+        photon->phi = (signed char)(rng(-127.0, 127.0));
+    }
+    map.buildTree();
+    map.setGatherOptions(settings, false);
+
+    std::vector<Vector3d> points;
+    points.reserve(kLightingLookups);
+    for (int i = 0; i < kLightingLookups; i++)
+        points.push_back(Vector3d(rng(-9.0, 9.0), 0.0, rng(-9.0, 9.0)));
+    Vector3d normal(0.0, 1.0, 0.0);
+
+    PhotonGatherer gatherer(&map, settings);
+    DBL sum = 0.0;
+    while (state.KeepRunning())
+    {
+        for (std::vector<Vector3d>::const_iterator i = points.begin(); i != points.end(); ++i)
+            sum += gatherer.gatherPhotonsAdaptive(&(*i), &normal, true);
+        state.AddItems(points.size());
+    }
+    KeepResult(sum);
+}
+
+/// Radiosity sample cache lookups on a floor covered by samples, as in the final render pass.
+POV_MICROBENCH(radiosity, lookup, "lookups")
+{
+    MicrobenchRandom rng;
+    SceneRadiositySettings settings;
+    RadiosityCache cache(settings);
+    RenderStatistics stats;
+    Vector3d normal(0.0, 1.0, 0.0);
+    MathColour zero(0.0);
+
+    RadiosityCache::BlockPool* pool = cache.AcquireBlockPool();
+    for (int i = 0; i < kLightingSamples / 4; i++)
+    {
+        Vector3d point(rng(-10.0, 10.0), 0.0, rng(-10.0, 10.0));
+        DBL harmonicMeanDistance = rng(0.05, 0.5);
+        cache.AddBlock(pool, &stats, point, normal, 1.0, Vector3d(0.0),
+                       zero, zero, zero, MathColour(0.5),
+                       harmonicMeanDistance, 0.5 * harmonicMeanDistance, 1.0, 0, OT_PASS_FINAL, 0);
+    }
+    cache.ReleaseBlockPool(pool);
+
+    std::vector<Vector3d> points;
+    points.reserve(kLightingLookups);
+    for (int i = 0; i < kLightingLookups; i++)
+        points.push_back(Vector3d(rng(-9.0, 9.0), 0.0, rng(-9.0, 9.0)));
+
+    DBL sum = 0.0;
+    while (state.KeepRunning())
+    {
+        for (std::vector<Vector3d>::const_iterator i = points.begin(); i != points.end(); ++i)
+        {
+            MathColour illuminance;
+            sum += cache.FindReusableBlock(stats, settings.errorBound, *i, normal, 1.0, illuminance, 0, OT_PASS_FINAL, 0);
+        }
+        state.AddItems(points.size());
+    }
+    KeepResult(sum);
+}
+
+}
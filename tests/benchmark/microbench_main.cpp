@@ -0,0 +1,330 @@
+//******************************************************************************
+///
+/// @file tests/benchmark/microbench_main.cpp
+///
+/// Driver and support code for POV-Ray subsystem microbenchmarks.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+// configcore.h must always be the first POV file included within core *.cpp files
+// (and as we're exercising core code, we should consider ourselves part of it);
+// microbench.h must follow suite.
+#include "core/configcore.h"
+#include "microbench.h"
+
+// C++ variants of C standard header files
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// C++ standard header files
+#include <algorithm>
+#include <exception>
+
+// POV-Ray header files (base module)
+#include "base/version.h"
+
+// POV-Ray header files (core module)
+#include "core/bounding/flatbvh.h"
+#include "core/material/noise.h"
+#include "core/scene/scenedata.h"
+#include "core/scene/tracethreaddata.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_microbench
+{
+
+using namespace pov;
+
+static volatile double gKeptResult;
+
+void KeepResult(double value)
+{
+    gKeptResult = value;
+}
+
+MicrobenchState::MicrobenchState(double minTime) :
+    mMinTime(minTime),
+    mSeconds(0.0),
+    mItems(0),
+    mStarted(false)
+{}
+
+bool MicrobenchState::KeepRunning()
+{
+    Clock::time_point now = Clock::now();
+    if (!mStarted)
+    {
+        mStarted = true;
+        mStart = now;
+        return !IsSkipped();
+    }
+    mSeconds = std::chrono::duration<double>(now - mStart).count();
+    return (mSeconds < mMinTime) && !IsSkipped();
+}
+
+std::vector<MicrobenchInfo>& GetMicrobenchRegistry()
+{
+    static std::vector<MicrobenchInfo> registry;
+    return registry;
+}
+
+MicrobenchRegistrar::MicrobenchRegistrar(const char* group, const char* name, const char* unit, MicrobenchFunction function)
+{
+    MicrobenchInfo info = { group, name, unit, function };
+    GetMicrobenchRegistry().push_back(info);
+}
+
+Vector3d MicrobenchRandom::Point(double lo, double hi)
+{
+    double x = (*this)(lo, hi);
+    double y = (*this)(lo, hi);
+    double z = (*this)(lo, hi);
+    return Vector3d(x, y, z);
+}
+
+Vector3d MicrobenchRandom::Direction()
+{
+    double z   = (*this)(-1.0, 1.0);
+    double phi = (*this)(0.0, TWO_M_PI);
+    double r   = sqrt(max(0.0, 1.0 - z * z));
+    return Vector3d(r * cos(phi), r * sin(phi), z);
+}
+
+MicrobenchScene::MicrobenchScene() :
+    mpSceneData(new SceneData()),
+    mpThreadData(nullptr)
+{
+    mpThreadData = new TraceThreadData(mpSceneData, 0);
+}
+
+MicrobenchScene::~MicrobenchScene()
+{
+    delete mpThreadData;
+}
+
+/// Result of running a single microbenchmark several times.
+struct MicrobenchResult
+{
+    const MicrobenchInfo*   info;
+    std::vector<double>     rates;      ///< Throughput of each repetition, in items per second.
+    POV_ULONG               items;      ///< Total items processed across all repetitions.
+    double                  seconds;    ///< Total time measured across all repetitions.
+    std::string             label;
+    std::string             skipReason;
+};
+
+static double Median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    return ((n % 2 != 0) ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]));
+}
+
+static void WriteJSONString(FILE *f, const std::string& s)
+{
+    std::fputc('"', f);
+    for (std::string::const_iterator i = s.begin(); i != s.end(); ++i)
+    {
+        unsigned char c = (unsigned char)(*i);
+        if ((c == '"') || (c == '\\'))
+            std::fprintf(f, "\\%c", c);
+        else if (c < 0x20)
+            std::fprintf(f, "\\u%04x", (unsigned int)c);
+        else
+            std::fputc(c, f);
+    }
+    std::fputc('"', f);
+}
+
+static void WriteJSON(FILE *f, const std::vector<MicrobenchResult>& results, double minTime, int repetitions)
+{
+    std::fprintf(f, "{\n");
+    std::fprintf(f, "  \"version\": ");
+    WriteJSONString(f, POV_RAY_FULL_VERSION);
+    std::fprintf(f, ",\n  \"min_time\": %g,\n  \"repetitions\": %d,\n  \"benchmarks\": [", minTime, repetitions);
+
+    for (std::vector<MicrobenchResult>::const_iterator i = results.begin(); i != results.end(); ++i)
+    {
+        std::fprintf(f, "%s\n    {\n      \"name\": ", (i == results.begin() ? "" : ","));
+        WriteJSONString(f, std::string(i->info->group) + "/" + i->info->name);
+        std::fprintf(f, ",\n      \"unit\": ");
+        WriteJSONString(f, i->info->unit);
+        if (!i->label.empty())
+        {
+            std::fprintf(f, ",\n      \"label\": ");
+            WriteJSONString(f, i->label);
+        }
+        if (!i->skipReason.empty())
+        {
+            std::fprintf(f, ",\n      \"skipped\": ");
+            WriteJSONString(f, i->skipReason);
+        }
+        else
+        {
+            double median = Median(i->rates);
+            std::fprintf(f, ",\n      \"items\": %.0f,\n      \"seconds\": %.6f", (double)i->items, i->seconds);
+            std::fprintf(f, ",\n      \"rate_median\": %.6g,\n      \"rate_min\": %.6g,\n      \"rate_max\": %.6g",
+                         median, *std::min_element(i->rates.begin(), i->rates.end()), *std::max_element(i->rates.begin(), i->rates.end()));
+            std::fprintf(f, ",\n      \"ns_per_item\": %.6g", (median > 0.0 ? 1.0e9 / median : 0.0));
+        }
+        std::fprintf(f, "\n    }");
+    }
+
+    std::fprintf(f, "\n  ]\n}\n");
+}
+
+static void Usage(const char *self)
+{
+    std::fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  --list              list the available microbenchmarks and exit\n"
+        "  --filter=TEXT       run only microbenchmarks whose name contains TEXT\n"
+        "  --min-time=SECONDS  minimum time to spend in each repetition (default 0.5)\n"
+        "  --repetitions=N     number of repetitions of each microbenchmark (default 5)\n"
+        "  --output=FILE       write the JSON results to FILE instead of stdout\n",
+        self);
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    using namespace pov_microbench;
+
+    std::vector<std::string> filters;
+    double minTime = 0.5;
+    int repetitions = 5;
+    const char *outputFile = nullptr;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--list") == 0)
+            listOnly = true;
+        else if (std::strncmp(argv[i], "--filter=", 9) == 0)
+            filters.push_back(argv[i] + 9);
+        else if (std::strncmp(argv[i], "--min-time=", 11) == 0)
+            minTime = std::atof(argv[i] + 11);
+        else if (std::strncmp(argv[i], "--repetitions=", 14) == 0)
+            repetitions = std::max(1, std::atoi(argv[i] + 14));
+        else if (std::strncmp(argv[i], "--output=", 9) == 0)
+            outputFile = argv[i] + 9;
+        else
+        {
+            Usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // same start-up as the render engine proper
+    pov::Initialize_Noise();
+    pov::Initialise_FlatBVHDispatch();
+
+    const std::vector<MicrobenchInfo>& registry = GetMicrobenchRegistry();
+    std::vector<MicrobenchResult> results;
+
+    for (std::vector<MicrobenchInfo>::const_iterator i = registry.begin(); i != registry.end(); ++i)
+    {
+        std::string name = std::string(i->group) + "/" + i->name;
+
+        bool selected = filters.empty();
+        for (std::vector<std::string>::const_iterator j = filters.begin(); j != filters.end(); ++j)
+            selected = selected || (name.find(*j) != std::string::npos);
+        if (!selected)
+            continue;
+
+        if (listOnly)
+        {
+            std::printf("%-32s %s\n", name.c_str(), i->unit);
+            continue;
+        }
+
+        MicrobenchResult result;
+        result.info = &(*i);
+        result.items = 0;
+        result.seconds = 0.0;
+
+        std::fprintf(stderr, "%-32s", name.c_str());
+        std::fflush(stderr);
+
+        try
+        {
+            for (int rep = 0; rep < repetitions; rep++)
+            {
+                MicrobenchState state(minTime);
+                i->function(state);
+                result.label = state.GetLabel();
+                if (state.IsSkipped())
+                {
+                    result.skipReason = state.GetSkipReason();
+                    break;
+                }
+                result.items += state.GetItems();
+                result.seconds += state.GetSeconds();
+                result.rates.push_back(state.GetSeconds() > 0.0 ? state.GetItems() / state.GetSeconds() : 0.0);
+            }
+        }
+        catch (std::exception& e)
+        {
+            result.rates.clear();
+            result.skipReason = std::string("failed: ") + e.what();
+        }
+
+        if (!result.skipReason.empty())
+            std::fprintf(stderr, " skipped (%s)\n", result.skipReason.c_str());
+        else
+            std::fprintf(stderr, " %12.4g %s/s\n", Median(result.rates), i->unit);
+
+        results.push_back(result);
+    }
+
+    if (listOnly)
+        return EXIT_SUCCESS;
+
+    FILE *f = stdout;
+    if (outputFile != nullptr)
+    {
+        f = std::fopen(outputFile, "w");
+        if (f == nullptr)
+        {
+            std::fprintf(stderr, "Cannot create output file '%s'\n", outputFile);
+            return EXIT_FAILURE;
+        }
+    }
+    WriteJSON(f, results, minTime, repetitions);
+    if (f != stdout)
+        std::fclose(f);
+
+    return EXIT_SUCCESS;
+}
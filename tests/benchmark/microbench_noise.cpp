@@ -0,0 +1,165 @@
+//******************************************************************************
+///
+/// @file tests/benchmark/microbench_noise.cpp
+///
+/// Microbenchmarks of the noise and turbulence functions.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+// configcore.h must always be the first POV file included within core *.cpp files
+// (and as we're exercising core code, we should consider ourselves part of it);
+// microbench.h must follow suite.
+#include "core/configcore.h"
+#include "microbench.h"
+
+// POV-Ray header files (core module)
+#include "core/material/noise.h"
+#include "core/material/warp.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_microbench
+{
+
+using namespace pov;
+
+const int kNoisePoints = 4096;
+
+static void MakeNoisePoints(std::vector<Vector3d>& points)
+{
+    MicrobenchRandom rng;
+    points.resize(kNoisePoints);
+    for (std::vector<Vector3d>::iterator i = points.begin(); i != points.end(); ++i)
+        *i = rng.Point(-50.0, 50.0);
+}
+
+static std::string NoiseImplementationName()
+{
+#ifdef TRY_OPTIMIZED_NOISE
+    for (const OptimizedNoiseInfo* pInfo = gaOptimizedNoiseInfo; pInfo->name != nullptr; ++pInfo)
+        if (pInfo->noise == Noise)
+            return pInfo->name;
+#endif
+    return "portable";
+}
+
+static void RunNoise(MicrobenchState& state, int noiseGenerator)
+{
+    std::vector<Vector3d> points;
+    MakeNoisePoints(points);
+    state.SetLabel(NoiseImplementationName());
+
+    DBL sum = 0.0;
+    while (state.KeepRunning())
+    {
+        for (std::vector<Vector3d>::const_iterator i = points.begin(); i != points.end(); ++i)
+            sum += Noise(*i, noiseGenerator);
+        state.AddItems(points.size());
+    }
+    KeepResult(sum);
+}
+
+POV_MICROBENCH(noise, noise_range_corrected, "points")
+{
+    RunNoise(state, kNoiseGen_RangeCorrected);
+}
+
+POV_MICROBENCH(noise, noise_perlin, "points")
+{
+    RunNoise(state, kNoiseGen_Perlin);
+}
+
+POV_MICROBENCH(noise, dnoise, "points")
+{
+    std::vector<Vector3d> points;
+    MakeNoisePoints(points);
+    state.SetLabel(NoiseImplementationName());
+
+    Vector3d sum(0.0);
+    while (state.KeepRunning())
+    {
+        for (std::vector<Vector3d>::const_iterator i = points.begin(); i != points.end(); ++i)
+        {
+            Vector3d result;
+            DNoise(result, *i);
+            sum += result;
+        }
+        state.AddItems(points.size());
+    }
+    KeepResult(sum.x() + sum.y() + sum.z());
+}
+
+POV_MICROBENCH(noise, turbulence, "points")
+{
+    std::vector<Vector3d> points;
+    MakeNoisePoints(points);
+    state.SetLabel(NoiseImplementationName());
+
+    TurbulenceWarp warp;
+    warp.Turbulence = Vector3d(1.0);
+    warp.Octaves = 6;
+
+    DBL sum = 0.0;
+    while (state.KeepRunning())
+    {
+        for (std::vector<Vector3d>::const_iterator i = points.begin(); i != points.end(); ++i)
+            sum += Turbulence(*i, &warp, kNoiseGen_RangeCorrected);
+        state.AddItems(points.size());
+    }
+    KeepResult(sum);
+}
+
+POV_MICROBENCH(noise, dturbulence, "points")
+{
+    std::vector<Vector3d> points;
+    MakeNoisePoints(points);
+    state.SetLabel(NoiseImplementationName());
+
+    TurbulenceWarp warp;
+    warp.Turbulence = Vector3d(1.0);
+    warp.Octaves = 6;
+
+    Vector3d sum(0.0);
+    while (state.KeepRunning())
+    {
+        for (std::vector<Vector3d>::const_iterator i = points.begin(); i != points.end(); ++i)
+        {
+            Vector3d result;
+            DTurbulence(result, *i, &warp);
+            sum += result;
+        }
+        state.AddItems(points.size());
+    }
+    KeepResult(sum.x() + sum.y() + sum.z());
+}
+
+}
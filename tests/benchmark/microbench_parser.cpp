@@ -0,0 +1,130 @@
+//******************************************************************************
+///
+/// @file tests/benchmark/microbench_parser.cpp
+///
+/// Microbenchmarks of the scene description language tokenizer.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+// configparser.h must always be the first POV file included within parser *.cpp files
+// (and as we're exercising parser code, we should consider ourselves part of it);
+// microbench.h must follow suite.
+#include "parser/configparser.h"
+#include "microbench.h"
+
+// C++ variants of C standard header files
+#include <cstdio>
+
+// POV-Ray header files (base module)
+#include "base/fileinputoutput.h"
+
+// POV-Ray header files (parser module)
+#include "parser/parsertypes.h"
+#include "parser/rawtokenizer.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_microbench
+{
+
+using namespace pov_base;
+using namespace pov_parser;
+
+const int kIncludeSegments = 4000;
+const int kStringAppends = 100000;
+
+/// Generate a large include file exercising the various kinds of lexemes.
+static void MakeIncludeFile(std::string& text)
+{
+    char buffer[1024];
+    for (int i = 0; i < kIncludeSegments; i++)
+    {
+        std::snprintf(buffer, sizeof(buffer),
+            "// Segment %d of the generated include file\n"
+            "#declare Segment_%d_Position = <%d.25, -%d.5, %de-3>;\n"
+            "#declare Segment_%d_Name = \"segment_%d\";\n"
+            "#macro Segment_%d_Make(Radius, Colour)\n"
+            "  sphere { Segment_%d_Position, Radius * 1.5\n"
+            "    texture { pigment { colour Colour } finish { phong 0.5 reflection { 0.1, 0.3 } } }\n"
+            "  }\n"
+            "#end\n"
+            "/* block comment\n"
+            "   spanning lines */\n"
+            "#if (%d > 100) #local Tmp = sin(%d * pi / 180) + sqrt(%d); #end\n",
+            i, i, i, i, i, i, i, i, i, i, i, i);
+        text.append(buffer);
+    }
+}
+
+POV_MICROBENCH(parser, tokenizer, "tokens")
+{
+    std::string text;
+    MakeIncludeFile(text);
+
+    char label[64];
+    std::snprintf(label, sizeof(label), "%u KiB input", (unsigned int)(text.size() / 1024));
+    state.SetLabel(label);
+
+    RawTokenizer tokenizer;
+    RawToken token;
+    while (state.KeepRunning())
+    {
+        POV_ULONG tokens = 0;
+        tokenizer.SetInputStream(StreamPtr(new IMemStream(reinterpret_cast<const unsigned char*>(text.data()), text.size(), "microbench.inc")));
+        while (tokenizer.GetNextToken(token))
+            tokens++;
+        state.AddItems(tokens);
+    }
+}
+
+/// Build a string piece by piece, as `#declare S = concat(S, Piece)` in a loop does.
+POV_MICROBENCH(parser, string_append, "appends")
+{
+    const UCS2 *piece = u"frame_0001.png;";
+
+    while (state.KeepRunning())
+    {
+        AssignableString *s = new AssignableString();
+        for (int i = 0; i < kStringAppends; i++)
+        {
+            // Copy the identifier's value, append to the copy, and replace the identifier's value.
+            AssignableString *t = s->Clone();
+            t->Append(piece);
+            delete s;
+            s = t;
+        }
+        delete s;
+        state.AddItems(kStringAppends);
+    }
+}
+
+}
@@ -0,0 +1,183 @@
+//******************************************************************************
+///
+/// @file tests/benchmark/microbench_shapes.cpp
+///
+/// Microbenchmarks of the intersection tests of individual shapes.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+// configcore.h must always be the first POV file included within core *.cpp files
+// (and as we're exercising core code, we should consider ourselves part of it);
+// microbench.h must follow suite.
+#include "core/configcore.h"
+#include "microbench.h"
+
+// POV-Ray header files (core module)
+#include "core/render/ray.h"
+#include "core/render/trace.h"
+#include "core/scene/object.h"
+#include "core/scene/tracethreaddata.h"
+#include "core/shape/box.h"
+#include "core/shape/cone.h"
+#include "core/shape/disc.h"
+#include "core/shape/plane.h"
+#include "core/shape/sphere.h"
+#include "core/shape/superellipsoid.h"
+#include "core/shape/torus.h"
+#include "core/shape/triangle.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_microbench
+{
+
+using namespace pov;
+
+const int kShapeRays = 4096;
+
+/// Time All_Intersections() of a shape spanning roughly the unit cube.
+///
+/// Rays start on a sphere of radius 4 around the origin, aimed at random points inside the
+/// unit cube, so most but not all of them hit the shape; the count includes the misses.
+///
+static void RunShape(MicrobenchState& state, ObjectPtr object)
+{
+    MicrobenchScene scene;
+    TraceThreadData* threadData = scene.GetThreadData();
+    TraceTicket ticket(1, 0.0);
+    MicrobenchRandom rng;
+
+    std::vector<Ray> rays;
+    rays.reserve(kShapeRays);
+    for (int i = 0; i < kShapeRays; i++)
+    {
+        Vector3d origin = rng.Direction() * 4.0;
+        Vector3d target = rng.Point(-1.0, 1.0);
+        rays.push_back(Ray(ticket, origin, (target - origin).normalized()));
+    }
+
+    IStack depthstack(threadData->stackPool);
+    POV_ULONG hits = 0;
+    while (state.KeepRunning())
+    {
+        for (std::vector<Ray>::const_iterator i = rays.begin(); i != rays.end(); ++i)
+        {
+            if (object->All_Intersections(*i, depthstack, threadData))
+                hits++;
+            while (!depthstack->empty())
+                depthstack->pop();
+        }
+        state.AddItems(rays.size());
+    }
+    KeepResult(double(hits));
+
+    Destroy_Object(object);
+}
+
+POV_MICROBENCH(shapes, sphere, "rays")
+{
+    RunShape(state, new Sphere());
+}
+
+POV_MICROBENCH(shapes, box, "rays")
+{
+    RunShape(state, new Box());
+}
+
+POV_MICROBENCH(shapes, cylinder, "rays")
+{
+    Cone* object = new Cone();
+    object->Cylinder();
+    object->apex = Vector3d(0.0, 1.0, 0.0);
+    object->base = Vector3d(0.0, -1.0, 0.0);
+    object->apex_radius = object->base_radius = 1.0;
+    object->Compute_Cylinder_Data();
+    object->Compute_BBox();
+    RunShape(state, object);
+}
+
+POV_MICROBENCH(shapes, cone, "rays")
+{
+    Cone* object = new Cone();
+    object->apex = Vector3d(0.0, 1.0, 0.0);
+    object->base = Vector3d(0.0, -1.0, 0.0);
+    object->apex_radius = 0.25;
+    object->base_radius = 1.0;
+    object->Compute_Cone_Data();
+    object->Compute_BBox();
+    RunShape(state, object);
+}
+
+POV_MICROBENCH(shapes, disc, "rays")
+{
+    Disc* object = new Disc();
+    object->normal = Vector3d(0.0, 1.0, 0.0);
+    object->oradius2 = 1.0;
+    object->iradius2 = 0.25 * 0.25;
+    object->Compute_Disc();
+    RunShape(state, object);
+}
+
+POV_MICROBENCH(shapes, plane, "rays")
+{
+    RunShape(state, new Plane());
+}
+
+POV_MICROBENCH(shapes, triangle, "rays")
+{
+    Triangle* object = new Triangle();
+    object->P1 = Vector3d(-1.0, -1.0, 0.0);
+    object->P2 = Vector3d( 1.0, -1.0, 0.0);
+    object->P3 = Vector3d( 0.0,  1.0, 0.0);
+    object->Compute_Triangle();
+    RunShape(state, object);
+}
+
+POV_MICROBENCH(shapes, torus, "rays")
+{
+    Torus* object = new Torus();
+    object->MajorRadius = 0.75;
+    object->MinorRadius = 0.25;
+    object->Compute_BBox();
+    RunShape(state, object);
+}
+
+POV_MICROBENCH(shapes, superellipsoid, "rays")
+{
+    // same as `superellipsoid { <0.25, 0.25> }`
+    Superellipsoid* object = new Superellipsoid();
+    object->Power = Vector3d(2.0 / 0.25, 0.25 / 0.25, 2.0 / 0.25);
+    object->Compute_BBox();
+    RunShape(state, object);
+}
+
+}
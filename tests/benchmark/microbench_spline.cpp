@@ -0,0 +1,116 @@
+//******************************************************************************
+///
+/// @file tests/benchmark/microbench_spline.cpp
+///
+/// Microbenchmarks of spline evaluation.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+// configcore.h must always be the first POV file included within core *.cpp files
+// (and as we're exercising core code, we should consider ourselves part of it);
+// microbench.h must follow suite.
+#include "core/configcore.h"
+#include "microbench.h"
+
+// POV-Ray header files (core module)
+#include "core/math/spline.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_microbench
+{
+
+using namespace pov;
+
+const int kSplineEntries = 200;
+const int kSplinePoints = 4096;
+
+/// Natural spline of the kind used for camera paths, sampled along its full length.
+static GenericSpline* MakeSpline(std::vector<DBL>& points)
+{
+    MicrobenchRandom rng;
+    GenericSpline* spline = new NaturalSpline();
+    for (int i = 0; i < kSplineEntries; i++)
+    {
+        EXPRESS value;
+        for (int k = 0; k < 5; k++)
+            value[k] = rng(-10.0, 10.0);
+        Insert_Spline_Entry(spline, DBL(i), value);
+    }
+    spline->Precompute();
+
+    points.resize(kSplinePoints);
+    for (int i = 0; i < kSplinePoints; i++)
+        points[i] = (kSplineEntries - 1) * DBL(i) / kSplinePoints;
+    return spline;
+}
+
+POV_MICROBENCH(spline, eval, "calls")
+{
+    std::vector<DBL> points;
+    GenericSpline* spline = MakeSpline(points);
+
+    DBL sum = 0.0;
+    while (state.KeepRunning())
+    {
+        for (std::vector<DBL>::const_iterator i = points.begin(); i != points.end(); ++i)
+        {
+            EXPRESS value;
+            spline->Get(*i, value);
+            sum += value[0];
+        }
+        state.AddItems(points.size());
+    }
+    KeepResult(sum);
+
+    Destroy_Spline(spline);
+}
+
+POV_MICROBENCH(spline, batch, "calls")
+{
+    std::vector<DBL> points;
+    GenericSpline* spline = MakeSpline(points);
+    std::vector<EXPRESS> values(points.size());
+
+    DBL sum = 0.0;
+    while (state.KeepRunning())
+    {
+        spline->GetBatch(&points[0], points.size(), &values[0]);
+        sum += values[0][0];
+        state.AddItems(points.size());
+    }
+    KeepResult(sum);
+
+    Destroy_Spline(spline);
+}
+
+}
@@ -0,0 +1,193 @@
+//******************************************************************************
+///
+/// @file tests/benchmark/microbench_vm.cpp
+///
+/// Microbenchmarks of the user-defined function virtual machine.
+///
+/// @copyright
+/// @parblock
+///
+/// Persistence of Vision Ray Tracer ('POV-Ray') version 3.8.
+/// Copyright 1991-2018 Persistence of Vision Raytracer Pty. Ltd.
+///
+/// POV-Ray is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU Affero General Public License as
+/// published by the Free Software Foundation, either version 3 of the
+/// License, or (at your option) any later version.
+///
+/// POV-Ray is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU Affero General Public License for more details.
+///
+/// You should have received a copy of the GNU Affero General Public License
+/// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+///
+/// ----------------------------------------------------------------------------
+///
+/// POV-Ray is based on the popular DKB raytracer version 2.12.
+/// DKBTrace was originally written by David K. Buck.
+/// DKBTrace Ver 2.0-2.12 were written by David K. Buck & Aaron A. Collins.
+///
+/// @endparblock
+///
+//******************************************************************************
+
+
+// configvm.h must always be the first POV file included within vm *.cpp files
+// (and as we're exercising vm code, we should consider ourselves part of it);
+// microbench.h must follow suite.
+#include "vm/configvm.h"
+#include "microbench.h"
+
+// C++ variants of C standard header files
+#include <cstring>
+
+// POV-Ray header files (base module)
+#include "base/pov_mem.h"
+
+// POV-Ray header files (core module)
+#include "core/scene/tracethreaddata.h"
+
+// POV-Ray header files (VM module)
+#include "vm/fnpovfpu.h"
+
+// this must be the last file included
+#include "base/povdebug.h"
+
+namespace pov_microbench
+{
+
+using namespace pov;
+
+const int kFunctionPoints = 4096;
+
+#define ASM(op,rs,rd,k) MAKE_INSTRUCTION((op) | ((rs) << 3) | (rd), k)
+
+/// Add a typical isosurface function to the VM, as compiled by the parser.
+///
+/// The code is that of `function { sqrt(x*x + y*y + z*z) - 1 + 0.1*sin(4*x) }`, using the
+/// same instruction sequence the function compiler emits: load the parameters into r2-r4,
+/// evaluate into r0, and return.
+///
+static FUNCTION_PTR AddIsosurfaceFunction(FunctionVM* vm)
+{
+    const Instruction program[] =
+    {
+        ASM(OPCODE_GROW,  0, 0, 3),
+        ASM(OPCODE_LOAD,  1, 2, 0),                                 // x -> r2
+        ASM(OPCODE_LOAD,  1, 3, 1),                                 // y -> r3
+        ASM(OPCODE_LOAD,  1, 4, 2),                                 // z -> r4
+        ASM(OPCODE_MOVE,  2, 0, 0),
+        ASM(OPCODE_MUL,   2, 0, 0),                                 // r0 = x*x
+        ASM(OPCODE_MOVE,  3, 1, 0),
+        ASM(OPCODE_MUL,   3, 1, 0),
+        ASM(OPCODE_ADD,   1, 0, 0),                                 // r0 += y*y
+        ASM(OPCODE_MOVE,  4, 1, 0),
+        ASM(OPCODE_MUL,   4, 1, 0),
+        ASM(OPCODE_ADD,   1, 0, 0),                                 // r0 += z*z
+        ASM(OPCODE_SYS1,  0, 0, TRAP_SYS1_SQRT),                    // r0 = sqrt(r0)
+        ASM(OPCODE_SUBI,  0, 0, vm->AddConstant(1.0)),              // r0 -= 1
+        ASM(OPCODE_MOVE,  0, 5, 0),
+        ASM(OPCODE_MOVE,  2, 0, 0),
+        ASM(OPCODE_MULI,  0, 0, vm->AddConstant(4.0)),
+        ASM(OPCODE_SYS1,  0, 0, TRAP_SYS1_SIN),                     // r0 = sin(4*x)
+        ASM(OPCODE_MULI,  0, 0, vm->AddConstant(0.1)),
+        ASM(OPCODE_ADD,   5, 0, 0),
+        ASM(OPCODE_RTS,   0, 0, 0)
+    };
+
+    FunctionCode f;
+    f.program_size = sizeof(program) / sizeof(program[0]);
+    f.program = reinterpret_cast<Instruction *>(POV_MALLOC(sizeof(program), "fn: program"));
+    std::memcpy(f.program, program, sizeof(program));
+    f.return_size = 0;
+    f.parameter_cnt = 3;
+    f.localvar_cnt = 0;
+    for (int i = 0; i < MAX_FUNCTION_PARAMETER_LIST; i++)
+    {
+        f.localvar_pos[i] = 0;
+        f.localvar[i] = nullptr;
+        f.parameter[i] = nullptr;
+    }
+    f.parameter[0] = POV_STRDUP("x");
+    f.parameter[1] = POV_STRDUP("y");
+    f.parameter[2] = POV_STRDUP("z");
+    f.sourceInfo.name = "microbench";
+    f.flags = 0;
+    f.private_copy_method = nullptr;
+    f.private_destroy_method = nullptr;
+    f.private_data = nullptr;
+    f.cache_id = 0;
+
+    return new FUNCTION(vm->AddFunction(&f));
+}
+
+#undef ASM
+
+static const char* FunctionEngineName()
+{
+#if POV_VM_JIT
+    return "jit";
+#else
+    return "interpreter";
+#endif
+}
+
+POV_MICROBENCH(vm, function_eval, "calls")
+{
+    MicrobenchScene scene;
+    intrusive_ptr<FunctionVM> vm(new FunctionVM());
+    FunctionVM::CustomFunction fn(vm.get(), AddIsosurfaceFunction(vm.get()));
+    state.SetLabel(FunctionEngineName());
+
+    MicrobenchRandom rng;
+    std::vector<Vector3d> points;
+    points.reserve(kFunctionPoints);
+    for (int i = 0; i < kFunctionPoints; i++)
+        points.push_back(rng.Point(-2.0, 2.0));
+
+    GenericFunctionContextPtr pContext = fn.AcquireContext(scene.GetThreadData());
+    DBL sum = 0.0;
+    while (state.KeepRunning())
+    {
+        for (std::vector<Vector3d>::const_iterator i = points.begin(); i != points.end(); ++i)
+        {
+            fn.InitArguments(pContext);
+            fn.PushArgument(pContext, i->x());
+            fn.PushArgument(pContext, i->y());
+            fn.PushArgument(pContext, i->z());
+            sum += fn.Execute(pContext);
+        }
+        state.AddItems(points.size());
+    }
+    fn.ReleaseContext(pContext);
+    KeepResult(sum);
+}
+
+POV_MICROBENCH(vm, function_batch, "calls")
+{
+    MicrobenchScene scene;
+    intrusive_ptr<FunctionVM> vm(new FunctionVM());
+    FunctionVM::CustomFunction fn(vm.get(), AddIsosurfaceFunction(vm.get()));
+    state.SetLabel(FunctionEngineName());
+
+    MicrobenchRandom rng;
+    std::vector<DBL> args(kFunctionPoints * 3);
+    for (std::vector<DBL>::iterator i = args.begin(); i != args.end(); ++i)
+        *i = rng(-2.0, 2.0);
+    std::vector<DBL> results(kFunctionPoints);
+
+    GenericFunctionContextPtr pContext = fn.AcquireContext(scene.GetThreadData());
+    DBL sum = 0.0;
+    while (state.KeepRunning())
+    {
+        fn.ExecuteBatch(pContext, &args[0], 3, kFunctionPoints, &results[0]);
+        sum += results[0];
+        state.AddItems(kFunctionPoints);
+    }
+    fn.ReleaseContext(pContext);
+    KeepResult(sum);
+}
+
+}
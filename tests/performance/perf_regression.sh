@@ -0,0 +1,145 @@
+#!/bin/sh
+# ==============================================================================
+# POV-Ray v3.8
+# perf_regression.sh - render the performance scenes and compare to baselines
+# ==============================================================================
+# This file is part of POV-Ray and subject to the POV-Ray licence
+# see POVLEGAL.DOC for details
+# ------------------------------------------------------------------------------
+# calling conventions:
+#
+#   perf_regression.sh [-r] [-b baseline_file] [povray_binary]
+#
+# -r: record the results as the new baseline instead of comparing
+# -b: baseline file (defaults to baselines/<hostname>.txt)
+# povray_binary: POV-Ray executable to test (defaults to povray in the PATH)
+#
+# Each scene in the scenes directory is rendered PERF_RUNS times with fixed
+# resolution, thread count and high reproducibility mode, and the fastest
+# phase times along with the ray and subsystem statistics counters are
+# compared against the baseline. Timings are machine specific, which is why
+# baselines are kept per host; record one on an idle machine before use.
+#
+# environment:
+#
+#   PERF_THREADS          render threads (default 1)
+#   PERF_RUNS             renders per scene, best time is kept (default 3)
+#   PERF_TIME_TOLERANCE   allowed slowdown in percent (default 15)
+#   PERF_COUNT_TOLERANCE  allowed counter deviation in percent (default 1)
+#
+# The exit status is 1 if any metric regressed beyond its tolerance.
+# ==============================================================================
+
+# --- specify additional render options here ---
+POV_OPTIONS="-d -f +W160 +H120 +HR"
+
+THREADS="${PERF_THREADS:-1}"
+RUNS="${PERF_RUNS:-3}"
+TIME_TOLERANCE="${PERF_TIME_TOLERANCE:-15}"
+COUNT_TOLERANCE="${PERF_COUNT_TOLERANCE:-1}"
+
+SCRIPT_DIR=`cd \`dirname $0\` && pwd`
+SCENE_DIR="$SCRIPT_DIR/scenes"
+INCLUDE_DIR="$SCRIPT_DIR/../../distribution/include"
+if [ ! -d "$INCLUDE_DIR" ] ; then
+  # prepared Unix source tree
+  INCLUDE_DIR="$SCRIPT_DIR/../../include"
+fi
+
+RECORD=no
+BASELINE="$SCRIPT_DIR/baselines/`uname -n`.txt"
+
+while getopts rb: OPT ; do
+  case $OPT in
+    r) RECORD=yes ;;
+    b) BASELINE="$OPTARG" ;;
+    *) sed -n '11p' "$0" | sed 's/^# *//' ; exit 2 ;;
+  esac
+done
+shift `expr $OPTIND - 1`
+
+POVRAY="${1:-povray}"
+case "$POVRAY" in
+  */*) POVRAY=`cd \`dirname "$POVRAY"\` && pwd`/`basename "$POVRAY"` ;;
+esac
+
+if [ "$RECORD" = no ] && [ ! -f "$BASELINE" ] ; then
+  echo "baseline $BASELINE not found; run with -r to record one"
+  exit 1
+fi
+
+RESULTS=`mktemp ${TMPDIR:-/tmp}/perf_regression.XXXXXX` || exit 1
+LOG="$RESULTS.log"
+trap 'rm -f "$RESULTS" "$LOG"' 0
+
+echo "# threads $THREADS" > "$RESULTS"
+
+cd "$SCENE_DIR"
+
+for SCENE in *.pov ; do
+  NAME=`basename $SCENE .pov`
+  BEST=""
+  RUN=0
+  while [ $RUN -lt $RUNS ] ; do
+    if ! "$POVRAY" +I$SCENE +L"$INCLUDE_DIR" +WT$THREADS $POV_OPTIONS > /dev/null 2> "$LOG" ; then
+      echo "$NAME: render failed"
+      tail -n 20 "$LOG"
+      exit 1
+    fi
+    # phase times in seconds, then the statistics counters
+    RESULT=`awk '
+      /^ *(Parse|Photon|Radiosity|Trace) Time: .*seconds\)/ {
+        t = $0; sub(/.*\(/, "", t); sub(/ seconds\).*/, "", t)
+        phase = $1; time[tolower(phase) "_time"] = t
+      }
+      /^Rays:/                         { count["rays"] = $2 }
+      /^Shadow Ray Tests:/             { count["shadow_tests"] = $4 }
+      /^Isosurface roots:/             { count["isosurface_roots"] = $3 }
+      /^Radiosity samples calculated:/ { count["radiosity_samples"] = $4 }
+      /^Number of photons shot:/       { count["photons_shot"] = $5 }
+      END {
+        for (m in time)  print m, time[m]
+        for (m in count) print m, count[m]
+      }' "$LOG"`
+    # keep the fastest run; counters are identical in high reproducibility mode
+    BEST=`printf "%s\n%s\n" "$BEST" "$RESULT" | awk '
+      NF == 2 {
+        if (!($1 in v) || ($1 ~ /_time$/ && $2 < v[$1])) v[$1] = $2
+      }
+      END { for (m in v) print m, v[m] }'`
+    RUN=`expr $RUN + 1`
+  done
+  echo "$BEST" | sort | sed "s/^/$NAME /" >> "$RESULTS"
+done
+
+if [ "$RECORD" = yes ] ; then
+  mkdir -p `dirname "$BASELINE"`
+  cp "$RESULTS" "$BASELINE"
+  echo "baseline recorded in $BASELINE"
+  exit 0
+fi
+
+awk -v time_tol="$TIME_TOLERANCE" -v count_tol="$COUNT_TOLERANCE" '
+  FNR == 1 && $1 == "#" {
+    if (NR == FNR) base_threads = $3; else if ($3 != base_threads) print "warning: baseline was recorded with", base_threads, "threads"
+    next
+  }
+  NR == FNR { base[$1 " " $2] = $3; next }
+  {
+    key = $1 " " $2
+    if (!(key in base)) { printf "%-40s %12s  new\n", key, $3; next }
+    b = base[key]
+    if ($2 ~ /_time$/) {
+      # allow for timer granularity on very short phases
+      limit = b * (1 + time_tol / 100) + 0.05
+      low = b * (1 - time_tol / 100) - 0.05
+    } else {
+      limit = b * (1 + count_tol / 100)
+      low = b * (1 - count_tol / 100)
+    }
+    status = "ok"
+    if ($3 > limit) { status = "REGRESSION"; failed = 1 }
+    else if ($3 < low) status = "improved"
+    printf "%-40s %12s %12s  %s\n", key, b, $3, status
+  }
+  END { exit failed }' "$BASELINE" "$RESULTS"
@@ -0,0 +1,30 @@
+// Persistence of Vision Ray Tracer Scene Description File
+// File: perf_isosurface.pov
+// Desc: Performance regression scene - noise-displaced isosurface,
+//       exercising the function VM and root finding.
+
+#version 3.7;
+
+#include "functions.inc"
+
+global_settings { assumed_gamma 1.0 }
+
+camera {
+  location <0, 1.5, -4>
+  look_at  <0, 0, 0>
+  angle 45
+  right x*image_width/image_height
+}
+
+light_source { <-5, 8, -6> rgb 1 }
+
+plane { y, -1.2 pigment { rgb 0.6 } }
+
+isosurface {
+  function { f_sphere(x, y, z, 1) - f_noise3d(x*4, y*4, z*4)*0.3 }
+  contained_by { box { -1.5, 1.5 } }
+  max_gradient 4
+  accuracy 0.001
+  pigment { rgb <0.4, 0.6, 0.9> }
+  finish { specular 0.4 }
+}
@@ -0,0 +1,48 @@
+// Persistence of Vision Ray Tracer Scene Description File
+// File: perf_media.pov
+// Desc: Performance regression scene - spotlight through scattering
+//       media with a turbulent density, exercising media sampling.
+
+#version 3.7;
+
+global_settings { assumed_gamma 1.0 }
+
+camera {
+  location <0, 1.5, -5>
+  look_at  <0, 1, 0>
+  angle 50
+  right x*image_width/image_height
+}
+
+light_source {
+  <0, 4, 0> rgb 1
+  spotlight
+  point_at <0, 0, 0>
+  radius 15
+  falloff 25
+  media_interaction on
+}
+
+plane { y, 0 pigment { rgb 0.6 } }
+
+sphere { <0, 2.2, 0>, 0.3 pigment { rgb 0.3 } }
+
+box {
+  <-2, 0, -2>, <2, 4, 2>
+  pigment { rgbt 1 }
+  hollow
+  interior {
+    media {
+      scattering { 1, rgb 0.3 }
+      method 3
+      intervals 1
+      samples 20
+      density {
+        bozo
+        turbulence 0.5
+        color_map { [0 rgb 0.2] [1 rgb 1] }
+        scale 0.5
+      }
+    }
+  }
+}
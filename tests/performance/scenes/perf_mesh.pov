@@ -0,0 +1,63 @@
+// Persistence of Vision Ray Tracer Scene Description File
+// File: perf_mesh.pov
+// Desc: Performance regression scene - large smooth triangle mesh
+//       with reflections, exercising mesh intersection and bounding.
+
+#version 3.7;
+
+global_settings { assumed_gamma 1.0 }
+
+camera {
+  location <0, 1.5, -4>
+  look_at  <0, 0.3, 0>
+  angle 45
+  right x*image_width/image_height
+}
+
+light_source { <-5, 8, -6> rgb 1 }
+light_source { < 6, 4, -3> rgb 0.4 }
+
+plane { y, -1 pigment { checker rgb 0.2 rgb 0.8 scale 0.5 } }
+
+// Wavy torus-like surface of revolution; 160 x 80 quads.
+#declare NU = 160;
+#declare NV = 80;
+#declare Radius1 = 1.2;
+#declare Radius2 = 0.45;
+
+mesh2 {
+  vertex_vectors {
+    NU*NV,
+    #declare I = 0;
+    #while (I < NU)
+      #declare J = 0;
+      #while (J < NV)
+        #declare U = 2*pi*I/NU;
+        #declare V = 2*pi*J/NV;
+        #declare R2 = Radius2*(1 + 0.15*sin(7*U)*cos(3*V));
+        <(Radius1 + R2*cos(V))*cos(U), R2*sin(V), (Radius1 + R2*cos(V))*sin(U)>,
+        #declare J = J + 1;
+      #end
+      #declare I = I + 1;
+    #end
+  }
+  face_indices {
+    NU*NV*2,
+    #declare I = 0;
+    #while (I < NU)
+      #declare J = 0;
+      #while (J < NV)
+        #declare A = I*NV + J;
+        #declare B = mod(I+1, NU)*NV + J;
+        #declare C = I*NV + mod(J+1, NV);
+        #declare D = mod(I+1, NU)*NV + mod(J+1, NV);
+        <A, B, D>, <A, D, C>,
+        #declare J = J + 1;
+      #end
+      #declare I = I + 1;
+    #end
+  }
+  pigment { rgb <0.8, 0.5, 0.2> }
+  finish { specular 0.6 reflection 0.3 }
+  rotate x*30
+}
@@ -0,0 +1,62 @@
+// Persistence of Vision Ray Tracer Scene Description File
+// File: perf_parser.pov
+// Desc: Performance regression scene - macro-heavy scene generation,
+//       exercising the parser, symbol tables, arrays and strings.
+
+#version 3.7;
+
+global_settings { assumed_gamma 1.0 }
+
+camera {
+  location <0, 12, -16>
+  look_at  <0, 0, 0>
+  angle 50
+  right x*image_width/image_height
+}
+
+light_source { <-10, 20, -10> rgb 1 }
+
+#declare Seed = seed(1234);
+
+// Recursive macro building a tree of spheres and cylinders.
+#macro Branch(Base, Dir, Len, Depth)
+  #local Tip = Base + Dir*Len;
+  cylinder { Base, Tip, Len*0.05 }
+  #if (Depth > 0)
+    #local I = 0;
+    #while (I < 3)
+      #local Axis = vnormalize(vcross(Dir, <rand(Seed)-0.5, rand(Seed)-0.5, rand(Seed)-0.5>));
+      #local NewDir = vnormalize(vaxis_rotate(Dir, Axis, 25 + 20*rand(Seed)));
+      Branch(Tip, NewDir, Len*0.7, Depth-1)
+      #local I = I + 1;
+    #end
+  #else
+    sphere { Tip, Len*0.15 }
+  #end
+#end
+
+// Grid of small trees, each with a name built via string operations.
+#declare Names = array[64];
+#declare N = 0;
+#while (N < 64)
+  #declare Names[N] = concat("tree_", str(N, 0, 0), "_", str(mod(N*7, 13), 0, 0));
+  #declare N = N + 1;
+#end
+
+union {
+  #declare N = 0;
+  #while (N < 64)
+    #local X = mod(N, 8) - 3.5;
+    #local Z = div(N, 8) - 3.5;
+    #if (strlen(Names[N]) > 0)
+      union {
+        Branch(<0, 0, 0>, y, 1, 5)
+        translate <X*2, 0, Z*2>
+      }
+    #end
+    #declare N = N + 1;
+  #end
+  pigment { rgb <0.4, 0.7, 0.3> }
+}
+
+plane { y, 0 pigment { rgb 0.6 } }
@@ -0,0 +1,42 @@
+// Persistence of Vision Ray Tracer Scene Description File
+// File: perf_photons.pov
+// Desc: Performance regression scene - glass and metal caustics,
+//       exercising photon shooting, sorting and gathering.
+
+#version 3.7;
+
+global_settings {
+  assumed_gamma 1.0
+  photons {
+    spacing 0.02
+    autostop 0
+    jitter 0
+  }
+}
+
+camera {
+  location <0, 2.5, -4>
+  look_at  <0, 0.3, 0>
+  angle 45
+  right x*image_width/image_height
+}
+
+light_source { <-3, 6, -2> rgb 1 photons { refraction on reflection on } }
+
+plane { y, 0 pigment { rgb 0.8 } }
+
+sphere {
+  <-0.7, 0.6, 0>, 0.6
+  pigment { rgbf <1, 1, 1, 0.95> }
+  finish { reflection 0.05 }
+  interior { ior 1.5 }
+  photons { target refraction on reflection off }
+}
+
+torus {
+  0.5, 0.1
+  translate <0.8, 0.1, 0.3>
+  pigment { rgb <0.9, 0.7, 0.3> }
+  finish { reflection 0.8 }
+  photons { target refraction off reflection on }
+}
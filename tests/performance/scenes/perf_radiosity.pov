@@ -0,0 +1,42 @@
+// Persistence of Vision Ray Tracer Scene Description File
+// File: perf_radiosity.pov
+// Desc: Performance regression scene - closed room lit by a single
+//       light, exercising radiosity pretrace and sample lookup.
+
+#version 3.7;
+
+global_settings {
+  assumed_gamma 1.0
+  radiosity {
+    pretrace_start 0.08
+    pretrace_end   0.02
+    count 200
+    nearest_count 10
+    error_bound 0.5
+    recursion_limit 2
+    brightness 1
+  }
+}
+
+camera {
+  location <0, 1.5, -2.8>
+  look_at  <0, 1.2, 0>
+  angle 70
+  right x*image_width/image_height
+}
+
+light_source { <1.5, 2.7, -1> rgb 1 }
+
+// Room.
+box {
+  <-3, 0, -3>, <3, 3, 3>
+  hollow
+  pigment { rgb 0.8 }
+  finish { diffuse 0.8 ambient 0 }
+}
+
+box { <-3, 0, -3>, <-2.95, 3, 3> pigment { rgb <0.8, 0.2, 0.1> } finish { diffuse 0.8 ambient 0 } }
+box { < 2.95, 0, -3>, <3, 3, 3> pigment { rgb <0.1, 0.3, 0.8> } finish { diffuse 0.8 ambient 0 } }
+
+sphere { <-0.8, 0.5, 0.5>, 0.5 pigment { rgb 0.9 } finish { diffuse 0.8 ambient 0 } }
+box { <0.3, 0, 0.2>, <1.3, 1.2, 1.2> rotate y*20 pigment { rgb 0.9 } finish { diffuse 0.8 ambient 0 } }
@@ -0,0 +1,36 @@
+// Persistence of Vision Ray Tracer Scene Description File
+// File: perf_sss.pov
+// Desc: Performance regression scene - translucent objects,
+//       exercising subsurface light transport.
+
+#version 3.7;
+
+global_settings {
+  assumed_gamma 1.0
+  mm_per_unit 40
+  subsurface { samples 50, 20 }
+}
+
+camera {
+  location <0, 1.5, -3.5>
+  look_at  <0, 0.5, 0>
+  angle 45
+  right x*image_width/image_height
+}
+
+light_source { <-2, 4, 3> rgb 1 }
+light_source { < 3, 3, -4> rgb 0.3 }
+
+plane { y, 0 pigment { rgb 0.7 } }
+
+sphere {
+  <-0.6, 0.5, 0>, 0.5
+  pigment { rgb <0.9, 0.8, 0.7> }
+  finish { subsurface { translucency <0.4562, 0.3811, 0.3325> } }
+}
+
+cylinder {
+  <0.6, 0, 0.3>, <0.6, 1.2, 0.3>, 0.3
+  pigment { rgb <0.9, 0.6, 0.5> }
+  finish { subsurface { translucency <0.8, 0.4, 0.3> } }
+}
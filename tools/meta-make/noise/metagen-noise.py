@@ -0,0 +1,136 @@
+#!/usr/bin/env python
+
+import getopt, math, sys
+
+def printerr(s):
+    sys.stderr.write("%s\n" % s);
+
+def UsageError():
+    printerr("metagen-noise.py");
+    printerr("    Create the lookup tables of the noise functions as C-style arrays,");
+    printerr("    replicating the pseudo-random sequences formerly used to fill them");
+    printerr("    at program start-up.");
+    printerr("Usage:");
+    printerr("    python metagen-noise.py [options]");
+    printerr("Output options:");
+    printerr("    -h          Generates declarations only.");
+    printerr("    -n<STRING>  Wraps the declarations/definitions in a namespace.");
+    sys.exit(2);
+
+def Error(s):
+    printerr(s);
+    sys.exit(1);
+
+header    = False;
+namespace = "";
+
+try:
+    opts, args = getopt.getopt(sys.argv[1:], "hn:");
+
+except getopt.GetoptError as err:
+    UsageError();
+
+for o, a in opts:
+    if (o == "-h"):
+        header = True;
+    elif (o == "-n"):
+        namespace = a;
+    else:
+        Error("Unrecognized option %s" % o);
+
+if (len(args) > 0):
+    printerr("Too many parameters.");
+    UsageError();
+
+# Number of distinct entries in the Perlin noise tables; must be a power of 2.
+noiseEntries = 2048;
+
+# The legacy generator `next_rand = next_rand * 1812433253L + 12345L`,
+# with 32-bit two's complement wrap-around.
+def NextRand(r):
+    r = (r * 1812433253 + 12345) & 0xFFFFFFFF;
+    if (r >= 0x80000000):
+        r -= 0x100000000;
+    return r;
+
+def RandBits(r):
+    return (r >> 16) & 0x7FFF;
+
+def HashTable():
+    table = list(range(4096));
+    r = 0;
+    for i in range(4095, -1, -1):
+        r = NextRand(r);
+        j = RandBits(r) % 4096;
+        table[i], table[j] = table[j], table[i];
+    return table + table;
+
+def SolidNoiseTables():
+    # Random gradient vectors uniformly distributed on the unit sphere.
+    gradients = [];
+    r = 1;
+    for i in range(noiseEntries):
+        while True:
+            v = [];
+            for j in range(3):
+                r = NextRand(r);
+                v.append(float((RandBits(r) % (noiseEntries << 1)) - noiseEntries) / float(noiseEntries));
+            s = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+            if ((s <= 1.0) and (s >= 1.0e-5)):
+                break;
+        d = math.sqrt(s);
+        gradients.append([v[0] / d, v[1] / d, v[2] / d]);
+    # Pseudo-random permutation of [0..noiseEntries]; note that only every other entry is swapped.
+    permutation = list(range(noiseEntries)) + [0];
+    for i in range(noiseEntries, 0, -2):
+        k = permutation[i];
+        r = NextRand(r);
+        j = RandBits(r) % noiseEntries;
+        permutation[i] = permutation[j];
+        permutation[j] = k;
+    # Duplicate the entries so that no modulus operation is needed to look up values;
+    # the copy runs in place, so entry noiseEntries is overwritten before it is read.
+    permutation = permutation[:noiseEntries];
+    permutation = permutation + permutation + permutation[:2];
+    gradients = gradients + gradients + gradients[:2];
+    return permutation, gradients;
+
+def PrintIntegers(declaration, data, format, itemsPerLine):
+    print("%s = {" % declaration);
+    for i in range(0, len(data), itemsPerLine):
+        print("  %s," % ",".join([format % x for x in data[i:i + itemsPerLine]]));
+    print("};");
+
+size = 2 * (noiseEntries + 1);
+
+hashDeclaration        = "extern const unsigned short hashTable[8192]";
+permutationDeclaration = "extern const int NoisePermutation[%i]" % size;
+gradientsDeclaration   = "extern const double NoiseGradients[%i][3]" % size;
+
+if (namespace):
+    print("namespace %s {" % namespace);
+    print("");
+
+if (header):
+    print("/// Pseudo-random permutation of [0..4095], repeated twice.");
+    print("%s;" % hashDeclaration);
+    print("");
+    print("/// Pseudo-random permutation table of the Perlin noise generator.");
+    print("%s;" % permutationDeclaration);
+    print("");
+    print("/// Random unit gradient vectors of the Perlin noise generator.");
+    print("%s;" % gradientsDeclaration);
+else:
+    permutation, gradients = SolidNoiseTables();
+    PrintIntegers(hashDeclaration, HashTable(), "%4i", 16);
+    print("");
+    PrintIntegers(permutationDeclaration, permutation, "%4i", 16);
+    print("");
+    print("%s = {" % gradientsDeclaration);
+    for v in gradients:
+        print("  { %s }," % ", ".join([repr(x) for x in v]));
+    print("};");
+
+if (namespace):
+    print("");
+    print("}");
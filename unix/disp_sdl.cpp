@@ -77,6 +77,7 @@ namespace pov_frontend
         m_display_scale = 1.;
         m_screen = nullptr;
         m_display = nullptr;
+        m_LastUpdate = 0;
     }
 
     UnixSDLDisplay::~UnixSDLDisplay()
@@ -124,6 +125,8 @@ namespace pov_frontend
 
     void UnixSDLDisplay::Close()
     {
+        boost::mutex::scoped_lock lock(m_Mutex);
+
         if (!m_valid)
             return;
 
@@ -131,6 +134,7 @@ namespace pov_frontend
 //      SDL_FreeSurface(m_display);
 //      SDL_Quit();
         m_PxCount.clear();
+        m_update_rects.clear();
         m_valid = false;
     }
 
@@ -222,18 +226,14 @@ namespace pov_frontend
             for(vector<unsigned char>::iterator iter = m_PxCount.begin(); iter != m_PxCount.end(); iter++)
                 (*iter) = 0;
 
-            m_update_rect.x = 0;
-            m_update_rect.y = 0;
-            m_update_rect.w = width;
-            m_update_rect.h = height;
-
             m_screen_rect.x = 0;
             m_screen_rect.y = 0;
             m_screen_rect.w = width;
             m_screen_rect.h = height;
 
+            UpdateAll();
             m_valid = true;
-            m_PxCnt = UpdateInterval;
+            m_LastUpdate = 0;
 
             if ((width == GetWidth()) && (height == GetHeight()))
             {
@@ -341,26 +341,61 @@ namespace pov_frontend
 
     void UnixSDLDisplay::UpdateCoord(unsigned int x, unsigned int y)
     {
-        unsigned int rx2 = m_update_rect.x + m_update_rect.w;
-        unsigned int ry2 = m_update_rect.y + m_update_rect.h;
-        m_update_rect.x = min((unsigned int)m_update_rect.x, x);
-        m_update_rect.y = min((unsigned int)m_update_rect.y, y);
-        rx2 = max(rx2, x);
-        ry2 = max(ry2, y);
-        m_update_rect.w = rx2 - m_update_rect.x;
-        m_update_rect.h = ry2 - m_update_rect.y;
+        UpdateCoord(x, y, x, y);
     }
 
     void UnixSDLDisplay::UpdateCoord(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2)
     {
-        unsigned int rx2 = m_update_rect.x + m_update_rect.w;
-        unsigned int ry2 = m_update_rect.y + m_update_rect.h;
-        m_update_rect.x = min((unsigned int)m_update_rect.x, x1);
-        m_update_rect.y = min((unsigned int)m_update_rect.y, y1);
-        rx2 = max(rx2, x2);
-        ry2 = max(ry2, y2);
-        m_update_rect.w = rx2 - m_update_rect.x;
-        m_update_rect.h = ry2 - m_update_rect.y;
+        // SDL_Rect spans exclusive of its far edges
+        int rx1 = x1;
+        int ry1 = y1;
+        int rx2 = min(int(x2) + 1, int(m_display->w));
+        int ry2 = min(int(y2) + 1, int(m_display->h));
+        if (rx1 >= rx2 || ry1 >= ry2)
+            return;
+
+        // merge with any rectangle overlapping or touching this one, repeating as long as the
+        // merged rectangle grows into yet another one
+        for (size_t i = 0; i < m_update_rects.size(); )
+        {
+            const SDL_Rect& r = m_update_rects[i];
+            if (r.x > rx2 || r.y > ry2 || r.x + r.w < rx1 || r.y + r.h < ry1)
+            {
+                i++;
+                continue;
+            }
+            rx1 = min(rx1, int(r.x));
+            ry1 = min(ry1, int(r.y));
+            rx2 = max(rx2, int(r.x + r.w));
+            ry2 = max(ry2, int(r.y + r.h));
+            m_update_rects.erase(m_update_rects.begin() + i);
+            i = 0;
+        }
+
+        // too many separate rectangles cost more to update than their bounding box
+        if (m_update_rects.size() >= MaxUpdateRects)
+        {
+            for (vector<SDL_Rect>::const_iterator r = m_update_rects.begin(); r != m_update_rects.end(); r++)
+            {
+                rx1 = min(rx1, int(r->x));
+                ry1 = min(ry1, int(r->y));
+                rx2 = max(rx2, int(r->x + r->w));
+                ry2 = max(ry2, int(r->y + r->h));
+            }
+            m_update_rects.clear();
+        }
+
+        SDL_Rect rect;
+        rect.x = rx1;
+        rect.y = ry1;
+        rect.w = rx2 - rx1;
+        rect.h = ry2 - ry1;
+        m_update_rects.push_back(rect);
+    }
+
+    void UnixSDLDisplay::UpdateAll()
+    {
+        m_update_rects.assign(1, m_screen_rect);
     }
 
     void UnixSDLDisplay::UpdateCoordScaled(unsigned int x, unsigned int y)
@@ -376,6 +411,8 @@ namespace pov_frontend
 
     void UnixSDLDisplay::DrawPixel(unsigned int x, unsigned int y, const RGBA8& colour)
     {
+        boost::mutex::scoped_lock lock(m_Mutex);
+
         if (!m_valid || x >= GetWidth() || y >= GetHeight())
             return;
         if (SDL_MUSTLOCK(m_display) && SDL_LockSurface(m_display) < 0)
@@ -392,14 +429,14 @@ namespace pov_frontend
             UpdateCoord(x, y);
         }
 
-        m_PxCnt++;
-
         if (SDL_MUSTLOCK(m_display))
             SDL_UnlockSurface(m_display);
     }
 
     void UnixSDLDisplay::DrawRectangleFrame(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const RGBA8& colour)
     {
+        boost::mutex::scoped_lock lock(m_Mutex);
+
         if (!m_valid)
             return;
 
@@ -444,12 +481,12 @@ namespace pov_frontend
 
         if (SDL_MUSTLOCK(m_display))
             SDL_UnlockSurface(m_display);
-
-        m_PxCnt = UpdateInterval;
     }
 
     void UnixSDLDisplay::DrawFilledRectangle(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const RGBA8& colour)
     {
+        boost::mutex::scoped_lock lock(m_Mutex);
+
         if (!m_valid)
             return;
 
@@ -476,12 +513,12 @@ namespace pov_frontend
         tempRect.w = ix2 - ix1 + 1;
         tempRect.h = iy2 - iy1 + 1;
         SDL_FillRect(m_display, &tempRect, sdl_col);
-
-        m_PxCnt = UpdateInterval;
     }
 
     void UnixSDLDisplay::DrawPixelBlock(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const RGBA8 *colour)
     {
+        boost::mutex::scoped_lock lock(m_Mutex);
+
         if (!m_valid)
             return;
 
@@ -510,35 +547,47 @@ namespace pov_frontend
 
         if (SDL_MUSTLOCK(m_display))
             SDL_UnlockSurface(m_display);
-
-        m_PxCnt = UpdateInterval;
     }
 
     void UnixSDLDisplay::Clear()
     {
+        boost::mutex::scoped_lock lock(m_Mutex);
+
         for(vector<unsigned char>::iterator iter = m_PxCount.begin(); iter != m_PxCount.end(); iter++)
             (*iter) = 0;
 
-        m_update_rect.x = 0;
-        m_update_rect.y = 0;
-        m_update_rect.w = m_display->w;
-        m_update_rect.h = m_display->h;
+        SDL_Rect rect;
+        rect.x = 0;
+        rect.y = 0;
+        rect.w = m_display->w;
+        rect.h = m_display->h;
 
-        SDL_FillRect(m_display, &m_update_rect, (Uint32)0);
+        SDL_FillRect(m_display, &rect, (Uint32)0);
 
-        m_PxCnt = UpdateInterval;
+        UpdateAll();
     }
 
     void UnixSDLDisplay::UpdateScreen(bool Force = false)
     {
-        if (!m_valid)
+        boost::mutex::scoped_lock lock(m_Mutex);
+
+        if (!m_valid || m_update_rects.empty())
             return;
-        if (Force || m_PxCnt >= UpdateInterval)
+
+        // coalesce the changes of several render blocks into one update, to keep the display from
+        // taking CPU time away from the render
+        Uint32 now = SDL_GetTicks();
+        if (!Force && now - m_LastUpdate < UpdateInterval)
+            return;
+
+        for (vector<SDL_Rect>::iterator r = m_update_rects.begin(); r != m_update_rects.end(); r++)
         {
-            SDL_BlitSurface(m_display, &m_update_rect, m_screen, &m_update_rect);
-            SDL_UpdateRect(m_screen, m_update_rect.x, m_update_rect.y, m_update_rect.w, m_update_rect.h);
-            m_PxCnt = 0;
+            SDL_Rect dest = *r; // SDL_BlitSurface clips the destination rectangle in place
+            SDL_BlitSurface(m_display, &(*r), m_screen, &dest);
         }
+        SDL_UpdateRects(m_screen, m_update_rects.size(), &m_update_rects[0]);
+        m_update_rects.clear();
+        m_LastUpdate = now;
     }
 
     void UnixSDLDisplay::PauseWhenDoneNotifyStart()
@@ -44,6 +44,10 @@
 #include "unixoptions.h"
 #include "disp.h"
 
+#include <vector>
+
+#include <boost/thread/mutex.hpp>
+
 #include <SDL/SDL.h>
 
 namespace pov_frontend
@@ -76,8 +80,10 @@ namespace pov_frontend
             void PauseWhenDoneNotifyEnd();
 
         protected:
-            /// Number of Pixels before the display is updated
-            static const unsigned int UpdateInterval = 100;
+            /// Minimum time between screen updates in milliseconds, unless forced
+            static const Uint32 UpdateInterval = 40;
+            /// Maximum number of separate rectangles to update at a time
+            static const size_t MaxUpdateRects = 16;
 
             void SetCaption(bool paused);
 
@@ -89,25 +95,35 @@ namespace pov_frontend
                  If the pixel is already filled the color is mixed.
             */
             inline void SetPixelScaled(unsigned int x, unsigned int y, const RGBA8& colour);
-            /// Makes a pixel coordinate part of the update rectangle
+            /// Makes a pixel coordinate part of the update region
             void UpdateCoord(unsigned int x, unsigned int y);
-            /// Makes a rectangle part of the update rectangle
+            /**
+                 @brief Makes a rectangle part of the update region.
+
+                 The rectangle is merged with any rectangle of the region it overlaps or touches,
+                 so that adjacent render blocks are updated together.
+            */
             void UpdateCoord(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2);
-            /// Makes a pixel coordinate part of the update rectangle (scaled down image version)
+            /// Makes a pixel coordinate part of the update region (scaled down image version)
             void UpdateCoordScaled(unsigned int x, unsigned int y);
-            /// Makes a rectangle part of the update rectangle (scaled down image version)
+            /// Makes a rectangle part of the update region (scaled down image version)
             void UpdateCoordScaled(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2);
+            /// Makes the entire display the update region
+            void UpdateAll();
 
             bool m_Initialized;
             bool m_valid;
             bool m_display_scaled;
             float m_display_scale;
-            /// for update interval
-            unsigned int m_PxCnt;
+            /// time of the last screen update, for update interval
+            Uint32 m_LastUpdate;
             SDL_Surface *m_screen;
             SDL_Surface *m_display;
             SDL_Rect m_screen_rect;
-            SDL_Rect m_update_rect;
+            /// parts of the display changed since the last screen update
+            std::vector<SDL_Rect> m_update_rects;
+            /// guards the display surface, which is drawn to by the display update thread
+            boost::mutex m_Mutex;
             /// for mixing colors in scaled down display
             vector<unsigned char> m_PxCount;
     };
@@ -195,9 +195,15 @@ const int NULL=0;
     #define TRY_OPTIMIZED_NOISE_AVX             // AVX-only hand-optimized noise (Intel).
 #endif
 
+#if defined(HAVE_ASM_AVX)
+    #define TRY_OPTIMIZED_BVH                   // optimized bounding hierarchy master switch.
+    #define TRY_OPTIMIZED_BVH_AVX               // AVX flattened bounding hierarchy node test.
+#endif
+
 #if defined(DISABLE_AVX)
     #define DISABLE_OPTIMIZED_NOISE_AVX
     #define DISABLE_OPTIMIZED_NOISE_AVX_PORTABLE
+    #define DISABLE_OPTIMIZED_BVH_AVX
 #endif
 
 #if defined(HAVE_ASM_AVX) && defined(HAVE_ASM_FMA4)
@@ -50,6 +50,11 @@
 #define POV_USE_DEFAULT_TASK_INITIALIZE 1
 #define POV_USE_DEFAULT_TASK_CLEANUP    1
 
+// On Linux, render threads can be bound to CPUs (see `platform/unix/syspovtask.cpp`).
+#ifdef __linux__
+    #define POV_USE_DEFAULT_TASK_AFFINITY 0
+#endif
+
 // Linux machines appear to need more stack storage than the default.
 // Note that we leave this setting configurable via `-DPOV_THREAD_STACK_SIZE=...`.
 #ifndef POV_THREAD_STACK_SIZE
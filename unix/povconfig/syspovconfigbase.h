@@ -65,6 +65,40 @@
     #define POV_USE_DEFAULT_TIMER 1
 #endif
 
+// Our Unix-specific implementation of the HardwareCounters class relies on the Linux
+// perf_event_open() system call. Elsewhere we're falling back to POV-Ray's platform-independent
+// default implementation, which supports no counters.
+#if defined(HAVE_LINUX_PERF_EVENT_H) && defined(HAVE_SYS_SYSCALL_H)
+    #define POV_USE_DEFAULT_HARDWARE_COUNTERS 0
+#else
+    #define POV_USE_DEFAULT_HARDWARE_COUNTERS 1
+#endif
+
+// Our Unix-specific implementation of the MappedFile class relies on the presence of the mmap()
+// function. If we don't have it, we're falling back to POV-Ray's platform-independent default
+// implementation, which reads the whole file into memory.
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+    #define POV_USE_DEFAULT_FILE_MAPPING 0
+#else
+    #define POV_USE_DEFAULT_FILE_MAPPING 1
+#endif
+
+// The same goes for the WritableMappedFile class, which additionally makes use of madvise() to
+// pass access pattern hints to the kernel where available.
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+    #define POV_USE_DEFAULT_WRITABLE_FILE_MAPPING 0
+#else
+    #define POV_USE_DEFAULT_WRITABLE_FILE_MAPPING 1
+#endif
+
+// Our Unix-specific implementation of directory listing relies on the presence of the opendir()
+// function. If we don't have it, file searches check each candidate file name individually.
+#if defined(HAVE_OPENDIR) && defined(HAVE_DIRENT_H)
+    #define POV_USE_DEFAULT_DIRECTORY_LISTING 0
+#else
+    #define POV_USE_DEFAULT_DIRECTORY_LISTING 1
+#endif
+
 // The default Path::ParsePathString() suits our needs perfectly.
 #define POV_USE_DEFAULT_PATH_PARSER 1
 
@@ -42,4 +42,12 @@
 
 #include "syspovconfig.h"
 
+// On x86-64 with the System V calling convention, functions are translated to native code, using
+// mmap() to obtain executable memory. (Cygwin uses the Microsoft calling convention, and the x32
+// ABI has 32-bit pointers, neither of which the translator supports.)
+#if (defined(__x86_64__) || defined(__amd64__)) && !defined(__CYGWIN__) && !defined(__ILP32__) && \
+    defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+    #define POV_VM_JIT 1
+#endif
+
 #endif // POVRAY_UNIX_SYSPOVCONFIGVM_H
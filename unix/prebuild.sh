@@ -434,6 +434,21 @@ povray_SOURCES = \\
   disp_sdl.cpp disp_sdl.h \\
   disp_text.cpp disp_text.h
 
+# Subsystem microbenchmarks; not built by default, use \`make povbench'.
+EXTRA_PROGRAMS = povbench
+povbench_SOURCES = \\
+  ../tests/benchmark/microbench.h \\
+  ../tests/benchmark/microbench_bounding.cpp \\
+  ../tests/benchmark/microbench_image.cpp \\
+  ../tests/benchmark/microbench_lighting.cpp \\
+  ../tests/benchmark/microbench_main.cpp \\
+  ../tests/benchmark/microbench_noise.cpp \\
+  ../tests/benchmark/microbench_parser.cpp \\
+  ../tests/benchmark/microbench_shapes.cpp \\
+  ../tests/benchmark/microbench_spline.cpp \\
+  ../tests/benchmark/microbench_vm.cpp
+povbench_CPPFLAGS = \$(AM_CPPFLAGS) -I\$(top_srcdir)/tests/benchmark
+
 cppflags_platformcpu =
 ldadd_platformcpu =
 if BUILD_x86
@@ -607,7 +622,8 @@ SUBDIRS = source vfe platform unix
 EXTRA_DIST = \\
   bootstrap kde_install.sh \\
   doc icons include ini scenes scripts \\
-  povray.ini.in changes.txt revision.txt
+  povray.ini.in changes.txt revision.txt \\
+  tests/performance
 
 # Additional files to clean with 'make distclean'.
 DISTCLEANFILES = \$(top_builddir)/povray.ini
@@ -618,6 +634,12 @@ CONFIG_CLEAN_FILES =
 check: all
 	\$(top_builddir)/unix/povray +i\$(top_srcdir)/scenes/advanced/biscuit.pov -f +d +p +v +w320 +h240 +a0.3 +L\$(top_srcdir)/include
 
+# Compare rendering performance against the host's baseline for 'make check-perf'.
+# See tests/performance/perf_regression.sh for the options and environment.
+.PHONY: check-perf
+check-perf: all
+	\$(SHELL) \$(top_srcdir)/tests/performance/perf_regression.sh \$(top_builddir)/unix/povray\$(EXEEXT)
+
 # Install scripts in povlibdir.
 nobase_povlib_SCRIPTS = `echo $scriptfiles`
 
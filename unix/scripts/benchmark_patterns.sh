@@ -0,0 +1,41 @@
+#!/bin/sh
+# ==============================================================================
+# POV-Ray v3.8
+# benchmark_patterns.sh - compare render patterns on the benchmark scene
+# ==============================================================================
+# This file is part of POV-Ray and subject to the POV-Ray licence
+# see POVLEGAL.DOC for details
+# ------------------------------------------------------------------------------
+# calling conventions:
+#
+#   benchmark_patterns.sh [benchmark_directory] [threads]
+#
+# benchmark_directory: directory holding benchmark.ini and benchmark.pov
+#                      (defaults to the one in the distribution scenes)
+# threads: number of render threads (defaults to all available)
+#
+# The benchmark scene is rendered once with each render pattern, and the
+# trace time as reported by POV-Ray is printed for each pattern.
+# ==============================================================================
+
+# --- specify additional render options here ---
+POV_OPTIONS="-d -f"
+
+SCRIPT_DIR=`dirname $0`
+BENCHMARK_DIR="${1:-$SCRIPT_DIR/../../distribution/scenes/advanced/benchmark}"
+
+if [ ! -z "$2" ] ; then
+  POV_OPTIONS="$POV_OPTIONS +WT$2"
+fi
+
+if [ ! -f "$BENCHMARK_DIR/benchmark.ini" ] ; then
+  echo "benchmark scene not found in $BENCHMARK_DIR"
+  exit 1
+fi
+
+cd "$BENCHMARK_DIR"
+
+for PATTERN in 0 1 2 3 4 5 6 7 ; do
+  TIME=`povray benchmark.ini +RP$PATTERN $POV_OPTIONS 2>&1 | grep -E '^ *Trace Time:' | sed 's/^ *Trace Time: *//'`
+  echo "Render_Pattern=$PATTERN: $TIME"
+done
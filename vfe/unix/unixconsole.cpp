@@ -303,7 +303,7 @@ static void PauseWhenDone(vfeSession *session)
     GetRenderWindow()->PauseWhenDoneNotifyEnd();
 }
 
-static ReturnValue PrepareBenchmark(vfeSession *session, vfeRenderOptions& opts, string& ini, string& pov, int argc, char **argv)
+static void ParseBenchmarkOptions(vfeRenderOptions& opts, char **argv)
 {
     // parse command-line options
     while (*++argv)
@@ -327,6 +327,32 @@ static ReturnValue PrepareBenchmark(vfeSession *session, vfeRenderOptions& opts,
             opts.AddLibraryPath(s);
         }
     }
+}
+
+static ReturnValue WriteBenchmarkFiles(vfeSession *session, string& ini, string& pov)
+{
+    int benchversion = pov::Get_Benchmark_Version();
+    string basename = UCS2toASCIIString(session->CreateTemporaryFile());
+    ini = basename + ".ini";
+    pov = basename + ".pov";
+    if (pov::Write_Benchmark_File(pov.c_str(), ini.c_str()))
+    {
+        fprintf(stderr, "%s: creating %s\n", PACKAGE, ini.c_str());
+        fprintf(stderr, "%s: creating %s\n", PACKAGE, pov.c_str());
+        fprintf(stderr, "Running standard POV-Ray benchmark version %x.%02x\n", benchversion / 256, benchversion % 256);
+    }
+    else
+    {
+        fprintf(stderr, "%s: failed to write temporary files for benchmark\n", PACKAGE);
+        return RETURN_ERROR;
+    }
+
+    return RETURN_OK;
+}
+
+static ReturnValue PrepareBenchmark(vfeSession *session, vfeRenderOptions& opts, string& ini, string& pov, int argc, char **argv)
+{
+    ParseBenchmarkOptions(opts, argv);
 
     int benchversion = pov::Get_Benchmark_Version();
     fprintf(stderr, "\
@@ -372,22 +398,7 @@ Press <Enter> to continue or <Ctrl-C> to abort.\n\
         Delay(20);
     }
 
-    string basename = UCS2toASCIIString(session->CreateTemporaryFile());
-    ini = basename + ".ini";
-    pov = basename + ".pov";
-    if (pov::Write_Benchmark_File(pov.c_str(), ini.c_str()))
-    {
-        fprintf(stderr, "%s: creating %s\n", PACKAGE, ini.c_str());
-        fprintf(stderr, "%s: creating %s\n", PACKAGE, pov.c_str());
-        fprintf(stderr, "Running standard POV-Ray benchmark version %x.%02x\n", benchversion / 256, benchversion % 256);
-    }
-    else
-    {
-        fprintf(stderr, "%s: failed to write temporary files for benchmark\n", PACKAGE);
-        return RETURN_ERROR;
-    }
-
-    return RETURN_OK;
+    return WriteBenchmarkFiles(session, ini, pov);
 }
 
 static void CleanupBenchmark(vfeUnixSession *session, string& ini, string& pov)
@@ -398,6 +409,147 @@ static void CleanupBenchmark(vfeUnixSession *session, string& ini, string& pov)
     session->DeleteTemporaryFile(ASCIItoUCS2String(pov.c_str()));
 }
 
+struct ScalingSample
+{
+    int threads;
+    vfeSession::PhaseTime phases[vfeSession::pMaxPhase];
+};
+
+static const char *gPhaseNames[vfeSession::pMaxPhase] = { "Parse", "Bounding", "Photons", "Radiosity", "Trace" };
+
+static POV_LONG TotalRealTime(const ScalingSample& sample)
+{
+    POV_LONG total = 0;
+    for (int i = 0; i < vfeSession::pMaxPhase; i++)
+        total += sample.phases[i].m_RealTime;
+    return total;
+}
+
+// parallel efficiency, i.e. speed-up relative to the single-thread render divided by the thread count
+static void FormatEfficiency(char *buffer, size_t size, POV_LONG baseTime, POV_LONG time, int threads)
+{
+    if (baseTime > 0 && time > 0)
+        snprintf(buffer, size, "%9d%%", int(100.0 * double(baseTime) / (double(time) * threads) + 0.5));
+    else
+        snprintf(buffer, size, "%10s", "-");
+}
+
+static void PrintScalingReport(const vector<ScalingSample>& samples)
+{
+    const ScalingSample& base = samples.front();
+    char cell[32];
+
+    fprintf(stderr, "\n==== [Thread Scaling] ======================================================\n");
+    fprintf(stderr, "Wall-clock time per phase (seconds)\n");
+    fprintf(stderr, "Threads ");
+    for (int i = 0; i < vfeSession::pMaxPhase; i++)
+        fprintf(stderr, "%10s", gPhaseNames[i]);
+    fprintf(stderr, "%10s\n", "Total");
+    for (vector<ScalingSample>::const_iterator s = samples.begin(); s != samples.end(); s++)
+    {
+        fprintf(stderr, "%7d ", s->threads);
+        for (int i = 0; i < vfeSession::pMaxPhase; i++)
+        {
+            if (s->phases[i].m_Threads > 0)
+                fprintf(stderr, "%10.3f", s->phases[i].m_RealTime / 1000.0);
+            else
+                fprintf(stderr, "%10s", "-");
+        }
+        fprintf(stderr, "%10.3f\n", TotalRealTime(*s) / 1000.0);
+    }
+
+    fprintf(stderr, "\nParallel efficiency per phase (speed-up over 1 thread / thread count)\n");
+    fprintf(stderr, "Threads ");
+    for (int i = 0; i < vfeSession::pMaxPhase; i++)
+        fprintf(stderr, "%10s", gPhaseNames[i]);
+    fprintf(stderr, "%10s%10s\n", "Total", "Speed-up");
+    for (vector<ScalingSample>::const_iterator s = samples.begin(); s != samples.end(); s++)
+    {
+        fprintf(stderr, "%7d ", s->threads);
+        for (int i = 0; i < vfeSession::pMaxPhase; i++)
+        {
+            FormatEfficiency(cell, sizeof(cell), base.phases[i].m_RealTime, s->phases[i].m_RealTime, s->threads);
+            fprintf(stderr, "%s", cell);
+        }
+        FormatEfficiency(cell, sizeof(cell), TotalRealTime(base), TotalRealTime(*s), s->threads);
+        POV_LONG total = TotalRealTime(*s);
+        if (total > 0)
+            fprintf(stderr, "%s%9.2fx\n", cell, double(TotalRealTime(base)) / double(total));
+        else
+            fprintf(stderr, "%s%10s\n", cell, "-");
+    }
+
+    // the trace phase ends when its slowest thread finishes its last block; until then the others sit idle
+    fprintf(stderr, "\nTime lost waiting for the slowest final block of the trace phase\n");
+    fprintf(stderr, "Threads    Workers   Slowest      Mean      Lost   of Trace\n");
+    for (vector<ScalingSample>::const_iterator s = samples.begin(); s != samples.end(); s++)
+    {
+        const vfeSession::PhaseTime& trace = s->phases[vfeSession::pTrace];
+        if (trace.m_Threads == 0)
+            continue;
+        POV_LONG lost = trace.m_RealTime - trace.m_MeanRealTime;
+        fprintf(stderr, "%7d %10d%10.3f%10.3f%10.3f%10.1f%%\n",
+                s->threads, trace.m_Threads, trace.m_RealTime / 1000.0, trace.m_MeanRealTime / 1000.0, lost / 1000.0,
+                trace.m_RealTime > 0 ? 100.0 * double(lost) / double(trace.m_RealTime) : 0.0);
+    }
+}
+
+// render the scene repeatedly with 1, 2, 4, ... threads up to the configured thread count, then report how it scaled
+static ReturnValue RunScalingBenchmark(vfeSession *session, vfeRenderOptions& opts)
+{
+    vfeStatusFlags flags;
+    vector<ScalingSample> samples;
+    int maxThreads = opts.GetThreadCount();
+    int threads = 1;
+
+    while (true)
+    {
+        char wt[32];
+        snprintf(wt, sizeof(wt), "+WT%d", threads);
+        vfeRenderOptions runOpts(opts);
+        runOpts.SetThreadCount(threads);
+        runOpts.AddCommand(wt);
+
+        fprintf(stderr, "\n==== [Scaling benchmark: %d of up to %d thread(s)] ==============================\n", threads, maxThreads);
+        if (session->SetOptions(runOpts) != vfeNoError || session->StartRender() != vfeNoError)
+        {
+            fprintf(stderr, "%s\n", session->GetErrorString());
+            return RETURN_ERROR;
+        }
+
+        session->SetEventMask(stBackendStateChanged);
+        while (((flags = session->GetStatus(true, 200)) & stRenderShutdown) == 0)
+        {
+            ProcessSignal();
+            if (gCancelRender)
+            {
+                CancelRender(session);
+                return RETURN_USER_ABORT;
+            }
+            if (flags & stAnyMessage)
+                PrintStatus (session);
+            if (flags & stBackendStateChanged)
+                PrintStatusChanged (session);
+        }
+        PrintStatus (session);
+        if (session->Succeeded() == false)
+            return RETURN_ERROR;
+
+        ScalingSample sample;
+        sample.threads = threads;
+        for (int i = 0; i < vfeSession::pMaxPhase; i++)
+            sample.phases[i] = session->GetPhaseTime(vfeSession::PhaseType(i));
+        samples.push_back(sample);
+
+        if (threads >= maxThreads)
+            break;
+        threads = min(threads * 2, maxThreads);
+    }
+
+    PrintScalingReport(samples);
+    return RETURN_OK;
+}
+
 int main (int argc, char **argv)
 {
     vfeUnixSession   *session;
@@ -405,6 +557,7 @@ int main (int argc, char **argv)
     vfeRenderOptions  opts;
     ReturnValue       retval = RETURN_OK;
     bool              running_benchmark = false;
+    bool              running_scaling = false;
     string            bench_ini_name;
     string            bench_pov_name;
     sigset_t          sigset;
@@ -507,6 +660,29 @@ int main (int argc, char **argv)
             return retval;
         }
     }
+    else if (session->GetUnixOptions()->isOptionSet("general", "benchmark-scaling"))
+    {
+        running_scaling = true;
+        // without a scene of its own, scale the built-in benchmark scene
+        if (argc < 2)
+        {
+            ParseBenchmarkOptions(opts, argv);
+            retval = WriteBenchmarkFiles(session, bench_ini_name, bench_pov_name);
+            if (retval != RETURN_OK)
+            {
+                session->Shutdown();
+                delete sigthread;
+                delete session;
+                return retval;
+            }
+            running_benchmark = true;
+        }
+        else
+        {
+            // a +WTn option sets the highest thread count to try
+            ParseBenchmarkOptions(opts, argv);
+        }
+    }
 
     // process INI settings
     if (running_benchmark)
@@ -519,12 +695,31 @@ int main (int argc, char **argv)
     else
     {
         char *s = std::getenv ("POVINC");
-        session->SetDisplayCreator(UnixDisplayCreator);
+        if (!running_scaling)
+            session->SetDisplayCreator(UnixDisplayCreator);
         session->GetUnixOptions()->Process_povray_ini(opts);
         if (s != nullptr)
             opts.AddLibraryPath (s);
         while (*++argv)
             opts.AddCommand (*argv);
+        // timings are all we are after; keep display and file output from skewing them
+        if (running_scaling)
+        {
+            opts.AddCommand ("-D");
+            opts.AddCommand ("-F");
+        }
+    }
+
+    if (running_scaling)
+    {
+        retval = RunScalingBenchmark(session, opts);
+        if (running_benchmark)
+            CleanupBenchmark(session, bench_ini_name, bench_pov_name);
+        session->Shutdown();
+        PrintStatus (session);
+        delete sigthread;
+        delete session;
+        return retval;
     }
 
     // set all options and start rendering
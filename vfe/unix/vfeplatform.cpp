@@ -39,6 +39,7 @@
 #include "syspovconfig.h"
 
 // C++ variants of C standard headers
+#include <cerrno>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -435,4 +436,28 @@ namespace vfePlatform
             return false;
         return gShelloutsPermittedFixThis;
     }
+
+    std::FILE *UnixShelloutProcessing::ExecutePipeCommand(const string& cmd, const string& params)
+    {
+        string command = cmd + " " + params;
+        boost::trim(command);
+        if (command.empty())
+            throw POV_EXCEPTION(kParamErr, "Empty output pipe command");
+
+        // the shell runs the command in the background, so this returns as soon as it has started;
+        // a command that cannot be found only shows up as a failure to write to the pipe later on.
+        std::fflush(nullptr);
+        std::FILE *pipe = popen(command.c_str(), "w");
+        if (pipe == nullptr)
+            throw POV_EXCEPTION(kCannotOpenFileErr, string("Cannot start output pipe command: ") + std::strerror(errno));
+        return pipe;
+    }
+
+    int UnixShelloutProcessing::CollectPipeCommand(std::FILE *pipe)
+    {
+        int result = pclose(pipe);
+        if (result == -1 || !WIFEXITED(result))
+            return -1;
+        return WEXITSTATUS(result);
+    }
 }
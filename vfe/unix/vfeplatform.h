@@ -70,6 +70,8 @@ namespace vfePlatform
             virtual int CollectCommand(string& output);
             virtual int CollectCommand(void);
             virtual bool CommandPermitted(const string& command, const string& parameters);
+            virtual std::FILE *ExecutePipeCommand(const string& cmd, const string& params);
+            virtual int CollectPipeCommand(std::FILE *pipe);
 
             bool m_ProcessRunning;
             string m_Command;
@@ -306,6 +306,8 @@ void vfeParserMessageHandler::Options(Console *Con, POVMS_Object& Obj, bool cono
 void vfeParserMessageHandler::Statistics(Console *Con, POVMS_Object& Obj, bool conout)
 {
   ParserMessageHandler::Statistics (Con, Obj, conout) ;
+  m_Session->SetPhaseTime (vfeSession::pParse, Obj, kPOVAttrib_ParseTime) ;
+  m_Session->SetPhaseTime (vfeSession::pBounding, Obj, kPOVAttrib_BoundingTime) ;
 }
 
 void vfeParserMessageHandler::Progress(Console *Con, POVMS_Object& Obj, bool verbose)
@@ -439,6 +441,9 @@ void vfeRenderMessageHandler::Options(Console *Con, POVMS_Object& Obj, bool cono
 void vfeRenderMessageHandler::Statistics(Console *Con, POVMS_Object& Obj, bool conout)
 {
   RenderMessageHandler::Statistics (Con, Obj, conout) ;
+  m_Session->SetPhaseTime (vfeSession::pPhotons, Obj, kPOVAttrib_PhotonTime) ;
+  m_Session->SetPhaseTime (vfeSession::pRadiosity, Obj, kPOVAttrib_RadiosityTime) ;
+  m_Session->SetPhaseTime (vfeSession::pTrace, Obj, kPOVAttrib_TraceTime) ;
 }
 
 void vfeRenderMessageHandler::Progress(Console *Con, POVMS_Object& Obj, bool verbose)
@@ -606,6 +611,7 @@ VirtualFrontEnd::VirtualFrontEnd(vfeSession& session, POVMSContext ctx, POVMSAdd
   consoleResult = nullptr;
   displayResult = nullptr;
   m_PauseRequested = m_PausedAfterFrame = false;
+  m_SceneKept = false;
   renderFrontend.ConnectToBackend(backendAddress, msg, result, console);
 }
 
@@ -627,7 +633,10 @@ bool VirtualFrontEnd::Start(POVMS_Object& opts)
 
   m_Session->Clear();
   animationProcessing.reset() ;
+  framePipe.reset();
   m_PauseRequested = m_PausedAfterFrame = false;
+  m_SceneKept = false;
+  m_PipelinedScenes.clear();
   m_PostPauseState = kReady;
 
   Path ip (m_Session->GetInputFilename());
@@ -705,23 +714,26 @@ bool VirtualFrontEnd::Start(POVMS_Object& opts)
     if (m_Session->OutputToFileSet())
     {
       imageProcessing = shared_ptr<ImageProcessing> (new ImageProcessing (opts));
-      UCS2String filename = imageProcessing->GetOutputFilename (opts, 0, 0);
-      options.SetUCS2String (kPOVAttrib_OutputFile, filename.c_str());
+      if (shelloutProcessing->OutputPipeSet() == false)
+      {
+        UCS2String filename = imageProcessing->GetOutputFilename (opts, 0, 0);
+        options.SetUCS2String (kPOVAttrib_OutputFile, filename.c_str());
 
-      if ((imageProcessing->OutputIsStdout() || imageProcessing->OutputIsStderr()) && m_Session->ImageOutputToStdoutSupported() == false)
-        throw POV_EXCEPTION(kCannotOpenFileErr, "Image output to STDOUT/STDERR not supported on this platform");
+        if ((imageProcessing->OutputIsStdout() || imageProcessing->OutputIsStderr()) && m_Session->ImageOutputToStdoutSupported() == false)
+          throw POV_EXCEPTION(kCannotOpenFileErr, "Image output to STDOUT/STDERR not supported on this platform");
 
-      // test access permission now to avoid surprise later after waiting for
-      // the render to complete.
-      if (imageProcessing->OutputIsStdout() == false && imageProcessing->OutputIsStderr() == false && m_Session->TestAccessAllowed(filename, true) == false)
-      {
-        string str ("IO Restrictions prohibit write access to '") ;
-        str += UCS2toASCIIString(filename);
-        str += "'";
-        throw POV_EXCEPTION(kCannotOpenFileErr, str);
+        // test access permission now to avoid surprise later after waiting for
+        // the render to complete.
+        if (imageProcessing->OutputIsStdout() == false && imageProcessing->OutputIsStderr() == false && m_Session->TestAccessAllowed(filename, true) == false)
+        {
+          string str ("IO Restrictions prohibit write access to '") ;
+          str += UCS2toASCIIString(filename);
+          str += "'";
+          throw POV_EXCEPTION(kCannotOpenFileErr, str);
+        }
+        shelloutProcessing->SetOutputFile(UCS2toASCIIString(filename));
+        m_Session->AdviseOutputFilename (filename);
       }
-      shelloutProcessing->SetOutputFile(UCS2toASCIIString(filename));
-      m_Session->AdviseOutputFilename (filename);
     }
   }
   else
@@ -736,6 +748,14 @@ bool VirtualFrontEnd::Start(POVMS_Object& opts)
     options = animationProcessing->GetFrameRenderOptions () ;
   }
 
+  // start the output pipe command now, so that the frames can be streamed to it
+  // as they are rendered instead of being written to output files.
+  if (imageProcessing != nullptr && shelloutProcessing->OutputPipeSet())
+  {
+    framePipe = shared_ptr<FramePipe> (new FramePipe (shelloutProcessing));
+    imageProcessing->SetFramePipe(framePipe);
+  }
+
   state = kStarting;
 
   return true;
@@ -924,6 +944,65 @@ bool VirtualFrontEnd::HandleShelloutCancel()
   return true;
 }
 
+// With Pipeline_Frames set, the scenes of up to that many upcoming frames are parsed
+// while the current frame renders, one after the other. This is not done if frame
+// shellouts are configured, as they may change the scene's input files or skip frames.
+void VirtualFrontEnd::PipelineFrames()
+{
+  int depth = options.TryGetInt(kPOVAttrib_PipelineFrames, 0);
+
+  if ((depth <= 0) || (animationProcessing == nullptr) || (int(m_PipelinedScenes.size()) >= depth))
+    return;
+  if (options.TryGetBool(kPOVAttrib_ReuseScene, false) || options.Exist(kPOVAttrib_PreFrameCommand) || options.Exist(kPOVAttrib_PostFrameCommand))
+    return;
+
+  // only parse one scene at a time, so the current frame keeps most of the cores
+  if (!m_PipelinedScenes.empty() && (renderFrontend.GetSceneState(m_PipelinedScenes.back()) != SceneData::Scene_Ready))
+    return;
+
+  int ahead = int(m_PipelinedScenes.size()) + 1;
+  if (animationProcessing->MoreFrames(ahead - 1) == false)
+    return;
+
+  POVMS_Object frameOptions(animationProcessing->GetFrameRenderOptions(ahead));
+  RenderFrontendBase::SceneId id;
+
+  try { id = renderFrontend.CreateScene(backendAddress, frameOptions, boost::bind(&vfe::VirtualFrontEnd::CreateConsole, this)); }
+  catch(pov_base::Exception&) { return; } // the frame will be parsed in turn instead, reporting any error
+
+  m_PipelinedScenes.push_back(id);
+
+  // a parser that fails to start leaves the scene failed, which is reported when the frame's turn comes
+  try { renderFrontend.StartParser(id, frameOptions); }
+  catch(pov_base::Exception&) { }
+}
+
+// Stop and close the scenes parsed ahead; returns false while some are still parsing.
+bool VirtualFrontEnd::ClosePipelinedScenes()
+{
+  for (std::deque<RenderFrontendBase::SceneId>::iterator i = m_PipelinedScenes.begin(); i != m_PipelinedScenes.end(); )
+  {
+    switch (renderFrontend.GetSceneState(*i))
+    {
+      case SceneData::Scene_Parsing:
+      case SceneData::Scene_Paused:
+        try { renderFrontend.StopParser(*i); } catch (pov_base::Exception&) { }
+        ++i;
+        break;
+
+      case SceneData::Scene_Stopping:
+        ++i;
+        break;
+
+      default:
+        try { renderFrontend.CloseScene(*i); } catch (pov_base::Exception&) { /* Ignore any error here! */ }
+        i = m_PipelinedScenes.erase(i);
+        break;
+    }
+  }
+  return m_PipelinedScenes.empty();
+}
+
 State VirtualFrontEnd::Process()
 {
   if (state == kReady)
@@ -944,7 +1023,7 @@ State VirtualFrontEnd::Process()
             int frameId = animationProcessing->GetNominalFrameNumber();
             int frame = animationProcessing->GetRunningFrameNumber();
             options = animationProcessing->GetFrameRenderOptions ();
-            if (m_Session->OutputToFileSet())
+            if (m_Session->OutputToFileSet() && framePipe == nullptr)
             {
               filename = imageProcessing->GetOutputFilename (options, frameId, animationProcessing->GetFrameNumberDigits());
               options.SetUCS2String (kPOVAttrib_OutputFile, filename.c_str());
@@ -1048,23 +1127,34 @@ State VirtualFrontEnd::Process()
         }
       }
 
-      // now set up the scene in preparation for parsing, then start the parser
-      try { sceneId = renderFrontend.CreateScene(backendAddress, options, boost::bind(&vfe::VirtualFrontEnd::CreateConsole, this)); }
-      catch(pov_base::Exception& e)
+      // now set up the scene in preparation for parsing, then start the parser;
+      // a scene kept from the previous frame is already parsed and ready to render,
+      // and one parsed ahead is already parsing or done
+      if (!m_SceneKept && !m_PipelinedScenes.empty())
       {
-        m_Session->SetFailed();
-        m_Session->AppendErrorMessage (e.what()) ;
-        m_Session->AppendStatusMessage (e.what()) ;
-        return state = kFailed;
+        sceneId = m_PipelinedScenes.front();
+        m_PipelinedScenes.pop_front();
       }
-      try { renderFrontend.StartParser(sceneId, options); }
-      catch(pov_base::Exception& e)
+      else if (!m_SceneKept)
       {
-        m_Session->SetFailed();
-        m_Session->AppendErrorMessage (e.what()) ;
-        m_Session->AppendStatusMessage (e.what()) ;
-        return state = kFailed;
+        try { sceneId = renderFrontend.CreateScene(backendAddress, options, boost::bind(&vfe::VirtualFrontEnd::CreateConsole, this)); }
+        catch(pov_base::Exception& e)
+        {
+          m_Session->SetFailed();
+          m_Session->AppendErrorMessage (e.what()) ;
+          m_Session->AppendStatusMessage (e.what()) ;
+          return state = kFailed;
+        }
+        try { renderFrontend.StartParser(sceneId, options); }
+        catch(pov_base::Exception& e)
+        {
+          m_Session->SetFailed();
+          m_Session->AppendErrorMessage (e.what()) ;
+          m_Session->AppendStatusMessage (e.what()) ;
+          return state = kFailed;
+        }
       }
+      m_SceneKept = false;
       if (m_PauseRequested)
       {
         m_PostPauseState = kParsing;
@@ -1104,7 +1194,17 @@ State VirtualFrontEnd::Process()
             m_Session->AppendStatusMessage (e.what()) ;
             return state = kFailed;
           }
-          try { renderFrontend.StartRender(viewId, options); }
+          try
+          {
+            if (m_Session->OutputToFileSet())
+            {
+              if (animationProcessing != nullptr)
+                imageProcessing->StartStreaming(options, animationProcessing->GetNominalFrameNumber(), animationProcessing->GetFrameNumberDigits());
+              else
+                imageProcessing->StartStreaming(options);
+            }
+            renderFrontend.StartRender(viewId, options);
+          }
           catch(pov_base::Exception& e)
           {
             m_Session->ClearStatusMessages();
@@ -1184,15 +1284,25 @@ State VirtualFrontEnd::Process()
           }
           try
           {
+            if (framePipe != nullptr)
+              imageProcessing->WriteImage(options);
             if (animationProcessing != nullptr)
             {
-              if (m_Session->OutputToFileSet())
+              if (m_Session->OutputToFileSet() && framePipe == nullptr)
+              {
                 m_Session->AdviseOutputFilename (imageProcessing->WriteImage(options, animationProcessing->GetNominalFrameNumber(), animationProcessing->GetFrameNumberDigits()));
+                // the post-frame action may want to process the file, so it must be complete by then
+                if (shelloutProcessing->IsSet(ShelloutProcessing::postFrame))
+                  imageProcessing->FinishWriting();
+              }
               m_Session->AdviseFrameCompleted();
             }
             else
-              if (m_Session->OutputToFileSet())
+              if (m_Session->OutputToFileSet() && framePipe == nullptr)
+              {
                 m_Session->AdviseOutputFilename (imageProcessing->WriteImage(options));
+                imageProcessing->FinishWriting();
+              }
           }
           catch (pov_base::Exception& e)
           {
@@ -1225,6 +1335,11 @@ State VirtualFrontEnd::Process()
 
           return state = kPostFrameShellout;
 
+        case ViewData::View_Rendering:
+          if (state == kRendering)
+            PipelineFrames();
+          break;
+
         default:
           break;
       }
@@ -1263,8 +1378,13 @@ State VirtualFrontEnd::Process()
        */
       try { renderFrontend.CloseView(viewId); }
       catch (pov_base::Exception&) { /* Ignore any error here! */ }
-      try { renderFrontend.CloseScene(sceneId); }
-      catch (pov_base::Exception&) { /* Ignore any error here! */ }
+      if (options.TryGetBool(kPOVAttrib_ReuseScene, false))
+        m_SceneKept = true;
+      else
+      {
+        try { renderFrontend.CloseScene(sceneId); }
+        catch (pov_base::Exception&) { /* Ignore any error here! */ }
+      }
       animationProcessing->ComputeNextFrame();
       if (m_Session->GetPauseWhenDone())
       {
@@ -1304,13 +1424,45 @@ State VirtualFrontEnd::Process()
       return state = kStopped;
 
     case kStopped:
+      if (ClosePipelinedScenes() == false)
+        return state;
       try { renderFrontend.CloseView(viewId); }
       catch (pov_base::Exception&) { /* Ignore any error here! */ }
       try { renderFrontend.CloseScene(sceneId); }
       catch (pov_base::Exception&) { /* Ignore any error here! */ }
       animationProcessing.reset();
+      if (imageProcessing != nullptr)
+      {
+        // complete the output files of the last frames still being written
+        try { imageProcessing->FinishWriting(); }
+        catch (pov_base::Exception& e)
+        {
+          m_Session->AppendErrorAndStatusMessage (e.what());
+          m_Session->SetFailed();
+        }
+      }
       imageProcessing.reset();
 
+      // let the output pipe command finish reading the frames before the post-scene action runs
+      if (framePipe != nullptr)
+      {
+        try
+        {
+          int exitCode = framePipe->Finish();
+          if (exitCode != 0)
+          {
+            m_Session->AppendErrorAndStatusMessage (str(boost::format("Output pipe command exited with code %d") % exitCode));
+            m_Session->SetFailed();
+          }
+        }
+        catch (pov_base::Exception& e)
+        {
+          m_Session->AppendErrorAndStatusMessage (e.what());
+          m_Session->SetFailed();
+        }
+        framePipe.reset();
+      }
+
       // we only run the post-scene or failed action if we have passed the pre-scene point
       // i.e. if we stop before pre-scene, we don't run post-scene
       if (shelloutProcessing->HadPreScene())
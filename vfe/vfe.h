@@ -39,6 +39,7 @@
 #define POVRAY_VFE_VFE_H
 
 #include <cassert>
+#include <deque>
 
 #include <boost/format.hpp>
 #include <boost/bind.hpp>
@@ -242,6 +243,8 @@ namespace vfe
       virtual Display *CreateDisplay(unsigned int width, unsigned int height)
         { return m_Session->CreateDisplay(width, height) ; }
       bool HandleShelloutCancel();
+      void PipelineFrames();
+      bool ClosePipelinedScenes();
 
       RenderFrontend<vfeParserMessageHandler,FileMessageHandler,vfeRenderMessageHandler,ImageMessageHandler> renderFrontend;
       POVMSAddress backendAddress;
@@ -252,12 +255,15 @@ namespace vfe
       shared_ptr<AnimationProcessing> animationProcessing ;
       shared_ptr<ImageProcessing> imageProcessing ;
       shared_ptr<ShelloutProcessing> shelloutProcessing;
+      shared_ptr<FramePipe> framePipe;  // output pipe command the frames are streamed to, if any
       Console **consoleResult;
       Display **displayResult;
       vfeSession* m_Session;
       vfePlatformBase m_PlatformBase;
       bool m_PausedAfterFrame;
       bool m_PauseRequested;
+      bool m_SceneKept;             // parsed scene is kept for the next frame (Reuse_Scene)
+      std::deque<RenderFrontendBase::SceneId> m_PipelinedScenes; // scenes of the next frames, parsed ahead (Pipeline_Frames)
       State m_PostPauseState;
   };
 }
@@ -38,6 +38,8 @@
 #include "backend/frame.h"
 #include "vfe.h"
 
+#include <algorithm>
+
 // this must be the last file included
 #include "syspovdebug.h"
 
@@ -82,7 +84,7 @@ void vfeDisplay::Hide()
 void vfeDisplay::DrawPixel(unsigned int x, unsigned int y, const RGBA8& colour)
 {
   assert (x < GetWidth() && y < GetHeight());
-  m_Pixels[y * GetHeight() + x] = colour;
+  m_Pixels[y * GetWidth() + x] = colour;
 }
 
 void vfeDisplay::DrawRectangleFrame(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const RGBA8& colour)
@@ -95,9 +97,12 @@ void vfeDisplay::DrawFilledRectangle(unsigned int x1, unsigned int y1, unsigned
 
 void vfeDisplay::DrawPixelBlock(unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2, const RGBA8 *colour)
 {
-  for (int y = y1 ; y <= y2; y++)
-    for (int x = x1; x <= x2; x++)
-      DrawPixel (x, y, *colour++) ;
+  assert (x1 <= x2 && x2 < GetWidth() && y1 <= y2 && y2 < GetHeight());
+
+  // copy whole rows rather than going through DrawPixel() for each pixel
+  unsigned int width = x2 - x1 + 1;
+  for (unsigned int y = y1 ; y <= y2; y++, colour += width)
+    std::copy (colour, colour + width, m_Pixels.begin() + y * GetWidth() + x1) ;
 }
 
 void vfeDisplay::Clear()
@@ -112,10 +112,29 @@ void vfeSession::Clear(bool Notify)
   m_CurrentFrameId = 0;
   m_CurrentFrame = 0;
   m_TotalFrames = 0;
+  for (int i = 0; i < pMaxPhase; i++)
+    m_PhaseTimes[i] = PhaseTime();
   if (Notify)
     NotifyEvent(stClear);
 }
 
+// Records the timing of a render phase from a statistics message, if
+// present. Key identifies the elapsed time object within Stats (e.g.
+// kPOVAttrib_ParseTime).
+void vfeSession::SetPhaseTime(PhaseType Phase, POVMS_Object& Stats, POVMSType Key)
+{
+  if (Stats.Exist(Key) == false)
+    return;
+
+  POVMS_Object elapsed;
+  Stats.Get(Key, elapsed);
+  PhaseTime& t = m_PhaseTimes[Phase];
+  t.m_RealTime = elapsed.TryGetLong(kPOVAttrib_RealTime, 0);
+  t.m_MeanRealTime = elapsed.TryGetLong(kPOVAttrib_MeanRealTime, t.m_RealTime);
+  t.m_CPUTime = elapsed.TryGetLong(kPOVAttrib_CPUTime, 0);
+  t.m_Threads = elapsed.TryGetInt(kPOVAttrib_TimeSamples, 1);
+}
+
 // Resets a session - this not only does the same work as vfeSession::Clear
 // (without a stClear notification) but it also empties all the message
 // queues, clears the input and output filenames, clears any animation
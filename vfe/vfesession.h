@@ -442,6 +442,37 @@ namespace vfe
           UCS2String m_Filename;
       } ;
 
+      // Identifies one of the phases of a render for which the core code
+      // reports timing information in its statistics.
+      typedef enum
+      {
+        pParse = 0,
+        pBounding,
+        pPhotons,
+        pRadiosity,
+        pTrace,
+        pMaxPhase
+      } PhaseType ;
+
+      ////////////////////////////////////////////////////////////////////////
+      // struct PhaseTime.
+      //
+      // PhaseTime holds the timing the core code reported for one phase of
+      // the last render, in milliseconds. m_RealTime is the wall-clock time
+      // of the slowest thread working on the phase, and m_MeanRealTime the
+      // average over all m_Threads threads; the difference between the two
+      // is time spent waiting for the last thread to finish. A phase that
+      // did not take place has m_Threads set to 0.
+      struct PhaseTime
+      {
+        PhaseTime() : m_RealTime(0), m_MeanRealTime(0), m_CPUTime(0), m_Threads(0) {}
+
+        POV_LONG m_RealTime;
+        POV_LONG m_MeanRealTime;
+        POV_LONG m_CPUTime;
+        int m_Threads;
+      } ;
+
       // The following queues are used to hold messages collected from the
       // core code via vfeSession's worker thread.
       typedef std::queue<GenericMessage> GenericQueue;
@@ -710,6 +741,11 @@ namespace vfe
       // one render progress message has been received from the backend.
       virtual int GetTotalPixels() const { return m_TotalPixels; }
 
+      // Returns the timing of the given phase of the last render. This is
+      // only valid once the render statistics have been received, i.e. once
+      // the render has completed; it is reset by Clear().
+      virtual const PhaseTime& GetPhaseTime(PhaseType Phase) const { return m_PhaseTimes[Phase]; }
+
       ////////////////////////////////////////////////////////////////////////
       // Return an absolute path including trailing path separator.
       // *nix platforms might want to just return "/tmp/" here.
@@ -1124,6 +1160,7 @@ namespace vfe
       virtual void SetRenderingAnimation();
       virtual void SetPercentComplete(int Percent) { m_PercentComplete = Percent; }
       virtual void SetPixelsRendered(int Rendered, int Total) { m_PixelsRendered = Rendered; m_TotalPixels = Total; }
+      virtual void SetPhaseTime(PhaseType Phase, POVMS_Object& Stats, POVMSType Key);
 
       virtual void AppendStreamMessage (MessageType type, const char *message, bool chompLF = false);
       virtual void AppendStreamMessage (MessageType type, const boost::format& fmt, bool chompLF = false);
@@ -1231,6 +1268,7 @@ namespace vfe
       int m_CurrentFrameId;
       int m_CurrentFrame;
       int m_TotalFrames;
+      PhaseTime m_PhaseTimes[pMaxPhase];
       bool m_Failed;
       bool m_Succeeded;
       bool m_HadErrorMessage;
@@ -72,6 +72,7 @@ CodemaxLanguage LangINI =
   "Bounding_Method\n"
   "Bounding_Threshold\n"
   "BSP_BaseAccessCost\n"
+  "BSP_Cache_File\n"
   "BSP_ChildAccessCost\n"
   "BSP_ISectCost\n"
   "BSP_MaxDepth\n"
@@ -82,6 +83,7 @@ CodemaxLanguage LangINI =
   "Clockless_Animation\n"
   "Compression\n"
   "Continue_Trace\n"
+  "Cost_Map\n"
   "Create_Histogram\n"
   "Create_Ini\n"
   "Cyclic_Animation\n"
@@ -93,6 +95,7 @@ CodemaxLanguage LangINI =
   "Draw_Vistas\n"
   "End_Column\n"
   "End_Row\n"
+  "Event_Trace_File\n"
   "Fatal_Console\n"
   "Fatal_Error_Command\n"
   "Fatal_Error_Return\n"
@@ -108,7 +111,9 @@ CodemaxLanguage LangINI =
   "Initial_Clock\n"
   "Initial_Frame\n"
   "Input_File_Name\n"
+  "Include_Cache_Path\n"
   "Include_Header\n"
+  "Incremental_Animation\n"
   "Include_Ini\n"
   "Jitter_Amount\n"
   "Jitter\n"
@@ -120,7 +125,9 @@ CodemaxLanguage LangINI =
   "Output_File_Type\n"
   "Output_To_File\n"
   "Palette\n"
+  "Parse_Profile\n"
   "Pause_When_Done\n"
+  "Pipeline_Frames\n"
   "Post_Frame_Command\n"
   "Post_Frame_Return\n"
   "Post_Scene_Command\n"
@@ -140,16 +147,22 @@ CodemaxLanguage LangINI =
   "Render_Block_Size\n"
   "Render_Console\n"
   "Render_File\n"
+  "Render_Node\n"
+  "Render_Nodes\n"
+  "Reuse_Scene\n"
   "Sampling_Method\n"
   "Split_Unions\n"
   "Start_Column\n"
   "Start_Row\n"
   "Statistic_Console\n"
   "Statistic_File\n"
+  "Stream_Output\n"
   "Subset_End_Frame\n"
   "Subset_Start_Frame\n"
   "Test_Abort_Count\n"
   "Test_Abort\n"
+  "Thread_Affinity\n"
+  "Tiled_Output\n"
   "User_Abort_Command\n"
   "User_Abort_Return\n"
   "Verbose\n"
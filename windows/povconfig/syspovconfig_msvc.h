@@ -230,6 +230,8 @@
     #define TRY_OPTIMIZED_NOISE_AVX_PORTABLE    // AVX-only compiler-optimized noise.
     #define TRY_OPTIMIZED_NOISE_AVX             // AVX-only hand-optimized noise (Intel).
     #define TRY_OPTIMIZED_NOISE_AVXFMA4         // AVX/FMA4 hand-optimized noise (AMD).
+    #define TRY_OPTIMIZED_BVH                   // optimized bounding hierarchy master switch.
+    #define TRY_OPTIMIZED_BVH_AVX               // AVX flattened bounding hierarchy node test.
 #endif
 
 #if _MSC_VER >= 1900
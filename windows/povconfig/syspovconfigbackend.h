@@ -44,5 +44,6 @@
 // On the Windows platform, we're doing some special mojo at thread startup.
 #define POV_USE_DEFAULT_TASK_INITIALIZE 0
 #define POV_USE_DEFAULT_TASK_CLEANUP    0
+#define POV_USE_DEFAULT_TASK_AFFINITY   0
 
 #endif // POVRAY_WINDOWS_SYSPOVCONFIGBACKEND_H